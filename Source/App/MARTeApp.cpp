@@ -75,6 +75,8 @@ int main(int argc, char **argv) {
 
     ConfigurationDatabase loaderParameters;
     StreamI *configurationStream = NULL_PTR(StreamI *);
+    StreamI **configurationFragments = NULL_PTR(StreamI **);
+    uint32 numberOfConfigurationFragments = 0u;
 
     if (ret) {
         ret = bootstrap.ReadParameters(argc, argv, loaderParameters);
@@ -88,6 +90,12 @@ int main(int argc, char **argv) {
         else {
             REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not GetConfigurationStream.");
         }
+        if (ret) {
+            ret = bootstrap.GetConfigurationFragments(loaderParameters, configurationFragments, numberOfConfigurationFragments);
+            if (!ret) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not GetConfigurationFragments.");
+            }
+        }
     }
     else {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not ReadParameters.");
@@ -106,6 +114,7 @@ int main(int argc, char **argv) {
     if (ret) {
         loaderRef = Reference(loaderClass.Buffer(), GlobalObjectsDatabase::Instance()->GetStandardHeap());
         if (loaderRef.IsValid()) {
+            loaderRef->SetConfigurationFragments(configurationFragments, numberOfConfigurationFragments);
             ret = loaderRef->Configure(loaderParameters, *configurationStream);
             if (!ret) {
                 REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not Initialise the loader with name %s", loaderClass.Buffer());
@@ -0,0 +1,417 @@
+/**
+ * @file ApplicationBenchmarks.cpp
+ * @brief Source file for module ApplicationBenchmarks
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module ApplicationBenchmarks (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "ApplicationBenchmarks.h"
+#include "ConfigurationDatabase.h"
+#include "GAM.h"
+#include "HeapManager.h"
+#include "HighResolutionTimer.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "Sleep.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief GAM of the synthetic chain: writes each input signal plus one in the corresponding output signal
+ * (the first GAM of the chain has no inputs and writes the cycle number).
+ */
+class BenchmarkChainGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    BenchmarkChainGAM() :
+            GAM() {
+        counter = 0u;
+    }
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~BenchmarkChainGAM() {
+    }
+
+    /**
+     * @brief Checks that there are as many input signals (if any) as output signals, all uint32 scalars.
+     * @return true if the signals are valid.
+     */
+    virtual bool Setup() {
+        uint32 numberOfInputs = GetNumberOfInputSignals();
+        uint32 numberOfOutputs = GetNumberOfOutputSignals();
+        bool ok = (numberOfOutputs > 0u) && ((numberOfInputs == 0u) || (numberOfInputs == numberOfOutputs));
+        uint32 i;
+        for (i = 0u; (i < numberOfInputs) && (ok); i++) {
+            ok = (GetSignalType(InputSignals, i) == UnsignedInteger32Bit);
+        }
+        for (i = 0u; (i < numberOfOutputs) && (ok); i++) {
+            ok = (GetSignalType(OutputSignals, i) == UnsignedInteger32Bit);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The signals shall be uint32 and there shall be as many inputs (if any) as outputs");
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Writes the outputs.
+     * @return true.
+     */
+    virtual bool Execute() {
+        uint32 numberOfInputs = GetNumberOfInputSignals();
+        uint32 numberOfOutputs = GetNumberOfOutputSignals();
+        counter++;
+        uint32 i;
+        for (i = 0u; i < numberOfOutputs; i++) {
+            uint32 *output = static_cast<uint32 *>(GetOutputSignalMemory(i));
+            if (numberOfInputs > 0u) {
+                *output = *static_cast<uint32 *>(GetInputSignalMemory(i)) + 1u;
+            }
+            else {
+                *output = counter;
+            }
+        }
+        return true;
+    }
+
+private:
+
+    /**
+     * Number of cycles executed.
+     */
+    uint32 counter;
+};
+
+/**
+ * @brief Last GAM of the synthetic applications: measures the time between consecutive cycles.
+ * @details The last MaxSamples cycle times are kept.
+ */
+class BenchmarkClockGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    BenchmarkClockGAM() :
+            GAM() {
+        cycleTicks = NULL_PTR(uint64 *);
+        maxSamples = 0u;
+        numberOfCycles = 0u;
+        firstTicks = 0u;
+        lastTicks = 0u;
+    }
+
+    /**
+     * @brief Destructor. Frees the samples.
+     */
+    virtual ~BenchmarkClockGAM() {
+        if (cycleTicks != NULL_PTR(uint64 *)) {
+            void *mem = reinterpret_cast<void *>(cycleTicks);
+            (void) HeapManager::Free(mem);
+        }
+    }
+
+    /**
+     * @brief Reads MaxSamples and allocates the samples.
+     * @return true if MaxSamples > 0 and the samples could be allocated.
+     */
+    virtual bool Initialise(StructuredDataI &data) {
+        bool ok = GAM::Initialise(data);
+        if (ok) {
+            ok = data.Read("MaxSamples", maxSamples);
+            if (ok) {
+                ok = (maxSamples > 0u);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "MaxSamples shall be specified and > 0");
+            }
+        }
+        if (ok) {
+            cycleTicks = reinterpret_cast<uint64 *>(HeapManager::Malloc(static_cast<uint32>(sizeof(uint64)) * maxSamples));
+            ok = (cycleTicks != NULL_PTR(uint64 *));
+        }
+        return ok;
+    }
+
+    /**
+     * @brief NOOP.
+     * @return true.
+     */
+    virtual bool Setup() {
+        return true;
+    }
+
+    /**
+     * @brief Stores the time from the previous cycle.
+     * @return true.
+     */
+    virtual bool Execute() {
+        uint64 now = HighResolutionTimer::Counter();
+        if (numberOfCycles == 0u) {
+            firstTicks = now;
+        }
+        else {
+            cycleTicks[(numberOfCycles - 1u) % maxSamples] = now - lastTicks;
+        }
+        lastTicks = now;
+        numberOfCycles++;
+        return true;
+    }
+
+    /**
+     * @brief Gets the number of cycle times measured.
+     * @return the number of cycle times measured.
+     */
+    uint64 GetNumberOfCycleTimes() const {
+        uint64 n = 0u;
+        if (numberOfCycles > 0u) {
+            n = numberOfCycles - 1u;
+        }
+        return n;
+    }
+
+    /**
+     * @brief Gets the number of cycle times kept.
+     * @return the number of cycle times kept.
+     */
+    uint32 GetNumberOfSamples() const {
+        uint64 n = GetNumberOfCycleTimes();
+        if (n > maxSamples) {
+            n = maxSamples;
+        }
+        return static_cast<uint32>(n);
+    }
+
+    /**
+     * @brief Gets one of the cycle times kept.
+     * @param[in] idx the sample index (< GetNumberOfSamples()).
+     * @return the cycle time in ticks.
+     */
+    uint64 GetSample(const uint32 idx) const {
+        return cycleTicks[idx];
+    }
+
+    /**
+     * @brief Gets the time elapsed from the first to the last cycle.
+     * @return the time in ticks.
+     */
+    uint64 GetElapsedTicks() const {
+        return lastTicks - firstTicks;
+    }
+
+private:
+
+    /**
+     * The last maxSamples cycle times (circular buffer).
+     */
+    uint64 *cycleTicks;
+
+    /**
+     * Size of cycleTicks.
+     */
+    uint32 maxSamples;
+
+    /**
+     * Number of cycles executed.
+     */
+    uint64 numberOfCycles;
+
+    /**
+     * Counter at the first cycle.
+     */
+    uint64 firstTicks;
+
+    /**
+     * Counter at the last cycle.
+     */
+    uint64 lastTicks;
+};
+
+CLASS_REGISTER(BenchmarkChainGAM, "1.0")
+CLASS_REGISTER(BenchmarkClockGAM, "1.0")
+
+}
+
+namespace {
+
+/**
+ * The applications executed when the size is not given (number of GAMs, number of signals).
+ */
+const MARTe::uint32 DEFAULT_APPLICATIONS[][2] = { { 1u, 1u }, { 4u, 16u }, { 16u, 64u }, { 64u, 16u } };
+
+/**
+ * @brief Writes the configuration of a chain of \a numberOfGAMs GAMs with \a numberOfSignals signals each.
+ */
+void WriteConfiguration(MARTe::StreamString &config,
+                        const MARTe::uint32 numberOfGAMs,
+                        const MARTe::uint32 numberOfSignals,
+                        const MARTe::uint32 maxSamples) {
+    using namespace MARTe;
+    (void) config.Printf("%s", "$Benchmark = { Class = RealTimeApplication +Functions = { Class = ReferenceContainer ");
+    uint32 g;
+    uint32 s;
+    for (g = 0u; g < numberOfGAMs; g++) {
+        (void) config.Printf("+G%u = { Class = BenchmarkChainGAM ", g);
+        if (g > 0u) {
+            (void) config.Printf("%s", "InputSignals = { ");
+            for (s = 0u; s < numberOfSignals; s++) {
+                (void) config.Printf("S%u_%u = { Type = uint32 } ", g - 1u, s);
+            }
+            (void) config.Printf("%s", "} ");
+        }
+        (void) config.Printf("%s", "OutputSignals = { ");
+        for (s = 0u; s < numberOfSignals; s++) {
+            (void) config.Printf("S%u_%u = { Type = uint32 } ", g, s);
+        }
+        (void) config.Printf("%s", "} } ");
+    }
+    (void) config.Printf("+Clock = { Class = BenchmarkClockGAM MaxSamples = %u InputSignals = { S%u_0 = { Type = uint32 } } } } ", maxSamples,
+                         numberOfGAMs - 1u);
+    (void) config.Printf("%s", "+Data = { Class = ReferenceContainer DefaultDataSource = DDB +DDB = { Class = GAMDataSource } ");
+    (void) config.Printf("%s", "+Timings = { Class = TimingDataSource } } ");
+    (void) config.Printf("%s", "+States = { Class = ReferenceContainer +Run = { Class = RealTimeState +Threads = { Class = ReferenceContainer ");
+    (void) config.Printf("%s", "+Thread = { Class = RealTimeThread Functions = { ");
+    for (g = 0u; g < numberOfGAMs; g++) {
+        (void) config.Printf("G%u ", g);
+    }
+    (void) config.Printf("%s", "Clock } } } } } +Scheduler = { Class = GAMScheduler TimingDataSource = Timings } }");
+}
+
+/**
+ * @brief Configures, executes and measures one synthetic application.
+ */
+bool RunApplication(MARTe::BenchmarkRunner &runner,
+                    const MARTe::uint32 numberOfGAMs,
+                    const MARTe::uint32 numberOfSignals,
+                    const MARTe::float32 duration) {
+    using namespace MARTe;
+    StreamString name;
+    (void) name.Printf("Application.%ux%u", numberOfGAMs, numberOfSignals);
+    bool ok = true;
+    if (runner.IsSelected(name.Buffer())) {
+        StreamString config;
+        WriteConfiguration(config, numberOfGAMs, numberOfSignals, runner.GetMaxSamples());
+        (void) config.Seek(0ull);
+        ConfigurationDatabase cdb;
+        StandardParser parser(config, cdb);
+        ok = parser.Parse();
+        ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+        if (ok) {
+            ok = god->Initialise(cdb);
+        }
+        ReferenceT<RealTimeApplication> application;
+        if (ok) {
+            application = god->Find("Benchmark");
+            ok = application.IsValid();
+        }
+        if (ok) {
+            ok = application->ConfigureApplication();
+        }
+        if (ok) {
+            ok = application->PrepareNextState("Run");
+        }
+        if (ok) {
+            ok = application->StartNextStateExecution();
+        }
+        if (ok) {
+            Sleep::Sec(duration);
+            ok = application->StopCurrentStateExecution();
+        }
+        ReferenceT<BenchmarkClockGAM> clock;
+        if (ok) {
+            clock = god->Find("Benchmark.Functions.Clock");
+            ok = clock.IsValid();
+        }
+        if (ok) {
+            float64 period = HighResolutionTimer::Period();
+            runner.Begin(name.Buffer(), "us");
+            uint32 numberOfSamples = clock->GetNumberOfSamples();
+            uint32 i;
+            for (i = 0u; i < numberOfSamples; i++) {
+                runner.AddSample(static_cast<float64>(clock->GetSample(i)) * period * 1e6);
+            }
+            //Each GAM writes all its signals and reads all the signals of the previous one; the clock reads one signal
+            float64 copiesPerCycle = static_cast<float64>(((2u * numberOfGAMs) - 1u) * numberOfSignals) + 1.0;
+            float64 elapsed = static_cast<float64>(clock->GetElapsedTicks()) * period;
+            float64 throughput = 0.0;
+            if (elapsed > 0.0) {
+                throughput = (copiesPerCycle * static_cast<float64>(clock->GetNumberOfCycleTimes())) / elapsed;
+            }
+            runner.End(throughput, "copies/s");
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "%s failed", name.Buffer());
+        }
+        god->Purge();
+    }
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace ApplicationBenchmarks {
+
+bool Run(BenchmarkRunner &runner,
+         const uint32 numberOfGAMs,
+         const uint32 numberOfSignals,
+         const float32 duration) {
+    bool ok = true;
+    if ((numberOfGAMs > 0u) && (numberOfSignals > 0u)) {
+        ok = RunApplication(runner, numberOfGAMs, numberOfSignals, duration);
+    }
+    else {
+        uint32 numberOfApplications = static_cast<uint32>(sizeof(DEFAULT_APPLICATIONS) / sizeof(DEFAULT_APPLICATIONS[0]));
+        uint32 i;
+        for (i = 0u; (i < numberOfApplications) && (ok); i++) {
+            ok = RunApplication(runner, DEFAULT_APPLICATIONS[i][0], DEFAULT_APPLICATIONS[i][1], duration);
+        }
+    }
+    return ok;
+}
+
+}
+
+}
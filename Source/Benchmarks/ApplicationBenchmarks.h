@@ -0,0 +1,69 @@
+/**
+ * @file ApplicationBenchmarks.h
+ * @brief Header file for module ApplicationBenchmarks
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module ApplicationBenchmarks
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef APPLICATIONBENCHMARKS_H_
+#define APPLICATIONBENCHMARKS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "BenchmarkRunner.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief End-to-end benchmarks of synthetic real-time applications.
+     * @details Each application is a chain of NumberOfGAMs GAMs, each one reading the NumberOfSignals uint32 signals written by the previous GAM through a GAMDataSource, executed by a free running GAMScheduler (i.e. the cycle time is the cost of the brokers copies, of the GAMs and of the scheduler itself).
+     */
+    namespace ApplicationBenchmarks {
+
+        /**
+         * @brief Executes the selected applications benchmarks (named Application.<NumberOfGAMs>x<NumberOfSignals>): the samples
+         * are the cycle times and the throughput is the number of signals copied by the MemoryMapBroker instances per second.
+         * @param[in] runner where the samples are collected.
+         * @param[in] numberOfGAMs the number of GAMs of the application (0 for the default set of applications).
+         * @param[in] numberOfSignals the number of signals of each GAM.
+         * @param[in] duration the time (in seconds) that each application is executed.
+         * @return true if all the selected applications could be configured and executed.
+         */
+        bool Run(BenchmarkRunner &runner,
+                 const uint32 numberOfGAMs,
+                 const uint32 numberOfSignals,
+                 const float32 duration);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* APPLICATIONBENCHMARKS_H_ */
@@ -0,0 +1,174 @@
+/**
+ * @file BenchmarkRunner.cpp
+ * @brief Source file for class BenchmarkRunner
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BenchmarkRunner (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "BenchmarkRunner.h"
+#include "HeapManager.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * @brief qsort comparison function of the samples.
+ */
+int CompareSamples(const void * const a,
+                   const void * const b) {
+    MARTe::float64 va = *static_cast<const MARTe::float64 *>(a);
+    MARTe::float64 vb = *static_cast<const MARTe::float64 *>(b);
+    int ret = 0;
+    if (va < vb) {
+        ret = -1;
+    }
+    else if (va > vb) {
+        ret = 1;
+    }
+    else {
+        ret = 0;
+    }
+    return ret;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+BenchmarkRunner::BenchmarkRunner() {
+    samples = NULL_PTR(float64 *);
+    maxSamples = 0u;
+    numberOfSamples = 0u;
+    numberOfResults = 0u;
+}
+
+BenchmarkRunner::~BenchmarkRunner() {
+    if (samples != NULL_PTR(float64 *)) {
+        void *mem = reinterpret_cast<void *>(samples);
+        (void) HeapManager::Free(mem);
+    }
+}
+
+bool BenchmarkRunner::Initialise(const char8 * const filterIn,
+                                 const uint32 maxSamplesIn) {
+    if (filterIn != NULL_PTR(const char8 *)) {
+        filter = filterIn;
+    }
+    bool ok = (maxSamplesIn > 0u) && (samples == NULL_PTR(float64 *));
+    if (ok) {
+        samples = reinterpret_cast<float64 *>(HeapManager::Malloc(static_cast<uint32>(sizeof(float64)) * maxSamplesIn));
+        ok = (samples != NULL_PTR(float64 *));
+    }
+    if (ok) {
+        maxSamples = maxSamplesIn;
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not allocate %u samples", maxSamplesIn);
+    }
+    return ok;
+}
+
+bool BenchmarkRunner::IsSelected(const char8 * const nameIn) {
+    bool selected = (filter.Size() == 0u);
+    if (!selected) {
+        selected = (StringHelper::SearchString(nameIn, filter.Buffer()) != NULL_PTR(const char8 *));
+    }
+    return selected;
+}
+
+uint32 BenchmarkRunner::GetMaxSamples() const {
+    return maxSamples;
+}
+
+void BenchmarkRunner::Begin(const char8 * const nameIn,
+                            const char8 * const unitIn) {
+    name = nameIn;
+    unit = unitIn;
+    numberOfSamples = 0u;
+}
+
+void BenchmarkRunner::AddSample(const float64 value) {
+    if (numberOfSamples < maxSamples) {
+        samples[numberOfSamples] = value;
+        numberOfSamples++;
+    }
+}
+
+float64 BenchmarkRunner::GetPercentile(const float64 percentile) const {
+    float64 value = 0.0;
+    if (numberOfSamples > 0u) {
+        //Nearest rank
+        uint32 rank = static_cast<uint32>(((percentile * static_cast<float64>(numberOfSamples)) / 100.0) + 0.5);
+        if (rank > 0u) {
+            rank--;
+        }
+        if (rank >= numberOfSamples) {
+            rank = numberOfSamples - 1u;
+        }
+        value = samples[rank];
+    }
+    return value;
+}
+
+void BenchmarkRunner::End(const float64 throughput,
+                          const char8 * const throughputUnit) {
+    float64 mean = 0.0;
+    if (numberOfSamples > 0u) {
+        qsort(samples, static_cast<size_t>(numberOfSamples), sizeof(float64), &CompareSamples);
+        uint32 i;
+        for (i = 0u; i < numberOfSamples; i++) {
+            mean += samples[i];
+        }
+        mean /= static_cast<float64>(numberOfSamples);
+    }
+    if (numberOfResults > 0u) {
+        (void) results.Printf("%s", ",\n");
+    }
+    (void) results.Printf("{\"name\":\"%s\",\"unit\":\"%s\",\"samples\":%u,", name.Buffer(), unit.Buffer(), numberOfSamples);
+    (void) results.Printf("\"mean\":%.3f,\"p50\":%.3f,\"p99\":%.3f,", mean, GetPercentile(50.0), GetPercentile(99.0));
+    (void) results.Printf("\"p999\":%.3f,\"max\":%.3f,", GetPercentile(99.9), GetPercentile(100.0));
+    (void) results.Printf("\"throughput\":%.3f,\"throughputUnit\":\"%s\"}", throughput, throughputUnit);
+    numberOfResults++;
+}
+
+const char8 *BenchmarkRunner::GetResults() {
+    (void) document.SetSize(0ull);
+    (void) document.Printf("{\"benchmarks\":[\n%s\n]}\n", results.Buffer());
+    return document.Buffer();
+}
+
+}
@@ -0,0 +1,183 @@
+/**
+ * @file BenchmarkRunner.h
+ * @brief Header file for class BenchmarkRunner
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BenchmarkRunner
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BENCHMARKRUNNER_H_
+#define BENCHMARKRUNNER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Collects the samples of the benchmarks and writes their statistics as JSON.
+ * @details Each benchmark is executed between Begin and End. The samples added in between are sorted by End, which
+ * appends to the results the number of samples, the mean, the 50th, 99th and 99.9th percentiles, the maximum and
+ * the throughput declared by the benchmark:
+ *
+ * <pre>
+ * {"benchmarks":[
+ *   {"name":"EventSem.WakeLatency","unit":"us","samples":10000,"mean":...,"p50":...,"p99":...,"p999":...,"max":...,
+ *    "throughput":...,"throughputUnit":"wakes/s"},
+ *   ...
+ * ]}
+ * </pre>
+ */
+class BenchmarkRunner {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetMaxSamples() == 0
+     */
+    BenchmarkRunner();
+
+    /**
+     * @brief Destructor. Frees the samples.
+     */
+    ~BenchmarkRunner();
+
+    /**
+     * @brief Allocates the samples and sets the benchmarks to be executed.
+     * @param[in] filterIn only the benchmarks whose name contains this string are executed (NULL or empty for all).
+     * @param[in] maxSamplesIn the maximum number of samples of each benchmark.
+     * @return true if the samples could be allocated.
+     */
+    bool Initialise(const char8 * const filterIn,
+                    const uint32 maxSamplesIn);
+
+    /**
+     * @brief Checks if a benchmark is to be executed.
+     * @param[in] name the name of the benchmark.
+     * @return true if the name of the benchmark matches the filter.
+     */
+    bool IsSelected(const char8 * const name);
+
+    /**
+     * @brief Gets the maximum number of samples of each benchmark.
+     * @return the maximum number of samples.
+     */
+    uint32 GetMaxSamples() const;
+
+    /**
+     * @brief Starts a benchmark (discards the previous samples).
+     * @param[in] name the name of the benchmark.
+     * @param[in] unit the unit of the samples.
+     */
+    void Begin(const char8 * const name,
+               const char8 * const unit);
+
+    /**
+     * @brief Adds a sample to the current benchmark. The samples after GetMaxSamples() are ignored.
+     * @param[in] value the sample.
+     */
+    void AddSample(const float64 value);
+
+    /**
+     * @brief Computes the statistics of the current benchmark and appends them to the results.
+     * @param[in] throughput the throughput of the benchmark.
+     * @param[in] throughputUnit the unit of \a throughput.
+     */
+    void End(const float64 throughput,
+             const char8 * const throughputUnit);
+
+    /**
+     * @brief Gets the results of all the benchmarks executed.
+     * @return the JSON document.
+     */
+    const char8 *GetResults();
+
+private:
+
+    /**
+     * @brief Gets a percentile of the (sorted) samples.
+     * @param[in] percentile the percentile (0 to 100).
+     * @return the value of the percentile.
+     */
+    float64 GetPercentile(const float64 percentile) const;
+
+    /**
+     * Benchmarks whose name does not contain this string are not executed.
+     */
+    StreamString filter;
+
+    /**
+     * The samples of the current benchmark.
+     */
+    float64 *samples;
+
+    /**
+     * Number of samples allocated.
+     */
+    uint32 maxSamples;
+
+    /**
+     * Number of samples of the current benchmark.
+     */
+    uint32 numberOfSamples;
+
+    /**
+     * Name of the current benchmark.
+     */
+    StreamString name;
+
+    /**
+     * Unit of the samples of the current benchmark.
+     */
+    StreamString unit;
+
+    /**
+     * The statistics of the benchmarks executed.
+     */
+    StreamString results;
+
+    /**
+     * Number of benchmarks in the results.
+     */
+    uint32 numberOfResults;
+
+    /**
+     * The JSON document returned by GetResults.
+     */
+    StreamString document;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BENCHMARKRUNNER_H_ */
@@ -0,0 +1,165 @@
+/**
+ * @file MARTeBenchmarks.cpp
+ * @brief Source file for the MARTeBenchmarks executable
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the main function of the MARTeBenchmarks executable.
+ */
+
+/**
+ * @brief Executes the micro-benchmarks of the framework primitives and of synthetic real-time applications and writes
+ * the statistics (see BenchmarkRunner) as JSON, so that the results of different builds can be compared.
+ * @details Usage: MARTeBenchmarks.ex [-b filter] [-n samples] [-t seconds] [-g gams] [-s signals] [-o file]
+ *  - -b only executes the benchmarks whose name contains filter;
+ *  - -n the number of samples of each benchmark (default 1000);
+ *  - -t the time that each synthetic application is executed (default 2 seconds);
+ *  - -g and -s only execute a synthetic application with this number of GAMs and of signals per GAM;
+ *  - -o writes the results to file instead of the console.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ApplicationBenchmarks.h"
+#include "BasicConsole.h"
+#include "BasicFile.h"
+#include "BenchmarkRunner.h"
+#include "PrimitivesBenchmarks.h"
+#include "StringHelper.h"
+#include "TypeConversion.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief The error processing function: prints the messages on the console (except the information and debug messages, which are
+ * printed by every application configured).
+ * @param[in] errorInfo information about the error.
+ * @param[in] errorDescription error textual description.
+ */
+void BenchmarksErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo,
+                                    const char * const errorDescription) {
+    bool print = (errorInfo.header.errorType != MARTe::ErrorManagement::Information);
+    if (print) {
+        print = (errorInfo.header.errorType != MARTe::ErrorManagement::Debug);
+    }
+    if (print) {
+        MARTe::StreamString errorCodeStr;
+        MARTe::ErrorManagement::ErrorCodeToStream(errorInfo.header.errorType, errorCodeStr);
+        MARTe::StreamString err;
+        (void) err.Printf("[%s - %s:%d]: %s\n", errorCodeStr.Buffer(), errorInfo.fileName, errorInfo.header.lineNumber, errorDescription);
+        MARTe::BasicConsole console;
+        if (console.Open(MARTe::BasicConsoleMode::Default)) {
+            MARTe::uint32 size = static_cast<MARTe::uint32>(err.Size());
+            (void) console.Write(err.Buffer(), size);
+            (void) console.Close();
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Main function.
+ * @param[in] argc the number of arguments.
+ * @param[in] argv the arguments (see the file description).
+ * @return 0 if all the benchmarks were executed.
+ */
+int main(int argc, char **argv) {
+    using namespace MARTe;
+    SetErrorProcessFunction(&BenchmarksErrorProcessFunction);
+
+    const char8 *filter = NULL_PTR(const char8 *);
+    const char8 *outputFile = NULL_PTR(const char8 *);
+    uint32 numberOfSamples = 1000u;
+    float32 duration = 2.0F;
+    uint32 numberOfGAMs = 0u;
+    uint32 numberOfSignals = 0u;
+    bool ok = true;
+    int32 i;
+    for (i = 1; (i < (argc - 1)) && (ok); i += 2) {
+        const char8 *option = argv[i];
+        const char8 *value = argv[i + 1];
+        if (StringHelper::Compare(option, "-b") == 0) {
+            filter = value;
+        }
+        else if (StringHelper::Compare(option, "-o") == 0) {
+            outputFile = value;
+        }
+        else if (StringHelper::Compare(option, "-n") == 0) {
+            ok = TypeConvert(numberOfSamples, value);
+        }
+        else if (StringHelper::Compare(option, "-t") == 0) {
+            ok = TypeConvert(duration, value);
+        }
+        else if (StringHelper::Compare(option, "-g") == 0) {
+            ok = TypeConvert(numberOfGAMs, value);
+        }
+        else if (StringHelper::Compare(option, "-s") == 0) {
+            ok = TypeConvert(numberOfSignals, value);
+        }
+        else {
+            ok = false;
+        }
+    }
+    if ((!ok) || (i != argc)) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError,
+                              "Usage: MARTeBenchmarks.ex [-b filter] [-n samples] [-t seconds] [-g gams] [-s signals] [-o file]");
+        ok = false;
+    }
+
+    BenchmarkRunner runner;
+    if (ok) {
+        ok = runner.Initialise(filter, numberOfSamples);
+    }
+    if (ok) {
+        ok = PrimitivesBenchmarks::Run(runner);
+    }
+    if (ok) {
+        ok = ApplicationBenchmarks::Run(runner, numberOfGAMs, numberOfSignals, duration);
+    }
+    if (ok) {
+        const char8 *results = runner.GetResults();
+        uint32 size = StringHelper::Length(results);
+        if (outputFile != NULL_PTR(const char8 *)) {
+            BasicFile file;
+            ok = file.Open(outputFile, BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT | BasicFile::FLAG_TRUNC);
+            if (ok) {
+                ok = file.Write(results, size);
+                (void) file.Close();
+            }
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::OSError, "Could not write the results to %s", outputFile);
+            }
+        }
+        else {
+            BasicConsole console;
+            ok = console.Open(BasicConsoleMode::Default);
+            if (ok) {
+                ok = console.Write(results, size);
+                (void) console.Close();
+            }
+        }
+    }
+    return ok ? 0 : -1;
+}
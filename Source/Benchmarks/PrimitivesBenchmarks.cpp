@@ -0,0 +1,324 @@
+/**
+ * @file PrimitivesBenchmarks.cpp
+ * @brief Source file for module PrimitivesBenchmarks
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module PrimitivesBenchmarks (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "EventSem.h"
+#include "FastPollingMutexSem.h"
+#include "HighResolutionTimer.h"
+#include "PrimitivesBenchmarks.h"
+#include "Sleep.h"
+#include "StreamString.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * Number of operations timed by each sample of the batched benchmarks.
+ */
+const MARTe::uint32 BATCH_SIZE = 256u;
+
+/**
+ * @brief State shared with the helper thread of the contended and wake latency benchmarks.
+ */
+struct HelperState {
+    /**
+     * The semaphore taken by the helper thread (contended benchmark).
+     */
+    MARTe::FastPollingMutexSem mux;
+
+    /**
+     * Posted by the main thread to wake the helper thread (wake latency benchmark).
+     */
+    MARTe::EventSem wakeSem;
+
+    /**
+     * Posted by the helper thread once the wake up was measured.
+     */
+    MARTe::EventSem ackSem;
+
+    /**
+     * High resolution timer counter when wakeSem was posted.
+     */
+    volatile MARTe::int64 postTicks;
+
+    /**
+     * High resolution timer ticks from the post to the wake up.
+     */
+    volatile MARTe::int64 wakeTicks;
+
+    /**
+     * Set to 1 to stop the helper thread.
+     */
+    volatile MARTe::int32 stop;
+
+    /**
+     * Set to 1 by the helper thread when it terminates.
+     */
+    volatile MARTe::int32 done;
+};
+
+/**
+ * @brief Converts high resolution timer ticks to nano-seconds.
+ */
+MARTe::float64 TicksToNanoSeconds(const MARTe::uint64 ticks) {
+    return static_cast<MARTe::float64>(ticks) * MARTe::HighResolutionTimer::Period() * 1e9;
+}
+
+/**
+ * @brief Helper thread of the contended benchmark: takes and releases the semaphore until asked to stop.
+ */
+void ContendedThread(const void * const parameters) {
+    HelperState *state = static_cast<HelperState *>(const_cast<void *>(parameters));
+    while (MARTe::Atomic::LoadAcquire(&state->stop) == 0) {
+        if (state->mux.FastLock()) {
+            state->mux.FastUnLock();
+        }
+    }
+    MARTe::Atomic::StoreRelease(&state->done, 1);
+}
+
+/**
+ * @brief Helper thread of the wake latency benchmark: measures the time from the post of wakeSem to the wake up.
+ */
+void WakeThread(const void * const parameters) {
+    HelperState *state = static_cast<HelperState *>(const_cast<void *>(parameters));
+    while (MARTe::Atomic::LoadAcquire(&state->stop) == 0) {
+        if (state->wakeSem.Wait(MARTe::TTInfiniteWait)) {
+            MARTe::int64 now = static_cast<MARTe::int64>(MARTe::HighResolutionTimer::Counter());
+            state->wakeTicks = now - state->postTicks;
+            (void) state->wakeSem.Reset();
+            (void) state->ackSem.Post();
+        }
+    }
+    MARTe::Atomic::StoreRelease(&state->done, 1);
+}
+
+/**
+ * @brief Waits for the helper thread to terminate.
+ */
+void WaitHelper(HelperState &state) {
+    while (MARTe::Atomic::LoadAcquire(&state.done) == 0) {
+        MARTe::Sleep::MSec(1u);
+    }
+}
+
+/**
+ * @brief Adds the (per operation) samples of a batched benchmark and ends it.
+ */
+void EndBatched(MARTe::BenchmarkRunner &runner,
+                const MARTe::uint64 totalTicks,
+                const MARTe::char8 * const throughputUnit) {
+    MARTe::float64 totalSeconds = TicksToNanoSeconds(totalTicks) / 1e9;
+    MARTe::float64 throughput = 0.0;
+    if (totalSeconds > 0.0) {
+        throughput = static_cast<MARTe::float64>(runner.GetMaxSamples() * BATCH_SIZE) / totalSeconds;
+    }
+    runner.End(throughput, throughputUnit);
+}
+
+/**
+ * @brief Benchmarks the reading of the high resolution timer.
+ */
+void RunCounter(MARTe::BenchmarkRunner &runner) {
+    using namespace MARTe;
+    runner.Begin("HighResolutionTimer.Counter", "ns");
+    uint64 totalTicks = 0u;
+    uint32 s;
+    for (s = 0u; s < runner.GetMaxSamples(); s++) {
+        uint64 start = HighResolutionTimer::Counter();
+        uint32 i;
+        for (i = 0u; i < BATCH_SIZE; i++) {
+            (void) HighResolutionTimer::Counter();
+        }
+        uint64 ticks = HighResolutionTimer::Counter() - start;
+        totalTicks += ticks;
+        runner.AddSample(TicksToNanoSeconds(ticks) / static_cast<float64>(BATCH_SIZE));
+    }
+    EndBatched(runner, totalTicks, "reads/s");
+}
+
+/**
+ * @brief Benchmarks a lock/unlock pair of a FastPollingMutexSem.
+ */
+void RunMutex(MARTe::BenchmarkRunner &runner,
+              const MARTe::char8 * const name,
+              MARTe::FastPollingMutexSem &mux) {
+    using namespace MARTe;
+    runner.Begin(name, "ns");
+    uint64 totalTicks = 0u;
+    uint32 s;
+    for (s = 0u; s < runner.GetMaxSamples(); s++) {
+        uint64 start = HighResolutionTimer::Counter();
+        uint32 i;
+        for (i = 0u; i < BATCH_SIZE; i++) {
+            if (mux.FastLock()) {
+                mux.FastUnLock();
+            }
+        }
+        uint64 ticks = HighResolutionTimer::Counter() - start;
+        totalTicks += ticks;
+        runner.AddSample(TicksToNanoSeconds(ticks) / static_cast<float64>(BATCH_SIZE));
+    }
+    EndBatched(runner, totalTicks, "locks/s");
+}
+
+/**
+ * @brief Benchmarks the wake up of a thread blocked on an EventSem.
+ */
+bool RunWakeLatency(MARTe::BenchmarkRunner &runner,
+                    HelperState &state) {
+    using namespace MARTe;
+    bool ok = (state.wakeSem.Create()) && (state.ackSem.Create());
+    if (ok) {
+        ok = (state.wakeSem.Reset()) && (state.ackSem.Reset());
+    }
+    if (ok) {
+        state.stop = 0;
+        state.done = 0;
+        ok = (Threads::BeginThread(&WakeThread, &state, THREADS_DEFAULT_STACKSIZE, "WakeLatency") != InvalidThreadIdentifier);
+    }
+    if (ok) {
+        runner.Begin("EventSem.WakeLatency", "us");
+        uint64 totalTicks = 0u;
+        uint32 s;
+        for (s = 0u; (s < runner.GetMaxSamples()) && (ok); s++) {
+            //Let the helper thread block on the semaphore
+            Sleep::MSec(1u);
+            (void) state.ackSem.Reset();
+            state.postTicks = static_cast<int64>(HighResolutionTimer::Counter());
+            ok = state.wakeSem.Post();
+            if (ok) {
+                ok = state.ackSem.Wait(1000u);
+            }
+            if (ok) {
+                uint64 ticks = static_cast<uint64>(state.wakeTicks);
+                totalTicks += ticks;
+                runner.AddSample(TicksToNanoSeconds(ticks) / 1e3);
+            }
+        }
+        Atomic::StoreRelease(&state.stop, 1);
+        (void) state.wakeSem.Post();
+        WaitHelper(state);
+        float64 throughput = 0.0;
+        float64 totalSeconds = TicksToNanoSeconds(totalTicks) / 1e9;
+        if (totalSeconds > 0.0) {
+            throughput = static_cast<float64>(runner.GetMaxSamples()) / totalSeconds;
+        }
+        runner.End(throughput, "wakes/s");
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "EventSem.WakeLatency failed");
+    }
+    return ok;
+}
+
+/**
+ * @brief Benchmarks the printing of one value in an IOBuffer (through a StreamString).
+ */
+template<typename T>
+void RunPrintf(MARTe::BenchmarkRunner &runner,
+               const MARTe::char8 * const name,
+               const MARTe::char8 * const format,
+               const T value) {
+    using namespace MARTe;
+    runner.Begin(name, "ns");
+    StreamString output;
+    uint64 totalTicks = 0u;
+    uint32 s;
+    for (s = 0u; s < runner.GetMaxSamples(); s++) {
+        (void) output.SetSize(0ull);
+        uint64 start = HighResolutionTimer::Counter();
+        uint32 i;
+        for (i = 0u; i < BATCH_SIZE; i++) {
+            (void) output.Printf(format, value);
+        }
+        uint64 ticks = HighResolutionTimer::Counter() - start;
+        totalTicks += ticks;
+        runner.AddSample(TicksToNanoSeconds(ticks) / static_cast<float64>(BATCH_SIZE));
+    }
+    EndBatched(runner, totalTicks, "prints/s");
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace PrimitivesBenchmarks {
+
+bool Run(BenchmarkRunner &runner) {
+    bool ok = true;
+    HelperState state;
+    state.postTicks = 0;
+    state.wakeTicks = 0;
+    state.stop = 0;
+    state.done = 0;
+    (void) state.mux.Create();
+    if (runner.IsSelected("HighResolutionTimer.Counter")) {
+        RunCounter(runner);
+    }
+    if (runner.IsSelected("FastPollingMutexSem.Uncontended")) {
+        RunMutex(runner, "FastPollingMutexSem.Uncontended", state.mux);
+    }
+    if (runner.IsSelected("FastPollingMutexSem.Contended")) {
+        ok = (Threads::BeginThread(&ContendedThread, &state, THREADS_DEFAULT_STACKSIZE, "Contended") != InvalidThreadIdentifier);
+        if (ok) {
+            RunMutex(runner, "FastPollingMutexSem.Contended", state.mux);
+            Atomic::StoreRelease(&state.stop, 1);
+            WaitHelper(state);
+        }
+    }
+    if ((ok) && (runner.IsSelected("EventSem.WakeLatency"))) {
+        ok = RunWakeLatency(runner, state);
+    }
+    if (runner.IsSelected("IOBuffer.PrintfInteger")) {
+        RunPrintf(runner, "IOBuffer.PrintfInteger", "%d ", static_cast<int32>(-1234567));
+    }
+    if (runner.IsSelected("IOBuffer.PrintfFloat")) {
+        RunPrintf(runner, "IOBuffer.PrintfFloat", "%.6f ", static_cast<float64>(3.14159265358979));
+    }
+    if (runner.IsSelected("IOBuffer.PrintfString")) {
+        RunPrintf(runner, "IOBuffer.PrintfString", "%s ", "RealTimeApplication");
+    }
+    return ok;
+}
+
+}
+
+}
@@ -0,0 +1,66 @@
+/**
+ * @file PrimitivesBenchmarks.h
+ * @brief Header file for module PrimitivesBenchmarks
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module PrimitivesBenchmarks
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PRIMITIVESBENCHMARKS_H_
+#define PRIMITIVESBENCHMARKS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "BenchmarkRunner.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief Micro-benchmarks of the synchronisation, timing and formatting primitives.
+     * @details Each benchmark times batches of operations, so that the cost of reading the timer is negligible, and adds one sample per batch.
+     */
+    namespace PrimitivesBenchmarks {
+
+        /**
+         * @brief Executes the selected primitives benchmarks:
+         *  - HighResolutionTimer.Counter: cost of reading the high resolution timer;
+         *  - FastPollingMutexSem.Uncontended and FastPollingMutexSem.Contended: cost of a lock/unlock pair, with no other thread and with another thread continuously taking the same semaphore;
+         *  - EventSem.WakeLatency: time from the Post of a semaphore to the return from Wait of the thread blocked on it;
+         *  - IOBuffer.PrintfInteger, IOBuffer.PrintfFloat and IOBuffer.PrintfString: cost of a Printf of one value.
+         * @param[in] runner where the samples are collected.
+         * @return true if all the selected benchmarks could be executed.
+         */
+        bool Run(BenchmarkRunner &runner);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* PRIMITIVESBENCHMARKS_H_ */
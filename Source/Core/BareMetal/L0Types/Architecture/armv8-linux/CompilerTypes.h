@@ -74,6 +74,9 @@ typedef uint32 uintp;
 #define dll_import
 #define dll_export
 
+/** Storage class of the variables that have one instance per thread. */
+#define THREAD_LOCAL __thread
+
 } // namespace MARTe
 
 #endif /* COMPILERTYPESA */
@@ -24,6 +24,10 @@
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
 
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
@@ -36,14 +40,104 @@
 
 namespace MARTe {
 
-static BitSet Longer(const BitSet a, const BitSet b) {
-    BitSet result = a;
-    if (b.GetNumberOfElements() > a.GetNumberOfElements()) {
-        result = b;
+/**
+ * The bitwise operations supported by WordsOperation.
+ */
+enum BitSetWordOperation {
+    BitSetAnd, BitSetOr, BitSetXor
+};
+
+/**
+ * @brief Computes destination[i] = destination[i] op source[i] for i in [0, n[ (four words per NEON instruction when available).
+ */
+static void WordsOperation(uint32 * const destination,
+                           const uint32 * const source,
+                           const uint32 n,
+                           const BitSetWordOperation operation) {
+    uint32 i = 0u;
+    if (operation == BitSetAnd) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+        for (; (i + 4u) <= n; i += 4u) {
+            vst1q_u32(&destination[i], vandq_u32(vld1q_u32(&destination[i]), vld1q_u32(&source[i])));
+        }
+#endif
+        for (; i < n; i++) {
+            destination[i] &= source[i];
+        }
+    }
+    else if (operation == BitSetOr) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+        for (; (i + 4u) <= n; i += 4u) {
+            vst1q_u32(&destination[i], vorrq_u32(vld1q_u32(&destination[i]), vld1q_u32(&source[i])));
+        }
+#endif
+        for (; i < n; i++) {
+            destination[i] |= source[i];
+        }
+    }
+    else {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+        for (; (i + 4u) <= n; i += 4u) {
+            vst1q_u32(&destination[i], veorq_u32(vld1q_u32(&destination[i]), vld1q_u32(&source[i])));
+        }
+#endif
+        for (; i < n; i++) {
+            destination[i] ^= source[i];
+        }
     }
-    return result;
 }
 
+/**
+ * @brief Checks if the words in [0, n[ are all zero.
+ */
+static bool WordsAreZero(const uint32 * const words,
+                         const uint32 n) {
+    uint32 i = 0u;
+    bool zero = true;
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    for (; ((i + 4u) <= n) && (zero); i += 4u) {
+        zero = (vmaxvq_u32(vld1q_u32(&words[i])) == 0u);
+    }
+#endif
+    for (; (i < n) && (zero); i++) {
+        zero = (words[i] == 0u);
+    }
+    return zero;
+}
+
+/**
+ * @brief Packs eight booleans (bytes) in the eight bits of the returned value.
+ */
+static inline uint32 PackEightBooleans(const uint8 * const booleans) {
+    uint64 bytes = 0u;
+    for (uint32 b = 0u; b < 8u; b++) {
+        bytes |= static_cast<uint64>(booleans[b]) << (8u * b);
+    }
+    //Set the most significant bit of every non-zero byte, then gather the eight bits with a multiplication
+    uint64 high = (((bytes & 0x7F7F7F7F7F7F7F7FLLU) + 0x7F7F7F7F7F7F7F7FLLU) | bytes) & 0x8080808080808080LLU;
+    return static_cast<uint32>(((high >> 7u) * 0x0102040810204080LLU) >> 56u);
+}
+
+/**
+ * @brief Unpacks the eight least significant bits of \a bits into eight booleans (bytes with value 0 or 1).
+ */
+static inline void UnpackEightBooleans(const uint32 bits,
+                                       uint8 * const booleans) {
+    //Replicate the byte and isolate bit b in byte b
+    uint64 spread = (static_cast<uint64>(bits & 0xFFu) * 0x0101010101010101LLU) & 0x8040201008040201LLU;
+    spread = ((spread + 0x7F7F7F7F7F7F7F7FLLU) >> 7u) & 0x0101010101010101LLU;
+    for (uint32 b = 0u; b < 8u; b++) {
+        booleans[b] = static_cast<uint8>(spread >> (8u * b));
+    }
+}
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+/**
+ * The weight of each boolean in a group of 8 (used to pack/unpack 16 booleans per NEON instruction).
+ */
+static const uint8 bitSetBooleanWeights[16] = { 1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u, 1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u };
+#endif
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -190,52 +284,21 @@ BitSet::operator uint64() const {
     return v;
 }
 
-/*lint -e{772} -e{9135} newArray correctly initialized and it is not an unary operator!*/
 BitSet BitSet::operator&(const BitSet& rhm) const {
-    uint32 msize = TypeCharacteristics<uint32>::Min(nElements, rhm.nElements); // ? nElements : rhm.nElements;
-    uint32 size = TypeCharacteristics<uint32>::Max(nElements, rhm.nElements); // ? nElements : rhm.nElements;
-    uint32 * newArray = new uint32[size];
-    for (uint32 i = 0u; i < msize; i++) {
-        newArray[i] = array[i] & rhm.array[i];
-    }
-    for (uint32 i = msize; i < size; i++) {
-        newArray[i] = 0u;
-    }
-
-    BitSet res(newArray, size);
-    delete[] newArray;
+    BitSet res(*this);
+    res &= rhm;
     return res;
 }
 
-/*lint -e{772} newArray correctly initialized*/
 BitSet BitSet::operator|(const BitSet& rhm) const {
-    uint32 msize = TypeCharacteristics<uint32>::Min(nElements, rhm.nElements); // ? nElements : rhm.nElements;
-    uint32 size = TypeCharacteristics<uint32>::Max(nElements, rhm.nElements); // nElements : rhm.nElements;
-    uint32 * newArray = new uint32[size];
-    for (uint32 i = 0u; i < msize; i++) {
-        newArray[i] = array[i] | rhm.array[i];
-    }
-    for (uint32 i = msize; i < size; i++) {
-        newArray[i] = Longer(*this, rhm).array[i];
-    }
-    BitSet res(newArray, size);
-    delete[] newArray;
+    BitSet res(*this);
+    res |= rhm;
     return res;
 }
 
-/*lint -e{772} newArray correctly initialized*/
 BitSet BitSet::operator^(const BitSet& rhm) const {
-    uint32 msize = TypeCharacteristics<uint32>::Min(nElements, rhm.nElements); // ? nElements : rhm.nElements;
-    uint32 size = TypeCharacteristics<uint32>::Max(nElements, rhm.nElements); // nElements : rhm.nElements;
-    uint32 * newArray = new uint32[size];
-    for (uint32 i = 0u; i < msize; i++) {
-        newArray[i] = array[i] ^ rhm.array[i];
-    }
-    for (uint32 i = msize; i < size; i++) {
-        newArray[i] = Longer(*this, rhm).array[i];
-    }
-    BitSet res(newArray, size);
-    delete[] newArray;
+    BitSet res(*this);
+    res ^= rhm;
     return res;
 }
 
@@ -252,19 +315,17 @@ BitSet BitSet::operator~() const {
 
 /*lint -e{771} newArray is correctly initialized*/
 BitSet BitSet::operator<<(const uint32& rhm) const {
-    uint32 newSize = nElements + (rhm / 32u) + 1u;
+    uint32 wordShift = rhm / 32u;
+    uint32 bitShift = rhm - (wordShift * 32u);
+    uint32 newSize = nElements + wordShift + 1u;
     uint32 * newArray = new uint32[newSize];
     for (uint32 i = 0u; i < newSize; i++) {
         newArray[i] = 0u;
     }
-    uint32 bitsize = 32u * nElements;
-    for (uint32 i = 0u; i < bitsize; i++) {
-        if (Bit(i)) {
-            uint32 byteIndex = (i + rhm) / 32u;
-            uint32 bitIndex = (i + rhm) - (byteIndex * 32u);
-            if (byteIndex < newSize) {
-                newArray[byteIndex] |= TypeCharacteristics<uint32>::One() << bitIndex;
-            }
+    for (uint32 i = 0u; i < nElements; i++) {
+        newArray[i + wordShift] |= array[i] << bitShift;
+        if (bitShift > 0u) {
+            newArray[i + wordShift + 1u] |= array[i] >> (32u - bitShift);
         }
     }
     BitSet bs(newArray, newSize);
@@ -274,19 +335,18 @@ BitSet BitSet::operator<<(const uint32& rhm) const {
 
 /*lint -e{771} newArray is correctly initialized*/
 BitSet BitSet::operator>>(const uint32& rhm) const {
+    uint32 wordShift = rhm / 32u;
+    uint32 bitShift = rhm - (wordShift * 32u);
     uint32 * newArray = new uint32[nElements];
-    uint32 bitsize = 32u * nElements;
     for (uint32 i = 0u; i < nElements; i++) {
-        newArray[i] = 0u;
-    }
-    for (uint32 i = rhm; i < bitsize; i++) {
-        if (Bit(i)) {
-            uint32 byteIndex = (i - rhm) / 32u;
-            uint32 bitIndex = (i - rhm) - (byteIndex * 32u);
-            if (byteIndex < nElements) {
-                newArray[byteIndex] |= TypeCharacteristics<uint32>::One() << bitIndex;
+        uint32 word = 0u;
+        if ((i + wordShift) < nElements) {
+            word = array[i + wordShift] >> bitShift;
+            if ((bitShift > 0u) && ((i + wordShift + 1u) < nElements)) {
+                word |= array[i + wordShift + 1u] << (32u - bitShift);
             }
         }
+        newArray[i] = word;
     }
     BitSet bs(newArray, nElements);
     delete[] newArray;
@@ -295,18 +355,16 @@ BitSet BitSet::operator>>(const uint32& rhm) const {
 
 bool BitSet::operator==(const BitSet& rhm) const {
     uint32 common = TypeCharacteristics<uint32>::Min(nElements, rhm.nElements); // ? nElements : rhm.nElements;
-    uint32 maxLength = TypeCharacteristics<uint32>::Max(nElements, rhm.nElements); // ? nElements : rhm.nElements;
     bool result = true;
-    for (uint32 i = 0u; i < common; i++) {
-        if (rhm.array[i] != array[i]) {
-            result = false;
-        }
+    for (uint32 i = 0u; (i < common) && (result); i++) {
+        result = (rhm.array[i] == array[i]);
     }
-    if (result && (common < maxLength)) {
-        for (uint32 i = common; i < maxLength; i++) {
-            if (Longer(*this, rhm).array[i] != 0u) {
-                result = false;
-            }
+    if (result) {
+        if (nElements > common) {
+            result = WordsAreZero(&array[common], nElements - common);
+        }
+        else if (rhm.nElements > common) {
+            result = WordsAreZero(&rhm.array[common], rhm.nElements - common);
         }
     }
     return result;
@@ -361,49 +419,29 @@ bool BitSet::operator!=(const uint64& rhm) const {
 }
 
 BitSet & BitSet::operator|=(const BitSet& rhm) {
-    uint32 msize = TypeCharacteristics<uint32>::Min(nElements, rhm.nElements); // ? nElements : rhm.nElements;
-    uint32 size = TypeCharacteristics<uint32>::Max(nElements, rhm.nElements); // ? nElements : rhm.nElements;
-    uint32 * newArray = new uint32[size];
-    for (uint32 i = 0u; i < msize; i++) {
-        newArray[i] = array[i] | rhm.array[i];
-    }
-    for (uint32 i = msize; i < size; i++) {
-        newArray[i] = Longer(*this, rhm).array[i];
+    if (rhm.nElements > nElements) {
+        Resize(rhm.nElements);
     }
-    delete[] array;
-    array = newArray;
-    nElements = size;
+    WordsOperation(array, rhm.array, rhm.nElements, BitSetOr);
     return *this;
 }
+
 BitSet & BitSet::operator&=(const BitSet& rhm) {
-    uint32 msize = TypeCharacteristics<uint32>::Min(nElements, rhm.nElements); // ? nElements : rhm.nElements;
-    uint32 size = TypeCharacteristics<uint32>::Max(nElements, rhm.nElements); // ? nElements : rhm.nElements;
-    uint32 *newArray = new uint32[size];
-    for (uint32 i = 0u; i < msize; i++) {
-        newArray[i] = array[i] & rhm.array[i];
+    if (rhm.nElements > nElements) {
+        Resize(rhm.nElements);
     }
-    for (uint32 i = msize; i < size; i++) {
-        newArray[i] = 0u;
+    WordsOperation(array, rhm.array, rhm.nElements, BitSetAnd);
+    for (uint32 i = rhm.nElements; i < nElements; i++) {
+        array[i] = 0u;
     }
-    delete[] array;
-    array = newArray;
-    nElements = size;
     return *this;
 }
 
 BitSet & BitSet::operator^=(const BitSet& rhm) {
-    uint32 msize = TypeCharacteristics<uint32>::Min(nElements, rhm.nElements); // ? nElements : rhm.nElements;
-    uint32 size = TypeCharacteristics<uint32>::Max(nElements, rhm.nElements); // ? nElements : rhm.nElements;
-    uint32 *newArray = new uint32[size];
-    for (uint32 i = 0u; i < msize; i++) {
-        newArray[i] = array[i] ^ rhm.array[i];
-    }
-    for (uint32 i = msize; i < size; i++) {
-        newArray[i] = Longer(*this, rhm).array[i];
+    if (rhm.nElements > nElements) {
+        Resize(rhm.nElements);
     }
-    delete[] array;
-    array = newArray;
-    nElements = size;
+    WordsOperation(array, rhm.array, rhm.nElements, BitSetXor);
     return *this;
 }
 
@@ -411,5 +449,136 @@ uint32 *BitSet::GetArray() {
     return array;
 }
 
+uint32 BitSet::GetNumberOfSetBits() const {
+    uint32 count = 0u;
+    uint32 i = 0u;
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    for (; (i + 4u) <= nElements; i += 4u) {
+        count += static_cast<uint32>(vaddvq_u8(vcntq_u8(vreinterpretq_u8_u32(vld1q_u32(&array[i])))));
+    }
+#endif
+    for (; i < nElements; i++) {
+        count += static_cast<uint32>(__builtin_popcount(array[i]));
+    }
+    return count;
+}
+
+bool BitSet::FindFirstSet(uint32 &index) const {
+    return FindNextSet(0u, index);
+}
+
+bool BitSet::FindNextSet(const uint32 fromIndex,
+                         uint32 &index) const {
+    uint32 w = fromIndex / 32u;
+    bool found = false;
+    if (w < nElements) {
+        //Mask the bits below fromIndex in the first word
+        uint32 word = array[w] & (0xFFFFFFFFu << (fromIndex - (w * 32u)));
+        found = (word != 0u);
+        w++;
+#if defined(__ARM_NEON) && defined(__aarch64__)
+        //Skip the empty words four at a time
+        while ((!found) && ((w + 4u) <= nElements) && (vmaxvq_u32(vld1q_u32(&array[w])) == 0u)) {
+            w += 4u;
+        }
+#endif
+        while ((!found) && (w < nElements)) {
+            word = array[w];
+            found = (word != 0u);
+            w++;
+        }
+        if (found) {
+            index = ((w - 1u) * 32u) + static_cast<uint32>(__builtin_ctz(word));
+        }
+    }
+    return found;
+}
+
+void BitSet::SetBooleans(const uint8 * const booleans,
+                         const uint32 numberOfBooleans) {
+    uint32 numberOfWords = (numberOfBooleans + 31u) / 32u;
+    if (numberOfWords > nElements) {
+        Resize(numberOfWords);
+    }
+    PackBooleans(booleans, array, numberOfBooleans);
+}
+
+void BitSet::GetBooleans(uint8 * const booleans,
+                         const uint32 numberOfBooleans) const {
+    uint32 available = TypeCharacteristics<uint32>::Min(numberOfBooleans, nElements * 32u);
+    UnpackBooleans(array, booleans, available);
+    for (uint32 i = available; i < numberOfBooleans; i++) {
+        booleans[i] = 0u;
+    }
+}
+
+void BitSet::PackBooleans(const uint8 * const booleans,
+                          uint32 * const words,
+                          const uint32 numberOfBooleans) {
+    uint32 w = 0u;
+    uint32 i = 0u;
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    uint8x16_t weights = vld1q_u8(&bitSetBooleanWeights[0]);
+#endif
+    for (; (i + 32u) <= numberOfBooleans; i += 32u) {
+        uint32 word = 0u;
+#if defined(__ARM_NEON) && defined(__aarch64__)
+        for (uint32 h = 0u; h < 2u; h++) {
+            uint8x16_t v = vld1q_u8(&booleans[i + (16u * h)]);
+            uint8x16_t m = vandq_u8(vtstq_u8(v, v), weights);
+            uint32 bits16 = static_cast<uint32>(vaddv_u8(vget_low_u8(m))) | (static_cast<uint32>(vaddv_u8(vget_high_u8(m))) << 8u);
+            word |= bits16 << (16u * h);
+        }
+#else
+        for (uint32 b = 0u; b < 4u; b++) {
+            word |= PackEightBooleans(&booleans[i + (8u * b)]) << (8u * b);
+        }
+#endif
+        words[w] = word;
+        w++;
+    }
+    if (i < numberOfBooleans) {
+        uint32 word = 0u;
+        for (uint32 b = 0u; (i + b) < numberOfBooleans; b++) {
+            if (booleans[i + b] != 0u) {
+                word |= (1u << b);
+            }
+        }
+        words[w] = word;
+    }
+}
+
+void BitSet::UnpackBooleans(const uint32 * const words,
+                            uint8 * const booleans,
+                            const uint32 numberOfBooleans) {
+    uint32 w = 0u;
+    uint32 i = 0u;
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    uint8x16_t weights = vld1q_u8(&bitSetBooleanWeights[0]);
+    uint8x16_t ones = vdupq_n_u8(1u);
+#endif
+    for (; (i + 32u) <= numberOfBooleans; i += 32u) {
+        uint32 word = words[w];
+#if defined(__ARM_NEON) && defined(__aarch64__)
+        for (uint32 h = 0u; h < 2u; h++) {
+            uint32 bits16 = word >> (16u * h);
+            uint8x16_t v = vcombine_u8(vdup_n_u8(static_cast<uint8>(bits16)), vdup_n_u8(static_cast<uint8>(bits16 >> 8u)));
+            vst1q_u8(&booleans[i + (16u * h)], vandq_u8(vtstq_u8(v, weights), ones));
+        }
+#else
+        for (uint32 b = 0u; b < 4u; b++) {
+            UnpackEightBooleans(word >> (8u * b), &booleans[i + (8u * b)]);
+        }
+#endif
+        w++;
+    }
+    if (i < numberOfBooleans) {
+        uint32 word = words[w];
+        for (uint32 b = 0u; (i + b) < numberOfBooleans; b++) {
+            booleans[i + b] = static_cast<uint8>((word >> b) & 1u);
+        }
+    }
+}
+
 
 }
@@ -256,6 +256,68 @@ public:
      * @brief Access to the internal array.
      */
     uint32 *GetArray();
+
+    /**
+     * @brief Counts the bits set to one (population count).
+     * @return the number of bits set to one.
+     */
+    uint32 GetNumberOfSetBits() const;
+
+    /**
+     * @brief Finds the lowest bit set to one.
+     * @param[out] index the index of the lowest bit set to one.
+     * @return true if at least one bit is set.
+     */
+    bool FindFirstSet(uint32 &index) const;
+
+    /**
+     * @brief Finds the lowest bit set to one with an index greater or equal than \a fromIndex.
+     * @param[in] fromIndex the index where to start the search.
+     * @param[out] index the index of the bit found.
+     * @return true if a bit set to one was found.
+     */
+    bool FindNextSet(const uint32 fromIndex,
+                     uint32 &index) const;
+
+    /**
+     * @brief Sets the first \a numberOfBooleans bits from an array of booleans (one byte per boolean, any value != 0 is true).
+     * @details The bitset is resized if it cannot hold \a numberOfBooleans bits. The bits above \a numberOfBooleans
+     * in the last word written are cleared.
+     * @param[in] booleans the array of booleans.
+     * @param[in] numberOfBooleans the number of elements in \a booleans.
+     */
+    void SetBooleans(const uint8 * const booleans,
+                     const uint32 numberOfBooleans);
+
+    /**
+     * @brief Writes the first \a numberOfBooleans bits in an array of booleans (one byte per boolean with value 0 or 1).
+     * @param[out] booleans the array of booleans.
+     * @param[in] numberOfBooleans the number of elements in \a booleans.
+     */
+    void GetBooleans(uint8 * const booleans,
+                     const uint32 numberOfBooleans) const;
+
+    /**
+     * @brief Packs an array of booleans (one byte per boolean, any value != 0 is true) into 32-bit words.
+     * @details Bit i of the output is word[i / 32] bit (i % 32). The bits above \a numberOfBooleans in the last word are cleared.
+     * It may be used directly on bit-packed signal memory.
+     * @param[in] booleans the array of booleans.
+     * @param[out] words the output words. Shall have at least (numberOfBooleans + 31) / 32 elements.
+     * @param[in] numberOfBooleans the number of elements in \a booleans.
+     */
+    static void PackBooleans(const uint8 * const booleans,
+                             uint32 * const words,
+                             const uint32 numberOfBooleans);
+
+    /**
+     * @brief Unpacks 32-bit words into an array of booleans (one byte per boolean with value 0 or 1).
+     * @param[in] words the bit-packed words.
+     * @param[out] booleans the array of booleans.
+     * @param[in] numberOfBooleans the number of bits to unpack.
+     */
+    static void UnpackBooleans(const uint32 * const words,
+                               uint8 * const booleans,
+                               const uint32 numberOfBooleans);
 private:
 
 
@@ -43,6 +43,11 @@ namespace MARTe {
  *
  * The CRC table shall be pre-computed by calling ComputeTable. The initial CRC value shall be set using SetInitialCRC, otherwise zero is assumed.
  *
+ * The data can either be given at once (Compute) or in consecutive buffers (SetInitialCRC, Update and GetCRC). Eight bytes are
+ * processed in each step (slice-by-8), using eight lookup tables where the table k holds the CRC of a byte followed by k zero bytes.
+ *
+ * For the standard reflected CRC-32 and CRC-32C, which may be computed by the processor, see the CRC32 module.
+ *
  * The implementation is based on the algorithm implementation described in http://www.sunshine2k.de/articles/coding/crc/understanding_crc.html
  * and on https://github.com/meetanthony/crcjava
  */
@@ -76,12 +81,44 @@ public:
      */
     T Compute(const uint8 * const data, int32 size, T initCRC, bool inputInverted) const;
 
+    /**
+     * @brief Sets the value of the running CRC used by Update.
+     * @param[in] initCRC the initial CRC value.
+     */
+    void SetInitialCRC(const T initCRC);
+
+    /**
+     * @brief Adds \a size bytes to the running CRC.
+     * @details Calling Update for consecutive buffers gives the same CRC as calling Compute once for the concatenation of all the buffers.
+     * @param[in] data the bytes to add to the CRC.
+     * @param[in] size the number of bytes in \a data.
+     * @pre
+     *   ComputeTable was called.
+     */
+    void Update(const uint8 * const data, const uint32 size);
+
+    /**
+     * @brief Gets the running CRC value.
+     * @return the CRC of all the bytes given to Update since the last SetInitialCRC.
+     */
+    T GetCRC() const;
+
 private:
     /**
-     * Lookup table for a given polynomial divisor.
+     * @brief Computes the CRC of \a size bytes in \a data (forward order), eight bytes at a time.
+     */
+    T ComputeForward(const uint8 *data, uint32 size, T crc) const;
+
+    /**
+     * Lookup tables (8 x 256) for a given polynomial divisor.
      */
     T *crcTable;
 
+    /**
+     * The running CRC value (see Update).
+     */
+    T currentCRC;
+
     /**
      * The type dependent mask
      */
@@ -107,6 +144,7 @@ namespace MARTe {
 template<typename T>
 CRC<T>::CRC() {
     crcTable = NULL_PTR(T *);
+    currentCRC = static_cast<T>(0u);
     mask = 1u;
     mask = mask << ((sizeof(T) * 8u) - 1u); //0x80 for uint8, 0x8000 for uint16 ...
     maskInv = 0xFFFFFFFFu;
@@ -132,7 +170,7 @@ void CRC<T>::ComputeTable(const T pol) {
         delete[] crcTable;
         crcTable = NULL_PTR(T *);
     }
-    crcTable = new T[256u];
+    crcTable = new T[2048u];
 
     uint32 d; //divisor
     for (d = 0u; d < 256u; d++) {
@@ -152,25 +190,90 @@ void CRC<T>::ComputeTable(const T pol) {
 
         crcTable[d] = curByte;
     }
+    //Table k is the table k - 1 followed by one more zero byte
+    uint32 k;
+    for (k = 1u; k < 8u; k++) {
+        for (d = 0u; d < 256u; d++) {
+            T prev = crcTable[((k - 1u) * 256u) + d];
+            uint8 pos = static_cast<uint8>((prev >> shift) & 0xFFu);
+            T next = static_cast<T>(static_cast<T>(crcTable[pos]) ^ (prev << 8u));
+            next &= maskInv;
+            crcTable[(k * 256u) + d] = next;
+        }
+    }
 }
 
 template<typename T>
 T CRC<T>::Compute(const uint8 * const data, const int32 size, T initCRC, const bool inputInverted) const {
     using namespace MARTe;
-    int32 b;
     T crc = initCRC;
 
-    for (b = 0; b < size; b++) {
+    if (!inputInverted) {
+        if (size > 0) {
+            crc = ComputeForward(data, static_cast<uint32>(size), crc);
+        }
+    }
+    else {
+        int32 b;
+        for (b = 0; b < size; b++) {
+
+            uint8 pos = static_cast<uint8>(((crc >> shift) ^ data[-b]) & 0xFF);
+            /*lint -e{613} crcTable is not NULL if pre-condition is met*/
+            crc = static_cast<T>(static_cast<T>(crcTable[pos]) ^ (crc << 8u));
+            crc &= maskInv;
+        }
+    }
 
-        uint8 pos = static_cast<uint8>(((crc >> shift) ^ data[inputInverted ? -b : b]) & 0xFF);
+    return crc;
+}
+
+template<typename T>
+T CRC<T>::ComputeForward(const uint8 *data, uint32 size, T crc) const {
+    const uint32 nBytes = static_cast<uint32>(sizeof(T));
+    while (size >= 8u) {
+        uint8 block[8];
+        uint32 j;
+        for (j = 0u; j < 8u; j++) {
+            block[j] = data[j];
+        }
+        //The CRC register (at most 8 bytes) is combined with the first bytes of the block, most significant first
+        for (j = 0u; (j < nBytes) && (j < 8u); j++) {
+            block[j] ^= static_cast<uint8>((crc >> (shift - (8u * j))) & 0xFFu);
+        }
+        crc = static_cast<T>(0u);
+        for (j = 0u; j < 8u; j++) {
+            /*lint -e{613} crcTable is not NULL if pre-condition is met*/
+            crc ^= crcTable[((7u - j) * 256u) + block[j]];
+        }
+        data = &data[8];
+        size -= 8u;
+    }
+    while (size > 0u) {
+        uint8 pos = static_cast<uint8>(((crc >> shift) ^ *data) & 0xFF);
         /*lint -e{613} crcTable is not NULL if pre-condition is met*/
         crc = static_cast<T>(static_cast<T>(crcTable[pos]) ^ (crc << 8u));
         crc &= maskInv;
+        data = &data[1];
+        size--;
     }
-
     return crc;
 }
 
+template<typename T>
+void CRC<T>::SetInitialCRC(const T initCRC) {
+    currentCRC = initCRC;
+}
+
+template<typename T>
+void CRC<T>::Update(const uint8 * const data, const uint32 size) {
+    currentCRC = ComputeForward(data, size, currentCRC);
+}
+
+template<typename T>
+T CRC<T>::GetCRC() const {
+    return currentCRC;
+}
+
 }
 
 #endif /* SOURCE_CORE_BAREMETAL_L0TYPES_CRC_H_ */
@@ -207,6 +207,10 @@ void LinkedListHolder::ListBSort(SortFilter * const sorter) {
     llhRoot.BSort(sorter);
 }
 
+void LinkedListHolder::ListSort(SortFilter * const sorter) {
+    llhRoot.MSort(sorter);
+}
+
 LinkedListable *LinkedListHolder::ListPeek(const uint32 index) {
     return (llhRoot.Next() == NULL) ? (NULL_PTR(LinkedListable *)) : (llhRoot.Next()->Peek(index));
 }
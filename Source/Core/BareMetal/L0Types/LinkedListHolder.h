@@ -203,6 +203,14 @@ public:
      */
     void ListBSort(SortFilter * const sorter);
 
+    /**
+     * @brief Sorts the elements in the list using a SortFilter, with O(n log n) comparisons (see LinkedListable::MSort).
+     * @details Many elements are best inserted unsorted (e.g. with FastListInsertSingle, in constant time each) and then
+     * sorted once, rather than each inserted in its sorted position (which is quadratic on the number of elements).
+     * @param[in] sorter defines the comparison criteria.
+     */
+    void ListSort(SortFilter * const sorter);
+
     /**
      * @brief Browses the list.
      * @param[in] index the position of the requested element (0 means the first element).
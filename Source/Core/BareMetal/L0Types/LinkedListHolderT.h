@@ -153,6 +153,11 @@ public:
      */
     inline void ListBSort(SortFilter * const sorter);
 
+    /**
+     * @brief @see LinkedListHolder::ListSort()
+     */
+    inline void ListSort(SortFilter * const sorter);
+
     /**
      * @brief @see LinkedListHolder::ListPeek()
      */
@@ -280,6 +285,11 @@ void LinkedListHolderT<T, canDestroy>::ListBSort(SortFilter * const sorter) {
     LinkedListHolder::ListBSort(sorter);
 }
 
+template <class T, bool canDestroy>
+void LinkedListHolderT<T, canDestroy>::ListSort(SortFilter * const sorter) {
+    LinkedListHolder::ListSort(sorter);
+}
+
 template <class T, bool canDestroy>
 T *LinkedListHolderT<T, canDestroy>::ListPeek(const uint32 index) {
     return static_cast<T*>(LinkedListHolder::ListPeek(index));
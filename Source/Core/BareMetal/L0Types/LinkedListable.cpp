@@ -115,6 +115,60 @@ void LinkedListable::BSort(SortFilter * const sorter) {
     }
 }
 
+void LinkedListable::MSort(SortFilter * const sorter) {
+
+    if ((sorter != NULL) && (next != NULL)) {
+        uint32 runSize = 1u;
+        bool sorted = false;
+        while (!sorted) {
+            //Merges each pair of consecutive runs of runSize elements
+            LinkedListable *p = next;
+            LinkedListable *tail = this;
+            uint32 numberOfMerges = 0u;
+            while (p != NULL) {
+                numberOfMerges++;
+                LinkedListable *q = p;
+                uint32 pSize = 0u;
+                while ((pSize < runSize) && (q != NULL)) {
+                    pSize++;
+                    q = q->next;
+                }
+                uint32 qSize = runSize;
+                while ((pSize > 0u) || ((qSize > 0u) && (q != NULL))) {
+                    bool takeP;
+                    if (pSize == 0u) {
+                        takeP = false;
+                    }
+                    else if ((qSize == 0u) || (q == NULL)) {
+                        takeP = true;
+                    }
+                    else {
+                        //The first run wins on equal elements, so that the sort is stable
+                        takeP = (sorter->Compare(p, q) <= 0);
+                    }
+                    LinkedListable *item;
+                    if (takeP) {
+                        item = p;
+                        p = p->next;
+                        pSize--;
+                    }
+                    else {
+                        item = q;
+                        q = q->next;
+                        qSize--;
+                    }
+                    tail->next = item;
+                    tail = item;
+                }
+                p = q;
+            }
+            tail->next = NULL_PTR(LinkedListable *);
+            sorted = (numberOfMerges <= 1u);
+            runSize *= 2u;
+        }
+    }
+}
+
 void LinkedListable::Insert(LinkedListable * p) {
 
     if (p != NULL) {
@@ -138,7 +192,7 @@ void LinkedListable::Insert(LinkedListable * p,
             if (p->next != NULL) {
                 LinkedListable root;
                 root.next = p;
-                root.BSort(sorter);
+                root.MSort(sorter);
                 p = root.next;
             }
             LinkedListable *list = this;
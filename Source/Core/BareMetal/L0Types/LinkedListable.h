@@ -104,6 +104,14 @@ public:
      */
     void BSort(SortFilter * const sorter);
 
+    /**
+     * @brief Merge Sort the sub-list to the right of this element.
+     * @details Bottom-up (iterative) merge sort of the links, with O(n log n) comparisons and no memory allocation. As for BSort,
+     * two elements are ordered if the SortFilter returns a value <= 0 and the order of the equal elements is preserved.
+     * @param[in] sorter implements the comparison criteria for the sorting.
+     */
+    void MSort(SortFilter * const sorter);
+
     /**
      * @brief Inserts the entire list as in input to the next location.
      * @param[in] p the pointer to the LinkedListable to be inserted.
@@ -113,7 +121,8 @@ public:
     /**
      * @brief Inserts a sorted set of all the elements from the sub-list p.
      * @details The list is inserted in the next position. If sorter is NULL,
-     * the unsorted Insert(LinkedListable *) function is called.
+     * the unsorted Insert(LinkedListable *) function is called. The sub-list \a p is first
+     * sorted (see MSort) and then merged, in a single pass, with the (already sorted) sub-list of this element.
      * @param[in] p the pointer to the LinkedListable to be inserted .
      * @param[in] sorter implements the comparison criteria for the sorting.
      */
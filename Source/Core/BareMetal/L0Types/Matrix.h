@@ -222,6 +222,8 @@ public:
 
     /**
      * @brief Performs the matrix product.
+     * @details If the three matrices are stored in contiguous memory (IsStaticDeclared()) the product is computed
+     * in place with the blocked MatrixKernels::Product.
      * @param[in] factor is the matrix to be multiplied with.
      * @param[out] result is the matrix product result.
      * @return true if the dimensions of \a factor and \a result are correct, false otherwise.
@@ -235,8 +237,24 @@ public:
     bool Product(Matrix<T> &factor,
                  Matrix<T> &result) const;
 
+    /**
+     * @brief Performs the matrix-vector product.
+     * @param[in] factor is the vector to be multiplied with.
+     * @param[out] result is the vector product result.
+     * @return true if the dimensions of \a factor and \a result are correct, false otherwise.
+     * @pre
+     *   GetNumberOfColumns() == factor.GetNumberOfElements() &&
+     *   GetNumberOfRows() == result.GetNumberOfElements()
+     * @post
+     *   result holds the product between *this and factor
+     */
+    bool Product(Vector<T> &factor,
+                 Vector<T> &result) const;
+
     /**
      * @brief Performs the matrix sum.
+     * @details If the three matrices are stored in contiguous memory (IsStaticDeclared()) the sum is computed
+     * with MatrixKernels::Add.
      * @param[in] addend is the matrix to be summed with.
      * @param[out] result is the matrix sum result.
      * @return true if the matrix dimensions are consistent
@@ -290,6 +308,8 @@ public:
 
     /**
      * @brief Retrieves the transpose of this matrix.
+     * @details If both matrices are stored in contiguous memory (IsStaticDeclared()) the blocked
+     * MatrixKernels::Transpose is used.
      * @param[out] transpose is the transpose matrix in output.
      * @return true if the preconditions are satisfied, false otherwise.
      * @pre
@@ -635,7 +655,12 @@ bool Matrix<T>::Product(Matrix<T> &factor,
     bool cond2 = (result.numberOfRows == numberOfRows);
     bool cond3 = (result.numberOfColumns == factor.numberOfColumns);
     bool ret = ((cond1) && (cond2) && (cond3));
-    if (ret) {
+    bool contiguous = ((staticDeclared) && (factor.staticDeclared) && (result.staticDeclared));
+    if ((ret) && (contiguous)) {
+        MatrixKernels::Product(static_cast<const T*>(dataPointer), static_cast<const T*>(factor.dataPointer), static_cast<T*>(result.dataPointer),
+                               numberOfRows, numberOfColumns, factor.numberOfColumns);
+    }
+    else if (ret) {
         Matrix<T> temp;
         if (staticDeclared) {
             temp = Matrix<T>(static_cast<T*>(dataPointer), numberOfRows, numberOfColumns);
@@ -655,13 +680,37 @@ bool Matrix<T>::Product(Matrix<T> &factor,
     return ret;
 }
 
+template<typename T>
+bool Matrix<T>::Product(Vector<T> &factor,
+                        Vector<T> &result) const {
+    bool cond1 = (factor.GetNumberOfElements() == numberOfColumns);
+    bool cond2 = (result.GetNumberOfElements() == numberOfRows);
+    bool ret = ((cond1) && (cond2));
+    if ((ret) && (staticDeclared)) {
+        MatrixKernels::Product(static_cast<const T*>(dataPointer), static_cast<const T*>(factor.GetDataPointer()), result.GetDataPointer(), numberOfRows,
+                               numberOfColumns);
+    }
+    else if (ret) {
+        T **rows = static_cast<T**>(dataPointer);
+        for (uint32 i = 0u; i < numberOfRows; i++) {
+            result[i] = MatrixKernels::Dot(static_cast<const T*>(rows[i]), static_cast<const T*>(factor.GetDataPointer()), numberOfColumns);
+        }
+    }
+    return ret;
+}
+
 template<typename T>
 bool Matrix<T>::Sum(Matrix<T> &addend,
                     Matrix<T> &result) const {
     bool cond1 = (addend.numberOfRows == numberOfRows) && (result.numberOfRows == numberOfRows);
     bool cond2 = (addend.numberOfColumns == numberOfColumns) && (result.numberOfColumns == numberOfColumns);
     bool ret = (cond1 && cond2);
-    if (ret) {
+    bool contiguous = ((staticDeclared) && (addend.staticDeclared) && (result.staticDeclared));
+    if ((ret) && (contiguous)) {
+        MatrixKernels::Add(static_cast<const T*>(dataPointer), static_cast<const T*>(addend.dataPointer), static_cast<T*>(result.dataPointer),
+                           numberOfRows * numberOfColumns);
+    }
+    else if (ret) {
         Matrix<T> temp;
         if (staticDeclared) {
             temp = Matrix<T>(static_cast<T*>(dataPointer), numberOfRows, numberOfColumns);
@@ -752,8 +801,12 @@ bool Matrix<T>::Transpose(Matrix<T> &transpose) const {
     bool cond2 = (numberOfColumns == transpose.numberOfRows);
 
     bool ret = ((cond1) && (cond2));
+    bool contiguous = ((staticDeclared) && (transpose.staticDeclared));
 
-    if (ret) {
+    if ((ret) && (contiguous)) {
+        MatrixKernels::Transpose(static_cast<const T*>(dataPointer), static_cast<T*>(transpose.dataPointer), numberOfRows, numberOfColumns);
+    }
+    else if (ret) {
         Matrix<T> temp;
         if (staticDeclared) {
             temp = Matrix<T>(static_cast<T*>(dataPointer), numberOfRows, numberOfColumns);
@@ -0,0 +1,472 @@
+/**
+ * @file MatrixKernels.h
+ * @brief Header file for class MatrixKernels
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MatrixKernels
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MATRIXKERNELS_H_
+#define MATRIXKERNELS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * The number of rows/columns of each block of the blocked matrix kernels.
+ * 64 float32 (or float64) columns of 64 rows fit in the L1/L2 caches of the ARMv8 cores.
+ */
+#define MATRIX_KERNELS_BLOCK_SIZE 64u
+
+namespace MARTe {
+
+/**
+ * @brief Dense linear algebra kernels operating in place on contiguous row-major memory.
+ * @details These functions work directly on the raw memory (e.g. the memory of a GAM signal) and never allocate
+ * temporary copies. The float32 and float64 specialisations of the element kernels are vectorised with NEON
+ * when available (__ARM_NEON), all the other types use the generic scalar implementation.
+ * The output memory shall not overlap with any of the inputs, except for the element-wise kernels,
+ * where the output may be the same as one of the inputs.
+ */
+namespace MatrixKernels {
+
+/**
+ * @brief Computes y[i] += alpha * x[i] for i in [0, n[.
+ * @param[in] alpha the scalar multiplier.
+ * @param[in] x the input array.
+ * @param[in,out] y the accumulator array.
+ * @param[in] n the number of elements.
+ */
+template<typename T>
+inline void Axpy(const T alpha, const T * const x, T * const y, const uint32 n);
+
+/**
+ * @brief Computes the scalar product of \a x and \a y.
+ * @param[in] x the first array.
+ * @param[in] y the second array.
+ * @param[in] n the number of elements.
+ * @return the sum of x[i] * y[i] for i in [0, n[.
+ */
+template<typename T>
+inline T Dot(const T * const x, const T * const y, const uint32 n);
+
+/**
+ * @brief Computes z[i] = x[i] + y[i] for i in [0, n[.
+ * @param[in] x the first array.
+ * @param[in] y the second array.
+ * @param[out] z the result array.
+ * @param[in] n the number of elements.
+ */
+template<typename T>
+inline void Add(const T * const x, const T * const y, T * const z, const uint32 n);
+
+/**
+ * @brief Computes z[i] = x[i] - y[i] for i in [0, n[.
+ * @param[in] x the first array.
+ * @param[in] y the second array.
+ * @param[out] z the result array.
+ * @param[in] n the number of elements.
+ */
+template<typename T>
+inline void Subtract(const T * const x, const T * const y, T * const z, const uint32 n);
+
+/**
+ * @brief Computes z[i] = x[i] * y[i] for i in [0, n[ (Hadamard product).
+ * @param[in] x the first array.
+ * @param[in] y the second array.
+ * @param[out] z the result array.
+ * @param[in] n the number of elements.
+ */
+template<typename T>
+inline void Multiply(const T * const x, const T * const y, T * const z, const uint32 n);
+
+/**
+ * @brief Computes y[i] = alpha * x[i] for i in [0, n[.
+ * @param[in] alpha the scalar multiplier.
+ * @param[in] x the input array.
+ * @param[out] y the result array.
+ * @param[in] n the number of elements.
+ */
+template<typename T>
+inline void Scale(const T alpha, const T * const x, T * const y, const uint32 n);
+
+/**
+ * @brief Computes the matrix product c = a * b.
+ * @details The product is blocked in MATRIX_KERNELS_BLOCK_SIZE x MATRIX_KERNELS_BLOCK_SIZE tiles of \a b and
+ * each row of the tile is accumulated in \a c with Axpy.
+ * @param[in] a the rows x inner matrix.
+ * @param[in] b the inner x columns matrix.
+ * @param[out] c the rows x columns result matrix.
+ * @param[in] rows the number of rows of \a a and \a c.
+ * @param[in] inner the number of columns of \a a and of rows of \a b.
+ * @param[in] columns the number of columns of \a b and \a c.
+ */
+template<typename T>
+inline void Product(const T * const a, const T * const b, T * const c, const uint32 rows, const uint32 inner, const uint32 columns);
+
+/**
+ * @brief Computes the matrix-vector product y = a * x.
+ * @param[in] a the rows x columns matrix.
+ * @param[in] x the vector with \a columns elements.
+ * @param[out] y the vector with \a rows elements.
+ * @param[in] rows the number of rows of \a a.
+ * @param[in] columns the number of columns of \a a.
+ */
+template<typename T>
+inline void Product(const T * const a, const T * const x, T * const y, const uint32 rows, const uint32 columns);
+
+/**
+ * @brief Computes the transpose t of the matrix a.
+ * @details The copy is blocked so that both the reads and the writes stay in a small set of cache lines.
+ * @param[in] a the rows x columns matrix.
+ * @param[out] t the columns x rows transposed matrix.
+ * @param[in] rows the number of rows of \a a.
+ * @param[in] columns the number of columns of \a a.
+ */
+template<typename T>
+inline void Transpose(const T * const a, T * const t, const uint32 rows, const uint32 columns);
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace MatrixKernels {
+
+template<typename T>
+inline void Axpy(const T alpha, const T * const x, T * const y, const uint32 n) {
+    for (uint32 i = 0u; i < n; i++) {
+        y[i] += alpha * x[i];
+    }
+}
+
+template<typename T>
+inline T Dot(const T * const x, const T * const y, const uint32 n) {
+    T result = static_cast<T>(0);
+    for (uint32 i = 0u; i < n; i++) {
+        result += x[i] * y[i];
+    }
+    return result;
+}
+
+template<typename T>
+inline void Add(const T * const x, const T * const y, T * const z, const uint32 n) {
+    for (uint32 i = 0u; i < n; i++) {
+        z[i] = x[i] + y[i];
+    }
+}
+
+template<typename T>
+inline void Subtract(const T * const x, const T * const y, T * const z, const uint32 n) {
+    for (uint32 i = 0u; i < n; i++) {
+        z[i] = x[i] - y[i];
+    }
+}
+
+template<typename T>
+inline void Multiply(const T * const x, const T * const y, T * const z, const uint32 n) {
+    for (uint32 i = 0u; i < n; i++) {
+        z[i] = x[i] * y[i];
+    }
+}
+
+template<typename T>
+inline void Scale(const T alpha, const T * const x, T * const y, const uint32 n) {
+    for (uint32 i = 0u; i < n; i++) {
+        y[i] = alpha * x[i];
+    }
+}
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+/**
+ * @brief float32 NEON implementation of Axpy (8 elements per iteration).
+ */
+template<>
+inline void Axpy<float32>(const float32 alpha, const float32 * const x, float32 * const y, const uint32 n) {
+    uint32 i = 0u;
+    float32x4_t va = vdupq_n_f32(alpha);
+    for (; (i + 8u) <= n; i += 8u) {
+        float32x4_t y0 = vld1q_f32(&y[i]);
+        float32x4_t y1 = vld1q_f32(&y[i + 4u]);
+        y0 = vfmaq_f32(y0, va, vld1q_f32(&x[i]));
+        y1 = vfmaq_f32(y1, va, vld1q_f32(&x[i + 4u]));
+        vst1q_f32(&y[i], y0);
+        vst1q_f32(&y[i + 4u], y1);
+    }
+    for (; (i + 4u) <= n; i += 4u) {
+        vst1q_f32(&y[i], vfmaq_f32(vld1q_f32(&y[i]), va, vld1q_f32(&x[i])));
+    }
+    for (; i < n; i++) {
+        y[i] += alpha * x[i];
+    }
+}
+
+/**
+ * @brief float64 NEON implementation of Axpy (4 elements per iteration).
+ */
+template<>
+inline void Axpy<float64>(const float64 alpha, const float64 * const x, float64 * const y, const uint32 n) {
+    uint32 i = 0u;
+    float64x2_t va = vdupq_n_f64(alpha);
+    for (; (i + 4u) <= n; i += 4u) {
+        float64x2_t y0 = vld1q_f64(&y[i]);
+        float64x2_t y1 = vld1q_f64(&y[i + 2u]);
+        y0 = vfmaq_f64(y0, va, vld1q_f64(&x[i]));
+        y1 = vfmaq_f64(y1, va, vld1q_f64(&x[i + 2u]));
+        vst1q_f64(&y[i], y0);
+        vst1q_f64(&y[i + 2u], y1);
+    }
+    for (; i < n; i++) {
+        y[i] += alpha * x[i];
+    }
+}
+
+/**
+ * @brief float32 NEON implementation of Dot (two independent accumulators).
+ */
+template<>
+inline float32 Dot<float32>(const float32 * const x, const float32 * const y, const uint32 n) {
+    uint32 i = 0u;
+    float32x4_t acc0 = vdupq_n_f32(0.0F);
+    float32x4_t acc1 = vdupq_n_f32(0.0F);
+    for (; (i + 8u) <= n; i += 8u) {
+        acc0 = vfmaq_f32(acc0, vld1q_f32(&x[i]), vld1q_f32(&y[i]));
+        acc1 = vfmaq_f32(acc1, vld1q_f32(&x[i + 4u]), vld1q_f32(&y[i + 4u]));
+    }
+    for (; (i + 4u) <= n; i += 4u) {
+        acc0 = vfmaq_f32(acc0, vld1q_f32(&x[i]), vld1q_f32(&y[i]));
+    }
+    float32 result = vaddvq_f32(vaddq_f32(acc0, acc1));
+    for (; i < n; i++) {
+        result += x[i] * y[i];
+    }
+    return result;
+}
+
+/**
+ * @brief float64 NEON implementation of Dot (two independent accumulators).
+ */
+template<>
+inline float64 Dot<float64>(const float64 * const x, const float64 * const y, const uint32 n) {
+    uint32 i = 0u;
+    float64x2_t acc0 = vdupq_n_f64(0.0);
+    float64x2_t acc1 = vdupq_n_f64(0.0);
+    for (; (i + 4u) <= n; i += 4u) {
+        acc0 = vfmaq_f64(acc0, vld1q_f64(&x[i]), vld1q_f64(&y[i]));
+        acc1 = vfmaq_f64(acc1, vld1q_f64(&x[i + 2u]), vld1q_f64(&y[i + 2u]));
+    }
+    float64 result = vaddvq_f64(vaddq_f64(acc0, acc1));
+    for (; i < n; i++) {
+        result += x[i] * y[i];
+    }
+    return result;
+}
+
+/**
+ * @brief float32 NEON implementation of Add.
+ */
+template<>
+inline void Add<float32>(const float32 * const x, const float32 * const y, float32 * const z, const uint32 n) {
+    uint32 i = 0u;
+    for (; (i + 4u) <= n; i += 4u) {
+        vst1q_f32(&z[i], vaddq_f32(vld1q_f32(&x[i]), vld1q_f32(&y[i])));
+    }
+    for (; i < n; i++) {
+        z[i] = x[i] + y[i];
+    }
+}
+
+/**
+ * @brief float64 NEON implementation of Add.
+ */
+template<>
+inline void Add<float64>(const float64 * const x, const float64 * const y, float64 * const z, const uint32 n) {
+    uint32 i = 0u;
+    for (; (i + 2u) <= n; i += 2u) {
+        vst1q_f64(&z[i], vaddq_f64(vld1q_f64(&x[i]), vld1q_f64(&y[i])));
+    }
+    for (; i < n; i++) {
+        z[i] = x[i] + y[i];
+    }
+}
+
+/**
+ * @brief float32 NEON implementation of Subtract.
+ */
+template<>
+inline void Subtract<float32>(const float32 * const x, const float32 * const y, float32 * const z, const uint32 n) {
+    uint32 i = 0u;
+    for (; (i + 4u) <= n; i += 4u) {
+        vst1q_f32(&z[i], vsubq_f32(vld1q_f32(&x[i]), vld1q_f32(&y[i])));
+    }
+    for (; i < n; i++) {
+        z[i] = x[i] - y[i];
+    }
+}
+
+/**
+ * @brief float64 NEON implementation of Subtract.
+ */
+template<>
+inline void Subtract<float64>(const float64 * const x, const float64 * const y, float64 * const z, const uint32 n) {
+    uint32 i = 0u;
+    for (; (i + 2u) <= n; i += 2u) {
+        vst1q_f64(&z[i], vsubq_f64(vld1q_f64(&x[i]), vld1q_f64(&y[i])));
+    }
+    for (; i < n; i++) {
+        z[i] = x[i] - y[i];
+    }
+}
+
+/**
+ * @brief float32 NEON implementation of Multiply.
+ */
+template<>
+inline void Multiply<float32>(const float32 * const x, const float32 * const y, float32 * const z, const uint32 n) {
+    uint32 i = 0u;
+    for (; (i + 4u) <= n; i += 4u) {
+        vst1q_f32(&z[i], vmulq_f32(vld1q_f32(&x[i]), vld1q_f32(&y[i])));
+    }
+    for (; i < n; i++) {
+        z[i] = x[i] * y[i];
+    }
+}
+
+/**
+ * @brief float64 NEON implementation of Multiply.
+ */
+template<>
+inline void Multiply<float64>(const float64 * const x, const float64 * const y, float64 * const z, const uint32 n) {
+    uint32 i = 0u;
+    for (; (i + 2u) <= n; i += 2u) {
+        vst1q_f64(&z[i], vmulq_f64(vld1q_f64(&x[i]), vld1q_f64(&y[i])));
+    }
+    for (; i < n; i++) {
+        z[i] = x[i] * y[i];
+    }
+}
+
+/**
+ * @brief float32 NEON implementation of Scale.
+ */
+template<>
+inline void Scale<float32>(const float32 alpha, const float32 * const x, float32 * const y, const uint32 n) {
+    uint32 i = 0u;
+    for (; (i + 4u) <= n; i += 4u) {
+        vst1q_f32(&y[i], vmulq_n_f32(vld1q_f32(&x[i]), alpha));
+    }
+    for (; i < n; i++) {
+        y[i] = alpha * x[i];
+    }
+}
+
+/**
+ * @brief float64 NEON implementation of Scale.
+ */
+template<>
+inline void Scale<float64>(const float64 alpha, const float64 * const x, float64 * const y, const uint32 n) {
+    uint32 i = 0u;
+    for (; (i + 2u) <= n; i += 2u) {
+        vst1q_f64(&y[i], vmulq_n_f64(vld1q_f64(&x[i]), alpha));
+    }
+    for (; i < n; i++) {
+        y[i] = alpha * x[i];
+    }
+}
+#endif
+
+template<typename T>
+inline void Product(const T * const a, const T * const b, T * const c, const uint32 rows, const uint32 inner, const uint32 columns) {
+    for (uint32 i = 0u; i < (rows * columns); i++) {
+        c[i] = static_cast<T>(0);
+    }
+    for (uint32 kk = 0u; kk < inner; kk += MATRIX_KERNELS_BLOCK_SIZE) {
+        uint32 kEnd = kk + MATRIX_KERNELS_BLOCK_SIZE;
+        if (kEnd > inner) {
+            kEnd = inner;
+        }
+        for (uint32 jj = 0u; jj < columns; jj += MATRIX_KERNELS_BLOCK_SIZE) {
+            uint32 jLength = MATRIX_KERNELS_BLOCK_SIZE;
+            if ((jj + jLength) > columns) {
+                jLength = columns - jj;
+            }
+            for (uint32 i = 0u; i < rows; i++) {
+                const T * const aRow = &a[i * inner];
+                T * const cRow = &c[(i * columns) + jj];
+                for (uint32 k = kk; k < kEnd; k++) {
+                    Axpy(aRow[k], &b[(k * columns) + jj], cRow, jLength);
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+inline void Product(const T * const a, const T * const x, T * const y, const uint32 rows, const uint32 columns) {
+    for (uint32 i = 0u; i < rows; i++) {
+        y[i] = Dot(&a[i * columns], x, columns);
+    }
+}
+
+template<typename T>
+inline void Transpose(const T * const a, T * const t, const uint32 rows, const uint32 columns) {
+    const uint32 tile = MATRIX_KERNELS_BLOCK_SIZE / 4u;
+    for (uint32 ii = 0u; ii < rows; ii += tile) {
+        uint32 iEnd = ii + tile;
+        if (iEnd > rows) {
+            iEnd = rows;
+        }
+        for (uint32 jj = 0u; jj < columns; jj += tile) {
+            uint32 jEnd = jj + tile;
+            if (jEnd > columns) {
+                jEnd = columns;
+            }
+            for (uint32 i = ii; i < iEnd; i++) {
+                for (uint32 j = jj; j < jEnd; j++) {
+                    t[(j * rows) + i] = a[(i * columns) + j];
+                }
+            }
+        }
+    }
+}
+
+}
+
+}
+
+#endif /* MATRIXKERNELS_H_ */
@@ -0,0 +1,422 @@
+/**
+ * @file MatrixView.h
+ * @brief Header file for class MatrixView
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MatrixView
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MATRIXVIEW_H_
+#define MATRIXVIEW_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "MatrixKernels.h"
+#include "VectorView.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Strided view of a matrix of values that does not own the memory.
+ * @details A MatrixView is a pointer, a shape (rows x columns) and the distance, in elements, between two consecutive
+ * rows and two consecutive columns. Sub-matrices, rows, columns and the transpose are views on the same memory,
+ * so that a GAM can operate on blocks of a signal in place. Copying a MatrixView only copies the pointer and the shape.
+ * @tparam T the scalar type of the elements.
+ */
+template<typename T>
+class MatrixView {
+
+public:
+
+    /**
+     * @brief Default constructor.
+     * @post
+     *   GetNumberOfRows() == 0u &&
+     *   GetNumberOfColumns() == 0u &&
+     *   GetDataPointer() == NULL
+     */
+    MatrixView();
+
+    /**
+     * @brief Constructs a view over an existing contiguous row-major memory block.
+     * @param[in] existingArray the pointer to the element (0, 0).
+     * @param[in] nOfRows the number of rows.
+     * @param[in] nOfColumns the number of columns.
+     * @post
+     *   GetRowStride() == nOfColumns &&
+     *   GetColumnStride() == 1u
+     */
+    MatrixView(T * const existingArray,
+               const uint32 nOfRows,
+               const uint32 nOfColumns);
+
+    /**
+     * @brief Constructs a strided view over an existing memory block.
+     * @param[in] existingArray the pointer to the element (0, 0).
+     * @param[in] nOfRows the number of rows.
+     * @param[in] nOfColumns the number of columns.
+     * @param[in] rowStrideIn the distance, in elements, between the elements (i, j) and (i + 1, j).
+     * @param[in] columnStrideIn the distance, in elements, between the elements (i, j) and (i, j + 1).
+     */
+    MatrixView(T * const existingArray,
+               const uint32 nOfRows,
+               const uint32 nOfColumns,
+               const uint32 rowStrideIn,
+               const uint32 columnStrideIn);
+
+    /**
+     * @brief Returns the element at row \a row and column \a col.
+     * @param[in] row the row index.
+     * @param[in] col the column index.
+     * @return the element at GetDataPointer()[row * GetRowStride() + col * GetColumnStride()].
+     * @pre
+     *   row < GetNumberOfRows() &&
+     *   col < GetNumberOfColumns()
+     */
+    inline T& operator()(const uint32 row,
+                         const uint32 col) const;
+
+    /**
+     * @brief Gets the pointer to the element (0, 0).
+     * @return the pointer to the element (0, 0).
+     */
+    inline T* GetDataPointer() const;
+
+    /**
+     * @brief Gets the number of rows.
+     * @return the number of rows.
+     */
+    inline uint32 GetNumberOfRows() const;
+
+    /**
+     * @brief Gets the number of columns.
+     * @return the number of columns.
+     */
+    inline uint32 GetNumberOfColumns() const;
+
+    /**
+     * @brief Gets the distance, in elements, between two consecutive rows.
+     * @return the distance, in elements, between two consecutive rows.
+     */
+    inline uint32 GetRowStride() const;
+
+    /**
+     * @brief Gets the distance, in elements, between two consecutive columns.
+     * @return the distance, in elements, between two consecutive columns.
+     */
+    inline uint32 GetColumnStride() const;
+
+    /**
+     * @brief Checks if the view is a dense row-major block.
+     * @return true if GetColumnStride() == 1u and GetRowStride() == GetNumberOfColumns() (or if the view has a single row).
+     */
+    inline bool IsContiguous() const;
+
+    /**
+     * @brief Retrieves the view of the row \a row.
+     * @param[in] row the row index.
+     * @param[out] rowView the view of the row.
+     * @return true if row < GetNumberOfRows().
+     */
+    bool Row(const uint32 row,
+             VectorView<T> &rowView) const;
+
+    /**
+     * @brief Retrieves the view of the column \a col.
+     * @param[in] col the column index.
+     * @param[out] columnView the view of the column.
+     * @return true if col < GetNumberOfColumns().
+     */
+    bool Column(const uint32 col,
+                VectorView<T> &columnView) const;
+
+    /**
+     * @brief Retrieves the view of the block between the row and columns ranges specified.
+     * @param[in] beginRow is the top boundary of the block.
+     * @param[in] endRow is the bottom boundary of the block.
+     * @param[in] beginColumn is the left boundary of the block.
+     * @param[in] endColumn is the right boundary of the block.
+     * @param[out] subMatrix the view of the block.
+     * @return true if the preconditions are satisfied, false otherwise.
+     * @pre
+     *   beginRow <= endRow &&
+     *   beginColumn <= endColumn &&
+     *   endRow < GetNumberOfRows() &&
+     *   endColumn < GetNumberOfColumns()
+     */
+    bool SubMatrix(const uint32 beginRow,
+                   const uint32 endRow,
+                   const uint32 beginColumn,
+                   const uint32 endColumn,
+                   MatrixView<T> &subMatrix) const;
+
+    /**
+     * @brief Retrieves the transpose of this view (no data is moved, only the strides are swapped).
+     * @return the transposed view.
+     */
+    MatrixView<T> Transposed() const;
+
+    /**
+     * @brief Performs the matrix product.
+     * @details Uses MatrixKernels::Product if the three views are contiguous.
+     * @param[in] factor is the matrix to be multiplied with.
+     * @param[out] result is the matrix product result. It shall not overlap with this view or with \a factor.
+     * @return true if the dimensions of \a factor and \a result are correct, false otherwise.
+     * @pre
+     *   GetNumberOfColumns() == factor.GetNumberOfRows() &&
+     *   GetNumberOfRows() == result.GetNumberOfRows() &&
+     *   factor.GetNumberOfColumns() == result.GetNumberOfColumns()
+     */
+    bool Product(const MatrixView<T> &factor,
+                 const MatrixView<T> &result) const;
+
+    /**
+     * @brief Performs the matrix-vector product.
+     * @param[in] factor is the vector to be multiplied with.
+     * @param[out] result is the vector product result. It shall not overlap with this view or with \a factor.
+     * @return true if the dimensions of \a factor and \a result are correct, false otherwise.
+     * @pre
+     *   GetNumberOfColumns() == factor.GetNumberOfElements() &&
+     *   GetNumberOfRows() == result.GetNumberOfElements()
+     */
+    bool Product(const VectorView<T> &factor,
+                 const VectorView<T> &result) const;
+
+    /**
+     * @brief Copies the elements of \a source into this view.
+     * @param[in] source the view to copy from.
+     * @return true if \a source has the same shape of this view.
+     */
+    bool Copy(const MatrixView<T> &source) const;
+
+private:
+
+    /**
+     * The pointer to the element (0, 0).
+     */
+    T *dataPointer;
+
+    /**
+     * The number of rows.
+     */
+    uint32 numberOfRows;
+
+    /**
+     * The number of columns.
+     */
+    uint32 numberOfColumns;
+
+    /**
+     * The distance, in elements, between two consecutive rows.
+     */
+    uint32 rowStride;
+
+    /**
+     * The distance, in elements, between two consecutive columns.
+     */
+    uint32 columnStride;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+template<typename T>
+MatrixView<T>::MatrixView() {
+    dataPointer = NULL_PTR(T*);
+    numberOfRows = 0u;
+    numberOfColumns = 0u;
+    rowStride = 0u;
+    columnStride = 1u;
+}
+
+template<typename T>
+MatrixView<T>::MatrixView(T * const existingArray,
+                          const uint32 nOfRows,
+                          const uint32 nOfColumns) {
+    dataPointer = existingArray;
+    numberOfRows = nOfRows;
+    numberOfColumns = nOfColumns;
+    rowStride = nOfColumns;
+    columnStride = 1u;
+}
+
+template<typename T>
+MatrixView<T>::MatrixView(T * const existingArray,
+                          const uint32 nOfRows,
+                          const uint32 nOfColumns,
+                          const uint32 rowStrideIn,
+                          const uint32 columnStrideIn) {
+    dataPointer = existingArray;
+    numberOfRows = nOfRows;
+    numberOfColumns = nOfColumns;
+    rowStride = rowStrideIn;
+    columnStride = columnStrideIn;
+}
+
+template<typename T>
+inline T& MatrixView<T>::operator()(const uint32 row,
+                                    const uint32 col) const {
+    return dataPointer[(row * rowStride) + (col * columnStride)];
+}
+
+template<typename T>
+inline T* MatrixView<T>::GetDataPointer() const {
+    return dataPointer;
+}
+
+template<typename T>
+inline uint32 MatrixView<T>::GetNumberOfRows() const {
+    return numberOfRows;
+}
+
+template<typename T>
+inline uint32 MatrixView<T>::GetNumberOfColumns() const {
+    return numberOfColumns;
+}
+
+template<typename T>
+inline uint32 MatrixView<T>::GetRowStride() const {
+    return rowStride;
+}
+
+template<typename T>
+inline uint32 MatrixView<T>::GetColumnStride() const {
+    return columnStride;
+}
+
+template<typename T>
+inline bool MatrixView<T>::IsContiguous() const {
+    bool ret = ((columnStride == 1u) || (numberOfColumns <= 1u));
+    if (ret) {
+        ret = ((rowStride == numberOfColumns) || (numberOfRows <= 1u));
+    }
+    return ret;
+}
+
+template<typename T>
+bool MatrixView<T>::Row(const uint32 row,
+                        VectorView<T> &rowView) const {
+    bool ret = (row < numberOfRows);
+    if (ret) {
+        rowView = VectorView<T>(&dataPointer[row * rowStride], numberOfColumns, columnStride);
+    }
+    return ret;
+}
+
+template<typename T>
+bool MatrixView<T>::Column(const uint32 col,
+                           VectorView<T> &columnView) const {
+    bool ret = (col < numberOfColumns);
+    if (ret) {
+        columnView = VectorView<T>(&dataPointer[col * columnStride], numberOfRows, rowStride);
+    }
+    return ret;
+}
+
+template<typename T>
+bool MatrixView<T>::SubMatrix(const uint32 beginRow,
+                              const uint32 endRow,
+                              const uint32 beginColumn,
+                              const uint32 endColumn,
+                              MatrixView<T> &subMatrix) const {
+    bool ret = ((endRow >= beginRow) && (endColumn >= beginColumn));
+    if (ret) {
+        ret = ((endRow < numberOfRows) && (endColumn < numberOfColumns));
+    }
+    if (ret) {
+        subMatrix = MatrixView<T>(&(*this)(beginRow, beginColumn), (endRow - beginRow) + 1u, (endColumn - beginColumn) + 1u, rowStride, columnStride);
+    }
+    return ret;
+}
+
+template<typename T>
+MatrixView<T> MatrixView<T>::Transposed() const {
+    return MatrixView<T>(dataPointer, numberOfColumns, numberOfRows, columnStride, rowStride);
+}
+
+template<typename T>
+bool MatrixView<T>::Product(const MatrixView<T> &factor,
+                            const MatrixView<T> &result) const {
+    bool cond1 = (factor.numberOfRows == numberOfColumns);
+    bool cond2 = (result.numberOfRows == numberOfRows);
+    bool cond3 = (result.numberOfColumns == factor.numberOfColumns);
+    bool ret = ((cond1) && (cond2) && (cond3));
+    bool contiguous = ((IsContiguous()) && (factor.IsContiguous()) && (result.IsContiguous()));
+    if ((ret) && (contiguous)) {
+        MatrixKernels::Product(static_cast<const T*>(dataPointer), static_cast<const T*>(factor.dataPointer), result.dataPointer, numberOfRows,
+                               numberOfColumns, factor.numberOfColumns);
+    }
+    else if (ret) {
+        for (uint32 i = 0u; i < numberOfRows; i++) {
+            for (uint32 j = 0u; j < factor.numberOfColumns; j++) {
+                T sum = static_cast<T>(0);
+                for (uint32 k = 0u; k < numberOfColumns; k++) {
+                    sum += (*this)(i, k) * factor(k, j);
+                }
+                result(i, j) = sum;
+            }
+        }
+    }
+    return ret;
+}
+
+template<typename T>
+bool MatrixView<T>::Product(const VectorView<T> &factor,
+                            const VectorView<T> &result) const {
+    bool cond1 = (factor.GetNumberOfElements() == numberOfColumns);
+    bool cond2 = (result.GetNumberOfElements() == numberOfRows);
+    bool ret = ((cond1) && (cond2));
+    for (uint32 i = 0u; (i < numberOfRows) && (ret); i++) {
+        VectorView<T> rowView;
+        ret = Row(i, rowView);
+        if (ret) {
+            ret = rowView.Product(factor, result[i]);
+        }
+    }
+    return ret;
+}
+
+template<typename T>
+bool MatrixView<T>::Copy(const MatrixView<T> &source) const {
+    bool ret = ((source.numberOfRows == numberOfRows) && (source.numberOfColumns == numberOfColumns));
+    for (uint32 i = 0u; (i < numberOfRows) && (ret); i++) {
+        for (uint32 j = 0u; j < numberOfColumns; j++) {
+            (*this)(i, j) = source(i, j);
+        }
+    }
+    return ret;
+}
+
+}
+
+#endif /* MATRIXVIEW_H_ */
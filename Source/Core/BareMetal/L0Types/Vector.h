@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "HeapManager.h"
+#include "MatrixKernels.h"
 #include "MemoryOperationsHelper.h"
 
 /*---------------------------------------------------------------------------*/
@@ -168,6 +169,7 @@ public:
 
     /**
      * @brief Performs the vector scalar product.
+     * @details Uses MatrixKernels::Dot directly on the vectors memory.
      * @param[in] factor is the vector to be multiplied with.
      * @param[out] result is the result of the scalar product of this vector multiplied with \a factor.
      * @return true if \a factor has the same number of elements of this vector, false otherwise.
@@ -176,9 +178,24 @@ public:
      * @post
      *   result holds the result of the scalar product of this vector multiplied with \a factor
      */
-    bool Product(Vector<T> factor,
+    bool Product(const Vector<T> &factor,
                  T &result) const;
 
+    /**
+     * @brief Performs the element-wise vector sum.
+     * @details Uses MatrixKernels::Add directly on the vectors memory. \a result may be this vector or \a addend.
+     * @param[in] addend is the vector to be summed with.
+     * @param[out] result is the vector sum result.
+     * @return true if \a addend and \a result have the same number of elements of this vector, false otherwise.
+     * @pre
+     *   numberOfElements == addend.numberOfElements &&
+     *   numberOfElements == result.numberOfElements
+     * @post
+     *   result[i] = (*this)[i] + addend[i]
+     */
+    bool Sum(const Vector<T> &addend,
+             Vector<T> &result) const;
+
 private:
     /**
      * @brief Frees memory if necessary
@@ -337,15 +354,21 @@ inline uint32 Vector<T>::GetNumberOfElements() const {
 }
 
 template<typename T>
-bool Vector<T>::Product(Vector<T> factor,
+bool Vector<T>::Product(const Vector<T> &factor,
                         T &result) const {
     bool ret = (factor.numberOfElements == numberOfElements);
     if (ret) {
-        result = static_cast<T>(0);
-        T *array = dataPointer;
-        for (uint32 i = 0u; i < numberOfElements; i++) {
-            result += array[i] * factor[i];
-        }
+        result = MatrixKernels::Dot(dataPointer, factor.dataPointer, numberOfElements);
+    }
+    return ret;
+}
+
+template<typename T>
+bool Vector<T>::Sum(const Vector<T> &addend,
+                    Vector<T> &result) const {
+    bool ret = (addend.numberOfElements == numberOfElements) && (result.numberOfElements == numberOfElements);
+    if (ret) {
+        MatrixKernels::Add(dataPointer, addend.dataPointer, result.dataPointer, numberOfElements);
     }
     return ret;
 }
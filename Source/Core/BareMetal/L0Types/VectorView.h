@@ -0,0 +1,269 @@
+/**
+ * @file VectorView.h
+ * @brief Header file for class VectorView
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class VectorView
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef VECTORVIEW_H_
+#define VECTORVIEW_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "MatrixKernels.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Strided view of an array of values that does not own the memory.
+ * @details A VectorView is a pointer, a number of elements and a stride (in elements) between consecutive elements.
+ * It allows to address, in place, slices of an existing memory block (e.g. one column of a row-major matrix signal)
+ * without copying them. Copying a VectorView only copies the pointer and the shape.
+ * @tparam T the scalar type of the elements.
+ */
+template<typename T>
+class VectorView {
+
+public:
+
+    /**
+     * @brief Default constructor.
+     * @post
+     *   GetNumberOfElements() == 0u &&
+     *   GetDataPointer() == NULL &&
+     *   GetStride() == 1u
+     */
+    VectorView();
+
+    /**
+     * @brief Constructs a view over an existing array.
+     * @param[in] existingArray the pointer to the first element.
+     * @param[in] nOfElements the number of elements of the view.
+     * @param[in] strideIn the distance, in elements, between two consecutive elements of the view.
+     * @post
+     *   GetNumberOfElements() == nOfElements &&
+     *   GetDataPointer() == existingArray &&
+     *   GetStride() == strideIn
+     */
+    VectorView(T * const existingArray,
+               const uint32 nOfElements,
+               const uint32 strideIn = 1u);
+
+    /**
+     * @brief Constructs a contiguous view over the memory of a Vector.
+     * @param[in] vector the Vector whose memory is to be viewed. The memory must outlive the view.
+     */
+    VectorView(const Vector<T> &vector);
+
+    /**
+     * @brief Returns the element at position \a idx.
+     * @param[in] idx the index of the element to retrieve.
+     * @return the element at position \a idx (i.e. GetDataPointer()[idx * GetStride()]).
+     * @pre idx < GetNumberOfElements()
+     */
+    inline T& operator [](const uint32 idx) const;
+
+    /**
+     * @brief Gets the pointer to the first element.
+     * @return the pointer to the first element.
+     */
+    inline T* GetDataPointer() const;
+
+    /**
+     * @brief Gets the number of elements in the view.
+     * @return the number of elements in the view.
+     */
+    inline uint32 GetNumberOfElements() const;
+
+    /**
+     * @brief Gets the distance, in elements, between two consecutive elements.
+     * @return the distance, in elements, between two consecutive elements.
+     */
+    inline uint32 GetStride() const;
+
+    /**
+     * @brief Checks if the elements are adjacent in memory.
+     * @return true if GetStride() == 1u or GetNumberOfElements() <= 1u.
+     */
+    inline bool IsContiguous() const;
+
+    /**
+     * @brief Retrieves a view of \a nOfElements elements starting at \a beginIdx, taking one every \a step elements.
+     * @param[in] beginIdx the index of the first element.
+     * @param[in] nOfElements the number of elements of the sub view.
+     * @param[in] step the distance, in elements of this view, between consecutive elements of the sub view.
+     * @param[out] subView the requested view.
+     * @return true if the sub view is inside this view.
+     * @pre
+     *   step > 0 &&
+     *   nOfElements > 0 &&
+     *   beginIdx + (nOfElements - 1) * step < GetNumberOfElements()
+     */
+    bool SubView(const uint32 beginIdx,
+                 const uint32 nOfElements,
+                 const uint32 step,
+                 VectorView<T> &subView) const;
+
+    /**
+     * @brief Performs the scalar product with \a factor.
+     * @details Uses MatrixKernels::Dot if both views are contiguous.
+     * @param[in] factor the view to be multiplied with.
+     * @param[out] result the scalar product.
+     * @return true if \a factor has the same number of elements of this view.
+     */
+    bool Product(const VectorView<T> &factor,
+                 T &result) const;
+
+    /**
+     * @brief Copies the elements of \a source into this view.
+     * @param[in] source the view to copy from.
+     * @return true if \a source has the same number of elements of this view.
+     */
+    bool Copy(const VectorView<T> &source) const;
+
+private:
+
+    /**
+     * The pointer to the first element.
+     */
+    T *dataPointer;
+
+    /**
+     * The number of elements.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * The distance, in elements, between two consecutive elements.
+     */
+    uint32 stride;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+template<typename T>
+VectorView<T>::VectorView() {
+    dataPointer = NULL_PTR(T*);
+    numberOfElements = 0u;
+    stride = 1u;
+}
+
+template<typename T>
+VectorView<T>::VectorView(T * const existingArray,
+                          const uint32 nOfElements,
+                          const uint32 strideIn) {
+    dataPointer = existingArray;
+    numberOfElements = nOfElements;
+    stride = strideIn;
+}
+
+template<typename T>
+VectorView<T>::VectorView(const Vector<T> &vector) {
+    dataPointer = vector.GetDataPointer();
+    numberOfElements = vector.GetNumberOfElements();
+    stride = 1u;
+}
+
+template<typename T>
+inline T& VectorView<T>::operator [](const uint32 idx) const {
+    return dataPointer[idx * stride];
+}
+
+template<typename T>
+inline T* VectorView<T>::GetDataPointer() const {
+    return dataPointer;
+}
+
+template<typename T>
+inline uint32 VectorView<T>::GetNumberOfElements() const {
+    return numberOfElements;
+}
+
+template<typename T>
+inline uint32 VectorView<T>::GetStride() const {
+    return stride;
+}
+
+template<typename T>
+inline bool VectorView<T>::IsContiguous() const {
+    return ((stride == 1u) || (numberOfElements <= 1u));
+}
+
+template<typename T>
+bool VectorView<T>::SubView(const uint32 beginIdx,
+                            const uint32 nOfElements,
+                            const uint32 step,
+                            VectorView<T> &subView) const {
+    bool ret = ((step > 0u) && (nOfElements > 0u));
+    if (ret) {
+        ret = ((beginIdx + ((nOfElements - 1u) * step)) < numberOfElements);
+    }
+    if (ret) {
+        subView = VectorView<T>(&dataPointer[beginIdx * stride], nOfElements, stride * step);
+    }
+    return ret;
+}
+
+template<typename T>
+bool VectorView<T>::Product(const VectorView<T> &factor,
+                            T &result) const {
+    bool ret = (factor.numberOfElements == numberOfElements);
+    if (ret) {
+        if ((IsContiguous()) && (factor.IsContiguous())) {
+            result = MatrixKernels::Dot(static_cast<const T*>(dataPointer), static_cast<const T*>(factor.dataPointer), numberOfElements);
+        }
+        else {
+            result = static_cast<T>(0);
+            for (uint32 i = 0u; i < numberOfElements; i++) {
+                result += (*this)[i] * factor[i];
+            }
+        }
+    }
+    return ret;
+}
+
+template<typename T>
+bool VectorView<T>::Copy(const VectorView<T> &source) const {
+    bool ret = (source.numberOfElements == numberOfElements);
+    for (uint32 i = 0u; (i < numberOfElements) && (ret); i++) {
+        (*this)[i] = source[i];
+    }
+    return ret;
+}
+
+}
+
+#endif /* VECTORVIEW_H_ */
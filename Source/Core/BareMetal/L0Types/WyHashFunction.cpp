@@ -0,0 +1,189 @@
+/**
+ * @file WyHashFunction.cpp
+ * @brief Source file for class WyHashFunction
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class WyHashFunction (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "WyHashFunction.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * The default wyhash secret.
+ */
+const MARTe::uint64 WY_SECRET[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+/**
+ * @brief Computes the 128 bit product of a and b, returning the low 64 bits in a and the high 64 bits in b.
+ */
+inline void WyMum(MARTe::uint64 &a,
+                  MARTe::uint64 &b) {
+#if defined(__SIZEOF_INT128__)
+    /*lint -e{970} the 128 bit integer is a compiler extension without a MARTe type.*/
+    unsigned __int128 r = a;
+    r *= b;
+    a = static_cast<MARTe::uint64>(r);
+    b = static_cast<MARTe::uint64>(r >> 64u);
+#else
+    const MARTe::uint64 ha = a >> 32u;
+    const MARTe::uint64 hb = b >> 32u;
+    const MARTe::uint64 la = static_cast<MARTe::uint32>(a);
+    const MARTe::uint64 lb = static_cast<MARTe::uint32>(b);
+    const MARTe::uint64 rh = ha * hb;
+    const MARTe::uint64 rm0 = ha * lb;
+    const MARTe::uint64 rm1 = hb * la;
+    const MARTe::uint64 rl = la * lb;
+    const MARTe::uint64 t = rl + (rm0 << 32u);
+    MARTe::uint64 c = (t < rl) ? 1u : 0u;
+    const MARTe::uint64 lo = t + (rm1 << 32u);
+    c += (lo < t) ? 1u : 0u;
+    a = lo;
+    b = rh + (rm0 >> 32u) + (rm1 >> 32u) + c;
+#endif
+}
+
+/**
+ * @brief Multiplies a and b (128 bits) and folds the product to 64 bits.
+ */
+inline MARTe::uint64 WyMix(MARTe::uint64 a,
+                           MARTe::uint64 b) {
+    WyMum(a, b);
+    return a ^ b;
+}
+
+/**
+ * @brief Reads 4 bytes in little endian order.
+ */
+inline MARTe::uint64 WyRead4(const MARTe::uint8 * const p) {
+    MARTe::uint32 v = static_cast<MARTe::uint32>(p[0]);
+    v |= static_cast<MARTe::uint32>(p[1]) << 8u;
+    v |= static_cast<MARTe::uint32>(p[2]) << 16u;
+    v |= static_cast<MARTe::uint32>(p[3]) << 24u;
+    return static_cast<MARTe::uint64>(v);
+}
+
+/**
+ * @brief Reads 8 bytes in little endian order.
+ */
+inline MARTe::uint64 WyRead8(const MARTe::uint8 * const p) {
+    //Written as independent shifts so that the compiler merges them in a single (unaligned) load
+    return static_cast<MARTe::uint64>(WyRead4(p)) | (static_cast<MARTe::uint64>(WyRead4(&p[4])) << 32u);
+}
+
+/**
+ * @brief Reads 1 to 3 bytes (the first, the middle and the last).
+ */
+inline MARTe::uint64 WyRead3(const MARTe::uint8 * const p,
+                             const MARTe::uint32 k) {
+    return ((static_cast<MARTe::uint64>(p[0]) << 16u) | (static_cast<MARTe::uint64>(p[k >> 1u]) << 8u)) | static_cast<MARTe::uint64>(p[k - 1u]);
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+WyHashFunction::WyHashFunction(const uint64 seedIn) :
+        HashFunction() {
+    seed = seedIn;
+}
+
+WyHashFunction::~WyHashFunction() {
+}
+
+uint32 WyHashFunction::Compute(const char8 * const in,
+                               const uint32 size) {
+    uint64 hash = Compute64(in, size);
+    return static_cast<uint32>(hash ^ (hash >> 32u));
+}
+
+uint64 WyHashFunction::Compute64(const char8 * const in,
+                                 const uint32 size) const {
+    const uint8 * const in8 = reinterpret_cast<const uint8 *>(in);
+    const uint8 *p = in8;
+    uint32 len = size;
+    if ((p != NULL) && (len == 0u)) {
+        while (p[len] != 0u) {
+            len++;
+        }
+    }
+    uint64 s = seed ^ WyMix(seed ^ WY_SECRET[0], WY_SECRET[1]);
+    uint64 a = 0u;
+    uint64 b = 0u;
+    if (p != NULL) {
+        if (len <= 16u) {
+            if (len >= 4u) {
+                const uint32 mid = ((len >> 3u) << 2u);
+                a = (WyRead4(p) << 32u) | WyRead4(&p[mid]);
+                b = (WyRead4(&p[len - 4u]) << 32u) | WyRead4(&p[(len - 4u) - mid]);
+            }
+            else if (len > 0u) {
+                a = WyRead3(p, len);
+            }
+            else {
+                //NOOP
+            }
+        }
+        else {
+            uint32 i = len;
+            if (i > 48u) {
+                uint64 see1 = s;
+                uint64 see2 = s;
+                while (i > 48u) {
+                    s = WyMix(WyRead8(p) ^ WY_SECRET[1], WyRead8(&p[8]) ^ s);
+                    see1 = WyMix(WyRead8(&p[16]) ^ WY_SECRET[2], WyRead8(&p[24]) ^ see1);
+                    see2 = WyMix(WyRead8(&p[32]) ^ WY_SECRET[3], WyRead8(&p[40]) ^ see2);
+                    p = &p[48];
+                    i -= 48u;
+                }
+                s ^= see1 ^ see2;
+            }
+            while (i > 16u) {
+                s = WyMix(WyRead8(p) ^ WY_SECRET[1], WyRead8(&p[8]) ^ s);
+                i -= 16u;
+                p = &p[16];
+            }
+            //The last 16 bytes, which may overlap the ones already consumed
+            const uint8 * const last = &in8[len - 16u];
+            a = WyRead8(last);
+            b = WyRead8(&last[8]);
+        }
+    }
+    a ^= WY_SECRET[1];
+    b ^= s;
+    WyMum(a, b);
+    return WyMix((a ^ WY_SECRET[0]) ^ static_cast<uint64>(len), b ^ WY_SECRET[1]);
+}
+
+}
@@ -0,0 +1,92 @@
+/**
+ * @file WyHashFunction.h
+ * @brief Header file for class WyHashFunction
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class WyHashFunction
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_CORE_BAREMETAL_L0TYPES_WYHASHFUNCTION_H_
+#define SOURCE_CORE_BAREMETAL_L0TYPES_WYHASHFUNCTION_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "HashFunction.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief wyhash (final version 4) 64 bit hash function.
+ * @details Reads the input eight bytes at a time (little endian, independently of the alignment) and mixes the words with
+ * 64x64->128 bit multiplications, so that the dependency chain is one multiplication for each 16 bytes (instead of one per byte
+ * as in Fnv1aHashFunction and DjbHashFunction). Strings up to 16 bytes, as the typical path components, are hashed
+ * with only two multiplications.
+ *
+ * Compute returns the 64 bit hash folded to 32 bits; Compute64 returns the full hash.
+ * It is not a cryptographic hash.
+ */
+class WyHashFunction: public HashFunction {
+public:
+
+    /**
+     * @brief Constructor
+     * @param[in] seedIn the seed of the hash (different seeds give independent hash functions).
+     */
+    WyHashFunction(const uint64 seedIn = 0u);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~WyHashFunction();
+
+    /**
+     * @see HashFunction::Compute
+     */
+    virtual uint32 Compute(const char8 * const in, const uint32 size=0u);
+
+    /**
+     * @brief Computes the 64 bit hash.
+     * @param[in] in the input string
+     * @param[in] size the size of the input (if 0 is the string length)
+     * @return the 64 bit hash.
+     */
+    uint64 Compute64(const char8 * const in, const uint32 size=0u) const;
+
+private:
+
+    /**
+     * The seed of the hash.
+     */
+    uint64 seed;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_CORE_BAREMETAL_L0TYPES_WYHASHFUNCTION_H_ */
@@ -0,0 +1,118 @@
+/**
+ * @file AddressEventSem.cpp
+ * @brief Source file for class AddressEventSem
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class AddressEventSem (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#define DLL_API
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AddressEventSem.h"
+#include "AddressWait.h"
+#include "Atomic.h"
+#include "HighResolutionTimer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+
+/**
+ * Bit of the event word set when the barrier is lowered.
+ */
+const MARTe::int32 ADDRESS_EVENT_SEM_POSTED = 0x1;
+
+/**
+ * Bit of the event word set when a thread is (or is about to be) blocked in the kernel.
+ */
+const MARTe::int32 ADDRESS_EVENT_SEM_WAITERS = 0x2;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+AddressEventSem::AddressEventSem() {
+    eventWord = 0;
+}
+
+void AddressEventSem::Post() {
+    int32 previous = Atomic::Exchange(&eventWord, ADDRESS_EVENT_SEM_POSTED);
+    if ((previous & ADDRESS_EVENT_SEM_WAITERS) != 0) {
+        AddressWait::WakeAll(&eventWord);
+    }
+}
+
+void AddressEventSem::Reset() {
+    //The waiters (if any) are woken up so that they announce themselves again on the new word value
+    int32 previous = Atomic::Exchange(&eventWord, 0);
+    if ((previous & ADDRESS_EVENT_SEM_WAITERS) != 0) {
+        AddressWait::WakeAll(&eventWord);
+    }
+}
+
+bool AddressEventSem::IsPosted() const {
+    return ((Atomic::LoadAcquire(&eventWord) & ADDRESS_EVENT_SEM_POSTED) != 0);
+}
+
+ErrorManagement::ErrorType AddressEventSem::Wait(const TimeoutType &timeout) {
+    ErrorManagement::ErrorType err;
+    uint64 start = HighResolutionTimer::Counter();
+    bool posted = false;
+    while ((!posted) && (err.ErrorsCleared())) {
+        int32 state = Atomic::LoadAcquire(&eventWord);
+        if ((state & ADDRESS_EVENT_SEM_POSTED) != 0) {
+            posted = true;
+        }
+        else if ((state & ADDRESS_EVENT_SEM_WAITERS) == 0) {
+            //Announce the waiter before blocking, so that the Post wakes it up (retry if the word changed meanwhile)
+            (void) Atomic::CompareExchange(&eventWord, state, state | ADDRESS_EVENT_SEM_WAITERS);
+        }
+        else {
+            TimeoutType remaining = timeout;
+            if (timeout.IsFinite()) {
+                uint64 elapsed = HighResolutionTimer::Counter() - start;
+                uint64 timeoutTicks = timeout.HighResolutionTimerTicks();
+                err.timeout = (elapsed >= timeoutTicks);
+                if (!err.timeout) {
+                    remaining.SetTimeoutHighResolutionTimerTicks(timeoutTicks - elapsed);
+                }
+            }
+            if (err.ErrorsCleared()) {
+                err = AddressWait::Wait(&eventWord, state, remaining);
+            }
+        }
+    }
+    //The Post may have arrived just as the timeout expired
+    if ((!posted) && (IsPosted())) {
+        err.timeout = false;
+    }
+    return err;
+}
+
+}
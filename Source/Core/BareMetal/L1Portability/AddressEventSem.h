@@ -0,0 +1,97 @@
+/**
+ * @file AddressEventSem.h
+ * @brief Header file for class AddressEventSem
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class AddressEventSem
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef ADDRESSEVENTSEM_H_
+#define ADDRESSEVENTSEM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ErrorType.h"
+#include "GeneralDefinitions.h"
+#include "TimeoutType.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Event semaphore stored in a single memory word, which blocks the waiting threads in the operating system (see AddressWait).
+ * @details Unlike the EventSem it does not own any operating system resource (so that it can be a member of short-lived objects
+ * and be used in the BareMetal layers) and, unlike the FastPollingEventSem, the waiting threads do not poll: they are woken up
+ * by the Post. A Post only enters the kernel if a thread is (or is about to be) blocked in Wait.
+ */
+class DLL_API AddressEventSem {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   IsPosted() == false
+     */
+    AddressEventSem();
+
+    /**
+     * @brief Lowers the barrier and wakes up all the threads blocked in Wait.
+     * @details The memory writes before the Post are visible to the threads that return from Wait.
+     */
+    void Post();
+
+    /**
+     * @brief Raises the barrier.
+     */
+    void Reset();
+
+    /**
+     * @brief Checks if the barrier is lowered.
+     * @return true if Post was called after the last Reset.
+     */
+    bool IsPosted() const;
+
+    /**
+     * @brief Waits until the barrier is lowered by a Post (or the timeout expires).
+     * @param[in] timeout the maximum time to wait.
+     * @return ErrorManagement::NoError if the barrier is (or is lowered while waiting), ErrorManagement::Timeout otherwise.
+     */
+    ErrorManagement::ErrorType Wait(const TimeoutType &timeout = TTInfiniteWait);
+
+private:
+
+    /**
+     * ADDRESS_EVENT_SEM_POSTED if the barrier is lowered and ADDRESS_EVENT_SEM_WAITERS if a thread is (or is about to be) blocked in Wait.
+     */
+    volatile int32 eventWord;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* ADDRESSEVENTSEM_H_ */
@@ -0,0 +1,78 @@
+/**
+ * @file AddressWait.h
+ * @brief Header file for module AddressWait
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module AddressWait
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef ADDRESSWAIT_H_
+#define ADDRESSWAIT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "GeneralDefinitions.h"
+#include "TimeoutType.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief Blocking wait on the value of a memory word (e.g. a futex on Linux).
+     * @details Allows the BareMetal classes (which cannot use the Scheduler EventSem) to block a thread until another thread changes
+     * a word and wakes it up, without having to create any operating system resource per word. The waker shall only call WakeAll
+     * after changing the word, and only if a waiter may be blocked on it (e.g. signalled by a bit of the word), so that the
+     * uncontended case does not enter the kernel (see AddressEventSem).
+     */
+    namespace AddressWait {
+
+        /**
+         * @brief Blocks the calling thread while *address is equal to value, until it is woken up by WakeAll or the timeout expires.
+         * @details Returns immediately if *address is not equal to value. Spurious wake-ups are possible, so the caller must always
+         * check *address again.
+         * @param[in] address the word to wait on.
+         * @param[in] value the value that keeps the caller blocked.
+         * @param[in] timeout the maximum time to wait (relative to the call).
+         * @return ErrorManagement::Timeout if the timeout expired, ErrorManagement::NoError otherwise.
+         */
+        ErrorManagement::ErrorType Wait(volatile int32 * const address, const int32 value, const TimeoutType &timeout);
+
+        /**
+         * @brief Wakes up all the threads blocked in Wait on \a address.
+         * @param[in] address the word that was changed.
+         */
+        void WakeAll(volatile int32 * const address);
+    }
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* ADDRESSWAIT_H_ */
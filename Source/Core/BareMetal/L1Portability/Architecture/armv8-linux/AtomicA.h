@@ -196,6 +196,154 @@ inline void Sub(volatile int32 *p,
     asm volatile( "cpsie i");*/
 }
 
+/**
+ * @brief Maps a MemoryOrder to the GCC __ATOMIC_* constant.
+ * @details When the order is a compile time constant (as it is after inlining)
+ * the compiler selects the matching instruction sequence, i.e. LSE ldadd/cas
+ * (with the a/l suffixes) when built for ARMv8.1 or with -moutline-atomics,
+ * and ldxr/stxr loops (with ldaxr/stlxr only when required) otherwise.
+ */
+inline int32 ToBuiltinOrder(const MemoryOrder order) {
+    int32 ret = __ATOMIC_SEQ_CST;
+    if (order == MemoryOrderRelaxed) {
+        ret = __ATOMIC_RELAXED;
+    }
+    else if (order == MemoryOrderAcquire) {
+        ret = __ATOMIC_ACQUIRE;
+    }
+    else if (order == MemoryOrderRelease) {
+        ret = __ATOMIC_RELEASE;
+    }
+    else if (order == MemoryOrderAcquireRelease) {
+        ret = __ATOMIC_ACQ_REL;
+    }
+    else {
+        ret = __ATOMIC_SEQ_CST;
+    }
+    return ret;
+}
+
+/**
+ * @brief Gets the failure ordering of a compare-and-swap, which cannot contain a release.
+ */
+inline int32 ToBuiltinFailureOrder(const MemoryOrder order) {
+    int32 ret = __ATOMIC_SEQ_CST;
+    if ((order == MemoryOrderRelaxed) || (order == MemoryOrderRelease)) {
+        ret = __ATOMIC_RELAXED;
+    }
+    else if ((order == MemoryOrderAcquire) || (order == MemoryOrderAcquireRelease)) {
+        ret = __ATOMIC_ACQUIRE;
+    }
+    else {
+        ret = __ATOMIC_SEQ_CST;
+    }
+    return ret;
+}
+
+inline int32 LoadAcquire(const volatile int32 *p) {
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+inline int64 LoadAcquire(const volatile int64 *p) {
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+inline int32 Load(const volatile int32 *p,
+                  const MemoryOrder order) {
+    return __atomic_load_n(p, ToBuiltinFailureOrder(order));
+}
+
+inline int64 Load(const volatile int64 *p,
+                  const MemoryOrder order) {
+    return __atomic_load_n(p, ToBuiltinFailureOrder(order));
+}
+
+inline void StoreRelease(volatile int32 *p,
+                         const int32 value) {
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+inline void StoreRelease(volatile int64 *p,
+                         const int64 value) {
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+inline void Store(volatile int32 *p,
+                  const int32 value,
+                  const MemoryOrder order) {
+    if (order == MemoryOrderRelaxed) {
+        __atomic_store_n(p, value, __ATOMIC_RELAXED);
+    }
+    else if ((order == MemoryOrderRelease) || (order == MemoryOrderAcquireRelease)) {
+        __atomic_store_n(p, value, __ATOMIC_RELEASE);
+    }
+    else {
+        __atomic_store_n(p, value, __ATOMIC_SEQ_CST);
+    }
+}
+
+inline void Store(volatile int64 *p,
+                  const int64 value,
+                  const MemoryOrder order) {
+    if (order == MemoryOrderRelaxed) {
+        __atomic_store_n(p, value, __ATOMIC_RELAXED);
+    }
+    else if ((order == MemoryOrderRelease) || (order == MemoryOrderAcquireRelease)) {
+        __atomic_store_n(p, value, __ATOMIC_RELEASE);
+    }
+    else {
+        __atomic_store_n(p, value, __ATOMIC_SEQ_CST);
+    }
+}
+
+inline bool CompareExchange(volatile int32 *p,
+                            int32 &expected,
+                            const int32 desired,
+                            const MemoryOrder order) {
+    return __atomic_compare_exchange_n(p, &expected, desired, false, ToBuiltinOrder(order), ToBuiltinFailureOrder(order));
+}
+
+inline bool CompareExchange(volatile int64 *p,
+                            int64 &expected,
+                            const int64 desired,
+                            const MemoryOrder order) {
+    return __atomic_compare_exchange_n(p, &expected, desired, false, ToBuiltinOrder(order), ToBuiltinFailureOrder(order));
+}
+
+inline int32 FetchAdd(volatile int32 *p,
+                      const int32 value,
+                      const MemoryOrder order) {
+    return __atomic_fetch_add(p, value, ToBuiltinOrder(order));
+}
+
+inline int64 FetchAdd(volatile int64 *p,
+                      const int64 value,
+                      const MemoryOrder order) {
+    return __atomic_fetch_add(p, value, ToBuiltinOrder(order));
+}
+
+inline void WaitWhileEqual(const volatile int32 *p,
+                           const int32 value) {
+#if defined(__aarch64__)
+    int32 current;
+    __asm__ volatile (
+            "ldaxr %w0, [%1]\n\t"
+            "cmp %w0, %w2\n\t"
+            "b.ne 1f\n\t"
+            "wfe\n"
+            "1:"
+            : "=&r" (current) : "r" (p), "r" (value) : "cc", "memory"
+    );
+#else
+    (void) p;
+    (void) value;
+#endif
+}
+
+inline void ThreadFence(const MemoryOrder order) {
+    __atomic_thread_fence(ToBuiltinOrder(order));
+}
+
 }
 
 }
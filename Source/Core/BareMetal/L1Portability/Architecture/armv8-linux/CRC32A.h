@@ -0,0 +1,166 @@
+/**
+ * @file CRC32A.h
+ * @brief Header file for module CRC32A
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CRC32A
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CRC32A_H_
+#define CRC32A_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace CRC32 {
+
+/**
+ * @brief Checks if this target can be compiled with the ARMv8 CRC instructions (the availability in the running processor
+ * is checked by the environment, see IsHardwareAccelerated).
+ */
+inline bool ArchitectureHasCRCInstructions();
+
+/**
+ * @brief Updates a running CRC-32 with the crc32b/h/w/x instructions.
+ * @pre ArchitectureHasCRCInstructions() and the processor implements the CRC32 extension.
+ */
+inline uint32 HardwareUpdate(uint32 crc, const uint8 * data, uint32 size);
+
+/**
+ * @brief Updates a running CRC-32C with the crc32cb/ch/cw/cx instructions.
+ * @pre ArchitectureHasCRCInstructions() and the processor implements the CRC32 extension.
+ */
+inline uint32 HardwareUpdateC(uint32 crc, const uint8 * data, uint32 size);
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace CRC32 {
+
+#if defined(__aarch64__)
+/*lint -save -e586 -e950 inline assembly is required to access the CRC instructions. */
+
+inline bool ArchitectureHasCRCInstructions() {
+    return true;
+}
+
+/* The CRC extension is optional in ARMv8.0, so the instructions are enabled only for these functions (the caller checks
+ * HWCAP_CRC32 before calling them), leaving the rest of the code compiled for the baseline architecture.*/
+__attribute__((target("+crc")))
+inline uint32 HardwareUpdate(uint32 crc, const uint8 * data, uint32 size) {
+    //Align the data to 8 bytes so that the 64 bit loads never cross a cache line
+    while ((size > 0u) && ((reinterpret_cast<uintp>(data) & 7u) != 0u)) {
+        __asm__ ("crc32b %w0, %w0, %w1" : "+r" (crc) : "r" (static_cast<uint32>(*data)));
+        data++;
+        size--;
+    }
+    while (size >= 8u) {
+        const uint64 word = *reinterpret_cast<const uint64 *>(data);
+        __asm__ ("crc32x %w0, %w0, %x1" : "+r" (crc) : "r" (word));
+        data += 8u;
+        size -= 8u;
+    }
+    if (size >= 4u) {
+        const uint32 word = *reinterpret_cast<const uint32 *>(data);
+        __asm__ ("crc32w %w0, %w0, %w1" : "+r" (crc) : "r" (word));
+        data += 4u;
+        size -= 4u;
+    }
+    if (size >= 2u) {
+        const uint32 half = static_cast<uint32>(*reinterpret_cast<const uint16 *>(data));
+        __asm__ ("crc32h %w0, %w0, %w1" : "+r" (crc) : "r" (half));
+        data += 2u;
+        size -= 2u;
+    }
+    if (size > 0u) {
+        __asm__ ("crc32b %w0, %w0, %w1" : "+r" (crc) : "r" (static_cast<uint32>(*data)));
+    }
+    return crc;
+}
+
+__attribute__((target("+crc")))
+inline uint32 HardwareUpdateC(uint32 crc, const uint8 * data, uint32 size) {
+    while ((size > 0u) && ((reinterpret_cast<uintp>(data) & 7u) != 0u)) {
+        __asm__ ("crc32cb %w0, %w0, %w1" : "+r" (crc) : "r" (static_cast<uint32>(*data)));
+        data++;
+        size--;
+    }
+    while (size >= 8u) {
+        const uint64 word = *reinterpret_cast<const uint64 *>(data);
+        __asm__ ("crc32cx %w0, %w0, %x1" : "+r" (crc) : "r" (word));
+        data += 8u;
+        size -= 8u;
+    }
+    if (size >= 4u) {
+        const uint32 word = *reinterpret_cast<const uint32 *>(data);
+        __asm__ ("crc32cw %w0, %w0, %w1" : "+r" (crc) : "r" (word));
+        data += 4u;
+        size -= 4u;
+    }
+    if (size >= 2u) {
+        const uint32 half = static_cast<uint32>(*reinterpret_cast<const uint16 *>(data));
+        __asm__ ("crc32ch %w0, %w0, %w1" : "+r" (crc) : "r" (half));
+        data += 2u;
+        size -= 2u;
+    }
+    if (size > 0u) {
+        __asm__ ("crc32cb %w0, %w0, %w1" : "+r" (crc) : "r" (static_cast<uint32>(*data)));
+    }
+    return crc;
+}
+
+/*lint -restore */
+#else
+
+inline bool ArchitectureHasCRCInstructions() {
+    return false;
+}
+
+inline uint32 HardwareUpdate(const uint32 crc, const uint8 * const, const uint32) {
+    return crc;
+}
+
+inline uint32 HardwareUpdateC(const uint32 crc, const uint8 * const, const uint32) {
+    return crc;
+}
+
+#endif
+
+}
+
+}
+
+#endif /* CRC32A_H_ */
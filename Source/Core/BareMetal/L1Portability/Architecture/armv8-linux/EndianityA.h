@@ -27,6 +27,9 @@
 /*---------------------------------------------------------------------------*/
 /*                        Standard header includes                           */
 /*---------------------------------------------------------------------------*/
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
@@ -52,30 +55,28 @@ inline void Swap16(volatile void *x) {
     *(uint16*)x=__builtin_bswap16(*(uint16*)x);
 }
 
-inline void Swap16(volatile void *x,
-                   uint32 sizer) {
-    int16 *xx = (int16 *) x;
-
-    for (uint32 i = 0; i < sizer; i++) {
-        void* xptr = (void *) xx;
-        Swap16(xptr);
-        xx++;
-    }
-}
-
 inline void MemCopySwap16(volatile void *dest,
                           volatile const void *src,
                           uint32 sizer) {
-    int16 *s = (int16 *) src;
-    int16 *d = (int16 *) dest;
-    for (uint32 i = 0; i < sizer; i++) {
-        *d = *s;
-        Swap16(d);
-        d++;
-        s++;
+    uint16 *s = (uint16 *) src;
+    uint16 *d = (uint16 *) dest;
+    uint32 i = 0u;
+#if defined(__aarch64__)
+    //8 elements per rev16. Each vector is loaded before being stored, so that dest may be equal to src.
+    for (; (i + 8u) <= sizer; i += 8u) {
+        vst1q_u8((uint8 *) &d[i], vrev16q_u8(vld1q_u8((uint8 *) &s[i])));
+    }
+#endif
+    for (; i < sizer; i++) {
+        d[i] = __builtin_bswap16(s[i]);
     }
 }
 
+inline void Swap16(volatile void *x,
+                   uint32 sizer) {
+    MemCopySwap16(x, x, sizer);
+}
+
 inline void Swap32(volatile void *x) {
     /*int16 *p = (int16 *) x;
     Swap16(&p[0]);
@@ -86,31 +87,28 @@ inline void Swap32(volatile void *x) {
     *(uint32*)x=__builtin_bswap32(*(uint32*)x);
 }
 
-inline void Swap32(volatile void *x,
-                   uint32 sizer) {
-    int32 *xx = (int32 *) x;
-    for (uint32 i = 0; i < sizer; i++) {
-
-        void* xptr = (void *) xx;
-        Swap32(xptr);
-
-        xx++;
-    }
-}
-
 inline void MemCopySwap32(volatile void *dest,
                           volatile const void *src,
                           uint32 sizer) {
-    int32 *s = (int32 *) src;
-    int32 *d = (int32 *) dest;
-    for (uint32 i = 0; i < sizer; i++) {
-        *d = *s;
-        Swap32(d);
-        d++;
-        s++;
+    uint32 *s = (uint32 *) src;
+    uint32 *d = (uint32 *) dest;
+    uint32 i = 0u;
+#if defined(__aarch64__)
+    //4 elements per rev32. Each vector is loaded before being stored, so that dest may be equal to src.
+    for (; (i + 4u) <= sizer; i += 4u) {
+        vst1q_u8((uint8 *) &d[i], vrev32q_u8(vld1q_u8((uint8 *) &s[i])));
+    }
+#endif
+    for (; i < sizer; i++) {
+        d[i] = __builtin_bswap32(s[i]);
     }
 }
 
+inline void Swap32(volatile void *x,
+                   uint32 sizer) {
+    MemCopySwap32(x, x, sizer);
+}
+
 inline void Swap64(volatile void *x) {
     /*
     int32 *p = (int32 *) x;
@@ -126,16 +124,25 @@ inline void Swap64(volatile void *x) {
 inline void MemCopySwap64(volatile void *dest,
                           volatile const void *src,
                           uint32 sizer) {
-    int64 *s = (int64 *) src;
-    int64 *d = (int64 *) dest;
-    for (uint32 i = 0; i < sizer; i++) {
-        *d = *s;
-        Swap64(d);
-        d++;
-        s++;
+    uint64 *s = (uint64 *) src;
+    uint64 *d = (uint64 *) dest;
+    uint32 i = 0u;
+#if defined(__aarch64__)
+    //2 elements per rev64. Each vector is loaded before being stored, so that dest may be equal to src.
+    for (; (i + 2u) <= sizer; i += 2u) {
+        vst1q_u8((uint8 *) &d[i], vrev64q_u8(vld1q_u8((uint8 *) &s[i])));
+    }
+#endif
+    for (; i < sizer; i++) {
+        d[i] = __builtin_bswap64(s[i]);
     }
 }
 
+inline void Swap64(volatile void *x,
+                   uint32 sizer) {
+    MemCopySwap64(x, x, sizer);
+}
+
 inline void FromBigEndian(volatile float64 &x) {
     Swap64(&x);
 }
@@ -27,6 +27,10 @@
 /*---------------------------------------------------------------------------*/
 /*                        Standard header includes                           */
 /*---------------------------------------------------------------------------*/
+#include <math.h>
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
@@ -56,32 +60,158 @@ typedef __int128_t int128;
 typedef __uint128_t uint128;
 #endif
 
-inline float Sin(const float angle) {
-    volatile float output;
-    __asm__ __volatile__(
-            "fsin"
-            : "=t" (output) : "0" (angle)
-    );
+/**
+ * Cody-Waite split of pi/2 (the first two terms are exact in float32).
+ */
+const float32 FASTMATH_PIO2_1 = 1.5703125F;
+const float32 FASTMATH_PIO2_2 = 4.837512969970703125e-4F;
+const float32 FASTMATH_PIO2_3 = 7.54978995489188216e-8F;
+
+/**
+ * 2/pi in single precision.
+ */
+const float32 FASTMATH_TWO_PI_F = 0.636619772367581343F;
+
+/**
+ * Minimax coefficients of sin(r) and cos(r) for |r| <= pi/4.
+ */
+const float32 FASTMATH_SIN_C1 = -1.6666654611E-1F;
+const float32 FASTMATH_SIN_C2 = 8.3321608736E-3F;
+const float32 FASTMATH_SIN_C3 = -1.9515295891E-4F;
+const float32 FASTMATH_COS_C1 = 4.166664568298827E-2F;
+const float32 FASTMATH_COS_C2 = -1.388731625493765E-3F;
+const float32 FASTMATH_COS_C3 = 2.443315711809948E-5F;
+
+inline float32 RoundToNearest(const float32 input) {
+#if defined(__aarch64__)
+    float32 output;
+    __asm__ ("frintn %s0, %s1" : "=w" (output) : "w" (input));
     return output;
+#else
+    return rintf(input);
+#endif
 }
 
-inline float Cos(const float angle) {
-    volatile float output;
-    __asm__ __volatile__(
-            "fcos;"
-            : "=t" (output) : "0" (angle)
-    );
+/**
+ * @brief Evaluates sin (quadrant even) or cos (quadrant odd) of angle + quadrantOffset * pi/2.
+ * @details The angle is reduced to [-pi/4, pi/4] with a three term Cody-Waite
+ * reduction and the result is obtained with a degree 7 (sin) or degree 8 (cos)
+ * polynomial. The maximum error is a few ulp for |angle| < 1e4.
+ */
+inline float32 SinCosKernel(const float32 angle,
+                            const int32 quadrantOffset) {
+    float32 qf = RoundToNearest(angle * FASTMATH_TWO_PI_F);
+    int32 quadrant = static_cast<int32>(qf) + quadrantOffset;
+    float32 r = angle - (qf * FASTMATH_PIO2_1);
+    r -= (qf * FASTMATH_PIO2_2);
+    r -= (qf * FASTMATH_PIO2_3);
+    float32 r2 = r * r;
+    float32 output;
+    if ((quadrant & 1) != 0) {
+        output = (1.0F - (0.5F * r2)) + ((r2 * r2) * (FASTMATH_COS_C1 + (r2 * (FASTMATH_COS_C2 + (r2 * FASTMATH_COS_C3)))));
+    }
+    else {
+        output = r + ((r * r2) * (FASTMATH_SIN_C1 + (r2 * (FASTMATH_SIN_C2 + (r2 * FASTMATH_SIN_C3)))));
+    }
+    if ((quadrant & 2) != 0) {
+        output = -output;
+    }
     return output;
 }
 
-inline int32 FloatToInt(const float input) {
-    volatile int32 output;
-    __asm__ __volatile__(
-            "fld   %1;\n"
-            "fistpl %0;"
-            : "=m" (output) : "m" (input)
+inline float32 Sin(const float32 angle) {
+    return SinCosKernel(angle, 0);
+}
+
+inline float32 Cos(const float32 angle) {
+    return SinCosKernel(angle, 1);
+}
+
+inline int32 FloatToInt(const float32 input) {
+#if defined(__aarch64__)
+    int32 output;
+    float32 rounded;
+    __asm__ (
+            "frintn %s1, %s2\n\t"
+            "fcvtzs %w0, %s1"
+            : "=r" (output), "=&w" (rounded) : "w" (input)
     );
     return output;
+#else
+    return static_cast<int32>(rintf(input));
+#endif
+}
+
+#if defined(__aarch64__)
+/**
+ * @brief NEON version of SinCosKernel operating on four lanes.
+ */
+inline float32x4_t SinCosKernelNEON(const float32x4_t angle,
+                                    const int32 quadrantOffset) {
+    float32x4_t qf = vrndnq_f32(vmulq_n_f32(angle, FASTMATH_TWO_PI_F));
+    int32x4_t quadrant = vaddq_s32(vcvtq_s32_f32(qf), vdupq_n_s32(quadrantOffset));
+    float32x4_t r = vfmsq_f32(angle, qf, vdupq_n_f32(FASTMATH_PIO2_1));
+    r = vfmsq_f32(r, qf, vdupq_n_f32(FASTMATH_PIO2_2));
+    r = vfmsq_f32(r, qf, vdupq_n_f32(FASTMATH_PIO2_3));
+    float32x4_t r2 = vmulq_f32(r, r);
+
+    float32x4_t ps = vfmaq_f32(vdupq_n_f32(FASTMATH_SIN_C2), r2, vdupq_n_f32(FASTMATH_SIN_C3));
+    ps = vfmaq_f32(vdupq_n_f32(FASTMATH_SIN_C1), r2, ps);
+    ps = vfmaq_f32(r, vmulq_f32(r, r2), ps);
+
+    float32x4_t pc = vfmaq_f32(vdupq_n_f32(FASTMATH_COS_C2), r2, vdupq_n_f32(FASTMATH_COS_C3));
+    pc = vfmaq_f32(vdupq_n_f32(FASTMATH_COS_C1), r2, pc);
+    pc = vfmaq_f32(vfmsq_f32(vdupq_n_f32(1.0F), r2, vdupq_n_f32(0.5F)), vmulq_f32(r2, r2), pc);
+
+    uint32x4_t useCos = vtstq_s32(quadrant, vdupq_n_s32(1));
+    float32x4_t output = vbslq_f32(useCos, pc, ps);
+    uint32x4_t negate = vandq_u32(vtstq_s32(quadrant, vdupq_n_s32(2)), vdupq_n_u32(0x80000000U));
+    return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(output), negate));
+}
+#endif
+
+/**
+ * @brief Applies SinCosKernel to an array, four elements at a time when NEON is available.
+ */
+inline void SinCosKernelArray(const float32 * const input,
+                              float32 * const output,
+                              const uint32 numberOfElements,
+                              const int32 quadrantOffset) {
+    uint32 i = 0u;
+#if defined(__aarch64__)
+    for (; (i + 4u) <= numberOfElements; i += 4u) {
+        vst1q_f32(&output[i], SinCosKernelNEON(vld1q_f32(&input[i]), quadrantOffset));
+    }
+#endif
+    for (; i < numberOfElements; i++) {
+        output[i] = SinCosKernel(input[i], quadrantOffset);
+    }
+}
+
+inline void Sin(const float32 * const input,
+                float32 * const output,
+                const uint32 numberOfElements) {
+    SinCosKernelArray(input, output, numberOfElements, 0);
+}
+
+inline void Cos(const float32 * const input,
+                float32 * const output,
+                const uint32 numberOfElements) {
+    SinCosKernelArray(input, output, numberOfElements, 1);
+}
+
+inline void FloatToInt(const float32 * const input,
+                       int32 * const output,
+                       const uint32 numberOfElements) {
+    uint32 i = 0u;
+#if defined(__aarch64__)
+    for (; (i + 4u) <= numberOfElements; i += 4u) {
+        vst1q_s32(&output[i], vcvtnq_s32_f32(vld1q_f32(&input[i])));
+    }
+#endif
+    for (; i < numberOfElements; i++) {
+        output[i] = FloatToInt(input[i]);
+    }
 }
 
 template<typename T1,typename T2> T1 UMulT (T1 x1,T1 x2,T1 &high){
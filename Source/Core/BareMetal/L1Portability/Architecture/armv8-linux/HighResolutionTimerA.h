@@ -50,20 +50,71 @@ namespace HighResolutionTimer {
 
 uint64 Frequency();
 
+/**
+ * @brief Reads the ARMv8 generic timer virtual count (CNTVCT_EL0).
+ * @details The generic timer is a monotonic, fixed frequency counter that
+ * is readable from EL0 on every ARMv8 Linux kernel. When _USE_HRT_ISB is
+ * defined the read is preceded by an ISB so that it cannot be speculated
+ * ahead of the instructions that precede it in program order (at the cost
+ * of a pipeline flush).
+ * @return the current value of CNTVCT_EL0.
+ */
+inline uint64 GenericTimerCounter() {
+    uint64 cc = 0u;
+#if defined(__aarch64__)
+#ifdef _USE_HRT_ISB
+    __asm__ volatile ("isb\n\tmrs %0, cntvct_el0" : "=r" (cc) : : "memory");
+#else
+    __asm__ volatile ("mrs %0, cntvct_el0" : "=r" (cc));
+#endif
+#endif
+    return cc;
+}
 
+/**
+ * @brief Same as GenericTimerCounter() but always ISB-ordered.
+ * @details To be used when the time stamp must not be taken before the
+ * previous instructions have completed (e.g. when measuring the duration
+ * of a short code section).
+ * @return the current value of CNTVCT_EL0.
+ */
+inline uint64 GenericTimerCounterOrdered() {
+    uint64 cc = 0u;
+#if defined(__aarch64__)
+    __asm__ volatile ("isb\n\tmrs %0, cntvct_el0" : "=r" (cc) : : "memory");
+#endif
+    return cc;
+}
 
+/**
+ * @brief Reads the ARMv8 generic timer frequency (CNTFRQ_EL0).
+ * @return the frequency, in Hz, at which CNTVCT_EL0 is incremented or 0
+ * if the generic timer is not available on this target.
+ */
+inline uint64 GenericTimerFrequency() {
+    uint64 freq = 0u;
+#if defined(__aarch64__)
+    __asm__ volatile ("mrs %0, cntfrq_el0" : "=r" (freq));
+#endif
+    return freq;
+}
 
 inline uint64 Counter() {
 
-#ifdef _USE_HRT_PERF_MODULE
-
+#if defined(_USE_HRT_PERF_MODULE) && defined(__aarch64__)
+    uint64 cc = 0u;
+    __asm__ volatile ("mrs %0, pmccntr_el0":"=r" (cc));
+    return cc;
+#elif defined(_USE_HRT_PERF_MODULE)
     volatile uint32 cc = 0;
     __asm__ volatile ("mrc p15, 0, %0, c9, c13, 0":"=r" (cc));
 
     return ((uint64)(cc))<<6;
+#elif defined(__aarch64__)
+    return GenericTimerCounter();
 #else
     struct timespec now;
-    clock_gettime(CLOCK_REALTIME, &now);
+    clock_gettime(CLOCK_MONOTONIC, &now);
 
     double counter_x=((now.tv_sec*1000000000. + now.tv_nsec)/1e9)*(HighResolutionTimer::Frequency());
     return (uint64)counter_x;
@@ -72,7 +123,7 @@ inline uint64 Counter() {
 }
 
 inline uint32 Counter32() {
-#ifdef _USE_HRT_PERF_MODULE
+#if defined(_USE_HRT_PERF_MODULE) && !defined(__aarch64__)
     volatile uint32 cc = 0;
     __asm__ volatile ("mrc p15, 0, %0, c9, c13, 0":"=r" (cc));
     return cc<<6;
@@ -0,0 +1,423 @@
+/**
+ * @file MemoryOperationsHelperA.h
+ * @brief Header file for module MemoryOperationsHelperA
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module MemoryOperationsHelperA
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MEMORYOPERATIONSHELPERA_H_
+#define MEMORYOPERATIONSHELPERA_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace MemoryOperationsHelper {
+
+/**
+ * Above this size CopyUnchecked delegates to the C library memcpy.
+ */
+const uint32 MEMORY_OPERATIONS_HELPER_INLINE_COPY_MAX = 64u;
+
+/**
+ * Below this size CopyNonTemporal behaves as CopyUnchecked.
+ */
+const uint32 MEMORY_OPERATIONS_HELPER_NON_TEMPORAL_MIN = 4096u;
+
+/**
+ * The cache line size assumed by Prefetch.
+ */
+const uint32 MEMORY_OPERATIONS_HELPER_CACHE_LINE_SIZE = 64u;
+
+/**
+ * Maximum number of bytes prefetched by a Prefetch call (larger blocks would evict more than they bring in).
+ */
+const uint32 MEMORY_OPERATIONS_HELPER_PREFETCH_MAX = 4096u;
+
+inline void CopyUnchecked(void * const destination,
+                          const void * const source,
+                          const uint32 size) {
+    uint8 *dst = static_cast<uint8 *>(destination);
+    const uint8 *src = static_cast<const uint8 *>(source);
+    /* Each size class is covered by two (possibly overlapping) blocks, one aligned with the
+     * beginning and one with the end of the area. All the loads are issued before the stores. */
+    if (size <= 16u) {
+        if (size >= 8u) {
+            uint64 head;
+            uint64 tail;
+            __builtin_memcpy(&head, src, 8u);
+            __builtin_memcpy(&tail, &src[size - 8u], 8u);
+            __builtin_memcpy(dst, &head, 8u);
+            __builtin_memcpy(&dst[size - 8u], &tail, 8u);
+        }
+        else if (size >= 4u) {
+            uint32 head;
+            uint32 tail;
+            __builtin_memcpy(&head, src, 4u);
+            __builtin_memcpy(&tail, &src[size - 4u], 4u);
+            __builtin_memcpy(dst, &head, 4u);
+            __builtin_memcpy(&dst[size - 4u], &tail, 4u);
+        }
+        else if (size > 0u) {
+            uint8 first = src[0u];
+            uint8 middle = src[size / 2u];
+            uint8 last = src[size - 1u];
+            dst[0u] = first;
+            dst[size / 2u] = middle;
+            dst[size - 1u] = last;
+        }
+        else {
+            //NOOP
+        }
+    }
+    else if (size <= 32u) {
+#if defined(__aarch64__)
+        uint8x16_t head = vld1q_u8(src);
+        uint8x16_t tail = vld1q_u8(&src[size - 16u]);
+        vst1q_u8(dst, head);
+        vst1q_u8(&dst[size - 16u], tail);
+#else
+        uint8 head[16u];
+        uint8 tail[16u];
+        __builtin_memcpy(head, src, 16u);
+        __builtin_memcpy(tail, &src[size - 16u], 16u);
+        __builtin_memcpy(dst, head, 16u);
+        __builtin_memcpy(&dst[size - 16u], tail, 16u);
+#endif
+    }
+    else if (size <= MEMORY_OPERATIONS_HELPER_INLINE_COPY_MAX) {
+#if defined(__aarch64__)
+        uint8x16_t q0 = vld1q_u8(src);
+        uint8x16_t q1 = vld1q_u8(&src[16u]);
+        uint8x16_t q2 = vld1q_u8(&src[size - 32u]);
+        uint8x16_t q3 = vld1q_u8(&src[size - 16u]);
+        vst1q_u8(dst, q0);
+        vst1q_u8(&dst[16u], q1);
+        vst1q_u8(&dst[size - 32u], q2);
+        vst1q_u8(&dst[size - 16u], q3);
+#else
+        uint8 head[32u];
+        uint8 tail[32u];
+        __builtin_memcpy(head, src, 32u);
+        __builtin_memcpy(tail, &src[size - 32u], 32u);
+        __builtin_memcpy(dst, head, 32u);
+        __builtin_memcpy(&dst[size - 32u], tail, 32u);
+#endif
+    }
+    else {
+        (void) __builtin_memcpy(dst, src, static_cast<osulong>(size));
+    }
+}
+
+inline void CopyNonTemporal(void * const destination,
+                            const void * const source,
+                            const uint32 size) {
+#if defined(__aarch64__)
+    if (size >= MEMORY_OPERATIONS_HELPER_NON_TEMPORAL_MIN) {
+        uint8 *dst = static_cast<uint8 *>(destination);
+        const uint8 *src = static_cast<const uint8 *>(source);
+        uint32 blocks = (size / 64u);
+        /* ldnp/stnp hint the memory system that the data is not to be kept in the caches.
+         * Unlike the other loads, ldnp gives no ordering guarantee with respect to the address
+         * calculation, which is not an issue here since the addresses do not depend on loaded data. */
+        for (uint32 b = 0u; b < blocks; b++) {
+            __asm__ __volatile__(
+                    "ldnp q0, q1, [%[s]]\n\t"
+                    "ldnp q2, q3, [%[s], #32]\n\t"
+                    "stnp q0, q1, [%[d]]\n\t"
+                    "stnp q2, q3, [%[d], #32]\n\t"
+                    :
+                    : [d] "r" (dst), [s] "r" (src)
+                    : "memory", "v0", "v1", "v2", "v3");
+            dst = &dst[64u];
+            src = &src[64u];
+        }
+        uint32 remainder = (size - (blocks * 64u));
+        if (remainder > 0u) {
+            CopyUnchecked(dst, src, remainder);
+        }
+    }
+    else {
+        CopyUnchecked(destination, source, size);
+    }
+#else
+    CopyUnchecked(destination, source, size);
+#endif
+}
+
+template<uint32 size>
+inline void CopyFixedSize(void * const destination,
+                          const void * const source) {
+    (void) __builtin_memcpy(destination, source, static_cast<osulong>(size));
+}
+
+inline uint32 GetFixedCopySize(const uint32 size) {
+    uint32 fixedSize = 0u;
+    if ((size == 1u) || (size == 2u) || (size == 4u) || (size == 8u)) {
+        fixedSize = size;
+    }
+    else if ((size <= 64u) && ((size % 16u) == 0u)) {
+        fixedSize = size;
+    }
+    else {
+        //Generic copy
+    }
+    return fixedSize;
+}
+
+inline void CopyTagged(void * const destination,
+                       const void * const source,
+                       const uint32 size,
+                       const uint32 fixedSize) {
+    switch (fixedSize) {
+    case 1u:
+        CopyFixedSize<1u>(destination, source);
+        break;
+    case 2u:
+        CopyFixedSize<2u>(destination, source);
+        break;
+    case 4u:
+        CopyFixedSize<4u>(destination, source);
+        break;
+    case 8u:
+        CopyFixedSize<8u>(destination, source);
+        break;
+    case 16u:
+        CopyFixedSize<16u>(destination, source);
+        break;
+    case 32u:
+        CopyFixedSize<32u>(destination, source);
+        break;
+    case 48u:
+        CopyFixedSize<48u>(destination, source);
+        break;
+    case 64u:
+        CopyFixedSize<64u>(destination, source);
+        break;
+    default:
+        CopyUnchecked(destination, source, size);
+        break;
+    }
+}
+
+/**
+ * @brief Copies equally spaced elements of a known size (stride and the element size in bytes).
+ */
+template<uint32 elementSize>
+inline void CopyStridedFixedSize(uint8 * const destination,
+                                 const uint32 destinationStride,
+                                 const uint8 * const source,
+                                 const uint32 sourceStride,
+                                 const uint32 numberOfElements) {
+    for (uint32 i = 0u; i < numberOfElements; i++) {
+        CopyFixedSize<elementSize>(&destination[i * destinationStride], &source[i * sourceStride]);
+    }
+}
+
+/**
+ * @brief Copies equally spaced elements of any size.
+ */
+inline void CopyStrided(uint8 * const destination,
+                        const uint32 destinationStride,
+                        const uint8 * const source,
+                        const uint32 sourceStride,
+                        const uint32 elementSize,
+                        const uint32 numberOfElements) {
+    switch (elementSize) {
+    case 1u:
+        CopyStridedFixedSize<1u>(destination, destinationStride, source, sourceStride, numberOfElements);
+        break;
+    case 2u:
+        CopyStridedFixedSize<2u>(destination, destinationStride, source, sourceStride, numberOfElements);
+        break;
+    case 4u:
+        CopyStridedFixedSize<4u>(destination, destinationStride, source, sourceStride, numberOfElements);
+        break;
+    case 8u:
+        CopyStridedFixedSize<8u>(destination, destinationStride, source, sourceStride, numberOfElements);
+        break;
+    default:
+        for (uint32 i = 0u; i < numberOfElements; i++) {
+            CopyUnchecked(&destination[i * destinationStride], &source[i * sourceStride], elementSize);
+        }
+        break;
+    }
+}
+
+#if defined(__aarch64__)
+/**
+ * @brief De-interleaves with ld2/ld3/ld4 the first blocks of a GatherStrided and returns the number of elements gathered.
+ * @details A block is only loaded if at least one element follows it, so that the loads (which read whole frames)
+ * never go beyond the last element.
+ */
+inline uint32 GatherInterleaved(uint8 * const dst,
+                                const uint8 * const src,
+                                const uint32 elementSize,
+                                const uint32 stride,
+                                const uint32 numberOfElements) {
+    uint32 i = 0u;
+    /*lint -e{927} -e{826} NEON loads/stores of the element type. Unaligned accesses are allowed on armv8 normal memory.*/
+    if (elementSize == 1u) {
+        if (stride == 2u) {
+            for (; (i + 16u) < numberOfElements; i += 16u) {
+                vst1q_u8(&dst[i], vld2q_u8(&src[i * stride]).val[0]);
+            }
+        }
+        else if (stride == 3u) {
+            for (; (i + 16u) < numberOfElements; i += 16u) {
+                vst1q_u8(&dst[i], vld3q_u8(&src[i * stride]).val[0]);
+            }
+        }
+        else if (stride == 4u) {
+            for (; (i + 16u) < numberOfElements; i += 16u) {
+                vst1q_u8(&dst[i], vld4q_u8(&src[i * stride]).val[0]);
+            }
+        }
+        else {
+            //Not interleaved by 2, 3 or 4
+        }
+    }
+    else if (elementSize == 2u) {
+        uint16 *dst16 = reinterpret_cast<uint16 *>(dst);
+        if (stride == 4u) {
+            for (; (i + 8u) < numberOfElements; i += 8u) {
+                vst1q_u16(&dst16[i], vld2q_u16(reinterpret_cast<const uint16 *>(&src[i * stride])).val[0]);
+            }
+        }
+        else if (stride == 6u) {
+            for (; (i + 8u) < numberOfElements; i += 8u) {
+                vst1q_u16(&dst16[i], vld3q_u16(reinterpret_cast<const uint16 *>(&src[i * stride])).val[0]);
+            }
+        }
+        else if (stride == 8u) {
+            for (; (i + 8u) < numberOfElements; i += 8u) {
+                vst1q_u16(&dst16[i], vld4q_u16(reinterpret_cast<const uint16 *>(&src[i * stride])).val[0]);
+            }
+        }
+        else {
+            //Not interleaved by 2, 3 or 4
+        }
+    }
+    else if (elementSize == 4u) {
+        uint32 *dst32 = reinterpret_cast<uint32 *>(dst);
+        if (stride == 8u) {
+            for (; (i + 4u) < numberOfElements; i += 4u) {
+                vst1q_u32(&dst32[i], vld2q_u32(reinterpret_cast<const uint32 *>(&src[i * stride])).val[0]);
+            }
+        }
+        else if (stride == 12u) {
+            for (; (i + 4u) < numberOfElements; i += 4u) {
+                vst1q_u32(&dst32[i], vld3q_u32(reinterpret_cast<const uint32 *>(&src[i * stride])).val[0]);
+            }
+        }
+        else if (stride == 16u) {
+            for (; (i + 4u) < numberOfElements; i += 4u) {
+                vst1q_u32(&dst32[i], vld4q_u32(reinterpret_cast<const uint32 *>(&src[i * stride])).val[0]);
+            }
+        }
+        else {
+            //Not interleaved by 2, 3 or 4
+        }
+    }
+    else {
+        //No NEON de-interleaving
+    }
+    return i;
+}
+#endif
+
+inline void GatherStrided(void * const destination,
+                          const void * const source,
+                          const uint32 elementSize,
+                          const uint32 stride,
+                          const uint32 numberOfElements) {
+    uint8 *dst = static_cast<uint8 *>(destination);
+    const uint8 *src = static_cast<const uint8 *>(source);
+    uint32 first = 0u;
+#if defined(__aarch64__)
+    first = GatherInterleaved(dst, src, elementSize, stride, numberOfElements);
+#endif
+    CopyStrided(&dst[first * elementSize], elementSize, &src[first * stride], stride, elementSize, numberOfElements - first);
+}
+
+inline void ScatterStrided(void * const destination,
+                           const void * const source,
+                           const uint32 elementSize,
+                           const uint32 stride,
+                           const uint32 numberOfElements) {
+    //The other elements of the interleaved frames may belong to somebody else: no vector stores
+    CopyStrided(static_cast<uint8 *>(destination), stride, static_cast<const uint8 *>(source), elementSize, elementSize, numberOfElements);
+}
+
+inline void Prefetch(const void * const address,
+                     const uint32 size,
+                     const bool forWrite) {
+    uint32 prefetchSize = size;
+    if (prefetchSize > MEMORY_OPERATIONS_HELPER_PREFETCH_MAX) {
+        prefetchSize = MEMORY_OPERATIONS_HELPER_PREFETCH_MAX;
+    }
+    /*lint -e{923} the address is only used as a hint*/
+    uintp end = reinterpret_cast<uintp>(address) + prefetchSize;
+    /*lint -e{923} the address is only used as a hint*/
+    uintp line = reinterpret_cast<uintp>(address) & ~static_cast<uintp>(MEMORY_OPERATIONS_HELPER_CACHE_LINE_SIZE - 1u);
+    while (line < end) {
+#if defined(__aarch64__)
+        if (forWrite) {
+            __asm__ __volatile__("prfm pstl1keep, [%[a]]" : : [a] "r" (line));
+        }
+        else {
+            __asm__ __volatile__("prfm pldl1keep, [%[a]]" : : [a] "r" (line));
+        }
+#else
+        /*lint -e{923} the address is only used as a hint*/
+        const void *lineAddress = reinterpret_cast<const void *>(line);
+        if (forWrite) {
+            __builtin_prefetch(lineAddress, 1, 3);
+        }
+        else {
+            __builtin_prefetch(lineAddress, 0, 3);
+        }
+#endif
+        line += MEMORY_OPERATIONS_HELPER_CACHE_LINE_SIZE;
+    }
+}
+
+}
+
+}
+
+#endif /* MEMORYOPERATIONSHELPERA_H_ */
+
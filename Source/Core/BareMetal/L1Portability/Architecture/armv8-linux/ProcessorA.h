@@ -52,6 +52,34 @@ inline const char8 * VendorId() {
     return "";
 }
 
+/**
+ * @brief Reads the smallest data cache line size of the core from CTR_EL0 (DminLine).
+ * @details CTR_EL0 is readable from EL0 in every ARMv8 Linux kernel.
+ * @return the line size in bytes or 0 if the register is not available in this target.
+ */
+inline uint32 DataCacheLineSizeRegister() {
+    uint32 lineSize = 0u;
+#if defined(__aarch64__)
+    uint64 ctr = 0u;
+    __asm__ volatile ("mrs %0, ctr_el0" : "=r" (ctr));
+    //DminLine is the log2 of the number of 4 byte words
+    lineSize = (4u << static_cast<uint32>((ctr >> 16u) & 0xFu));
+#endif
+    return lineSize;
+}
+
+/**
+ * @brief Hints the core that the caller is busy waiting (e.g. on a flag written by another core).
+ * @details On ARMv8 it issues a yield, which lowers the power of the spin and lets the other hardware thread (if any) progress.
+ */
+inline void SpinHint() {
+#if defined(__aarch64__)
+    __asm__ volatile ("yield" ::: "memory");
+#else
+    __asm__ volatile ("" ::: "memory");
+#endif
+}
+
 }
 
 }
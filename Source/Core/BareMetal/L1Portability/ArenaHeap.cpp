@@ -0,0 +1,220 @@
+/**
+ * @file ArenaHeap.cpp
+ * @brief Source file for class ArenaHeap
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ArenaHeap (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ArenaHeap.h"
+#include "HeapManager.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * Size of the header that precedes every allocation (keeps the 16 bytes alignment).
+ */
+const MARTe::uint32 ARENA_HEAP_HEADER_SIZE = 16u;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ArenaHeap::ArenaHeap(const char8 * const nameIn) :
+        HeapI() {
+    memory = NULL_PTR(uint8 *);
+    areaSize = 0u;
+    used = 0;
+    name = StringHelper::StringDup(nameIn);
+}
+
+/*lint -e{1551} HeapManager::Free does not throw exceptions*/
+ArenaHeap::~ArenaHeap() {
+    if (memory != NULL_PTR(uint8 *)) {
+        if (HeapManager::Free(reinterpret_cast<void *&>(memory))) {
+            memory = NULL_PTR(uint8 *);
+        }
+    }
+    if (name != NULL_PTR(char8 *)) {
+        if (HeapManager::Free(reinterpret_cast<void *&>(name))) {
+            name = NULL_PTR(char8 *);
+        }
+    }
+}
+
+bool ArenaHeap::Initialise(const uint32 sizeIn) {
+    bool ok = (memory == NULL_PTR(uint8 *));
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::InitialisationError, "ArenaHeap: Already initialised");
+    }
+    if (ok) {
+        ok = (sizeIn > 0u) && (sizeIn <= 0x7FFFFFF0u);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "ArenaHeap: The size shall be greater than zero and smaller than 2 GB");
+        }
+    }
+    if (ok) {
+        //Padding so that the area can be aligned to 16 bytes
+        memory = reinterpret_cast<uint8 *>(HeapManager::Malloc(sizeIn + ARENA_HEAP_HEADER_SIZE));
+        ok = (memory != NULL_PTR(uint8 *));
+    }
+    if (ok) {
+        areaSize = sizeIn;
+        used = 0;
+        //Reserve the alignment padding
+        /*lint -e{923} -e{9091} the alignment requires the conversion of the pointer to an integer*/
+        uintp misalignment = reinterpret_cast<uintp>(memory) % ARENA_HEAP_HEADER_SIZE;
+        if (misalignment != 0u) {
+            used = static_cast<int32>(ARENA_HEAP_HEADER_SIZE - static_cast<uint32>(misalignment));
+        }
+    }
+    return ok;
+}
+
+void ArenaHeap::Reset() {
+    int32 start = 0;
+    if (memory != NULL_PTR(uint8 *)) {
+        /*lint -e{923} -e{9091} the alignment requires the conversion of the pointer to an integer*/
+        uintp misalignment = reinterpret_cast<uintp>(memory) % ARENA_HEAP_HEADER_SIZE;
+        if (misalignment != 0u) {
+            start = static_cast<int32>(ARENA_HEAP_HEADER_SIZE - static_cast<uint32>(misalignment));
+        }
+    }
+    Atomic::Store(&used, start, Atomic::MemoryOrderRelease);
+}
+
+void *ArenaHeap::Malloc(const uint32 size) {
+    uint8 *allocated = NULL_PTR(uint8 *);
+    //Header plus the size rounded up to keep the next allocation aligned
+    uint64 need = static_cast<uint64>(ARENA_HEAP_HEADER_SIZE) + ((static_cast<uint64>(size) + 15u) & ~static_cast<uint64>(15u));
+    bool ok = (memory != NULL_PTR(uint8 *)) && (size > 0u);
+    int32 offset = Atomic::Load(&used, Atomic::MemoryOrderRelaxed);
+    bool done = false;
+    while ((ok) && (!done)) {
+        /*lint -e{9117} offset is never negative*/
+        uint64 end = static_cast<uint64>(static_cast<uint32>(offset)) + need;
+        //The area has ARENA_HEAP_HEADER_SIZE extra bytes to accommodate the alignment padding
+        ok = (end <= (static_cast<uint64>(areaSize) + ARENA_HEAP_HEADER_SIZE));
+        if (ok) {
+            done = Atomic::CompareExchange(&used, offset, static_cast<int32>(end), Atomic::MemoryOrderRelaxed);
+        }
+    }
+    if (ok) {
+        uint8 *header = &memory[offset];
+        /*lint -e{927} -e{826} the header holds the size of the allocation*/
+        *reinterpret_cast<uint32 *>(header) = size;
+        allocated = &header[ARENA_HEAP_HEADER_SIZE];
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "ArenaHeap: Failed Malloc()");
+    }
+    return reinterpret_cast<void *>(allocated);
+}
+
+void ArenaHeap::Free(void *&data) {
+    data = NULL_PTR(void *);
+}
+
+void *ArenaHeap::Realloc(void *&data,
+                         const uint32 newSize) {
+    void *allocated = NULL_PTR(void *);
+    if (data == NULL) {
+        data = ArenaHeap::Malloc(newSize);
+        allocated = data;
+    }
+    else if (newSize == 0u) {
+        ArenaHeap::Free(data);
+    }
+    else {
+        const uint8 *header = &reinterpret_cast<const uint8 *>(data)[-static_cast<int32>(ARENA_HEAP_HEADER_SIZE)];
+        /*lint -e{927} -e{826} the header holds the size of the allocation*/
+        uint32 oldSize = *reinterpret_cast<const uint32 *>(header);
+        if (newSize <= ((oldSize + 15u) & ~15u)) {
+            allocated = data;
+        }
+        else {
+            allocated = ArenaHeap::Malloc(newSize);
+            if (allocated != NULL) {
+                (void) MemoryOperationsHelper::Copy(allocated, data, oldSize);
+                data = allocated;
+            }
+        }
+    }
+    return allocated;
+}
+
+void *ArenaHeap::Duplicate(const void * const data,
+                           uint32 size) {
+    void *duplicate = NULL_PTR(void *);
+    if (data != NULL) {
+        if (size == 0U) {
+            size = StringHelper::Length(static_cast<const char8 *>(data)) + 1u;
+        }
+        duplicate = ArenaHeap::Malloc(size);
+        if (duplicate != NULL) {
+            (void) MemoryOperationsHelper::Copy(duplicate, data, size);
+        }
+    }
+    return duplicate;
+}
+
+uintp ArenaHeap::FirstAddress() const {
+    /*lint -e{923} -e{9091} the casting from pointer type to integer type is required by the HeapI interface*/
+    return reinterpret_cast<uintp>(memory);
+}
+
+uintp ArenaHeap::LastAddress() const {
+    uintp last = 0u;
+    if (memory != NULL_PTR(uint8 *)) {
+        /*lint -e{923} -e{9091} the casting from pointer type to integer type is required by the HeapI interface*/
+        last = reinterpret_cast<uintp>(memory) + ((static_cast<uintp>(areaSize) + ARENA_HEAP_HEADER_SIZE) - 1u);
+    }
+    return last;
+}
+
+const char8 *ArenaHeap::Name() const {
+    return name;
+}
+
+uint32 ArenaHeap::GetSize() const {
+    return areaSize;
+}
+
+uint32 ArenaHeap::GetUsedSize() const {
+    return static_cast<uint32>(Atomic::Load(&used, Atomic::MemoryOrderRelaxed));
+}
+
+}
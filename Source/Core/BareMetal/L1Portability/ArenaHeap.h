@@ -0,0 +1,176 @@
+/**
+ * @file ArenaHeap.h
+ * @brief Header file for class ArenaHeap
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ArenaHeap
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef ARENAHEAP_H_
+#define ARENAHEAP_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "HeapI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief A bump-pointer HeapI over a single memory area that is released in bulk.
+ * @details The memory area is allocated in Initialise. Malloc only advances (with a compare-and-swap) an offset
+ * in the area, so that it is a lock-free O(1) operation that never touches the standard heap. Free does not
+ * return the memory: all the allocations are released at once with Reset (e.g. at every state change or at the
+ * end of every cycle).
+ *
+ * Every allocation is aligned to 16 bytes and preceded by a 16 bytes header that holds its size (used by Realloc).
+ *
+ * The heap can be registered with HeapManager::AddHeap so that it can be selected by Name() (e.g. with the HeapName
+ * parameter of the GAMDataSource).
+ */
+class DLL_API ArenaHeap: public HeapI {
+public:
+
+    /**
+     * @brief Constructor.
+     * @param[in] nameIn the name of the heap (see Name()).
+     */
+    ArenaHeap(const char8 * const nameIn);
+
+    /**
+     * @brief Destructor. Frees the memory area.
+     */
+    virtual ~ArenaHeap();
+
+    /**
+     * @brief Allocates the memory area.
+     * @param[in] sizeIn the size of the memory area in bytes (< 2 GB).
+     * @return true if the heap was not already initialised and the memory could be allocated.
+     */
+    bool Initialise(const uint32 sizeIn);
+
+    /**
+     * @brief Releases all the allocations.
+     * @pre
+     *   None of the memory previously returned by this heap is still in use.
+     */
+    void Reset();
+
+    /**
+     * @brief Allocates memory at the end of the used part of the area.
+     * @param[in] size the number of bytes to allocate.
+     * @return the allocated memory or NULL if there is not enough space left.
+     */
+    virtual void *Malloc(const uint32 size);
+
+    /**
+     * @brief NOOP. The memory is only released by Reset.
+     * @param[in,out] data the memory to be freed.
+     * @post data = NULL
+     */
+    virtual void Free(void *&data);
+
+    /**
+     * @brief Changes the size of an allocation.
+     * @details If \a newSize fits in the space of the original allocation \a data is not changed. Otherwise new memory
+     * is allocated and the original content copied.
+     * @param[in,out] data the memory to resize. If NULL new memory is allocated.
+     * @param[in] newSize the new size. If 0 the memory is freed.
+     * @return the (possibly) new address or NULL if there is not enough space left.
+     */
+    virtual void *Realloc(void *&data,
+                          const uint32 newSize);
+
+    /**
+     * @brief Copies a memory section into newly allocated memory.
+     * @param[in] data the memory to copy.
+     * @param[in] size the number of bytes to copy. If 0 the memory is copied until a zero is found (inclusive).
+     * @return the new memory or NULL if there is not enough space left.
+     */
+    /*lint -e(1735) the derived classes shall use this default parameter or no default parameter at all*/
+    virtual void *Duplicate(const void * const data,
+                            uint32 size = 0U);
+
+    /**
+     * @brief Returns the start of the memory area.
+     * @return the start of the memory area.
+     */
+    virtual uintp FirstAddress() const;
+
+    /**
+     * @brief Returns the end (inclusive) of the memory area.
+     * @return the end (inclusive) of the memory area.
+     */
+    virtual uintp LastAddress() const;
+
+    /**
+     * @brief Returns the name of the heap.
+     * @return the name set in the constructor.
+     */
+    virtual const char8 *Name() const;
+
+    /**
+     * @brief Gets the size of the memory area.
+     * @return the size of the memory area.
+     */
+    uint32 GetSize() const;
+
+    /**
+     * @brief Gets the number of bytes used (including the headers and the alignment).
+     * @return the number of bytes used since the last Reset.
+     */
+    uint32 GetUsedSize() const;
+
+private:
+
+    /**
+     * The memory area.
+     */
+    uint8 *memory;
+
+    /**
+     * The size of the memory area.
+     */
+    uint32 areaSize;
+
+    /**
+     * The number of bytes used.
+     */
+    volatile int32 used;
+
+    /**
+     * The heap name.
+     */
+    char8 *name;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* ARENAHEAP_H_ */
@@ -33,6 +33,28 @@
 /*---------------------------------------------------------------------------*/
 
 #include "GeneralDefinitions.h"
+
+namespace MARTe {
+    namespace Atomic {
+
+        /**
+         * @brief Memory ordering constraints of the Atomic operations that accept one.
+         * @details The semantics are the ones of the C++11 memory model. On ARMv8
+         * MemoryOrderRelaxed does not emit any barrier, MemoryOrderAcquire and
+         * MemoryOrderRelease map to the one-way ldar/stlr (or LSE acquire/release)
+         * instructions and MemoryOrderSequential is the behaviour of the legacy functions.
+         */
+        enum MemoryOrder {
+            MemoryOrderRelaxed = 0,
+            MemoryOrderAcquire,
+            MemoryOrderRelease,
+            MemoryOrderAcquireRelease,
+            MemoryOrderSequential
+        };
+
+    }
+}
+
 #include INCLUDE_FILE_ARCHITECTURE(BareMetal,L1Portability,ARCHITECTURE,AtomicA.h)
 
 /*---------------------------------------------------------------------------*/
@@ -135,6 +157,118 @@ namespace MARTe {
          */
         inline void Sub (volatile int32 *p, int32 value);
 
+        /**
+         * @brief Atomically loads a 32 bit integer with acquire semantics.
+         * @param[in] p the pointer to the variable to read.
+         * @return the value of *p.
+         * @pre p != NULL.
+         */
+        inline int32 LoadAcquire (const volatile int32 *p);
+
+        /**
+         * @brief Atomically loads a 64 bit integer with acquire semantics.
+         * @see LoadAcquire(const volatile int32 *)
+         */
+        inline int64 LoadAcquire (const volatile int64 *p);
+
+        /**
+         * @brief Atomically loads a 32 bit integer with the specified ordering.
+         * @param[in] p the pointer to the variable to read.
+         * @param[in] order one of MemoryOrderRelaxed, MemoryOrderAcquire or MemoryOrderSequential.
+         * @return the value of *p.
+         * @pre p != NULL.
+         */
+        inline int32 Load (const volatile int32 *p, const MemoryOrder order);
+
+        /**
+         * @see Load(const volatile int32 *, const MemoryOrder)
+         */
+        inline int64 Load (const volatile int64 *p, const MemoryOrder order);
+
+        /**
+         * @brief Atomically stores a 32 bit integer with release semantics.
+         * @param[out] p the pointer to the variable to write.
+         * @param[in] value the value to store.
+         * @pre p != NULL.
+         */
+        inline void StoreRelease (volatile int32 *p, const int32 value);
+
+        /**
+         * @brief Atomically stores a 64 bit integer with release semantics.
+         * @see StoreRelease(volatile int32 *, const int32)
+         */
+        inline void StoreRelease (volatile int64 *p, const int64 value);
+
+        /**
+         * @brief Atomically stores a 32 bit integer with the specified ordering.
+         * @param[out] p the pointer to the variable to write.
+         * @param[in] value the value to store.
+         * @param[in] order one of MemoryOrderRelaxed, MemoryOrderRelease or MemoryOrderSequential.
+         * @pre p != NULL.
+         */
+        inline void Store (volatile int32 *p, const int32 value, const MemoryOrder order);
+
+        /**
+         * @see Store(volatile int32 *, const int32, const MemoryOrder)
+         */
+        inline void Store (volatile int64 *p, const int64 value, const MemoryOrder order);
+
+        /**
+         * @brief Atomically compares *p with expected and, if equal, writes desired.
+         * @param[in,out] p the pointer to the variable to update.
+         * @param[in,out] expected the value *p is expected to hold. If the comparison
+         * fails it is updated with the value read from *p.
+         * @param[in] desired the value to write if *p == expected.
+         * @param[in] order the ordering of the operation (on failure the
+         * strongest valid load ordering implied by order is used).
+         * @return true if *p was equal to expected and was replaced by desired.
+         * @pre p != NULL.
+         */
+        inline bool CompareExchange (volatile int32 *p, int32 &expected, const int32 desired, const MemoryOrder order = MemoryOrderSequential);
+
+        /**
+         * @see CompareExchange(volatile int32 *, int32 &, const int32, const MemoryOrder)
+         */
+        inline bool CompareExchange (volatile int64 *p, int64 &expected, const int64 desired, const MemoryOrder order = MemoryOrderSequential);
+
+        /**
+         * @brief Atomically adds value to *p and returns the value held before the addition.
+         * @param[in,out] p the pointer to the variable to update.
+         * @param[in] value the value to add (may be negative).
+         * @param[in] order the ordering of the operation.
+         * @return the value of *p before the addition.
+         * @pre p != NULL.
+         */
+        inline int32 FetchAdd (volatile int32 *p, const int32 value, const MemoryOrder order = MemoryOrderSequential);
+
+        /**
+         * @see FetchAdd(volatile int32 *, const int32, const MemoryOrder)
+         */
+        inline int64 FetchAdd (volatile int64 *p, const int64 value, const MemoryOrder order = MemoryOrderSequential);
+
+        /**
+         * @brief Waits, in a low power state if available, while *p is equal to value.
+         * @details On ARMv8 the location is loaded exclusively (with acquire semantics) and,
+         * if it still holds value, the core is halted with WFE until the exclusive monitor is
+         * cleared by a store to the location from another core (or by any other event, e.g. the
+         * kernel timer event stream). On other architectures it returns immediately.
+         * Spurious returns are possible, so the caller must always check *p again.
+         * @param[in] p the pointer to the variable to monitor.
+         * @param[in] value the value that keeps the caller waiting.
+         * @pre p != NULL.
+         */
+        inline void WaitWhileEqual (const volatile int32 *p, const int32 value);
+
+        /**
+         * @brief Issues a memory fence with the specified ordering.
+         * @details Orders the (possibly non-atomic) memory accesses around the fence, e.g. a MemoryOrderRelease
+         * fence followed by a relaxed store prevents the accesses before the fence from being reordered after
+         * the store, and a relaxed load followed by a MemoryOrderAcquire fence prevents the accesses after the fence
+         * from being reordered before the load (as required by sequence locks).
+         * @param[in] order the ordering of the fence.
+         */
+        inline void ThreadFence (const MemoryOrder order);
+
     }
 
 }
@@ -360,6 +360,8 @@ public:
 
     /**
      * @see StreamI::Write
+     * @details If the number of columns is zero (the default, see SetSceneSize) the lines are not wrapped and the
+     * buffer is written to the operating system in one go, so that writing many lines at once usually costs a single system call.
      */
     virtual bool Write(const char8 * const input,
                        uint32 & size);
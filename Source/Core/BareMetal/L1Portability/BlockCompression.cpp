@@ -0,0 +1,388 @@
+/**
+ * @file BlockCompression.cpp
+ * @brief Source file for module BlockCompression
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BlockCompression (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "BlockCompression.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * The minimum length of a back-reference.
+ */
+const MARTe::uint32 BLOCK_COMPRESSION_MIN_MATCH = 4u;
+
+/**
+ * The last bytes of a block are always literals.
+ */
+const MARTe::uint32 BLOCK_COMPRESSION_LAST_LITERALS = 5u;
+
+/**
+ * A back-reference shall start at least these bytes before the end of the block.
+ */
+const MARTe::uint32 BLOCK_COMPRESSION_MATCH_LIMIT = 12u;
+
+/**
+ * The maximum distance of a back-reference.
+ */
+const MARTe::uint32 BLOCK_COMPRESSION_MAX_OFFSET = 65535u;
+
+/**
+ * The length values which are continued in extra bytes.
+ */
+const MARTe::uint32 BLOCK_COMPRESSION_RUN_MASK = 15u;
+
+/**
+ * @brief Reads four bytes (any alignment).
+ */
+inline MARTe::uint32 BlockCompressionRead32(const MARTe::uint8 * const p) {
+    return static_cast<MARTe::uint32>(p[0]) | (static_cast<MARTe::uint32>(p[1]) << 8u) | (static_cast<MARTe::uint32>(p[2]) << 16u)
+            | (static_cast<MARTe::uint32>(p[3]) << 24u);
+}
+
+/**
+ * @brief Index in the hash table of four bytes (multiplicative hashing).
+ */
+inline MARTe::uint32 BlockCompressionHash(const MARTe::uint32 sequence) {
+    return (sequence * 2654435761u) >> 20u;
+}
+
+/**
+ * @brief Writes the continuation bytes of a length (which is already reduced by BLOCK_COMPRESSION_RUN_MASK).
+ */
+void BlockCompressionWriteLength(MARTe::uint8 * const output, MARTe::uint32 &op, MARTe::uint32 length) {
+    while (length >= 255u) {
+        output[op] = 255u;
+        op++;
+        length -= 255u;
+    }
+    output[op] = static_cast<MARTe::uint8>(length);
+    op++;
+}
+
+/**
+ * @brief Writes a sequence: \a literalLength literals followed (unless \a last) by a back-reference.
+ * @return false if the sequence does not fit in \a capacity.
+ */
+bool BlockCompressionWriteSequence(const MARTe::uint8 * const literals, const MARTe::uint32 literalLength, MARTe::uint8 * const output,
+                                   const MARTe::uint32 capacity, MARTe::uint32 &op, const MARTe::uint32 offset, const MARTe::uint32 matchLength,
+                                   const bool last) {
+    //Worst case: token, literal length, literals, offset and match length
+    MARTe::uint32 needed = 1u + ((literalLength / 255u) + 1u) + literalLength;
+    if (!last) {
+        needed += 2u + (((matchLength - BLOCK_COMPRESSION_MIN_MATCH) / 255u) + 1u);
+    }
+    bool ok = (op <= capacity);
+    if (ok) {
+        ok = (needed <= (capacity - op));
+    }
+    if (ok) {
+        MARTe::uint32 tokenIdx = op;
+        op++;
+        MARTe::uint8 token;
+        if (literalLength >= BLOCK_COMPRESSION_RUN_MASK) {
+            token = static_cast<MARTe::uint8>(BLOCK_COMPRESSION_RUN_MASK << 4u);
+            BlockCompressionWriteLength(output, op, literalLength - BLOCK_COMPRESSION_RUN_MASK);
+        }
+        else {
+            token = static_cast<MARTe::uint8>(literalLength << 4u);
+        }
+        MARTe::uint32 i;
+        for (i = 0u; i < literalLength; i++) {
+            output[op + i] = literals[i];
+        }
+        op += literalLength;
+        if (!last) {
+            output[op] = static_cast<MARTe::uint8>(offset & 0xFFu);
+            output[op + 1u] = static_cast<MARTe::uint8>(offset >> 8u);
+            op += 2u;
+            MARTe::uint32 length = matchLength - BLOCK_COMPRESSION_MIN_MATCH;
+            if (length >= BLOCK_COMPRESSION_RUN_MASK) {
+                token |= static_cast<MARTe::uint8>(BLOCK_COMPRESSION_RUN_MASK);
+                BlockCompressionWriteLength(output, op, length - BLOCK_COMPRESSION_RUN_MASK);
+            }
+            else {
+                token |= static_cast<MARTe::uint8>(length);
+            }
+        }
+        output[tokenIdx] = token;
+    }
+    return ok;
+}
+
+/**
+ * @brief Reads the continuation bytes of a length.
+ * @return false if the input ends before the length.
+ */
+bool BlockCompressionReadLength(const MARTe::uint8 * const input, const MARTe::uint32 inputSize, MARTe::uint32 &ip, MARTe::uint32 &length) {
+    bool ok = true;
+    bool more = true;
+    while ((ok) && (more)) {
+        ok = (ip < inputSize);
+        if (ok) {
+            MARTe::uint8 value = input[ip];
+            ip++;
+            length += value;
+            more = (value == 255u);
+            //A (corrupted) length larger than any block
+            ok = (length < 0x80000000u);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief DeltaEncode for integers of type T.
+ */
+template<typename T>
+void BlockCompressionDeltaEncode(MARTe::uint8 * const records, const MARTe::uint32 numberOfRecords, const MARTe::uint32 recordSize,
+                                 const MARTe::uint32 offset, const MARTe::uint32 numberOfIntegers) {
+    //From the last record, so that each difference is computed with the original previous value
+    MARTe::uint32 r;
+    for (r = numberOfRecords - 1u; (r > 0u) && (r < numberOfRecords); r--) {
+        /*lint -e{927} -e{826} the integers are aligned to their size.*/
+        T *current = reinterpret_cast<T *>(&records[(r * recordSize) + offset]);
+        /*lint -e{927} -e{826} the integers are aligned to their size.*/
+        const T *previous = reinterpret_cast<const T *>(&records[((r - 1u) * recordSize) + offset]);
+        MARTe::uint32 i;
+        for (i = 0u; i < numberOfIntegers; i++) {
+            current[i] = static_cast<T>(current[i] - previous[i]);
+        }
+    }
+}
+
+/**
+ * @brief DeltaDecode for integers of type T.
+ */
+template<typename T>
+void BlockCompressionDeltaDecode(MARTe::uint8 * const records, const MARTe::uint32 numberOfRecords, const MARTe::uint32 recordSize,
+                                 const MARTe::uint32 offset, const MARTe::uint32 numberOfIntegers) {
+    MARTe::uint32 r;
+    for (r = 1u; r < numberOfRecords; r++) {
+        /*lint -e{927} -e{826} the integers are aligned to their size.*/
+        T *current = reinterpret_cast<T *>(&records[(r * recordSize) + offset]);
+        /*lint -e{927} -e{826} the integers are aligned to their size.*/
+        const T *previous = reinterpret_cast<const T *>(&records[((r - 1u) * recordSize) + offset]);
+        MARTe::uint32 i;
+        for (i = 0u; i < numberOfIntegers; i++) {
+            current[i] = static_cast<T>(current[i] + previous[i]);
+        }
+    }
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    namespace BlockCompression {
+
+        uint32 Compress(const uint8 * const input, const uint32 inputSize, uint8 * const output, const uint32 outputCapacity,
+                        uint32 * const hashTable) {
+            uint32 op = 0u;
+            uint32 anchor = 0u;
+            bool ok = true;
+            if (inputSize > BLOCK_COMPRESSION_MATCH_LIMIT) {
+                uint32 h;
+                for (h = 0u; h < HASH_TABLE_SIZE; h++) {
+                    hashTable[h] = 0u;
+                }
+                uint32 limit = inputSize - BLOCK_COMPRESSION_MATCH_LIMIT;
+                uint32 matchEnd = inputSize - BLOCK_COMPRESSION_LAST_LITERALS;
+                uint32 ip = 0u;
+                while ((ip < limit) && (ok)) {
+                    uint32 sequence = BlockCompressionRead32(&input[ip]);
+                    h = BlockCompressionHash(sequence);
+                    uint32 ref = hashTable[h];
+                    hashTable[h] = ip;
+                    bool found = ((ref < ip) && ((ip - ref) <= BLOCK_COMPRESSION_MAX_OFFSET));
+                    if (found) {
+                        found = (BlockCompressionRead32(&input[ref]) == sequence);
+                    }
+                    if (found) {
+                        while ((ip > anchor) && (ref > 0u) && (input[ip - 1u] == input[ref - 1u])) {
+                            ip--;
+                            ref--;
+                        }
+                        uint32 length = BLOCK_COMPRESSION_MIN_MATCH;
+                        while (((ip + length) < matchEnd) && (input[ref + length] == input[ip + length])) {
+                            length++;
+                        }
+                        ok = BlockCompressionWriteSequence(&input[anchor], ip - anchor, output, outputCapacity, op, ip - ref, length, false);
+                        ip += length;
+                        anchor = ip;
+                        if (ip < limit) {
+                            hashTable[BlockCompressionHash(BlockCompressionRead32(&input[ip - 2u]))] = ip - 2u;
+                        }
+                    }
+                    else {
+                        //Moves faster on data which does not compress
+                        ip += 1u + ((ip - anchor) >> 6u);
+                    }
+                }
+            }
+            if (ok) {
+                ok = BlockCompressionWriteSequence(&input[anchor], inputSize - anchor, output, outputCapacity, op, 0u, 0u, true);
+            }
+            return (ok) ? (op) : (0u);
+        }
+
+        bool Decompress(const uint8 * const input, const uint32 inputSize, uint8 * const output, const uint32 outputSize) {
+            uint32 ip = 0u;
+            uint32 op = 0u;
+            bool ok = (inputSize > 0u);
+            bool done = false;
+            while ((ok) && (!done)) {
+                ok = (ip < inputSize);
+                uint32 token = 0u;
+                uint32 literalLength = 0u;
+                if (ok) {
+                    token = input[ip];
+                    ip++;
+                    literalLength = token >> 4u;
+                    if (literalLength == BLOCK_COMPRESSION_RUN_MASK) {
+                        ok = BlockCompressionReadLength(input, inputSize, ip, literalLength);
+                    }
+                }
+                if (ok) {
+                    ok = ((literalLength <= (inputSize - ip)) && (literalLength <= (outputSize - op)));
+                }
+                if (ok) {
+                    uint32 i;
+                    for (i = 0u; i < literalLength; i++) {
+                        output[op + i] = input[ip + i];
+                    }
+                    ip += literalLength;
+                    op += literalLength;
+                    //The last sequence has no back-reference
+                    done = (ip == inputSize);
+                }
+                if ((ok) && (!done)) {
+                    ok = ((inputSize - ip) >= 2u);
+                    uint32 offset = 0u;
+                    if (ok) {
+                        offset = static_cast<uint32>(input[ip]) | (static_cast<uint32>(input[ip + 1u]) << 8u);
+                        ip += 2u;
+                        ok = ((offset > 0u) && (offset <= op));
+                    }
+                    uint32 matchLength = token & BLOCK_COMPRESSION_RUN_MASK;
+                    if ((ok) && (matchLength == BLOCK_COMPRESSION_RUN_MASK)) {
+                        ok = BlockCompressionReadLength(input, inputSize, ip, matchLength);
+                    }
+                    if (ok) {
+                        matchLength += BLOCK_COMPRESSION_MIN_MATCH;
+                        ok = (matchLength <= (outputSize - op));
+                    }
+                    if (ok) {
+                        //Byte by byte, as the reference may overlap the bytes being written (repeated patterns)
+                        uint32 i;
+                        for (i = 0u; i < matchLength; i++) {
+                            output[op + i] = output[(op - offset) + i];
+                        }
+                        op += matchLength;
+                    }
+                }
+            }
+            return ((ok) && (op == outputSize));
+        }
+
+        void Shuffle(const uint8 * const input, uint8 * const output, const uint32 numberOfElements, const uint32 elementSize) {
+            uint32 i;
+            for (i = 0u; i < numberOfElements; i++) {
+                const uint8 *element = &input[i * elementSize];
+                uint32 b;
+                for (b = 0u; b < elementSize; b++) {
+                    output[(b * numberOfElements) + i] = element[b];
+                }
+            }
+        }
+
+        void Unshuffle(const uint8 * const input, uint8 * const output, const uint32 numberOfElements, const uint32 elementSize) {
+            uint32 i;
+            for (i = 0u; i < numberOfElements; i++) {
+                uint8 *element = &output[i * elementSize];
+                uint32 b;
+                for (b = 0u; b < elementSize; b++) {
+                    element[b] = input[(b * numberOfElements) + i];
+                }
+            }
+        }
+
+        bool DeltaEncode(uint8 * const records, const uint32 numberOfRecords, const uint32 recordSize, const uint32 offset,
+                         const uint32 integerSize, const uint32 numberOfIntegers) {
+            bool ok = true;
+            if (integerSize == 1u) {
+                BlockCompressionDeltaEncode<uint8>(records, numberOfRecords, recordSize, offset, numberOfIntegers);
+            }
+            else if (integerSize == 2u) {
+                BlockCompressionDeltaEncode<uint16>(records, numberOfRecords, recordSize, offset, numberOfIntegers);
+            }
+            else if (integerSize == 4u) {
+                BlockCompressionDeltaEncode<uint32>(records, numberOfRecords, recordSize, offset, numberOfIntegers);
+            }
+            else if (integerSize == 8u) {
+                BlockCompressionDeltaEncode<uint64>(records, numberOfRecords, recordSize, offset, numberOfIntegers);
+            }
+            else {
+                ok = false;
+            }
+            return ok;
+        }
+
+        bool DeltaDecode(uint8 * const records, const uint32 numberOfRecords, const uint32 recordSize, const uint32 offset,
+                         const uint32 integerSize, const uint32 numberOfIntegers) {
+            bool ok = true;
+            if (integerSize == 1u) {
+                BlockCompressionDeltaDecode<uint8>(records, numberOfRecords, recordSize, offset, numberOfIntegers);
+            }
+            else if (integerSize == 2u) {
+                BlockCompressionDeltaDecode<uint16>(records, numberOfRecords, recordSize, offset, numberOfIntegers);
+            }
+            else if (integerSize == 4u) {
+                BlockCompressionDeltaDecode<uint32>(records, numberOfRecords, recordSize, offset, numberOfIntegers);
+            }
+            else if (integerSize == 8u) {
+                BlockCompressionDeltaDecode<uint64>(records, numberOfRecords, recordSize, offset, numberOfIntegers);
+            }
+            else {
+                ok = false;
+            }
+            return ok;
+        }
+    }
+
+}
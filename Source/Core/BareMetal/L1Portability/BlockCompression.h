@@ -0,0 +1,128 @@
+/**
+ * @file BlockCompression.h
+ * @brief Header file for module BlockCompression
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BlockCompression
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef BLOCKCOMPRESSION_H_
+#define BLOCKCOMPRESSION_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief Lossless compression of blocks of binary data (e.g. recorded signals).
+     * @details Compress and Decompress implement the LZ4 block format (sequences of literals and back-references of at least
+     * 4 bytes within the previous 64 KB), with a single pass greedy matcher: it is much faster than entropy coders and, as each block
+     * is independent, any block can be decompressed without the others.
+     *
+     * Shuffle and DeltaEncode are reversible transformations that make numeric data compress better: Shuffle groups the bytes with the
+     * same position in each element (e.g. all the most significant bytes) and DeltaEncode replaces slowly varying integers by the
+     * (small) difference to the previous element.
+     */
+    namespace BlockCompression {
+
+        /**
+         * The number of uint32 of the hash table given to Compress.
+         */
+        static const uint32 HASH_TABLE_SIZE = 4096u;
+
+        /**
+         * @brief Compresses a block.
+         * @param[in] input the data to compress.
+         * @param[in] inputSize the number of bytes of \a input.
+         * @param[out] output where to write the compressed block.
+         * @param[in] outputCapacity the number of bytes available in \a output.
+         * @param[in] hashTable HASH_TABLE_SIZE elements of working memory (any content).
+         * @return the size of the compressed block or 0 if it does not fit in \a outputCapacity (e.g. if \a outputCapacity < \a inputSize
+         * and the data cannot be compressed).
+         */
+        DLL_API uint32 Compress(const uint8 * const input, const uint32 inputSize, uint8 * const output, const uint32 outputCapacity,
+                                uint32 * const hashTable);
+
+        /**
+         * @brief Decompresses a block written by Compress (or by any LZ4 block compressor).
+         * @param[in] input the compressed block.
+         * @param[in] inputSize the number of bytes of \a input.
+         * @param[out] output where to write the decompressed data.
+         * @param[in] outputSize the size of the decompressed data.
+         * @return true if \a input is a valid block that decompresses to exactly \a outputSize bytes. Invalid blocks never cause
+         * reads or writes outside of \a input and \a output.
+         */
+        DLL_API bool Decompress(const uint8 * const input, const uint32 inputSize, uint8 * const output, const uint32 outputSize);
+
+        /**
+         * @brief Transposes \a numberOfElements elements of \a elementSize bytes, so that output[(b * numberOfElements) + i] = input[(i * elementSize) + b].
+         * @param[in] input the elements.
+         * @param[out] output the shuffled bytes (shall not overlap \a input).
+         * @param[in] numberOfElements the number of elements.
+         * @param[in] elementSize the size of each element.
+         */
+        DLL_API void Shuffle(const uint8 * const input, uint8 * const output, const uint32 numberOfElements, const uint32 elementSize);
+
+        /**
+         * @brief Reverts Shuffle.
+         * @see Shuffle
+         */
+        DLL_API void Unshuffle(const uint8 * const input, uint8 * const output, const uint32 numberOfElements, const uint32 elementSize);
+
+        /**
+         * @brief Replaces, in place, each integer of a series of records by its difference (modulo 2^bits) to the same integer of the previous record.
+         * @details The integers of the first record are not changed.
+         * @param[in,out] records the records.
+         * @param[in] numberOfRecords the number of records.
+         * @param[in] recordSize the size of each record.
+         * @param[in] offset the offset of the first integer in a record.
+         * @param[in] integerSize the size of each integer (1, 2, 4 or 8 bytes). The integers shall be aligned to their size.
+         * @param[in] numberOfIntegers the number of consecutive integers in each record.
+         * @return false if \a integerSize is not supported.
+         */
+        DLL_API bool DeltaEncode(uint8 * const records, const uint32 numberOfRecords, const uint32 recordSize, const uint32 offset,
+                                 const uint32 integerSize, const uint32 numberOfIntegers);
+
+        /**
+         * @brief Reverts DeltaEncode.
+         * @see DeltaEncode
+         */
+        DLL_API bool DeltaDecode(uint8 * const records, const uint32 numberOfRecords, const uint32 recordSize, const uint32 offset,
+                                 const uint32 integerSize, const uint32 numberOfIntegers);
+    }
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BLOCKCOMPRESSION_H_ */
@@ -0,0 +1,152 @@
+/**
+ * @file CPUFeatures.h
+ * @brief Header file for module CPUFeatures
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CPUFeatures
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CPUFEATURES_H_
+#define CPUFEATURES_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/**
+ * Defined if the compiler can generate the SVE kernels, i.e. accepts arm_sve.h and __attribute__((target("+sve"))) without SVE being
+ * enabled for the whole library. The kernels shall still only be called if CPUFeatures::Has(CPU_FEATURE_SVE).
+ */
+#if defined(__aarch64__) && defined(__GNUC__) && (!defined(__clang__)) && (__GNUC__ >= 10)
+#define MARTe2_SVE_KERNELS
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief Optional processor extensions, detected once at runtime, used to select the implementation of the hot kernels.
+     * @details The library is compiled for the baseline of the architecture (e.g. ARMv8.0-A with NEON), so that the same binary runs
+     * on all the processors of the family. The kernels that have a faster implementation for an optional extension compile it for
+     * that extension only (e.g. with __attribute__((target("+crc")))) and select it once, with Has or Select, if the processor
+     * implements the extension (see CRC32).
+     *
+     * On Linux the extensions are read from the auxiliary vector (AT_HWCAP and AT_HWCAP2), i.e. as reported by the kernel.
+     */
+    namespace CPUFeatures {
+
+        /**
+         * The CRC32 and CRC32C instructions (ARMv8 crc32*).
+         */
+        static const uint32 CPU_FEATURE_CRC32 = 0x1u;
+
+        /**
+         * The large system extension atomics (ARMv8.1 LSE: ldadd, cas, swp).
+         */
+        static const uint32 CPU_FEATURE_ATOMICS = 0x2u;
+
+        /**
+         * The SIMD integer dot product instructions (ARMv8.2 sdot and udot).
+         */
+        static const uint32 CPU_FEATURE_DOTPROD = 0x4u;
+
+        /**
+         * The SIMD int8 matrix multiplication instructions (ARMv8.6 smmla and ummla).
+         */
+        static const uint32 CPU_FEATURE_I8MM = 0x8u;
+
+        /**
+         * The scalable vector extension.
+         */
+        static const uint32 CPU_FEATURE_SVE = 0x10u;
+
+        /**
+         * The scalable vector extension 2.
+         */
+        static const uint32 CPU_FEATURE_SVE2 = 0x20u;
+
+        /**
+         * One after the last CPU_FEATURE.
+         */
+        static const uint32 CPU_FEATURE_LAST = 0x40u;
+
+        /**
+         * @brief Gets the extensions implemented by the processor.
+         * @details Probed on the first call, the following calls only return the result.
+         * @return a mask of CPU_FEATURE values.
+         */
+        DLL_API uint32 Get();
+
+        /**
+         * @brief Checks if the processor implements all the extensions in \a features.
+         * @param[in] features a mask of CPU_FEATURE values.
+         * @return true if all the \a features are implemented.
+         */
+        inline bool Has(const uint32 features);
+
+        /**
+         * @brief Selects one of two implementations of a kernel.
+         * @param[in] features the extensions required by \a optimised.
+         * @param[in] optimised the implementation that requires the \a features.
+         * @param[in] generic the implementation for the baseline of the architecture.
+         * @return \a optimised if Has(features), \a generic otherwise.
+         */
+        template<typename FunctionType>
+        inline FunctionType Select(const uint32 features,
+                                   const FunctionType optimised,
+                                   const FunctionType generic);
+
+        /**
+         * @brief Gets the name of an extension.
+         * @param[in] feature one CPU_FEATURE value.
+         * @return the name (e.g. "crc32") or "unknown" if \a feature is not a single CPU_FEATURE value.
+         */
+        DLL_API const char8 *GetName(const uint32 feature);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+    namespace CPUFeatures {
+
+        inline bool Has(const uint32 features) {
+            return ((Get() & features) == features);
+        }
+
+        template<typename FunctionType>
+        inline FunctionType Select(const uint32 features,
+                                   const FunctionType optimised,
+                                   const FunctionType generic) {
+            return Has(features) ? (optimised) : (generic);
+        }
+    }
+}
+
+#endif /* CPUFEATURES_H_ */
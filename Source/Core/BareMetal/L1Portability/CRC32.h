@@ -0,0 +1,113 @@
+/**
+ * @file CRC32.h
+ * @brief Header file for module CRC32
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CRC32
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CRC32_H_
+#define CRC32_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include INCLUDE_FILE_ARCHITECTURE(BareMetal,L1Portability,ARCHITECTURE,CRC32A.h)
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief Fast computation of the two standard reflected 32 bit CRCs: CRC-32 (IEEE 802.3, polynomial 0x04C11DB7, as used by
+     * Ethernet, zlib and PNG) and CRC-32C (Castagnoli, polynomial 0x1EDC6F41, as used by iSCSI, ext4 and SCTP).
+     * @details When the processor provides CRC instructions (ARMv8 crc32 and crc32c, detected at runtime) these are used, otherwise
+     * a slice-by-8 table driven implementation (eight bytes per step) is used. Both give the same results.
+     *
+     * The Update functions are streaming: the value returned by one call is given as the \a crc of the next one, so that a
+     * sequence of buffers can be processed as if it were one. The running value is the non-inverted register, i.e. it shall
+     * start at 0xFFFFFFFF and the final CRC is its bitwise complement (see Compute).
+     *
+     * For generic (non reflected) polynomials and other widths see CRC.
+     */
+    namespace CRC32 {
+
+        /**
+         * @brief Updates a running CRC-32 (IEEE 802.3) with \a size bytes of \a data.
+         * @param[in] crc the running CRC value (0xFFFFFFFF for the first buffer).
+         * @param[in] data the bytes to be added to the CRC.
+         * @param[in] size the number of bytes in \a data.
+         * @return the updated running CRC value.
+         */
+        DLL_API uint32 Update(const uint32 crc, const uint8 * const data, const uint32 size);
+
+        /**
+         * @brief Updates a running CRC-32C (Castagnoli) with \a size bytes of \a data.
+         * @see Update
+         */
+        DLL_API uint32 UpdateC(const uint32 crc, const uint8 * const data, const uint32 size);
+
+        /**
+         * @brief Computes the CRC-32 (IEEE 802.3) of \a size bytes of \a data.
+         * @return the CRC (e.g. 0xCBF43926 for the ASCII string "123456789").
+         */
+        inline uint32 Compute(const uint8 * const data, const uint32 size);
+
+        /**
+         * @brief Computes the CRC-32C (Castagnoli) of \a size bytes of \a data.
+         * @return the CRC (e.g. 0xE3069283 for the ASCII string "123456789").
+         */
+        inline uint32 ComputeC(const uint8 * const data, const uint32 size);
+
+        /**
+         * @brief Checks if the processor CRC instructions are being used.
+         * @return true if the CRCs are computed by the hardware.
+         */
+        DLL_API bool IsHardwareAccelerated();
+    }
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    namespace CRC32 {
+
+        inline uint32 Compute(const uint8 * const data, const uint32 size) {
+            return ~Update(0xFFFFFFFFu, data, size);
+        }
+
+        inline uint32 ComputeC(const uint8 * const data, const uint32 size) {
+            return ~UpdateC(0xFFFFFFFFu, data, size);
+        }
+    }
+
+}
+
+#endif /* CRC32_H_ */
@@ -0,0 +1,118 @@
+/**
+ * @file ClockCorrelation.h
+ * @brief Header file for module ClockCorrelation
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module ClockCorrelation
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CLOCKCORRELATION_H_
+#define CLOCKCORRELATION_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * The number of (counter, reference time) samples fitted by ClockCorrelation.
+     */
+    static const uint32 CLOCK_CORRELATION_SAMPLES = 16u;
+
+    /**
+     * The difference in nanoseconds between a sample and the model which is taken as a step of the reference clock.
+     */
+    static const uint64 CLOCK_CORRELATION_STEP_THRESHOLD = 1000000u;
+
+    /**
+     * @brief Correlation of the HighResolutionTimer::Counter with an absolute (UTC) reference clock.
+     * @details The HighResolutionTimer counter is monotonic and is never stepped, which makes it the right clock for the cycle
+     * timings, but it has no absolute origin and drifts with respect to the UTC. The reference clock (the operating system
+     * real-time clock, which may be disciplined by NTP, or the hardware clock of a PTP network card, see SetReferenceClock) is
+     * sampled with Sample, which shall be called periodically (e.g. every second) by a non real-time thread. Each sample is a
+     * (counter, reference time) pair, taken with the counter read before and after the reference clock (the pair with the
+     * shortest read, of a few tries, is kept). A least squares line is fitted on the last CLOCK_CORRELATION_SAMPLES samples,
+     * which corrects both the offset and the drift of the counter.
+     *
+     * CounterToUTC converts a counter value with the model, without any system call or lock, so that the real-time threads can
+     * stamp their samples with an absolute time. The model is published by Sample with a sequence number (the readers retry
+     * while it is being written).
+     *
+     * If a sample is further than CLOCK_CORRELATION_STEP_THRESHOLD from the model the reference clock was stepped (e.g. by NTP)
+     * and the fit restarts from that sample.
+     */
+    namespace ClockCorrelation {
+
+        /**
+         * @brief Selects the reference clock and restarts the fit.
+         * @param[in] device the PTP hardware clock device (e.g. /dev/ptp0). If NULL the operating system real-time clock is used.
+         * @return true if the clock device could be opened.
+         */
+        bool SetReferenceClock(const char8 * const device = NULL_PTR(const char8 *));
+
+        /**
+         * @brief Samples the reference clock and updates the model.
+         * @return true if the reference clock could be read.
+         */
+        bool Sample();
+
+        /**
+         * @brief Converts a counter value to an absolute time.
+         * @param[in] ticks the HighResolutionTimer::Counter value.
+         * @return the nanoseconds since the epoch (1/1/1970 00:00:00 UTC, or the epoch of the PTP clock, i.e. TAI) at \a ticks,
+         * or 0 if Sample was never called.
+         */
+        uint64 CounterToUTC(const uint64 ticks);
+
+        /**
+         * @brief Checks if the model can be used.
+         * @return true if Sample was successfully called at least once.
+         */
+        bool IsSynchronised();
+
+        /**
+         * @brief Gets the drift of the counter measured by the model.
+         * @return the difference, in parts per million, between the measured and the nominal (HighResolutionTimer::Frequency) counter frequency.
+         */
+        float64 GetDrift();
+
+        /**
+         * @brief Gets the number of steps of the reference clock detected by Sample.
+         * @return the number of steps of the reference clock.
+         */
+        uint32 GetNumberOfSteps();
+    }
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* CLOCKCORRELATION_H_ */
@@ -0,0 +1,124 @@
+/**
+ * @file CompiledFormat.cpp
+ * @brief Source file for class CompiledFormat
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CompiledFormat (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "Atomic.h"
+#include "CompiledFormat.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+CompiledFormat::CompiledFormat() {
+    format = static_cast<const char8 *>(NULL);
+    numberOfDescriptors = 0u;
+    for (uint32 i = 0u; i <= COMPILED_FORMAT_MAX_DESCRIPTORS; i++) {
+        literalOffset[i] = 0u;
+        literalSize[i] = 0u;
+    }
+    state = static_cast<int32>(CompiledFormatEmpty);
+}
+
+CompiledFormat::CompiledFormat(const char8 * const formatIn) {
+    format = static_cast<const char8 *>(NULL);
+    numberOfDescriptors = 0u;
+    for (uint32 i = 0u; i <= COMPILED_FORMAT_MAX_DESCRIPTORS; i++) {
+        literalOffset[i] = 0u;
+        literalSize[i] = 0u;
+    }
+    state = static_cast<int32>(CompiledFormatEmpty);
+    (void) Compile(formatIn);
+}
+
+bool CompiledFormat::Compile(const char8 * const formatIn) {
+    bool ok = Parse(formatIn);
+    Atomic::StoreRelease(&state, ok ? static_cast<int32>(CompiledFormatReady) : static_cast<int32>(CompiledFormatInvalid));
+    return ok;
+}
+
+bool CompiledFormat::CompileOnce(const char8 * const formatIn) {
+    int32 expected = static_cast<int32>(CompiledFormatEmpty);
+    if (Atomic::CompareExchange(&state, expected, static_cast<int32>(CompiledFormatCompiling))) {
+        bool ok = Parse(formatIn);
+        Atomic::StoreRelease(&state, ok ? static_cast<int32>(CompiledFormatReady) : static_cast<int32>(CompiledFormatInvalid));
+    }
+    return (Atomic::LoadAcquire(&state) == static_cast<int32>(CompiledFormatReady)) && (format == formatIn);
+}
+
+/*lint -e{946} -e{947} [MISRA C++ Rule 5-0-15], [MISRA C++ Rule 5-0-17]. Justification: the offsets are computed between pointers inside the same format string.*/
+bool CompiledFormat::Parse(const char8 * const formatIn) {
+    format = formatIn;
+    numberOfDescriptors = 0u;
+    bool ok = (formatIn != NULL);
+    bool quit = !ok;
+    const char8 *current = formatIn;
+    while (!quit) {
+        // the literal segment up to the next % or the end
+        const char8 *literal = current;
+        while ((current[0] != '\0') && (current[0] != '%')) {
+            current = &current[1];
+        }
+        uint32 offset = static_cast<uint32>(literal - formatIn);
+        uint32 size = static_cast<uint32>(current - literal);
+        ok = (offset <= 0xFFFFu) && (size <= 0xFFFFu);
+        if (ok) {
+            literalOffset[numberOfDescriptors] = static_cast<uint16>(offset);
+            literalSize[numberOfDescriptors] = static_cast<uint16>(size);
+        }
+        if ((!ok) || (current[0] == '\0')) {
+            quit = true;
+        }
+        else {
+            // consume % and parse the descriptor
+            current = &current[1];
+            ok = (numberOfDescriptors < COMPILED_FORMAT_MAX_DESCRIPTORS);
+            if (ok) {
+                ok = descriptors[numberOfDescriptors].InitialiseFromString(current);
+            }
+            if (ok) {
+                numberOfDescriptors++;
+            }
+            else {
+                quit = true;
+            }
+        }
+    }
+    return ok;
+}
+
+}
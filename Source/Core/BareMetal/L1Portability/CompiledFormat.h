@@ -0,0 +1,222 @@
+/**
+ * @file CompiledFormat.h
+ * @brief Header file for class CompiledFormat
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CompiledFormat
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef COMPILEDFORMAT_H_
+#define COMPILEDFORMAT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "FormatDescriptor.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Maximum number of format descriptors in a CompiledFormat.
+ */
+static const uint32 COMPILED_FORMAT_MAX_DESCRIPTORS = 12u;
+
+/**
+ * @brief A printf-like format string parsed once into its literal segments
+ * and FormatDescriptor list.
+ * @details The printers (IOBuffer::PrintFormatted, BufferedStreamI::Printf)
+ * accept a CompiledFormat in place of the format string and then skip the
+ * parsing, copying the literal segments and applying the descriptors
+ * directly. A CompiledFormat is meant to be declared once per call site
+ * (e.g. as a function static, as the REPORT_ERROR macros do) and compiled
+ * on first use with CompileOnce().
+ *
+ * The format string is not copied and must outlive the CompiledFormat
+ * (string literals are the intended use case). The object does not allocate
+ * memory: formats with more than COMPILED_FORMAT_MAX_DESCRIPTORS descriptors,
+ * with literal segments longer than 65535 characters or with an invalid
+ * descriptor are not compiled and the callers fall back on the format string.
+ */
+class DLL_API CompiledFormat {
+public:
+
+    /**
+     * @brief Default constructor.
+     * @post
+     *   not IsCompiled() &&
+     *   GetFormat() == NULL
+     */
+    CompiledFormat();
+
+    /**
+     * @brief Constructor which compiles \a formatIn.
+     * @param[in] formatIn the printf-like format (see FormatDescriptor::InitialiseFromString).
+     * @post
+     *   IsCompiled() if \a formatIn could be compiled.
+     */
+    explicit CompiledFormat(const char8 * const formatIn);
+
+    /**
+     * @brief Parses \a formatIn and stores the literal segments and descriptors.
+     * @details Not thread safe; use CompileOnce on objects shared by several threads.
+     * @param[in] formatIn the printf-like format.
+     * @return true if \a formatIn was successfully compiled.
+     */
+    bool Compile(const char8 * const formatIn);
+
+    /**
+     * @brief Compiles \a formatIn on the first call and checks that the
+     * object was compiled from \a formatIn on the next ones.
+     * @details Thread safe and lock free: only the first caller compiles,
+     * concurrent callers return false until the compilation has completed.
+     * The check is on the pointer, so a call site whose format is not a
+     * constant string keeps returning false after the first format.
+     * @param[in] formatIn the printf-like format.
+     * @return true if the object is compiled from \a formatIn and can be used
+     * in its place.
+     */
+    bool CompileOnce(const char8 * const formatIn);
+
+    /**
+     * @brief Checks if the format was successfully compiled.
+     * @return true if the format was successfully compiled.
+     */
+    inline bool IsCompiled() const;
+
+    /**
+     * @brief Gets the format string.
+     * @return the format string (NULL if never compiled).
+     */
+    inline const char8 *GetFormat() const;
+
+    /**
+     * @brief Gets the number of format descriptors.
+     * @return the number of format descriptors.
+     */
+    inline uint32 GetNumberOfDescriptors() const;
+
+    /**
+     * @brief Gets a format descriptor.
+     * @param[in] index the index of the descriptor (< GetNumberOfDescriptors()).
+     * @return the descriptor at position \a index.
+     */
+    inline const FormatDescriptor &GetDescriptor(const uint32 index) const;
+
+    /**
+     * @brief Gets the literal segment which precedes a format descriptor.
+     * @param[in] index the index of the descriptor (<= GetNumberOfDescriptors(),
+     * GetNumberOfDescriptors() returning the segment after the last descriptor).
+     * @param[out] size the number of characters in the segment.
+     * @return the beginning of the segment inside the format.
+     */
+    inline const char8 *GetLiteral(const uint32 index,
+                                   uint32 &size) const;
+
+private:
+
+    /**
+     * @brief Parses \a formatIn into the literal segments and descriptors.
+     * @param[in] formatIn the printf-like format.
+     * @return true if \a formatIn was successfully parsed.
+     */
+    bool Parse(const char8 * const formatIn);
+
+    /**
+     * The compilation states.
+     */
+    enum CompiledFormatState {
+        CompiledFormatEmpty = 0,
+        CompiledFormatCompiling = 1,
+        CompiledFormatReady = 2,
+        CompiledFormatInvalid = 3
+    };
+
+    /**
+     * The format string.
+     */
+    const char8 *format;
+
+    /**
+     * The number of format descriptors.
+     */
+    uint32 numberOfDescriptors;
+
+    /**
+     * The format descriptors.
+     */
+    FormatDescriptor descriptors[COMPILED_FORMAT_MAX_DESCRIPTORS];
+
+    /**
+     * The offset in the format of each literal segment.
+     */
+    uint16 literalOffset[COMPILED_FORMAT_MAX_DESCRIPTORS + 1u];
+
+    /**
+     * The size of each literal segment.
+     */
+    uint16 literalSize[COMPILED_FORMAT_MAX_DESCRIPTORS + 1u];
+
+    /**
+     * One of CompiledFormatState.
+     */
+    volatile int32 state;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+bool CompiledFormat::IsCompiled() const {
+    return (state == static_cast<int32>(CompiledFormatReady));
+}
+
+const char8 *CompiledFormat::GetFormat() const {
+    return format;
+}
+
+uint32 CompiledFormat::GetNumberOfDescriptors() const {
+    return numberOfDescriptors;
+}
+
+const FormatDescriptor &CompiledFormat::GetDescriptor(const uint32 index) const {
+    return descriptors[index];
+}
+
+const char8 *CompiledFormat::GetLiteral(const uint32 index,
+                                        uint32 &size) const {
+    size = static_cast<uint32>(literalSize[index]);
+    return &format[literalOffset[index]];
+}
+
+}
+
+#endif /* COMPILEDFORMAT_H_ */
@@ -0,0 +1,66 @@
+/**
+ * @file Crc32cHashFunction.cpp
+ * @brief Source file for class Crc32cHashFunction
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class Crc32cHashFunction (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "CRC32.h"
+#include "Crc32cHashFunction.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+Crc32cHashFunction::Crc32cHashFunction() :
+        HashFunction() {
+}
+
+Crc32cHashFunction::~Crc32cHashFunction() {
+}
+
+uint32 Crc32cHashFunction::Compute(const char8 * const in,
+                                   const uint32 size) {
+    const uint8 *input = reinterpret_cast<const uint8 *>(in);
+    uint32 hash = 0u;
+    if (input != NULL) {
+        uint32 len = size;
+        if (len == 0u) {
+            while (input[len] != 0u) {
+                len++;
+            }
+        }
+        hash = CRC32::ComputeC(input, len);
+    }
+    return hash;
+}
+}
@@ -0,0 +1,73 @@
+/**
+ * @file Crc32cHashFunction.h
+ * @brief Header file for class Crc32cHashFunction
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class Crc32cHashFunction
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CRC32CHASHFUNCTION_H_
+#define CRC32CHASHFUNCTION_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "HashFunction.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Hash function based on the CRC-32C (Castagnoli) of the input.
+ * @details When the processor implements the ARMv8 CRC instructions each crc32cx hashes eight bytes in a few cycles,
+ * otherwise the slice-by-8 tables are used (see CRC32). The hash is well distributed for short strings but, being linear,
+ * it is not suitable against inputs chosen to collide (see WyHashFunction).
+ */
+class Crc32cHashFunction: public HashFunction {
+public:
+
+    /**
+     * @brief Constructor
+     */
+    Crc32cHashFunction();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~Crc32cHashFunction();
+
+    /**
+     * @see HashFunction::Compute
+     */
+    virtual uint32 Compute(const char8 * const in, const uint32 size=0u);
+
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* CRC32CHASHFUNCTION_H_ */
@@ -53,6 +53,8 @@ void NullErrorProcessFunction(const ErrorInformation &errorInfo,
 
 ErrorProcessFunctionType errorMessageProcessFunction = &NullErrorProcessFunction;
 
+ErrorIntegerFormat reportMask = 0xFFFFFFFFu;
+
 /**
  * @brief A structure pairing an error code with its explanation.
  */
@@ -113,6 +115,22 @@ void ErrorCodeToStream(const ErrorType &errorCode,
     }
 }
 
+bool ErrorNameToCode(const char8 * const name,
+                     ErrorType &errorCode) {
+    bool found = false;
+    if (name != NULL) {
+        uint32 i = 0u;
+        while ((!found) && (errorNames[i].name != NULL)) {
+            found = (StringHelper::Compare(errorNames[i].name, name) == 0);
+            if (found) {
+                errorCode = errorNames[i].errorBitSet;
+            }
+            i++;
+        }
+    }
+    return found;
+}
+
 void ReportError(const ErrorType &code,
                  const char8 * const errorDescription,
                  const char8 * const clsName,
@@ -169,6 +187,14 @@ void SetErrorProcessFunction(const ErrorProcessFunctionType userFun) {
     }
 }
 
+void SetReportMask(const ErrorType &mask) {
+    reportMask = mask.format_as_integer;
+}
+
+ErrorType GetReportMask() {
+    return ErrorType(reportMask);
+}
+
 }
 
 }
@@ -55,10 +55,8 @@ bool Copy(void* const destination,
 
     bool ret = false;
     if ((source != NULL) && (destination != NULL)) {
-        ret = memcpy(destination, source, static_cast<osulong>(size)) != NULL;
-        if (!ret) {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryOperationsHelper: Failed memcpy()");
-        }
+        CopyUnchecked(destination, source, size);
+        ret = true;
     }
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "MemoryOperationsHelper: Invalid input arguments");
@@ -0,0 +1,84 @@
+/**
+ * @file AddressWait.cpp
+ * @brief Source file for module AddressWait
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class AddressWait (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AddressWait.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace AddressWait {
+
+ErrorManagement::ErrorType Wait(volatile int32 * const address,
+                                const int32 value,
+                                const TimeoutType &timeout) {
+    ErrorManagement::ErrorType err;
+    struct timespec relative;
+    struct timespec *relativePtr = static_cast<struct timespec *>(NULL);
+    if (timeout.IsFinite()) {
+        uint64 usec = timeout.GetTimeoutUSec();
+        relative.tv_sec = static_cast<time_t>(usec / 1000000u);
+        relative.tv_nsec = static_cast<long>((usec % 1000000u) * 1000u);
+        relativePtr = &relative;
+    }
+    /*lint -e{923} the futex syscall requires this cast*/
+    long ret = syscall(SYS_futex, address, FUTEX_WAIT | FUTEX_PRIVATE_FLAG, value, relativePtr, NULL, 0);
+    if (ret != 0) {
+        //EAGAIN: *address != value; EINTR: spurious wake-up
+        err.timeout = (errno == ETIMEDOUT);
+    }
+    return err;
+}
+
+void WakeAll(volatile int32 * const address) {
+    /*lint -e{923} the futex syscall requires this cast*/
+    (void) syscall(SYS_futex, address, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, INT_MAX, NULL, NULL, 0);
+}
+
+}
+
+}
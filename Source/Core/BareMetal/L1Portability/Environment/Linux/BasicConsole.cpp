@@ -27,6 +27,7 @@
 
 #ifndef LINT
 #include <sys/ioctl.h>
+#include <errno.h>
 #include <stdio.h>
 #include <unistd.h>
 #include <string.h>
@@ -254,6 +255,23 @@ bool BasicConsole::OSWrite(const char8* const buffer,
 
     bool sink = false;
     bool err = true;
+    if (handle->nOfColumns == 0u) {
+        //No scene size: there is nothing to wrap, so that the whole buffer is written with as few write() as possible
+        while ((err == true) && (index < size)) {
+            ssize_t wbytes = write(BasicConsoleProperties::STDOUT, &bufferString[index], static_cast<size_t>(size - index));
+            if (wbytes > 0) {
+                index += static_cast<uint32>(wbytes);
+                writtenBytes += wbytes;
+            }
+            else if ((wbytes == -1) && (errno == EINTR)) {
+                //Interrupted before writing anything, try again
+            }
+            else {
+                err = false;
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicConsole: Failed write()");
+            }
+        }
+    }
     while ((err == true) && (index < size)) {
         currentChar = bufferString[index];
         if (currentChar == '\n') {
@@ -0,0 +1,138 @@
+/**
+ * @file CPUFeatures.cpp
+ * @brief Source file for module CPUFeatures
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module CPUFeatures for Linux.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#if defined(__aarch64__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "CPUFeatures.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * @brief Reads the extensions reported by the kernel in the auxiliary vector.
+ * @details Each HWCAP is only checked if the C library headers know it, so that older toolchains report less extensions.
+ */
+MARTe::uint32 ProbeCPUFeatures() {
+    MARTe::uint32 features = 0u;
+#if defined(__aarch64__)
+    unsigned long hwcap = getauxval(AT_HWCAP);
+#if defined(HWCAP_CRC32)
+    if ((hwcap & HWCAP_CRC32) != 0u) {
+        features |= MARTe::CPUFeatures::CPU_FEATURE_CRC32;
+    }
+#endif
+#if defined(HWCAP_ATOMICS)
+    if ((hwcap & HWCAP_ATOMICS) != 0u) {
+        features |= MARTe::CPUFeatures::CPU_FEATURE_ATOMICS;
+    }
+#endif
+#if defined(HWCAP_ASIMDDP)
+    if ((hwcap & HWCAP_ASIMDDP) != 0u) {
+        features |= MARTe::CPUFeatures::CPU_FEATURE_DOTPROD;
+    }
+#endif
+#if defined(HWCAP_SVE)
+    if ((hwcap & HWCAP_SVE) != 0u) {
+        features |= MARTe::CPUFeatures::CPU_FEATURE_SVE;
+    }
+#endif
+#if defined(AT_HWCAP2)
+    unsigned long hwcap2 = getauxval(AT_HWCAP2);
+#if defined(HWCAP2_SVE2)
+    if ((hwcap2 & HWCAP2_SVE2) != 0u) {
+        features |= MARTe::CPUFeatures::CPU_FEATURE_SVE2;
+    }
+#endif
+#if defined(HWCAP2_I8MM)
+    if ((hwcap2 & HWCAP2_I8MM) != 0u) {
+        features |= MARTe::CPUFeatures::CPU_FEATURE_I8MM;
+    }
+#endif
+    (void) hwcap2;
+#endif
+    (void) hwcap;
+#endif
+    return features;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace CPUFeatures {
+
+uint32 Get() {
+    static const uint32 features = ProbeCPUFeatures();
+    return features;
+}
+
+const char8 *GetName(const uint32 feature) {
+    const char8 *name = "unknown";
+    if (feature == CPU_FEATURE_CRC32) {
+        name = "crc32";
+    }
+    else if (feature == CPU_FEATURE_ATOMICS) {
+        name = "atomics";
+    }
+    else if (feature == CPU_FEATURE_DOTPROD) {
+        name = "dotprod";
+    }
+    else if (feature == CPU_FEATURE_I8MM) {
+        name = "i8mm";
+    }
+    else if (feature == CPU_FEATURE_SVE) {
+        name = "sve";
+    }
+    else if (feature == CPU_FEATURE_SVE2) {
+        name = "sve2";
+    }
+    else {
+        //Not a single CPU_FEATURE
+    }
+    return name;
+}
+
+}
+
+}
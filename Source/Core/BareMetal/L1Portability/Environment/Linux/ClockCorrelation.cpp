@@ -0,0 +1,263 @@
+/**
+ * @file ClockCorrelation.cpp
+ * @brief Source file for module ClockCorrelation
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ClockCorrelation (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "ClockCorrelation.h"
+#include "ErrorManagement.h"
+#include "HighResolutionTimer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+
+/**
+ * The number of reads of the reference clock of each sample.
+ */
+const MARTe::uint32 CLOCK_CORRELATION_TRIES = 3u;
+
+/**
+ * @brief The linear model which converts the counter to the reference time.
+ */
+struct ClockCorrelationModel {
+    MARTe::uint64 baseTicks;
+    MARTe::uint64 baseNanoseconds;
+    MARTe::float64 nanosecondsPerTick;
+};
+
+/**
+ * The model used by CounterToUTC (written by Sample under modelSequence).
+ */
+ClockCorrelationModel model = { 0u, 0u, 0.0 };
+
+/**
+ * Odd while the model is being written.
+ */
+volatile MARTe::int32 modelSequence = 0;
+
+/**
+ * The samples of the fit (only used by Sample).
+ */
+MARTe::uint64 sampleTicks[MARTe::CLOCK_CORRELATION_SAMPLES];
+MARTe::uint64 sampleNanoseconds[MARTe::CLOCK_CORRELATION_SAMPLES];
+MARTe::uint32 numberOfSamples = 0u;
+MARTe::uint32 nextSample = 0u;
+
+/**
+ * The number of steps of the reference clock.
+ */
+MARTe::uint32 numberOfSteps = 0u;
+
+/**
+ * The reference clock and the file descriptor of its PTP device (-1 for CLOCK_REALTIME).
+ */
+clockid_t referenceClock = CLOCK_REALTIME;
+int referenceClockFile = -1;
+
+/**
+ * @brief Publishes a new model.
+ */
+void PublishModel(const ClockCorrelationModel &newModel) {
+    (void) MARTe::Atomic::FetchAdd(&modelSequence, 1, MARTe::Atomic::MemoryOrderAcquire);
+    MARTe::Atomic::ThreadFence(MARTe::Atomic::MemoryOrderRelease);
+    model = newModel;
+    (void) MARTe::Atomic::FetchAdd(&modelSequence, 1, MARTe::Atomic::MemoryOrderRelease);
+}
+
+/**
+ * @brief Copies the published model.
+ * @return false if no model was published yet.
+ */
+bool ReadModel(ClockCorrelationModel &copy) {
+    bool consistent = false;
+    while (!consistent) {
+        MARTe::int32 before = MARTe::Atomic::Load(&modelSequence, MARTe::Atomic::MemoryOrderAcquire);
+        if ((before & 1) == 0) {
+            copy = model;
+            MARTe::Atomic::ThreadFence(MARTe::Atomic::MemoryOrderAcquire);
+            consistent = (MARTe::Atomic::Load(&modelSequence, MARTe::Atomic::MemoryOrderRelaxed) == before);
+        }
+    }
+    return (copy.nanosecondsPerTick > 0.0);
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace ClockCorrelation {
+
+bool SetReferenceClock(const char8 * const device) {
+    if (referenceClockFile >= 0) {
+        (void) close(referenceClockFile);
+        referenceClockFile = -1;
+    }
+    referenceClock = CLOCK_REALTIME;
+    bool ok = true;
+    if (device != NULL_PTR(const char8 *)) {
+        referenceClockFile = open(device, O_RDONLY);
+        ok = (referenceClockFile >= 0);
+        if (ok) {
+            //FD_TO_CLOCKID of the kernel dynamic clocks
+            referenceClock = static_cast<clockid_t>((~static_cast<uint32>(referenceClockFile) << 3u) | 3u);
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "ClockCorrelation: could not open the PTP clock device.");
+        }
+    }
+    numberOfSamples = 0u;
+    nextSample = 0u;
+    ClockCorrelationModel noModel = { 0u, 0u, 0.0 };
+    PublishModel(noModel);
+    return ok;
+}
+
+bool Sample() {
+    //The read of the reference clock bracketed by the shortest counter interval
+    bool ok = false;
+    uint64 bestInterval = 0u;
+    uint64 ticks = 0u;
+    uint64 nanoseconds = 0u;
+    for (uint32 t = 0u; t < CLOCK_CORRELATION_TRIES; t++) {
+        struct timespec now;
+        uint64 before = HighResolutionTimer::Counter();
+        bool read = (clock_gettime(referenceClock, &now) == 0);
+        uint64 after = HighResolutionTimer::Counter();
+        if (read) {
+            if ((!ok) || ((after - before) < bestInterval)) {
+                bestInterval = (after - before);
+                ticks = before + (bestInterval / 2u);
+                nanoseconds = (static_cast<uint64>(now.tv_sec) * 1000000000u) + static_cast<uint64>(now.tv_nsec);
+            }
+            ok = true;
+        }
+    }
+    if (ok) {
+        ClockCorrelationModel current;
+        if (ReadModel(current)) {
+            int64 predicted = static_cast<int64>(current.baseNanoseconds)
+                    + static_cast<int64>(static_cast<float64>(static_cast<int64>(ticks - current.baseTicks)) * current.nanosecondsPerTick);
+            int64 error = static_cast<int64>(nanoseconds) - predicted;
+            if (error < 0) {
+                error = -error;
+            }
+            if (static_cast<uint64>(error) > CLOCK_CORRELATION_STEP_THRESHOLD) {
+                numberOfSteps++;
+                numberOfSamples = 0u;
+                nextSample = 0u;
+            }
+        }
+        sampleTicks[nextSample] = ticks;
+        sampleNanoseconds[nextSample] = nanoseconds;
+        nextSample = ((nextSample + 1u) % CLOCK_CORRELATION_SAMPLES);
+        if (numberOfSamples < CLOCK_CORRELATION_SAMPLES) {
+            numberOfSamples++;
+        }
+        //Least squares fit relative to the newest sample, so that the differences are small enough for a float64
+        ClockCorrelationModel newModel;
+        newModel.baseTicks = ticks;
+        newModel.baseNanoseconds = nanoseconds;
+        newModel.nanosecondsPerTick = 1e9 / static_cast<float64>(HighResolutionTimer::Frequency());
+        if (numberOfSamples > 1u) {
+            float64 meanX = 0.0;
+            float64 meanY = 0.0;
+            for (uint32 s = 0u; s < numberOfSamples; s++) {
+                meanX += static_cast<float64>(static_cast<int64>(sampleTicks[s] - ticks));
+                meanY += static_cast<float64>(static_cast<int64>(sampleNanoseconds[s] - nanoseconds));
+            }
+            meanX /= static_cast<float64>(numberOfSamples);
+            meanY /= static_cast<float64>(numberOfSamples);
+            float64 sxx = 0.0;
+            float64 sxy = 0.0;
+            for (uint32 s = 0u; s < numberOfSamples; s++) {
+                float64 dx = static_cast<float64>(static_cast<int64>(sampleTicks[s] - ticks)) - meanX;
+                float64 dy = static_cast<float64>(static_cast<int64>(sampleNanoseconds[s] - nanoseconds)) - meanY;
+                sxx += dx * dx;
+                sxy += dx * dy;
+            }
+            if (sxx > 0.0) {
+                newModel.nanosecondsPerTick = sxy / sxx;
+                //The fitted line evaluated at the newest sample
+                float64 offset = meanY - (newModel.nanosecondsPerTick * meanX);
+                newModel.baseNanoseconds = static_cast<uint64>(static_cast<int64>(nanoseconds) + static_cast<int64>(offset));
+            }
+        }
+        PublishModel(newModel);
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "ClockCorrelation: could not read the reference clock.");
+    }
+    return ok;
+}
+
+uint64 CounterToUTC(const uint64 ticks) {
+    ClockCorrelationModel current;
+    uint64 utc = 0u;
+    if (ReadModel(current)) {
+        int64 elapsed = static_cast<int64>(static_cast<float64>(static_cast<int64>(ticks - current.baseTicks)) * current.nanosecondsPerTick);
+        utc = static_cast<uint64>(static_cast<int64>(current.baseNanoseconds) + elapsed);
+    }
+    return utc;
+}
+
+bool IsSynchronised() {
+    ClockCorrelationModel current;
+    return ReadModel(current);
+}
+
+float64 GetDrift() {
+    ClockCorrelationModel current;
+    float64 drift = 0.0;
+    if (ReadModel(current)) {
+        //The measured frequency is 1e9 / nanosecondsPerTick
+        drift = ((1e9 / (current.nanosecondsPerTick * static_cast<float64>(HighResolutionTimer::Frequency()))) - 1.0) * 1e6;
+    }
+    return drift;
+}
+
+uint32 GetNumberOfSteps() {
+    return numberOfSteps;
+}
+
+}
+
+}
@@ -84,6 +84,7 @@ struct BasicConsoleProperties;
 typedef int32 Handle;
 static const char8 DIRECTORY_SEPARATOR = '/';
 const uint32 SCHED_GRANULARITY_US = 10000;
+const uint32 SLEEP_SPIN_THRESHOLD_NS = 50000;
 
 }
 
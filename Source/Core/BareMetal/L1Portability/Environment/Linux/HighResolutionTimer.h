@@ -63,6 +63,14 @@ inline float64 TicksToTime(const uint64 tStop,
     return static_cast<float64>(dT) * Period();
 }
 
+inline uint64 TicksToNanoSeconds(const uint64 ticks) {
+    return calibratedHighResolutionTimer.TicksToNanoSeconds(ticks);
+}
+
+inline uint64 TicksToMicroSeconds(const uint64 ticks) {
+    return calibratedHighResolutionTimer.TicksToMicroSeconds(ticks);
+}
+
 inline bool GetTimeStamp(TimeStamp &date) {
     return calibratedHighResolutionTimer.GetTimeStamp(date);
 }
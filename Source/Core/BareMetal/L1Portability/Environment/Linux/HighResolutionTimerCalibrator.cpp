@@ -57,11 +57,58 @@ namespace MARTe {
 /*lint -e{9141} constant that can be reused by other classes*/
 HighResolutionTimerCalibrator calibratedHighResolutionTimer;
 
+/**
+ * Longest interval (in seconds) that is converted with the integer
+ * multiply-shift constants.
+ */
+static const uint64 HRT_MAX_CONVERSION_SECONDS = 600u;
+
+/**
+ * @brief Computes the constants such that (ticks * multiplier) >> shift
+ * converts ticks at \a frequencyIn in units at \a unitsPerSecond.
+ * @details The largest shift (i.e. the best precision) is selected for which
+ * the product does not overflow 64 bits for intervals up to
+ * HRT_MAX_CONVERSION_SECONDS.
+ * @param[in] frequencyIn the ticks frequency.
+ * @param[in] unitsPerSecond the number of target units in a second.
+ * @param[out] multiplier the computed multiplier.
+ * @param[out] shift the computed shift.
+ */
+static void ComputeTicksConversion(const uint64 frequencyIn,
+                                   const uint64 unitsPerSecond,
+                                   uint64 &multiplier, uint32 &shift) {
+  /* Number of bits that are left to the multiplier. */
+  uint32 multiplierBits = 32u;
+  uint64 tmp = (HRT_MAX_CONVERSION_SECONDS * frequencyIn) >> 32u;
+  while (tmp > 0u) {
+    tmp >>= 1u;
+    multiplierBits--;
+  }
+  multiplier = 0u;
+  shift = 32u;
+  while (shift > 0u) {
+    /* Round up so that exact multiples of the period are not truncated to the unit below. */
+    tmp = unitsPerSecond << shift;
+    tmp += frequencyIn - 1u;
+    tmp /= frequencyIn;
+    if ((tmp >> multiplierBits) == 0u) {
+      break;
+    }
+    shift--;
+  }
+  multiplier = tmp;
+}
+
 HighResolutionTimerCalibrator::HighResolutionTimerCalibrator() {
   const uint64 LINUX_CPUINFO_BUFFER_SIZE = 1023u;
   initialTicks = HighResolutionTimer::Counter();
   frequency = 0u;
   period = 0.;
+  nanoSecondsMultiplier = 0u;
+  nanoSecondsShift = 0u;
+  microSecondsMultiplier = 0u;
+  microSecondsShift = 0u;
+  maxConversionTicks = 0u;
 
   struct timeval initTime;
   int32 ret = gettimeofday(&initTime, static_cast<struct timezone *>(NULL));
@@ -72,6 +119,14 @@ HighResolutionTimerCalibrator::HighResolutionTimerCalibrator() {
   bool ok = false;
 
   if (ret == 0) {
+#if defined(__aarch64__) && !defined(_USE_HRT_PERF_MODULE)
+    /* The Counter() reads the generic timer, whose frequency is fixed and published by the CPU. */
+    frequency = HighResolutionTimer::GenericTimerFrequency();
+    ok = (frequency > 0u);
+    if (ok) {
+      period = 1.0 / static_cast<float64>(frequency);
+    }
+#else
     char8 *cpu_freq = getenv("CPU_FREQ");
     ok = (cpu_freq != NULL);
     if (ok) {
@@ -123,6 +178,7 @@ HighResolutionTimerCalibrator::HighResolutionTimerCalibrator() {
         }
       }
     }
+#endif
     if (!ok) {
       REPORT_ERROR_STATIC_0(
           ErrorManagement::OSError,
@@ -132,6 +188,13 @@ HighResolutionTimerCalibrator::HighResolutionTimerCalibrator() {
     REPORT_ERROR_STATIC_0(ErrorManagement::OSError,
                           "HighResolutionTimerCalibrator: gettimeofday()");
   }
+  if (frequency > 0u) {
+    ComputeTicksConversion(frequency, 1000000000u, nanoSecondsMultiplier,
+                           nanoSecondsShift);
+    ComputeTicksConversion(frequency, 1000000u, microSecondsMultiplier,
+                           microSecondsShift);
+    maxConversionTicks = HRT_MAX_CONVERSION_SECONDS * frequency;
+  }
 }
 
 bool HighResolutionTimerCalibrator::GetTimeStamp(TimeStamp &timeStamp) const {
@@ -52,6 +52,8 @@ public:
      * @details The period and frequency of the CPU clock are estimated upon
      * construction.
      * In the Linux implementation these values are read from the /proc/cpuinfo file.
+     * On AArch64 (unless _USE_HRT_PERF_MODULE is defined) the counter is the
+     * ARMv8 generic timer and the frequency is read from CNTFRQ_EL0.
      * The number of elapsed cpu ticks is also stored at this moment.
      */
     HighResolutionTimerCalibrator();
@@ -75,7 +77,23 @@ public:
      */
     float64 GetPeriod() const;
 
+    /**
+     * @brief Converts a number of ticks to nanoseconds.
+     * @details Uses the multiply-shift constants computed upon construction.
+     * Intervals longer than maxConversionTicks are converted in floating point.
+     * @param[in] ticks the number of ticks to convert.
+     * @return the number of nanoseconds corresponding to \a ticks.
+     */
+    inline uint64 TicksToNanoSeconds(const uint64 ticks) const;
 
+    /**
+     * @brief Converts a number of ticks to microseconds.
+     * @details Uses the multiply-shift constants computed upon construction.
+     * Intervals longer than maxConversionTicks are converted in floating point.
+     * @param[in] ticks the number of ticks to convert.
+     * @return the number of microseconds corresponding to \a ticks.
+     */
+    inline uint64 TicksToMicroSeconds(const uint64 ticks) const;
 
 private:
 
@@ -104,6 +122,31 @@ private:
      */
     uint64 initialTicks;
 
+    /**
+     * ticks to nanoseconds is (ticks * nanoSecondsMultiplier) >> nanoSecondsShift.
+     */
+    uint64 nanoSecondsMultiplier;
+
+    /**
+     * See nanoSecondsMultiplier.
+     */
+    uint32 nanoSecondsShift;
+
+    /**
+     * ticks to microseconds is (ticks * microSecondsMultiplier) >> microSecondsShift.
+     */
+    uint64 microSecondsMultiplier;
+
+    /**
+     * See microSecondsMultiplier.
+     */
+    uint32 microSecondsShift;
+
+    /**
+     * Maximum number of ticks that can be converted with the multipliers without overflowing 64 bits.
+     */
+    uint64 maxConversionTicks;
+
 };
 
 }
@@ -111,4 +154,30 @@ private:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+inline uint64 HighResolutionTimerCalibrator::TicksToNanoSeconds(const uint64 ticks) const {
+    uint64 ret;
+    if (ticks <= maxConversionTicks) {
+        ret = (ticks * nanoSecondsMultiplier) >> nanoSecondsShift;
+    }
+    else {
+        ret = static_cast<uint64>((static_cast<float64>(ticks) * period) * 1e9);
+    }
+    return ret;
+}
+
+inline uint64 HighResolutionTimerCalibrator::TicksToMicroSeconds(const uint64 ticks) const {
+    uint64 ret;
+    if (ticks <= maxConversionTicks) {
+        ret = (ticks * microSecondsMultiplier) >> microSecondsShift;
+    }
+    else {
+        ret = static_cast<uint64>((static_cast<float64>(ticks) * period) * 1e6);
+    }
+    return ret;
+}
+
+}
+
 #endif /* HIGHRESOLUTIONTIMERCALIBRATOROS_H_ */
@@ -0,0 +1,195 @@
+/**
+ * @file PerformanceCounters.cpp
+ * @brief Source file for module PerformanceCounters
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PerformanceCounters (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ErrorManagement.h"
+#include "PerformanceCounters.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+
+/**
+ * The counters group of a thread is not opened yet.
+ */
+const MARTe::int32 PERFORMANCE_COUNTERS_CLOSED = 0;
+
+/**
+ * The counters group of a thread is open.
+ */
+const MARTe::int32 PERFORMANCE_COUNTERS_OPEN = 1;
+
+/**
+ * The counters group of a thread could not be opened.
+ */
+const MARTe::int32 PERFORMANCE_COUNTERS_UNAVAILABLE = 2;
+
+/**
+ * The perf events of the counters, in the order of the PerformanceCounters indexes.
+ */
+const MARTe::uint64 performanceCountersEvents[] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES };
+
+/**
+ * The counters group of a thread.
+ */
+struct PerformanceCountersGroup {
+    /**
+     * One of the PERFORMANCE_COUNTERS_ constants.
+     */
+    MARTe::int32 status;
+
+    /**
+     * Number of counters opened in the group (the first one is the group leader).
+     */
+    MARTe::uint32 numberOfOpened;
+
+    /**
+     * The file descriptors of the opened counters.
+     */
+    MARTe::int32 fds[MARTe::PerformanceCounters::NUMBER_OF_COUNTERS];
+
+    /**
+     * The PerformanceCounters index of each opened counter.
+     */
+    MARTe::uint32 indexes[MARTe::PerformanceCounters::NUMBER_OF_COUNTERS];
+};
+
+/**
+ * The counters group of the calling thread (zero initialised, i.e. PERFORMANCE_COUNTERS_CLOSED).
+ */
+THREAD_LOCAL PerformanceCountersGroup performanceCountersGroup;
+
+/**
+ * @brief Opens one counter of the calling thread.
+ * @return the file descriptor of the counter or -1 if it could not be opened.
+ */
+MARTe::int32 OpenCounter(const MARTe::uint64 event,
+                         const MARTe::int32 groupFd) {
+    struct perf_event_attr attributes;
+    (void) memset(&attributes, 0, sizeof(attributes));
+    attributes.type = PERF_TYPE_HARDWARE;
+    attributes.size = static_cast<MARTe::uint32>(sizeof(attributes));
+    attributes.config = event;
+    attributes.read_format = PERF_FORMAT_GROUP;
+    attributes.exclude_kernel = 1u;
+    attributes.exclude_hv = 1u;
+    /*lint -e{970} -e{9130} the perf_event_open system call has no wrapper in the C library.*/
+    long fd = syscall(__NR_perf_event_open, &attributes, 0, -1, groupFd, 0ul);
+    return static_cast<MARTe::int32>(fd);
+}
+
+/**
+ * @brief Opens the counters group of the calling thread. The counters that the processor does not support are skipped.
+ */
+void OpenGroup() {
+    PerformanceCountersGroup &group = performanceCountersGroup;
+    group.numberOfOpened = 0u;
+    for (MARTe::uint32 c = 0u; c < MARTe::PerformanceCounters::NUMBER_OF_COUNTERS; c++) {
+        MARTe::int32 groupFd = -1;
+        if (group.numberOfOpened > 0u) {
+            groupFd = group.fds[0u];
+        }
+        MARTe::int32 fd = OpenCounter(performanceCountersEvents[c], groupFd);
+        if (fd >= 0) {
+            group.fds[group.numberOfOpened] = fd;
+            group.indexes[group.numberOfOpened] = c;
+            group.numberOfOpened++;
+        }
+    }
+    if (group.numberOfOpened > 0u) {
+        group.status = PERFORMANCE_COUNTERS_OPEN;
+    }
+    else {
+        group.status = PERFORMANCE_COUNTERS_UNAVAILABLE;
+        REPORT_ERROR_STATIC_0(MARTe::ErrorManagement::Warning,
+                              "PerformanceCounters: could not open the counters (check the processor support and /proc/sys/kernel/perf_event_paranoid).");
+    }
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace PerformanceCounters {
+
+bool Read(uint64 * const values) {
+    PerformanceCountersGroup &group = performanceCountersGroup;
+    if (group.status == PERFORMANCE_COUNTERS_CLOSED) {
+        OpenGroup();
+    }
+    bool ok = (group.status == PERFORMANCE_COUNTERS_OPEN);
+    if (ok) {
+        //PERF_FORMAT_GROUP: the number of counters followed by the values, in the order in which the counters were opened
+        uint64 buffer[NUMBER_OF_COUNTERS + 1u];
+        size_t size = static_cast<size_t>(sizeof(uint64)) * (group.numberOfOpened + 1u);
+        ok = (read(group.fds[0u], &buffer[0u], size) == static_cast<ssize_t>(size));
+        if (ok) {
+            for (uint32 c = 0u; c < NUMBER_OF_COUNTERS; c++) {
+                values[c] = 0u;
+            }
+            for (uint32 c = 0u; c < group.numberOfOpened; c++) {
+                values[group.indexes[c]] = buffer[c + 1u];
+            }
+        }
+    }
+    return ok;
+}
+
+void Close() {
+    PerformanceCountersGroup &group = performanceCountersGroup;
+    if (group.status == PERFORMANCE_COUNTERS_OPEN) {
+        //The group leader is closed last
+        uint32 c = group.numberOfOpened;
+        while (c > 0u) {
+            c--;
+            (void) close(group.fds[c]);
+        }
+    }
+    group.numberOfOpened = 0u;
+    group.status = PERFORMANCE_COUNTERS_CLOSED;
+}
+
+}
+
+}
@@ -0,0 +1,214 @@
+/**
+ * @file PinnedMemory.cpp
+ * @brief Source file for module PinnedMemory
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PinnedMemory (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ErrorManagement.h"
+#include "PinnedMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+
+/**
+ * Huge page size used if it cannot be read from /proc/meminfo.
+ */
+const MARTe::uint32 PINNED_MEMORY_DEFAULT_HUGE_PAGE_SIZE = 2097152u;
+
+/**
+ * @brief Reads the default huge page size from /proc/meminfo.
+ */
+MARTe::uint32 GetHugePageSize() {
+    MARTe::uint32 hugePageSize = PINNED_MEMORY_DEFAULT_HUGE_PAGE_SIZE;
+    FILE *meminfo = fopen("/proc/meminfo", "r");
+    if (meminfo != NULL) {
+        char line[128];
+        bool found = false;
+        while ((!found) && (fgets(&line[0], static_cast<int>(sizeof(line)), meminfo) != NULL)) {
+            unsigned long sizeKiB = 0u;
+            /*lint -e{960} -e{1960} sscanf is required to parse /proc/meminfo.*/
+            if (sscanf(&line[0], "Hugepagesize: %lu kB", &sizeKiB) == 1) {
+                hugePageSize = static_cast<MARTe::uint32>(sizeKiB * 1024u);
+                found = true;
+            }
+        }
+        (void) fclose(meminfo);
+    }
+    return hugePageSize;
+}
+
+/**
+ * @brief Rounds size up to a multiple of pageSize (a power of two).
+ */
+MARTe::uint32 RoundToPage(const MARTe::uint32 size,
+                          const MARTe::uint32 pageSize) {
+    return ((size + (pageSize - 1u)) & ~(pageSize - 1u));
+}
+
+/**
+ * MPOL_BIND from linux/mempolicy.h (the numaif.h of libnuma is not required).
+ */
+const int PINNED_MEMORY_MPOL_BIND = 2;
+
+/**
+ * @brief Binds the pages of a mapping to a NUMA node with the mbind system call.
+ */
+bool BindToNode(void * const address,
+                const MARTe::uint32 size,
+                const MARTe::int32 numaNode) {
+    bool ok = false;
+#ifdef SYS_mbind
+    const MARTe::uint32 bitsPerWord = static_cast<MARTe::uint32>(sizeof(unsigned long) * 8u);
+    unsigned long nodeMask[4] = { 0u, 0u, 0u, 0u };
+    MARTe::uint32 node = static_cast<MARTe::uint32>(numaNode);
+    if (node < (4u * bitsPerWord)) {
+        nodeMask[node / bitsPerWord] = (1ul << (node % bitsPerWord));
+        ok = (syscall(SYS_mbind, address, static_cast<unsigned long>(size), PINNED_MEMORY_MPOL_BIND, &nodeMask[0], static_cast<unsigned long>(4u * bitsPerWord), 0u) == 0);
+    }
+#endif
+    return ok;
+}
+
+}
+
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+namespace PinnedMemory {
+
+void *Allocate(const uint32 size,
+               const bool hugePages,
+               const bool lock,
+               uint32 &mappedSize) {
+    return Allocate(size, hugePages, lock, -1, mappedSize);
+}
+
+void *Allocate(const uint32 size,
+               const bool hugePages,
+               const bool lock,
+               const int32 numaNode,
+               uint32 &mappedSize) {
+    void *address = MAP_FAILED;
+    mappedSize = 0u;
+    if (size > 0u) {
+        if (hugePages) {
+            uint32 hugeSize = RoundToPage(size, GetHugePageSize());
+            address = mmap(NULL, static_cast<size_t>(hugeSize), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (address != MAP_FAILED) {
+                mappedSize = hugeSize;
+            }
+            else {
+                REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "PinnedMemory: could not map the block with huge pages. Using normal pages.");
+            }
+        }
+        if (address == MAP_FAILED) {
+            uint32 normalSize = RoundToPage(size, static_cast<uint32>(sysconf(_SC_PAGESIZE)));
+            address = mmap(NULL, static_cast<size_t>(normalSize), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (address != MAP_FAILED) {
+                mappedSize = normalSize;
+            }
+            else {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PinnedMemory: could not map the block.");
+            }
+        }
+        //The policy only applies to the pages faulted afterwards, i.e. it has to be set before mlock
+        if ((address != MAP_FAILED) && (numaNode >= 0)) {
+            if (!BindToNode(address, mappedSize, numaNode)) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "PinnedMemory: could not bind the block to the NUMA node.");
+            }
+        }
+        if ((address != MAP_FAILED) && (lock)) {
+            if (mlock(address, static_cast<size_t>(mappedSize)) != 0) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "PinnedMemory: could not lock the block in memory (check RLIMIT_MEMLOCK).");
+            }
+        }
+    }
+    return (address != MAP_FAILED) ? (address) : (NULL_PTR(void *));
+}
+
+bool Free(void *&address,
+          const uint32 mappedSize) {
+    bool ok = true;
+    if (address != NULL_PTR(void *)) {
+        //munmap also unlocks the pages
+        ok = (munmap(address, static_cast<size_t>(mappedSize)) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PinnedMemory: could not unmap the block.");
+        }
+        address = NULL_PTR(void *);
+    }
+    return ok;
+}
+
+int32 NodeOfCPU(const uint32 cpu) {
+    int32 node = -1;
+    char8 path[64];
+    (void) snprintf(&path[0], sizeof(path), "/sys/devices/system/cpu/cpu%u", cpu);
+    //The CPU directory has a nodeN link for the node of the CPU
+    DIR *cpuDir = opendir(&path[0]);
+    if (cpuDir != NULL) {
+        struct dirent *entry = readdir(cpuDir);
+        while ((entry != NULL) && (node < 0)) {
+            const char8 * const entryName = &entry->d_name[0];
+            if ((strncmp(entryName, "node", 4u) == 0) && (entryName[4] >= '0') && (entryName[4] <= '9')) {
+                node = static_cast<int32>(strtol(&entryName[4], NULL_PTR(char8 **), 10));
+            }
+            entry = readdir(cpuDir);
+        }
+        (void) closedir(cpuDir);
+    }
+    return node;
+}
+
+bool LockAll() {
+    bool ok = (mlockall(MCL_CURRENT | MCL_FUTURE) == 0);
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PinnedMemory: mlockall(MCL_CURRENT | MCL_FUTURE) failed (check the permissions and RLIMIT_MEMLOCK).");
+    }
+    return ok;
+}
+
+}
+
+}
@@ -0,0 +1,213 @@
+/**
+ * @file PowerManagement.cpp
+ * @brief Source file for module PowerManagement
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PowerManagement (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ErrorManagement.h"
+#include "PowerManagement.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+
+/**
+ * The maximum length of a cpufreq governor name.
+ */
+const MARTe::uint32 POWER_MANAGEMENT_GOVERNOR_SIZE = 32u;
+
+/**
+ * @brief The frequency scaling of a CPU before it was changed.
+ */
+struct SavedCPUFrequency {
+    MARTe::uint32 cpu;
+    MARTe::char8 governor[POWER_MANAGEMENT_GOVERNOR_SIZE];
+    MARTe::char8 minFrequency[POWER_MANAGEMENT_GOVERNOR_SIZE];
+};
+
+/**
+ * The file descriptor of /dev/cpu_dma_latency (-1 if no limit is set).
+ */
+int wakeUpLatencyFile = -1;
+
+/**
+ * The CPUs changed by SetCPUFrequency.
+ */
+SavedCPUFrequency savedCPUFrequencies[MARTe::POWER_MANAGEMENT_MAX_CPUS];
+
+/**
+ * The number of savedCPUFrequencies.
+ */
+MARTe::uint32 numberOfSavedCPUFrequencies = 0u;
+
+/**
+ * @brief Reads the first line of a cpufreq file of a CPU (without the trailing new line).
+ */
+bool ReadCPUFrequencyFile(const MARTe::uint32 cpu,
+                          const MARTe::char8 * const name,
+                          MARTe::char8 * const line,
+                          const MARTe::uint32 lineSize) {
+    MARTe::char8 path[128];
+    (void) snprintf(&path[0], sizeof(path), "/sys/devices/system/cpu/cpu%u/cpufreq/%s", cpu, name);
+    bool ok = false;
+    FILE *cpufreqFile = fopen(&path[0], "r");
+    if (cpufreqFile != NULL) {
+        ok = (fgets(line, static_cast<int>(lineSize), cpufreqFile) != NULL);
+        (void) fclose(cpufreqFile);
+    }
+    if (ok) {
+        MARTe::char8 *newLine = strchr(line, '\n');
+        if (newLine != NULL) {
+            *newLine = '\0';
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Writes a value to a cpufreq file of a CPU.
+ */
+bool WriteCPUFrequencyFile(const MARTe::uint32 cpu,
+                           const MARTe::char8 * const name,
+                           const MARTe::char8 * const value) {
+    MARTe::char8 path[128];
+    (void) snprintf(&path[0], sizeof(path), "/sys/devices/system/cpu/cpu%u/cpufreq/%s", cpu, name);
+    bool ok = false;
+    FILE *cpufreqFile = fopen(&path[0], "w");
+    if (cpufreqFile != NULL) {
+        ok = (fputs(value, cpufreqFile) >= 0);
+        //The value is only validated by the kernel when it is flushed
+        ok = (fclose(cpufreqFile) == 0) && (ok);
+    }
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace PowerManagement {
+
+bool SetWakeUpLatency(const uint32 latency) {
+    if (wakeUpLatencyFile < 0) {
+        wakeUpLatencyFile = open("/dev/cpu_dma_latency", O_WRONLY);
+    }
+    bool ok = (wakeUpLatencyFile >= 0);
+    if (ok) {
+        //The PM QoS request is a binary int32
+        int32 request = static_cast<int32>(latency);
+        ok = (write(wakeUpLatencyFile, &request, sizeof(request)) == static_cast<ssize_t>(sizeof(request)));
+        if (!ok) {
+            ReleaseWakeUpLatency();
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PowerManagement: could not write to /dev/cpu_dma_latency (check the permissions).");
+    }
+    return ok;
+}
+
+void ReleaseWakeUpLatency() {
+    if (wakeUpLatencyFile >= 0) {
+        (void) close(wakeUpLatencyFile);
+        wakeUpLatencyFile = -1;
+    }
+}
+
+bool SetCPUFrequency(const uint32 cpu,
+                     const char8 * const governor,
+                     const uint32 minFrequency) {
+    bool saved = false;
+    for (uint32 i = 0u; (i < numberOfSavedCPUFrequencies) && (!saved); i++) {
+        saved = (savedCPUFrequencies[i].cpu == cpu);
+    }
+    bool ok = true;
+    if (!saved) {
+        ok = (numberOfSavedCPUFrequencies < POWER_MANAGEMENT_MAX_CPUS);
+        if (ok) {
+            SavedCPUFrequency &entry = savedCPUFrequencies[numberOfSavedCPUFrequencies];
+            entry.cpu = cpu;
+            ok = ReadCPUFrequencyFile(cpu, "scaling_governor", &entry.governor[0], POWER_MANAGEMENT_GOVERNOR_SIZE);
+            if (ok) {
+                ok = ReadCPUFrequencyFile(cpu, "scaling_min_freq", &entry.minFrequency[0], POWER_MANAGEMENT_GOVERNOR_SIZE);
+            }
+            if (ok) {
+                numberOfSavedCPUFrequencies++;
+            }
+        }
+    }
+    if (ok) {
+        if (governor != NULL_PTR(const char8 *)) {
+            if (governor[0] != '\0') {
+                ok = WriteCPUFrequencyFile(cpu, "scaling_governor", governor);
+            }
+        }
+    }
+    if ((ok) && (minFrequency > 0u)) {
+        char8 value[16];
+        (void) snprintf(&value[0], sizeof(value), "%u", minFrequency);
+        ok = WriteCPUFrequencyFile(cpu, "scaling_min_freq", &value[0]);
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PowerManagement: could not set the cpufreq policy of a CPU (check the permissions and that the kernel has cpufreq).");
+    }
+    return ok;
+}
+
+bool RestoreCPUFrequencies() {
+    bool ok = true;
+    for (uint32 i = 0u; i < numberOfSavedCPUFrequencies; i++) {
+        const SavedCPUFrequency &entry = savedCPUFrequencies[i];
+        //The governor first, given that it may reset the frequency limits
+        bool restored = WriteCPUFrequencyFile(entry.cpu, "scaling_governor", &entry.governor[0]);
+        restored = (WriteCPUFrequencyFile(entry.cpu, "scaling_min_freq", &entry.minFrequency[0])) && (restored);
+        ok = (restored) && (ok);
+    }
+    numberOfSavedCPUFrequencies = 0u;
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PowerManagement: could not restore the cpufreq policy of all the CPUs.");
+    }
+    return ok;
+}
+
+}
+
+}
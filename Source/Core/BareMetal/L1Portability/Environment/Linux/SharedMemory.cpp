@@ -0,0 +1,187 @@
+/**
+ * @file SharedMemory.cpp
+ * @brief Source file for module SharedMemory
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module SharedMemory (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ErrorManagement.h"
+#include "SharedMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+
+/**
+ * @brief Checks if the name is a shared memory object name (i.e. "/name") rather than a file path.
+ */
+bool IsSharedMemoryObject(const MARTe::char8 * const name) {
+    return ((name[0] == '/') && (strchr(&name[1], static_cast<int>('/')) == NULL));
+}
+
+/**
+ * @brief Opens the shared memory object or the file with the given name.
+ */
+int OpenSegment(const MARTe::char8 * const name,
+                const int flags) {
+    int fd;
+    if (IsSharedMemoryObject(name)) {
+        fd = shm_open(name, flags, static_cast<mode_t>(0666));
+    }
+    else {
+        fd = open(name, flags, static_cast<mode_t>(0666));
+    }
+    return fd;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+namespace SharedMemory {
+
+void *Create(const char8 * const name,
+             const uint32 size,
+             const bool lock,
+             uint32 &mappedSize) {
+    void *address = MAP_FAILED;
+    mappedSize = 0u;
+    if ((name != NULL_PTR(const char8 *)) && (size > 0u)) {
+        //A new segment, so that the processes which still map the old one are not corrupted
+        (void) Remove(name);
+        int fd = OpenSegment(name, O_RDWR | O_CREAT | O_EXCL);
+        if (fd >= 0) {
+            //The block size of a hugetlbfs file is the huge page size
+            struct stat info;
+            uint32 pageSize = static_cast<uint32>(sysconf(_SC_PAGESIZE));
+            if (fstat(fd, &info) == 0) {
+                if (static_cast<uint32>(info.st_blksize) > pageSize) {
+                    pageSize = static_cast<uint32>(info.st_blksize);
+                }
+            }
+            uint32 segmentSize = ((size + (pageSize - 1u)) / pageSize) * pageSize;
+            if (ftruncate(fd, static_cast<off_t>(segmentSize)) == 0) {
+                //The new pages are zero initialised
+                address = mmap(NULL, static_cast<size_t>(segmentSize), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            }
+            if (address != MAP_FAILED) {
+                mappedSize = segmentSize;
+            }
+            else {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "SharedMemory: could not size or map the segment.");
+                (void) Remove(name);
+            }
+            (void) close(fd);
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "SharedMemory: could not create the segment.");
+        }
+        if ((address != MAP_FAILED) && (lock)) {
+            if (mlock(address, static_cast<size_t>(mappedSize)) != 0) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "SharedMemory: could not lock the segment in memory (check RLIMIT_MEMLOCK).");
+            }
+        }
+    }
+    return (address != MAP_FAILED) ? (address) : (NULL_PTR(void *));
+}
+
+void *Open(const char8 * const name,
+           const bool readOnly,
+           uint32 &mappedSize) {
+    void *address = MAP_FAILED;
+    mappedSize = 0u;
+    if (name != NULL_PTR(const char8 *)) {
+        int fd = OpenSegment(name, readOnly ? O_RDONLY : O_RDWR);
+        if (fd >= 0) {
+            struct stat info;
+            if (fstat(fd, &info) == 0) {
+                //Empty if the creator did not size it yet
+                if (info.st_size > 0) {
+                    int protection = readOnly ? PROT_READ : (PROT_READ | PROT_WRITE);
+                    address = mmap(NULL, static_cast<size_t>(info.st_size), protection, MAP_SHARED, fd, 0);
+                    if (address != MAP_FAILED) {
+                        mappedSize = static_cast<uint32>(info.st_size);
+                    }
+                    else {
+                        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "SharedMemory: could not map the segment.");
+                    }
+                }
+            }
+            (void) close(fd);
+        }
+    }
+    return (address != MAP_FAILED) ? (address) : (NULL_PTR(void *));
+}
+
+bool Close(void *&address,
+           const uint32 mappedSize) {
+    bool ok = true;
+    if (address != NULL_PTR(void *)) {
+        ok = (munmap(address, static_cast<size_t>(mappedSize)) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "SharedMemory: could not unmap the segment.");
+        }
+        address = NULL_PTR(void *);
+    }
+    return ok;
+}
+
+bool Remove(const char8 * const name) {
+    bool ok = (name != NULL_PTR(const char8 *));
+    if (ok) {
+        int err;
+        if (IsSharedMemoryObject(name)) {
+            err = shm_unlink(name);
+        }
+        else {
+            err = unlink(name);
+        }
+        ok = ((err == 0) || (errno == ENOENT));
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "SharedMemory: could not remove the segment.");
+        }
+    }
+    return ok;
+}
+
+}
+
+}
@@ -30,6 +30,8 @@
 #include <math.h>
 #include <errno.h>
 #include <unistd.h>
+#include <time.h>
+#include <sys/prctl.h>
 #else
 #include "lint-linux.h"
 #endif
@@ -71,6 +73,62 @@ void Sleep::OsUsleep(const uint32 usecTime) {
 
 }
 
+void Sleep::OsNanoSleep(const uint64 nsecTime) {
+    if (nsecTime > 0u) {
+        struct timespec tspec;
+        tspec.tv_sec = static_cast<time_t>(nsecTime / 1000000000LLU);
+        tspec.tv_nsec = static_cast<long>(nsecTime % 1000000000LLU);
+
+        struct timespec rem;
+        while (nanosleep(&tspec, &rem) == -1) {
+            if (errno == EINTR) {
+                tspec = rem;
+            }
+            else {
+                break;
+            }
+        }
+    }
+}
+
+bool Sleep::SetTimerSlack(const uint32 slack) {
+    bool ret = (prctl(PR_SET_TIMERSLACK, static_cast<unsigned long>(slack), 0UL, 0UL, 0UL) == 0);
+    if (!ret) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Sleep: Failed prctl(PR_SET_TIMERSLACK)");
+    }
+    return ret;
+}
+
+uint32 Sleep::GetTimerSlack() {
+    int32 slack = prctl(PR_GET_TIMERSLACK, 0UL, 0UL, 0UL, 0UL);
+    if (slack < 0) {
+        slack = 0;
+    }
+    return static_cast<uint32>(slack);
+}
+
+uint64 Sleep::GetMonotonicNanoSeconds() {
+    struct timespec now;
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+    return (static_cast<uint64>(now.tv_sec) * 1000000000LLU) + static_cast<uint64>(now.tv_nsec);
+}
+
+void Sleep::UntilMonotonicNanoSeconds(const uint64 deadline,
+                                      const uint32 busyTailUsec) {
+    uint64 busyTail = static_cast<uint64>(busyTailUsec) * 1000LLU;
+    if (deadline > busyTail) {
+        uint64 wakeUp = deadline - busyTail;
+        struct timespec tspec;
+        tspec.tv_sec = static_cast<time_t>(wakeUp / 1000000000LLU);
+        tspec.tv_nsec = static_cast<long>(wakeUp % 1000000000LLU);
+        //The absolute deadline does not change, so it is safe to restart the sleep if interrupted by a signal
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &tspec, static_cast<struct timespec *>(NULL)) == EINTR) {
+        }
+    }
+    while (GetMonotonicNanoSeconds() < deadline) {
+    }
+}
+
 int32 Sleep::GetDateSeconds() {
     return static_cast<int32>(time(static_cast<time_t *>(NULL)));
 }
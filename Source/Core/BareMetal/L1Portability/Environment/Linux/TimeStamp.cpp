@@ -54,20 +54,20 @@ TimeStamp::TimeStamp() {
 
 bool TimeStamp::ConvertFromEpoch(const oslong secondsFromEpoch) {
 
-    //fill the time structure
-    const struct tm *tValues = localtime(&secondsFromEpoch);
-    bool ret = (tValues != NULL);
+    //fill the time structure (localtime_r, as this may be called by more than one thread)
+    struct tm tValues;
+    bool ret = (localtime_r(&secondsFromEpoch, &tValues) != NULL);
     if (ret) {
-        seconds = static_cast<uint32>(tValues->tm_sec);
-        minutes = static_cast<uint32>(tValues->tm_min);
-        hours = static_cast<uint32>(tValues->tm_hour);
-        days = static_cast<uint32>(tValues->tm_mday) - 1u;
-        month = static_cast<uint32>(tValues->tm_mon);
-        year = static_cast<uint32>(tValues->tm_year) + 1900u;
+        seconds = static_cast<uint32>(tValues.tm_sec);
+        minutes = static_cast<uint32>(tValues.tm_min);
+        hours = static_cast<uint32>(tValues.tm_hour);
+        days = static_cast<uint32>(tValues.tm_mday) - 1u;
+        month = static_cast<uint32>(tValues.tm_mon);
+        year = static_cast<uint32>(tValues.tm_year) + 1900u;
     }
 
     else {
-        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: localtime()");
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: localtime_r()");
     }
     return ret;
 }
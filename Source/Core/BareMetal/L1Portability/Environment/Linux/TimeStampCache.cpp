@@ -0,0 +1,154 @@
+/**
+ * @file TimeStampCache.cpp
+ * @brief Source file for class TimeStampCache
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class TimeStampCache (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <time.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "TimeStampCache.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Writes the \a numberOfDigits least significant decimal digits of \a value.
+ */
+static void WriteDigits(char8 * const destination,
+                        uint32 value,
+                        const uint32 numberOfDigits) {
+    uint32 i;
+    for (i = numberOfDigits; i > 0u; i--) {
+        destination[i - 1u] = static_cast<char8>('0' + static_cast<char8>(value % 10u));
+        value /= 10u;
+    }
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+TimeStampCache::TimeStampCache() {
+    minuteStart = 0;
+    valid = false;
+    //YYYY-MM-DDThh:mm:ss+hh:mm
+    iso8601[0] = '\0';
+    iso8601[4] = '-';
+    iso8601[7] = '-';
+    iso8601[10] = 'T';
+    iso8601[13] = ':';
+    iso8601[16] = ':';
+    iso8601[22] = ':';
+    iso8601[TIME_STAMP_CACHE_ISO8601_SIZE] = '\0';
+}
+
+TimeStampCache::~TimeStampCache() {
+}
+
+bool TimeStampCache::Update(const oslong secondsFromEpoch) {
+    bool ok = valid;
+    if (ok) {
+        ok = (secondsFromEpoch >= minuteStart) && ((secondsFromEpoch - minuteStart) < 60);
+    }
+    if (ok) {
+        //Same minute: only the seconds change
+        uint32 seconds = static_cast<uint32>(secondsFromEpoch - minuteStart);
+        cached.SetSeconds(seconds);
+        WriteDigits(&iso8601[17], seconds, 2u);
+    }
+    else {
+        struct tm tValues;
+        time_t t = static_cast<time_t>(secondsFromEpoch);
+        ok = (localtime_r(&t, &tValues) != NULL);
+        if (ok) {
+            uint32 seconds = static_cast<uint32>(tValues.tm_sec);
+            //The leap seconds (tm_sec = 60) are never cached
+            valid = (seconds < 60u);
+            minuteStart = secondsFromEpoch - static_cast<oslong>(seconds);
+            cached.SetSeconds(seconds);
+            cached.SetMinutes(static_cast<uint32>(tValues.tm_min));
+            cached.SetHour(static_cast<uint32>(tValues.tm_hour));
+            cached.SetDay(static_cast<uint32>(tValues.tm_mday) - 1u);
+            cached.SetMonth(static_cast<uint32>(tValues.tm_mon));
+            cached.SetYear(static_cast<uint32>(tValues.tm_year) + 1900u);
+            WriteDigits(&iso8601[0], static_cast<uint32>(tValues.tm_year) + 1900u, 4u);
+            WriteDigits(&iso8601[5], static_cast<uint32>(tValues.tm_mon) + 1u, 2u);
+            WriteDigits(&iso8601[8], static_cast<uint32>(tValues.tm_mday), 2u);
+            WriteDigits(&iso8601[11], static_cast<uint32>(tValues.tm_hour), 2u);
+            WriteDigits(&iso8601[14], static_cast<uint32>(tValues.tm_min), 2u);
+            WriteDigits(&iso8601[17], seconds, 2u);
+            int32 offsetMinutes = static_cast<int32>(tValues.tm_gmtoff / 60);
+            if (offsetMinutes < 0) {
+                iso8601[19] = '-';
+                offsetMinutes = -offsetMinutes;
+            }
+            else {
+                iso8601[19] = '+';
+            }
+            WriteDigits(&iso8601[20], static_cast<uint32>(offsetMinutes) / 60u, 2u);
+            WriteDigits(&iso8601[23], static_cast<uint32>(offsetMinutes) % 60u, 2u);
+        }
+        else {
+            valid = false;
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: localtime_r()");
+        }
+    }
+    return ok;
+}
+
+bool TimeStampCache::Convert(const oslong secondsFromEpoch,
+                             TimeStamp &timeStamp) {
+    bool ok = Update(secondsFromEpoch);
+    if (ok) {
+        timeStamp.SetSeconds(cached.GetSeconds());
+        timeStamp.SetMinutes(cached.GetMinutes());
+        timeStamp.SetHour(cached.GetHour());
+        timeStamp.SetDay(cached.GetDay());
+        timeStamp.SetMonth(cached.GetMonth());
+        timeStamp.SetYear(cached.GetYear());
+    }
+    return ok;
+}
+
+const char8 *TimeStampCache::GetISO8601(const oslong secondsFromEpoch) {
+    const char8 *ret = NULL_PTR(const char8 *);
+    if (Update(secondsFromEpoch)) {
+        ret = &iso8601[0];
+    }
+    return ret;
+}
+
+}
@@ -0,0 +1,97 @@
+/**
+ * @file TraceMarkers.cpp
+ * @brief Source file for the environment specific functions of module Trace
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class Trace (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Trace.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+
+/**
+ * Locations of the trace_marker (tracefs mount point and legacy debugfs location).
+ */
+const char * const traceMarkerPaths[] = { "/sys/kernel/tracing/trace_marker", "/sys/kernel/debug/tracing/trace_marker" };
+
+/**
+ * Number of elements in traceMarkerPaths.
+ */
+const MARTe::uint32 TRACE_NUMBER_OF_MARKER_PATHS = 2u;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace Trace {
+
+uint32 GetThreadId() {
+    /*lint -e{970} -e{9130} gettid has no wrapper in older C libraries.*/
+    long tid = syscall(SYS_gettid);
+    return static_cast<uint32>(tid);
+}
+
+uint32 GetProcessId() {
+    return static_cast<uint32>(getpid());
+}
+
+int32 OpenKernelMarkers() {
+    int32 handle = -1;
+    for (uint32 p = 0u; (p < TRACE_NUMBER_OF_MARKER_PATHS) && (handle < 0); p++) {
+        handle = open(traceMarkerPaths[p], O_WRONLY | O_CLOEXEC);
+    }
+    return handle;
+}
+
+void CloseKernelMarkers(const int32 handle) {
+    (void) close(handle);
+}
+
+void WriteKernelMarker(const int32 handle,
+                       const char8 * const text,
+                       const uint32 size) {
+    //A failed write only loses the marker
+    (void) write(handle, text, static_cast<size_t>(size));
+}
+
+}
+
+}
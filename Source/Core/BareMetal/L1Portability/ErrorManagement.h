@@ -34,6 +34,7 @@
 
 #include "ErrorInformation.h"
 #include "GeneralDefinitions.h"
+#include "ReportRateLimiter.h"
 #include "StreamI.h"
 
 
@@ -71,6 +72,14 @@ DLL_API void NullErrorProcessFunction(const ErrorInformation &errorInfo,
  */
 DLL_API void ErrorCodeToStream (const ErrorType &errorCode,StreamI &stream );
 
+/**
+ * @brief Converts the name of an error (as written by ErrorCodeToStream, e.g. Warning) to the ErrorType.
+ * @param[in] name the name of the error.
+ * @param[out] errorCode the error code.
+ * @return true if name is a valid error name.
+ */
+DLL_API bool ErrorNameToCode(const char8 * const name, ErrorType &errorCode);
+
 /**
  * @brief Stores the error informations in an ErrorInformation structure, then calls a predefined routine.
  * @details The thread identifier is stored in the ErrorInformation structure only if interrupts are disabled, because
@@ -114,15 +123,51 @@ const char8 * const functionName = static_cast<const char8 *>(NULL));
  */
 DLL_API void SetErrorProcessFunction(const ErrorProcessFunctionType userFun);
 
+/**
+ * @brief The error types which are reported (see SetReportMask).
+ */
+extern DLL_API ErrorIntegerFormat reportMask;
+
+/**
+ * @brief Sets the error types which are reported.
+ * @details The REPORT_ERROR macros check the mask at the call site (see IsReportEnabled), so that a discarded
+ * report costs one branch: the message is not formatted, the ErrorInformation is not filled and the rate limiter
+ * is not consulted. The reports of the classes can be further filtered (see ClassRegistryItem::SetReportMask).
+ * @param[in] mask the error types to be reported (all by default).
+ */
+DLL_API void SetReportMask(const ErrorType &mask);
+
+/**
+ * @brief Gets the error types which are reported.
+ * @return the mask set with SetReportMask.
+ */
+DLL_API ErrorType GetReportMask();
+
+/**
+ * @brief Checks if the reports with a given code are enabled by the report mask.
+ * @param[in] code the error code of the report.
+ * @return true if at least one of the bits of \a code is in the report mask or if \a code is NoError.
+ */
+inline bool IsReportEnabled(const ErrorType &code);
+
 }
 
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace ErrorManagement {
+
+inline bool IsReportEnabled(const ErrorType &code) {
+    return ((code.format_as_integer & reportMask) != 0u) || (code.format_as_integer == 0u);
+}
+
+}
+
 /**
  * @brief The function to call in case of errors and without allowing to pass parameters.
  * @details Calls ErrorManagement::ReportError with the file name, the function and the line number of the error as inputs.
+ * The reports of each call site are filtered (see ErrorManagement::SetReportMask) and rate limited (see ErrorManagement::SetReportRateLimit).
  * @param[in] code is the ErrorType code error.
  * @param[in] message is the description associated to the error.
  */
@@ -130,7 +175,19 @@ DLL_API void SetErrorProcessFunction(const ErrorProcessFunctionType userFun);
  * 9026: function-like macro defined.
  */
 #define REPORT_ERROR_STATIC_0(code,message)\
-MARTe::ErrorManagement::ReportError(code, message, NULL_PTR(const MARTe::char8* ), NULL_PTR(const MARTe::char8* ), NULL_PTR(const void* ), __FILE__,__LINE__,__ERROR_FUNCTION_NAME__)
+/*lint -save -e717 Let lint know that we know that we are doing while(0)*/\
+do {\
+    if (MARTe::ErrorManagement::IsReportEnabled(code)) {\
+        static MARTe::ErrorManagement::ReportRateLimiter reportRateLimiter;\
+        MARTe::uint32 reportSuppressed;\
+        if (reportRateLimiter.Allow(code, reportSuppressed)) {\
+            MARTe::ErrorManagement::ReportError(code, message, NULL_PTR(const MARTe::char8* ), NULL_PTR(const MARTe::char8* ), NULL_PTR(const void* ), __FILE__,__LINE__,__ERROR_FUNCTION_NAME__);\
+            if (reportSuppressed > 0u) {\
+                MARTe::ErrorManagement::ReportSuppressed(code, reportSuppressed, NULL_PTR(const MARTe::char8* ), NULL_PTR(const MARTe::char8* ), NULL_PTR(const void* ), __FILE__,__LINE__,__ERROR_FUNCTION_NAME__);\
+            }\
+        }\
+    }\
+} while(false) /*lint -restore */ //Protect scope with the {} and force to end with ;
 /**
  * @brief The function to call in case of errors.
  * @details Calls ErrorManagement::ReportErrorFullContext with the file name, the function and the line number of the error as inputs.
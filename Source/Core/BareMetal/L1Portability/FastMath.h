@@ -135,6 +135,42 @@ namespace MARTe {
         /*lint -e(762) This declaration is redundant. */
         inline float32 Sin(const float32 angle);
 
+        /**
+         * @brief Converts an array of floats to integers (round to nearest).
+         * @details Uses the architecture vector unit when available.
+         * @param[in] input the values to convert.
+         * @param[out] output the converted values (at least numberOfElements long).
+         * @param[in] numberOfElements the number of elements to convert.
+         */
+        /*lint -e(762) This declaration is redundant. */
+        inline void FloatToInt(const float32 * const input,
+                               int32 * const output,
+                               const uint32 numberOfElements);
+
+        /**
+         * @brief Computes the cosine of an array of angles.
+         * @details Uses the architecture vector unit when available.
+         * @param[in] input the angles to compute.
+         * @param[out] output the cosines (at least numberOfElements long).
+         * @param[in] numberOfElements the number of elements to compute.
+         */
+        /*lint -e(762) This declaration is redundant. */
+        inline void Cos(const float32 * const input,
+                        float32 * const output,
+                        const uint32 numberOfElements);
+
+        /**
+         * @brief Computes the sine of an array of angles.
+         * @details Uses the architecture vector unit when available.
+         * @param[in] input the angles to compute.
+         * @param[out] output the sines (at least numberOfElements long).
+         * @param[in] numberOfElements the number of elements to compute.
+         */
+        /*lint -e(762) This declaration is redundant. */
+        inline void Sin(const float32 * const input,
+                        float32 * const output,
+                        const uint32 numberOfElements);
+
         /**
          * @brief Generic template implementation to compute square root of number.
          * @details If applied to a negative signed integer, the function typecasts
@@ -80,7 +80,8 @@ ErrorManagement::ErrorType FastPollingEventSem::FastWait(const TimeoutType &time
             }
         }
         if (!noSleep) {
-            Sleep::Sec(sleepTime);
+            //Short sleeps are busy waited so that they are not delayed by the operating system timer slack
+            Sleep::Hybrid(static_cast<uint64>((sleepTime * 1e9) + 0.5), Sleep::GetSpinThreshold());
         }
     }
 
@@ -43,19 +43,33 @@
 
 namespace MARTe {
 
+/**
+ * Increment of the next ticket (upper 16 bits) of a ticket lock.
+ */
+static const int32 FAST_POLLING_MUTEX_TICKET_INCREMENT = 0x10000;
+
+/**
+ * Mask of the ticket being served (lower 16 bits) of a ticket lock.
+ */
+static const uint32 FAST_POLLING_MUTEX_TICKET_MASK = 0xFFFFu;
+
 FastPollingMutexSem::FastPollingMutexSem() {
     internalFlag = 0;
     flag = &internalFlag;
+    ticketMode = false;
 }
 
 FastPollingMutexSem::FastPollingMutexSem(volatile int32 &externalFlag) {
     internalFlag = 0;
     flag = &externalFlag;
+    ticketMode = false;
 }
 
-void FastPollingMutexSem::Create(const bool locked) {
+void FastPollingMutexSem::Create(const bool locked,
+                                 const bool fifo) {
+    ticketMode = fifo;
     if (locked) {
-        *flag = 1;
+        *flag = (ticketMode) ? (FAST_POLLING_MUTEX_TICKET_INCREMENT) : (1);
     }
     else {
         *flag = 0;
@@ -63,44 +77,101 @@ void FastPollingMutexSem::Create(const bool locked) {
 }
 
 bool FastPollingMutexSem::Locked() const {
-    return *flag == 1;
+    bool ret;
+    if (ticketMode) {
+        uint32 value = static_cast<uint32>(Atomic::Load(flag, Atomic::MemoryOrderRelaxed));
+        ret = ((value & FAST_POLLING_MUTEX_TICKET_MASK) != ((value >> 16u) & FAST_POLLING_MUTEX_TICKET_MASK));
+    }
+    else {
+        ret = (*flag == 1);
+    }
+    return ret;
+}
+
+void FastPollingMutexSem::WaitStep(const int32 value,
+                                   const float32 sleepTime) const {
+    if (IsEqual(sleepTime, 0.0F)) {
+        Atomic::WaitWhileEqual(flag, value);
+    }
+    else {
+        //Short sleeps are busy waited so that they are not delayed by the operating system timer slack
+        Sleep::Hybrid(static_cast<uint64>((sleepTime * 1e9) + 0.5), Sleep::GetSpinThreshold());
+    }
 }
 
 ErrorManagement::ErrorType FastPollingMutexSem::FastLock(const TimeoutType &timeout,
-                                                         float32 sleepTime ) {
-    uint64 ticksStop = timeout.HighResolutionTimerTicks();
-    ticksStop += HighResolutionTimer::Counter();
+                                                         float32 sleepTime) {
+    //The deadline is only computed (reading the timer) if the semaphore is not immediately available
+    uint64 ticksStop = 0u;
+    bool ticksStopSet = false;
     ErrorManagement::ErrorType err = ErrorManagement::NoError;
 
     // sets the default if it is negative
     if (sleepTime < 0.0F) {
         sleepTime = 1e-3F;
     }
-    bool noSleep = IsEqual(sleepTime, 0.0);
-
-    while (!Atomic::TestAndSet(flag)) {
-        if (timeout != TTInfiniteWait) {
-            uint64 ticks = HighResolutionTimer::Counter();
-            if (ticks > ticksStop) {
-                err = ErrorManagement::Timeout;
-                REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "FastPollingMutexSem: Timeout expired");
-                break;
-            }
-        }
 
-        if (!noSleep) {
-            Sleep::Sec(sleepTime);
+    if ((ticketMode) && (timeout == TTInfiniteWait)) {
+        uint32 previous = static_cast<uint32>(Atomic::FetchAdd(flag, FAST_POLLING_MUTEX_TICKET_INCREMENT, Atomic::MemoryOrderAcquire));
+        uint32 myTicket = ((previous >> 16u) & FAST_POLLING_MUTEX_TICKET_MASK);
+        int32 value = Atomic::LoadAcquire(flag);
+        while ((static_cast<uint32>(value) & FAST_POLLING_MUTEX_TICKET_MASK) != myTicket) {
+            WaitStep(value, sleepTime);
+            value = Atomic::LoadAcquire(flag);
+        }
+    }
+    else {
+        while (!FastTryLock()) {
+            if (timeout != TTInfiniteWait) {
+                uint64 ticks = HighResolutionTimer::Counter();
+                if (!ticksStopSet) {
+                    ticksStop = ticks + timeout.HighResolutionTimerTicks();
+                    ticksStopSet = true;
+                }
+                if (ticks >= ticksStop) {
+                    err = ErrorManagement::Timeout;
+                    REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "FastPollingMutexSem: Timeout expired");
+                    break;
+                }
+            }
+            WaitStep((ticketMode) ? (Atomic::Load(flag, Atomic::MemoryOrderRelaxed)) : (1), sleepTime);
         }
     }
     return err;
 }
 
 bool FastPollingMutexSem::FastTryLock() {
-    return (Atomic::TestAndSet(flag));
+    bool ret;
+    if (ticketMode) {
+        int32 expected = Atomic::Load(flag, Atomic::MemoryOrderRelaxed);
+        uint32 value = static_cast<uint32>(expected);
+        ret = ((value & FAST_POLLING_MUTEX_TICKET_MASK) == ((value >> 16u) & FAST_POLLING_MUTEX_TICKET_MASK));
+        if (ret) {
+            int32 desired = static_cast<int32>(value + static_cast<uint32>(FAST_POLLING_MUTEX_TICKET_INCREMENT));
+            ret = Atomic::CompareExchange(flag, expected, desired, Atomic::MemoryOrderAcquire);
+        }
+    }
+    else {
+        ret = Atomic::TestAndSet(flag);
+    }
+    return ret;
 }
 
 void FastPollingMutexSem::FastUnLock() {
-    *flag = 0;
+    if (ticketMode) {
+        /* Only the owner changes the lower half, but the upper half may be changed concurrently by new requests. */
+        int32 expected = Atomic::Load(flag, Atomic::MemoryOrderRelaxed);
+        int32 desired;
+        do {
+            uint32 value = static_cast<uint32>(expected);
+            desired = static_cast<int32>((value & ~FAST_POLLING_MUTEX_TICKET_MASK) | ((value + 1u) & FAST_POLLING_MUTEX_TICKET_MASK));
+        }
+        while (!Atomic::CompareExchange(flag, expected, desired, Atomic::MemoryOrderRelease));
+    }
+    else {
+        /* The store-release clears the exclusive monitor of the waiting cores, waking them from WFE. */
+        Atomic::StoreRelease(flag, 0);
+    }
 }
 
 }
@@ -51,6 +51,16 @@ namespace MARTe {
  *
  * @details This semaphore is not recursive i.e is the same thread locks two times sequentially causes a deadlock.
  * Moreover a thread can unlock the semaphore locked by another thread.
+ *
+ * @details Two locking disciplines are available (see Create):
+ *  - test-and-set (default): the spin-lock holds 0 (unlocked) or 1 (locked) and there is no
+ *    guarantee on the order in which contending threads acquire the lock;
+ *  - ticket (FIFO): the lower 16 bits of the spin-lock hold the ticket being served and the upper
+ *    16 bits the next ticket to be given. Threads acquire the lock in the order they requested it.
+ *
+ * @details When FastLock is called with sleepTime = 0 the waiting thread does not busy-poll the
+ * spin-lock but, on ARMv8, waits with WFE on the exclusive monitor of the spin-lock, so that it
+ * is woken by the store-release of FastUnLock.
  */
 class DLL_API FastPollingMutexSem {
 
@@ -72,8 +82,11 @@ public:
     /**
      * @brief Initializes the semaphore as locked or unlocked.
      * @param[in] locked defines if the semaphore is to be initialized in a locked in an unlocked state (default locked=false)
+     * @param[in] fifo if true the semaphore is a ticket lock which grants the lock in FIFO order (default fifo=false).
+     * @pre all the semaphores sharing an external spin-lock must be created with the same fifo value.
      */
-    void Create(const bool locked = false);
+    void Create(const bool locked = false,
+                const bool fifo = false);
 
     /**
      * @brief Returns the status of the semaphore.
@@ -87,7 +100,9 @@ public:
      * by the same thread causes a deadlock.
      * @param[in] timeout is the desired timeout.
      * @param[in] sleepTime is the amount of time the CPU is to be released in-between each polling loop cycle.
-     * If sleepTime = 0 the CPU is never released and the spin-lock is continuously polled.
+     * If sleepTime = 0 the CPU is never released and the thread spins on the spin-lock (using WFE where available).
+     * @details In FIFO mode with a finite timeout a ticket is never taken (as it could not be given back
+     * if the timeout expires) and the lock is acquired only when it is free and no other thread is queued.
      * @return ErrorManagement::Timeout if the semaphore is locked for a period which is greater than the
      * specified timeout. Otherwise ErrorManagement::NoError is returned.
      */
@@ -120,6 +135,20 @@ private:
      */
     volatile int32 *flag;
 
+    /**
+     * True if the semaphore is a FIFO ticket lock.
+     */
+    bool ticketMode;
+
+    /**
+     * @brief Waits for the spin-lock to change from value, either by sleeping or by spinning.
+     * @details Spurious returns are possible and the caller must check the spin-lock again.
+     * @param[in] value the last value read from the spin-lock.
+     * @param[in] sleepTime the time to sleep (if 0 the thread spins with Atomic::WaitWhileEqual).
+     */
+    void WaitStep(const int32 value,
+                  const float32 sleepTime) const;
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,201 @@
+/**
+ * @file FastPollingReadWriteSem.cpp
+ * @brief Source file for class FastPollingReadWriteSem
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FastPollingReadWriteSem (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#define DLL_API
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "Atomic.h"
+#include "ErrorManagement.h"
+#include "FastPollingReadWriteSem.h"
+#include "HighResolutionTimer.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Bit of the spin-lock set while a writer holds the semaphore.
+ */
+static const int32 FAST_POLLING_READ_WRITE_SEM_WRITER = 0x40000000;
+
+/**
+ * Bit of the spin-lock set while a writer is waiting for the semaphore (no new readers are admitted).
+ */
+static const int32 FAST_POLLING_READ_WRITE_SEM_WRITER_WAITING = 0x20000000;
+
+/**
+ * Mask of the number of readers.
+ */
+static const int32 FAST_POLLING_READ_WRITE_SEM_READERS = 0x1FFFFFFF;
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+FastPollingReadWriteSem::FastPollingReadWriteSem() {
+    internalFlag = 0;
+    flag = &internalFlag;
+}
+
+FastPollingReadWriteSem::FastPollingReadWriteSem(volatile int32 &externalFlag) {
+    internalFlag = 0;
+    flag = &externalFlag;
+}
+
+void FastPollingReadWriteSem::Create() {
+    *flag = 0;
+}
+
+bool FastPollingReadWriteSem::Locked() const {
+    int32 value = Atomic::Load(flag, Atomic::MemoryOrderRelaxed);
+    return ((value & (FAST_POLLING_READ_WRITE_SEM_WRITER | FAST_POLLING_READ_WRITE_SEM_READERS)) != 0);
+}
+
+void FastPollingReadWriteSem::WaitStep(const int32 value,
+                                       const float32 sleepTime) const {
+    if (IsEqual(sleepTime, 0.0F)) {
+        Atomic::WaitWhileEqual(flag, value);
+    }
+    else {
+        //Short sleeps are busy waited so that they are not delayed by the operating system timer slack
+        Sleep::Hybrid(static_cast<uint64>((sleepTime * 1e9) + 0.5), Sleep::GetSpinThreshold());
+    }
+}
+
+ErrorManagement::ErrorType FastPollingReadWriteSem::FastLock(const TimeoutType &timeout,
+                                                             float32 sleepTime) {
+    //The deadline is only computed (reading the timer) if the semaphore is not immediately available
+    uint64 ticksStop = 0u;
+    bool ticksStopSet = false;
+    ErrorManagement::ErrorType err = ErrorManagement::NoError;
+
+    // sets the default if it is negative
+    if (sleepTime < 0.0F) {
+        sleepTime = 1e-3F;
+    }
+
+    while (!FastTryLock()) {
+        int32 value = Atomic::Load(flag, Atomic::MemoryOrderRelaxed);
+        if ((value & FAST_POLLING_READ_WRITE_SEM_WRITER_WAITING) == 0) {
+            //Stop admitting new readers (retried in the next loop if the spin-lock changed meanwhile)
+            int32 waiting = (value | FAST_POLLING_READ_WRITE_SEM_WRITER_WAITING);
+            if (Atomic::CompareExchange(flag, value, waiting, Atomic::MemoryOrderRelaxed)) {
+                value = waiting;
+            }
+        }
+        if (timeout != TTInfiniteWait) {
+            uint64 ticks = HighResolutionTimer::Counter();
+            if (!ticksStopSet) {
+                ticksStop = ticks + timeout.HighResolutionTimerTicks();
+                ticksStopSet = true;
+            }
+            if (ticks >= ticksStop) {
+                //Admit the readers again (another waiting writer will set the bit again)
+                int32 expected = Atomic::Load(flag, Atomic::MemoryOrderRelaxed);
+                int32 desired;
+                do {
+                    desired = (expected & ~FAST_POLLING_READ_WRITE_SEM_WRITER_WAITING);
+                }
+                while (!Atomic::CompareExchange(flag, expected, desired, Atomic::MemoryOrderRelaxed));
+                err = ErrorManagement::Timeout;
+                REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "FastPollingReadWriteSem: Timeout expired");
+                break;
+            }
+        }
+        WaitStep(value, sleepTime);
+    }
+    return err;
+}
+
+bool FastPollingReadWriteSem::FastTryLock() {
+    //Free (possibly with writers waiting): the waiting bit is cleared, the other waiting writers set it again
+    int32 expected = Atomic::Load(flag, Atomic::MemoryOrderRelaxed);
+    bool ret = ((expected & ~FAST_POLLING_READ_WRITE_SEM_WRITER_WAITING) == 0);
+    if (ret) {
+        ret = Atomic::CompareExchange(flag, expected, FAST_POLLING_READ_WRITE_SEM_WRITER, Atomic::MemoryOrderAcquire);
+    }
+    return ret;
+}
+
+void FastPollingReadWriteSem::FastUnLock() {
+    /* The waiting bit may be set concurrently by other writers. The release clears the exclusive monitor of the waiting cores. */
+    (void) Atomic::FetchAdd(flag, -FAST_POLLING_READ_WRITE_SEM_WRITER, Atomic::MemoryOrderRelease);
+}
+
+ErrorManagement::ErrorType FastPollingReadWriteSem::FastReadLock(const TimeoutType &timeout,
+                                                                 float32 sleepTime) {
+    uint64 ticksStop = 0u;
+    bool ticksStopSet = false;
+    ErrorManagement::ErrorType err = ErrorManagement::NoError;
+
+    // sets the default if it is negative
+    if (sleepTime < 0.0F) {
+        sleepTime = 1e-3F;
+    }
+
+    while (!FastTryReadLock()) {
+        if (timeout != TTInfiniteWait) {
+            uint64 ticks = HighResolutionTimer::Counter();
+            if (!ticksStopSet) {
+                ticksStop = ticks + timeout.HighResolutionTimerTicks();
+                ticksStopSet = true;
+            }
+            if (ticks >= ticksStop) {
+                err = ErrorManagement::Timeout;
+                REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "FastPollingReadWriteSem: Timeout expired");
+                break;
+            }
+        }
+        WaitStep(Atomic::Load(flag, Atomic::MemoryOrderRelaxed), sleepTime);
+    }
+    return err;
+}
+
+bool FastPollingReadWriteSem::FastTryReadLock() {
+    bool ret = false;
+    bool retry = true;
+    int32 expected = Atomic::Load(flag, Atomic::MemoryOrderRelaxed);
+    while (retry) {
+        retry = ((expected & (FAST_POLLING_READ_WRITE_SEM_WRITER | FAST_POLLING_READ_WRITE_SEM_WRITER_WAITING)) == 0);
+        if (retry) {
+            //Only another reader (or a writer announcing itself) may have changed the spin-lock: retry with the new value
+            ret = Atomic::CompareExchange(flag, expected, expected + 1, Atomic::MemoryOrderAcquire);
+            retry = !ret;
+        }
+    }
+    return ret;
+}
+
+void FastPollingReadWriteSem::FastReadUnLock() {
+    (void) Atomic::FetchAdd(flag, -1, Atomic::MemoryOrderRelease);
+}
+
+}
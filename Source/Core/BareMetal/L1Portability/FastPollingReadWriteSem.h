@@ -0,0 +1,158 @@
+/**
+ * @file FastPollingReadWriteSem.h
+ * @brief Header file for class FastPollingReadWriteSem
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FastPollingReadWriteSem
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FASTPOLLINGREADWRITESEM_H_
+#define FASTPOLLINGREADWRITESEM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ErrorManagement.h"
+#include "ErrorType.h"
+#include "GeneralDefinitions.h"
+#include "TimeoutType.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Reader-writer semaphore based on a spin-lock which can be used without depending on the operating system scheduler.
+ * @details Any number of readers (FastReadLock) may hold the semaphore at the same time, so that read-mostly traversals run in
+ * parallel and never block on each other. A writer (FastLock) holds it exclusively. Writers have preference: once a writer
+ * is waiting no new reader is admitted, so that a continuous flow of readers cannot starve the writers.
+ *
+ * @details The spin-lock holds the number of readers in the lower bits, the FAST_POLLING_READ_WRITE_SEM_WRITER bit when a
+ * writer holds the semaphore and the FAST_POLLING_READ_WRITE_SEM_WRITER_WAITING bit when a writer is waiting for it.
+ *
+ * @details This semaphore is not recursive: a thread that holds it (as a reader or as a writer) and locks it again may
+ * deadlock (e.g. a read lock is not granted while a writer is waiting).
+ *
+ * @details As for the FastPollingMutexSem, copies of this semaphore share the spin-lock of the source semaphore.
+ */
+class DLL_API FastPollingReadWriteSem {
+
+public:
+
+    /**
+     * @brief Initialises the semaphore as unlocked.
+     */
+    FastPollingReadWriteSem();
+
+    /**
+     * @brief Constructor by external spin-lock.
+     * @param[in] externalFlag is the spin-lock which will drive the semaphore.
+     */
+    FastPollingReadWriteSem(volatile int32 &externalFlag);
+
+    /**
+     * @brief Initialises the semaphore as unlocked.
+     */
+    void Create();
+
+    /**
+     * @brief Returns the status of the semaphore.
+     * @return true if the semaphore is held by a writer or by at least one reader.
+     */
+    bool Locked() const;
+
+    /**
+     * @brief Locks the semaphore exclusively (i.e. as a writer).
+     * @details Waits until all the readers and the writer (if any) release the semaphore. No new reader is admitted meanwhile.
+     * @param[in] timeout is the desired timeout.
+     * @param[in] sleepTime is the amount of time the CPU is to be released in-between each polling loop cycle
+     * (see FastPollingMutexSem::FastLock).
+     * @return ErrorManagement::Timeout if the semaphore could not be locked before the timeout, ErrorManagement::NoError otherwise.
+     */
+    ErrorManagement::ErrorType FastLock(const TimeoutType &timeout = TTInfiniteWait,
+                                        float32 sleepTime = 1e-6F);
+
+    /**
+     * @brief Tries to lock the semaphore exclusively and in case of failure returns immediately.
+     * @return true if the semaphore was free and is now held by the caller as a writer.
+     */
+    bool FastTryLock();
+
+    /**
+     * @brief Releases the exclusive lock.
+     * @pre FastLock or FastTryLock succeeded.
+     */
+    void FastUnLock();
+
+    /**
+     * @brief Locks the semaphore shared with other readers.
+     * @details Waits while a writer holds or is waiting for the semaphore.
+     * @param[in] timeout is the desired timeout.
+     * @param[in] sleepTime is the amount of time the CPU is to be released in-between each polling loop cycle
+     * (see FastPollingMutexSem::FastLock).
+     * @return ErrorManagement::Timeout if the semaphore could not be locked before the timeout, ErrorManagement::NoError otherwise.
+     */
+    ErrorManagement::ErrorType FastReadLock(const TimeoutType &timeout = TTInfiniteWait,
+                                            float32 sleepTime = 1e-6F);
+
+    /**
+     * @brief Tries to lock the semaphore shared with other readers and in case of failure returns immediately.
+     * @return true if no writer holds or is waiting for the semaphore and the caller is now one of its readers.
+     */
+    bool FastTryReadLock();
+
+    /**
+     * @brief Releases a shared lock.
+     * @pre FastReadLock or FastTryReadLock succeeded.
+     */
+    void FastReadUnLock();
+
+private:
+
+    /**
+     * @brief Waits (sleeping or spinning) before polling the spin-lock again.
+     * @param[in] value the spin-lock value that keeps the caller waiting.
+     * @param[in] sleepTime see FastLock.
+     */
+    void WaitStep(const int32 value,
+                  const float32 sleepTime) const;
+
+    /**
+     * The internal spin-lock
+     */
+    volatile int32 internalFlag;
+
+    /**
+     * Pointer to the spin-lock (either the internal or an external one).
+     */
+    volatile int32 *flag;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FASTPOLLINGREADWRITESEM_H_ */
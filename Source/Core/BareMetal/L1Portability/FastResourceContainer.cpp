@@ -35,6 +35,24 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+namespace {
+/**
+ * The number of resources of a word of the bitmap.
+ */
+const uint32 FAST_RESOURCE_CONTAINER_WORD_BITS = 64u;
+
+#ifdef THREAD_LOCAL
+/**
+ * The word where the calling thread last took or returned a resource (shared by all the containers,
+ * it is only a hint of where to start searching).
+ */
+static THREAD_LOCAL uint32 fastResourceContainerHint = 0u;
+#endif
+}
+
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -42,154 +60,129 @@
 namespace MARTe {
 
 FastResourceContainer::FastResourceContainer(const uint32 nOfElements, const bool taken) {
-    treeSize = nOfElements;
-    treeHalf = 0u;
-    buffers = NULL_PTR(FastResourceContainerData *);
-
-    if (treeSize > 0u) {
-        uint32 bit = 1u;
-        while (bit < treeSize) {
-            bit <<= 1;
-        }
-        treeHalf = (bit >> 1u);
-        buffers = new FastResourceContainerData[treeSize];
+    nOfResources = nOfElements;
+    nOfWords = 0u;
+    freeCount = 0;
+    words = NULL_PTR(volatile int64 *);
+
+    if (nOfResources > 0u) {
+        nOfWords = ((nOfResources - 1u) / FAST_RESOURCE_CONTAINER_WORD_BITS) + 1u;
+        words = new int64[nOfWords];
         uint32 i;
-        for (i = 0u; i < nOfElements; i++) {
-            buffers[i].sem = 0;
-            buffers[i].size = 0;
+        for (i = 0u; i < nOfWords; i++) {
+            uint64 free = 0u;
+            if (!taken) {
+                uint32 first = i * FAST_RESOURCE_CONTAINER_WORD_BITS;
+                uint32 inWord = nOfResources - first;
+                if (inWord >= FAST_RESOURCE_CONTAINER_WORD_BITS) {
+                    free = ~static_cast<uint64>(0u);
+                }
+                else {
+                    free = (static_cast<uint64>(1u) << inWord) - 1u;
+                }
+            }
+            words[i] = static_cast<int64>(free);
         }
         if (!taken) {
-            for (i = 0u; i < nOfElements; i++) {
-                Return(i);
-            }
+            freeCount = static_cast<int32>(nOfResources);
         }
+        Atomic::ThreadFence(Atomic::MemoryOrderRelease);
     }
 }
 
 /*lint -e{715} copy not used as this implementation is only to forbid the copy construction of this class*/
 FastResourceContainer::FastResourceContainer(const FastResourceContainer &copy) {
     //NOOP
-    treeSize = 0u;
-    treeHalf = 0u;
-    buffers = NULL_PTR(FastResourceContainerData *);
+    nOfResources = 0u;
+    nOfWords = 0u;
+    freeCount = 0;
+    words = NULL_PTR(volatile int64 *);
 }
 
 /*lint -e{715} -e{1745} -e{1529} copy not used as this implementation is only to forbid the copy construction of this class*/
 FastResourceContainer & FastResourceContainer::operator =(const FastResourceContainer &copy) {
     //NOOP
-    treeSize = 0u;
-    treeHalf = 0u;
+    nOfResources = 0u;
+    nOfWords = 0u;
     return *this;
 }
 
 FastResourceContainer::~FastResourceContainer() {
-    if (buffers != NULL_PTR(FastResourceContainerData *)) {
-        delete[] buffers;
+    if (words != NULL_PTR(volatile int64 *)) {
+        /*lint -e{1773} the words were allocated as non volatile*/
+        delete[] const_cast<int64 *>(words);
     }
 }
 
 uint32 FastResourceContainer::GetSize() const {
     uint32 size = 0u;
-    if (buffers != NULL_PTR(FastResourceContainerData *)) {
-        size = static_cast<uint32>(buffers[0].size);
+    int32 count = Atomic::Load(&freeCount, Atomic::MemoryOrderRelaxed);
+    if (count > 0) {
+        size = static_cast<uint32>(count);
     }
     return size;
 }
 
 uint32 FastResourceContainer::Take() {
-    uint32 pos = 0u;
-    bool done = false;
-    if (buffers != NULL_PTR(FastResourceContainerData *)) {
-        if (buffers[0].size != 0) {
-            uint32 pathChooser = 0u;
-            uint32 returnChooser = 0u;
-            uint32 bit = treeHalf;
-            while ((bit <= treeHalf) && (!done)) {
-                if (bit == 0u) {
-                    if (Atomic::TestAndSet(&buffers[pos].sem)) {
-                        uint32 tempBit = 1u;
-                        uint32 temp = pos;
-                        Atomic::Decrement(&buffers[temp].size);
-                        while (tempBit <= treeHalf) {
-                            if ((temp & tempBit) != 0u) {
-                                temp -= tempBit;
-                                Atomic::Decrement(&buffers[temp].size);
-                            }
-                            tempBit <<= 1;
-                        }
-                        done = true;
-                    }
-                    else {
-                        bit = 1u;
-                        if ((pathChooser & bit) != 0u) {
-                            pos -= bit;
-                        }
-                    }
+    uint32 pos = 0xFFFFFFFFu;
+    if (Atomic::Load(&freeCount, Atomic::MemoryOrderRelaxed) > 0) {
+        uint32 w = 0u;
+#ifdef THREAD_LOCAL
+        w = fastResourceContainerHint % nOfWords;
+#endif
+        uint32 n;
+        for (n = 0u; (n < nOfWords) && (pos == 0xFFFFFFFFu); n++) {
+            int64 value = Atomic::Load(&words[w], Atomic::MemoryOrderRelaxed);
+            /*lint -e{9117} the bits are handled as unsigned*/
+            while ((value != 0) && (pos == 0xFFFFFFFFu)) {
+                uint64 free = static_cast<uint64>(value);
+                uint32 bit = static_cast<uint32>(__builtin_ctzll(free));
+                int64 desired = static_cast<int64>(free & (free - 1u));
+                /* on failure value is updated with the current word and the search restarts from it */
+                if (Atomic::CompareExchange(&words[w], value, desired, Atomic::MemoryOrderAcquire)) {
+                    pos = (w * FAST_RESOURCE_CONTAINER_WORD_BITS) + bit;
                 }
-
-                if (!done) {
-                    // time to return one level up
-                    if ((returnChooser & bit) != 0u) {
-
-                        returnChooser &= ~bit;
-                        bit <<= 1;
-                        if ((pathChooser & bit) != 0u) {
-                            pos -= bit;
-                        }
-                    }
-                    else { // go down
-                        if ((pathChooser & bit) != 0u) { // go right
-                            pathChooser &= ~bit;
-                            returnChooser |= bit; // next is up
-                            int32 tot = buffers[pos].size;
-                            int32 right = 0;
-                            if ((pos + bit) < treeSize) {
-                                uint32 newpos = pos + bit;
-                                right = buffers[newpos].size;
-                            }
-                            if ((tot - right) > 0) {
-                                bit >>= 1;
-                            }
-                        }
-                        else { // go left
-                            pathChooser |= bit; // next is right
-                            int32 right = 0;
-                            if ((pos + bit) < treeSize) {
-                                uint32 newpos = pos + bit;
-                                right = buffers[newpos].size;
-                            }
-                            if (right > 0) {
-                                pos += bit;
-                                bit >>= 1;
-                            }
-                        }
-                    }
+            }
+            if (pos == 0xFFFFFFFFu) {
+                w++;
+                if (w == nOfWords) {
+                    w = 0u;
                 }
             }
         }
-        if (!done) {
-            pos = 0xFFFFFFFFu;
+        if (pos != 0xFFFFFFFFu) {
+            (void) Atomic::FetchAdd(&freeCount, -1, Atomic::MemoryOrderRelaxed);
+#ifdef THREAD_LOCAL
+            fastResourceContainerHint = w;
+#endif
         }
     }
     return pos;
 }
 
-void FastResourceContainer::Return(uint32 pos) {
-    if (buffers != NULL_PTR(FastResourceContainerData *)) {
-        if (pos < treeSize) {
-            buffers[pos].sem = 0;
-            Atomic::Increment(&buffers[pos].size);
-
-            uint32 bit = 1u;
-            while (bit <= treeHalf) {
-                if ((pos & bit) != 0u) {
-                    pos -= bit;
-                    Atomic::Increment(&buffers[pos].size);
-                }
-                bit <<= 1;
+void FastResourceContainer::Return(const uint32 pos) {
+    if (pos < nOfResources) {
+        uint32 w = pos / FAST_RESOURCE_CONTAINER_WORD_BITS;
+        uint64 mask = static_cast<uint64>(1u) << (pos % FAST_RESOURCE_CONTAINER_WORD_BITS);
+        int64 value = Atomic::Load(&words[w], Atomic::MemoryOrderRelaxed);
+        bool returned = false;
+        bool done = false;
+        while (!done) {
+            if ((static_cast<uint64>(value) & mask) != 0u) {
+                /* already free */
+                done = true;
+            }
+            else {
+                returned = Atomic::CompareExchange(&words[w], value, static_cast<int64>(static_cast<uint64>(value) | mask), Atomic::MemoryOrderRelease);
+                done = returned;
             }
         }
+        if (returned) {
+            (void) Atomic::FetchAdd(&freeCount, 1, Atomic::MemoryOrderRelaxed);
+#ifdef THREAD_LOCAL
+            fastResourceContainerHint = w;
+#endif
+        }
     }
 }
 }
-
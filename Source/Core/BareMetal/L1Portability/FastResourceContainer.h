@@ -40,6 +40,12 @@ namespace MARTe {
 /**
  * @brief A container of resources. It allows taking and releasing resource,, in any order,
  * and concurrently by any number of tasks, interrupts and processors.
+ * @details The resources are the bits of an array of 64 bit words (a set bit is a free resource).
+ * Take finds a free resource in a word with a count trailing zeros (rbit + clz on ARMv8) and claims
+ * it with a compare and exchange of that word only, so that in the common case a Take or a Return
+ * touches a single cache line. Each thread remembers the word where it last took or returned a
+ * resource (THREAD_LOCAL hint) and starts its next search from there, which spreads concurrent
+ * threads over different words and keeps the resources of a thread in the same line.
  */
 class FastResourceContainer {
 public:
@@ -84,33 +90,25 @@ private:
     FastResourceContainer & operator =(const FastResourceContainer &copy);
 
     /**
-     * @brief describes a free resource.
+     * The bitmap of the free resources (bit i%64 of word i/64 set if the resource i is free).
      */
-    struct FastResourceContainerData {
-        /**
-         * Amount of buffer used.
-         */
-        volatile int32 size;
-        /**
-         * Semaphore that locks the resource.
-         */
-        volatile int32 sem;
-    };
+    volatile int64 *words;
 
     /**
-     * List of FastResourceContainerData.
+     * The number of words of the bitmap.
      */
-    FastResourceContainerData *buffers;
+    uint32 nOfWords;
 
     /**
-     * The number of FastResourceContainerData elements.
+     * The number of resources.
      */
-    uint32 treeSize;
+    uint32 nOfResources;
 
     /**
-     * Number equal to half of the FastResourceContainerData elements.
+     * The number of free resources (may transiently differ from the number of set bits by the
+     * Take and Return operations in progress).
      */
-    uint32 treeHalf;
+    volatile int32 freeCount;
 
     /*lint -e{1712} This class does not have a default constructor because
      * the nOfElements must be defined on construction and remain constant
@@ -0,0 +1,321 @@
+/**
+ * @file FixedSizePool.cpp
+ * @brief Source file for class FixedSizePool
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FixedSizePool (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "FixedSizePool.h"
+#include "HeapManager.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * @brief Builds the value of a free list head.
+ */
+inline MARTe::int64 PackHead(const MARTe::uint32 tag,
+                             const MARTe::uint32 first) {
+    MARTe::uint64 packed = (static_cast<MARTe::uint64>(tag) << 32u) | static_cast<MARTe::uint64>(first);
+    return static_cast<MARTe::int64>(packed);
+}
+
+/**
+ * @brief Gets the index of the first free block (plus one) from a free list head.
+ */
+inline MARTe::uint32 HeadFirst(const MARTe::int64 packed) {
+    return static_cast<MARTe::uint32>(static_cast<MARTe::uint64>(packed) & 0xFFFFFFFFu);
+}
+
+/**
+ * @brief Gets the modification counter from a free list head.
+ */
+inline MARTe::uint32 HeadTag(const MARTe::int64 packed) {
+    return static_cast<MARTe::uint32>(static_cast<MARTe::uint64>(packed) >> 32u);
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+FixedSizePool::FixedSizePool() {
+    uint32 i;
+    for (i = 0u; i < FIXED_SIZE_POOL_MAX_SLABS; i++) {
+        slabs[i] = NULL_PTR(uint8 *);
+        slabFirstBlock[i] = 0u;
+        slabNumberOfBlocks[i] = 0u;
+    }
+    numberOfSlabs = 0;
+    head = 0;
+    usedBlocks = 0;
+    blockSize = 0u;
+    numberOfBlocks = 0u;
+    firstAddress = 0u;
+    lastAddress = 0u;
+    canGrow = false;
+    growMux.Create();
+}
+
+/*lint -e{715} copy not used as this implementation is only to forbid the copy construction of this class*/
+FixedSizePool::FixedSizePool(const FixedSizePool &copy) {
+    uint32 i;
+    for (i = 0u; i < FIXED_SIZE_POOL_MAX_SLABS; i++) {
+        slabs[i] = NULL_PTR(uint8 *);
+        slabFirstBlock[i] = 0u;
+        slabNumberOfBlocks[i] = 0u;
+    }
+    numberOfSlabs = 0;
+    head = 0;
+    usedBlocks = 0;
+    blockSize = 0u;
+    numberOfBlocks = 0u;
+    firstAddress = 0u;
+    lastAddress = 0u;
+    canGrow = false;
+}
+
+/*lint -e{715} -e{1745} -e{1529} copy not used as this implementation is only to forbid the copy construction of this class*/
+FixedSizePool & FixedSizePool::operator =(const FixedSizePool &copy) {
+    return *this;
+}
+
+/*lint -e{1551} HeapManager::Free does not throw exceptions*/
+FixedSizePool::~FixedSizePool() {
+    uint32 n = static_cast<uint32>(numberOfSlabs);
+    uint32 i;
+    for (i = 0u; i < n; i++) {
+        void *slab = reinterpret_cast<void *>(slabs[i]);
+        if (!HeapManager::Free(slab)) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "FixedSizePool: Failed to free slab");
+        }
+        slabs[i] = NULL_PTR(uint8 *);
+    }
+    numberOfSlabs = 0;
+    head = 0;
+}
+
+bool FixedSizePool::Initialise(const uint32 blockSizeIn,
+                               const uint32 numberOfBlocksIn,
+                               const bool canGrowIn) {
+    bool ok = (numberOfSlabs == 0);
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::InitialisationError, "FixedSizePool: Already initialised");
+    }
+    if (ok) {
+        ok = (blockSizeIn > 0u) && (numberOfBlocksIn > 0u);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "FixedSizePool: The block size and the number of blocks shall be greater than zero");
+        }
+    }
+    if (ok) {
+        //Room for the free list link and alignment of any type stored in the block
+        blockSize = ((blockSizeIn + 15u) / 16u) * 16u;
+        slabNumberOfBlocks[0] = numberOfBlocksIn;
+        canGrow = canGrowIn;
+        ok = (growMux.FastLock() == ErrorManagement::NoError);
+        if (ok) {
+            ok = Grow();
+            growMux.FastUnLock();
+        }
+    }
+    return ok;
+}
+
+bool FixedSizePool::Grow() {
+    uint32 slab = static_cast<uint32>(numberOfSlabs);
+    bool ok = (slab < FIXED_SIZE_POOL_MAX_SLABS);
+    uint32 nBlocks = 0u;
+    if (ok) {
+        nBlocks = (slab == 0u) ? (slabNumberOfBlocks[0]) : (slabNumberOfBlocks[slab - 1u] * 2u);
+        //The slab size is limited by the uint32 interface of the heaps and the block index by the free list head
+        uint64 slabSize = static_cast<uint64>(nBlocks) * static_cast<uint64>(blockSize);
+        uint64 totalBlocks = static_cast<uint64>(numberOfBlocks) + static_cast<uint64>(nBlocks);
+        ok = (slabSize <= 0xFFFFFFFFu) && (totalBlocks < 0xFFFFFFFFu);
+        if (ok) {
+            slabs[slab] = reinterpret_cast<uint8 *>(HeapManager::Malloc(static_cast<uint32>(slabSize)));
+            ok = (slabs[slab] != NULL_PTR(uint8 *));
+        }
+    }
+    if (ok) {
+        /*lint -e{923} -e{9091} the address range requires the conversion of the pointers to integers*/
+        uintp slabStart = reinterpret_cast<uintp>(slabs[slab]);
+        uintp slabEnd = slabStart + ((static_cast<uintp>(nBlocks) * blockSize) - 1u);
+        if ((firstAddress == 0u) || (slabStart < firstAddress)) {
+            firstAddress = slabStart;
+        }
+        if (slabEnd > lastAddress) {
+            lastAddress = slabEnd;
+        }
+        slabFirstBlock[slab] = numberOfBlocks;
+        slabNumberOfBlocks[slab] = nBlocks;
+        uint32 first = numberOfBlocks + 1u;
+        //Chain the new blocks. The link of the last one is set when pushing the chain into the free list.
+        uint32 i;
+        for (i = 0u; i < (nBlocks - 1u); i++) {
+            /*lint -e{927} -e{826} the first bytes of a free block hold the link to the next free block*/
+            uint32 *link = reinterpret_cast<uint32 *>(&slabs[slab][i * blockSize]);
+            *link = first + i + 1u;
+        }
+        numberOfBlocks += nBlocks;
+        //Publish the slab before any of its blocks can be seen in the free list
+        Atomic::Store(&numberOfSlabs, static_cast<int32>(slab + 1u), Atomic::MemoryOrderRelease);
+
+        /*lint -e{927} -e{826} the first bytes of a free block hold the link to the next free block*/
+        volatile uint32 *lastLink = reinterpret_cast<volatile uint32 *>(&slabs[slab][(nBlocks - 1u) * blockSize]);
+        int64 oldHead = Atomic::Load(&head, Atomic::MemoryOrderAcquire);
+        bool done = false;
+        while (!done) {
+            *lastLink = HeadFirst(oldHead);
+            done = Atomic::CompareExchange(&head, oldHead, PackHead(HeadTag(oldHead) + 1u, first), Atomic::MemoryOrderAcquireRelease);
+        }
+    }
+    return ok;
+}
+
+uint8 *FixedSizePool::BlockAddress(const uint32 index) const {
+    uint32 n = static_cast<uint32>(Atomic::Load(&numberOfSlabs, Atomic::MemoryOrderAcquire));
+    uint8 *address = NULL_PTR(uint8 *);
+    uint32 i;
+    for (i = 0u; (i < n) && (address == NULL_PTR(uint8 *)); i++) {
+        if ((index >= slabFirstBlock[i]) && ((index - slabFirstBlock[i]) < slabNumberOfBlocks[i])) {
+            address = &slabs[i][(index - slabFirstBlock[i]) * blockSize];
+        }
+    }
+    return address;
+}
+
+bool FixedSizePool::BlockIndex(const void * const address,
+                               uint32 &index) const {
+    uint32 n = static_cast<uint32>(Atomic::Load(&numberOfSlabs, Atomic::MemoryOrderAcquire));
+    /*lint -e{923} -e{9091} the address arithmetic requires the conversion of the pointers to integers*/
+    uintp addr = reinterpret_cast<uintp>(address);
+    bool found = false;
+    uint32 i;
+    for (i = 0u; (i < n) && (!found); i++) {
+        /*lint -e{923} -e{9091} the address arithmetic requires the conversion of the pointers to integers*/
+        uintp start = reinterpret_cast<uintp>(slabs[i]);
+        uintp end = start + (static_cast<uintp>(slabNumberOfBlocks[i]) * blockSize);
+        if ((addr >= start) && (addr < end)) {
+            uintp offset = addr - start;
+            found = ((offset % blockSize) == 0u);
+            if (found) {
+                index = slabFirstBlock[i] + static_cast<uint32>(offset / blockSize);
+            }
+            else {
+                //Inside the slab but not at the start of a block. Stop searching.
+                i = n;
+            }
+        }
+    }
+    return found;
+}
+
+void *FixedSizePool::Allocate() {
+    uint8 *block = NULL_PTR(uint8 *);
+    bool exhausted = (blockSize == 0u);
+    while ((block == NULL_PTR(uint8 *)) && (!exhausted)) {
+        int64 oldHead = Atomic::Load(&head, Atomic::MemoryOrderAcquire);
+        uint32 first = HeadFirst(oldHead);
+        if (first != 0u) {
+            uint8 *candidate = BlockAddress(first - 1u);
+            //The link may be stale if another thread takes the block first, in which case the exchange fails.
+            /*lint -e{927} -e{826} the first bytes of a free block hold the link to the next free block*/
+            uint32 next = *reinterpret_cast<volatile uint32 *>(candidate);
+            if (Atomic::CompareExchange(&head, oldHead, PackHead(HeadTag(oldHead) + 1u, next), Atomic::MemoryOrderAcquireRelease)) {
+                block = candidate;
+            }
+        }
+        else if (canGrow) {
+            exhausted = (growMux.FastLock() != ErrorManagement::NoError);
+            if (!exhausted) {
+                //Another thread may have grown the pool (or returned blocks) while waiting for the lock
+                if (HeadFirst(Atomic::Load(&head, Atomic::MemoryOrderAcquire)) == 0u) {
+                    exhausted = !Grow();
+                }
+                growMux.FastUnLock();
+            }
+        }
+        else {
+            exhausted = true;
+        }
+    }
+    if (block != NULL_PTR(uint8 *)) {
+        (void) Atomic::FetchAdd(&usedBlocks, 1, Atomic::MemoryOrderRelaxed);
+    }
+    return reinterpret_cast<void *>(block);
+}
+
+bool FixedSizePool::Free(void * const block) {
+    uint32 index = 0u;
+    bool ok = BlockIndex(block, index);
+    if (ok) {
+        /*lint -e{927} -e{826} the first bytes of a free block hold the link to the next free block*/
+        volatile uint32 *link = reinterpret_cast<volatile uint32 *>(block);
+        int64 oldHead = Atomic::Load(&head, Atomic::MemoryOrderAcquire);
+        bool done = false;
+        while (!done) {
+            *link = HeadFirst(oldHead);
+            done = Atomic::CompareExchange(&head, oldHead, PackHead(HeadTag(oldHead) + 1u, index + 1u), Atomic::MemoryOrderAcquireRelease);
+        }
+        (void) Atomic::FetchAdd(&usedBlocks, -1, Atomic::MemoryOrderRelaxed);
+    }
+    return ok;
+}
+
+bool FixedSizePool::Contains(const void * const address) const {
+    uint32 index = 0u;
+    return BlockIndex(address, index);
+}
+
+uint32 FixedSizePool::GetBlockSize() const {
+    return blockSize;
+}
+
+uint32 FixedSizePool::GetNumberOfBlocks() const {
+    return numberOfBlocks;
+}
+
+uint32 FixedSizePool::GetNumberOfUsedBlocks() const {
+    return static_cast<uint32>(Atomic::Load(&usedBlocks, Atomic::MemoryOrderRelaxed));
+}
+
+uintp FixedSizePool::GetFirstAddress() const {
+    return firstAddress;
+}
+
+uintp FixedSizePool::GetLastAddress() const {
+    return lastAddress;
+}
+
+}
@@ -0,0 +1,240 @@
+/**
+ * @file FixedSizePool.h
+ * @brief Header file for class FixedSizePool
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FixedSizePool
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FIXEDSIZEPOOL_H_
+#define FIXEDSIZEPOOL_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "FastPollingMutexSem.h"
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Maximum number of slabs that a FixedSizePool may hold.
+ * @details Each slab doubles the capacity of the previous one, so that this is in practice not a limit.
+ */
+static const uint32 FIXED_SIZE_POOL_MAX_SLABS = 24u;
+
+/**
+ * @brief A pool of equally sized memory blocks.
+ * @details The blocks are carved from slabs that are allocated in the standard heap. The free blocks are kept in
+ * a lock-free list (the index of the next free block is stored in the first bytes of each free block) whose head
+ * is tagged with a modification counter, so that Allocate and Free can be concurrently called by any number of
+ * threads without risk of ABA problems.
+ *
+ * When the pool is allowed to grow a new slab, with twice the number of blocks of the previous one, is allocated
+ * every time that the pool runs out of blocks. Slabs are only released when the pool is destroyed, so that the
+ * time to Allocate and Free a block does not depend on the number of blocks in use.
+ *
+ * The block size is always rounded up to a multiple of 16 bytes so that any block is suitably aligned for any type.
+ */
+class DLL_API FixedSizePool {
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     * @post
+     *   GetBlockSize() == 0u &&
+     *   GetNumberOfBlocks() == 0u
+     */
+    FixedSizePool();
+
+    /**
+     * @brief Destructor. Frees all the slabs.
+     * @warning All the blocks returned by Allocate become invalid.
+     */
+    ~FixedSizePool();
+
+    /**
+     * @brief Allocates the first slab of the pool.
+     * @param[in] blockSizeIn the size of each block (rounded up to a multiple of 16 bytes).
+     * @param[in] numberOfBlocksIn the number of blocks in the first slab.
+     * @param[in] canGrowIn if true a new slab is allocated when the pool runs out of blocks.
+     * @return true if the pool was not already initialised, both sizes are greater than zero and the memory could
+     * be allocated.
+     */
+    bool Initialise(const uint32 blockSizeIn,
+                    const uint32 numberOfBlocksIn,
+                    const bool canGrowIn = true);
+
+    /**
+     * @brief Takes a block from the pool.
+     * @return a pointer to a block with GetBlockSize() bytes or NULL if the pool is exhausted (and cannot grow).
+     */
+    void *Allocate();
+
+    /**
+     * @brief Returns a block to the pool.
+     * @param[in] block a block that was returned by Allocate.
+     * @return true if \a block belongs to this pool.
+     */
+    bool Free(void * const block);
+
+    /**
+     * @brief Checks if an address belongs to one of the blocks of this pool.
+     * @param[in] address the address to check.
+     * @return true if \a address is the start of a block of this pool.
+     */
+    bool Contains(const void * const address) const;
+
+    /**
+     * @brief Gets the (rounded) size of each block.
+     * @return the size of each block.
+     */
+    uint32 GetBlockSize() const;
+
+    /**
+     * @brief Gets the total number of blocks in all the slabs.
+     * @return the total number of blocks.
+     */
+    uint32 GetNumberOfBlocks() const;
+
+    /**
+     * @brief Gets the number of blocks currently taken.
+     * @return the number of blocks currently taken.
+     */
+    uint32 GetNumberOfUsedBlocks() const;
+
+    /**
+     * @brief Gets the lowest address of all the slabs.
+     * @return the lowest address of all the slabs (0 if the pool was not initialised).
+     */
+    uintp GetFirstAddress() const;
+
+    /**
+     * @brief Gets the highest address (inclusive) of all the slabs.
+     * @return the highest address of all the slabs (0 if the pool was not initialised).
+     */
+    uintp GetLastAddress() const;
+
+private:
+
+    /**
+     * Do not allow assignment nor copy construction of this class.
+     */
+    /*lint -e{1704} private copy constructor to avoid assignment of this class*/
+    FixedSizePool(const FixedSizePool &copy);
+    FixedSizePool & operator =(const FixedSizePool &copy);
+
+    /**
+     * @brief Allocates a new slab and adds its blocks to the free list.
+     * @return true if the slab was successfully allocated.
+     */
+    bool Grow();
+
+    /**
+     * @brief Gets the address of the block with a given index.
+     * @param[in] index the block index (< GetNumberOfBlocks()).
+     * @return the block address.
+     */
+    uint8 *BlockAddress(const uint32 index) const;
+
+    /**
+     * @brief Gets the index of the block at a given address.
+     * @param[in] address the block address.
+     * @param[out] index the block index.
+     * @return true if \a address is the start of a block of this pool.
+     */
+    bool BlockIndex(const void * const address,
+                    uint32 &index) const;
+
+    /**
+     * The memory of each slab.
+     */
+    uint8 *slabs[FIXED_SIZE_POOL_MAX_SLABS];
+
+    /**
+     * The index of the first block of each slab.
+     */
+    uint32 slabFirstBlock[FIXED_SIZE_POOL_MAX_SLABS];
+
+    /**
+     * The number of blocks in each slab.
+     */
+    uint32 slabNumberOfBlocks[FIXED_SIZE_POOL_MAX_SLABS];
+
+    /**
+     * The number of slabs in use.
+     */
+    volatile int32 numberOfSlabs;
+
+    /**
+     * The head of the free list. The low 32 bits hold the index of the first free block plus one (zero if the
+     * list is empty) and the high 32 bits a counter that is incremented in every modification.
+     */
+    volatile int64 head;
+
+    /**
+     * The number of blocks currently taken.
+     */
+    volatile int32 usedBlocks;
+
+    /**
+     * The size of each block.
+     */
+    uint32 blockSize;
+
+    /**
+     * The total number of blocks.
+     */
+    uint32 numberOfBlocks;
+
+    /**
+     * The lowest address of all the slabs.
+     */
+    uintp firstAddress;
+
+    /**
+     * The highest address (inclusive) of all the slabs.
+     */
+    uintp lastAddress;
+
+    /**
+     * True if new slabs can be allocated.
+     */
+    bool canGrow;
+
+    /**
+     * Serialises the allocation of new slabs.
+     */
+    FastPollingMutexSem growMux;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FIXEDSIZEPOOL_H_ */
@@ -27,6 +27,9 @@
 /*---------------------------------------------------------------------------*/
 /*                        Standard header includes                           */
 /*---------------------------------------------------------------------------*/
+#ifdef MARTe2_CXX11
+#include <utility>
+#endif
 
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
@@ -49,6 +52,16 @@ namespace MARTe {
 #define __ERROR_FUNCTION_NAME__ __func__
 #endif
 
+/**
+ * @brief Moves \a x (i.e. allows its move constructor or move assignment to be used) in the C++11 builds (MARTe2_CXX11)
+ * and copies it otherwise. \a x shall not be used after being moved.
+ */
+#ifdef MARTe2_CXX11
+#define MARTe2_MOVE(x) std::move(x)
+#else
+#define MARTe2_MOVE(x) (x)
+#endif
+
 /**
  * @brief Type for a generic callback function.
  */
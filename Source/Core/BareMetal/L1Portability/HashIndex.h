@@ -0,0 +1,328 @@
+/**
+ * @file HashIndex.h
+ * @brief Header file for class HashIndex
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HashIndex
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef HASHINDEX_H_
+#define HASHINDEX_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+/**
+ * @brief Hash table from string identifiers to values.
+ * @details The keys are computed from the identifiers with the provided template hash function (see HashFunction) and
+ * the table stores only the keys and the values, so that different elements can have the same key (either because
+ * the identifiers are repeated or because of a collision). Search returns, one after the other, all the values
+ * with a given key (in no specific order) and it is up to the caller to check the identifier of each candidate.
+ *
+ * The table uses separate chaining with the elements stored in one array and grows (doubling the number of
+ * buckets) when the number of elements reaches 3/4 of the number of buckets, so that Insert, Remove and Search
+ * are O(1) on average.
+ *
+ * @pre T shall have a default constructor and an assignment operator, and be comparable with ==.
+ */
+template<typename T, typename HashObject>
+class HashIndex {
+public:
+
+    /**
+     * @brief Constructor. No memory is allocated until the first Insert.
+     */
+    HashIndex();
+
+    /**
+     * @brief Destructor. Frees the table.
+     */
+    ~HashIndex();
+
+    /**
+     * @brief Computes the key of an identifier.
+     * @param[in] id the identifier.
+     * @param[in] idSize the number of characters of \a id to use (if 0 is the string length).
+     * @return the key.
+     */
+    uint32 Key(const char8 * const id, const uint32 idSize = 0u);
+
+    /**
+     * @brief Adds an element.
+     * @param[in] key the key of the element (see Key).
+     * @param[in] value the value of the element.
+     * @return false if the table could not be grown.
+     */
+    bool Insert(const uint32 key, const T &value);
+
+    /**
+     * @brief Removes one element.
+     * @param[in] key the key with which the element was inserted.
+     * @param[in] value the value of the element.
+     * @return true if an element with this key and value was found (and removed).
+     */
+    bool Remove(const uint32 key, const T &value);
+
+    /**
+     * @brief Gets the next element with a given key.
+     * @param[in] key the key to search.
+     * @param[in,out] cursor shall be set to 0 to get the first element and then given back unchanged to get the next ones.
+     * @param[out] value the value of the element.
+     * @return true if an element was found, false if all the elements with this key were returned.
+     * @pre
+     *   The table is not modified between the calls with the same cursor.
+     */
+    bool Search(const uint32 key, uint32 &cursor, T &value) const;
+
+    /**
+     * @brief Removes all the elements (without freeing the table).
+     */
+    void Reset();
+
+    /**
+     * @brief Gets the number of elements.
+     * @return the number of elements.
+     */
+    uint32 GetSize() const;
+
+private:
+
+    /**
+     * @brief Reallocates the table with \a newNumberOfBuckets buckets (a power of two) and rehashes all the elements.
+     */
+    bool Resize(const uint32 newNumberOfBuckets);
+
+    /**
+     * The hash function.
+     */
+    HashObject hashFun;
+
+    /**
+     * The keys of the elements.
+     */
+    uint32 *keys;
+
+    /**
+     * The values of the elements.
+     */
+    T *values;
+
+    /**
+     * For each element, the index + 1 of the next element in the same bucket (or in the free list), 0 for the last.
+     */
+    uint32 *next;
+
+    /**
+     * For each bucket, the index + 1 of its first element, 0 if empty.
+     */
+    uint32 *buckets;
+
+    /**
+     * The number of buckets (and the capacity of the element arrays).
+     */
+    uint32 numberOfBuckets;
+
+    /**
+     * The number of elements in the arrays that were ever used.
+     */
+    uint32 used;
+
+    /**
+     * The index + 1 of the first removed element (to be reused), 0 if none.
+     */
+    uint32 freeList;
+
+    /**
+     * The number of elements.
+     */
+    uint32 size;
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+template<typename T, typename HashObject>
+HashIndex<T, HashObject>::HashIndex() {
+    keys = NULL_PTR(uint32 *);
+    values = NULL_PTR(T *);
+    next = NULL_PTR(uint32 *);
+    buckets = NULL_PTR(uint32 *);
+    numberOfBuckets = 0u;
+    used = 0u;
+    freeList = 0u;
+    size = 0u;
+}
+
+/*lint -e{1551} the destructor only frees memory.*/
+template<typename T, typename HashObject>
+HashIndex<T, HashObject>::~HashIndex() {
+    delete[] keys;
+    delete[] values;
+    delete[] next;
+    delete[] buckets;
+}
+
+template<typename T, typename HashObject>
+uint32 HashIndex<T, HashObject>::Key(const char8 * const id, const uint32 idSize) {
+    return hashFun.Compute(id, idSize);
+}
+
+template<typename T, typename HashObject>
+bool HashIndex<T, HashObject>::Insert(const uint32 key, const T &value) {
+    bool ok = true;
+    //Keep the load factor below 3/4
+    if (((size + 1u) * 4u) > (numberOfBuckets * 3u)) {
+        ok = Resize((numberOfBuckets == 0u) ? (16u) : (numberOfBuckets * 2u));
+    }
+    if (ok) {
+        uint32 element;
+        if (freeList != 0u) {
+            element = freeList - 1u;
+            freeList = next[element];
+        }
+        else {
+            element = used;
+            used++;
+        }
+        uint32 bucket = key & (numberOfBuckets - 1u);
+        keys[element] = key;
+        values[element] = value;
+        next[element] = buckets[bucket];
+        buckets[bucket] = element + 1u;
+        size++;
+    }
+    return ok;
+}
+
+template<typename T, typename HashObject>
+bool HashIndex<T, HashObject>::Remove(const uint32 key, const T &value) {
+    bool found = false;
+    if (numberOfBuckets > 0u) {
+        uint32 *link = &buckets[key & (numberOfBuckets - 1u)];
+        while ((!found) && ((*link) != 0u)) {
+            uint32 element = (*link) - 1u;
+            found = ((keys[element] == key) && (values[element] == value));
+            if (found) {
+                *link = next[element];
+                values[element] = T();
+                next[element] = freeList;
+                freeList = element + 1u;
+                size--;
+            }
+            else {
+                link = &next[element];
+            }
+        }
+    }
+    return found;
+}
+
+template<typename T, typename HashObject>
+bool HashIndex<T, HashObject>::Search(const uint32 key, uint32 &cursor, T &value) const {
+    bool found = false;
+    if (numberOfBuckets > 0u) {
+        uint32 element = (cursor == 0u) ? (buckets[key & (numberOfBuckets - 1u)]) : (next[cursor - 1u]);
+        while ((!found) && (element != 0u)) {
+            found = (keys[element - 1u] == key);
+            if (found) {
+                value = values[element - 1u];
+                cursor = element;
+            }
+            else {
+                element = next[element - 1u];
+            }
+        }
+    }
+    return found;
+}
+
+template<typename T, typename HashObject>
+void HashIndex<T, HashObject>::Reset() {
+    uint32 i;
+    for (i = 0u; i < numberOfBuckets; i++) {
+        buckets[i] = 0u;
+    }
+    for (i = 0u; i < used; i++) {
+        values[i] = T();
+    }
+    used = 0u;
+    freeList = 0u;
+    size = 0u;
+}
+
+template<typename T, typename HashObject>
+uint32 HashIndex<T, HashObject>::GetSize() const {
+    return size;
+}
+
+template<typename T, typename HashObject>
+bool HashIndex<T, HashObject>::Resize(const uint32 newNumberOfBuckets) {
+    bool ok = (newNumberOfBuckets > numberOfBuckets);
+    if (ok) {
+        uint32 *newKeys = new uint32[newNumberOfBuckets];
+        T *newValues = new T[newNumberOfBuckets];
+        uint32 *newNext = new uint32[newNumberOfBuckets];
+        uint32 *newBuckets = new uint32[newNumberOfBuckets];
+        uint32 i;
+        for (i = 0u; i < newNumberOfBuckets; i++) {
+            newBuckets[i] = 0u;
+        }
+        //Compact the elements while rehashing them
+        uint32 n = 0u;
+        for (i = 0u; i < numberOfBuckets; i++) {
+            uint32 element = buckets[i];
+            while (element != 0u) {
+                uint32 bucket = keys[element - 1u] & (newNumberOfBuckets - 1u);
+                newKeys[n] = keys[element - 1u];
+                newValues[n] = values[element - 1u];
+                newNext[n] = newBuckets[bucket];
+                newBuckets[bucket] = n + 1u;
+                n++;
+                element = next[element - 1u];
+            }
+        }
+        delete[] keys;
+        delete[] values;
+        delete[] next;
+        delete[] buckets;
+        keys = newKeys;
+        values = newValues;
+        next = newNext;
+        buckets = newBuckets;
+        numberOfBuckets = newNumberOfBuckets;
+        used = n;
+        freeList = 0u;
+    }
+    return ok;
+}
+
+}
+
+#endif /* HASHINDEX_H_ */
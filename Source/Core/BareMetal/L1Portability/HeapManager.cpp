@@ -1,496 +1,1011 @@
-/**
- * @file HeapManager.cpp
- * @brief Source file for module HeapManager
- * @date 07/08/2015
- * @author Filippo Sartori
- *
- * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
- * the Development of Fusion Energy ('Fusion for Energy').
- * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
- * by the European Commission - subsequent versions of the EUPL (the "Licence")
- * You may not use this work except in compliance with the Licence.
- * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
- *
- * @warning Unless required by applicable law or agreed to in writing, 
- * software distributed under the Licence is distributed on an "AS IS"
- * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
- * or implied. See the Licence permissions and limitations under the Licence.
-
- * @details This source file contains the definition of all the methods for
- * the module HeapManager (public, protected, and private). Be aware that some
- * methods, such as those inline could be defined on the header file, instead.
- */
-#define DLL_API
-/*---------------------------------------------------------------------------*/
-/*                         Standard header includes                          */
-/*---------------------------------------------------------------------------*/
-
-/*---------------------------------------------------------------------------*/
-/*                         Project header includes                           */
-/*---------------------------------------------------------------------------*/
-
-#include "HeapManager.h"
-#include "FastPollingMutexSem.h"
-#include "GeneralDefinitions.h"
-#include "HeapI.h"
-#include "StringHelper.h"
-#include "GlobalObjectI.h"
-#include "GlobalObjectsDatabase.h"
-
-/*---------------------------------------------------------------------------*/
-/*                           Local Module declaration                        */
-/*---------------------------------------------------------------------------*/
-
-namespace MARTe {
-
-namespace HeapManager /*Internals*/{
-
-/**
- * @brief The heap database size.
- */
-static const int32 MaximumNumberOfHeaps = 16;
-
-/**
- * @brief Class to store HeapI pointers.
- * @details This class allows to store and recover pointers to HeapI objects,
- * which are addressable by a numeric index. It also offers methods for
- * locking the access to the database. It is intended to be created following
- * the singleton pattern by means of the Instance method.
- */
-class HeapDatabase: public GlobalObjectI {
-
-    /**
-     * @brief Lists all heaps
-     * all unused heaps have a NULL pointer.
-     */
-    HeapI * heaps[MaximumNumberOfHeaps];
-
-    /**
-     * @brief Internal mutex semaphore.
-     */
-    FastPollingMutexSem mux;
-
-public:
-    /**
-     * @brief Singleton access to the database.
-     * @return a reference to the database.
-     */
-    static HeapDatabase *Instance();
-
-    /**
-     * @brief Destructor NOOP.
-     */
-    virtual ~HeapDatabase();
-
-    /**
-     * @brief gets the HeapI contained in a given slot of the database
-     * @param[in] index indicates the slots of the database
-     * @return NULL index out of range or if empty slot
-     * */
-    HeapI *GetHeap(int32 index) const;
-
-    /**
-     * @brief sets the HeapI in a given slot of the database
-     * @param[in] index indicates the slots of the database
-     * @param[in] heap  is the desired heap to store
-     * @return true if index is within range; specified slot is free; and heap is not NULL
-     * */
-    bool SetHeap(int32 index,
-                 HeapI * const heap);
-
-    /**
-     * @brief sets to NULL a given slot of the database
-     * @param[in] index indicates the slots of the database
-     * @param[in] heap must contain the same value as in the database
-     * @return true if index is within range; specified slot contains heapl heap is not NULL
-     * */
-    bool UnsetHeap(int32 index,
-                   const HeapI *heap);
-
-    /**
-     * @brief constructor
-     * */
-    HeapDatabase();
-
-    /**
-     * @brief locks access to database
-     * @return true if locking successful
-     * */
-    bool Lock();
-
-    /**
-     * @brief unlocks access to database
-     * */
-    void UnLock();
-
-    /**
-     * @brief Returns "HeapDatabase".
-     * @return "HeapDatabase".
-     */
-    virtual const char8 * const GetClassName() const;
-
-};
-
-/*---------------------------------------------------------------------------*/
-/*                           Static definitions                              */
-/*---------------------------------------------------------------------------*/
-
-HeapDatabase *HeapDatabase::Instance() {
-    static HeapDatabase *instance = NULL_PTR(HeapDatabase *);
-    if (instance == NULL_PTR(HeapDatabase *)) {
-        instance = new HeapDatabase();
-        GlobalObjectsDatabase::Instance()->Add(instance, NUMBER_OF_GLOBAL_OBJECTS - 1u);
-    }
-    return instance;
-}
-
-/*---------------------------------------------------------------------------*/
-/*                           Method definitions                              */
-/*---------------------------------------------------------------------------*/
-
-HeapI *HeapDatabase::GetHeap(const int32 index) const {
-    HeapI *returnValue = NULL_PTR(HeapI *);
-    if ((index >= 0) && (index < MaximumNumberOfHeaps)) {
-        returnValue = heaps[index];
-    }
-
-    return returnValue;
-}
-
-bool HeapDatabase::SetHeap(const int32 index,
-                           HeapI * const heap) {
-    bool ok = false;
-    if ((index >= 0) && (index < MaximumNumberOfHeaps)) {
-
-        if ((heaps[index] == NULL) && (heap != NULL)) {
-            heaps[index] = heap;
-            ok = true;
-        }
-
-    }
-    return ok;
-}
-
-bool HeapDatabase::UnsetHeap(const int32 index,
-                             const HeapI * const heap) {
-    bool ok = false;
-    if ((index >= 0) && (index < MaximumNumberOfHeaps)) {
-        if (heaps[index] == heap) {
-            heaps[index] = NULL_PTR(HeapI *);
-            ok = true;
-        }
-    }
-
-    return ok;
-}
-
-HeapDatabase::HeapDatabase() {
-    int32 i;
-    for (i = 0; i < MaximumNumberOfHeaps; i++) {
-        heaps[i] = NULL_PTR(HeapI *);
-    }
-}
-
-HeapDatabase::~HeapDatabase() {
-}
-
-bool HeapDatabase::Lock() {
-    return (mux.FastLock() == ErrorManagement::NoError);
-}
-
-void HeapDatabase::UnLock() {
-    mux.FastUnLock();
-}
-
-const char8 * const HeapDatabase::GetClassName() const {
-    return "HeapDatabase";
-}
-
-HeapI *FindHeap(const void * const address) {
-
-    /*
-     address range of currently found heap
-     */
-    uintp foundSpan = 0U;
-
-    /*
-     * the search will set this pointer to point to the heap found
-     * by default return the standard heap
-     */
-    HeapI *foundHeap = NULL_PTR(HeapI *);
-
-    /* controls access to database */
-    if (HeapDatabase::Instance()->Lock()) {
-
-        int32 i;
-        for (i = 0; (i < MaximumNumberOfHeaps); i++) {
-
-            /* retrieve heap information in current slot */
-            HeapI *heap = HeapDatabase::Instance()->GetHeap(i);
-            /* if slot used */
-            if (heap != NULL_PTR(HeapI *)) {
-                /* check address compatibility */
-                if (heap->Owns(address)) {
-                    /* check if first occurrence or */
-                    if (foundHeap == NULL_PTR(HeapI *)) {
-                        /* size of memory space */
-                        foundSpan = heap->LastAddress() - heap->FirstAddress();
-                        /* save heap */
-                        foundHeap = heap;
-                    }
-                    else { /* further occurrences */
-
-                        /* size of memory space */
-                        uintp newFoundSpan = heap->LastAddress() - heap->FirstAddress();
-
-                        /*
-                         * smaller memory span and intersecting memory address space
-                         * it can only mean that this heap is a sub-heap of the previously found heap
-                         */
-                        if (newFoundSpan < foundSpan) {
-                            /* save size of memory space */
-                            foundSpan = newFoundSpan;
-                            /* save heap */
-                            foundHeap = heap;
-                        } // end if (newFoundSpan < foundSpan)
-
-                    } /* end of check first occurrence */
-
-                } /* end check address compatibility */
-
-            } /* end if heap != NULL */
-
-        } /* end i loop */
-
-        HeapDatabase::Instance()->UnLock();
-    }
-
-    /* assign to heap the found heap or the default one */
-    if ((foundHeap == NULL_PTR(HeapI *))) {
-
-        /* try default heap */
-        foundHeap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
-
-        /* check ownership of default heap */
-        if (!foundHeap->Owns(address)) {
-            foundHeap = NULL_PTR(HeapI *);
-        }
-
-    }
-
-    return foundHeap;
-}
-
-HeapI *FindHeap(const char8 * const name) {
-
-    bool ok = (name != NULL);
-
-    /*
-     * found heap
-     */
-    bool found = false;
-
-    /*
-     * the search will set this pointer to point to the heap found
-     */
-    HeapI *foundHeap = NULL_PTR(HeapI *);
-
-    if (ok) {
-
-        /* controls access to database */
-        if (HeapDatabase::Instance()->Lock()) {
-            int32 i;
-            for (i = 0; (i < MaximumNumberOfHeaps) && (!found); i++) {
-
-                /* retrieve heap information in current slot */
-                HeapI *heap = HeapDatabase::Instance()->GetHeap(i);
-
-                /* if slot used */
-                if (heap != NULL_PTR(HeapI *)) {
-
-                    /* check address compatibility */
-                    if (StringHelper::Compare(heap->Name(), name) == 0) {
-
-                        found = true;
-
-                        foundHeap = heap;
-
-                    } /* end check name */
-
-                } /* end if heap != NULL */
-
-            } /* end i loop */
-            HeapDatabase::Instance()->UnLock();
-        }
-    }
-
-    return foundHeap;
-}
-
-bool Free(void *&data) {
-    HeapI *heap = FindHeap(data);
-
-    bool ok = false;
-    /* Does not belong to any heap?*/
-    if ((heap != NULL_PTR(HeapI *))) {
-        heap->Free(data);
-        ok = true;
-
-    }
-    else {
-
-        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Error: the pointer in input does not belong to any heap");
-
-    }
-
-    return ok;
-}
-
-void *Malloc(uint32 const size,
-             const char8 * const heapName) {
-
-    void *address = NULL_PTR(void *);
-
-    /* Standard behavior */
-    if (heapName == NULL) {
-        address = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(size);
-    }
-    else {
-
-        HeapI *heap = FindHeap(heapName);
-
-        if (heap != NULL) {
-            address = heap->Malloc(size);
-        }
-        else {
-            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Error: no heaps with the specified name found");
-        }
-
-    }
-
-    return address;
-}
-
-void *Realloc(void *&data,
-              const uint32 newSize) {
-    void *newAddress = NULL_PTR(void *);
-
-    HeapI *chosenHeap = FindHeap(data);
-
-    if (chosenHeap != NULL) {
-        newAddress = chosenHeap->Realloc(data, newSize);
-    }
-    //if the heap is not found (the data is null) allocates it on the standard heap (C malloc).
-    else {
-        newAddress = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Realloc(data, newSize);
-    }
-
-    return newAddress;
-}
-
-void *Duplicate(const void * const data,
-                const uint32 size,
-                const char8 * const heapName) {
-    void *newAddress = NULL_PTR(void *);
-
-    HeapI *chosenHeap = NULL_PTR(HeapI *);
-
-    //if the heapName is not null searches the heap by name
-    if (heapName != NULL) {
-        chosenHeap = FindHeap(heapName);
-    }
-
-    //if the heap with that name is not found calls the find by address
-    if (chosenHeap == NULL) {
-        chosenHeap = FindHeap(data);
-    }
-
-    // if found calls the correct heap duplicate
-    if (chosenHeap != NULL) {
-        newAddress = chosenHeap->Duplicate(data, size);
-    }
-    // if the address is not found considers the memory as a static
-    else {
-        //REPORT_ERROR(ErrorManagement::Warning, "ErrorManagement::Warning: the input address does not belong to any heap. It will be considered as a static memory address");
-        newAddress = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Duplicate(data, size);
-    }
-    return newAddress;
-
-}
-
-bool AddHeap(HeapI * const newHeap) {
-
-    bool ok = true;
-
-    /* check value of heap not to be NULL */
-    if (newHeap == NULL_PTR(HeapI *)) {
-        ok = false;
-    }
-
-    /* controls access to database */
-    if (HeapDatabase::Instance()->Lock()) {
-        int32 i;
-        /* check if not registered already */
-        for (i = 0; (i < MaximumNumberOfHeaps) && ok; i++) {
-            /* retrieve heap information in current slot */
-            HeapI *heap = HeapDatabase::Instance()->GetHeap(i);
-
-            /* already found */
-            if (heap == newHeap) {
-                ok = false;
-
-                //Do not uncomment this line. The HeapManager cannot use the REPORT_ERROR since the HeapDatabase::Instance() is locked and
-                // the user callback function could use the HeapDatabase, e.g. by using a StreamString
-                //REPORT_ERROR(ErrorManagement::FatalError, "Error: heap already registered in the database");
-
-            }
-        }
-
-        /* check if space available and if so register it  */
-        if (ok) {
-
-            bool found = false;
-            /* for each slot  */
-            for (i = 0; (i < MaximumNumberOfHeaps) && (!found); i++) {
-                /* try to set each slot */
-                found = HeapDatabase::Instance()->SetHeap(i, newHeap);
-            }
-
-            /* no more space */
-            if (!found) {
-                ok = false;
-                //Do not uncomment this line. The HeapManager cannot use the REPORT_ERROR since the HeapDatabase::Instance() is locked and
-                // the user callback function could use the HeapDatabase, e.g. by using a StreamString
-                //REPORT_ERROR(ErrorManagement::FatalError, "Error: not enough space in the database for new records");
-
-            }
-
-        }
-        /* controls access to database */
-        HeapDatabase::Instance()->UnLock();
-    }
-    return ok;
-}
-
-bool RemoveHeap(const HeapI * const heap) {
-
-    bool found = false;
-
-    /* controls access to database */
-    if (HeapDatabase::Instance()->Lock()) {
-        int32 i;
-        /* check if not registered already */
-        for (i = 0; (i < MaximumNumberOfHeaps) && (!found); i++) {
-            /* retrieve heap information in current slot */
-            found = HeapDatabase::Instance()->UnsetHeap(i, heap);
-        }
-        /* controls access to database */
-        HeapDatabase::Instance()->UnLock();
-    }
-
-    return found;
-}
-
-}
-
-}
+/**
+ * @file HeapManager.cpp
+ * @brief Source file for module HeapManager
+ * @date 07/08/2015
+ * @author Filippo Sartori
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module HeapManager (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+#define DLL_API
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "HeapManager.h"
+#include "Atomic.h"
+#include "FastPollingMutexSem.h"
+#include "GeneralDefinitions.h"
+#include "HeapI.h"
+#include "StringHelper.h"
+#include "GlobalObjectI.h"
+#include "GlobalObjectsDatabase.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Local Module declaration                        */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace HeapManager /*Internals*/{
+
+/**
+ * @brief The heap database size.
+ */
+static const int32 MaximumNumberOfHeaps = 16;
+
+/**
+ * @brief Class to store HeapI pointers.
+ * @details This class allows to store and recover pointers to HeapI objects,
+ * which are addressable by a numeric index. It also offers methods for
+ * locking the access to the database. It is intended to be created following
+ * the singleton pattern by means of the Instance method.
+ */
+class HeapDatabase: public GlobalObjectI {
+
+    /**
+     * @brief Lists all heaps
+     * all unused heaps have a NULL pointer.
+     */
+    HeapI * heaps[MaximumNumberOfHeaps];
+
+    /**
+     * @brief Internal mutex semaphore.
+     */
+    FastPollingMutexSem mux;
+
+    /**
+     * @brief The address range of a registered heap.
+     */
+    struct HeapRange {
+        /**
+         * HeapI::FirstAddress of the heap.
+         */
+        uintp first;
+        /**
+         * HeapI::LastAddress of the heap.
+         */
+        uintp last;
+        /**
+         * The maximum last address of this and all the previous ranges in the table.
+         */
+        uintp maxLast;
+        /**
+         * The slot of the heap.
+         */
+        int32 index;
+    };
+
+    /**
+     * @brief The allocation counters of a heap.
+     */
+    struct HeapCounters {
+        /**
+         * @see HeapStatistics::numberOfAllocations
+         */
+        volatile int64 numberOfAllocations;
+        /**
+         * @see HeapStatistics::numberOfFrees
+         */
+        volatile int64 numberOfFrees;
+        /**
+         * @see HeapStatistics::numberOfFailures
+         */
+        volatile int64 numberOfFailures;
+        /**
+         * @see HeapStatistics::allocatedBytes
+         */
+        volatile int64 allocatedBytes;
+        /**
+         * @see HeapStatistics::blocksInUse
+         */
+        volatile int64 blocksInUse;
+        /**
+         * @see HeapStatistics::maxBlocksInUse
+         */
+        volatile int64 maxBlocksInUse;
+        /**
+         * @see HeapStatistics::realTimeAllocations
+         */
+        volatile int64 realTimeAllocations;
+        /**
+         * @see HeapStatistics::realTimeFrees
+         */
+        volatile int64 realTimeFrees;
+    };
+
+    /**
+     * @brief The address ranges of the registered heaps sorted by the first address
+     * (and by decreasing span for equal first addresses).
+     */
+    HeapRange ranges[MaximumNumberOfHeaps];
+
+    /**
+     * @brief The number of elements in ranges.
+     */
+    int32 numberOfRanges;
+
+    /**
+     * @brief The allocation counters of each slot. The last element is for the standard heap.
+     */
+    HeapCounters counters[MaximumNumberOfHeaps + 1];
+
+    /**
+     * @brief The most recent violations (the slot of the violation n is n % HEAP_MANAGER_REAL_TIME_VIOLATIONS).
+     */
+    RealTimeViolation violations[HEAP_MANAGER_REAL_TIME_VIOLATIONS];
+
+    /**
+     * @brief The total number of violations.
+     */
+    volatile int64 numberOfViolations;
+
+    /**
+     * @brief Resets the allocation counters of a slot.
+     * @param[in] index the slot (MaximumNumberOfHeaps for the standard heap).
+     */
+    void ResetCounters(const int32 index);
+
+public:
+
+    /**
+     * @brief 1 if the real-time check is enabled (see SetRealTimeCheck).
+     */
+    volatile int32 realTimeCheck;
+
+    /**
+     * @brief The number of warm-up cycles of the real-time threads.
+     */
+    uint32 warmUpCycles;
+
+    /**
+     * @brief Singleton access to the database.
+     * @return a reference to the database.
+     */
+    static HeapDatabase *Instance();
+
+    /**
+     * @brief Destructor NOOP.
+     */
+    virtual ~HeapDatabase();
+
+    /**
+     * @brief gets the HeapI contained in a given slot of the database
+     * @param[in] index indicates the slots of the database
+     * @return NULL index out of range or if empty slot
+     * */
+    HeapI *GetHeap(int32 index) const;
+
+    /**
+     * @brief sets the HeapI in a given slot of the database
+     * @param[in] index indicates the slots of the database
+     * @param[in] heap  is the desired heap to store
+     * @return true if index is within range; specified slot is free; and heap is not NULL
+     * */
+    bool SetHeap(int32 index,
+                 HeapI * const heap);
+
+    /**
+     * @brief sets to NULL a given slot of the database
+     * @param[in] index indicates the slots of the database
+     * @param[in] heap must contain the same value as in the database
+     * @return true if index is within range; specified slot contains heapl heap is not NULL
+     * */
+    bool UnsetHeap(int32 index,
+                   const HeapI *heap);
+
+    /**
+     * @brief Rebuilds the table of address ranges of the registered heaps.
+     * @return true if any of the ranges changed.
+     * @pre Lock()
+     */
+    bool UpdateRanges();
+
+    /**
+     * @brief Searches the table of address ranges for the innermost heap that owns an address.
+     * @param[in] address the address to search.
+     * @return the slot of the heap or -1 if no heap in the table owns the \a address.
+     * @pre Lock()
+     */
+    int32 SearchRanges(const void * const address) const;
+
+    /**
+     * @brief Updates the allocation counters of a slot.
+     * @param[in] index the slot (MaximumNumberOfHeaps for the standard heap).
+     * @param[in] ok true if the allocation was successful.
+     * @param[in] size the number of bytes requested.
+     * @param[in] newBlock true if a new block was allocated (false for a reallocation).
+     */
+    void CountAllocation(const int32 index,
+                         const bool ok,
+                         const uint32 size,
+                         const bool newBlock);
+
+    /**
+     * @brief Updates the free counter of a slot.
+     * @param[in] index the slot (MaximumNumberOfHeaps for the standard heap).
+     */
+    void CountFree(const int32 index);
+
+    /**
+     * @brief Counts and records an operation made by a real-time thread after its warm-up cycles.
+     * @param[in] index the slot (MaximumNumberOfHeaps for the standard heap, -1 if not found).
+     * @param[in] heap the heap on which the operation was made.
+     * @param[in] operation the operation.
+     * @param[in] callSite the return address of the HeapManager function.
+     * @param[in] cycle the number of cycles executed by the thread.
+     */
+    void CountRealTime(const int32 index,
+                       const HeapI * const heap,
+                       const HeapOperation operation,
+                       const uintp callSite,
+                       const uint32 cycle);
+
+    /**
+     * @brief Resets the violations.
+     */
+    void ResetViolations();
+
+    /**
+     * @see HeapManager::GetRealTimeViolations
+     */
+    uint64 GetViolations(RealTimeViolation * const violationsOut,
+                         const uint32 maxViolations,
+                         uint32 &numberOfViolationsOut) const;
+
+    /**
+     * @brief Gets the allocation statistics of a slot.
+     * @param[in] index the slot (MaximumNumberOfHeaps for the standard heap).
+     * @param[out] statistics the allocation statistics.
+     */
+    void GetStatistics(const int32 index,
+                       HeapStatistics &statistics) const;
+
+    /**
+     * @brief constructor
+     * */
+    HeapDatabase();
+
+    /**
+     * @brief locks access to database
+     * @return true if locking successful
+     * */
+    bool Lock();
+
+    /**
+     * @brief unlocks access to database
+     * */
+    void UnLock();
+
+    /**
+     * @brief Returns "HeapDatabase".
+     * @return "HeapDatabase".
+     */
+    virtual const char8 * const GetClassName() const;
+
+};
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+HeapDatabase *HeapDatabase::Instance() {
+    static HeapDatabase *instance = NULL_PTR(HeapDatabase *);
+    if (instance == NULL_PTR(HeapDatabase *)) {
+        instance = new HeapDatabase();
+        GlobalObjectsDatabase::Instance()->Add(instance, NUMBER_OF_GLOBAL_OBJECTS - 1u);
+    }
+    return instance;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+HeapI *HeapDatabase::GetHeap(const int32 index) const {
+    HeapI *returnValue = NULL_PTR(HeapI *);
+    if ((index >= 0) && (index < MaximumNumberOfHeaps)) {
+        returnValue = heaps[index];
+    }
+
+    return returnValue;
+}
+
+bool HeapDatabase::SetHeap(const int32 index,
+                           HeapI * const heap) {
+    bool ok = false;
+    if ((index >= 0) && (index < MaximumNumberOfHeaps)) {
+
+        if ((heaps[index] == NULL) && (heap != NULL)) {
+            heaps[index] = heap;
+            ResetCounters(index);
+            (void) UpdateRanges();
+            ok = true;
+        }
+
+    }
+    return ok;
+}
+
+bool HeapDatabase::UnsetHeap(const int32 index,
+                             const HeapI * const heap) {
+    bool ok = false;
+    if ((index >= 0) && (index < MaximumNumberOfHeaps)) {
+        if (heaps[index] == heap) {
+            heaps[index] = NULL_PTR(HeapI *);
+            (void) UpdateRanges();
+            ok = true;
+        }
+    }
+
+    return ok;
+}
+
+HeapDatabase::HeapDatabase() {
+    int32 i;
+    for (i = 0; i < MaximumNumberOfHeaps; i++) {
+        heaps[i] = NULL_PTR(HeapI *);
+        ranges[i].first = 0u;
+        ranges[i].last = 0u;
+        ranges[i].maxLast = 0u;
+        ranges[i].index = -1;
+    }
+    for (i = 0; i <= MaximumNumberOfHeaps; i++) {
+        ResetCounters(i);
+    }
+    numberOfRanges = 0;
+    realTimeCheck = 0;
+    warmUpCycles = 0u;
+    ResetViolations();
+}
+
+void HeapDatabase::ResetCounters(const int32 index) {
+    counters[index].numberOfAllocations = 0;
+    counters[index].numberOfFrees = 0;
+    counters[index].numberOfFailures = 0;
+    counters[index].allocatedBytes = 0;
+    counters[index].blocksInUse = 0;
+    counters[index].maxBlocksInUse = 0;
+    counters[index].realTimeAllocations = 0;
+    counters[index].realTimeFrees = 0;
+}
+
+bool HeapDatabase::UpdateRanges() {
+    HeapRange newRanges[MaximumNumberOfHeaps];
+    int32 n = 0;
+    int32 i;
+    for (i = 0; i < MaximumNumberOfHeaps; i++) {
+        if (heaps[i] != NULL_PTR(HeapI *)) {
+            HeapRange range;
+            range.first = heaps[i]->FirstAddress();
+            range.last = heaps[i]->LastAddress();
+            range.maxLast = 0u;
+            range.index = i;
+            //Insertion sort by first address and, for the same first address, by decreasing span
+            int32 j = n;
+            bool moved = true;
+            while ((j > 0) && (moved)) {
+                const HeapRange &previous = newRanges[j - 1];
+                moved = (previous.first > range.first) || ((previous.first == range.first) && (previous.last < range.last));
+                if (moved) {
+                    newRanges[j] = previous;
+                    j--;
+                }
+            }
+            newRanges[j] = range;
+            n++;
+        }
+    }
+    bool changed = (n != numberOfRanges);
+    uintp maxLast = 0u;
+    for (i = 0; i < n; i++) {
+        if (newRanges[i].last > maxLast) {
+            maxLast = newRanges[i].last;
+        }
+        newRanges[i].maxLast = maxLast;
+        if (!changed) {
+            changed = (newRanges[i].first != ranges[i].first) || (newRanges[i].last != ranges[i].last) || (newRanges[i].index != ranges[i].index);
+        }
+    }
+    if (changed) {
+        for (i = 0; i < n; i++) {
+            ranges[i] = newRanges[i];
+        }
+        numberOfRanges = n;
+    }
+    return changed;
+}
+
+int32 HeapDatabase::SearchRanges(const void * const address) const {
+    /*lint -e{9091} -e{923} the casting from pointer type to integer type is required to compare with the heap ranges*/
+    uintp addressValue = reinterpret_cast<uintp>(address);
+    //Number of ranges with first <= address
+    int32 low = 0;
+    int32 high = numberOfRanges;
+    while (low < high) {
+        int32 middle = (low + high) / 2;
+        if (ranges[middle].first <= addressValue) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+    //The innermost heap is the one with the largest first address that contains the address.
+    //Stop as soon as no previous range can reach the address.
+    int32 found = -1;
+    int32 i = low - 1;
+    while ((i >= 0) && (found < 0)) {
+        if (ranges[i].maxLast < addressValue) {
+            i = -1;
+        }
+        else {
+            if (ranges[i].last >= addressValue) {
+                if (heaps[ranges[i].index]->Owns(address)) {
+                    found = ranges[i].index;
+                }
+            }
+            i--;
+        }
+    }
+    return found;
+}
+
+void HeapDatabase::CountAllocation(const int32 index,
+                                   const bool ok,
+                                   const uint32 size,
+                                   const bool newBlock) {
+    if ((index >= 0) && (index <= MaximumNumberOfHeaps)) {
+        if (ok) {
+            if (newBlock) {
+                (void) Atomic::FetchAdd(&counters[index].numberOfAllocations, 1, Atomic::MemoryOrderRelaxed);
+                int64 inUse = Atomic::FetchAdd(&counters[index].blocksInUse, 1, Atomic::MemoryOrderRelaxed) + 1;
+                int64 maxInUse = Atomic::Load(&counters[index].maxBlocksInUse, Atomic::MemoryOrderRelaxed);
+                //On failure maxInUse is updated with the current high-water mark
+                while (inUse > maxInUse) {
+                    if (Atomic::CompareExchange(&counters[index].maxBlocksInUse, maxInUse, inUse, Atomic::MemoryOrderRelaxed)) {
+                        maxInUse = inUse;
+                    }
+                }
+            }
+            (void) Atomic::FetchAdd(&counters[index].allocatedBytes, static_cast<int64>(size), Atomic::MemoryOrderRelaxed);
+        }
+        else {
+            (void) Atomic::FetchAdd(&counters[index].numberOfFailures, 1, Atomic::MemoryOrderRelaxed);
+        }
+    }
+}
+
+void HeapDatabase::CountFree(const int32 index) {
+    if ((index >= 0) && (index <= MaximumNumberOfHeaps)) {
+        (void) Atomic::FetchAdd(&counters[index].numberOfFrees, 1, Atomic::MemoryOrderRelaxed);
+        (void) Atomic::FetchAdd(&counters[index].blocksInUse, -1, Atomic::MemoryOrderRelaxed);
+    }
+}
+
+void HeapDatabase::CountRealTime(const int32 index,
+                                 const HeapI * const heap,
+                                 const HeapOperation operation,
+                                 const uintp callSite,
+                                 const uint32 cycle) {
+    if ((index >= 0) && (index <= MaximumNumberOfHeaps)) {
+        if (operation == HeapOperationFree) {
+            (void) Atomic::FetchAdd(&counters[index].realTimeFrees, 1, Atomic::MemoryOrderRelaxed);
+        }
+        else {
+            (void) Atomic::FetchAdd(&counters[index].realTimeAllocations, 1, Atomic::MemoryOrderRelaxed);
+        }
+    }
+    //Concurrent violations use different slots, unless more than HEAP_MANAGER_REAL_TIME_VIOLATIONS are recorded at the same time
+    uint64 n = static_cast<uint64>(Atomic::FetchAdd(&numberOfViolations, 1, Atomic::MemoryOrderRelaxed));
+    uint32 slot = static_cast<uint32>(n % HEAP_MANAGER_REAL_TIME_VIOLATIONS);
+    violations[slot].callSite = callSite;
+    violations[slot].heap = heap;
+    violations[slot].operation = operation;
+    violations[slot].cycle = cycle;
+}
+
+void HeapDatabase::ResetViolations() {
+    uint32 i;
+    for (i = 0u; i < HEAP_MANAGER_REAL_TIME_VIOLATIONS; i++) {
+        violations[i].callSite = 0u;
+        violations[i].heap = NULL_PTR(const HeapI *);
+        violations[i].operation = HeapOperationMalloc;
+        violations[i].cycle = 0u;
+    }
+    numberOfViolations = 0;
+}
+
+uint64 HeapDatabase::GetViolations(RealTimeViolation * const violationsOut,
+                                   const uint32 maxViolations,
+                                   uint32 &numberOfViolationsOut) const {
+    uint64 total = static_cast<uint64>(Atomic::Load(&numberOfViolations, Atomic::MemoryOrderRelaxed));
+    uint64 available = total;
+    if (available > HEAP_MANAGER_REAL_TIME_VIOLATIONS) {
+        available = HEAP_MANAGER_REAL_TIME_VIOLATIONS;
+    }
+    if (available > maxViolations) {
+        available = maxViolations;
+    }
+    numberOfViolationsOut = static_cast<uint32>(available);
+    uint32 i;
+    for (i = 0u; i < numberOfViolationsOut; i++) {
+        uint64 n = (total - available) + i;
+        violationsOut[i] = violations[static_cast<uint32>(n % HEAP_MANAGER_REAL_TIME_VIOLATIONS)];
+    }
+    return total;
+}
+
+void HeapDatabase::GetStatistics(const int32 index,
+                                 HeapStatistics &statistics) const {
+    if ((index >= 0) && (index <= MaximumNumberOfHeaps)) {
+        statistics.numberOfAllocations = static_cast<uint64>(Atomic::Load(&counters[index].numberOfAllocations, Atomic::MemoryOrderRelaxed));
+        statistics.numberOfFrees = static_cast<uint64>(Atomic::Load(&counters[index].numberOfFrees, Atomic::MemoryOrderRelaxed));
+        statistics.numberOfFailures = static_cast<uint64>(Atomic::Load(&counters[index].numberOfFailures, Atomic::MemoryOrderRelaxed));
+        statistics.allocatedBytes = static_cast<uint64>(Atomic::Load(&counters[index].allocatedBytes, Atomic::MemoryOrderRelaxed));
+        int64 inUse = Atomic::Load(&counters[index].blocksInUse, Atomic::MemoryOrderRelaxed);
+        //The blocks allocated before the statistics were reset may be freed afterwards
+        if (inUse < 0) {
+            inUse = 0;
+        }
+        statistics.blocksInUse = static_cast<uint64>(inUse);
+        statistics.maxBlocksInUse = static_cast<uint64>(Atomic::Load(&counters[index].maxBlocksInUse, Atomic::MemoryOrderRelaxed));
+        statistics.realTimeAllocations = static_cast<uint64>(Atomic::Load(&counters[index].realTimeAllocations, Atomic::MemoryOrderRelaxed));
+        statistics.realTimeFrees = static_cast<uint64>(Atomic::Load(&counters[index].realTimeFrees, Atomic::MemoryOrderRelaxed));
+    }
+}
+
+HeapDatabase::~HeapDatabase() {
+}
+
+bool HeapDatabase::Lock() {
+    return (mux.FastLock() == ErrorManagement::NoError);
+}
+
+void HeapDatabase::UnLock() {
+    mux.FastUnLock();
+}
+
+const char8 * const HeapDatabase::GetClassName() const {
+    return "HeapDatabase";
+}
+
+/**
+ * @brief Finds the heap that owns an address and its slot in the database.
+ * @param[in] address the address to search.
+ * @param[out] index the slot of the heap (MaximumNumberOfHeaps for the standard heap and -1 if not found).
+ * @return the heap that owns the address or NULL if not found.
+ */
+static HeapI *FindHeapIndex(const void * const address,
+                            int32 &index) {
+    index = -1;
+
+    /*
+     * the search will set this pointer to point to the heap found
+     * by default return the standard heap
+     */
+    HeapI *foundHeap = NULL_PTR(HeapI *);
+
+    /* controls access to database */
+    if (HeapDatabase::Instance()->Lock()) {
+
+        index = HeapDatabase::Instance()->SearchRanges(address);
+
+        /* the range of a heap may have grown since the table was last updated */
+        if (index < 0) {
+            if (HeapDatabase::Instance()->UpdateRanges()) {
+                index = HeapDatabase::Instance()->SearchRanges(address);
+            }
+        }
+
+        if (index >= 0) {
+            foundHeap = HeapDatabase::Instance()->GetHeap(index);
+        }
+
+        HeapDatabase::Instance()->UnLock();
+    }
+
+    /* assign to heap the found heap or the default one */
+    if ((foundHeap == NULL_PTR(HeapI *))) {
+
+        /* try default heap */
+        foundHeap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
+        index = MaximumNumberOfHeaps;
+
+        /* check ownership of default heap */
+        if (!foundHeap->Owns(address)) {
+            foundHeap = NULL_PTR(HeapI *);
+            index = -1;
+        }
+
+    }
+
+    return foundHeap;
+}
+
+/**
+ * @brief Finds a heap by name and its slot in the database.
+ * @param[in] name the name of the heap.
+ * @param[out] index the slot of the heap (-1 if not found).
+ * @return the heap with the specified name or NULL if not found.
+ */
+static HeapI *FindHeapIndex(const char8 * const name,
+                            int32 &index) {
+
+    bool ok = (name != NULL);
+
+    /*
+     * found heap
+     */
+    bool found = false;
+
+    /*
+     * the search will set this pointer to point to the heap found
+     */
+    HeapI *foundHeap = NULL_PTR(HeapI *);
+    index = -1;
+
+    if (ok) {
+
+        /* controls access to database */
+        if (HeapDatabase::Instance()->Lock()) {
+            int32 i;
+            for (i = 0; (i < MaximumNumberOfHeaps) && (!found); i++) {
+
+                /* retrieve heap information in current slot */
+                HeapI *heap = HeapDatabase::Instance()->GetHeap(i);
+
+                /* if slot used */
+                if (heap != NULL_PTR(HeapI *)) {
+
+                    /* check address compatibility */
+                    if (StringHelper::Compare(heap->Name(), name) == 0) {
+
+                        found = true;
+
+                        foundHeap = heap;
+                        index = i;
+
+                    } /* end check name */
+
+                } /* end if heap != NULL */
+
+            } /* end i loop */
+            HeapDatabase::Instance()->UnLock();
+        }
+    }
+
+    return foundHeap;
+}
+
+#ifdef THREAD_LOCAL
+/**
+ * @brief The number of cycles executed by the calling thread (0 if it is not a real-time thread, see RealTimeCycle).
+ */
+static THREAD_LOCAL uint32 realTimeThreadCycles = 0u;
+#endif
+
+/**
+ * @brief Counts and records an operation if the calling thread is a real-time thread after its warm-up cycles.
+ * @param[in] index the slot of the heap.
+ * @param[in] heap the heap on which the operation was made.
+ * @param[in] operation the operation.
+ * @param[in] callSite the return address of the HeapManager function.
+ */
+static void CheckRealTime(const int32 index,
+                          const HeapI * const heap,
+                          const HeapOperation operation,
+                          const void * const callSite) {
+#ifdef THREAD_LOCAL
+    HeapDatabase *database = HeapDatabase::Instance();
+    if (Atomic::Load(&database->realTimeCheck, Atomic::MemoryOrderRelaxed) != 0) {
+        if (realTimeThreadCycles > database->warmUpCycles) {
+            /*lint -e{923} the call site is only recorded as a number*/
+            database->CountRealTime(index, heap, operation, reinterpret_cast<uintp>(callSite), realTimeThreadCycles);
+        }
+    }
+#endif
+}
+
+HeapI *FindHeap(const void * const address) {
+    int32 index;
+    return FindHeapIndex(address, index);
+}
+
+HeapI *FindHeap(const char8 * const name) {
+    int32 index;
+    return FindHeapIndex(name, index);
+}
+
+bool Free(void *&data) {
+    int32 index;
+    HeapI *heap = FindHeapIndex(data, index);
+
+    bool ok = false;
+    /* Does not belong to any heap?*/
+    if ((heap != NULL_PTR(HeapI *))) {
+        heap->Free(data);
+        HeapDatabase::Instance()->CountFree(index);
+        CheckRealTime(index, heap, HeapOperationFree, __builtin_return_address(0u));
+        ok = true;
+
+    }
+    else {
+
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Error: the pointer in input does not belong to any heap");
+
+    }
+
+    return ok;
+}
+
+void *Malloc(uint32 const size,
+             const char8 * const heapName) {
+
+    void *address = NULL_PTR(void *);
+
+    /* Standard behavior */
+    if (heapName == NULL) {
+        HeapI *standardHeap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
+        address = standardHeap->Malloc(size);
+        HeapDatabase::Instance()->CountAllocation(MaximumNumberOfHeaps, (address != NULL), size, true);
+        CheckRealTime(MaximumNumberOfHeaps, standardHeap, HeapOperationMalloc, __builtin_return_address(0u));
+    }
+    else {
+
+        int32 index;
+        HeapI *heap = FindHeapIndex(heapName, index);
+
+        if (heap != NULL) {
+            address = heap->Malloc(size);
+            HeapDatabase::Instance()->CountAllocation(index, (address != NULL), size, true);
+            CheckRealTime(index, heap, HeapOperationMalloc, __builtin_return_address(0u));
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Error: no heaps with the specified name found");
+        }
+
+    }
+
+    return address;
+}
+
+void *Realloc(void *&data,
+              const uint32 newSize) {
+    void *newAddress = NULL_PTR(void *);
+
+    int32 index;
+    HeapI *chosenHeap = FindHeapIndex(data, index);
+    bool newBlock = (data == NULL);
+
+    //if the heap is not found (the data is null) allocates it on the standard heap (C malloc).
+    if (chosenHeap == NULL) {
+        index = MaximumNumberOfHeaps;
+        chosenHeap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
+    }
+    newAddress = chosenHeap->Realloc(data, newSize);
+
+    if (newSize == 0u) {
+        if (!newBlock) {
+            HeapDatabase::Instance()->CountFree(index);
+            CheckRealTime(index, chosenHeap, HeapOperationFree, __builtin_return_address(0u));
+        }
+    }
+    else {
+        HeapDatabase::Instance()->CountAllocation(index, (newAddress != NULL), newSize, newBlock);
+        CheckRealTime(index, chosenHeap, HeapOperationRealloc, __builtin_return_address(0u));
+    }
+
+    return newAddress;
+}
+
+void *Duplicate(const void * const data,
+                const uint32 size,
+                const char8 * const heapName) {
+    void *newAddress = NULL_PTR(void *);
+
+    HeapI *chosenHeap = NULL_PTR(HeapI *);
+    int32 index = -1;
+
+    //if the heapName is not null searches the heap by name
+    if (heapName != NULL) {
+        chosenHeap = FindHeapIndex(heapName, index);
+    }
+
+    //if the heap with that name is not found calls the find by address
+    if (chosenHeap == NULL) {
+        chosenHeap = FindHeapIndex(data, index);
+    }
+
+    // if found calls the correct heap duplicate
+    if (chosenHeap != NULL) {
+        newAddress = chosenHeap->Duplicate(data, size);
+    }
+    // if the address is not found considers the memory as a static
+    else {
+        //REPORT_ERROR(ErrorManagement::Warning, "ErrorManagement::Warning: the input address does not belong to any heap. It will be considered as a static memory address");
+        index = MaximumNumberOfHeaps;
+        chosenHeap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
+        newAddress = chosenHeap->Duplicate(data, size);
+    }
+    CheckRealTime(index, chosenHeap, HeapOperationDuplicate, __builtin_return_address(0u));
+
+    if (data != NULL) {
+        uint32 duplicatedSize = size;
+        if (duplicatedSize == 0u) {
+            duplicatedSize = StringHelper::Length(static_cast<const char8 *>(data)) + 1u;
+        }
+        HeapDatabase::Instance()->CountAllocation(index, (newAddress != NULL), duplicatedSize, true);
+    }
+    return newAddress;
+
+}
+
+bool AddHeap(HeapI * const newHeap) {
+
+    bool ok = true;
+
+    /* check value of heap not to be NULL */
+    if (newHeap == NULL_PTR(HeapI *)) {
+        ok = false;
+    }
+
+    /* controls access to database */
+    if (HeapDatabase::Instance()->Lock()) {
+        int32 i;
+        /* check if not registered already */
+        for (i = 0; (i < MaximumNumberOfHeaps) && ok; i++) {
+            /* retrieve heap information in current slot */
+            HeapI *heap = HeapDatabase::Instance()->GetHeap(i);
+
+            /* already found */
+            if (heap == newHeap) {
+                ok = false;
+
+                //Do not uncomment this line. The HeapManager cannot use the REPORT_ERROR since the HeapDatabase::Instance() is locked and
+                // the user callback function could use the HeapDatabase, e.g. by using a StreamString
+                //REPORT_ERROR(ErrorManagement::FatalError, "Error: heap already registered in the database");
+
+            }
+        }
+
+        /* check if space available and if so register it  */
+        if (ok) {
+
+            bool found = false;
+            /* for each slot  */
+            for (i = 0; (i < MaximumNumberOfHeaps) && (!found); i++) {
+                /* try to set each slot */
+                found = HeapDatabase::Instance()->SetHeap(i, newHeap);
+            }
+
+            /* no more space */
+            if (!found) {
+                ok = false;
+                //Do not uncomment this line. The HeapManager cannot use the REPORT_ERROR since the HeapDatabase::Instance() is locked and
+                // the user callback function could use the HeapDatabase, e.g. by using a StreamString
+                //REPORT_ERROR(ErrorManagement::FatalError, "Error: not enough space in the database for new records");
+
+            }
+
+        }
+        /* controls access to database */
+        HeapDatabase::Instance()->UnLock();
+    }
+    return ok;
+}
+
+bool RemoveHeap(const HeapI * const heap) {
+
+    bool found = false;
+
+    /* controls access to database */
+    if (HeapDatabase::Instance()->Lock()) {
+        int32 i;
+        /* check if not registered already */
+        for (i = 0; (i < MaximumNumberOfHeaps) && (!found); i++) {
+            /* retrieve heap information in current slot */
+            found = HeapDatabase::Instance()->UnsetHeap(i, heap);
+        }
+        /* controls access to database */
+        HeapDatabase::Instance()->UnLock();
+    }
+
+    return found;
+}
+
+bool GetStatistics(const HeapI * const heap,
+                   HeapStatistics &statistics) {
+    int32 index = -1;
+    if (heap == GlobalObjectsDatabase::Instance()->GetStandardHeap()) {
+        index = MaximumNumberOfHeaps;
+    }
+    else if (HeapDatabase::Instance()->Lock()) {
+        int32 i;
+        for (i = 0; (i < MaximumNumberOfHeaps) && (index < 0); i++) {
+            if (HeapDatabase::Instance()->GetHeap(i) == heap) {
+                index = i;
+            }
+        }
+        HeapDatabase::Instance()->UnLock();
+    }
+    else {
+        //NOOP
+    }
+    bool ok = (index >= 0) && (heap != NULL_PTR(const HeapI *));
+    if (ok) {
+        HeapDatabase::Instance()->GetStatistics(index, statistics);
+    }
+    return ok;
+}
+
+uint32 ListHeaps(HeapI ** const heaps,
+                 const uint32 maxHeaps) {
+    uint32 n = 0u;
+    if (maxHeaps > 0u) {
+        heaps[n] = GlobalObjectsDatabase::Instance()->GetStandardHeap();
+        n++;
+    }
+    if (HeapDatabase::Instance()->Lock()) {
+        int32 i;
+        for (i = 0; (i < MaximumNumberOfHeaps) && (n < maxHeaps); i++) {
+            HeapI *heap = HeapDatabase::Instance()->GetHeap(i);
+            if (heap != NULL_PTR(HeapI *)) {
+                heaps[n] = heap;
+                n++;
+            }
+        }
+        HeapDatabase::Instance()->UnLock();
+    }
+    return n;
+}
+
+void SetRealTimeCheck(const bool enabled,
+                      const uint32 warmUpCycles) {
+    HeapDatabase *database = HeapDatabase::Instance();
+    if (enabled) {
+        if (Atomic::Load(&database->realTimeCheck, Atomic::MemoryOrderRelaxed) == 0) {
+            database->ResetViolations();
+        }
+        database->warmUpCycles = warmUpCycles;
+        Atomic::StoreRelease(&database->realTimeCheck, 1);
+    }
+    else {
+        Atomic::StoreRelease(&database->realTimeCheck, 0);
+    }
+}
+
+void RealTimeCycle() {
+#ifdef THREAD_LOCAL
+    if (realTimeThreadCycles < 0xFFFFFFFFu) {
+        realTimeThreadCycles++;
+    }
+#endif
+}
+
+uint64 GetRealTimeViolations(RealTimeViolation * const violations,
+                             const uint32 maxViolations,
+                             uint32 &numberOfViolations) {
+    return HeapDatabase::Instance()->GetViolations(violations, maxViolations, numberOfViolations);
+}
+
+}
+
+}
@@ -42,8 +42,98 @@ namespace MARTe {
 
 namespace HeapManager {
 
+/**
+ * @brief Allocation statistics of a heap.
+ * @details Only the operations performed through the HeapManager functions (Malloc, Free, Realloc and Duplicate)
+ * are counted. Calls made directly on the HeapI interface are not visible to the HeapManager.
+ */
+struct HeapStatistics {
+    /**
+     * Number of successful allocations (Malloc, Duplicate and Realloc of a NULL pointer).
+     */
+    uint64 numberOfAllocations;
+
+    /**
+     * Number of successful frees.
+     */
+    uint64 numberOfFrees;
+
+    /**
+     * Number of allocations that failed.
+     */
+    uint64 numberOfFailures;
+
+    /**
+     * Total number of bytes requested in successful allocations and reallocations.
+     */
+    uint64 allocatedBytes;
+
+    /**
+     * Number of blocks currently allocated (allocations - frees).
+     */
+    uint64 blocksInUse;
+
+    /**
+     * High-water mark of blocksInUse.
+     */
+    uint64 maxBlocksInUse;
+
+    /**
+     * Number of allocations (and reallocations) made by real-time threads after their warm-up cycles (see SetRealTimeCheck).
+     */
+    uint64 realTimeAllocations;
+
+    /**
+     * Number of frees made by real-time threads after their warm-up cycles (see SetRealTimeCheck).
+     */
+    uint64 realTimeFrees;
+};
+
+/**
+ * @brief The operations recorded in a RealTimeViolation.
+ */
+enum HeapOperation {
+    HeapOperationMalloc = 0,
+    HeapOperationFree,
+    HeapOperationRealloc,
+    HeapOperationDuplicate
+};
+
+/**
+ * @brief An allocation or free made by a real-time thread after its warm-up cycles (see SetRealTimeCheck).
+ */
+struct RealTimeViolation {
+    /**
+     * The return address of the call to the HeapManager function (to be resolved with e.g. addr2line).
+     */
+    uintp callSite;
+
+    /**
+     * The heap on which the operation was made (only to be compared, as it may no longer be registered).
+     */
+    const HeapI *heap;
+
+    /**
+     * The operation.
+     */
+    HeapOperation operation;
+
+    /**
+     * The number of cycles executed by the thread when the operation was made.
+     */
+    uint32 cycle;
+};
+
+/**
+ * The number of RealTimeViolation records kept by the HeapManager (the most recent ones).
+ */
+static const uint32 HEAP_MANAGER_REAL_TIME_VIOLATIONS = 16u;
+
 /**
  * @brief Finds the HeapI that manages the specified memory location in the database.
+ * @details The address ranges of the registered heaps are kept in a table sorted by the first address, so that
+ * the search is O(log n). As the range of a heap may grow after its registration, the table is refreshed
+ * (from HeapI::FirstAddress and HeapI::LastAddress) before concluding that no registered heap owns the address.
  * @param[in] address is a memory address that the target heap should manage.
  * @return a pointer to the HeapI that manages the specified memory location or
  * GetStandardHeap() if no one in HeapI objects' database manages that address.
@@ -125,6 +215,55 @@ DLL_API void *Duplicate(const void * const data,
                         const uint32 size = 0U,
                         const char8 * const heapName = NULL_PTR(char8 *));
 
+/**
+ * @brief Gets the allocation statistics of a heap.
+ * @details The statistics of a registered heap are reset when it is added to the database.
+ * @param[in] heap a registered heap or the standard heap.
+ * @param[out] statistics the allocation statistics of \a heap.
+ * @return true if \a heap is registered in the database or is the standard heap.
+ */
+DLL_API bool GetStatistics(const HeapI * const heap,
+                           HeapStatistics &statistics);
+
+/**
+ * @brief Lists the heaps whose statistics are kept.
+ * @param[out] heaps the standard heap followed by the registered heaps.
+ * @param[in] maxHeaps the number of elements of \a heaps.
+ * @return the number of heaps written in \a heaps.
+ */
+DLL_API uint32 ListHeaps(HeapI ** const heaps,
+                         const uint32 maxHeaps);
+
+/**
+ * @brief Enables (or disables) the detection of the allocations and frees made by the real-time threads.
+ * @details A thread is marked real-time by calling RealTimeCycle once per cycle (the GAMSchedulerI does it on every
+ * cycle it executes). Once a real-time thread executed more than \a warmUpCycles cycles, every Malloc, Free,
+ * Realloc and Duplicate that it calls is counted in the HeapStatistics of the heap (realTimeAllocations and
+ * realTimeFrees) and recorded, with the address from which it was called, as a RealTimeViolation. The errors
+ * cannot be reported from the HeapManager (REPORT_ERROR may allocate) and shall be read with GetRealTimeViolations.
+ * When disabled (the default) the cost of the check is a load of a global flag.
+ * @param[in] enabled true to enable the detection.
+ * @param[in] warmUpCycles the number of cycles of each real-time thread during which it may allocate memory.
+ */
+DLL_API void SetRealTimeCheck(const bool enabled,
+                              const uint32 warmUpCycles);
+
+/**
+ * @brief Marks the calling thread as real-time and counts one of its cycles (see SetRealTimeCheck).
+ */
+DLL_API void RealTimeCycle();
+
+/**
+ * @brief Gets the most recent RealTimeViolation records.
+ * @param[out] violations where the records are written, from the oldest to the most recent.
+ * @param[in] maxViolations the number of elements of \a violations.
+ * @param[out] numberOfViolations the number of records written in \a violations.
+ * @return the total number of violations detected since SetRealTimeCheck enabled the detection.
+ */
+DLL_API uint64 GetRealTimeViolations(RealTimeViolation * const violations,
+                                     const uint32 maxViolations,
+                                     uint32 &numberOfViolations);
+
 }
 
 }
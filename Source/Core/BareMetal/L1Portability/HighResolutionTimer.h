@@ -79,6 +79,24 @@ namespace MARTe {
          */
         inline float64 TicksToTime(uint64 tStop, uint64 tStart = 0u);
 
+        /**
+         * @brief Converts a number of HighResolutionTimer ticks to nanoseconds.
+         * @details Uses integer multiply-shift constants that are precomputed with
+         * the timer calibration, i.e. no floating point operation is performed
+         * (unless the interval is longer than ten minutes).
+         * @param[in] ticks is the number of ticks to convert.
+         * @return the number of nanoseconds.
+         */
+        inline uint64 TicksToNanoSeconds(const uint64 ticks);
+
+        /**
+         * @brief Converts a number of HighResolutionTimer ticks to microseconds.
+         * @see TicksToNanoSeconds.
+         * @param[in] ticks is the number of ticks to convert.
+         * @return the number of microseconds.
+         */
+        inline uint64 TicksToMicroSeconds(const uint64 ticks);
+
         /**
          * @brief Gets the current time stamp [microseconds, seconds, minutes, hour, day, month, year].
          * @see TimeValues.
@@ -0,0 +1,150 @@
+/**
+ * @file HybridEventSem.cpp
+ * @brief Source file for class HybridEventSem
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HybridEventSem (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#define DLL_API
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "HighResolutionTimer.h"
+#include "HybridEventSem.h"
+#include "Sleep.h"
+#include INCLUDE_FILE_ARCHITECTURE(BareMetal,L1Portability,ARCHITECTURE,ProcessorA.h)
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+HybridEventSem::HybridEventSem() :
+        event() {
+    spinWindow = 0u;
+    spinWindowTicks = 0u;
+    ResetStatistics();
+}
+
+void HybridEventSem::SetSpinWindow(const uint32 spinWindowIn) {
+    spinWindow = spinWindowIn;
+    spinWindowTicks = static_cast<uint64>((static_cast<float64>(spinWindow) * static_cast<float64>(HighResolutionTimer::Frequency())) / 1e9);
+}
+
+uint32 HybridEventSem::GetSpinWindow() const {
+    return spinWindow;
+}
+
+void HybridEventSem::Post() {
+    event.Post();
+}
+
+void HybridEventSem::Reset() {
+    event.Reset();
+}
+
+bool HybridEventSem::IsPosted() const {
+    return event.IsPosted();
+}
+
+ErrorManagement::ErrorType HybridEventSem::Wait(const TimeoutType &timeout) {
+    ErrorManagement::ErrorType err;
+    uint64 start = HighResolutionTimer::Counter();
+    uint64 window = spinWindowTicks;
+    uint64 timeoutTicks = 0u;
+    if (timeout.IsFinite()) {
+        timeoutTicks = timeout.HighResolutionTimerTicks();
+        if (timeoutTicks < window) {
+            window = timeoutTicks;
+        }
+    }
+    bool posted = event.IsPosted();
+    uint64 elapsed = 0u;
+    while ((!posted) && (elapsed < window)) {
+        Processor::SpinHint();
+        posted = event.IsPosted();
+        elapsed = HighResolutionTimer::Counter() - start;
+    }
+    statistics.spinTicks += elapsed;
+    if (posted) {
+        statistics.numberOfSpinWakes++;
+    }
+    else {
+        TimeoutType remaining = timeout;
+        if (timeout.IsFinite()) {
+            remaining.SetTimeoutHighResolutionTimerTicks((timeoutTicks > elapsed) ? (timeoutTicks - elapsed) : (0u));
+        }
+        err = event.Wait(remaining);
+        if (err.ErrorsCleared()) {
+            statistics.numberOfSleepWakes++;
+        }
+        else {
+            statistics.numberOfTimeouts++;
+        }
+    }
+    return err;
+}
+
+void HybridEventSem::WaitUntil(const uint64 absoluteTicks) {
+    uint64 now = HighResolutionTimer::Counter();
+    if ((now + spinWindowTicks) < absoluteTicks) {
+        //Operating system sleep only (the spin is accounted below)
+        Sleep::Hybrid(HighResolutionTimer::TicksToNanoSeconds((absoluteTicks - spinWindowTicks) - now), 0u);
+        now = HighResolutionTimer::Counter();
+    }
+    if (now < absoluteTicks) {
+        uint64 spinStart = now;
+        while (now < absoluteTicks) {
+            Processor::SpinHint();
+            now = HighResolutionTimer::Counter();
+        }
+        statistics.spinTicks += (now - spinStart);
+        statistics.numberOfSpinWakes++;
+    }
+    else {
+        statistics.numberOfSleepWakes++;
+    }
+    uint64 lateness = now - absoluteTicks;
+    if (lateness > statistics.worstLatenessTicks) {
+        statistics.worstLatenessTicks = lateness;
+    }
+}
+
+void HybridEventSem::GetStatistics(HybridEventSemStatistics &statisticsOut) const {
+    statisticsOut = statistics;
+}
+
+void HybridEventSem::ResetStatistics() {
+    statistics.numberOfSpinWakes = 0u;
+    statistics.numberOfSleepWakes = 0u;
+    statistics.numberOfTimeouts = 0u;
+    statistics.spinTicks = 0u;
+    statistics.worstLatenessTicks = 0u;
+}
+
+}
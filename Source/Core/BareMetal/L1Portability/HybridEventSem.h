@@ -0,0 +1,181 @@
+/**
+ * @file HybridEventSem.h
+ * @brief Header file for class HybridEventSem
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HybridEventSem
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef HYBRIDEVENTSEM_H_
+#define HYBRIDEVENTSEM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "AddressEventSem.h"
+#include "ErrorType.h"
+#include "GeneralDefinitions.h"
+#include "TimeoutType.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief The statistics of the waits of a HybridEventSem.
+ */
+struct HybridEventSemStatistics {
+    /**
+     * Number of waits which returned while busy waiting (i.e. without entering the operating system).
+     */
+    uint64 numberOfSpinWakes;
+
+    /**
+     * Number of waits which returned after blocking in the operating system.
+     */
+    uint64 numberOfSleepWakes;
+
+    /**
+     * Number of waits which expired.
+     */
+    uint64 numberOfTimeouts;
+
+    /**
+     * Total HighResolutionTimer ticks spent busy waiting.
+     */
+    uint64 spinTicks;
+
+    /**
+     * Worst lateness, in HighResolutionTimer ticks, of the WaitUntil with respect to the requested deadline.
+     */
+    uint64 worstLatenessTicks;
+};
+
+/**
+ * @brief Event semaphore for the synchronisation of a real-time thread, which busy waits for a configurable window before blocking
+ * in the operating system.
+ * @details Wait first polls the barrier (see Processor::SpinHint) for up to GetSpinWindow nano-seconds and only then blocks as an
+ * AddressEventSem. On an isolated core, where the Post is expected within the window, this saves the context switch and the wake-up
+ * latency of the operating system. WaitUntil applies the same principle to a deadline on the HighResolutionTimer (as Sleep::UntilTicks).
+ *
+ * The waits are accounted in HybridEventSemStatistics (see GetStatistics), so that the window can be tuned: a window which is too short
+ * gives mostly sleep wakes, a window which is too long burns the core (see HybridEventSemStatistics::spinTicks). The statistics are only
+ * updated by the waiting thread (i.e. only one thread shall Wait).
+ *
+ * With a window of 0 it behaves as an AddressEventSem.
+ */
+class DLL_API HybridEventSem {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   IsPosted() == false
+     *   GetSpinWindow() == 0
+     */
+    HybridEventSem();
+
+    /**
+     * @brief Sets the time to busy wait before blocking in the operating system.
+     * @param[in] spinWindowIn the window in nano-seconds.
+     */
+    void SetSpinWindow(const uint32 spinWindowIn);
+
+    /**
+     * @brief Gets the time to busy wait before blocking in the operating system.
+     * @return the window in nano-seconds.
+     */
+    uint32 GetSpinWindow() const;
+
+    /**
+     * @brief See AddressEventSem::Post.
+     */
+    void Post();
+
+    /**
+     * @brief See AddressEventSem::Reset.
+     */
+    void Reset();
+
+    /**
+     * @brief See AddressEventSem::IsPosted.
+     */
+    bool IsPosted() const;
+
+    /**
+     * @brief Waits until the barrier is lowered by a Post (or the timeout expires), busy waiting for up to the spin window first.
+     * @param[in] timeout the maximum time to wait (including the spin window).
+     * @return ErrorManagement::NoError if the barrier is (or is lowered while waiting), ErrorManagement::Timeout otherwise.
+     */
+    ErrorManagement::ErrorType Wait(const TimeoutType &timeout = TTInfiniteWait);
+
+    /**
+     * @brief Sleeps until the HighResolutionTimer reaches \a absoluteTicks, busy waiting for the last spin window.
+     * @details The operating system sleep is counted as a sleep wake if it overshot the spin window (i.e. there was nothing left to
+     * busy wait), as a spin wake otherwise. The lateness with respect to \a absoluteTicks is accounted in
+     * HybridEventSemStatistics::worstLatenessTicks.
+     * @param[in] absoluteTicks the deadline in HighResolutionTimer ticks.
+     */
+    void WaitUntil(const uint64 absoluteTicks);
+
+    /**
+     * @brief Gets the statistics of the waits since the construction or the last ResetStatistics.
+     * @param[out] statistics the statistics.
+     */
+    void GetStatistics(HybridEventSemStatistics &statistics) const;
+
+    /**
+     * @brief Resets the statistics.
+     */
+    void ResetStatistics();
+
+private:
+
+    /**
+     * The barrier.
+     */
+    AddressEventSem event;
+
+    /**
+     * The spin window in nano-seconds.
+     */
+    uint32 spinWindow;
+
+    /**
+     * The spin window in HighResolutionTimer ticks.
+     */
+    uint64 spinWindowTicks;
+
+    /**
+     * The statistics of the waits.
+     */
+    HybridEventSemStatistics statistics;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* HYBRIDEVENTSEM_H_ */
@@ -0,0 +1,188 @@
+/**
+ * @file InternedStringTable.cpp
+ * @brief Source file for class InternedStringTable
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class InternedStringTable (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "Atomic.h"
+#include "ErrorManagement.h"
+#include "GlobalObjectsDatabase.h"
+#include "InternedStringTable.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Stored immediately before the characters of each interned string.
+ */
+struct InternedStringHeader {
+    /**
+     * The WyHashFunction hash of the string.
+     */
+    uint32 hash;
+
+    /**
+     * The length of the string.
+     */
+    uint32 length;
+
+    /**
+     * The number of references to the string.
+     */
+    volatile int32 references;
+
+    /**
+     * Keeps the characters 16 bytes aligned.
+     */
+    uint32 reserved;
+};
+
+/*lint -e{927} -e{826} the header is allocated immediately before the characters.*/
+static InternedStringHeader *InternedStringGetHeader(const char8 * const interned) {
+    return reinterpret_cast<InternedStringHeader *>(const_cast<char8 *>(&interned[-static_cast<int32>(sizeof(InternedStringHeader))]));
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+InternedStringTable *InternedStringTable::Instance() {
+    static InternedStringTable *instance = NULL_PTR(InternedStringTable *);
+    if (instance == NULL_PTR(InternedStringTable *)) {
+        instance = new InternedStringTable();
+        //Destroyed last, as any Object name may be released until the ObjectRegistryDatabase is destroyed
+        GlobalObjectsDatabase::Instance()->Add(instance, NUMBER_OF_GLOBAL_OBJECTS - 1u);
+    }
+    return instance;
+}
+
+InternedStringTable::InternedStringTable() :
+        GlobalObjectI() {
+    mux.Create();
+}
+
+/*lint -e{1551} the destructor only frees memory.*/
+InternedStringTable::~InternedStringTable() {
+    //The strings still referenced are not freed, as they may be used by objects destroyed later
+}
+
+const char8 *InternedStringTable::Intern(const char8 * const string,
+                                         const uint32 size) {
+    char8 *interned = NULL_PTR(char8 *);
+    if (string != NULL) {
+        uint32 length = (size > 0u) ? (size) : (StringHelper::Length(string));
+        uint32 hash = index.Key(string, length);
+        if (mux.FastLock() != ErrorManagement::NoError) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "InternedStringTable: Failed FastLock()");
+        }
+        uint32 cursor = 0u;
+        char8 *candidate = NULL_PTR(char8 *);
+        while ((interned == NULL) && (index.Search(hash, cursor, candidate))) {
+            InternedStringHeader *header = InternedStringGetHeader(candidate);
+            if (header->length == length) {
+                if (MemoryOperationsHelper::Compare(candidate, string, length) == 0) {
+                    interned = candidate;
+                    Atomic::Increment(&header->references);
+                }
+            }
+        }
+        if (interned == NULL) {
+            char8 *memory = new char8[static_cast<uint32>(sizeof(InternedStringHeader)) + length + 1u];
+            /*lint -e{826} -e{927} the memory is allocated for the header and the characters.*/
+            InternedStringHeader *header = reinterpret_cast<InternedStringHeader *>(memory);
+            header->hash = hash;
+            header->length = length;
+            header->references = 1;
+            header->reserved = 0u;
+            interned = &memory[sizeof(InternedStringHeader)];
+            /*lint -e{534} the size is known to be valid.*/
+            MemoryOperationsHelper::Copy(interned, string, length);
+            interned[length] = '\0';
+            if (!index.Insert(hash, interned)) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "InternedStringTable: Failed to grow the table");
+            }
+        }
+        mux.FastUnLock();
+    }
+    return interned;
+}
+
+const char8 *InternedStringTable::Share(const char8 * const interned) {
+    if (interned != NULL) {
+        //The caller holds a reference, so the string cannot be freed in the meanwhile
+        Atomic::Increment(&(InternedStringGetHeader(interned)->references));
+    }
+    return interned;
+}
+
+void InternedStringTable::Release(const char8 * const interned) {
+    if (interned != NULL) {
+        InternedStringHeader *header = InternedStringGetHeader(interned);
+        if (mux.FastLock() != ErrorManagement::NoError) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "InternedStringTable: Failed FastLock()");
+        }
+        //Intern only increments under the lock, so that a string cannot be found while it is being freed
+        Atomic::Decrement(&header->references);
+        if (header->references == 0) {
+            if (!index.Remove(header->hash, const_cast<char8 *>(interned))) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "InternedStringTable: Released a string which is not interned");
+            }
+            /*lint -e{927} the header is the beginning of the allocated memory.*/
+            char8 *memory = reinterpret_cast<char8 *>(header);
+            delete[] memory;
+        }
+        mux.FastUnLock();
+    }
+}
+
+uint32 InternedStringTable::GetHash(const char8 * const interned) {
+    return InternedStringGetHeader(interned)->hash;
+}
+
+uint32 InternedStringTable::GetLength(const char8 * const interned) {
+    return InternedStringGetHeader(interned)->length;
+}
+
+uint32 InternedStringTable::GetNumberOfStrings() const {
+    return index.GetSize();
+}
+
+const char8 * const InternedStringTable::GetClassName() const {
+    return "InternedStringTable";
+}
+
+}
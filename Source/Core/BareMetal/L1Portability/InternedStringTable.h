@@ -0,0 +1,159 @@
+/**
+ * @file InternedStringTable.h
+ * @brief Header file for class InternedStringTable
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class InternedStringTable
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef INTERNEDSTRINGTABLE_H_
+#define INTERNEDSTRINGTABLE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "FastPollingMutexSem.h"
+#include "GlobalObjectI.h"
+#include "HashIndex.h"
+#include "WyHashFunction.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Global table of interned (i.e. stored only once) strings.
+ * @details Intern returns, for all the equal strings, the same stable pointer to a zero terminated copy of the
+ * string, so that two interned strings are equal if and only if their pointers are equal. The length and the hash
+ * of each string are computed once, when the string is first interned, and stored with the characters (see GetHash
+ * and GetLength).
+ *
+ * Each interned string is reference counted: every Intern (or Share) shall be matched by a Release and the string
+ * is freed by the last Release, so that names which are generated at run-time (e.g. the threads of a service) do
+ * not accumulate in the table.
+ *
+ * The hash is computed with the same WyHashFunction used by HashIndex<T, WyHashFunction>::Key, so that
+ * the GetHash of an interned string can be given directly to a HashIndex<T, WyHashFunction>.
+ *
+ * The Object names are interned (see Object::SetName).
+ */
+class DLL_API InternedStringTable: public GlobalObjectI {
+public:
+
+    /**
+     * @brief Singleton access to the table.
+     * @return a pointer to the table.
+     */
+    static InternedStringTable *Instance();
+
+    /**
+     * @brief Destructor. Frees the table (but not the strings which are still referenced).
+     */
+    virtual ~InternedStringTable();
+
+    /**
+     * @brief Interns a string.
+     * @param[in] string the string to intern.
+     * @param[in] size the number of characters of \a string to intern (if 0 is the string length).
+     * @return the interned copy of the string (which shall be given back to Release) or NULL if \a string is NULL.
+     */
+    const char8 *Intern(const char8 * const string,
+                        const uint32 size = 0u);
+
+    /**
+     * @brief Gets a new reference to a string which is already interned (without searching the table).
+     * @param[in] interned a string returned by Intern (or NULL).
+     * @return \a interned (which shall be given back to Release).
+     */
+    const char8 *Share(const char8 * const interned);
+
+    /**
+     * @brief Releases a reference to an interned string. The string is freed by the last Release.
+     * @param[in] interned a string returned by Intern or Share (or NULL).
+     */
+    void Release(const char8 * const interned);
+
+    /**
+     * @brief Gets the hash of an interned string.
+     * @param[in] interned a string returned by Intern or Share.
+     * @return the same value of HashIndex<T, WyHashFunction>::Key(interned).
+     */
+    static uint32 GetHash(const char8 * const interned);
+
+    /**
+     * @brief Gets the length of an interned string.
+     * @param[in] interned a string returned by Intern or Share.
+     * @return StringHelper::Length(interned).
+     */
+    static uint32 GetLength(const char8 * const interned);
+
+    /**
+     * @brief Gets the number of different strings in the table.
+     * @return the number of different strings in the table.
+     */
+    uint32 GetNumberOfStrings() const;
+
+    /**
+     * @see GlobalObjectI::GetClassName
+     * @return "InternedStringTable".
+     */
+    virtual const char8 * const GetClassName() const;
+
+private:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    InternedStringTable();
+
+    /*lint -e{1704} non copyable*/
+    /**
+     * @brief Disallow the copy constructor.
+     */
+    InternedStringTable(const InternedStringTable &);
+
+    /**
+     * @brief Disallow the copy operator.
+     */
+    InternedStringTable &operator=(const InternedStringTable &);
+
+    /**
+     * The interned strings, by hash.
+     */
+    HashIndex<char8 *, WyHashFunction> index;
+
+    /**
+     * Protects the table and the reference counters.
+     */
+    FastPollingMutexSem mux;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* INTERNEDSTRINGTABLE_H_ */
@@ -34,6 +34,7 @@
 
 #include "ErrorManagement.h"
 #include "GeneralDefinitions.h"
+#include INCLUDE_FILE_ARCHITECTURE(BareMetal,L1Portability,ARCHITECTURE,MemoryOperationsHelperA.h)
 
 /*---------------------------------------------------------------------------*/
 /*                           Module declaration                              */
@@ -54,6 +55,99 @@ namespace MemoryOperationsHelper {
  */
 DLL_API bool Copy(void * const destination, const void * const source, uint32 size);
 
+/**
+ * @brief Copies a block of memory into another without validating the arguments.
+ * @details To be used in the real-time paths (e.g. the brokers) where the pointers were validated once at
+ *  initialisation time. Small sizes (up to 64 bytes) are copied inline with size-specialised
+ *  (NEON on armv8) loads and stores; larger sizes are delegated to the C library.
+ * @param[in,out] destination is the pointer to the destination memory location.
+ * @param[in] source is the pointer to the source memory location.
+ * @param[in] size is the size of the memory to be copied.
+ * @pre destination and source are valid for \a size bytes and do not overlap.
+ */
+inline void CopyUnchecked(void * const destination, const void * const source, const uint32 size);
+
+/**
+ * @brief As CopyUnchecked but, for large blocks, using non-temporal loads and stores (where available).
+ * @details Meant for large acquisition buffers that are copied once and are not read again by this core,
+ *  so that the copy does not evict the working set of the real-time thread from the caches.
+ * @param[in,out] destination is the pointer to the destination memory location.
+ * @param[in] source is the pointer to the source memory location.
+ * @param[in] size is the size of the memory to be copied.
+ * @pre destination and source are valid for \a size bytes and do not overlap.
+ */
+inline void CopyNonTemporal(void * const destination, const void * const source, const uint32 size);
+
+/**
+ * @brief Copies a block of memory whose size is known at compile time.
+ * @details With a constant size the compiler emits the exact loads and stores (a single load/store for the scalar sizes).
+ * @tparam size is the size of the memory to be copied.
+ * @param[in,out] destination is the pointer to the destination memory location.
+ * @param[in] source is the pointer to the source memory location.
+ * @pre destination and source are valid for \a size bytes and do not overlap.
+ */
+template<uint32 size>
+inline void CopyFixedSize(void * const destination, const void * const source);
+
+/**
+ * @brief Gets the tag of the CopyFixedSize specialisation to be used by CopyTagged for a given size.
+ * @details The specialised sizes are the scalar ones (1, 2, 4 and 8 bytes) and the small multiples of 16 bytes (16, 32, 48 and 64 bytes).
+ * @param[in] size is the size of the memory to be copied.
+ * @return \a size if there is a specialisation for it, 0 otherwise.
+ */
+inline uint32 GetFixedCopySize(const uint32 size);
+
+/**
+ * @brief Copies a block of memory with the CopyFixedSize specialisation selected by \a fixedSize, or with CopyUnchecked if \a fixedSize is 0.
+ * @details Meant for copy tables where the tag is computed once, with GetFixedCopySize, at initialisation time.
+ * @param[in,out] destination is the pointer to the destination memory location.
+ * @param[in] source is the pointer to the source memory location.
+ * @param[in] size is the size of the memory to be copied.
+ * @param[in] fixedSize is GetFixedCopySize(size).
+ * @pre destination and source are valid for \a size bytes and do not overlap.
+ */
+inline void CopyTagged(void * const destination, const void * const source, const uint32 size, const uint32 fixedSize);
+
+/**
+ * @brief Gathers equally spaced elements of a memory block into a contiguous block.
+ * @details Copies \a numberOfElements elements of \a elementSize bytes, the element i being read from source + (i * stride) and
+ *  written to destination + (i * elementSize). Typically used to extract a channel from an interleaved frame. On armv8 the
+ *  1, 2 and 4 bytes elements with a stride of 2, 3 or 4 elements are de-interleaved with the NEON ld2/ld3/ld4 instructions
+ *  (which never read beyond the last element).
+ * @param[in,out] destination is the pointer to the (contiguous) destination memory location.
+ * @param[in] source is the pointer to the first element in the source memory location.
+ * @param[in] elementSize is the size of each element in bytes.
+ * @param[in] stride is the distance in bytes between two consecutive elements in the source.
+ * @param[in] numberOfElements is the number of elements to copy.
+ * @pre destination and source are valid and do not overlap.
+ */
+inline void GatherStrided(void * const destination, const void * const source, const uint32 elementSize, const uint32 stride,
+                          const uint32 numberOfElements);
+
+/**
+ * @brief Scatters a contiguous block into equally spaced elements of a memory block (the inverse of GatherStrided).
+ * @details The memory between the elements of the destination is not written.
+ * @param[in,out] destination is the pointer to the first element in the destination memory location.
+ * @param[in] source is the pointer to the (contiguous) source memory location.
+ * @param[in] elementSize is the size of each element in bytes.
+ * @param[in] stride is the distance in bytes between two consecutive elements in the destination.
+ * @param[in] numberOfElements is the number of elements to copy.
+ * @pre destination and source are valid and do not overlap.
+ */
+inline void ScatterStrided(void * const destination, const void * const source, const uint32 elementSize, const uint32 stride,
+                           const uint32 numberOfElements);
+
+/**
+ * @brief Hints the memory system that a block of memory is about to be read or written.
+ * @details Issues a prefetch (prfm pldl1keep/pstl1keep on armv8) for each cache line of the block, so that the lines
+ *  are loaded in background while the caller does something else. At most MEMORY_OPERATIONS_HELPER_PREFETCH_MAX bytes
+ *  are prefetched. The hints never fault, so that the address does not need to be valid.
+ * @param[in] address is the beginning of the memory block.
+ * @param[in] size is the size of the memory block.
+ * @param[in] forWrite true if the block is going to be written, false if it is going to be read.
+ */
+inline void Prefetch(const void * const address, const uint32 size, const bool forWrite);
+
 /**
  * @brief Compares the first specified bytes of two blocks of memories.
  * @param[in] mem1 is the pointer to the first memory location.
@@ -0,0 +1,98 @@
+/**
+ * @file PerformanceCounters.h
+ * @brief Header file for module PerformanceCounters
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module PerformanceCounters
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PERFORMANCECOUNTERS_H_
+#define PERFORMANCECOUNTERS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief Hardware performance counters of the calling thread.
+     * @details The counters are opened as one group (i.e. they are started, stopped and read together) the first time that
+     * a thread calls Read and only count the user space execution of that thread. The values are free running, the number
+     * of events of a code section is the difference between a Read after and a Read before the section.
+     */
+    namespace PerformanceCounters {
+
+        /**
+         * Index of the number of CPU cycles in the values given by Read.
+         */
+        static const uint32 CYCLES = 0u;
+
+        /**
+         * Index of the number of retired instructions in the values given by Read.
+         */
+        static const uint32 INSTRUCTIONS = 1u;
+
+        /**
+         * Index of the number of last level cache misses in the values given by Read.
+         */
+        static const uint32 CACHE_MISSES = 2u;
+
+        /**
+         * Index of the number of mispredicted branches in the values given by Read.
+         */
+        static const uint32 BRANCH_MISSES = 3u;
+
+        /**
+         * Number of values given by Read.
+         */
+        static const uint32 NUMBER_OF_COUNTERS = 4u;
+
+        /**
+         * @brief Reads the counters of the calling thread.
+         * @details Opens the counters if this is the first call of the thread. The counters which are not supported by the
+         * processor read always 0.
+         * @param[out] values the NUMBER_OF_COUNTERS counter values.
+         * @return false if the counters are not available (e.g. not supported by the operating system or not allowed to the process).
+         * The failure to open the counters is only reported once per thread.
+         */
+        bool Read(uint64 * const values);
+
+        /**
+         * @brief Releases the counters of the calling thread (which are otherwise kept until the process terminates).
+         */
+        void Close();
+    }
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* PERFORMANCECOUNTERS_H_ */
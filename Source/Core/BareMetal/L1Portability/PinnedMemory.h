@@ -0,0 +1,103 @@
+/**
+ * @file PinnedMemory.h
+ * @brief Header file for module PinnedMemory
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module PinnedMemory
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PINNEDMEMORY_H_
+#define PINNEDMEMORY_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief Allocation of large, page aligned, memory blocks directly from the operating system.
+     * @details Meant for big buffers shared between real-time threads (e.g. the pages of the asynchronous brokers), which benefit from
+     * being contiguous, backed by huge pages (less TLB misses) and locked in memory (no page faults).
+     */
+    namespace PinnedMemory {
+
+        /**
+         * @brief Allocates a zero initialised, page aligned, memory block.
+         * @param[in] size the number of bytes to allocate.
+         * @param[in] hugePages if true the block is backed by huge pages, if available. Otherwise (or if the huge pages cannot be reserved) normal pages are used.
+         * @param[in] lock if true the block is locked in memory. A failure to lock the memory is only reported as a warning.
+         * @param[out] mappedSize the number of bytes effectively allocated (size rounded up to the page size), to be given to Free.
+         * @return the address of the block or NULL if it could not be allocated.
+         */
+        void *Allocate(const uint32 size, const bool hugePages, const bool lock, uint32 &mappedSize);
+
+        /**
+         * @brief As Allocate(const uint32, const bool, const bool, uint32 &) but binding the block to a NUMA node.
+         * @details The binding is set before the pages are touched (i.e. before locking them), so that all the pages are
+         * allocated in the memory of \a numaNode. A failure to bind the memory is only reported as a warning.
+         * @param[in] size the number of bytes to allocate.
+         * @param[in] hugePages if true the block is backed by huge pages, if available.
+         * @param[in] lock if true the block is locked in memory.
+         * @param[in] numaNode the NUMA node where to allocate the memory. If < 0 the memory is not bound.
+         * @param[out] mappedSize the number of bytes effectively allocated, to be given to Free.
+         * @return the address of the block or NULL if it could not be allocated.
+         */
+        void *Allocate(const uint32 size, const bool hugePages, const bool lock, const int32 numaNode, uint32 &mappedSize);
+
+        /**
+         * @brief Gets the NUMA node of a CPU.
+         * @param[in] cpu the CPU number.
+         * @return the NUMA node of \a cpu or -1 if it cannot be determined (e.g. the system is not NUMA).
+         */
+        int32 NodeOfCPU(const uint32 cpu);
+
+        /**
+         * @brief Frees a block allocated with Allocate.
+         * @param[in,out] address the address of the block. Set to NULL on return.
+         * @param[in] mappedSize the mappedSize returned by Allocate.
+         * @return true if the block was successfully freed.
+         */
+        bool Free(void *&address, const uint32 mappedSize);
+
+        /**
+         * @brief Locks all the current and future memory pages of the process (e.g. heap, thread stacks, shared libraries).
+         * @details After this call no page of the process is swapped out and the pages are mapped when allocated,
+         * so that the real-time threads do not take page faults.
+         * @return true if the memory could be locked (it may fail due to insufficient permissions or RLIMIT_MEMLOCK).
+         */
+        bool LockAll();
+    }
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* PINNEDMEMORY_H_ */
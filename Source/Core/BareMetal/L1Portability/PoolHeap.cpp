@@ -0,0 +1,148 @@
+/**
+ * @file PoolHeap.cpp
+ * @brief Source file for class PoolHeap
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PoolHeap (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "HeapManager.h"
+#include "MemoryOperationsHelper.h"
+#include "PoolHeap.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+PoolHeap::PoolHeap(const char8 * const nameIn) :
+        HeapI(),
+        pool() {
+    name = StringHelper::StringDup(nameIn);
+}
+
+/*lint -e{1551} HeapManager::Free does not throw exceptions*/
+PoolHeap::~PoolHeap() {
+    if (name != NULL_PTR(char8 *)) {
+        if (HeapManager::Free(reinterpret_cast<void *&>(name))) {
+            name = NULL_PTR(char8 *);
+        }
+    }
+}
+
+bool PoolHeap::Initialise(const uint32 blockSize,
+                          const uint32 numberOfBlocks,
+                          const bool canGrow) {
+    return pool.Initialise(blockSize, numberOfBlocks, canGrow);
+}
+
+void *PoolHeap::Malloc(const uint32 size) {
+    void *block = NULL_PTR(void *);
+    if (size <= pool.GetBlockSize()) {
+        block = pool.Allocate();
+    }
+    if (block == NULL_PTR(void *)) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PoolHeap: Failed Malloc()");
+    }
+    return block;
+}
+
+void PoolHeap::Free(void *&data) {
+    if (data != NULL) {
+        if (!pool.Free(data)) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "PoolHeap: The pointer does not belong to this heap");
+        }
+    }
+    data = NULL_PTR(void *);
+}
+
+void *PoolHeap::Realloc(void *&data,
+                        const uint32 newSize) {
+    void *block = NULL_PTR(void *);
+    if (data == NULL) {
+        data = PoolHeap::Malloc(newSize);
+        block = data;
+    }
+    else if (newSize == 0u) {
+        PoolHeap::Free(data);
+    }
+    else if (newSize <= pool.GetBlockSize()) {
+        block = data;
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PoolHeap: Failed Realloc(). The size is greater than the block size");
+    }
+    return block;
+}
+
+void *PoolHeap::Duplicate(const void * const data,
+                          uint32 size) {
+    void *duplicate = NULL_PTR(void *);
+    if (data != NULL) {
+        if (size == 0U) {
+            size = StringHelper::Length(static_cast<const char8 *>(data)) + 1u;
+        }
+        duplicate = PoolHeap::Malloc(size);
+        if (duplicate != NULL) {
+            if (!MemoryOperationsHelper::Copy(duplicate, data, size)) {
+                PoolHeap::Free(duplicate);
+            }
+        }
+    }
+    return duplicate;
+}
+
+uintp PoolHeap::FirstAddress() const {
+    return pool.GetFirstAddress();
+}
+
+uintp PoolHeap::LastAddress() const {
+    return pool.GetLastAddress();
+}
+
+bool PoolHeap::Owns(void const * const data) const {
+    return pool.Contains(data);
+}
+
+const char8 *PoolHeap::Name() const {
+    return name;
+}
+
+uint32 PoolHeap::GetBlockSize() const {
+    return pool.GetBlockSize();
+}
+
+uint32 PoolHeap::GetNumberOfUsedBlocks() const {
+    return pool.GetNumberOfUsedBlocks();
+}
+
+}
@@ -0,0 +1,165 @@
+/**
+ * @file PoolHeap.h
+ * @brief Header file for class PoolHeap
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class PoolHeap
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef POOLHEAP_H_
+#define POOLHEAP_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "FixedSizePool.h"
+#include "HeapI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief A HeapI where all the allocations take a block from a FixedSizePool.
+ * @details Malloc and Free are lock-free O(1) operations. Any allocation larger than the block size fails.
+ * Unless the pool is allowed to grow, the memory of all the blocks is allocated in Initialise and the standard
+ * heap is never touched afterwards.
+ *
+ * The heap can be registered with HeapManager::AddHeap so that it can be selected by Name() (e.g. with the HeapName
+ * parameter of the GAMDataSource).
+ */
+class DLL_API PoolHeap: public HeapI {
+public:
+
+    /**
+     * @brief Constructor.
+     * @param[in] nameIn the name of the heap (see Name()).
+     */
+    PoolHeap(const char8 * const nameIn);
+
+    /**
+     * @brief Destructor. Frees the memory of all the blocks.
+     */
+    virtual ~PoolHeap();
+
+    /**
+     * @brief Allocates the blocks of the heap.
+     * @param[in] blockSize the size of each block (rounded up to a multiple of 16 bytes).
+     * @param[in] numberOfBlocks the number of blocks.
+     * @param[in] canGrow if true the pool allocates more blocks (in the standard heap) when it runs out of blocks.
+     * @return true if the FixedSizePool can be initialised with these parameters.
+     */
+    bool Initialise(const uint32 blockSize,
+                    const uint32 numberOfBlocks,
+                    const bool canGrow = false);
+
+    /**
+     * @brief Takes a block from the pool.
+     * @param[in] size the number of bytes to allocate (<= GetBlockSize()).
+     * @return a block or NULL if \a size is greater than the block size or the pool is exhausted.
+     */
+    virtual void *Malloc(const uint32 size);
+
+    /**
+     * @brief Returns a block to the pool.
+     * @param[in,out] data the block to be freed.
+     * @post data = NULL
+     */
+    virtual void Free(void *&data);
+
+    /**
+     * @brief Changes the size of a block.
+     * @details As all the blocks have the same size this only succeeds if \a newSize <= GetBlockSize(), in which
+     * case \a data is not changed.
+     * @param[in,out] data the block to resize. If NULL a new block is allocated.
+     * @param[in] newSize the new size. If 0 the block is freed.
+     * @return \a data or NULL if \a newSize is greater than the block size.
+     */
+    virtual void *Realloc(void *&data,
+                          const uint32 newSize);
+
+    /**
+     * @brief Copies a memory section into a new block.
+     * @param[in] data the memory to copy.
+     * @param[in] size the number of bytes to copy. If 0 the memory is copied until a zero is found (inclusive).
+     * @return the new block or NULL if the copy does not fit in a block.
+     */
+    /*lint -e(1735) the derived classes shall use this default parameter or no default parameter at all*/
+    virtual void *Duplicate(const void * const data,
+                            uint32 size = 0U);
+
+    /**
+     * @see FixedSizePool::GetFirstAddress
+     */
+    virtual uintp FirstAddress() const;
+
+    /**
+     * @see FixedSizePool::GetLastAddress
+     */
+    virtual uintp LastAddress() const;
+
+    /**
+     * @brief Checks if an address is one of the blocks of this heap.
+     * @param[in] data the address to check.
+     * @return true if \a data is the start of a block of this heap.
+     */
+    virtual bool Owns(void const * const data) const;
+
+    /**
+     * @brief Returns the name of the heap.
+     * @return the name set in the constructor.
+     */
+    virtual const char8 *Name() const;
+
+    /**
+     * @brief Gets the block size.
+     * @return the (rounded) block size.
+     */
+    uint32 GetBlockSize() const;
+
+    /**
+     * @brief Gets the number of blocks currently taken.
+     * @return the number of blocks currently taken.
+     */
+    uint32 GetNumberOfUsedBlocks() const;
+
+private:
+
+    /**
+     * The blocks.
+     */
+    FixedSizePool pool;
+
+    /**
+     * The heap name.
+     */
+    char8 *name;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* POOLHEAP_H_ */
@@ -0,0 +1,96 @@
+/**
+ * @file PowerManagement.h
+ * @brief Header file for module PowerManagement
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module PowerManagement
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef POWERMANAGEMENT_H_
+#define POWERMANAGEMENT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief Control of the processor power management (idle states and frequency scaling), which adds wake-up latency and jitter
+     * to the real-time threads.
+     * @details The settings are process wide and are kept until they are restored (ReleaseWakeUpLatency and RestoreCPUFrequencies),
+     * which shall be done before the process exits, given that the frequency settings outlive the process. The functions are meant
+     * to be called by the (single) thread which configures the application and are not thread safe.
+     */
+    namespace PowerManagement {
+
+        /**
+         * @brief Limits the wake-up latency of all the CPUs (PM QoS), i.e. forbids the idle states which take longer to exit.
+         * @details The limit is written to /dev/cpu_dma_latency, which is kept open, given that the kernel drops the request
+         * when the file is closed. Calling it again changes the limit.
+         * @param[in] latency the maximum wake-up latency in microseconds (0 keeps the CPUs out of any idle state).
+         * @return true if the limit was set (it may fail due to insufficient permissions).
+         */
+        bool SetWakeUpLatency(const uint32 latency);
+
+        /**
+         * @brief Releases the wake-up latency limit set with SetWakeUpLatency.
+         */
+        void ReleaseWakeUpLatency();
+
+        /**
+         * @brief Sets the frequency scaling of a CPU (cpufreq).
+         * @details The governor and the minimum frequency of the CPU are saved, the first time the CPU is changed, to be restored by
+         * RestoreCPUFrequencies. At most POWER_MANAGEMENT_MAX_CPUS CPUs can be changed.
+         * @param[in] cpu the CPU number (starting at 0).
+         * @param[in] governor the scaling governor (e.g. performance). If NULL or empty the governor is not changed.
+         * @param[in] minFrequency the minimum scaling frequency in kHz (e.g. the maximum frequency of the CPU to disable the
+         * frequency ramps). If 0 the minimum frequency is not changed.
+         * @return true if the settings were written (it may fail due to insufficient permissions or if the kernel has no cpufreq).
+         */
+        bool SetCPUFrequency(const uint32 cpu, const char8 * const governor, const uint32 minFrequency);
+
+        /**
+         * @brief Restores the governor and the minimum frequency of all the CPUs changed with SetCPUFrequency.
+         * @return true if all the settings were restored.
+         */
+        bool RestoreCPUFrequencies();
+    }
+
+    /**
+     * The maximum number of CPUs whose frequency scaling can be changed with PowerManagement::SetCPUFrequency.
+     */
+    static const uint32 POWER_MANAGEMENT_MAX_CPUS = 64u;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* POWERMANAGEMENT_H_ */
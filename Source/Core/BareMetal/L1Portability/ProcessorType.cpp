@@ -54,6 +54,171 @@ void ProcessorType::SetDefaultCPUs(const BitSet &mask) {
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+/**
+ * @brief Skips the blanks of \a cpus from \a i.
+ */
+static void ProcessorTypeSkipBlanks(const char8 * const cpus,
+                                    uint32 &i) {
+    while ((cpus[i] == ' ') || (cpus[i] == '\t')) {
+        i++;
+    }
+}
+
+/**
+ * @brief Parses the decimal CPU number at \a i of \a cpus.
+ * @return false if there are no digits or the number is not smaller than PROCESSOR_TYPE_MAX_CPUS.
+ */
+static bool ProcessorTypeParseCPU(const char8 * const cpus,
+                                  uint32 &i,
+                                  uint32 &cpu) {
+    bool ok = ((cpus[i] >= '0') && (cpus[i] <= '9'));
+    cpu = 0u;
+    while ((ok) && (cpus[i] >= '0') && (cpus[i] <= '9')) {
+        cpu = (cpu * 10u) + static_cast<uint32>(cpus[i] - '0');
+        ok = (cpu < PROCESSOR_TYPE_MAX_CPUS);
+        i++;
+    }
+    return ok;
+}
+
+/**
+ * @brief Parses a list of CPU numbers and ranges (e.g. "0-3,64-67").
+ */
+static bool ProcessorTypeParseList(const char8 * const cpus,
+                                   BitSet &mask) {
+    bool ok = true;
+    uint32 i = 0u;
+    ProcessorTypeSkipBlanks(cpus, i);
+    while ((ok) && (cpus[i] != '\0')) {
+        if (cpus[i] == ',') {
+            i++;
+        }
+        else {
+            uint32 first = 0u;
+            ok = ProcessorTypeParseCPU(cpus, i, first);
+            uint32 last = first;
+            ProcessorTypeSkipBlanks(cpus, i);
+            if ((ok) && (cpus[i] == '-')) {
+                i++;
+                ProcessorTypeSkipBlanks(cpus, i);
+                ok = ProcessorTypeParseCPU(cpus, i, last);
+                if (ok) {
+                    ok = (first <= last);
+                }
+            }
+            if (ok) {
+                ok = ((cpus[i] == ',') || (cpus[i] == '\0') || (cpus[i] == ' ') || (cpus[i] == '\t'));
+            }
+            for (uint32 cpu = first; (ok) && (cpu <= last); cpu++) {
+                mask.Set(cpu, true);
+            }
+        }
+        ProcessorTypeSkipBlanks(cpus, i);
+    }
+    return ok;
+}
+
+/**
+ * @brief Parses a hexadecimal mask of any width (without the 0x prefix).
+ */
+static bool ProcessorTypeParseHexadecimal(const char8 * const digits,
+                                          const uint32 numberOfDigits,
+                                          BitSet &mask) {
+    bool ok = (numberOfDigits > 0u);
+    for (uint32 d = 0u; (d < numberOfDigits) && (ok); d++) {
+        //The last digit holds the CPUs 0 to 3
+        char8 c = digits[numberOfDigits - 1u - d];
+        uint32 value = 0u;
+        if ((c >= '0') && (c <= '9')) {
+            value = static_cast<uint32>(c - '0');
+        }
+        else if ((c >= 'a') && (c <= 'f')) {
+            value = static_cast<uint32>(c - 'a') + 10u;
+        }
+        else if ((c >= 'A') && (c <= 'F')) {
+            value = static_cast<uint32>(c - 'A') + 10u;
+        }
+        else {
+            ok = false;
+        }
+        for (uint32 b = 0u; (b < 4u) && (ok); b++) {
+            if ((value & (1u << b)) != 0u) {
+                uint32 cpu = (4u * d) + b;
+                ok = (cpu < PROCESSOR_TYPE_MAX_CPUS);
+                if (ok) {
+                    mask.Set(cpu, true);
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Parses a decimal mask (up to 64 bits).
+ */
+static bool ProcessorTypeParseDecimal(const char8 * const digits,
+                                      BitSet &mask) {
+    const uint64 maxValue = 0xFFFFFFFFFFFFFFFFull;
+    uint64 value = 0u;
+    bool ok = true;
+    uint32 i = 0u;
+    while ((ok) && (digits[i] != '\0')) {
+        ok = ((digits[i] >= '0') && (digits[i] <= '9'));
+        if (ok) {
+            uint64 digit = static_cast<uint64>(digits[i] - '0');
+            ok = (value <= ((maxValue - digit) / 10u));
+            if (ok) {
+                value = (value * 10u) + digit;
+            }
+        }
+        i++;
+    }
+    if (ok) {
+        mask = value;
+    }
+    return ok;
+}
+
+/**
+ * @brief Appends \a c to \a buffer, keeping space for the terminator.
+ */
+static bool ProcessorTypeAppend(char8 * const buffer,
+                                const uint32 size,
+                                uint32 &written,
+                                const char8 c) {
+    bool ok = ((written + 1u) < size);
+    if (ok) {
+        buffer[written] = c;
+        written++;
+    }
+    return ok;
+}
+
+/**
+ * @brief Appends the decimal \a number to \a buffer, keeping space for the terminator.
+ */
+static bool ProcessorTypeAppendNumber(char8 * const buffer,
+                                      const uint32 size,
+                                      uint32 &written,
+                                      const uint32 number) {
+    char8 digits[10];
+    uint32 numberOfDigits = 0u;
+    uint32 n = number;
+    do {
+        digits[numberOfDigits] = static_cast<char8>('0' + static_cast<char8>(n % 10u));
+        numberOfDigits++;
+        n /= 10u;
+    }
+    while (n > 0u);
+    bool ok = true;
+    while ((ok) && (numberOfDigits > 0u)) {
+        numberOfDigits--;
+        ok = ProcessorTypeAppend(buffer, size, written, digits[numberOfDigits]);
+    }
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -123,5 +288,71 @@ BitSet ProcessorType::GetProcessorMask() const{
     return processorMask;
 }
 
+bool ProcessorType::SetFromString(const char8 * const cpus) {
+    bool ok = (cpus != NULL);
+    bool isList = false;
+    uint32 length = 0u;
+    if (ok) {
+        while (cpus[length] != '\0') {
+            if ((cpus[length] == ',') || (cpus[length] == '-')) {
+                isList = true;
+            }
+            length++;
+        }
+        ok = (length > 0u);
+    }
+    BitSet mask(0u);
+    if (ok) {
+        if (isList) {
+            ok = ProcessorTypeParseList(cpus, mask);
+        }
+        else if ((length > 2u) && (cpus[0] == '0') && ((cpus[1] == 'x') || (cpus[1] == 'X'))) {
+            ok = ProcessorTypeParseHexadecimal(&cpus[2], length - 2u, mask);
+        }
+        else {
+            ok = ProcessorTypeParseDecimal(cpus, mask);
+        }
+    }
+    if (ok) {
+        processorMask = mask;
+    }
+    return ok;
+}
+
+bool ProcessorType::ToList(char8 * const buffer,
+                           const uint32 size) const {
+    bool ok = (size > 0u);
+    uint32 written = 0u;
+    uint32 first = 0u;
+    bool found = processorMask.FindFirstSet(first);
+    while ((found) && (ok)) {
+        //Extend the range while the next CPU is also set
+        uint32 last = first;
+        uint32 next = 0u;
+        found = processorMask.FindNextSet(last + 1u, next);
+        while ((found) && (next == (last + 1u))) {
+            last = next;
+            found = processorMask.FindNextSet(last + 1u, next);
+        }
+        if (written > 0u) {
+            ok = ProcessorTypeAppend(buffer, size, written, ',');
+        }
+        if (ok) {
+            ok = ProcessorTypeAppendNumber(buffer, size, written, first);
+        }
+        if ((ok) && (last > first)) {
+            ok = ProcessorTypeAppend(buffer, size, written, '-');
+            if (ok) {
+                ok = ProcessorTypeAppendNumber(buffer, size, written, last);
+            }
+        }
+        first = next;
+    }
+    if (size > 0u) {
+        buffer[written] = '\0';
+    }
+    return ok;
+}
+
 
 }
@@ -40,10 +40,16 @@
 
 namespace MARTe {
 
+/**
+ * The highest number of CPUs that can be given in a configuration string (see ProcessorType::SetFromString).
+ */
+const uint32 PROCESSOR_TYPE_MAX_CPUS = 4096u;
+
 /**
  * @brief Defines the processors where a particular task should run.
  *
- * @details CPUs are set by a mask of bits (64 bits max => 64 processors max).
+ * @details CPUs are set by a mask of bits of any width (the bit i is the CPU i).
+ * In the configurations the mask is given with the syntax of SetFromString, so that also the CPUs above the 64th can be addressed.
  * System dependent calls to get the used cpus could be found in ProcessorType.h
  */
 class DLL_API ProcessorType {
@@ -164,6 +170,26 @@ public:
      */
     static void SetDefaultCPUs(const BitSet &mask);
 
+    /**
+     * @brief Sets the mask from its configuration string.
+     * @details The string is either:
+     * - a mask: a decimal number (up to 64 bits) or a hexadecimal number with the 0x prefix and any number of digits (e.g. 0x30000000000000000);
+     * - a list of CPU numbers and ranges of CPU numbers, numbered from 0 as in the Linux cpusets (e.g. "0-3,64-67"). The string is a list
+     * if it contains a comma or a dash, so that a single CPU is written as "64-64" or "64,".
+     * @param[in] cpus the configuration string.
+     * @return true if \a cpus is valid and no CPU is above PROCESSOR_TYPE_MAX_CPUS. The mask is not changed otherwise.
+     */
+    bool SetFromString(const char8 * const cpus);
+
+    /**
+     * @brief Writes the mask as a list of CPU numbers and ranges of CPU numbers (e.g. "0-3,64-67").
+     * @param[out] buffer where the zero terminated list is written.
+     * @param[in] size the number of characters of \a buffer.
+     * @return true if the list fits in \a buffer.
+     */
+    bool ToList(char8 * const buffer,
+                const uint32 size) const;
+
 private:
     /**
      * The processor mask
@@ -0,0 +1,185 @@
+/**
+ * @file ReportRateLimiter.cpp
+ * @brief Source file for class ReportRateLimiter
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ReportRateLimiter (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "ErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "ReportRateLimiter.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace ErrorManagement {
+
+/**
+ * @brief The rate limit of an error type.
+ */
+struct ReportRateLimit {
+    /**
+     * Ticks between two reports at the sustained rate (0 if not limited).
+     */
+    int64 interval;
+
+    /**
+     * Ticks by which a report may anticipate its theoretical arrival time ((burst - 1) * interval).
+     */
+    int64 tolerance;
+};
+
+/**
+ * The rate limits indexed by error bit.
+ */
+static ReportRateLimit reportRateLimits[LastErrorBit];
+
+/**
+ * @brief Gets the rate limit which applies to a code.
+ * @param[in] code the error code.
+ * @return the limit of the lowest (i.e. most severe) bit of code which has a limit or NULL if none applies.
+ */
+static const ReportRateLimit *GetReportRateLimit(const ErrorType &code) {
+    const ReportRateLimit *limit = NULL_PTR(const ReportRateLimit *);
+    ErrorIntegerFormat bits = code.format_as_integer;
+    for (uint32 i = 0u; (i < LastErrorBit) && (bits != 0u) && (limit == NULL_PTR(const ReportRateLimit *)); i++) {
+        if ((bits & 0x1u) != 0u) {
+            if (reportRateLimits[i].interval > 0) {
+                limit = &reportRateLimits[i];
+            }
+        }
+        bits >>= 1u;
+    }
+    return limit;
+}
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace ErrorManagement {
+
+void SetReportRateLimit(const ErrorType &code,
+                        const float64 rate,
+                        const uint32 burst) {
+    int64 interval = 0;
+    if (rate > 0.0) {
+        interval = static_cast<int64>(static_cast<float64>(HighResolutionTimer::Frequency()) / rate);
+        if (interval < 1) {
+            interval = 1;
+        }
+    }
+    uint32 nOfTokens = (burst > 0u) ? (burst) : (1u);
+    ErrorIntegerFormat bits = code.format_as_integer;
+    for (uint32 i = 0u; (i < LastErrorBit) && (bits != 0u); i++) {
+        if ((bits & 0x1u) != 0u) {
+            reportRateLimits[i].tolerance = (interval * static_cast<int64>(nOfTokens - 1u));
+            reportRateLimits[i].interval = interval;
+        }
+        bits >>= 1u;
+    }
+}
+
+void ReportSuppressed(const ErrorType &code,
+                      const uint32 suppressed,
+                      const char8 * const clsName,
+                      const char8 * const objName,
+                      const void * const objPtr,
+                      const char8 * const fileName,
+                      const int16 lineNumber,
+                      const char8 * const functionName) {
+    const char8 * const prefix = "Suppressed ";
+    const char8 * const suffix = " similar messages";
+    char8 buffer[48];
+    uint32 n = 0u;
+    for (uint32 i = 0u; prefix[i] != '\0'; i++) {
+        buffer[n] = prefix[i];
+        n++;
+    }
+    char8 digits[10];
+    uint32 nOfDigits = 0u;
+    uint32 value = suppressed;
+    do {
+        digits[nOfDigits] = static_cast<char8>('0' + static_cast<char8>(value % 10u));
+        nOfDigits++;
+        value /= 10u;
+    }
+    while (value > 0u);
+    while (nOfDigits > 0u) {
+        nOfDigits--;
+        buffer[n] = digits[nOfDigits];
+        n++;
+    }
+    for (uint32 i = 0u; suffix[i] != '\0'; i++) {
+        buffer[n] = suffix[i];
+        n++;
+    }
+    buffer[n] = '\0';
+    ReportError(code, &buffer[0], clsName, objName, objPtr, fileName, lineNumber, functionName);
+}
+
+bool ReportRateLimiter::Allow(const ErrorType &code,
+                              uint32 &suppressed) {
+    bool allowed = true;
+    const ReportRateLimit *limit = GetReportRateLimit(code);
+    if (limit != NULL_PTR(const ReportRateLimit *)) {
+        int64 now = static_cast<int64>(HighResolutionTimer::Counter());
+        int64 arrival = Atomic::Load(&theoreticalArrival, Atomic::MemoryOrderRelaxed);
+        bool done = false;
+        while (!done) {
+            allowed = ((arrival - now) <= limit->tolerance);
+            if (allowed) {
+                int64 next = (((arrival - now) > 0) ? (arrival) : (now)) + limit->interval;
+                done = Atomic::CompareExchange(&theoreticalArrival, arrival, next, Atomic::MemoryOrderRelaxed);
+            }
+            else {
+                Atomic::Increment(&suppressedCount);
+                done = true;
+            }
+        }
+    }
+    suppressed = 0u;
+    if (allowed) {
+        if (Atomic::Load(&suppressedCount, Atomic::MemoryOrderRelaxed) != 0) {
+            suppressed = static_cast<uint32>(Atomic::Exchange(&suppressedCount, 0));
+        }
+    }
+    return allowed;
+}
+
+}
+
+}
@@ -0,0 +1,121 @@
+/**
+ * @file ReportRateLimiter.h
+ * @brief Header file for class ReportRateLimiter
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ReportRateLimiter
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REPORTRATELIMITER_H_
+#define REPORTRATELIMITER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "ErrorType.h"
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace ErrorManagement {
+
+/**
+ * @brief Sets the maximum rate at which each error reporting call site may report errors of a given type.
+ * @details The limit is a token bucket with burst tokens, refilled at rate tokens per second, which is
+ * kept independently by each call site (see ReportRateLimiter).
+ * @param[in] code the error type(s) to be limited. The limit is applied to each bit set in code.
+ * @param[in] rate the maximum sustained number of reports per second. A value <= 0 removes the limit.
+ * @param[in] burst the number of reports that are accepted back to back (at least 1).
+ */
+DLL_API void SetReportRateLimit(const ErrorType &code,
+                                const float64 rate,
+                                const uint32 burst);
+
+/**
+ * @brief Reports that a call site suppressed messages.
+ * @details Reports with code the message "Suppressed N similar messages" with the context of the call site.
+ * @param[in] code the error code of the call site.
+ * @param[in] suppressed the number of suppressed messages.
+ * @param[in] clsName the name of the class reporting the error (may be NULL).
+ * @param[in] objName the name of the object reporting the error (may be NULL).
+ * @param[in] objPtr the pointer to the object reporting the error (may be NULL).
+ * @param[in] fileName the name of the file where the error was reported.
+ * @param[in] lineNumber the line where the error was reported.
+ * @param[in] functionName the name of the function where the error was reported.
+ */
+DLL_API void ReportSuppressed(const ErrorType &code,
+                              const uint32 suppressed,
+                              const char8 * const clsName,
+                              const char8 * const objName,
+                              const void * const objPtr,
+                              const char8 * const fileName,
+                              const int16 lineNumber,
+                              const char8 * const functionName);
+
+/**
+ * @brief Per call site rate limiter of the REPORT_ERROR macros.
+ * @details Each macro expansion owns a static instance and calls Allow before formatting the
+ * message, so that a suppressed report costs a timer read and a compare-and-swap.
+ * The token bucket is implemented as a virtual scheduling (GCRA) on a single 64 bit time stamp, which
+ * makes it lock-free. The number of suppressed reports is returned by the next accepted call so
+ * that the caller can report it after its own message (see ReportSuppressed).
+ * The class has no constructor, so that a static instance is zero initialised without any
+ * run-time initialisation guard. Instances must therefore have static storage duration.
+ */
+class DLL_API ReportRateLimiter {
+public:
+    /**
+     * @brief Checks if a report with the given code is allowed.
+     * @param[in] code the error code of the report.
+     * @param[out] suppressed the number of reports suppressed since the last allowed one (only meaningful if true is returned).
+     * @return true if the report is allowed.
+     */
+    bool Allow(const ErrorType &code,
+               uint32 &suppressed);
+
+private:
+
+    /**
+     * Theoretical arrival time (in HighResolutionTimer ticks) of the next report which does not consume the burst.
+     */
+    volatile int64 theoreticalArrival;
+
+    /**
+     * Number of reports suppressed since the last allowed one.
+     */
+    volatile int32 suppressedCount;
+};
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REPORTRATELIMITER_H_ */
@@ -0,0 +1,95 @@
+/**
+ * @file SharedMemory.h
+ * @brief Header file for module SharedMemory
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module SharedMemory
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SHAREDMEMORY_H_
+#define SHAREDMEMORY_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief Named memory segments which can be mapped by several processes.
+     * @details A name which starts with '/' and has no other '/' (e.g. "/marte_plant") is an operating system shared
+     * memory object. Any other name is the path of a file which is mapped as the segment, e.g. a file in a hugetlbfs mount
+     * (e.g. "/dev/hugepages/marte_plant") in order to back the segment with huge pages.
+     */
+    namespace SharedMemory {
+
+        /**
+         * @brief Creates a new, zero initialised, segment and maps it for reading and writing.
+         * @details An existing segment with the same name is replaced (the processes which have it mapped keep the old segment).
+         * @param[in] name the name of the segment.
+         * @param[in] size the number of bytes of the segment.
+         * @param[in] lock if true the segment is locked in memory. A failure to lock the memory is only reported as a warning.
+         * @param[out] mappedSize the number of bytes effectively mapped (size rounded up to the page size of the segment), to be given to Close.
+         * @return the address of the segment or NULL if it could not be created.
+         */
+        void *Create(const char8 * const name, const uint32 size, const bool lock, uint32 &mappedSize);
+
+        /**
+         * @brief Maps an existing segment.
+         * @details Does not report any error if the segment does not exist, so that it can be called periodically
+         * until the segment is created by another process.
+         * @param[in] name the name of the segment.
+         * @param[in] readOnly if true the segment is mapped for reading only.
+         * @param[out] mappedSize the size of the segment, to be given to Close.
+         * @return the address of the segment or NULL if it does not exist (or is empty) or could not be mapped.
+         */
+        void *Open(const char8 * const name, const bool readOnly, uint32 &mappedSize);
+
+        /**
+         * @brief Unmaps a segment mapped with Create or Open.
+         * @param[in,out] address the address of the segment. Set to NULL on return.
+         * @param[in] mappedSize the mappedSize returned by Create or Open.
+         * @return true if the segment was successfully unmapped.
+         */
+        bool Close(void *&address, const uint32 mappedSize);
+
+        /**
+         * @brief Removes the name of a segment. The segment is freed when it is no longer mapped by any process.
+         * @param[in] name the name of the segment.
+         * @return true if the name was removed (or did not exist).
+         */
+        bool Remove(const char8 * const name);
+    }
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SHAREDMEMORY_H_ */
@@ -0,0 +1,221 @@
+/**
+ * @file SlabHeap.cpp
+ * @brief Source file for class SlabHeap
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SlabHeap (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "HeapManager.h"
+#include "MemoryOperationsHelper.h"
+#include "SlabHeap.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * Block size of the smallest class.
+ */
+const MARTe::uint32 SLAB_HEAP_MIN_BLOCK_SIZE = 16u;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+SlabHeap::SlabHeap(const char8 * const nameIn) :
+        HeapI() {
+    numberOfClasses = 0u;
+    name = StringHelper::StringDup(nameIn);
+}
+
+/*lint -e{1551} HeapManager::Free does not throw exceptions*/
+SlabHeap::~SlabHeap() {
+    if (name != NULL_PTR(char8 *)) {
+        if (HeapManager::Free(reinterpret_cast<void *&>(name))) {
+            name = NULL_PTR(char8 *);
+        }
+    }
+}
+
+bool SlabHeap::Initialise(const uint32 maxBlockSize,
+                          const uint32 numberOfBlocks,
+                          const bool canGrow) {
+    bool ok = (numberOfClasses == 0u);
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::InitialisationError, "SlabHeap: Already initialised");
+    }
+    uint32 nClasses = 1u;
+    if (ok) {
+        while ((nClasses < SLAB_HEAP_MAX_CLASSES) && ((SLAB_HEAP_MIN_BLOCK_SIZE << (nClasses - 1u)) < maxBlockSize)) {
+            nClasses++;
+        }
+        ok = ((SLAB_HEAP_MIN_BLOCK_SIZE << (nClasses - 1u)) >= maxBlockSize);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "SlabHeap: The maximum block size is greater than the largest supported class");
+        }
+    }
+    uint32 i;
+    for (i = 0u; (i < nClasses) && (ok); i++) {
+        ok = pools[i].Initialise(SLAB_HEAP_MIN_BLOCK_SIZE << i, numberOfBlocks, canGrow);
+    }
+    if (ok) {
+        numberOfClasses = nClasses;
+    }
+    return ok;
+}
+
+uint32 SlabHeap::FindClass(const void * const data) const {
+    uint32 c = numberOfClasses;
+    uint32 i;
+    for (i = 0u; (i < numberOfClasses) && (c == numberOfClasses); i++) {
+        if (pools[i].Contains(data)) {
+            c = i;
+        }
+    }
+    return c;
+}
+
+void *SlabHeap::Malloc(const uint32 size) {
+    void *block = NULL_PTR(void *);
+    uint32 c = 0u;
+    while ((c < numberOfClasses) && ((SLAB_HEAP_MIN_BLOCK_SIZE << c) < size)) {
+        c++;
+    }
+    if (c < numberOfClasses) {
+        block = pools[c].Allocate();
+    }
+    if (block == NULL_PTR(void *)) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "SlabHeap: Failed Malloc()");
+    }
+    return block;
+}
+
+void SlabHeap::Free(void *&data) {
+    if (data != NULL) {
+        uint32 c = FindClass(data);
+        if (c < numberOfClasses) {
+            (void) pools[c].Free(data);
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "SlabHeap: The pointer does not belong to this heap");
+        }
+    }
+    data = NULL_PTR(void *);
+}
+
+void *SlabHeap::Realloc(void *&data,
+                        const uint32 newSize) {
+    void *block = NULL_PTR(void *);
+    if (data == NULL) {
+        data = SlabHeap::Malloc(newSize);
+        block = data;
+    }
+    else if (newSize == 0u) {
+        SlabHeap::Free(data);
+    }
+    else {
+        uint32 c = FindClass(data);
+        if (c < numberOfClasses) {
+            uint32 oldSize = pools[c].GetBlockSize();
+            if (newSize <= oldSize) {
+                block = data;
+            }
+            else {
+                block = SlabHeap::Malloc(newSize);
+                if (block != NULL) {
+                    (void) MemoryOperationsHelper::Copy(block, data, oldSize);
+                    SlabHeap::Free(data);
+                    data = block;
+                }
+            }
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "SlabHeap: The pointer does not belong to this heap");
+        }
+    }
+    return block;
+}
+
+void *SlabHeap::Duplicate(const void * const data,
+                          uint32 size) {
+    void *duplicate = NULL_PTR(void *);
+    if (data != NULL) {
+        if (size == 0U) {
+            size = StringHelper::Length(static_cast<const char8 *>(data)) + 1u;
+        }
+        duplicate = SlabHeap::Malloc(size);
+        if (duplicate != NULL) {
+            (void) MemoryOperationsHelper::Copy(duplicate, data, size);
+        }
+    }
+    return duplicate;
+}
+
+uintp SlabHeap::FirstAddress() const {
+    uintp first = 0u;
+    uint32 i;
+    for (i = 0u; i < numberOfClasses; i++) {
+        uintp poolFirst = pools[i].GetFirstAddress();
+        if ((first == 0u) || (poolFirst < first)) {
+            first = poolFirst;
+        }
+    }
+    return first;
+}
+
+uintp SlabHeap::LastAddress() const {
+    uintp last = 0u;
+    uint32 i;
+    for (i = 0u; i < numberOfClasses; i++) {
+        uintp poolLast = pools[i].GetLastAddress();
+        if (poolLast > last) {
+            last = poolLast;
+        }
+    }
+    return last;
+}
+
+bool SlabHeap::Owns(void const * const data) const {
+    return (FindClass(data) < numberOfClasses);
+}
+
+const char8 *SlabHeap::Name() const {
+    return name;
+}
+
+uint32 SlabHeap::GetNumberOfClasses() const {
+    return numberOfClasses;
+}
+
+}
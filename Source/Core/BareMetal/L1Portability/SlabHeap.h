@@ -0,0 +1,178 @@
+/**
+ * @file SlabHeap.h
+ * @brief Header file for class SlabHeap
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SlabHeap
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SLABHEAP_H_
+#define SLABHEAP_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "FixedSizePool.h"
+#include "HeapI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Maximum number of size classes of a SlabHeap (i.e. blocks from 16 bytes to 512 KB).
+ */
+static const uint32 SLAB_HEAP_MAX_CLASSES = 16u;
+
+/**
+ * @brief A HeapI with a FixedSizePool for each power of two size class.
+ * @details The size classes go from 16 bytes up to the maximum block size (rounded up to a power of two). Every
+ * allocation takes a block from the smallest class that fits the request, so that Malloc and Free are lock-free
+ * O(1) operations. Allocations larger than the maximum block size fail.
+ *
+ * The heap can be registered with HeapManager::AddHeap so that it can be selected by Name() (e.g. with the HeapName
+ * parameter of the GAMDataSource).
+ */
+class DLL_API SlabHeap: public HeapI {
+public:
+
+    /**
+     * @brief Constructor.
+     * @param[in] nameIn the name of the heap (see Name()).
+     */
+    SlabHeap(const char8 * const nameIn);
+
+    /**
+     * @brief Destructor. Frees the memory of all the size classes.
+     */
+    virtual ~SlabHeap();
+
+    /**
+     * @brief Allocates the blocks of all the size classes.
+     * @param[in] maxBlockSize the size of the largest class (rounded up to a power of two).
+     * @param[in] numberOfBlocks the number of blocks of each class.
+     * @param[in] canGrow if true each class allocates more blocks (in the standard heap) when it runs out of blocks.
+     * @return true if \a maxBlockSize is not greater than the largest supported class and all the pools can be initialised.
+     */
+    bool Initialise(const uint32 maxBlockSize,
+                    const uint32 numberOfBlocks,
+                    const bool canGrow = false);
+
+    /**
+     * @brief Takes a block from the smallest class that fits \a size.
+     * @param[in] size the number of bytes to allocate.
+     * @return a block or NULL if \a size is greater than the maximum block size or the class is exhausted.
+     */
+    virtual void *Malloc(const uint32 size);
+
+    /**
+     * @brief Returns a block to its class.
+     * @param[in,out] data the block to be freed.
+     * @post data = NULL
+     */
+    virtual void Free(void *&data);
+
+    /**
+     * @brief Changes the size of a block.
+     * @details If \a newSize fits in the class of \a data the block is not changed. Otherwise a block of
+     * a larger class is taken and the content copied.
+     * @param[in,out] data the block to resize. If NULL a new block is allocated.
+     * @param[in] newSize the new size. If 0 the block is freed.
+     * @return the (possibly) new block or NULL if no block can hold \a newSize.
+     */
+    virtual void *Realloc(void *&data,
+                          const uint32 newSize);
+
+    /**
+     * @brief Copies a memory section into a new block.
+     * @param[in] data the memory to copy.
+     * @param[in] size the number of bytes to copy. If 0 the memory is copied until a zero is found (inclusive).
+     * @return the new block or NULL if the copy does not fit in a block.
+     */
+    /*lint -e(1735) the derived classes shall use this default parameter or no default parameter at all*/
+    virtual void *Duplicate(const void * const data,
+                            uint32 size = 0U);
+
+    /**
+     * @brief Returns the lowest address of all the classes.
+     * @return the lowest address of all the classes.
+     */
+    virtual uintp FirstAddress() const;
+
+    /**
+     * @brief Returns the highest address (inclusive) of all the classes.
+     * @return the highest address of all the classes.
+     */
+    virtual uintp LastAddress() const;
+
+    /**
+     * @brief Checks if an address is one of the blocks of this heap.
+     * @param[in] data the address to check.
+     * @return true if \a data is the start of a block of any of the classes.
+     */
+    virtual bool Owns(void const * const data) const;
+
+    /**
+     * @brief Returns the name of the heap.
+     * @return the name set in the constructor.
+     */
+    virtual const char8 *Name() const;
+
+    /**
+     * @brief Gets the number of size classes.
+     * @return the number of size classes.
+     */
+    uint32 GetNumberOfClasses() const;
+
+private:
+
+    /**
+     * @brief Gets the class that holds a block.
+     * @param[in] data the block address.
+     * @return the class index or GetNumberOfClasses() if \a data does not belong to this heap.
+     */
+    uint32 FindClass(const void * const data) const;
+
+    /**
+     * One pool for each size class (the block size of class i is 16 << i).
+     */
+    FixedSizePool pools[SLAB_HEAP_MAX_CLASSES];
+
+    /**
+     * The number of size classes.
+     */
+    uint32 numberOfClasses;
+
+    /**
+     * The heap name.
+     */
+    char8 *name;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SLABHEAP_H_ */
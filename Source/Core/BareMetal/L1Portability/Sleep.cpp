@@ -40,6 +40,8 @@ namespace MARTe{
 
 uint32 Sleep::schedulerGranularity = SCHED_GRANULARITY_US;
 
+uint32 Sleep::spinThreshold = SLEEP_SPIN_THRESHOLD_NS;
+
 uint32 Sleep::GetSchedulerGranularity() {
     return Sleep::schedulerGranularity;
 }
@@ -48,4 +50,12 @@ void Sleep::SetSchedulerGranularity(const uint32 &granularity) {
     Sleep::schedulerGranularity = granularity;
 }
 
+uint32 Sleep::GetSpinThreshold() {
+    return Sleep::spinThreshold;
+}
+
+void Sleep::SetSpinThreshold(const uint32 &threshold) {
+    Sleep::spinThreshold = threshold;
+}
+
 }
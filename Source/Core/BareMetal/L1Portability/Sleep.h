@@ -87,6 +87,51 @@ public:
     static inline void SemiBusy(const float32 totalSleepSec,
             const float32 nonBusySleepSec);
 
+    /**
+     * @brief Sleeps until the HighResolutionTimer counter reaches \a absoluteTicks.
+     * @details The operating system sleep is used until GetSpinThreshold() nano-seconds before
+     * the deadline and the remaining time is busy waited. Returns immediately if the deadline has expired.
+     * @param[in] absoluteTicks the HighResolutionTimer::Counter() value at which to wake up.
+     */
+    static inline void Until(const uint64 absoluteTicks);
+
+    /**
+     * @brief Sleeps for \a nanoSeconds, busy waiting the last \a spinThreshold nano-seconds.
+     * @details Requests shorter than \a spinThreshold are entirely busy waited, so that they
+     * are not delayed by the operating system timer slack. This function uses HighResolutionTimer functions.
+     * @param[in] nanoSeconds the time to sleep in nano-seconds.
+     * @param[in] spinThreshold the time in nano-seconds, before the end of the sleep, to be spent busy waiting.
+     */
+    static inline void Hybrid(const uint64 nanoSeconds,
+                              const uint32 spinThreshold);
+
+    /**
+     * @brief Gets the default spin threshold used by Until.
+     * @return the spin threshold in nano-seconds.
+     */
+    static uint32 GetSpinThreshold();
+
+    /**
+     * @brief Sets the default spin threshold used by Until.
+     * @param[in] threshold the spin threshold in nano-seconds.
+     */
+    static void SetSpinThreshold(const uint32 &threshold);
+
+    /**
+     * @brief Sets the operating system timer slack of the calling thread.
+     * @details The timer slack is the amount of time by which the operating system is allowed to
+     * delay a sleep wake-up in order to coalesce timer interrupts. Threads created afterwards by the calling thread inherit it.
+     * @param[in] slack the timer slack in nano-seconds (0 resets to the operating system default).
+     * @return true if the timer slack could be set.
+     */
+    static bool SetTimerSlack(const uint32 slack);
+
+    /**
+     * @brief Gets the operating system timer slack of the calling thread.
+     * @return the timer slack in nano-seconds (0 if it is not available).
+     */
+    static uint32 GetTimerSlack();
+
     /**
      * @brief Gets the scheduler granularity (i.e. any requests to sleep no more than this value, will busy sleep).
      * @return the scheduler granularity in micro-seconds.
@@ -99,6 +144,25 @@ public:
      */
     static void SetSchedulerGranularity(const uint32 &granularity);
 
+    /**
+     * @brief Retrieves the current value of the operating system monotonic clock.
+     * @details The origin is arbitrary but it is shared by all the threads of the process,
+     * so that absolute deadlines computed by different threads can be compared.
+     * @return the monotonic clock value in nano-seconds.
+     */
+    static uint64 GetMonotonicNanoSeconds();
+
+    /**
+     * @brief Sleeps until the monotonic clock (see GetMonotonicNanoSeconds) reaches \a deadline.
+     * @details The thread is suspended with an absolute-time operating system sleep until
+     * \a busyTailUsec micro-seconds before the deadline and then busy waits for the remaining time.
+     * Returns immediately if the deadline has already expired.
+     * @param[in] deadline the absolute monotonic time, in nano-seconds, at which to wake up.
+     * @param[in] busyTailUsec the time in micro-seconds, before the deadline, to be spent busy waiting.
+     */
+    static void UntilMonotonicNanoSeconds(const uint64 deadline,
+                                          const uint32 busyTailUsec);
+
 private:
 
     /**
@@ -114,10 +178,29 @@ private:
      */
     static void OsUsleep(uint32 usecTime);
 
+    /**
+     * @brief Wraps the operating system sleep call with nano-seconds resolution.
+     * @param[in] nsecTime is the time to sleep in nano-seconds.
+     */
+    static void OsNanoSleep(const uint64 nsecTime);
+
+    /**
+     * @brief Sleeps until the HighResolutionTimer counter reaches \a absoluteTicks, busy waiting the last \a spinThreshold nano-seconds.
+     * @param[in] absoluteTicks the HighResolutionTimer::Counter() value at which to wake up.
+     * @param[in] spinThreshold the time in nano-seconds, before the deadline, to be spent busy waiting.
+     */
+    static inline void UntilTicks(const uint64 absoluteTicks,
+                                  const uint32 spinThreshold);
+
     /**
      * The scheduler granularity (i.e. any requests to sleep no more than this value, will busy sleep).
      */
     static uint32 schedulerGranularity;
+
+    /**
+     * The default spin threshold in nano-seconds (see Until).
+     */
+    static uint32 spinThreshold;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -171,5 +254,29 @@ void Sleep::MicroSeconds(uint32 totalUsecTime,
     }
 }
 
+void Sleep::Until(const uint64 absoluteTicks) {
+    UntilTicks(absoluteTicks, spinThreshold);
+}
+
+void Sleep::Hybrid(const uint64 nanoSeconds,
+                   const uint32 spinThreshold) {
+    uint64 startCounter = HighResolutionTimer::Counter();
+    uint64 deltaTicks = static_cast<uint64>(static_cast<float64>(nanoSeconds) * static_cast<float64>(HighResolutionTimer::Frequency()) / 1e9);
+    UntilTicks(startCounter + deltaTicks, spinThreshold);
+}
+
+void Sleep::UntilTicks(const uint64 absoluteTicks,
+                       const uint32 spinThreshold) {
+    uint64 now = HighResolutionTimer::Counter();
+    if (now < absoluteTicks) {
+        uint64 remaining = HighResolutionTimer::TicksToNanoSeconds(absoluteTicks - now);
+        if (remaining > spinThreshold) {
+            OsNanoSleep(remaining - spinThreshold);
+        }
+        while (HighResolutionTimer::Counter() < absoluteTicks) {
+        }
+    }
+}
+
 }
 #endif /* SLEEP_H_ */
@@ -52,7 +52,7 @@ namespace MARTe {
  * the element type and sets the allocation granularity for all the instances.
  *
  * @tparam elementType The type of the elements that the list will hold
- * @tparam listAllocationGranularity The number of elements that the list must
+ * @tparam listAllocationGranularity The minimum number of elements that the list must
  * reserve as space in memory in advance, each time that needs to grow.
  *
  * @see Lists::StaticListHolder
@@ -102,6 +102,17 @@ public:
      */
     bool Add(const elementType &value);
 
+    /**
+     * @see StaticListHolder::Add(const void * const, const uint32)
+     */
+    bool Add(const elementType * const values,
+             const uint32 numberOfElements);
+
+    /**
+     * @see StaticListHolder::Reserve()
+     */
+    bool Reserve(const uint32 capacity);
+
     /**
      * @see StaticListHolder::Insert()
      */
@@ -213,6 +224,17 @@ bool StaticList<elementType, listAllocationGranularity>::Add(const elementType &
     return slh.Add(static_cast<const void *>(&value));
 }
 
+template<typename elementType, uint32 listAllocationGranularity>
+bool StaticList<elementType, listAllocationGranularity>::Add(const elementType * const values,
+                                                             const uint32 numberOfElements) {
+    return slh.Add(static_cast<const void *>(values), numberOfElements);
+}
+
+template<typename elementType, uint32 listAllocationGranularity>
+bool StaticList<elementType, listAllocationGranularity>::Reserve(const uint32 capacity) {
+    return slh.Reserve(capacity);
+}
+
 template<typename elementType, uint32 listAllocationGranularity>
 bool StaticList<elementType, listAllocationGranularity>::Insert(const uint32 position,
                                                                 const elementType &value) {
@@ -111,13 +111,7 @@ bool StaticListHolder::Add(const void * const copyFrom) {
     // Increases capacity if after adding an element, the list is going to fall short of space.
     if (ret) {
         if ((listSize_ + 1u) > listCapacity_) {
-            //Checks if new capacity will be on range and calls IncreaseCapacity or signals error otherwise.
-            if ((listCapacity_ + listAllocationGranularity_) <= maxListCapacity_) {
-                ret = IncreaseCapacity();
-            }
-            else {
-                ret = false;
-            }
+            ret = IncreaseCapacity(listSize_ + 1u);
         }
     }
 
@@ -147,13 +141,7 @@ bool StaticListHolder::Insert(const uint32 position,
     // Increases capacity if after adding an element, the list is going to fall short of space.
     if (ret) {
         if ((listSize_ + 1u) > listCapacity_) {
-            //Checks if new capacity will be on range and calls IncreaseCapacity or signals error otherwise.
-            if ((listCapacity_ + listAllocationGranularity_) <= maxListCapacity_) {
-                ret = IncreaseCapacity();
-            }
-            else {
-                ret = false;
-            }
+            ret = IncreaseCapacity(listSize_ + 1u);
         }
     }
 
@@ -266,43 +254,104 @@ bool StaticListHolder::Extract(const uint32 position,
     return ret;
 }
 
-bool StaticListHolder::IncreaseCapacity(void) {
-    bool ret = true;
-
+bool StaticListHolder::IncreaseCapacity(const uint32 minimumCapacity) {
     //Checks the precondition
-    if ((listCapacity_ + listAllocationGranularity_) > maxListCapacity_) {
-        ret = false;
+    bool ret = (minimumCapacity <= maxListCapacity_);
+
+    if (ret) {
+        //Grows geometrically, so that the number of reallocations (and of copied elements) is not quadratic on the size
+        uint32 growth = listCapacity_ / 2u;
+        if (growth < listAllocationGranularity_) {
+            growth = listAllocationGranularity_;
+        }
+        uint32 newCapacity = maxListCapacity_;
+        if (growth < (maxListCapacity_ - listCapacity_)) {
+            newCapacity = listCapacity_ + growth;
+        }
+        if (newCapacity < minimumCapacity) {
+            newCapacity = minimumCapacity;
+        }
+        //Rounds up to the granularity (maxListCapacity_ is a multiple of it)
+        uint32 remainder = newCapacity % listAllocationGranularity_;
+        if (remainder > 0u) {
+            newCapacity += (listAllocationGranularity_ - remainder);
+        }
+        ret = Resize(newCapacity);
     }
+    return ret;
+}
 
+bool StaticListHolder::Resize(const uint32 newCapacity) {
+    bool ret = true;
     //Allocates or reallocates the memory reserved for the array depending on current allocated memory
+    if (listCapacity_ == 0U) {
+        //The array has not memory reserved, yet, so it allocates memory for it
+        allocatedMemory_ = static_cast<uint8 *>(HeapManager::Malloc(newCapacity * listElementSize_));
+        if (allocatedMemory_ != NULL_PTR(void *)) {
+            listCapacity_ = newCapacity;
+        }
+        else {
+            //Implicit rollback of allocatedMemory_
+            ret = false;
+        }
+    }
+    else { // { listAllocatedSize_ > 0U }
+           //The array has already memory reserved, so it reallocates memory for it
+        void *memoryPointer = allocatedMemory_;
+        allocatedMemory_ = static_cast<uint8 *>(HeapManager::Realloc(memoryPointer, newCapacity * listElementSize_));
+        if (allocatedMemory_ != NULL_PTR(void *)) {
+            listCapacity_ = newCapacity;
+        }
+        else {
+            //TODO Is it assured that memoryPointer is still pointing to a valid allocated memory?
+            //Explicit rollback of allocatedMemory_
+            allocatedMemory_ = static_cast<uint8 *>(memoryPointer);
+            ret = false;
+        }
+    }
+    return ret;
+}
+
+bool StaticListHolder::Add(const void * const copyFrom,
+                           const uint32 numberOfElements) {
+    //Checks the precondition
+    bool ret = (copyFrom != NULL_PTR(void *));
     if (ret) {
-        uint32 tempListAllocatedSize = listCapacity_ + listAllocationGranularity_;
-        if (listCapacity_ == 0U) {
-            //The array has not memory reserved, yet, so it allocates memory for it
-            allocatedMemory_ = static_cast<uint8 *>(HeapManager::Malloc(tempListAllocatedSize * listElementSize_));
-            if (allocatedMemory_ != NULL_PTR(void *)) {
-                listCapacity_ = tempListAllocatedSize;
-            }
-            else {
-                //Implicit rollback of allocatedMemory_
-                ret = false;
-            }
+        ret = (numberOfElements <= (maxListCapacity_ - listSize_));
+    }
+
+    // Increases capacity (once) if after adding the elements, the list is going to fall short of space.
+    if ((ret) && (numberOfElements > 0u)) {
+        if ((listSize_ + numberOfElements) > listCapacity_) {
+            ret = IncreaseCapacity(listSize_ + numberOfElements);
         }
-        else { // { listAllocatedSize_ > 0U }
-               //The array has already memory reserved, so it reallocates memory for it
-            void *memoryPointer = allocatedMemory_;
-            allocatedMemory_ = static_cast<uint8 *>(HeapManager::Realloc(memoryPointer, tempListAllocatedSize * listElementSize_));
-            if (allocatedMemory_ != NULL_PTR(void *)) {
-                listCapacity_ = tempListAllocatedSize;
-            }
-            else {
-                //TODO Is it assured that memoryPointer is still pointing to a valid allocated memory?
-                //Explicit rollback of allocatedMemory_
-                allocatedMemory_ = static_cast<uint8 *>(memoryPointer);
-                ret = false;
+        //Copies the elements to the back of the list
+        if (ret) {
+            /*lint -e{9016} This implementation uses pointer arithmetic instead of array indexing*/
+            /*lint -e{679} This implementation uses pointer arithmetic instead of array indexing*/
+            uint8* pointer = (allocatedMemory_ + (listElementSize_ * listSize_));
+            ret = MemoryOperationsHelper::Copy(pointer, copyFrom, listElementSize_ * numberOfElements);
+            if (ret) {
+                listSize_ += numberOfElements;
             }
         }
     }
+
+    return ret;
+}
+
+bool StaticListHolder::Reserve(const uint32 capacity) {
+    //Checks the precondition
+    bool ret = (capacity <= maxListCapacity_);
+    if ((ret) && (capacity > listCapacity_)) {
+        //Rounds up to the granularity (maxListCapacity_ is a multiple of it)
+        uint32 newCapacity = capacity;
+        uint32 remainder = newCapacity % listAllocationGranularity_;
+        if (remainder > 0u) {
+            newCapacity += (listAllocationGranularity_ - remainder);
+        }
+        ret = Resize(newCapacity);
+    }
     return ret;
 }
 
@@ -314,6 +363,14 @@ const void* StaticListHolder::GetAllocatedMemoryConst() const {
     return reinterpret_cast<const void *>(allocatedMemory_);
 }
 
+void* StaticListHolder::Release() {
+    void *memory = reinterpret_cast<void *>(allocatedMemory_);
+    allocatedMemory_ = NULL_PTR(uint8 *);
+    listCapacity_ = 0u;
+    listSize_ = 0u;
+    return memory;
+}
+
 bool StaticListHolder::Set(const uint32 position,
                            const void * const value) {
     bool ret = (position < listSize_);
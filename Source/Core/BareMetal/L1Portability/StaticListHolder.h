@@ -83,16 +83,18 @@ namespace MARTe {
  * - Size: The number of elements that the list actually holds.
  * - Capacity: The number of elements that the list actually holds plus the
  * number of reserved spaces in memory for storing new elements.
- * of the array. The capacity grows dynamically in increments specified by
- * the allocation granularity.
+ * of the array. The capacity grows dynamically by half of its value (and at
+ * least by the allocation granularity), so that adding n elements one by one
+ * copies O(n) elements in total. It can also be reserved in advance (see Reserve).
  * - ElementTypeSize: The size in bytes of the type of the elements. It will
  * typically be sizeof(type) or sizeof(type*) in case the elements were
  * pointers.
  * - MaxCapacity: The maximum theoretically capacity of the list taking
  * into account the element type size, the allocation granularity, and the
  * maximum value for the numeric type used for indexing positions.
- * - AllocationGranularity: The number of elements that the list must reserve
- * as space in memory in advance each time that needs to grow.
+ * - AllocationGranularity: The minimum number of elements that the list must reserve
+ * as space in memory in advance each time that needs to grow. The capacity is always
+ * a multiple of the allocation granularity.
  *
  * Formulae
  * --------
@@ -112,7 +114,8 @@ namespace MARTe {
  * Responsibilities
  * ----------------
  *
- * - Adding new elements at the back of the array.
+ * - Adding new elements (one or many at once) at the back of the array.
+ * - Reserving the capacity for a known number of elements.
  * - Inserting new elements at any position of the array.
  * - Removing elements from any position of the array.
  * - Peeking elements from any position of the array.
@@ -183,6 +186,33 @@ public:
      */
     bool Add(const void * const copyFrom);
 
+    /**
+     * @brief Adds many elements at the end of the list, with at most one reallocation and a single copy.
+     * @param[in] copyFrom The pointer to the memory address where the new elements must be copied from
+     * @param[in] numberOfElements The number of elements to be copied from \a copyFrom
+     * @return false if precondition is broken or memory allocation fails
+     * @pre
+     *   copyFrom != NULL &&
+     *   GetSize() + numberOfElements <= GetMaxCapacity()
+     * @post
+     *   GetSize() == this'old->GetSize() + numberOfElements &&
+     *   {i:uint32 in [0..numberOfElements-1] | Peek(this'old->GetSize()+i,value) => *value == copyFrom[i]}
+     * @warning *copyFrom must be a valid allocated memory of size numberOfElements * GetElementSize()
+     */
+    bool Add(const void * const copyFrom,
+             const uint32 numberOfElements);
+
+    /**
+     * @brief Reserves the memory for at least \a capacity elements, so that the list does not grow until it holds them.
+     * @details The capacity is rounded up to the allocation granularity. A \a capacity smaller than the current capacity is ignored
+     * (the list never shrinks).
+     * @param[in] capacity The number of elements to be reserved
+     * @return false if \a capacity > GetMaxCapacity() or memory allocation fails
+     * @post
+     *   GetCapacity() >= capacity
+     */
+    bool Reserve(const uint32 capacity);
+
     /**
      * @brief Remove all elements. Does not shrink list or free memory
      * @post GetSize() = 0
@@ -278,15 +308,33 @@ public:
      */
     const void* GetAllocatedMemoryConst() const;
 
+    /**
+     * @brief Gives the allocated memory area (allocated with HeapManager) to the caller, which becomes responsible for freeing it.
+     * @return the pointer to the allocated memory area.
+     * @post
+     *   GetSize() == 0 &&
+     *   GetCapacity() == 0
+     */
+    void* Release();
+
 private:
 
     /**
-     * @brief Increases the capacity of the list
+     * @brief Increases the capacity of the list by half (and at least by the allocation granularity and up to the maximum capacity)
+     * @param[in] minimumCapacity The capacity that the list must at least have
      * @return false if precondition is broken or memory allocation fails
-     * @pre GetCapacity() + GetAllocationGranularity() <= GetMaxCapacity()
-     * @post GetCapacity() == GetCapacity()'old + GetAllocationGranularity()
+     * @pre minimumCapacity <= GetMaxCapacity()
+     * @post GetCapacity() >= minimumCapacity
+     */
+    bool IncreaseCapacity(const uint32 minimumCapacity);
+
+    /**
+     * @brief Allocates or reallocates the memory of the list
+     * @param[in] newCapacity The new capacity (a multiple of the allocation granularity)
+     * @return false if the memory allocation fails (the list is then not changed)
+     * @post GetCapacity() == newCapacity
      */
-    bool IncreaseCapacity(void);
+    bool Resize(const uint32 newCapacity);
 
     /**
      * Stores the ElementSize
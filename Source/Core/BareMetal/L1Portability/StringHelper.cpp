@@ -25,6 +25,10 @@
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
 
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
@@ -36,6 +40,30 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+#if defined(__ARM_NEON) && defined(__aarch64__)
+namespace MARTe {
+
+namespace StringHelper {
+
+/**
+ * Size of the smallest memory page. Loads which do not cross a page boundary cannot fault
+ * if their first byte is readable.
+ */
+static const uintp STRING_HELPER_PAGE_SIZE = 4096u;
+
+/**
+ * @brief Gets a 64 bit mask with 4 bits set for each lane of \a lanes which is 0xFF.
+ */
+static inline uint64 StringHelperLaneMask(const uint8x16_t lanes) {
+    uint8x8_t narrow = vshrn_n_u16(vreinterpretq_u16_u8(lanes), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(narrow), 0);
+}
+
+}
+
+}
+#endif
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -137,6 +165,77 @@ bool ToLower(char8* const string) {
     
 }
 
+uint32 ComponentLength(const char8* const string,
+                       const char8 separator) {
+    uint32 length = 0u;
+    if (string != NULL) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+        //Aligned loads starting at or before the string: the lanes before the string are masked out
+        /*lint -e{923} -e{927} cast pointer to integer and to the NEON element type*/
+        uintp misalignment = reinterpret_cast<uintp>(string) & 15u;
+        const uint8 *block = reinterpret_cast<const uint8 *>(&string[0]) - misalignment;
+        const uint8x16_t separators = vdupq_n_u8(static_cast<uint8>(separator));
+        uint8x16_t characters = vld1q_u8(block);
+        uint64 mask = StringHelperLaneMask(vorrq_u8(vceqq_u8(characters, separators), vceqzq_u8(characters)));
+        mask >>= (misalignment * 4u);
+        uint32 scanned = static_cast<uint32>(16u - misalignment);
+        while (mask == 0u) {
+            block = &block[16];
+            characters = vld1q_u8(block);
+            mask = StringHelperLaneMask(vorrq_u8(vceqq_u8(characters, separators), vceqzq_u8(characters)));
+            if (mask == 0u) {
+                scanned += 16u;
+            }
+            else {
+                length = scanned;
+            }
+        }
+        length += static_cast<uint32>(__builtin_ctzll(mask) / 4);
+#else
+        while ((string[length] != separator) && (string[length] != '\0')) {
+            length++;
+        }
+#endif
+    }
+    return length;
+}
+
+bool EqualsN(const char8* const string,
+             const char8* const component,
+             const uint32 size) {
+    bool equal = ((string != NULL) && (component != NULL));
+    uint32 i = 0u;
+    if (equal) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+        //Unaligned loads of string are only done if they do not cross a page (as the string may be shorter than size)
+        bool vector = true;
+        while ((equal) && (vector) && ((i + 16u) <= size)) {
+            /*lint -e{923} cast pointer to integer*/
+            vector = ((reinterpret_cast<uintp>(&string[i]) & (STRING_HELPER_PAGE_SIZE - 1u)) <= (STRING_HELPER_PAGE_SIZE - 16u));
+            if (vector) {
+                /*lint -e{927} cast to the NEON element type*/
+                uint8x16_t characters = vld1q_u8(reinterpret_cast<const uint8 *>(&string[i]));
+                uint8x16_t others = vld1q_u8(reinterpret_cast<const uint8 *>(&component[i]));
+                //Equal and not the terminator
+                uint8x16_t same = vandq_u8(vceqq_u8(characters, others), vtstq_u8(characters, characters));
+                equal = (vminvq_u8(same) == 0xFFu);
+                if (equal) {
+                    i += 16u;
+                }
+            }
+        }
+#endif
+        while ((equal) && (i < size)) {
+            equal = ((string[i] == component[i]) && (string[i] != '\0'));
+            i++;
+        }
+        if (equal) {
+            equal = (string[size] == '\0');
+        }
+    }
+    return equal;
+}
+
 }
 
 }
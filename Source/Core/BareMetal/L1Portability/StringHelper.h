@@ -252,6 +252,30 @@ DLL_API bool SetChar(char8* const string,
                      const uint32 size,
                      const char8 c);
 
+/**
+ * @brief Returns the length of the first component of a path, i.e. the number of characters before
+ * the first \a separator or the end of the string (e.g. "abc.de" '.' returns 3).
+ * @details On armv8 the string is scanned 16 characters at a time with aligned loads (which never cross a page).
+ * @param[in] string the path.
+ * @param[in] separator the separator of the path components.
+ * @return the length of the first component or 0 if \a string is NULL.
+ */
+DLL_API uint32 ComponentLength(const char8* const string,
+                               const char8 separator);
+
+/**
+ * @brief Checks if a string is equal to a component of a path, which is not terminated (see ComponentLength).
+ * @details Equivalent to (CompareN(string, component, size) == 0) && (Length(string) == size), in a single pass
+ * which compares 16 characters at a time on armv8.
+ * @param[in] string the (terminated) string.
+ * @param[in] component the first character of the component.
+ * @param[in] size the number of characters of \a component.
+ * @return true if \a string has exactly \a size characters, equal to the ones of \a component.
+ */
+DLL_API bool EqualsN(const char8* const string,
+                     const char8* const component,
+                     const uint32 size);
+
 /**
  * @brief Get the token using characters as delimiters.
  * @param[in] string is the string to tokenize.
@@ -0,0 +1,125 @@
+/**
+ * @file TimeStampCache.h
+ * @brief Header file for class TimeStampCache
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class TimeStampCache
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TIMESTAMPCACHE_H_
+#define TIMESTAMPCACHE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "TimeStamp.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The number of characters of the ISO-8601 local time written by TimeStampCache::GetISO8601 (YYYY-MM-DDThh:mm:ss+hh:mm).
+ */
+static const uint32 TIME_STAMP_CACHE_ISO8601_SIZE = 25u;
+
+/**
+ * @brief Converts the seconds from the epoch into calendar (local time) fields, only calling the operating system when the minute changes.
+ * @details The conversion of the operating system (see TimeStamp::ConvertFromEpoch) takes the time zone into account and is by far
+ * the most expensive part of printing a time (e.g. in every log message, see LoggerConsumerI). The cache keeps the fields, and their
+ * ISO-8601 representation, of the last minute which was converted: the times in the same minute (which is the case for almost all the
+ * consecutive log messages) only update the seconds, with no call to the operating system. The cache is refreshed at every new
+ * minute, which is enough to follow the time zone changes (all the time zone offsets are whole minutes).
+ * @warning The cache is not thread safe: each thread shall use its own.
+ */
+class DLL_API TimeStampCache {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   The cache is empty (the first conversion calls the operating system).
+     */
+    TimeStampCache();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~TimeStampCache();
+
+    /**
+     * @brief Converts the seconds from the epoch into the calendar fields of the local time.
+     * @param[in] secondsFromEpoch the seconds from the epoch.
+     * @param[out] timeStamp the calendar fields (the microseconds are not changed).
+     * @return true if the time could be converted.
+     */
+    bool Convert(const oslong secondsFromEpoch,
+                 TimeStamp &timeStamp);
+
+    /**
+     * @brief Gets the ISO-8601 representation of the local time.
+     * @param[in] secondsFromEpoch the seconds from the epoch.
+     * @return TIME_STAMP_CACHE_ISO8601_SIZE characters (zero terminated), valid until the next call on this object, or NULL if the
+     * time could not be converted.
+     */
+    const char8 *GetISO8601(const oslong secondsFromEpoch);
+
+private:
+
+    /**
+     * @brief Updates the cache to \a secondsFromEpoch.
+     * @return true if the time could be converted.
+     */
+    bool Update(const oslong secondsFromEpoch);
+
+    /**
+     * The seconds from the epoch of the first second of the cached minute.
+     */
+    oslong minuteStart;
+
+    /**
+     * True if the cache holds a minute.
+     */
+    bool valid;
+
+    /**
+     * The calendar fields of the last converted time.
+     */
+    TimeStamp cached;
+
+    /**
+     * The ISO-8601 representation of the last converted time.
+     */
+    char8 iso8601[TIME_STAMP_CACHE_ISO8601_SIZE + 1u];
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TIMESTAMPCACHE_H_ */
@@ -0,0 +1,421 @@
+/**
+ * @file Trace.cpp
+ * @brief Source file for module Trace
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module Trace (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "FastPollingMutexSem.h"
+#include "HighResolutionTimer.h"
+#include "StringHelper.h"
+#include "Trace.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace Trace {
+
+/**
+ * @brief The events recorded by one thread.
+ */
+struct TraceRing {
+    /**
+     * The events (mask + 1 elements).
+     */
+    TraceEvent *events;
+
+    /**
+     * Number of events recorded since the ring was claimed (only written by the owner thread).
+     */
+    volatile int64 head;
+
+    /**
+     * The operating system identifier of the owner thread.
+     */
+    uint32 threadId;
+
+    /**
+     * Keeps the heads of consecutive rings in different cache lines.
+     */
+    uint8 padding[64];
+};
+
+/**
+ * Maximum number of characters (including the terminators) of all the registered names.
+ */
+static const uint32 TRACE_NAMES_SIZE = 32768u;
+
+/**
+ * Maximum number of registered names.
+ */
+static const uint32 TRACE_MAX_NAMES = 1024u;
+
+/**
+ * Number of rings allocated by Enable if Initialise was not called.
+ */
+static const uint32 TRACE_DEFAULT_NUMBER_OF_THREADS = 64u;
+
+/**
+ * Number of events in each ring allocated by Enable if Initialise was not called.
+ */
+static const uint32 TRACE_DEFAULT_NUMBER_OF_EVENTS = 4096u;
+
+/**
+ * Maximum length of a line written to the trace_marker.
+ */
+static const uint32 TRACE_MARKER_LINE_SIZE = 128u;
+
+volatile int32 enabled = 0;
+
+/**
+ * The rings (numberOfRings elements).
+ */
+static TraceRing *rings = NULL_PTR(TraceRing *);
+
+/**
+ * Number of elements in rings.
+ */
+static uint32 numberOfRings = 0u;
+
+/**
+ * Number of rings claimed by threads (may be greater than numberOfRings if too many threads recorded events).
+ */
+static volatile int32 numberOfClaimedRings = 0;
+
+/**
+ * Number of events in each ring - 1.
+ */
+static uint32 ringMask = 0u;
+
+/**
+ * The characters of the registered names (each one terminated by a 0).
+ */
+static char8 names[TRACE_NAMES_SIZE] = "Unnamed";
+
+/**
+ * The position of each registered name in names.
+ */
+static uint32 nameOffsets[TRACE_MAX_NAMES] = { 0u };
+
+/**
+ * Number of registered names (the first one is "Unnamed").
+ */
+static uint32 numberOfNames = 1u;
+
+/**
+ * Number of characters used in names.
+ */
+static uint32 namesSize = 8u;
+
+/**
+ * Protects the allocation of the rings and the registration of the names.
+ */
+static FastPollingMutexSem traceMux;
+
+/**
+ * The handle of the trace_marker (-1 if the events are not written to the kernel tracer).
+ */
+static volatile int32 kernelMarkers = -1;
+
+/**
+ * The ring of the calling thread (NULL until the thread records the first event).
+ */
+static THREAD_LOCAL TraceRing *threadRing = NULL_PTR(TraceRing *);
+
+/**
+ * True if the calling thread could not claim a ring (all taken).
+ */
+static THREAD_LOCAL bool threadWithoutRing = false;
+
+/**
+ * The text written to the trace_marker for each event type (B: begin, E: end, I: instant).
+ */
+static const char8 * const kernelMarkerPrefixes[] = { "MARTe2 I ", "MARTe2 B Cycle ", "MARTe2 E Cycle ", "MARTe2 B ", "MARTe2 E ", "MARTe2 I State ",
+        "MARTe2 B Flush ", "MARTe2 E Flush ", "MARTe2 B Wait ", "MARTe2 E Wait " };
+
+/**
+ * Number of elements in kernelMarkerPrefixes.
+ */
+static const uint16 TRACE_NUMBER_OF_PREFIXES = 10u;
+
+/**
+ * @brief Claims a ring for the calling thread.
+ * @return the ring or NULL if all the rings are taken.
+ */
+static TraceRing *ClaimRing() {
+    TraceRing *ring = NULL_PTR(TraceRing *);
+    if (!threadWithoutRing) {
+        int32 ringIdx = Atomic::FetchAdd(&numberOfClaimedRings, 1);
+        if (static_cast<uint32>(ringIdx) < numberOfRings) {
+            ring = &rings[ringIdx];
+            ring->threadId = GetThreadId();
+            threadRing = ring;
+        }
+        else {
+            threadWithoutRing = true;
+        }
+    }
+    return ring;
+}
+
+/**
+ * @brief Appends text to a trace_marker line.
+ */
+static void AppendMarkerText(char8 * const line,
+                             uint32 &size,
+                             const char8 * const text) {
+    uint32 i = 0u;
+    while ((text[i] != '\0') && (size < (TRACE_MARKER_LINE_SIZE - 1u))) {
+        line[size] = text[i];
+        size++;
+        i++;
+    }
+}
+
+/**
+ * @brief Writes an event to the trace_marker as "MARTe2 <B|E|I> [<category>] <name> <argument>".
+ */
+static void WriteEventMarker(const int32 handle,
+                             const uint16 type,
+                             const uint32 nameId,
+                             const uint32 argument) {
+    char8 line[TRACE_MARKER_LINE_SIZE];
+    uint32 size = 0u;
+    uint16 prefix = type;
+    if (prefix >= TRACE_NUMBER_OF_PREFIXES) {
+        prefix = 0u;
+    }
+    AppendMarkerText(&line[0], size, kernelMarkerPrefixes[prefix]);
+    AppendMarkerText(&line[0], size, GetName(nameId));
+    char8 digits[12];
+    uint32 numberOfDigits = 0u;
+    uint32 value = argument;
+    do {
+        digits[numberOfDigits] = static_cast<char8>('0' + static_cast<char8>(value % 10u));
+        numberOfDigits++;
+        value /= 10u;
+    }
+    while (value > 0u);
+    digits[numberOfDigits] = ' ';
+    numberOfDigits++;
+    while ((numberOfDigits > 0u) && (size < (TRACE_MARKER_LINE_SIZE - 1u))) {
+        numberOfDigits--;
+        line[size] = digits[numberOfDigits];
+        size++;
+    }
+    line[size] = '\n';
+    size++;
+    WriteKernelMarker(handle, &line[0], size);
+}
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace Trace {
+
+bool Initialise(const uint32 maxNumberOfThreads,
+                const uint32 numberOfEvents) {
+    bool ok = ((numberOfEvents > 0u) && ((numberOfEvents & (numberOfEvents - 1u)) == 0u) && (maxNumberOfThreads > 0u));
+    if (ok) {
+        ok = (traceMux.FastLock() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (rings == NULL_PTR(TraceRing *));
+        if (ok) {
+            TraceRing *newRings = new TraceRing[maxNumberOfThreads];
+            for (uint32 r = 0u; r < maxNumberOfThreads; r++) {
+                newRings[r].events = new TraceEvent[numberOfEvents];
+                newRings[r].head = 0;
+                newRings[r].threadId = 0u;
+            }
+            ringMask = (numberOfEvents - 1u);
+            numberOfRings = maxNumberOfThreads;
+            //The rings are only claimed after the trace is enabled (which implies that they exist)
+            Atomic::ThreadFence(Atomic::MemoryOrderRelease);
+            rings = newRings;
+        }
+        traceMux.FastUnLock();
+    }
+    return ok;
+}
+
+void Enable() {
+    (void) Initialise(TRACE_DEFAULT_NUMBER_OF_THREADS, TRACE_DEFAULT_NUMBER_OF_EVENTS);
+    Atomic::StoreRelease(&enabled, 1);
+}
+
+void Disable() {
+    Atomic::StoreRelease(&enabled, 0);
+}
+
+uint32 RegisterName(const char8 * const name) {
+    uint32 nameId = 0u;
+    if (name != NULL_PTR(const char8 *)) {
+        if (traceMux.FastLock() == ErrorManagement::NoError) {
+            bool found = false;
+            uint32 n;
+            for (n = 1u; (n < numberOfNames) && (!found); n++) {
+                found = (StringHelper::Compare(&names[nameOffsets[n]], name) == 0);
+                if (found) {
+                    nameId = n;
+                }
+            }
+            uint32 size = (StringHelper::Length(name) + 1u);
+            if ((!found) && (numberOfNames < TRACE_MAX_NAMES) && ((namesSize + size) <= TRACE_NAMES_SIZE)) {
+                (void) StringHelper::Copy(&names[namesSize], name);
+                nameOffsets[numberOfNames] = namesSize;
+                namesSize += size;
+                nameId = numberOfNames;
+                //The events may be exported by other threads while the names are registered
+                Atomic::ThreadFence(Atomic::MemoryOrderRelease);
+                numberOfNames++;
+            }
+            traceMux.FastUnLock();
+        }
+    }
+    return nameId;
+}
+
+const char8 *GetName(const uint32 nameId) {
+    uint32 offset = 0u;
+    if (nameId < numberOfNames) {
+        offset = nameOffsets[nameId];
+    }
+    return &names[offset];
+}
+
+void Record(const uint16 type,
+            const uint32 nameId,
+            const uint32 argument) {
+    TraceRing *ring = threadRing;
+    if (ring == NULL_PTR(TraceRing *)) {
+        ring = ClaimRing();
+    }
+    if (ring != NULL_PTR(TraceRing *)) {
+        //Only this thread writes the head
+        int64 head = ring->head;
+        TraceEvent &event = ring->events[static_cast<uint32>(head) & ringMask];
+        event.ticks = HighResolutionTimer::Counter();
+        event.nameId = nameId;
+        event.type = type;
+        event.argument = argument;
+        Atomic::StoreRelease(&ring->head, head + 1);
+    }
+    int32 handle = Atomic::Load(&kernelMarkers, Atomic::MemoryOrderRelaxed);
+    if (handle >= 0) {
+        WriteEventMarker(handle, type, nameId, argument);
+    }
+}
+
+uint32 GetNumberOfRings() {
+    uint32 claimed = static_cast<uint32>(Atomic::LoadAcquire(&numberOfClaimedRings));
+    if (claimed > numberOfRings) {
+        claimed = numberOfRings;
+    }
+    return claimed;
+}
+
+uint32 GetRingSize() {
+    uint32 size = 0u;
+    if (numberOfRings > 0u) {
+        size = ringMask + 1u;
+    }
+    return size;
+}
+
+uint32 ReadEvents(const uint32 ringIdx,
+                  TraceEvent * const events,
+                  const uint32 maxNumberOfEvents,
+                  uint32 &threadId) {
+    uint32 numberOfEvents = 0u;
+    if (ringIdx < GetNumberOfRings()) {
+        const TraceRing &ring = rings[ringIdx];
+        threadId = ring.threadId;
+        int64 capacity = static_cast<int64>(ringMask) + 1;
+        int64 head = Atomic::LoadAcquire(&ring.head);
+        int64 first = head - capacity;
+        if (first < 0) {
+            first = 0;
+        }
+        if ((head - first) > static_cast<int64>(maxNumberOfEvents)) {
+            first = head - static_cast<int64>(maxNumberOfEvents);
+        }
+        for (int64 e = first; e < head; e++) {
+            events[e - first] = ring.events[static_cast<uint32>(e) & ringMask];
+        }
+        Atomic::ThreadFence(Atomic::MemoryOrderAcquire);
+        //The owner may have overwritten the oldest events (including the one being written, not yet published) during the copy
+        int64 valid = (Atomic::LoadAcquire(&ring.head) + 1) - capacity;
+        int64 discarded = 0;
+        if (valid > first) {
+            discarded = valid - first;
+            if (discarded > (head - first)) {
+                discarded = (head - first);
+            }
+        }
+        numberOfEvents = static_cast<uint32>((head - first) - discarded);
+        for (uint32 e = 0u; e < numberOfEvents; e++) {
+            events[e] = events[static_cast<uint32>(discarded) + e];
+        }
+    }
+    return numberOfEvents;
+}
+
+bool EnableKernelMarkers(const bool enable) {
+    bool ok = true;
+    if (traceMux.FastLock() == ErrorManagement::NoError) {
+        int32 handle = Atomic::Load(&kernelMarkers, Atomic::MemoryOrderRelaxed);
+        if ((enable) && (handle < 0)) {
+            handle = OpenKernelMarkers();
+            ok = (handle >= 0);
+            Atomic::StoreRelease(&kernelMarkers, handle);
+        }
+        else if ((!enable) && (handle >= 0)) {
+            //A thread which already read the handle may still write one event
+            Atomic::StoreRelease(&kernelMarkers, -1);
+            CloseKernelMarkers(handle);
+        }
+        else {
+            //Nothing to change
+        }
+        traceMux.FastUnLock();
+    }
+    return ok;
+}
+
+}
+
+}
@@ -0,0 +1,292 @@
+/**
+ * @file Trace.h
+ * @brief Header file for module Trace
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module Trace
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "Atomic.h"
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief An event recorded by Trace::Record.
+     */
+    struct TraceEvent {
+        /**
+         * HighResolutionTimer::Counter() when the event was recorded.
+         */
+        uint64 ticks;
+
+        /**
+         * The identifier of the name of the event (see Trace::RegisterName).
+         */
+        uint32 nameId;
+
+        /**
+         * One of the Trace::EVENT_ constants.
+         */
+        uint16 type;
+
+        /**
+         * Unused (keeps the size of the event a multiple of 8 bytes).
+         */
+        uint16 reserved;
+
+        /**
+         * A value associated to the event (e.g. the number of buffers flushed by a broker).
+         */
+        uint32 argument;
+
+        /**
+         * Unused (keeps the size of the event a multiple of 8 bytes).
+         */
+        uint32 padding;
+    };
+
+    /**
+     * @brief Low overhead trace markers, to correlate the phases of the real-time cycles with the events of the operating system.
+     * @details Each thread records the events in its own ring of TraceEvents (claimed the first time that the thread records an event),
+     * without locks or system calls, so that a recording costs a few nanoseconds. When the ring is full the oldest events are overwritten.
+     * The rings can be read at any time with ReadEvents (e.g. to export them in the Chrome/Perfetto JSON format with TraceExporter).
+     *
+     * The events are recorded with the MARTe2_TRACE_EVENT macro, which is compiled out unless MARTe2_TRACE is defined
+     * (MARTe2_TRACE=1 in the make command line, the default) and, when compiled, only records while the trace is enabled (Enable/Disable).
+     *
+     * Optionally (EnableKernelMarkers) the events are also written as text to the trace_marker of the kernel tracer (ftrace), so that they
+     * appear in the kernel traces. Each of these writes is a system call (microseconds).
+     */
+    namespace Trace {
+
+        /**
+         * A real-time thread starts a cycle.
+         */
+        static const uint16 EVENT_CYCLE_BEGIN = 1u;
+
+        /**
+         * A real-time thread ends a cycle.
+         */
+        static const uint16 EVENT_CYCLE_END = 2u;
+
+        /**
+         * An ExecutableI (GAM or broker) starts its execution.
+         */
+        static const uint16 EVENT_EXECUTABLE_BEGIN = 3u;
+
+        /**
+         * An ExecutableI (GAM or broker) ends its execution.
+         */
+        static const uint16 EVENT_EXECUTABLE_END = 4u;
+
+        /**
+         * The scheduler prepares the change to a new state (the name is the name of the state).
+         */
+        static const uint16 EVENT_STATE_CHANGE = 5u;
+
+        /**
+         * An asynchronous broker starts writing buffers to its DataSource (the argument is the number of buffers).
+         */
+        static const uint16 EVENT_BROKER_FLUSH_BEGIN = 6u;
+
+        /**
+         * An asynchronous broker ends writing buffers to its DataSource.
+         */
+        static const uint16 EVENT_BROKER_FLUSH_END = 7u;
+
+        /**
+         * A thread blocks on a semaphore.
+         */
+        static const uint16 EVENT_SEMAPHORE_WAIT_BEGIN = 8u;
+
+        /**
+         * A thread blocked on a semaphore is released.
+         */
+        static const uint16 EVENT_SEMAPHORE_WAIT_END = 9u;
+
+        /**
+         * @brief Allocates the rings. Only the first call (including the implicit call from Enable) is effective.
+         * @param[in] maxNumberOfThreads the maximum number of threads that can record events.
+         * @param[in] numberOfEvents the number of events in each ring. Must be a power of 2.
+         * @return true if the rings were allocated by this call.
+         */
+        DLL_API bool Initialise(const uint32 maxNumberOfThreads,
+                                const uint32 numberOfEvents);
+
+        /**
+         * @brief Starts recording the events. If Initialise was not called, allocates 64 rings of 4096 events.
+         */
+        DLL_API void Enable();
+
+        /**
+         * @brief Stops recording the events. The recorded events are kept.
+         */
+        DLL_API void Disable();
+
+        /**
+         * @brief Checks if the events are being recorded.
+         * @return true if Enable was called (and Disable was not called after).
+         */
+        inline bool IsEnabled();
+
+        /**
+         * @brief Gets the identifier of a name, registering it if needed.
+         * @details Meant to be called when configuring (it takes a lock), so that the events only store the identifier.
+         * The names are never released.
+         * @param[in] name the name.
+         * @return the identifier of the name or 0 (the identifier of "Unnamed") if there is no more space for names.
+         */
+        DLL_API uint32 RegisterName(const char8 * const name);
+
+        /**
+         * @brief Gets a name registered with RegisterName.
+         * @param[in] nameId the identifier of the name.
+         * @return the name or "Unnamed" if \a nameId is not valid.
+         */
+        DLL_API const char8 *GetName(const uint32 nameId);
+
+        /**
+         * @brief Records an event in the ring of the calling thread (use the MARTe2_TRACE_EVENT macro instead).
+         * @param[in] type one of the EVENT_ constants.
+         * @param[in] nameId the identifier of the name of the event.
+         * @param[in] argument a value associated to the event.
+         */
+        DLL_API void Record(const uint16 type,
+                            const uint32 nameId,
+                            const uint32 argument);
+
+        /**
+         * @brief Gets the number of rings claimed by threads.
+         * @return the number of rings which can be read with ReadEvents.
+         */
+        DLL_API uint32 GetNumberOfRings();
+
+        /**
+         * @brief Gets the number of events in each ring.
+         * @return the number of events in each ring (0 if the rings are not allocated).
+         */
+        DLL_API uint32 GetRingSize();
+
+        /**
+         * @brief Copies the most recent events of a ring, from the oldest to the newest.
+         * @details Can be called while the owner thread is recording: the events that may have been overwritten during the copy are discarded.
+         * @param[in] ringIdx the ring index (< GetNumberOfRings()).
+         * @param[out] events where to copy the events.
+         * @param[in] maxNumberOfEvents the capacity of \a events.
+         * @param[out] threadId the operating system identifier of the thread which owns the ring.
+         * @return the number of events copied.
+         */
+        DLL_API uint32 ReadEvents(const uint32 ringIdx,
+                                  TraceEvent * const events,
+                                  const uint32 maxNumberOfEvents,
+                                  uint32 &threadId);
+
+        /**
+         * @brief Starts or stops writing the events to the trace_marker of the kernel tracer.
+         * @param[in] enable true to start writing the events.
+         * @return false if the trace_marker could not be opened (e.g. tracefs is not mounted or not writable).
+         */
+        DLL_API bool EnableKernelMarkers(const bool enable);
+
+        /**
+         * @brief Gets the operating system identifier of the calling thread (environment specific).
+         * @return the identifier of the calling thread.
+         */
+        DLL_API uint32 GetThreadId();
+
+        /**
+         * @brief Gets the operating system identifier of the process (environment specific).
+         * @return the identifier of the process.
+         */
+        DLL_API uint32 GetProcessId();
+
+        /**
+         * @brief Opens the trace_marker of the kernel tracer (environment specific).
+         * @return the handle of the trace_marker or -1 if it could not be opened.
+         */
+        DLL_API int32 OpenKernelMarkers();
+
+        /**
+         * @brief Closes the trace_marker of the kernel tracer (environment specific).
+         * @param[in] handle the handle returned by OpenKernelMarkers.
+         */
+        DLL_API void CloseKernelMarkers(const int32 handle);
+
+        /**
+         * @brief Writes a line to the trace_marker of the kernel tracer (environment specific).
+         * @param[in] handle the handle returned by OpenKernelMarkers.
+         * @param[in] text the line.
+         * @param[in] size the number of characters in \a text.
+         */
+        DLL_API void WriteKernelMarker(const int32 handle,
+                                       const char8 * const text,
+                                       const uint32 size);
+
+        /**
+         * Different from 0 while the events are recorded (use IsEnabled).
+         */
+        extern DLL_API volatile int32 enabled;
+    }
+
+}
+
+/**
+ * @brief Records a trace event if the trace is enabled. Compiled out if MARTe2_TRACE is not defined.
+ * @param[in] type one of the Trace::EVENT_ constants.
+ * @param[in] nameId the identifier of the name of the event (see Trace::RegisterName).
+ * @param[in] argument a value associated to the event.
+ */
+#ifdef MARTe2_TRACE
+#define MARTe2_TRACE_EVENT(type, nameId, argument) if (MARTe::Trace::IsEnabled()) { MARTe::Trace::Record((type), (nameId), (argument)); }
+#else
+#define MARTe2_TRACE_EVENT(type, nameId, argument)
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    namespace Trace {
+
+        bool IsEnabled() {
+            return (Atomic::Load(&enabled, Atomic::MemoryOrderRelaxed) != 0);
+        }
+
+    }
+
+}
+
+#endif /* TRACE_H_ */
@@ -0,0 +1,66 @@
+/**
+ * @file TripleBuffer.cpp
+ * @brief Source file for class TripleBuffer
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class TripleBuffer (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "TripleBuffer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+TripleBuffer::TripleBuffer() {
+    writeBuffer = 0u;
+    state = 1;
+    readBuffer = 2u;
+}
+
+TripleBuffer::~TripleBuffer() {
+}
+
+void TripleBuffer::Publish() {
+    //The exchange is sequentially consistent, so that the writes to the buffer are visible before it is published
+    int32 previous = Atomic::Exchange(&state, static_cast<int32>(writeBuffer) | NEW_DATA);
+    writeBuffer = static_cast<uint32>(previous & INDEX_MASK);
+}
+
+bool TripleBuffer::Acquire() {
+    bool newData = ((Atomic::LoadAcquire(&state) & NEW_DATA) != 0);
+    if (newData) {
+        int32 previous = Atomic::Exchange(&state, static_cast<int32>(readBuffer));
+        readBuffer = static_cast<uint32>(previous & INDEX_MASK);
+    }
+    return newData;
+}
+
+}
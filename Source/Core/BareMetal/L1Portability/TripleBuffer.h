@@ -0,0 +1,142 @@
+/**
+ * @file TripleBuffer.h
+ * @brief Header file for class TripleBuffer
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class TripleBuffer
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TRIPLEBUFFER_H_
+#define TRIPLEBUFFER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Lock-free exchange of the indexes of three buffers between one writer and one reader.
+ * @details At any time one buffer is owned by the writer (GetWriteBuffer), one by the reader (GetReadBuffer)
+ * and the third one holds the last buffer published by the writer. Publish atomically swaps the buffer of
+ * the writer with the published one and Acquire, only if a new buffer was published since the last call,
+ * swaps the buffer of the reader with the published one.
+ *
+ * Neither side ever waits for the other: the writer can publish at any rate (the buffers not acquired
+ * in the meanwhile are simply overwritten) and the reader always gets the last complete buffer.
+ * This is the pattern to let a slow thread (e.g. monitoring) read the signals of a fast thread.
+ *
+ * @warning Only one thread may call GetWriteBuffer/Publish and only one thread may call GetReadBuffer/Acquire.
+ */
+class DLL_API TripleBuffer {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetWriteBuffer() == 0u &&
+     *   GetReadBuffer() == 2u &&
+     *   not Acquire()
+     */
+    TripleBuffer();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~TripleBuffer();
+
+    /**
+     * @brief Gets the index of the buffer owned by the writer.
+     * @return the index (0, 1 or 2) of the buffer where the writer can write.
+     */
+    inline uint32 GetWriteBuffer() const;
+
+    /**
+     * @brief Publishes the buffer owned by the writer, which gets the previously published buffer.
+     * @post
+     *   GetWriteBuffer() is the buffer that was published before (or the one released by the reader).
+     */
+    void Publish();
+
+    /**
+     * @brief Gets the index of the buffer owned by the reader.
+     * @return the index (0, 1 or 2) of the buffer from where the reader can read.
+     */
+    inline uint32 GetReadBuffer() const;
+
+    /**
+     * @brief If a buffer was published since the last call, gets it as the buffer of the reader.
+     * @return true if GetReadBuffer() changed to a newly published buffer.
+     */
+    bool Acquire();
+
+private:
+
+    /**
+     * Flag set in the state when the published buffer was not acquired yet.
+     */
+    static const int32 NEW_DATA = 4;
+
+    /**
+     * Mask of the buffer index in the state.
+     */
+    static const int32 INDEX_MASK = 3;
+
+    /**
+     * The published buffer and the NEW_DATA flag.
+     */
+    volatile int32 state;
+
+    /**
+     * The buffer owned by the writer.
+     */
+    uint32 writeBuffer;
+
+    /**
+     * The buffer owned by the reader.
+     */
+    uint32 readBuffer;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+uint32 TripleBuffer::GetWriteBuffer() const {
+    return writeBuffer;
+}
+
+uint32 TripleBuffer::GetReadBuffer() const {
+    return readBuffer;
+}
+
+}
+
+#endif /* TRIPLEBUFFER_H_ */
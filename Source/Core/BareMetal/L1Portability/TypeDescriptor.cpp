@@ -30,7 +30,9 @@
 /*---------------------------------------------------------------------------*/
 
 #include "TypeDescriptor.h"
+#include "HashIndex.h"
 #include "StringHelper.h"
+#include "WyHashFunction.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -68,6 +70,95 @@ static const TypeCastInfo basicTypeInfo[] = {
         { VoidType, "void"},
         { InvalidType, static_cast<const char8*>(NULL)}
 };
+
+/**
+ * @brief Hash tables of the basicTypeInfo by name and by TypeDescriptor, so that the lookups do not scan the table.
+ */
+class BasicTypeIndex {
+public:
+
+    /**
+     * @brief Indexes all the elements of basicTypeInfo.
+     */
+    BasicTypeIndex() {
+        uint32 typeIndex = 0u;
+        while (basicTypeInfo[typeIndex].castName != NULL) {
+            (void) names.Insert(names.Key(basicTypeInfo[typeIndex].castName), typeIndex);
+            uint16 code = DescriptorCode(basicTypeInfo[typeIndex].typeDes);
+            (void) descriptors.Insert(descriptors.Key(reinterpret_cast<const char8 *>(&code), static_cast<uint32>(sizeof(uint16))), typeIndex);
+            typeIndex++;
+        }
+        invalidIndex = typeIndex;
+    }
+
+    /**
+     * @brief Returns the position of \a typeName in basicTypeInfo (the position of InvalidType if not found).
+     */
+    uint32 FindName(const char8 * const typeName) {
+        uint32 found = invalidIndex;
+        if (typeName != NULL) {
+            uint32 key = names.Key(typeName);
+            uint32 cursor = 0u;
+            uint32 typeIndex = 0u;
+            while ((found == invalidIndex) && (names.Search(key, cursor, typeIndex))) {
+                if (StringHelper::Compare(typeName, basicTypeInfo[typeIndex].castName) == 0) {
+                    found = typeIndex;
+                }
+            }
+        }
+        return found;
+    }
+
+    /**
+     * @brief Returns the position of \a typeDescriptor in basicTypeInfo (the position of InvalidType if not found).
+     */
+    uint32 FindDescriptor(const TypeDescriptor &typeDescriptor) {
+        uint32 found = invalidIndex;
+        uint16 code = DescriptorCode(typeDescriptor);
+        uint32 key = descriptors.Key(reinterpret_cast<const char8 *>(&code), static_cast<uint32>(sizeof(uint16)));
+        uint32 cursor = 0u;
+        uint32 typeIndex = 0u;
+        //The first in the table, as with a linear search
+        while (descriptors.Search(key, cursor, typeIndex)) {
+            if ((typeIndex < found) && (basicTypeInfo[typeIndex].typeDes == typeDescriptor)) {
+                found = typeIndex;
+            }
+        }
+        return found;
+    }
+
+private:
+
+    /**
+     * @brief The hashed value of a TypeDescriptor, ignoring the constant flag (as in TypeDescriptor::operator==).
+     */
+    static uint16 DescriptorCode(const TypeDescriptor &typeDescriptor) {
+        return static_cast<uint16>(typeDescriptor.all | (0x0002u));
+    }
+
+    /**
+     * basicTypeInfo positions by castName.
+     */
+    HashIndex<uint32, WyHashFunction> names;
+
+    /**
+     * basicTypeInfo positions by typeDes.
+     */
+    HashIndex<uint32, WyHashFunction> descriptors;
+
+    /**
+     * The position of InvalidType in basicTypeInfo.
+     */
+    uint32 invalidIndex;
+};
+
+/**
+ * @brief Returns the BasicTypeIndex, built on the first call (never destroyed, as types may be looked up until the very end).
+ */
+static BasicTypeIndex &GetBasicTypeIndex() {
+    static BasicTypeIndex *basicTypeIndex = new BasicTypeIndex();
+    return *basicTypeIndex;
+}
 }
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -119,31 +210,13 @@ bool TypeDescriptor::IsNumericType() const {
 }
 
 TypeDescriptor TypeDescriptor::GetTypeDescriptorFromTypeName(const char8 * const typeName){
-    uint32 typeIndex = 0u;
-    while (basicTypeInfo[typeIndex].castName != NULL) {
-        if (StringHelper::Compare(typeName, basicTypeInfo[typeIndex].castName) == 0) {
-            break;
-        }
-        else {
-            typeIndex++;
-        }
-    }
-
+    uint32 typeIndex = GetBasicTypeIndex().FindName(typeName);
     return basicTypeInfo[typeIndex].typeDes;
 }
 
 
 const char8 *TypeDescriptor::GetTypeNameFromTypeDescriptor(const TypeDescriptor &typeDescriptor){
-    uint32 typeIndex = 0u;
-    while (basicTypeInfo[typeIndex].typeDes != InvalidType) {
-        if (basicTypeInfo[typeIndex].typeDes == typeDescriptor) {
-            break;
-        }
-        else {
-            typeIndex++;
-        }
-    }
-
+    uint32 typeIndex = GetBasicTypeIndex().FindDescriptor(typeDescriptor);
     return basicTypeInfo[typeIndex].castName;
 }
 
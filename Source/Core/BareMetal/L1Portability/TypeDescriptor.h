@@ -153,6 +153,8 @@ public:
 
     /**
      * @brief Retrieves the TypeDescriptor associated to the type name provided in input.
+     * @details Only the basic types are matched (the structured types are registered in the ClassRegistryDatabase). The names are
+     * hashed, so that the lookup is O(1).
      * @param[in] typeName is the type name input.
      * @return the TypeDescriptor associated to \a typeName. If \a typeName is not matched returns InvalidType.
      */
@@ -160,6 +162,7 @@ public:
 
     /**
      * @brief Retrieves the type name associated to the TypeDescriptor provided in input.
+     * @details As GetTypeDescriptorFromTypeName, O(1) and only for the basic types.
      * @param[in] typeDescriptor is the TypeDescriptor input.
      * @return the type name associated to \a typeDescriptor. If \a typeDescriptor is not matched returns NULL.
      */
@@ -62,8 +62,9 @@ public:
                                      ClassRegistryItem * const classRegistryItem,
                                      ClassMethodInterfaceMapper * const mapper) {
         if ((mapper != NULL) && (classRegistryItem != NULL)) {
-            classRegistryItem->AddMethod(mapper);
+            //The name is needed to index the method
             mapper->SetMethodName(methodName);
+            classRegistryItem->AddMethod(mapper);
         }
     }
 
@@ -77,6 +78,8 @@ public:
 /**
  * This macro has to be inserted in the unit file of the class with the method to register.
  * The methodName of the className will be registered in the classRegistryItem associated to this className
+ * The method can then be called either with the parameters in a StructuredDataI (see Object::CallRegisteredMethod) or, without any
+ * packing nor conversion, with typed values (see Object::CallTypedMethod and ClassMethodCaller::CallTyped).
  */
 /*lint -save -e9026 -e9024 -e9023 -e9141 -e1503
  * 9026: function-like macro defined.
@@ -138,11 +138,14 @@
      * e.g. void *MyClassType::operator new(const size_t size, Heap &heap);                                            \
      */                                                                                                                \
     void * className::operator new(const size_t size, MARTe::HeapI* const heap) {                                      \
-        void *obj = NULL_PTR(void *);                                                                                  \
-        if (heap != NULL) {                                                                                            \
-            obj = heap->Malloc(static_cast<MARTe::uint32>(size));                                                      \
-        } else {                                                                                                       \
-            obj = MARTe::HeapManager::Malloc(static_cast<MARTe::uint32>(size));                                        \
+        /* Objects in the standard heap are taken from the class pool, if any (see ClassRegistryItem::CreatePool) */   \
+        void *obj = GetClassRegistryItem_Static()->AllocateFromPool(static_cast<MARTe::uint32>(size), heap);           \
+        if (obj == NULL_PTR(void *)) {                                                                                 \
+            if (heap != NULL) {                                                                                        \
+                obj = heap->Malloc(static_cast<MARTe::uint32>(size));                                                  \
+            } else {                                                                                                   \
+                obj = MARTe::HeapManager::Malloc(static_cast<MARTe::uint32>(size));                                    \
+            }                                                                                                          \
         }                                                                                                              \
         GetClassRegistryItem_Static()->IncrementNumberOfInstances();                                                   \
         return obj;                                                                                                    \
@@ -151,7 +154,10 @@
      * e.g. void *MyClassType::operator delete(void *p);                                                               \
      */                                                                                                                \
     void className::operator delete(void *p) {                                                                         \
-        bool ok = MARTe::HeapManager::Free(p);                                                                         \
+        bool ok = GetClassRegistryItem_Static()->FreeToPool(p);                                                        \
+        if (!ok) {                                                                                                     \
+            ok = MARTe::HeapManager::Free(p);                                                                          \
+        }                                                                                                              \
         if(!ok){                                                                                                       \
             /* TODO error here */                                                                                      \
         }                                                                                                              \
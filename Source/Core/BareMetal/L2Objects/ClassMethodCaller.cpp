@@ -72,4 +72,9 @@ ErrorManagement::ErrorType ClassMethodCaller::Call(Object *object){
     return ErrorManagement::ParametersError;
 }
 
+/*lint -e{715} -e{952} [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12] [MISRA C++ Rule 7-1-1]. This function is a default implementation which does nothing*/
+ErrorManagement::ErrorType ClassMethodCaller::CallWithArguments(Object *object, const void * const signature, const void * const * const arguments){
+    return ErrorManagement::ParametersError;
+}
+
 }
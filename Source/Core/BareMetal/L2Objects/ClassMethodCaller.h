@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "ClassMethodSignature.h"
 #include "ErrorType.h"
 #include "Object.h"
 #include "StructuredDataI.h"
@@ -49,6 +50,12 @@ namespace MARTe {
 /**
  * @brief Allows to call registered methods on registered objects (see ClassMethodInterfaceMapper and CLASS_METHOD_REGISTER).
  * @details The actual implementations of this class are in ClassMethodCallerT.
+ *
+ * When the caller already has the parameters as typed values, CallTyped hands their addresses to the registered method, without packing
+ * them in a StructuredDataI and without any TypeConversion. The types shall be exactly the ones of the registered method stripped of the
+ * const and reference modifiers (e.g. CallTyped<uint32>(object, 3u) for ErrorType Method(const uint32 &)), otherwise
+ * ErrorManagement::ParametersError is returned. Methods with output (non-constant reference) parameters can only be called through a
+ * StructuredDataI.
  */
 /*lint -e{9109} forward declaration required to be able to Call the Object *.*/
 class ClassMethodCaller {
@@ -109,6 +116,72 @@ public:
      * + on success the error returned by the method called
      */
     virtual ErrorManagement::ErrorType Call(Object *object);
+
+    /**
+     * @brief Calls the class method with the parameters at the given addresses.
+     * @param[in] object is the pointer to the object owning the method.
+     * @param[in] signature the ClassMethodSignature::Get of the types of the parameters.
+     * @param[in] arguments the addresses of the parameters (as many as the types in the signature).
+     * @return
+     * + ErrorManagement::ParametersError if the signature is not the one of the method or if the method has output parameters
+     * + ErrorManagement::UnsupportedFeature if dynamic_cast to specialised class type is possible with provided argument object
+     * + on success the error returned by the method called
+     */
+    virtual ErrorManagement::ErrorType CallWithArguments(Object *object,
+                                                         const void * const signature,
+                                                         const void * const * const arguments);
+
+    /**
+     * @brief Calls the class method with one typed parameter (see class description).
+     * @param[in] object is the pointer to the object owning the method.
+     * @param[in] param1 the first parameter.
+     * @return see CallWithArguments.
+     */
+    template<typename argType1>
+    inline ErrorManagement::ErrorType CallTyped(Object * const object,
+                                                const argType1 &param1);
+
+    /**
+     * @brief Calls the class method with two typed parameters (see class description).
+     * @param[in] object is the pointer to the object owning the method.
+     * @param[in] param1 the first parameter.
+     * @param[in] param2 the second parameter.
+     * @return see CallWithArguments.
+     */
+    template<typename argType1, typename argType2>
+    inline ErrorManagement::ErrorType CallTyped(Object * const object,
+                                                const argType1 &param1,
+                                                const argType2 &param2);
+
+    /**
+     * @brief Calls the class method with three typed parameters (see class description).
+     * @param[in] object is the pointer to the object owning the method.
+     * @param[in] param1 the first parameter.
+     * @param[in] param2 the second parameter.
+     * @param[in] param3 the third parameter.
+     * @return see CallWithArguments.
+     */
+    template<typename argType1, typename argType2, typename argType3>
+    inline ErrorManagement::ErrorType CallTyped(Object * const object,
+                                                const argType1 &param1,
+                                                const argType2 &param2,
+                                                const argType3 &param3);
+
+    /**
+     * @brief Calls the class method with four typed parameters (see class description).
+     * @param[in] object is the pointer to the object owning the method.
+     * @param[in] param1 the first parameter.
+     * @param[in] param2 the second parameter.
+     * @param[in] param3 the third parameter.
+     * @param[in] param4 the fourth parameter.
+     * @return see CallWithArguments.
+     */
+    template<typename argType1, typename argType2, typename argType3, typename argType4>
+    inline ErrorManagement::ErrorType CallTyped(Object * const object,
+                                                const argType1 &param1,
+                                                const argType2 &param2,
+                                                const argType3 &param3,
+                                                const argType4 &param4);
 };
 }
 
@@ -116,4 +189,42 @@ public:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+template<typename argType1>
+ErrorManagement::ErrorType ClassMethodCaller::CallTyped(Object * const object,
+                                                        const argType1 &param1) {
+    const void *arguments[] = { &param1 };
+    return CallWithArguments(object, ClassMethodSignature<argType1>::Get(), &arguments[0]);
+}
+
+template<typename argType1, typename argType2>
+ErrorManagement::ErrorType ClassMethodCaller::CallTyped(Object * const object,
+                                                        const argType1 &param1,
+                                                        const argType2 &param2) {
+    const void *arguments[] = { &param1, &param2 };
+    return CallWithArguments(object, ClassMethodSignature<argType1, argType2>::Get(), &arguments[0]);
+}
+
+template<typename argType1, typename argType2, typename argType3>
+ErrorManagement::ErrorType ClassMethodCaller::CallTyped(Object * const object,
+                                                        const argType1 &param1,
+                                                        const argType2 &param2,
+                                                        const argType3 &param3) {
+    const void *arguments[] = { &param1, &param2, &param3 };
+    return CallWithArguments(object, ClassMethodSignature<argType1, argType2, argType3>::Get(), &arguments[0]);
+}
+
+template<typename argType1, typename argType2, typename argType3, typename argType4>
+ErrorManagement::ErrorType ClassMethodCaller::CallTyped(Object * const object,
+                                                        const argType1 &param1,
+                                                        const argType2 &param2,
+                                                        const argType3 &param3,
+                                                        const argType4 &param4) {
+    const void *arguments[] = { &param1, &param2, &param3, &param4 };
+    return CallWithArguments(object, ClassMethodSignature<argType1, argType2, argType3, argType4>::Get(), &arguments[0]);
+}
+
+}
+
 #endif /* CLASSMETHODCALLER_H_ */
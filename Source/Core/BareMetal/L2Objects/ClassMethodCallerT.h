@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "ClassMethodCaller.h"
+#include "ClassMethodSignature.h"
 #include "ReferenceContainer.h"
 #include "ReferenceT.h"
 
@@ -101,6 +102,12 @@ public:
      */
     virtual ErrorManagement::ErrorType Call(Object *object, ReferenceContainer &parameters);
 
+    /**
+     * @brief See ClassMethodCaller::CallWithArguments.
+     * @details Calls the method directly with the parameters at the given addresses (no StructuredDataI nor TypeConversion).
+     */
+    virtual ErrorManagement::ErrorType CallWithArguments(Object *object, const void * const signature, const void * const * const arguments);
+
 private:
     /**
      * Pointer to the class method
@@ -162,6 +169,12 @@ public:
      */
     virtual ErrorManagement::ErrorType Call(Object *object, ReferenceContainer &parameters);
 
+    /**
+     * @brief See ClassMethodCaller::CallWithArguments.
+     * @details Calls the method directly with the parameters at the given addresses (no StructuredDataI nor TypeConversion).
+     */
+    virtual ErrorManagement::ErrorType CallWithArguments(Object *object, const void * const signature, const void * const * const arguments);
+
 private:
     /**
      * Pointer to the class method
@@ -223,6 +236,12 @@ public:
      */
     virtual ErrorManagement::ErrorType Call(Object *object, ReferenceContainer &parameters);
 
+    /**
+     * @brief See ClassMethodCaller::CallWithArguments.
+     * @details Calls the method directly with the parameters at the given addresses (no StructuredDataI nor TypeConversion).
+     */
+    virtual ErrorManagement::ErrorType CallWithArguments(Object *object, const void * const signature, const void * const * const arguments);
+
 private:
     /**
      * Pointer to the class method
@@ -282,6 +301,12 @@ public:
      */
     virtual ErrorManagement::ErrorType Call(Object *object, ReferenceContainer &parameters);
 
+    /**
+     * @brief See ClassMethodCaller::CallWithArguments.
+     * @details Calls the method directly with the parameters at the given addresses (no StructuredDataI nor TypeConversion).
+     */
+    virtual ErrorManagement::ErrorType CallWithArguments(Object *object, const void * const signature, const void * const * const arguments);
+
 private:
     /**
      * Pointer to the class method
@@ -347,6 +372,12 @@ public:
      */
     virtual ErrorManagement::ErrorType Call(Object *object);
 
+    /**
+     * @brief See ClassMethodCaller::CallWithArguments.
+     * @details Calls the method directly with the parameters at the given addresses (no StructuredDataI nor TypeConversion).
+     */
+    virtual ErrorManagement::ErrorType CallWithArguments(Object *object, const void * const signature, const void * const * const arguments);
+
 private:
 
     /**
@@ -614,6 +645,26 @@ ErrorManagement::ErrorType ClassMethodCallerT<className, MethodPointer, argType1
     return err;
 }
 
+template<class className, typename MethodPointer, typename argType1, typename argType2, typename argType3, typename argType4>
+ErrorManagement::ErrorType ClassMethodCallerT<className, MethodPointer, argType1, argType2, argType3, argType4>::CallWithArguments(Object *object, const void * const signature, const void * const * const arguments) {
+    ErrorManagement::ErrorType err;
+
+    className* actual = dynamic_cast<className *>(object);
+    err.unsupportedFeature = (actual == static_cast<className*>(0));
+    if (err.ErrorsCleared()) {
+        //The output parameters cannot be written back to the (constant) typed values
+        err.parametersError = ((signature != ClassMethodSignature<argType1, argType2, argType3, argType4>::Get()) || (mask != 0u));
+    }
+    if (err.ErrorsCleared()) {
+        /*lint -e{9005} the constness is only removed to match the prototype of the method, which does not write the input parameters*/
+        err = (actual->*pFun)(*static_cast<argType1 *>(const_cast<void *>(arguments[0u])),
+                       *static_cast<argType2 *>(const_cast<void *>(arguments[1u])),
+                       *static_cast<argType3 *>(const_cast<void *>(arguments[2u])),
+                       *static_cast<argType4 *>(const_cast<void *>(arguments[3u])));
+    }
+    return err;
+}
+
 template<class className, typename MethodPointer, typename argType1, typename argType2, typename argType3>
 ClassMethodCallerT<className, MethodPointer, argType1, argType2, argType3, void>::ClassMethodCallerT(MethodPointer method, uint32 maskIn) {
     pFun = method;
@@ -689,6 +740,25 @@ ErrorManagement::ErrorType ClassMethodCallerT<className, MethodPointer, argType1
     return err;
 }
 
+template<class className, typename MethodPointer, typename argType1, typename argType2, typename argType3>
+ErrorManagement::ErrorType ClassMethodCallerT<className, MethodPointer, argType1, argType2, argType3, void>::CallWithArguments(Object *object, const void * const signature, const void * const * const arguments) {
+    ErrorManagement::ErrorType err;
+
+    className* actual = dynamic_cast<className *>(object);
+    err.unsupportedFeature = (actual == static_cast<className*>(0));
+    if (err.ErrorsCleared()) {
+        //The output parameters cannot be written back to the (constant) typed values
+        err.parametersError = ((signature != ClassMethodSignature<argType1, argType2, argType3>::Get()) || (mask != 0u));
+    }
+    if (err.ErrorsCleared()) {
+        /*lint -e{9005} the constness is only removed to match the prototype of the method, which does not write the input parameters*/
+        err = (actual->*pFun)(*static_cast<argType1 *>(const_cast<void *>(arguments[0u])),
+                       *static_cast<argType2 *>(const_cast<void *>(arguments[1u])),
+                       *static_cast<argType3 *>(const_cast<void *>(arguments[2u])));
+    }
+    return err;
+}
+
 template<class className, typename MethodPointer, typename argType1, typename argType2>
 ClassMethodCallerT<className, MethodPointer, argType1, argType2, void, void>::ClassMethodCallerT(MethodPointer method, uint32 maskIn) {
     pFun = method;
@@ -754,6 +824,24 @@ ErrorManagement::ErrorType ClassMethodCallerT<className, MethodPointer, argType1
 }
 
 
+template<class className, typename MethodPointer, typename argType1, typename argType2>
+ErrorManagement::ErrorType ClassMethodCallerT<className, MethodPointer, argType1, argType2, void, void>::CallWithArguments(Object *object, const void * const signature, const void * const * const arguments) {
+    ErrorManagement::ErrorType err;
+
+    className* actual = dynamic_cast<className *>(object);
+    err.unsupportedFeature = (actual == static_cast<className*>(0));
+    if (err.ErrorsCleared()) {
+        //The output parameters cannot be written back to the (constant) typed values
+        err.parametersError = ((signature != ClassMethodSignature<argType1, argType2>::Get()) || (mask != 0u));
+    }
+    if (err.ErrorsCleared()) {
+        /*lint -e{9005} the constness is only removed to match the prototype of the method, which does not write the input parameters*/
+        err = (actual->*pFun)(*static_cast<argType1 *>(const_cast<void *>(arguments[0u])),
+                       *static_cast<argType2 *>(const_cast<void *>(arguments[1u])));
+    }
+    return err;
+}
+
 template<class className, typename MethodPointer, typename argType1>
 ClassMethodCallerT<className, MethodPointer, argType1, void, void, void>::ClassMethodCallerT(MethodPointer method, uint32 maskIn) {
     pFun = method;
@@ -803,6 +891,23 @@ ErrorManagement::ErrorType ClassMethodCallerT<className, MethodPointer, argType1
     return err;
 }
 
+template<class className, typename MethodPointer, typename argType1>
+ErrorManagement::ErrorType ClassMethodCallerT<className, MethodPointer, argType1, void, void, void>::CallWithArguments(Object *object, const void * const signature, const void * const * const arguments) {
+    ErrorManagement::ErrorType err;
+
+    className* actual = dynamic_cast<className *>(object);
+    err.unsupportedFeature = (actual == static_cast<className*>(0));
+    if (err.ErrorsCleared()) {
+        //The output parameters cannot be written back to the (constant) typed values
+        err.parametersError = ((signature != ClassMethodSignature<argType1>::Get()) || (mask != 0u));
+    }
+    if (err.ErrorsCleared()) {
+        /*lint -e{9005} the constness is only removed to match the prototype of the method, which does not write the input parameters*/
+        err = (actual->*pFun)(*static_cast<argType1 *>(const_cast<void *>(arguments[0u])));
+    }
+    return err;
+}
+
 template<class className, typename MethodPointer>
 ClassMethodCallerT<className, MethodPointer, void, void, void, void>::ClassMethodCallerT(MethodPointer method, uint32 mask) {
     pFun = method;
@@ -833,6 +938,21 @@ ErrorManagement::ErrorType ClassMethodCallerT<className, MethodPointer, void, vo
     return (actual->*pFun)();
 }
 
+template<class className, typename MethodPointer>
+ErrorManagement::ErrorType ClassMethodCallerT<className, MethodPointer, void, void, void, void>::CallWithArguments(Object *object, const void * const signature, const void * const * const arguments) {
+    ErrorManagement::ErrorType err;
+
+    className* actual = dynamic_cast<className *>(object);
+    err.unsupportedFeature = (actual == static_cast<className*>(0));
+    if (err.ErrorsCleared()) {
+        err.parametersError = (signature != ClassMethodSignature<>::Get());
+    }
+    if (err.ErrorsCleared()) {
+        err = (actual->*pFun)();
+    }
+    return err;
+}
+
 template<class className, typename MethodPointer>
 ClassMethodCallerT<className, MethodPointer, StructuredDataI, void, void, void>::ClassMethodCallerT(MethodPointer method, uint32 maskIn) {
     pFun = method;
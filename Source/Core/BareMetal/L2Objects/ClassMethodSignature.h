@@ -0,0 +1,78 @@
+/**
+ * @file ClassMethodSignature.h
+ * @brief Header file for class ClassMethodSignature
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ClassMethodSignature
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CLASSMETHODSIGNATURE_H_
+#define CLASSMETHODSIGNATURE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Identifies, at compile time, the parameter types of a registered method (see ClassMethodCaller::CallTyped).
+ * @details Get returns a different address for each combination of the template parameters, so that a typed call can be matched against
+ * the registered method with a single pointer comparison. The types are the ones of the registered method stripped of the const and
+ * reference modifiers (i.e. the same for a method with a uint32 and with a const uint32 & parameter). The unused parameters are void.
+ * @tparam argType1 the type of the first parameter.
+ * @tparam argType2 the type of the second parameter.
+ * @tparam argType3 the type of the third parameter.
+ * @tparam argType4 the type of the fourth parameter.
+ */
+template<typename argType1 = void, typename argType2 = void, typename argType3 = void, typename argType4 = void>
+class ClassMethodSignature {
+public:
+
+    /**
+     * @brief Gets the identifier of the signature.
+     * @return an address which is unique for the template parameters.
+     */
+    static inline const void *Get();
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+template<typename argType1, typename argType2, typename argType3, typename argType4>
+const void *ClassMethodSignature<argType1, argType2, argType3, argType4>::Get() {
+    /*lint -e{1788} only the address of the tag is used*/
+    static const uint8 tag = 0u;
+    return &tag;
+}
+
+}
+
+#endif /* CLASSMETHODSIGNATURE_H_ */
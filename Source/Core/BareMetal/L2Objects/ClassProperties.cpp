@@ -48,6 +48,7 @@ ClassProperties::ClassProperties() {
     classVersion = static_cast<const char8 *>(NULL);
     uniqueIdentifier = 0u;
     size = 0u;
+    disabledReports = 0u;
 }
 
 ClassProperties::ClassProperties(const char8 * const cName,
@@ -55,6 +56,7 @@ ClassProperties::ClassProperties(const char8 * const cName,
                                  const char8 * const cVersion,
                                  const uint32 cSize) {
     uniqueIdentifier = 0u;
+    disabledReports = 0u;
     Reset(cName, typeidName, cVersion, cSize);
 }
 
@@ -93,4 +95,12 @@ uint32 ClassProperties::GetSize() const {
     return size;
 }
 
+void ClassProperties::SetReportMask(const ErrorManagement::ErrorType &mask) {
+    disabledReports = ~mask.format_as_integer;
+}
+
+ErrorManagement::ErrorType ClassProperties::GetReportMask() const {
+    return ErrorManagement::ErrorType(static_cast<ErrorManagement::ErrorIntegerFormat>(~disabledReports));
+}
+
 }
@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "GeneralDefinitions.h"
+#include "ErrorType.h"
 #include "FractionalInteger.h"
 
 /*---------------------------------------------------------------------------*/
@@ -109,6 +110,26 @@ public:
      */
     void Reset(const char8 * const cName, const char8 * const typeidName, const char8 * const cVersion, const uint32 cSize = 0u);
 
+    /**
+     * @brief Sets the error types which are reported by the REPORT_ERROR macros of the objects of the class.
+     * @details Applied after the global ErrorManagement::SetReportMask, i.e. a report is only formatted if its code is in both masks.
+     * @param[in] mask the error types to be reported (all by default).
+     */
+    void SetReportMask(const ErrorManagement::ErrorType &mask);
+
+    /**
+     * @brief Gets the error types which are reported by the objects of the class.
+     * @return the mask set with SetReportMask.
+     */
+    ErrorManagement::ErrorType GetReportMask() const;
+
+    /**
+     * @brief Checks if the reports with a given code are enabled for the objects of the class.
+     * @param[in] code the error code of the report.
+     * @return true if at least one of the bits of \a code is in the report mask of the class or if \a code is NoError.
+     */
+    inline bool IsReportEnabled(const ErrorManagement::ErrorType &code) const;
+
 private:
     /**
      * The name of the class.
@@ -134,6 +155,11 @@ private:
      * The class size (number of bytes)
      */
     uint32 size;
+
+    /**
+     * The error types which are not reported (the complement of the report mask, so that a zero initialised instance reports all).
+     */
+    ErrorManagement::ErrorIntegerFormat disabledReports;
 };
 
 }
@@ -142,5 +168,13 @@ private:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+inline bool ClassProperties::IsReportEnabled(const ErrorManagement::ErrorType &code) const {
+    return ((code.format_as_integer & ~disabledReports) != 0u) || (code.format_as_integer == 0u);
+}
+
+}
+
 #endif /* CLASSPROPERTIES_H_ */
 
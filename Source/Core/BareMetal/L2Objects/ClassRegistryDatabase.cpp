@@ -40,11 +40,29 @@
 #include "ClassRegistryItem.h"
 #include "ClassRegistryDatabase.h"
 #include "ErrorManagement.h"
+#include "Sleep.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+/**
+ * The states of a ClassRegistryManifestLibrary.
+ */
+static const uint8 CLASS_REGISTRY_LIBRARY_NOT_LOADED = 0u;
+static const uint8 CLASS_REGISTRY_LIBRARY_LOADING = 1u;
+static const uint8 CLASS_REGISTRY_LIBRARY_LOADED = 2u;
+static const uint8 CLASS_REGISTRY_LIBRARY_FAILED = 3u;
+
+/**
+ * Time that a Find waits before checking again if a library being opened by another thread is open.
+ */
+static const uint32 CLASS_REGISTRY_LIBRARY_POLL_MSEC = 1u;
+
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -65,6 +83,7 @@ ClassRegistryDatabase::ClassRegistryDatabase() {
 }
 
 ClassRegistryDatabase::~ClassRegistryDatabase() {
+    CleanUpLibraries();
     //automatic LinkedListHolder::CleanUp
 }
 
@@ -80,11 +99,26 @@ void ClassRegistryDatabase::Add(ClassRegistryItem * const p) {
         classDatabase.ListInsert(p, classUniqueIdentifier);
         classUniqueIdentifier = classUniqueIdentifier + 1u;
 
+        const ClassProperties *classProperties = p->GetClassProperties();
+        if (classProperties != NULL_PTR(ClassProperties *)) {
+            bool ok = true;
+            if (classProperties->GetName() != NULL) {
+                ok = classNameIndex.Insert(classNameIndex.Key(classProperties->GetName()), p);
+            }
+            if ((ok) && (classProperties->GetTypeIdName() != NULL)) {
+                ok = typeIdIndex.Insert(typeIdIndex.Key(classProperties->GetTypeIdName()), p);
+            }
+            if (!ok) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed to index the class");
+            }
+        }
+
         UnLock();
     }
 }
 
 ClassRegistryItem *ClassRegistryDatabase::Find(const char8 *className) {
+    const char8 * const requestedName = className;
     const uint32 maxSize = 129u;
     char8 dllName[maxSize];
     dllName[0] = '\0';
@@ -115,20 +149,8 @@ ClassRegistryItem *ClassRegistryDatabase::Find(const char8 *className) {
         if (!Lock()) {
             REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
         }
-        uint32 i;
-        uint32 databaseSize = classDatabase.ListSize();
-        for (i = 0u; (i < databaseSize) && (!found); i++) {
-            ClassRegistryItem *p = classDatabase.ListPeek(i);
-            if (p != NULL) {
-                const ClassProperties *classProperties = p->GetClassProperties();
-                if (classProperties != NULL_PTR(ClassProperties *)) {
-                    if (StringHelper::Compare(classProperties->GetName(), className) == 0) {
-                        registryItem = p;
-                        found = true;
-                    }
-                }
-            }
-        }
+        registryItem = FindInIndex(false, className);
+        found = (registryItem != NULL_PTR(ClassRegistryItem *));
         //Must unlock as the loader->Open below might trigger the registration of new classes which will call on the
         //Add method and thus Lock the database.
         UnLock();
@@ -136,86 +158,317 @@ ClassRegistryItem *ClassRegistryDatabase::Find(const char8 *className) {
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: NULL pointer in input");
     }
-    //registryItem still not found. Try to look inside the dll (if it exists)
-    /*lint -e{593} this pointer is freed by the registry item when it is destructed*/
-    if (!found) {
-        uint32 dllNameSize = StringHelper::Length(&(dllName[0]));
-        uint32 fullSize = dllNameSize + 5u;
-        /*lint -e{925} pointer to pointer required due to Malloc implementation*/
-        char8 *fullName = static_cast<char8 *>(HeapManager::Malloc(fullSize));
-
-        LoadableLibrary *loader = new LoadableLibrary();
-
-        uint32 i = 0u;
-        bool dllOpened = false;
-        //Check for all known operating system extensions.
-        while ((operatingSystemDLLExtensions[i] != 0) && (!dllOpened)) {
-            if (MemoryOperationsHelper::Set(fullName, '\0', fullSize)) {
-                if (StringHelper::ConcatenateN(fullName, &(dllName[0]), dllNameSize)) {
-                    const char8 *extension = operatingSystemDLLExtensions[i];
-                    char8 *fullNameWithDllName = &fullName[dllNameSize];
-                    if (StringHelper::ConcatenateN(fullNameWithDllName, extension, 4u)) {
-                        dllOpened = loader->Open(fullName);
-                    }
-                }
-            }
-            i++;
+    //registryItem still not found. Try to look inside the dll (if it exists and if it was not already tried)
+    if ((!found) && (className != NULL)) {
+        if (!Lock()) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
+        }
+        bool failed = IsFailedLookup(requestedName);
+        UnLock();
+        if (!failed) {
+            registryItem = FindInManifest(className);
+            found = (registryItem != NULL_PTR(ClassRegistryItem *));
         }
-        //If the dll was successfully opened than it is likely that more classes were registered
-        //in the database. Search again.
-        if (dllOpened) {
+        if ((!found) && (!failed)) {
+            registryItem = FindInLibrary(&(dllName[0]), className);
+            found = (registryItem != NULL_PTR(ClassRegistryItem *));
+        }
+        if ((!found) && (!failed)) {
             if (!Lock()) {
                 REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
             }
-            uint32 databaseSize = classDatabase.ListSize();
-            for (i = 0u; (i < databaseSize) && (!found); i++) {
-                ClassRegistryItem *p = classDatabase.ListPeek(i);
-                if (p != NULL) {
-                    const ClassProperties *classProperties = p->GetClassProperties();
-                    if (classProperties != NULL_PTR(ClassProperties *)) {
-                        if (StringHelper::Compare(classProperties->GetName(), className) == 0) {
-                            registryItem = p;
-                            registryItem->SetLoadableLibrary(loader);
-                            found = true;
-                        }
+            //Another thread might have added it in the meanwhile
+            if (!IsFailedLookup(requestedName)) {
+                char8 *failedName = StringHelper::StringDup(requestedName);
+                if (failedLookups.Add(failedName)) {
+                    if (!failedLookupsIndex.Insert(failedLookupsIndex.Key(failedName), failedLookups.GetSize() - 1u)) {
+                        REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "ClassRegistryDatabase: Failed to index the failed lookup");
                     }
                 }
+                else {
+                    (void) HeapManager::Free(reinterpret_cast<void *&>(failedName));
+                }
             }
             UnLock();
         }
-        //Not found...
-        if (!found) {
-            delete loader;
-        }
-        if (!HeapManager::Free(reinterpret_cast<void*&>(fullName))) {
-            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Free failed");
-        }
     }
 
     return registryItem;
 }
 
-ClassRegistryItem *ClassRegistryDatabase::FindTypeIdName(const char8 * const typeidName) {
+ClassRegistryItem *ClassRegistryDatabase::FindInManifest(const char8 * const className) {
     ClassRegistryItem *registryItem = NULL_PTR(ClassRegistryItem *);
+    bool found = false;
     if (!Lock()) {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
     }
+    uint32 key = manifestEntriesIndex.Key(className);
+    uint32 cursor = 0u;
+    uint32 position = 0u;
+    ClassRegistryManifestEntry entry;
+    while ((!found) && (manifestEntriesIndex.Search(key, cursor, position))) {
+        if (manifestEntries.Peek(position, entry)) {
+            found = (StringHelper::Compare(entry.className, className) == 0);
+        }
+    }
+    UnLock();
+    if (found) {
+        found = PreloadManifestLibrary(entry.library);
+    }
+    if (found) {
+        if (!Lock()) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
+        }
+        registryItem = FindInIndex(false, className);
+        ClassRegistryManifestLibrary library;
+        if ((registryItem != NULL_PTR(ClassRegistryItem *)) && (manifestLibraries.Peek(entry.library, library))) {
+            //The first class found in the library owns it
+            if (library.loader != NULL_PTR(LoadableLibrary *)) {
+                registryItem->SetLoadableLibrary(library.loader);
+                library.loader = NULL_PTR(LoadableLibrary *);
+                (void) manifestLibraries.Set(entry.library, library);
+            }
+        }
+        UnLock();
+        if (registryItem == NULL_PTR(ClassRegistryItem *)) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "ClassRegistryDatabase: The library manifest is out of date. Class not found in the library");
+        }
+    }
+    return registryItem;
+}
+
+ClassRegistryItem *ClassRegistryDatabase::FindInLibrary(const char8 * const dllName,
+                                                        const char8 * const className) {
+    ClassRegistryItem *registryItem = NULL_PTR(ClassRegistryItem *);
     bool found = false;
-    if (typeidName != NULL) {
-        uint32 i;
-        uint32 databaseSize = classDatabase.ListSize();
-        for (i = 0u; (i < databaseSize) && (!found); i++) {
-            ClassRegistryItem *p = classDatabase.ListPeek(i);
-            if (p != NULL) {
-                const ClassProperties *classProperties = p->GetClassProperties();
-                if (classProperties != NULL_PTR(ClassProperties *)) {
-                    if (StringHelper::Compare(classProperties->GetTypeIdName(), typeidName) == 0) {
-                        registryItem = p;
-                        found = true;
-                    }
+    uint32 dllNameSize = StringHelper::Length(dllName);
+    uint32 fullSize = dllNameSize + 5u;
+    /*lint -e{925} pointer to pointer required due to Malloc implementation*/
+    char8 *fullName = static_cast<char8 *>(HeapManager::Malloc(fullSize));
+
+    /*lint -e{593} this pointer is freed by the registry item when it is destructed*/
+    LoadableLibrary *loader = new LoadableLibrary();
+
+    uint32 i = 0u;
+    bool dllOpened = false;
+    //Check for all known operating system extensions.
+    while ((operatingSystemDLLExtensions[i] != 0) && (!dllOpened)) {
+        if (MemoryOperationsHelper::Set(fullName, '\0', fullSize)) {
+            if (StringHelper::ConcatenateN(fullName, dllName, dllNameSize)) {
+                const char8 *extension = operatingSystemDLLExtensions[i];
+                char8 *fullNameWithDllName = &fullName[dllNameSize];
+                if (StringHelper::ConcatenateN(fullNameWithDllName, extension, 4u)) {
+                    dllOpened = loader->Open(fullName);
                 }
             }
         }
+        i++;
+    }
+    //If the dll was successfully opened than it is likely that more classes were registered
+    //in the database. Search again.
+    if (dllOpened) {
+        if (!Lock()) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
+        }
+        registryItem = FindInIndex(false, className);
+        found = (registryItem != NULL_PTR(ClassRegistryItem *));
+        if (found) {
+            registryItem->SetLoadableLibrary(loader);
+        }
+        UnLock();
+    }
+    //Not found...
+    if (!found) {
+        delete loader;
+    }
+    if (!HeapManager::Free(reinterpret_cast<void*&>(fullName))) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Free failed");
+    }
+
+    return registryItem;
+}
+
+bool ClassRegistryDatabase::IsFailedLookup(const char8 * const name) {
+    bool failed = false;
+    uint32 key = failedLookupsIndex.Key(name);
+    uint32 cursor = 0u;
+    uint32 position = 0u;
+    while ((!failed) && (failedLookupsIndex.Search(key, cursor, position))) {
+        char8 *failedName = NULL_PTR(char8 *);
+        if (failedLookups.Peek(position, failedName)) {
+            failed = (StringHelper::Compare(failedName, name) == 0);
+        }
+    }
+    return failed;
+}
+
+bool ClassRegistryDatabase::AddLibraryManifestEntry(const char8 * const className,
+                                                    const char8 * const libraryPath) {
+    bool ok = ((className != NULL) && (libraryPath != NULL));
+    if (!Lock()) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
+    }
+    uint32 key = 0u;
+    uint32 cursor = 0u;
+    uint32 position = 0u;
+    if (ok) {
+        key = manifestEntriesIndex.Key(className);
+        ClassRegistryManifestEntry entry;
+        while ((ok) && (manifestEntriesIndex.Search(key, cursor, position))) {
+            if (manifestEntries.Peek(position, entry)) {
+                ok = (StringHelper::Compare(entry.className, className) != 0);
+            }
+        }
+    }
+    bool libraryFound = false;
+    uint32 libraryIdx = 0u;
+    uint32 libraryKey = 0u;
+    if (ok) {
+        libraryKey = manifestLibrariesIndex.Key(libraryPath);
+        cursor = 0u;
+        ClassRegistryManifestLibrary library;
+        while ((!libraryFound) && (manifestLibrariesIndex.Search(libraryKey, cursor, position))) {
+            if (manifestLibraries.Peek(position, library)) {
+                libraryFound = (StringHelper::Compare(library.path, libraryPath) == 0);
+                libraryIdx = position;
+            }
+        }
+    }
+    if ((ok) && (!libraryFound)) {
+        ClassRegistryManifestLibrary library;
+        library.path = StringHelper::StringDup(libraryPath);
+        library.loader = NULL_PTR(LoadableLibrary *);
+        library.state = CLASS_REGISTRY_LIBRARY_NOT_LOADED;
+        ok = manifestLibraries.Add(library);
+        if (ok) {
+            libraryIdx = manifestLibraries.GetSize() - 1u;
+            ok = manifestLibrariesIndex.Insert(libraryKey, libraryIdx);
+        }
+    }
+    if (ok) {
+        ClassRegistryManifestEntry entry;
+        entry.className = StringHelper::StringDup(className);
+        entry.library = libraryIdx;
+        ok = manifestEntries.Add(entry);
+        if (ok) {
+            ok = manifestEntriesIndex.Insert(key, manifestEntries.GetSize() - 1u);
+        }
+    }
+    UnLock();
+    return ok;
+}
+
+uint32 ClassRegistryDatabase::GetNumberOfManifestLibraries() {
+    uint32 size = 0u;
+    if (Lock()) {
+        size = manifestLibraries.GetSize();
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
+    }
+    UnLock();
+    return size;
+}
+
+bool ClassRegistryDatabase::PreloadManifestLibrary(const uint32 idx) {
+    bool opened = false;
+    bool done = false;
+    while (!done) {
+        bool load = false;
+        ClassRegistryManifestLibrary library;
+        if (!Lock()) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
+        }
+        done = !manifestLibraries.Peek(idx, library);
+        if (!done) {
+            if (library.state == CLASS_REGISTRY_LIBRARY_NOT_LOADED) {
+                library.state = CLASS_REGISTRY_LIBRARY_LOADING;
+                load = manifestLibraries.Set(idx, library);
+            }
+            else if (library.state != CLASS_REGISTRY_LIBRARY_LOADING) {
+                opened = (library.state == CLASS_REGISTRY_LIBRARY_LOADED);
+                done = true;
+            }
+            else {
+                //Being opened by another thread
+            }
+        }
+        //Must unlock as the loader->Open below triggers the registration of new classes
+        UnLock();
+        if (load) {
+            LoadableLibrary *loader = new LoadableLibrary();
+            opened = loader->Open(library.path);
+            if (!opened) {
+                delete loader;
+                loader = NULL_PTR(LoadableLibrary *);
+            }
+            if (!Lock()) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
+            }
+            library.loader = loader;
+            library.state = opened ? (CLASS_REGISTRY_LIBRARY_LOADED) : (CLASS_REGISTRY_LIBRARY_FAILED);
+            (void) manifestLibraries.Set(idx, library);
+            UnLock();
+            done = true;
+        }
+        else if (!done) {
+            Sleep::MSec(CLASS_REGISTRY_LIBRARY_POLL_MSEC);
+        }
+        else {
+            //Already opened (or failed)
+        }
+    }
+    return opened;
+}
+
+void ClassRegistryDatabase::ClearFailedLookups() {
+    if (!Lock()) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
+    }
+    uint32 i;
+    for (i = 0u; i < failedLookups.GetSize(); i++) {
+        char8 *failedName = NULL_PTR(char8 *);
+        if (failedLookups.Peek(i, failedName)) {
+            (void) HeapManager::Free(reinterpret_cast<void *&>(failedName));
+        }
+    }
+    failedLookups.Clean();
+    failedLookupsIndex.Reset();
+    UnLock();
+}
+
+void ClassRegistryDatabase::CleanUpLibraries() {
+    ClearFailedLookups();
+    uint32 i;
+    for (i = 0u; i < manifestEntries.GetSize(); i++) {
+        ClassRegistryManifestEntry entry;
+        if (manifestEntries.Peek(i, entry)) {
+            (void) HeapManager::Free(reinterpret_cast<void *&>(entry.className));
+        }
+    }
+    //The libraries which were not handed over to a ClassRegistryItem stay loaded (LoadableLibrary does not close on destruction)
+    for (i = 0u; i < manifestLibraries.GetSize(); i++) {
+        ClassRegistryManifestLibrary library;
+        if (manifestLibraries.Peek(i, library)) {
+            (void) HeapManager::Free(reinterpret_cast<void *&>(library.path));
+            if (library.loader != NULL_PTR(LoadableLibrary *)) {
+                delete library.loader;
+            }
+        }
+    }
+    manifestEntries.Clean();
+    manifestEntriesIndex.Reset();
+    manifestLibraries.Clean();
+    manifestLibrariesIndex.Reset();
+}
+
+ClassRegistryItem *ClassRegistryDatabase::FindTypeIdName(const char8 * const typeidName) {
+    ClassRegistryItem *registryItem = NULL_PTR(ClassRegistryItem *);
+    if (!Lock()) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
+    }
+    if (typeidName != NULL) {
+        registryItem = FindInIndex(true, typeidName);
     }
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: NULL pointer in input");
@@ -225,6 +478,31 @@ ClassRegistryItem *ClassRegistryDatabase::FindTypeIdName(const char8 * const typ
     return registryItem;
 }
 
+ClassRegistryItem *ClassRegistryDatabase::FindInIndex(const bool typeIdName,
+                                                      const char8 * const name) {
+    ClassRegistryItem *registryItem = NULL_PTR(ClassRegistryItem *);
+    ClassUID registryItemUID = 0u;
+    ItemIndex &index = typeIdName ? typeIdIndex : classNameIndex;
+    uint32 key = index.Key(name);
+    uint32 cursor = 0u;
+    ClassRegistryItem *p = NULL_PTR(ClassRegistryItem *);
+    while (index.Search(key, cursor, p)) {
+        const ClassProperties *classProperties = p->GetClassProperties();
+        if (classProperties != NULL_PTR(ClassProperties *)) {
+            const char8 * const itemName = typeIdName ? classProperties->GetTypeIdName() : classProperties->GetName();
+            if (StringHelper::Compare(itemName, name) == 0) {
+                //Keep the first registered
+                ClassUID uid = classProperties->GetUniqueIdentifier();
+                if ((registryItem == NULL_PTR(ClassRegistryItem *)) || (uid < registryItemUID)) {
+                    registryItem = p;
+                    registryItemUID = uid;
+                }
+            }
+        }
+    }
+    return registryItem;
+}
+
 uint32 ClassRegistryDatabase::GetSize() {
     uint32 size = 0u;
     if (Lock()) {
@@ -254,6 +532,9 @@ const char8 * const ClassRegistryDatabase::GetClassName() const {
 }
 
 void ClassRegistryDatabase::CleanUp() {
+    CleanUpLibraries();
+    classNameIndex.Reset();
+    typeIdIndex.Reset();
     classDatabase.CleanUp();
 }
 
@@ -35,8 +35,11 @@
 #include "GlobalObjectsDatabase.h"
 #include "FastPollingMutexSem.h"
 #include "ClassRegistryItem.h"
+#include "HashIndex.h"
+#include "LoadableLibrary.h"
 #include "StaticList.h"
 #include "FractionalInteger.h"
+#include "WyHashFunction.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -44,6 +47,41 @@
 
 namespace MARTe {
 
+/**
+ * @brief A shared library listed in the library manifest of the ClassRegistryDatabase.
+ */
+struct ClassRegistryManifestLibrary {
+    /**
+     * The path of the shared library.
+     */
+    char8 *path;
+
+    /**
+     * The library once opened (NULL after being handed over to the ClassRegistryItem of a class found in it).
+     */
+    LoadableLibrary *loader;
+
+    /**
+     * One of the manifest library states (not loaded, loading, loaded or failed).
+     */
+    uint8 state;
+};
+
+/**
+ * @brief An entry of the library manifest of the ClassRegistryDatabase.
+ */
+struct ClassRegistryManifestEntry {
+    /**
+     * The name of the class.
+     */
+    char8 *className;
+
+    /**
+     * The index of the library (see ClassRegistryManifestLibrary) where the class is registered.
+     */
+    uint32 library;
+};
+
 /**
  * @brief Database of framework base classes.
  * @details Most of the framework user classes inherit from Object. As a
@@ -53,6 +91,16 @@ namespace MARTe {
  * Every class that inherits from Object will be described by a
  * ClassRegistryItem and automatically added to a ClassRegistryDatabase. This
  * database can then be used to retrieve information about the registered classes.
+ *
+ * The classes are kept in registration order (see Peek) and are also indexed by
+ * class name and by typeid name in hash tables, so that Find and FindTypeIdName are O(1).
+ *
+ * When a class is not registered, Find tries to load it from a shared library. An optional library manifest (see
+ * AddLibraryManifestEntry) maps the class names to the path of the library where they are registered, so that the library is
+ * opened directly instead of being searched with all the operatingSystemDLLExtensions along the loader path. The libraries of the
+ * manifest can also be loaded before they are needed (see PreloadManifestLibrary). The names which could not be found (neither
+ * registered nor in a library) are remembered, so that a repeated Find of a missing class does not probe the libraries again
+ * (see ClearFailedLookups).
  */
 class DLL_API ClassRegistryDatabase: public GlobalObjectI {
 
@@ -108,6 +156,37 @@ public:
      */
     const ClassRegistryItem *Peek(const uint32 &idx);
 
+    /**
+     * @brief Adds an entry to the library manifest.
+     * @details The next Find of \a className, if not already registered, opens \a libraryPath before (and instead of, if the class is
+     * registered by the library) probing the operatingSystemDLLExtensions.
+     * @param[in] className the name of the class.
+     * @param[in] libraryPath the path of the shared library where \a className is registered.
+     * @return false if \a className is already in the manifest or if any of the parameters is NULL.
+     */
+    bool AddLibraryManifestEntry(const char8 * const className,
+                                 const char8 * const libraryPath);
+
+    /**
+     * @brief Returns the number of distinct libraries in the library manifest.
+     * @return the number of distinct libraries in the library manifest.
+     */
+    uint32 GetNumberOfManifestLibraries();
+
+    /**
+     * @brief Opens the library at position \a idx of the library manifest (if not already opened).
+     * @details Can be called concurrently (e.g. to preload all the libraries at start-up with several threads). If the library is being
+     * opened by another thread, waits for it to be opened.
+     * @param[in] idx the index of the library (< GetNumberOfManifestLibraries()).
+     * @return true if the library is open.
+     */
+    bool PreloadManifestLibrary(const uint32 idx);
+
+    /**
+     * @brief Forgets the names which could not be found, so that the next Find probes the libraries again.
+     */
+    void ClearFailedLookups();
+
     /**
      * @brief Returns "ClassRegistryDatabase"
      * @return "ClassRegistryDatabase".
@@ -145,6 +224,94 @@ private:
      */
     LinkedListHolderT<ClassRegistryItem> classDatabase;
 
+    /**
+     * Hash table from the class (or typeid) names to the registered items.
+     */
+    typedef HashIndex<ClassRegistryItem *, WyHashFunction> ItemIndex;
+
+    /**
+     * @brief Searches an item in one of the indexes.
+     * @details If more than one class has this name, the first registered is returned (as with a linear search).
+     * @param[in] typeIdName if true \a name is searched in typeIdIndex, otherwise in classNameIndex.
+     * @param[in] name the class (or typeid) name.
+     * @return the item or NULL if not found.
+     * @pre Lock() was called.
+     */
+    ClassRegistryItem *FindInIndex(const bool typeIdName, const char8 * const name);
+
+    /**
+     * @brief Tries to load \a className from the library listed in the library manifest.
+     * @param[in] className the class name.
+     * @return the item or NULL if \a className is not in the manifest or could not be loaded from the library.
+     */
+    ClassRegistryItem *FindInManifest(const char8 * const className);
+
+    /**
+     * @brief Tries to load \a className from the library \a dllName using all the operatingSystemDLLExtensions.
+     * @param[in] dllName the library name without extension.
+     * @param[in] className the class name.
+     * @return the item or NULL if no library could be opened or the class is not registered by the library.
+     */
+    ClassRegistryItem *FindInLibrary(const char8 * const dllName, const char8 * const className);
+
+    /**
+     * @brief Searches a name in the failedLookups.
+     * @param[in] name the name as passed to Find.
+     * @return true if \a name is in the failedLookups.
+     * @pre Lock() was called.
+     */
+    bool IsFailedLookup(const char8 * const name);
+
+    /**
+     * @brief Frees the library manifest and the failedLookups.
+     */
+    void CleanUpLibraries();
+
+    /**
+     * Index of classDatabase by ClassProperties::GetName().
+     */
+    ItemIndex classNameIndex;
+
+    /**
+     * Index of classDatabase by ClassProperties::GetTypeIdName().
+     */
+    ItemIndex typeIdIndex;
+
+    /**
+     * Hash table from names to the position of the name in one of the lists below.
+     */
+    typedef HashIndex<uint32, WyHashFunction> PositionIndex;
+
+    /**
+     * The distinct libraries of the library manifest.
+     */
+    StaticList<ClassRegistryManifestLibrary> manifestLibraries;
+
+    /**
+     * Index of manifestLibraries by path.
+     */
+    PositionIndex manifestLibrariesIndex;
+
+    /**
+     * The entries of the library manifest.
+     */
+    StaticList<ClassRegistryManifestEntry> manifestEntries;
+
+    /**
+     * Index of manifestEntries by class name.
+     */
+    PositionIndex manifestEntriesIndex;
+
+    /**
+     * The names that Find could not find.
+     */
+    StaticList<char8 *> failedLookups;
+
+    /**
+     * Index of failedLookups by name.
+     */
+    PositionIndex failedLookupsIndex;
+
     /**
      * Protects the concurrent access to the database
      */
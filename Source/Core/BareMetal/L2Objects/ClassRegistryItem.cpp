@@ -35,6 +35,7 @@
 #include "ClassRegistryDatabase.h"
 #include "ClassRegistryItem.h"
 #include "ErrorManagement.h"
+#include "GlobalObjectsDatabase.h"
 #include "Introspection.h"
 #include "LoadableLibrary.h"
 #include "ObjectBuilder.h"
@@ -54,11 +55,13 @@ namespace MARTe {
 ClassRegistryItem::ClassRegistryItem(ClassProperties &classProperties_in) :
         LinkedListable(),
         classProperties(classProperties_in),
-        classMethods() {
+        classMethods(),
+        classMethodsIndex() {
     numberOfInstances = 0;
     loadableLibrary = NULL_PTR(LoadableLibrary *);
     objectBuilder = NULL_PTR(ObjectBuilder *);
     introspection = NULL_PTR(Introspection *);
+    pool = NULL_PTR(FixedSizePool *);
 }
 
 ClassRegistryItem *ClassRegistryItem::Instance(ClassRegistryItem *&instance,
@@ -92,6 +95,13 @@ ClassRegistryItem::~ClassRegistryItem() {
     loadableLibrary = NULL_PTR(LoadableLibrary *);
     introspection = NULL_PTR(Introspection *);
     objectBuilder = NULL_PTR(ObjectBuilder *);
+    //The pool memory cannot be released while there are live objects allocated from it.
+    if (pool != NULL_PTR(FixedSizePool *)) {
+        if (GetNumberOfInstances() == 0u) {
+            delete pool;
+        }
+    }
+    pool = NULL_PTR(FixedSizePool *);
 }
 
 void ClassRegistryItem::GetClassPropertiesCopy(ClassProperties &destination) const {
@@ -102,6 +112,10 @@ const ClassProperties *ClassRegistryItem::GetClassProperties() const {
     return &classProperties;
 }
 
+void ClassRegistryItem::SetReportMask(const ErrorManagement::ErrorType &mask) {
+    classProperties.SetReportMask(mask);
+}
+
 void ClassRegistryItem::SetIntrospection(const Introspection * const introspectionIn) {
     introspection = introspectionIn;
 }
@@ -134,20 +148,29 @@ void ClassRegistryItem::SetUniqueIdentifier(const ClassUID &uid) {
     classProperties.SetUniqueIdentifier(uid);
 }
 
-ClassMethodCaller *ClassRegistryItem::FindMethod(CCString methodName) {
+ClassMethodInterfaceMapper *ClassRegistryItem::FindMethodMapper(const uint32 key,
+                                                                 CCString methodName) const {
+    ClassMethodInterfaceMapper *mapper = NULL_PTR(ClassMethodInterfaceMapper *);
+    ClassMethodInterfaceMapper *cmim = NULL_PTR(ClassMethodInterfaceMapper *);
+    uint32 cursor = 0u;
+    //Different names may have the same key
+    while ((mapper == NULL_PTR(ClassMethodInterfaceMapper *)) && (classMethodsIndex.Search(key, cursor, cmim))) {
+        if (cmim != NULL_PTR(ClassMethodInterfaceMapper *)) {
+            if (StringHelper::Compare(cmim->GetMethodName(), methodName) == 0) {
+                mapper = cmim;
+            }
+        }
+    }
+    return mapper;
+}
 
-    uint32 i = 0u;
-    uint32 end = classMethods.ListSize();
+ClassMethodCaller *ClassRegistryItem::FindMethod(CCString methodName) {
     ClassMethodCaller *caller = NULL_PTR(ClassMethodCaller *);
-    while ((i < end) && (caller == NULL_PTR(ClassMethodCaller *))) {
-        ClassMethodInterfaceMapper *cmim = classMethods.ListPeek(i);
-        if (cmim != NULL) {
-            CCString mapperMethodName = cmim->GetMethodName();
-            if (StringHelper::Compare(mapperMethodName, methodName) == 0) {
-                caller = cmim->GetMethodCaller();
-            }
+    if (methodName.GetList() != NULL_PTR(const char8 *)) {
+        ClassMethodInterfaceMapper *cmim = FindMethodMapper(classMethodsIndex.Key(methodName.GetList()), methodName);
+        if (cmim != NULL_PTR(ClassMethodInterfaceMapper *)) {
+            caller = cmim->GetMethodCaller();
         }
-        i++;
     }
     return caller;
 }
@@ -155,7 +178,65 @@ ClassMethodCaller *ClassRegistryItem::FindMethod(CCString methodName) {
 void ClassRegistryItem::AddMethod(ClassMethodInterfaceMapper * const method) {
     if (method != NULL) {
         classMethods.ListAdd(method);
+        CCString methodName = method->GetMethodName();
+        if (methodName.GetList() != NULL_PTR(const char8 *)) {
+            uint32 key = classMethodsIndex.Key(methodName.GetList());
+            //Only the latest registered method with a given name is indexed
+            ClassMethodInterfaceMapper *previous = FindMethodMapper(key, methodName);
+            if (previous != NULL_PTR(ClassMethodInterfaceMapper *)) {
+                (void) classMethodsIndex.Remove(key, previous);
+            }
+            if (!classMethodsIndex.Insert(key, method)) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryItem: Failed to index the method");
+            }
+        }
+    }
+}
+
+bool ClassRegistryItem::CreatePool(const uint32 numberOfBlocks) {
+    bool ok = (pool == NULL_PTR(FixedSizePool *));
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::InitialisationError, "ClassRegistryItem: The pool was already created");
+    }
+    if (ok) {
+        FixedSizePool *newPool = new FixedSizePool();
+        ok = newPool->Initialise(classProperties.GetSize(), numberOfBlocks, true);
+        if (ok) {
+            pool = newPool;
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::InitialisationError, "ClassRegistryItem: Failed to create the pool");
+            delete newPool;
+        }
     }
+    return ok;
+}
+
+void *ClassRegistryItem::AllocateFromPool(const uint32 size,
+                                          const HeapI * const heap) {
+    void *address = NULL_PTR(void *);
+    if (pool != NULL_PTR(FixedSizePool *)) {
+        bool standardHeap = (heap == NULL_PTR(const HeapI *));
+        if (!standardHeap) {
+            standardHeap = (heap == GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        }
+        if ((standardHeap) && (size <= pool->GetBlockSize())) {
+            address = pool->Allocate();
+        }
+    }
+    return address;
+}
+
+bool ClassRegistryItem::FreeToPool(void * const address) {
+    bool ok = (pool != NULL_PTR(FixedSizePool *));
+    if (ok) {
+        ok = pool->Free(address);
+    }
+    return ok;
+}
+
+const FixedSizePool *ClassRegistryItem::GetPool() const {
+    return pool;
 }
 
 }
@@ -34,12 +34,16 @@
 
 #include "ClassProperties.h"
 #include "CString.h"
+#include "FixedSizePool.h"
 #include "FractionalInteger.h"    //using ClassUID typedef
+#include "HashIndex.h"
+#include "HeapI.h"
 #include "Introspection.h"
 #include "LinkedListable.h"
 #include "LinkedListHolderT.h"
 #include "LoadableLibrary.h"
 #include "ObjectBuilder.h"
+#include "WyHashFunction.h"
 
 
 /*---------------------------------------------------------------------------*/
@@ -102,6 +106,12 @@ public:
      */
     const ClassProperties *GetClassProperties() const;
 
+    /**
+     * @brief Sets the error types which are reported by the objects of the class (see ClassProperties::SetReportMask).
+     * @param[in] mask the error types to be reported.
+     */
+    void SetReportMask(const ErrorManagement::ErrorType &mask);
+
     /**
      * @brief Adds the introspection data.
      * @param[in] introspectionIn is the pointer to the object containing the informations
@@ -151,6 +161,7 @@ public:
 
     /**
      * @brief Gets the ClassMethodCaller associated to the method with name = methodName.
+     * @details The methods are indexed by name in a hash table, so that the search is O(1).
      * @param[in] methodName the name of the method.
      * @return the ClassMethodCaller associated to the method with name = methodName.
      */
@@ -158,10 +169,49 @@ public:
 
     /**
      * @brief Registers a method that can be later retrieved with FindMethod.
+     * @details If a method with the same name was already registered, FindMethod will return the new one.
      * @param[in] method the method to register. The pointer will be freed by this class.
+     * @pre
+     *   method->GetMethodName() is already set.
      */
     void AddMethod(ClassMethodInterfaceMapper * const method);
 
+    /**
+     * @brief Creates a pool of fixed size blocks from where the instances of this class type will be allocated.
+     * @details After this call all the objects of this class type that are created in the standard heap (see
+     * CLASS_REGISTER operator new) are taken from the pool, which grows on demand. Each block has
+     * GetClassProperties()->GetSize() bytes. Objects allocated before the pool was created are still
+     * correctly freed.
+     * @param[in] numberOfBlocks the number of blocks in the first slab of the pool.
+     * @return true if the pool did not exist yet and could be created.
+     * @pre
+     *   No objects of this class type are being concurrently created (i.e. should be called while loading the application).
+     */
+    bool CreatePool(const uint32 numberOfBlocks);
+
+    /**
+     * @brief Allocates the memory for a new instance from the pool (see CreatePool).
+     * @param[in] size the number of bytes requested by operator new.
+     * @param[in] heap the heap requested by operator new.
+     * @return a block of the pool or NULL if no pool was created, if \a heap is neither NULL nor the standard heap,
+     * if \a size is greater than the pool block size (e.g. for a non registered derived class) or if the pool is exhausted.
+     */
+    void *AllocateFromPool(const uint32 size,
+                           const HeapI * const heap);
+
+    /**
+     * @brief Returns to the pool the memory of an instance allocated with AllocateFromPool.
+     * @param[in] address the memory to free.
+     * @return true if \a address belongs to the pool of this class type.
+     */
+    bool FreeToPool(void * const address);
+
+    /**
+     * @brief Gets the pool where the instances of this class type are allocated.
+     * @return the pool or NULL if CreatePool was not called.
+     */
+    const FixedSizePool *GetPool() const;
+
 protected:
 
     /**
@@ -180,6 +230,15 @@ protected:
 
 private:
 
+    /**
+     * @brief Searches a method in classMethodsIndex.
+     * @param[in] key the key of \a methodName in classMethodsIndex.
+     * @param[in] methodName the name of the method.
+     * @return the method or NULL if not found.
+     */
+    ClassMethodInterfaceMapper *FindMethodMapper(const uint32 key,
+                                                 CCString methodName) const;
+
     /**
      * The properties of the class represented by this registry item.
      */
@@ -211,6 +270,16 @@ private:
      */
     LinkedListHolderT<ClassMethodInterfaceMapper, true> classMethods;
 
+    /**
+     * Index of classMethods by ClassMethodInterfaceMapper::GetMethodName().
+     */
+    HashIndex<ClassMethodInterfaceMapper *, WyHashFunction> classMethodsIndex;
+
+    /**
+     * The optional pool where the instances of this class type are allocated.
+     */
+    FixedSizePool *pool;
+
 };
 
 
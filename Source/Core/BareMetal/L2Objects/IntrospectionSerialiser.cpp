@@ -0,0 +1,231 @@
+/**
+ * @file IntrospectionSerialiser.cpp
+ * @brief Source file for class IntrospectionSerialiser
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class IntrospectionSerialiser (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ClassRegistryDatabase.h"
+#include "ErrorManagement.h"
+#include "IntrospectionSerialiser.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+IntrospectionSerialiser::IntrospectionSerialiser() {
+    runs = NULL_PTR(IntrospectionCopyRun *);
+    numberOfRuns = 0u;
+    runsCapacity = 0u;
+    serialisedSize = 0u;
+    structureSize = 0u;
+}
+
+IntrospectionSerialiser::~IntrospectionSerialiser() {
+    Reset();
+}
+
+void IntrospectionSerialiser::Reset() {
+    if (runs != NULL_PTR(IntrospectionCopyRun *)) {
+        delete[] runs;
+    }
+    runs = NULL_PTR(IntrospectionCopyRun *);
+    numberOfRuns = 0u;
+    runsCapacity = 0u;
+    serialisedSize = 0u;
+    structureSize = 0u;
+}
+
+bool IntrospectionSerialiser::Initialise(const char8 * const className) {
+    Reset();
+    const ClassRegistryItem *item = ClassRegistryDatabase::Instance()->Find(className);
+    bool ok = (item != NULL_PTR(const ClassRegistryItem *));
+    const Introspection *introspection = NULL_PTR(const Introspection *);
+    if (ok) {
+        /*lint -e{613} item checked above*/
+        introspection = item->GetIntrospection();
+        ok = (introspection != NULL_PTR(const Introspection *));
+    }
+    if (ok) {
+        /*lint -e{613} introspection checked above*/
+        ok = AddMembers(*introspection, 0u);
+    }
+    if (ok) {
+        /*lint -e{613} introspection checked above*/
+        structureSize = introspection->GetClassSize();
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::InitialisationError, "IntrospectionSerialiser: Could not build the copy plan");
+        Reset();
+    }
+    return ok;
+}
+
+bool IntrospectionSerialiser::AddMembers(const Introspection &introspection,
+                                         const uint32 structureOffset) {
+    bool ok = true;
+    uint32 numberOfMembers = introspection.GetNumberOfMembers();
+    uint32 i;
+    for (i = 0u; (i < numberOfMembers) && (ok); i++) {
+        IntrospectionEntry entry = introspection[i];
+        uint32 memberOffset = structureOffset + entry.GetMemberByteOffset();
+        uint32 memberSize = entry.GetMemberSize();
+        ok = (entry.GetMemberPointerLevel() == 0u);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "IntrospectionSerialiser: Pointer members cannot be serialised");
+        }
+        TypeDescriptor td = InvalidType;
+        if (ok) {
+            td = entry.GetMemberTypeDescriptor();
+            ok = (!(td == InvalidType));
+        }
+        if (ok) {
+            if (td.isStructuredData) {
+                const ClassRegistryItem *item = ClassRegistryDatabase::Instance()->Peek(td.structuredDataIdCode);
+                const Introspection *nested = NULL_PTR(const Introspection *);
+                if (item != NULL_PTR(const ClassRegistryItem *)) {
+                    nested = item->GetIntrospection();
+                }
+                ok = (nested != NULL_PTR(const Introspection *));
+                if (ok) {
+                    //Each element of an array of structures is planned on its own, as it may have padding
+                    uint32 numberOfElements = 1u;
+                    uint32 d;
+                    for (d = 0u; d < entry.GetNumberOfDimensions(); d++) {
+                        numberOfElements *= entry.GetNumberOfElements(d);
+                    }
+                    uint32 elementSize = (numberOfElements > 0u) ? (memberSize / numberOfElements) : (0u);
+                    uint32 e;
+                    for (e = 0u; (e < numberOfElements) && (ok); e++) {
+                        /*lint -e{613} nested checked above*/
+                        ok = AddMembers(*nested, memberOffset + (e * elementSize));
+                    }
+                }
+                else {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "IntrospectionSerialiser: Nested structure without introspection");
+                }
+            }
+            else {
+                ok = ((td.type == SignedInteger) || (td.type == UnsignedInteger) || (td.type == Float) || (td.type == CArray));
+                if (ok) {
+                    AddRun(memberOffset, memberSize);
+                }
+                else {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "IntrospectionSerialiser: Only integer, float and character array members can be serialised");
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+void IntrospectionSerialiser::AddRun(const uint32 structureOffset,
+                                     const uint32 size) {
+    bool merged = false;
+    if (numberOfRuns > 0u) {
+        IntrospectionCopyRun &last = runs[numberOfRuns - 1u];
+        merged = ((last.structureOffset + last.size) == structureOffset);
+        if (merged) {
+            last.size += size;
+        }
+    }
+    if (!merged) {
+        if (numberOfRuns == runsCapacity) {
+            uint32 newCapacity = (runsCapacity > 0u) ? (2u * runsCapacity) : (8u);
+            IntrospectionCopyRun *newRuns = new IntrospectionCopyRun[newCapacity];
+            uint32 r;
+            for (r = 0u; r < numberOfRuns; r++) {
+                newRuns[r] = runs[r];
+            }
+            if (runs != NULL_PTR(IntrospectionCopyRun *)) {
+                delete[] runs;
+            }
+            runs = newRuns;
+            runsCapacity = newCapacity;
+        }
+        runs[numberOfRuns].structureOffset = structureOffset;
+        runs[numberOfRuns].bufferOffset = serialisedSize;
+        runs[numberOfRuns].size = size;
+        numberOfRuns++;
+    }
+    serialisedSize += size;
+}
+
+uint32 IntrospectionSerialiser::GetSerialisedSize() const {
+    return serialisedSize;
+}
+
+uint32 IntrospectionSerialiser::GetStructureSize() const {
+    return structureSize;
+}
+
+uint32 IntrospectionSerialiser::GetNumberOfRuns() const {
+    return numberOfRuns;
+}
+
+const IntrospectionCopyRun *IntrospectionSerialiser::GetRun(const uint32 runIdx) const {
+    const IntrospectionCopyRun *run = NULL_PTR(const IntrospectionCopyRun *);
+    if (runIdx < numberOfRuns) {
+        run = &runs[runIdx];
+    }
+    return run;
+}
+
+bool IntrospectionSerialiser::Serialise(const void * const structure,
+                                        void * const buffer,
+                                        const uint32 bufferSize) const {
+    bool ok = ((numberOfRuns > 0u) && (bufferSize >= serialisedSize));
+    const char8 *source = static_cast<const char8 *>(structure);
+    char8 *destination = static_cast<char8 *>(buffer);
+    uint32 r;
+    for (r = 0u; (r < numberOfRuns) && (ok); r++) {
+        ok = MemoryOperationsHelper::Copy(&destination[runs[r].bufferOffset], &source[runs[r].structureOffset], runs[r].size);
+    }
+    return ok;
+}
+
+bool IntrospectionSerialiser::Deserialise(const void * const buffer,
+                                          const uint32 bufferSize,
+                                          void * const structure) const {
+    bool ok = ((numberOfRuns > 0u) && (bufferSize >= serialisedSize));
+    const char8 *source = static_cast<const char8 *>(buffer);
+    char8 *destination = static_cast<char8 *>(structure);
+    uint32 r;
+    for (r = 0u; (r < numberOfRuns) && (ok); r++) {
+        ok = MemoryOperationsHelper::Copy(&destination[runs[r].structureOffset], &source[runs[r].bufferOffset], runs[r].size);
+    }
+    return ok;
+}
+
+}
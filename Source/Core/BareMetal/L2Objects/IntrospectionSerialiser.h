@@ -0,0 +1,216 @@
+/**
+ * @file IntrospectionSerialiser.h
+ * @brief Header file for class IntrospectionSerialiser
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class IntrospectionSerialiser
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef INTROSPECTIONSERIALISER_H_
+#define INTROSPECTIONSERIALISER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "Introspection.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A contiguous range of bytes copied with a single memory copy (see IntrospectionSerialiser).
+ */
+struct IntrospectionCopyRun {
+    /**
+     * Offset of the range in the structure.
+     */
+    uint32 structureOffset;
+
+    /**
+     * Offset of the range in the serialised buffer.
+     */
+    uint32 bufferOffset;
+
+    /**
+     * Number of bytes of the range.
+     */
+    uint32 size;
+};
+
+/**
+ * @brief Copies a registered structure (see DECLARE_STRUCT_INTROSPECTION and DECLARE_CLASS_INTROSPECTION)
+ * to and from a flat binary buffer.
+ * @details Initialise walks the Introspection of the class once (recursing into the nested structures and
+ * into each element of the arrays of nested structures) and builds a copy plan: a list of IntrospectionCopyRun
+ * where the members which are contiguous in the structure are merged in a single run. Serialise and Deserialise
+ * then only perform one memory copy per run, without any type conversion.
+ *
+ * The members are packed in the buffer in the order of the Introspection, without the padding of the structure
+ * (i.e. GetSerialisedSize() <= sizeof(structure)) and in the native byte order, so that the buffer shall be
+ * deserialised by a node with the same architecture.
+ *
+ * Only the integer, float and character array members (and structures of them) are supported: structures
+ * with pointers or strings (e.g. StreamString) members are refused by Initialise.
+ */
+class DLL_API IntrospectionSerialiser {
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     * @post
+     *   GetNumberOfRuns() == 0 &&
+     *   GetSerialisedSize() == 0
+     */
+    IntrospectionSerialiser();
+
+    /**
+     * @brief Destructor. Frees the copy plan.
+     */
+    ~IntrospectionSerialiser();
+
+    /**
+     * @brief Builds the copy plan of a registered class.
+     * @param[in] className the name of the class (or structure) in the ClassRegistryDatabase.
+     * @return true if the class is registered with an Introspection and all of its members are supported
+     * (see class description).
+     */
+    bool Initialise(const char8 * const className);
+
+    /**
+     * @brief Gets the number of bytes of a serialised structure.
+     * @return the number of bytes of a serialised structure.
+     */
+    uint32 GetSerialisedSize() const;
+
+    /**
+     * @brief Gets the size of the structure.
+     * @return the size of the structure (i.e. its sizeof).
+     */
+    uint32 GetStructureSize() const;
+
+    /**
+     * @brief Gets the number of memory copies performed by Serialise and Deserialise.
+     * @return the number of runs of the copy plan.
+     */
+    uint32 GetNumberOfRuns() const;
+
+    /**
+     * @brief Gets a run of the copy plan.
+     * @param[in] runIdx the index of the run.
+     * @return the run or NULL if \a runIdx >= GetNumberOfRuns().
+     */
+    const IntrospectionCopyRun *GetRun(const uint32 runIdx) const;
+
+    /**
+     * @brief Copies a structure to a buffer.
+     * @param[in] structure the structure to serialise.
+     * @param[out] buffer the buffer to write.
+     * @param[in] bufferSize the size of \a buffer.
+     * @return true if the copy plan was built and \a bufferSize >= GetSerialisedSize().
+     */
+    bool Serialise(const void * const structure,
+                   void * const buffer,
+                   const uint32 bufferSize) const;
+
+    /**
+     * @brief Copies a buffer written by Serialise to a structure.
+     * @param[in] buffer the buffer to read.
+     * @param[in] bufferSize the size of \a buffer.
+     * @param[out] structure the structure to write.
+     * @return true if the copy plan was built and \a bufferSize >= GetSerialisedSize().
+     */
+    bool Deserialise(const void * const buffer,
+                     const uint32 bufferSize,
+                     void * const structure) const;
+
+private:
+
+    /**
+     * @brief Adds the runs of all the members of \a introspection.
+     * @param[in] introspection the Introspection of the (nested) structure.
+     * @param[in] structureOffset the offset of the (nested) structure.
+     * @return false if a member is not supported.
+     */
+    bool AddMembers(const Introspection &introspection,
+                    const uint32 structureOffset);
+
+    /**
+     * @brief Adds a run to the plan, merging it with the previous run if they are contiguous in the structure.
+     * @param[in] structureOffset the offset of the run in the structure.
+     * @param[in] size the number of bytes of the run.
+     */
+    void AddRun(const uint32 structureOffset,
+                const uint32 size);
+
+    /**
+     * @brief Frees the copy plan.
+     */
+    void Reset();
+
+    /**
+     * The copy plan.
+     */
+    IntrospectionCopyRun *runs;
+
+    /**
+     * Number of runs in the plan.
+     */
+    uint32 numberOfRuns;
+
+    /**
+     * Number of runs allocated.
+     */
+    uint32 runsCapacity;
+
+    /**
+     * Number of bytes of a serialised structure.
+     */
+    uint32 serialisedSize;
+
+    /**
+     * Size of the structure.
+     */
+    uint32 structureSize;
+
+    /*lint -e{1704} non copyable*/
+    /**
+     * @brief Disallow the copy constructor.
+     */
+    IntrospectionSerialiser(const IntrospectionSerialiser &);
+
+    /**
+     * @brief Disallow the copy operator.
+     */
+    IntrospectionSerialiser &operator=(const IntrospectionSerialiser &);
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* INTROSPECTIONSERIALISER_H_ */
@@ -35,6 +35,7 @@
 #include "Object.h"
 #include "StringHelper.h"
 #include "HeapI.h"
+#include "InternedStringTable.h"
 #include "Introspection.h"
 #include "ReferenceContainer.h"
 #include "MemoryOperationsHelper.h"
@@ -47,6 +48,8 @@
 
 namespace MARTe {
 
+volatile int32 Object::namesVersion = 0;
+
 ErrorManagement::ErrorType Object::CallRegisteredMethod(const CCString &methodName) {
     ErrorManagement::ErrorType err;
 
@@ -131,6 +134,29 @@ ErrorManagement::ErrorType Object::CallRegisteredMethod(const CCString &methodNa
     return err;
 }
 
+ErrorManagement::ErrorType Object::CallMethodWithArguments(const CCString &methodName,
+                                                           const void * const signature,
+                                                           const void * const * const arguments) {
+    ErrorManagement::ErrorType err;
+
+    ClassRegistryItem * cri = GetClassRegistryItem();
+    ClassMethodCaller *caller = NULL_PTR(ClassMethodCaller *);
+
+    err.fatalError = (cri == NULL_PTR(ClassRegistryItem *));
+
+    if (err.ErrorsCleared()) {
+        caller = cri->FindMethod(methodName);
+        err.unsupportedFeature = (caller == NULL_PTR(ClassMethodCaller *));
+    }
+
+    if (err.ErrorsCleared()) {
+        /*lint -e{613} err.unsupportedFeature protects from using caller = NULL*/
+        err = caller->CallWithArguments(this, signature, arguments);
+    }
+
+    return err;
+}
+
 bool Object::ConvertDataToStructuredData(void* const ptr, const char8* const className, StructuredDataI& data, const char8* const objName) {
     bool ret = false;
 
@@ -313,43 +339,47 @@ bool Object::ConvertMetadataToStructuredData(void * const ptr, const char8 * con
 
 Object::Object() {
     referenceCounter = 0;
-    thisObjName = NULL_PTR(char8 *);
+    thisObjName = NULL_PTR(const char8 *);
     isDomain = false;
+    threadConfined = false;
 }
 
 Object::Object(const Object &copy) {
     referenceCounter = 0;
-    if (copy.thisObjName != NULL_PTR(char8 *)) {
-        thisObjName = StringHelper::StringDup(copy.thisObjName);
-    }
-    else {
-        thisObjName = NULL_PTR(char8 *);
-    }
+    thisObjName = InternedStringTable::Instance()->Share(copy.thisObjName);
     isDomain = false;
+    threadConfined = false;
 }
 
-/*lint -e{1551} the destructor must guarantee that the named is freed. No exception should be
- * thrown given that name always points to a valid memory address and thus Memory::Free
- * should not raise exceptions.*/
+/*lint -e{1551} the destructor must guarantee that the name is released.*/
 Object::~Object() {
-    if (thisObjName != NULL_PTR(char8 *)) {
-        /*lint -e{929} cast required to be able to use Memory::Free interface.*/
-        bool ok = HeapManager::Free(reinterpret_cast<void *&>(thisObjName));
-        if (!ok) {
-            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Object: Failed HeapManager::Free() in destructor");
-        }
+    if (thisObjName != NULL_PTR(const char8 *)) {
+        InternedStringTable::Instance()->Release(thisObjName);
     }
 }
 
 uint32 Object::DecrementReferences() {
-    Atomic::Decrement(&referenceCounter);
-    uint32 ret = static_cast<uint32>(referenceCounter);
+    int32 previous;
+    if (threadConfined) {
+        previous = referenceCounter;
+        referenceCounter = previous - 1;
+    }
+    else {
+        /* Release the writes of this thread to the object and acquire the ones of the other owners before it may be destroyed. */
+        previous = Atomic::FetchAdd(&referenceCounter, -1, Atomic::MemoryOrderAcquireRelease);
+    }
+    uint32 ret = static_cast<uint32>(previous - 1);
     return ret;
 }
 
 void Object::IncrementReferences() {
-    Atomic::Increment(&referenceCounter);
-
+    if (threadConfined) {
+        referenceCounter = referenceCounter + 1;
+    }
+    else {
+        /* A new reference can only be created from an existing one, so no ordering is required. */
+        (void) Atomic::FetchAdd(&referenceCounter, 1, Atomic::MemoryOrderRelaxed);
+    }
 }
 
 Object *Object::Clone() const {
@@ -444,14 +474,19 @@ void Object::GetUniqueName(char8 * const destination, const uint32 &size) const
 }
 
 void Object::SetName(const char8 * const newName) {
-    if (thisObjName != NULL_PTR(char8 *)) {
-        /*lint -e{929} cast required to be able to use Memory::Free interface.*/
-        bool ok = HeapManager::Free(reinterpret_cast<void *&>(thisObjName));
-        if (!ok) {
-            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Object: Failed HeapManager::Free()");
-        }
+    //Naming a new Object which is not yet referenced by any container cannot invalidate an index
+    bool indexable = ((thisObjName != NULL_PTR(const char8 *)) || (NumberOfReferences() > 1u));
+    const char8 *oldName = thisObjName;
+    thisObjName = InternedStringTable::Instance()->Intern(newName);
+    //Released after the Intern, as newName may be the current name
+    InternedStringTable::Instance()->Release(oldName);
+    if (indexable) {
+        Atomic::Increment(&namesVersion);
     }
-    thisObjName = StringHelper::StringDup(newName);
+}
+
+uint32 Object::GetNamesVersion() {
+    return static_cast<uint32>(namesVersion);
 }
 
 bool Object::ExportData(StructuredDataI & data) {
@@ -495,6 +530,14 @@ bool Object::IsDomain() const {
     return isDomain;
 }
 
+void Object::SetThreadConfined(const bool confined) {
+    threadConfined = confined;
+}
+
+bool Object::IsThreadConfined() const {
+    return threadConfined;
+}
+
 /*lint -e{715} purgeList is not used in the default implementation of the method*/
 void Object::Purge(ReferenceContainer &purgeList) {
 
@@ -40,6 +40,7 @@
 #include "StringHelper.h"
 #include "StructuredDataI.h"
 #include "CLASSREGISTER.h"
+#include "ClassMethodSignature.h"
 /*---------------------------------------------------------------------------*/
 /*                         Forward declarations                              */
 /*---------------------------------------------------------------------------*/
@@ -207,6 +208,26 @@ public:
      */
     bool IsDomain() const;
 
+    /**
+     * @brief Declares that all the References to this object are created, copied and destroyed by one thread.
+     * @details The reference counter of a thread-confined object is updated with plain (non-atomic) increments and decrements,
+     * which avoids the atomic read-modify-write (and its barrier) on every copy of a Reference. By default objects are not
+     * thread-confined. It can also be set from the configuration with ThreadConfined = 1 (see Reference::Initialise).
+     * @param[in] confined true if the application guarantees that the object references are only handled by one thread.
+     * @pre
+     *   No other thread holds or will take a Reference to this object while it is thread-confined (the flag shall be set before
+     *   the object is shared, e.g. just after its creation).
+     * @post
+     *    IsThreadConfined() == confined
+     */
+    void SetThreadConfined(const bool confined);
+
+    /**
+     * @brief Returns true if the object was declared thread-confined.
+     * @return true if the reference counter is not updated atomically.
+     */
+    bool IsThreadConfined() const;
+
     /**
      * @brief Returns the number of references.
      * @return the number of references pointing to this object.
@@ -215,7 +236,8 @@ public:
 
     /**
      * @brief Returns the object name.
-     * @return the object name (which might be NULL).
+     * @return the object name (which might be NULL). The name is interned (see InternedStringTable), so that
+     * the objects with the same name return the same pointer.
      */
     const char8 * const GetName() const;
 
@@ -237,11 +259,20 @@ public:
     /**
      * @brief Sets the object name.
      * @details If a name had already been set the object name will be updated to this name.
-     * @param newName the new name of the Object. A private copy of the \a name will be performed and managed by the Object.
+     * @param newName the new name of the Object. The \a name is interned (see InternedStringTable) and released by the Object.
      * @pre newName != NULL
      */
     void SetName(const char8 * const newName);
 
+    /**
+     * @brief Returns a counter which is incremented every time that SetName is called on any Object.
+     * @details Allows the indexes of objects by name (see ReferenceContainer) to detect that a name may have changed after
+     * the object was indexed. The first SetName of an Object held by at most one Reference is not counted, so that building
+     * a tree of new objects does not invalidate the indexes (objects shall thus be named before being inserted in a container).
+     * @return the number of times that SetName was called (see above).
+     */
+    static uint32 GetNamesVersion();
+
     /**
      * @brief Calls a registered method without arguments.
      * @param[in] methodName is the method name.
@@ -277,6 +308,62 @@ public:
      */
     ErrorManagement::ErrorType CallRegisteredMethod(const CCString &methodName, StreamI &stream);
 
+    /**
+     * @brief Calls a registered method with one typed parameter, without packing it in a StructuredDataI (see ClassMethodCaller::CallTyped).
+     * @details The type shall be the one of the method parameter stripped of the const and reference modifiers
+     * (e.g. CallTypedMethod<uint32>("SetValue", 3u) for ErrorType SetValue(const uint32 &)).
+     * @param[in] methodName is the method name.
+     * @param[in] param1 the first parameter.
+     * @return ErrorManagement::UnsupportedFeature if the \a methodName is not registered.
+     * ErrorManagement::ParametersError if the types are not the ones of the method or if the method has output parameters.
+     * The error returned by the method otherwise.
+     */
+    template<typename argType1>
+    inline ErrorManagement::ErrorType CallTypedMethod(const CCString &methodName,
+                                                      const argType1 &param1);
+
+    /**
+     * @brief Calls a registered method with two typed parameters (see CallTypedMethod).
+     * @param[in] methodName is the method name.
+     * @param[in] param1 the first parameter.
+     * @param[in] param2 the second parameter.
+     * @return see CallTypedMethod.
+     */
+    template<typename argType1, typename argType2>
+    inline ErrorManagement::ErrorType CallTypedMethod(const CCString &methodName,
+                                                      const argType1 &param1,
+                                                      const argType2 &param2);
+
+    /**
+     * @brief Calls a registered method with three typed parameters (see CallTypedMethod).
+     * @param[in] methodName is the method name.
+     * @param[in] param1 the first parameter.
+     * @param[in] param2 the second parameter.
+     * @param[in] param3 the third parameter.
+     * @return see CallTypedMethod.
+     */
+    template<typename argType1, typename argType2, typename argType3>
+    inline ErrorManagement::ErrorType CallTypedMethod(const CCString &methodName,
+                                                      const argType1 &param1,
+                                                      const argType2 &param2,
+                                                      const argType3 &param3);
+
+    /**
+     * @brief Calls a registered method with four typed parameters (see CallTypedMethod).
+     * @param[in] methodName is the method name.
+     * @param[in] param1 the first parameter.
+     * @param[in] param2 the second parameter.
+     * @param[in] param3 the third parameter.
+     * @param[in] param4 the fourth parameter.
+     * @return see CallTypedMethod.
+     */
+    template<typename argType1, typename argType2, typename argType3, typename argType4>
+    inline ErrorManagement::ErrorType CallTypedMethod(const CCString &methodName,
+                                                      const argType1 &param1,
+                                                      const argType2 &param2,
+                                                      const argType3 &param3,
+                                                      const argType4 &param4);
+
     /**
      * @brief Returns the class properties associated with this class type.
      * @return a pointer to the class properties object (which might be NULL).
@@ -294,7 +381,16 @@ public:
 
 private:
 
-
+    /**
+     * @brief Finds the registered method and calls it with the parameters at the given addresses (see ClassMethodCaller::CallWithArguments).
+     * @param[in] methodName is the method name.
+     * @param[in] signature the ClassMethodSignature::Get of the types of the parameters.
+     * @param[in] arguments the addresses of the parameters.
+     * @return see CallTypedMethod.
+     */
+    ErrorManagement::ErrorType CallMethodWithArguments(const CCString &methodName,
+                                                       const void * const signature,
+                                                       const void * const * const arguments);
 
     /**
      * @brief Decrements the number of references to this object.
@@ -374,14 +470,24 @@ private:
     volatile int32 referenceCounter;
 
     /**
-     * The name of this object.
+     * The name of this object (interned in the InternedStringTable).
      */
-    char8 *thisObjName;
+    const char8 *thisObjName;
 
     /**
      * Specifies if the object is a domain
      */
     bool isDomain;
+
+    /**
+     * Specifies if the reference counter can be updated without atomic operations.
+     */
+    bool threadConfined;
+
+    /**
+     * Incremented by SetName (see GetNamesVersion).
+     */
+    static volatile int32 namesVersion;
 };
 
 
@@ -390,6 +496,40 @@ private:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+template<typename argType1>
+ErrorManagement::ErrorType Object::CallTypedMethod(const CCString &methodName,
+                                                   const argType1 &param1) {
+    const void *arguments[] = { &param1 };
+    return CallMethodWithArguments(methodName, ClassMethodSignature<argType1>::Get(), &arguments[0]);
+}
+
+template<typename argType1, typename argType2>
+ErrorManagement::ErrorType Object::CallTypedMethod(const CCString &methodName,
+                                                   const argType1 &param1,
+                                                   const argType2 &param2) {
+    const void *arguments[] = { &param1, &param2 };
+    return CallMethodWithArguments(methodName, ClassMethodSignature<argType1, argType2>::Get(), &arguments[0]);
+}
+
+template<typename argType1, typename argType2, typename argType3>
+ErrorManagement::ErrorType Object::CallTypedMethod(const CCString &methodName,
+                                                   const argType1 &param1,
+                                                   const argType2 &param2,
+                                                   const argType3 &param3) {
+    const void *arguments[] = { &param1, &param2, &param3 };
+    return CallMethodWithArguments(methodName, ClassMethodSignature<argType1, argType2, argType3>::Get(), &arguments[0]);
+}
+
+template<typename argType1, typename argType2, typename argType3, typename argType4>
+ErrorManagement::ErrorType Object::CallTypedMethod(const CCString &methodName,
+                                                   const argType1 &param1,
+                                                   const argType2 &param2,
+                                                   const argType3 &param3,
+                                                   const argType4 &param4) {
+    const void *arguments[] = { &param1, &param2, &param3, &param4 };
+    return CallMethodWithArguments(methodName, ClassMethodSignature<argType1, argType2, argType3, argType4>::Get(), &arguments[0]);
+}
+
 
 
 
@@ -32,8 +32,8 @@
 /*---------------------------------------------------------------------------*/
 
 #include "ErrorType.h"
+#include "WyHashFunction.h"
 #include "ObjectRegistryDatabase.h"
-#include "ReferenceContainerFilterObjectName.h"
 #include "ReferenceContainerFilterReferences.h"
 
 /*---------------------------------------------------------------------------*/
@@ -58,6 +58,13 @@ ObjectRegistryDatabase *ObjectRegistryDatabase::Instance() {
 
 ObjectRegistryDatabase::ObjectRegistryDatabase() :
         ReferenceContainer() {
+    cacheMux.Create();
+    cacheTreeVersion = ReferenceContainer::GetTreeVersion();
+    cacheNamesVersion = Object::GetNamesVersion();
+    for (uint32 i = 0u; i < OBJECT_REGISTRY_DATABASE_CACHE_SIZE; i++) {
+        cache[i].current = NULL_PTR(const Object *);
+        cache[i].path[0] = '\0';
+    }
 }
 
 /*lint -e{1551} Guarantees that all the nodes are cleared before destroying the application.*/
@@ -67,6 +74,76 @@ ObjectRegistryDatabase::~ObjectRegistryDatabase() {
 
 Reference ObjectRegistryDatabase::Find(const char8 * const path,
                                        const Reference current) {
+    Reference ret;
+    //The start point only matters if the path goes back to its domains
+    const Object *start = NULL_PTR(const Object *);
+    if (current.IsValid()) {
+        if (path[0] == ':') {
+            start = current.operator->();
+        }
+    }
+    uint32 pathSize = StringHelper::Length(path);
+    bool cacheable = (pathSize < OBJECT_REGISTRY_DATABASE_CACHE_PATH_SIZE);
+    uint32 slot = 0u;
+    uint32 treeVersion = ReferenceContainer::GetTreeVersion();
+    uint32 namesVersion = Object::GetNamesVersion();
+    if (cacheable) {
+        WyHashFunction hashFun;
+        slot = hashFun.Compute(path, pathSize);
+        slot ^= static_cast<uint32>(reinterpret_cast<uintp>(start) >> 4u);
+        slot &= (OBJECT_REGISTRY_DATABASE_CACHE_SIZE - 1u);
+        if (cacheMux.FastLock() == ErrorManagement::NoError) {
+            if ((cacheTreeVersion != treeVersion) || (cacheNamesVersion != namesVersion)) {
+                CacheClear();
+                cacheTreeVersion = treeVersion;
+                cacheNamesVersion = namesVersion;
+            }
+            CacheEntry &entry = cache[slot];
+            if (entry.reference.IsValid()) {
+                if ((entry.current == start) && (StringHelper::Compare(&entry.path[0], path) == 0)) {
+                    ret = entry.reference;
+                }
+            }
+        }
+        cacheMux.FastUnLock();
+    }
+    if (!ret.IsValid()) {
+        ret = FindUncached(path, current);
+        if ((cacheable) && (ret.IsValid())) {
+            if (cacheMux.FastLock() == ErrorManagement::NoError) {
+                //Only if nothing changed while searching
+                if ((cacheTreeVersion == treeVersion) && (cacheNamesVersion == namesVersion)) {
+                    CacheEntry &entry = cache[slot];
+                    if (StringHelper::Copy(&entry.path[0], path)) {
+                        entry.current = start;
+                        entry.reference = ret;
+                    }
+                }
+            }
+            cacheMux.FastUnLock();
+        }
+    }
+    return ret;
+}
+
+void ObjectRegistryDatabase::CacheClear() {
+    for (uint32 i = 0u; i < OBJECT_REGISTRY_DATABASE_CACHE_SIZE; i++) {
+        cache[i].reference = Reference();
+        cache[i].current = NULL_PTR(const Object *);
+        cache[i].path[0] = '\0';
+    }
+}
+
+void ObjectRegistryDatabase::Purge(ReferenceContainer &purgeList) {
+    if (cacheMux.FastLock() == ErrorManagement::NoError) {
+        CacheClear();
+    }
+    cacheMux.FastUnLock();
+    ReferenceContainer::Purge(purgeList);
+}
+
+Reference ObjectRegistryDatabase::FindUncached(const char8 * const path,
+                                               const Reference &current) {
     ReferenceT<ReferenceContainer> domain = current;
     bool isSearchDomain = current.IsValid();
     uint32 backSteps = 0u;
@@ -110,13 +187,11 @@ Reference ObjectRegistryDatabase::Find(const char8 * const path,
     // now search from the domain forward
     Reference ret;
     if (ok) {
-        ReferenceContainerFilterObjectName filterName(1, ReferenceContainerFilterMode::SHALLOW, &path[backSteps]);
-        ReferenceContainer resultSingle;
-
+        //Resolved with the name indexes of the containers (see ReferenceContainer::Find)
         if (isSearchDomain) {
             if (domain.IsValid()) {
                 // already safe
-                domain->Find(resultSingle, filterName);
+                ret = domain->Find(&path[backSteps]);
             }
             else {
                 REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Find: Invalid domain");
@@ -124,13 +199,7 @@ Reference ObjectRegistryDatabase::Find(const char8 * const path,
         }
         else {
             // search from the beginning
-            ReferenceContainer::Find(resultSingle, filterName);
-        }
-
-        ok = (resultSingle.Size() > 0u);
-        if (ok) {
-            //Invalidate move to leafs
-            ret = resultSingle.Get(resultSingle.Size() - 1u);
+            ret = ReferenceContainer::Find(&path[backSteps]);
         }
     }
     return ret;
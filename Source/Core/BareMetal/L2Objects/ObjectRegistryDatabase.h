@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "FastPollingMutexSem.h"
 #include "ReferenceContainer.h"
 #include "ReferenceT.h"
 
@@ -41,8 +42,23 @@
 
 namespace MARTe {
 
+/**
+ * Number of entries of the ObjectRegistryDatabase::Find cache (a power of two).
+ */
+const uint32 OBJECT_REGISTRY_DATABASE_CACHE_SIZE = 64u;
+
+/**
+ * Maximum length (including the terminator) of the paths stored in the ObjectRegistryDatabase::Find cache.
+ */
+const uint32 OBJECT_REGISTRY_DATABASE_CACHE_PATH_SIZE = 64u;
+
 /**
  * @brief Singleton database of References to MARTe Objects.
+ * @details The results of Find are kept in a small direct mapped cache (path, start point) -> Reference, so that repeated
+ * searches of the same destinations (e.g. by MessageI::SendMessage) do not walk the tree. The whole cache is discarded as soon
+ * as an object is removed from (or inserted in a given position of) any ReferenceContainer or any Object is renamed
+ * (see ReferenceContainer::GetTreeVersion and Object::GetNamesVersion), so that the cached references are released at the
+ * latest on the next Find or Purge.
  */
 class DLL_API ObjectRegistryDatabase: public ReferenceContainer, public GlobalObjectI {
 
@@ -72,6 +88,15 @@ public:
     Reference Find(const char8 * const path,
                    const Reference current = Reference());
 
+    /**
+     * @brief Discards the Find cache and purges the database.
+     * @see ReferenceContainer::Purge
+     */
+    virtual void Purge(ReferenceContainer &purgeList);
+
+    /*lint -e{1511} Purge() is still ReferenceContainer::Purge().*/
+    using ReferenceContainer::Purge;
+
     /**
      * @see Object::GetClassName
      * @return "ObjectRegistryDatabase".
@@ -80,6 +105,58 @@ public:
 
 private:
 
+    /**
+     * @brief Find without the cache.
+     * @see Find
+     */
+    Reference FindUncached(const char8 * const path,
+                           const Reference &current);
+
+    /**
+     * @brief Releases all the entries of the cache.
+     * @pre cacheMux is locked.
+     */
+    void CacheClear();
+
+    /**
+     * An entry of the Find cache.
+     */
+    struct CacheEntry {
+        /**
+         * The start point of the search (only compared, never accessed), NULL if the search was from the root.
+         */
+        const Object *current;
+
+        /**
+         * The result of the search (invalid if the entry is empty).
+         */
+        Reference reference;
+
+        /**
+         * The searched path.
+         */
+        char8 path[OBJECT_REGISTRY_DATABASE_CACHE_PATH_SIZE];
+    };
+
+    /**
+     * The Find cache.
+     */
+    CacheEntry cache[OBJECT_REGISTRY_DATABASE_CACHE_SIZE];
+
+    /**
+     * The ReferenceContainer::GetTreeVersion() for which the cache entries are valid.
+     */
+    uint32 cacheTreeVersion;
+
+    /**
+     * The Object::GetNamesVersion() for which the cache entries are valid.
+     */
+    uint32 cacheNamesVersion;
+
+    /**
+     * Protects the cache.
+     */
+    FastPollingMutexSem cacheMux;
 
     /**
      * @brief Disallow the usage of new.
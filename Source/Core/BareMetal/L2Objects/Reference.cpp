@@ -58,6 +58,25 @@ Reference::Reference(const Reference& sourceReference) {
     (*this) = sourceReference;
 }
 
+#ifdef MARTe2_CXX11
+Reference::Reference(Reference&& sourceReference) {
+    objectPointer = sourceReference.objectPointer;
+    sourceReference.objectPointer = NULL_PTR(Object*);
+    //Also clears the typed pointer of a ReferenceT
+    sourceReference.RemoveReference();
+}
+
+Reference& Reference::operator=(Reference&& sourceReference) {
+    if (this != &sourceReference) {
+        RemoveReference();
+        objectPointer = sourceReference.objectPointer;
+        sourceReference.objectPointer = NULL_PTR(Object*);
+        sourceReference.RemoveReference();
+    }
+    return *this;
+}
+#endif
+
 Reference::Reference(const char8* const typeName,
                      HeapI* const heap) {
     objectPointer = NULL_PTR(Object*);
@@ -147,6 +166,13 @@ bool Reference::Initialise(StructuredDataI &data,
             objectPointer->SetName(&data.GetName()[1]);
         }
     }
+    if (ok) {
+        uint32 threadConfined = 0u;
+        if (data.Read("ThreadConfined", threadConfined)) {
+            /*lint -e{613} checking of NULL pointer done before entering here. */
+            objectPointer->SetThreadConfined(threadConfined > 0u);
+        }
+    }
     if (ok) {
         /*lint -e{613} checking of NULL pointer done before entering here. */
         ok = objectPointer->Initialise(data);
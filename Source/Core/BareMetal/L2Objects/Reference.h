@@ -71,6 +71,14 @@ public:
      */
     Reference(const Reference& sourceReference);
 
+#ifdef MARTe2_CXX11
+    /**
+     * @brief Creates a Reference taking the object of \a sourceReference (without changing its number of references).
+     * @param[in] sourceReference the Reference to be moved. It is left invalid.
+     */
+    Reference(Reference&& sourceReference);
+#endif
+
     /**
      * @brief Creates a new object of type \a typeName and links a reference to it.
      * @param[in] typeName the name of the class type.
@@ -94,6 +102,8 @@ public:
 
     /**
      * @brief Creates an object from a structured list of elements.
+     * @details The object is created with the class given by the Class element and, if ThreadConfined = 1, it is set as
+     * thread-confined (see Object::SetThreadConfined) before calling its Initialise.
      * @param[in] data the data to initialise the underlying object.
      * @param[in] initOnly if true the object is supposed to be already created and will be only initialized.
      * @return true if the object was successfully created and initialized, false otherwise.
@@ -143,6 +153,17 @@ public:
      */
     virtual Reference& operator=(const Reference& sourceReference);
 
+#ifdef MARTe2_CXX11
+    /**
+     * @brief Move assignment operator.
+     * @details This reference will be referencing the object of \a sourceReference, which is left invalid, without
+     * changing its number of references.
+     * @param[in] sourceReference the source reference to be moved to this reference.
+     * @return a reference to the object referenced by \a sourceReference.
+     */
+    virtual Reference& operator=(Reference&& sourceReference);
+#endif
+
     /**
      * @brief Assignment operator.
      * @details It will increment the number of references referencing the underlying object.
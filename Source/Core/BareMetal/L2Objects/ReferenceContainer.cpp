@@ -31,12 +31,14 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "Atomic.h"
 #include "ClassRegistryItemT.h"
 #include "ReferenceContainer.h"
 #include "ReferenceContainerNode.h"
 #include "ReferenceContainerFilterReferences.h"
 #include "ReferenceT.h"
 #include "ErrorManagement.h"
+#include "InternedStringTable.h"
 #include "StringHelper.h"
 #include "ReferenceContainerFilterObjectName.h"
 #include <typeinfo>
@@ -48,6 +50,32 @@
 namespace MARTe {
 char8 ReferenceContainer::buildTokensList[REFERENCE_CONTAINER_NUMBER_OF_TOKENS] = { '+', '\0', '\0', '\0', '\0' };
 char8 ReferenceContainer::domainTokensList[REFERENCE_CONTAINER_NUMBER_OF_TOKENS] = { '$', '\0', '\0', '\0', '\0' };
+volatile int32 ReferenceContainer::treeVersion = 0;
+}
+
+namespace {
+
+/**
+ * @brief Checks if the name of \a ref is the first \a nameSize characters of \a name.
+ */
+bool HasName(const MARTe::Reference &ref,
+             const MARTe::char8 * const name,
+             const MARTe::uint32 nameSize) {
+    bool ok = ref.IsValid();
+    if (ok) {
+        const MARTe::char8 * const refName = ref->GetName();
+        ok = (refName != NULL);
+        if (ok) {
+            //The length of the interned names is known, so that most of the candidates are refused without reading them
+            ok = (MARTe::InternedStringTable::GetLength(refName) == nameSize);
+        }
+        if (ok) {
+            ok = MARTe::StringHelper::EqualsN(refName, name, nameSize);
+        }
+    }
+    return ok;
+}
+
 }
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -59,10 +87,22 @@ ReferenceContainer::ReferenceContainer() :
         Object() {
     mux.Create();
     muxTimeout = TTInfiniteWait;
+    nameIndex = NULL_PTR(NameIndex *);
+    nameIndexVersion = 0u;
+    childrenVersion = 0u;
+    positions = NULL_PTR(ReferenceContainerNode **);
+    positionsCapacity = 0u;
+    positionsVersion = 0u;
 }
 
 ReferenceContainer::ReferenceContainer(ReferenceContainer &copy) :
         Object(copy) {
+    nameIndex = NULL_PTR(NameIndex *);
+    nameIndexVersion = 0u;
+    childrenVersion = 0u;
+    positions = NULL_PTR(ReferenceContainerNode **);
+    positionsCapacity = 0u;
+    positionsVersion = 0u;
     SetTimeout(copy.GetTimeout());
     uint32 nChildren = copy.Size();
     for (uint32 i = 0u; i < nChildren; i++) {
@@ -90,9 +130,22 @@ ReferenceContainer& ReferenceContainer::operator =(ReferenceContainer &copy) {
 /*lint -e{929} -e{925} the current implementation of the ReferenceContainer requires pointer to pointer casting*/
 Reference ReferenceContainer::Get(const uint32 idx) {
     Reference ref;
-    if (Lock()) {
+    bool ok = ReadLock();
+    if ((ok) && (PositionsAreStale(idx))) {
+        //The array can only be (re)built with the exclusive lock
+        ReadUnLock();
+        ok = Lock();
+        if (ok) {
+            if (PositionsAreStale(idx)) {
+                PositionsBuild();
+            }
+            UnLock();
+            ok = ReadLock();
+        }
+    }
+    if (ok) {
         if (idx < list.ListSize()) {
-            ReferenceContainerNode *node = (list.ListPeek(idx));
+            ReferenceContainerNode *node = PeekNode(idx);
             if (node != NULL) {
                 ref = node->GetReference();
             }
@@ -100,8 +153,8 @@ Reference ReferenceContainer::Get(const uint32 idx) {
         else {
             REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "ReferenceContainer: input greater than the list size.");
         }
+        ReadUnLock();
     }
-    UnLock();
     return ref;
 }
 
@@ -116,6 +169,10 @@ void ReferenceContainer::SetTimeout(const TimeoutType &timeout) {
 /*lint -e{1551} no exception should be thrown given that ReferenceContainer is
  * the sole owner of the list (LinkedListHolder)*/
 ReferenceContainer::~ReferenceContainer() {
+    IndexReset();
+    if (positions != NULL) {
+        delete[] positions;
+    }
     LinkedListable *p = list.List();
     list.Reset();
     while (p != NULL) {
@@ -130,23 +187,42 @@ bool ReferenceContainer::Insert(Reference ref, const int32 &position) {
     bool ok = (Lock());
     if (ok) {
         ReferenceContainerNode *newItem = new ReferenceContainerNode();
-        if (newItem->SetReference(ref)) {
+        if (newItem->SetReference(MARTe2_MOVE(ref))) {
             if (position == -1) {
                 list.ListAdd(newItem);
+                //Appending keeps the array of the nodes by position up to date
+                if ((positions != NULL) && (positionsVersion == childrenVersion)) {
+                    uint32 size = list.ListSize();
+                    if (size > positionsCapacity) {
+                        ReferenceContainerNode **grown = new ReferenceContainerNode*[2u * size];
+                        for (uint32 i = 0u; i < (size - 1u); i++) {
+                            grown[i] = positions[i];
+                        }
+                        delete[] positions;
+                        positions = grown;
+                        positionsCapacity = 2u * size;
+                    }
+                    positions[size - 1u] = newItem;
+                    positionsVersion = childrenVersion + 1u;
+                }
             }
             else {
                 list.ListInsert(newItem, static_cast<uint32>(position));
+                //May hide an element with the same name
+                Atomic::Increment(&treeVersion);
             }
+            IndexAdd(newItem);
+            childrenVersion++;
         }
         else {
             delete newItem;
             ok = false;
         }
+        UnLock();
     }
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ReferenceContainer: Failed FastLock()");
     }
-    UnLock();
     return ok;
 }
 
@@ -170,12 +246,17 @@ bool ReferenceContainer::Insert(const char8 * const path, Reference ref) {
                 ok = (StringHelper::Length(token) > 0u);
                 if (ok) {
                     //Check if a node with this name already exists
-                    bool found = false;
                     Reference foundReference;
-                    uint32 i;
-                    for (i = 0u; (i < currentNode->Size()) && (!found); i++) {
-                        foundReference = currentNode->Get(i);
-                        found = (StringHelper::Compare(foundReference->GetName(), token) == 0);
+                    uint32 matches = currentNode->FindChild(token, StringHelper::Length(token), foundReference);
+                    bool found = (matches > 0u);
+                    if (matches > 1u) {
+                        //Repeated name, take the first one
+                        found = false;
+                        uint32 i;
+                        for (i = 0u; (i < currentNode->Size()) && (!found); i++) {
+                            foundReference = currentNode->Get(i);
+                            found = (StringHelper::Compare(foundReference->GetName(), token) == 0);
+                        }
                     }
                     // take the next token
 
@@ -250,8 +331,25 @@ bool ReferenceContainer::IsContainer(const Reference &ref) const {
 /*lint -e{929} -e{925} the current implementation of the ReferenceContainer requires pointer to pointer casting*/
 void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilter &filter) {
     int32 index = 0;
-    bool ok = Lock();
-    if (ok) {
+    //Only the removal of the found nodes requires the exclusive lock
+    bool exclusive = filter.IsRemove();
+    bool locked = exclusive ? Lock() : ReadLock();
+    //The removals would anyway make the array out of date (e.g. Delete would rebuild it every time)
+    if ((locked) && (!exclusive) && (list.ListSize() > 0u)) {
+        if (PositionsAreStale(list.ListSize() - 1u)) {
+            //The array can only be (re)built with the exclusive lock
+            ReadUnLock();
+            locked = Lock();
+            if (locked) {
+                if ((list.ListSize() > 0u) && (PositionsAreStale(list.ListSize() - 1u))) {
+                    PositionsBuild();
+                }
+                UnLock();
+                locked = ReadLock();
+            }
+        }
+    }
+    if (locked) {
         if (list.ListSize() > 0u) {
             if (filter.IsReverse()) {
                 index = static_cast<int32>(list.ListSize()) - 1;
@@ -261,7 +359,7 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
             //lint -e{9007} no side-effects on the right of the && operator
             while ((!filter.IsFinished()) && ((filter.IsReverse() && (index > -1)) || ((!filter.IsReverse()) && (index < static_cast<int32>(list.ListSize()))))) {
 
-                ReferenceContainerNode *currentNode = (list.ListPeek(static_cast<uint32>(index)));
+                ReferenceContainerNode *currentNode = PeekNode(static_cast<uint32>(index));
                 Reference const & currentNodeReference = currentNode->GetReference();
                 //Check if the current node meets the filter criteria
                 bool found = filter.Test(result, currentNodeReference);
@@ -273,6 +371,9 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
                         if (result.Insert(currentNodeReference)) {
                             if (filter.IsRemove()) {
                                 //Only delete the exact node index
+                                IndexRemove(currentNode);
+                                Atomic::Increment(&treeVersion);
+                                childrenVersion++;
                                 if (list.ListDelete(currentNode)) {
                                     //Given that the index will be incremented, but we have removed an element, the index should stay in the same position
                                     if (!filter.IsReverse()) {
@@ -297,7 +398,7 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
 
                 /*lint -e{9007} filter.IsRecursive() has no side effects*/
                 if ((IsContainer(currentNodeReference)) && filter.IsRecursive()) {
-                    ok = true;
+                    bool ok = true;
                     if (filter.IsStorePath()) {
                         ok = result.Insert(currentNodeReference);
                     }
@@ -305,22 +406,32 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
                     if (ok) {
                         ReferenceT<ReferenceContainer> currentNodeContainer = currentNodeReference;
                         uint32 sizeBeforeBranching = result.list.ListSize();
-                        UnLock();
+                        if (exclusive) {
+                            UnLock();
+                        }
+                        else {
+                            ReadUnLock();
+                        }
                         currentNodeContainer->Find(result, filter);
-                        if (Lock()) {
+                        locked = exclusive ? Lock() : ReadLock();
+                        if (locked) {
                             //Recursion was aborted. Remove all the elements from the test results
                             if (!filter.IsRecursive()) {
+                                result.IndexReset();
                                 while (result.list.ListSize() > 0u) {
                                     LinkedListable *node = result.list.ListExtract(result.list.ListSize() - 1u);
                                     delete node;
+                                    result.childrenVersion++;
                                 }
                             }
                             //Something was found if the result size has changed
                             else if (sizeBeforeBranching == result.list.ListSize()) {
                                 //Nothing found. Remove the stored path (which led to nowhere).
                                 if (filter.IsStorePath()) {
+                                    result.IndexReset();
                                     LinkedListable *node = result.list.ListExtract(result.list.ListSize() - 1u);
                                     delete node;
+                                    result.childrenVersion++;
                                 }
                             }
                             else {
@@ -334,6 +445,9 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
                         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ReferenceContainer: Failed StaticList::Insert()");
                     }
                 }
+                if (!locked) {
+                    break;
+                }
                 if (!filter.IsReverse()) {
                     index++;
                 }
@@ -342,41 +456,268 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
                 }
             }
         }
+        if (locked) {
+            if (exclusive) {
+                UnLock();
+            }
+            else {
+                ReadUnLock();
+            }
+        }
     }
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ReferenceContainer: Failed FastLock()");
     }
-
-    UnLock();
 }
 
 Reference ReferenceContainer::Find(const char8 * const path, const bool recursive) {
     Reference ret;
-    uint32 mode = ReferenceContainerFilterMode::SHALLOW;
-    if (recursive) {
-        mode = ReferenceContainerFilterMode::RECURSIVE;
+    bool found = false;
+    if (!recursive) {
+        found = FindPath(path, ret);
     }
-    ReferenceContainerFilterObjectName filter(1, mode, path);
-    ReferenceContainer resultSingle;
-    Find(resultSingle, filter);
-    if (resultSingle.Size() > 0u) {
-        ret = resultSingle.Get(resultSingle.Size() - 1u);
+    if (!found) {
+        uint32 mode = ReferenceContainerFilterMode::SHALLOW;
+        if (recursive) {
+            mode = ReferenceContainerFilterMode::RECURSIVE;
+        }
+        ReferenceContainerFilterObjectName filter(1, mode, path);
+        ReferenceContainer resultSingle;
+        Find(resultSingle, filter);
+        if (resultSingle.Size() > 0u) {
+            ret = resultSingle.Get(resultSingle.Size() - 1u);
+        }
     }
     return ret;
 }
 
+bool ReferenceContainer::FindPath(const char8 * const path, Reference &ret) {
+    bool decided = true;
+    ret = Reference();
+    //Same syntax as in ReferenceContainerFilterObjectName: the first and the last '.' are ignored and empty names are not valid
+    uint32 end = StringHelper::Length(path);
+    uint32 start = 0u;
+    if (end > 0u) {
+        if (path[0] == '.') {
+            start = 1u;
+        }
+    }
+    if (end > start) {
+        if (path[end - 1u] == '.') {
+            end--;
+        }
+    }
+    bool valid = (end > start);
+    ReferenceContainer *current = this;
+    //Holds the current container while it is being searched
+    Reference currentRef;
+    while ((valid) && (decided) && (start < end)) {
+        //path[end] is either the trailing '.' or the terminator
+        uint32 tokenEnd = start + StringHelper::ComponentLength(&path[start], '.');
+        valid = (tokenEnd > start);
+        if (valid) {
+            Reference child;
+            uint32 matches = current->FindChild(&path[start], tokenEnd - start, child);
+            decided = (matches < 2u);
+            valid = (matches == 1u);
+            if (valid) {
+                if (tokenEnd == end) {
+                    ret = child;
+                }
+                else {
+                    current = dynamic_cast<ReferenceContainer *>(child.operator->());
+                    valid = (current != NULL);
+                    currentRef = child;
+                }
+            }
+        }
+        start = tokenEnd + 1u;
+    }
+    return decided;
+}
+
+/*lint -e{929} -e{925} the current implementation of the ReferenceContainer requires pointer to pointer casting*/
+uint32 ReferenceContainer::FindChild(const char8 * const name,
+                                     const uint32 nameSize,
+                                     Reference &child) {
+    uint32 matches = 0u;
+    bool ok = ReadLock();
+    if ((ok) && (IndexIsStale())) {
+        //The index can only be (re)built with the exclusive lock
+        ReadUnLock();
+        ok = Lock();
+        if (ok) {
+            if (IndexIsStale()) {
+                IndexBuild();
+            }
+            UnLock();
+            ok = ReadLock();
+        }
+    }
+    if (ok) {
+        //A stale index (e.g. renamed in the meanwhile or failed to build) falls back to the linear search
+        if ((list.ListSize() >= REFERENCE_CONTAINER_INDEX_THRESHOLD) && (!IndexIsStale())) {
+            uint32 key = nameIndex->Key(name, nameSize);
+            uint32 cursor = 0u;
+            ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+            while ((matches < 2u) && (nameIndex->Search(key, cursor, node))) {
+                if (HasName(node->GetReference(), name, nameSize)) {
+                    child = node->GetReference();
+                    matches++;
+                }
+            }
+        }
+        else {
+            ReferenceContainerNode *node = list.List();
+            while ((matches < 2u) && (node != NULL)) {
+                if (HasName(node->GetReference(), name, nameSize)) {
+                    if (matches == 0u) {
+                        child = node->GetReference();
+                    }
+                    matches++;
+                }
+                node = static_cast<ReferenceContainerNode *>(node->Next());
+            }
+        }
+        ReadUnLock();
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ReferenceContainer: Failed FastLock()");
+    }
+    return matches;
+}
+
+/*lint -e{929} -e{925} the current implementation of the ReferenceContainer requires pointer to pointer casting*/
+void ReferenceContainer::IndexBuild() {
+    //Read before walking the list so that a concurrent rename invalidates the index
+    nameIndexVersion = Object::GetNamesVersion();
+    if (nameIndex == NULL) {
+        nameIndex = new NameIndex();
+    }
+    else {
+        nameIndex->Reset();
+    }
+    bool ok = true;
+    ReferenceContainerNode *node = list.List();
+    while ((ok) && (node != NULL)) {
+        Reference const & ref = node->GetReference();
+        if (ref.IsValid()) {
+            const char8 * const name = ref->GetName();
+            if (name != NULL) {
+                //The Object names are interned with their (WyHashFunction) hash
+                ok = nameIndex->Insert(InternedStringTable::GetHash(name), node);
+            }
+        }
+        node = static_cast<ReferenceContainerNode *>(node->Next());
+    }
+    if (!ok) {
+        IndexReset();
+    }
+}
+
+void ReferenceContainer::IndexAdd(ReferenceContainerNode * const node) {
+    //A stale index will anyway be rebuilt on the next search
+    if (nameIndex != NULL) {
+        if (nameIndexVersion == Object::GetNamesVersion()) {
+            Reference const & ref = node->GetReference();
+            const char8 * const name = ref->GetName();
+            if (name != NULL) {
+                if (!nameIndex->Insert(InternedStringTable::GetHash(name), node)) {
+                    IndexReset();
+                }
+            }
+        }
+    }
+}
+
+void ReferenceContainer::IndexRemove(ReferenceContainerNode * const node) {
+    //A stale index will anyway be rebuilt on the next search
+    if (nameIndex != NULL) {
+        if (nameIndexVersion == Object::GetNamesVersion()) {
+            Reference const & ref = node->GetReference();
+            const char8 * name = NULL_PTR(const char8 *);
+            if (ref.IsValid()) {
+                name = ref->GetName();
+            }
+            if (name != NULL) {
+                if (!nameIndex->Remove(InternedStringTable::GetHash(name), node)) {
+                    IndexReset();
+                }
+            }
+        }
+    }
+}
+
+bool ReferenceContainer::IndexIsStale() const {
+    bool stale = (list.ListSize() >= REFERENCE_CONTAINER_INDEX_THRESHOLD);
+    if (stale) {
+        stale = ((nameIndex == NULL) || (nameIndexVersion != Object::GetNamesVersion()));
+    }
+    return stale;
+}
+
+void ReferenceContainer::PositionsBuild() {
+    uint32 size = list.ListSize();
+    if (size > positionsCapacity) {
+        if (positions != NULL) {
+            delete[] positions;
+        }
+        positions = new ReferenceContainerNode*[size];
+        positionsCapacity = size;
+    }
+    ReferenceContainerNode *node = list.List();
+    uint32 i = 0u;
+    while (node != NULL) {
+        positions[i] = node;
+        i++;
+        node = static_cast<ReferenceContainerNode *>(node->Next());
+    }
+    positionsVersion = childrenVersion;
+}
+
+bool ReferenceContainer::PositionsAreStale(const uint32 idx) const {
+    //The first positions are faster to walk than the array is to rebuild (e.g. Purge always gets the element 0 and deletes it)
+    bool stale = (idx >= REFERENCE_CONTAINER_INDEX_THRESHOLD);
+    if (stale) {
+        stale = ((positions == NULL) || (positionsVersion != childrenVersion));
+    }
+    return stale;
+}
+
+ReferenceContainerNode *ReferenceContainer::PeekNode(const uint32 idx) {
+    ReferenceContainerNode *node;
+    if ((idx >= REFERENCE_CONTAINER_INDEX_THRESHOLD) && (positions != NULL) && (positionsVersion == childrenVersion)) {
+        node = positions[idx];
+    }
+    else {
+        node = list.ListPeek(idx);
+    }
+    return node;
+}
+
+void ReferenceContainer::IndexReset() {
+    if (nameIndex != NULL) {
+        delete nameIndex;
+        nameIndex = NULL_PTR(NameIndex *);
+    }
+}
+
 uint32 ReferenceContainer::Size() {
     uint32 size = 0u;
-    if (Lock()) {
+    if (ReadLock()) {
         size = list.ListSize();
+        ReadUnLock();
     }
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ReferenceContainer: Failed FastLock()");
     }
-    UnLock();
     return size;
 }
 
+uint32 ReferenceContainer::GetChildrenVersion() const {
+    return childrenVersion;
+}
+
 bool ReferenceContainer::Initialise(StructuredDataI &data) {
 
     // only one thread has to initialise.
@@ -438,6 +779,14 @@ void ReferenceContainer::UnLock() {
     mux.FastUnLock();
 }
 
+bool ReferenceContainer::ReadLock() {
+    return (mux.FastReadLock(muxTimeout) == ErrorManagement::NoError);
+}
+
+void ReferenceContainer::ReadUnLock() {
+    mux.FastReadUnLock();
+}
+
 void ReferenceContainer::Purge() {
     ReferenceContainer purgeList;
     Purge(purgeList);
@@ -471,6 +820,10 @@ void ReferenceContainer::Purge(ReferenceContainer &purgeList) {
     }
 }
 
+uint32 ReferenceContainer::GetTreeVersion() {
+    return static_cast<uint32>(treeVersion);
+}
+
 bool ReferenceContainer::IsReferenceContainer() const {
     return true;
 }
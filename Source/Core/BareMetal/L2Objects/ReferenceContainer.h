@@ -32,13 +32,15 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
-#include "FastPollingMutexSem.h"
+#include "FastPollingReadWriteSem.h"
+#include "HashIndex.h"
 #include "LinkedListHolder.h"
 #include "Object.h"
 #include "Reference.h"
 #include "ReferenceContainerFilter.h"
 #include "ReferenceContainerNode.h"
 #include "TimeoutType.h"
+#include "WyHashFunction.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -50,11 +52,21 @@ namespace MARTe {
  * lint -esym(551, MARTe::REFERENCE_CONTAINER_NUMBER_OF_TOKENS) the symbol is used to define the size of the token arrays
  */
 const uint32 REFERENCE_CONTAINER_NUMBER_OF_TOKENS = 5u;
+/**
+ * Number of elements from which the names of the elements of a container are indexed with an hash table (smaller
+ * containers are searched linearly).
+ */
+const uint32 REFERENCE_CONTAINER_INDEX_THRESHOLD = 8u;
 /**
  * @brief Container of references.
  * @details One of the basilar classes of the framework. Linear container of references which may also
  * include other containers of references (generating a tree). The access to the container is protected
- * by an internal FastPollingMutexSem whose timeout can be specified.
+ * by an internal FastPollingReadWriteSem (concurrent searches, exclusive changes) whose timeout can be specified.
+ *
+ * The elements of containers with at least REFERENCE_CONTAINER_INDEX_THRESHOLD elements are indexed by name in an hash table,
+ * built on the first search by path (see Find(const char8 * const, const bool)) and then kept up to date by Insert and Delete,
+ * so that a path is resolved in O(depth) instead of O(depth x elements). The index is rebuilt if an Object is renamed
+ * (see Object::GetNamesVersion).
  */
 /*lint -e{9109} forward declaration in ReferenceContainerFilter.h is required to define the class*/
 /*lint -e{763} forward declaration in ReferenceContainerFilter.h is required to define the class*/
@@ -140,6 +152,8 @@ ReferenceContainer    ();
 
     /**
      * @brief Finds the first element identified by \a path in RECURSIVE mode.
+     * @details If not \a recursive and the names in the path are unique in their containers, the path is resolved with the
+     * name index of each container. Otherwise the containers are walked with a ReferenceContainerFilterObjectName.
      * @param[in] path is the name of the element to be found or its full path.
      * @param[in] recursive is the flag for recursive search
      * @return the element if it is found or an invalid reference if not.
@@ -159,8 +173,18 @@ ReferenceContainer    ();
      */
     uint32 Size();
 
+    /**
+     * @brief Returns a counter which is incremented every time that a Reference is inserted in or removed from this container.
+     * @details Allows caches of the contents of the container (e.g. the serialisations of HttpObjectBrowser) to detect that they are stale.
+     * Changes in the children of the elements are not taken into account.
+     * @return the number of insertions and removals in this container.
+     */
+    uint32 GetChildrenVersion() const;
+
     /**
      * @brief Returns the reference at position \a idx.
+     * @details Large containers keep an array of their nodes (rebuilt after an element is removed or inserted in the middle), so that
+     * iterating with Get is linear in the number of elements.
      * @param[in] idx the desired reference position.
      * @return the Reference at position \a idx or an empty Reference if \a idx < 0 or \a idx >  Size().
      */
@@ -204,6 +228,18 @@ ReferenceContainer    ();
      */
     void UnLock();
 
+    /**
+     * @brief Locks the internal spin-lock mutex in shared mode (i.e. concurrently with other readers, but not with Lock).
+     * @details Get, Size, FindChild and Find (unless the filter removes the found elements) only take the shared lock.
+     * @return true if the lock succeeds.
+     */
+    bool ReadLock();
+
+    /**
+     * @brief Unlocks the shared lock taken with ReadLock.
+     */
+    void ReadUnLock();
+
     /**
      * @brief Removes all the elements from the container and destroys any cyclic links.
      * @details This function destroys each element of the container also in case of reference loops (the father contains a reference to the children and the
@@ -235,6 +271,14 @@ ReferenceContainer    ();
      */
     virtual bool IsReferenceContainer() const;
 
+    /**
+     * @brief Returns a counter which is incremented every time that a Reference is removed from any ReferenceContainer
+     * or is inserted in a given position (i.e. the changes that may modify the result of a previous search by path).
+     * @details Allows caches of the results of Find (see ObjectRegistryDatabase) to detect that they may be stale.
+     * @return the number of these changes.
+     */
+    static uint32 GetTreeVersion();
+
     /**
      * @brief Checks if the input token is one of the tokens that force the creation of a new Object.
      * @param[in] token the token to verify.
@@ -286,6 +330,11 @@ private:
      */
     static char8 domainTokensList[REFERENCE_CONTAINER_NUMBER_OF_TOKENS];
 
+    /**
+     * Incremented by the changes listed in GetTreeVersion.
+     */
+    static volatile int32 treeVersion;
+
     /**
      * @brief Checks if the input token is one of the tokens in the input token list.
      * @param[in] tokenList the token list to verify.
@@ -312,13 +361,113 @@ private:
     /**
      * The list of references
      */
+    /**
+     * @brief Finds the elements with a given name.
+     * @param[in] name the name (not necessarily zero terminated).
+     * @param[in] nameSize the number of characters in \a name.
+     * @param[out] child the first element with this name (if there is exactly one).
+     * @return the number of elements with this name: 0, 1 or 2 (which means more than one).
+     */
+    uint32 FindChild(const char8 * const name, const uint32 nameSize, Reference &child);
+
+    /**
+     * @brief Resolves \a path with FindChild at each level.
+     * @param[in] path the path as in Find(const char8 * const, const bool).
+     * @param[out] ret the element found (invalid if not found).
+     * @return false if some name in the path is not unique in its container (and thus ReferenceContainerFilterObjectName has to be used).
+     */
+    bool FindPath(const char8 * const path, Reference &ret);
+
+    /**
+     * @brief Builds (or rebuilds) the name index with all the elements.
+     * @pre Lock() was called.
+     */
+    void IndexBuild();
+
+    /**
+     * @brief Adds a node just inserted in the list to the name index (if any).
+     * @pre Lock() was called.
+     */
+    void IndexAdd(ReferenceContainerNode * const node);
+
+    /**
+     * @brief Removes a node about to be deleted from the list from the name index (if any).
+     * @pre Lock() was called.
+     */
+    void IndexRemove(ReferenceContainerNode * const node);
+
+    /**
+     * @brief Checks if the list is large enough to be indexed and the name index is not built or out of date.
+     * @pre Lock() or ReadLock() was called.
+     * @return true if the name index has to be (re)built before being searched.
+     */
+    bool IndexIsStale() const;
+
+    /**
+     * @brief Destroys the name index (to be built again on the next search).
+     */
+    void IndexReset();
+
+    /**
+     * @brief Builds (or rebuilds) the array of the nodes by position.
+     * @pre Lock() was called.
+     */
+    void PositionsBuild();
+
+    /**
+     * @brief Checks if the node at position \a idx is better found in the array of the nodes by position but the array is not built or out of date.
+     * @pre Lock() or ReadLock() was called.
+     * @return true if the array has to be (re)built before getting the node at \a idx.
+     */
+    bool PositionsAreStale(const uint32 idx) const;
+
+    /**
+     * @brief Gets the node at position \a idx, from the array of the nodes by position if it is up to date or walking the list otherwise.
+     * @pre Lock() or ReadLock() was called and idx < list.ListSize().
+     */
+    ReferenceContainerNode *PeekNode(const uint32 idx);
+
     LinkedListHolderT<ReferenceContainerNode> list;
 
+    /**
+     * Hash table from the names to the nodes of list.
+     */
+    typedef HashIndex<ReferenceContainerNode *, WyHashFunction> NameIndex;
+
+    /**
+     * Index of the nodes of list by name (NULL until built).
+     */
+    NameIndex *nameIndex;
+
+    /**
+     * The Object::GetNamesVersion() when nameIndex was built.
+     */
+    uint32 nameIndexVersion;
+
+    /**
+     * The nodes of list by position (NULL until built).
+     */
+    ReferenceContainerNode **positions;
+
+    /**
+     * The number of elements allocated in positions.
+     */
+    uint32 positionsCapacity;
+
+    /**
+     * The childrenVersion when positions was last updated.
+     */
+    uint32 positionsVersion;
+
+    /**
+     * Incremented by the changes listed in GetChildrenVersion.
+     */
+    uint32 childrenVersion;
     
     /**
      * Protects multiple access to the internal resources
      */
-    FastPollingMutexSem mux;
+    FastPollingReadWriteSem mux;
 
     /**
      * Timeout
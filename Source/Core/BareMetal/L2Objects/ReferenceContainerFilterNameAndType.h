@@ -34,7 +34,7 @@
 
 #include "ReferenceContainerFilterObjectName.h"
 #include "ReferenceContainer.h"
-#include "StringHelper.h"
+#include "InternedStringTable.h"
 #include "ErrorManagement.h"
 #include "ReferenceT.h"
 /*---------------------------------------------------------------------------*/
@@ -157,7 +157,8 @@ bool ReferenceContainerFilterNameAndType<T>::Test(ReferenceContainer &previously
             found = false;
             for (uint32 i = 0u; (i < currentIndex) && (ok); i++) {
                 Reference ref = previouslyFound.Get(i);
-                ok = (StringHelper::Compare(ref->GetName(), addressToSearch[i]) == 0);
+                //Both names are interned
+                ok = (ref->GetName() == addressToSearch[i]);
                 if (ok) {
                     ReferenceT<T> reft = ref;
                     if (reft.IsValid()) {
@@ -166,17 +167,17 @@ bool ReferenceContainerFilterNameAndType<T>::Test(ReferenceContainer &previously
                     }
                 }
                 //add the '.'
-                nodeStrIndex += (StringHelper::Length(addressToSearch[i]) + 1u);
+                nodeStrIndex += (InternedStringTable::GetLength(addressToSearch[i]) + 1u);
             }
             if (!found) {
                 //test the last one
-                found = (StringHelper::Compare(referenceToTest->GetName(), addressToSearch[currentIndex]) == 0);
+                found = (referenceToTest->GetName() == addressToSearch[currentIndex]);
                 if (found) {
                     ReferenceT<T> reft = referenceToTest;
                     found = reft.IsValid();
                 }
                 if (found) {
-                    nodeStrIndex += StringHelper::Length(addressToSearch[currentIndex]);
+                    nodeStrIndex += InternedStringTable::GetLength(addressToSearch[currentIndex]);
 
                     if (currentIndex < (addressNumberNodes - 1u)) {
                         nodeStrIndex++;
@@ -188,13 +189,13 @@ bool ReferenceContainerFilterNameAndType<T>::Test(ReferenceContainer &previously
     }
     else {
         //test the last one
-        found = (StringHelper::Compare(referenceToTest->GetName(), addressToSearch[0]) == 0);
+        found = (referenceToTest->GetName() == addressToSearch[0]);
         if (found) {
             ReferenceT<T> reft = referenceToTest;
             found = reft.IsValid();
         }
         if (found) {
-            nodeStrIndex = StringHelper::Length(addressToSearch[0]);
+            nodeStrIndex = InternedStringTable::GetLength(addressToSearch[0]);
         }
     }
 
@@ -31,8 +31,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
-#include "HeapManager.h"
-#include "MemoryOperationsHelper.h"
+#include "InternedStringTable.h"
 #include "StringHelper.h"
 #include "ReferenceContainerFilterObjectName.h"
 
@@ -49,7 +48,7 @@ namespace MARTe {
 ReferenceContainerFilterObjectName::ReferenceContainerFilterObjectName() :
         ReferenceContainerFilter() {
     addressNumberNodes = 0u;
-    addressToSearch = static_cast<char8 **>(NULL);
+    addressToSearch = static_cast<const char8 **>(NULL);
 }
 
 /*lint -e{929} -e{925} the current implementation of the ReferenceContainerFilterObjects requires pointer to pointer casting*/
@@ -57,7 +56,7 @@ ReferenceContainerFilterObjectName::ReferenceContainerFilterObjectName(const int
         ReferenceContainerFilter(occurrenceNumber, modeToSet) {
 
     addressNumberNodes = 0u;
-    addressToSearch = static_cast<char8 **>(NULL);
+    addressToSearch = static_cast<const char8 **>(NULL);
     /*lint -e{1506} the caller must know that the address pointer shall be valid while the class is to be used*/
     SetAddress(address);
 }
@@ -65,7 +64,7 @@ ReferenceContainerFilterObjectName::ReferenceContainerFilterObjectName(const int
 /*lint -e{929} -e{925} -e{9007} the current implementation of the ReferenceContainerFilterObjects requires pointer to pointer casting*/
 void ReferenceContainerFilterObjectName::SetAddress(const char8 * const address) {
     const char8 *lastOccurrence = address;
-    addressToSearch = static_cast<char8 **>(NULL);
+    addressToSearch = static_cast<const char8 **>(NULL);
 
     if (address != NULL) {
         //Count the number of dots found. The first and last dot are ignored. Two consecutive dots result
@@ -107,14 +106,16 @@ void ReferenceContainerFilterObjectName::SetAddress(const char8 * const address)
 
         if (addressNumberNodes > 0u) {
             //create an array of strings for nodes
-            addressToSearch = new char8*[addressNumberNodes];
+            addressToSearch = new const char8*[addressNumberNodes];
             lastOccurrence = &address[startIn];
 
             for (uint32 i = 0u; i < addressNumberNodes; i++) {
-                uint32 strLength = static_cast<uint32>(StringHelper::SearchIndex(&lastOccurrence[0], "."));
-                addressToSearch[i] = static_cast<char8 *>(HeapManager::Malloc(strLength + 1u));
-                lastOccurrence = StringHelper::TokenizeByChars(lastOccurrence, ".", addressToSearch[i]);
-
+                //No empty nodes (i.e. consecutive dots) at this point
+                uint32 strLength = StringHelper::ComponentLength(lastOccurrence, '.');
+                addressToSearch[i] = InternedStringTable::Instance()->Intern(lastOccurrence, strLength);
+                if ((i + 1u) < addressNumberNodes) {
+                    lastOccurrence = &lastOccurrence[strLength + 1u];
+                }
             }
         }
     }
@@ -133,15 +134,12 @@ void ReferenceContainerFilterObjectName::SetAddress(const char8 * const address)
 /*lint -e{929} -e{925} the current implementation of the ReferenceContainerFilterObjects requires pointer to pointer casting*/
 ReferenceContainerFilterObjectName::ReferenceContainerFilterObjectName(const ReferenceContainerFilterObjectName& other) :
         ReferenceContainerFilter(other) {
-    addressToSearch = static_cast<char8 **>(NULL);
+    addressToSearch = static_cast<const char8 **>(NULL);
     addressNumberNodes = other.addressNumberNodes;
     if (addressNumberNodes > 0u) {
-        addressToSearch = new char8*[addressNumberNodes];
+        addressToSearch = new const char8*[addressNumberNodes];
         for (uint32 i = 0u; i < addressNumberNodes; i++) {
-            uint32 length = StringHelper::Length(other.addressToSearch[i]) + 1u;
-            addressToSearch[i] = static_cast<char8 *>(HeapManager::Malloc(length));
-            /*lint -e{534} possible failure is not handled nor propagated.*/
-            MemoryOperationsHelper::Copy(addressToSearch[i], other.addressToSearch[i], length);
+            addressToSearch[i] = InternedStringTable::Instance()->Share(other.addressToSearch[i]);
         }
     }
     Reset();
@@ -153,11 +151,7 @@ ReferenceContainerFilterObjectName &ReferenceContainerFilterObjectName::operator
         if (addressNumberNodes > 0u) {
 
             for (uint32 i = 0u; i < addressNumberNodes; i++) {
-                bool ok = HeapManager::Free(reinterpret_cast<void *&>(addressToSearch[i]));
-                if (!ok) {
-                    REPORT_ERROR_STATIC_0(ErrorManagement::FatalError,
-                                          "ReferenceContainerFilterObjectName: Failed HeapManager::Free()");
-                }
+                InternedStringTable::Instance()->Release(addressToSearch[i]);
             }
         }
 
@@ -168,12 +162,9 @@ ReferenceContainerFilterObjectName &ReferenceContainerFilterObjectName::operator
         SetMode(other.GetMode());
         addressNumberNodes = other.addressNumberNodes;
         if (addressNumberNodes > 0u) {
-            addressToSearch = new char8*[addressNumberNodes];
+            addressToSearch = new const char8*[addressNumberNodes];
             for (uint32 i = 0u; i < addressNumberNodes; i++) {
-                uint32 length = StringHelper::Length(other.addressToSearch[i]) + 1u;
-                addressToSearch[i] = static_cast<char8 *>(HeapManager::Malloc(length));
-                /*lint -e{534} possible failure is not handled nor propagated.*/
-                MemoryOperationsHelper::Copy(addressToSearch[i], other.addressToSearch[i], length);
+                addressToSearch[i] = InternedStringTable::Instance()->Share(other.addressToSearch[i]);
             }
         }
     }
@@ -187,11 +178,7 @@ ReferenceContainerFilterObjectName::~ReferenceContainerFilterObjectName() {
     if (addressNumberNodes > 0u) {
 
         for (uint32 i = 0u; i < addressNumberNodes; i++) {
-            bool ok = HeapManager::Free(reinterpret_cast<void *&>(addressToSearch[i]));
-            if (!ok) {
-                REPORT_ERROR_STATIC_0(ErrorManagement::FatalError,
-                                      "ReferenceContainerFilterObjectName: Failed HeapManager::Free()");
-            }
+            InternedStringTable::Instance()->Release(addressToSearch[i]);
         }
         delete[] addressToSearch;
     }
@@ -204,9 +191,8 @@ bool ReferenceContainerFilterObjectName::TestPath(ReferenceContainer &previously
     for (uint32 i = 0u; (i < previouslyFound.Size()) && (found); i++) {
         found = false;
         if (previouslyFound.Get(static_cast<uint32>(i)).IsValid()) {
-            if (previouslyFound.Get(static_cast<uint32>(i))->GetName() != NULL) {
-                found = (StringHelper::Compare(previouslyFound.Get(static_cast<uint32>(i))->GetName(), addressToSearch[i]) == 0);
-            }
+            //Both names are interned
+            found = (previouslyFound.Get(static_cast<uint32>(i))->GetName() == addressToSearch[i]);
         }
     }
     return found;
@@ -228,7 +214,8 @@ bool ReferenceContainerFilterObjectName::Test(ReferenceContainer &previouslyFoun
 
         found = (index < addressNumberNodes);
         if (found) {
-            found = (StringHelper::Compare(referenceToTest->GetName(), addressToSearch[index]) == 0);
+            //Both names are interned
+            found = (referenceToTest->GetName() == addressToSearch[index]);
         }
 
         if (found) {
@@ -109,9 +109,10 @@ public:
 protected:
 
     /**
-     * Broken-down list of the address to search.
+     * Broken-down list of the address to search. The nodes are interned (see InternedStringTable), so that
+     * they are compared with the (interned) object names by pointer.
      */
-    char8 **addressToSearch;
+    const char8 **addressToSearch;
 
     /**
      * Number of nodes in the address.
@@ -55,7 +55,7 @@ Reference const & ReferenceContainerNode::GetReference() const {
 }
 
 bool ReferenceContainerNode::SetReference(Reference newReference) {
-    reference = newReference;
+    reference = MARTe2_MOVE(newReference);
     return reference.IsValid();
 }
 
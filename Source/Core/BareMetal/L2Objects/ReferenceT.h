@@ -85,6 +85,20 @@ public:
      */
     ReferenceT(const ReferenceT<T>& sourceReference);
 
+#ifdef MARTe2_CXX11
+    /**
+     * @brief Creates a ReferenceT taking the object of \a sourceReference (without changing its number of references).
+     * @param[in] sourceReference the reference to be moved. It is left invalid.
+     */
+    ReferenceT(ReferenceT<T>&& sourceReference);
+
+    /**
+     * @brief Creates a ReferenceT taking the object of \a sourceReference if it is compatible with T.
+     * @param[in] sourceReference the reference to be moved. It is left invalid, unless its object is not compatible with T.
+     */
+    ReferenceT(Reference&& sourceReference);
+#endif
+
     /**
      * @brief Instantiates a new object of type \a typeName and links a reference to it.
      * @details If the operation succeeds a reference to the new object is created,
@@ -129,6 +143,24 @@ public:
      */
     virtual ReferenceT<T>& operator=(const Reference& sourceReference);
 
+#ifdef MARTe2_CXX11
+    /**
+     * @brief Move assignment operator.
+     * @param[in] sourceReference the source reference to be moved to this reference. It is left invalid.
+     * @return a reference to the object referenced by \a sourceReference.
+     */
+    ReferenceT<T>& operator=(ReferenceT<T>&& sourceReference);
+
+    /**
+     * @brief Move assignment operator.
+     * @details This reference will be referencing the object of \a sourceReference if it is compatible with T.
+     * @param[in] sourceReference the source reference to be moved to this reference. It is left invalid, unless its object
+     * is not compatible with T.
+     * @return a reference to the object referenced by \a sourceReference.
+     */
+    virtual ReferenceT<T>& operator=(Reference&& sourceReference);
+#endif
+
     /**
      * @brief Verifies if this Reference links to the same object of \a sourceReference.
      * @param[in] sourceReference reference to be compared.
@@ -251,6 +283,53 @@ ReferenceT<T>& ReferenceT<T>::operator=(const Reference& sourceReference) {
     return *this;
 }
 
+#ifdef MARTe2_CXX11
+/*lint -e{1566} Init function initializes members */
+template<typename T>
+ReferenceT<T>::ReferenceT(ReferenceT<T>&& sourceReference) :
+        Reference() {
+    Init();
+    (*this) = static_cast<ReferenceT<T>&&>(sourceReference);
+}
+
+/*lint -e{1566} Init function initializes members */
+template<typename T>
+ReferenceT<T>::ReferenceT(Reference&& sourceReference) :
+        Reference() {
+    Init();
+    (*this) = static_cast<Reference&&>(sourceReference);
+}
+
+template<typename T>
+ReferenceT<T>& ReferenceT<T>::operator=(ReferenceT<T>&& sourceReference) {
+    if (this != &sourceReference) {
+        //Read before being cleared by the move
+        T *p = sourceReference.typeTObjectPointer;
+        RemoveReference();
+        Reference::operator=(static_cast<Reference&&>(sourceReference));
+        if (objectPointer != NULL) {
+            typeTObjectPointer = p;
+        }
+    }
+    return *this;
+}
+
+template<typename T>
+ReferenceT<T>& ReferenceT<T>::operator=(Reference&& sourceReference) {
+    //Reference::operator& is private. Referring to the same object also covers the self move.
+    T *p = dynamic_cast<T*>(sourceReference.operator->());
+    if (p != typeTObjectPointer) {
+        RemoveReference();
+        if (p != NULL) {
+            Reference::operator=(static_cast<Reference&&>(sourceReference));
+            typeTObjectPointer = p;
+        }
+    }
+
+    return *this;
+}
+#endif
+
 template<typename T>
 T* ReferenceT<T>::operator->() const {
     return typeTObjectPointer;
@@ -34,6 +34,8 @@
 #include "ClassProperties.h"
 #include "CompilerTypes.h"
 #include "ErrorManagement.h"
+#include "CompiledErrorReport.h"
+#include "CompiledFormat.h"
 #include "StreamMemoryReference.h"
 
 /*---------------------------------------------------------------------------*/
@@ -60,15 +62,37 @@ do {                                                                        \
 } while(false) /*lint -restore */ //Protect scope with the {} and force to end with ;
 /**
  * @brief The REPORT_ERROR_STATIC_MACRO_CHOOSER will call this function for any call to REPORT_ERROR_STATIC that has more than two parameters (the first two being the log code and the message)
+ * @details The message is compiled once per call site (see CompiledFormat) so that
+ * repeated reports do not parse the format again. Compiled messages are reported with
+ * ErrorManagement::ReportErrorCompiled, which may defer the formatting to the logger thread.
+ * The reports of each call site are filtered (see ErrorManagement::SetReportMask and
+ * ClassRegistryItem::SetReportMask) and rate limited (see ErrorManagement::SetReportRateLimit) before
+ * the parameters are evaluated and the message is formatted.
  */
 #define REPORT_ERROR_STATIC_PARAMETERS(code, message,...)                              \
 /*lint -save -e717 Let lint know that we know that we are doing while(0)*/             \
 do {                                                                                   \
-    MARTe::char8 buffer[MARTe::MAX_ERROR_MESSAGE_SIZE+1u];                             \
-    MARTe::StreamMemoryReference smr(&buffer[0],MARTe::MAX_ERROR_MESSAGE_SIZE);        \
-    (void) (smr.Printf(reinterpret_cast<const MARTe::char8 *>(message),__VA_ARGS__));  \
-    buffer[smr.Size()]='\0';                                                           \
-    MARTe::ErrorManagement::ReportError(code,&buffer[0], NULL_PTR(const MARTe::char8* ), NULL_PTR(const MARTe::char8* ), NULL_PTR(const void* ), __FILE__,__LINE__,__ERROR_FUNCTION_NAME__); \
+    if (MARTe::ErrorManagement::IsReportEnabled(code)) {                               \
+        static MARTe::ErrorManagement::ReportRateLimiter reportRateLimiter;            \
+        MARTe::uint32 reportSuppressed;                                                \
+        if (reportRateLimiter.Allow(code, reportSuppressed)) {                         \
+            static MARTe::CompiledFormat compiledMessage;                              \
+            const MARTe::char8 * const reportedFormat = reinterpret_cast<const MARTe::char8 *>(message); \
+            if (compiledMessage.CompileOnce(reportedFormat)) {                         \
+                MARTe::ErrorManagement::ReportErrorCompiled(code, compiledMessage, NULL_PTR(const MARTe::char8* ), NULL_PTR(const MARTe::char8* ), NULL_PTR(const void* ), __FILE__,__LINE__,__ERROR_FUNCTION_NAME__, __VA_ARGS__); \
+            }                                                                          \
+            else {                                                                     \
+                MARTe::char8 buffer[MARTe::MAX_ERROR_MESSAGE_SIZE+1u];                 \
+                MARTe::StreamMemoryReference smr(&buffer[0],MARTe::MAX_ERROR_MESSAGE_SIZE); \
+                (void) (smr.Printf(reportedFormat,__VA_ARGS__));                       \
+                buffer[smr.Size()]='\0';                                               \
+                MARTe::ErrorManagement::ReportError(code,&buffer[0], NULL_PTR(const MARTe::char8* ), NULL_PTR(const MARTe::char8* ), NULL_PTR(const void* ), __FILE__,__LINE__,__ERROR_FUNCTION_NAME__); \
+            }                                                                          \
+            if (reportSuppressed > 0u) {                                               \
+                MARTe::ErrorManagement::ReportSuppressed(code, reportSuppressed, NULL_PTR(const MARTe::char8* ), NULL_PTR(const MARTe::char8* ), NULL_PTR(const void* ), __FILE__,__LINE__,__ERROR_FUNCTION_NAME__); \
+            }                                                                          \
+        }                                                                              \
+    }                                                                                  \
 } while(false) /*lint -restore */ //Protect scope with the {} and force to end with ;
 
 /**
@@ -102,32 +126,67 @@ do {                                                                        \
 /**
  * @brief The REPORT_ERROR_MACRO_CHOOSER will call this function for any call to REPORT_ERROR that has two and only two parameters (the log code and the message)
  */
-#define REPORT_ERROR_0(code, message)                                       \
-/*lint -save -e717 Let lint know that we know that we are doing while(0)*/  \
-do {                                                                        \
-    const MARTe::char8 *pClassName = "Unknown";                             \
-    const MARTe::ClassProperties *cProperties = GetClassProperties();       \
-    if (cProperties != NULL_PTR(const MARTe::ClassProperties *)) {          \
-        pClassName = cProperties->GetName();                                \
-    }                                                                       \
-    MARTe::ErrorManagement::ReportError(code, message, pClassName, GetName(), this, __FILE__,__LINE__,__ERROR_FUNCTION_NAME__); \
+#define REPORT_ERROR_0(code, message)                                                  \
+/*lint -save -e717 Let lint know that we know that we are doing while(0)*/             \
+do {                                                                                   \
+    if (MARTe::ErrorManagement::IsReportEnabled(code)) {                               \
+        const MARTe::char8 *pClassName = "Unknown";                                    \
+        bool classReportEnabled = true;                                                \
+        const MARTe::ClassProperties *cProperties = GetClassProperties();              \
+        if (cProperties != NULL_PTR(const MARTe::ClassProperties *)) {                 \
+            pClassName = cProperties->GetName();                                       \
+            classReportEnabled = cProperties->IsReportEnabled(code);                   \
+        }                                                                              \
+        static MARTe::ErrorManagement::ReportRateLimiter reportRateLimiter;            \
+        MARTe::uint32 reportSuppressed;                                                \
+        if ((classReportEnabled) && (reportRateLimiter.Allow(code, reportSuppressed))) { \
+            MARTe::ErrorManagement::ReportError(code, message, pClassName, GetName(), this, __FILE__,__LINE__,__ERROR_FUNCTION_NAME__); \
+            if (reportSuppressed > 0u) {                                               \
+                MARTe::ErrorManagement::ReportSuppressed(code, reportSuppressed, pClassName, GetName(), this, __FILE__,__LINE__,__ERROR_FUNCTION_NAME__); \
+            }                                                                          \
+        }                                                                              \
+    }                                                                                  \
 } while(false) /*lint -restore */ //Protect scope with the {} and force to end with ;
 /**
  * @brief The REPORT_ERROR_MACRO_CHOOSER will call this function for any call to REPORT_ERROR that has more than two parameters (the first two being the log code and the message)
+ * @details The message is compiled once per call site (see CompiledFormat) so that
+ * repeated reports do not parse the format again. Compiled messages are reported with
+ * ErrorManagement::ReportErrorCompiled, which may defer the formatting to the logger thread.
+ * The reports of each call site are filtered (see ErrorManagement::SetReportMask and
+ * ClassRegistryItem::SetReportMask) and rate limited (see ErrorManagement::SetReportRateLimit) before
+ * the parameters are evaluated and the message is formatted.
  */
 #define REPORT_ERROR_PARAMETERS(code, message,...)                                     \
 /*lint -save -e717 Let lint know that we know that we are doing while(0)*/             \
 do {                                                                                   \
-    MARTe::char8 buffer[MARTe::MAX_ERROR_MESSAGE_SIZE+1u];                             \
-    MARTe::StreamMemoryReference smr(&buffer[0],MARTe::MAX_ERROR_MESSAGE_SIZE);        \
-    (void) (smr.Printf(reinterpret_cast<const MARTe::char8 *>(message),__VA_ARGS__));  \
-    buffer[smr.Size()]='\0';                                                           \
-    const MARTe::char8 *pClassName = "Unknown";                                        \
-    const MARTe::ClassProperties *cProperties = GetClassProperties();                  \
-    if (cProperties != NULL_PTR(const MARTe::ClassProperties *)) {                     \
-        pClassName = cProperties->GetName();                                           \
+    if (MARTe::ErrorManagement::IsReportEnabled(code)) {                               \
+        const MARTe::char8 *pClassName = "Unknown";                                    \
+        bool classReportEnabled = true;                                                \
+        const MARTe::ClassProperties *cProperties = GetClassProperties();              \
+        if (cProperties != NULL_PTR(const MARTe::ClassProperties *)) {                 \
+            pClassName = cProperties->GetName();                                       \
+            classReportEnabled = cProperties->IsReportEnabled(code);                   \
+        }                                                                              \
+        static MARTe::ErrorManagement::ReportRateLimiter reportRateLimiter;            \
+        MARTe::uint32 reportSuppressed;                                                \
+        if ((classReportEnabled) && (reportRateLimiter.Allow(code, reportSuppressed))) { \
+            static MARTe::CompiledFormat compiledMessage;                              \
+            const MARTe::char8 * const reportedFormat = reinterpret_cast<const MARTe::char8 *>(message); \
+            if (compiledMessage.CompileOnce(reportedFormat)) {                         \
+                MARTe::ErrorManagement::ReportErrorCompiled(code, compiledMessage, pClassName, GetName(), this, __FILE__,__LINE__,__ERROR_FUNCTION_NAME__, __VA_ARGS__); \
+            }                                                                          \
+            else {                                                                     \
+                MARTe::char8 buffer[MARTe::MAX_ERROR_MESSAGE_SIZE+1u];                 \
+                MARTe::StreamMemoryReference smr(&buffer[0],MARTe::MAX_ERROR_MESSAGE_SIZE); \
+                (void) (smr.Printf(reportedFormat,__VA_ARGS__));                       \
+                buffer[smr.Size()]='\0';                                               \
+                MARTe::ErrorManagement::ReportError(code, &buffer[0], pClassName, GetName(), this, __FILE__,__LINE__,__ERROR_FUNCTION_NAME__); \
+            }                                                                          \
+            if (reportSuppressed > 0u) {                                               \
+                MARTe::ErrorManagement::ReportSuppressed(code, reportSuppressed, pClassName, GetName(), this, __FILE__,__LINE__,__ERROR_FUNCTION_NAME__); \
+            }                                                                          \
+        }                                                                              \
     }                                                                                  \
-    MARTe::ErrorManagement::ReportError(code, &buffer[0], pClassName, GetName(), this, __FILE__,__LINE__,__ERROR_FUNCTION_NAME__); \
 } while(false) /*lint -restore */ //Protect scope with the {} and force to end with ;
 
 /**
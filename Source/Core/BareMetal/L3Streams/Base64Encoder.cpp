@@ -25,6 +25,10 @@
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
 
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
@@ -65,6 +69,12 @@ public:
 
 const char8 * const Base64Codec::base64Alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/=";
 
+/**
+ * Number of groups of three bytes (four characters) encoded or decoded in each block.
+ * The blocks are written on the output stream with a single Write.
+ */
+static const uint32 BASE64_BLOCK_GROUPS = 1024u;
+
 Base64Codec::Base64Codec() {
     for (uint32 i = 0u; i < 256u; i++) {
         decodingTable[i] = 0xFFu;
@@ -79,66 +89,163 @@ Base64Codec::Base64Codec() {
 Base64Codec::~Base64Codec() {
 }
 
-bool Encode(StreamString &input,
-            StreamString &output) {
+/**
+ * @brief Writes \a size bytes on \a output.
+ * @return true if all the bytes were written.
+ */
+static bool Base64Write(StreamI &output,
+                        const char8 * const buffer,
+                        const uint32 size) {
+    uint32 writeSize = size;
+    bool ret = output.Write(buffer, writeSize);
+    if (ret) {
+        ret = (writeSize == size);
+    }
+    return ret;
+}
 
-    int32 size = static_cast<int32>(input.Size());
-    const uint8 *in = reinterpret_cast<const uint8 *>(input.Buffer());
-    output = "";
-    uint32 word = 0u;
-    uint32 code;
-    while (size > 0) {
-        word = in[0];
-        code = (word >> 2u);
-        word &= 0x3u;
-        output += Base64Codec::base64Alphabet[code];
-        if (size > 1) {
-            word <<= 8u;
-            word |= in[1];
-            code = (word >> 4u);
-            word &= 0xFu;
-            output += Base64Codec::base64Alphabet[code];
-            if (size > 2) {
-                word <<= 8u;
-                word |= in[2];
-                code = word;
-                word &= 0x3Fu;
-                code >>= 6u;
-                output += Base64Codec::base64Alphabet[code];
-                output += Base64Codec::base64Alphabet[word];
-            }
-            else { // 4 bits available
-                word <<= 2u;
-                output += Base64Codec::base64Alphabet[word];
-                output += "=";
-            }
-        }
-        else { // 2 bits available
-            word <<= 4u;
-            output += Base64Codec::base64Alphabet[word];
-            output += "==";
-        }
-        size -= 3;
+/**
+ * @brief Encodes \a numberOfGroups groups of three bytes into four characters each.
+ */
+static void Base64EncodeGroups(const uint8 *in,
+                               uint32 numberOfGroups,
+                               char8 *out) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    //16 groups per iteration: the 48 bytes are de-interleaved in three vectors, the 6 bit indexes are
+    //looked up (tbl) in the alphabet (four vectors) and the four vectors of characters are interleaved back.
+    const uint8 *alphabet = reinterpret_cast<const uint8 *>(Base64Codec::base64Alphabet);
+    uint8x16x4_t alphabetTable;
+    alphabetTable.val[0] = vld1q_u8(&alphabet[0]);
+    alphabetTable.val[1] = vld1q_u8(&alphabet[16]);
+    alphabetTable.val[2] = vld1q_u8(&alphabet[32]);
+    alphabetTable.val[3] = vld1q_u8(&alphabet[48]);
+    const uint8x16_t mask = vdupq_n_u8(0x3Fu);
+    while (numberOfGroups >= 16u) {
+        uint8x16x3_t bytes = vld3q_u8(in);
+        uint8x16x4_t indexes;
+        indexes.val[0] = vshrq_n_u8(bytes.val[0], 2);
+        indexes.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[0], 4), vshrq_n_u8(bytes.val[1], 4)), mask);
+        indexes.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[1], 2), vshrq_n_u8(bytes.val[2], 6)), mask);
+        indexes.val[3] = vandq_u8(bytes.val[2], mask);
+        uint8x16x4_t characters;
+        characters.val[0] = vqtbl4q_u8(alphabetTable, indexes.val[0]);
+        characters.val[1] = vqtbl4q_u8(alphabetTable, indexes.val[1]);
+        characters.val[2] = vqtbl4q_u8(alphabetTable, indexes.val[2]);
+        characters.val[3] = vqtbl4q_u8(alphabetTable, indexes.val[3]);
+        vst4q_u8(reinterpret_cast<uint8 *>(out), characters);
+        in = &in[48];
+        out = &out[64];
+        numberOfGroups -= 16u;
+    }
+#endif
+    while (numberOfGroups > 0u) {
+        uint32 word = (static_cast<uint32>(in[0]) << 16u) | (static_cast<uint32>(in[1]) << 8u) | static_cast<uint32>(in[2]);
+        out[0] = Base64Codec::base64Alphabet[(word >> 18u) & 0x3Fu];
+        out[1] = Base64Codec::base64Alphabet[(word >> 12u) & 0x3Fu];
+        out[2] = Base64Codec::base64Alphabet[(word >> 6u) & 0x3Fu];
+        out[3] = Base64Codec::base64Alphabet[word & 0x3Fu];
         in = &in[3];
+        out = &out[4];
+        numberOfGroups--;
     }
-
-    return true;
 }
 
-bool Decode(StreamString &input,
-            StreamString &output) {
+/**
+ * @brief Decodes groups of four characters into three bytes each, until the first group with a padding
+ * or an invalid character.
+ * @return the number of groups decoded.
+ */
+static uint32 Base64DecodeGroups(const uint8 *in,
+                                 const uint32 numberOfGroups,
+                                 uint8 *out) {
+    uint32 decoded = 0u;
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    //16 groups per iteration: the characters below 128 are looked up (tbl) in the two halves of the
+    //decoding table (the indexes out of a table give 0). The padding and the invalid characters have
+    //the most significant bit set either in the character or in the table.
+    uint8x16x4_t lowTable;
+    uint8x16x4_t highTable;
+    uint32 t;
+    for (t = 0u; t < 4u; t++) {
+        lowTable.val[t] = vld1q_u8(&base64Codec.decodingTable[16u * t]);
+        highTable.val[t] = vld1q_u8(&base64Codec.decodingTable[64u + (16u * t)]);
+    }
+    const uint8x16_t highOffset = vdupq_n_u8(64u);
+    bool vectorValid = true;
+    while (((numberOfGroups - decoded) >= 16u) && (vectorValid)) {
+        uint8x16x4_t characters = vld4q_u8(in);
+        uint8x16x4_t keys;
+        uint8x16_t invalid = vdupq_n_u8(0u);
+        for (t = 0u; t < 4u; t++) {
+            keys.val[t] = vorrq_u8(vqtbl4q_u8(lowTable, characters.val[t]), vqtbl4q_u8(highTable, vsubq_u8(characters.val[t], highOffset)));
+            invalid = vorrq_u8(invalid, vorrq_u8(keys.val[t], characters.val[t]));
+        }
+        vectorValid = ((vmaxvq_u8(invalid) & 0x80u) == 0u);
+        if (vectorValid) {
+            uint8x16x3_t bytes;
+            bytes.val[0] = vorrq_u8(vshlq_n_u8(keys.val[0], 2), vshrq_n_u8(keys.val[1], 4));
+            bytes.val[1] = vorrq_u8(vshlq_n_u8(keys.val[1], 4), vshrq_n_u8(keys.val[2], 2));
+            bytes.val[2] = vorrq_u8(vshlq_n_u8(keys.val[2], 6), keys.val[3]);
+            vst3q_u8(out, bytes);
+            in = &in[64];
+            out = &out[48];
+            decoded += 16u;
+        }
+    }
+#endif
+    bool valid = true;
+    while ((decoded < numberOfGroups) && (valid)) {
+        uint32 key0 = base64Codec.decodingTable[in[0]];
+        uint32 key1 = base64Codec.decodingTable[in[1]];
+        uint32 key2 = base64Codec.decodingTable[in[2]];
+        uint32 key3 = base64Codec.decodingTable[in[3]];
+        valid = (((key0 | key1 | key2 | key3) & 0x80u) == 0u);
+        if (valid) {
+            uint32 word = (key0 << 18u) | (key1 << 12u) | (key2 << 6u) | key3;
+            out[0] = static_cast<uint8>(word >> 16u);
+            out[1] = static_cast<uint8>(word >> 8u);
+            out[2] = static_cast<uint8>(word);
+            in = &in[4];
+            out = &out[3];
+            decoded++;
+        }
+    }
+    return decoded;
+}
 
-    uint32 size = static_cast<uint32>(input.Size());
-    const uint8 *in = reinterpret_cast<const uint8*>(input.Buffer());
-    output = "";
+/**
+ * @brief Decodes a group of four characters which contains a padding or an invalid character.
+ * @details Only the complete bytes before the padding are decoded.
+ * @param[out] out the decoded bytes.
+ * @param[out] outSize the number of decoded bytes.
+ * @param[out] done true if a padding character was found.
+ * @return false if an invalid character was found.
+ */
+static bool Base64DecodeLastGroup(const uint8 * const in,
+                                  uint8 * const out,
+                                  uint32 &outSize,
+                                  bool &done) {
     uint32 word = 0u;
     uint32 code = 0u;
     uint8 key = 0u;
     uint8 c = 0u;
-    bool done = false;
     bool ret = true;
-    while ((size >= 4u) && (ret) && (!done)) {
-        c = in[0];
+    outSize = 0u;
+    c = in[0];
+    if (c == static_cast<uint8>('=')) {
+        done = true;
+    }
+    if (!done) {
+        key = base64Codec.decodingTable[c];
+        if (key == 0xFFu) {
+            ret = false;
+        }
+    }
+
+    if ((ret) && (!done)) {
+        word = key;
+
+        c = in[1];
         if (c == static_cast<uint8>('=')) {
             done = true;
         }
@@ -148,74 +255,181 @@ bool Decode(StreamString &input,
                 ret = false;
             }
         }
+    }
+    if ((ret) && (!done)) {
 
-        if ((ret) && (!done)) {
-            word = key;
+        word <<= 6u;
+        word |= key;
+        code = (word >> 4u);
+        word &= 0xFu;
+        out[outSize] = static_cast<uint8>(code);
+        outSize++;
 
-            c = in[1];
-            if (c == static_cast<uint8>('=')) {
-                word <<= 2u;
-                output += static_cast<char8>(word);
-                done = true;
-            }
-            if (!done) {
-                key = base64Codec.decodingTable[c];
-                if (key == 0xFFu) {
-                    ret = false;
-                }
+        c = in[2];
+        if (c == static_cast<uint8>('=')) {
+            //The remaining 4 bits are padding
+            done = true;
+        }
+        if (!done) {
+            key = base64Codec.decodingTable[c];
+            if (key == 0xFFu) {
+                ret = false;
             }
         }
-        if ((ret) && (!done)) {
+    }
 
-            word <<= 6u;
-            word |= key;
-            code = (word >> 4u);
-            word &= 0xFu;
-            output += static_cast<char8>(code);
+    if ((ret) && (!done)) {
+        word <<= 6u;
+        word |= key;
+        code = (word >> 2u);
+        word &= 0x3u;
+        out[outSize] = static_cast<uint8>(code);
+        outSize++;
 
-            c = in[2];
-            if (c == static_cast<uint8>('=')) {
-                word <<= 4u;
-                output += static_cast<char8>(word);
-                done = true;
+        c = in[3];
+        if (c == static_cast<uint8>('=')) {
+            done = true;
+        }
+        if (!done) {
+            key = base64Codec.decodingTable[c];
+            if (key == 0xFFu) {
+                ret = false;
             }
-            if (!done) {
-                key = base64Codec.decodingTable[c];
-                if (key == 0xFFu) {
-                    ret = false;
-                }
+        }
+    }
+    if ((ret) && (!done)) {
+        word <<= 6u;
+        word |= key;
+        out[outSize] = static_cast<uint8>(word);
+        outSize++;
+    }
+    return ret;
+}
+
+/**
+ * @brief Decodes \a size characters (see Decode), stopping at the first padding character.
+ * @param[in,out] done set to true if a padding character was found.
+ */
+static bool Base64DecodeBuffer(const uint8 *in,
+                               const uint32 size,
+                               StreamI &output,
+                               bool &done) {
+    uint8 block[BASE64_BLOCK_GROUPS * 3u];
+    uint32 numberOfGroups = size / 4u;
+    bool ret = true;
+    while ((numberOfGroups > 0u) && (ret) && (!done)) {
+        uint32 blockGroups = (numberOfGroups < BASE64_BLOCK_GROUPS) ? (numberOfGroups) : (BASE64_BLOCK_GROUPS);
+        uint32 decoded = Base64DecodeGroups(in, blockGroups, &block[0]);
+        uint32 blockSize = decoded * 3u;
+        if (decoded < blockGroups) {
+            uint32 lastSize = 0u;
+            ret = Base64DecodeLastGroup(&in[decoded * 4u], &block[blockSize], lastSize, done);
+            blockSize += lastSize;
+            if ((ret) && (!done)) {
+                decoded++;
             }
         }
+        if (blockSize > 0u) {
+            if (!Base64Write(output, reinterpret_cast<const char8 *>(&block[0]), blockSize)) {
+                ret = false;
+            }
+        }
+        in = &in[decoded * 4u];
+        numberOfGroups -= decoded;
+    }
+    return ret;
+}
 
-        if ((ret) && (!done)) {
-            word <<= 6u;
-            word |= key;
-            code = (word >> 2u);
-            word &= 0x3u;
-            output += static_cast<char8>(code);
+bool Encode(const char8 * const input,
+            const uint32 size,
+            StreamI &output) {
+    char8 block[BASE64_BLOCK_GROUPS * 4u];
+    const uint8 *in = reinterpret_cast<const uint8 *>(input);
+    uint32 numberOfGroups = size / 3u;
+    bool ret = true;
+    while ((numberOfGroups > 0u) && (ret)) {
+        uint32 blockGroups = (numberOfGroups < BASE64_BLOCK_GROUPS) ? (numberOfGroups) : (BASE64_BLOCK_GROUPS);
+        Base64EncodeGroups(in, blockGroups, &block[0]);
+        ret = Base64Write(output, &block[0], blockGroups * 4u);
+        in = &in[blockGroups * 3u];
+        numberOfGroups -= blockGroups;
+    }
+    uint32 remainder = size % 3u;
+    if ((ret) && (remainder > 0u)) {
+        uint32 word = static_cast<uint32>(in[0]) << 16u;
+        if (remainder > 1u) {
+            word |= static_cast<uint32>(in[1]) << 8u;
+        }
+        block[0] = Base64Codec::base64Alphabet[(word >> 18u) & 0x3Fu];
+        block[1] = Base64Codec::base64Alphabet[(word >> 12u) & 0x3Fu];
+        block[2] = (remainder > 1u) ? (Base64Codec::base64Alphabet[(word >> 6u) & 0x3Fu]) : ('=');
+        block[3] = '=';
+        ret = Base64Write(output, &block[0], 4u);
+    }
+    return ret;
+}
 
-            c = in[3];
-            if (c == static_cast<uint8>('=')) {
-                done = true;
-            }
-            if (!done) {
-                key = base64Codec.decodingTable[c];
-                if (key == 0xFFu) {
-                    ret = false;
-                }
+bool Decode(const char8 * const input,
+            const uint32 size,
+            StreamI &output) {
+    bool done = false;
+    return Base64DecodeBuffer(reinterpret_cast<const uint8 *>(input), size, output, done);
+}
+
+bool Encode(StreamI &input,
+            StreamI &output) {
+    //Multiple of three so that only the last block is padded
+    char8 block[BASE64_BLOCK_GROUPS * 3u];
+    bool ret = true;
+    bool end = false;
+    while ((ret) && (!end)) {
+        uint32 filled = 0u;
+        while ((!end) && (filled < sizeof(block))) {
+            uint32 readSize = static_cast<uint32>(sizeof(block)) - filled;
+            if (!input.Read(&block[filled], readSize)) {
+                readSize = 0u;
             }
+            end = (readSize == 0u);
+            filled += readSize;
+        }
+        if (filled > 0u) {
+            ret = Encode(&block[0], filled, output);
         }
-        if ((ret) && (!done)) {
-            word <<= 6u;
-            word |= key;
-            output += static_cast<char8>(word);
+    }
+    return ret;
+}
 
-            size -= 4u;
-            in = &in[4];
+bool Decode(StreamI &input,
+            StreamI &output) {
+    char8 block[BASE64_BLOCK_GROUPS * 4u];
+    bool ret = true;
+    bool end = false;
+    bool done = false;
+    while ((ret) && (!end) && (!done)) {
+        uint32 filled = 0u;
+        while ((!end) && (filled < sizeof(block))) {
+            uint32 readSize = static_cast<uint32>(sizeof(block)) - filled;
+            if (!input.Read(&block[filled], readSize)) {
+                readSize = 0u;
+            }
+            end = (readSize == 0u);
+            filled += readSize;
         }
+        ret = Base64DecodeBuffer(reinterpret_cast<const uint8 *>(&block[0]), filled, output, done);
     }
     return ret;
+}
 
+bool Encode(StreamString &input,
+            StreamString &output) {
+    output = "";
+    return Encode(input.Buffer(), static_cast<uint32>(input.Size()), output);
+}
+
+bool Decode(StreamString &input,
+            StreamString &output) {
+    output = "";
+    return Decode(input.Buffer(), static_cast<uint32>(input.Size()), output);
 }
 
 }
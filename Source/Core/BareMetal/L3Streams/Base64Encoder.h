@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "StreamI.h"
 #include "StreamString.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -59,6 +60,54 @@ bool Encode(StreamString &input,
 bool Decode(StreamString &input,
             StreamString &output);
 
+/**
+ * @brief Base64 encoding of a memory buffer.
+ * @details The buffer is encoded in blocks (with NEON instructions on armv8) and each block is
+ * written on \a output with a single Write.
+ * @param[in] input the buffer to be encoded.
+ * @param[in] size the number of bytes of \a input.
+ * @param[out] output the stream where the encoded result is written.
+ * @return true if all the encoded result was written.
+ */
+bool Encode(const char8 * const input,
+            const uint32 size,
+            StreamI &output);
+
+/**
+ * @brief Base64 decoding of a memory buffer.
+ * @details The decoding stops at the first padding character and any trailing incomplete group of four
+ * characters is ignored. The decoded bytes are written on \a output in blocks.
+ * @param[in] input the buffer to be decoded.
+ * @param[in] size the number of bytes of \a input.
+ * @param[out] output the stream where the decoded result is written.
+ * @return false if \a input contains characters which are not in the Base64 alphabet or if the
+ * result could not be written.
+ */
+bool Decode(const char8 * const input,
+            const uint32 size,
+            StreamI &output);
+
+/**
+ * @brief Base64 encoding of a stream.
+ * @details \a input is read until its end in large blocks, which are encoded as Encode(const char8 *, uint32, StreamI &).
+ * @param[in] input the stream to be encoded.
+ * @param[out] output the stream where the encoded result is written.
+ * @return true if all the encoded result was written.
+ */
+bool Encode(StreamI &input,
+            StreamI &output);
+
+/**
+ * @brief Base64 decoding of a stream.
+ * @details \a input is read until its end (or the first padding character) in large blocks, which are
+ * decoded as Decode(const char8 *, uint32, StreamI &).
+ * @param[in] input the stream to be decoded.
+ * @param[out] output the stream where the decoded result is written.
+ * @return see Decode(const char8 *, uint32, StreamI &).
+ */
+bool Decode(StreamI &input,
+            StreamI &output);
+
 }
 
 }
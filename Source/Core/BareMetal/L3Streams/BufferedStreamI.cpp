@@ -154,6 +154,23 @@ bool BufferedStreamI::PrintFormatted(const char8 * const format,
     return ret;
 }
 
+bool BufferedStreamI::PrintFormatted(const CompiledFormat &format,
+                                     const AnyType pars[]) {
+
+    bool ret = CanWrite();
+// retrieve stream mechanism
+// the output buffer is flushed in streamable.
+    if (ret) {
+        IOBuffer *outputBuffer = GetWriteBuffer();
+        if (outputBuffer != NULL) {
+
+            ret = outputBuffer->PrintFormatted(format, pars);
+
+        }
+    }
+    return ret;
+}
+
 bool BufferedStreamI::Copy(const char8 * const buffer) {
 
     bool ret = false;
@@ -169,37 +186,82 @@ bool BufferedStreamI::Copy(const char8 * const buffer) {
 
 bool BufferedStreamI::Copy(BufferedStreamI &stream) {
 
-    char8 buffer[256];
-    uint32 size = static_cast<uint32>(sizeof(buffer));
-
-    //read in buffer
-    bool ret = stream.Read(&buffer[0], size);
+    //write directly from the read buffer of the source stream
+    const char8 *data = NULL_PTR(const char8 *);
+    uint32 size = 0u;
+    bool ret = stream.PeekRead(data, size);
     while ((ret) && (size > 0u)) {
+        ret = Write(data, size);
+        if (ret) {
+            ret = stream.Consume(size);
+        }
+        if (ret) {
+            ret = stream.PeekRead(data, size);
+        }
+    }
+
+    return ret;
 
-        //write in buffer
-        ret = Write(&buffer[0], size);
-        //in case of ret false don't write again
-        size = 0u;
+}
 
-        //if successful, read again and size becomes zero if
-        //there is no more data to read
-        if (ret) {
-            size = static_cast<uint32>(sizeof(buffer));
-            ret = stream.Read(&buffer[0], size);
+bool BufferedStreamI::PeekRead(const char8 *&ptr,
+                               uint32 &avail) {
+    IOBuffer *buff = GetReadBuffer();
+    bool ret = (CanRead()) && (buff != NULL_PTR(IOBuffer *));
+    avail = 0u;
+    if (ret) {
+        if (buff->UsedAmountLeft() == 0u) {
+            //nothing left is not an error (i.e. end of the stream)
+            (void) Refill();
+        }
+        if (buff->Buffer() != NULL_PTR(const char8 *)) {
+            ptr = &(buff->Buffer()[buff->Position()]);
+            avail = buff->UsedAmountLeft();
         }
     }
-    //if exit because ret is false
-    //something was read in buffer
-    if (size > 0u) {
-        //write on the stream
-        //ret = ret && Write(buffer,size,TTDefault,true);
-        bool writeOk = (Write(&buffer[0], size));
-        ret = (ret) && (writeOk);
-        //size = 0;
+    return ret;
+}
+
+bool BufferedStreamI::Consume(const uint32 size) {
+    IOBuffer *buff = GetReadBuffer();
+    bool ret = (buff != NULL_PTR(IOBuffer *));
+    if (ret) {
+        ret = (size <= buff->UsedAmountLeft());
+    }
+    if ((ret) && (size > 0u)) {
+        ret = buff->RelativeSeek(static_cast<int32>(size));
     }
+    return ret;
+}
 
+bool BufferedStreamI::ReserveWrite(char8 *&ptr,
+                                   uint32 &room) {
+    IOBuffer *buff = GetWriteBuffer();
+    bool ret = (CanWrite()) && (buff != NULL_PTR(IOBuffer *));
+    uint32 needed = (room > 0u) ? (room) : (1u);
+    room = 0u;
+    if (ret) {
+        if (buff->AmountLeft() < needed) {
+            ret = buff->Flush(needed);
+        }
+    }
+    if (ret) {
+        ret = (buff->AmountLeft() >= needed) && (buff->BufferReference() != NULL_PTR(char8 *));
+    }
+    if (ret) {
+        ptr = &(buff->BufferReference()[buff->Position()]);
+        room = buff->AmountLeft();
+    }
     return ret;
+}
 
+bool BufferedStreamI::Commit(const uint32 size) {
+    IOBuffer *buff = GetWriteBuffer();
+    bool ret = (buff != NULL_PTR(IOBuffer *));
+    if (ret) {
+        ret = buff->Commit(size);
+    }
+    return ret;
 }
 
 bool BufferedStreamI::Flush() {
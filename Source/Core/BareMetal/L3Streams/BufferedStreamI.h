@@ -266,6 +266,19 @@ public:
      */
     bool PrintFormatted(const char8 * const format, const AnyType pars[]);
 
+    /**
+     * @brief Printf using a pre-compiled format.
+     * @details Same as PrintFormatted(const char8 * const, const AnyType []) but
+     * without parsing the format string (see CompiledFormat).
+     * @param[in] format the pre-compiled printf format.
+     * @param[in] pars the list of elements that are to be replaced in the
+     * \a format string. It must be terminated by a voidAnyType element.
+     * @return true if the string is successfully printed.
+     * @pre CanWrite() && GetWriteBuffer() != NULL
+     * @post see brief
+     */
+    bool PrintFormatted(const CompiledFormat &format, const AnyType pars[]);
+
     /**
      * @brief Copies a character buffer.
      * @details Copies a character buffer into this stream (from the
@@ -288,6 +301,50 @@ public:
      */
     bool Copy(BufferedStreamI &stream);
 
+    /**
+     * @brief Gives access to the data already buffered for reading, without copying it.
+     * @details If the read buffer is exhausted it is refilled first. The data is only
+     * removed from the stream by Consume, so that parsers can work directly on the
+     * internal buffer. \a ptr is valid until the next operation on the stream.
+     * @param[out] ptr the address of the next byte to be read.
+     * @param[out] avail the number of bytes which can be read from \a ptr (zero at the end of the stream).
+     * @return false if the stream cannot be read.
+     * @pre CanRead() && GetReadBuffer() != NULL
+     */
+    bool PeekRead(const char8 *&ptr,
+                  uint32 &avail);
+
+    /**
+     * @brief Removes from the stream data previously returned by PeekRead.
+     * @param[in] size the number of bytes read from the PeekRead pointer.
+     * @return false if \a size is greater than the available bytes returned by PeekRead.
+     * @pre CanRead() && GetReadBuffer() != NULL
+     */
+    bool Consume(const uint32 size);
+
+    /**
+     * @brief Gives access to the free space of the write buffer, so that data can be written in place.
+     * @details If less than \a room bytes are free the write buffer is flushed (or grown) first.
+     * The written data is only added to the stream by Commit. \a ptr is valid until the next
+     * operation on the stream.
+     * @param[out] ptr the address where the next byte is to be written.
+     * @param[in,out] room the minimum number of contiguous bytes needed (zero means at least one)
+     * and, on output, the number of bytes which can be written from \a ptr.
+     * @return false if the stream cannot be written or if the minimum space cannot be made available
+     * (e.g. if it is larger than the write buffer).
+     * @pre CanWrite() && GetWriteBuffer() != NULL
+     */
+    bool ReserveWrite(char8 *&ptr,
+                      uint32 &room);
+
+    /**
+     * @brief Adds to the stream the data written in place after ReserveWrite.
+     * @param[in] size the number of bytes written from the ReserveWrite pointer.
+     * @return false if \a size is greater than the room returned by ReserveWrite.
+     * @pre CanWrite() && GetWriteBuffer() != NULL
+     */
+    bool Commit(const uint32 size);
+
     /**
      * @see PrintFormatted.
      */
@@ -341,6 +398,59 @@ public:
     inline bool Printf(const char8 * const format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7,
                        const AnyType& par8, const AnyType& par9, const AnyType& par10);
 
+    /**
+     * @see PrintFormatted(const CompiledFormat &, const AnyType []).
+     */
+    inline bool Printf(const CompiledFormat &format, const AnyType& par1);
+
+    /**
+     * @see PrintFormatted(const CompiledFormat &, const AnyType []).
+     */
+    inline bool Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2);
+
+    /**
+     * @see PrintFormatted(const CompiledFormat &, const AnyType []).
+     */
+    inline bool Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3);
+
+    /**
+     * @see PrintFormatted(const CompiledFormat &, const AnyType []).
+     */
+    inline bool Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4);
+
+    /**
+     * @see PrintFormatted(const CompiledFormat &, const AnyType []).
+     */
+    inline bool Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5);
+
+    /**
+     * @see PrintFormatted(const CompiledFormat &, const AnyType []).
+     */
+    inline bool Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6);
+
+    /**
+     * @see PrintFormatted(const CompiledFormat &, const AnyType []).
+     */
+    inline bool Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7);
+
+    /**
+     * @see PrintFormatted(const CompiledFormat &, const AnyType []).
+     */
+    inline bool Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7,
+                       const AnyType& par8);
+
+    /**
+     * @see PrintFormatted(const CompiledFormat &, const AnyType []).
+     */
+    inline bool Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7,
+                       const AnyType& par8, const AnyType& par9);
+
+    /**
+     * @see PrintFormatted(const CompiledFormat &, const AnyType []).
+     */
+    inline bool Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6, const AnyType& par7,
+                       const AnyType& par8, const AnyType& par9, const AnyType& par10);
+
     /**
      * @brief Flushes the internal buffer on the stream.
      * @return true if the flush to the stream returns without errors, false otherwise.
@@ -465,6 +575,60 @@ bool BufferedStreamI::Printf(const char8 * const format, const AnyType& par1, co
     return PrintFormatted(format, &pars[0]);
 }
 
+bool BufferedStreamI::Printf(const CompiledFormat &format, const AnyType& par1) {
+    AnyType pars[2] = { par1, voidAnyType };
+    return PrintFormatted(format, &pars[0]);
+}
+
+bool BufferedStreamI::Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2) {
+    AnyType pars[3] = { par1, par2, voidAnyType };
+    return PrintFormatted(format, &pars[0]);
+}
+
+bool BufferedStreamI::Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3) {
+    AnyType pars[4] = { par1, par2, par3, voidAnyType };
+    return PrintFormatted(format, &pars[0]);
+}
+
+bool BufferedStreamI::Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4) {
+    AnyType pars[5] = { par1, par2, par3, par4, voidAnyType };
+    return PrintFormatted(format, &pars[0]);
+}
+
+bool BufferedStreamI::Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5) {
+    AnyType pars[6] = { par1, par2, par3, par4, par5, voidAnyType };
+    return PrintFormatted(format, &pars[0]);
+}
+
+bool BufferedStreamI::Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6) {
+    AnyType pars[7] = { par1, par2, par3, par4, par5, par6, voidAnyType };
+    return PrintFormatted(format, &pars[0]);
+}
+
+bool BufferedStreamI::Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6,
+                             const AnyType& par7) {
+    AnyType pars[8] = { par1, par2, par3, par4, par5, par6, par7, voidAnyType };
+    return PrintFormatted(format, &pars[0]);
+}
+
+bool BufferedStreamI::Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6,
+                             const AnyType& par7, const AnyType& par8) {
+    AnyType pars[9] = { par1, par2, par3, par4, par5, par6, par7, par8, voidAnyType };
+    return PrintFormatted(format, &pars[0]);
+}
+
+bool BufferedStreamI::Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6,
+                             const AnyType& par7, const AnyType& par8, const AnyType& par9) {
+    AnyType pars[10] = { par1, par2, par3, par4, par5, par6, par7, par8, par9, voidAnyType };
+    return PrintFormatted(format, &pars[0]);
+}
+
+bool BufferedStreamI::Printf(const CompiledFormat &format, const AnyType& par1, const AnyType& par2, const AnyType& par3, const AnyType& par4, const AnyType& par5, const AnyType& par6,
+                             const AnyType& par7, const AnyType& par8, const AnyType& par9, const AnyType& par10) {
+    AnyType pars[11] = { par1, par2, par3, par4, par5, par6, par7, par8, par9, par10, voidAnyType };
+    return PrintFormatted(format, &pars[0]);
+}
+
 void BufferedStreamI::SetCalibReadParam(const uint32 calibReadIn) {
     calibReadParam = calibReadIn;
 }
@@ -0,0 +1,340 @@
+/**
+ * @file CborPrinter.cpp
+ * @brief Source file for class CborPrinter
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CborPrinter (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "CborPrinter.h"
+#include "MemoryOperationsHelper.h"
+#include "StreamString.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * CBOR major types.
+ */
+static const uint8 CBOR_UNSIGNED = 0u;
+static const uint8 CBOR_NEGATIVE = 1u;
+static const uint8 CBOR_TEXT = 3u;
+static const uint8 CBOR_ARRAY = 4u;
+
+/**
+ * CBOR initial bytes without argument.
+ */
+static const char8 CBOR_INDEFINITE_ARRAY = static_cast<char8>(0x9Fu);
+static const char8 CBOR_INDEFINITE_MAP = static_cast<char8>(0xBFu);
+static const char8 CBOR_BREAK = static_cast<char8>(0xFFu);
+static const uint8 CBOR_FLOAT32 = 0xFAu;
+static const uint8 CBOR_FLOAT64 = 0xFBu;
+
+/**
+ * @brief Writes the \a numberOfBytes least significant bytes of \a value in big endian order.
+ */
+static void CborPutBigEndian(char8 * const buffer,
+                             const uint64 value,
+                             const uint32 numberOfBytes) {
+    uint32 i;
+    for (i = 0u; i < numberOfBytes; i++) {
+        buffer[i] = static_cast<char8>((value >> (8u * ((numberOfBytes - 1u) - i))) & 0xFFu);
+    }
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+CborPrinter::CborPrinter(BufferedStreamI & streamIn) :
+        PrinterI(streamIn) {
+}
+
+CborPrinter::CborPrinter() :
+        PrinterI() {
+}
+
+CborPrinter::~CborPrinter() {
+
+}
+
+bool CborPrinter::PrintOpenMatrix() {
+    return PrintBytes(&CBOR_INDEFINITE_ARRAY, 1u);
+}
+
+bool CborPrinter::PrintCloseMatrix() {
+    return PrintBytes(&CBOR_BREAK, 1u);
+}
+
+bool CborPrinter::PrintScalarSeparator() {
+    return true;
+}
+
+bool CborPrinter::PrintVectorSeparator() {
+    return true;
+}
+
+bool CborPrinter::PrintVariableSeparator() {
+    return true;
+}
+
+bool CborPrinter::PrintBlockSeparator() {
+    return true;
+}
+
+bool CborPrinter::PrintOpenVector() {
+    return PrintBytes(&CBOR_INDEFINITE_ARRAY, 1u);
+}
+
+bool CborPrinter::PrintCloseVector() {
+    return PrintBytes(&CBOR_BREAK, 1u);
+}
+
+bool CborPrinter::PrintOpenBlock(const char8 * const blockName) {
+    bool ok = PrintText(blockName);
+    if (ok) {
+        ok = PrintBytes(&CBOR_INDEFINITE_MAP, 1u);
+    }
+    return ok;
+}
+
+/*lint -e{715} parameter not used in this function*/
+bool CborPrinter::PrintCloseBlock(const char8 * const blockName) {
+    return PrintBytes(&CBOR_BREAK, 1u);
+}
+
+bool CborPrinter::PrintOpenAssignment(const char8 * const varName) {
+    return PrintText(varName);
+}
+
+/*lint -e{715} parameter not used in this function*/
+bool CborPrinter::PrintCloseAssignment(const char8 * const varName) {
+    return true;
+}
+
+bool CborPrinter::PrintVariable(const AnyType &var) {
+    bool ok = true;
+    uint8 numberOfDimensions = var.GetNumberOfDimensions();
+    if (numberOfDimensions == 0u) {
+        ok = PrintScalar(var);
+    }
+    else if (numberOfDimensions == 1u) {
+        ok = PrintArray(var, var.GetDataPointer(), var.GetNumberOfElements(0u));
+    }
+    else {
+        uint32 numberOfColumns = var.GetNumberOfElements(0u);
+        uint32 numberOfRows = var.GetNumberOfElements(1u);
+        ok = PrintHead(CBOR_ARRAY, numberOfRows);
+        uint32 r;
+        for (r = 0u; (r < numberOfRows) && (ok); r++) {
+            void *row;
+            if (var.IsStaticDeclared()) {
+                uint32 rowSize = numberOfColumns * var.GetByteSize();
+                row = &(static_cast<char8 *>(var.GetDataPointer())[r * rowSize]);
+            }
+            else {
+                row = static_cast<void **>(var.GetDataPointer())[r];
+            }
+            ok = PrintArray(var, row, numberOfColumns);
+        }
+    }
+    return ok;
+}
+
+bool CborPrinter::PrintBegin() {
+    return PrintBytes(&CBOR_INDEFINITE_MAP, 1u);
+}
+
+bool CborPrinter::PrintEnd() {
+    return PrintBytes(&CBOR_BREAK, 1u);
+}
+
+bool CborPrinter::PrintNewLine() {
+    return true;
+}
+
+bool CborPrinter::PrintBytes(const char8 * const data,
+                             const uint32 size) {
+    uint32 writeSize = size;
+    bool ok = (stream != NULL_PTR(BufferedStreamI *));
+    if (ok) {
+        ok = stream->Write(data, writeSize);
+    }
+    if (ok) {
+        ok = (writeSize == size);
+    }
+    return ok;
+}
+
+bool CborPrinter::PrintHead(const uint8 majorType,
+                            const uint64 argument) {
+    char8 head[9];
+    uint32 numberOfBytes;
+    uint8 additionalInformation;
+    if (argument < 24u) {
+        additionalInformation = static_cast<uint8>(argument);
+        numberOfBytes = 0u;
+    }
+    else if (argument <= 0xFFu) {
+        additionalInformation = 24u;
+        numberOfBytes = 1u;
+    }
+    else if (argument <= 0xFFFFu) {
+        additionalInformation = 25u;
+        numberOfBytes = 2u;
+    }
+    else if (argument <= 0xFFFFFFFFu) {
+        additionalInformation = 26u;
+        numberOfBytes = 4u;
+    }
+    else {
+        additionalInformation = 27u;
+        numberOfBytes = 8u;
+    }
+    head[0] = static_cast<char8>(static_cast<uint8>(majorType << 5u) | additionalInformation);
+    CborPutBigEndian(&head[1], argument, numberOfBytes);
+    return PrintBytes(&head[0], numberOfBytes + 1u);
+}
+
+bool CborPrinter::PrintText(const char8 * const text) {
+    uint32 length = StringHelper::Length(text);
+    bool ok = PrintHead(CBOR_TEXT, length);
+    if ((ok) && (length > 0u)) {
+        ok = PrintBytes(text, length);
+    }
+    return ok;
+}
+
+bool CborPrinter::PrintScalar(const AnyType &element) {
+    bool ok = true;
+    TypeDescriptor td = element.GetTypeDescriptor();
+    void *dataPointer = element.GetDataPointer();
+    //Only byte aligned integers and float32/float64 are written as numbers
+    bool isBinary = ((!td.isStructuredData) && (dataPointer != NULL) && (element.GetBitAddress() == 0u));
+    bool isInteger = ((td.type == SignedInteger) || (td.type == UnsignedInteger));
+    uint32 numberOfBits = td.numberOfBits;
+    if (isBinary) {
+        if (isInteger) {
+            isBinary = ((numberOfBits == 8u) || (numberOfBits == 16u) || (numberOfBits == 32u) || (numberOfBits == 64u));
+        }
+        else if (td.type == Float) {
+            isBinary = ((numberOfBits == 32u) || (numberOfBits == 64u));
+        }
+        else {
+            isBinary = false;
+        }
+    }
+    if (!isBinary) {
+        StreamString text;
+        ok = text.Printf("%!", element);
+        if (ok) {
+            ok = PrintText(text.Buffer());
+        }
+    }
+    else if (isInteger) {
+        uint64 raw = 0u;
+        bool negative = false;
+        if (td.type == UnsignedInteger) {
+            if (numberOfBits == 8u) {
+                raw = *static_cast<uint8 *>(dataPointer);
+            }
+            else if (numberOfBits == 16u) {
+                raw = *static_cast<uint16 *>(dataPointer);
+            }
+            else if (numberOfBits == 32u) {
+                raw = *static_cast<uint32 *>(dataPointer);
+            }
+            else {
+                raw = *static_cast<uint64 *>(dataPointer);
+            }
+        }
+        else {
+            int64 value;
+            if (numberOfBits == 8u) {
+                value = *static_cast<int8 *>(dataPointer);
+            }
+            else if (numberOfBits == 16u) {
+                value = *static_cast<int16 *>(dataPointer);
+            }
+            else if (numberOfBits == 32u) {
+                value = *static_cast<int32 *>(dataPointer);
+            }
+            else {
+                value = *static_cast<int64 *>(dataPointer);
+            }
+            negative = (value < 0);
+            //A negative integer n is encoded as -1 - n
+            raw = (negative) ? (static_cast<uint64>(-(value + 1))) : (static_cast<uint64>(value));
+        }
+        ok = PrintHead((negative) ? (CBOR_NEGATIVE) : (CBOR_UNSIGNED), raw);
+    }
+    else {
+        char8 number[9];
+        uint32 numberOfBytes;
+        if (numberOfBits == 32u) {
+            uint32 bits;
+            ok = MemoryOperationsHelper::Copy(&bits, dataPointer, 4u);
+            number[0] = static_cast<char8>(CBOR_FLOAT32);
+            CborPutBigEndian(&number[1], bits, 4u);
+            numberOfBytes = 5u;
+        }
+        else {
+            uint64 bits;
+            ok = MemoryOperationsHelper::Copy(&bits, dataPointer, 8u);
+            number[0] = static_cast<char8>(CBOR_FLOAT64);
+            CborPutBigEndian(&number[1], bits, 8u);
+            numberOfBytes = 9u;
+        }
+        if (ok) {
+            ok = PrintBytes(&number[0], numberOfBytes);
+        }
+    }
+    return ok;
+}
+
+bool CborPrinter::PrintArray(const AnyType &var,
+                             void * const dataPointer,
+                             const uint32 numberOfElements) {
+    AnyType vector(var.GetTypeDescriptor(), var.GetBitAddress(), dataPointer);
+    vector.SetNumberOfDimensions(1u);
+    vector.SetNumberOfElements(0u, numberOfElements);
+    bool ok = PrintHead(CBOR_ARRAY, numberOfElements);
+    uint32 i;
+    for (i = 0u; (i < numberOfElements) && (ok); i++) {
+        ok = PrintScalar(vector[i]);
+    }
+    return ok;
+}
+
+}
@@ -0,0 +1,202 @@
+/**
+ * @file CborPrinter.h
+ * @brief Header file for class CborPrinter
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CborPrinter
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CBORPRINTER_H_
+#define CBORPRINTER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "PrinterI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief The CBOR (RFC 8949) binary printer.
+ * @see PrinterI
+ * @details The data is written without any text formatting, so that it is cheaper to produce
+ * and to parse (see CborParser) and smaller than the text languages:
+ *  - PrintBegin/PrintOpenBlock open an indefinite length map (the block name is written as the key)
+ *    which is closed by PrintEnd/PrintCloseBlock. PrintOpenVector/PrintOpenMatrix open an
+ *    indefinite length array;
+ *  - PrintOpenAssignment writes the variable name as a text string key;
+ *  - PrintVariable writes the integers as CBOR integers (in the smallest encoding), the float32
+ *    and float64 as CBOR single and double precision floats and any other type as a text string.
+ *    Vectors are written as arrays and matrices as arrays of rows;
+ *  - the separators and the line breaks are not written.
+ *
+ * PrintBegin and PrintEnd shall be called (e.g. on the GetPrinter of a StreamStructuredData<CborPrinter>)
+ * so that the output is a single CBOR map.
+ */
+class CborPrinter: public PrinterI {
+public:
+    /**
+     * @brief Constructor
+     */
+    CborPrinter();
+
+    /**
+     * @brief Constructor. Sets a pointer to the stream where to print to.
+     * @param[in] streamIn is the stream to write to.
+     */
+    CborPrinter(BufferedStreamI & streamIn);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~CborPrinter();
+
+    /**
+     * @see PrinterI::PrintOpenMatrix
+     */
+    virtual bool PrintOpenMatrix();
+
+    /**
+     * @see PrinterI::PrintCloseMatrix
+     */
+    virtual bool PrintCloseMatrix();
+
+    /**
+     * @see PrinterI::PrintScalarSeparator
+     */
+    virtual bool PrintScalarSeparator();
+
+    /**
+     * @see PrinterI::PrintVectorSeparator
+     */
+    virtual bool PrintVectorSeparator();
+
+    /**
+     * @see PrinterI::PrintVariableSeparator
+     */
+    virtual bool PrintVariableSeparator();
+
+    /**
+     * @see PrinterI::PrintBlockSeparator
+     */
+    virtual bool PrintBlockSeparator();
+
+    /**
+     * @see PrinterI::PrintOpenVector
+     */
+    virtual bool PrintOpenVector();
+
+    /**
+     * @see PrinterI::PrintCloseVector
+     */
+    virtual bool PrintCloseVector();
+
+    /**
+     * @see PrinterI::PrintOpenBlock
+     */
+    virtual bool PrintOpenBlock(const char8 * const blockName);
+
+    /**
+     * @see PrinterI::PrintCloseBlock
+     */
+    virtual bool PrintCloseBlock(const char8 * const blockName);
+
+    /**
+     * @see PrinterI::PrintOpenAssignment
+     */
+    virtual bool PrintOpenAssignment(const char8 * const varName);
+
+    /**
+     * @see PrinterI::PrintCloseAssignment
+     */
+    virtual bool PrintCloseAssignment(const char8 * const varName);
+
+    /**
+     * @see PrinterI::PrintVariable
+     */
+    virtual bool PrintVariable(const AnyType &var);
+
+    /**
+     * @see PrinterI::PrintBegin
+     */
+    virtual bool PrintBegin();
+
+    /**
+     * @see PrinterI::PrintEnd
+     */
+    virtual bool PrintEnd();
+
+    /**
+     * @brief No line breaks are written.
+     * @return true.
+     */
+    virtual bool PrintNewLine();
+
+private:
+
+    /**
+     * @brief Writes \a size bytes on the stream.
+     * @return true if all the bytes were written.
+     */
+    bool PrintBytes(const char8 * const data,
+                    const uint32 size);
+
+    /**
+     * @brief Writes a CBOR head (major type and argument, in the smallest encoding).
+     * @return true if the head was written.
+     */
+    bool PrintHead(const uint8 majorType,
+                   const uint64 argument);
+
+    /**
+     * @brief Writes a CBOR text string.
+     * @return true if the string was written.
+     */
+    bool PrintText(const char8 * const text);
+
+    /**
+     * @brief Writes a scalar element (see class description).
+     * @return true if the element was written.
+     */
+    bool PrintScalar(const AnyType &element);
+
+    /**
+     * @brief Writes the \a numberOfElements elements of a vector, starting at \a dataPointer, as a CBOR array.
+     * @return true if the array was written.
+     */
+    bool PrintArray(const AnyType &var,
+                    void * const dataPointer,
+                    const uint32 numberOfElements);
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* CBORPRINTER_H_ */
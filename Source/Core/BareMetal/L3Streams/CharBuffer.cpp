@@ -32,6 +32,7 @@
 /*---------------------------------------------------------------------------*/
 #include "CharBuffer.h"
 #include "HeapManager.h"
+#include "MemoryOperationsHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -46,6 +47,8 @@ namespace MARTe {
 CharBuffer::CharBuffer() {
     bufferSize = 0u;
     buffer = NULL_PTR(char8 *);
+    inlineStorage = NULL_PTR(char8 *);
+    inlineStorageSize = 0u;
     readOnly = true;
     allocated = false;
     allocationGranularityMask = 0xFFFFFFFFu;
@@ -54,6 +57,8 @@ CharBuffer::CharBuffer() {
 CharBuffer::CharBuffer(const uint32 allocationGranularity) {
     bufferSize = 0u;
     buffer = NULL_PTR(char8 *);
+    inlineStorage = NULL_PTR(char8 *);
+    inlineStorageSize = 0u;
     readOnly = true;
     allocated = false;
 
@@ -88,7 +93,7 @@ CharBuffer::CharBuffer(const uint32 allocationGranularity) {
 }
 
 void CharBuffer::Reset() {
-    if (allocated) {
+    if ((allocated) && (buffer != inlineStorage)) {
         if (buffer != NULL) {
             if (HeapManager::Free(reinterpret_cast<void *&>(buffer))) {
                 bufferSize = 0u;
@@ -130,7 +135,16 @@ bool CharBuffer::SetBufferSize(const uint32 desiredSize) {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "CharBuffer: It is not possible allocate more than 2^32-1 bytes");
     }
 
-    if (ok) {
+    bool isInline = ((inlineStorage != NULL) && (buffer == inlineStorage));
+    bool useInline = ((inlineStorage != NULL) && (desiredSize <= inlineStorageSize));
+    if ((ok) && ((buffer == NULL) || (isInline)) && (useInline)) {
+        //Small sizes do not need any heap memory
+        buffer = inlineStorage;
+        bufferSize = inlineStorageSize;
+        readOnly = false;
+        allocated = true;
+    }
+    else if (ok) {
         // Increase up to granularity boundaries
         uint32 neededMemory = desiredSize + allocationGranularity;
         neededMemory -= 1u;
@@ -139,6 +153,12 @@ bool CharBuffer::SetBufferSize(const uint32 desiredSize) {
         if (buffer == NULL) {
             buffer = static_cast<char8 *>(HeapManager::Malloc(neededMemory));
         }
+        else if (isInline) {
+            buffer = static_cast<char8 *>(HeapManager::Malloc(neededMemory));
+            if (buffer != NULL) {
+                ok = MemoryOperationsHelper::Copy(buffer, inlineStorage, bufferSize);
+            }
+        }
         else {
             buffer = static_cast<char8 *>(HeapManager::Realloc(reinterpret_cast<void *&>(buffer), neededMemory));
         }
@@ -157,6 +177,28 @@ bool CharBuffer::SetBufferSize(const uint32 desiredSize) {
     return ok;
 }
 
+void CharBuffer::SetInlineStorage(char8 * const storage,
+                                  const uint32 storageSize) {
+    if (buffer == NULL) {
+        inlineStorage = storage;
+        inlineStorageSize = storageSize;
+    }
+}
+
+bool CharBuffer::TakeHeapMemory(CharBuffer &source) {
+    bool ok = ((source.allocated) && (source.buffer != NULL) && (source.buffer != source.inlineStorage));
+    if (ok) {
+        Reset();
+        buffer = source.buffer;
+        bufferSize = source.bufferSize;
+        readOnly = false;
+        allocated = true;
+        source.buffer = NULL_PTR(char8 *);
+        source.Reset();
+    }
+    return ok;
+}
+
 void CharBuffer::SetBufferReference(char8 * const buff,
                                     const uint32 buffSize) {
     Reset();
@@ -105,6 +105,26 @@ public:
      */
     bool SetBufferSize(const uint32 desiredSize);
 
+    /**
+     * @brief Sets a memory area, owned by the caller, to be used by SetBufferSize instead of the heap for the small sizes.
+     * @details While SetBufferSize is called with a \a desiredSize not greater than \a storageSize the buffer is
+     * \a storage (Size() == storageSize) and no heap memory is allocated. Larger sizes are allocated on the heap
+     * (copying the content of \a storage) and the buffer does not go back to \a storage until it is reset.
+     * @param[in] storage the memory area (shall live as long as this CharBuffer).
+     * @param[in] storageSize the size of \a storage.
+     * @pre
+     *    Buffer() == NULL
+     */
+    void SetInlineStorage(char8 * const storage,
+                          const uint32 storageSize);
+
+    /**
+     * @brief Takes the heap memory allocated by \a source, which is left without any memory (as after the construction).
+     * @param[in,out] source the CharBuffer whose memory is taken.
+     * @return true if \a source had heap memory allocated by itself, false otherwise (and nothing is done).
+     */
+    bool TakeHeapMemory(CharBuffer &source);
+
     /**
      * @brief Memory assignment of a preallocated buffer in read and write mode.
      * @param[in] buff a pointer to the writable buffer.
@@ -200,6 +220,16 @@ private:
     /*lint -sem(MARTe::CharBuffer::Reset,cleanup)*/
     char8 *buffer;
 
+    /**
+     * The memory used instead of the heap for the small sizes (see SetInlineStorage).
+     */
+    char8 *inlineStorage;
+
+    /**
+     * The size of inlineStorage.
+     */
+    uint32 inlineStorageSize;
+
     /**
      * @brief Resets the buffer, releasing any memory previously allocated in
      * the heap if it was allocated by the class itself.
@@ -0,0 +1,101 @@
+/**
+ * @file CompiledErrorReport.cpp
+ * @brief Source file for class CompiledErrorReport
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CompiledErrorReport (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CompiledErrorReport.h"
+#include "HighResolutionTimer.h"
+#include "Sleep.h"
+#include "StreamMemoryReference.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace ErrorManagement {
+
+DeferredErrorProcessFunctionType deferredErrorProcessFunction = NULL_PTR(DeferredErrorProcessFunctionType);
+
+void SetDeferredErrorProcessFunction(const DeferredErrorProcessFunctionType userFun) {
+    deferredErrorProcessFunction = userFun;
+}
+
+void ReportErrorCompiled(const ErrorType &code,
+                         const CompiledFormat &format,
+                         const char8 * const clsName,
+                         const char8 * const objName,
+                         const void * const objPtr,
+                         const char8 * const fileName,
+                         const int16 lineNumber,
+                         const char8 * const functionName,
+                         const AnyType &par1,
+                         const AnyType &par2,
+                         const AnyType &par3,
+                         const AnyType &par4,
+                         const AnyType &par5,
+                         const AnyType &par6,
+                         const AnyType &par7,
+                         const AnyType &par8,
+                         const AnyType &par9,
+                         const AnyType &par10) {
+    const AnyType parameters[] = { par1, par2, par3, par4, par5, par6, par7, par8, par9, par10, voidAnyType };
+    bool deferred = false;
+    DeferredErrorProcessFunctionType deferredFunction = deferredErrorProcessFunction;
+    if (deferredFunction != NULL_PTR(DeferredErrorProcessFunctionType)) {
+        ErrorInformation errorInfo;
+        errorInfo.header.errorType = code;
+        errorInfo.header.lineNumber = lineNumber;
+        errorInfo.header.isObject = (objPtr != static_cast<const char8 *>(NULL));
+        errorInfo.className = clsName;
+        errorInfo.objectName = objName;
+        errorInfo.objectPointer = objPtr;
+        errorInfo.fileName = fileName;
+        errorInfo.functionName = functionName;
+        errorInfo.hrtTime = HighResolutionTimer::Counter();
+        errorInfo.timeSeconds = Sleep::GetDateSeconds();
+        deferred = deferredFunction(errorInfo, format, &parameters[0]);
+    }
+    if (!deferred) {
+        char8 buffer[MAX_ERROR_MESSAGE_SIZE + 1u];
+        StreamMemoryReference smr(&buffer[0], MAX_ERROR_MESSAGE_SIZE);
+        (void) (smr.PrintFormatted(format, &parameters[0]));
+        buffer[smr.Size()] = '\0';
+        ReportError(code, &buffer[0], clsName, objName, objPtr, fileName, lineNumber, functionName);
+    }
+}
+
+}
+
+}
@@ -0,0 +1,114 @@
+/**
+ * @file CompiledErrorReport.h
+ * @brief Header file for class CompiledErrorReport
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CompiledErrorReport
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef COMPILEDERRORREPORT_H_
+#define COMPILEDERRORREPORT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "AnyType.h"
+#include "CompiledFormat.h"
+#include "ErrorManagement.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace ErrorManagement {
+
+/**
+ * @brief The type of a function that accepts an error report whose message is not yet formatted.
+ * @details The function receives the compiled format and the parameters exactly as given to
+ * the REPORT_ERROR macro and is expected to copy whatever it needs (the parameters do not
+ * outlive the call).
+ * @param[in] errorInfo the error information (including the timestamp of the report).
+ * @param[in] format the compiled message format. Its lifetime is the one of the reporting call site.
+ * @param[in] parameters the message parameters, terminated by a void AnyType.
+ * @return true if the report was accepted. If false is returned the message is formatted on
+ * the calling thread and handed to errorMessageProcessFunction.
+ */
+typedef bool (*DeferredErrorProcessFunctionType)(const ErrorInformation &errorInfo,
+                                                 const CompiledFormat &format,
+                                                 const AnyType parameters[]);
+
+/**
+ * @brief A pointer to the function that accepts deferred error reports (NULL if deferral is disabled).
+ */
+extern DLL_API DeferredErrorProcessFunctionType deferredErrorProcessFunction;
+
+/**
+ * @brief Sets the function that accepts deferred error reports.
+ * @param[in] userFun the function to be installed or NULL to format all the messages on the calling thread.
+ */
+DLL_API void SetDeferredErrorProcessFunction(const DeferredErrorProcessFunctionType userFun);
+
+/**
+ * @brief Reports an error whose message is described by a compiled format.
+ * @details If a deferred error process function is installed and accepts the report, the
+ * message is not formatted on the calling thread. Otherwise the message is printed into a
+ * buffer of MAX_ERROR_MESSAGE_SIZE characters and reported with ReportError.
+ * @param[in] code the error code.
+ * @param[in] format the compiled message format.
+ * @param[in] clsName the name of the class reporting the error (may be NULL).
+ * @param[in] objName the name of the object reporting the error (may be NULL).
+ * @param[in] objPtr the pointer to the object reporting the error (may be NULL).
+ * @param[in] fileName the name of the file where the error was reported.
+ * @param[in] lineNumber the line where the error was reported.
+ * @param[in] functionName the name of the function where the error was reported.
+ * @param[in] par1..par10 the message parameters.
+ */
+DLL_API void ReportErrorCompiled(const ErrorType &code,
+                                 const CompiledFormat &format,
+                                 const char8 * const clsName,
+                                 const char8 * const objName,
+                                 const void * const objPtr,
+                                 const char8 * const fileName,
+                                 const int16 lineNumber,
+                                 const char8 * const functionName,
+                                 const AnyType &par1 = voidAnyType,
+                                 const AnyType &par2 = voidAnyType,
+                                 const AnyType &par3 = voidAnyType,
+                                 const AnyType &par4 = voidAnyType,
+                                 const AnyType &par5 = voidAnyType,
+                                 const AnyType &par6 = voidAnyType,
+                                 const AnyType &par7 = voidAnyType,
+                                 const AnyType &par8 = voidAnyType,
+                                 const AnyType &par9 = voidAnyType,
+                                 const AnyType &par10 = voidAnyType);
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* COMPILEDERRORREPORT_H_ */
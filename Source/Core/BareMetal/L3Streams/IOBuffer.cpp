@@ -1729,12 +1729,50 @@ bool IOBuffer::PrintFormatted(const char8 * format, const AnyType pars[]) {
     return ret;
 }
 
+bool IOBuffer::PrintFormatted(const CompiledFormat &format, const AnyType pars[]) {
+
+    bool ret = true;
+    if (!format.IsCompiled()) {
+        ret = PrintFormatted(format.GetFormat(), pars);
+    }
+    else {
+        // indicates active parameter
+        int32 parsIndex = 0;
+        uint32 numberOfDescriptors = format.GetNumberOfDescriptors();
+        for (uint32 i = 0u; ret && (i <= numberOfDescriptors); i++) {
+            uint32 literalSize;
+            const char8 *literal = format.GetLiteral(i, literalSize);
+            if (literalSize > 0u) {
+                // copy the literal in one go if it fits
+                if (AmountLeft() > (UndoLevel() + literalSize)) {
+                    ret = Write(literal, literalSize);
+                }
+                else {
+                    for (uint32 j = 0u; ret && (j < literalSize); j++) {
+                        ret = PutC(literal[j]);
+                    }
+                }
+            }
+            if ((ret) && (i < numberOfDescriptors)) {
+                // if void simply skip and continue
+                if (!pars[parsIndex].IsVoid()) {
+                    // use it to process parameters
+                    ret = PrintToStream(*this, pars[parsIndex], format.GetDescriptor(i));
+                    parsIndex++;
+                }
+            }
+        }
+    }
+    return ret;
+}
+
 bool IOBuffer::Seek(const uint32 position) {
     bool retval = (position <= UsedSize());
 
     if (retval) {
         amountLeft = MaxUsableAmount() - position;
-        positionPtr = &((BufferReference())[position]);
+        //The buffer may be read only (see SetBufferReadOnlyReferencedMemory)
+        positionPtr = &((const_cast<char8 *>(Buffer()))[position]);
     }
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "IOBuffer: Position in input greater than the buffer size");
@@ -1770,7 +1808,7 @@ bool IOBuffer::RelativeSeek(const int32 delta) {
             REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "IOBuffer: Final position less than zero: move to the beginning");
         }
         amountLeft += gap;
-        positionPtr = &((BufferReference())[Position() - gap]);
+        positionPtr = &((const_cast<char8 *>(Buffer()))[Position() - gap]);
     }
 
     return ret;
@@ -1841,6 +1879,25 @@ bool IOBuffer::SetBufferHeapMemory(const uint32 desiredSize, const uint32 reserv
     return ret;
 }
 
+void IOBuffer::SetBufferInlineMemory(char8 * const storage, const uint32 storageSize) {
+    internalBuffer.SetInlineStorage(storage, storageSize);
+}
+
+bool IOBuffer::TakeHeapMemory(IOBuffer &source) {
+    bool ok = internalBuffer.TakeHeapMemory(source.internalBuffer);
+    if (ok) {
+        maxUsableAmount = source.maxUsableAmount;
+        amountLeft = source.amountLeft;
+        fillLeft = source.fillLeft;
+        positionPtr = source.positionPtr;
+        source.maxUsableAmount = 0u;
+        source.amountLeft = 0u;
+        source.fillLeft = 0u;
+        source.positionPtr = static_cast<char8 *>(NULL);
+    }
+    return ok;
+}
+
 void IOBuffer::SetBufferReferencedMemory(char8 * const buffer, const uint32 bufferSize, const uint32 reservedSpaceAtEnd) {
     internalBuffer.SetBufferReference(buffer, bufferSize);
     positionPtr = BufferReference();
@@ -1920,6 +1977,18 @@ bool IOBuffer::Write(const char8 * const buffer, uint32 &size) {
     return retval;
 }
 
+bool IOBuffer::Commit(const uint32 size) {
+    bool retval = (internalBuffer.CanWrite()) && (size <= amountLeft);
+    if (retval) {
+        positionPtr = &positionPtr[size];
+        amountLeft -= size;
+        if (fillLeft > amountLeft) {
+            fillLeft = amountLeft;
+        }
+    }
+    return retval;
+}
+
 bool IOBuffer::WriteAll(const char8 * buffer, const uint32 &size) {
 
     bool retval = true;
@@ -36,6 +36,7 @@
 #include "HeapManager.h"
 #include "MemoryOperationsHelper.h"
 #include "AnyType.h"
+#include "CompiledFormat.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -161,6 +162,23 @@ public:
     virtual bool SetBufferHeapMemory(const uint32 desiredSize,
             const uint32 reservedSpaceAtEnd);
 
+    /**
+     * @brief Sets a memory area to be used by SetBufferHeapMemory instead of the heap for the small sizes.
+     * @see CharBuffer::SetInlineStorage
+     * @param[in] storage the memory area (shall live as long as this IOBuffer).
+     * @param[in] storageSize the size of \a storage.
+     */
+    void SetBufferInlineMemory(char8 * const storage,
+            const uint32 storageSize);
+
+    /**
+     * @brief Takes the heap memory, the filled size and the position of \a source, which is left without any memory.
+     * @see CharBuffer::TakeHeapMemory
+     * @param[in,out] source the IOBuffer whose memory is taken.
+     * @return true if \a source had heap memory allocated by itself, false otherwise (and nothing is done).
+     */
+    bool TakeHeapMemory(IOBuffer &source);
+
     /**
      * @brief Assigns a preallocated memory with read and write access.
      * @details Sets the buffer as empty and maxUsableAmount = (bufferSize - reservedSpaceAtEnd).
@@ -323,6 +341,17 @@ public:
     bool WriteAll(const char8 * buffer,
             const uint32 &size);
 
+    /**
+     * @brief Marks as written the size bytes which were directly copied in
+     * BufferReference() starting from the cursor position.
+     * @details Sets the cursor size positions forward and adjusts fillLeft and
+     * amountLeft as Write does, without copying any data.
+     * @param[in] size is the number of bytes written in place.
+     * @return false if CharBuffer::CanWrite returns false or if size is greater
+     * than amountLeft.
+     */
+    bool Commit(const uint32 size);
+
     /**
      * @brief Reads from this buffer to an output buffer.
      * @param[out] buffer is the output buffer where data must be written.
@@ -347,6 +376,19 @@ public:
     bool PrintFormatted(const char8 * format,
             const AnyType pars[]);
 
+    /**
+     * @brief Prints using a pre-compiled format.
+     * @details Copies the literal segments of \a format and calls the
+     * PrintToStream function with its format descriptors, without parsing
+     * the format string. If \a format is not compiled it falls back on
+     * PrintFormatted(format.GetFormat(), pars).
+     * @param[in] format is the pre-compiled printf-like format.
+     * @param[in] pars is a list of AnyType elements to print.
+     * @return false in case of errors.
+     */
+    bool PrintFormatted(const CompiledFormat &format,
+            const AnyType pars[]);
+
     /**
      * @brief Reads a token from the buffer and writes it on an output buffer.
      * @details Extracts a token from the buffer into a string data until a
@@ -33,6 +33,7 @@
 #include "FormatDescriptor.h"
 #include "IOBuffer.h"
 #include "BitSetToInteger.h"
+#include "MemoryOperationsHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -311,6 +312,422 @@ static inline void FastPowerOf10Private(T &output,
     }
 }
 
+/**
+ * @brief Number of characters needed to hold the shortest digits of any
+ * float32 or float64 (see ShortestDigitsPrivate).
+ */
+static const uint32 shortestDigitsMaximumSize = 18u;
+
+/**
+ * @brief Significands of the powers of ten 10^k, k = -348 + 8i, normalised
+ * to 64 bits and rounded to nearest.
+ */
+static const uint64 cachedPowersSignificand[] = {
+        0xFA8FD5A0081C0288ULL, 0xBAAEE17FA23EBF76ULL, 0x8B16FB203055AC76ULL,
+        0xCF42894A5DCE35EAULL, 0x9A6BB0AA55653B2DULL, 0xE61ACF033D1A45DFULL,
+        0xAB70FE17C79AC6CAULL, 0xFF77B1FCBEBCDC4FULL, 0xBE5691EF416BD60CULL,
+        0x8DD01FAD907FFC3CULL, 0xD3515C2831559A83ULL, 0x9D71AC8FADA6C9B5ULL,
+        0xEA9C227723EE8BCBULL, 0xAECC49914078536DULL, 0x823C12795DB6CE57ULL,
+        0xC21094364DFB5637ULL, 0x9096EA6F3848984FULL, 0xD77485CB25823AC7ULL,
+        0xA086CFCD97BF97F4ULL, 0xEF340A98172AACE5ULL, 0xB23867FB2A35B28EULL,
+        0x84C8D4DFD2C63F3BULL, 0xC5DD44271AD3CDBAULL, 0x936B9FCEBB25C996ULL,
+        0xDBAC6C247D62A584ULL, 0xA3AB66580D5FDAF6ULL, 0xF3E2F893DEC3F126ULL,
+        0xB5B5ADA8AAFF80B8ULL, 0x87625F056C7C4A8BULL, 0xC9BCFF6034C13053ULL,
+        0x964E858C91BA2655ULL, 0xDFF9772470297EBDULL, 0xA6DFBD9FB8E5B88FULL,
+        0xF8A95FCF88747D94ULL, 0xB94470938FA89BCFULL, 0x8A08F0F8BF0F156BULL,
+        0xCDB02555653131B6ULL, 0x993FE2C6D07B7FACULL, 0xE45C10C42A2B3B06ULL,
+        0xAA242499697392D3ULL, 0xFD87B5F28300CA0EULL, 0xBCE5086492111AEBULL,
+        0x8CBCCC096F5088CCULL, 0xD1B71758E219652CULL, 0x9C40000000000000ULL,
+        0xE8D4A51000000000ULL, 0xAD78EBC5AC620000ULL, 0x813F3978F8940984ULL,
+        0xC097CE7BC90715B3ULL, 0x8F7E32CE7BEA5C70ULL, 0xD5D238A4ABE98068ULL,
+        0x9F4F2726179A2245ULL, 0xED63A231D4C4FB27ULL, 0xB0DE65388CC8ADA8ULL,
+        0x83C7088E1AAB65DBULL, 0xC45D1DF942711D9AULL, 0x924D692CA61BE758ULL,
+        0xDA01EE641A708DEAULL, 0xA26DA3999AEF774AULL, 0xF209787BB47D6B85ULL,
+        0xB454E4A179DD1877ULL, 0x865B86925B9BC5C2ULL, 0xC83553C5C8965D3DULL,
+        0x952AB45CFA97A0B3ULL, 0xDE469FBD99A05FE3ULL, 0xA59BC234DB398C25ULL,
+        0xF6C69A72A3989F5CULL, 0xB7DCBF5354E9BECEULL, 0x88FCF317F22241E2ULL,
+        0xCC20CE9BD35C78A5ULL, 0x98165AF37B2153DFULL, 0xE2A0B5DC971F303AULL,
+        0xA8D9D1535CE3B396ULL, 0xFB9B7CD9A4A7443CULL, 0xBB764C4CA7A44410ULL,
+        0x8BAB8EEFB6409C1AULL, 0xD01FEF10A657842CULL, 0x9B10A4E5E9913129ULL,
+        0xE7109BFBA19C0C9DULL, 0xAC2820D9623BF429ULL, 0x80444B5E7AA7CF85ULL,
+        0xBF21E44003ACDD2DULL, 0x8E679C2F5E44FF8FULL, 0xD433179D9C8CB841ULL,
+        0x9E19DB92B4E31BA9ULL, 0xEB96BF6EBADF77D9ULL, 0xAF87023B9BF0EE6BULL };
+
+/**
+ * @brief Binary exponents of the powers of ten in cachedPowersSignificand.
+ */
+static const int16 cachedPowersExponent[] = {
+        -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980, -954, -927,
+        -901, -874, -847, -821, -794, -768, -741, -715, -688, -661, -635, -608,
+        -582, -555, -529, -502, -475, -449, -422, -396, -369, -343, -316, -289,
+        -263, -236, -210, -183, -157, -130, -103, -77, -50, -24, 3, 30,
+        56, 83, 109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+        375, 402, 428, 455, 481, 508, 534, 561, 588, 614, 641, 667,
+        694, 720, 747, 774, 800, 827, 853, 880, 907, 933, 960, 986,
+        1013, 1039, 1066 };
+
+/**
+ * @brief Powers of ten which fit in 32 bits.
+ */
+static const uint32 powersOf10Table32[] = { 1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u };
+
+/**
+ * @brief A number with a 64 bit unsigned significand and a binary exponent
+ * (significand * 2^exponent), used to generate the shortest digits.
+ */
+struct ExtendedFloatPrivate {
+    /**
+     * The significand.
+     */
+    uint64 significand;
+    /**
+     * The binary exponent.
+     */
+    int32 exponent;
+};
+
+/**
+ * @brief Multiplies two extended floats keeping the 64 most significant bits
+ * of the product (rounded to nearest).
+ * @param[in] x is the first operand.
+ * @param[in] y is the second operand.
+ * @return x * y.
+ */
+static inline ExtendedFloatPrivate ExtendedFloatMultiply(const ExtendedFloatPrivate &x,
+                                                         const ExtendedFloatPrivate &y) {
+    const uint64 mask32 = 0xFFFFFFFFULL;
+    uint64 a = x.significand >> 32u;
+    uint64 b = x.significand & mask32;
+    uint64 c = y.significand >> 32u;
+    uint64 d = y.significand & mask32;
+    uint64 ac = a * c;
+    uint64 bc = b * c;
+    uint64 ad = a * d;
+    uint64 bd = b * d;
+    // add half of the discarded part to round to nearest
+    uint64 middle = (bd >> 32u) + (ad & mask32) + (bc & mask32) + 0x80000000ULL;
+    ExtendedFloatPrivate product;
+    product.significand = ac + (ad >> 32u) + (bc >> 32u) + (middle >> 32u);
+    product.exponent = x.exponent + y.exponent + 64;
+    return product;
+}
+
+/**
+ * @brief Shifts the significand left until its most significant bit is set.
+ * @param[in,out] x is the extended float to normalise (significand != 0).
+ */
+static inline void ExtendedFloatNormalise(ExtendedFloatPrivate &x) {
+    while ((x.significand & 0x8000000000000000ULL) == 0u) {
+        x.significand <<= 1u;
+        x.exponent--;
+    }
+}
+
+/**
+ * @brief Decomposes a positive, finite and non zero float64 in its integer
+ * significand and binary exponent.
+ * @param[in] positiveNumber is the number to decompose.
+ * @param[out] value is the exact value of the number.
+ * @param[out] lowerBoundaryIsCloser is true when the number is a power of 2
+ * above the smallest normal, i.e. when the previous representable number is
+ * closer than the next one.
+ */
+static inline void ExtendedFloatDecompose(const float64 positiveNumber,
+                                          ExtendedFloatPrivate &value,
+                                          bool &lowerBoundaryIsCloser) {
+    uint64 bits = 0u;
+    (void) MemoryOperationsHelper::Copy(&bits, &positiveNumber, static_cast<uint32>(sizeof(float64)));
+    const uint64 hiddenBit = 0x0010000000000000ULL;
+    uint64 fraction = bits & (hiddenBit - 1u);
+    int32 biasedExponent = static_cast<int32>(bits >> 52u);
+    if (biasedExponent != 0) {
+        value.significand = fraction + hiddenBit;
+        value.exponent = biasedExponent - 1075;
+    }
+    else {
+        value.significand = fraction;
+        value.exponent = -1074;
+    }
+    lowerBoundaryIsCloser = (fraction == 0u) && (biasedExponent > 1);
+}
+
+/**
+ * @brief Decomposes a positive, finite and non zero float32 in its integer
+ * significand and binary exponent.
+ * @param[in] positiveNumber is the number to decompose.
+ * @param[out] value is the exact value of the number.
+ * @param[out] lowerBoundaryIsCloser is true when the number is a power of 2
+ * above the smallest normal, i.e. when the previous representable number is
+ * closer than the next one.
+ */
+static inline void ExtendedFloatDecompose(const float32 positiveNumber,
+                                          ExtendedFloatPrivate &value,
+                                          bool &lowerBoundaryIsCloser) {
+    uint32 bits = 0u;
+    (void) MemoryOperationsHelper::Copy(&bits, &positiveNumber, static_cast<uint32>(sizeof(float32)));
+    const uint32 hiddenBit = 0x00800000u;
+    uint32 fraction = bits & (hiddenBit - 1u);
+    int32 biasedExponent = static_cast<int32>(bits >> 23u);
+    if (biasedExponent != 0) {
+        value.significand = static_cast<uint64>(fraction + hiddenBit);
+        value.exponent = biasedExponent - 150;
+    }
+    else {
+        value.significand = static_cast<uint64>(fraction);
+        value.exponent = -149;
+    }
+    lowerBoundaryIsCloser = (fraction == 0u) && (biasedExponent > 1);
+}
+
+/**
+ * @brief Moves the last generated digit towards the exact value for as long
+ * as the digits stay inside the rounding interval.
+ * @param[in,out] digits are the generated digits.
+ * @param[in] numberOfDigits is the number of generated digits.
+ * @param[in] delta is the width of the rounding interval.
+ * @param[in] rest is the distance between the digits and the upper boundary.
+ * @param[in] tenKappa is the weight of the last digit.
+ * @param[in] distanceToUpper is the distance between the exact value and the
+ * upper boundary.
+ */
+static inline void ShortestDigitsRound(char8 * const digits,
+                                       const uint32 numberOfDigits,
+                                       const uint64 delta,
+                                       uint64 rest,
+                                       const uint64 tenKappa,
+                                       const uint64 distanceToUpper) {
+    while ((rest < distanceToUpper) && ((delta - rest) >= tenKappa)
+            && (((rest + tenKappa) < distanceToUpper) || ((distanceToUpper - rest) > ((rest + tenKappa) - distanceToUpper)))) {
+        digits[numberOfDigits - 1u]--;
+        rest += tenKappa;
+    }
+}
+
+/**
+ * @brief Computes the shortest sequence of decimal digits which reads back
+ * as the same number.
+ * @details Implements the Grisu2 algorithm (F. Loitsch, "Printing
+ * Floating-Point Numbers Quickly and Accurately with Integers", PLDI 2010)
+ * using only 64 bit integer arithmetic. The boundaries of the interval of the
+ * numbers that round to positiveNumber are scaled by a cached power of ten and
+ * the digits are extracted until they identify a number inside the interval.
+ * The result always reads back as positiveNumber and is the shortest such
+ * sequence in the vast majority of the cases. Contrary to the repeated
+ * multiplication by 10 of the normalised number no rounding error is
+ * accumulated.
+ * @param[in] positiveNumber is the number to convert (positive, finite and
+ * not zero).
+ * @param[out] digits receives the digits (at least shortestDigitsMaximumSize
+ * characters, not terminated).
+ * @param[out] exponent is the exponent of the first digit, i.e. the number is
+ * digits[0].digits[1]digits[2]... * 10^exponent.
+ * @return the number of digits generated.
+ */
+/*lint -e{1573} [MISRA C++ Rule 14-5-1]. Justification: MARTe::HighResolutionTimerCalibrator is not a possible argument for this function template.*/
+template<typename T>
+static uint32 ShortestDigitsPrivate(const T positiveNumber,
+                                    char8 * const digits,
+                                    int16 &exponent) {
+    ExtendedFloatPrivate value;
+    bool lowerBoundaryIsCloser;
+    ExtendedFloatDecompose(positiveNumber, value, lowerBoundaryIsCloser);
+
+    // boundaries of the interval of the numbers which round to value
+    ExtendedFloatPrivate upper;
+    upper.significand = (value.significand << 1u) + 1u;
+    upper.exponent = value.exponent - 1;
+    ExtendedFloatNormalise(upper);
+    ExtendedFloatPrivate lower;
+    if (lowerBoundaryIsCloser) {
+        lower.significand = (value.significand << 2u) - 1u;
+        lower.exponent = value.exponent - 2;
+    }
+    else {
+        lower.significand = (value.significand << 1u) - 1u;
+        lower.exponent = value.exponent - 1;
+    }
+    lower.significand <<= static_cast<uint32>(lower.exponent - upper.exponent);
+    lower.exponent = upper.exponent;
+    ExtendedFloatNormalise(value);
+
+    // choose the cached 10^-k which brings the exponent of the scaled upper boundary in [-60, -32]
+    float64 approximateK = (static_cast<float64>(-61 - upper.exponent) * 0.30102999566398114) + 347.0;
+    int32 k = static_cast<int32>(approximateK);
+    if (approximateK > static_cast<float64>(k)) {
+        k++;
+    }
+    uint32 index = static_cast<uint32>((k / 8) + 1);
+    int32 decimalExponent = 348 - static_cast<int32>(index * 8u);
+    ExtendedFloatPrivate cachedPower;
+    cachedPower.significand = cachedPowersSignificand[index];
+    cachedPower.exponent = static_cast<int32>(cachedPowersExponent[index]);
+
+    ExtendedFloatPrivate scaledValue = ExtendedFloatMultiply(value, cachedPower);
+    ExtendedFloatPrivate scaledUpper = ExtendedFloatMultiply(upper, cachedPower);
+    ExtendedFloatPrivate scaledLower = ExtendedFloatMultiply(lower, cachedPower);
+    // shrink the interval to absorb the error of the multiplications
+    scaledLower.significand++;
+    scaledUpper.significand--;
+
+    // split the scaled upper boundary in integer and fractional part
+    uint32 fractionBits = static_cast<uint32>(-scaledUpper.exponent);
+    uint64 one = static_cast<uint64>(1u) << fractionBits;
+    uint64 delta = scaledUpper.significand - scaledLower.significand;
+    uint64 distanceToUpper = scaledUpper.significand - scaledValue.significand;
+    uint32 integerPart = static_cast<uint32>(scaledUpper.significand >> fractionBits);
+    uint64 fractionalPart = scaledUpper.significand & (one - 1u);
+
+    // number of digits of the integer part
+    int32 kappa = 10;
+    while ((kappa > 1) && (integerPart < powersOf10Table32[kappa - 1])) {
+        kappa--;
+    }
+
+    uint32 numberOfDigits = 0u;
+    bool done = false;
+    while ((!done) && (kappa > 0)) {
+        uint32 divisor = powersOf10Table32[kappa - 1];
+        uint32 digit = integerPart / divisor;
+        integerPart %= divisor;
+        if ((digit != 0u) || (numberOfDigits != 0u)) {
+            digits[numberOfDigits] = static_cast<char8>(static_cast<uint32>('0') + digit);
+            numberOfDigits++;
+        }
+        kappa--;
+        uint64 rest = (static_cast<uint64>(integerPart) << fractionBits) + fractionalPart;
+        if (rest <= delta) {
+            decimalExponent += kappa;
+            ShortestDigitsRound(digits, numberOfDigits, delta, rest, static_cast<uint64>(powersOf10Table32[kappa]) << fractionBits, distanceToUpper);
+            done = true;
+        }
+    }
+    while (!done) {
+        fractionalPart *= 10u;
+        delta *= 10u;
+        uint32 digit = static_cast<uint32>(fractionalPart >> fractionBits);
+        if ((digit != 0u) || (numberOfDigits != 0u)) {
+            digits[numberOfDigits] = static_cast<char8>(static_cast<uint32>('0') + digit);
+            numberOfDigits++;
+        }
+        fractionalPart &= (one - 1u);
+        kappa--;
+        if (fractionalPart < delta) {
+            decimalExponent += kappa;
+            uint32 scale = static_cast<uint32>(-kappa);
+            uint64 scaledDistance = (scale < 10u) ? (distanceToUpper * powersOf10Table32[scale]) : 0u;
+            ShortestDigitsRound(digits, numberOfDigits, delta, fractionalPart, one, scaledDistance);
+            done = true;
+        }
+    }
+
+    // the trailing zeros are not significant
+    while ((numberOfDigits > 1u) && (digits[numberOfDigits - 1u] == '0')) {
+        numberOfDigits--;
+        decimalExponent++;
+    }
+
+    // the number is digits * 10^decimalExponent
+    exponent = static_cast<int16>(decimalExponent + (static_cast<int32>(numberOfDigits) - 1));
+    return numberOfDigits;
+}
+
+/**
+ * @brief Produces the digits of a normalised number in [0, 10) by repeated
+ * multiplication by 10.
+ */
+template<typename T>
+class ScaledDigitsPrivate {
+public:
+    /**
+     * @brief Constructor.
+     * @param[in] normalizedNumber is the normalised number.
+     */
+    explicit ScaledDigitsPrivate(const T normalizedNumber) :
+            number(normalizedNumber) {
+    }
+
+    /**
+     * @brief Checks that the number is in the [0, 10) range.
+     * @return true if the number is in the [0, 10) range.
+     */
+    bool IsValid() const {
+        return (number >= static_cast<T>(0.0)) && (number < static_cast<T>(10.0));
+    }
+
+    /**
+     * @brief Gets the next digit and shifts the number.
+     * @return the next digit.
+     */
+    int8 NextDigit() {
+        int8 digit = static_cast<int8>(number);
+        number -= static_cast<T>(digit);
+        number *= static_cast<T>(10.0);
+        return digit;
+    }
+
+private:
+    /**
+     * The remaining part of the number.
+     */
+    T number;
+};
+
+/**
+ * @brief Produces the digits computed by ShortestDigitsPrivate, followed by
+ * zeros.
+ */
+class ShortestDigitsSourcePrivate {
+public:
+    /**
+     * @brief Constructor.
+     * @param[in] digitsIn are the digits.
+     * @param[in] numberOfDigitsIn is the number of digits.
+     */
+    ShortestDigitsSourcePrivate(const char8 * const digitsIn,
+                                const uint32 numberOfDigitsIn) :
+            digits(digitsIn),
+            numberOfDigits(numberOfDigitsIn),
+            index(0u) {
+    }
+
+    /**
+     * @brief The digits are always valid.
+     * @return true.
+     */
+    bool IsValid() const {
+        return true;
+    }
+
+    /**
+     * @brief Gets the next digit.
+     * @return the next digit or 0 after the last digit.
+     */
+    int8 NextDigit() {
+        int8 digit = 0;
+        if (index < numberOfDigits) {
+            digit = static_cast<int8>(digits[index] - '0');
+            index++;
+        }
+        return digit;
+    }
+
+private:
+    /**
+     * The digits.
+     */
+    const char8 *digits;
+
+    /**
+     * The number of digits.
+     */
+    uint32 numberOfDigits;
+
+    /**
+     * The next digit to produce.
+     */
+    uint32 index;
+};
+
 /**
  * @brief Rapid determination of size of the exponent.
  * @param[in] exponent is the exponent parameter.
@@ -938,14 +1355,15 @@ namespace MARTe {
  * fixed format. PositiveNumber is not 0 nor NaN nor Inf and is positive,
  * precision should be strictly positive.
  * @param[out] ioBuffer is the generic ioBuffer.
- * @param[in] positiveNumber is the absolute value of the normalized number.
+ * @param[in] positiveNumber produces the digits of the absolute value of the
+ * normalized number (ScaledDigitsPrivate or ShortestDigitsSourcePrivate).
  * @param[in] exponent is the exponent of the number.
  * @param[in] precision is the number of first significative digits to print.
  * @return false only in case of incorrect digits.
  */
-template<typename T>
+template<typename DigitsSource>
 bool FloatToFixedPrivate(IOBuffer & ioBuffer,
-                         T positiveNumber,
+                         DigitsSource positiveNumber,
                          int16 exponent,
                          int16 precision) {
 
@@ -954,7 +1372,7 @@ bool FloatToFixedPrivate(IOBuffer & ioBuffer,
 // impossible
 // should never be called like this
 // better handle it anyway
-    if ((positiveNumber < static_cast<T>(0.0)) || (positiveNumber >= static_cast<T>(10.0))) {
+    if (!positiveNumber.IsValid()) {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError,"IOBufferFloatPrint: The normalized number must be in [0, 10) range!");
         if (!ioBuffer.PutC('!')) {
             REPORT_ERROR_STATIC_0(ErrorManagement::FatalError,"IOBufferFloatPrint: Failed IOBuffer::PutC()");
@@ -1010,9 +1428,7 @@ bool FloatToFixedPrivate(IOBuffer & ioBuffer,
             }
             else {
                 // get a digit and shift the number
-                int8 digit = static_cast<int8>(positiveNumber);
-                positiveNumber -= static_cast<T>(digit);
-                positiveNumber *= static_cast<T>(10.0);
+                int8 digit = positiveNumber.NextDigit();
 
                 int8 zero = static_cast<int8>('0');
                 if (!ioBuffer.PutC(static_cast<char8>(zero + digit))) {
@@ -1039,15 +1455,15 @@ bool FloatToFixedPrivate(IOBuffer & ioBuffer,
  * @param[in] notation is the desired notation.
  * @param[out] ioBuffer is the generic ioBuffer (any class with a
  * PutC(char8 c) method )
- * @param[in] normalizedNumber is the normalized number.
+ * @param[in] normalizedNumber produces the digits of the normalized number.
  * @param[in] exponent is the exponent of the number.
  * @param[in] precision is the number of the first significative
  * digits to print.
  */
-template<typename T>
+template<typename DigitsSource>
 bool FloatToStreamPrivate(const FloatNotation &notation,
                           IOBuffer & ioBuffer,
-                          const T normalizedNumber,
+                          const DigitsSource &normalizedNumber,
                           int16 exponent,
                           const int16 precision) {
 
@@ -1307,6 +1723,30 @@ bool FloatToStreamPrivate(IOBuffer & ioBuffer,
 // if found them then mode and size are assigned
     FloatDisplayModes chosenMode = CheckNumber(number, maximumSize, numberSize);
 
+// with the default precision print the shortest digits which read back as
+// the same number (for fixed point the precision is the number of decimals)
+    bool useShortestDigits = (chosenMode == NoFormat) && (format.precision == defaultPrecision) && (format.floatNotation != FixedPointNotation);
+    char8 shortestDigits[shortestDigitsMaximumSize];
+    uint32 numberOfShortestDigits = 0u;
+    if (useShortestDigits) {
+        numberOfShortestDigits = ShortestDigitsPrivate(positiveNumber, &shortestDigits[0], exponent);
+        precision = static_cast<int16>(numberOfShortestDigits);
+
+        // work out the number size
+        uint8 notation = static_cast<uint8>(format.floatNotation);
+        numberSize = NumberOfDigitsNotation(notation, exponent, hasSign, precision, maximumSize);
+
+        // the digits are exact and need no rounding up, unless they have to be clipped to fit
+        useShortestDigits = (precision == static_cast<int16>(numberOfShortestDigits));
+        if (useShortestDigits) {
+            chosenMode = Normal;
+        }
+        else {
+            precision = formatPrecision;
+            exponent = 0;
+        }
+    }
+
 // no chosen mode yet try all formats
     if (chosenMode == NoFormat) {
 
@@ -1414,8 +1854,17 @@ bool FloatToStreamPrivate(IOBuffer & ioBuffer,
             }
         }
         uint8 notation = static_cast<uint8>(format.floatNotation);
-        if (!FloatToStreamPrivate(notation, ioBuffer, positiveNumber, exponent, precision)) {
-            ok = false;
+        if (useShortestDigits) {
+            ShortestDigitsSourcePrivate digits(&shortestDigits[0], numberOfShortestDigits);
+            if (!FloatToStreamPrivate(notation, ioBuffer, digits, exponent, precision)) {
+                ok = false;
+            }
+        }
+        else {
+            ScaledDigitsPrivate<T> digits(positiveNumber);
+            if (!FloatToStreamPrivate(notation, ioBuffer, digits, exponent, precision)) {
+                ok = false;
+            }
         }
     }
         break;
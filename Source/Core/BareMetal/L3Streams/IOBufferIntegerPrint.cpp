@@ -452,6 +452,64 @@ static bool PutS(IOBuffer &ioBuffer,
     return ok;
 }
 
+/**
+ * @brief The decimal representation of all the numbers in [0, 99] as pairs of
+ * characters.
+ */
+static const char8 decimalDigitPairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+/**
+ * @brief Converts a positive integer to its decimal digits.
+ * @details The digits are produced two at a time from the right using the
+ * decimalDigitPairs table, which halves the number of divisions. Divisions
+ * on 64 bits are only used while the number does not fit in 32 bits.
+ * @param[in] positiveNumber is the number to convert.
+ * @param[out] digits receives the digits (not terminated), right aligned in
+ * its 20 characters.
+ * @return the index of the first digit in digits.
+ */
+static inline uint32 Number2DecimalDigitsPrivate(uint64 positiveNumber,
+                                                 char8 (&digits)[20]) {
+    uint32 index = 20u;
+    while (positiveNumber > 0xFFFFFFFFULL) {
+        /*lint -e{9125} [MISRA C++ Rule 5-0-9]. Justification: the result is always in [0-99] */
+        uint32 pair = static_cast<uint32>(positiveNumber % 100u) * 2u;
+        positiveNumber /= 100u;
+        index -= 2u;
+        digits[index] = decimalDigitPairs[pair];
+        digits[index + 1u] = decimalDigitPairs[pair + 1u];
+    }
+    uint32 number = static_cast<uint32>(positiveNumber);
+    while (number >= 100u) {
+        uint32 pair = (number % 100u) * 2u;
+        number /= 100u;
+        index -= 2u;
+        digits[index] = decimalDigitPairs[pair];
+        digits[index + 1u] = decimalDigitPairs[pair + 1u];
+    }
+    if (number >= 10u) {
+        uint32 pair = number * 2u;
+        index -= 2u;
+        digits[index] = decimalDigitPairs[pair];
+        digits[index + 1u] = decimalDigitPairs[pair + 1u];
+    }
+    else {
+        index--;
+        digits[index] = static_cast<char8>(static_cast<uint32>('0') + number);
+    }
+    return index;
+}
+
 /**
  * @brief Print on a general ioBuffer using a specific format.
  * @details Converts any integer type, signed and unsigned to a sequence of
@@ -756,7 +814,20 @@ bool IntegerToStreamDecimalNotation(IOBuffer &ioBuffer,
             }
 
             // put number
-            Number2StreamDecimalNotationPrivate(ioBuffer, positiveNumber);
+            // if the digits fit in the free space of the buffer convert them
+            // all at once and copy them, otherwise output them one by one
+            if (ioBuffer.AmountLeft() > (ioBuffer.UndoLevel() + static_cast<uint32>(numberSize))) {
+                char8 digits[20];
+                uint32 first = Number2DecimalDigitsPrivate(static_cast<uint64>(positiveNumber), digits);
+                uint32 writeSize = 20u - first;
+                if (!ioBuffer.Write(&digits[first], writeSize)) {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "IOBufferIntegerPrint: Failed IOBuffer::Write()");
+                    ok = false;
+                }
+            }
+            else {
+                Number2StreamDecimalNotationPrivate(ioBuffer, positiveNumber);
+            }
         }
 
         // fill up from numberSize to maximumSize with ' '
@@ -65,4 +65,8 @@ bool PrinterI::PrintEnd() {
     return true;
 }
 
+bool PrinterI::PrintNewLine() {
+    return stream->Printf("%s", "\n\r");
+}
+
 }
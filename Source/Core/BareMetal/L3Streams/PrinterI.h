@@ -194,6 +194,15 @@ public:
      */
     virtual bool PrintEnd();
 
+    /**
+     * @brief Prints the line break written before each variable and block.
+     * @details The default implementation prints "\n\r".
+     * @return true if the print succeeds, false otherwise.
+     * @pre
+     *   stream != NULL
+     */
+    virtual bool PrintNewLine();
+
 protected:
 
     /**
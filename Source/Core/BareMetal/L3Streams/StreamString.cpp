@@ -105,6 +105,44 @@ StreamString::StreamString(const StreamString &toCopy) :
     }
 }
 
+#ifdef MARTe2_CXX11
+/*lint -e{1738} . Justification: StreamI is only an interface there is nothing to be moved. */
+StreamString::StreamString(StreamString &&toMove) :
+        BufferedStreamI() {
+    //Initialise and terminate an empty string (no heap memory is allocated)
+    bool ret;
+    ret = buffer.SetBufferAllocationSize(0u);
+
+    if (!ret) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "StreamString: Failed initialization of the StreamString buffer during construction.");
+    }
+    (*this) = static_cast<StreamString &&>(toMove);
+}
+
+StreamString& StreamString::operator=(StreamString &&s) {
+    if (&s != this) {
+        bool ok;
+        if (buffer.TakeHeapMemory(s.buffer)) {
+            //As after Set, the position is at the end of the string
+            ok = buffer.Seek(buffer.UsedSize());
+            if (ok) {
+                //Leave s as an empty string
+                ok = s.buffer.SetBufferAllocationSize(0u);
+            }
+        }
+        else {
+            ok = Set(s);
+            s.buffer.Empty();
+            s.buffer.Terminate();
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "StreamString: Failed to move the string");
+        }
+    }
+    return *this;
+}
+#endif
+
 StreamString::operator AnyType() {
     void *dataPointer = static_cast<void *>(this);
     TypeDescriptor dataDescriptor(false, SString, static_cast<uint16>(sizeof(StreamString) * 8u));
@@ -199,6 +237,14 @@ bool StreamString::SetSize(const uint64 size) {
     return buffer.SetBufferAllocationSize(static_cast<uint32>(size));
 }
 
+bool StreamString::Reserve(const uint32 capacity) {
+    bool ok = true;
+    if (capacity > buffer.MaxUsableAmount()) {
+        ok = buffer.SetBufferAllocationSize(capacity);
+    }
+    return ok;
+}
+
 bool StreamString::CanSeek() const {
     return true;
 }
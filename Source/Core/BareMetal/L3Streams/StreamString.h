@@ -107,6 +107,15 @@ public:
      */
     StreamString(const StreamString &toCopy);
 
+#ifdef MARTe2_CXX11
+    /**
+     * @brief Move Constructor.
+     * @details Takes the heap memory of \a toMove (the short strings, see StreamStringIOBuffer, are copied).
+     * @param[in] toMove the StreamString to be moved. It is left empty.
+     */
+    StreamString(StreamString &&toMove);
+#endif
+
     /**
      * @brief Destructor
      */
@@ -216,6 +225,14 @@ public:
      */
     virtual bool SetSize(const uint64 size);
 
+    /**
+     * @brief Allocates the memory for a string of \a capacity characters without changing the content.
+     * @details Avoids the reallocations when a string of a known (or maximum) size is built by appending.
+     * @param[in] capacity the number of characters (without the final '\0') to be written without any reallocation.
+     * @return false in case of errors in the allocation.
+     */
+    bool Reserve(const uint32 capacity);
+
     /*---------------------------------------------------------------------------*/
 
     /**
@@ -275,6 +292,15 @@ public:
      */
     inline StreamString& operator=(const StreamString &s);
 
+#ifdef MARTe2_CXX11
+    /**
+     * @brief Takes the content of the input parameter (see StreamString(StreamString &&)).
+     * @param[in] s The StreamString to move. It is left empty.
+     * @return a reference to this StreamString.
+     */
+    StreamString& operator=(StreamString &&s);
+#endif
+
     /**
      * @brief Concatenate the character to the string contained in the buffer.
      * @param[in] c The character to concatenate.
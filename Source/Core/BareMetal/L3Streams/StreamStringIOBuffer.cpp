@@ -44,12 +44,12 @@ namespace MARTe {
 
 StreamStringIOBuffer::StreamStringIOBuffer() :
         IOBuffer(64u, 0u) {
-
+    SetBufferInlineMemory(&inlineMemory[0], STREAM_STRING_INLINE_SIZE);
 }
 
 StreamStringIOBuffer::StreamStringIOBuffer(const uint32 granularity) :
         IOBuffer(granularity, 0u) {
-
+    SetBufferInlineMemory(&inlineMemory[0], STREAM_STRING_INLINE_SIZE);
 }
 
 StreamStringIOBuffer::~StreamStringIOBuffer() {
@@ -80,7 +80,7 @@ bool StreamStringIOBuffer::Write(const char8 * const buffer,
     bool ret = true;
 
     if (size > AmountLeft()) {
-        ret = SetBufferAllocationSize(Position() + size);
+        ret = Grow(Position() + size);
     }
 
     if (ret) {
@@ -97,7 +97,7 @@ bool StreamStringIOBuffer::NoMoreSpaceToWrite() {
     // reallocate buffer
     // uses safe version of the function
     // implemented in this class
-    ret = SetBufferAllocationSize(GetBufferSize() + 1u);
+    ret = Grow(GetBufferSize() + 1u);
 
     return ret;
 }
@@ -109,11 +109,21 @@ bool StreamStringIOBuffer::NoMoreSpaceToWrite(const uint32 neededSize) {
     // reallocate buffer
     // uses safe version of the function
     // implemented in this class
-    ret = SetBufferAllocationSize(GetBufferSize() + neededSize);
+    ret = Grow(GetBufferSize() + neededSize);
 
     return ret;
 }
 
+bool StreamStringIOBuffer::Grow(const uint32 desiredSize) {
+    uint32 bufferSize = GetBufferSize();
+    uint32 grownSize = bufferSize + (bufferSize / 2u);
+    //Saturate on overflow
+    if (grownSize < bufferSize) {
+        grownSize = desiredSize;
+    }
+    return SetBufferAllocationSize((desiredSize > grownSize) ? (desiredSize) : (grownSize));
+}
+
 void StreamStringIOBuffer::Terminate() {
     if (BufferReference() != NULL) {
         BufferReference()[UsedSize()] = '\0';
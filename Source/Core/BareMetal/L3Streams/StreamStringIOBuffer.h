@@ -43,6 +43,12 @@
 
 namespace MARTe {
 
+/**
+ * Size of the memory inside each StreamStringIOBuffer used for the short strings (including the final '\0'), before
+ * any heap memory is allocated.
+ */
+const uint32 STREAM_STRING_INLINE_SIZE = 32u;
+
 /**
  * @brief The StreamString buffer.
  *
@@ -51,6 +57,11 @@ namespace MARTe {
  *
  * For memory allocations it adds one to the desired size passed by argument and sets reservedSpaceAtEnd = 1 for the
  * final '\0' character.
+ *
+ * Strings with up to STREAM_STRING_INLINE_SIZE - 1 characters are stored inside the object, so that the short strings
+ * (e.g. the object and signal names) do not allocate any heap memory. Longer strings are allocated on the heap and
+ * the writes beyond the end of the buffer grow it geometrically (by one half of its size), so that a string built
+ * by appending is reallocated a logarithmic number of times.
  */
 class DLL_API StreamStringIOBuffer: public IOBuffer {
 
@@ -126,6 +137,20 @@ public:
      */
     virtual bool NoMoreSpaceToWrite(const uint32 neededSize);
 
+private:
+
+    /**
+     * @brief Grows the buffer to at least \a desiredSize characters, or by one half of its size if larger.
+     * @param[in] desiredSize the minimum number of characters (without the final '\0').
+     * @return false in case of errors in the allocation.
+     */
+    bool Grow(const uint32 desiredSize);
+
+    /**
+     * The memory used for the short strings.
+     */
+    char8 inlineMemory[STREAM_STRING_INLINE_SIZE];
+
 };
 
 }
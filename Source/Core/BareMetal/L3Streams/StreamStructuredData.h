@@ -245,6 +245,16 @@ protected:
      * Used to check if a block is closed or not.
      */
     bool blockCloseState;
+
+    /**
+     * @brief Gets the descriptors of the nodes of a path.
+     * @details Each node is searched by name in its parent (see ReferenceContainer::Find(const char8 * const, const bool)), so that the
+     * cost does not grow with the number of blocks already written (as it would with a ReferenceContainerFilter on the whole tree).
+     * @param[in] path the path of the node, with the names separated by '.'.
+     * @param[out] nodes where the descriptors are inserted, from the first node after the root to the node itself (empty if the path does not exist).
+     */
+    void FindNodes(const char8 * const path,
+                   ReferenceContainer &nodes);
 };
 
 }
@@ -313,7 +323,7 @@ bool StreamStructuredData<Printer>::Write(const char8 * const name, const AnyTyp
     }
     if (ret) {
         currentNode->needsSeparatorBeforeNextBlock = true;
-        ret = stream->Printf("%s", "\n\r");
+        ret = printer.PrintNewLine();
     }
     if (ret) {
         //use custom component to print
@@ -354,9 +364,8 @@ bool StreamStructuredData<Printer>::MoveToRoot() {
     //find the last node by path
     //close the nodes along the path
 
-    ReferenceContainerFilterReferences filter(1, ReferenceContainerFilterMode::PATH, currentNode);
     ReferenceContainer path;
-    treeDescriptor->Find(path, filter);
+    FindNodes(currentPath.Buffer(), path);
 
     uint32 pathSize = path.Size();
     bool ret = (pathSize > 0u);
@@ -365,7 +374,7 @@ bool StreamStructuredData<Printer>::MoveToRoot() {
         ret = ref.IsValid();
         if (ret) {
             ref->isClosed = 1u;
-            ret = stream->Printf("%s", "\n\r");
+            ret = printer.PrintNewLine();
             if (ret) {
                 ret = printer.PrintCloseBlock(ref->GetName());
                 blockCloseState = true;
@@ -390,9 +399,8 @@ bool StreamStructuredData<Printer>::MoveToAncestor(uint32 generations) {
     bool ret = true;
     if (generations > 0u) {
 
-        ReferenceContainerFilterReferences filter(1, ReferenceContainerFilterMode::PATH, currentNode);
         ReferenceContainer path;
-        treeDescriptor->Find(path, filter);
+        FindNodes(currentPath.Buffer(), path);
 
         uint32 pathSize = path.Size();
         ret = (pathSize >= generations);
@@ -418,7 +426,7 @@ bool StreamStructuredData<Printer>::MoveToAncestor(uint32 generations) {
                 ret = (ref.IsValid());
                 if (ret) {
                     ref->isClosed = 1u;
-                    ret = stream->Printf("%s", "\n\r");
+                    ret = printer.PrintNewLine();
                 }
                 if (ret) {
                     ret = printer.PrintCloseBlock(ref->GetName());
@@ -450,9 +458,8 @@ bool StreamStructuredData<Printer>::MoveToAncestor(uint32 generations) {
 template<class Printer>
 bool StreamStructuredData<Printer>::MoveAbsolute(const char8 * const path) {
 
-    ReferenceContainerFilterObjectName filterDest(1, ReferenceContainerFilterMode::SHALLOW, path);
     ReferenceContainer resultDest;
-    treeDescriptor->Find(resultDest, filterDest);
+    FindNodes(path, resultDest);
 
     uint32 pathDestSize = resultDest.Size();
     bool ret = (pathDestSize > 0u);
@@ -464,9 +471,8 @@ bool StreamStructuredData<Printer>::MoveAbsolute(const char8 * const path) {
         }
         if (ret) {
 
-            ReferenceContainerFilterReferences filter(1, ReferenceContainerFilterMode::PATH, currentNode);
             ReferenceContainer result;
-            treeDescriptor->Find(result, filter);
+            FindNodes(currentPath.Buffer(), result);
 
             uint32 pathSize = result.Size();
 
@@ -498,7 +504,7 @@ bool StreamStructuredData<Printer>::MoveAbsolute(const char8 * const path) {
                     ret = (ref.IsValid());
                     if (ret) {
                         ref->isClosed = 1u;
-                        ret = stream->Printf("%s", "\n\r");
+                        ret = printer.PrintNewLine();
                         if (ret) {
                             ret = printer.PrintCloseBlock(ref->GetName());
                             blockCloseState = true;
@@ -519,7 +525,7 @@ bool StreamStructuredData<Printer>::MoveAbsolute(const char8 * const path) {
                         }
                     }
                     if (ret) {
-                        ret = stream->Printf("%s", "\n\r");
+                        ret = printer.PrintNewLine();
                     }
                     if (ret) {
                         if (currentNode->needsSeparatorBeforeNextBlock) {
@@ -582,7 +588,7 @@ bool StreamStructuredData<Printer>::MoveToChild(const uint32 childIdx) {
         ret = (child->isClosed == 0u);
     }
     if (ret) {
-        ret = stream->Printf("%s", "\n\r");
+        ret = printer.PrintNewLine();
     }
     if (ret) {
         ret = printer.PrintOpenBlock(child->GetName());
@@ -590,6 +596,9 @@ bool StreamStructuredData<Printer>::MoveToChild(const uint32 childIdx) {
         blockCloseState = false;
     }
     if (ret) {
+        if (currentPath.Size() > 0u) {
+            currentPath += ".";
+        }
         currentPath += child->GetName();
         currentNode = child;
         stream->Flush();
@@ -609,17 +618,10 @@ bool StreamStructuredData<Printer>::CreateAbsolute(const char8 * const path) {
     StreamString token;
     bool ret = true;
     while ((pathStr.GetToken(token, ".", terminator)) && (ret)) {
-        uint32 nodeSize = node->Size();
-        bool found = false;
-        for (uint32 i = 0u; (i < nodeSize) && (ret) && (!found); i++) {
-            ReferenceT<StreamStructuredDataNodeDes> child = node->Get(i);
-            ret = child.IsValid();
-            if (ret) {
-                found = (token == child->GetName());
-                if (found) {
-                    node = child;
-                }
-            }
+        ReferenceT<StreamStructuredDataNodeDes> child = node->Find(token.Buffer());
+        bool found = child.IsValid();
+        if (found) {
+            node = child;
         }
         if ((ret) && (!found)) {
             //create the node
@@ -685,6 +687,29 @@ Printer *StreamStructuredData<Printer>::GetPrinter() {
     return &printer;
 }
 
+template<class Printer>
+void StreamStructuredData<Printer>::FindNodes(const char8 * const path,
+                                              ReferenceContainer &nodes) {
+    ReferenceContainer found;
+    StreamString pathStr = path;
+    bool ret = pathStr.Seek(0u);
+    ReferenceT<StreamStructuredDataNodeDes> node = treeDescriptor;
+    char8 terminator;
+    StreamString token;
+    while ((ret) && (pathStr.GetToken(token, ".", terminator))) {
+        node = node->Find(token.Buffer());
+        ret = node.IsValid();
+        if (ret) {
+            ret = found.Insert(node);
+        }
+        token.SetSize(0u);
+    }
+    uint32 nOfNodes = found.Size();
+    for (uint32 i = 0u; (i < nOfNodes) && (ret); i++) {
+        ret = nodes.Insert(found.Get(i));
+    }
+}
+
 }
 
 /*---------------------------------------------------------------------------*/
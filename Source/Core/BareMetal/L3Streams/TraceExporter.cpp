@@ -0,0 +1,133 @@
+/**
+ * @file TraceExporter.cpp
+ * @brief Source file for module TraceExporter
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module TraceExporter (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "HighResolutionTimer.h"
+#include "TraceExporter.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace TraceExporter {
+
+/**
+ * The Chrome phase of each event type (B: begin, E: end, i: instant), indexed by Trace::EVENT_.
+ */
+static const char8 * const tracePhases[] = { "i", "B", "E", "B", "E", "i", "B", "E", "B", "E" };
+
+/**
+ * The Chrome category of each event type, indexed by Trace::EVENT_.
+ */
+static const char8 * const traceCategories[] = { "Unknown", "Cycle", "Cycle", "Executable", "Executable", "State", "Broker", "Broker", "Semaphore",
+        "Semaphore" };
+
+/**
+ * Number of elements in tracePhases and traceCategories.
+ */
+static const uint16 TRACE_NUMBER_OF_TYPES = 10u;
+
+/**
+ * @brief Writes one event as a Chrome trace event.
+ */
+static bool WriteEvent(BufferedStreamI &stream,
+                       const TraceEvent &event,
+                       const uint32 processId,
+                       const uint32 threadId,
+                       const bool first) {
+    uint16 type = event.type;
+    if (type >= TRACE_NUMBER_OF_TYPES) {
+        type = 0u;
+    }
+    uint64 frequency = HighResolutionTimer::Frequency();
+    uint64 nanoseconds = ((event.ticks / frequency) * 1000000000ULL) + (((event.ticks % frequency) * 1000000000ULL) / frequency);
+    const char8 *separator = ",\n";
+    if (first) {
+        separator = "\n";
+    }
+    bool ok = stream.Printf("%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%s\",\"ts\":%u.%03u,\"pid\":%u,\"tid\":%u", separator,
+                            Trace::GetName(event.nameId), traceCategories[type], tracePhases[type], nanoseconds / 1000ULL,
+                            static_cast<uint32>(nanoseconds % 1000ULL), processId, threadId);
+    if ((ok) && (type == Trace::EVENT_STATE_CHANGE)) {
+        ok = stream.Printf("%s", ",\"s\":\"p\"");
+    }
+    if ((ok) && (event.argument != 0u)) {
+        ok = stream.Printf(",\"args\":{\"value\":%u}", event.argument);
+    }
+    if (ok) {
+        ok = stream.Printf("%s", "}");
+    }
+    return ok;
+}
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace TraceExporter {
+
+bool ExportChromeJSON(BufferedStreamI &stream) {
+    bool ok = stream.Printf("%s", "{\"traceEvents\":[");
+    uint32 ringSize = Trace::GetRingSize();
+    TraceEvent *events = NULL_PTR(TraceEvent *);
+    if (ringSize > 0u) {
+        events = new TraceEvent[ringSize];
+    }
+    uint32 processId = Trace::GetProcessId();
+    uint32 numberOfRings = Trace::GetNumberOfRings();
+    bool first = true;
+    for (uint32 r = 0u; (r < numberOfRings) && (ok); r++) {
+        uint32 threadId = 0u;
+        uint32 numberOfEvents = Trace::ReadEvents(r, events, ringSize, threadId);
+        for (uint32 e = 0u; (e < numberOfEvents) && (ok); e++) {
+            //lint -e{613} events != NULL if there are rings
+            ok = WriteEvent(stream, events[e], processId, threadId, first);
+            first = false;
+        }
+    }
+    if (ok) {
+        ok = stream.Printf("%s", "\n],\"displayTimeUnit\":\"ns\"}\n");
+    }
+    if (events != NULL_PTR(TraceEvent *)) {
+        delete[] events;
+    }
+    return ok;
+}
+
+}
+
+}
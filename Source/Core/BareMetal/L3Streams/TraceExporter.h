@@ -0,0 +1,67 @@
+/**
+ * @file TraceExporter.h
+ * @brief Header file for module TraceExporter
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module TraceExporter
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TRACEEXPORTER_H_
+#define TRACEEXPORTER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "BufferedStreamI.h"
+#include "Trace.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief Exports the events recorded by Trace.
+     */
+    namespace TraceExporter {
+
+        /**
+         * @brief Writes the events of all the rings in the Chrome trace event JSON format (which can be loaded in Perfetto or chrome://tracing).
+         * @details The cycles, the executions of the ExecutableIs, the broker flushes and the semaphore waits are written as begin/end
+         * events and the state changes as instant events. The timestamps are the HighResolutionTimer time in microseconds and the
+         * thread and process identifiers are the ones of the operating system, so that the events can be correlated with a kernel trace.
+         * Can be called while the events are being recorded.
+         * @param[out] stream where to write the events.
+         * @return true if all the events were written.
+         */
+        DLL_API bool ExportChromeJSON(BufferedStreamI &stream);
+    }
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TRACEEXPORTER_H_ */
@@ -356,7 +356,8 @@ static bool SerializeScalar(const AnyType &typeIn,
 namespace MARTe {
 
 AnyObject::AnyObject() :
-        Object() {
+        Object(),
+        owner() {
 }
 
 /*lint -e{1551} Justification: Memory has to be freed in the destructor.
@@ -403,7 +404,63 @@ bool AnyObject::Serialise(const AnyType &typeIn) {
     return ok;
 }
 
+bool AnyObject::IsContiguous(const AnyType &typeIn) {
+    TypeDescriptor descriptor = typeIn.GetTypeDescriptor();
+    bool ok = (typeIn.GetDataPointer() != NULL_PTR(void *));
+    if (ok) {
+        ok = ((descriptor.type != SString) && (descriptor.type != BT_CCString) && (descriptor.type != Pointer) && (!descriptor.isStructuredData));
+    }
+    if (ok) {
+        ok = (typeIn.GetNumberOfDimensions() <= 3u);
+    }
+    if (ok) {
+        //The heap matrices are arrays of rows and the heap arrays of characters are arrays of pointers
+        if ((typeIn.GetNumberOfDimensions() > 1u) || (descriptor.type == CArray)) {
+            ok = typeIn.IsStaticDeclared();
+        }
+    }
+    return ok;
+}
+
+bool AnyObject::Adopt(const AnyType &typeIn) {
+    CleanUp();
+    bool ok = IsContiguous(typeIn);
+    if (ok) {
+        type = typeIn;
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Only contiguous types can be adopted");
+    }
+    return ok;
+}
+
+bool AnyObject::View(const AnyType &typeIn,
+                     const Reference &ownerIn) {
+    CleanUp();
+    bool ok = ownerIn.IsValid();
+    if (ok) {
+        ok = IsContiguous(typeIn);
+    }
+    if (ok) {
+        type = typeIn;
+        owner = ownerIn;
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Only contiguous types with a valid owner can be viewed");
+    }
+    return ok;
+}
+
+bool AnyObject::IsView() const {
+    return owner.IsValid();
+}
+
 void AnyObject::CleanUp() {
+    if (owner.IsValid()) {
+        //The memory belongs to the owner
+        owner = Reference();
+        type = voidAnyType;
+    }
     void *typePointer = type.GetDataPointer();
     bool cString = (type.GetTypeDescriptor().type == BT_CCString);
     bool sString = (type.GetTypeDescriptor().type == SString);
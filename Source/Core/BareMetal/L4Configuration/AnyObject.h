@@ -34,6 +34,7 @@
 
 #include "AnyType.h"
 #include "Object.h"
+#include "Reference.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -45,6 +46,14 @@ namespace MARTe {
  * @brief An helper class to serialise the contents of an AnyType (i.e. of the data pointed by an AnyType.GetDataPointer()).
  * @details This class allows to associate a name and a reference to an AnyType.
  * It holds and manages a memory space to store a copy of the data of the serialised AnyType.
+ *
+ * Large contiguous arrays (e.g. waveform tables and calibration matrices) do not need to be copied:
+ * - Adopt takes the ownership of memory already allocated with the HeapManager (e.g. by the parser, see ConfigurationParserI);
+ * - View references memory owned by another (reference counted) Object, e.g. a memory mapped file, which is kept alive by the AnyObject.
+ *
+ * Only contiguous types can be adopted or viewed (i.e. not strings, not pointers and, for more than one dimension, statically declared).
+ * As the AnyObject is reference counted, a leaf of a ConfigurationDatabase can be shared (see ConfigurationDatabase::GetLeaf) so that
+ * the data is accessed through GetType without any copy or conversion, also after the ConfigurationDatabase is destroyed.
  */
 class DLL_API AnyObject: public Object {
 
@@ -84,6 +93,42 @@ public:
      */
     bool Serialise(const AnyType &typeIn);
 
+    /**
+     * @brief Takes the ownership of the data of an AnyType, without copying it.
+     * @details The memory (typeIn.GetDataPointer()) shall have been allocated with HeapManager and will be freed by CleanUp.
+     * @param[in] typeIn the AnyType to be adopted.
+     * @return true if \a typeIn is contiguous (see class description) and has data.
+     * @post
+     *   GetType() == typeIn
+     */
+    bool Adopt(const AnyType &typeIn);
+
+    /**
+     * @brief References the data of an AnyType owned by another Object, without copying it.
+     * @details The \a owner is referenced until CleanUp, so that the data stays valid as long as this AnyObject exists.
+     * @param[in] typeIn the AnyType to be viewed.
+     * @param[in] owner the Object that owns the memory of \a typeIn.
+     * @return true if \a typeIn is contiguous (see class description) and has data and if \a owner is valid.
+     * @post
+     *   GetType() == typeIn &&
+     *   IsView()
+     */
+    bool View(const AnyType &typeIn,
+              const Reference &owner);
+
+    /**
+     * @brief Checks if the data is owned by another Object (see View).
+     * @return true if the data is owned by another Object.
+     */
+    bool IsView() const;
+
+    /**
+     * @brief Checks if the AnyType can be adopted or viewed (see class description).
+     * @param[in] typeIn the AnyType to check.
+     * @return true if the data of \a typeIn is in one contiguous block.
+     */
+    static bool IsContiguous(const AnyType &typeIn);
+
     /**
      * @brief Gets the serialised AnyType.
      * @return the serialised AnyType.
@@ -96,6 +141,11 @@ private:
      * The serialised AnyType
      */
     AnyType type;
+
+    /**
+     * The owner of the data of a view.
+     */
+    Reference owner;
 };
 
 }
@@ -79,6 +79,18 @@ void AnyTypeCreator::CleanUp(const uint32 granularityIn) {
     granularity=granularityIn;
 }
 
+void *AnyTypeCreator::Release(const uint32 granularityIn) {
+    void *released = NULL_PTR(void *);
+    if (memory != NULL) {
+        TypeDescriptor descriptor = TypeDescriptor::GetTypeDescriptorFromStaticTable(typeIndex);
+        if ((descriptor.type != BT_CCString) && (descriptor.type != SString)) {
+            released = memory->Release();
+            CleanUp(granularityIn);
+        }
+    }
+    return released;
+}
+
 AnyType AnyTypeCreator::Create(const uint8 nOfDimensions,
                                const uint32 dimensionSize[3]) const {
 
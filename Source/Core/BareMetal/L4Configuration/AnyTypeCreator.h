@@ -100,6 +100,17 @@ public:
      */
     void CleanUp(const uint32 granularityIn);
 
+    /**
+     * @brief Gives the memory of the elements to the caller (e.g. to be adopted by an AnyObject, see AnyObject::Adopt) instead of freeing it.
+     * @details Only the non-string types can be released, given that the strings are allocated one by one.
+     * @param[in] granularityIn is the granularity for the new memory allocation.
+     * @return the memory of the elements (allocated with HeapManager), which shall be freed by the caller, or NULL if there are no
+     * elements or if they are strings (in which case the memory is kept and freed by CleanUp).
+     * @post
+     *   The return value != NULL => GetSize() == 0 && GetGranularity() == granularityIn
+     */
+    void *Release(const uint32 granularityIn);
+
     /**
      * @brief Retrieves how many elements currently are in the memory.
      * @return The current number of elements in the memory
@@ -0,0 +1,688 @@
+/**
+ * @file CborParser.cpp
+ * @brief Source file for class CborParser
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CborParser (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "CborParser.h"
+#include "Matrix.h"
+#include "MemoryOperationsHelper.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * CBOR major types.
+ */
+static const uint8 CBOR_UNSIGNED = 0u;
+static const uint8 CBOR_NEGATIVE = 1u;
+static const uint8 CBOR_BYTES = 2u;
+static const uint8 CBOR_TEXT = 3u;
+static const uint8 CBOR_ARRAY = 4u;
+static const uint8 CBOR_MAP = 5u;
+static const uint8 CBOR_TAG = 6u;
+static const uint8 CBOR_SIMPLE = 7u;
+
+/**
+ * Additional information of indefinite lengths and breaks.
+ */
+static const uint8 CBOR_INDEFINITE = 31u;
+
+/**
+ * @brief Number of bits of the smallest unsigned type which holds \a value.
+ */
+static uint8 CborUnsignedBits(const uint64 value) {
+    uint8 bits = 64u;
+    if (value <= 0xFFu) {
+        bits = 8u;
+    }
+    else if (value <= 0xFFFFu) {
+        bits = 16u;
+    }
+    else if (value <= 0xFFFFFFFFu) {
+        bits = 32u;
+    }
+    else {
+    }
+    return bits;
+}
+
+/**
+ * @brief Number of bits of the smallest signed type which holds \a value (or -1 - \a value).
+ */
+static uint8 CborSignedBits(const uint64 value) {
+    uint8 bits = 64u;
+    if (value < 0x80u) {
+        bits = 8u;
+    }
+    else if (value < 0x8000u) {
+        bits = 16u;
+    }
+    else if (value < 0x80000000u) {
+        bits = 32u;
+    }
+    else {
+    }
+    return bits;
+}
+
+/**
+ * @brief Converts a numeric CborScalar to T.
+ */
+template<typename T>
+static T CborToNumber(const CborScalar &scalar) {
+    T value;
+    if (scalar.majorType == CBOR_UNSIGNED) {
+        value = static_cast<T>(scalar.integer);
+    }
+    else if (scalar.majorType == CBOR_NEGATIVE) {
+        value = static_cast<T>(-1 - static_cast<int64>(scalar.integer));
+    }
+    else {
+        value = static_cast<T>(scalar.floatValue);
+    }
+    return value;
+}
+
+/**
+ * @brief Writes \a numberOfElements numeric scalars as a T scalar (numberOfRows == 0 and numberOfColumns == 0),
+ * vector (numberOfRows == 0) or matrix.
+ */
+template<typename T>
+static bool CborWriteNumbers(StructuredDataI &database,
+                             const char8 * const name,
+                             const CborScalar * const elements,
+                             const uint32 numberOfElements,
+                             const uint32 numberOfRows,
+                             const uint32 numberOfColumns) {
+    bool ok;
+    T *values = new T[numberOfElements];
+    uint32 i;
+    for (i = 0u; i < numberOfElements; i++) {
+        values[i] = CborToNumber<T>(elements[i]);
+    }
+    if (numberOfColumns == 0u) {
+        ok = database.Write(name, values[0]);
+    }
+    else if (numberOfRows == 0u) {
+        Vector<T> vec(values, numberOfElements);
+        ok = database.Write(name, vec);
+    }
+    else {
+        Matrix<T> mat(values, numberOfRows, numberOfColumns);
+        ok = database.Write(name, mat);
+    }
+    delete[] values;
+    return ok;
+}
+
+/**
+ * @brief As CborWriteNumbers for strings (the numbers are printed).
+ */
+static bool CborWriteStrings(StructuredDataI &database,
+                             const char8 * const name,
+                             const CborScalar * const elements,
+                             const uint32 numberOfElements,
+                             const uint32 numberOfRows,
+                             const uint32 numberOfColumns) {
+    bool ok = true;
+    StreamString *values = new StreamString[numberOfElements];
+    uint32 i;
+    for (i = 0u; (i < numberOfElements) && (ok); i++) {
+        if (elements[i].majorType == CBOR_TEXT) {
+            values[i] = elements[i].text;
+        }
+        else if (elements[i].majorType == CBOR_UNSIGNED) {
+            ok = values[i].Printf("%u", elements[i].integer);
+        }
+        else if (elements[i].majorType == CBOR_NEGATIVE) {
+            ok = values[i].Printf("%d", -1 - static_cast<int64>(elements[i].integer));
+        }
+        else {
+            ok = values[i].Printf("%!", elements[i].floatValue);
+        }
+    }
+    if (ok) {
+        if (numberOfColumns == 0u) {
+            ok = database.Write(name, values[0].Buffer());
+        }
+        else if (numberOfRows == 0u) {
+            Vector<StreamString> vec(values, numberOfElements);
+            ok = database.Write(name, vec);
+        }
+        else {
+            Matrix<StreamString> mat(values, numberOfRows, numberOfColumns);
+            ok = database.Write(name, mat);
+        }
+    }
+    delete[] values;
+    return ok;
+}
+
+/**
+ * @brief Writes scalars, vectors or matrices (see CborWriteNumbers) with the widest type of the elements.
+ */
+static bool CborWriteScalars(StructuredDataI &database,
+                             const char8 * const name,
+                             const CborScalar * const elements,
+                             const uint32 numberOfElements,
+                             const uint32 numberOfRows,
+                             const uint32 numberOfColumns) {
+    bool hasText = false;
+    bool hasFloat = false;
+    bool hasInteger = false;
+    bool hasNegative = false;
+    uint8 floatBits = 32u;
+    uint8 unsignedBits = 8u;
+    uint8 signedBits = 8u;
+    uint32 i;
+    for (i = 0u; i < numberOfElements; i++) {
+        uint8 majorType = elements[i].majorType;
+        if (majorType == CBOR_TEXT) {
+            hasText = true;
+        }
+        else if (majorType == CBOR_SIMPLE) {
+            hasFloat = true;
+            if (elements[i].numberOfBits > floatBits) {
+                floatBits = elements[i].numberOfBits;
+            }
+        }
+        else {
+            hasInteger = true;
+            hasNegative = (hasNegative) || (majorType == CBOR_NEGATIVE);
+            if ((majorType == CBOR_UNSIGNED) && (elements[i].numberOfBits > unsignedBits)) {
+                unsignedBits = elements[i].numberOfBits;
+            }
+            uint8 bits = CborSignedBits(elements[i].integer);
+            if (bits > signedBits) {
+                signedBits = bits;
+            }
+        }
+    }
+    bool ok;
+    if (hasText) {
+        ok = CborWriteStrings(database, name, elements, numberOfElements, numberOfRows, numberOfColumns);
+    }
+    else if (hasFloat) {
+        if ((floatBits == 32u) && (!hasInteger)) {
+            ok = CborWriteNumbers<float32>(database, name, elements, numberOfElements, numberOfRows, numberOfColumns);
+        }
+        else {
+            ok = CborWriteNumbers<float64>(database, name, elements, numberOfElements, numberOfRows, numberOfColumns);
+        }
+    }
+    else if (hasNegative) {
+        if (signedBits == 8u) {
+            ok = CborWriteNumbers<int8>(database, name, elements, numberOfElements, numberOfRows, numberOfColumns);
+        }
+        else if (signedBits == 16u) {
+            ok = CborWriteNumbers<int16>(database, name, elements, numberOfElements, numberOfRows, numberOfColumns);
+        }
+        else if (signedBits == 32u) {
+            ok = CborWriteNumbers<int32>(database, name, elements, numberOfElements, numberOfRows, numberOfColumns);
+        }
+        else {
+            ok = CborWriteNumbers<int64>(database, name, elements, numberOfElements, numberOfRows, numberOfColumns);
+        }
+    }
+    else {
+        if (unsignedBits == 8u) {
+            ok = CborWriteNumbers<uint8>(database, name, elements, numberOfElements, numberOfRows, numberOfColumns);
+        }
+        else if (unsignedBits == 16u) {
+            ok = CborWriteNumbers<uint16>(database, name, elements, numberOfElements, numberOfRows, numberOfColumns);
+        }
+        else if (unsignedBits == 32u) {
+            ok = CborWriteNumbers<uint32>(database, name, elements, numberOfElements, numberOfRows, numberOfColumns);
+        }
+        else {
+            ok = CborWriteNumbers<uint64>(database, name, elements, numberOfElements, numberOfRows, numberOfColumns);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Adds a scalar at the end of \a elements, growing it if needed.
+ */
+static void CborAppend(CborScalar *&elements,
+                       uint32 &numberOfElements,
+                       uint32 &capacity,
+                       const CborScalar &scalar) {
+    if (numberOfElements == capacity) {
+        capacity = (capacity == 0u) ? (16u) : (capacity * 2u);
+        CborScalar *grown = new CborScalar[capacity];
+        uint32 i;
+        for (i = 0u; i < numberOfElements; i++) {
+            grown[i] = elements[i];
+        }
+        if (elements != NULL_PTR(CborScalar *)) {
+            delete[] elements;
+        }
+        elements = grown;
+    }
+    elements[numberOfElements] = scalar;
+    numberOfElements++;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+CborParser::CborParser(StreamI &stream,
+                       StructuredDataI &databaseIn,
+                       BufferedStreamI * const err) {
+    inputStream = &stream;
+    database = &databaseIn;
+    errorStream = err;
+    position = 0u;
+}
+
+CborParser::~CborParser() {
+    inputStream = NULL_PTR(StreamI *);
+    database = NULL_PTR(StructuredDataI *);
+    errorStream = NULL_PTR(BufferedStreamI *);
+}
+
+bool CborParser::Parse() {
+    uint8 majorType;
+    uint8 additionalInformation;
+    uint64 argument;
+    bool ok = ReadHead(majorType, additionalInformation, argument);
+    if (ok) {
+        ok = (majorType == CBOR_MAP);
+        if (!ok) {
+            PrintError("The stream does not start with a map");
+        }
+    }
+    if (ok) {
+        ok = ParseMap(argument, (additionalInformation == CBOR_INDEFINITE));
+    }
+    return ok;
+}
+
+bool CborParser::ReadBytes(char8 * const buffer,
+                           const uint32 size) {
+    uint32 readSize = size;
+    bool ok = inputStream->Read(buffer, readSize);
+    if (ok) {
+        ok = (readSize == size);
+    }
+    if (!ok) {
+        PrintError("Unexpected end of the stream");
+    }
+    position += readSize;
+    return ok;
+}
+
+bool CborParser::ReadHead(uint8 &majorType,
+                          uint8 &additionalInformation,
+                          uint64 &argument) {
+    char8 head[8];
+    bool ok = ReadBytes(&head[0], 1u);
+    if (ok) {
+        uint8 initialByte = static_cast<uint8>(head[0]);
+        majorType = static_cast<uint8>(initialByte >> 5u);
+        additionalInformation = static_cast<uint8>(initialByte & 0x1Fu);
+        argument = 0u;
+        if (additionalInformation < 24u) {
+            argument = additionalInformation;
+        }
+        else if (additionalInformation <= 27u) {
+            uint32 numberOfBytes = (1u << (additionalInformation - 24u));
+            ok = ReadBytes(&head[0], numberOfBytes);
+            uint32 i;
+            for (i = 0u; (i < numberOfBytes) && (ok); i++) {
+                argument = ((argument << 8u) | static_cast<uint8>(head[i]));
+            }
+        }
+        else if (additionalInformation == CBOR_INDEFINITE) {
+            ok = ((majorType == CBOR_BYTES) || (majorType == CBOR_TEXT) || (majorType == CBOR_ARRAY) || (majorType == CBOR_MAP)
+                    || (majorType == CBOR_SIMPLE));
+            if (!ok) {
+                PrintError("Invalid indefinite length");
+            }
+        }
+        else {
+            ok = false;
+            PrintError("Reserved additional information");
+        }
+    }
+    return ok;
+}
+
+bool CborParser::ReadText(const uint64 length,
+                          const bool indefinite,
+                          StreamString &text) {
+    bool ok = true;
+    if (indefinite) {
+        //Concatenation of definite length chunks up to the break
+        bool done = false;
+        while ((ok) && (!done)) {
+            uint8 majorType;
+            uint8 additionalInformation;
+            uint64 chunkLength;
+            ok = ReadHead(majorType, additionalInformation, chunkLength);
+            if (ok) {
+                done = ((majorType == CBOR_SIMPLE) && (additionalInformation == CBOR_INDEFINITE));
+                if (!done) {
+                    ok = ((majorType == CBOR_TEXT) || (majorType == CBOR_BYTES)) && (additionalInformation != CBOR_INDEFINITE);
+                    if (ok) {
+                        ok = ReadText(chunkLength, false, text);
+                    }
+                    else {
+                        PrintError("Invalid string chunk");
+                    }
+                }
+            }
+        }
+    }
+    else {
+        char8 chunk[256];
+        uint64 left = length;
+        while ((ok) && (left > 0u)) {
+            uint32 size = (left > sizeof(chunk)) ? (static_cast<uint32>(sizeof(chunk))) : (static_cast<uint32>(left));
+            ok = ReadBytes(&chunk[0], size);
+            if (ok) {
+                uint32 writeSize = size;
+                ok = text.Write(&chunk[0], writeSize);
+                left -= size;
+            }
+        }
+    }
+    return ok;
+}
+
+bool CborParser::ParseMap(const uint64 length,
+                          const bool indefinite) {
+    bool ok = true;
+    bool done = ((!indefinite) && (length == 0u));
+    uint64 n = 0u;
+    while ((ok) && (!done)) {
+        uint8 majorType;
+        uint8 additionalInformation;
+        uint64 argument;
+        ok = ReadHead(majorType, additionalInformation, argument);
+        if (ok) {
+            done = ((indefinite) && (majorType == CBOR_SIMPLE) && (additionalInformation == CBOR_INDEFINITE));
+        }
+        if ((ok) && (!done)) {
+            ok = (majorType == CBOR_TEXT);
+            StreamString key;
+            if (ok) {
+                ok = ReadText(argument, (additionalInformation == CBOR_INDEFINITE), key);
+            }
+            else {
+                PrintError("The map keys shall be text strings");
+            }
+            if (ok) {
+                ok = ParseValue(key.Buffer());
+            }
+            n++;
+            done = ((!indefinite) && (n == length));
+        }
+    }
+    return ok;
+}
+
+bool CborParser::ParseValue(const char8 * const name) {
+    uint8 majorType;
+    uint8 additionalInformation;
+    uint64 argument;
+    bool ok = ReadHead(majorType, additionalInformation, argument);
+    while ((ok) && (majorType == CBOR_TAG)) {
+        ok = ReadHead(majorType, additionalInformation, argument);
+    }
+    bool indefinite = (additionalInformation == CBOR_INDEFINITE);
+    if (ok) {
+        if (majorType == CBOR_MAP) {
+            ok = database->CreateRelative(name);
+            if (ok) {
+                ok = ParseMap(argument, indefinite);
+            }
+            if (ok) {
+                ok = database->MoveToAncestor(1u);
+            }
+        }
+        else if (majorType == CBOR_ARRAY) {
+            ok = ParseArray(name, argument, indefinite);
+        }
+        else if (majorType == CBOR_BYTES) {
+            StreamString bytes;
+            ok = ReadText(argument, indefinite, bytes);
+            if ((ok) && (bytes.Size() > 0u)) {
+                Vector<uint8> vec(reinterpret_cast<uint8 *>(bytes.BufferReference()), static_cast<uint32>(bytes.Size()));
+                ok = database->Write(name, vec);
+            }
+        }
+        else {
+            CborScalar scalar;
+            ok = ReadScalar(majorType, additionalInformation, argument, scalar);
+            if (ok) {
+                ok = CborWriteScalars(*database, name, &scalar, 1u, 0u, 0u);
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "CborParser: Failed to add %s", name);
+        }
+    }
+    return ok;
+}
+
+bool CborParser::ReadScalar(const uint8 majorType,
+                            const uint8 additionalInformation,
+                            const uint64 argument,
+                            CborScalar &scalar) {
+    bool ok = true;
+    scalar.majorType = majorType;
+    scalar.integer = argument;
+    scalar.floatValue = 0.0;
+    scalar.numberOfBits = 0u;
+    if (majorType == CBOR_UNSIGNED) {
+        scalar.numberOfBits = CborUnsignedBits(argument);
+    }
+    else if (majorType == CBOR_NEGATIVE) {
+        scalar.numberOfBits = CborSignedBits(argument);
+        ok = (argument < 0x8000000000000000u);
+        if (!ok) {
+            PrintError("Negative integer out of the int64 range");
+        }
+    }
+    else if (majorType == CBOR_TEXT) {
+        ok = ReadText(argument, (additionalInformation == CBOR_INDEFINITE), scalar.text);
+    }
+    else if (majorType == CBOR_SIMPLE) {
+        if ((additionalInformation == 20u) || (additionalInformation == 21u)) {
+            //false and true
+            scalar.majorType = CBOR_UNSIGNED;
+            scalar.integer = (additionalInformation == 21u) ? (1u) : (0u);
+            scalar.numberOfBits = 8u;
+        }
+        else if ((additionalInformation == 22u) || (additionalInformation == 23u)) {
+            //null and undefined
+            scalar.majorType = CBOR_TEXT;
+        }
+        else if (additionalInformation == 25u) {
+            //half precision, expanded to the single precision bits
+            uint32 half = static_cast<uint32>(argument);
+            uint32 sign = ((half >> 15u) & 0x1u);
+            uint32 exponent = ((half >> 10u) & 0x1Fu);
+            uint32 mantissa = (half & 0x3FFu);
+            float32 value;
+            if (exponent == 0u) {
+                value = static_cast<float32>(mantissa) / 16777216.0F;
+                if (sign != 0u) {
+                    value = -value;
+                }
+            }
+            else {
+                uint32 bits = (sign << 31u) | (mantissa << 13u);
+                bits |= (exponent == 0x1Fu) ? (0xFFu << 23u) : ((exponent + 112u) << 23u);
+                ok = MemoryOperationsHelper::Copy(&value, &bits, 4u);
+            }
+            scalar.floatValue = value;
+            scalar.numberOfBits = 32u;
+        }
+        else if (additionalInformation == 26u) {
+            uint32 bits = static_cast<uint32>(argument);
+            float32 value;
+            ok = MemoryOperationsHelper::Copy(&value, &bits, 4u);
+            scalar.floatValue = value;
+            scalar.numberOfBits = 32u;
+        }
+        else if (additionalInformation == 27u) {
+            ok = MemoryOperationsHelper::Copy(&scalar.floatValue, &argument, 8u);
+            scalar.numberOfBits = 64u;
+        }
+        else {
+            ok = false;
+            PrintError("Unsupported simple value");
+        }
+    }
+    else {
+        ok = false;
+        PrintError("Unexpected item (expected a scalar)");
+    }
+    return ok;
+}
+
+bool CborParser::ParseArray(const char8 * const name,
+                            const uint64 length,
+                            const bool indefinite) {
+    CborScalar *elements = NULL_PTR(CborScalar *);
+    uint32 numberOfElements = 0u;
+    uint32 capacity = 0u;
+    uint32 numberOfRows = 0u;
+    uint32 numberOfColumns = 0u;
+    bool isMatrix = false;
+    bool ok = true;
+    bool done = ((!indefinite) && (length == 0u));
+    uint64 n = 0u;
+    while ((ok) && (!done)) {
+        uint8 majorType;
+        uint8 additionalInformation;
+        uint64 argument;
+        ok = ReadHead(majorType, additionalInformation, argument);
+        while ((ok) && (majorType == CBOR_TAG)) {
+            ok = ReadHead(majorType, additionalInformation, argument);
+        }
+        if (ok) {
+            done = ((indefinite) && (majorType == CBOR_SIMPLE) && (additionalInformation == CBOR_INDEFINITE));
+        }
+        if ((ok) && (!done)) {
+            if (n == 0u) {
+                isMatrix = (majorType == CBOR_ARRAY);
+            }
+            ok = (isMatrix == (majorType == CBOR_ARRAY));
+            if (!ok) {
+                PrintError("Arrays shall either contain only scalars or only arrays of scalars");
+            }
+        }
+        if ((ok) && (!done)) {
+            if (isMatrix) {
+                //A row
+                bool rowIndefinite = (additionalInformation == CBOR_INDEFINITE);
+                bool rowDone = ((!rowIndefinite) && (argument == 0u));
+                uint32 rowSize = 0u;
+                while ((ok) && (!rowDone)) {
+                    uint8 elementMajorType;
+                    uint8 elementAdditionalInformation;
+                    uint64 elementArgument;
+                    ok = ReadHead(elementMajorType, elementAdditionalInformation, elementArgument);
+                    if (ok) {
+                        rowDone = ((rowIndefinite) && (elementMajorType == CBOR_SIMPLE) && (elementAdditionalInformation == CBOR_INDEFINITE));
+                    }
+                    if ((ok) && (!rowDone)) {
+                        CborScalar scalar;
+                        ok = ReadScalar(elementMajorType, elementAdditionalInformation, elementArgument, scalar);
+                        if (ok) {
+                            CborAppend(elements, numberOfElements, capacity, scalar);
+                            rowSize++;
+                            rowDone = ((!rowIndefinite) && (rowSize == argument));
+                        }
+                    }
+                }
+                if (ok) {
+                    if (numberOfRows == 0u) {
+                        numberOfColumns = rowSize;
+                    }
+                    ok = (rowSize == numberOfColumns);
+                    if (!ok) {
+                        PrintError("All the rows of a matrix shall have the same number of elements");
+                    }
+                    numberOfRows++;
+                }
+            }
+            else {
+                CborScalar scalar;
+                ok = ReadScalar(majorType, additionalInformation, argument, scalar);
+                if (ok) {
+                    CborAppend(elements, numberOfElements, capacity, scalar);
+                }
+            }
+            n++;
+            done = ((!indefinite) && (n == length));
+        }
+    }
+    if (ok) {
+        if (numberOfElements == 0u) {
+            //Empty arrays are written as empty strings
+            ok = database->Write(name, "");
+        }
+        else if (isMatrix) {
+            ok = CborWriteScalars(*database, name, elements, numberOfElements, numberOfRows, numberOfColumns);
+        }
+        else {
+            ok = CborWriteScalars(*database, name, elements, numberOfElements, 0u, numberOfElements);
+        }
+    }
+    if (elements != NULL_PTR(CborScalar *)) {
+        delete[] elements;
+    }
+    return ok;
+}
+
+void CborParser::PrintError(const char8 * const message) {
+    if (errorStream != NULL_PTR(BufferedStreamI *)) {
+        if (!errorStream->Printf("%s at byte [%u].", message, position)) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "CborParser: Failed Printf() on the error stream");
+        }
+    }
+    REPORT_ERROR_STATIC(ErrorManagement::FatalError, "CborParser: %s at byte [%u].", message, position);
+}
+
+}
@@ -0,0 +1,201 @@
+/**
+ * @file CborParser.h
+ * @brief Header file for class CborParser
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CborParser
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CBORPARSER_H_
+#define CBORPARSER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "BufferedStreamI.h"
+#include "StreamI.h"
+#include "StreamString.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A decoded CBOR scalar (see CborParser).
+ */
+struct CborScalar {
+    /**
+     * One of the CBOR major types (0 unsigned, 1 negative, 3 text) or 7 for floats.
+     */
+    uint8 majorType;
+
+    /**
+     * Number of bits of the smallest type which holds the value.
+     */
+    uint8 numberOfBits;
+
+    /**
+     * The value of unsigned integers or the argument (-1 - value) of negative integers.
+     */
+    uint64 integer;
+
+    /**
+     * The value of floats.
+     */
+    float64 floatValue;
+
+    /**
+     * The value of text strings.
+     */
+    StreamString text;
+};
+
+/**
+ * @brief Builds a StructuredDataI from a stream encoded in CBOR (RFC 8949), e.g. as written by a
+ * StreamStructuredData<CborPrinter>.
+ * @details The stream shall contain a map (of definite or indefinite length) whose keys are text strings.
+ * The values which are maps are created as nodes, the others are written as leaves:
+ *  - unsigned integers as uint8, uint16, uint32 or uint64 and negative integers as int8, int16, int32
+ *    or int64 (the smallest type holding the value);
+ *  - half and single precision floats as float32, double precision floats as float64;
+ *  - true, false as uint8 and text strings as strings (null as an empty string);
+ *  - byte strings as vectors of uint8;
+ *  - arrays of scalars as vectors and arrays of arrays (with the same number of elements) as matrices, of
+ *    the widest type of their elements (or of strings if any element is a string).
+ *
+ * Tags are ignored. Unlike the text parsers (see ParserI) there are no grammar tables: the encoding is
+ * decoded directly, without any tokenisation or number formatting.
+ */
+class DLL_API CborParser {
+public:
+
+    /**
+     * @brief Constructor.
+     * @param[in] stream is the stream to be parsed.
+     * @param[out] databaseIn is the built StructuredData in output.
+     * @param[out] err is the stream where error messages are printed to.
+     */
+    CborParser(StreamI &stream,
+               StructuredDataI &databaseIn,
+               BufferedStreamI * const err = static_cast<BufferedStreamI*>(NULL));
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~CborParser();
+
+    /**
+     * @brief Parses the stream in input and builds the structured data accordingly.
+     * @return true if the stream is a valid CBOR map as described in the class description.
+     * In case of failure the error is printed on the \a err stream in input (if it is not NULL).
+     */
+    bool Parse();
+
+private:
+
+    /**
+     * @brief Reads \a size bytes from the stream.
+     */
+    bool ReadBytes(char8 * const buffer,
+                   const uint32 size);
+
+    /**
+     * @brief Reads a CBOR head.
+     * @param[out] majorType the major type.
+     * @param[out] additionalInformation the additional information (31 for indefinite lengths and breaks).
+     * @param[out] argument the argument (or the bits of a float).
+     */
+    bool ReadHead(uint8 &majorType,
+                  uint8 &additionalInformation,
+                  uint64 &argument);
+
+    /**
+     * @brief Reads a text string with length \a length (indefinite if \a indefinite).
+     */
+    bool ReadText(const uint64 length,
+                  const bool indefinite,
+                  StreamString &text);
+
+    /**
+     * @brief Reads the entries of a map and writes them in the current node of the database.
+     */
+    bool ParseMap(const uint64 length,
+                  const bool indefinite);
+
+    /**
+     * @brief Reads a value and writes it with the name \a name.
+     */
+    bool ParseValue(const char8 * const name);
+
+    /**
+     * @brief Decodes the scalar of the head given in input.
+     * @return false if the head is not a scalar.
+     */
+    bool ReadScalar(const uint8 majorType,
+                    const uint8 additionalInformation,
+                    const uint64 argument,
+                    CborScalar &scalar);
+
+    /**
+     * @brief Reads an array (of scalars or of arrays of scalars) and writes it with the name \a name.
+     */
+    bool ParseArray(const char8 * const name,
+                    const uint64 length,
+                    const bool indefinite);
+
+    /**
+     * @brief Prints an error on the error stream.
+     */
+    void PrintError(const char8 * const message);
+
+    /**
+     * The stream to be parsed.
+     */
+    StreamI *inputStream;
+
+    /**
+     * The database to be built.
+     */
+    StructuredDataI *database;
+
+    /**
+     * The error stream.
+     */
+    BufferedStreamI *errorStream;
+
+    /**
+     * Number of bytes read (for the error messages).
+     */
+    uint64 position;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* CBORPARSER_H_ */
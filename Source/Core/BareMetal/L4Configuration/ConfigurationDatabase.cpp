@@ -34,8 +34,10 @@
 #include "AnyObject.h"
 #include "ErrorType.h"
 #include "ConfigurationDatabase.h"
+#include "MemoryOperationsHelper.h"
 #include "StreamString.h"
 #include "TypeConversion.h"
+#include "TypeConversionKernels.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -67,6 +69,26 @@ ConfigurationDatabase::ConfigurationDatabase(const ConfigurationDatabase &toCopy
     currentNode = toCopy.currentNode;
 }
 
+#ifdef MARTe2_CXX11
+ConfigurationDatabase::ConfigurationDatabase(ConfigurationDatabase &&toMove) :
+        Object(toMove) {
+    mux = toMove.mux;
+    rootNode = MARTe2_MOVE(toMove.rootNode);
+    currentNode = MARTe2_MOVE(toMove.currentNode);
+}
+
+ConfigurationDatabase &ConfigurationDatabase::operator =(ConfigurationDatabase &&toMove) {
+    if (this != &toMove) {
+        currentNode = Reference();
+        Purge();
+        mux = toMove.mux;
+        rootNode = MARTe2_MOVE(toMove.rootNode);
+        currentNode = MARTe2_MOVE(toMove.currentNode);
+    }
+    return *this;
+}
+#endif
+
 ConfigurationDatabase &ConfigurationDatabase::operator =(const ConfigurationDatabase &toCopy) {
     if (this != &toCopy) {
         currentNode = Reference();
@@ -81,13 +103,16 @@ ConfigurationDatabase &ConfigurationDatabase::operator =(const ConfigurationData
 void ConfigurationDatabase::Purge() const {
     //If the only references pointing at the rootNode are itself and eventually all its child nodes then it can be purged
     //Note that for every direct child of the rootNode a link to it (the parent) is created
-    uint32 numberOfReferences = (rootNode.NumberOfReferences() - 1u);
-    if (rootNode == currentNode) {
-        //currentNode is pointing at rootNode
-        numberOfReferences--;
-    }
-    if(numberOfReferences == rootNode->GetNumberOfNodes()) {
-        rootNode->Purge();
+    //A moved ConfigurationDatabase has no rootNode
+    if (rootNode.IsValid()) {
+        uint32 numberOfReferences = (rootNode.NumberOfReferences() - 1u);
+        if (rootNode == currentNode) {
+            //currentNode is pointing at rootNode
+            numberOfReferences--;
+        }
+        if(numberOfReferences == rootNode->GetNumberOfNodes()) {
+            rootNode->Purge();
+        }
     }
 }
 
@@ -130,6 +155,103 @@ bool ConfigurationDatabase::Write(const char8 * const name, const AnyType &value
     return ok;
 }
 
+bool ConfigurationDatabase::WriteAdopted(const char8 * const name,
+                                         const AnyType &value) {
+    ReferenceT<AnyObject> objToWrite(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = objToWrite.IsValid();
+    bool adopted = false;
+    if (ok) {
+        adopted = objToWrite->Adopt(value);
+        ok = adopted;
+    }
+    if (!adopted) {
+        void *memory = value.GetDataPointer();
+        if (memory != NULL_PTR(void *)) {
+            (void) HeapManager::Free(memory);
+        }
+    }
+    if (ok) {
+        ok = (StringHelper::Length(name) > 0u);
+    }
+    if (ok) {
+        objToWrite->SetName(name);
+        ok = WriteLeaf(objToWrite);
+    }
+    return ok;
+}
+
+bool ConfigurationDatabase::WriteView(const char8 * const name,
+                                      const AnyType &value,
+                                      const Reference &owner) {
+    ReferenceT<AnyObject> objToWrite(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = objToWrite.IsValid();
+    if (ok) {
+        ok = (StringHelper::Length(name) > 0u);
+    }
+    if (ok) {
+        ok = objToWrite->View(value, owner);
+    }
+    if (ok) {
+        objToWrite->SetName(name);
+        ok = WriteLeaf(objToWrite);
+    }
+    return ok;
+}
+
+ReferenceT<AnyObject> ConfigurationDatabase::GetLeaf(const char8 * const name) {
+    ReferenceT<AnyObject> leaf;
+    if (currentNode.IsValid()) {
+        leaf = currentNode->FindLeaf(name);
+    }
+    return leaf;
+}
+
+bool ConfigurationDatabase::ReadArray(const char8 * const name,
+                                      const TypeDescriptor &type,
+                                      void * const destination,
+                                      const uint32 numberOfElements) {
+    ReferenceT<AnyObject> leaf = GetLeaf(name);
+    bool ok = leaf.IsValid();
+    AnyType value;
+    if (ok) {
+        value = leaf->GetType();
+        uint32 numberOfLeafElements = 1u;
+        uint32 i;
+        for (i = 0u; i < 3u; i++) {
+            uint32 elements = value.GetNumberOfElements(i);
+            numberOfLeafElements *= (elements > 0u) ? (elements) : (1u);
+        }
+        ok = (numberOfLeafElements == numberOfElements);
+    }
+    if (ok) {
+        bool done = false;
+        if ((AnyObject::IsContiguous(value)) && (value.GetBitAddress() == 0u)) {
+            if (value.GetTypeDescriptor() == type) {
+                ok = MemoryOperationsHelper::Copy(destination, value.GetDataPointer(), numberOfElements * (static_cast<uint32>(type.numberOfBits) / 8u));
+                done = true;
+            }
+            else {
+                TypeConversionKernel kernel = TypeConversionKernels::Find(type, value.GetTypeDescriptor());
+                if (kernel != NULL_PTR(TypeConversionKernel)) {
+                    ok = kernel(destination, value.GetDataPointer(), numberOfElements);
+                    done = true;
+                }
+            }
+        }
+        if (!done) {
+            AnyType destinationType(type, 0u, destination);
+            destinationType.SetNumberOfDimensions(value.GetNumberOfDimensions());
+            uint32 i;
+            for (i = 0u; i < 3u; i++) {
+                destinationType.SetNumberOfElements(i, value.GetNumberOfElements(i));
+            }
+            destinationType.SetStaticDeclared(true);
+            ok = TypeConvert(destinationType, value);
+        }
+    }
+    return ok;
+}
+
 AnyType ConfigurationDatabase::GetType(const char8 * const name) {
     AnyType retType;
     if (currentNode.IsValid()) {
@@ -143,10 +265,12 @@ AnyType ConfigurationDatabase::GetType(const char8 * const name) {
 }
 
 bool ConfigurationDatabase::Copy(StructuredDataI &destination) {
-    ReferenceT<ConfigurationDatabaseNode> foundNode;
+    ConfigurationDatabase *destinationDatabase = dynamic_cast<ConfigurationDatabase *>(&destination);
     bool ok = true;
-    for (uint32 i = 0u; (i < currentNode->Size()) && (ok); i++) {
-        foundNode = currentNode->Get(i);
+    uint32 numberOfChildren = currentNode->Size();
+    for (uint32 i = 0u; (i < numberOfChildren) && (ok); i++) {
+        Reference child = currentNode->Get(i);
+        ReferenceT<ConfigurationDatabaseNode> foundNode = child;
         if (foundNode.IsValid()) {
             if (!destination.CreateRelative(foundNode->GetName())) {
                 ok = false;
@@ -166,10 +290,15 @@ bool ConfigurationDatabase::Copy(StructuredDataI &destination) {
             }
         }
         else {
-            ReferenceT<AnyObject> foundLeaf = currentNode->Get(i);
+            ReferenceT<AnyObject> foundLeaf = child;
 
             if (foundLeaf.IsValid()) {
-                ok = destination.Write(foundLeaf->GetName(), foundLeaf->GetType());
+                if (destinationDatabase != NULL_PTR(ConfigurationDatabase *)) {
+                    ok = destinationDatabase->WriteLeaf(foundLeaf);
+                }
+                else {
+                    ok = destination.Write(foundLeaf->GetName(), foundLeaf->GetType());
+                }
             }
         }
     }
@@ -346,6 +475,22 @@ bool ConfigurationDatabase::Delete(const char8 * const name) {
     return ok;
 }
 
+bool ConfigurationDatabase::WriteLeaf(ReferenceT<AnyObject> leaf) {
+    const char8 * const name = leaf->GetName();
+    bool ok = currentNode.IsValid();
+    if (ok) {
+        //As in Write, an existent leaf is replaced
+        ReferenceT<AnyObject> existent = currentNode->FindLeaf(name);
+        if (existent.IsValid()) {
+            ok = currentNode->Delete(existent);
+        }
+    }
+    if (ok) {
+        ok = currentNode->Insert(leaf);
+    }
+    return ok;
+}
+
 bool ConfigurationDatabase::AddToCurrentNode(Reference node) {
     ReferenceT<ConfigurationDatabaseNode> nodeToAdd = node;
     bool ok = nodeToAdd.IsValid();
@@ -380,6 +525,14 @@ void ConfigurationDatabase::Unlock() {
     mux.FastUnLock();
 }
 
+bool ConfigurationDatabase::ReadLock(const TimeoutType &timeout) {
+    return (mux.FastReadLock(timeout) == ErrorManagement::NoError);
+}
+
+void ConfigurationDatabase::ReadUnlock() {
+    mux.FastReadUnLock();
+}
+
 /*Reference ConfigurationDatabase::GetCurrentNode() const {
     return currentNode;
 }*/
@@ -82,6 +82,21 @@ ConfigurationDatabase    ();
      */
     ConfigurationDatabase & operator = (const ConfigurationDatabase &toCopy);
 
+#ifdef MARTe2_CXX11
+    /**
+     * @brief Move constructor.
+     * @details Takes the references to the current and root node (and the shared semaphore) of \a toMove.
+     * @param[in] toMove the ConfigurationDatabase to be moved. It is left without any node and shall only be destroyed or assigned.
+     */
+    ConfigurationDatabase(ConfigurationDatabase &&toMove);
+
+    /**
+     * @brief Move assignment operator (see ConfigurationDatabase(ConfigurationDatabase &&)).
+     * @param[in] toMove the ConfigurationDatabase to be moved. It is left without any node and shall only be destroyed or assigned.
+     */
+    ConfigurationDatabase & operator = (ConfigurationDatabase &&toMove);
+#endif
+
     /**
      * @brief Destructor.
      */
@@ -116,8 +131,70 @@ ConfigurationDatabase    ();
     virtual bool Write(const char8 * const name,
             const AnyType &value);
 
+    /**
+     * @brief Writes a leaf which takes the ownership of the data of \a value, without copying it (see AnyObject::Adopt).
+     * @param[in] name the name of the leaf (an existent leaf with the same name is replaced).
+     * @param[in] value the value, whose memory shall have been allocated with HeapManager and shall be contiguous. The memory is always
+     * owned by the database after the call (i.e. it is freed if the leaf cannot be written).
+     * @return true if the leaf could be written.
+     */
+    bool WriteAdopted(const char8 * const name,
+                      const AnyType &value);
+
+    /**
+     * @brief Writes a leaf which references the data of \a value owned by another Object, without copying it (see AnyObject::View).
+     * @details The \a owner (e.g. a memory mapped file) is kept alive as long as the leaf exists.
+     * @param[in] name the name of the leaf (an existent leaf with the same name is replaced).
+     * @param[in] value the value (which shall be contiguous).
+     * @param[in] owner the Object that owns the memory of \a value.
+     * @return true if the leaf could be written.
+     */
+    bool WriteView(const char8 * const name,
+                   const AnyType &value,
+                   const Reference &owner);
+
+    /**
+     * @brief Shares a leaf of the current node.
+     * @details The returned AnyObject gives (with AnyObject::GetType) the value without any copy or conversion and keeps it valid also
+     * after the leaf is deleted or the database is destroyed (e.g. to keep a large table read in GAM::Initialise).
+     * @param[in] name the name of the leaf.
+     * @return the leaf or an invalid reference if \a name is not a leaf of the current node.
+     */
+    ReferenceT<AnyObject> GetLeaf(const char8 * const name);
+
+    /**
+     * @brief Reads all the elements of a leaf (of any number of dimensions) into an array, in bulk.
+     * @details If the leaf is contiguous (see AnyObject::IsContiguous) and of the same type the elements are copied with one memory copy.
+     * If it is contiguous and of another numeric type the elements are converted with a TypeConversionKernels kernel. Otherwise (e.g.
+     * strings) the elements are converted with TypeConvert.
+     * @param[in] name the name of the leaf.
+     * @param[out] destination the array where to write the elements (row by row for matrices).
+     * @param[in] numberOfElements the number of elements of \a destination.
+     * @return true if the leaf exists, has \a numberOfElements elements and all the elements could be converted.
+     */
+    template<typename T>
+    inline bool ReadArray(const char8 * const name,
+                          T * const destination,
+                          const uint32 numberOfElements);
+
+    /**
+     * @brief See ReadArray.
+     * @param[in] name the name of the leaf.
+     * @param[in] type the type of the elements of \a destination.
+     * @param[out] destination the array where to write the elements.
+     * @param[in] numberOfElements the number of elements of \a destination.
+     * @return see ReadArray.
+     */
+    bool ReadArray(const char8 * const name,
+                   const TypeDescriptor &type,
+                   void * const destination,
+                   const uint32 numberOfElements);
+
     /**
      * @see StructuredDataI::Copy
+     * @details If \a destination is a ConfigurationDatabase the nodes are copied but the leaves are shared with \a destination
+     * (i.e. their values are not serialised again). This is safe because a leaf is never modified after being created:
+     * Write and Delete replace or remove the leaf in the node, leaving any other database pointing at it unchanged.
      */
     virtual bool Copy(StructuredDataI &destination);
 
@@ -201,6 +278,20 @@ ConfigurationDatabase    ();
      */
     void Unlock();
 
+    /**
+     * @brief Locks the shared semaphore in shared mode.
+     * @details Any number of readers, each moving in its own copy of this ConfigurationDatabase (the copies share the semaphore
+     * but not the current node), can hold the shared lock at the same time, while Lock waits for all of them to Unlock.
+     * @param[in] timeout maximum time to wait for the semaphore to be unlocked by the writer.
+     * @return true if the shared semaphore is successfully locked.
+     */
+    bool ReadLock(const TimeoutType &timeout);
+
+    /**
+     * @brief Unlocks the shared lock taken with ReadLock.
+     */
+    void ReadUnlock();
+
     /**
      * @brief Gets a reference to the current node as a ReferenceContainer.
      * @return a reference to the current node as a ReferenceContainer.
@@ -212,6 +303,14 @@ ConfigurationDatabase    ();
      */
     void SetCurrentNodeAsRootNode();
 
+    /**
+     * @brief Adds a leaf of another ConfigurationDatabase to the current node (replacing any leaf with the same name).
+     * @details The leaf is shared (not copied) between the two databases (see GetLeaf).
+     * @param[in] leaf the leaf to be shared.
+     * @return true if the leaf could be added.
+     */
+    bool WriteLeaf(ReferenceT<AnyObject> leaf);
+
 private:
 
     /**
@@ -232,9 +331,9 @@ private:
     ReferenceT<ConfigurationDatabaseNode> rootNode;
 
     /**
-     * The shared mutex semaphore.
+     * The shared reader-writer semaphore.
      */
-    FastPollingMutexSem mux;
+    FastPollingReadWriteSem mux;
 
 };
 
@@ -244,5 +343,16 @@ private:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+template<typename T>
+bool ConfigurationDatabase::ReadArray(const char8 * const name,
+                                      T * const destination,
+                                      const uint32 numberOfElements) {
+    return ReadArray(name, Type2TypeDescriptor<T>(), destination, numberOfElements);
+}
+
+}
+
 #endif /* CONFIGURATIONDATABASE_H_ */
 
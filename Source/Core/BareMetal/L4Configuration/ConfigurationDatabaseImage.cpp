@@ -0,0 +1,689 @@
+/**
+ * @file ConfigurationDatabaseImage.cpp
+ * @brief Source file for the ConfigurationDatabaseImage functions
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the ConfigurationDatabaseImage functions.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabaseImage.h"
+#include "HashIndex.h"
+#include "HeapManager.h"
+#include "MemoryOperationsHelper.h"
+#include "StreamString.h"
+#include "StringHelper.h"
+#include "WyHashFunction.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The tag at the beginning of every image.
+ */
+static const char8 IMAGE_TAG[8] = { 'M', 'A', 'R', 'T', 'e', 'C', 'D', 'B' };
+
+/**
+ * Incremented every time the layout below is changed.
+ */
+static const uint32 IMAGE_VERSION = 1u;
+
+/**
+ * Written in the byte order of the machine that compiled the image.
+ */
+static const uint32 IMAGE_BYTE_ORDER = 0x01020304u;
+
+/**
+ * Alignment of the leaf values section.
+ */
+static const uint32 IMAGE_DATA_ALIGNMENT = 8u;
+
+/**
+ * The size of the buffer used to read the streams.
+ */
+static const uint32 IMAGE_READ_CHUNK_SIZE = 4096u;
+
+/**
+ * Type of a node record.
+ */
+static const uint8 IMAGE_NODE_RECORD = 0u;
+
+/**
+ * Type of a leaf record.
+ */
+static const uint8 IMAGE_LEAF_RECORD = 1u;
+
+/**
+ * Number of string pointers of a leaf that are decoded without allocating memory.
+ */
+static const uint32 IMAGE_STRINGS_ON_STACK = 16u;
+
+/**
+ * The header at the beginning of every image. All the offsets are relative to the beginning of the image.
+ */
+struct ConfigurationDatabaseImageHeader {
+    char8 tag[8];
+    uint32 version;
+    uint32 byteOrder;
+    uint64 key;
+    uint32 numberOfRecords;
+    uint32 recordsOffset;
+    uint32 stringsOffset;
+    uint32 stringsSize;
+    uint32 dataOffset;
+    uint32 dataSize;
+};
+
+/**
+ * A node or a leaf. The records are stored in depth first order, i.e. each node record is followed by the
+ * records of all its descendants. The first record is the (nameless) node that was current when the image was written.
+ */
+struct ConfigurationDatabaseImageRecord {
+    /**
+     * Offset of the name in the strings section.
+     */
+    uint32 name;
+    /**
+     * TypeDescriptor::all of the leaf value.
+     */
+    uint16 typeDescriptor;
+    /**
+     * IMAGE_NODE_RECORD or IMAGE_LEAF_RECORD.
+     */
+    uint8 kind;
+    uint8 numberOfDimensions;
+    uint32 numberOfElements[3];
+    /**
+     * Number of nodes and leaves directly below a node.
+     */
+    uint32 numberOfChildren;
+    /**
+     * Offset of the leaf value in the data section and its size.
+     */
+    uint32 data;
+    uint32 dataSize;
+};
+
+/**
+ * The sections of an image while it is being written.
+ */
+class ConfigurationDatabaseImageWriter {
+public:
+    ConfigurationDatabaseImageWriter() {
+        numberOfRecords = 0u;
+    }
+
+    StreamString records;
+    StreamString strings;
+    StreamString data;
+    HashIndex<uint32, WyHashFunction> stringIndex;
+    uint32 numberOfRecords;
+};
+
+/**
+ * @brief Checks that a leaf type can be stored in an image.
+ */
+static bool ImageTypeSupported(const TypeDescriptor &td) {
+    bool ok = !static_cast<bool>(td.isStructuredData);
+    if (ok) {
+        uint32 type = td.type;
+        if (type == BT_CCString) {
+        }
+        else if ((type == SignedInteger) || (type == UnsignedInteger) || (type == Float)) {
+            uint32 numberOfBits = td.numberOfBits;
+            ok = ((numberOfBits > 0u) && (numberOfBits <= 64u) && ((numberOfBits % 8u) == 0u));
+        }
+        else {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Writes all the \a size bytes of \a buffer.
+ */
+static bool ImageWriteAll(StreamI &stream,
+                          const char8 * const buffer,
+                          const uint32 size) {
+    uint32 written = size;
+    bool ok = true;
+    if (size > 0u) {
+        ok = stream.Write(buffer, written);
+        if (ok) {
+            ok = (written == size);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Adds a string to the strings section, unless it is already there.
+ */
+static bool ImageInternString(ConfigurationDatabaseImageWriter &writer,
+                              const char8 * const str,
+                              uint32 &offset) {
+    bool ok = (str != NULL_PTR(const char8 *));
+    bool found = false;
+    uint32 key = 0u;
+    uint32 length = 0u;
+    if (ok) {
+        length = StringHelper::Length(str);
+        key = writer.stringIndex.Key(str, length);
+        uint32 cursor = 0u;
+        uint32 candidate = 0u;
+        const char8 * const table = writer.strings.Buffer();
+        while ((!found) && (writer.stringIndex.Search(key, cursor, candidate))) {
+            found = (StringHelper::Compare(&table[candidate], str) == 0);
+            if (found) {
+                offset = candidate;
+            }
+        }
+    }
+    if ((ok) && (!found)) {
+        offset = static_cast<uint32>(writer.strings.Size());
+        //Including the terminator
+        ok = ImageWriteAll(writer.strings, str, length + 1u);
+        if (ok) {
+            ok = writer.stringIndex.Insert(key, offset);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Appends a record to the records section.
+ */
+static bool ImageAddRecord(ConfigurationDatabaseImageWriter &writer,
+                           const ConfigurationDatabaseImageRecord &record) {
+    bool ok = ImageWriteAll(writer.records, reinterpret_cast<const char8 *>(&record), static_cast<uint32>(sizeof(ConfigurationDatabaseImageRecord)));
+    if (ok) {
+        writer.numberOfRecords++;
+    }
+    return ok;
+}
+
+/**
+ * @brief Appends a leaf record and its value.
+ */
+static bool ImageAddLeaf(ConfigurationDatabaseImageWriter &writer,
+                         const char8 * const name,
+                         const AnyType &value) {
+    TypeDescriptor td = value.GetTypeDescriptor();
+    uint32 numberOfDimensions = value.GetNumberOfDimensions();
+    uint32 numberOfColumns = value.GetNumberOfElements(0u);
+    uint32 numberOfRows = value.GetNumberOfElements(1u);
+    const void * const dataPointer = value.GetDataPointer();
+    bool ok = (ImageTypeSupported(td)) && (numberOfDimensions <= 2u) && (value.GetBitAddress() == 0u);
+    if (ok) {
+        ok = (dataPointer != NULL);
+    }
+    if (ok) {
+        if (numberOfDimensions == 0u) {
+            numberOfColumns = 1u;
+        }
+        if (numberOfDimensions < 2u) {
+            numberOfRows = 1u;
+        }
+    }
+    ConfigurationDatabaseImageRecord record;
+    if (ok) {
+        ok = ImageInternString(writer, name, record.name);
+    }
+    if (ok) {
+        record.typeDescriptor = td.all;
+        record.kind = IMAGE_LEAF_RECORD;
+        record.numberOfDimensions = static_cast<uint8>(numberOfDimensions);
+        record.numberOfElements[0] = numberOfColumns;
+        record.numberOfElements[1] = numberOfRows;
+        record.numberOfElements[2] = 1u;
+        record.numberOfChildren = 0u;
+        //Align the value
+        const char8 padding[IMAGE_DATA_ALIGNMENT] = { '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0' };
+        uint32 misalignment = static_cast<uint32>(writer.data.Size()) % IMAGE_DATA_ALIGNMENT;
+        if (misalignment != 0u) {
+            ok = ImageWriteAll(writer.data, &padding[0], IMAGE_DATA_ALIGNMENT - misalignment);
+        }
+        record.data = static_cast<uint32>(writer.data.Size());
+    }
+    bool isString = (td.type == BT_CCString);
+    bool isHeapMatrix = ((numberOfDimensions == 2u) && (!value.IsStaticDeclared()));
+    if ((ok) && (isString)) {
+        for (uint32 r = 0u; (r < numberOfRows) && (ok); r++) {
+            for (uint32 c = 0u; (c < numberOfColumns) && (ok); c++) {
+                const char8 *token = NULL_PTR(const char8 *);
+                if (numberOfDimensions == 0u) {
+                    token = static_cast<const char8 *>(dataPointer);
+                }
+                else if (isHeapMatrix) {
+                    /*lint -e{9025} Three pointer indirection levels required for matrices of char *. */
+                    token = static_cast<const char8 * const * const *>(dataPointer)[r][c];
+                }
+                else {
+                    token = static_cast<const char8 * const *>(dataPointer)[(r * numberOfColumns) + c];
+                }
+                uint32 offset = 0u;
+                ok = ImageInternString(writer, token, offset);
+                if (ok) {
+                    ok = ImageWriteAll(writer.data, reinterpret_cast<const char8 *>(&offset), static_cast<uint32>(sizeof(uint32)));
+                }
+            }
+        }
+    }
+    else if (ok) {
+        uint32 rowSize = value.GetByteSize() * numberOfColumns;
+        if (isHeapMatrix) {
+            for (uint32 r = 0u; (r < numberOfRows) && (ok); r++) {
+                ok = ImageWriteAll(writer.data, static_cast<const char8 * const *>(dataPointer)[r], rowSize);
+            }
+        }
+        else {
+            ok = ImageWriteAll(writer.data, static_cast<const char8 *>(dataPointer), rowSize * numberOfRows);
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::UnsupportedFeature, "The type of the leaf %s cannot be stored in a configuration image", name);
+    }
+    if (ok) {
+        record.dataSize = static_cast<uint32>(writer.data.Size()) - record.data;
+        ok = ImageAddRecord(writer, record);
+    }
+    return ok;
+}
+
+/**
+ * @brief Appends the records of all the children of the current node of \a database.
+ */
+static bool ImageAddChildren(ConfigurationDatabaseImageWriter &writer,
+                             StructuredDataI &database) {
+    bool ok = true;
+    uint32 numberOfChildren = database.GetNumberOfChildren();
+    for (uint32 i = 0u; (i < numberOfChildren) && (ok); i++) {
+        const char8 * const name = database.GetChildName(i);
+        if (database.MoveToChild(i)) {
+            ConfigurationDatabaseImageRecord record;
+            ok = ImageInternString(writer, name, record.name);
+            if (ok) {
+                record.typeDescriptor = 0u;
+                record.kind = IMAGE_NODE_RECORD;
+                record.numberOfDimensions = 0u;
+                record.numberOfElements[0] = 0u;
+                record.numberOfElements[1] = 0u;
+                record.numberOfElements[2] = 0u;
+                record.numberOfChildren = database.GetNumberOfChildren();
+                record.data = 0u;
+                record.dataSize = 0u;
+                ok = ImageAddRecord(writer, record);
+            }
+            if (ok) {
+                ok = ImageAddChildren(writer, database);
+            }
+            if (!database.MoveToAncestor(1u)) {
+                ok = false;
+            }
+        }
+        else {
+            ok = ImageAddLeaf(writer, name, database.GetType(name));
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Copies the header of an image and checks it.
+ */
+static bool ImageGetHeader(const char8 * const image,
+                           const uint32 imageSize,
+                           ConfigurationDatabaseImageHeader &header) {
+    bool ok = (image != NULL_PTR(const char8 *));
+    if (ok) {
+        ok = (imageSize >= static_cast<uint32>(sizeof(ConfigurationDatabaseImageHeader)));
+    }
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(&header, image, static_cast<uint32>(sizeof(ConfigurationDatabaseImageHeader)));
+    }
+    if (ok) {
+        ok = (MemoryOperationsHelper::Compare(&header.tag[0], &IMAGE_TAG[0], static_cast<uint32>(sizeof(IMAGE_TAG))) == 0);
+    }
+    if (ok) {
+        ok = (header.version == IMAGE_VERSION) && (header.byteOrder == IMAGE_BYTE_ORDER);
+    }
+    //All the sections shall be inside the image
+    if (ok) {
+        uint64 recordsEnd = static_cast<uint64>(header.recordsOffset)
+                + (static_cast<uint64>(header.numberOfRecords) * static_cast<uint64>(sizeof(ConfigurationDatabaseImageRecord)));
+        uint64 stringsEnd = static_cast<uint64>(header.stringsOffset) + static_cast<uint64>(header.stringsSize);
+        uint64 dataEnd = static_cast<uint64>(header.dataOffset) + static_cast<uint64>(header.dataSize);
+        ok = (recordsEnd <= imageSize) && (stringsEnd <= imageSize) && (dataEnd <= imageSize);
+    }
+    //The string table shall be terminated so that any offset inside it gives a string
+    if (ok) {
+        ok = (header.numberOfRecords > 0u) && (header.stringsSize > 0u);
+    }
+    if (ok) {
+        ok = (image[(header.stringsOffset + header.stringsSize) - 1u] == '\0');
+    }
+    return ok;
+}
+
+/**
+ * @brief Creates the nodes and the leaves of the records of \a numberOfChildren children in the current node of \a database.
+ */
+static bool ImageReadChildren(const char8 * const image,
+                              const ConfigurationDatabaseImageHeader &header,
+                              const uint32 numberOfChildren,
+                              uint32 &recordIndex,
+                              StructuredDataI &database) {
+    bool ok = true;
+    const char8 * const strings = &image[header.stringsOffset];
+    const char8 * const data = &image[header.dataOffset];
+    for (uint32 i = 0u; (i < numberOfChildren) && (ok); i++) {
+        ConfigurationDatabaseImageRecord record;
+        ok = (recordIndex < header.numberOfRecords);
+        if (ok) {
+            uint32 recordOffset = header.recordsOffset + (recordIndex * static_cast<uint32>(sizeof(ConfigurationDatabaseImageRecord)));
+            ok = MemoryOperationsHelper::Copy(&record, &image[recordOffset], static_cast<uint32>(sizeof(ConfigurationDatabaseImageRecord)));
+            recordIndex++;
+        }
+        if (ok) {
+            ok = (record.name < header.stringsSize);
+        }
+        if (ok) {
+            const char8 * const name = &strings[record.name];
+            if (record.kind == IMAGE_NODE_RECORD) {
+                ok = database.CreateRelative(name);
+                if (ok) {
+                    ok = ImageReadChildren(image, header, record.numberOfChildren, recordIndex, database);
+                    if (!database.MoveToAncestor(1u)) {
+                        ok = false;
+                    }
+                }
+            }
+            else {
+                TypeDescriptor td(record.typeDescriptor);
+                uint32 numberOfDimensions = record.numberOfDimensions;
+                uint32 numberOfColumns = record.numberOfElements[0];
+                uint32 numberOfRows = record.numberOfElements[1];
+                ok = (record.kind == IMAGE_LEAF_RECORD) && (ImageTypeSupported(td)) && (numberOfDimensions <= 2u);
+                if (ok) {
+                    ok = (record.numberOfElements[2] == 1u) && ((numberOfDimensions == 2u) || (numberOfRows == 1u))
+                            && ((numberOfDimensions != 0u) || (numberOfColumns == 1u));
+                }
+                uint64 numberOfElements = static_cast<uint64>(numberOfColumns) * static_cast<uint64>(numberOfRows);
+                bool isString = (td.type == BT_CCString);
+                if (ok) {
+                    uint64 elementSize = static_cast<uint64>(sizeof(uint32));
+                    if (!isString) {
+                        elementSize = static_cast<uint64>(td.numberOfBits) / 8u;
+                    }
+                    ok = (static_cast<uint64>(record.dataSize) == (numberOfElements * elementSize));
+                }
+                if (ok) {
+                    ok = ((static_cast<uint64>(record.data) + static_cast<uint64>(record.dataSize)) <= static_cast<uint64>(header.dataSize));
+                }
+                if ((ok) && (isString)) {
+                    //The strings are stored as offsets which are converted back to pointers
+                    const char8 *stackTokens[IMAGE_STRINGS_ON_STACK];
+                    const char8 **tokens = &stackTokens[0];
+                    uint32 nOfTokens = static_cast<uint32>(numberOfElements);
+                    if (nOfTokens > IMAGE_STRINGS_ON_STACK) {
+                        tokens = static_cast<const char8 **>(HeapManager::Malloc(nOfTokens * static_cast<uint32>(sizeof(const char8 *))));
+                        ok = (tokens != NULL_PTR(const char8 **));
+                    }
+                    for (uint32 t = 0u; (t < nOfTokens) && (ok); t++) {
+                        uint32 offset = 0u;
+                        ok = MemoryOperationsHelper::Copy(&offset, &data[record.data + (t * static_cast<uint32>(sizeof(uint32)))], static_cast<uint32>(sizeof(uint32)));
+                        if (ok) {
+                            ok = (offset < header.stringsSize);
+                        }
+                        if (ok) {
+                            tokens[t] = &strings[offset];
+                        }
+                    }
+                    if (ok) {
+                        void *valuePointer = static_cast<void *>(tokens);
+                        if (numberOfDimensions == 0u) {
+                            valuePointer = const_cast<char8 *>(tokens[0]);
+                        }
+                        AnyType value(td, 0u, valuePointer);
+                        value.SetNumberOfDimensions(static_cast<uint8>(numberOfDimensions));
+                        value.SetNumberOfElements(0u, numberOfColumns);
+                        value.SetNumberOfElements(1u, numberOfRows);
+                        value.SetNumberOfElements(2u, 1u);
+                        value.SetStaticDeclared(true);
+                        ok = database.Write(name, value);
+                    }
+                    if ((tokens != &stackTokens[0]) && (tokens != NULL_PTR(const char8 **))) {
+                        void *tokensMemory = static_cast<void *>(tokens);
+                        (void) HeapManager::Free(tokensMemory);
+                    }
+                }
+                else if (ok) {
+                    AnyType value(td, 0u, static_cast<void *>(const_cast<char8 *>(&data[record.data])));
+                    value.SetNumberOfDimensions(static_cast<uint8>(numberOfDimensions));
+                    value.SetNumberOfElements(0u, numberOfColumns);
+                    value.SetNumberOfElements(1u, numberOfRows);
+                    value.SetNumberOfElements(2u, 1u);
+                    value.SetStaticDeclared(true);
+                    ok = database.Write(name, value);
+                }
+                else {
+                    REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Invalid leaf %s in the configuration image", name);
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace ConfigurationDatabaseImage {
+
+uint64 ComputeKey(StreamI &source,
+                  const char8 * const salt) {
+    uint64 key = 0u;
+    if (salt != NULL_PTR(const char8 *)) {
+        uint32 saltSize = StringHelper::Length(salt);
+        if (saltSize > 0u) {
+            WyHashFunction saltHash;
+            key = saltHash.Compute64(salt, saltSize);
+        }
+    }
+    bool ok = source.Seek(0LLU);
+    char8 buffer[IMAGE_READ_CHUNK_SIZE];
+    while (ok) {
+        uint32 size = IMAGE_READ_CHUNK_SIZE;
+        ok = source.Read(&buffer[0], size);
+        if (ok) {
+            ok = (size > 0u);
+        }
+        if (ok) {
+            //Chain the chunks by seeding each one with the key of the previous ones
+            WyHashFunction chunkHash(key);
+            key = chunkHash.Compute64(&buffer[0], size);
+        }
+    }
+    (void) source.Seek(0LLU);
+    return key;
+}
+
+bool Write(StructuredDataI &database,
+           const uint64 key,
+           StreamI &image) {
+    ConfigurationDatabaseImageWriter writer;
+    ConfigurationDatabaseImageRecord root;
+    //The empty string is the name of the root
+    bool ok = ImageInternString(writer, "", root.name);
+    if (ok) {
+        root.typeDescriptor = 0u;
+        root.kind = IMAGE_NODE_RECORD;
+        root.numberOfDimensions = 0u;
+        root.numberOfElements[0] = 0u;
+        root.numberOfElements[1] = 0u;
+        root.numberOfElements[2] = 0u;
+        root.numberOfChildren = database.GetNumberOfChildren();
+        root.data = 0u;
+        root.dataSize = 0u;
+        ok = ImageAddRecord(writer, root);
+    }
+    if (ok) {
+        ok = ImageAddChildren(writer, database);
+    }
+    ConfigurationDatabaseImageHeader header;
+    uint32 stringsEnd = 0u;
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(&header.tag[0], &IMAGE_TAG[0], static_cast<uint32>(sizeof(IMAGE_TAG)));
+        header.version = IMAGE_VERSION;
+        header.byteOrder = IMAGE_BYTE_ORDER;
+        header.key = key;
+        header.numberOfRecords = writer.numberOfRecords;
+        header.recordsOffset = static_cast<uint32>(sizeof(ConfigurationDatabaseImageHeader));
+        header.stringsOffset = header.recordsOffset + static_cast<uint32>(writer.records.Size());
+        header.stringsSize = static_cast<uint32>(writer.strings.Size());
+        stringsEnd = header.stringsOffset + header.stringsSize;
+        header.dataOffset = stringsEnd;
+        uint32 misalignment = stringsEnd % IMAGE_DATA_ALIGNMENT;
+        if (misalignment != 0u) {
+            header.dataOffset += (IMAGE_DATA_ALIGNMENT - misalignment);
+        }
+        header.dataSize = static_cast<uint32>(writer.data.Size());
+    }
+    if (ok) {
+        ok = ImageWriteAll(image, reinterpret_cast<const char8 *>(&header), static_cast<uint32>(sizeof(ConfigurationDatabaseImageHeader)));
+    }
+    if (ok) {
+        ok = ImageWriteAll(image, writer.records.Buffer(), static_cast<uint32>(writer.records.Size()));
+    }
+    if (ok) {
+        ok = ImageWriteAll(image, writer.strings.Buffer(), static_cast<uint32>(writer.strings.Size()));
+    }
+    if (ok) {
+        const char8 padding[IMAGE_DATA_ALIGNMENT] = { '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0' };
+        ok = ImageWriteAll(image, &padding[0], header.dataOffset - stringsEnd);
+    }
+    if (ok) {
+        ok = ImageWriteAll(image, writer.data.Buffer(), static_cast<uint32>(writer.data.Size()));
+    }
+    return ok;
+}
+
+bool GetKey(const char8 * const image,
+            const uint32 imageSize,
+            uint64 &key) {
+    ConfigurationDatabaseImageHeader header;
+    bool ok = ImageGetHeader(image, imageSize, header);
+    if (ok) {
+        key = header.key;
+    }
+    return ok;
+}
+
+bool Read(const char8 * const image,
+          const uint32 imageSize,
+          StructuredDataI &database) {
+    ConfigurationDatabaseImageHeader header;
+    ConfigurationDatabaseImageRecord root;
+    bool ok = ImageGetHeader(image, imageSize, header);
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(&root, &image[header.recordsOffset], static_cast<uint32>(sizeof(ConfigurationDatabaseImageRecord)));
+    }
+    if (ok) {
+        ok = (root.kind == IMAGE_NODE_RECORD);
+    }
+    if (ok) {
+        uint32 recordIndex = 1u;
+        ok = ImageReadChildren(image, header, root.numberOfChildren, recordIndex, database);
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to load the configuration image");
+    }
+    return ok;
+}
+
+bool Read(StreamI &image,
+          StructuredDataI &database) {
+    uint64 streamSize = image.Size();
+    bool ok = (streamSize < 0xFFFFFFFFLLU);
+    uint32 imageSize = static_cast<uint32>(streamSize);
+    char8 *buffer = NULL_PTR(char8 *);
+    if (ok) {
+        ok = (imageSize > 0u);
+    }
+    if (ok) {
+        buffer = static_cast<char8 *>(HeapManager::Malloc(imageSize));
+        ok = (buffer != NULL_PTR(char8 *));
+    }
+    if (ok) {
+        ok = image.Seek(0LLU);
+    }
+    uint32 readSize = 0u;
+    while ((ok) && (readSize < imageSize)) {
+        uint32 size = imageSize - readSize;
+        ok = image.Read(&buffer[readSize], size);
+        if (ok) {
+            ok = (size > 0u);
+        }
+        if (ok) {
+            readSize += size;
+        }
+    }
+    if (ok) {
+        ok = Read(buffer, imageSize, database);
+    }
+    if (buffer != NULL_PTR(char8 *)) {
+        void *bufferMemory = static_cast<void *>(buffer);
+        (void) HeapManager::Free(bufferMemory);
+    }
+    return ok;
+}
+
+bool IsImage(StreamI &stream) {
+    char8 tag[sizeof(IMAGE_TAG)];
+    uint32 size = static_cast<uint32>(sizeof(IMAGE_TAG));
+    bool ok = stream.Seek(0LLU);
+    if (ok) {
+        ok = stream.Read(&tag[0], size);
+    }
+    if (ok) {
+        ok = (size == static_cast<uint32>(sizeof(IMAGE_TAG)));
+    }
+    if (ok) {
+        ok = (MemoryOperationsHelper::Compare(&tag[0], &IMAGE_TAG[0], size) == 0);
+    }
+    (void) stream.Seek(0LLU);
+    return ok;
+}
+
+}
+
+}
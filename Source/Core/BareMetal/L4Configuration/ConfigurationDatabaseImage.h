@@ -0,0 +1,132 @@
+/**
+ * @file ConfigurationDatabaseImage.h
+ * @brief Header file for the ConfigurationDatabaseImage functions
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the ConfigurationDatabaseImage functions
+ * which compile a StructuredDataI into a binary image and load it back.
+ */
+
+#ifndef CONFIGURATIONDATABASEIMAGE_H_
+#define CONFIGURATIONDATABASEIMAGE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "StreamI.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Binary (compiled) images of a configuration database.
+ * @details An image stores an already parsed and type converted tree so that it can be loaded again
+ * without lexing, parsing and converting the source configuration. It is composed of:
+ * - a header with the image version and the key of the source from where it was compiled (see ComputeKey);
+ * - the tree nodes and leaves, in depth first order, each with the type and the dimensions of the leaf value;
+ * - the table of all the names and string values, where each distinct string is stored only once;
+ * - the (8 byte aligned) leaf values, where the strings are stored as offsets in the table above.
+ *
+ * Only the leaves produced by the parsers can be compiled: scalars, vectors and matrices of
+ * integers, floats and char8 * strings. The image uses the byte order of the machine where it was compiled
+ * and it is refused by any machine with a different byte order.
+ */
+namespace ConfigurationDatabaseImage {
+
+/**
+ * @brief Computes the key that identifies the content of a source configuration.
+ * @param[in] source the source configuration. Read from the beginning to the end.
+ * @param[in] salt any other string that changes the result of compiling the \a source (e.g. the parser name).
+ * @return the 64 bit key of the \a source content and of the \a salt.
+ * @post
+ *   source.Position() == 0
+ */
+DLL_API uint64 ComputeKey(StreamI &source,
+                          const char8 * const salt);
+
+/**
+ * @brief Compiles the tree below the current node of \a database into an image.
+ * @param[in] database the tree to compile.
+ * @param[in] key the key of the source of the \a database (see ComputeKey).
+ * @param[out] image the stream where the image is written.
+ * @return true if all the leaves are of a supported type and the image could be completely written.
+ * @post
+ *   The current node of \a database is not changed.
+ */
+DLL_API bool Write(StructuredDataI &database,
+                   const uint64 key,
+                   StreamI &image);
+
+/**
+ * @brief Checks if a memory buffer starts with a valid image header and gets the key of its source.
+ * @param[in] image the memory buffer.
+ * @param[in] imageSize the size of the \a image buffer.
+ * @param[out] key the key given to Write.
+ * @return true if the \a image has a valid header for this version and byte order and its sections fit in \a imageSize.
+ */
+DLL_API bool GetKey(const char8 * const image,
+                    const uint32 imageSize,
+                    uint64 &key);
+
+/**
+ * @brief Loads an image into the current node of \a database.
+ * @param[in] image the memory buffer with the image (see Write).
+ * @param[in] imageSize the size of the \a image buffer.
+ * @param[out] database where the nodes and leaves of the image are created.
+ * @return true if the image is valid and all the nodes and leaves could be created.
+ * @post
+ *   The current node of \a database is not changed.
+ */
+DLL_API bool Read(const char8 * const image,
+                  const uint32 imageSize,
+                  StructuredDataI &database);
+
+/**
+ * @brief Loads an image from a stream into the current node of \a database.
+ * @details The full stream is read into memory and loaded with Read above.
+ * @param[in] image the stream with the image (see Write).
+ * @param[out] database where the nodes and leaves of the image are created.
+ * @return true if the stream could be read and the image loaded.
+ */
+DLL_API bool Read(StreamI &image,
+                  StructuredDataI &database);
+
+/**
+ * @brief Checks if a stream starts with the tag of an image.
+ * @param[in] stream the stream to check.
+ * @return true if the first bytes of the \a stream are the tag of an image.
+ * @post
+ *   stream.Position() == 0
+ */
+DLL_API bool IsImage(StreamI &stream);
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* CONFIGURATIONDATABASEIMAGE_H_ */
@@ -50,6 +50,8 @@ ConfigurationDatabaseNode::ConfigurationDatabaseNode() :
     maxSize = 0u;
     container = NULL_PTR(Reference *);
     muxTimeout = TTInfiniteWait;
+    nameIndex = NULL_PTR(NameIndex *);
+    nameIndexVersion = 0u;
 }
 
 /*lint -e{1579} .Justification: The destructor calls an external function. */
@@ -76,11 +78,26 @@ void ConfigurationDatabaseNode::Purge() {
     containerSize = 0u;
     numberOfNodes = 0u;
     maxSize = 0u;
-    binTree.Reset();
+    IndexReset();
 }
 
 bool ConfigurationDatabaseNode::Insert(Reference ref) {
-    bool ok = Lock();
+    bool locked = Lock();
+    bool ok = locked;
+    const char8 * name = NULL_PTR(const char8 *);
+    if (ok) {
+        ok = ref.IsValid();
+    }
+    if (ok) {
+        name = ref->GetName();
+        ok = (name != NULL);
+    }
+    if (ok) {
+        //The names are unique
+        uint32 existent;
+        IndexUpdate();
+        ok = !FindChild(name, StringHelper::Length(name), existent);
+    }
     if (ok) {
         uint32 index = containerSize;
         if (index >= maxSize) {
@@ -103,7 +120,14 @@ bool ConfigurationDatabaseNode::Insert(Reference ref) {
             }
         }
         container[index] = ref;
-        ok = (binTree.Insert(ref->GetName(), index) != 0xFFFFFFFFu);
+        //A stale index will anyway be rebuilt on the next search
+        if (nameIndex != NULL) {
+            if (nameIndexVersion == Object::GetNamesVersion()) {
+                if (!nameIndex->Insert(nameIndex->Key(name), index)) {
+                    IndexReset();
+                }
+            }
+        }
     }
     if (ok) {
         containerSize++;
@@ -112,99 +136,104 @@ bool ConfigurationDatabaseNode::Insert(Reference ref) {
             numberOfNodes++;
         }
     }
-    UnLock();
+    if (locked) {
+        UnLock();
+    }
     return ok;
 }
 
 uint32 ConfigurationDatabaseNode::Size() {
     uint32 ssize = 0u;
-    if (Lock()) {
+    if (ReadLock()) {
         ssize = containerSize;
+        ReadUnLock();
     }
-    UnLock();
     return ssize;
 }
 
 Reference ConfigurationDatabaseNode::Get(const uint32 idx) {
     Reference ref;
-    if (Lock()) {
+    if (ReadLock()) {
         if (idx < containerSize) {
             ref = container[idx];
         }
+        ReadUnLock();
     }
-    UnLock();
     return ref;
 }
 
 Reference ConfigurationDatabaseNode::Find(const char8 * const path) {
     Reference ret;
-    //find the first name
-    StreamString token;
-    StreamString toTokenize = path;
-    (void) toTokenize.Seek(0LLU);
-    char8 term;
-
-    if (toTokenize.GetToken(token, ".", term)) {
-        uint32 bindex;
-        //binary search
-        if (Lock()) {
-            if (binTree.Search(token.Buffer(), bindex)) {
-                uint32 index = binTree[bindex];
-                if (index < containerSize) {
-                    if (term == '.') {
-                        ReferenceT<ConfigurationDatabaseNode> containerI;
-                        containerI = container[index];
-                        UnLock();
-                        if (containerI.IsValid()) {
-                            StreamString next = &toTokenize.Buffer()[token.Size() + 1u];
-                            if (next.Size() > 0u) {
-                                //continue only for the path
-                                ret = containerI->Find(next.Buffer());
-                            }
-                            else {
-                                ret = containerI;
-                            }
-                        }
-                    }
-                    else {
-                        ret = container[index];
-                    }
+    ConfigurationDatabaseNode *node = this;
+    //Holds the current node while it is being searched
+    ReferenceT<ConfigurationDatabaseNode> nodeHolder;
+    uint32 end = StringHelper::Length(path);
+    uint32 start = 0u;
+    bool ok = true;
+    while ((ok) && (start < end)) {
+        uint32 tokenEnd = start + StringHelper::ComponentLength(&path[start], '.');
+        //Empty names are skipped (as by StreamString::GetToken)
+        if (tokenEnd > start) {
+            Reference child;
+            uint32 index = 0u;
+            ok = node->IndexedReadLock();
+            if (ok) {
+                ok = node->FindChild(&path[start], tokenEnd - start, index);
+                if (ok) {
+                    child = node->container[index];
+                }
+                node->ReadUnLock();
+            }
+            bool last = true;
+            uint32 n;
+            for (n = tokenEnd; (n < end) && (last); n++) {
+                last = (path[n] == '.');
+            }
+            if (ok) {
+                nodeHolder = child;
+                //A leaf can only be the last element of a path without a trailing '.'
+                if ((!last) || (tokenEnd < end)) {
+                    ok = nodeHolder.IsValid();
+                }
+            }
+            if (ok) {
+                if (last) {
+                    ret = child;
+                }
+                else {
+                    node = nodeHolder.operator ->();
                 }
             }
         }
-        UnLock();
+        start = tokenEnd + 1u;
     }
-
     return ret;
 }
 
 Reference ConfigurationDatabaseNode::FindLeaf(const char8 * const name) {
     Reference ret;
-    uint32 bindex;
-    //binary search
-    if (Lock()) {
-        if (binTree.Search(name, bindex)) {
-            uint32 index = binTree[bindex];
-            if (index < containerSize) {
-                ret = container[index];
-            }
+    uint32 index;
+    if (IndexedReadLock()) {
+        if (FindChild(name, StringHelper::Length(name), index)) {
+            ret = container[index];
         }
+        ReadUnLock();
     }
-    UnLock();
     return ret;
 }
 
 bool ConfigurationDatabaseNode::Delete(Reference ref) {
-    bool ok = Lock();
+    bool locked = Lock();
+    bool ok = locked;
     if (ok) {
         ok = ref.IsValid();
         uint32 index = 0u;
-        //binary search
         if (ok) {
-            uint32 bindex;
-            if (binTree.Search(ref->GetName(), bindex)) {
-                index = binTree[bindex];
-                ok = (index < containerSize);
+            const char8 * const name = ref->GetName();
+            ok = (name != NULL);
+            if (ok) {
+                IndexUpdate();
+                ok = FindChild(name, StringHelper::Length(name), index);
             }
         }
         if (ok) {
@@ -237,15 +266,9 @@ bool ConfigurationDatabaseNode::Delete(Reference ref) {
                 maxSize = 0u;
             }
         }
-        //Need to remap...
+        //The positions have changed. Rebuilt on the next search.
         if (ok) {
-            binTree.Reset();
-            uint32 i;
-            for (i=0u; (i<containerSize) && (ok); i++) {
-                /*lint -e{613} containerSize > 0 => container != NULL*/
-                Reference eRef = container[i];
-                ok = (binTree.Insert(eRef->GetName(), static_cast<uint32>(i)) != 0xFFFFFFFFu);
-            }
+            IndexReset();
         }
         if (ok) {
             //Break the reference to the parent
@@ -257,7 +280,9 @@ bool ConfigurationDatabaseNode::Delete(Reference ref) {
             }
         }
     }
-    UnLock();
+    if (locked) {
+        UnLock();
+    }
     return ok;
 }
 
@@ -277,12 +302,110 @@ void ConfigurationDatabaseNode::UnLock() {
     mux.FastUnLock();
 }
 
+bool ConfigurationDatabaseNode::ReadLock() {
+    return (mux.FastReadLock(muxTimeout) == ErrorManagement::NoError);
+}
+
+void ConfigurationDatabaseNode::ReadUnLock() {
+    mux.FastReadUnLock();
+}
+
+bool ConfigurationDatabaseNode::IndexedReadLock() {
+    bool ok = ReadLock();
+    if ((ok) && (IndexIsStale())) {
+        //The index can only be (re)built with the exclusive lock
+        ReadUnLock();
+        ok = Lock();
+        if (ok) {
+            IndexUpdate();
+            UnLock();
+            ok = ReadLock();
+        }
+    }
+    return ok;
+}
+
+bool ConfigurationDatabaseNode::FindChild(const char8 * const name,
+                                          const uint32 nameSize,
+                                          uint32 &index) {
+    bool found = false;
+    //A stale index (e.g. renamed in the meanwhile or failed to build) falls back to the linear search
+    if ((nameIndex != NULL) && (nameIndexVersion == Object::GetNamesVersion())) {
+        uint32 key = nameIndex->Key(name, nameSize);
+        uint32 cursor = 0u;
+        uint32 candidate = 0u;
+        while ((!found) && (nameIndex->Search(key, cursor, candidate))) {
+            if (candidate < containerSize) {
+                found = StringHelper::EqualsN(container[candidate]->GetName(), name, nameSize);
+            }
+            if (found) {
+                index = candidate;
+            }
+        }
+    }
+    else {
+        uint32 n;
+        for (n = 0u; (n < containerSize) && (!found); n++) {
+            /*lint -e{613} containerSize > 0 => container != NULL*/
+            found = StringHelper::EqualsN(container[n]->GetName(), name, nameSize);
+            if (found) {
+                index = n;
+            }
+        }
+    }
+    return found;
+}
+
+void ConfigurationDatabaseNode::IndexBuild() {
+    //Read before walking the container so that a concurrent rename invalidates the index
+    nameIndexVersion = Object::GetNamesVersion();
+    if (nameIndex == NULL) {
+        nameIndex = new NameIndex();
+    }
+    else {
+        nameIndex->Reset();
+    }
+    bool ok = true;
+    uint32 n;
+    for (n = 0u; (n < containerSize) && (ok); n++) {
+        /*lint -e{613} containerSize > 0 => container != NULL*/
+        const char8 * const name = container[n]->GetName();
+        if (name != NULL) {
+            ok = nameIndex->Insert(nameIndex->Key(name), n);
+        }
+    }
+    if (!ok) {
+        IndexReset();
+    }
+}
+
+bool ConfigurationDatabaseNode::IndexIsStale() const {
+    bool stale = (containerSize >= CONFIGURATION_DATABASE_NODE_INDEX_THRESHOLD);
+    if (stale) {
+        stale = ((nameIndex == NULL) || (nameIndexVersion != Object::GetNamesVersion()));
+    }
+    return stale;
+}
+
+void ConfigurationDatabaseNode::IndexUpdate() {
+    if (IndexIsStale()) {
+        IndexBuild();
+    }
+}
+
+void ConfigurationDatabaseNode::IndexReset() {
+    if (nameIndex != NULL) {
+        delete nameIndex;
+        nameIndex = NULL_PTR(NameIndex *);
+    }
+}
+
 uint32 ConfigurationDatabaseNode::GetNumberOfNodes() {
     uint32 ssize = 0u;
-    if (Lock()) {
+    if (ReadLock()) {
         ssize = numberOfNodes;
+        ReadUnLock();
     }
-    UnLock();
     return ssize;
 }
 
@@ -31,22 +31,31 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
-#include "BinaryTree.h"
-#include "Fnv1aHashFunction.h"
+#include "HashIndex.h"
 #include "Object.h"
 #include "ReferenceContainer.h"
 #include "ReferenceT.h"
+#include "WyHashFunction.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * Number of elements from which the names of the elements of a ConfigurationDatabaseNode are indexed with an hash table
+ * (smaller nodes are searched linearly).
+ */
+const uint32 CONFIGURATION_DATABASE_NODE_INDEX_THRESHOLD = 8u;
+
 /**
  * @brief A ReferenceContainer like node implementation optimised for the ConfigurationDatabase.
- * @details With respect to the ReferenceContainer, the ConfigurationDatabaseNode offers an optimised Find method,
- * based on the BinaryTree and allows to directly navigate to the parent Container.
+ * @details With respect to the ReferenceContainer, the ConfigurationDatabaseNode offers an optimised Find method
+ * and allows to directly navigate to the parent Container.
  *
+ * The elements of nodes with at least CONFIGURATION_DATABASE_NODE_INDEX_THRESHOLD elements are indexed by name in an hash table,
+ * built on the first search and then kept up to date by Insert (Delete discards it, as the positions of the elements change),
+ * so that each name of a path is resolved in O(1). The index is rebuilt if an Object is renamed (see Object::GetNamesVersion).
  */
 class DLL_API ConfigurationDatabaseNode: public Object {
 
@@ -71,7 +80,7 @@ ConfigurationDatabaseNode    ();
     /**
      * @brief Inserts a reference to this node.
      * @param[in] ref the reference to be added.
-     * @return true if the reference is successfully added.
+     * @return true if the reference is successfully added (false if another element already has the same name).
      */
     bool Insert(Reference ref);
 
@@ -140,6 +149,60 @@ private:
      */
     void UnLock();
 
+    /**
+     * @brief Locks the internal spin-lock mutex in shared mode (i.e. concurrently with other readers, but not with Lock).
+     * @return true if the lock succeeds.
+     */
+    bool ReadLock();
+
+    /**
+     * @brief Unlocks the shared lock taken with ReadLock or IndexedReadLock.
+     */
+    void ReadUnLock();
+
+    /**
+     * @brief As ReadLock, after having (re)built the name index with the exclusive lock if it is stale.
+     * @return true if the lock succeeds.
+     */
+    bool IndexedReadLock();
+
+    /**
+     * @brief Searches the element with a given name.
+     * @param[in] name the name (not necessarily terminated).
+     * @param[in] nameSize the number of characters of the name.
+     * @param[out] index the position of the element in the container.
+     * @return true if the element exists.
+     * @details The name index is only used if it is up to date (see IndexUpdate), otherwise the container is searched linearly.
+     * @pre Lock() or ReadLock() was called.
+     */
+    bool FindChild(const char8 * const name,
+                   const uint32 nameSize,
+                   uint32 &index);
+
+    /**
+     * @brief Builds the name index with all the elements of the container.
+     * @pre Lock() was called.
+     */
+    void IndexBuild();
+
+    /**
+     * @brief Checks if the container is large enough to be indexed and the name index is not built or out of date.
+     * @return true if the name index has to be (re)built before being searched.
+     * @pre Lock() or ReadLock() was called.
+     */
+    bool IndexIsStale() const;
+
+    /**
+     * @brief Builds the name index if it is stale.
+     * @pre Lock() was called.
+     */
+    void IndexUpdate();
+
+    /**
+     * @brief Destroys the name index (to be built again on the next search).
+     */
+    void IndexReset();
+
     /**
      * The container holding all the nodes directly underneath this node.
      */
@@ -168,7 +231,7 @@ private:
     /**
      * Protects multiple access to the internal resources
      */
-    FastPollingMutexSem mux;
+    FastPollingReadWriteSem mux;
 
     /**
      * Timeout
@@ -177,9 +240,19 @@ private:
 
 
     /**
-     * Binary tree containing the indexes of the elements in the container.
+     * Hash table from the names to the positions of the elements in the container.
+     */
+    typedef HashIndex<uint32, WyHashFunction> NameIndex;
+
+    /**
+     * Index of the elements of the container by name (NULL until built).
+     */
+    NameIndex *nameIndex;
+
+    /**
+     * The Object::GetNamesVersion() when nameIndex was built.
      */
-    BinaryTree<uint32, Fnv1aHashFunction> binTree;
+    uint32 nameIndexVersion;
 
     /**
      * The parent node
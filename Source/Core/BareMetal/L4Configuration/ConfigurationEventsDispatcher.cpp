@@ -0,0 +1,335 @@
+/**
+ * @file ConfigurationEventsDispatcher.cpp
+ * @brief Source file for class ConfigurationEventsDispatcher
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ConfigurationEventsDispatcher (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationEventsDispatcher.h"
+#include "HeapManager.h"
+#include "Reference.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Checks if a path is, or is below, the path of a filter.
+ * @param[in] fullPath the path names separated by dots.
+ * @param[in] filter the filter names separated by dots, where "*" matches any name.
+ * @return true if all the names of the \a filter match the first names of \a fullPath.
+ */
+static bool MatchFilter(const char8 * const fullPath,
+                        const char8 * const filter) {
+    uint32 p = 0u;
+    uint32 f = 0u;
+    bool match = true;
+    bool done = false;
+    while ((match) && (!done)) {
+        if (filter[f] == '\0') {
+            // all the filter consumed: match if at the end of a path name
+            match = ((fullPath[p] == '\0') || (fullPath[p] == '.'));
+            done = true;
+        }
+        else if (fullPath[p] == '\0') {
+            match = false;
+        }
+        else {
+            bool wildcard = (filter[f] == '*') && ((filter[f + 1u] == '.') || (filter[f + 1u] == '\0'));
+            if (wildcard) {
+                f++;
+                while ((fullPath[p] != '.') && (fullPath[p] != '\0')) {
+                    p++;
+                }
+            }
+            else {
+                while ((filter[f] != '.') && (filter[f] != '\0') && (match)) {
+                    match = (filter[f] == fullPath[p]);
+                    f++;
+                    p++;
+                }
+                if (match) {
+                    match = ((fullPath[p] == '.') || (fullPath[p] == '\0'));
+                }
+            }
+            if ((match) && (filter[f] == '.')) {
+                f++;
+                if (fullPath[p] == '.') {
+                    p++;
+                }
+                else {
+                    // the path is shorter than the filter
+                    match = false;
+                }
+            }
+        }
+    }
+    return match;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ConfigurationEventsDispatcher::ConfigurationEventsDispatcher(ConfigurationEventsI &receiverIn) :
+        StructuredDataI() {
+    receiver = &receiverIn;
+}
+
+/*lint -e{1551} the filters are freed with HeapManager::Free which does not throw.*/
+ConfigurationEventsDispatcher::~ConfigurationEventsDispatcher() {
+    uint32 numberOfFilters = filters.GetSize();
+    for (uint32 i = 0u; i < numberOfFilters; i++) {
+        char8 *filter = static_cast<char8 *>(NULL);
+        if (filters.Peek(i, filter)) {
+            void *mem = static_cast<void *>(filter);
+            (void) HeapManager::Free(mem);
+        }
+    }
+    receiver = static_cast<ConfigurationEventsI *>(NULL);
+}
+
+bool ConfigurationEventsDispatcher::AddFilter(const char8 * const filter) {
+    bool ok = (filter != NULL);
+    if (ok) {
+        ok = (StringHelper::Length(filter) > 0u);
+    }
+    if (ok) {
+        char8 *filterCopy = StringHelper::StringDup(filter);
+        ok = (filterCopy != NULL);
+        if (ok) {
+            ok = filters.Add(filterCopy);
+            if (!ok) {
+                void *mem = static_cast<void *>(filterCopy);
+                (void) HeapManager::Free(mem);
+            }
+        }
+    }
+    return ok;
+}
+
+bool ConfigurationEventsDispatcher::IsSelected(const char8 * const fullPath) const {
+    uint32 numberOfFilters = filters.GetSize();
+    bool ret = (numberOfFilters == 0u);
+    const char8 * const * const filterList = filters.GetAllocatedMemoryConst();
+    for (uint32 i = 0u; (i < numberOfFilters) && (!ret); i++) {
+        ret = MatchFilter(fullPath, filterList[i]);
+    }
+    return ret;
+}
+
+/*lint -e{715} -e{952} -e{1762} reading is not supported.*/
+bool ConfigurationEventsDispatcher::Read(const char8 * const name,
+                                         const AnyType &value) {
+    return false;
+}
+
+/*lint -e{715} -e{952} -e{1762} reading is not supported.*/
+AnyType ConfigurationEventsDispatcher::GetType(const char8 * const name) {
+    return voidAnyType;
+}
+
+bool ConfigurationEventsDispatcher::Write(const char8 * const name,
+                                          const AnyType &value) {
+    bool ok = (name != NULL);
+    if (ok) {
+        uint32 depth = selected.GetSize();
+        bool isSelected = false;
+        if (depth > 0u) {
+            ok = selected.Peek(depth - 1u, isSelected);
+        }
+        uint32 nodePathSize = static_cast<uint32>(currentPath.Size());
+        if (ok) {
+            if (nodePathSize > 0u) {
+                ok = (currentPath += '.');
+            }
+        }
+        if (ok) {
+            ok = (currentPath += name);
+        }
+        if (ok) {
+            if (!isSelected) {
+                isSelected = IsSelected(currentPath.Buffer());
+            }
+            if (isSelected) {
+                ok = receiver->Leaf(currentPath.Buffer(), name, value);
+            }
+        }
+        if (!currentPath.SetSize(static_cast<uint64>(nodePathSize))) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+/*lint -e{715} -e{952} -e{1762} copying is not supported.*/
+bool ConfigurationEventsDispatcher::Copy(StructuredDataI &destination) {
+    return false;
+}
+
+/*lint -e{715} -e{952} -e{1762} storing references is not supported.*/
+bool ConfigurationEventsDispatcher::AddToCurrentNode(Reference node) {
+    return false;
+}
+
+bool ConfigurationEventsDispatcher::MoveToRoot() {
+    return MoveToAncestor(selected.GetSize());
+}
+
+bool ConfigurationEventsDispatcher::MoveToAncestor(uint32 generations) {
+    bool ok = (generations <= selected.GetSize());
+    for (uint32 i = 0u; (i < generations) && (ok); i++) {
+        uint32 depth = selected.GetSize();
+        bool isSelected = false;
+        uint32 nameStart = 0u;
+        ok = selected.Extract(depth - 1u, isSelected);
+        if (ok) {
+            ok = nameStarts.Extract(depth - 1u, nameStart);
+        }
+        if (ok) {
+            if (isSelected) {
+                ok = receiver->EndNode(currentPath.Buffer(), &(currentPath.Buffer()[nameStart]));
+            }
+        }
+        // remove the name and the separator
+        uint32 parentPathSize = (nameStart > 0u) ? (nameStart - 1u) : (0u);
+        if (!currentPath.SetSize(static_cast<uint64>(parentPathSize))) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+/*lint -e{715} -e{952} -e{1762} navigation is not supported.*/
+bool ConfigurationEventsDispatcher::MoveAbsolute(const char8 * const path) {
+    return false;
+}
+
+/*lint -e{715} -e{952} -e{1762} navigation is not supported.*/
+bool ConfigurationEventsDispatcher::MoveRelative(const char8 * const path) {
+    return false;
+}
+
+/*lint -e{715} -e{952} -e{1762} navigation is not supported.*/
+bool ConfigurationEventsDispatcher::MoveToChild(const uint32 childIdx) {
+    return false;
+}
+
+bool ConfigurationEventsDispatcher::CreateAbsolute(const char8 * const path) {
+    bool ok = MoveToRoot();
+    if (ok) {
+        ok = CreateRelative(path);
+    }
+    return ok;
+}
+
+bool ConfigurationEventsDispatcher::CreateRelative(const char8 * const path) {
+    bool ok = (path != NULL);
+    if (ok) {
+        ok = (path[0] != '\0');
+    }
+    uint32 i = 0u;
+    while ((ok) && (path[i] != '\0')) {
+        uint32 depth = selected.GetSize();
+        bool isSelected = false;
+        if (depth > 0u) {
+            ok = selected.Peek(depth - 1u, isSelected);
+        }
+        uint32 nameStart = static_cast<uint32>(currentPath.Size());
+        if ((ok) && (nameStart > 0u)) {
+            ok = (currentPath += '.');
+            nameStart++;
+        }
+        uint32 nameSize = 0u;
+        while ((ok) && (path[i] != '.') && (path[i] != '\0')) {
+            ok = (currentPath += path[i]);
+            nameSize++;
+            i++;
+        }
+        if (ok) {
+            ok = (nameSize > 0u);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Empty node name in %s", path);
+            }
+        }
+        if (ok) {
+            if (!isSelected) {
+                isSelected = IsSelected(currentPath.Buffer());
+            }
+            ok = nameStarts.Add(nameStart);
+            if (ok) {
+                ok = selected.Add(isSelected);
+            }
+        }
+        if ((ok) && (isSelected)) {
+            ok = receiver->BeginNode(currentPath.Buffer(), &(currentPath.Buffer()[nameStart]));
+        }
+        if ((ok) && (path[i] == '.')) {
+            i++;
+            ok = (path[i] != '\0');
+        }
+    }
+    return ok;
+}
+
+/*lint -e{715} -e{952} -e{1762} deleting is not supported.*/
+bool ConfigurationEventsDispatcher::Delete(const char8 * const name) {
+    return false;
+}
+
+const char8 *ConfigurationEventsDispatcher::GetName() {
+    uint32 depth = nameStarts.GetSize();
+    uint32 nameStart = 0u;
+    if (depth > 0u) {
+        if (!nameStarts.Peek(depth - 1u, nameStart)) {
+            nameStart = 0u;
+        }
+    }
+    return (depth > 0u) ? (&(currentPath.Buffer()[nameStart])) : ("");
+}
+
+/*lint -e{715} -e{952} -e{1762} the children are not stored.*/
+const char8 *ConfigurationEventsDispatcher::GetChildName(const uint32 index) {
+    return static_cast<const char8 *>(NULL);
+}
+
+/*lint -e{1762} the children are not stored.*/
+uint32 ConfigurationEventsDispatcher::GetNumberOfChildren() {
+    return 0u;
+}
+
+}
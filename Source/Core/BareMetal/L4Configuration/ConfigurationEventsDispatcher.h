@@ -0,0 +1,235 @@
+/**
+ * @file ConfigurationEventsDispatcher.h
+ * @brief Header file for class ConfigurationEventsDispatcher
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ConfigurationEventsDispatcher
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CONFIGURATIONEVENTSDISPATCHER_H_
+#define CONFIGURATIONEVENTSDISPATCHER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "ConfigurationEventsI.h"
+#include "StaticList.h"
+#include "StreamString.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A StructuredDataI which, instead of storing the tree, forwards each node and leaf
+ * to a ConfigurationEventsI as soon as it is created.
+ * @details Given as the output database of any ConfigurationParserI (StandardParser, JsonParser,
+ * XMLParser), it turns the parser in an event driven (SAX like) parser: the tree is never built and the
+ * memory used does not depend on the size of the input, e.g.
+ * <pre>
+ *   ConfigurationEventsDispatcher dispatcher(receiver);
+ *   dispatcher.AddFilter("App.Functions.*.Class");
+ *   JsonParser parser(stream, dispatcher, &err);
+ *   bool ok = parser.Parse();
+ * </pre>
+ *
+ * If filters are added (see AddFilter), only the nodes and the leaves which are, or are below, the path
+ * of at least one filter are forwarded. Without filters everything is forwarded.
+ *
+ * Only the operations needed to build a tree are supported: CreateRelative, CreateAbsolute,
+ * MoveToAncestor, MoveToRoot and Write. All the other operations (reading, navigating
+ * and deleting) fail.
+ */
+class DLL_API ConfigurationEventsDispatcher: public StructuredDataI {
+public:
+
+    /**
+     * @brief Constructor.
+     * @param[in] receiverIn the receiver of the events.
+     * @post
+     *   GetName() == ""
+     */
+    ConfigurationEventsDispatcher(ConfigurationEventsI &receiverIn);
+
+    /**
+     * @brief Destructor. Frees the filters.
+     */
+    virtual ~ConfigurationEventsDispatcher();
+
+    /**
+     * @brief Adds a path filter.
+     * @details The filter is a path of names separated by dots, where a "*" matches any
+     * single name (e.g. "App.Functions.*.InputSignals").
+     * @param[in] filter the path filter.
+     * @return false if \a filter is NULL or empty.
+     */
+    bool AddFilter(const char8 * const filter);
+
+    /**
+     * @brief Not supported.
+     * @return false.
+     */
+    virtual bool Read(const char8 * const name,
+                      const AnyType &value);
+
+    /**
+     * @brief Not supported.
+     * @return voidAnyType.
+     */
+    virtual AnyType GetType(const char8 * const name);
+
+    /**
+     * @brief Forwards a leaf of the current node to ConfigurationEventsI::Leaf (if not filtered out).
+     * @param[in] name the name of the leaf.
+     * @param[in] value the value of the leaf.
+     * @return the value returned by the receiver (true if filtered out) or false if \a name is NULL.
+     */
+    virtual bool Write(const char8 * const name,
+                       const AnyType &value);
+
+    /**
+     * @brief Not supported.
+     * @return false.
+     */
+    virtual bool Copy(StructuredDataI &destination);
+
+    /**
+     * @brief Not supported.
+     * @return false.
+     */
+    virtual bool AddToCurrentNode(Reference node);
+
+    /**
+     * @brief Closes all the open nodes, calling ConfigurationEventsI::EndNode for each of them.
+     * @return true if all the EndNode calls returned true.
+     */
+    virtual bool MoveToRoot();
+
+    /**
+     * @brief Closes \a generations nodes, calling ConfigurationEventsI::EndNode for each of them.
+     * @param[in] generations the number of nodes to close.
+     * @return false if there are less than \a generations open nodes or if any EndNode call returned false.
+     */
+    virtual bool MoveToAncestor(uint32 generations);
+
+    /**
+     * @brief Not supported.
+     * @return false.
+     */
+    virtual bool MoveAbsolute(const char8 * const path);
+
+    /**
+     * @brief Not supported.
+     * @return false.
+     */
+    virtual bool MoveRelative(const char8 * const path);
+
+    /**
+     * @brief Not supported.
+     * @return false.
+     */
+    virtual bool MoveToChild(const uint32 childIdx);
+
+    /**
+     * @brief Closes all the open nodes (see MoveToRoot) and opens the nodes of \a path (see CreateRelative).
+     * @param[in] path the path of the nodes to open.
+     * @return true if the nodes were closed and opened.
+     */
+    virtual bool CreateAbsolute(const char8 * const path);
+
+    /**
+     * @brief Opens the nodes of \a path, calling ConfigurationEventsI::BeginNode for each of them.
+     * @param[in] path the names of the nodes separated by dots.
+     * @return false if \a path is NULL or has an empty name or if any BeginNode call returned false.
+     */
+    virtual bool CreateRelative(const char8 * const path);
+
+    /**
+     * @brief Not supported.
+     * @return false.
+     */
+    virtual bool Delete(const char8 * const name);
+
+    /**
+     * @brief Gets the name of the current (i.e. the last open) node.
+     * @return the name of the current node or "" if there are no open nodes.
+     */
+    virtual const char8 *GetName();
+
+    /**
+     * @brief Not supported.
+     * @return NULL.
+     */
+    virtual const char8 *GetChildName(const uint32 index);
+
+    /**
+     * @brief The children are never stored.
+     * @return 0.
+     */
+    virtual uint32 GetNumberOfChildren();
+
+private:
+
+    /**
+     * @brief Checks if a path is selected by the filters.
+     * @param[in] fullPath the path to check.
+     * @return true if there are no filters or if \a fullPath is, or is below, the path of any filter.
+     */
+    bool IsSelected(const char8 * const fullPath) const;
+
+    /**
+     * The receiver of the events.
+     */
+    ConfigurationEventsI *receiver;
+
+    /**
+     * The full path of the current node.
+     */
+    StreamString currentPath;
+
+    /**
+     * For each open node, the position of its name in path.
+     */
+    StaticList<uint32> nameStarts;
+
+    /**
+     * For each open node, whether it was selected by the filters.
+     */
+    StaticList<bool> selected;
+
+    /**
+     * The path filters.
+     */
+    StaticList<char8 *> filters;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* CONFIGURATIONEVENTSDISPATCHER_H_ */
@@ -0,0 +1,105 @@
+/**
+ * @file ConfigurationEventsI.h
+ * @brief Header file for class ConfigurationEventsI
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ConfigurationEventsI
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CONFIGURATIONEVENTSI_H_
+#define CONFIGURATIONEVENTSI_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "AnyType.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Interface of the receivers of the events of an event driven (SAX like) parsing.
+ * @details The events are generated, in the order in which the nodes and the leaves are found in the
+ * parsed input, by a ConfigurationEventsDispatcher given to any ConfigurationParserI as the output database.
+ *
+ * The \a path of each event is the full path of the node or of the leaf, with the names separated by dots
+ * (e.g. "App.Functions.GAM1.Class"), and the \a name is its last element.
+ *
+ * If any of the methods returns false the parsing is aborted with an error.
+ */
+class DLL_API ConfigurationEventsI {
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~ConfigurationEventsI();
+
+    /**
+     * @brief Called when a node is opened.
+     * @param[in] path the full path of the node.
+     * @param[in] name the name of the node.
+     * @return true to continue parsing.
+     */
+    virtual bool BeginNode(const char8 * const path,
+                           const char8 * const name) = 0;
+
+    /**
+     * @brief Called when a node is closed, after all the events of its children.
+     * @param[in] path the full path of the node.
+     * @param[in] name the name of the node.
+     * @return true to continue parsing.
+     */
+    virtual bool EndNode(const char8 * const path,
+                         const char8 * const name) = 0;
+
+    /**
+     * @brief Called when a leaf is parsed.
+     * @param[in] path the full path of the leaf.
+     * @param[in] name the name of the leaf.
+     * @param[in] value the value of the leaf, already converted to the type of the type cast (if any).
+     * Only valid until this method returns.
+     * @return true to continue parsing.
+     */
+    virtual bool Leaf(const char8 * const path,
+                      const char8 * const name,
+                      const AnyType &value) = 0;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+inline ConfigurationEventsI::~ConfigurationEventsI() {
+}
+
+}
+
+#endif /* CONFIGURATIONEVENTSI_H_ */
@@ -32,6 +32,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
 #include "ConfigurationParserI.h"
 #include "TypeConversion.h"
 
@@ -90,6 +91,23 @@ ConfigurationParserI::ConfigurationParserI(StreamI &stream,
     
 }
 
+ConfigurationParserI::ConfigurationParserI(const char8 * const input,
+                               const uint32 inputSize,
+                               StructuredDataI &databaseIn,
+                               BufferedStreamI * const err,
+                               const GrammarInfo &grammarIn)
+        : ParserI(input, inputSize, err, grammarIn)
+        , memory(1u) {
+
+    numberOfColumns = 0u;
+    firstNumberOfColumns = 0u;
+    numberOfRows = 0u;
+    database = &databaseIn;
+    tokenType = 0u;
+    numberOfDimensions = 0u;
+
+}
+
 ConfigurationParserI::~ConfigurationParserI() {
     database=static_cast<StructuredDataI*>(NULL);
 }
@@ -129,7 +147,18 @@ void ConfigurationParserI::AddLeaf() {
     AnyType element = memory.Create(numberOfDimensions, &dimSizes[0]);
     bool ret = (element.GetDataPointer() != NULL);
     if (ret) {
-        ret = database->Write(nodeName.Buffer(), element);
+        ConfigurationDatabase *configurationDatabase = dynamic_cast<ConfigurationDatabase *>(database);
+        void *released = NULL_PTR(void *);
+        if (configurationDatabase != NULL_PTR(ConfigurationDatabase *)) {
+            //The (non-string) elements are handed over to the leaf instead of being copied again
+            released = memory.Release(1u);
+        }
+        if (released != NULL_PTR(void *)) {
+            ret = configurationDatabase->WriteAdopted(nodeName.Buffer(), element);
+        }
+        else {
+            ret = database->Write(nodeName.Buffer(), element);
+        }
         if (!ret) {
             PrintErrorOnStream("Failed adding a leaf to the configuration database! [%d]", GetCurrentTokenLineNumber(currentToken), errorStream);
             isError = true;
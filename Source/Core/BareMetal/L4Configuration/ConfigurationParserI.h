@@ -103,6 +103,23 @@ public:
             BufferedStreamI * const err,
             const GrammarInfo &grammarIn);
 
+    /**
+     * @brief Constructor which parses a memory buffer instead of a stream.
+     * @param[in] input is the buffer to be parsed (see ParserI).
+     * @param[in] inputSize is the number of characters in \a input.
+     * @param[in,out] databaseIn is the StructuredDataI in output.
+     * @param[out] err is a stream where parse error messages are written into.
+     * @param[in] grammarIn contains the comments patterns, the separator and
+     * terminal characters.
+     * @post
+     *   GetGrammar() == grammarIn
+     */
+    ConfigurationParserI(const char8 * const input,
+            const uint32 inputSize,
+            StructuredDataI &databaseIn,
+            BufferedStreamI * const err,
+            const GrammarInfo &grammarIn);
+
     /**
      * @brief Destructor.
      */
@@ -31,12 +31,58 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "AdvancedErrorManagement.h"
+#include "HeapManager.h"
 #include "JsonParser.h"
+#include "TypeConversion.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+static void PrintErrorOnStream(const char8 * const format,
+                               const uint32 lineNumber,
+                               BufferedStreamI * const err) {
+    if (err != NULL) {
+        if (!err->Printf(format, lineNumber)) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "PrintErrorOnStream: Failed Printf() on parseError stream");
+        }
+    }
+
+    REPORT_ERROR_STATIC(ErrorManagement::FatalError, format, lineNumber);
+}
+
+/**
+ * @brief Checks if \a c ends a token which is not a string (see JsonStructuralIndex).
+ */
+static inline bool IsJsonTokenEnd(const char8 c) {
+    bool ret = false;
+    switch (c) {
+    case ('{'):
+    case ('}'):
+    case ('['):
+    case (']'):
+    case (':'):
+    case ('"'):
+    case (' '):
+    case ('\t'):
+    case ('\n'):
+    case ('\r'):
+    case (','): {
+        ret = true;
+    }
+        break;
+    default: {
+    }
+        break;
+    }
+    return ret;
+}
+
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -114,6 +160,30 @@ JsonParser::JsonParser(StreamI &stream,
                        StructuredDataI &databaseIn,
                        BufferedStreamI * const err) :
         ConfigurationParserI(stream, databaseIn, err, JsonGrammar) {
+    InitialiseActions();
+    indexedInput = NULL_PTR(const char8 *);
+    indexedInputSize = 0u;
+    indexedEntry = 0u;
+    indexedTerminal = '\0';
+    tokenBuffer = NULL_PTR(char8 *);
+    tokenBufferSize = 0u;
+}
+
+JsonParser::JsonParser(const char8 * const input,
+                       const uint32 inputSize,
+                       StructuredDataI &databaseIn,
+                       BufferedStreamI * const err) :
+        ConfigurationParserI(input, inputSize, databaseIn, err, JsonGrammar) {
+    InitialiseActions();
+    indexedInput = input;
+    indexedInputSize = inputSize;
+    indexedEntry = 0u;
+    indexedTerminal = '\0';
+    tokenBuffer = NULL_PTR(char8 *);
+    tokenBufferSize = 0u;
+}
+
+void JsonParser::InitialiseActions() {
     Action[0] = static_cast<void (JsonParser::*)(void)>(NULL);
     Action [ 1 ] = &JsonParser::End;
     Action [ 2 ] = &JsonParser::GetNodeName;
@@ -123,11 +193,294 @@ JsonParser::JsonParser(StreamI &stream,
     Action [ 6 ] = &JsonParser::EndVector;
     Action [ 7 ] = &JsonParser::EndMatrix;
     Action [ 8 ] = &JsonParser::BlockEnd;
-
 }
 
 JsonParser::~JsonParser() {
+    if (tokenBuffer != NULL_PTR(char8 *)) {
+        void *mem = reinterpret_cast<void *>(tokenBuffer);
+        (void) HeapManager::Free(mem);
+    }
+    tokenBuffer = NULL_PTR(char8 *);
+    indexedInput = NULL_PTR(const char8 *);
+}
+
+bool JsonParser::Parse() {
+    bool ret;
+    if (indexedInput != NULL_PTR(const char8 *)) {
+        ret = ParseIndexed();
+    }
+    else {
+        ret = ParserI::Parse();
+    }
+    return ret;
+}
+
+bool JsonParser::ParseIndexed() {
+    isError = !structuralIndex.Build(indexedInput, indexedInputSize);
+    if (isError) {
+        uint32 lineNumber = 0u;
+        if (structuralIndex.GetSize() > 0u) {
+            lineNumber = structuralIndex.GetLineNumber(structuralIndex.GetSize() - 1u);
+        }
+        PrintErrorOnStream("Unterminated string on line [%d].", lineNumber, errorStream);
+    }
+    else {
+        indexedEntry = 0u;
+        currentToken = &indexedToken;
+        NextToken();
+        bool parsed = false;
+        while ((!isError) && (indexedToken.GetId() != EOF_TOKEN)) {
+            ParseExpression(0u);
+            parsed = true;
+        }
+        if ((!isError) && (parsed)) {
+            End();
+        }
+    }
+    currentToken = NULL_PTR(Token *);
+    return !isError;
+}
+
+void JsonParser::NextToken() {
+    if (indexedEntry < structuralIndex.GetSize()) {
+        uint32 position = structuralIndex.GetPosition(indexedEntry);
+        uint32 lineNumber = structuralIndex.GetLineNumber(indexedEntry);
+        char8 c = indexedInput[position];
+        indexedTerminal = '\0';
+        if (c == '"') {
+            //the next entry is the closing quote
+            uint32 end = structuralIndex.GetPosition(indexedEntry + 1u);
+            indexedToken.Set(STRING_TOKEN, "STRING", DecodeToken(position + 1u, end), lineNumber);
+            indexedEntry += 2u;
+        }
+        else if (IsJsonTokenEnd(c)) {
+            char8 terminal[2] = { c, '\0' };
+            indexedToken.Set(TERMINAL_TOKEN, "TERMINAL", &terminal[0], lineNumber);
+            indexedTerminal = c;
+            indexedEntry++;
+        }
+        else {
+            uint32 end = position + 1u;
+            while ((end < indexedInputSize) && (!IsJsonTokenEnd(indexedInput[end]))) {
+                end++;
+            }
+            const char8 * const data = DecodeToken(position, end);
+            //as the LexicalAnalyzer: a token which begins with a digit shall be a number
+            uint32 firstDigit = 0u;
+            if ((data[0] == '+') || (data[0] == '-')) {
+                firstDigit = 1u;
+            }
+            if ((data[firstDigit] >= '0') && (data[firstDigit] <= '9')) {
+                float64 possibleFloat = 0.0;
+                if (TypeConvert(possibleFloat, data)) {
+                    indexedToken.Set(NUMBER_TOKEN, "NUMBER", data, lineNumber);
+                }
+                else {
+                    indexedToken.Set(ERROR_TOKEN, "ERROR", "", lineNumber);
+                }
+            }
+            else {
+                indexedToken.Set(STRING_TOKEN, "STRING", data, lineNumber);
+            }
+            indexedEntry++;
+        }
+    }
+    else {
+        indexedTerminal = '\0';
+        indexedToken.Set(EOF_TOKEN, "EOF", "", indexedToken.GetLineNumber());
+    }
+}
+
+const char8 *JsonParser::DecodeToken(const uint32 begin,
+                                     const uint32 end) {
+    uint32 size = (end - begin) + 1u;
+    if (size > tokenBufferSize) {
+        void *mem = reinterpret_cast<void *>(tokenBuffer);
+        void *newBuffer = HeapManager::Realloc(mem, size);
+        if (newBuffer != NULL_PTR(void *)) {
+            tokenBuffer = static_cast<char8 *>(newBuffer);
+            tokenBufferSize = size;
+        }
+    }
+    const char8 *decoded = "";
+    uint32 n = 0u;
+    if (size <= tokenBufferSize) {
+        bool escape = false;
+        for (uint32 i = begin; i < end; i++) {
+            char8 c = indexedInput[i];
+            if (escape) {
+                //the escape sequences of the LexicalAnalyzer
+                switch (c) {
+                case ('n'): {
+                    c = '\n';
+                }
+                    break;
+                case ('t'): {
+                    c = '\t';
+                }
+                    break;
+                case ('r'): {
+                    c = '\r';
+                }
+                    break;
+                case ('"'):
+                case ('\\'): {
+                }
+                    break;
+                default: {
+                    tokenBuffer[n] = '\\';
+                    n++;
+                }
+                    break;
+                }
+                tokenBuffer[n] = c;
+                n++;
+                escape = false;
+            }
+            else if (c == '\\') {
+                escape = true;
+            }
+            else {
+                tokenBuffer[n] = c;
+                n++;
+            }
+        }
+        tokenBuffer[n] = '\0';
+        decoded = tokenBuffer;
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed allocating the token buffer");
+        isError = true;
+    }
+    return decoded;
+}
+
+void JsonParser::ParseExpression(const uint32 depth) {
+    if (depth > JSON_PARSER_MAX_DEPTH) {
+        PrintErrorOnStream("Too many nested blocks on line [%d].", indexedToken.GetLineNumber(), errorStream);
+        isError = true;
+    }
+    else if (indexedTerminal == '{') {
+        NextToken();
+        ParseBlock(depth + 1u, false);
+    }
+    else if (indexedToken.GetId() == STRING_TOKEN) {
+        nameToken.Set(STRING_TOKEN, "STRING", indexedToken.GetData(), indexedToken.GetLineNumber());
+        NextToken();
+        if (indexedTerminal == ':') {
+            NextToken();
+            //the name is the current token of the actions on it
+            currentToken = &nameToken;
+            if (indexedTerminal == '{') {
+                CreateNode();
+                currentToken = &indexedToken;
+                if (!isError) {
+                    NextToken();
+                    ParseBlock(depth + 1u, true);
+                }
+            }
+            else {
+                GetNodeName();
+                currentToken = &indexedToken;
+                ParseVariable();
+            }
+        }
+        else {
+            SyntaxError();
+        }
+    }
+    else {
+        SyntaxError();
+    }
+}
+
+void JsonParser::ParseBlock(const uint32 depth,
+                            const bool isNode) {
+    //a block cannot be empty
+    if (indexedTerminal == '}') {
+        SyntaxError();
+    }
+    while ((!isError) && (indexedTerminal != '}')) {
+        if (indexedToken.GetId() == EOF_TOKEN) {
+            SyntaxError();
+        }
+        else {
+            ParseExpression(depth);
+        }
+    }
+    if (!isError) {
+        if (isNode) {
+            BlockEnd();
+        }
+        NextToken();
+    }
+}
+
+void JsonParser::ParseVariable() {
+    if (indexedTerminal == '[') {
+        NextToken();
+        if (indexedTerminal == '[') {
+            //a matrix: a vector of vectors
+            while ((!isError) && (indexedTerminal == '[')) {
+                NextToken();
+                ParseVector();
+            }
+            if (!isError) {
+                if (indexedTerminal == ']') {
+                    EndMatrix();
+                    NextToken();
+                }
+                else {
+                    SyntaxError();
+                }
+            }
+        }
+        else {
+            ParseVector();
+        }
+    }
+    else if (IsScalar()) {
+        AddScalar();
+        NextToken();
+    }
+    else {
+        SyntaxError();
+    }
+    if (!isError) {
+        AddLeaf();
+    }
+}
 
+void JsonParser::ParseVector() {
+    //a vector cannot be empty
+    if (!IsScalar()) {
+        SyntaxError();
+    }
+    while ((!isError) && (IsScalar())) {
+        AddScalar();
+        NextToken();
+    }
+    if (!isError) {
+        if (indexedTerminal == ']') {
+            EndVector();
+            NextToken();
+        }
+        else {
+            SyntaxError();
+        }
+    }
+}
+
+bool JsonParser::IsScalar() const {
+    uint32 id = indexedToken.GetId();
+    return ((id == STRING_TOKEN) || (id == NUMBER_TOKEN));
+}
+
+void JsonParser::SyntaxError() {
+    if (!isError) {
+        PrintErrorOnStream("Syntax error. Invalid token on line [%d].", indexedToken.GetLineNumber(), errorStream);
+        isError = true;
+    }
 }
 
 void JsonParser::Execute(const uint32 number) {
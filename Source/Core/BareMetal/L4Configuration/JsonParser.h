@@ -33,6 +33,8 @@
 /*---------------------------------------------------------------------------*/
 
 #include "ConfigurationParserI.h"
+#include "JsonStructuralIndex.h"
+#include "Token.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -40,7 +42,10 @@
 
 namespace MARTe {
 
-
+/**
+ * The maximum number of nested blocks parsed from a memory buffer.
+ */
+static const uint32 JSON_PARSER_MAX_DEPTH = 256u;
 
 /**
  * @brief Concrete class for MARTe::ParserI abstract class, configured
@@ -89,6 +94,16 @@ namespace MARTe {
  *
  * Note: This grammar is written in the SLK language and refers to functions
  * declared in MARTe::ParserI.
+ *
+ * When the parser is constructed on a memory buffer the tokens are not produced by the
+ * LexicalAnalyzer: the structural characters, the strings and the other tokens are first
+ * located with a JsonStructuralIndex (which classifies the characters 64 at a time, with NEON
+ * when available) and the rules of the grammar above are then applied visiting only the
+ * entries of the index, calling the same functions of MARTe::ConfigurationParserI, so that
+ * the same StructuredDataI is built (and the same errors reported). A stream can be parsed
+ * in this way by reading (or memory mapping) it in a buffer first; the parser constructed on
+ * a stream reads it in blocks with the LexicalAnalyzer, with a memory use which does not
+ * depend on its size (e.g. to forward it to a ConfigurationEventsDispatcher).
  */
 class DLL_API JsonParser: public ConfigurationParserI {
 
@@ -104,11 +119,32 @@ public:
                StructuredDataI &databaseIn,
                BufferedStreamI * const err = static_cast<BufferedStreamI*>(NULL));
 
+    /**
+     * @brief Constructor which parses a memory buffer (e.g. a memory mapped
+     * file) instead of a stream, using a JsonStructuralIndex (see class description).
+     * @param[in] input is the buffer to be parsed. It must remain valid and
+     * unchanged until Parse() returns.
+     * @param[in] inputSize is the number of characters in \a input.
+     * @param[out] databaseIn is the built StructuredData in output.
+     * @param[out] err is the stream where error messages are printed to.
+     */
+    JsonParser(const char8 * const input,
+               const uint32 inputSize,
+               StructuredDataI &databaseIn,
+               BufferedStreamI * const err = static_cast<BufferedStreamI*>(NULL));
+
     /**
      * @brief Destructor.
      */
     virtual ~JsonParser();
 
+    /**
+     * @see ParserI::Parse
+     * @details If the parser was constructed on a memory buffer the buffer is parsed
+     * using a JsonStructuralIndex (see class description).
+     */
+    virtual bool Parse();
+
 protected:
 
     /**
@@ -158,11 +194,110 @@ protected:
 
 private:
 
+    /**
+     * @brief Fills the array of functions needed by the parser.
+     */
+    void InitialiseActions();
+
+    /**
+     * @brief Parses the memory buffer using the JsonStructuralIndex.
+     */
+    bool ParseIndexed();
+
+    /**
+     * @brief Reads the token of the next entry of the index in the indexedToken.
+     */
+    void NextToken();
+
+    /**
+     * @brief Copies the characters of a token in the tokenBuffer, replacing the escape sequences as the LexicalAnalyzer.
+     * @return the tokenBuffer.
+     */
+    const char8 *DecodeToken(const uint32 begin,
+                             const uint32 end);
+
+    /**
+     * @brief Parses an expression (see EXPRESSION in the class description) starting from the current token.
+     */
+    void ParseExpression(const uint32 depth);
+
+    /**
+     * @brief Parses the expressions of a block, after its opening brace, up to the closing brace.
+     * @param[in] isNode true if the block is a node (i.e. BlockEnd is called).
+     */
+    void ParseBlock(const uint32 depth,
+                    const bool isNode);
+
+    /**
+     * @brief Parses a VARIABLE, starting from the current token, and adds the leaf.
+     */
+    void ParseVariable();
+
+    /**
+     * @brief Parses the scalars of a vector, after its opening bracket, up to the closing bracket.
+     */
+    void ParseVector();
+
+    /**
+     * @brief Checks if the current token is a scalar (STRING or NUMBER).
+     */
+    bool IsScalar() const;
+
+    /**
+     * @brief Reports a syntax error on the current token.
+     */
+    void SyntaxError();
+
     /**
      * The array of functions needed by the parser.
      */
     void (JsonParser::*Action[10])(void);
 
+    /**
+     * The memory buffer to be parsed (NULL if the parser was constructed on a stream).
+     */
+    const char8 *indexedInput;
+
+    /**
+     * The number of characters of indexedInput.
+     */
+    uint32 indexedInputSize;
+
+    /**
+     * The structural index of indexedInput.
+     */
+    JsonStructuralIndex structuralIndex;
+
+    /**
+     * The next entry of the structuralIndex.
+     */
+    uint32 indexedEntry;
+
+    /**
+     * The current token read from the structuralIndex.
+     */
+    Token indexedToken;
+
+    /**
+     * The terminal of the current token ('\0' if it is not a terminal).
+     */
+    char8 indexedTerminal;
+
+    /**
+     * The name of the expression being parsed.
+     */
+    Token nameToken;
+
+    /**
+     * The decoded characters of the current token.
+     */
+    char8 *tokenBuffer;
+
+    /**
+     * The size of the tokenBuffer.
+     */
+    uint32 tokenBufferSize;
+
 };
 
 }
@@ -0,0 +1,322 @@
+/**
+ * @file JsonStructuralIndex.cpp
+ * @brief Source file for class JsonStructuralIndex
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class JsonStructuralIndex (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "HeapManager.h"
+#include "JsonStructuralIndex.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief The classes of the characters of a block, one bit per character.
+ */
+struct JsonBlockMasks {
+    uint64 quotes;
+    uint64 backslashes;
+    uint64 structurals;
+    uint64 separators;
+    uint64 newLines;
+};
+
+/**
+ * The bits of the even characters of a block.
+ */
+static const uint64 JSON_EVEN_BITS = 0x5555555555555555ULL;
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+/**
+ * The bit of each lane in its byte of the mask (see JsonLaneBits).
+ */
+static const uint8 JSON_LANE_BITS[16] = { 0x01u, 0x02u, 0x04u, 0x08u, 0x10u, 0x20u, 0x40u, 0x80u, 0x01u, 0x02u, 0x04u, 0x08u, 0x10u, 0x20u, 0x40u,
+        0x80u };
+
+/**
+ * @brief Gets a 64 bit mask with one bit for each lane (0xFF) of the four vectors in input.
+ */
+static inline uint64 JsonLaneBits(const uint8x16_t lanes0,
+                                  const uint8x16_t lanes1,
+                                  const uint8x16_t lanes2,
+                                  const uint8x16_t lanes3) {
+    const uint8x16_t bits = vld1q_u8(&JSON_LANE_BITS[0]);
+    uint8x16_t sum0 = vpaddq_u8(vandq_u8(lanes0, bits), vandq_u8(lanes1, bits));
+    uint8x16_t sum1 = vpaddq_u8(vandq_u8(lanes2, bits), vandq_u8(lanes3, bits));
+    sum0 = vpaddq_u8(sum0, sum1);
+    sum0 = vpaddq_u8(sum0, sum0);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+}
+
+/**
+ * @brief Classifies 16 characters.
+ */
+static inline void JsonClassify16(const uint8x16_t chars,
+                                  uint8x16_t &quotes,
+                                  uint8x16_t &backslashes,
+                                  uint8x16_t &structurals,
+                                  uint8x16_t &separators,
+                                  uint8x16_t &newLines) {
+    quotes = vceqq_u8(chars, vdupq_n_u8(static_cast<uint8>('"')));
+    backslashes = vceqq_u8(chars, vdupq_n_u8(static_cast<uint8>('\\')));
+    //{ and } as well as [ and ] only differ by the bit 0x20
+    uint8x16_t folded = vorrq_u8(chars, vdupq_n_u8(0x20u));
+    structurals = vorrq_u8(vorrq_u8(vceqq_u8(folded, vdupq_n_u8(static_cast<uint8>('{'))), vceqq_u8(folded, vdupq_n_u8(static_cast<uint8>('}')))),
+                           vceqq_u8(chars, vdupq_n_u8(static_cast<uint8>(':'))));
+    newLines = vceqq_u8(chars, vdupq_n_u8(static_cast<uint8>('\n')));
+    separators = vorrq_u8(vorrq_u8(newLines, vceqq_u8(chars, vdupq_n_u8(static_cast<uint8>(' ')))),
+                          vorrq_u8(vorrq_u8(vceqq_u8(chars, vdupq_n_u8(static_cast<uint8>('\t'))), vceqq_u8(chars, vdupq_n_u8(static_cast<uint8>('\r')))),
+                                   vceqq_u8(chars, vdupq_n_u8(static_cast<uint8>(',')))));
+}
+
+/**
+ * @brief Classifies the characters of a block with NEON.
+ */
+static inline void JsonClassifyBlock(const char8 * const block,
+                                     JsonBlockMasks &masks) {
+    const uint8 * const bytes = reinterpret_cast<const uint8 *>(block);
+    uint8x16_t q[4];
+    uint8x16_t b[4];
+    uint8x16_t s[4];
+    uint8x16_t w[4];
+    uint8x16_t n[4];
+    for (uint32 i = 0u; i < 4u; i++) {
+        JsonClassify16(vld1q_u8(&bytes[i * 16u]), q[i], b[i], s[i], w[i], n[i]);
+    }
+    masks.quotes = JsonLaneBits(q[0], q[1], q[2], q[3]);
+    masks.backslashes = JsonLaneBits(b[0], b[1], b[2], b[3]);
+    masks.structurals = JsonLaneBits(s[0], s[1], s[2], s[3]);
+    masks.separators = JsonLaneBits(w[0], w[1], w[2], w[3]);
+    masks.newLines = JsonLaneBits(n[0], n[1], n[2], n[3]);
+}
+#else
+/**
+ * @brief Classifies the characters of a block.
+ */
+static inline void JsonClassifyBlock(const char8 * const block,
+                                     JsonBlockMasks &masks) {
+    masks.quotes = 0ULL;
+    masks.backslashes = 0ULL;
+    masks.structurals = 0ULL;
+    masks.separators = 0ULL;
+    masks.newLines = 0ULL;
+    for (uint32 i = 0u; i < JSON_STRUCTURAL_INDEX_BLOCK_SIZE; i++) {
+        uint64 bit = (1ULL << i);
+        switch (block[i]) {
+        case ('"'): {
+            masks.quotes |= bit;
+        }
+            break;
+        case ('\\'): {
+            masks.backslashes |= bit;
+        }
+            break;
+        case ('{'):
+        case ('}'):
+        case ('['):
+        case (']'):
+        case (':'): {
+            masks.structurals |= bit;
+        }
+            break;
+        case ('\n'): {
+            masks.newLines |= bit;
+            masks.separators |= bit;
+        }
+            break;
+        case (' '):
+        case ('\t'):
+        case ('\r'):
+        case (','): {
+            masks.separators |= bit;
+        }
+            break;
+        default: {
+        }
+            break;
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Finds the escaped characters of a block, i.e. the characters which follow an odd number of backslashes.
+ * @param[in] backslashes the backslashes of the block.
+ * @param[in,out] escapedCarry 1 if the first character of the block is escaped. Updated for the next block.
+ * @return the mask of the escaped characters.
+ */
+static inline uint64 JsonFindEscaped(uint64 backslashes,
+                                     uint64 &escapedCarry) {
+    //an escaped backslash does not escape the next character
+    backslashes &= ~escapedCarry;
+    uint64 followsEscape = (backslashes << 1u) | escapedCarry;
+    //the sequences of backslashes starting on odd bits, added to the backslashes, leave the carry on the bit after the sequence
+    uint64 oddSequenceStarts = (backslashes & (~JSON_EVEN_BITS)) & (~followsEscape);
+    uint64 sequencesStartingOnEvenBits = oddSequenceStarts + backslashes;
+    escapedCarry = 0ULL;
+    if (sequencesStartingOnEvenBits < backslashes) {
+        escapedCarry = 1ULL;
+    }
+    uint64 invertMask = (sequencesStartingOnEvenBits << 1u);
+    return (JSON_EVEN_BITS ^ invertMask) & followsEscape;
+}
+
+/**
+ * @brief Gets the mask of the characters which are after an odd number of set bits (i.e. the prefix xor of the bits).
+ */
+static inline uint64 JsonPrefixXor(uint64 bits) {
+    bits ^= (bits << 1u);
+    bits ^= (bits << 2u);
+    bits ^= (bits << 4u);
+    bits ^= (bits << 8u);
+    bits ^= (bits << 16u);
+    bits ^= (bits << 32u);
+    return bits;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+JsonStructuralIndex::JsonStructuralIndex() {
+    positions = NULL_PTR(uint32 *);
+    lineNumbers = NULL_PTR(uint32 *);
+    size = 0u;
+    capacity = 0u;
+    lineNumber = 1u;
+}
+
+JsonStructuralIndex::~JsonStructuralIndex() {
+    if (positions != NULL_PTR(uint32 *)) {
+        void *mem = reinterpret_cast<void *>(positions);
+        (void) HeapManager::Free(mem);
+    }
+    if (lineNumbers != NULL_PTR(uint32 *)) {
+        void *mem = reinterpret_cast<void *>(lineNumbers);
+        (void) HeapManager::Free(mem);
+    }
+    positions = NULL_PTR(uint32 *);
+    lineNumbers = NULL_PTR(uint32 *);
+}
+
+bool JsonStructuralIndex::Build(const char8 * const input,
+                                const uint32 inputSize) {
+    size = 0u;
+    lineNumber = 1u;
+    bool ret = (input != NULL_PTR(const char8 *));
+    //carries from one block to the next
+    uint64 escapedCarry = 0ULL;
+    uint64 insideString = 0ULL;
+    uint64 tokenCarry = 0ULL;
+    uint32 base = 0u;
+    while ((ret) && (base < inputSize)) {
+        JsonBlockMasks masks;
+        uint32 remaining = (inputSize - base);
+        if (remaining >= JSON_STRUCTURAL_INDEX_BLOCK_SIZE) {
+            JsonClassifyBlock(&input[base], masks);
+        }
+        else {
+            //the last block is padded with separators
+            char8 last[JSON_STRUCTURAL_INDEX_BLOCK_SIZE];
+            (void) MemoryOperationsHelper::Set(&last[0], ' ', JSON_STRUCTURAL_INDEX_BLOCK_SIZE);
+            (void) MemoryOperationsHelper::Copy(&last[0], &input[base], remaining);
+            JsonClassifyBlock(&last[0], masks);
+        }
+        uint64 escaped = JsonFindEscaped(masks.backslashes, escapedCarry);
+        uint64 quotes = (masks.quotes & (~escaped));
+        //the opening quotes and the characters of the strings, without the closing quotes
+        uint64 strings = (JsonPrefixXor(quotes) ^ insideString);
+        insideString = (0ULL - (strings >> 63u));
+        //the characters of the other tokens and the first of each of them
+        uint64 tokens = ~(((masks.structurals | masks.separators) | quotes) | strings);
+        uint64 tokenStarts = (tokens & (~((tokens << 1u) | tokenCarry)));
+        tokenCarry = (tokens >> 63u);
+        uint64 entries = (((masks.structurals & (~strings)) | quotes) | tokenStarts);
+        ret = AddBlock(base, entries, masks.newLines);
+        base += JSON_STRUCTURAL_INDEX_BLOCK_SIZE;
+    }
+    if (ret) {
+        ret = (insideString == 0ULL);
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::SyntaxError, "Unterminated string");
+        }
+    }
+    return ret;
+}
+
+bool JsonStructuralIndex::AddBlock(const uint32 base,
+                                   uint64 entries,
+                                   const uint64 newLines) {
+    bool ret = true;
+    if ((size + JSON_STRUCTURAL_INDEX_BLOCK_SIZE) > capacity) {
+        uint32 newCapacity = (capacity * 2u) + (JSON_STRUCTURAL_INDEX_BLOCK_SIZE * 16u);
+        uint32 newSize = static_cast<uint32>(newCapacity * sizeof(uint32));
+        void *mem = reinterpret_cast<void *>(positions);
+        void *newPositions = HeapManager::Realloc(mem, newSize);
+        ret = (newPositions != NULL_PTR(void *));
+        if (ret) {
+            positions = static_cast<uint32 *>(newPositions);
+            mem = reinterpret_cast<void *>(lineNumbers);
+            void *newLineNumbers = HeapManager::Realloc(mem, newSize);
+            ret = (newLineNumbers != NULL_PTR(void *));
+            if (ret) {
+                lineNumbers = static_cast<uint32 *>(newLineNumbers);
+                capacity = newCapacity;
+            }
+        }
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed allocating the index");
+        }
+    }
+    if (ret) {
+        while (entries != 0ULL) {
+            uint32 bit = static_cast<uint32>(__builtin_ctzll(entries));
+            positions[size] = (base + bit);
+            lineNumbers[size] = lineNumber + static_cast<uint32>(__builtin_popcountll(newLines & ((1ULL << bit) - 1ULL)));
+            size++;
+            entries &= (entries - 1ULL);
+        }
+        lineNumber += static_cast<uint32>(__builtin_popcountll(newLines));
+    }
+    return ret;
+}
+
+}
@@ -0,0 +1,166 @@
+/**
+ * @file JsonStructuralIndex.h
+ * @brief Header file for class JsonStructuralIndex
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class JsonStructuralIndex
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef JSONSTRUCTURALINDEX_H_
+#define JSONSTRUCTURALINDEX_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The number of characters classified at once by JsonStructuralIndex::Build.
+ */
+static const uint32 JSON_STRUCTURAL_INDEX_BLOCK_SIZE = 64u;
+
+/**
+ * @brief Index of the structural characters of a JSON text (the first stage of a JsonParser on a memory buffer).
+ * @details Build classifies the characters of the text JSON_STRUCTURAL_INDEX_BLOCK_SIZE at a time (with four 16 byte NEON
+ * comparisons per character class when available, __ARM_NEON) into bit masks of quotes, backslashes, structural characters
+ * ({, }, [, ] and :) and separators (white spaces and commas, see JsonGrammar). The escaped characters and the characters inside
+ * strings are then found with a few integer operations on the masks of the block, without any branch on the characters.
+ *
+ * The index holds, in order, the position (and the line number) of:
+ *  - the structural characters outside strings;
+ *  - the quotes which open and close the strings;
+ *  - the first character of the other tokens (numbers and unquoted words).
+ *
+ * so that the second stage (see JsonParser) only visits the tokens and never the separators.
+ */
+class DLL_API JsonStructuralIndex {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetSize() == 0
+     */
+    JsonStructuralIndex();
+
+    /**
+     * @brief Destructor. Frees the index.
+     */
+    ~JsonStructuralIndex();
+
+    /**
+     * @brief Builds the index of \a input.
+     * @param[in] input the JSON text.
+     * @param[in] inputSize the number of characters of \a input.
+     * @return true if the index is built and the last string of \a input is terminated.
+     */
+    bool Build(const char8 * const input,
+               const uint32 inputSize);
+
+    /**
+     * @brief Gets the number of entries of the index.
+     * @return the number of entries of the index.
+     */
+    inline uint32 GetSize() const;
+
+    /**
+     * @brief Gets the position of an entry.
+     * @param[in] entry the entry (< GetSize()).
+     * @return the position in the input of the character of the entry.
+     */
+    inline uint32 GetPosition(const uint32 entry) const;
+
+    /**
+     * @brief Gets the line number of an entry.
+     * @param[in] entry the entry (< GetSize()).
+     * @return the line number (starting from 1) of the character of the entry.
+     */
+    inline uint32 GetLineNumber(const uint32 entry) const;
+
+private:
+
+    /**
+     * @brief Adds the entries of a block.
+     * @param[in] base the position of the first character of the block.
+     * @param[in] entries the mask of the characters to be added.
+     * @param[in] newLines the mask of the new lines of the block.
+     */
+    bool AddBlock(const uint32 base,
+                  uint64 entries,
+                  const uint64 newLines);
+
+    /**
+     * The positions of the entries.
+     */
+    uint32 *positions;
+
+    /**
+     * The line numbers of the entries.
+     */
+    uint32 *lineNumbers;
+
+    /**
+     * The number of entries.
+     */
+    uint32 size;
+
+    /**
+     * The number of entries allocated.
+     */
+    uint32 capacity;
+
+    /**
+     * The line number of the first character of the next block.
+     */
+    uint32 lineNumber;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+uint32 JsonStructuralIndex::GetSize() const {
+    return size;
+}
+
+uint32 JsonStructuralIndex::GetPosition(const uint32 entry) const {
+    return positions[entry];
+}
+
+uint32 JsonStructuralIndex::GetLineNumber(const uint32 entry) const {
+    return lineNumbers[entry];
+}
+
+}
+
+#endif /* JSONSTRUCTURALINDEX_H_ */
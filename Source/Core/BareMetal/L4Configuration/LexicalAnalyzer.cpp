@@ -32,6 +32,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
+#include "HeapManager.h"
 #include "LexicalAnalyzer.h"
 #include "StreamString.h"
 #include "TypeConversion.h"
@@ -43,50 +44,224 @@
 namespace MARTe {
 
 /**
- * @brief Gets the next character from the stream.
- * @param[in] stream is the stream of characters to be read.
- * @param[out] c is the read character.
- * @return false if EOF, true otherwise.
+ * @brief Builds the escape character in case when '\' is read.
+ * @param[out] c is the character in output.
+ * @return true if the character in input matches a known escape sequence, false otherwise.
  */
-static bool GetC(StreamI &stream,
-                 char8 &c) {
-    uint32 charSize = 1u;
-    bool ret = stream.Read(&c, charSize);
-    return (ret) && (charSize == 1u);
+static bool EscapeChar(char8 &c) {
+    bool ret = true;
+    switch (c) {
+    case ('n'): {
+        c = '\n';
+    }
+        break;
+    case ('t'): {
+        c = '\t';
+    }
+        break;
+    case ('r'): {
+        c = '\r';
+    }
+        break;
+    case ('"'): {
+        c = '"';
+    }
+        break;
+    case ('\\'): {
+        c = '\\';
+    }
+        break;
+    default: {
+        ret = false;
+    }
+    }
+    return ret;
 }
 
-/**
- * @brief Reads the comment on single lines.
- * @param[in] stream is the stream of characters to be read.
- */
-static void ReadCommentOneLine(StreamI &stream) {
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+Token * LexicalAnalyzer::GetToken() {
+    // keep the previous token for reuse
+    if (token != NULL) {
+        if (!tokenPool.Add(token)) {
+            delete token;
+        }
+        token = static_cast<Token *>(NULL);
+    }
+    TokenizeInput();
+    if (!tokenQueue.Extract(0u, token)) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Extract() of the token from the token stack");
+    }
+    return token;
+}
+
+/*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
+Token *LexicalAnalyzer::PeekToken(const uint32 position) {
+
+    TokenizeInput(position);
+    Token *peekToken = static_cast<Token*>(NULL);
+    if (!tokenQueue.Peek(position, peekToken)) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Peek() of the token from the token stack");
+    }
+    return peekToken;
+
+}
+
+LexicalAnalyzer::LexicalAnalyzer(StreamI &stream,
+                                 const char8 * const terminalsIn,
+                                 const char8 * const separatorsIn,
+                                 const char8 * const oneLineCommentBeginIn,
+                                 const char8 * const multipleLineCommentBeginIn,
+                                 const char8 * const multipleLineCommentEndIn) {
+    inputStream = &stream;
+    inputWindow = static_cast<char8 *>(HeapManager::Malloc(LEXICAL_ANALYZER_WINDOW_SIZE));
+    inputBuffer = inputWindow;
+    inputSize = 0u;
+    inputIndex = 0u;
+    Initialise(terminalsIn, separatorsIn, oneLineCommentBeginIn, multipleLineCommentBeginIn, multipleLineCommentEndIn, "");
+}
+
+LexicalAnalyzer::LexicalAnalyzer(StreamI &stream,
+                                 const char8 * const terminalsIn,
+                                 const char8 * const separatorsIn,
+                                 const char8 * const oneLineCommentBeginIn,
+                                 const char8 * const multipleLineCommentBeginIn,
+                                 const char8 * const multipleLineCommentEndIn,
+                                 const char8 * const keywordsIn) {
+    inputStream = &stream;
+    inputWindow = static_cast<char8 *>(HeapManager::Malloc(LEXICAL_ANALYZER_WINDOW_SIZE));
+    inputBuffer = inputWindow;
+    inputSize = 0u;
+    inputIndex = 0u;
+    Initialise(terminalsIn, separatorsIn, oneLineCommentBeginIn, multipleLineCommentBeginIn, multipleLineCommentEndIn, keywordsIn);
+}
+
+LexicalAnalyzer::LexicalAnalyzer(const char8 * const input,
+                                 const uint32 inputSizeIn,
+                                 const char8 * const terminalsIn,
+                                 const char8 * const separatorsIn,
+                                 const char8 * const oneLineCommentBeginIn,
+                                 const char8 * const multipleLineCommentBeginIn,
+                                 const char8 * const multipleLineCommentEndIn,
+                                 const char8 * const keywordsIn) {
+    inputStream = static_cast<StreamI *>(NULL);
+    inputWindow = static_cast<char8 *>(NULL);
+    inputBuffer = input;
+    inputSize = (input != NULL) ? (inputSizeIn) : (0u);
+    inputIndex = 0u;
+    Initialise(terminalsIn, separatorsIn, oneLineCommentBeginIn, multipleLineCommentBeginIn, multipleLineCommentEndIn, keywordsIn);
+}
+
+/*lint -e{1551} Justification: Memory has to be freed in the destructor.
+ * No exceptions should be thrown given that the memory is managed exclusively managed by this class.". */
+LexicalAnalyzer::~LexicalAnalyzer() {
+    uint32 queueSize=tokenQueue.GetSize();
+    for (uint32 i = 0u; i < queueSize; i++) {
+        Token *toDelete;
+        if (tokenQueue.Extract((queueSize - i) - 1u, toDelete)) {
+            delete toDelete;
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Extract() of the token from the token stack");
+        }
+    }
+    uint32 poolSize = tokenPool.GetSize();
+    for (uint32 i = 0u; i < poolSize; i++) {
+        Token *toDelete;
+        if (tokenPool.Extract((poolSize - i) - 1u, toDelete)) {
+            delete toDelete;
+        }
+    }
+    if (token != NULL) {
+        delete token;
+    }
+    if (inputStream != NULL) {
+        // give back to the stream the characters read but not analysed
+        uint32 unread = inputSize - inputIndex;
+        if (unread > 0u) {
+            uint64 pos = inputStream->Position();
+            if (pos >= unread) {
+                if (!inputStream->Seek(pos - unread)) {
+                    REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed Seek() while restoring the position of the input stream.");
+                }
+            }
+        }
+    }
+    if (inputWindow != NULL) {
+        void *mem = static_cast<void *>(inputWindow);
+        HeapManager::Free(mem);
+    }
+    inputWindow = static_cast<char8 *>(NULL);
+    inputBuffer = static_cast<const char8 *>(NULL);
+    inputStream = static_cast<StreamI*>(NULL);
+}
+
+void LexicalAnalyzer::Initialise(const char8 * const terminalsIn,
+                                 const char8 * const separatorsIn,
+                                 const char8 * const oneLineCommentBeginIn,
+                                 const char8 * const multipleLineCommentBeginIn,
+                                 const char8 * const multipleLineCommentEndIn,
+                                 const char8 * const keywordsIn) {
+    token = static_cast<Token *>(NULL);
+    lineNumber = 1u;
+    terminals = terminalsIn;
+    separators = separatorsIn;
+    oneLineCommentBegin = oneLineCommentBeginIn;
+    multipleLineCommentBegin = multipleLineCommentBeginIn;
+    multipleLineCommentEnd = multipleLineCommentEndIn;
+    keywords = keywordsIn;
+    tokenInfo[0].Set(EOF_TOKEN, "EOF");
+    tokenInfo[1].Set(STRING_TOKEN, "STRING");
+    tokenInfo[2].Set(NUMBER_TOKEN, "NUMBER");
+    tokenInfo[3].Set(ERROR_TOKEN, "ERROR");
+    tokenInfo[4].Set(TERMINAL_TOKEN, "TERMINAL");
+}
+
+bool LexicalAnalyzer::FillInput() {
+    bool ret = ((inputStream != NULL) && (inputWindow != NULL));
+    if (ret) {
+        uint32 readSize = LEXICAL_ANALYZER_WINDOW_SIZE;
+        ret = inputStream->Read(inputWindow, readSize);
+        if (ret) {
+            ret = (readSize > 0u);
+        }
+        inputSize = (ret) ? (readSize) : (0u);
+        inputIndex = 0u;
+    }
+    return ret;
+}
+
+bool LexicalAnalyzer::PeekC(char8 &c) {
+    bool ret = (inputIndex < inputSize);
+    if (!ret) {
+        ret = FillInput();
+    }
+    c = (ret) ? (inputBuffer[inputIndex]) : ('\0');
+    return ret;
+}
+
+void LexicalAnalyzer::ReadCommentOneLine() {
 
     char8 c = ' ';
     while (c != '\n') {
-        if (!GetC(stream, c)) {
+        if (!GetC(c)) {
             break;
         }
     }
 }
 
-/**
- * @brief Reads the comment on multiple lines.
- * @param[in] stream is the stream of characters to be read.
- * @param[out] lineNumber is the token line number.
- * @param[in] multipleLineEnd C-string containing the pattern
- * that it is used for marking the end of a multiple line comment.
- */
-static void ReadCommentMultipleLines(StreamI &stream,
-                                     uint32 &lineNumber,
-                                     const char8 * const multipleLineEnd) {
+void LexicalAnalyzer::ReadCommentMultipleLines() {
 
     char8 c = ' ';
+    const char8 * const multipleLineEnd = multipleLineCommentEnd.Buffer();
     uint32 size = StringHelper::Length(multipleLineEnd);
     char8 buffer[16];
 
     // read the next characters to match the end of comment
     for (uint32 i = 0u; i < size; i++) {
-        if (!GetC(stream, c)) {
+        if (!GetC(c)) {
             break;
         }
         if (c == '\n') {
@@ -98,7 +273,7 @@ static void ReadCommentMultipleLines(StreamI &stream,
 
     while (StringHelper::Compare(&buffer[0], multipleLineEnd) != 0) {
 
-        if (!GetC(stream, c)) {
+        if (!GetC(c)) {
             break;
         }
         for (uint32 i = 1u; i < size; i++) {
@@ -113,34 +288,14 @@ static void ReadCommentMultipleLines(StreamI &stream,
     }
 }
 
-/**
- * @brief Skips the comments in the stream.
- * @param[in] stream is the stream of characters to be read.
- * @param[out] buffer contains the data read from the stream.
- * @param[out] bufferSize the actual size of the data in buffer
- * @param[out] lineNumber is the token line number.
- * @param[in] separators is the separator characters list.
- * @param[in] oneLineBegin C-string containing the pattern that
- * it is used for marking the beginning of a single line comment.
- * @param[in] multipleLineBegin C-string containing the pattern that
- * it is used for marking the beginning of a multiple line comment.
- * @param[in] multipleLineEnd C-string containing the pattern that
- * it is used for marking the end of a multiple line comment.
- * @param[out] separator returns the separator char found at the end of the comment.
- * @param[in] isNewToken specifies if the separators at the beginning must be skipped or not.
- * @return false if EOF, true otherwise.
- */
-static bool SkipComment(StreamI &stream,
-                        char8 * const buffer,
-                        uint32 &bufferSize,
-                        uint32 &lineNumber,
-                        const char8 * const separators,
-                        const char8 * const oneLineBegin,
-                        const char8 * const multipleLineBegin,
-                        const char8 * const multipleLineEnd,
-                        char8 &separator,
-                        const bool isNewToken) {
+bool LexicalAnalyzer::SkipComment(char8 * const buffer,
+                                  uint32 &bufferSize,
+                                  char8 &separator,
+                                  const bool isNewToken) {
 
+    const char8 * const separatorsList = separators.Buffer();
+    const char8 * const oneLineBegin = oneLineCommentBegin.Buffer();
+    const char8 * const multipleLineBegin = multipleLineCommentBegin.Buffer();
     char8 c = '\0';
     bufferSize = 0u;
     buffer[0] = '\0';
@@ -152,9 +307,9 @@ static bool SkipComment(StreamI &stream,
 
     // skip separators before
     while (skip) {
-        if (GetC(stream, c)) {
+        if (GetC(c)) {
             //stop loop, not a separator
-            if (StringHelper::SearchChar(separators, c) == NULL) {
+            if (StringHelper::SearchChar(separatorsList, c) == NULL) {
                 skip = false;
             }
             else {
@@ -190,7 +345,7 @@ static bool SkipComment(StreamI &stream,
                 isComment = (c == oneLineBegin[i]);
                 buffer[i] = c;
                 if (isComment) {
-                    if (!GetC(stream, c)) {
+                    if (!GetC(c)) {
                         isComment = false;
                         isEOF = true;
                         c = '\0';
@@ -209,7 +364,7 @@ static bool SkipComment(StreamI &stream,
         buffer[i] = '\0';
         if (isComment) {
             // comment on one line
-            ReadCommentOneLine(stream);
+            ReadCommentOneLine();
             buffer[0] = '\0';
             separator = '\n';
         }
@@ -224,7 +379,7 @@ static bool SkipComment(StreamI &stream,
                         c = buffer[i];
                     }
                     else {
-                        if (!GetC(stream, c)) {
+                        if (!GetC(c)) {
                             isComment = false;
                             isEOF = true;
                             c = '\0';
@@ -244,7 +399,7 @@ static bool SkipComment(StreamI &stream,
 
             if (isComment) {
                 // comment on multiple line
-                ReadCommentMultipleLines(stream, lineNumber, multipleLineEnd);
+                ReadCommentMultipleLines();
                 buffer[0] = '\0';
             }
             else {
@@ -263,135 +418,25 @@ static bool SkipComment(StreamI &stream,
     return !isEOF;
 }
 
-/**
- * @brief Builds the escape character in case when '\' is read.
- * @param[out] c is the character in output.
- * @return true if the character in input matches a known escape sequence, false otherwise.
- */
-static bool EscapeChar(char8 &c) {
-    bool ret = true;
-    switch (c) {
-    case ('n'): {
-        c = '\n';
-    }
-        break;
-    case ('t'): {
-        c = '\t';
-    }
-        break;
-    case ('r'): {
-        c = '\r';
-    }
-        break;
-    case ('"'): {
-        c = '"';
-    }
-        break;
-    case ('\\'): {
-        c = '\\';
-    }
-        break;
-    default: {
-        ret = false;
-    }
-    }
-    return ret;
-}
-
-/*---------------------------------------------------------------------------*/
-/*                           Method definitions                              */
-/*---------------------------------------------------------------------------*/
-
 /*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
-Token * LexicalAnalyzer::GetToken() {
-    // delete the previous token
-    if (token != NULL) {
-        delete token;
-    }
-    TokenizeInput();
-    if (!tokenQueue.Extract(0u, token)) {
-        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Extract() of the token from the token stack");
-    }
-    return token;
-}
-
-/*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
-Token *LexicalAnalyzer::PeekToken(const uint32 position) {
-
-    TokenizeInput(position);
-    Token *peekToken = static_cast<Token*>(NULL);
-    if (!tokenQueue.Peek(position, peekToken)) {
-        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Peek() of the token from the token stack");
-    }
-    return peekToken;
-
-}
-
-LexicalAnalyzer::LexicalAnalyzer(StreamI &stream,
-                                 const char8 * const terminalsIn,
-                                 const char8 * const separatorsIn,
-                                 const char8 * const oneLineCommentBeginIn,
-                                 const char8 * const multipleLineCommentBeginIn,
-                                 const char8 * const multipleLineCommentEndIn) {
-    token = static_cast<Token *>(NULL);
-    inputStream = &stream;
-    lineNumber = 1u;
-    terminals = terminalsIn;
-    separators = separatorsIn;
-    oneLineCommentBegin=oneLineCommentBeginIn;
-    multipleLineCommentBegin=multipleLineCommentBeginIn;
-    multipleLineCommentEnd= multipleLineCommentEndIn;
-    keywords = "";
-    tokenInfo[0].Set(EOF_TOKEN, "EOF");
-    tokenInfo[1].Set(STRING_TOKEN, "STRING");
-    tokenInfo[2].Set(NUMBER_TOKEN, "NUMBER");
-    tokenInfo[3].Set(ERROR_TOKEN, "ERROR");
-    tokenInfo[4].Set(TERMINAL_TOKEN, "TERMINAL");
-}
-
-LexicalAnalyzer::LexicalAnalyzer(StreamI &stream,
-                                 const char8 * const terminalsIn,
-                                 const char8 * const separatorsIn,
-                                 const char8 * const oneLineCommentBeginIn,
-                                 const char8 * const multipleLineCommentBeginIn,
-                                 const char8 * const multipleLineCommentEndIn,
-                                 const char8 * const keywordsIn) {
-    token = static_cast<Token *>(NULL);
-    inputStream = &stream;
-    lineNumber = 1u;
-    terminals = terminalsIn;
-    separators = separatorsIn;
-    oneLineCommentBegin=oneLineCommentBeginIn;
-    multipleLineCommentBegin=multipleLineCommentBeginIn;
-    multipleLineCommentEnd= multipleLineCommentEndIn;
-    keywords = keywordsIn;
-    tokenInfo[0].Set(EOF_TOKEN, "EOF");
-    tokenInfo[1].Set(STRING_TOKEN, "STRING");
-    tokenInfo[2].Set(NUMBER_TOKEN, "NUMBER");
-    tokenInfo[3].Set(ERROR_TOKEN, "ERROR");
-    tokenInfo[4].Set(TERMINAL_TOKEN, "TERMINAL");
-}
-
-/*lint -e{1551} Justification: Memory has to be freed in the destructor.
- * No exceptions should be thrown given that the memory is managed exclusively managed by this class.". */
-LexicalAnalyzer::~LexicalAnalyzer() {
-    uint32 queueSize=tokenQueue.GetSize();
-    for (uint32 i = 0u; i < queueSize; i++) {
-        Token *toDelete;
-        if (tokenQueue.Extract((queueSize - i) - 1u, toDelete)) {
-            delete toDelete;
-        }
-        else {
-            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Extract() of the token from the token stack");
+void LexicalAnalyzer::AddTokenToQueue(const uint32 type,
+                                      const char8 * const data) {
+    Token *toAdd = static_cast<Token *>(NULL);
+    uint32 poolSize = tokenPool.GetSize();
+    if (poolSize > 0u) {
+        if (tokenPool.Extract(poolSize - 1u, toAdd)) {
+            toAdd->Set(tokenInfo[type].GetTokenId(), tokenInfo[type].GetDescription(), data, lineNumber);
         }
     }
-    if (token != NULL) {
-        delete token;
+    if (toAdd == NULL) {
+        /*lint -e{423} .Justification: The pointer is added to a stack and the memory is freed by the class destructor */
+        toAdd = new Token(tokenInfo[type].GetTokenId(), tokenInfo[type].GetDescription(), data, lineNumber);
+    }
+    if (!tokenQueue.Add(toAdd)) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Add() of the token to the token stack");
     }
-    inputStream = static_cast<StreamI*>(NULL);
 }
 
-/*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
 void LexicalAnalyzer::AddToken(char8 * const tokenBuffer,
                                const bool isString) {
 
@@ -420,11 +465,7 @@ void LexicalAnalyzer::AddToken(char8 * const tokenBuffer,
                     tokenBuffer[end] = '\0';
                 }
             }
-            /*lint -e{423} .Justification: The pointer is added to a stack and the memory is freed by the class destructor */
-            Token *toAdd = new Token(tokenInfo[STRING_TOKEN], &tokenBuffer[begin], lineNumber);
-            if (!tokenQueue.Add(toAdd)) {
-                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Add() of the token to the token stack");
-            }
+            AddTokenToQueue(STRING_TOKEN, &tokenBuffer[begin]);
             converted = true;
         }
 
@@ -432,57 +473,38 @@ void LexicalAnalyzer::AddToken(char8 * const tokenBuffer,
             // not an integer! Try a float (number)
             float64 possibleFloat = 0.0;
             if (TypeConvert(possibleFloat, tokenBuffer)) {
-                /*lint -e{423} .Justification: The pointer is added to a stack and the memory is freed by the class destructor */
-                Token *toAdd = new Token(tokenInfo[NUMBER_TOKEN], &tokenBuffer[0], lineNumber);
-                if (!tokenQueue.Add(toAdd)) {
-                    REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Add() of the token to the token stack");
-                }
+                AddTokenToQueue(NUMBER_TOKEN, &tokenBuffer[0]);
                 converted = true;
             }
         }
 
         // error!
         if (!converted) {
-            /*lint -e{423} .Justification: The pointer is added to a stack and the memory is freed by the class destructor */
-            Token *toAdd = new Token(tokenInfo[ERROR_TOKEN], "", lineNumber);
-            if (!tokenQueue.Add(toAdd)) {
-                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Add() of the token to the token stack");
-            }
+            AddTokenToQueue(ERROR_TOKEN, "");
         }
     }
 
 }
 
-/*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
 void LexicalAnalyzer::AddTerminal(const char8 terminal) {
 
     char8 terminalBuffer[2] = {terminal, '\0'};
-    /*lint -e{423} .Justification: The pointer is added to a stack and the memory is freed by the class destructor */
-    Token *toAdd = new Token(tokenInfo[TERMINAL_TOKEN], &terminalBuffer[0], lineNumber);
-    if (!tokenQueue.Add(toAdd)) {
-        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Add() of the token to the token stack");
-    }
+    AddTokenToQueue(TERMINAL_TOKEN, &terminalBuffer[0]);
 }
 
-/*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
 void LexicalAnalyzer::AddTerminal(const char8* const terminalBuffer) {
 
-    /*lint -e{423} .Justification: The pointer is added to a stack and the memory is freed by the class destructor */
-    Token *toAdd = new Token(tokenInfo[TERMINAL_TOKEN], terminalBuffer, lineNumber);
-    if (!tokenQueue.Add(toAdd)) {
-        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Add() of the token to the token stack");
-    }
+    AddTokenToQueue(TERMINAL_TOKEN, terminalBuffer);
 }
 
-/*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
 /*lint --e{9007} StringHelper::SearchString() and StringHelper::Compare() have no side effects*/
 void LexicalAnalyzer::TokenizeInput(const uint32 level) {
 
     bool ok = true;
     bool isEOF = false;
 
-    StreamString separatorsUsed = separators.Buffer();
-    StreamString terminalsUsed = terminals.Buffer();
+    const char8 * separatorsUsed = separators.Buffer();
+    const char8 * terminalsUsed = terminals.Buffer();
 
     while (tokenQueue.GetSize() < (level + 1u)) {
         char8 c = '\0';
@@ -493,8 +515,7 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
         uint32 bufferSize = 0u;
         // skips one or consecutive comments and controls EOF
         while ((ok) && (c == '\0')) {
-            ok = SkipComment(*inputStream, &buffer[0], bufferSize, lineNumber, separators.Buffer(), oneLineCommentBegin.Buffer(),
-                             multipleLineCommentBegin.Buffer(), multipleLineCommentEnd.Buffer(), separator, true);
+            ok = SkipComment(&buffer[0], bufferSize, separator, true);
             c = buffer[0];
             // need to do this for one line comments at the end of the tokens
             if (separator == '\n') {
@@ -503,7 +524,7 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
         }
 
         // the token
-        StreamString tokenString = "";
+        tokenString = "";
         uint32 bufferIndex = 1u;
         bufferSize--;
 
@@ -517,13 +538,12 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
         // Lexer starts building the next token and will stop when a single-character terminal is found
         while (ok) {
             
-            //std::cout << tokenString.Buffer() << "\n";
-            if ((StringHelper::SearchChar(separatorsUsed.Buffer(), c) != NULL) && (!escape)) {
+            if ((StringHelper::SearchChar(separatorsUsed, c) != NULL) && (!escape)) {
                 // this means that a string is found! Read everything until another " is found
                 if (isString1) {
                     tokenString += c;
-                    separatorsUsed = separators;
-                    terminalsUsed = terminals;
+                    separatorsUsed = separators.Buffer();
+                    terminalsUsed = terminals.Buffer();
                     ok = false;
                 }
                 else {
@@ -532,7 +552,7 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
                 }
                 separator = c;
             }
-            else if ((StringHelper::SearchChar(terminalsUsed.Buffer(), c) != NULL) && (!escape)) {
+            else if ((StringHelper::SearchChar(terminalsUsed, c) != NULL) && (!escape)) {
                 terminal = c;
                 if(bufferSize>0u) {
                     AddToken(tokenString.BufferReference(), isString1);
@@ -580,11 +600,10 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
                 }
                 else {
                     if (isString1) {
-                        ok = GetC(*inputStream, c);
+                        ok = GetC(c);
                     }
                     else {
-                        ok = SkipComment(*inputStream, &buffer[0], bufferSize, lineNumber, separators.Buffer(), oneLineCommentBegin.Buffer(),
-                        multipleLineCommentBegin.Buffer(), multipleLineCommentEnd.Buffer(), separator, false);
+                        ok = SkipComment(&buffer[0], bufferSize, separator, false);
                         if (ok) {
                             // not a comment with a terminal as the next char!
                             bufferIndex=1u;
@@ -603,7 +622,7 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
         // The lexer stopped because it found a sigle-character terminal
         
         // So now we have a trail of characters (tokenSring) ended by a terminal (trail + terminal)
-        StreamString multiCharToken = tokenString.Buffer();
+        multiCharToken = tokenString.Buffer();
         multiCharToken += terminal;
         
         // If the trail of characters + terminal is a keyword
@@ -630,40 +649,30 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
                     
                     // terminal may be followed by another terminal and their combination may be a keyword, so:
                     char8 nextChar = '\0';
-                    uint32 charSize = 1u;
-                    
-                    uint64  pos = inputStream->Position();
-                    bool readOk = inputStream->Read(&nextChar, charSize);
-                    if (!readOk) {
-                        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed Read() while looking ahead in input stream.");
-                    }
+                    bool nextOk = PeekC(nextChar);
                     
                     multiCharToken = "";
                     multiCharToken += terminal;
-                    if (nextChar != ' ') {              // since space is used as separator in MathGrammar.keywords
+                    if ((nextChar != ' ') && (nextChar != '\0')) {              // since space is used as separator in MathGrammar.keywords
                         multiCharToken += nextChar;
                     }
                     
                     if ( (StringHelper::SearchString(keywords.Buffer(), multiCharToken.Buffer()) != NULL) && (StringHelper::Compare("", multiCharToken.Buffer()) != 0) ) {
                         AddTerminal(multiCharToken.Buffer());
+                        // the next character is part of the keyword
+                        if (nextOk) {
+                            inputIndex++;
+                        }
                     }
-                    // if the terminal is alone, just add it (and reset the stream pointer)
+                    // if the terminal is alone, just add it (the next character is not consumed)
                     else {
                         AddTerminal(terminal);
-                        bool seekOk = inputStream->Seek(pos);
-                        if (!seekOk) {
-                            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed Seek() while restoring pointer to current position.");
-                        }
                     }
                 }
         }
         
         if (isEOF) {
-            /*lint -e{423} .Justification: The pointer is added to a stack and the memory is freed by the class destructor */
-            Token *toAdd = new Token(tokenInfo[EOF_TOKEN], "", lineNumber);
-            if (!tokenQueue.Add(toAdd)) {
-                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Add() of the token to the token stack");
-            }
+            AddTokenToQueue(EOF_TOKEN, "");
         }
 
         // if a newline is the separator add it for the next token
@@ -58,6 +58,12 @@ namespace MARTe {
  * stream of characters one by one, being the lexer responsible of applying
  * the lexical rules of the configuration.
  *
+ * The characters can also be read directly from a contiguous memory buffer
+ * (e.g. a memory mapped file), in which case the input is never copied.
+ * Otherwise the stream is read in blocks of LEXICAL_ANALYZER_WINDOW_SIZE
+ * characters and, when the lexer is destroyed, the stream position is moved
+ * back to the first character that was not analysed yet.
+ *
  * Note: Each read token is an instance of the class Token which can be of
  * one of the following types:
  * - NUMBER_TOKEN: If the token represents a number (also in hexadecimal,
@@ -69,6 +75,11 @@ namespace MARTe {
  * - EOF_TOKEN: If the read operation from the stream fails.
  *
  */
+/**
+ * Number of characters read from the input stream at once.
+ */
+static const uint32 LEXICAL_ANALYZER_WINDOW_SIZE = 4096u;
+
 /*lint -e1712 . Justification: This class must be as per the only defined
  * constructor. No need for a default constructor.*/
 class DLL_API LexicalAnalyzer {
@@ -97,8 +108,25 @@ public:
             const char8 * const oneLineCommentBeginIn,
             const char8 * const multipleLineCommentBeginIn,
             const char8 * const multipleLineCommentEndIn);
-    
-          
+
+    /**
+     * @brief Constructor which initializes the instance with the stream of
+     * characters to analyze and the configuration of the analyzer (terminals,
+     * separators, comment markers and keywords).
+     * @param[in] stream the stream of characters to be tokenized.
+     * @param[in] terminalsIn C-string containing the list of terminal
+     * characters, being each character a terminal.
+     * @param[in] separatorsIn C-string containing the list of separator
+     * characters, being each character a terminal.
+     * @param[in] oneLineCommentBeginIn C-string containing the pattern that
+     * it is used for marking the beginning of a single line comment.
+     * @param[in] multipleLineCommentBeginIn C-string containing the pattern
+     * that it is used for marking the beginning of a multiple line comment.
+     * @param[in] multipleLineCommentEndIn C-string containing the pattern
+     * that it is used for marking the end of a multiple line comment.
+     * @param[in] keywordsIn C-string containing the multiple character
+     * terminals, separated by spaces.
+     */
     LexicalAnalyzer(StreamI &stream,
             const char8 * const terminalsIn,
             const char8 * const separatorsIn,
@@ -106,7 +134,36 @@ public:
             const char8 * const multipleLineCommentBeginIn,
             const char8 * const multipleLineCommentEndIn,
             const char8 * const keywordsIn);
-    
+
+    /**
+     * @brief Constructor which initializes the instance with a memory buffer
+     * of characters to analyze and the configuration of the analyzer.
+     * @details The tokens are extracted directly from the \a input buffer,
+     * which must remain valid and unchanged during the lifetime of the lexer.
+     * @param[in] input the characters to be tokenized.
+     * @param[in] inputSizeIn the number of characters in \a input.
+     * @param[in] terminalsIn C-string containing the list of terminal
+     * characters, being each character a terminal.
+     * @param[in] separatorsIn C-string containing the list of separator
+     * characters, being each character a terminal.
+     * @param[in] oneLineCommentBeginIn C-string containing the pattern that
+     * it is used for marking the beginning of a single line comment.
+     * @param[in] multipleLineCommentBeginIn C-string containing the pattern
+     * that it is used for marking the beginning of a multiple line comment.
+     * @param[in] multipleLineCommentEndIn C-string containing the pattern
+     * that it is used for marking the end of a multiple line comment.
+     * @param[in] keywordsIn C-string containing the multiple character
+     * terminals, separated by spaces.
+     */
+    LexicalAnalyzer(const char8 * const input,
+            const uint32 inputSizeIn,
+            const char8 * const terminalsIn,
+            const char8 * const separatorsIn,
+            const char8 * const oneLineCommentBeginIn,
+            const char8 * const multipleLineCommentBeginIn,
+            const char8 * const multipleLineCommentEndIn,
+            const char8 * const keywordsIn = "");
+
     /**
      * @brief Destructor.
      */
@@ -133,6 +190,65 @@ private:
      * characters on demand, each time GetToken or PeekToken are called.
      */
 
+    /**
+     * @brief Initialises the lexical elements and the token types.
+     * @param[in] terminalsIn the terminal characters.
+     * @param[in] separatorsIn the separator characters.
+     * @param[in] oneLineCommentBeginIn the begin of single line comment pattern.
+     * @param[in] multipleLineCommentBeginIn the begin of multiple line comment pattern.
+     * @param[in] multipleLineCommentEndIn the end of multiple line comment pattern.
+     * @param[in] keywordsIn the keywords to be detected as terminals.
+     */
+    void Initialise(const char8 * const terminalsIn,
+                    const char8 * const separatorsIn,
+                    const char8 * const oneLineCommentBeginIn,
+                    const char8 * const multipleLineCommentBeginIn,
+                    const char8 * const multipleLineCommentEndIn,
+                    const char8 * const keywordsIn);
+
+    /**
+     * @brief Gets the next character from the input.
+     * @param[out] c is the read character.
+     * @return false if EOF, true otherwise.
+     */
+    inline bool GetC(char8 &c);
+
+    /**
+     * @brief Gets the next character from the input without consuming it.
+     * @param[out] c is the next character or '\0' if EOF.
+     * @return false if EOF, true otherwise.
+     */
+    bool PeekC(char8 &c);
+
+    /**
+     * @brief Reads the next block of characters from the input stream.
+     * @return false if there is no input stream or if no characters could be read.
+     */
+    bool FillInput();
+
+    /**
+     * @brief Reads the comment on single lines.
+     */
+    void ReadCommentOneLine();
+
+    /**
+     * @brief Reads the comment on multiple lines, updating the line number.
+     */
+    void ReadCommentMultipleLines();
+
+    /**
+     * @brief Skips the comments in the input.
+     * @param[out] buffer contains the characters read from the input.
+     * @param[out] bufferSize the actual size of the data in buffer
+     * @param[out] separator returns the separator char found at the end of the comment.
+     * @param[in] isNewToken specifies if the separators at the beginning must be skipped or not.
+     * @return false if EOF, true otherwise.
+     */
+    bool SkipComment(char8 * const buffer,
+                     uint32 &bufferSize,
+                     char8 &separator,
+                     const bool isNewToken);
+
     /**
      * @brief Tokenizes the stream in input adding tokens to the internal queue.
      * @param[in] level is the number of tokens to add to the queue - 1.
@@ -157,12 +273,26 @@ private:
      * @param[in] terminalBuffer is the terminal data.
      */
     void AddTerminal(const char8* const terminalBuffer);
-    
+
+    /**
+     * @brief Adds a token to the internal queue, reusing the memory of the
+     * previously returned tokens.
+     * @param[in] type is the index of the token type in tokenInfo.
+     * @param[in] data is the token data.
+     */
+    void AddTokenToQueue(const uint32 type,
+                         const char8 * const data);
+
     /**
      * Internal token queue
      */
     StaticList<Token *> tokenQueue;
 
+    /**
+     * Tokens already returned that can be reused
+     */
+    StaticList<Token *> tokenPool;
+
     /**
      * Separator characters
      */
@@ -204,10 +334,40 @@ private:
     Token *token;
 
     /**
-     * Pointer to the stream to be tokenized
+     * Pointer to the stream to be tokenized (NULL if the input is a memory buffer)
      */
     StreamI *inputStream;
 
+    /**
+     * The characters to be analysed: the memory buffer or the block read from the stream
+     */
+    const char8 *inputBuffer;
+
+    /**
+     * The memory where the stream blocks are read (NULL if the input is a memory buffer)
+     */
+    char8 *inputWindow;
+
+    /**
+     * Number of characters in inputBuffer
+     */
+    uint32 inputSize;
+
+    /**
+     * Index of the next character in inputBuffer
+     */
+    uint32 inputIndex;
+
+    /**
+     * The token being built
+     */
+    StreamString tokenString;
+
+    /**
+     * A token followed by a terminal, to be checked against the keywords
+     */
+    StreamString multiCharToken;
+
     /**
      * Line number counter
      */
@@ -221,5 +381,21 @@ private:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+bool LexicalAnalyzer::GetC(char8 &c) {
+    bool ret = (inputIndex < inputSize);
+    if (!ret) {
+        ret = FillInput();
+    }
+    if (ret) {
+        c = inputBuffer[inputIndex];
+        inputIndex++;
+    }
+    return ret;
+}
+
+}
+
 #endif /* LEXICALANALYZER_H_ */
 
@@ -31,6 +31,8 @@
 
 #include "AdvancedErrorManagement.h"
 #include "MathExpressionParser.h"
+#include "MemoryOperationsHelper.h"
+#include "TypeConversion.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -122,6 +124,277 @@ static const char8 *GetTerminalName(const uint32 symbol) {
     return Terminal_name[symbol];
 }
 
+/**
+ * @brief A node of the expression tree of a statement (see MathExpressionParser::PopAssignment).
+ */
+struct MathExpressionNode {
+    /**
+     * The RPN line of the node without its arguments (e.g. `READ x`, `CONST float64 2` or `MUL`).
+     */
+    StreamString operation;
+
+    /**
+     * The nodes computing the arguments, in the order in which they are pushed.
+     */
+    uint32 arguments[2];
+
+    /**
+     * The number of arguments.
+     */
+    uint32 numberOfArguments;
+
+    /**
+     * The number of times the node is an argument of the nodes of the tree.
+     */
+    uint32 numberOfUses;
+
+    /**
+     * true if the node is reachable from the root of the tree.
+     */
+    bool used;
+
+    /**
+     * true if the value of the node was already emitted into a temporary.
+     */
+    bool emitted;
+
+    /**
+     * The number of the temporary holding the value of the node.
+     */
+    uint32 temporary;
+
+    /**
+     * true if the node is a `CONST float64`.
+     */
+    bool isConstant;
+
+    /**
+     * The value of the `CONST float64`.
+     */
+    float64 value;
+};
+
+/**
+ * The maximum number of arguments of an operation.
+ */
+static const uint32 maxNumberOfArguments = 2u;
+
+/**
+ * The operations with two arguments.
+ */
+static const char8 * const binaryOperations[] = { "AND", "OR", "XOR", "EQ", "NEQ", "GT", "LT", "GTE", "LTE", "ADD", "SUB", "MUL", "DIV", "POW",
+        static_cast<const char8 *>(NULL) };
+
+/**
+ * The operations with one argument (besides CAST).
+ */
+static const char8 * const unaryOperations[] = { "NOT", "NEG", "SIN", "COS", "TAN", "EXP", "LOG", "LOG10", static_cast<const char8 *>(NULL) };
+
+/**
+ * @brief Checks if \a command is in the NULL terminated \a list.
+ */
+static bool IsInList(const StreamString &command,
+                     const char8 * const * const list) {
+    bool found = false;
+    for (uint32 i = 0u; (list[i] != NULL) && (!found); i++) {
+        found = (command == list[i]);
+    }
+    return found;
+}
+
+/**
+ * @brief Gets the number of arguments of an operation of the stack machine expression.
+ * @return the number of arguments or a number greater than maxNumberOfArguments if the operation is not known.
+ */
+static uint32 GetNumberOfArguments(const StreamString &command) {
+    uint32 numberOfArguments = maxNumberOfArguments + 1u;
+    if ((command == "READ") || (command == "CONST")) {
+        numberOfArguments = 0u;
+    }
+    else if ((command == "CAST") || (IsInList(command, &unaryOperations[0]))) {
+        numberOfArguments = 1u;
+    }
+    else if (IsInList(command, &binaryOperations[0])) {
+        numberOfArguments = 2u;
+    }
+    else {
+        // the functions not known are not optimised
+    }
+    return numberOfArguments;
+}
+
+/**
+ * @brief Writes a float64 constant so that it is read back with the same value.
+ * @return false if the value cannot be written exactly.
+ */
+static bool FloatConstantToString(const float64 value,
+                                  StreamString &operation) {
+    const char8 * const formats[] = { "%.15E", "%.16E", "%.17E" };
+    bool ok = false;
+    for (uint32 i = 0u; (i < 3u) && (!ok); i++) {
+        StreamString number;
+        float64 readValue = 0.0;
+        ok = number.Printf(formats[i], value);
+        if (ok) {
+            ok = TypeConvert(readValue, number.Buffer());
+        }
+        if (ok) {
+            /*lint -e{777} the value must be exactly the same*/
+            ok = (readValue == value);
+        }
+        if (ok) {
+            operation = "CONST float64 ";
+            operation += number.Buffer();
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Checks if the node is the float64 constant \a value (not a negative zero).
+ */
+static bool IsConstant(const MathExpressionNode &node,
+                       const float64 value) {
+    bool ret = node.isConstant;
+    if (ret) {
+        /*lint -e{777} the value must be exactly the same*/
+        ret = (node.value == value);
+    }
+    if (ret) {
+        uint64 bits = 0u;
+        ret = MemoryOperationsHelper::Copy(&bits, &node.value, static_cast<uint32>(sizeof(float64)));
+        ret = ((ret) && ((bits >> 63u) == 0u));
+    }
+    return ret;
+}
+
+/**
+ * @brief Folds the operations of constants and simplifies the identities.
+ * @param[in] nodes the nodes of the tree.
+ * @param[in,out] node the node to simplify. On output the folded constant if the operation was folded.
+ * @param[out] simplified the node to use instead of \a node if an identity was simplified.
+ * @return true if the node was replaced by \a simplified.
+ */
+static bool SimplifyNode(const MathExpressionNode * const nodes,
+                         MathExpressionNode &node,
+                         uint32 &simplified) {
+    bool ret = false;
+    const MathExpressionNode *x1 = NULL_PTR(const MathExpressionNode *);
+    const MathExpressionNode *x2 = NULL_PTR(const MathExpressionNode *);
+    if (node.numberOfArguments > 0u) {
+        x1 = &nodes[node.arguments[0u]];
+    }
+    if (node.numberOfArguments > 1u) {
+        x2 = &nodes[node.arguments[1u]];
+    }
+
+    bool constantArguments = (node.numberOfArguments > 0u);
+    for (uint32 i = 0u; i < node.numberOfArguments; i++) {
+        constantArguments = ((constantArguments) && (nodes[node.arguments[i]].isConstant));
+    }
+
+    // the float64 arithmetic is exact and can be computed now
+    bool fold = false;
+    float64 value = 0.0;
+    if (constantArguments) {
+        fold = true;
+        if ((node.operation == "NEG") && (x2 == NULL)) {
+            value = -x1->value;
+        }
+        else if (x2 == NULL) {
+            fold = false;
+        }
+        else if (node.operation == "ADD") {
+            value = x1->value + x2->value;
+        }
+        else if (node.operation == "SUB") {
+            value = x1->value - x2->value;
+        }
+        else if (node.operation == "MUL") {
+            value = x1->value * x2->value;
+        }
+        /*lint -e{777} the division by zero is left to the evaluation*/
+        else if ((node.operation == "DIV") && (x2->value != 0.0)) {
+            value = x1->value / x2->value;
+        }
+        else {
+            fold = false;
+        }
+    }
+    if (fold) {
+        StreamString operation;
+        fold = FloatConstantToString(value, operation);
+        if (fold) {
+            node.operation = operation;
+            node.numberOfArguments = 0u;
+            node.isConstant = true;
+            node.value = value;
+        }
+    }
+
+    // x * 1, 1 * x, x / 1, x - 0 and -(-x) are x
+    if ((!fold) && (x2 != NULL)) {
+        if ((node.operation == "MUL") && (IsConstant(*x2, 1.0))) {
+            simplified = node.arguments[0u];
+            ret = true;
+        }
+        else if ((node.operation == "MUL") && (IsConstant(*x1, 1.0))) {
+            simplified = node.arguments[1u];
+            ret = true;
+        }
+        else if (((node.operation == "DIV") && (IsConstant(*x2, 1.0))) || ((node.operation == "SUB") && (IsConstant(*x2, 0.0)))) {
+            simplified = node.arguments[0u];
+            ret = true;
+        }
+        else {
+            ret = false;
+        }
+    }
+    if ((!fold) && (x1 != NULL) && (x2 == NULL)) {
+        if ((node.operation == "NEG") && (x1->operation == "NEG")) {
+            simplified = x1->arguments[0u];
+            ret = true;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Emits the RPN of the node and of its arguments.
+ * @details The nodes used more than once are computed once into a temporary.
+ */
+static void EmitNode(MathExpressionNode * const nodes,
+                     const uint32 index,
+                     uint32 &numberOfTemporaries,
+                     StreamString &output) {
+    MathExpressionNode &node = nodes[index];
+    StreamString temporaryName;
+    if (node.emitted) {
+        (void) temporaryName.Printf("Temporary@%u", node.temporary);
+        output += "READ ";
+        output += temporaryName.Buffer();
+        output += "\n";
+    }
+    else {
+        for (uint32 i = 0u; i < node.numberOfArguments; i++) {
+            EmitNode(nodes, node.arguments[i], numberOfTemporaries, output);
+        }
+        output += node.operation.Buffer();
+        output += "\n";
+        if ((node.numberOfUses > 1u) && (node.numberOfArguments > 0u)) {
+            node.temporary = numberOfTemporaries;
+            node.emitted = true;
+            numberOfTemporaries++;
+            (void) temporaryName.Printf("Temporary@%u", node.temporary);
+            output += "WRITE ";
+            output += temporaryName.Buffer();
+            output += "\nREAD ";
+            output += temporaryName.Buffer();
+            output += "\n";
+        }
+    }
+}
+
 }
 
 /*---------------------------------------------------------------------------*/
@@ -144,6 +417,8 @@ MathExpressionParser::MathExpressionParser(StreamI &stream,
     Action [ 7 ] = &MathExpressionParser::PopTypecast;
     Action [ 8 ] = &MathExpressionParser::AddOperandTypecast;
     Action [ 9 ] = &MathExpressionParser::AddOperand;
+
+    numberOfTemporaries = 0u;
 }
 
 /*lint -e{1551} Justification: Memory has to be freed in the destructor.
@@ -258,12 +533,12 @@ void MathExpressionParser::PopOperator() {
     
     // Write in the stack machine expression
     if (ok) {
-        stackMachineExpr += OperatorFormatting(currentOperator->BufferReference());
+        statementExpr += OperatorFormatting(currentOperator->BufferReference());
     }
     else {
-        stackMachineExpr += "ERR";
+        statementExpr += "ERR";
     }
-    stackMachineExpr += "\n";
+    statementExpr += "\n";
     
     if (currentOperator != NULL) {
         delete currentOperator;
@@ -287,7 +562,7 @@ void MathExpressionParser::PopOperatorAlternate() {
             // prefix + operator is implied
         }
         else if (StringHelper::Compare(currentOperator->Buffer(), "-") == 0) {
-            stackMachineExpr += "NEG\n";
+            statementExpr += "NEG\n";
         }
         else {
             REPORT_ERROR_STATIC(ErrorManagement::FatalError,
@@ -296,7 +571,7 @@ void MathExpressionParser::PopOperatorAlternate() {
         }
     }
     else {
-        stackMachineExpr += "ERR\n";
+        statementExpr += "ERR\n";
     }
     
     if (currentOperator != NULL) {
@@ -332,13 +607,13 @@ void MathExpressionParser::PopTypecast() {
     
     // Write in the stack machine expression
     if (ok) {
-        stackMachineExpr += "CAST ";
-        stackMachineExpr += currentOperator->Buffer();
+        statementExpr += "CAST ";
+        statementExpr += currentOperator->Buffer();
     }
     else {
-        stackMachineExpr += "ERR";
+        statementExpr += "ERR";
     }
-    stackMachineExpr += "\n";
+    statementExpr += "\n";
     
     if (currentOperator != NULL) {
         delete currentOperator;
@@ -349,17 +624,17 @@ void MathExpressionParser::AddOperand() {
     
     // Write in the stack machine expression
     if (StringHelper::Compare(currentToken->GetDescription(), "STRING") == 0) {
-        stackMachineExpr += "READ ";
-        stackMachineExpr += currentToken->GetData();
+        statementExpr += "READ ";
+        statementExpr += currentToken->GetData();
     }
     else if (StringHelper::Compare(currentToken->GetDescription(), "NUMBER") == 0) {
-        stackMachineExpr += "CONST float64 ";
-        stackMachineExpr += currentToken->GetData();
+        statementExpr += "CONST float64 ";
+        statementExpr += currentToken->GetData();
     }
     else {
-        stackMachineExpr += "ERR";
+        statementExpr += "ERR";
     }
-    stackMachineExpr += "\n";
+    statementExpr += "\n";
 }
 
 void MathExpressionParser::AddOperandTypecast() {
@@ -376,14 +651,14 @@ void MathExpressionParser::AddOperandTypecast() {
     
     // Write in the stack machine expression
     if (ok) {
-        stackMachineExpr += "CONST ";
-        stackMachineExpr += currentOperator->Buffer();
-        stackMachineExpr += " ";
-        stackMachineExpr += currentToken->GetData();
-        stackMachineExpr += "\n";
+        statementExpr += "CONST ";
+        statementExpr += currentOperator->Buffer();
+        statementExpr += " ";
+        statementExpr += currentToken->GetData();
+        statementExpr += "\n";
     }
     else {
-        stackMachineExpr += "ERR\n";
+        statementExpr += "ERR\n";
     }
 
     if (currentOperator != NULL) {
@@ -399,12 +674,126 @@ void MathExpressionParser::StoreAssignment() {
 
 void MathExpressionParser::PopAssignment() {
     
+    StreamString optimisedExpr;
+    if (OptimiseStatement(optimisedExpr)) {
+        stackMachineExpr += optimisedExpr.Buffer();
+    }
+    else {
+        // the statement is written as it was parsed
+        stackMachineExpr += statementExpr.Buffer();
+    }
+    statementExpr = "";
+
     // Write in the stack machine expression
     stackMachineExpr += "WRITE ";
     stackMachineExpr += assignmentVarName.Buffer();
     stackMachineExpr += "\n";
 }
 
+bool MathExpressionParser::OptimiseStatement(StreamString &optimisedExpr) {
+
+    // each line of the statement is at most one node
+    uint32 numberOfLines = 0u;
+    const char8 * const statement = statementExpr.Buffer();
+    for (uint32 i = 0u; i < statementExpr.Size(); i++) {
+        if (statement[i] == '\n') {
+            numberOfLines++;
+        }
+    }
+
+    bool ok = (numberOfLines > 0u);
+    MathExpressionNode *nodes = NULL_PTR(MathExpressionNode *);
+    uint32 *stack = NULL_PTR(uint32 *);
+    if (ok) {
+        nodes = new MathExpressionNode[numberOfLines];
+        stack = new uint32[numberOfLines];
+        ok = statementExpr.Seek(0ull);
+    }
+
+    // build the tree, sharing the equal sub-expressions
+    uint32 numberOfNodes = 0u;
+    uint32 stackSize = 0u;
+    StreamString line;
+    char8 terminator;
+    while ((ok) && (statementExpr.GetToken(line, "\n", terminator, "\n\r"))) {
+        StreamString command;
+        StreamString parameter1;
+        StreamString parameter2;
+        ok = line.Seek(0ull);
+        if (ok) {
+            (void) line.GetToken(command, " \t", terminator, " \t");
+            (void) line.GetToken(parameter1, " \t", terminator, " \t");
+            (void) line.GetToken(parameter2, " \t", terminator, " \t");
+        }
+        uint32 numberOfArguments = GetNumberOfArguments(command);
+        ok = ((ok) && (numberOfArguments <= maxNumberOfArguments) && (numberOfArguments <= stackSize));
+
+        if (ok) {
+            MathExpressionNode &node = nodes[numberOfNodes];
+            node.operation = line;
+            node.numberOfArguments = numberOfArguments;
+            node.numberOfUses = 0u;
+            node.used = false;
+            node.emitted = false;
+            node.temporary = 0u;
+            node.isConstant = ((command == "CONST") && (parameter1 == "float64"));
+            node.value = 0.0;
+            if (node.isConstant) {
+                node.isConstant = TypeConvert(node.value, parameter2.Buffer());
+            }
+            for (uint32 i = 0u; i < numberOfArguments; i++) {
+                node.arguments[i] = stack[(stackSize - numberOfArguments) + i];
+            }
+            stackSize -= numberOfArguments;
+
+            uint32 index = numberOfNodes;
+            if (!SimplifyNode(nodes, node, index)) {
+                bool found = false;
+                for (uint32 i = 0u; (i < numberOfNodes) && (!found); i++) {
+                    found = ((nodes[i].operation == node.operation) && (nodes[i].numberOfArguments == node.numberOfArguments));
+                    for (uint32 j = 0u; (j < node.numberOfArguments) && (found); j++) {
+                        found = (nodes[i].arguments[j] == node.arguments[j]);
+                    }
+                    if (found) {
+                        index = i;
+                    }
+                }
+                if (!found) {
+                    numberOfNodes++;
+                }
+            }
+            stack[stackSize] = index;
+            stackSize++;
+        }
+        line = "";
+    }
+    ok = ((ok) && (stackSize == 1u));
+
+    if (ok) {
+        // the arguments always precede the nodes using them
+        uint32 root = stack[0u];
+        nodes[root].used = true;
+        for (uint32 i = root + 1u; i > 0u; i--) {
+            const MathExpressionNode &node = nodes[i - 1u];
+            if (node.used) {
+                for (uint32 j = 0u; j < node.numberOfArguments; j++) {
+                    nodes[node.arguments[j]].used = true;
+                    nodes[node.arguments[j]].numberOfUses++;
+                }
+            }
+        }
+        EmitNode(nodes, root, numberOfTemporaries, optimisedExpr);
+    }
+
+    if (nodes != NULL) {
+        delete[] nodes;
+    }
+    if (stack != NULL) {
+        delete[] stack;
+    }
+    return ok;
+}
+
 void MathExpressionParser::Execute(const uint32 number) {
     (this->*Action[number])();
 }
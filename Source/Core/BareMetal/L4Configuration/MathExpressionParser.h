@@ -132,6 +132,38 @@ namespace MARTe{
  * WRITE retVar
  * ~~~~~~~~~~~~
  *
+ * Before being written in stack machine form each statement is
+ * optimised as an expression tree:
+ * - the float64 arithmetic (`+`, `-`, `*`, `/` and the prefix `-`) of
+ *   literal numbers is computed by the parser (constant folding), e.g.
+ *   `y = x * (2.0 / 4.0)` becomes `READ x; CONST float64 0.5; MUL; WRITE y`;
+ * - the identities `x * 1`, `1 * x`, `x / 1`, `x - 0` and `-(-x)` are
+ *   simplified to `x`;
+ * - the sub-expressions which appear more than once in the statement
+ *   are computed once into a local variable named `Temporary@N`
+ *   (common sub-expression elimination), e.g.
+ *   `z = (K * 2.0 / 3.14159) * x + (K * 2.0 / 3.14159) * y` becomes:
+ * 
+ * ~~~~~~~~~~~~
+ * READ K
+ * CONST float64 2.0
+ * MUL
+ * CONST float64 3.14159
+ * DIV
+ * WRITE Temporary@0
+ * READ Temporary@0
+ * READ x
+ * MUL
+ * READ Temporary@0
+ * READ y
+ * MUL
+ * ADD
+ * WRITE z
+ * ~~~~~~~~~~~~
+ * 
+ * The statements using functions not known to the parser are written
+ * as they are parsed.
+ *
  * All the instances of this parser use the lexical elements defined
  * in the MathGrammar of MARTe::GrammarInfo and apply the parsing rules
  * defined in MathGrammar.ll:
@@ -283,6 +315,19 @@ protected:
          */
         virtual void PopAssignment();
     //@}
+
+    /**
+     * @brief   Optimises the statement in #statementExpr.
+     * @details Builds the expression tree of the statement, folds the
+     *          constants, simplifies the identities and shares the
+     *          equal sub-expressions, which are then computed once
+     *          into temporaries (see the class description).
+     * @param[out] optimisedExpr the optimised statement in stack
+     *          machine form (without the final `WRITE`).
+     * @returns false if the statement cannot be optimised (e.g. it
+     *          uses a function not known to the parser).
+     */
+    bool OptimiseStatement(StreamString &optimisedExpr);
     
     /**
      * @brief   Translates an operator from infix mathematical syntax
@@ -391,6 +436,16 @@ protected:
      * @brief Holds the mathematical expression in stack machine form while parsing.
      */
     StreamString              stackMachineExpr;
+
+    /**
+     * @brief Holds the statement being parsed in stack machine form (see OptimiseStatement()).
+     */
+    StreamString              statementExpr;
+
+    /**
+     * @brief The number of temporaries used by the optimised statements.
+     */
+    uint32                    numberOfTemporaries;
     
 private:
     
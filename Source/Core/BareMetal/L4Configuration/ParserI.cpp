@@ -83,6 +83,19 @@ ParserI::ParserI(StreamI &stream,
     }
 }
 
+ParserI::ParserI(const char8 * const input,
+                 const uint32 inputSize,
+                 BufferedStreamI * const err,
+                 const GrammarInfo &grammarIn) :
+        tokenProducer(input, inputSize, &grammarIn.assignment, grammarIn.separators, grammarIn.beginOneLineComment, grammarIn.beginMultipleLinesComment,
+                      grammarIn.endMultipleLinesComment, grammarIn.keywords) {
+
+    errorStream = err;
+    grammar = grammarIn;
+    currentToken = static_cast<Token*>(NULL);
+    isError = false;
+}
+
 ParserI::~ParserI() {
     currentToken = static_cast<Token*>(NULL);
     errorStream=static_cast<BufferedStreamI*>(NULL);
@@ -89,6 +89,24 @@ public:
     ParserI(StreamI &stream,
             BufferedStreamI * const err,
             const GrammarInfo &grammarIn);
+
+    /**
+     * @brief Constructor which parses a memory buffer (e.g. a memory mapped
+     * file) instead of a stream.
+     * @details The tokens are extracted directly from the \a input buffer,
+     * which must remain valid and unchanged until Parse() returns.
+     * @param[in] input is the buffer to be parsed.
+     * @param[in] inputSize is the number of characters in \a input.
+     * @param[out] err is a stream where parse error messages are written into.
+     * @param[in] grammarIn contains the comments patterns, the separator and
+     * terminal characters.
+     * @post
+     *   GetGrammar() == grammarIn
+     */
+    ParserI(const char8 * const input,
+            const uint32 inputSize,
+            BufferedStreamI * const err,
+            const GrammarInfo &grammarIn);
             
     /**
      * @brief Destructor.
@@ -102,7 +120,7 @@ public:
      * In case of failure, the error causing the failure is printed on the
      * \a err stream in input (if it is not NULL).
      */
-    bool Parse();
+    virtual bool Parse();
 
     /**
      * @brief Retrieves the grammar used by this parser.
@@ -52,6 +52,275 @@ const CCString castToken("CAST");
 const CCString remoteWriteToken("RWRITE");
 const CCString remoteReadToken("RREAD");
 
+/**
+ * @name Functions of the optimised code
+ * @details Used by RuntimeEvaluator::Optimise().
+ */
+//@{
+/**
+ * Pushes the variable addressed by the operand 0.
+ */
+template <typename T> void Load(RuntimeEvaluator &context){
+    context.Push(context.Operand<T>(0u));
+}
+
+/**
+ * Pops into the variable addressed by the operand 0.
+ */
+template <typename T> void Store(RuntimeEvaluator &context){
+    context.Pop(context.Operand<T>(0u));
+}
+
+/**
+ * x2 + x1
+ */
+class AdditionOperation {
+public:
+    template <typename T> static inline T Apply(const T x2, const T x1){
+        return static_cast<T>(x2 + x1);
+    }
+};
+
+/**
+ * x2 - x1
+ */
+class SubtractionOperation {
+public:
+    template <typename T> static inline T Apply(const T x2, const T x1){
+        return static_cast<T>(x2 - x1);
+    }
+};
+
+/**
+ * x2 * x1
+ */
+class MultiplicationOperation {
+public:
+    template <typename T> static inline T Apply(const T x2, const T x1){
+        return static_cast<T>(x2 * x1);
+    }
+};
+
+/**
+ * x2 / x1
+ */
+class DivisionOperation {
+public:
+    template <typename T> static inline T Apply(const T x2, const T x1){
+        return static_cast<T>(x2 / x1);
+    }
+};
+
+/**
+ * READ a; READ b; OP; WRITE c
+ */
+template <typename T, class Operation> void LoadLoadOperateStore(RuntimeEvaluator &context){
+    context.Operand<T>(2u) = Operation::Apply(context.Operand<T>(0u), context.Operand<T>(1u));
+}
+
+/**
+ * READ a; READ b; OP
+ */
+template <typename T, class Operation> void LoadLoadOperate(RuntimeEvaluator &context){
+    T x3 = Operation::Apply(context.Operand<T>(0u), context.Operand<T>(1u));
+    context.Push(x3);
+}
+
+/**
+ * READ b; OP; WRITE c
+ */
+template <typename T, class Operation> void LoadOperateStore(RuntimeEvaluator &context){
+    T x2;
+    context.Pop(x2);
+    context.Operand<T>(1u) = Operation::Apply(x2, context.Operand<T>(0u));
+}
+
+/**
+ * READ b; OP
+ */
+template <typename T, class Operation> void LoadOperate(RuntimeEvaluator &context){
+    T x2;
+    context.Pop(x2);
+    T x3 = Operation::Apply(x2, context.Operand<T>(0u));
+    context.Push(x3);
+}
+
+/**
+ * OP; WRITE c
+ */
+template <typename T, class Operation> void OperateStore(RuntimeEvaluator &context){
+    T x1;
+    T x2;
+    context.Pop(x1);
+    context.Pop(x2);
+    context.Operand<T>(0u) = Operation::Apply(x2, x1);
+}
+//@}
+
+/**
+ * The sequences fused in a single instruction (the columns of the fused function tables).
+ */
+static const uint32 loadLoadOperateStorePattern = 0u;
+static const uint32 loadLoadOperatePattern      = 1u;
+static const uint32 loadOperateStorePattern     = 2u;
+static const uint32 loadOperatePattern          = 3u;
+static const uint32 operateStorePattern         = 4u;
+static const uint32 numberOfPatterns            = 5u;
+
+/**
+ * The operators which can be fused (the rows of the fused function tables).
+ */
+static const char8 * const fusedOperatorNames[] = { "ADD", "SUB", "MUL", "DIV" };
+static const uint32 numberOfFusedOperators      = 4u;
+
+#define FUSED_FUNCTIONS(type,operation) { \
+        &LoadLoadOperateStore<type,operation>, &LoadLoadOperate<type,operation>, &LoadOperateStore<type,operation>, \
+        &LoadOperate<type,operation>, &OperateStore<type,operation> }
+
+/**
+ * The float32 fused functions.
+ */
+static const Function fusedFloat32Functions[numberOfFusedOperators][numberOfPatterns] = {
+        FUSED_FUNCTIONS(float32, AdditionOperation),
+        FUSED_FUNCTIONS(float32, SubtractionOperation),
+        FUSED_FUNCTIONS(float32, MultiplicationOperation),
+        FUSED_FUNCTIONS(float32, DivisionOperation) };
+
+/**
+ * The float64 fused functions.
+ */
+static const Function fusedFloat64Functions[numberOfFusedOperators][numberOfPatterns] = {
+        FUSED_FUNCTIONS(float64, AdditionOperation),
+        FUSED_FUNCTIONS(float64, SubtractionOperation),
+        FUSED_FUNCTIONS(float64, MultiplicationOperation),
+        FUSED_FUNCTIONS(float64, DivisionOperation) };
+
+/**
+ * @brief Gets the Load and the Store functions of a type.
+ * @param[in] type the type of the variable.
+ * @param[out] load the Load function or NULL if the type is not supported.
+ * @param[out] store the Store function or NULL if the type is not supported.
+ */
+static void GetLoadStoreFunctions(const TypeDescriptor &type, Function &load, Function &store){
+    if (type == Float64Bit) {
+        load = &Load<float64>;
+        store = &Store<float64>;
+    }
+    else if (type == Float32Bit) {
+        load = &Load<float32>;
+        store = &Store<float32>;
+    }
+    else if (type == UnsignedInteger64Bit) {
+        load = &Load<uint64>;
+        store = &Store<uint64>;
+    }
+    else if (type == SignedInteger64Bit) {
+        load = &Load<int64>;
+        store = &Store<int64>;
+    }
+    else if (type == UnsignedInteger32Bit) {
+        load = &Load<uint32>;
+        store = &Store<uint32>;
+    }
+    else if (type == SignedInteger32Bit) {
+        load = &Load<int32>;
+        store = &Store<int32>;
+    }
+    else if (type == UnsignedInteger16Bit) {
+        load = &Load<uint16>;
+        store = &Store<uint16>;
+    }
+    else if (type == SignedInteger16Bit) {
+        load = &Load<int16>;
+        store = &Store<int16>;
+    }
+    else if (type == UnsignedInteger8Bit) {
+        load = &Load<uint8>;
+        store = &Store<uint8>;
+    }
+    else if (type == SignedInteger8Bit) {
+        load = &Load<int8>;
+        store = &Store<int8>;
+    }
+    else {
+        load = NULL_PTR(Function);
+        store = NULL_PTR(Function);
+    }
+}
+
+/**
+ * @brief Describes an instruction while RuntimeEvaluator::Optimise() builds the optimised code.
+ */
+struct OptimiserEntry {
+    /**
+     * The instruction.
+     */
+    RuntimeEvaluatorInstruction instruction;
+
+    /**
+     * The type read by a load, written by a store, or of a fusible operator.
+     */
+    TypeDescriptor type;
+
+    /**
+     * true if the instruction pushes a variable (or constant) addressed by the operand 0.
+     */
+    bool isLoad;
+
+    /**
+     * true if the instruction pops into a variable of the same type addressed by the operand 0.
+     */
+    bool isStore;
+
+    /**
+     * true if the instruction pushes a constant.
+     */
+    bool isConstant;
+
+    /**
+     * The row of the fused function tables or numberOfFusedOperators if the instruction cannot be fused.
+     */
+    uint32 fusedOperator;
+
+    /**
+     * The index of the RuntimeEvaluatorBatchVariable addressed by the operand 0 or numberOfBatchVariables.
+     */
+    uint32 batchVariable;
+};
+
+/**
+ * @brief Gets the function which executes a fused sequence.
+ * @param[in] entry the operator of the sequence.
+ * @param[in] pattern the sequence.
+ * @return the function or NULL if the operator cannot be fused.
+ */
+static Function GetFusedFunction(const OptimiserEntry &entry, const uint32 pattern){
+    Function function = NULL_PTR(Function);
+    if (entry.fusedOperator < numberOfFusedOperators) {
+        if (entry.type == Float32Bit) {
+            function = fusedFloat32Functions[entry.fusedOperator][pattern];
+        }
+        else {
+            function = fusedFloat64Functions[entry.fusedOperator][pattern];
+        }
+    }
+    return function;
+}
+
+/**
+ * @brief Checks if an entry is a load of the given type.
+ */
+static bool IsLoadOfType(const OptimiserEntry &entry, const TypeDescriptor &type){
+    return ((entry.isLoad) && (entry.type == type));
+}
+
+/**
+ * @brief Checks if an entry is a store of the given type.
+ */
+static bool IsStoreOfType(const OptimiserEntry &entry, const TypeDescriptor &type){
+    return ((entry.isStore) && (entry.type == type));
+}
+
 
 
 /**
@@ -125,6 +394,10 @@ RuntimeEvaluator::RuntimeEvaluator(StreamString RPNCodeIn){
     codeMemoryPtr = NULL_PTR(CodeMemoryElement*);
     stackPtr = NULL_PTR(DataMemoryElement*);
     startOfVariables = 0u;
+    threadedCodeSize = 0u;
+    instructionPtr = NULL_PTR(const RuntimeEvaluatorInstruction*);
+    numberOfBatchVariables = 0u;
+    numberOfBatchOperands = 0u;
 }
 
 RuntimeEvaluator::~RuntimeEvaluator(){
@@ -956,6 +1229,10 @@ ErrorManagement::ErrorType RuntimeEvaluator::Compile()
         }
     }
 
+    if (ret.ErrorsCleared()){
+        ret = Optimise();
+    }
+
     return ret;
 }
 
@@ -1127,6 +1404,268 @@ ErrorManagement::ErrorType RuntimeEvaluator::FunctionRecordOutputs2String(Runtim
     return ret;
 }
 
+/*lint -e{946, 947, 9016} the pointers are calculated from pointers pointing to the same arrays */
+ErrorManagement::ErrorType RuntimeEvaluator::Optimise(){
+
+    ErrorManagement::ErrorType ret;
+
+    const CodeMemoryElement *codeMemoryBeginPtr = codeMemory.GetAllocatedMemoryConst();
+    CodeMemoryAddress codeMaxIndex  = static_cast<CodeMemoryAddress>(codeMemory.GetSize());
+    const CodeMemoryElement *codeMemoryMaxPtr = codeMemoryBeginPtr + codeMaxIndex;
+    DataMemoryElement *stackBeginPtr = static_cast<DataMemoryElement*>(stack.GetDataPointer());
+
+    // there are at most as many functions as pseudo-codes, and each folded constant takes at most 64 bits
+    Vector<OptimiserEntry> entries(static_cast<uint32>(codeMaxIndex));
+    uint32 numberOfEntries = 0u;
+    foldedConstants.SetSize(2u * static_cast<uint32>(codeMaxIndex));
+    uint32 numberOfFoldedElements = 0u;
+
+    // the variables in external memory, whose addresses are advanced by ExecuteBatch
+    uint32 numberOfInputVariables = 0u;
+    VariableInformation *var;
+    while (BrowseInputVariable(numberOfInputVariables, var)){
+        numberOfInputVariables++;
+    }
+    uint32 numberOfOutputVariables = 0u;
+    while (BrowseOutputVariable(numberOfOutputVariables, var)){
+        numberOfOutputVariables++;
+    }
+    batchVariables.SetSize(numberOfInputVariables + numberOfOutputVariables);
+    numberOfBatchVariables = 0u;
+    for (uint32 i = 0u; i < (numberOfInputVariables + numberOfOutputVariables); i++){
+        if (i < numberOfInputVariables){
+            (void) BrowseInputVariable(i, var);
+        }
+        else {
+            (void) BrowseOutputVariable(i - numberOfInputVariables, var);
+        }
+        if (var->externalLocation != NULL){
+            RuntimeEvaluatorBatchVariable &batchVariable = batchVariables[numberOfBatchVariables];
+            batchVariable.location = var->location;
+            batchVariable.base = static_cast<char8 *>(var->externalLocation);
+            batchVariable.index = i;
+            batchVariable.size = static_cast<uint32>(var->type.numberOfBits) / 8u;
+            batchVariable.stride = batchVariable.size;
+            numberOfBatchVariables++;
+        }
+    }
+
+    // first pass: resolve the operands and fold the constants
+    codeMemoryPtr = codeMemoryBeginPtr;
+    while (codeMemoryPtr < codeMemoryMaxPtr){
+        CodeMemoryElement pCode = GetPseudoCode();
+        RuntimeEvaluatorFunction &fr = functionRecords[pCode];
+        StreamString functionName = fr.GetName();
+
+        OptimiserEntry entry;
+        entry.instruction.function = fr.GetFunction();
+        entry.instruction.code = codeMemoryPtr;
+        entry.instruction.operands[0u] = NULL_PTR(void *);
+        entry.instruction.operands[1u] = NULL_PTR(void *);
+        entry.instruction.operands[2u] = NULL_PTR(void *);
+        entry.type = InvalidType;
+        entry.isLoad = false;
+        entry.isStore = false;
+        entry.isConstant = false;
+        entry.fusedOperator = numberOfFusedOperators;
+        entry.batchVariable = numberOfBatchVariables;
+
+        bool isRead        = (functionName == readToken);
+        bool isRemoteRead  = (functionName == remoteReadToken);
+        bool isWrite       = (functionName == writeToken);
+        bool isRemoteWrite = (functionName == remoteWriteToken);
+        Function load = NULL_PTR(Function);
+        Function store = NULL_PTR(Function);
+
+        if (isRead || isRemoteRead || isWrite || isRemoteWrite){
+            CodeMemoryElement pCode2 = GetPseudoCode();
+            if (isRead || isWrite){
+                entry.instruction.operands[0u] = &variablesMemoryPtr[pCode2];
+            } else {
+                entry.instruction.operands[0u] = Variable<void *>(pCode2);
+                for (uint32 k = 0u; k < numberOfBatchVariables; k++){
+                    if (batchVariables[k].location == pCode2){
+                        entry.batchVariable = k;
+                    }
+                }
+            }
+            if (isRead || isRemoteRead){
+                entry.type = fr.GetOutputTypes()[0u];
+                GetLoadStoreFunctions(entry.type, load, store);
+                entry.isLoad = (load != NULL_PTR(Function));
+                if (entry.isLoad){
+                    entry.instruction.function = load;
+                }
+                entry.isConstant = (isRead && (pCode2 < startOfVariables));
+            } else {
+                // the WRITEs which convert the type are kept
+                entry.type = fr.GetInputTypes()[0u];
+                VariableInformation *variableInformation = NULL_PTR(VariableInformation *);
+                ErrorManagement::ErrorType found = FindVariable(pCode2, variableInformation);
+                if (found.ErrorsCleared()){
+                    if (variableInformation->type == entry.type){
+                        GetLoadStoreFunctions(entry.type, load, store);
+                        entry.isStore = (store != NULL_PTR(Function));
+                        if (entry.isStore){
+                            entry.instruction.function = store;
+                        }
+                    }
+                }
+            }
+        } else {
+            Vector<TypeDescriptor> inputTypes = fr.GetInputTypes();
+            Vector<TypeDescriptor> outputTypes = fr.GetOutputTypes();
+            uint32 numberOfInputs = inputTypes.GetNumberOfElements();
+            DataMemoryAddress outputSize = 0u;
+
+            // an operation whose inputs are all constants is computed now
+            bool fold = ((outputTypes.GetNumberOfElements() == 1u) && (numberOfInputs > 0u) && (numberOfInputs <= numberOfEntries));
+            for (uint32 i = 0u; (i < numberOfInputs) && (fold); i++){
+                fold = entries[(numberOfEntries - 1u) - i].isConstant;
+            }
+            if (fold){
+                GetLoadStoreFunctions(outputTypes[0u], load, store);
+                outputSize = ByteSizeToDataMemorySize(outputTypes[0u].numberOfBits/8u);
+                fold = ((load != NULL_PTR(Function)) && ((numberOfFoldedElements + outputSize) <= foldedConstants.GetNumberOfElements()));
+            }
+            if (fold){
+                stackPtr = stackBeginPtr;
+                for (uint32 i = numberOfEntries - numberOfInputs; i < numberOfEntries; i++){
+                    DataMemoryAddress size = ByteSizeToDataMemorySize(entries[i].type.numberOfBits/8u);
+                    const DataMemoryElement *constant = static_cast<const DataMemoryElement *>(entries[i].instruction.operands[0u]);
+                    for (DataMemoryAddress j = 0u; j < size; j++){
+                        *stackPtr = constant[j];
+                        stackPtr++;
+                    }
+                }
+                runtimeError = ErrorManagement::ErrorType(true);
+                fr.ExecuteFunction(*this);
+                // the operations which report an error are left to the runtime
+                fold = ((runtimeError.ErrorsCleared()) && (stackPtr == (stackBeginPtr + outputSize)));
+            }
+            if (fold){
+                DataMemoryElement *result = &foldedConstants[numberOfFoldedElements];
+                for (DataMemoryAddress j = 0u; j < outputSize; j++){
+                    result[j] = stackBeginPtr[j];
+                }
+                numberOfFoldedElements += outputSize;
+                numberOfEntries -= numberOfInputs;
+                entry.instruction.function = load;
+                entry.instruction.operands[0u] = result;
+                entry.type = outputTypes[0u];
+                entry.isLoad = true;
+                entry.isConstant = true;
+            } else {
+                // the float ADD, SUB, MUL and DIV can be fused
+                bool fusible = ((numberOfInputs == 2u) && (outputTypes.GetNumberOfElements() == 1u));
+                if (fusible){
+                    entry.type = outputTypes[0u];
+                    fusible = ((entry.type == Float32Bit) || (entry.type == Float64Bit));
+                }
+                if (fusible){
+                    fusible = ((inputTypes[0u] == entry.type) && (inputTypes[1u] == entry.type));
+                }
+                for (uint32 k = 0u; (k < numberOfFusedOperators) && (fusible); k++){
+                    if (functionName == fusedOperatorNames[k]){
+                        entry.fusedOperator = k;
+                    }
+                }
+            }
+        }
+        entries[numberOfEntries] = entry;
+        numberOfEntries++;
+    }
+    stackPtr = stackBeginPtr;
+    runtimeError = ErrorManagement::ErrorType(true);
+
+    // second pass: fuse the sequences
+    threadedCode.SetSize(numberOfEntries);
+    threadedCodeSize = 0u;
+    batchOperands.SetSize(3u * numberOfEntries);
+    numberOfBatchOperands = 0u;
+    uint32 i = 0u;
+    while (i < numberOfEntries){
+        RuntimeEvaluatorInstruction instruction = entries[i].instruction;
+        // the entries whose operand 0 becomes each operand of the instruction
+        uint32 sources[3u] = { i, numberOfEntries, numberOfEntries };
+        uint32 remaining = numberOfEntries - i;
+        uint32 consumed = 1u;
+        bool fused = false;
+        // READ a; READ b; OP [; WRITE c]
+        if (remaining >= 3u){
+            const OptimiserEntry &operation = entries[i + 2u];
+            fused = (operation.fusedOperator < numberOfFusedOperators);
+            if (fused){
+                fused = ((IsLoadOfType(entries[i], operation.type)) && (IsLoadOfType(entries[i + 1u], operation.type)));
+            }
+            if (fused){
+                instruction.operands[1u] = entries[i + 1u].instruction.operands[0u];
+                sources[1u] = i + 1u;
+                if (remaining >= 4u){
+                    if (IsStoreOfType(entries[i + 3u], operation.type)){
+                        consumed = 4u;
+                    }
+                }
+                if (consumed == 4u){
+                    instruction.function = GetFusedFunction(operation, loadLoadOperateStorePattern);
+                    instruction.operands[2u] = entries[i + 3u].instruction.operands[0u];
+                    sources[2u] = i + 3u;
+                } else {
+                    instruction.function = GetFusedFunction(operation, loadLoadOperatePattern);
+                    consumed = 3u;
+                }
+            }
+        }
+        // READ b; OP [; WRITE c]
+        if ((!fused) && (remaining >= 2u)){
+            const OptimiserEntry &operation = entries[i + 1u];
+            fused = ((operation.fusedOperator < numberOfFusedOperators) && (IsLoadOfType(entries[i], operation.type)));
+            if (fused){
+                if (remaining >= 3u){
+                    if (IsStoreOfType(entries[i + 2u], operation.type)){
+                        consumed = 3u;
+                    }
+                }
+                if (consumed == 3u){
+                    instruction.function = GetFusedFunction(operation, loadOperateStorePattern);
+                    instruction.operands[1u] = entries[i + 2u].instruction.operands[0u];
+                    sources[1u] = i + 2u;
+                } else {
+                    instruction.function = GetFusedFunction(operation, loadOperatePattern);
+                    consumed = 2u;
+                }
+            }
+        }
+        // OP; WRITE c
+        if ((!fused) && (remaining >= 2u)){
+            const OptimiserEntry &operation = entries[i];
+            fused = ((operation.fusedOperator < numberOfFusedOperators) && (IsStoreOfType(entries[i + 1u], operation.type)));
+            if (fused){
+                instruction.function = GetFusedFunction(operation, operateStorePattern);
+                instruction.operands[0u] = entries[i + 1u].instruction.operands[0u];
+                sources[0u] = i + 1u;
+                consumed = 2u;
+            }
+        }
+        for (uint32 k = 0u; k < 3u; k++){
+            if (sources[k] < numberOfEntries){
+                if (entries[sources[k]].batchVariable < numberOfBatchVariables){
+                    RuntimeEvaluatorBatchOperand &batchOperand = batchOperands[numberOfBatchOperands];
+                    batchOperand.instruction = threadedCodeSize;
+                    batchOperand.operand = k;
+                    batchOperand.variable = entries[sources[k]].batchVariable;
+                    numberOfBatchOperands++;
+                }
+            }
+        }
+        threadedCode[threadedCodeSize] = instruction;
+        threadedCodeSize++;
+        i += consumed;
+    }
+
+    return ret;
+}
+
 /*lint -e{946, 947, 9016} codeMemoryMaxPtr is calculated from pointers pointing to the same array
  * and is only used as a safety check, thus it cannot go out of bounds */
 ErrorManagement::ErrorType RuntimeEvaluator::Execute(const executionMode mode, StreamI* const debugStream){
@@ -1143,9 +1682,11 @@ ErrorManagement::ErrorType RuntimeEvaluator::Execute(const executionMode mode, S
 
     switch (mode){
     case fastMode:{
-        while(codeMemoryPtr < codeMemoryMaxPtr){
-            CodeMemoryElement pCode = GetPseudoCode();
-            functionRecords[pCode].ExecuteFunction(*this);
+        const RuntimeEvaluatorInstruction *instructionBeginPtr = static_cast<const RuntimeEvaluatorInstruction *>(threadedCode.GetDataPointer());
+        const RuntimeEvaluatorInstruction *instructionMaxPtr = instructionBeginPtr + threadedCodeSize;
+        for (instructionPtr = instructionBeginPtr; instructionPtr < instructionMaxPtr; instructionPtr++){
+            codeMemoryPtr = instructionPtr->code;
+            instructionPtr->function(*this);
         }
     }break;
     case safeMode:{
@@ -1257,6 +1798,57 @@ ErrorManagement::ErrorType RuntimeEvaluator::Execute(const executionMode mode, S
     return runtimeError;
 }
 
+/*lint -e{946, 947, 9016} the pointers are calculated from pointers pointing to the same arrays */
+ErrorManagement::ErrorType RuntimeEvaluator::ExecuteBatch(const uint32 numberOfElements, const uint32 * const strides){
+
+    DataMemoryElement *stackBeginPtr = static_cast<DataMemoryElement*>(stack.GetDataPointer());
+    variablesMemoryPtr = static_cast<DataMemoryElement *>(dataMemory.GetDataPointer());
+    runtimeError = ErrorManagement::ErrorType(true);
+
+    RuntimeEvaluatorInstruction *instructionBeginPtr = static_cast<RuntimeEvaluatorInstruction *>(threadedCode.GetDataPointer());
+    const RuntimeEvaluatorInstruction *instructionMaxPtr = instructionBeginPtr + threadedCodeSize;
+
+    for (uint32 k = 0u; k < numberOfBatchVariables; k++){
+        if (strides != NULL_PTR(const uint32 *)){
+            batchVariables[k].stride = strides[batchVariables[k].index];
+        }
+        else {
+            batchVariables[k].stride = batchVariables[k].size;
+        }
+    }
+
+    uint32 offset = 0u;
+    for (uint32 i = 0u; i < numberOfElements; i++){
+        // each element is addressed by the functions through the data memory or the operands
+        for (uint32 k = 0u; k < numberOfBatchVariables; k++){
+            offset = i * batchVariables[k].stride;
+            Variable<void *>(batchVariables[k].location) = &batchVariables[k].base[offset];
+        }
+        for (uint32 k = 0u; k < numberOfBatchOperands; k++){
+            const RuntimeEvaluatorBatchOperand &batchOperand = batchOperands[k];
+            offset = i * batchVariables[batchOperand.variable].stride;
+            instructionBeginPtr[batchOperand.instruction].operands[batchOperand.operand] = &batchVariables[batchOperand.variable].base[offset];
+        }
+
+        stackPtr = stackBeginPtr;
+        for (instructionPtr = instructionBeginPtr; instructionPtr < instructionMaxPtr; instructionPtr++){
+            codeMemoryPtr = instructionPtr->code;
+            instructionPtr->function(*this);
+        }
+    }
+
+    // restore the addresses of the first element
+    for (uint32 k = 0u; k < numberOfBatchVariables; k++){
+        Variable<void *>(batchVariables[k].location) = batchVariables[k].base;
+    }
+    for (uint32 k = 0u; k < numberOfBatchOperands; k++){
+        const RuntimeEvaluatorBatchOperand &batchOperand = batchOperands[k];
+        instructionBeginPtr[batchOperand.instruction].operands[batchOperand.operand] = batchVariables[batchOperand.variable].base;
+    }
+
+    return runtimeError;
+}
+
 /*lint -e{946, 947, 9016} codeMemoryMaxPtr is calculated from pointers pointing to the same array
  * and is only used as a safety check, thus it cannot go out of bounds */
 ErrorManagement::ErrorType RuntimeEvaluator::DeCompile(StreamString &DeCompileRPNCode, const bool showTypes) {
@@ -56,6 +56,81 @@ namespace MARTe {
 
 // Forward declaration required (RuntimeEvaluator and RuntimeEvaluatorFunction are circular-dependant).
 class RuntimeEvaluatorFunction;
+class RuntimeEvaluator;
+
+/**
+ * @brief One instruction of the optimised code executed in RuntimeEvaluator::fastMode.
+ * @details The function is called directly (no lookup in #functionRecords). The operands of the functions
+ * generated by the optimisation (loads, stores and superinstructions, see RuntimeEvaluator::Compile) are
+ * pointers resolved at compile time and are accessed with RuntimeEvaluator::Operand(). The other functions
+ * read their pseudo-code operands with RuntimeEvaluator::GetPseudoCode() starting from \a code.
+ */
+struct RuntimeEvaluatorInstruction {
+    /**
+     * The function to execute.
+     */
+    void (*function)(RuntimeEvaluator &context);
+
+    /**
+     * The pseudo-code following the function in the original code.
+     */
+    const CodeMemoryElement *code;
+
+    /**
+     * The addresses of the variables (or constants) read and written by the function.
+     */
+    void *operands[3];
+};
+
+/**
+ * @brief A variable in external memory whose address is advanced by RuntimeEvaluator::ExecuteBatch.
+ */
+struct RuntimeEvaluatorBatchVariable {
+    /**
+     * The location in the data memory where the address of the variable is kept.
+     */
+    DataMemoryAddress location;
+
+    /**
+     * The address of the first element of the variable.
+     */
+    char8 *base;
+
+    /**
+     * The index of the variable in the strides of ExecuteBatch (the input variables followed by the output variables).
+     */
+    uint32 index;
+
+    /**
+     * The size in bytes of the variable, i.e. the stride of a contiguous array.
+     */
+    uint32 size;
+
+    /**
+     * The stride in bytes used by the ExecuteBatch being executed.
+     */
+    uint32 stride;
+};
+
+/**
+ * @brief An operand of a RuntimeEvaluatorInstruction which addresses a RuntimeEvaluatorBatchVariable.
+ */
+struct RuntimeEvaluatorBatchOperand {
+    /**
+     * The index of the instruction in the optimised code.
+     */
+    uint32 instruction;
+
+    /**
+     * The index of the operand in the instruction.
+     */
+    uint32 operand;
+
+    /**
+     * The index of the RuntimeEvaluatorBatchVariable.
+     */
+    uint32 variable;
+};
 
 /**
  * @brief Runtime mathematical expression evaluation engine.
@@ -306,6 +381,9 @@ class RuntimeEvaluatorFunction;
  * types. Combination of code and types during Compile() produces
  * a list of calls to functions with specific types (the "pseudocode")
  * that will be executed during Execute().
+ * The pseudocode is then optimised into the list of instructions that
+ * Execute(fastMode) runs (see Compile()), while the safeMode and
+ * debugMode execute the pseudocode as it is.
  * Functions that will be called must be present in the #functionRecords
  * array, an array that holds all the available functions that
  * RuntimeEvaluator can call. #functionRecords is an array of
@@ -589,6 +667,17 @@ public:
      *            + writes constants into dataMemory
      *            + checks type consistency
      *            +  grow stack to required size
+     *          - Optimises the code executed in fastMode
+     *            + the operations whose inputs are all constants
+     *              are computed once (constant folding)
+     *            + READ/RREAD and WRITE/RWRITE address the variables
+     *              directly
+     *            + the float32 and float64 ADD, SUB, MUL and DIV
+     *              are fused with the preceding READs and the following
+     *              WRITE in a single instruction working on the variables
+     *              (e.g. `READ a; READ b; ADD; WRITE c` becomes `c = a + b`)
+     *            + the functions are called directly, without
+     *              the #functionRecords lookup
      * 
      * @pre     ExtractVariables() == true && all variable types must
      *          be set.
@@ -601,7 +690,8 @@ public:
      */
     enum executionMode {
         /**
-         * Executes with minimal checks - assumes compilation was correct and function description was truthful
+         * Executes with minimal checks - assumes compilation was correct and function description was truthful.
+         * Runs the optimised code (see Compile())
          */
         fastMode,
 
@@ -627,6 +717,25 @@ public:
      */
     ErrorManagement::ErrorType Execute(const executionMode mode = fastMode, StreamI* const debugStream=NULL_PTR(StreamI *));
 
+    /**
+     * @brief     Executes the optimised code (see fastMode) once for each element of the variables.
+     * @details   The variables whose memory was set with SetInputVariableMemory() or SetOutputVariableMemory()
+     *            are arrays of \a numberOfElements elements: the element i of a variable is at
+     *            i * stride bytes from the address that was set. The other variables (and the constants)
+     *            are scalars shared by all the elements.
+     *            The setup of the execution is done once for the batch and the addresses of the
+     *            variables are advanced in place, so that the cost of the evaluation of an
+     *            element is the cost of the optimised code only.
+     * @param[in] numberOfElements the number of elements to evaluate.
+     * @param[in] strides the stride in bytes of each variable, indexed as the input variables
+     *            (see BrowseInputVariable()) followed by the output variables (see BrowseOutputVariable()).
+     *            If NULL the arrays are contiguous (the stride is the size of the variable type).
+     * @returns   the combination of error flags reported by all the functions that were executed.
+     * @pre ExtractVariables() == true && Compile() == true && all
+     *      variable types must be set.
+     */
+    ErrorManagement::ErrorType ExecuteBatch(const uint32 numberOfElements, const uint32 * const strides = NULL_PTR(const uint32 *));
+
     /**
      * @brief Reconstruct the RPNCode with type information
      */
@@ -673,6 +782,15 @@ public:
         */
         template<typename T>
         inline void Peek(T &value);
+
+        /**
+        * @brief     Gets an operand of the optimised instruction being executed.
+        * @param[in] index the index of the operand.
+        * @return    the variable (or constant) addressed by the operand.
+        * @pre       Execute(fastMode) and the operand was set by the optimisation.
+        */
+        template<typename T>
+        inline T &Operand(const uint32 index);
         
         /**
          * @brief The errors produced by the functions and the checks during runtime.
@@ -796,6 +914,53 @@ private:
      * @details Used by GetPseudoCode().
      */
     const CodeMemoryElement *           codeMemoryPtr;
+
+    /**
+     * @brief   Optimises codeMemory into threadedCode.
+     * @details See Compile().
+     */
+    ErrorManagement::ErrorType Optimise();
+
+    /**
+     * @brief The optimised code executed in fastMode.
+     */
+    Vector<RuntimeEvaluatorInstruction> threadedCode;
+
+    /**
+     * @brief The number of instructions in threadedCode.
+     */
+    uint32                              threadedCodeSize;
+
+    /**
+     * @brief The results of the constant folding.
+     */
+    Vector<DataMemoryElement>           foldedConstants;
+
+    /**
+     * @brief The variables in external memory (see ExecuteBatch()).
+     */
+    Vector<RuntimeEvaluatorBatchVariable> batchVariables;
+
+    /**
+     * @brief The number of elements in batchVariables.
+     */
+    uint32                              numberOfBatchVariables;
+
+    /**
+     * @brief The operands of threadedCode which address the batchVariables.
+     */
+    Vector<RuntimeEvaluatorBatchOperand> batchOperands;
+
+    /**
+     * @brief The number of elements in batchOperands.
+     */
+    uint32                              numberOfBatchOperands;
+
+    /**
+     * @brief   The instruction being executed in fastMode.
+     * @details Used by Operand().
+     */
+    const RuntimeEvaluatorInstruction * instructionPtr;
     
     /**
      * @brief   The code to be evaluated in stack machine form.
@@ -850,6 +1015,11 @@ void RuntimeEvaluator::Push(T &value){
     }
 }
 
+template<typename T>
+T &RuntimeEvaluator::Operand(const uint32 index){
+    return *static_cast<T *>(instructionPtr->operands[index]);
+}
+
 template<typename T>
 T &RuntimeEvaluator::Variable(DataMemoryAddress variableIndex){
     // note that variableIndex is an address to the memory with a granularity of sizeof(MemoryElement)
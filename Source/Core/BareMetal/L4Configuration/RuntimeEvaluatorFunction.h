@@ -140,6 +140,11 @@ public:
      * @brief Get the name of the function.
      */
     StreamString GetName() const {return name;}
+
+    /**
+     * @brief Get the pointer to the actual function code this class wraps.
+     */
+    Function GetFunction() const {return function;}
     
     /**
      * @brief Get the input types set for the function
@@ -87,7 +87,18 @@ StandardParser::StandardParser(StreamI &stream,
                                StructuredDataI &databaseIn,
                                BufferedStreamI * const err) :
         ConfigurationParserI(stream, databaseIn, err, StandardGrammar) {
-    
+    InitialiseActions();
+}
+
+StandardParser::StandardParser(const char8 * const input,
+                               const uint32 inputSize,
+                               StructuredDataI &databaseIn,
+                               BufferedStreamI * const err) :
+        ConfigurationParserI(input, inputSize, databaseIn, err, StandardGrammar) {
+    InitialiseActions();
+}
+
+void StandardParser::InitialiseActions() {
     Action[0] = static_cast<void (StandardParser::*)(void)>(NULL);
     Action[1] = &StandardParser::End;
     Action[2] = &StandardParser::GetNodeName;
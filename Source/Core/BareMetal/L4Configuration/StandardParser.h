@@ -102,6 +102,20 @@ public:
                    StructuredDataI &databaseIn,
                    BufferedStreamI * const err = static_cast<BufferedStreamI*>(NULL));
 
+    /**
+     * @brief Constructor which parses a memory buffer (e.g. a memory mapped
+     * file) instead of a stream.
+     * @param[in] input is the buffer to be parsed. It must remain valid and
+     * unchanged until Parse() returns.
+     * @param[in] inputSize is the number of characters in \a input.
+     * @param[out] databaseIn is the built StructuredData in output.
+     * @param[out] err is the stream where error messages are printed to.
+     */
+    StandardParser(const char8 * const input,
+                   const uint32 inputSize,
+                   StructuredDataI &databaseIn,
+                   BufferedStreamI * const err = static_cast<BufferedStreamI*>(NULL));
+
     /**
      * @brief Destructor.
      */
@@ -156,6 +170,11 @@ protected:
 
 private:
 
+    /**
+     * @brief Fills the array of functions needed by the parser.
+     */
+    void InitialiseActions();
+
     /**
      * The array of functions needed by the parser.
      */
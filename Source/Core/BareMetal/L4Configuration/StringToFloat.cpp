@@ -34,6 +34,7 @@
 #include "FormatDescriptor.h"
 #include "GeneralDefinitions.h"
 #include "IOBuffer.h"
+#include "MemoryOperationsHelper.h"
 #include "TypeConversion.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -63,6 +64,1320 @@ exponent-=step;\
 
 namespace MARTe {
 
+/**
+ * The 128 bits truncated approximations of 5^q for q in [-342, 308], normalised so that the most significant bit is set.
+ * Used by the Eisel-Lemire algorithm (see ComputeFloat).
+ */
+static const uint64 powersOfFive128[651][2] = {
+        { 0xEEF453D6923BD65ALLU, 0x113FAA2906A13B3FLLU }, //5^-342
+        { 0x9558B4661B6565F8LLU, 0x4AC7CA59A424C507LLU }, //5^-341
+        { 0xBAAEE17FA23EBF76LLU, 0x5D79BCF00D2DF649LLU }, //5^-340
+        { 0xE95A99DF8ACE6F53LLU, 0xF4D82C2C107973DCLLU }, //5^-339
+        { 0x91D8A02BB6C10594LLU, 0x79071B9B8A4BE869LLU }, //5^-338
+        { 0xB64EC836A47146F9LLU, 0x9748E2826CDEE284LLU }, //5^-337
+        { 0xE3E27A444D8D98B7LLU, 0xFD1B1B2308169B25LLU }, //5^-336
+        { 0x8E6D8C6AB0787F72LLU, 0xFE30F0F5E50E20F7LLU }, //5^-335
+        { 0xB208EF855C969F4FLLU, 0xBDBD2D335E51A935LLU }, //5^-334
+        { 0xDE8B2B66B3BC4723LLU, 0xAD2C788035E61382LLU }, //5^-333
+        { 0x8B16FB203055AC76LLU, 0x4C3BCB5021AFCC31LLU }, //5^-332
+        { 0xADDCB9E83C6B1793LLU, 0xDF4ABE242A1BBF3DLLU }, //5^-331
+        { 0xD953E8624B85DD78LLU, 0xD71D6DAD34A2AF0DLLU }, //5^-330
+        { 0x87D4713D6F33AA6BLLU, 0x8672648C40E5AD68LLU }, //5^-329
+        { 0xA9C98D8CCB009506LLU, 0x680EFDAF511F18C2LLU }, //5^-328
+        { 0xD43BF0EFFDC0BA48LLU, 0x0212BD1B2566DEF2LLU }, //5^-327
+        { 0x84A57695FE98746DLLU, 0x014BB630F7604B57LLU }, //5^-326
+        { 0xA5CED43B7E3E9188LLU, 0x419EA3BD35385E2DLLU }, //5^-325
+        { 0xCF42894A5DCE35EALLU, 0x52064CAC828675B9LLU }, //5^-324
+        { 0x818995CE7AA0E1B2LLU, 0x7343EFEBD1940993LLU }, //5^-323
+        { 0xA1EBFB4219491A1FLLU, 0x1014EBE6C5F90BF8LLU }, //5^-322
+        { 0xCA66FA129F9B60A6LLU, 0xD41A26E077774EF6LLU }, //5^-321
+        { 0xFD00B897478238D0LLU, 0x8920B098955522B4LLU }, //5^-320
+        { 0x9E20735E8CB16382LLU, 0x55B46E5F5D5535B0LLU }, //5^-319
+        { 0xC5A890362FDDBC62LLU, 0xEB2189F734AA831DLLU }, //5^-318
+        { 0xF712B443BBD52B7BLLU, 0xA5E9EC7501D523E4LLU }, //5^-317
+        { 0x9A6BB0AA55653B2DLLU, 0x47B233C92125366ELLU }, //5^-316
+        { 0xC1069CD4EABE89F8LLU, 0x999EC0BB696E840ALLU }, //5^-315
+        { 0xF148440A256E2C76LLU, 0xC00670EA43CA250DLLU }, //5^-314
+        { 0x96CD2A865764DBCALLU, 0x380406926A5E5728LLU }, //5^-313
+        { 0xBC807527ED3E12BCLLU, 0xC605083704F5ECF2LLU }, //5^-312
+        { 0xEBA09271E88D976BLLU, 0xF7864A44C633682ELLU }, //5^-311
+        { 0x93445B8731587EA3LLU, 0x7AB3EE6AFBE0211DLLU }, //5^-310
+        { 0xB8157268FDAE9E4CLLU, 0x5960EA05BAD82964LLU }, //5^-309
+        { 0xE61ACF033D1A45DFLLU, 0x6FB92487298E33BDLLU }, //5^-308
+        { 0x8FD0C16206306BABLLU, 0xA5D3B6D479F8E056LLU }, //5^-307
+        { 0xB3C4F1BA87BC8696LLU, 0x8F48A4899877186CLLU }, //5^-306
+        { 0xE0B62E2929ABA83CLLU, 0x331ACDABFE94DE87LLU }, //5^-305
+        { 0x8C71DCD9BA0B4925LLU, 0x9FF0C08B7F1D0B14LLU }, //5^-304
+        { 0xAF8E5410288E1B6FLLU, 0x07ECF0AE5EE44DD9LLU }, //5^-303
+        { 0xDB71E91432B1A24ALLU, 0xC9E82CD9F69D6150LLU }, //5^-302
+        { 0x892731AC9FAF056ELLU, 0xBE311C083A225CD2LLU }, //5^-301
+        { 0xAB70FE17C79AC6CALLU, 0x6DBD630A48AAF406LLU }, //5^-300
+        { 0xD64D3D9DB981787DLLU, 0x092CBBCCDAD5B108LLU }, //5^-299
+        { 0x85F0468293F0EB4ELLU, 0x25BBF56008C58EA5LLU }, //5^-298
+        { 0xA76C582338ED2621LLU, 0xAF2AF2B80AF6F24ELLU }, //5^-297
+        { 0xD1476E2C07286FAALLU, 0x1AF5AF660DB4AEE1LLU }, //5^-296
+        { 0x82CCA4DB847945CALLU, 0x50D98D9FC890ED4DLLU }, //5^-295
+        { 0xA37FCE126597973CLLU, 0xE50FF107BAB528A0LLU }, //5^-294
+        { 0xCC5FC196FEFD7D0CLLU, 0x1E53ED49A96272C8LLU }, //5^-293
+        { 0xFF77B1FCBEBCDC4FLLU, 0x25E8E89C13BB0F7ALLU }, //5^-292
+        { 0x9FAACF3DF73609B1LLU, 0x77B191618C54E9ACLLU }, //5^-291
+        { 0xC795830D75038C1DLLU, 0xD59DF5B9EF6A2417LLU }, //5^-290
+        { 0xF97AE3D0D2446F25LLU, 0x4B0573286B44AD1DLLU }, //5^-289
+        { 0x9BECCE62836AC577LLU, 0x4EE367F9430AEC32LLU }, //5^-288
+        { 0xC2E801FB244576D5LLU, 0x229C41F793CDA73FLLU }, //5^-287
+        { 0xF3A20279ED56D48ALLU, 0x6B43527578C1110FLLU }, //5^-286
+        { 0x9845418C345644D6LLU, 0x830A13896B78AAA9LLU }, //5^-285
+        { 0xBE5691EF416BD60CLLU, 0x23CC986BC656D553LLU }, //5^-284
+        { 0xEDEC366B11C6CB8FLLU, 0x2CBFBE86B7EC8AA8LLU }, //5^-283
+        { 0x94B3A202EB1C3F39LLU, 0x7BF7D71432F3D6A9LLU }, //5^-282
+        { 0xB9E08A83A5E34F07LLU, 0xDAF5CCD93FB0CC53LLU }, //5^-281
+        { 0xE858AD248F5C22C9LLU, 0xD1B3400F8F9CFF68LLU }, //5^-280
+        { 0x91376C36D99995BELLU, 0x23100809B9C21FA1LLU }, //5^-279
+        { 0xB58547448FFFFB2DLLU, 0xABD40A0C2832A78ALLU }, //5^-278
+        { 0xE2E69915B3FFF9F9LLU, 0x16C90C8F323F516CLLU }, //5^-277
+        { 0x8DD01FAD907FFC3BLLU, 0xAE3DA7D97F6792E3LLU }, //5^-276
+        { 0xB1442798F49FFB4ALLU, 0x99CD11CFDF41779CLLU }, //5^-275
+        { 0xDD95317F31C7FA1DLLU, 0x40405643D711D583LLU }, //5^-274
+        { 0x8A7D3EEF7F1CFC52LLU, 0x482835EA666B2572LLU }, //5^-273
+        { 0xAD1C8EAB5EE43B66LLU, 0xDA3243650005EECFLLU }, //5^-272
+        { 0xD863B256369D4A40LLU, 0x90BED43E40076A82LLU }, //5^-271
+        { 0x873E4F75E2224E68LLU, 0x5A7744A6E804A291LLU }, //5^-270
+        { 0xA90DE3535AAAE202LLU, 0x711515D0A205CB36LLU }, //5^-269
+        { 0xD3515C2831559A83LLU, 0x0D5A5B44CA873E03LLU }, //5^-268
+        { 0x8412D9991ED58091LLU, 0xE858790AFE9486C2LLU }, //5^-267
+        { 0xA5178FFF668AE0B6LLU, 0x626E974DBE39A872LLU }, //5^-266
+        { 0xCE5D73FF402D98E3LLU, 0xFB0A3D212DC8128FLLU }, //5^-265
+        { 0x80FA687F881C7F8ELLU, 0x7CE66634BC9D0B99LLU }, //5^-264
+        { 0xA139029F6A239F72LLU, 0x1C1FFFC1EBC44E80LLU }, //5^-263
+        { 0xC987434744AC874ELLU, 0xA327FFB266B56220LLU }, //5^-262
+        { 0xFBE9141915D7A922LLU, 0x4BF1FF9F0062BAA8LLU }, //5^-261
+        { 0x9D71AC8FADA6C9B5LLU, 0x6F773FC3603DB4A9LLU }, //5^-260
+        { 0xC4CE17B399107C22LLU, 0xCB550FB4384D21D3LLU }, //5^-259
+        { 0xF6019DA07F549B2BLLU, 0x7E2A53A146606A48LLU }, //5^-258
+        { 0x99C102844F94E0FBLLU, 0x2EDA7444CBFC426DLLU }, //5^-257
+        { 0xC0314325637A1939LLU, 0xFA911155FEFB5308LLU }, //5^-256
+        { 0xF03D93EEBC589F88LLU, 0x793555AB7EBA27CALLU }, //5^-255
+        { 0x96267C7535B763B5LLU, 0x4BC1558B2F3458DELLU }, //5^-254
+        { 0xBBB01B9283253CA2LLU, 0x9EB1AAEDFB016F16LLU }, //5^-253
+        { 0xEA9C227723EE8BCBLLU, 0x465E15A979C1CADCLLU }, //5^-252
+        { 0x92A1958A7675175FLLU, 0x0BFACD89EC191EC9LLU }, //5^-251
+        { 0xB749FAED14125D36LLU, 0xCEF980EC671F667BLLU }, //5^-250
+        { 0xE51C79A85916F484LLU, 0x82B7E12780E7401ALLU }, //5^-249
+        { 0x8F31CC0937AE58D2LLU, 0xD1B2ECB8B0908810LLU }, //5^-248
+        { 0xB2FE3F0B8599EF07LLU, 0x861FA7E6DCB4AA15LLU }, //5^-247
+        { 0xDFBDCECE67006AC9LLU, 0x67A791E093E1D49ALLU }, //5^-246
+        { 0x8BD6A141006042BDLLU, 0xE0C8BB2C5C6D24E0LLU }, //5^-245
+        { 0xAECC49914078536DLLU, 0x58FAE9F773886E18LLU }, //5^-244
+        { 0xDA7F5BF590966848LLU, 0xAF39A475506A899ELLU }, //5^-243
+        { 0x888F99797A5E012DLLU, 0x6D8406C952429603LLU }, //5^-242
+        { 0xAAB37FD7D8F58178LLU, 0xC8E5087BA6D33B83LLU }, //5^-241
+        { 0xD5605FCDCF32E1D6LLU, 0xFB1E4A9A90880A64LLU }, //5^-240
+        { 0x855C3BE0A17FCD26LLU, 0x5CF2EEA09A55067FLLU }, //5^-239
+        { 0xA6B34AD8C9DFC06FLLU, 0xF42FAA48C0EA481ELLU }, //5^-238
+        { 0xD0601D8EFC57B08BLLU, 0xF13B94DAF124DA26LLU }, //5^-237
+        { 0x823C12795DB6CE57LLU, 0x76C53D08D6B70858LLU }, //5^-236
+        { 0xA2CB1717B52481EDLLU, 0x54768C4B0C64CA6ELLU }, //5^-235
+        { 0xCB7DDCDDA26DA268LLU, 0xA9942F5DCF7DFD09LLU }, //5^-234
+        { 0xFE5D54150B090B02LLU, 0xD3F93B35435D7C4CLLU }, //5^-233
+        { 0x9EFA548D26E5A6E1LLU, 0xC47BC5014A1A6DAFLLU }, //5^-232
+        { 0xC6B8E9B0709F109ALLU, 0x359AB6419CA1091BLLU }, //5^-231
+        { 0xF867241C8CC6D4C0LLU, 0xC30163D203C94B62LLU }, //5^-230
+        { 0x9B407691D7FC44F8LLU, 0x79E0DE63425DCF1DLLU }, //5^-229
+        { 0xC21094364DFB5636LLU, 0x985915FC12F542E4LLU }, //5^-228
+        { 0xF294B943E17A2BC4LLU, 0x3E6F5B7B17B2939DLLU }, //5^-227
+        { 0x979CF3CA6CEC5B5ALLU, 0xA705992CEECF9C42LLU }, //5^-226
+        { 0xBD8430BD08277231LLU, 0x50C6FF782A838353LLU }, //5^-225
+        { 0xECE53CEC4A314EBDLLU, 0xA4F8BF5635246428LLU }, //5^-224
+        { 0x940F4613AE5ED136LLU, 0x871B7795E136BE99LLU }, //5^-223
+        { 0xB913179899F68584LLU, 0x28E2557B59846E3FLLU }, //5^-222
+        { 0xE757DD7EC07426E5LLU, 0x331AEADA2FE589CFLLU }, //5^-221
+        { 0x9096EA6F3848984FLLU, 0x3FF0D2C85DEF7621LLU }, //5^-220
+        { 0xB4BCA50B065ABE63LLU, 0x0FED077A756B53A9LLU }, //5^-219
+        { 0xE1EBCE4DC7F16DFBLLU, 0xD3E8495912C62894LLU }, //5^-218
+        { 0x8D3360F09CF6E4BDLLU, 0x64712DD7ABBBD95CLLU }, //5^-217
+        { 0xB080392CC4349DECLLU, 0xBD8D794D96AACFB3LLU }, //5^-216
+        { 0xDCA04777F541C567LLU, 0xECF0D7A0FC5583A0LLU }, //5^-215
+        { 0x89E42CAAF9491B60LLU, 0xF41686C49DB57244LLU }, //5^-214
+        { 0xAC5D37D5B79B6239LLU, 0x311C2875C522CED5LLU }, //5^-213
+        { 0xD77485CB25823AC7LLU, 0x7D633293366B828BLLU }, //5^-212
+        { 0x86A8D39EF77164BCLLU, 0xAE5DFF9C02033197LLU }, //5^-211
+        { 0xA8530886B54DBDEBLLU, 0xD9F57F830283FDFCLLU }, //5^-210
+        { 0xD267CAA862A12D66LLU, 0xD072DF63C324FD7BLLU }, //5^-209
+        { 0x8380DEA93DA4BC60LLU, 0x4247CB9E59F71E6DLLU }, //5^-208
+        { 0xA46116538D0DEB78LLU, 0x52D9BE85F074E608LLU }, //5^-207
+        { 0xCD795BE870516656LLU, 0x67902E276C921F8BLLU }, //5^-206
+        { 0x806BD9714632DFF6LLU, 0x00BA1CD8A3DB53B6LLU }, //5^-205
+        { 0xA086CFCD97BF97F3LLU, 0x80E8A40ECCD228A4LLU }, //5^-204
+        { 0xC8A883C0FDAF7DF0LLU, 0x6122CD128006B2CDLLU }, //5^-203
+        { 0xFAD2A4B13D1B5D6CLLU, 0x796B805720085F81LLU }, //5^-202
+        { 0x9CC3A6EEC6311A63LLU, 0xCBE3303674053BB0LLU }, //5^-201
+        { 0xC3F490AA77BD60FCLLU, 0xBEDBFC4411068A9CLLU }, //5^-200
+        { 0xF4F1B4D515ACB93BLLU, 0xEE92FB5515482D44LLU }, //5^-199
+        { 0x991711052D8BF3C5LLU, 0x751BDD152D4D1C4ALLU }, //5^-198
+        { 0xBF5CD54678EEF0B6LLU, 0xD262D45A78A0635DLLU }, //5^-197
+        { 0xEF340A98172AACE4LLU, 0x86FB897116C87C34LLU }, //5^-196
+        { 0x9580869F0E7AAC0ELLU, 0xD45D35E6AE3D4DA0LLU }, //5^-195
+        { 0xBAE0A846D2195712LLU, 0x8974836059CCA109LLU }, //5^-194
+        { 0xE998D258869FACD7LLU, 0x2BD1A438703FC94BLLU }, //5^-193
+        { 0x91FF83775423CC06LLU, 0x7B6306A34627DDCFLLU }, //5^-192
+        { 0xB67F6455292CBF08LLU, 0x1A3BC84C17B1D542LLU }, //5^-191
+        { 0xE41F3D6A7377EECALLU, 0x20CABA5F1D9E4A93LLU }, //5^-190
+        { 0x8E938662882AF53ELLU, 0x547EB47B7282EE9CLLU }, //5^-189
+        { 0xB23867FB2A35B28DLLU, 0xE99E619A4F23AA43LLU }, //5^-188
+        { 0xDEC681F9F4C31F31LLU, 0x6405FA00E2EC94D4LLU }, //5^-187
+        { 0x8B3C113C38F9F37ELLU, 0xDE83BC408DD3DD04LLU }, //5^-186
+        { 0xAE0B158B4738705ELLU, 0x9624AB50B148D445LLU }, //5^-185
+        { 0xD98DDAEE19068C76LLU, 0x3BADD624DD9B0957LLU }, //5^-184
+        { 0x87F8A8D4CFA417C9LLU, 0xE54CA5D70A80E5D6LLU }, //5^-183
+        { 0xA9F6D30A038D1DBCLLU, 0x5E9FCF4CCD211F4CLLU }, //5^-182
+        { 0xD47487CC8470652BLLU, 0x7647C3200069671FLLU }, //5^-181
+        { 0x84C8D4DFD2C63F3BLLU, 0x29ECD9F40041E073LLU }, //5^-180
+        { 0xA5FB0A17C777CF09LLU, 0xF468107100525890LLU }, //5^-179
+        { 0xCF79CC9DB955C2CCLLU, 0x7182148D4066EEB4LLU }, //5^-178
+        { 0x81AC1FE293D599BFLLU, 0xC6F14CD848405530LLU }, //5^-177
+        { 0xA21727DB38CB002FLLU, 0xB8ADA00E5A506A7CLLU }, //5^-176
+        { 0xCA9CF1D206FDC03BLLU, 0xA6D90811F0E4851CLLU }, //5^-175
+        { 0xFD442E4688BD304ALLU, 0x908F4A166D1DA663LLU }, //5^-174
+        { 0x9E4A9CEC15763E2ELLU, 0x9A598E4E043287FELLU }, //5^-173
+        { 0xC5DD44271AD3CDBALLU, 0x40EFF1E1853F29FDLLU }, //5^-172
+        { 0xF7549530E188C128LLU, 0xD12BEE59E68EF47CLLU }, //5^-171
+        { 0x9A94DD3E8CF578B9LLU, 0x82BB74F8301958CELLU }, //5^-170
+        { 0xC13A148E3032D6E7LLU, 0xE36A52363C1FAF01LLU }, //5^-169
+        { 0xF18899B1BC3F8CA1LLU, 0xDC44E6C3CB279AC1LLU }, //5^-168
+        { 0x96F5600F15A7B7E5LLU, 0x29AB103A5EF8C0B9LLU }, //5^-167
+        { 0xBCB2B812DB11A5DELLU, 0x7415D448F6B6F0E7LLU }, //5^-166
+        { 0xEBDF661791D60F56LLU, 0x111B495B3464AD21LLU }, //5^-165
+        { 0x936B9FCEBB25C995LLU, 0xCAB10DD900BEEC34LLU }, //5^-164
+        { 0xB84687C269EF3BFBLLU, 0x3D5D514F40EEA742LLU }, //5^-163
+        { 0xE65829B3046B0AFALLU, 0x0CB4A5A3112A5112LLU }, //5^-162
+        { 0x8FF71A0FE2C2E6DCLLU, 0x47F0E785EABA72ABLLU }, //5^-161
+        { 0xB3F4E093DB73A093LLU, 0x59ED216765690F56LLU }, //5^-160
+        { 0xE0F218B8D25088B8LLU, 0x306869C13EC3532CLLU }, //5^-159
+        { 0x8C974F7383725573LLU, 0x1E414218C73A13FBLLU }, //5^-158
+        { 0xAFBD2350644EEACFLLU, 0xE5D1929EF90898FALLU }, //5^-157
+        { 0xDBAC6C247D62A583LLU, 0xDF45F746B74ABF39LLU }, //5^-156
+        { 0x894BC396CE5DA772LLU, 0x6B8BBA8C328EB783LLU }, //5^-155
+        { 0xAB9EB47C81F5114FLLU, 0x066EA92F3F326564LLU }, //5^-154
+        { 0xD686619BA27255A2LLU, 0xC80A537B0EFEFEBDLLU }, //5^-153
+        { 0x8613FD0145877585LLU, 0xBD06742CE95F5F36LLU }, //5^-152
+        { 0xA798FC4196E952E7LLU, 0x2C48113823B73704LLU }, //5^-151
+        { 0xD17F3B51FCA3A7A0LLU, 0xF75A15862CA504C5LLU }, //5^-150
+        { 0x82EF85133DE648C4LLU, 0x9A984D73DBE722FBLLU }, //5^-149
+        { 0xA3AB66580D5FDAF5LLU, 0xC13E60D0D2E0EBBALLU }, //5^-148
+        { 0xCC963FEE10B7D1B3LLU, 0x318DF905079926A8LLU }, //5^-147
+        { 0xFFBBCFE994E5C61FLLU, 0xFDF17746497F7052LLU }, //5^-146
+        { 0x9FD561F1FD0F9BD3LLU, 0xFEB6EA8BEDEFA633LLU }, //5^-145
+        { 0xC7CABA6E7C5382C8LLU, 0xFE64A52EE96B8FC0LLU }, //5^-144
+        { 0xF9BD690A1B68637BLLU, 0x3DFDCE7AA3C673B0LLU }, //5^-143
+        { 0x9C1661A651213E2DLLU, 0x06BEA10CA65C084ELLU }, //5^-142
+        { 0xC31BFA0FE5698DB8LLU, 0x486E494FCFF30A62LLU }, //5^-141
+        { 0xF3E2F893DEC3F126LLU, 0x5A89DBA3C3EFCCFALLU }, //5^-140
+        { 0x986DDB5C6B3A76B7LLU, 0xF89629465A75E01CLLU }, //5^-139
+        { 0xBE89523386091465LLU, 0xF6BBB397F1135823LLU }, //5^-138
+        { 0xEE2BA6C0678B597FLLU, 0x746AA07DED582E2CLLU }, //5^-137
+        { 0x94DB483840B717EFLLU, 0xA8C2A44EB4571CDCLLU }, //5^-136
+        { 0xBA121A4650E4DDEBLLU, 0x92F34D62616CE413LLU }, //5^-135
+        { 0xE896A0D7E51E1566LLU, 0x77B020BAF9C81D17LLU }, //5^-134
+        { 0x915E2486EF32CD60LLU, 0x0ACE1474DC1D122ELLU }, //5^-133
+        { 0xB5B5ADA8AAFF80B8LLU, 0x0D819992132456BALLU }, //5^-132
+        { 0xE3231912D5BF60E6LLU, 0x10E1FFF697ED6C69LLU }, //5^-131
+        { 0x8DF5EFABC5979C8FLLU, 0xCA8D3FFA1EF463C1LLU }, //5^-130
+        { 0xB1736B96B6FD83B3LLU, 0xBD308FF8A6B17CB2LLU }, //5^-129
+        { 0xDDD0467C64BCE4A0LLU, 0xAC7CB3F6D05DDBDELLU }, //5^-128
+        { 0x8AA22C0DBEF60EE4LLU, 0x6BCDF07A423AA96BLLU }, //5^-127
+        { 0xAD4AB7112EB3929DLLU, 0x86C16C98D2C953C6LLU }, //5^-126
+        { 0xD89D64D57A607744LLU, 0xE871C7BF077BA8B7LLU }, //5^-125
+        { 0x87625F056C7C4A8BLLU, 0x11471CD764AD4972LLU }, //5^-124
+        { 0xA93AF6C6C79B5D2DLLU, 0xD598E40D3DD89BCFLLU }, //5^-123
+        { 0xD389B47879823479LLU, 0x4AFF1D108D4EC2C3LLU }, //5^-122
+        { 0x843610CB4BF160CBLLU, 0xCEDF722A585139BALLU }, //5^-121
+        { 0xA54394FE1EEDB8FELLU, 0xC2974EB4EE658828LLU }, //5^-120
+        { 0xCE947A3DA6A9273ELLU, 0x733D226229FEEA32LLU }, //5^-119
+        { 0x811CCC668829B887LLU, 0x0806357D5A3F525FLLU }, //5^-118
+        { 0xA163FF802A3426A8LLU, 0xCA07C2DCB0CF26F7LLU }, //5^-117
+        { 0xC9BCFF6034C13052LLU, 0xFC89B393DD02F0B5LLU }, //5^-116
+        { 0xFC2C3F3841F17C67LLU, 0xBBAC2078D443ACE2LLU }, //5^-115
+        { 0x9D9BA7832936EDC0LLU, 0xD54B944B84AA4C0DLLU }, //5^-114
+        { 0xC5029163F384A931LLU, 0x0A9E795E65D4DF11LLU }, //5^-113
+        { 0xF64335BCF065D37DLLU, 0x4D4617B5FF4A16D5LLU }, //5^-112
+        { 0x99EA0196163FA42ELLU, 0x504BCED1BF8E4E45LLU }, //5^-111
+        { 0xC06481FB9BCF8D39LLU, 0xE45EC2862F71E1D6LLU }, //5^-110
+        { 0xF07DA27A82C37088LLU, 0x5D767327BB4E5A4CLLU }, //5^-109
+        { 0x964E858C91BA2655LLU, 0x3A6A07F8D510F86FLLU }, //5^-108
+        { 0xBBE226EFB628AFEALLU, 0x890489F70A55368BLLU }, //5^-107
+        { 0xEADAB0ABA3B2DBE5LLU, 0x2B45AC74CCEA842ELLU }, //5^-106
+        { 0x92C8AE6B464FC96FLLU, 0x3B0B8BC90012929DLLU }, //5^-105
+        { 0xB77ADA0617E3BBCBLLU, 0x09CE6EBB40173744LLU }, //5^-104
+        { 0xE55990879DDCAABDLLU, 0xCC420A6A101D0515LLU }, //5^-103
+        { 0x8F57FA54C2A9EAB6LLU, 0x9FA946824A12232DLLU }, //5^-102
+        { 0xB32DF8E9F3546564LLU, 0x47939822DC96ABF9LLU }, //5^-101
+        { 0xDFF9772470297EBDLLU, 0x59787E2B93BC56F7LLU }, //5^-100
+        { 0x8BFBEA76C619EF36LLU, 0x57EB4EDB3C55B65ALLU }, //5^-99
+        { 0xAEFAE51477A06B03LLU, 0xEDE622920B6B23F1LLU }, //5^-98
+        { 0xDAB99E59958885C4LLU, 0xE95FAB368E45ECEDLLU }, //5^-97
+        { 0x88B402F7FD75539BLLU, 0x11DBCB0218EBB414LLU }, //5^-96
+        { 0xAAE103B5FCD2A881LLU, 0xD652BDC29F26A119LLU }, //5^-95
+        { 0xD59944A37C0752A2LLU, 0x4BE76D3346F0495FLLU }, //5^-94
+        { 0x857FCAE62D8493A5LLU, 0x6F70A4400C562DDBLLU }, //5^-93
+        { 0xA6DFBD9FB8E5B88ELLU, 0xCB4CCD500F6BB952LLU }, //5^-92
+        { 0xD097AD07A71F26B2LLU, 0x7E2000A41346A7A7LLU }, //5^-91
+        { 0x825ECC24C873782FLLU, 0x8ED400668C0C28C8LLU }, //5^-90
+        { 0xA2F67F2DFA90563BLLU, 0x728900802F0F32FALLU }, //5^-89
+        { 0xCBB41EF979346BCALLU, 0x4F2B40A03AD2FFB9LLU }, //5^-88
+        { 0xFEA126B7D78186BCLLU, 0xE2F610C84987BFA8LLU }, //5^-87
+        { 0x9F24B832E6B0F436LLU, 0x0DD9CA7D2DF4D7C9LLU }, //5^-86
+        { 0xC6EDE63FA05D3143LLU, 0x91503D1C79720DBBLLU }, //5^-85
+        { 0xF8A95FCF88747D94LLU, 0x75A44C6397CE912ALLU }, //5^-84
+        { 0x9B69DBE1B548CE7CLLU, 0xC986AFBE3EE11ABALLU }, //5^-83
+        { 0xC24452DA229B021BLLU, 0xFBE85BADCE996168LLU }, //5^-82
+        { 0xF2D56790AB41C2A2LLU, 0xFAE27299423FB9C3LLU }, //5^-81
+        { 0x97C560BA6B0919A5LLU, 0xDCCD879FC967D41ALLU }, //5^-80
+        { 0xBDB6B8E905CB600FLLU, 0x5400E987BBC1C920LLU }, //5^-79
+        { 0xED246723473E3813LLU, 0x290123E9AAB23B68LLU }, //5^-78
+        { 0x9436C0760C86E30BLLU, 0xF9A0B6720AAF6521LLU }, //5^-77
+        { 0xB94470938FA89BCELLU, 0xF808E40E8D5B3E69LLU }, //5^-76
+        { 0xE7958CB87392C2C2LLU, 0xB60B1D1230B20E04LLU }, //5^-75
+        { 0x90BD77F3483BB9B9LLU, 0xB1C6F22B5E6F48C2LLU }, //5^-74
+        { 0xB4ECD5F01A4AA828LLU, 0x1E38AEB6360B1AF3LLU }, //5^-73
+        { 0xE2280B6C20DD5232LLU, 0x25C6DA63C38DE1B0LLU }, //5^-72
+        { 0x8D590723948A535FLLU, 0x579C487E5A38AD0ELLU }, //5^-71
+        { 0xB0AF48EC79ACE837LLU, 0x2D835A9DF0C6D851LLU }, //5^-70
+        { 0xDCDB1B2798182244LLU, 0xF8E431456CF88E65LLU }, //5^-69
+        { 0x8A08F0F8BF0F156BLLU, 0x1B8E9ECB641B58FFLLU }, //5^-68
+        { 0xAC8B2D36EED2DAC5LLU, 0xE272467E3D222F3FLLU }, //5^-67
+        { 0xD7ADF884AA879177LLU, 0x5B0ED81DCC6ABB0FLLU }, //5^-66
+        { 0x86CCBB52EA94BAEALLU, 0x98E947129FC2B4E9LLU }, //5^-65
+        { 0xA87FEA27A539E9A5LLU, 0x3F2398D747B36224LLU }, //5^-64
+        { 0xD29FE4B18E88640ELLU, 0x8EEC7F0D19A03AADLLU }, //5^-63
+        { 0x83A3EEEEF9153E89LLU, 0x1953CF68300424ACLLU }, //5^-62
+        { 0xA48CEAAAB75A8E2BLLU, 0x5FA8C3423C052DD7LLU }, //5^-61
+        { 0xCDB02555653131B6LLU, 0x3792F412CB06794DLLU }, //5^-60
+        { 0x808E17555F3EBF11LLU, 0xE2BBD88BBEE40BD0LLU }, //5^-59
+        { 0xA0B19D2AB70E6ED6LLU, 0x5B6ACEAEAE9D0EC4LLU }, //5^-58
+        { 0xC8DE047564D20A8BLLU, 0xF245825A5A445275LLU }, //5^-57
+        { 0xFB158592BE068D2ELLU, 0xEED6E2F0F0D56712LLU }, //5^-56
+        { 0x9CED737BB6C4183DLLU, 0x55464DD69685606BLLU }, //5^-55
+        { 0xC428D05AA4751E4CLLU, 0xAA97E14C3C26B886LLU }, //5^-54
+        { 0xF53304714D9265DFLLU, 0xD53DD99F4B3066A8LLU }, //5^-53
+        { 0x993FE2C6D07B7FABLLU, 0xE546A8038EFE4029LLU }, //5^-52
+        { 0xBF8FDB78849A5F96LLU, 0xDE98520472BDD033LLU }, //5^-51
+        { 0xEF73D256A5C0F77CLLU, 0x963E66858F6D4440LLU }, //5^-50
+        { 0x95A8637627989AADLLU, 0xDDE7001379A44AA8LLU }, //5^-49
+        { 0xBB127C53B17EC159LLU, 0x5560C018580D5D52LLU }, //5^-48
+        { 0xE9D71B689DDE71AFLLU, 0xAAB8F01E6E10B4A6LLU }, //5^-47
+        { 0x9226712162AB070DLLU, 0xCAB3961304CA70E8LLU }, //5^-46
+        { 0xB6B00D69BB55C8D1LLU, 0x3D607B97C5FD0D22LLU }, //5^-45
+        { 0xE45C10C42A2B3B05LLU, 0x8CB89A7DB77C506ALLU }, //5^-44
+        { 0x8EB98A7A9A5B04E3LLU, 0x77F3608E92ADB242LLU }, //5^-43
+        { 0xB267ED1940F1C61CLLU, 0x55F038B237591ED3LLU }, //5^-42
+        { 0xDF01E85F912E37A3LLU, 0x6B6C46DEC52F6688LLU }, //5^-41
+        { 0x8B61313BBABCE2C6LLU, 0x2323AC4B3B3DA015LLU }, //5^-40
+        { 0xAE397D8AA96C1B77LLU, 0xABEC975E0A0D081ALLU }, //5^-39
+        { 0xD9C7DCED53C72255LLU, 0x96E7BD358C904A21LLU }, //5^-38
+        { 0x881CEA14545C7575LLU, 0x7E50D64177DA2E54LLU }, //5^-37
+        { 0xAA242499697392D2LLU, 0xDDE50BD1D5D0B9E9LLU }, //5^-36
+        { 0xD4AD2DBFC3D07787LLU, 0x955E4EC64B44E864LLU }, //5^-35
+        { 0x84EC3C97DA624AB4LLU, 0xBD5AF13BEF0B113ELLU }, //5^-34
+        { 0xA6274BBDD0FADD61LLU, 0xECB1AD8AEACDD58ELLU }, //5^-33
+        { 0xCFB11EAD453994BALLU, 0x67DE18EDA5814AF2LLU }, //5^-32
+        { 0x81CEB32C4B43FCF4LLU, 0x80EACF948770CED7LLU }, //5^-31
+        { 0xA2425FF75E14FC31LLU, 0xA1258379A94D028DLLU }, //5^-30
+        { 0xCAD2F7F5359A3B3ELLU, 0x096EE45813A04330LLU }, //5^-29
+        { 0xFD87B5F28300CA0DLLU, 0x8BCA9D6E188853FCLLU }, //5^-28
+        { 0x9E74D1B791E07E48LLU, 0x775EA264CF55347ELLU }, //5^-27
+        { 0xC612062576589DDALLU, 0x95364AFE032A819ELLU }, //5^-26
+        { 0xF79687AED3EEC551LLU, 0x3A83DDBD83F52205LLU }, //5^-25
+        { 0x9ABE14CD44753B52LLU, 0xC4926A9672793543LLU }, //5^-24
+        { 0xC16D9A0095928A27LLU, 0x75B7053C0F178294LLU }, //5^-23
+        { 0xF1C90080BAF72CB1LLU, 0x5324C68B12DD6339LLU }, //5^-22
+        { 0x971DA05074DA7BEELLU, 0xD3F6FC16EBCA5E04LLU }, //5^-21
+        { 0xBCE5086492111AEALLU, 0x88F4BB1CA6BCF585LLU }, //5^-20
+        { 0xEC1E4A7DB69561A5LLU, 0x2B31E9E3D06C32E6LLU }, //5^-19
+        { 0x9392EE8E921D5D07LLU, 0x3AFF322E62439FD0LLU }, //5^-18
+        { 0xB877AA3236A4B449LLU, 0x09BEFEB9FAD487C3LLU }, //5^-17
+        { 0xE69594BEC44DE15BLLU, 0x4C2EBE687989A9B4LLU }, //5^-16
+        { 0x901D7CF73AB0ACD9LLU, 0x0F9D37014BF60A11LLU }, //5^-15
+        { 0xB424DC35095CD80FLLU, 0x538484C19EF38C95LLU }, //5^-14
+        { 0xE12E13424BB40E13LLU, 0x2865A5F206B06FBALLU }, //5^-13
+        { 0x8CBCCC096F5088CBLLU, 0xF93F87B7442E45D4LLU }, //5^-12
+        { 0xAFEBFF0BCB24AAFELLU, 0xF78F69A51539D749LLU }, //5^-11
+        { 0xDBE6FECEBDEDD5BELLU, 0xB573440E5A884D1CLLU }, //5^-10
+        { 0x89705F4136B4A597LLU, 0x31680A88F8953031LLU }, //5^-9
+        { 0xABCC77118461CEFCLLU, 0xFDC20D2B36BA7C3ELLU }, //5^-8
+        { 0xD6BF94D5E57A42BCLLU, 0x3D32907604691B4DLLU }, //5^-7
+        { 0x8637BD05AF6C69B5LLU, 0xA63F9A49C2C1B110LLU }, //5^-6
+        { 0xA7C5AC471B478423LLU, 0x0FCF80DC33721D54LLU }, //5^-5
+        { 0xD1B71758E219652BLLU, 0xD3C36113404EA4A9LLU }, //5^-4
+        { 0x83126E978D4FDF3BLLU, 0x645A1CAC083126EALLU }, //5^-3
+        { 0xA3D70A3D70A3D70ALLU, 0x3D70A3D70A3D70A4LLU }, //5^-2
+        { 0xCCCCCCCCCCCCCCCCLLU, 0xCCCCCCCCCCCCCCCDLLU }, //5^-1
+        { 0x8000000000000000LLU, 0x0000000000000000LLU }, //5^0
+        { 0xA000000000000000LLU, 0x0000000000000000LLU }, //5^1
+        { 0xC800000000000000LLU, 0x0000000000000000LLU }, //5^2
+        { 0xFA00000000000000LLU, 0x0000000000000000LLU }, //5^3
+        { 0x9C40000000000000LLU, 0x0000000000000000LLU }, //5^4
+        { 0xC350000000000000LLU, 0x0000000000000000LLU }, //5^5
+        { 0xF424000000000000LLU, 0x0000000000000000LLU }, //5^6
+        { 0x9896800000000000LLU, 0x0000000000000000LLU }, //5^7
+        { 0xBEBC200000000000LLU, 0x0000000000000000LLU }, //5^8
+        { 0xEE6B280000000000LLU, 0x0000000000000000LLU }, //5^9
+        { 0x9502F90000000000LLU, 0x0000000000000000LLU }, //5^10
+        { 0xBA43B74000000000LLU, 0x0000000000000000LLU }, //5^11
+        { 0xE8D4A51000000000LLU, 0x0000000000000000LLU }, //5^12
+        { 0x9184E72A00000000LLU, 0x0000000000000000LLU }, //5^13
+        { 0xB5E620F480000000LLU, 0x0000000000000000LLU }, //5^14
+        { 0xE35FA931A0000000LLU, 0x0000000000000000LLU }, //5^15
+        { 0x8E1BC9BF04000000LLU, 0x0000000000000000LLU }, //5^16
+        { 0xB1A2BC2EC5000000LLU, 0x0000000000000000LLU }, //5^17
+        { 0xDE0B6B3A76400000LLU, 0x0000000000000000LLU }, //5^18
+        { 0x8AC7230489E80000LLU, 0x0000000000000000LLU }, //5^19
+        { 0xAD78EBC5AC620000LLU, 0x0000000000000000LLU }, //5^20
+        { 0xD8D726B7177A8000LLU, 0x0000000000000000LLU }, //5^21
+        { 0x878678326EAC9000LLU, 0x0000000000000000LLU }, //5^22
+        { 0xA968163F0A57B400LLU, 0x0000000000000000LLU }, //5^23
+        { 0xD3C21BCECCEDA100LLU, 0x0000000000000000LLU }, //5^24
+        { 0x84595161401484A0LLU, 0x0000000000000000LLU }, //5^25
+        { 0xA56FA5B99019A5C8LLU, 0x0000000000000000LLU }, //5^26
+        { 0xCECB8F27F4200F3ALLU, 0x0000000000000000LLU }, //5^27
+        { 0x813F3978F8940984LLU, 0x4000000000000000LLU }, //5^28
+        { 0xA18F07D736B90BE5LLU, 0x5000000000000000LLU }, //5^29
+        { 0xC9F2C9CD04674EDELLU, 0xA400000000000000LLU }, //5^30
+        { 0xFC6F7C4045812296LLU, 0x4D00000000000000LLU }, //5^31
+        { 0x9DC5ADA82B70B59DLLU, 0xF020000000000000LLU }, //5^32
+        { 0xC5371912364CE305LLU, 0x6C28000000000000LLU }, //5^33
+        { 0xF684DF56C3E01BC6LLU, 0xC732000000000000LLU }, //5^34
+        { 0x9A130B963A6C115CLLU, 0x3C7F400000000000LLU }, //5^35
+        { 0xC097CE7BC90715B3LLU, 0x4B9F100000000000LLU }, //5^36
+        { 0xF0BDC21ABB48DB20LLU, 0x1E86D40000000000LLU }, //5^37
+        { 0x96769950B50D88F4LLU, 0x1314448000000000LLU }, //5^38
+        { 0xBC143FA4E250EB31LLU, 0x17D955A000000000LLU }, //5^39
+        { 0xEB194F8E1AE525FDLLU, 0x5DCFAB0800000000LLU }, //5^40
+        { 0x92EFD1B8D0CF37BELLU, 0x5AA1CAE500000000LLU }, //5^41
+        { 0xB7ABC627050305ADLLU, 0xF14A3D9E40000000LLU }, //5^42
+        { 0xE596B7B0C643C719LLU, 0x6D9CCD05D0000000LLU }, //5^43
+        { 0x8F7E32CE7BEA5C6FLLU, 0xE4820023A2000000LLU }, //5^44
+        { 0xB35DBF821AE4F38BLLU, 0xDDA2802C8A800000LLU }, //5^45
+        { 0xE0352F62A19E306ELLU, 0xD50B2037AD200000LLU }, //5^46
+        { 0x8C213D9DA502DE45LLU, 0x4526F422CC340000LLU }, //5^47
+        { 0xAF298D050E4395D6LLU, 0x9670B12B7F410000LLU }, //5^48
+        { 0xDAF3F04651D47B4CLLU, 0x3C0CDD765F114000LLU }, //5^49
+        { 0x88D8762BF324CD0FLLU, 0xA5880A69FB6AC800LLU }, //5^50
+        { 0xAB0E93B6EFEE0053LLU, 0x8EEA0D047A457A00LLU }, //5^51
+        { 0xD5D238A4ABE98068LLU, 0x72A4904598D6D880LLU }, //5^52
+        { 0x85A36366EB71F041LLU, 0x47A6DA2B7F864750LLU }, //5^53
+        { 0xA70C3C40A64E6C51LLU, 0x999090B65F67D924LLU }, //5^54
+        { 0xD0CF4B50CFE20765LLU, 0xFFF4B4E3F741CF6DLLU }, //5^55
+        { 0x82818F1281ED449FLLU, 0xBFF8F10E7A8921A4LLU }, //5^56
+        { 0xA321F2D7226895C7LLU, 0xAFF72D52192B6A0DLLU }, //5^57
+        { 0xCBEA6F8CEB02BB39LLU, 0x9BF4F8A69F764490LLU }, //5^58
+        { 0xFEE50B7025C36A08LLU, 0x02F236D04753D5B4LLU }, //5^59
+        { 0x9F4F2726179A2245LLU, 0x01D762422C946590LLU }, //5^60
+        { 0xC722F0EF9D80AAD6LLU, 0x424D3AD2B7B97EF5LLU }, //5^61
+        { 0xF8EBAD2B84E0D58BLLU, 0xD2E0898765A7DEB2LLU }, //5^62
+        { 0x9B934C3B330C8577LLU, 0x63CC55F49F88EB2FLLU }, //5^63
+        { 0xC2781F49FFCFA6D5LLU, 0x3CBF6B71C76B25FBLLU }, //5^64
+        { 0xF316271C7FC3908ALLU, 0x8BEF464E3945EF7ALLU }, //5^65
+        { 0x97EDD871CFDA3A56LLU, 0x97758BF0E3CBB5ACLLU }, //5^66
+        { 0xBDE94E8E43D0C8ECLLU, 0x3D52EEED1CBEA317LLU }, //5^67
+        { 0xED63A231D4C4FB27LLU, 0x4CA7AAA863EE4BDDLLU }, //5^68
+        { 0x945E455F24FB1CF8LLU, 0x8FE8CAA93E74EF6ALLU }, //5^69
+        { 0xB975D6B6EE39E436LLU, 0xB3E2FD538E122B44LLU }, //5^70
+        { 0xE7D34C64A9C85D44LLU, 0x60DBBCA87196B616LLU }, //5^71
+        { 0x90E40FBEEA1D3A4ALLU, 0xBC8955E946FE31CDLLU }, //5^72
+        { 0xB51D13AEA4A488DDLLU, 0x6BABAB6398BDBE41LLU }, //5^73
+        { 0xE264589A4DCDAB14LLU, 0xC696963C7EED2DD1LLU }, //5^74
+        { 0x8D7EB76070A08AECLLU, 0xFC1E1DE5CF543CA2LLU }, //5^75
+        { 0xB0DE65388CC8ADA8LLU, 0x3B25A55F43294BCBLLU }, //5^76
+        { 0xDD15FE86AFFAD912LLU, 0x49EF0EB713F39EBELLU }, //5^77
+        { 0x8A2DBF142DFCC7ABLLU, 0x6E3569326C784337LLU }, //5^78
+        { 0xACB92ED9397BF996LLU, 0x49C2C37F07965404LLU }, //5^79
+        { 0xD7E77A8F87DAF7FBLLU, 0xDC33745EC97BE906LLU }, //5^80
+        { 0x86F0AC99B4E8DAFDLLU, 0x69A028BB3DED71A3LLU }, //5^81
+        { 0xA8ACD7C0222311BCLLU, 0xC40832EA0D68CE0CLLU }, //5^82
+        { 0xD2D80DB02AABD62BLLU, 0xF50A3FA490C30190LLU }, //5^83
+        { 0x83C7088E1AAB65DBLLU, 0x792667C6DA79E0FALLU }, //5^84
+        { 0xA4B8CAB1A1563F52LLU, 0x577001B891185938LLU }, //5^85
+        { 0xCDE6FD5E09ABCF26LLU, 0xED4C0226B55E6F86LLU }, //5^86
+        { 0x80B05E5AC60B6178LLU, 0x544F8158315B05B4LLU }, //5^87
+        { 0xA0DC75F1778E39D6LLU, 0x696361AE3DB1C721LLU }, //5^88
+        { 0xC913936DD571C84CLLU, 0x03BC3A19CD1E38E9LLU }, //5^89
+        { 0xFB5878494ACE3A5FLLU, 0x04AB48A04065C723LLU }, //5^90
+        { 0x9D174B2DCEC0E47BLLU, 0x62EB0D64283F9C76LLU }, //5^91
+        { 0xC45D1DF942711D9ALLU, 0x3BA5D0BD324F8394LLU }, //5^92
+        { 0xF5746577930D6500LLU, 0xCA8F44EC7EE36479LLU }, //5^93
+        { 0x9968BF6ABBE85F20LLU, 0x7E998B13CF4E1ECBLLU }, //5^94
+        { 0xBFC2EF456AE276E8LLU, 0x9E3FEDD8C321A67ELLU }, //5^95
+        { 0xEFB3AB16C59B14A2LLU, 0xC5CFE94EF3EA101ELLU }, //5^96
+        { 0x95D04AEE3B80ECE5LLU, 0xBBA1F1D158724A12LLU }, //5^97
+        { 0xBB445DA9CA61281FLLU, 0x2A8A6E45AE8EDC97LLU }, //5^98
+        { 0xEA1575143CF97226LLU, 0xF52D09D71A3293BDLLU }, //5^99
+        { 0x924D692CA61BE758LLU, 0x593C2626705F9C56LLU }, //5^100
+        { 0xB6E0C377CFA2E12ELLU, 0x6F8B2FB00C77836CLLU }, //5^101
+        { 0xE498F455C38B997ALLU, 0x0B6DFB9C0F956447LLU }, //5^102
+        { 0x8EDF98B59A373FECLLU, 0x4724BD4189BD5EACLLU }, //5^103
+        { 0xB2977EE300C50FE7LLU, 0x58EDEC91EC2CB657LLU }, //5^104
+        { 0xDF3D5E9BC0F653E1LLU, 0x2F2967B66737E3EDLLU }, //5^105
+        { 0x8B865B215899F46CLLU, 0xBD79E0D20082EE74LLU }, //5^106
+        { 0xAE67F1E9AEC07187LLU, 0xECD8590680A3AA11LLU }, //5^107
+        { 0xDA01EE641A708DE9LLU, 0xE80E6F4820CC9495LLU }, //5^108
+        { 0x884134FE908658B2LLU, 0x3109058D147FDCDDLLU }, //5^109
+        { 0xAA51823E34A7EEDELLU, 0xBD4B46F0599FD415LLU }, //5^110
+        { 0xD4E5E2CDC1D1EA96LLU, 0x6C9E18AC7007C91ALLU }, //5^111
+        { 0x850FADC09923329ELLU, 0x03E2CF6BC604DDB0LLU }, //5^112
+        { 0xA6539930BF6BFF45LLU, 0x84DB8346B786151CLLU }, //5^113
+        { 0xCFE87F7CEF46FF16LLU, 0xE612641865679A63LLU }, //5^114
+        { 0x81F14FAE158C5F6ELLU, 0x4FCB7E8F3F60C07ELLU }, //5^115
+        { 0xA26DA3999AEF7749LLU, 0xE3BE5E330F38F09DLLU }, //5^116
+        { 0xCB090C8001AB551CLLU, 0x5CADF5BFD3072CC5LLU }, //5^117
+        { 0xFDCB4FA002162A63LLU, 0x73D9732FC7C8F7F6LLU }, //5^118
+        { 0x9E9F11C4014DDA7ELLU, 0x2867E7FDDCDD9AFALLU }, //5^119
+        { 0xC646D63501A1511DLLU, 0xB281E1FD541501B8LLU }, //5^120
+        { 0xF7D88BC24209A565LLU, 0x1F225A7CA91A4226LLU }, //5^121
+        { 0x9AE757596946075FLLU, 0x3375788DE9B06958LLU }, //5^122
+        { 0xC1A12D2FC3978937LLU, 0x0052D6B1641C83AELLU }, //5^123
+        { 0xF209787BB47D6B84LLU, 0xC0678C5DBD23A49ALLU }, //5^124
+        { 0x9745EB4D50CE6332LLU, 0xF840B7BA963646E0LLU }, //5^125
+        { 0xBD176620A501FBFFLLU, 0xB650E5A93BC3D898LLU }, //5^126
+        { 0xEC5D3FA8CE427AFFLLU, 0xA3E51F138AB4CEBELLU }, //5^127
+        { 0x93BA47C980E98CDFLLU, 0xC66F336C36B10137LLU }, //5^128
+        { 0xB8A8D9BBE123F017LLU, 0xB80B0047445D4184LLU }, //5^129
+        { 0xE6D3102AD96CEC1DLLU, 0xA60DC059157491E5LLU }, //5^130
+        { 0x9043EA1AC7E41392LLU, 0x87C89837AD68DB2FLLU }, //5^131
+        { 0xB454E4A179DD1877LLU, 0x29BABE4598C311FBLLU }, //5^132
+        { 0xE16A1DC9D8545E94LLU, 0xF4296DD6FEF3D67ALLU }, //5^133
+        { 0x8CE2529E2734BB1DLLU, 0x1899E4A65F58660CLLU }, //5^134
+        { 0xB01AE745B101E9E4LLU, 0x5EC05DCFF72E7F8FLLU }, //5^135
+        { 0xDC21A1171D42645DLLU, 0x76707543F4FA1F73LLU }, //5^136
+        { 0x899504AE72497EBALLU, 0x6A06494A791C53A8LLU }, //5^137
+        { 0xABFA45DA0EDBDE69LLU, 0x0487DB9D17636892LLU }, //5^138
+        { 0xD6F8D7509292D603LLU, 0x45A9D2845D3C42B6LLU }, //5^139
+        { 0x865B86925B9BC5C2LLU, 0x0B8A2392BA45A9B2LLU }, //5^140
+        { 0xA7F26836F282B732LLU, 0x8E6CAC7768D7141ELLU }, //5^141
+        { 0xD1EF0244AF2364FFLLU, 0x3207D795430CD926LLU }, //5^142
+        { 0x8335616AED761F1FLLU, 0x7F44E6BD49E807B8LLU }, //5^143
+        { 0xA402B9C5A8D3A6E7LLU, 0x5F16206C9C6209A6LLU }, //5^144
+        { 0xCD036837130890A1LLU, 0x36DBA887C37A8C0FLLU }, //5^145
+        { 0x802221226BE55A64LLU, 0xC2494954DA2C9789LLU }, //5^146
+        { 0xA02AA96B06DEB0FDLLU, 0xF2DB9BAA10B7BD6CLLU }, //5^147
+        { 0xC83553C5C8965D3DLLU, 0x6F92829494E5ACC7LLU }, //5^148
+        { 0xFA42A8B73ABBF48CLLU, 0xCB772339BA1F17F9LLU }, //5^149
+        { 0x9C69A97284B578D7LLU, 0xFF2A760414536EFBLLU }, //5^150
+        { 0xC38413CF25E2D70DLLU, 0xFEF5138519684ABALLU }, //5^151
+        { 0xF46518C2EF5B8CD1LLU, 0x7EB258665FC25D69LLU }, //5^152
+        { 0x98BF2F79D5993802LLU, 0xEF2F773FFBD97A61LLU }, //5^153
+        { 0xBEEEFB584AFF8603LLU, 0xAAFB550FFACFD8FALLU }, //5^154
+        { 0xEEAABA2E5DBF6784LLU, 0x95BA2A53F983CF38LLU }, //5^155
+        { 0x952AB45CFA97A0B2LLU, 0xDD945A747BF26183LLU }, //5^156
+        { 0xBA756174393D88DFLLU, 0x94F971119AEEF9E4LLU }, //5^157
+        { 0xE912B9D1478CEB17LLU, 0x7A37CD5601AAB85DLLU }, //5^158
+        { 0x91ABB422CCB812EELLU, 0xAC62E055C10AB33ALLU }, //5^159
+        { 0xB616A12B7FE617AALLU, 0x577B986B314D6009LLU }, //5^160
+        { 0xE39C49765FDF9D94LLU, 0xED5A7E85FDA0B80BLLU }, //5^161
+        { 0x8E41ADE9FBEBC27DLLU, 0x14588F13BE847307LLU }, //5^162
+        { 0xB1D219647AE6B31CLLU, 0x596EB2D8AE258FC8LLU }, //5^163
+        { 0xDE469FBD99A05FE3LLU, 0x6FCA5F8ED9AEF3BBLLU }, //5^164
+        { 0x8AEC23D680043BEELLU, 0x25DE7BB9480D5854LLU }, //5^165
+        { 0xADA72CCC20054AE9LLU, 0xAF561AA79A10AE6ALLU }, //5^166
+        { 0xD910F7FF28069DA4LLU, 0x1B2BA1518094DA04LLU }, //5^167
+        { 0x87AA9AFF79042286LLU, 0x90FB44D2F05D0842LLU }, //5^168
+        { 0xA99541BF57452B28LLU, 0x353A1607AC744A53LLU }, //5^169
+        { 0xD3FA922F2D1675F2LLU, 0x42889B8997915CE8LLU }, //5^170
+        { 0x847C9B5D7C2E09B7LLU, 0x69956135FEBADA11LLU }, //5^171
+        { 0xA59BC234DB398C25LLU, 0x43FAB9837E699095LLU }, //5^172
+        { 0xCF02B2C21207EF2ELLU, 0x94F967E45E03F4BBLLU }, //5^173
+        { 0x8161AFB94B44F57DLLU, 0x1D1BE0EEBAC278F5LLU }, //5^174
+        { 0xA1BA1BA79E1632DCLLU, 0x6462D92A69731732LLU }, //5^175
+        { 0xCA28A291859BBF93LLU, 0x7D7B8F7503CFDCFELLU }, //5^176
+        { 0xFCB2CB35E702AF78LLU, 0x5CDA735244C3D43ELLU }, //5^177
+        { 0x9DEFBF01B061ADABLLU, 0x3A0888136AFA64A7LLU }, //5^178
+        { 0xC56BAEC21C7A1916LLU, 0x088AAA1845B8FDD0LLU }, //5^179
+        { 0xF6C69A72A3989F5BLLU, 0x8AAD549E57273D45LLU }, //5^180
+        { 0x9A3C2087A63F6399LLU, 0x36AC54E2F678864BLLU }, //5^181
+        { 0xC0CB28A98FCF3C7FLLU, 0x84576A1BB416A7DDLLU }, //5^182
+        { 0xF0FDF2D3F3C30B9FLLU, 0x656D44A2A11C51D5LLU }, //5^183
+        { 0x969EB7C47859E743LLU, 0x9F644AE5A4B1B325LLU }, //5^184
+        { 0xBC4665B596706114LLU, 0x873D5D9F0DDE1FEELLU }, //5^185
+        { 0xEB57FF22FC0C7959LLU, 0xA90CB506D155A7EALLU }, //5^186
+        { 0x9316FF75DD87CBD8LLU, 0x09A7F12442D588F2LLU }, //5^187
+        { 0xB7DCBF5354E9BECELLU, 0x0C11ED6D538AEB2FLLU }, //5^188
+        { 0xE5D3EF282A242E81LLU, 0x8F1668C8A86DA5FALLU }, //5^189
+        { 0x8FA475791A569D10LLU, 0xF96E017D694487BCLLU }, //5^190
+        { 0xB38D92D760EC4455LLU, 0x37C981DCC395A9ACLLU }, //5^191
+        { 0xE070F78D3927556ALLU, 0x85BBE253F47B1417LLU }, //5^192
+        { 0x8C469AB843B89562LLU, 0x93956D7478CCEC8ELLU }, //5^193
+        { 0xAF58416654A6BABBLLU, 0x387AC8D1970027B2LLU }, //5^194
+        { 0xDB2E51BFE9D0696ALLU, 0x06997B05FCC0319ELLU }, //5^195
+        { 0x88FCF317F22241E2LLU, 0x441FECE3BDF81F03LLU }, //5^196
+        { 0xAB3C2FDDEEAAD25ALLU, 0xD527E81CAD7626C3LLU }, //5^197
+        { 0xD60B3BD56A5586F1LLU, 0x8A71E223D8D3B074LLU }, //5^198
+        { 0x85C7056562757456LLU, 0xF6872D5667844E49LLU }, //5^199
+        { 0xA738C6BEBB12D16CLLU, 0xB428F8AC016561DBLLU }, //5^200
+        { 0xD106F86E69D785C7LLU, 0xE13336D701BEBA52LLU }, //5^201
+        { 0x82A45B450226B39CLLU, 0xECC0024661173473LLU }, //5^202
+        { 0xA34D721642B06084LLU, 0x27F002D7F95D0190LLU }, //5^203
+        { 0xCC20CE9BD35C78A5LLU, 0x31EC038DF7B441F4LLU }, //5^204
+        { 0xFF290242C83396CELLU, 0x7E67047175A15271LLU }, //5^205
+        { 0x9F79A169BD203E41LLU, 0x0F0062C6E984D386LLU }, //5^206
+        { 0xC75809C42C684DD1LLU, 0x52C07B78A3E60868LLU }, //5^207
+        { 0xF92E0C3537826145LLU, 0xA7709A56CCDF8A82LLU }, //5^208
+        { 0x9BBCC7A142B17CCBLLU, 0x88A66076400BB691LLU }, //5^209
+        { 0xC2ABF989935DDBFELLU, 0x6ACFF893D00EA435LLU }, //5^210
+        { 0xF356F7EBF83552FELLU, 0x0583F6B8C4124D43LLU }, //5^211
+        { 0x98165AF37B2153DELLU, 0xC3727A337A8B704ALLU }, //5^212
+        { 0xBE1BF1B059E9A8D6LLU, 0x744F18C0592E4C5CLLU }, //5^213
+        { 0xEDA2EE1C7064130CLLU, 0x1162DEF06F79DF73LLU }, //5^214
+        { 0x9485D4D1C63E8BE7LLU, 0x8ADDCB5645AC2BA8LLU }, //5^215
+        { 0xB9A74A0637CE2EE1LLU, 0x6D953E2BD7173692LLU }, //5^216
+        { 0xE8111C87C5C1BA99LLU, 0xC8FA8DB6CCDD0437LLU }, //5^217
+        { 0x910AB1D4DB9914A0LLU, 0x1D9C9892400A22A2LLU }, //5^218
+        { 0xB54D5E4A127F59C8LLU, 0x2503BEB6D00CAB4BLLU }, //5^219
+        { 0xE2A0B5DC971F303ALLU, 0x2E44AE64840FD61DLLU }, //5^220
+        { 0x8DA471A9DE737E24LLU, 0x5CEAECFED289E5D2LLU }, //5^221
+        { 0xB10D8E1456105DADLLU, 0x7425A83E872C5F47LLU }, //5^222
+        { 0xDD50F1996B947518LLU, 0xD12F124E28F77719LLU }, //5^223
+        { 0x8A5296FFE33CC92FLLU, 0x82BD6B70D99AAA6FLLU }, //5^224
+        { 0xACE73CBFDC0BFB7BLLU, 0x636CC64D1001550BLLU }, //5^225
+        { 0xD8210BEFD30EFA5ALLU, 0x3C47F7E05401AA4ELLU }, //5^226
+        { 0x8714A775E3E95C78LLU, 0x65ACFAEC34810A71LLU }, //5^227
+        { 0xA8D9D1535CE3B396LLU, 0x7F1839A741A14D0DLLU }, //5^228
+        { 0xD31045A8341CA07CLLU, 0x1EDE48111209A050LLU }, //5^229
+        { 0x83EA2B892091E44DLLU, 0x934AED0AAB460432LLU }, //5^230
+        { 0xA4E4B66B68B65D60LLU, 0xF81DA84D5617853FLLU }, //5^231
+        { 0xCE1DE40642E3F4B9LLU, 0x36251260AB9D668ELLU }, //5^232
+        { 0x80D2AE83E9CE78F3LLU, 0xC1D72B7C6B426019LLU }, //5^233
+        { 0xA1075A24E4421730LLU, 0xB24CF65B8612F81FLLU }, //5^234
+        { 0xC94930AE1D529CFCLLU, 0xDEE033F26797B627LLU }, //5^235
+        { 0xFB9B7CD9A4A7443CLLU, 0x169840EF017DA3B1LLU }, //5^236
+        { 0x9D412E0806E88AA5LLU, 0x8E1F289560EE864ELLU }, //5^237
+        { 0xC491798A08A2AD4ELLU, 0xF1A6F2BAB92A27E2LLU }, //5^238
+        { 0xF5B5D7EC8ACB58A2LLU, 0xAE10AF696774B1DBLLU }, //5^239
+        { 0x9991A6F3D6BF1765LLU, 0xACCA6DA1E0A8EF29LLU }, //5^240
+        { 0xBFF610B0CC6EDD3FLLU, 0x17FD090A58D32AF3LLU }, //5^241
+        { 0xEFF394DCFF8A948ELLU, 0xDDFC4B4CEF07F5B0LLU }, //5^242
+        { 0x95F83D0A1FB69CD9LLU, 0x4ABDAF101564F98ELLU }, //5^243
+        { 0xBB764C4CA7A4440FLLU, 0x9D6D1AD41ABE37F1LLU }, //5^244
+        { 0xEA53DF5FD18D5513LLU, 0x84C86189216DC5EDLLU }, //5^245
+        { 0x92746B9BE2F8552CLLU, 0x32FD3CF5B4E49BB4LLU }, //5^246
+        { 0xB7118682DBB66A77LLU, 0x3FBC8C33221DC2A1LLU }, //5^247
+        { 0xE4D5E82392A40515LLU, 0x0FABAF3FEAA5334ALLU }, //5^248
+        { 0x8F05B1163BA6832DLLU, 0x29CB4D87F2A7400ELLU }, //5^249
+        { 0xB2C71D5BCA9023F8LLU, 0x743E20E9EF511012LLU }, //5^250
+        { 0xDF78E4B2BD342CF6LLU, 0x914DA9246B255416LLU }, //5^251
+        { 0x8BAB8EEFB6409C1ALLU, 0x1AD089B6C2F7548ELLU }, //5^252
+        { 0xAE9672ABA3D0C320LLU, 0xA184AC2473B529B1LLU }, //5^253
+        { 0xDA3C0F568CC4F3E8LLU, 0xC9E5D72D90A2741ELLU }, //5^254
+        { 0x8865899617FB1871LLU, 0x7E2FA67C7A658892LLU }, //5^255
+        { 0xAA7EEBFB9DF9DE8DLLU, 0xDDBB901B98FEEAB7LLU }, //5^256
+        { 0xD51EA6FA85785631LLU, 0x552A74227F3EA565LLU }, //5^257
+        { 0x8533285C936B35DELLU, 0xD53A88958F87275FLLU }, //5^258
+        { 0xA67FF273B8460356LLU, 0x8A892ABAF368F137LLU }, //5^259
+        { 0xD01FEF10A657842CLLU, 0x2D2B7569B0432D85LLU }, //5^260
+        { 0x8213F56A67F6B29BLLU, 0x9C3B29620E29FC73LLU }, //5^261
+        { 0xA298F2C501F45F42LLU, 0x8349F3BA91B47B8FLLU }, //5^262
+        { 0xCB3F2F7642717713LLU, 0x241C70A936219A73LLU }, //5^263
+        { 0xFE0EFB53D30DD4D7LLU, 0xED238CD383AA0110LLU }, //5^264
+        { 0x9EC95D1463E8A506LLU, 0xF4363804324A40AALLU }, //5^265
+        { 0xC67BB4597CE2CE48LLU, 0xB143C6053EDCD0D5LLU }, //5^266
+        { 0xF81AA16FDC1B81DALLU, 0xDD94B7868E94050ALLU }, //5^267
+        { 0x9B10A4E5E9913128LLU, 0xCA7CF2B4191C8326LLU }, //5^268
+        { 0xC1D4CE1F63F57D72LLU, 0xFD1C2F611F63A3F0LLU }, //5^269
+        { 0xF24A01A73CF2DCCFLLU, 0xBC633B39673C8CECLLU }, //5^270
+        { 0x976E41088617CA01LLU, 0xD5BE0503E085D813LLU }, //5^271
+        { 0xBD49D14AA79DBC82LLU, 0x4B2D8644D8A74E18LLU }, //5^272
+        { 0xEC9C459D51852BA2LLU, 0xDDF8E7D60ED1219ELLU }, //5^273
+        { 0x93E1AB8252F33B45LLU, 0xCABB90E5C942B503LLU }, //5^274
+        { 0xB8DA1662E7B00A17LLU, 0x3D6A751F3B936243LLU }, //5^275
+        { 0xE7109BFBA19C0C9DLLU, 0x0CC512670A783AD4LLU }, //5^276
+        { 0x906A617D450187E2LLU, 0x27FB2B80668B24C5LLU }, //5^277
+        { 0xB484F9DC9641E9DALLU, 0xB1F9F660802DEDF6LLU }, //5^278
+        { 0xE1A63853BBD26451LLU, 0x5E7873F8A0396973LLU }, //5^279
+        { 0x8D07E33455637EB2LLU, 0xDB0B487B6423E1E8LLU }, //5^280
+        { 0xB049DC016ABC5E5FLLU, 0x91CE1A9A3D2CDA62LLU }, //5^281
+        { 0xDC5C5301C56B75F7LLU, 0x7641A140CC7810FBLLU }, //5^282
+        { 0x89B9B3E11B6329BALLU, 0xA9E904C87FCB0A9DLLU }, //5^283
+        { 0xAC2820D9623BF429LLU, 0x546345FA9FBDCD44LLU }, //5^284
+        { 0xD732290FBACAF133LLU, 0xA97C177947AD4095LLU }, //5^285
+        { 0x867F59A9D4BED6C0LLU, 0x49ED8EABCCCC485DLLU }, //5^286
+        { 0xA81F301449EE8C70LLU, 0x5C68F256BFFF5A74LLU }, //5^287
+        { 0xD226FC195C6A2F8CLLU, 0x73832EEC6FFF3111LLU }, //5^288
+        { 0x83585D8FD9C25DB7LLU, 0xC831FD53C5FF7EABLLU }, //5^289
+        { 0xA42E74F3D032F525LLU, 0xBA3E7CA8B77F5E55LLU }, //5^290
+        { 0xCD3A1230C43FB26FLLU, 0x28CE1BD2E55F35EBLLU }, //5^291
+        { 0x80444B5E7AA7CF85LLU, 0x7980D163CF5B81B3LLU }, //5^292
+        { 0xA0555E361951C366LLU, 0xD7E105BCC332621FLLU }, //5^293
+        { 0xC86AB5C39FA63440LLU, 0x8DD9472BF3FEFAA7LLU }, //5^294
+        { 0xFA856334878FC150LLU, 0xB14F98F6F0FEB951LLU }, //5^295
+        { 0x9C935E00D4B9D8D2LLU, 0x6ED1BF9A569F33D3LLU }, //5^296
+        { 0xC3B8358109E84F07LLU, 0x0A862F80EC4700C8LLU }, //5^297
+        { 0xF4A642E14C6262C8LLU, 0xCD27BB612758C0FALLU }, //5^298
+        { 0x98E7E9CCCFBD7DBDLLU, 0x8038D51CB897789CLLU }, //5^299
+        { 0xBF21E44003ACDD2CLLU, 0xE0470A63E6BD56C3LLU }, //5^300
+        { 0xEEEA5D5004981478LLU, 0x1858CCFCE06CAC74LLU }, //5^301
+        { 0x95527A5202DF0CCBLLU, 0x0F37801E0C43EBC8LLU }, //5^302
+        { 0xBAA718E68396CFFDLLU, 0xD30560258F54E6BALLU }, //5^303
+        { 0xE950DF20247C83FDLLU, 0x47C6B82EF32A2069LLU }, //5^304
+        { 0x91D28B7416CDD27ELLU, 0x4CDC331D57FA5441LLU }, //5^305
+        { 0xB6472E511C81471DLLU, 0xE0133FE4ADF8E952LLU }, //5^306
+        { 0xE3D8F9E563A198E5LLU, 0x58180FDDD97723A6LLU }, //5^307
+        { 0x8E679C2F5E44FF8FLLU, 0x570F09EAA7EA7648LLU }  //5^308
+};
+
+/**
+ * The powers of ten which are exactly represented by a float64 (see StringToFloatFast).
+ */
+static const float64 exactPowersOfTen[23] = { 1E0, 1E1, 1E2, 1E3, 1E4, 1E5, 1E6, 1E7, 1E8, 1E9, 1E10, 1E11, 1E12, 1E13, 1E14, 1E15, 1E16, 1E17, 1E18, 1E19, 1E20,
+        1E21, 1E22 };
+
+/**
+ * @brief The characteristics of the binary format of the float types used by StringToFloatFast.
+ */
+template<typename T>
+struct FloatFormat;
+
+/**
+ * @brief The characteristics of the binary format of a float32.
+ */
+template<>
+struct FloatFormat<float32> {
+    /**
+     * The number of bits of the mantissa without the implicit bit.
+     */
+    static const int32 mantissaExplicitBits = 23;
+    /**
+     * The exponent bias.
+     */
+    static const int32 minimumExponent = -127;
+    /**
+     * The biased exponent of the infinite.
+     */
+    static const int32 infinitePower = 0xFF;
+    /**
+     * Any number w * 10^q with q < smallestPowerOfTen is rounded to zero.
+     */
+    static const int32 smallestPowerOfTen = -65;
+    /**
+     * Any number w * 10^q with q > largestPowerOfTen is infinite.
+     */
+    static const int32 largestPowerOfTen = 38;
+    /**
+     * Range of q where a number can be exactly halfway between two floats.
+     */
+    static const int32 minExponentRoundToEven = -17;
+    /**
+     * Range of q where a number can be exactly halfway between two floats.
+     */
+    static const int32 maxExponentRoundToEven = 10;
+    /**
+     * The largest exponent of ten exactly represented by the type.
+     */
+    static const int32 maxExponentFastPath = 10;
+};
+
+/**
+ * @brief The characteristics of the binary format of a float64.
+ */
+template<>
+struct FloatFormat<float64> {
+    /**
+     * The number of bits of the mantissa without the implicit bit.
+     */
+    static const int32 mantissaExplicitBits = 52;
+    /**
+     * The exponent bias.
+     */
+    static const int32 minimumExponent = -1023;
+    /**
+     * The biased exponent of the infinite.
+     */
+    static const int32 infinitePower = 0x7FF;
+    /**
+     * Any number w * 10^q with q < smallestPowerOfTen is rounded to zero.
+     */
+    static const int32 smallestPowerOfTen = -342;
+    /**
+     * Any number w * 10^q with q > largestPowerOfTen is infinite.
+     */
+    static const int32 largestPowerOfTen = 308;
+    /**
+     * Range of q where a number can be exactly halfway between two floats.
+     */
+    static const int32 minExponentRoundToEven = -4;
+    /**
+     * Range of q where a number can be exactly halfway between two floats.
+     */
+    static const int32 maxExponentRoundToEven = 23;
+    /**
+     * The largest exponent of ten exactly represented by the type.
+     */
+    static const int32 maxExponentFastPath = 22;
+};
+
+/**
+ * @brief Computes the 128 bits product of two 64 bits unsigned integers.
+ * @param[in] a the first operand.
+ * @param[in] b the second operand.
+ * @param[out] high the 64 most significant bits of a * b.
+ * @param[out] low the 64 least significant bits of a * b.
+ */
+static void FullMultiplication(const uint64 a,
+                               const uint64 b,
+                               uint64 &high,
+                               uint64 &low) {
+    const uint64 mask32 = 0xFFFFFFFFLLU;
+    uint64 aLow = (a & mask32);
+    uint64 aHigh = (a >> 32u);
+    uint64 bLow = (b & mask32);
+    uint64 bHigh = (b >> 32u);
+    uint64 lowLow = (aLow * bLow);
+    uint64 lowHigh = (aLow * bHigh);
+    uint64 highLow = (aHigh * bLow);
+    uint64 highHigh = (aHigh * bHigh);
+    //Cannot overflow: (2^32 - 1)^2 + 2 * (2^32 - 1) < 2^64
+    uint64 cross = ((lowLow >> 32u) + (lowHigh & mask32)) + highLow;
+    high = (highHigh + (lowHigh >> 32u)) + (cross >> 32u);
+    low = ((cross << 32u) | (lowLow & mask32));
+}
+
+/**
+ * @brief Gets the number of leading zero bits of a non-zero 64 bits integer.
+ * @param[in] value the integer.
+ * @return the number of leading zero bits of \a value.
+ */
+static int32 LeadingZeros(uint64 value) {
+    int32 zeros = 0;
+    uint32 shift = 32u;
+    while (shift > 0u) {
+        if ((value >> (64u - shift)) == 0u) {
+            value <<= shift;
+            zeros += static_cast<int32>(shift);
+        }
+        shift >>= 1u;
+    }
+    return zeros;
+}
+
+/**
+ * @brief Computes the float closest to w * 10^q with the Eisel-Lemire algorithm.
+ * @details The 64 bits \a w is multiplied by the truncated 128 bits normalised 5^q (see powersOfFive128). The product is
+ * always accurate enough to select the correctly rounded float, including the halfway cases (rounded to even)
+ * and the subnormal numbers.
+ * @param[in] q the decimal exponent.
+ * @param[in] w the decimal significand.
+ * @param[out] mantissa the mantissa of the float (without the implicit bit).
+ * @param[out] power2 the biased binary exponent of the float (FloatFormat<T>::infinitePower if the number is infinite).
+ */
+/*lint -e{1573} [MISRA C++ Rule 14-5-1]. Justification: MARTe::HighResolutionTimerCalibrator is not a possible argument for this function template.*/
+template<typename T>
+static void ComputeFloat(const int32 q,
+                         uint64 w,
+                         uint64 &mantissa,
+                         int32 &power2) {
+    const int32 mantissaBits = FloatFormat<T>::mantissaExplicitBits;
+    mantissa = 0u;
+    power2 = 0;
+    if (q > FloatFormat<T>::largestPowerOfTen) {
+        power2 = FloatFormat<T>::infinitePower;
+    }
+    else if ((w != 0u) && (q >= FloatFormat<T>::smallestPowerOfTen)) {
+        int32 lz = LeadingZeros(w);
+        w <<= static_cast<uint32>(lz);
+        uint32 index = static_cast<uint32>(q + 342);
+        uint64 high;
+        uint64 low;
+        FullMultiplication(w, powersOfFive128[index][0], high, low);
+        //Only the mantissaBits + 3 most significant bits are needed. If they could be affected by the truncation of 5^q, use the next 64 bits.
+        const uint64 precisionMask = (0xFFFFFFFFFFFFFFFFLLU >> static_cast<uint32>(mantissaBits + 3));
+        if ((high & precisionMask) == precisionMask) {
+            uint64 secondHigh;
+            uint64 secondLow;
+            FullMultiplication(w, powersOfFive128[index][1], secondHigh, secondLow);
+            low += secondHigh;
+            if (secondHigh > low) {
+                high++;
+            }
+        }
+        int32 upperBit = static_cast<int32>(high >> 63u);
+        uint32 shift = static_cast<uint32>(((upperBit + 64) - mantissaBits) - 3);
+        mantissa = (high >> shift);
+        //floor(log2(10^q)) = floor(q * log2(10)) computed in fixed point
+        power2 = ((((217706 * q) >> 16) + 63) + upperBit) - lz - FloatFormat<T>::minimumExponent;
+        if (power2 <= 0) {
+            //Subnormal
+            if ((-power2 + 1) >= 64) {
+                mantissa = 0u;
+                power2 = 0;
+            }
+            else {
+                mantissa >>= static_cast<uint32>(-power2 + 1);
+                mantissa += (mantissa & 1u);
+                mantissa >>= 1u;
+                if (mantissa < (static_cast<uint64>(1u) << static_cast<uint32>(mantissaBits))) {
+                    power2 = 0;
+                }
+                else {
+                    power2 = 1;
+                }
+            }
+        }
+        else {
+            //Exactly halfway between two floats: round to even
+            if ((low <= 1u) && (q >= FloatFormat<T>::minExponentRoundToEven) && (q <= FloatFormat<T>::maxExponentRoundToEven) && ((mantissa & 3u) == 1u)) {
+                if ((mantissa << shift) == high) {
+                    mantissa &= ~static_cast<uint64>(1u);
+                }
+            }
+            mantissa += (mantissa & 1u);
+            mantissa >>= 1u;
+            if (mantissa >= (static_cast<uint64>(2u) << static_cast<uint32>(mantissaBits))) {
+                mantissa = (static_cast<uint64>(1u) << static_cast<uint32>(mantissaBits));
+                power2++;
+            }
+            mantissa &= ~(static_cast<uint64>(1u) << static_cast<uint32>(mantissaBits));
+            if (power2 >= FloatFormat<T>::infinitePower) {
+                power2 = FloatFormat<T>::infinitePower;
+                mantissa = 0u;
+            }
+        }
+    }
+    else {
+        //Zero
+    }
+}
+
+/**
+ * @brief Builds a float32 from its sign, mantissa and biased exponent.
+ */
+static void AssembleFloat(float32 &number,
+                          const bool isNegative,
+                          const uint64 mantissa,
+                          const int32 power2) {
+    uint32 bits = (static_cast<uint32>(mantissa) | (static_cast<uint32>(power2) << 23u));
+    if (isNegative) {
+        bits |= 0x80000000u;
+    }
+    (void) MemoryOperationsHelper::Copy(&number, &bits, static_cast<uint32>(sizeof(float32)));
+}
+
+/**
+ * @brief Builds a float64 from its sign, mantissa and biased exponent.
+ */
+static void AssembleFloat(float64 &number,
+                          const bool isNegative,
+                          const uint64 mantissa,
+                          const int32 power2) {
+    uint64 bits = (mantissa | (static_cast<uint64>(power2) << 52u));
+    if (isNegative) {
+        bits |= 0x8000000000000000LLU;
+    }
+    (void) MemoryOperationsHelper::Copy(&number, &bits, static_cast<uint32>(sizeof(float64)));
+}
+
+/**
+ * The number of 32 bits limbs of the big integers used by RoundDecimalExactly.
+ */
+static const uint32 bigIntegerLimbs = 128u;
+
+/**
+ * The maximum number of significant digits taken into account by RoundDecimalExactly. Any further digit
+ * can only move the number away from a halfway point.
+ */
+static const uint32 maxExactDigits = 780u;
+
+/**
+ * The powers of five which fit in a uint32.
+ */
+static const uint32 powersOfFive32[14] = { 1u, 5u, 25u, 125u, 625u, 3125u, 15625u, 78125u, 390625u, 1953125u, 9765625u, 48828125u, 244140625u, 1220703125u };
+
+/**
+ * @brief Computes limbs = limbs * factor + addend.
+ * @param[in,out] limbs the big integer (the least significant limb first).
+ * @param[in,out] size the number of limbs of the big integer.
+ * @param[in] factor the factor.
+ * @param[in] addend the addend.
+ * @return false if the result does not fit in bigIntegerLimbs limbs.
+ */
+static bool BigIntegerMultiplyAdd(uint32 * const limbs,
+                                  uint32 &size,
+                                  const uint32 factor,
+                                  const uint32 addend) {
+    uint64 carry = addend;
+    for (uint32 k = 0u; k < size; k++) {
+        uint64 product = (static_cast<uint64>(limbs[k]) * factor) + carry;
+        limbs[k] = static_cast<uint32>(product);
+        carry = (product >> 32u);
+    }
+    bool ret = true;
+    if (carry > 0u) {
+        ret = (size < bigIntegerLimbs);
+        if (ret) {
+            limbs[size] = static_cast<uint32>(carry);
+            size++;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Computes limbs = limbs * 5^exponent.
+ * @param[in,out] limbs the big integer (the least significant limb first).
+ * @param[in,out] size the number of limbs of the big integer.
+ * @param[in] exponent the power of five.
+ * @return false if the result does not fit in bigIntegerLimbs limbs.
+ */
+static bool BigIntegerMultiplyPowerOfFive(uint32 * const limbs,
+                                          uint32 &size,
+                                          uint32 exponent) {
+    bool ret = true;
+    while ((exponent > 0u) && (ret)) {
+        uint32 step = exponent;
+        if (step > 13u) {
+            step = 13u;
+        }
+        ret = BigIntegerMultiplyAdd(limbs, size, powersOfFive32[step], 0u);
+        exponent -= step;
+    }
+    return ret;
+}
+
+/**
+ * @brief Computes limbs = limbs * 2^shift.
+ * @param[in,out] limbs the big integer (the least significant limb first).
+ * @param[in,out] size the number of limbs of the big integer.
+ * @param[in] shift the power of two.
+ * @return false if the result does not fit in bigIntegerLimbs limbs.
+ */
+static bool BigIntegerShiftLeft(uint32 * const limbs,
+                                uint32 &size,
+                                const uint32 shift) {
+    bool ret = true;
+    if (size > 0u) {
+        uint32 words = (shift / 32u);
+        uint32 bits = (shift % 32u);
+        ret = ((size + words) < bigIntegerLimbs);
+        if (ret) {
+            limbs[size + words] = 0u;
+            for (uint32 k = size; k > 0u; k--) {
+                uint64 shifted = (static_cast<uint64>(limbs[k - 1u]) << bits);
+                limbs[k + words] |= static_cast<uint32>(shifted >> 32u);
+                limbs[(k + words) - 1u] = static_cast<uint32>(shifted);
+            }
+            for (uint32 k = 0u; k < words; k++) {
+                limbs[k] = 0u;
+            }
+            size += words + 1u;
+            if (limbs[size - 1u] == 0u) {
+                size--;
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Compares two big integers.
+ * @return a positive number if a > b, a negative number if a < b and zero if they are equal.
+ */
+static int32 BigIntegerCompare(const uint32 * const a,
+                               const uint32 sizeA,
+                               const uint32 * const b,
+                               const uint32 sizeB) {
+    int32 ret = 0;
+    if (sizeA > sizeB) {
+        ret = 1;
+    }
+    else if (sizeA < sizeB) {
+        ret = -1;
+    }
+    else {
+        for (uint32 k = sizeA; (k > 0u) && (ret == 0); k--) {
+            if (a[k - 1u] > b[k - 1u]) {
+                ret = 1;
+            }
+            else if (a[k - 1u] < b[k - 1u]) {
+                ret = -1;
+            }
+            else {
+                //Same limb
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Rounds a decimal number which lies between the float \a bits and the next one.
+ * @details The number is compared, with exact big integer arithmetic, with the point halfway between the two floats,
+ * i.e. digits * 10^e against (2 * m + 1) * 2^(k - 1), where m * 2^k is the float \a bits.
+ * @param[in] digits the digits of the number ([0-9]*[.[0-9]*]), up to the first character which is neither a digit nor a '.'.
+ * @param[in] exponent the decimal exponent given after the digits.
+ * @param[in,out] bits the binary representation (without sign) of the float below the number. Incremented if the number has to be rounded up.
+ * @return false if the numbers do not fit in the big integers.
+ */
+/*lint -e{1573} [MISRA C++ Rule 14-5-1]. Justification: MARTe::HighResolutionTimerCalibrator is not a possible argument for this function template.*/
+template<typename T>
+static bool RoundDecimalExactly(const char8 * const digits,
+                                const int32 exponent,
+                                uint64 &bits) {
+    uint32 left[bigIntegerLimbs];
+    uint32 leftSize = 0u;
+    uint32 right[bigIntegerLimbs];
+    uint32 rightSize = 0u;
+    int32 decimalExponent = exponent;
+    uint32 significantDigits = 0u;
+    bool sticky = false;
+    bool fraction = false;
+    bool ret = true;
+    uint32 chunk = 0u;
+    uint32 chunkFactor = 1u;
+    for (uint32 i = 0u; (ret) && (((digits[i] >= '0') && (digits[i] <= '9')) || (digits[i] == '.')); i++) {
+        if (digits[i] == '.') {
+            fraction = true;
+        }
+        else {
+            uint32 newDigit = static_cast<uint32>(static_cast<uint8>(digits[i]) - static_cast<uint8>('0'));
+            if (fraction) {
+                decimalExponent--;
+            }
+            if ((significantDigits > 0u) || (newDigit > 0u)) {
+                significantDigits++;
+                if (significantDigits <= maxExactDigits) {
+                    chunk = (chunk * 10u) + newDigit;
+                    chunkFactor *= 10u;
+                    if (chunkFactor == 1000000000u) {
+                        ret = BigIntegerMultiplyAdd(&left[0], leftSize, chunkFactor, chunk);
+                        chunk = 0u;
+                        chunkFactor = 1u;
+                    }
+                }
+                else {
+                    decimalExponent++;
+                    if (newDigit > 0u) {
+                        sticky = true;
+                    }
+                }
+            }
+        }
+    }
+    if ((ret) && (chunkFactor > 1u)) {
+        ret = BigIntegerMultiplyAdd(&left[0], leftSize, chunkFactor, chunk);
+    }
+    const uint32 mantissaBits = static_cast<uint32>(FloatFormat<T>::mantissaExplicitBits);
+    int32 power2 = static_cast<int32>(bits >> mantissaBits);
+    uint64 m = (bits & ((static_cast<uint64>(1u) << mantissaBits) - 1u));
+    int32 k = 0;
+    if (power2 == 0) {
+        k = (1 + FloatFormat<T>::minimumExponent) - static_cast<int32>(mantissaBits);
+    }
+    else {
+        m |= (static_cast<uint64>(1u) << mantissaBits);
+        k = (power2 + FloatFormat<T>::minimumExponent) - static_cast<int32>(mantissaBits);
+    }
+    uint64 halfway = ((m << 1u) + 1u);
+    right[0] = static_cast<uint32>(halfway);
+    right[1] = static_cast<uint32>(halfway >> 32u);
+    rightSize = 2u;
+    if (right[1] == 0u) {
+        rightSize = 1u;
+    }
+    if (ret) {
+        if (decimalExponent >= 0) {
+            ret = BigIntegerMultiplyPowerOfFive(&left[0], leftSize, static_cast<uint32>(decimalExponent));
+        }
+        else {
+            ret = BigIntegerMultiplyPowerOfFive(&right[0], rightSize, static_cast<uint32>(-decimalExponent));
+        }
+    }
+    //The powers of two of 10^e and of 2^(k - 1)
+    int32 shift = (k - 1) - decimalExponent;
+    if (ret) {
+        if (shift >= 0) {
+            ret = BigIntegerShiftLeft(&right[0], rightSize, static_cast<uint32>(shift));
+        }
+        else {
+            ret = BigIntegerShiftLeft(&left[0], leftSize, static_cast<uint32>(-shift));
+        }
+    }
+    if (ret) {
+        int32 comparison = BigIntegerCompare(&left[0], leftSize, &right[0], rightSize);
+        bool roundUp = (comparison > 0);
+        if (comparison == 0) {
+            //Exactly halfway: round to even
+            roundUp = ((sticky) || ((bits & 1u) == 1u));
+        }
+        if (roundUp) {
+            bits++;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Converts a token in decimal notation to the correctly rounded float.
+ * @details The token is parsed in a single pass into the 64 bits significand w (the first 19 significant digits) and the
+ * decimal exponent q. If w and 10^|q| are exactly represented by the float type the result is w * 10^q (or w / 10^-q),
+ * otherwise it is computed with the Eisel-Lemire algorithm (see ComputeFloat). When more than 19 significant digits
+ * are given and w and w + 1 are not rounded to the same float, the choice between the two is made by RoundDecimalExactly.
+ * @param[in] input is the token in input.
+ * @param[out] number is the conversion result.
+ * @return true if the token was converted. false if the token is not a plain decimal number ([+-]digits[.digits][(E|e)[+-]digits]),
+ * or overflows, in which case it has to be converted by StringToNormalFloatPrivate(*),
+ * which reports the error. Nothing is reported by this function.
+ */
+/*lint -e{1573} [MISRA C++ Rule 14-5-1]. Justification: MARTe::HighResolutionTimerCalibrator is not a possible argument for this function template.*/
+template<typename T>
+static bool StringToFloatFast(const char8 * const input,
+                              T &number) {
+    uint32 i = 0u;
+    bool isNegative = false;
+    if (input[i] == '-') {
+        isNegative = true;
+        i++;
+    }
+    else {
+        if (input[i] == '+') {
+            i++;
+        }
+    }
+    const uint32 digitsStart = i;
+    uint64 w = 0u;
+    int32 q = 0;
+    int32 explicitExponent = 0;
+    uint32 significantDigits = 0u;
+    uint32 numberOfDigits = 0u;
+    bool truncated = false;
+    bool fraction = false;
+    bool ok = true;
+    bool done = false;
+    while (!done) {
+        char8 digit = input[i];
+        if ((digit >= '0') && (digit <= '9')) {
+            uint64 newDigit = static_cast<uint64>(static_cast<uint8>(digit) - static_cast<uint8>('0'));
+            numberOfDigits++;
+            if ((significantDigits > 0u) || (newDigit > 0u)) {
+                if (significantDigits < 19u) {
+                    w = (w * 10u) + newDigit;
+                    significantDigits++;
+                    if (fraction) {
+                        q--;
+                    }
+                }
+                else {
+                    //Digits after the 19th only move the decimal point
+                    if (newDigit > 0u) {
+                        truncated = true;
+                    }
+                    if (!fraction) {
+                        q++;
+                    }
+                }
+            }
+            else {
+                //Leading zeros
+                if (fraction) {
+                    q--;
+                }
+            }
+            i++;
+        }
+        else if ((digit == '.') && (!fraction)) {
+            fraction = true;
+            i++;
+        }
+        else {
+            done = true;
+        }
+    }
+    ok = (numberOfDigits > 0u);
+    if (ok) {
+        if ((input[i] == 'E') || (input[i] == 'e')) {
+            i++;
+            bool expPositive = true;
+            if (input[i] == '+') {
+                i++;
+            }
+            else {
+                if (input[i] == '-') {
+                    expPositive = false;
+                    i++;
+                }
+            }
+            int32 exponent = 0;
+            uint32 exponentDigits = 0u;
+            while ((ok) && (input[i] >= '0') && (input[i] <= '9')) {
+                exponent = (exponent * 10) + static_cast<int32>(static_cast<uint8>(input[i]) - static_cast<uint8>('0'));
+                exponentDigits++;
+                //StringToNormalFloatPrivate reports the overflow
+                ok = (exponent < 512);
+                i++;
+            }
+            if (ok) {
+                ok = (exponentDigits > 0u);
+            }
+            if (ok) {
+                if (expPositive) {
+                    explicitExponent = exponent;
+                }
+                else {
+                    explicitExponent = -exponent;
+                }
+                q += explicitExponent;
+            }
+        }
+    }
+    if (ok) {
+        ok = (input[i] == '\0');
+    }
+    if (ok) {
+        const int32 mantissaBits = FloatFormat<T>::mantissaExplicitBits;
+        const int32 maxFastPath = FloatFormat<T>::maxExponentFastPath;
+        bool fastPath = ((!truncated) && (w <= (static_cast<uint64>(2u) << static_cast<uint32>(mantissaBits))));
+        if (fastPath) {
+            fastPath = ((q >= -maxFastPath) && (q <= maxFastPath));
+        }
+        if (fastPath) {
+            //Both w and 10^|q| are exact, so is the rounding of the single operation
+            number = static_cast<T>(w);
+            if (q < 0) {
+                number /= static_cast<T>(exactPowersOfTen[-q]);
+            }
+            else {
+                number *= static_cast<T>(exactPowersOfTen[q]);
+            }
+            if (isNegative) {
+                number = -number;
+            }
+        }
+        else {
+            uint64 mantissa;
+            int32 power2;
+            ComputeFloat<T>(q, w, mantissa, power2);
+            if (truncated) {
+                //The number is in [w, w + 1) * 10^q
+                uint64 mantissaUp;
+                int32 power2Up;
+                ComputeFloat<T>(q, w + 1u, mantissaUp, power2Up);
+                uint64 bits = (mantissa | (static_cast<uint64>(power2) << static_cast<uint32>(mantissaBits)));
+                uint64 bitsUp = (mantissaUp | (static_cast<uint64>(power2Up) << static_cast<uint32>(mantissaBits)));
+                if (bits != bitsUp) {
+                    ok = (bitsUp == (bits + 1u));
+                    if (ok) {
+                        ok = RoundDecimalExactly<T>(&input[digitsStart], explicitExponent, bits);
+                    }
+                    power2 = static_cast<int32>(bits >> static_cast<uint32>(mantissaBits));
+                    mantissa = (bits & ((static_cast<uint64>(1u) << static_cast<uint32>(mantissaBits)) - 1u));
+                }
+            }
+            if (ok) {
+                ok = (power2 != FloatFormat<T>::infinitePower);
+            }
+            if (ok) {
+                AssembleFloat(number, isNegative, mantissa, power2);
+            }
+        }
+    }
+    return ok;
+}
+
 /**
  * @brief Given number and exponent performs the operation number*(10^exponent).
  * @param[in,out] number is the float number in input which will be multiplied with 10^exponent.
@@ -312,7 +1627,8 @@ static bool StringToNormalFloatPrivate(const char8 * const input,
 }
 
 /**
- * @brief In case of number in hexadecimal, octal or binary format, converts it to a float number, otherwise calls StringToNormalFloatPrivate(*).
+ * @brief In case of number in hexadecimal, octal or binary format, converts it to a float number, otherwise calls StringToFloatFast(*)
+ * and, if it cannot convert the token, StringToNormalFloatPrivate(*).
  */
 /*lint -e{1573} [MISRA C++ Rule 14-5-1]. Justification: MARTe::HighResolutionTimerCalibrator is not a possible argument for this function template.*/
 template<typename T>
@@ -330,11 +1646,17 @@ static bool StringToFloatPrivate(const char8 * const input,
             }
         }
         else {
-            ret = StringToNormalFloatPrivate(input, number);
+            ret = StringToFloatFast(input, number);
+            if (!ret) {
+                ret = StringToNormalFloatPrivate(input, number);
+            }
         }
     }
     else {
-        ret = StringToNormalFloatPrivate(input, number);
+        ret = StringToFloatFast(input, number);
+        if (!ret) {
+            ret = StringToNormalFloatPrivate(input, number);
+        }
     }
     return ret;
 }
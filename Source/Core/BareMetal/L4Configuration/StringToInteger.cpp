@@ -180,6 +180,103 @@ static bool StringToIntegerDecimalNotation(const char8* const input,
     return ret;
 }
 
+/**
+ * @brief Converts eight ASCII decimal digits to their value.
+ * @details The digits are loaded in a 64 bits word (the first digit in the least significant byte) and combined in pairs,
+ * then in groups of four and finally of eight with three multiplications, instead of eight dependent multiply-add steps.
+ * @param[in] digits the eight characters, all in [0-9].
+ * @return the value of the eight digits.
+ */
+static uint64 EightDigitsToInteger(const char8 * const digits) {
+    uint64 word = 0u;
+    for (uint32 k = 8u; k > 0u; k--) {
+        word = (word << 8u) | static_cast<uint64>(static_cast<uint8>(digits[k - 1u]));
+    }
+    word -= 0x3030303030303030LLU;
+    //10 * first + second in each 16 bits
+    word = ((word * 2561u) >> 8u) & 0x00FF00FF00FF00FFLLU;
+    //100 * first + second in each 32 bits
+    word = ((word * 6553601u) >> 16u) & 0x0000FFFF0000FFFFLLU;
+    //10000 * first + second
+    word = ((word * 42949672960001LLU) >> 32u);
+    return word;
+}
+
+/**
+ * @brief Converts a 0-terminated C-String token in decimal notation (with an optional sign) fitting in a 64 bits integer.
+ * @details The (up to 19) digits are converted eight at a time (see EightDigitsToInteger) and the result is checked once
+ * against the range of the output type.
+ * @param[in] input is the token to be converted.
+ * @param[out] number is the conversion result in output.
+ * @return true if the token was converted. false if the token is empty, has more than 19 digits, has an invalid character,
+ * does not fit in the output type or is negative and the output type is unsigned, in which case it has to be converted by
+ * StringToIntegerDecimalNotation(*), which reports the error. Nothing is reported by this function.
+ */
+/*lint -e{1573} [MISRA C++ Rule 14-5-1]. Justification: MARTe::HighResolutionTimerCalibrator is not a possible argument for this function template.*/
+template<typename T>
+static bool StringToIntegerDecimalFast(const char8 * const input,
+                                       T &number) {
+    uint32 i = 0u;
+    bool isSigned = (static_cast<T>(-1) < static_cast<T>(0));
+    bool isNegative = false;
+    if (input[i] == '-') {
+        i++;
+        isNegative = true;
+    }
+    else {
+        if (input[i] == '+') {
+            i++;
+        }
+    }
+    const char8 * const digits = &input[i];
+    uint32 numberOfDigits = 0u;
+    while ((numberOfDigits < 20u) && (digits[numberOfDigits] >= '0') && (digits[numberOfDigits] <= '9')) {
+        numberOfDigits++;
+    }
+    bool ret = ((numberOfDigits > 0u) && (numberOfDigits < 20u) && (digits[numberOfDigits] == '\0'));
+    if (ret) {
+        ret = ((!isNegative) || (isSigned));
+    }
+    if (ret) {
+        uint64 value = 0u;
+        uint32 j = 0u;
+        while ((j + 8u) <= numberOfDigits) {
+            value = (value * 100000000u) + EightDigitsToInteger(&digits[j]);
+            j += 8u;
+        }
+        while (j < numberOfDigits) {
+            value = (value * 10u) + static_cast<uint64>(static_cast<uint8>(digits[j]) - static_cast<uint8>('0'));
+            j++;
+        }
+        T maxmax = static_cast<T>(-1);
+        if (isSigned) {
+            maxmax = Shift::LogicalRightSafeShift(maxmax, 1u);
+        }
+        uint64 max = static_cast<uint64>(maxmax);
+        if (isNegative) {
+            //the minimum negative number 0x800...
+            ret = (value <= (max + 1u));
+            if (ret) {
+                if (value > 0u) {
+                    /*lint -e{732} -e{501} -e{9134}  [MISRA C++ Rule 5-3-2]. Justification: the type is signed. */
+                    number = -static_cast<T>(value - 1u);
+                    number--;
+                }
+                else {
+                    number = static_cast<T>(0);
+                }
+            }
+        }
+        else {
+            ret = (value <= max);
+            if (ret) {
+                number = static_cast<T>(value);
+            }
+        }
+    }
+    return ret;
+}
+
 /**
  * @brief Converts a 0-terminated C-String token representing an integer in hexadecimal notation to an integer.
  * @param[in] input is the token to be converted.
@@ -400,7 +497,7 @@ static bool StringToIntegerBinaryNotation(const char8* const input,
  * @return false if the token does not represent an integer in the known notations.
  * @pre
  *   input must represent an integer. The print notation is recognized by the header at the beginning;
- *   "" : (no header) Decimal notation;
+ *   "" : (no header) Decimal notation (see StringToIntegerDecimalFast and StringToIntegerDecimalNotation);
  *   "0x": Hexadecimal notation;
  *   "0o": Octal notation;
  *   "0b": Binary notation;
@@ -440,8 +537,10 @@ static bool StringToInteger(const char8 * const input,
         }
     }
     else {
-        ret = StringToIntegerDecimalNotation(input, number);
-
+        ret = StringToIntegerDecimalFast(input, number);
+        if (!ret) {
+            ret = StringToIntegerDecimalNotation(input, number);
+        }
     }
 
     return ret;
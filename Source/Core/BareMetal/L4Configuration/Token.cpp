@@ -70,6 +70,16 @@ Token::~Token() {
 
 }
 
+void Token::Set(const uint32 id,
+                const char8 * const description,
+                const char8 * const data,
+                const uint32 lineNumber) {
+    tokenId = id;
+    tokenDescription = description;
+    tokenData = data;
+    tokenLineNumber = lineNumber;
+}
+
 uint32 Token::GetId() const {
     return tokenId;
 }
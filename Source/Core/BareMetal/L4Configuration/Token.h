@@ -90,6 +90,24 @@ public:
      */
     ~Token();
 
+    /**
+     * @brief Replaces all the information of the token, reusing the memory already
+     * allocated for the description and for the data.
+     * @param[in] id is the token identifier.
+     * @param[in] description is the token description.
+     * @param[in] data is the token data.
+     * @param[in] lineNumber is the line number of the token in the stream.
+     * @post
+     *   GetId() == id &&
+     *   GetDescription() == description &&
+     *   GetData() == data &&
+     *   GetLineNumber() == lineNumber;
+     */
+    void Set(const uint32 id,
+             const char8 * const description,
+             const char8 * const data,
+             const uint32 lineNumber);
+
     /**
      * @brief Retrieves the token identifier.
      * @return the token identifier.
@@ -38,6 +38,7 @@
 #include "StreamString.h"
 #include "StructuredDataI.h"
 #include "TypeConversion.h"
+#include "TypeConversionKernels.h"
 #include "ValidateBasicType.h"
 
 /*---------------------------------------------------------------------------*/
@@ -920,6 +921,20 @@ static bool ScalarBasicTypeConvert(const AnyType &destination, const AnyType &so
     return ret;
 }
 
+/**
+ * @brief Gets the bulk conversion kernel for the elements of two basic type arrays.
+ * @param[in] destination the destination array.
+ * @param[in] source the source array.
+ * @return the kernel (see TypeConversionKernels::Find) or NULL if the elements are not byte aligned numbers.
+ */
+static TypeConversionKernel FindKernel(const AnyType &destination, const AnyType &source) {
+    TypeConversionKernel kernel = NULL_PTR(TypeConversionKernel);
+    if ((destination.GetBitAddress() == 0u) && (source.GetBitAddress() == 0u)) {
+        kernel = TypeConversionKernels::Find(destination.GetTypeDescriptor(), source.GetTypeDescriptor());
+    }
+    return kernel;
+}
+
 /**
  * @brief Performs the conversion from a vector to a vector.
  * @param[out] destination is the converted vector in output.
@@ -938,6 +953,12 @@ static bool VectorBasicTypeConvert(const AnyType &destination, const AnyType &so
     if (source.GetTypeDescriptor() == Character8Bit) {
         numberOfElements = source.GetNumberOfElements(1u);
     }
+    // Contiguous arrays of numbers are converted in bulk
+    TypeConversionKernel kernel = FindKernel(destination, source);
+    if (kernel != NULL_PTR(TypeConversionKernel)) {
+        ok = kernel(destination.GetDataPointer(), source.GetDataPointer(), numberOfElements);
+        numberOfElements = 0u;
+    }
     // Assume that the number of dimensions is equal
     for (uint32 idx = 0u; (idx < numberOfElements); idx++) {
         uint32 sourceElementByteSize = static_cast<uint32>(source.GetByteSize());
@@ -1033,6 +1054,12 @@ static bool StaticToStaticMatrix(const AnyType &destination, const AnyType &sour
     void *destinationPointer = destination.GetDataPointer();
 
     bool ok = true;
+    // The rows of static matrices of numbers are contiguous and converted in bulk
+    TypeConversionKernel kernel = FindKernel(destination, source);
+    if (kernel != NULL_PTR(TypeConversionKernel)) {
+        ok = kernel(destinationPointer, sourcePointer, numberOfRows * numberOfColumns);
+        numberOfRows = 0u;
+    }
     for (uint32 r = 0u; (r < numberOfRows); r++) {
 
         char8* sourceArray = reinterpret_cast<char8 *>(sourcePointer);
@@ -0,0 +1,702 @@
+/**
+ * @file TypeConversionKernels.cpp
+ * @brief Source file for the TypeConversionKernels functions
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the TypeConversionKernels functions.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "CPUFeatures.h"
+#include "MemoryOperationsHelper.h"
+#include "TypeCharacteristics.h"
+#include "TypeConversionKernels.h"
+
+//After CPUFeatures.h, which tells if the compiler can generate the SVE kernels
+#ifdef MARTe2_SVE_KERNELS
+#include <arm_sve.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+using namespace MARTe;
+
+/**
+ * The number of types with a kernel: (u)int{8,16,32,64} and float{32,64}.
+ */
+const uint32 NUMBER_OF_KERNEL_TYPES = 10u;
+
+/**
+ * @brief Compile time information about the types with a kernel.
+ */
+template<typename T>
+struct KernelTraits {
+    /**
+     * True if T is a float type.
+     */
+    static const bool isFloat = false;
+};
+
+template<>
+struct KernelTraits<float32> {
+    static const bool isFloat = true;
+};
+
+template<>
+struct KernelTraits<float64> {
+    static const bool isFloat = true;
+};
+
+/**
+ * @brief Converts a float to an integer as FloatToInteger (see FloatToInteger.cpp) does.
+ * @param[in] floatNumber the float to convert.
+ * @param[in,out] saturated set to true if the float does not fit in the integer type.
+ * @return the float rounded to the nearest integer (half away from zero) and saturated to the range of IntegerType.
+ */
+template<typename IntegerType, typename FloatType>
+inline IntegerType RoundAndSaturate(const FloatType floatNumber,
+                                    bool &saturated) {
+    const IntegerType max = TypeCharacteristics<IntegerType>::MaxValue();
+    const IntegerType min = TypeCharacteristics<IntegerType>::MinValue();
+    IntegerType integerNumber = static_cast<IntegerType>(0);
+    if ((TypeCharacteristics<IntegerType>::IsSigned()) || (floatNumber > static_cast<FloatType>(0.0))) {
+        if (floatNumber >= static_cast<FloatType>(max)) {
+            saturated = true;
+            integerNumber = max;
+        }
+        else if (floatNumber <= static_cast<FloatType>(min)) {
+            saturated = true;
+            integerNumber = min;
+        }
+        else {
+            integerNumber = static_cast<IntegerType>(floatNumber);
+            FloatType remainder = floatNumber - static_cast<FloatType>(integerNumber);
+            if (remainder >= static_cast<FloatType>(0.5)) {
+                if (integerNumber < max) {
+                    integerNumber++;
+                }
+            }
+            else if (remainder <= static_cast<FloatType>(-0.5)) {
+                if (integerNumber > min) {
+                    integerNumber--;
+                }
+            }
+            else {
+                //NOOP
+            }
+        }
+    }
+    else {
+        //Negative (or NaN) to unsigned
+        saturated = true;
+    }
+    return integerNumber;
+}
+
+/**
+ * @brief Converts the first elements of an array with vector instructions.
+ * @details This is the generic version, which does not convert any element.
+ * The overloads below are used for the type pairs that have a vectorised kernel.
+ * @param[out] destination the converted elements.
+ * @param[in] source the elements to convert.
+ * @param[in] numberOfElements the number of elements in the arrays.
+ * @param[in,out] saturated set to true if any of the converted elements was saturated.
+ * @return the number of converted elements (starting from the first).
+ */
+template<typename DestinationType, typename SourceType>
+inline uint32 VectorConvert(DestinationType * const destination,
+                            const SourceType * const source,
+                            const uint32 numberOfElements,
+                            bool &saturated) {
+    return 0u;
+}
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+
+inline uint32 VectorConvert(float32 * const destination,
+                            const int8 * const source,
+                            const uint32 numberOfElements,
+                            bool &saturated) {
+    uint32 i = 0u;
+    while ((i + 16u) <= numberOfElements) {
+        int8x16_t x = vld1q_s8(&source[i]);
+        int16x8_t low = vmovl_s8(vget_low_s8(x));
+        int16x8_t high = vmovl_high_s8(x);
+        vst1q_f32(&destination[i], vcvtq_f32_s32(vmovl_s16(vget_low_s16(low))));
+        vst1q_f32(&destination[i + 4u], vcvtq_f32_s32(vmovl_high_s16(low)));
+        vst1q_f32(&destination[i + 8u], vcvtq_f32_s32(vmovl_s16(vget_low_s16(high))));
+        vst1q_f32(&destination[i + 12u], vcvtq_f32_s32(vmovl_high_s16(high)));
+        i += 16u;
+    }
+    return i;
+}
+
+inline uint32 VectorConvert(float32 * const destination,
+                            const uint8 * const source,
+                            const uint32 numberOfElements,
+                            bool &saturated) {
+    uint32 i = 0u;
+    while ((i + 16u) <= numberOfElements) {
+        uint8x16_t x = vld1q_u8(&source[i]);
+        uint16x8_t low = vmovl_u8(vget_low_u8(x));
+        uint16x8_t high = vmovl_high_u8(x);
+        vst1q_f32(&destination[i], vcvtq_f32_u32(vmovl_u16(vget_low_u16(low))));
+        vst1q_f32(&destination[i + 4u], vcvtq_f32_u32(vmovl_high_u16(low)));
+        vst1q_f32(&destination[i + 8u], vcvtq_f32_u32(vmovl_u16(vget_low_u16(high))));
+        vst1q_f32(&destination[i + 12u], vcvtq_f32_u32(vmovl_high_u16(high)));
+        i += 16u;
+    }
+    return i;
+}
+
+inline uint32 VectorConvert(float32 * const destination,
+                            const int16 * const source,
+                            const uint32 numberOfElements,
+                            bool &saturated) {
+    uint32 i = 0u;
+    while ((i + 8u) <= numberOfElements) {
+        int16x8_t x = vld1q_s16(&source[i]);
+        vst1q_f32(&destination[i], vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))));
+        vst1q_f32(&destination[i + 4u], vcvtq_f32_s32(vmovl_high_s16(x)));
+        i += 8u;
+    }
+    return i;
+}
+
+inline uint32 VectorConvert(float32 * const destination,
+                            const uint16 * const source,
+                            const uint32 numberOfElements,
+                            bool &saturated) {
+    uint32 i = 0u;
+    while ((i + 8u) <= numberOfElements) {
+        uint16x8_t x = vld1q_u16(&source[i]);
+        vst1q_f32(&destination[i], vcvtq_f32_u32(vmovl_u16(vget_low_u16(x))));
+        vst1q_f32(&destination[i + 4u], vcvtq_f32_u32(vmovl_high_u16(x)));
+        i += 8u;
+    }
+    return i;
+}
+
+inline uint32 VectorConvert(float32 * const destination,
+                            const int32 * const source,
+                            const uint32 numberOfElements,
+                            bool &saturated) {
+    uint32 i = 0u;
+    while ((i + 4u) <= numberOfElements) {
+        vst1q_f32(&destination[i], vcvtq_f32_s32(vld1q_s32(&source[i])));
+        i += 4u;
+    }
+    return i;
+}
+
+inline uint32 VectorConvert(float32 * const destination,
+                            const uint32 * const source,
+                            const uint32 numberOfElements,
+                            bool &saturated) {
+    uint32 i = 0u;
+    while ((i + 4u) <= numberOfElements) {
+        vst1q_f32(&destination[i], vcvtq_f32_u32(vld1q_u32(&source[i])));
+        i += 4u;
+    }
+    return i;
+}
+
+/* The float to integer kernels round with FCVTA (to nearest, ties away from zero) and saturate as RoundAndSaturate.
+ * The saturation flags are the same comparisons of RoundAndSaturate, accumulated over the whole array. */
+
+inline uint32 VectorConvert(int32 * const destination,
+                            const float32 * const source,
+                            const uint32 numberOfElements,
+                            bool &saturated) {
+    const float32x4_t maxValue = vdupq_n_f32(static_cast<float32>(TypeCharacteristics<int32>::MaxValue()));
+    const float32x4_t minValue = vdupq_n_f32(static_cast<float32>(TypeCharacteristics<int32>::MinValue()));
+    uint32x4_t outOfRange = vdupq_n_u32(0u);
+    uint32 i = 0u;
+    while ((i + 4u) <= numberOfElements) {
+        float32x4_t x = vld1q_f32(&source[i]);
+        outOfRange = vorrq_u32(outOfRange, vorrq_u32(vcgeq_f32(x, maxValue), vcleq_f32(x, minValue)));
+        vst1q_s32(&destination[i], vcvtaq_s32_f32(x));
+        i += 4u;
+    }
+    if (vmaxvq_u32(outOfRange) != 0u) {
+        saturated = true;
+    }
+    return i;
+}
+
+inline uint32 VectorConvert(uint32 * const destination,
+                            const float32 * const source,
+                            const uint32 numberOfElements,
+                            bool &saturated) {
+    const float32x4_t maxValue = vdupq_n_f32(static_cast<float32>(TypeCharacteristics<uint32>::MaxValue()));
+    const float32x4_t zero = vdupq_n_f32(0.0F);
+    uint32x4_t outOfRange = vdupq_n_u32(0u);
+    uint32 i = 0u;
+    while ((i + 4u) <= numberOfElements) {
+        float32x4_t x = vld1q_f32(&source[i]);
+        //!(x > 0) also flags the NaN
+        outOfRange = vorrq_u32(outOfRange, vorrq_u32(vcgeq_f32(x, maxValue), vmvnq_u32(vcgtq_f32(x, zero))));
+        vst1q_u32(&destination[i], vcvtaq_u32_f32(x));
+        i += 4u;
+    }
+    if (vmaxvq_u32(outOfRange) != 0u) {
+        saturated = true;
+    }
+    return i;
+}
+
+inline uint32 VectorConvert(int16 * const destination,
+                            const float32 * const source,
+                            const uint32 numberOfElements,
+                            bool &saturated) {
+    const float32x4_t maxValue = vdupq_n_f32(static_cast<float32>(TypeCharacteristics<int16>::MaxValue()));
+    const float32x4_t minValue = vdupq_n_f32(static_cast<float32>(TypeCharacteristics<int16>::MinValue()));
+    uint32x4_t outOfRange = vdupq_n_u32(0u);
+    uint32 i = 0u;
+    while ((i + 8u) <= numberOfElements) {
+        float32x4_t low = vld1q_f32(&source[i]);
+        float32x4_t high = vld1q_f32(&source[i + 4u]);
+        outOfRange = vorrq_u32(outOfRange, vorrq_u32(vcgeq_f32(low, maxValue), vcleq_f32(low, minValue)));
+        outOfRange = vorrq_u32(outOfRange, vorrq_u32(vcgeq_f32(high, maxValue), vcleq_f32(high, minValue)));
+        vst1q_s16(&destination[i], vqmovn_high_s32(vqmovn_s32(vcvtaq_s32_f32(low)), vcvtaq_s32_f32(high)));
+        i += 8u;
+    }
+    if (vmaxvq_u32(outOfRange) != 0u) {
+        saturated = true;
+    }
+    return i;
+}
+
+inline uint32 VectorConvert(uint16 * const destination,
+                            const float32 * const source,
+                            const uint32 numberOfElements,
+                            bool &saturated) {
+    const float32x4_t maxValue = vdupq_n_f32(static_cast<float32>(TypeCharacteristics<uint16>::MaxValue()));
+    const float32x4_t zero = vdupq_n_f32(0.0F);
+    uint32x4_t outOfRange = vdupq_n_u32(0u);
+    uint32 i = 0u;
+    while ((i + 8u) <= numberOfElements) {
+        float32x4_t low = vld1q_f32(&source[i]);
+        float32x4_t high = vld1q_f32(&source[i + 4u]);
+        outOfRange = vorrq_u32(outOfRange, vorrq_u32(vcgeq_f32(low, maxValue), vmvnq_u32(vcgtq_f32(low, zero))));
+        outOfRange = vorrq_u32(outOfRange, vorrq_u32(vcgeq_f32(high, maxValue), vmvnq_u32(vcgtq_f32(high, zero))));
+        vst1q_u16(&destination[i], vqmovn_high_u32(vqmovn_u32(vcvtaq_u32_f32(low)), vcvtaq_u32_f32(high)));
+        i += 8u;
+    }
+    if (vmaxvq_u32(outOfRange) != 0u) {
+        saturated = true;
+    }
+    return i;
+}
+
+#endif
+
+/**
+ * @brief Converts arrays with the SVE instructions.
+ * @details This is the generic version, which falls back to the VectorConvert of the type pair.
+ * The overloads below convert all the elements (the last iteration is predicated on the remaining elements).
+ * @see VectorConvert
+ */
+template<typename DestinationType, typename SourceType>
+inline uint32 SVEConvert(DestinationType * const destination,
+                         const SourceType * const source,
+                         const uint32 numberOfElements,
+                         bool &saturated) {
+    return VectorConvert(destination, source, numberOfElements, saturated);
+}
+
+#ifdef MARTe2_SVE_KERNELS
+
+/*lint -save -e9026 -e9024 function-like macros used only to define the SVE kernels.*/
+/* Integer to float: the integers are loaded (sign or zero extended) into lanes of the size of the float and converted.
+ * LoadType is the type of the load intrinsic (e.g. int64_t is long while int64 is long long). */
+#define SVE_INTEGER_TO_FLOAT(DestinationType, SourceType, LoadType, whilelt, count, load, convert, store) \
+__attribute__((target("+sve"))) \
+uint32 SVEConvert(DestinationType * const destination, \
+                  const SourceType * const source, \
+                  const uint32 numberOfElements, \
+                  bool &saturated) { \
+    uint32 i = 0u; \
+    svbool_t pg = whilelt(i, numberOfElements); \
+    while (svptest_any(svptrue_b8(), pg)) { \
+        store(pg, &destination[i], convert(pg, load(pg, reinterpret_cast<const LoadType *>(&source[i])))); \
+        i += static_cast<uint32>(count()); \
+        pg = whilelt(i, numberOfElements); \
+    } \
+    return numberOfElements; \
+}
+
+SVE_INTEGER_TO_FLOAT(float32, int8, int8_t, svwhilelt_b32, svcntw, svld1sb_s32, svcvt_f32_s32_x, svst1_f32)
+SVE_INTEGER_TO_FLOAT(float32, uint8, uint8_t, svwhilelt_b32, svcntw, svld1ub_u32, svcvt_f32_u32_x, svst1_f32)
+SVE_INTEGER_TO_FLOAT(float32, int16, int16_t, svwhilelt_b32, svcntw, svld1sh_s32, svcvt_f32_s32_x, svst1_f32)
+SVE_INTEGER_TO_FLOAT(float32, uint16, uint16_t, svwhilelt_b32, svcntw, svld1uh_u32, svcvt_f32_u32_x, svst1_f32)
+SVE_INTEGER_TO_FLOAT(float32, int32, int32_t, svwhilelt_b32, svcntw, svld1_s32, svcvt_f32_s32_x, svst1_f32)
+SVE_INTEGER_TO_FLOAT(float32, uint32, uint32_t, svwhilelt_b32, svcntw, svld1_u32, svcvt_f32_u32_x, svst1_f32)
+SVE_INTEGER_TO_FLOAT(float64, int8, int8_t, svwhilelt_b64, svcntd, svld1sb_s64, svcvt_f64_s64_x, svst1_f64)
+SVE_INTEGER_TO_FLOAT(float64, uint8, uint8_t, svwhilelt_b64, svcntd, svld1ub_u64, svcvt_f64_u64_x, svst1_f64)
+SVE_INTEGER_TO_FLOAT(float64, int16, int16_t, svwhilelt_b64, svcntd, svld1sh_s64, svcvt_f64_s64_x, svst1_f64)
+SVE_INTEGER_TO_FLOAT(float64, uint16, uint16_t, svwhilelt_b64, svcntd, svld1uh_u64, svcvt_f64_u64_x, svst1_f64)
+SVE_INTEGER_TO_FLOAT(float64, int32, int32_t, svwhilelt_b64, svcntd, svld1sw_s64, svcvt_f64_s64_x, svst1_f64)
+SVE_INTEGER_TO_FLOAT(float64, uint32, uint32_t, svwhilelt_b64, svcntd, svld1uw_u64, svcvt_f64_u64_x, svst1_f64)
+SVE_INTEGER_TO_FLOAT(float64, int64, int64_t, svwhilelt_b64, svcntd, svld1_s64, svcvt_f64_s64_x, svst1_f64)
+SVE_INTEGER_TO_FLOAT(float64, uint64, uint64_t, svwhilelt_b64, svcntd, svld1_u64, svcvt_f64_u64_x, svst1_f64)
+
+/* Float to integer: as the NEON kernels, rounded to nearest (ties away from zero), clamped to the range of the destination type
+ * (NaN gives 0) and stored (narrowing) from the 32 bit lanes. */
+#define SVE_FLOAT_TO_SIGNED(DestinationType, store) \
+__attribute__((target("+sve"))) \
+uint32 SVEConvert(DestinationType * const destination, \
+                  const float32 * const source, \
+                  const uint32 numberOfElements, \
+                  bool &saturated) { \
+    const float32 maxValue = static_cast<float32>(TypeCharacteristics<DestinationType>::MaxValue()); \
+    const float32 minValue = static_cast<float32>(TypeCharacteristics<DestinationType>::MinValue()); \
+    svbool_t outOfRange = svpfalse_b(); \
+    uint32 i = 0u; \
+    svbool_t pg = svwhilelt_b32(i, numberOfElements); \
+    while (svptest_any(svptrue_b8(), pg)) { \
+        svfloat32_t x = svld1_f32(pg, &source[i]); \
+        outOfRange = svorr_b_z(svptrue_b32(), outOfRange, svcmpge_n_f32(pg, x, maxValue)); \
+        outOfRange = svorr_b_z(svptrue_b32(), outOfRange, svcmple_n_f32(pg, x, minValue)); \
+        svfloat32_t y = svmax_n_f32_x(pg, svmin_n_f32_x(pg, svrinta_f32_x(pg, x), maxValue), minValue); \
+        store(pg, &destination[i], svcvt_s32_f32_x(pg, y)); \
+        i += static_cast<uint32>(svcntw()); \
+        pg = svwhilelt_b32(i, numberOfElements); \
+    } \
+    if (svptest_any(svptrue_b32(), outOfRange)) { \
+        saturated = true; \
+    } \
+    return numberOfElements; \
+}
+
+#define SVE_FLOAT_TO_UNSIGNED(DestinationType, store) \
+__attribute__((target("+sve"))) \
+uint32 SVEConvert(DestinationType * const destination, \
+                  const float32 * const source, \
+                  const uint32 numberOfElements, \
+                  bool &saturated) { \
+    const float32 maxValue = static_cast<float32>(TypeCharacteristics<DestinationType>::MaxValue()); \
+    svbool_t outOfRange = svpfalse_b(); \
+    uint32 i = 0u; \
+    svbool_t pg = svwhilelt_b32(i, numberOfElements); \
+    while (svptest_any(svptrue_b8(), pg)) { \
+        svfloat32_t x = svld1_f32(pg, &source[i]); \
+        outOfRange = svorr_b_z(svptrue_b32(), outOfRange, svcmpge_n_f32(pg, x, maxValue)); \
+        /* !(x > 0) also flags the NaN */ \
+        outOfRange = svorr_b_z(svptrue_b32(), outOfRange, svnot_b_z(pg, svcmpgt_n_f32(pg, x, 0.0F))); \
+        svfloat32_t y = svmax_n_f32_x(pg, svmin_n_f32_x(pg, svrinta_f32_x(pg, x), maxValue), 0.0F); \
+        store(pg, &destination[i], svcvt_u32_f32_x(pg, y)); \
+        i += static_cast<uint32>(svcntw()); \
+        pg = svwhilelt_b32(i, numberOfElements); \
+    } \
+    if (svptest_any(svptrue_b32(), outOfRange)) { \
+        saturated = true; \
+    } \
+    return numberOfElements; \
+}
+
+SVE_FLOAT_TO_SIGNED(int32, svst1_s32)
+SVE_FLOAT_TO_SIGNED(int16, svst1h_s32)
+SVE_FLOAT_TO_UNSIGNED(uint32, svst1_u32)
+SVE_FLOAT_TO_UNSIGNED(uint16, svst1h_u32)
+
+#undef SVE_FLOAT_TO_UNSIGNED
+#undef SVE_FLOAT_TO_SIGNED
+#undef SVE_INTEGER_TO_FLOAT
+/*lint -restore */
+
+#endif
+
+/**
+ * @brief The vector instructions of the baseline of the architecture (see VectorConvert).
+ */
+struct BaselineVectors {
+    template<typename DestinationType, typename SourceType>
+    static inline uint32 Convert(DestinationType * const destination,
+                                 const SourceType * const source,
+                                 const uint32 numberOfElements,
+                                 bool &saturated) {
+        return VectorConvert(destination, source, numberOfElements, saturated);
+    }
+};
+
+/**
+ * @brief The SVE instructions (see SVEConvert). Only used if CPUFeatures::Has(CPU_FEATURE_SVE).
+ */
+struct SVEVectors {
+    template<typename DestinationType, typename SourceType>
+    static inline uint32 Convert(DestinationType * const destination,
+                                 const SourceType * const source,
+                                 const uint32 numberOfElements,
+                                 bool &saturated) {
+        return SVEConvert(destination, source, numberOfElements, saturated);
+    }
+};
+
+/**
+ * @brief Converts arrays from SourceType to DestinationType.
+ * @details Specialised below for each combination of integer and float types. The first elements are converted with the
+ * Vectors (BaselineVectors or SVEVectors) and the remaining ones with a scalar loop.
+ */
+template<typename DestinationType, typename SourceType, bool isDestinationFloat, bool isSourceFloat, typename Vectors>
+struct KernelT;
+
+/**
+ * @brief Integer to integer: saturates silently, as BitSetToBitSet does.
+ */
+template<typename DestinationType, typename SourceType, typename Vectors>
+struct KernelT<DestinationType, SourceType, false, false, Vectors> {
+    static bool Convert(void * const destination,
+                        const void * const source,
+                        const uint32 numberOfElements) {
+        DestinationType * const out = static_cast<DestinationType *>(destination);
+        const SourceType * const in = static_cast<const SourceType *>(source);
+        bool saturated = false;
+        uint32 i;
+        for (i = Vectors::Convert(out, in, numberOfElements, saturated); i < numberOfElements; i++) {
+            out[i] = SaturateInteger<DestinationType, SourceType, static_cast<uint8>(sizeof(DestinationType) * 8u)>(in[i]);
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief Integer to float: all the integers are within the range of float32 and float64.
+ */
+template<typename DestinationType, typename SourceType, typename Vectors>
+struct KernelT<DestinationType, SourceType, true, false, Vectors> {
+    static bool Convert(void * const destination,
+                        const void * const source,
+                        const uint32 numberOfElements) {
+        DestinationType * const out = static_cast<DestinationType *>(destination);
+        const SourceType * const in = static_cast<const SourceType *>(source);
+        bool saturated = false;
+        uint32 i;
+        for (i = Vectors::Convert(out, in, numberOfElements, saturated); i < numberOfElements; i++) {
+            out[i] = static_cast<DestinationType>(in[i]);
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief Float to integer: see RoundAndSaturate.
+ */
+template<typename DestinationType, typename SourceType, typename Vectors>
+struct KernelT<DestinationType, SourceType, false, true, Vectors> {
+    static bool Convert(void * const destination,
+                        const void * const source,
+                        const uint32 numberOfElements) {
+        DestinationType * const out = static_cast<DestinationType *>(destination);
+        const SourceType * const in = static_cast<const SourceType *>(source);
+        bool saturated = false;
+        uint32 i;
+        for (i = Vectors::Convert(out, in, numberOfElements, saturated); i < numberOfElements; i++) {
+            out[i] = RoundAndSaturate<DestinationType>(in[i], saturated);
+        }
+        if (saturated) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "TypeConversionKernels: Saturation of float to integer elements");
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief Float to float: as FloatToFloat (see TypeConversion.cpp).
+ */
+template<typename DestinationType, typename SourceType, typename Vectors>
+struct KernelT<DestinationType, SourceType, true, true, Vectors> {
+    static bool Convert(void * const destination,
+                        const void * const source,
+                        const uint32 numberOfElements) {
+        DestinationType * const out = static_cast<DestinationType *>(destination);
+        const SourceType * const in = static_cast<const SourceType *>(source);
+        const DestinationType max = TypeCharacteristics<DestinationType>::MaxValue();
+        bool ok = true;
+        bool saturated = false;
+        uint32 i;
+        for (i = 0u; i < numberOfElements; i++) {
+            SourceType x = in[i];
+            if ((IsNaN(x)) || (IsInf(x))) {
+                out[i] = static_cast<DestinationType>(0.0);
+                ok = false;
+            }
+            else {
+                DestinationType y = static_cast<DestinationType>(x);
+                //Only possible from float64 to float32
+                if (IsInf(y)) {
+                    y = (x > static_cast<SourceType>(0.0)) ? (max) : (-max);
+                    saturated = true;
+                }
+                out[i] = y;
+            }
+        }
+        if (saturated) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "TypeConversionKernels: Saturation of float64 to float32 elements");
+        }
+        return ok;
+    }
+};
+
+/**
+ * @brief Copies arrays of the same type.
+ */
+template<typename T>
+bool CopyKernel(void * const destination,
+                const void * const source,
+                const uint32 numberOfElements) {
+    MemoryOperationsHelper::CopyUnchecked(destination, source, static_cast<uint32>(sizeof(T)) * numberOfElements);
+    return true;
+}
+
+/**
+ * @brief Gets the position of a type in the kernel tables.
+ * @param[in] typeDescriptor the type.
+ * @return the position of the type or NUMBER_OF_KERNEL_TYPES if there are no kernels for this type.
+ */
+uint32 KernelIndex(const TypeDescriptor &typeDescriptor) {
+    uint32 index = NUMBER_OF_KERNEL_TYPES;
+    if (!typeDescriptor.isStructuredData) {
+        uint32 position = NUMBER_OF_KERNEL_TYPES;
+        uint16 numberOfBits = typeDescriptor.numberOfBits;
+        if (numberOfBits == 8u) {
+            position = 0u;
+        }
+        else if (numberOfBits == 16u) {
+            position = 2u;
+        }
+        else if (numberOfBits == 32u) {
+            position = 4u;
+        }
+        else if (numberOfBits == 64u) {
+            position = 6u;
+        }
+        else {
+            //NOOP
+        }
+        if (position < NUMBER_OF_KERNEL_TYPES) {
+            if (typeDescriptor.type == SignedInteger) {
+                index = position;
+            }
+            else if (typeDescriptor.type == UnsignedInteger) {
+                index = position + 1u;
+            }
+            else if ((typeDescriptor.type == Float) && (position >= 4u)) {
+                //float32 -> 8, float64 -> 9
+                index = 8u + ((position - 4u) / 2u);
+            }
+            else {
+                //NOOP
+            }
+        }
+    }
+    return index;
+}
+
+/*lint -save -e9026 -e9024 function-like macros used only to build the kernel table.*/
+#define TYPE_CONVERSION_KERNEL(Vectors, DestinationType, SourceType) \
+    &KernelT<DestinationType, SourceType, KernelTraits<DestinationType>::isFloat, KernelTraits<SourceType>::isFloat, Vectors>::Convert
+#define TYPE_CONVERSION_KERNELS_ROW(Vectors, DestinationType) { \
+    TYPE_CONVERSION_KERNEL(Vectors, DestinationType, int8), TYPE_CONVERSION_KERNEL(Vectors, DestinationType, uint8), \
+    TYPE_CONVERSION_KERNEL(Vectors, DestinationType, int16), TYPE_CONVERSION_KERNEL(Vectors, DestinationType, uint16), \
+    TYPE_CONVERSION_KERNEL(Vectors, DestinationType, int32), TYPE_CONVERSION_KERNEL(Vectors, DestinationType, uint32), \
+    TYPE_CONVERSION_KERNEL(Vectors, DestinationType, int64), TYPE_CONVERSION_KERNEL(Vectors, DestinationType, uint64), \
+    TYPE_CONVERSION_KERNEL(Vectors, DestinationType, float32), TYPE_CONVERSION_KERNEL(Vectors, DestinationType, float64) }
+#define TYPE_CONVERSION_KERNELS_TABLE(Vectors) { \
+    TYPE_CONVERSION_KERNELS_ROW(Vectors, int8), \
+    TYPE_CONVERSION_KERNELS_ROW(Vectors, uint8), \
+    TYPE_CONVERSION_KERNELS_ROW(Vectors, int16), \
+    TYPE_CONVERSION_KERNELS_ROW(Vectors, uint16), \
+    TYPE_CONVERSION_KERNELS_ROW(Vectors, int32), \
+    TYPE_CONVERSION_KERNELS_ROW(Vectors, uint32), \
+    TYPE_CONVERSION_KERNELS_ROW(Vectors, int64), \
+    TYPE_CONVERSION_KERNELS_ROW(Vectors, uint64), \
+    TYPE_CONVERSION_KERNELS_ROW(Vectors, float32), \
+    TYPE_CONVERSION_KERNELS_ROW(Vectors, float64) }
+
+/**
+ * The kernels indexed by [KernelIndex(destination)][KernelIndex(source)].
+ */
+const TypeConversionKernel kernels[NUMBER_OF_KERNEL_TYPES][NUMBER_OF_KERNEL_TYPES] = TYPE_CONVERSION_KERNELS_TABLE(BaselineVectors);
+
+#ifdef MARTe2_SVE_KERNELS
+/**
+ * The kernels used if the processor implements SVE, indexed as the kernels.
+ */
+const TypeConversionKernel sveKernels[NUMBER_OF_KERNEL_TYPES][NUMBER_OF_KERNEL_TYPES] = TYPE_CONVERSION_KERNELS_TABLE(SVEVectors);
+#endif
+
+#undef TYPE_CONVERSION_KERNELS_TABLE
+#undef TYPE_CONVERSION_KERNELS_ROW
+#undef TYPE_CONVERSION_KERNEL
+/*lint -restore */
+
+/**
+ * The kernels used when the source and the destination have the same type, indexed by KernelIndex.
+ */
+const TypeConversionKernel copyKernels[NUMBER_OF_KERNEL_TYPES] = { &CopyKernel<int8>, &CopyKernel<uint8>, &CopyKernel<int16>, &CopyKernel<uint16>,
+        &CopyKernel<int32>, &CopyKernel<uint32>, &CopyKernel<int64>, &CopyKernel<uint64>, &CopyKernel<float32>, &CopyKernel<float64> };
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace TypeConversionKernels {
+
+TypeConversionKernel Find(const TypeDescriptor &destination,
+                          const TypeDescriptor &source) {
+    TypeConversionKernel kernel = NULL_PTR(TypeConversionKernel);
+    uint32 destinationIndex = KernelIndex(destination);
+    uint32 sourceIndex = KernelIndex(source);
+    if ((destinationIndex < NUMBER_OF_KERNEL_TYPES) && (sourceIndex < NUMBER_OF_KERNEL_TYPES)) {
+        if (destinationIndex == sourceIndex) {
+            kernel = copyKernels[destinationIndex];
+        }
+        else {
+            kernel = kernels[destinationIndex][sourceIndex];
+#ifdef MARTe2_SVE_KERNELS
+            if (CPUFeatures::Has(CPUFeatures::CPU_FEATURE_SVE)) {
+                kernel = sveKernels[destinationIndex][sourceIndex];
+            }
+#endif
+        }
+    }
+    return kernel;
+}
+
+}
+
+}
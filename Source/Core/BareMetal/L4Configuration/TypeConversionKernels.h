@@ -0,0 +1,90 @@
+/**
+ * @file TypeConversionKernels.h
+ * @brief Header file for the TypeConversionKernels functions
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the TypeConversionKernels functions
+ * which convert arrays of numeric types without the per element AnyType dispatch.
+ */
+
+#ifndef TYPECONVERSIONKERNELS_H_
+#define TYPECONVERSIONKERNELS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "TypeDescriptor.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Converts an array of contiguous numeric elements from one type to another.
+ * @param[out] destination the memory of the converted elements.
+ * @param[in] source the memory of the elements to convert. Shall not overlap with \a destination.
+ * @param[in] numberOfElements the number of elements to convert.
+ * @return false if any of the elements could not be converted.
+ */
+typedef bool (*TypeConversionKernel)(void * const destination,
+                                     const void * const source,
+                                     const uint32 numberOfElements);
+
+/**
+ * @brief Bulk conversion of arrays between the basic numeric types.
+ * @details A kernel is selected once for a pair of types (see Find) and can then be called on any number of elements,
+ * e.g. by a broker on every cycle. The result of each element is the same as the one of TypeConvert:
+ * - integer to integer saturates to the range of the destination type;
+ * - float to integer rounds to the nearest integer (half away from zero) and saturates to the range of the destination type;
+ * - integer to float rounds to the nearest float;
+ * - float to float fails on NaN and infinite elements and saturates when a float64 does not fit in a float32;
+ * - elements of the same type are copied.
+ *
+ * Saturations are reported once per call (instead of once per element, as TypeConvert does).
+ * The conversions from the 8, 16 and 32 bit integers to float32 and from float32 to the 16 and 32 bit integers are
+ * vectorised with NEON when available (__ARM_NEON), the others are plain loops
+ * specialised for the type pair. If the processor implements SVE (see CPUFeatures) the conversions between the integers
+ * (up to 32 bits, and 64 bits to float64) and the floats and from float32 to the 16 and 32 bit integers use SVE kernels instead, which
+ * also convert the remaining elements with a predicate.
+ */
+namespace TypeConversionKernels {
+
+/**
+ * @brief Gets the kernel that converts arrays from the \a source type to the \a destination type.
+ * @param[in] destination the type of the destination elements.
+ * @param[in] source the type of the source elements.
+ * @return the kernel or NULL if either type is not one of (u)int{8,16,32,64} or float{32,64}.
+ */
+DLL_API TypeConversionKernel Find(const TypeDescriptor &destination,
+                                  const TypeDescriptor &source);
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TYPECONVERSIONKERNELS_H_ */
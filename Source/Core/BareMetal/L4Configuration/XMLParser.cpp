@@ -107,6 +107,18 @@ XMLParser::XMLParser(StreamI &stream,
                      StructuredDataI &databaseIn,
                      BufferedStreamI * const err) :
         ConfigurationParserI(stream, databaseIn, err, XMLGrammar) {
+    InitialiseActions();
+}
+
+XMLParser::XMLParser(const char8 * const input,
+                     const uint32 inputSize,
+                     StructuredDataI &databaseIn,
+                     BufferedStreamI * const err) :
+        ConfigurationParserI(input, inputSize, databaseIn, err, XMLGrammar) {
+    InitialiseActions();
+}
+
+void XMLParser::InitialiseActions() {
     Action[0] = static_cast<void (XMLParser::*)(void)>(NULL);
     Action[1] = &XMLParser::End;
     Action[2] = &XMLParser::GetNodeName;
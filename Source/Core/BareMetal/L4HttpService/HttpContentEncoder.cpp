@@ -0,0 +1,1178 @@
+/**
+ * @file HttpContentEncoder.cpp
+ * @brief Source file for class HttpContentEncoder
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HttpContentEncoder (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "CRC32.h"
+#include "HttpContentEncoder.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The maximum distance of a match (the window holds two times this size).
+ */
+static const uint32 DEFLATE_WINDOW_SIZE = 32768u;
+static const uint32 DEFLATE_WINDOW_MASK = DEFLATE_WINDOW_SIZE - 1u;
+
+/**
+ * The number of hash chains.
+ */
+static const uint32 DEFLATE_HASH_BITS = 15u;
+static const uint32 DEFLATE_HASH_SIZE = (1u << DEFLATE_HASH_BITS);
+
+/**
+ * The minimum and maximum length of a match.
+ */
+static const uint32 DEFLATE_MIN_MATCH = 3u;
+static const uint32 DEFLATE_MAX_MATCH = 258u;
+
+/**
+ * The data which is looked ahead before searching for a match (so that a maximum length match and the next hash can be found).
+ */
+static const uint32 DEFLATE_MIN_LOOKAHEAD = (DEFLATE_MAX_MATCH + DEFLATE_MIN_MATCH) + 1u;
+
+/**
+ * The maximum distance of a match which keeps the next MIN_LOOKAHEAD bytes in the window.
+ */
+static const uint32 DEFLATE_MAX_DISTANCE = DEFLATE_WINDOW_SIZE - DEFLATE_MIN_LOOKAHEAD;
+
+/**
+ * Minimum length matches further than this are not worth encoding.
+ */
+static const uint32 DEFLATE_TOO_FAR = 4096u;
+
+/**
+ * The maximum number of literals and matches in a block.
+ */
+static const uint32 DEFLATE_BLOCK_TOKENS = 16384u;
+
+/**
+ * The maximum size of a stored block.
+ */
+static const uint32 DEFLATE_MAX_STORED = 65535u;
+
+/**
+ * The number of literal/length and distance symbols which can be used in a block.
+ */
+static const uint32 DEFLATE_LENGTH_CODES = 29u;
+static const uint32 DEFLATE_USED_LITERALS = 257u + DEFLATE_LENGTH_CODES;
+
+/**
+ * The end of block symbol.
+ */
+static const uint32 DEFLATE_END_OF_BLOCK = 256u;
+
+/**
+ * The maximum length of the literal/length and distance codes and of the code length codes.
+ */
+static const uint32 DEFLATE_MAX_BITS = 15u;
+static const uint32 DEFLATE_MAX_CODE_LENGTH_BITS = 7u;
+
+/**
+ * The first length of each length code and the number of extra bits.
+ */
+static const uint16 deflateLengthBase[DEFLATE_LENGTH_CODES] = { 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u, 13u, 15u, 17u, 19u, 23u, 27u, 31u, 35u, 43u,
+        51u, 59u, 67u, 83u, 99u, 115u, 131u, 163u, 195u, 227u, 258u };
+static const uint8 deflateLengthExtra[DEFLATE_LENGTH_CODES] = { 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 2u, 2u, 2u, 2u, 3u, 3u, 3u, 3u, 4u,
+        4u, 4u, 4u, 5u, 5u, 5u, 5u, 0u };
+
+/**
+ * The first distance of each distance code and the number of extra bits.
+ */
+static const uint16 deflateDistanceBase[HTTP_CONTENT_ENCODER_DISTANCES] = { 1u, 2u, 3u, 4u, 5u, 7u, 9u, 13u, 17u, 25u, 33u, 49u, 65u, 97u, 129u,
+        193u, 257u, 385u, 513u, 769u, 1025u, 1537u, 2049u, 3073u, 4097u, 6145u, 8193u, 12289u, 16385u, 24577u };
+static const uint8 deflateDistanceExtra[HTTP_CONTENT_ENCODER_DISTANCES] = { 0u, 0u, 0u, 0u, 1u, 1u, 2u, 2u, 3u, 3u, 4u, 4u, 5u, 5u, 6u, 6u, 7u, 7u,
+        8u, 8u, 9u, 9u, 10u, 10u, 11u, 11u, 12u, 12u, 13u, 13u };
+
+/**
+ * The order in which the code length code lengths are written.
+ */
+static const uint8 deflateCodeLengthOrder[HTTP_CONTENT_ENCODER_CODE_LENGTHS] = { 16u, 17u, 18u, 0u, 8u, 7u, 9u, 6u, 10u, 5u, 11u, 4u, 12u, 3u, 13u,
+        2u, 14u, 1u, 15u };
+
+/**
+ * The number of extra bits of the code length symbols 16 (repeat the previous length), 17 (short run of zeros) and 18 (long run of zeros).
+ */
+static const uint8 deflateCodeLengthExtra[HTTP_CONTENT_ENCODER_CODE_LENGTHS] = { 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 2u,
+        3u, 7u };
+
+/**
+ * @brief The match search parameters of a compression level.
+ */
+struct DeflateLevel {
+    /**
+     * See HttpContentEncoder::goodLength.
+     */
+    uint16 goodLength;
+    /**
+     * See HttpContentEncoder::maxLazy.
+     */
+    uint16 maxLazy;
+    /**
+     * See HttpContentEncoder::niceLength.
+     */
+    uint16 niceLength;
+    /**
+     * See HttpContentEncoder::maxChain.
+     */
+    uint16 maxChain;
+};
+
+/**
+ * The parameters of each level (the ones of zlib). The levels 1 to 3 are greedy.
+ */
+static const DeflateLevel deflateLevels[10] = { { 0u, 0u, 0u, 0u }, { 4u, 4u, 8u, 4u }, { 4u, 5u, 16u, 8u }, { 4u, 6u, 32u, 32u },
+        { 4u, 4u, 16u, 16u }, { 8u, 16u, 32u, 32u }, { 8u, 16u, 128u, 128u }, { 8u, 32u, 128u, 256u }, { 32u, 128u, 258u, 1024u }, { 32u, 258u,
+                258u, 4096u } };
+
+/**
+ * @brief Gets the index of the most significant bit set (value > 0).
+ */
+static inline uint32 DeflateLog2(uint32 value) {
+    uint32 n = 0u;
+    while (value > 1u) {
+        value >>= 1u;
+        n++;
+    }
+    return n;
+}
+
+/**
+ * @brief Gets the length code (0 to 28) of a match length - 3.
+ */
+static inline uint32 DeflateLengthCode(const uint32 length3) {
+    uint32 code;
+    if (length3 < 8u) {
+        code = length3;
+    }
+    else if (length3 == 255u) {
+        code = 28u;
+    }
+    else {
+        uint32 n = DeflateLog2(length3);
+        code = (4u * (n - 1u)) + ((length3 >> (n - 2u)) & 3u);
+    }
+    return code;
+}
+
+/**
+ * @brief Gets the distance code (0 to 29) of a match distance.
+ */
+static inline uint32 DeflateDistanceCode(const uint32 distance) {
+    uint32 d = distance - 1u;
+    uint32 code;
+    if (d < 4u) {
+        code = d;
+    }
+    else {
+        uint32 n = DeflateLog2(d);
+        code = (2u * n) + ((d >> (n - 1u)) & 1u);
+    }
+    return code;
+}
+
+/**
+ * @brief Computes the lengths of the Huffman code of \a numberOfSymbols symbols with the given frequencies, limited to \a maxBits bits.
+ * @details At least two symbols are given a code (as required by some decoders), also if less are used.
+ */
+static void DeflateCodeLengths(const uint32 * const frequencies,
+                               const uint32 numberOfSymbols,
+                               const uint32 maxBits,
+                               uint8 * const lengths) {
+    uint16 symbols[HTTP_CONTENT_ENCODER_LITERALS];
+    uint32 count = 0u;
+    uint32 i;
+    for (i = 0u; i < numberOfSymbols; i++) {
+        lengths[i] = 0u;
+        if (frequencies[i] > 0u) {
+            symbols[count] = static_cast<uint16>(i);
+            count++;
+        }
+    }
+    if (count < 2u) {
+        uint32 first = 0u;
+        if (count == 1u) {
+            first = symbols[0];
+        }
+        lengths[first] = 1u;
+        lengths[(first == 0u) ? 1u : 0u] = 1u;
+    }
+    else {
+        //Sorted by increasing frequency (and symbol)
+        for (i = 1u; i < count; i++) {
+            uint16 s = symbols[i];
+            uint32 j = i;
+            while ((j > 0u) && (frequencies[symbols[j - 1u]] > frequencies[s])) {
+                symbols[j] = symbols[j - 1u];
+                j--;
+            }
+            symbols[j] = s;
+        }
+        //Huffman tree with two queues: the sorted leaves (0 to count - 1) and the internal nodes, which are created in increasing
+        //weight order (count to 2 * count - 2, the last one being the root)
+        uint32 weights[2u * HTTP_CONTENT_ENCODER_LITERALS];
+        uint16 parents[2u * HTTP_CONTENT_ENCODER_LITERALS];
+        for (i = 0u; i < count; i++) {
+            weights[i] = frequencies[symbols[i]];
+        }
+        uint32 nextLeaf = 0u;
+        uint32 nextNode = count;
+        uint32 newNode = count;
+        while (newNode < ((2u * count) - 1u)) {
+            uint32 weight = 0u;
+            uint32 k;
+            for (k = 0u; k < 2u; k++) {
+                uint32 smallest;
+                if ((nextLeaf < count) && ((nextNode >= newNode) || (weights[nextLeaf] <= weights[nextNode]))) {
+                    smallest = nextLeaf;
+                    nextLeaf++;
+                }
+                else {
+                    smallest = nextNode;
+                    nextNode++;
+                }
+                parents[smallest] = static_cast<uint16>(newNode);
+                weight += weights[smallest];
+            }
+            weights[newNode] = weight;
+            newNode++;
+        }
+        //The depths (reusing weights) from the root downwards, the parents having a larger index
+        uint32 root = (2u * count) - 2u;
+        uint32 lengthCounts[2u * HTTP_CONTENT_ENCODER_LITERALS];
+        for (i = 0u; i < (2u * HTTP_CONTENT_ENCODER_LITERALS); i++) {
+            lengthCounts[i] = 0u;
+        }
+        weights[root] = 0u;
+        uint32 maxDepth = 0u;
+        i = root;
+        while (i > 0u) {
+            i--;
+            weights[i] = weights[parents[i]] + 1u;
+            if (i < count) {
+                lengthCounts[weights[i]]++;
+                if (weights[i] > maxDepth) {
+                    maxDepth = weights[i];
+                }
+            }
+        }
+        //Limits the lengths keeping the code complete: two leaves at the deepest level are replaced by their parent and one of them
+        //becomes the sibling of a shallower leaf, which goes one level down
+        uint32 depth;
+        for (depth = maxDepth; depth > maxBits; depth--) {
+            while (lengthCounts[depth] > 0u) {
+                uint32 j = depth - 2u;
+                while (lengthCounts[j] == 0u) {
+                    j--;
+                }
+                lengthCounts[depth] -= 2u;
+                lengthCounts[depth - 1u]++;
+                lengthCounts[j + 1u] += 2u;
+                lengthCounts[j]--;
+            }
+        }
+        //The least frequent symbols get the longest codes
+        uint32 s = 0u;
+        for (depth = maxBits; depth > 0u; depth--) {
+            uint32 n;
+            for (n = 0u; n < lengthCounts[depth]; n++) {
+                lengths[symbols[s]] = static_cast<uint8>(depth);
+                s++;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Computes the canonical Huffman codes (bit reversed, as they are written least significant bit first) from the code lengths.
+ */
+static void DeflateCodes(const uint8 * const lengths,
+                         const uint32 numberOfSymbols,
+                         uint16 * const codes) {
+    uint32 lengthCounts[DEFLATE_MAX_BITS + 1u];
+    uint32 nextCodes[DEFLATE_MAX_BITS + 1u];
+    uint32 i;
+    for (i = 0u; i <= DEFLATE_MAX_BITS; i++) {
+        lengthCounts[i] = 0u;
+    }
+    for (i = 0u; i < numberOfSymbols; i++) {
+        lengthCounts[lengths[i]]++;
+    }
+    lengthCounts[0] = 0u;
+    uint32 code = 0u;
+    nextCodes[0] = 0u;
+    for (i = 1u; i <= DEFLATE_MAX_BITS; i++) {
+        code = (code + lengthCounts[i - 1u]) << 1u;
+        nextCodes[i] = code;
+    }
+    for (i = 0u; i < numberOfSymbols; i++) {
+        uint32 length = lengths[i];
+        codes[i] = 0u;
+        if (length > 0u) {
+            uint32 c = nextCodes[length];
+            nextCodes[length]++;
+            uint32 reversed = 0u;
+            uint32 b;
+            for (b = 0u; b < length; b++) {
+                reversed = (reversed << 1u) | (c & 1u);
+                c >>= 1u;
+            }
+            codes[i] = static_cast<uint16>(reversed);
+        }
+    }
+}
+
+/**
+ * @brief Updates a running Adler-32 with \a size bytes of \a data.
+ */
+static uint32 DeflateAdler32(const uint32 adler,
+                             const uint8 *data,
+                             uint32 size) {
+    uint32 a = adler & 0xFFFFu;
+    uint32 b = adler >> 16u;
+    while (size > 0u) {
+        //The largest number of bytes which cannot overflow b
+        uint32 n = (size > 5552u) ? 5552u : size;
+        size -= n;
+        while (n > 0u) {
+            a += *data;
+            b += a;
+            data++;
+            n--;
+        }
+        a %= 65521u;
+        b %= 65521u;
+    }
+    return (b << 16u) | a;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+HttpContentEncoder::HttpContentEncoder() {
+    window = NULL_PTR(uint8 *);
+    head = NULL_PTR(uint16 *);
+    previous = NULL_PTR(uint16 *);
+    tokenLiterals = NULL_PTR(uint8 *);
+    tokenDistances = NULL_PTR(uint16 *);
+    numberOfTokens = 0u;
+    windowEnd = 0u;
+    position = 0u;
+    blockStart = 0u;
+    previousLength = 0u;
+    previousDistance = 0u;
+    matchAvailable = false;
+    encoding = HTTP_CONTENT_ENCODING_IDENTITY;
+    maxChain = 0u;
+    niceLength = 0u;
+    maxLazy = 0u;
+    goodLength = 0u;
+    greedy = true;
+    started = false;
+    headerWritten = false;
+    checksum = 0u;
+    dataSize = 0u;
+    bitBuffer = 0u;
+    bitCount = 0u;
+    outputSize = 0u;
+}
+
+HttpContentEncoder::~HttpContentEncoder() {
+    if (window != NULL_PTR(uint8 *)) {
+        delete[] window;
+    }
+    if (head != NULL_PTR(uint16 *)) {
+        delete[] head;
+    }
+    if (previous != NULL_PTR(uint16 *)) {
+        delete[] previous;
+    }
+    if (tokenLiterals != NULL_PTR(uint8 *)) {
+        delete[] tokenLiterals;
+    }
+    if (tokenDistances != NULL_PTR(uint16 *)) {
+        delete[] tokenDistances;
+    }
+}
+
+bool HttpContentEncoder::Start(const uint32 encodingIn,
+                               const uint32 levelIn) {
+    Reset();
+    bool ok = ((encodingIn == HTTP_CONTENT_ENCODING_GZIP) || (encodingIn == HTTP_CONTENT_ENCODING_DEFLATE));
+    if (ok) {
+        ok = (levelIn <= 9u);
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "HttpContentEncoder: invalid encoding %u or level %u", encodingIn, levelIn);
+    }
+    if ((ok) && (window == NULL_PTR(uint8 *))) {
+        window = new uint8[2u * DEFLATE_WINDOW_SIZE];
+        head = new uint16[DEFLATE_HASH_SIZE];
+        previous = new uint16[DEFLATE_WINDOW_SIZE];
+        tokenLiterals = new uint8[DEFLATE_BLOCK_TOKENS];
+        tokenDistances = new uint16[DEFLATE_BLOCK_TOKENS];
+    }
+    if (ok) {
+        encoding = encodingIn;
+        goodLength = deflateLevels[levelIn].goodLength;
+        maxLazy = deflateLevels[levelIn].maxLazy;
+        niceLength = deflateLevels[levelIn].niceLength;
+        maxChain = deflateLevels[levelIn].maxChain;
+        greedy = (levelIn < 4u);
+        (void) MemoryOperationsHelper::Set(head, '\0', static_cast<uint32>(DEFLATE_HASH_SIZE * sizeof(uint16)));
+        checksum = (encoding == HTTP_CONTENT_ENCODING_GZIP) ? 0xFFFFFFFFu : 1u;
+        started = true;
+    }
+    return ok;
+}
+
+void HttpContentEncoder::Reset() {
+    numberOfTokens = 0u;
+    windowEnd = 0u;
+    position = 0u;
+    blockStart = 0u;
+    previousLength = DEFLATE_MIN_MATCH - 1u;
+    previousDistance = 0u;
+    matchAvailable = false;
+    started = false;
+    headerWritten = false;
+    dataSize = 0u;
+    bitBuffer = 0u;
+    bitCount = 0u;
+    outputSize = 0u;
+    uint32 i;
+    for (i = 0u; i < HTTP_CONTENT_ENCODER_LITERALS; i++) {
+        literalFrequencies[i] = 0u;
+    }
+    for (i = 0u; i < HTTP_CONTENT_ENCODER_DISTANCES; i++) {
+        distanceFrequencies[i] = 0u;
+    }
+}
+
+bool HttpContentEncoder::IsStarted() const {
+    return started;
+}
+
+bool HttpContentEncoder::Compress(const char8 * const data,
+                                  const uint32 size,
+                                  StreamI &output) {
+    bool ok = started;
+    if (ok) {
+        ok = WriteHeader(output);
+    }
+    if ((ok) && (size > 0u)) {
+        const uint8 * const bytes = reinterpret_cast<const uint8 *>(data);
+        if (encoding == HTTP_CONTENT_ENCODING_GZIP) {
+            checksum = CRC32::Update(checksum, bytes, size);
+        }
+        else {
+            checksum = DeflateAdler32(checksum, bytes, size);
+        }
+        dataSize += size;
+        uint32 consumed = 0u;
+        while ((ok) && (consumed < size)) {
+            if (windowEnd == (2u * DEFLATE_WINDOW_SIZE)) {
+                //The block ends before the window is moved, so that its bytes can still be stored
+                if ((numberOfTokens > 0u) || (position > blockStart)) {
+                    ok = FlushBlock(false, output);
+                }
+                SlideWindow();
+            }
+            uint32 n = (2u * DEFLATE_WINDOW_SIZE) - windowEnd;
+            if (n > (size - consumed)) {
+                n = (size - consumed);
+            }
+            if (ok) {
+                ok = MemoryOperationsHelper::Copy(&window[windowEnd], &bytes[consumed], n);
+            }
+            windowEnd += n;
+            consumed += n;
+            if (ok) {
+                ok = Deflate(false, output);
+            }
+        }
+    }
+    return ok;
+}
+
+bool HttpContentEncoder::Finish(StreamI &output) {
+    bool ok = started;
+    if (ok) {
+        ok = WriteHeader(output);
+    }
+    if (ok) {
+        ok = Deflate(true, output);
+    }
+    if ((ok) && (matchAvailable)) {
+        (void) TallyLiteral(window[position - 1u]);
+        matchAvailable = false;
+    }
+    if (ok) {
+        ok = FlushBlock(true, output);
+    }
+    if (ok) {
+        ok = AlignToByte(output);
+    }
+    if (ok) {
+        uint32 i;
+        if (encoding == HTTP_CONTENT_ENCODING_GZIP) {
+            //CRC-32 and size, little endian
+            uint32 crc = ~checksum;
+            for (i = 0u; (ok) && (i < 4u); i++) {
+                ok = PutByte(static_cast<uint8>(crc >> (8u * i)), output);
+            }
+            for (i = 0u; (ok) && (i < 4u); i++) {
+                ok = PutByte(static_cast<uint8>(dataSize >> (8u * i)), output);
+            }
+        }
+        else {
+            //Adler-32, big endian
+            for (i = 0u; (ok) && (i < 4u); i++) {
+                ok = PutByte(static_cast<uint8>(checksum >> (8u * (3u - i))), output);
+            }
+        }
+    }
+    if (ok) {
+        ok = FlushOutput(output);
+    }
+    started = false;
+    return ok;
+}
+
+bool HttpContentEncoder::WriteHeader(StreamI &output) {
+    bool ok = true;
+    if (!headerWritten) {
+        headerWritten = true;
+        if (encoding == HTTP_CONTENT_ENCODING_GZIP) {
+            //Magic, deflate method, no flags, no modification time, no extra flags and unknown operating system
+            const uint8 header[10] = { 0x1Fu, 0x8Bu, 8u, 0u, 0u, 0u, 0u, 0u, 0u, 0xFFu };
+            uint32 i;
+            for (i = 0u; (ok) && (i < 10u); i++) {
+                ok = PutByte(header[i], output);
+            }
+        }
+        else {
+            //Deflate with a 32 KB window and the default level (the check bits make the header a multiple of 31)
+            ok = PutByte(0x78u, output);
+            if (ok) {
+                ok = PutByte(0x9Cu, output);
+            }
+        }
+    }
+    return ok;
+}
+
+bool HttpContentEncoder::Deflate(const bool finishing,
+                                 StreamI &output) {
+    bool ok = true;
+    uint32 lookahead = windowEnd - position;
+    if (maxChain == 0u) {
+        //Level 0: only stored blocks
+        position = windowEnd;
+        lookahead = 0u;
+    }
+    while ((ok) && ((lookahead >= DEFLATE_MIN_LOOKAHEAD) || ((finishing) && (lookahead > 0u)))) {
+        uint32 hashHead = 0u;
+        if (lookahead >= DEFLATE_MIN_MATCH) {
+            hashHead = InsertHash(position);
+        }
+        bool full = false;
+        if (greedy) {
+            uint32 length = DEFLATE_MIN_MATCH - 1u;
+            uint32 distance = 0u;
+            if ((hashHead != 0u) && ((position - hashHead) <= DEFLATE_MAX_DISTANCE)) {
+                LongestMatch(hashHead, length, distance);
+            }
+            if (length >= DEFLATE_MIN_MATCH) {
+                full = TallyMatch(distance, length);
+                lookahead -= length;
+                if ((length <= maxLazy) && (lookahead >= DEFLATE_MIN_MATCH)) {
+                    uint32 i;
+                    for (i = 1u; i < length; i++) {
+                        position++;
+                        (void) InsertHash(position);
+                    }
+                    position++;
+                }
+                else {
+                    //The positions inside long matches are not hashed
+                    position += length;
+                }
+            }
+            else {
+                full = TallyLiteral(window[position]);
+                position++;
+                lookahead--;
+            }
+        }
+        else {
+            //Lazy evaluation: the match at the previous position is only taken if the current position has no longer match
+            uint32 length = DEFLATE_MIN_MATCH - 1u;
+            uint32 distance = 0u;
+            if ((hashHead != 0u) && (previousLength < maxLazy) && ((position - hashHead) <= DEFLATE_MAX_DISTANCE)) {
+                length = previousLength;
+                LongestMatch(hashHead, length, distance);
+                if ((distance == 0u) || ((length == DEFLATE_MIN_MATCH) && (distance > DEFLATE_TOO_FAR))) {
+                    length = DEFLATE_MIN_MATCH - 1u;
+                }
+            }
+            if ((previousLength >= DEFLATE_MIN_MATCH) && (length <= previousLength)) {
+                full = TallyMatch(previousDistance, previousLength);
+                //The match started at position - 1, whose hash was inserted with the previous position
+                uint32 maxInsert = windowEnd - DEFLATE_MIN_MATCH;
+                lookahead -= (previousLength - 1u);
+                uint32 n = previousLength - 2u;
+                while (n > 0u) {
+                    position++;
+                    if (position <= maxInsert) {
+                        (void) InsertHash(position);
+                    }
+                    n--;
+                }
+                position++;
+                matchAvailable = false;
+                previousLength = DEFLATE_MIN_MATCH - 1u;
+            }
+            else {
+                if (matchAvailable) {
+                    full = TallyLiteral(window[position - 1u]);
+                }
+                matchAvailable = true;
+                previousLength = length;
+                previousDistance = distance;
+                position++;
+                lookahead--;
+            }
+        }
+        if (full) {
+            ok = FlushBlock(false, output);
+        }
+    }
+    return ok;
+}
+
+uint32 HttpContentEncoder::InsertHash(const uint32 position) {
+    uint32 key = (static_cast<uint32>(window[position]) | (static_cast<uint32>(window[position + 1u]) << 8u))
+            | (static_cast<uint32>(window[position + 2u]) << 16u);
+    uint32 hash = (key * 2654435761u) >> (32u - DEFLATE_HASH_BITS);
+    uint32 candidate = head[hash];
+    previous[position & DEFLATE_WINDOW_MASK] = static_cast<uint16>(candidate);
+    head[hash] = static_cast<uint16>(position);
+    return candidate;
+}
+
+void HttpContentEncoder::LongestMatch(uint32 candidate,
+                                      uint32 &length,
+                                      uint32 &distance) const {
+    uint32 chain = maxChain;
+    if (length >= goodLength) {
+        chain >>= 2u;
+        if (chain == 0u) {
+            chain = 1u;
+        }
+    }
+    uint32 maxLength = windowEnd - position;
+    if (maxLength > DEFLATE_MAX_MATCH) {
+        maxLength = DEFLATE_MAX_MATCH;
+    }
+    uint32 limit = (position > DEFLATE_MAX_DISTANCE) ? (position - DEFLATE_MAX_DISTANCE) : 0u;
+    const uint8 * const scan = &window[position];
+    uint32 best = length;
+    bool more = (best < maxLength);
+    while (more) {
+        const uint8 * const match = &window[candidate];
+        //The byte which would make the match longer is checked first
+        if ((match[best] == scan[best]) && (match[0] == scan[0]) && (match[1] == scan[1])) {
+            uint32 n = 2u;
+            while ((n < maxLength) && (match[n] == scan[n])) {
+                n++;
+            }
+            if (n > best) {
+                best = n;
+                distance = position - candidate;
+                more = ((n < niceLength) && (n < maxLength));
+            }
+        }
+        if (more) {
+            candidate = previous[candidate & DEFLATE_WINDOW_MASK];
+            chain--;
+            more = ((candidate > limit) && (chain > 0u));
+        }
+    }
+    length = best;
+}
+
+bool HttpContentEncoder::TallyLiteral(const uint8 literal) {
+    tokenLiterals[numberOfTokens] = literal;
+    tokenDistances[numberOfTokens] = 0u;
+    numberOfTokens++;
+    literalFrequencies[literal]++;
+    return (numberOfTokens == DEFLATE_BLOCK_TOKENS);
+}
+
+bool HttpContentEncoder::TallyMatch(const uint32 distance,
+                                    const uint32 length) {
+    uint32 length3 = length - DEFLATE_MIN_MATCH;
+    tokenLiterals[numberOfTokens] = static_cast<uint8>(length3);
+    tokenDistances[numberOfTokens] = static_cast<uint16>(distance);
+    numberOfTokens++;
+    literalFrequencies[257u + DeflateLengthCode(length3)]++;
+    distanceFrequencies[DeflateDistanceCode(distance)]++;
+    return (numberOfTokens == DEFLATE_BLOCK_TOKENS);
+}
+
+bool HttpContentEncoder::FlushBlock(const bool last,
+                                    StreamI &output) {
+    //The byte pending for the lazy evaluation belongs to the next block
+    uint32 blockEnd = (matchAvailable) ? (position - 1u) : position;
+    uint32 storedSize = blockEnd - blockStart;
+    literalFrequencies[DEFLATE_END_OF_BLOCK] = 1u;
+
+    //Dynamic codes
+    uint8 literalLengths[HTTP_CONTENT_ENCODER_LITERALS];
+    uint8 distanceLengths[HTTP_CONTENT_ENCODER_DISTANCES];
+    DeflateCodeLengths(&literalFrequencies[0], DEFLATE_USED_LITERALS, DEFLATE_MAX_BITS, &literalLengths[0]);
+    literalLengths[DEFLATE_USED_LITERALS] = 0u;
+    literalLengths[DEFLATE_USED_LITERALS + 1u] = 0u;
+    DeflateCodeLengths(&distanceFrequencies[0], HTTP_CONTENT_ENCODER_DISTANCES, DEFLATE_MAX_BITS, &distanceLengths[0]);
+    uint32 numberOfLiterals = DEFLATE_USED_LITERALS;
+    while ((numberOfLiterals > 257u) && (literalLengths[numberOfLiterals - 1u] == 0u)) {
+        numberOfLiterals--;
+    }
+    uint32 numberOfDistances = HTTP_CONTENT_ENCODER_DISTANCES;
+    while ((numberOfDistances > 1u) && (distanceLengths[numberOfDistances - 1u] == 0u)) {
+        numberOfDistances--;
+    }
+    //The code lengths, run length encoded
+    uint8 allLengths[DEFLATE_USED_LITERALS + HTTP_CONTENT_ENCODER_DISTANCES];
+    uint32 numberOfLengths = numberOfLiterals + numberOfDistances;
+    uint32 i;
+    for (i = 0u; i < numberOfLiterals; i++) {
+        allLengths[i] = literalLengths[i];
+    }
+    for (i = 0u; i < numberOfDistances; i++) {
+        allLengths[numberOfLiterals + i] = distanceLengths[i];
+    }
+    uint8 runSymbols[DEFLATE_USED_LITERALS + HTTP_CONTENT_ENCODER_DISTANCES];
+    uint8 runExtras[DEFLATE_USED_LITERALS + HTTP_CONTENT_ENCODER_DISTANCES];
+    uint32 numberOfRuns = 0u;
+    uint32 codeLengthFrequencies[HTTP_CONTENT_ENCODER_CODE_LENGTHS];
+    for (i = 0u; i < HTTP_CONTENT_ENCODER_CODE_LENGTHS; i++) {
+        codeLengthFrequencies[i] = 0u;
+    }
+    i = 0u;
+    while (i < numberOfLengths) {
+        uint8 value = allLengths[i];
+        uint32 run = 1u;
+        while (((i + run) < numberOfLengths) && (allLengths[i + run] == value)) {
+            run++;
+        }
+        i += run;
+        if (value == 0u) {
+            while (run >= 11u) {
+                uint32 n = (run > 138u) ? 138u : run;
+                runSymbols[numberOfRuns] = 18u;
+                runExtras[numberOfRuns] = static_cast<uint8>(n - 11u);
+                numberOfRuns++;
+                run -= n;
+            }
+            if (run >= 3u) {
+                runSymbols[numberOfRuns] = 17u;
+                runExtras[numberOfRuns] = static_cast<uint8>(run - 3u);
+                numberOfRuns++;
+                run = 0u;
+            }
+        }
+        else {
+            runSymbols[numberOfRuns] = value;
+            runExtras[numberOfRuns] = 0u;
+            numberOfRuns++;
+            run--;
+            while (run >= 3u) {
+                uint32 n = (run > 6u) ? 6u : run;
+                runSymbols[numberOfRuns] = 16u;
+                runExtras[numberOfRuns] = static_cast<uint8>(n - 3u);
+                numberOfRuns++;
+                run -= n;
+            }
+        }
+        while (run > 0u) {
+            runSymbols[numberOfRuns] = value;
+            runExtras[numberOfRuns] = 0u;
+            numberOfRuns++;
+            run--;
+        }
+    }
+    for (i = 0u; i < numberOfRuns; i++) {
+        codeLengthFrequencies[runSymbols[i]]++;
+    }
+    uint8 codeLengthLengths[HTTP_CONTENT_ENCODER_CODE_LENGTHS];
+    DeflateCodeLengths(&codeLengthFrequencies[0], HTTP_CONTENT_ENCODER_CODE_LENGTHS, DEFLATE_MAX_CODE_LENGTH_BITS, &codeLengthLengths[0]);
+    uint32 numberOfCodeLengths = HTTP_CONTENT_ENCODER_CODE_LENGTHS;
+    while ((numberOfCodeLengths > 4u) && (codeLengthLengths[deflateCodeLengthOrder[numberOfCodeLengths - 1u]] == 0u)) {
+        numberOfCodeLengths--;
+    }
+
+    //Fixed codes
+    uint8 fixedLiteralLengths[HTTP_CONTENT_ENCODER_LITERALS];
+    uint8 fixedDistanceLengths[HTTP_CONTENT_ENCODER_DISTANCES];
+    for (i = 0u; i < HTTP_CONTENT_ENCODER_LITERALS; i++) {
+        if (i < 144u) {
+            fixedLiteralLengths[i] = 8u;
+        }
+        else if (i < 256u) {
+            fixedLiteralLengths[i] = 9u;
+        }
+        else if (i < 280u) {
+            fixedLiteralLengths[i] = 7u;
+        }
+        else {
+            fixedLiteralLengths[i] = 8u;
+        }
+    }
+    for (i = 0u; i < HTTP_CONTENT_ENCODER_DISTANCES; i++) {
+        fixedDistanceLengths[i] = 5u;
+    }
+
+    //The size in bits of each encoding
+    uint64 dynamicBits = 3u + 14u + (3u * static_cast<uint64>(numberOfCodeLengths));
+    for (i = 0u; i < numberOfRuns; i++) {
+        dynamicBits += static_cast<uint64>(codeLengthLengths[runSymbols[i]]) + deflateCodeLengthExtra[runSymbols[i]];
+    }
+    uint64 fixedBits = 3u;
+    for (i = 0u; i < DEFLATE_USED_LITERALS; i++) {
+        uint64 extra = (i > DEFLATE_END_OF_BLOCK) ? deflateLengthExtra[i - 257u] : 0u;
+        dynamicBits += static_cast<uint64>(literalFrequencies[i]) * (literalLengths[i] + extra);
+        fixedBits += static_cast<uint64>(literalFrequencies[i]) * (fixedLiteralLengths[i] + extra);
+    }
+    for (i = 0u; i < HTTP_CONTENT_ENCODER_DISTANCES; i++) {
+        dynamicBits += static_cast<uint64>(distanceFrequencies[i]) * (static_cast<uint64>(distanceLengths[i]) + deflateDistanceExtra[i]);
+        fixedBits += static_cast<uint64>(distanceFrequencies[i]) * (static_cast<uint64>(fixedDistanceLengths[i]) + deflateDistanceExtra[i]);
+    }
+    uint32 numberOfStored = (storedSize + (DEFLATE_MAX_STORED - 1u)) / DEFLATE_MAX_STORED;
+    if (numberOfStored == 0u) {
+        numberOfStored = 1u;
+    }
+    uint64 storedBits = (8u * static_cast<uint64>(storedSize)) + (48u * static_cast<uint64>(numberOfStored));
+
+    bool ok = true;
+    uint32 lastBit = (last) ? 1u : 0u;
+    if ((maxChain == 0u) || ((storedBits < dynamicBits) && (storedBits < fixedBits))) {
+        uint32 remaining = storedSize;
+        uint32 offset = blockStart;
+        bool more = true;
+        while ((ok) && (more)) {
+            uint32 n = (remaining > DEFLATE_MAX_STORED) ? DEFLATE_MAX_STORED : remaining;
+            remaining -= n;
+            more = (remaining > 0u);
+            ok = PutBits((more) ? 0u : lastBit, 3u, output);
+            if (ok) {
+                ok = AlignToByte(output);
+            }
+            if (ok) {
+                ok = PutBits(n, 16u, output);
+            }
+            if (ok) {
+                ok = PutBits((~n) & 0xFFFFu, 16u, output);
+            }
+            uint32 k;
+            for (k = 0u; (ok) && (k < n); k++) {
+                ok = PutByte(window[offset + k], output);
+            }
+            offset += n;
+        }
+    }
+    else if (fixedBits <= dynamicBits) {
+        uint16 literalCodes[HTTP_CONTENT_ENCODER_LITERALS];
+        uint16 distanceCodes[HTTP_CONTENT_ENCODER_DISTANCES];
+        DeflateCodes(&fixedLiteralLengths[0], HTTP_CONTENT_ENCODER_LITERALS, &literalCodes[0]);
+        DeflateCodes(&fixedDistanceLengths[0], HTTP_CONTENT_ENCODER_DISTANCES, &distanceCodes[0]);
+        ok = PutBits(lastBit | 2u, 3u, output);
+        if (ok) {
+            ok = WriteBlockData(&literalCodes[0], &fixedLiteralLengths[0], &distanceCodes[0], &fixedDistanceLengths[0], output);
+        }
+    }
+    else {
+        uint16 literalCodes[HTTP_CONTENT_ENCODER_LITERALS];
+        uint16 distanceCodes[HTTP_CONTENT_ENCODER_DISTANCES];
+        uint16 codeLengthCodes[HTTP_CONTENT_ENCODER_CODE_LENGTHS];
+        DeflateCodes(&literalLengths[0], HTTP_CONTENT_ENCODER_LITERALS, &literalCodes[0]);
+        DeflateCodes(&distanceLengths[0], HTTP_CONTENT_ENCODER_DISTANCES, &distanceCodes[0]);
+        DeflateCodes(&codeLengthLengths[0], HTTP_CONTENT_ENCODER_CODE_LENGTHS, &codeLengthCodes[0]);
+        ok = PutBits(lastBit | 4u, 3u, output);
+        if (ok) {
+            ok = PutBits(numberOfLiterals - 257u, 5u, output);
+        }
+        if (ok) {
+            ok = PutBits(numberOfDistances - 1u, 5u, output);
+        }
+        if (ok) {
+            ok = PutBits(numberOfCodeLengths - 4u, 4u, output);
+        }
+        for (i = 0u; (ok) && (i < numberOfCodeLengths); i++) {
+            ok = PutBits(codeLengthLengths[deflateCodeLengthOrder[i]], 3u, output);
+        }
+        for (i = 0u; (ok) && (i < numberOfRuns); i++) {
+            uint32 s = runSymbols[i];
+            ok = PutBits(codeLengthCodes[s], codeLengthLengths[s], output);
+            if ((ok) && (deflateCodeLengthExtra[s] > 0u)) {
+                ok = PutBits(runExtras[i], deflateCodeLengthExtra[s], output);
+            }
+        }
+        if (ok) {
+            ok = WriteBlockData(&literalCodes[0], &literalLengths[0], &distanceCodes[0], &distanceLengths[0], output);
+        }
+    }
+
+    numberOfTokens = 0u;
+    blockStart = blockEnd;
+    for (i = 0u; i < HTTP_CONTENT_ENCODER_LITERALS; i++) {
+        literalFrequencies[i] = 0u;
+    }
+    for (i = 0u; i < HTTP_CONTENT_ENCODER_DISTANCES; i++) {
+        distanceFrequencies[i] = 0u;
+    }
+    return ok;
+}
+
+bool HttpContentEncoder::WriteBlockData(const uint16 * const literalCodes,
+                                        const uint8 * const literalLengths,
+                                        const uint16 * const distanceCodes,
+                                        const uint8 * const distanceLengths,
+                                        StreamI &output) {
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; (ok) && (i < numberOfTokens); i++) {
+        uint32 literal = tokenLiterals[i];
+        uint32 distance = tokenDistances[i];
+        if (distance == 0u) {
+            ok = PutBits(literalCodes[literal], literalLengths[literal], output);
+        }
+        else {
+            uint32 lengthCode = DeflateLengthCode(literal);
+            uint32 symbol = 257u + lengthCode;
+            ok = PutBits(literalCodes[symbol], literalLengths[symbol], output);
+            if ((ok) && (deflateLengthExtra[lengthCode] > 0u)) {
+                ok = PutBits((literal + DEFLATE_MIN_MATCH) - deflateLengthBase[lengthCode], deflateLengthExtra[lengthCode], output);
+            }
+            uint32 distanceCode = DeflateDistanceCode(distance);
+            if (ok) {
+                ok = PutBits(distanceCodes[distanceCode], distanceLengths[distanceCode], output);
+            }
+            if ((ok) && (deflateDistanceExtra[distanceCode] > 0u)) {
+                ok = PutBits(distance - deflateDistanceBase[distanceCode], deflateDistanceExtra[distanceCode], output);
+            }
+        }
+    }
+    if (ok) {
+        ok = PutBits(literalCodes[DEFLATE_END_OF_BLOCK], literalLengths[DEFLATE_END_OF_BLOCK], output);
+    }
+    return ok;
+}
+
+void HttpContentEncoder::SlideWindow() {
+    (void) MemoryOperationsHelper::Copy(&window[0], &window[DEFLATE_WINDOW_SIZE], DEFLATE_WINDOW_SIZE);
+    windowEnd -= DEFLATE_WINDOW_SIZE;
+    position -= DEFLATE_WINDOW_SIZE;
+    blockStart -= DEFLATE_WINDOW_SIZE;
+    uint32 i;
+    for (i = 0u; i < DEFLATE_HASH_SIZE; i++) {
+        uint32 p = head[i];
+        head[i] = static_cast<uint16>((p >= DEFLATE_WINDOW_SIZE) ? (p - DEFLATE_WINDOW_SIZE) : 0u);
+    }
+    for (i = 0u; i < DEFLATE_WINDOW_SIZE; i++) {
+        uint32 p = previous[i];
+        previous[i] = static_cast<uint16>((p >= DEFLATE_WINDOW_SIZE) ? (p - DEFLATE_WINDOW_SIZE) : 0u);
+    }
+}
+
+bool HttpContentEncoder::PutBits(const uint32 value,
+                                 const uint32 numberOfBits,
+                                 StreamI &output) {
+    bool ok = true;
+    bitBuffer |= (static_cast<uint64>(value) << bitCount);
+    bitCount += numberOfBits;
+    while ((ok) && (bitCount >= 8u)) {
+        if (outputSize == HTTP_CONTENT_ENCODER_OUTPUT_SIZE) {
+            ok = FlushOutput(output);
+        }
+        outputBuffer[outputSize] = static_cast<char8>(bitBuffer & 0xFFu);
+        outputSize++;
+        bitBuffer >>= 8u;
+        bitCount -= 8u;
+    }
+    return ok;
+}
+
+bool HttpContentEncoder::AlignToByte(StreamI &output) {
+    bool ok = true;
+    if (bitCount > 0u) {
+        ok = PutBits(0u, 8u - bitCount, output);
+    }
+    return ok;
+}
+
+bool HttpContentEncoder::PutByte(const uint8 value,
+                                 StreamI &output) {
+    return PutBits(value, 8u, output);
+}
+
+bool HttpContentEncoder::FlushOutput(StreamI &output) {
+    bool ok = true;
+    if (outputSize > 0u) {
+        uint32 writeSize = outputSize;
+        ok = output.Write(&outputBuffer[0], writeSize);
+        if (ok) {
+            ok = (writeSize == outputSize);
+        }
+        outputSize = 0u;
+    }
+    return ok;
+}
+
+bool HttpContentEncoder::Encode(const uint32 encoding,
+                                const uint32 level,
+                                const char8 * const data,
+                                const uint32 size,
+                                StreamI &output) {
+    HttpContentEncoder encoder;
+    bool ok = encoder.Start(encoding, level);
+    if (ok) {
+        ok = encoder.Compress(data, size, output);
+    }
+    if (ok) {
+        ok = encoder.Finish(output);
+    }
+    return ok;
+}
+
+uint32 HttpContentEncoder::GetAcceptedEncoding(const char8 * const acceptEncoding) {
+    bool gzip = false;
+    bool deflate = false;
+    if (acceptEncoding != NULL_PTR(const char8 *)) {
+        const char8 *p = acceptEncoding;
+        while (*p != '\0') {
+            while ((*p == ' ') || (*p == '\t') || (*p == ',')) {
+                p++;
+            }
+            const char8 * const coding = p;
+            while ((*p != '\0') && (*p != ',') && (*p != ';') && (*p != ' ') && (*p != '\t')) {
+                p++;
+            }
+            uint32 codingLength = static_cast<uint32>(p - coding);
+            //The parameters, of which only a zero quality value (q=0, q=0.0, ...) matters
+            bool accepted = true;
+            while ((*p != '\0') && (*p != ',')) {
+                if (((*p == 'q') || (*p == 'Q')) && (p[1] == '=')) {
+                    p = &p[2];
+                    while ((*p == '0') || (*p == '.')) {
+                        p++;
+                    }
+                    accepted = ((*p >= '1') && (*p <= '9'));
+                }
+                else {
+                    p++;
+                }
+            }
+            if ((accepted) && (codingLength > 0u)) {
+                if ((codingLength == 4u) && (StringHelper::CompareNoCaseSensN(coding, "gzip", 4u) == 0)) {
+                    gzip = true;
+                }
+                else if ((codingLength == 6u) && (StringHelper::CompareNoCaseSensN(coding, "x-gzip", 6u) == 0)) {
+                    gzip = true;
+                }
+                else if ((codingLength == 7u) && (StringHelper::CompareNoCaseSensN(coding, "deflate", 7u) == 0)) {
+                    deflate = true;
+                }
+                else if ((codingLength == 1u) && (*coding == '*')) {
+                    gzip = true;
+                }
+                else {
+                    //Not supported
+                }
+            }
+        }
+    }
+    uint32 accepted = HTTP_CONTENT_ENCODING_IDENTITY;
+    if (gzip) {
+        accepted = HTTP_CONTENT_ENCODING_GZIP;
+    }
+    else if (deflate) {
+        accepted = HTTP_CONTENT_ENCODING_DEFLATE;
+    }
+    else {
+        //Not compressed
+    }
+    return accepted;
+}
+
+const char8 *HttpContentEncoder::GetEncodingName(const uint32 encoding) {
+    const char8 *name = "identity";
+    if (encoding == HTTP_CONTENT_ENCODING_GZIP) {
+        name = "gzip";
+    }
+    else if (encoding == HTTP_CONTENT_ENCODING_DEFLATE) {
+        name = "deflate";
+    }
+    else {
+        //identity
+    }
+    return name;
+}
+
+bool HttpContentEncoder::IsCompressible(const char8 * const contentType) {
+    bool compressible = false;
+    if (contentType != NULL_PTR(const char8 *)) {
+        compressible = (StringHelper::CompareNoCaseSensN(contentType, "text/", 5u) == 0);
+        if (!compressible) {
+            compressible = (StringHelper::SearchString(contentType, "json") != NULL_PTR(const char8 *));
+        }
+        if (!compressible) {
+            compressible = (StringHelper::SearchString(contentType, "javascript") != NULL_PTR(const char8 *));
+        }
+        if (!compressible) {
+            compressible = (StringHelper::SearchString(contentType, "xml") != NULL_PTR(const char8 *));
+        }
+    }
+    return compressible;
+}
+
+}
@@ -0,0 +1,426 @@
+/**
+ * @file HttpContentEncoder.h
+ * @brief Header file for class HttpContentEncoder
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HttpContentEncoder
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef HTTPCONTENTENCODER_H_
+#define HTTPCONTENTENCODER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "StreamI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The HTTP content codings supported by the HttpContentEncoder.
+ */
+static const uint32 HTTP_CONTENT_ENCODING_IDENTITY = 0u;
+static const uint32 HTTP_CONTENT_ENCODING_GZIP = 1u;
+static const uint32 HTTP_CONTENT_ENCODING_DEFLATE = 2u;
+
+/**
+ * The number of symbols of the literal/length alphabet (including the two unused codes of the fixed code).
+ */
+static const uint32 HTTP_CONTENT_ENCODER_LITERALS = 288u;
+
+/**
+ * The number of symbols of the distance alphabet.
+ */
+static const uint32 HTTP_CONTENT_ENCODER_DISTANCES = 30u;
+
+/**
+ * The number of symbols of the code length alphabet.
+ */
+static const uint32 HTTP_CONTENT_ENCODER_CODE_LENGTHS = 19u;
+
+/**
+ * The size of the buffer which collects the encoded bytes before they are written to the output.
+ */
+static const uint32 HTTP_CONTENT_ENCODER_OUTPUT_SIZE = 4096u;
+
+/**
+ * @brief Streaming deflate (RFC 1951) compressor producing the gzip (RFC 1952) and the deflate (zlib, RFC 1950) HTTP content codings.
+ * @details The data is given to Compress as it is produced and the compressed bytes are written to the output stream as soon as a
+ * deflate block is complete; Finish encodes the remaining data and the trailer. The matches are searched with hash chains on a
+ * 32 KB window (greedily for the levels 1 to 3, with lazy evaluation for the levels 4 to 9, the longer chains being searched by the
+ * higher levels) and each block is encoded with dynamic or fixed Huffman codes or stored, whichever is the smallest. The level 0
+ * only stores the data.
+ *
+ * The window and the hash chains (about 240 KB) are allocated by the first Start and kept for the following streams, so that an
+ * encoder can be reused without allocating memory (e.g. for all the responses of a connection).
+ *
+ * The compression is CPU intensive and shall only be performed by the service threads (e.g. of the HttpService), never by the real-time
+ * threads.
+ */
+class DLL_API HttpContentEncoder {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   IsStarted() == false
+     */
+    HttpContentEncoder();
+
+    /**
+     * @brief Destructor. Frees the window and the hash chains.
+     */
+    ~HttpContentEncoder();
+
+    /**
+     * @brief Starts a new compressed stream (discarding the current one, if any).
+     * @param[in] encodingIn HTTP_CONTENT_ENCODING_GZIP or HTTP_CONTENT_ENCODING_DEFLATE.
+     * @param[in] levelIn the compression level (0 to 9, a larger level compresses more and slower).
+     * @return true if the encoding and the level are valid.
+     */
+    bool Start(const uint32 encodingIn,
+               const uint32 levelIn);
+
+    /**
+     * @brief Compresses \a size bytes of \a data.
+     * @details Some of the data may be kept by the encoder (until it can complete a block), to be written by the next calls.
+     * @param[in] data the data to be compressed.
+     * @param[in] size the number of bytes in \a data.
+     * @param[out] output where the compressed bytes are written.
+     * @return true if the stream is started and all the write operations are successful.
+     */
+    bool Compress(const char8 * const data,
+                  const uint32 size,
+                  StreamI &output);
+
+    /**
+     * @brief Writes all the data kept by the encoder and the trailer of the stream.
+     * @param[out] output where the compressed bytes are written.
+     * @return true if the stream is started and all the write operations are successful.
+     * @post
+     *   IsStarted() == false
+     */
+    bool Finish(StreamI &output);
+
+    /**
+     * @brief Discards the current stream.
+     * @post
+     *   IsStarted() == false
+     */
+    void Reset();
+
+    /**
+     * @brief Checks if a stream is being compressed.
+     * @return true if Start was called and Finish (or Reset) was not.
+     */
+    bool IsStarted() const;
+
+    /**
+     * @brief Compresses a complete buffer.
+     * @param[in] encoding HTTP_CONTENT_ENCODING_GZIP or HTTP_CONTENT_ENCODING_DEFLATE.
+     * @param[in] level the compression level (0 to 9).
+     * @param[in] data the data to be compressed.
+     * @param[in] size the number of bytes in \a data.
+     * @param[out] output where the compressed stream is written.
+     * @return true if the encoding and the level are valid and all the write operations are successful.
+     */
+    static bool Encode(const uint32 encoding,
+                       const uint32 level,
+                       const char8 * const data,
+                       const uint32 size,
+                       StreamI &output);
+
+    /**
+     * @brief Chooses the content coding of a response from the Accept-Encoding header of the request.
+     * @param[in] acceptEncoding the value of the Accept-Encoding header (may be NULL).
+     * @return HTTP_CONTENT_ENCODING_GZIP if gzip (or *) is accepted, otherwise HTTP_CONTENT_ENCODING_DEFLATE if deflate is accepted,
+     * otherwise HTTP_CONTENT_ENCODING_IDENTITY. The codings with q=0 are not accepted.
+     */
+    static uint32 GetAcceptedEncoding(const char8 * const acceptEncoding);
+
+    /**
+     * @brief Gets the name of a content coding, as written in the Content-Encoding header.
+     * @return "gzip", "deflate" or "identity".
+     */
+    static const char8 *GetEncodingName(const uint32 encoding);
+
+    /**
+     * @brief Checks if it is worth compressing a content type.
+     * @param[in] contentType the value of the Content-Type header (may be NULL).
+     * @return true for the text, JSON, JavaScript and XML (including SVG) contents, false for the other (typically already
+     * compressed) contents.
+     */
+    static bool IsCompressible(const char8 * const contentType);
+
+private:
+
+    /**
+     * @brief Finds the matches of the data in the window, while at least a maximum length match can be looked ahead (or, if
+     * \a finishing, until all the data was processed).
+     */
+    bool Deflate(const bool finishing,
+                 StreamI &output);
+
+    /**
+     * @brief Looks for a match at the current position longer than \a length along the hash chain which starts at \a candidate.
+     * @param[in] candidate the most recent position with the same hash.
+     * @param[in,out] length the length of the longest match found.
+     * @param[out] distance the distance of the longest match found.
+     */
+    void LongestMatch(uint32 candidate,
+                      uint32 &length,
+                      uint32 &distance) const;
+
+    /**
+     * @brief Inserts the three bytes at \a position in the hash chains.
+     * @return the previous position with the same hash (0 if none).
+     */
+    uint32 InsertHash(const uint32 position);
+
+    /**
+     * @brief Adds a literal to the current block.
+     * @return true if the block is full.
+     */
+    bool TallyLiteral(const uint8 literal);
+
+    /**
+     * @brief Adds a match to the current block.
+     * @return true if the block is full.
+     */
+    bool TallyMatch(const uint32 distance,
+                    const uint32 length);
+
+    /**
+     * @brief Encodes the current block (with the smallest of the dynamic, fixed or stored encodings).
+     * @param[in] last true if it is the last block of the stream.
+     */
+    bool FlushBlock(const bool last,
+                    StreamI &output);
+
+    /**
+     * @brief Encodes the data of the current block with the given codes.
+     */
+    bool WriteBlockData(const uint16 * const literalCodes,
+                        const uint8 * const literalLengths,
+                        const uint16 * const distanceCodes,
+                        const uint8 * const distanceLengths,
+                        StreamI &output);
+
+    /**
+     * @brief Moves the upper half of the window to the lower half.
+     */
+    void SlideWindow();
+
+    /**
+     * @brief Appends \a numberOfBits bits of \a value to the output.
+     */
+    bool PutBits(const uint32 value,
+                 const uint32 numberOfBits,
+                 StreamI &output);
+
+    /**
+     * @brief Appends the bits not yet written to the output (padding the last byte with zeros).
+     */
+    bool AlignToByte(StreamI &output);
+
+    /**
+     * @brief Appends a byte to the output (at a byte boundary).
+     */
+    bool PutByte(const uint8 value,
+                 StreamI &output);
+
+    /**
+     * @brief Writes the encoded bytes to \a output.
+     */
+    bool FlushOutput(StreamI &output);
+
+    /**
+     * @brief Writes the gzip or zlib header, if not yet written.
+     */
+    bool WriteHeader(StreamI &output);
+
+    /**
+     * The data being compressed (two times the 32 KB maximum distance).
+     */
+    uint8 *window;
+
+    /**
+     * The most recent position of each hash value (0 if none).
+     */
+    uint16 *head;
+
+    /**
+     * The previous position with the same hash of each position in the window (modulo 32 KB).
+     */
+    uint16 *previous;
+
+    /**
+     * The literals (or the length - 3 of the matches) of the current block.
+     */
+    uint8 *tokenLiterals;
+
+    /**
+     * The distances of the matches of the current block (0 for the literals).
+     */
+    uint16 *tokenDistances;
+
+    /**
+     * The number of literals and matches in the current block.
+     */
+    uint32 numberOfTokens;
+
+    /**
+     * The number of bytes in the window.
+     */
+    uint32 windowEnd;
+
+    /**
+     * The position of the next byte to be processed.
+     */
+    uint32 position;
+
+    /**
+     * The position of the first byte of the current block.
+     */
+    uint32 blockStart;
+
+    /**
+     * The length of the match found at the previous position (lazy evaluation).
+     */
+    uint32 previousLength;
+
+    /**
+     * The distance of the match found at the previous position (lazy evaluation).
+     */
+    uint32 previousDistance;
+
+    /**
+     * True if the byte before position is yet to be encoded (lazy evaluation).
+     */
+    bool matchAvailable;
+
+    /**
+     * HTTP_CONTENT_ENCODING_GZIP or HTTP_CONTENT_ENCODING_DEFLATE.
+     */
+    uint32 encoding;
+
+    /**
+     * The maximum number of positions searched in a hash chain (0 for the level 0).
+     */
+    uint32 maxChain;
+
+    /**
+     * The match length after which the search stops.
+     */
+    uint32 niceLength;
+
+    /**
+     * The match length after which the lazy evaluation is not performed (0 for the greedy levels, for which it is the maximum length of
+     * the matches whose positions are inserted in the hash chains).
+     */
+    uint32 maxLazy;
+
+    /**
+     * The match length after which the chains are only searched for a quarter of maxChain.
+     */
+    uint32 goodLength;
+
+    /**
+     * True if the level is greedy.
+     */
+    bool greedy;
+
+    /**
+     * True between Start and Finish.
+     */
+    bool started;
+
+    /**
+     * True once the gzip or zlib header was written.
+     */
+    bool headerWritten;
+
+    /**
+     * The running CRC-32 (gzip) or Adler-32 (zlib) of the data.
+     */
+    uint32 checksum;
+
+    /**
+     * The number of bytes of the data (modulo 2^32).
+     */
+    uint32 dataSize;
+
+    /**
+     * The bits not yet written to outputBuffer.
+     */
+    uint64 bitBuffer;
+
+    /**
+     * The number of bits in bitBuffer.
+     */
+    uint32 bitCount;
+
+    /**
+     * The encoded bytes not yet written to the output stream.
+     */
+    char8 outputBuffer[HTTP_CONTENT_ENCODER_OUTPUT_SIZE];
+
+    /**
+     * The number of bytes in outputBuffer.
+     */
+    uint32 outputSize;
+
+    /**
+     * The frequencies of the literal/length symbols of the current block.
+     */
+    uint32 literalFrequencies[HTTP_CONTENT_ENCODER_LITERALS];
+
+    /**
+     * The frequencies of the distance symbols of the current block.
+     */
+    uint32 distanceFrequencies[HTTP_CONTENT_ENCODER_DISTANCES];
+
+    /*lint -e{1704} non copyable*/
+    /**
+     * @brief Disallow the copy constructor.
+     */
+    HttpContentEncoder(const HttpContentEncoder &);
+
+    /**
+     * @brief Disallow the copy operator.
+     */
+    HttpContentEncoder &operator=(const HttpContentEncoder &);
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* HTTPCONTENTENCODER_H_ */
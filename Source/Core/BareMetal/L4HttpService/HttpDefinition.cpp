@@ -42,6 +42,16 @@ namespace MARTe {
 namespace HttpDefinition {
 static const char8 *Http2Convert = " #%<>&~,$+=:/?[]\"@{}";
 
+/**
+ * The names of the days of the week, starting on Sunday.
+ */
+static const char8 * const httpDateDays[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+
+/**
+ * The names of the months.
+ */
+static const char8 * const httpDateMonths[] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
 bool HttpEncode(BufferedStreamI &converted,
                 const char8 * const original) {
 
@@ -108,5 +118,29 @@ bool HttpDecode(BufferedStreamI &destination,
 
 }
 
+bool PrintHttpDate(BufferedStreamI &date, const uint64 secondsFromEpoch) {
+    uint64 days = (secondsFromEpoch / 86400u);
+    uint32 secondsOfDay = static_cast<uint32>(secondsFromEpoch % 86400u);
+    //The 1/1/1970 was a Thursday
+    uint32 dayOfWeek = static_cast<uint32>((days + 4u) % 7u);
+    //Civil date from the number of days, counting the years from the 1st of March so that the leap day is the last one
+    uint64 shiftedDays = (days + 719468u);
+    uint64 era = (shiftedDays / 146097u);
+    uint32 dayOfEra = static_cast<uint32>(shiftedDays - (era * 146097u));
+    uint32 yearOfEra = (((dayOfEra - (dayOfEra / 1460u)) + (dayOfEra / 36524u)) - (dayOfEra / 146096u)) / 365u;
+    uint32 dayOfYear = dayOfEra - (((365u * yearOfEra) + (yearOfEra / 4u)) - (yearOfEra / 100u));
+    uint32 shiftedMonth = ((5u * dayOfYear) + 2u) / 153u;
+    uint32 day = (dayOfYear - (((153u * shiftedMonth) + 2u) / 5u)) + 1u;
+    uint32 month = (shiftedMonth < 10u) ? (shiftedMonth + 2u) : (shiftedMonth - 10u);
+    uint32 year = static_cast<uint32>(yearOfEra + (era * 400u));
+    if (month < 2u) {
+        year++;
+    }
+    uint32 hours = (secondsOfDay / 3600u);
+    uint32 minutes = ((secondsOfDay % 3600u) / 60u);
+    uint32 seconds = (secondsOfDay % 60u);
+    return date.Printf("%s, %02u %s %04u %02u:%02u:%02u GMT", httpDateDays[dayOfWeek], day, httpDateMonths[month], year, hours, minutes, seconds);
+}
+
 }
 }
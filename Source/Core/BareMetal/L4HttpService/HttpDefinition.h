@@ -83,6 +83,11 @@ static const int32 HSHCReply = 0x10000000;
  */
 static const int32 HSHCReplyOK = (HSHCReply + 200);
 
+/**
+ * HTTP REPLY NOT MODIFIED
+ */
+static const int32 HSHCReplyNotModified = (HSHCReply + 304);
+
 /**
  * HTTP REPLY BAD REQUEST
  */
@@ -147,6 +152,15 @@ int32 HexDecode(const char8 c);
  */
 bool HttpDecode(BufferedStreamI &destination, BufferedStreamI &source);
 
+/**
+ * @brief Prints a date in the HTTP format (e.g. Sun, 06 Nov 1994 08:49:37 GMT), as
+ * used in the Date, Last-Modified and If-Modified-Since headers.
+ * @param[out] date where to print the date.
+ * @param[in] secondsFromEpoch the number of seconds from 1/1/1970 00:00:00 UTC.
+ * @return true if the date was successfully printed.
+ */
+bool PrintHttpDate(BufferedStreamI &date, const uint64 secondsFromEpoch);
+
 }
 }
 
@@ -238,6 +252,10 @@ const char8 *GetErrorCodeString(const int32 httpErrorCode) {
         ret = "Method";
     }
         break;
+    case 304: {
+        ret = "Not Modified";
+    }
+        break;
     default: {
 
     }
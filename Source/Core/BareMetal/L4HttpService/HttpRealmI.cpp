@@ -47,5 +47,9 @@ HttpRealmI::HttpRealmI() {
 HttpRealmI::~HttpRealmI() {
 }
 
+HttpSessionTokens &HttpRealmI::GetSessionTokens() {
+    return sessionTokens;
+}
+
 }
 
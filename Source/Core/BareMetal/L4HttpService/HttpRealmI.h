@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "HttpDefinition.h"
+#include "HttpSessionTokens.h"
 #include "StreamString.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -41,6 +42,16 @@ namespace MARTe {
 
 /**
  * @brief HTTP interface to implement a realm.
+ * @details A realm can optionally issue session tokens (see HttpSessionTokens), so that the credentials of a client are only
+ * validated once (e.g. by a digest computation) and the following requests are accepted by checking the token. The tokens are
+ * disabled by default and are enabled by the implementation, e.g. in its Initialise:
+ * <pre>
+ *     uint32 sessionLifetime;
+ *     if (data.Read("SessionLifetime", sessionLifetime)) {
+ *         ok = GetSessionTokens().Enable(sessionLifetime);
+ *     }
+ * </pre>
+ * @see HttpProtocol::SecurityCheck.
  */
 class HttpRealmI {
 public:
@@ -77,6 +88,19 @@ public:
      */
     virtual bool GetAuthenticationRequest(StreamString &message)= 0;
 
+    /**
+     * @brief Gets the session tokens of the realm.
+     * @return the session tokens, which are only issued and accepted if enabled (see HttpSessionTokens::Enable).
+     */
+    HttpSessionTokens &GetSessionTokens();
+
+private:
+
+    /**
+     * The session tokens of the realm.
+     */
+    HttpSessionTokens sessionTokens;
+
 };
 
 }
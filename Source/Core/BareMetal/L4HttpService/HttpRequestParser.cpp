@@ -0,0 +1,283 @@
+/**
+ * @file HttpRequestParser.cpp
+ * @brief Source file for class HttpRequestParser
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HttpRequestParser (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "HttpRequestParser.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The names of the recognised headers, indexed by HTTP_HEADER value.
+ */
+static const char8 * const httpHeaderNames[HTTP_HEADER_UNKNOWN] = { "Host", "Connection", "Content-Length", "Content-Type", "Transfer-Encoding",
+        "Expect", "Authorization", "WWW-Authenticate", "Accept", "Accept-Encoding", "If-None-Match", "If-Modified-Since", "User-Agent", "Cookie",
+        "Range", "Cache-Control", "Origin", "Upgrade", "Last-Event-ID" };
+
+/**
+ * The number of slots of the perfect hash.
+ */
+static const uint32 HTTP_HEADER_HASH_SIZE = 32u;
+
+/**
+ * The HTTP_HEADER value + 1 of the name which hashes to each slot (0 if none). The hash of a name of length n is
+ * (3 * n + 12 * first + 5 * last) % 32, with the first and the last characters in lower case, which does not collide
+ * for the httpHeaderNames. It shall be recomputed if a name is added.
+ */
+static const uint8 httpHeaderSlots[HTTP_HEADER_HASH_SIZE] = { 15u, 4u, 9u, 0u, 0u, 0u, 5u, 16u, 2u, 0u, 18u, 19u, 17u, 0u, 0u, 14u, 1u, 0u, 6u, 0u,
+        0u, 0u, 3u, 0u, 12u, 7u, 0u, 11u, 10u, 8u, 13u, 0u };
+
+/**
+ * @brief Converts an ASCII letter to lower case.
+ */
+static inline uint32 HttpHeaderLowerCase(const char8 c) {
+    uint32 u = static_cast<uint32>(static_cast<uint8>(c));
+    if ((u >= static_cast<uint32>('A')) && (u <= static_cast<uint32>('Z'))) {
+        u += 32u;
+    }
+    return u;
+}
+
+/**
+ * @brief Checks if a character is a blank (space or horizontal tab).
+ */
+static inline bool HttpHeaderIsBlank(const char8 c) {
+    return ((c == ' ') || (c == '\t'));
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+HttpRequestParser::HttpRequestParser() {
+    Reset();
+}
+
+HttpRequestParser::~HttpRequestParser() {
+}
+
+void HttpRequestParser::Reset() {
+    size = 0u;
+    lineBegin = 0u;
+    hasStartLine = false;
+    numberOfFields = 0u;
+    uint32 i;
+    for (i = 0u; i < HTTP_HEADER_UNKNOWN; i++) {
+        headers[i] = 0u;
+    }
+    state = HTTP_REQUEST_PARSER_INCOMPLETE;
+}
+
+uint32 HttpRequestParser::Parse(const char8 * const data,
+                                const uint32 dataSize,
+                                uint32 &consumed) {
+    consumed = 0u;
+    while ((state == HTTP_REQUEST_PARSER_INCOMPLETE) && (consumed < dataSize)) {
+        //Take up to the end of the line, so that the data after the header stays in the stream
+        uint32 left = dataSize - consumed;
+        const char8 *newLine = static_cast<const char8 *>(MemoryOperationsHelper::Search(&data[consumed], '\n', left));
+        uint32 n = left;
+        if (newLine != NULL_PTR(const char8 *)) {
+            n = static_cast<uint32>(newLine - &data[consumed]) + 1u;
+        }
+        if ((size + n) > HTTP_REQUEST_PARSER_MAX_SIZE) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::CommunicationError, "HttpRequestParser: the HTTP header is too large");
+            state = HTTP_REQUEST_PARSER_ERROR;
+        }
+        else {
+            (void) MemoryOperationsHelper::Copy(&buffer[size], &data[consumed], n);
+            size += n;
+            consumed += n;
+            if (newLine != NULL_PTR(const char8 *)) {
+                ParseLine();
+                lineBegin = size;
+            }
+        }
+    }
+    return state;
+}
+
+void HttpRequestParser::ParseLine() {
+    //Without the line terminator (\r\n or \n)
+    uint32 end = size - 1u;
+    if ((end > lineBegin) && (buffer[end - 1u] == '\r')) {
+        end--;
+    }
+    buffer[end] = '\0';
+    if (!hasStartLine) {
+        if (end == lineBegin) {
+            //Empty lines before the start line are ignored (e.g. a CRLF after the body of the previous message)
+            size = lineBegin;
+        }
+        else {
+            hasStartLine = true;
+        }
+    }
+    else if (end == lineBegin) {
+        state = HTTP_REQUEST_PARSER_COMPLETE;
+    }
+    else if (HttpHeaderIsBlank(buffer[lineBegin])) {
+        //Obsolete line folding
+    }
+    else {
+        uint32 colon = lineBegin;
+        while ((colon < end) && (buffer[colon] != ':')) {
+            colon++;
+        }
+        if (colon == end) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::CommunicationError, "HttpRequestParser: header field without ':'");
+            state = HTTP_REQUEST_PARSER_ERROR;
+        }
+        else if (numberOfFields == HTTP_REQUEST_PARSER_MAX_FIELDS) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::CommunicationError, "HttpRequestParser: too many header fields");
+            state = HTTP_REQUEST_PARSER_ERROR;
+        }
+        else {
+            uint32 nameEnd = colon;
+            while ((nameEnd > lineBegin) && (HttpHeaderIsBlank(buffer[nameEnd - 1u]))) {
+                nameEnd--;
+            }
+            uint32 value = colon + 1u;
+            while ((value < end) && (HttpHeaderIsBlank(buffer[value]))) {
+                value++;
+            }
+            uint32 valueEnd = end;
+            while ((valueEnd > value) && (HttpHeaderIsBlank(buffer[valueEnd - 1u]))) {
+                valueEnd--;
+            }
+            buffer[nameEnd] = '\0';
+            buffer[valueEnd] = '\0';
+            fields[numberOfFields].name = static_cast<uint16>(lineBegin);
+            fields[numberOfFields].value = static_cast<uint16>(value);
+            numberOfFields++;
+            uint32 headerId = GetHeaderId(&buffer[lineBegin], nameEnd - lineBegin);
+            if (headerId < HTTP_HEADER_UNKNOWN) {
+                headers[headerId] = static_cast<uint8>(numberOfFields);
+            }
+        }
+    }
+}
+
+uint32 HttpRequestParser::GetState() const {
+    return state;
+}
+
+bool HttpRequestParser::IsEmpty() const {
+    return (size == 0u);
+}
+
+const char8 *HttpRequestParser::GetStartLine() const {
+    const char8 *line = NULL_PTR(const char8 *);
+    if (hasStartLine) {
+        line = &buffer[0];
+    }
+    return line;
+}
+
+uint32 HttpRequestParser::GetNumberOfFields() const {
+    return numberOfFields;
+}
+
+const char8 *HttpRequestParser::GetFieldName(const uint32 idx) const {
+    const char8 *name = NULL_PTR(const char8 *);
+    if (idx < numberOfFields) {
+        name = &buffer[fields[idx].name];
+    }
+    return name;
+}
+
+const char8 *HttpRequestParser::GetFieldValue(const uint32 idx) const {
+    const char8 *value = NULL_PTR(const char8 *);
+    if (idx < numberOfFields) {
+        value = &buffer[fields[idx].value];
+    }
+    return value;
+}
+
+const char8 *HttpRequestParser::GetHeader(const uint32 headerId) const {
+    const char8 *value = NULL_PTR(const char8 *);
+    if (headerId < HTTP_HEADER_UNKNOWN) {
+        if (headers[headerId] > 0u) {
+            value = &buffer[fields[headers[headerId] - 1u].value];
+        }
+    }
+    return value;
+}
+
+const char8 *HttpRequestParser::GetHeader(const char8 * const name) const {
+    const char8 *value = NULL_PTR(const char8 *);
+    if (name != NULL_PTR(const char8 *)) {
+        uint32 headerId = GetHeaderId(name, StringHelper::Length(name));
+        if (headerId < HTTP_HEADER_UNKNOWN) {
+            value = GetHeader(headerId);
+        }
+        else {
+            //The last one, as for the recognised headers
+            uint32 i = numberOfFields;
+            while ((i > 0u) && (value == NULL_PTR(const char8 *))) {
+                i--;
+                if (StringHelper::CompareNoCaseSensN(&buffer[fields[i].name], name, HTTP_REQUEST_PARSER_MAX_SIZE) == 0) {
+                    value = &buffer[fields[i].value];
+                }
+            }
+        }
+    }
+    return value;
+}
+
+uint32 HttpRequestParser::GetHeaderId(const char8 * const name,
+                                      const uint32 length) {
+    uint32 headerId = HTTP_HEADER_UNKNOWN;
+    if (length > 0u) {
+        uint32 hash = ((3u * length) + (12u * HttpHeaderLowerCase(name[0])) + (5u * HttpHeaderLowerCase(name[length - 1u]))) % HTTP_HEADER_HASH_SIZE;
+        uint32 slot = static_cast<uint32>(httpHeaderSlots[hash]);
+        if (slot > 0u) {
+            const char8 * const candidate = httpHeaderNames[slot - 1u];
+            if (StringHelper::Length(candidate) == length) {
+                if (StringHelper::CompareNoCaseSensN(candidate, name, length) == 0) {
+                    headerId = slot - 1u;
+                }
+            }
+        }
+    }
+    return headerId;
+}
+
+}
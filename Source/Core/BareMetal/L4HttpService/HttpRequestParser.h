@@ -0,0 +1,265 @@
+/**
+ * @file HttpRequestParser.h
+ * @brief Header file for class HttpRequestParser
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HttpRequestParser
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef HTTPREQUESTPARSER_H_
+#define HTTPREQUESTPARSER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The headers recognised by the HttpRequestParser (see HttpRequestParser::GetHeader).
+ */
+static const uint32 HTTP_HEADER_HOST = 0u;
+static const uint32 HTTP_HEADER_CONNECTION = 1u;
+static const uint32 HTTP_HEADER_CONTENT_LENGTH = 2u;
+static const uint32 HTTP_HEADER_CONTENT_TYPE = 3u;
+static const uint32 HTTP_HEADER_TRANSFER_ENCODING = 4u;
+static const uint32 HTTP_HEADER_EXPECT = 5u;
+static const uint32 HTTP_HEADER_AUTHORIZATION = 6u;
+static const uint32 HTTP_HEADER_WWW_AUTHENTICATE = 7u;
+static const uint32 HTTP_HEADER_ACCEPT = 8u;
+static const uint32 HTTP_HEADER_ACCEPT_ENCODING = 9u;
+static const uint32 HTTP_HEADER_IF_NONE_MATCH = 10u;
+static const uint32 HTTP_HEADER_IF_MODIFIED_SINCE = 11u;
+static const uint32 HTTP_HEADER_USER_AGENT = 12u;
+static const uint32 HTTP_HEADER_COOKIE = 13u;
+static const uint32 HTTP_HEADER_RANGE = 14u;
+static const uint32 HTTP_HEADER_CACHE_CONTROL = 15u;
+static const uint32 HTTP_HEADER_ORIGIN = 16u;
+static const uint32 HTTP_HEADER_UPGRADE = 17u;
+static const uint32 HTTP_HEADER_LAST_EVENT_ID = 18u;
+
+/**
+ * The number of recognised headers, also returned by HttpRequestParser::GetHeaderId for the other headers.
+ */
+static const uint32 HTTP_HEADER_UNKNOWN = 19u;
+
+/**
+ * The states of a HttpRequestParser.
+ */
+static const uint32 HTTP_REQUEST_PARSER_INCOMPLETE = 0u;
+static const uint32 HTTP_REQUEST_PARSER_COMPLETE = 1u;
+static const uint32 HTTP_REQUEST_PARSER_ERROR = 2u;
+
+/**
+ * The maximum size of the start line and of the header fields of a message (including the line terminators).
+ */
+static const uint32 HTTP_REQUEST_PARSER_MAX_SIZE = 8192u;
+
+/**
+ * The maximum number of header fields of a message.
+ */
+static const uint32 HTTP_REQUEST_PARSER_MAX_FIELDS = 64u;
+
+/**
+ * @brief A header field parsed by the HttpRequestParser.
+ */
+struct HttpRequestParserField {
+    /**
+     * Offset of the (zero terminated) name in the parser buffer.
+     */
+    uint16 name;
+
+    /**
+     * Offset of the (zero terminated and trimmed) value in the parser buffer.
+     */
+    uint16 value;
+};
+
+/**
+ * @brief Incremental parser of the start line and of the header fields of a HTTP message.
+ * @details The data is given to Parse as it is received (e.g. directly from the read buffer of the stream, see
+ * BufferedStreamI::PeekRead) and the parsing resumes where the previous call stopped, so that no line is scanned twice.
+ * Parse never takes the data after the empty line which ends the header, which is left in the stream for the body or
+ * for the next (pipelined) message.
+ *
+ * The lines are kept in a fixed size buffer (HTTP_REQUEST_PARSER_MAX_SIZE) and the fields in a fixed size table
+ * (HTTP_REQUEST_PARSER_MAX_FIELDS), so that parsing a message does not allocate memory. The names and the values are zero
+ * terminated in place and the values are trimmed of the surrounding blanks. The recognised headers (HTTP_HEADER_*) are
+ * identified while parsing with a perfect hash of their names and can then be found in constant time, the other ones
+ * are searched by name (case insensitive). If a header is repeated, the last value is returned. The obsolete line
+ * folding (lines starting with a blank) is ignored.
+ */
+class DLL_API HttpRequestParser {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetState() == HTTP_REQUEST_PARSER_INCOMPLETE
+     */
+    HttpRequestParser();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~HttpRequestParser();
+
+    /**
+     * @brief Discards the parsed message, so that the next message can be parsed.
+     * @post
+     *   GetState() == HTTP_REQUEST_PARSER_INCOMPLETE
+     */
+    void Reset();
+
+    /**
+     * @brief Parses the next \a dataSize bytes of the message.
+     * @param[in] data the received bytes.
+     * @param[in] dataSize the number of bytes in \a data.
+     * @param[out] consumed the number of bytes of \a data which were taken. Less than \a dataSize only if the header was completed
+     * (or could not be parsed) before the end of \a data.
+     * @return the state of the parser (HTTP_REQUEST_PARSER_INCOMPLETE if more data is needed). HTTP_REQUEST_PARSER_ERROR if
+     * the message is larger than HTTP_REQUEST_PARSER_MAX_SIZE, has more than HTTP_REQUEST_PARSER_MAX_FIELDS fields or has a
+     * field without ':'.
+     */
+    uint32 Parse(const char8 * const data,
+                 const uint32 dataSize,
+                 uint32 &consumed);
+
+    /**
+     * @brief Gets the state of the parser.
+     * @return one of the HTTP_REQUEST_PARSER states.
+     */
+    uint32 GetState() const;
+
+    /**
+     * @brief Checks if no data was parsed since the last Reset.
+     * @return true if Parse did not take any byte since the last Reset.
+     */
+    bool IsEmpty() const;
+
+    /**
+     * @brief Gets the start line (request or status line), without the line terminator.
+     * @return the start line or NULL if it was not yet parsed.
+     */
+    const char8 *GetStartLine() const;
+
+    /**
+     * @brief Gets the number of header fields parsed.
+     */
+    uint32 GetNumberOfFields() const;
+
+    /**
+     * @brief Gets the name of the field \a idx.
+     * @return the name or NULL if idx >= GetNumberOfFields().
+     */
+    const char8 *GetFieldName(const uint32 idx) const;
+
+    /**
+     * @brief Gets the value of the field \a idx.
+     * @return the value or NULL if idx >= GetNumberOfFields().
+     */
+    const char8 *GetFieldValue(const uint32 idx) const;
+
+    /**
+     * @brief Gets the value of a recognised header.
+     * @param[in] headerId one of the HTTP_HEADER values.
+     * @return the value or NULL if the message does not have the header. Valid until the next Reset.
+     */
+    const char8 *GetHeader(const uint32 headerId) const;
+
+    /**
+     * @brief Gets the value of a header.
+     * @param[in] name the name of the header (case insensitive).
+     * @return the value or NULL if the message does not have the header. Valid until the next Reset.
+     */
+    const char8 *GetHeader(const char8 * const name) const;
+
+    /**
+     * @brief Gets the HTTP_HEADER value of a header name.
+     * @param[in] name the name of the header (case insensitive).
+     * @param[in] length the number of characters of \a name.
+     * @return the HTTP_HEADER value or HTTP_HEADER_UNKNOWN if the header is not recognised.
+     */
+    static uint32 GetHeaderId(const char8 * const name,
+                              const uint32 length);
+
+private:
+
+    /**
+     * @brief Parses the line which starts at lineBegin and ends at the end of the buffer (including the '\\n').
+     */
+    void ParseLine();
+
+    /**
+     * The start line and the header fields received.
+     */
+    char8 buffer[HTTP_REQUEST_PARSER_MAX_SIZE];
+
+    /**
+     * The number of bytes in buffer.
+     */
+    uint32 size;
+
+    /**
+     * The offset in buffer of the line being received.
+     */
+    uint32 lineBegin;
+
+    /**
+     * True once the start line was parsed (at offset 0 of the buffer).
+     */
+    bool hasStartLine;
+
+    /**
+     * The header fields.
+     */
+    HttpRequestParserField fields[HTTP_REQUEST_PARSER_MAX_FIELDS];
+
+    /**
+     * The number of elements of fields.
+     */
+    uint32 numberOfFields;
+
+    /**
+     * The index + 1 in fields of each recognised header (0 if the message does not have the header).
+     */
+    uint8 headers[HTTP_HEADER_UNKNOWN];
+
+    /**
+     * One of the HTTP_REQUEST_PARSER states.
+     */
+    uint32 state;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* HTTPREQUESTPARSER_H_ */
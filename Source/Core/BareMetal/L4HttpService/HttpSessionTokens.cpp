@@ -0,0 +1,330 @@
+/**
+ * @file HttpSessionTokens.cpp
+ * @brief Source file for class HttpSessionTokens
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HttpSessionTokens (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "HttpSessionTokens.h"
+#include "Md5Encrypt.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Writes \a size bytes as 2 * \a size lower case hexadecimal characters.
+ */
+static void HttpSessionTokensPrintHex(const uint8 * const bytes,
+                                      const uint32 size,
+                                      char8 * const hex) {
+    const char8 * const hexDigits = "0123456789abcdef";
+    uint32 i;
+    for (i = 0u; i < size; i++) {
+        hex[2u * i] = hexDigits[bytes[i] >> 4u];
+        hex[(2u * i) + 1u] = hexDigits[bytes[i] & 0xFu];
+    }
+}
+
+/**
+ * @brief Reads 2 * \a size hexadecimal characters into \a size bytes.
+ * @return false if a character is not an hexadecimal digit.
+ */
+static bool HttpSessionTokensParseHex(const char8 * const hex,
+                                      const uint32 size,
+                                      uint8 * const bytes) {
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; (i < (2u * size)) && (ok); i++) {
+        uint32 c = static_cast<uint32>(static_cast<uint8>(hex[i]));
+        uint32 nibble = 0u;
+        if ((c >= static_cast<uint32>('0')) && (c <= static_cast<uint32>('9'))) {
+            nibble = c - static_cast<uint32>('0');
+        }
+        else if ((c >= static_cast<uint32>('a')) && (c <= static_cast<uint32>('f'))) {
+            nibble = (c - static_cast<uint32>('a')) + 10u;
+        }
+        else {
+            ok = false;
+        }
+        if ((i % 2u) == 0u) {
+            bytes[i / 2u] = static_cast<uint8>(nibble << 4u);
+        }
+        else {
+            bytes[i / 2u] |= static_cast<uint8>(nibble);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Writes a 32 bit value in big endian order.
+ */
+static void HttpSessionTokensPutUInt32(const uint32 value,
+                                       uint8 * const bytes) {
+    bytes[0] = static_cast<uint8>(value >> 24u);
+    bytes[1] = static_cast<uint8>(value >> 16u);
+    bytes[2] = static_cast<uint8>(value >> 8u);
+    bytes[3] = static_cast<uint8>(value);
+}
+
+/**
+ * @brief Reads a 32 bit value in big endian order.
+ */
+static uint32 HttpSessionTokensGetUInt32(const uint8 * const bytes) {
+    return ((static_cast<uint32>(bytes[0]) << 24u) | (static_cast<uint32>(bytes[1]) << 16u) | (static_cast<uint32>(bytes[2]) << 8u))
+            | static_cast<uint32>(bytes[3]);
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+HttpSessionTokens::HttpSessionTokens() {
+    lifetime = 0u;
+    nextNonce = 0u;
+    uint32 i;
+    for (i = 0u; i < HTTP_SESSION_TOKENS_SECRET_SIZE; i++) {
+        secret[i] = 0u;
+    }
+    for (i = 0u; i < HTTP_SESSION_TOKENS_CACHE_SIZE; i++) {
+        cache[i].expiry = 0u;
+    }
+    (void) sem.Create();
+}
+
+HttpSessionTokens::~HttpSessionTokens() {
+}
+
+bool HttpSessionTokens::Enable(const uint32 lifetimeIn,
+                               const uint8 * const secretIn,
+                               const uint32 secretSize) {
+    bool ok = (lifetimeIn > 0u);
+    if (ok) {
+        if ((secretIn != NULL_PTR(const uint8 *)) && (secretSize > 0u)) {
+            //any size is reduced to the size of the secret
+            uint8 *key = new uint8[secretSize];
+            (void) MemoryOperationsHelper::Copy(key, secretIn, secretSize);
+            Md5Encrypt::Md5(key, secretSize, &secret[0]);
+            delete[] key;
+        }
+        else {
+            uint8 seed[24];
+            uint64 counter = HighResolutionTimer::Counter();
+            (void) MemoryOperationsHelper::Copy(&seed[0], &counter, 8u);
+            /*lint -e{9091} -e{923} the address is only used as a seed*/
+            uint64 address = static_cast<uint64>(reinterpret_cast<uintp>(this));
+            (void) MemoryOperationsHelper::Copy(&seed[8], &address, 8u);
+            counter = HighResolutionTimer::Counter();
+            (void) MemoryOperationsHelper::Copy(&seed[16], &counter, 8u);
+            Md5Encrypt::Md5(&seed[0], static_cast<uint32>(sizeof(seed)), &secret[0]);
+        }
+        //the nonces of different secrets do not start from the same value
+        nextNonce = HttpSessionTokensGetUInt32(&secret[12]);
+        lifetime = lifetimeIn;
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "HttpSessionTokens: the lifetime shall be > 0");
+    }
+    return ok;
+}
+
+bool HttpSessionTokens::IsEnabled() const {
+    return (lifetime > 0u);
+}
+
+uint32 HttpSessionTokens::GetLifetime() const {
+    return lifetime;
+}
+
+bool HttpSessionTokens::Issue(const uint32 ipNumber,
+                              StreamString &token) {
+    bool ok = IsEnabled();
+    uint32 nonce = 0u;
+    if (ok) {
+        ok = (sem.FastLock() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        nonce = nextNonce;
+        nextNonce++;
+        sem.FastUnLock();
+    }
+    if (ok) {
+        uint32 expiry = Now() + lifetime;
+        uint8 header[8];
+        HttpSessionTokensPutUInt32(expiry, &header[0]);
+        HttpSessionTokensPutUInt32(nonce, &header[4]);
+        uint8 signature[16];
+        Sign(expiry, nonce, ipNumber, &signature[0]);
+        char8 text[HTTP_SESSION_TOKEN_SIZE + 1u];
+        HttpSessionTokensPrintHex(&header[0], 4u, &text[0]);
+        text[8] = '.';
+        HttpSessionTokensPrintHex(&header[4], 4u, &text[9]);
+        text[17] = '.';
+        HttpSessionTokensPrintHex(&signature[0], 16u, &text[18]);
+        text[HTTP_SESSION_TOKEN_SIZE] = '\0';
+        token = &text[0];
+    }
+    return ok;
+}
+
+bool HttpSessionTokens::Validate(const char8 * const token,
+                                 const uint32 ipNumber) {
+    bool ok = ((IsEnabled()) && (token != NULL_PTR(const char8 *)));
+    if (ok) {
+        ok = (StringHelper::Length(token) == HTTP_SESSION_TOKEN_SIZE);
+    }
+    if (ok) {
+        ok = ((token[8] == '.') && (token[17] == '.'));
+    }
+    uint8 header[8];
+    uint8 signature[16];
+    if (ok) {
+        ok = HttpSessionTokensParseHex(&token[0], 4u, &header[0]);
+    }
+    if (ok) {
+        ok = HttpSessionTokensParseHex(&token[9], 4u, &header[4]);
+    }
+    if (ok) {
+        ok = HttpSessionTokensParseHex(&token[18], 16u, &signature[0]);
+    }
+    uint32 expiry = 0u;
+    uint32 nonce = 0u;
+    if (ok) {
+        expiry = HttpSessionTokensGetUInt32(&header[0]);
+        nonce = HttpSessionTokensGetUInt32(&header[4]);
+        uint32 now = Now();
+        ok = ((now < expiry) && ((expiry - now) <= lifetime));
+    }
+    //the signature of a token is random, so that its first bytes spread the tokens over the cache
+    uint32 slot = (HttpSessionTokensGetUInt32(&signature[0]) % HTTP_SESSION_TOKENS_CACHE_SIZE);
+    bool cached = false;
+    if (ok) {
+        ok = (sem.FastLock() == ErrorManagement::NoError);
+        if (ok) {
+            const HttpSessionTokensEntry &entry = cache[slot];
+            cached = ((entry.expiry == expiry) && (entry.nonce == nonce) && (entry.ipNumber == ipNumber));
+            if (cached) {
+                cached = (MemoryOperationsHelper::Compare(&entry.signature[0], &signature[0], 16u) == 0);
+            }
+            sem.FastUnLock();
+        }
+    }
+    if ((ok) && (!cached)) {
+        uint8 expected[16];
+        Sign(expiry, nonce, ipNumber, &expected[0]);
+        //compare all the bytes, so that the time does not tell how many are right
+        uint8 difference = 0u;
+        uint32 i;
+        for (i = 0u; i < 16u; i++) {
+            difference |= static_cast<uint8>(expected[i] ^ signature[i]);
+        }
+        ok = (difference == 0u);
+        if (ok) {
+            ok = (sem.FastLock() == ErrorManagement::NoError);
+        }
+        if (ok) {
+            HttpSessionTokensEntry &entry = cache[slot];
+            entry.expiry = expiry;
+            entry.nonce = nonce;
+            entry.ipNumber = ipNumber;
+            (void) MemoryOperationsHelper::Copy(&entry.signature[0], &signature[0], 16u);
+            sem.FastUnLock();
+        }
+    }
+    return ok;
+}
+
+bool HttpSessionTokens::GetRequestToken(const char8 * const cookie,
+                                        const char8 * const authorization,
+                                        StreamString &token) {
+    bool found = false;
+    token = "";
+    if (cookie != NULL_PTR(const char8 *)) {
+        //name=value pairs separated by ';'
+        uint32 nameSize = StringHelper::Length(HTTP_SESSION_TOKEN_COOKIE);
+        const char8 *pair = cookie;
+        while ((pair != NULL_PTR(const char8 *)) && (!found)) {
+            while ((*pair == ' ') || (*pair == '\t')) {
+                pair = &pair[1];
+            }
+            if ((StringHelper::CompareN(pair, HTTP_SESSION_TOKEN_COOKIE, nameSize) == 0) && (pair[nameSize] == '=')) {
+                const char8 *value = &pair[nameSize + 1u];
+                uint32 valueSize = 0u;
+                while ((value[valueSize] != '\0') && (value[valueSize] != ';') && (value[valueSize] != ' ')) {
+                    valueSize++;
+                }
+                found = (valueSize > 0u);
+                if (found) {
+                    found = token.Write(value, valueSize);
+                }
+            }
+            pair = StringHelper::SearchChar(pair, ';');
+            if (pair != NULL_PTR(const char8 *)) {
+                pair = &pair[1];
+            }
+        }
+    }
+    if ((!found) && (authorization != NULL_PTR(const char8 *))) {
+        if (StringHelper::CompareN(authorization, "Bearer ", 7u) == 0) {
+            const char8 *value = &authorization[7];
+            while (*value == ' ') {
+                value = &value[1];
+            }
+            token = value;
+            found = (token.Size() > 0u);
+        }
+    }
+    return found;
+}
+
+void HttpSessionTokens::Sign(const uint32 expiry,
+                             const uint32 nonce,
+                             const uint32 ipNumber,
+                             uint8 * const signature) const {
+    uint8 message[12];
+    HttpSessionTokensPutUInt32(expiry, &message[0]);
+    HttpSessionTokensPutUInt32(nonce, &message[4]);
+    HttpSessionTokensPutUInt32(ipNumber, &message[8]);
+    Md5Encrypt::Md5Hmac(&secret[0], HTTP_SESSION_TOKENS_SECRET_SIZE, &message[0], static_cast<uint32>(sizeof(message)), signature);
+}
+
+uint32 HttpSessionTokens::Now() {
+    return static_cast<uint32>(HighResolutionTimer::Counter() / HighResolutionTimer::Frequency());
+}
+
+}
@@ -0,0 +1,220 @@
+/**
+ * @file HttpSessionTokens.h
+ * @brief Header file for class HttpSessionTokens
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HttpSessionTokens
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef HTTPSESSIONTOKENS_H_
+#define HTTPSESSIONTOKENS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "FastPollingMutexSem.h"
+#include "GeneralDefinitions.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The name of the cookie which carries the session token.
+ */
+static const char8 * const HTTP_SESSION_TOKEN_COOKIE = "MARTeSession";
+
+/**
+ * The number of characters of a session token (expiry.nonce.signature in hexadecimal).
+ */
+static const uint32 HTTP_SESSION_TOKEN_SIZE = 50u;
+
+/**
+ * The number of validated tokens remembered by a HttpSessionTokens.
+ */
+static const uint32 HTTP_SESSION_TOKENS_CACHE_SIZE = 64u;
+
+/**
+ * The size in bytes of the secret of a HttpSessionTokens.
+ */
+static const uint32 HTTP_SESSION_TOKENS_SECRET_SIZE = 16u;
+
+/**
+ * @brief A session token validated by a HttpSessionTokens.
+ */
+struct HttpSessionTokensEntry {
+    /**
+     * The expiry time of the token in seconds of the HighResolutionTimer (0 if the entry is free).
+     */
+    uint32 expiry;
+
+    /**
+     * The number which makes the token unique.
+     */
+    uint32 nonce;
+
+    /**
+     * The address of the client to which the token was issued.
+     */
+    uint32 ipNumber;
+
+    /**
+     * The signature of the token.
+     */
+    uint8 signature[16];
+};
+
+/**
+ * @brief Signed session tokens, which allow a client to be authenticated once and then identified by the token until it expires.
+ * @details A token is issued (see Issue) after the credentials of a client were validated by a HttpRealmI and is then sent by the
+ * client with every request, either as the HTTP_SESSION_TOKEN_COOKIE cookie or as a bearer token (Authorization: Bearer TOKEN).
+ * The token carries its expiry time and a nonce, signed with HMAC-MD5 (see Md5Encrypt::Md5Hmac) over the expiry, the nonce and the
+ * address of the client with a secret known only by the server, so that it cannot be forged nor used from another address and no
+ * session has to be stored. The tokens which were validated are remembered in a small table (HTTP_SESSION_TOKENS_CACHE_SIZE
+ * entries, indexed by the signature), so that the following requests with the same token are accepted without recomputing the
+ * signature.
+ *
+ * The tokens are only valid for the lifetime of the process (the expiry is measured with the HighResolutionTimer). If no secret is
+ * given to Enable, it is derived from the HighResolutionTimer and from the address of the object, which is enough to prevent
+ * casual forgeries; a random secret shall be given when the tokens shall resist a determined attacker.
+ */
+class DLL_API HttpSessionTokens {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   IsEnabled() == false
+     */
+    HttpSessionTokens();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~HttpSessionTokens();
+
+    /**
+     * @brief Enables the issue and the validation of tokens.
+     * @param[in] lifetimeIn the validity of a token in seconds.
+     * @param[in] secretIn the secret with which the tokens are signed (if NULL the secret is derived, see class description).
+     * @param[in] secretSize the number of bytes of \a secretIn.
+     * @return true if \a lifetimeIn > 0.
+     * @post
+     *   IsEnabled() == true
+     */
+    bool Enable(const uint32 lifetimeIn,
+                const uint8 * const secretIn = NULL_PTR(const uint8 *),
+                const uint32 secretSize = 0u);
+
+    /**
+     * @brief Checks if the tokens are enabled.
+     * @return true if Enable was successfully called.
+     */
+    bool IsEnabled() const;
+
+    /**
+     * @brief Gets the validity of a token.
+     * @return the validity of a token in seconds.
+     */
+    uint32 GetLifetime() const;
+
+    /**
+     * @brief Issues a new token.
+     * @param[in] ipNumber the address of the client, which is the only one which can then use the token.
+     * @param[out] token the token (HTTP_SESSION_TOKEN_SIZE characters).
+     * @return true if the tokens are enabled and the token is written.
+     */
+    bool Issue(const uint32 ipNumber,
+               StreamString &token);
+
+    /**
+     * @brief Validates a token.
+     * @param[in] token the token sent by the client.
+     * @param[in] ipNumber the address of the client.
+     * @return true if the tokens are enabled and the token was issued (for \a ipNumber) by this object and did not expire.
+     */
+    bool Validate(const char8 * const token,
+                  const uint32 ipNumber);
+
+    /**
+     * @brief Gets the token sent with a request.
+     * @param[in] cookie the value of the Cookie header of the request (may be NULL).
+     * @param[in] authorization the value of the Authorization header of the request (may be NULL).
+     * @param[out] token the value of the HTTP_SESSION_TOKEN_COOKIE cookie or, if not set, of the bearer token.
+     * @return true if the request has a token.
+     */
+    static bool GetRequestToken(const char8 * const cookie,
+                                const char8 * const authorization,
+                                StreamString &token);
+
+private:
+
+    /**
+     * @brief Computes the signature of a token.
+     */
+    void Sign(const uint32 expiry,
+              const uint32 nonce,
+              const uint32 ipNumber,
+              uint8 * const signature) const;
+
+    /**
+     * @brief Gets the current time in seconds of the HighResolutionTimer.
+     */
+    static uint32 Now();
+
+    /**
+     * The secret with which the tokens are signed.
+     */
+    uint8 secret[HTTP_SESSION_TOKENS_SECRET_SIZE];
+
+    /**
+     * The validity of a token in seconds (0 if the tokens are not enabled).
+     */
+    uint32 lifetime;
+
+    /**
+     * The nonce of the next token.
+     */
+    uint32 nextNonce;
+
+    /**
+     * The tokens already validated.
+     */
+    HttpSessionTokensEntry cache[HTTP_SESSION_TOKENS_CACHE_SIZE];
+
+    /**
+     * Protects the nextNonce and the cache.
+     */
+    FastPollingMutexSem sem;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* HTTPSESSIONTOKENS_H_ */
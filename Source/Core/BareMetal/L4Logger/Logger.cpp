@@ -31,7 +31,11 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "CompiledErrorReport.h"
 #include "../../BareMetal/L4Logger/Logger.h"
+#include "StreamMemoryReference.h"
+#include "StringHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -51,45 +55,311 @@ void LoggerErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &
         LoggerPage *page = loggerService->GetPage();
         if (page != NULL_PTR(LoggerPage *)) {
             page->errorInfo = errorInfo;
+            page->deferredFormat = NULL_PTR(const CompiledFormat *);
             (void)MemoryOperationsHelper::Copy(&page->errorStrBuffer[0u], errorDescription, MAX_ERROR_MESSAGE_SIZE);
             loggerService->AddLogEntry(page);
         }
     }
 }
+
+/**
+ * @brief Copies the raw bytes of the parameters into the page.
+ * @param[out] page the page where to copy the parameters.
+ * @param[in] parameters the parameters terminated by a void AnyType.
+ * @return true if all the parameters are scalar numbers, pointers, characters or strings and fit in the page.
+ */
+static bool LoggerDeferParameters(LoggerPage &page,
+                                  const AnyType parameters[]) {
+    bool ok = true;
+    char8 * const data = reinterpret_cast<char8 *>(&page.deferredData[0u]);
+    const uint32 dataSize = static_cast<uint32>(sizeof(page.deferredData));
+    uint32 used = 0u;
+    uint32 n = 0u;
+    while ((ok) && (!parameters[n].IsVoid())) {
+        ok = (n < LOGGER_MAX_DEFERRED_PARAMETERS);
+        TypeDescriptor td;
+        const char8 *source = NULL_PTR(const char8 *);
+        uint32 size = 0u;
+        bool isString = false;
+        //The pointer AnyType holds the pointer value itself
+        const void *pointerValue = NULL_PTR(const void *);
+        if (ok) {
+            td = parameters[n].GetTypeDescriptor();
+            source = static_cast<const char8 *>(parameters[n].GetDataPointer());
+            ok = ((!td.isStructuredData) && (parameters[n].GetBitAddress() == 0u) && (source != NULL_PTR(const char8 *)));
+        }
+        if (ok) {
+            uint8 nOfDimensions = parameters[n].GetNumberOfDimensions();
+            if ((td.type == BT_CCString) && (nOfDimensions == 0u)) {
+                isString = true;
+                size = StringHelper::Length(source);
+            }
+            else if ((td.type == CArray) && (td.numberOfBits == 8u) && (nOfDimensions == 1u)) {
+                isString = true;
+                uint32 maxSize = parameters[n].GetNumberOfElements(0u);
+                while ((size < maxSize) && (source[size] != '\0')) {
+                    size++;
+                }
+            }
+            else {
+                bool isScalar = ((td.type == SignedInteger) || (td.type == UnsignedInteger) || (td.type == Float) || (td.type == Pointer)
+                        || (td.type == CArray));
+                bool isByteSized = ((td.numberOfBits == 8u) || (td.numberOfBits == 16u) || (td.numberOfBits == 32u) || (td.numberOfBits == 64u));
+                ok = ((isScalar) && (isByteSized) && (nOfDimensions == 0u));
+                size = (static_cast<uint32>(td.numberOfBits) / 8u);
+                if (td.type == Pointer) {
+                    pointerValue = parameters[n].GetDataPointer();
+                    source = reinterpret_cast<const char8 *>(&pointerValue);
+                    size = static_cast<uint32>(sizeof(const void *));
+                }
+            }
+        }
+        if (ok) {
+            uint32 remaining = dataSize - used;
+            if (isString) {
+                ok = (remaining > 0u);
+                if ((ok) && (size >= remaining)) {
+                    size = remaining - 1u;
+                }
+            }
+            else {
+                ok = (size <= remaining);
+            }
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Copy(&data[used], source, size);
+        }
+        if (ok) {
+            page.deferredOffsets[n] = static_cast<uint16>(used);
+            used += size;
+            if (isString) {
+                data[used] = '\0';
+                used++;
+                page.deferredTypes[n] = ConstCharString;
+            }
+            else {
+                page.deferredTypes[n] = td;
+            }
+            //Keep the next value aligned
+            used = ((used + 7u) & ~7u);
+            if (used > dataSize) {
+                used = dataSize;
+            }
+            n++;
+        }
+    }
+    page.numberOfDeferredParameters = n;
+    return ok;
 }
 
+/**
+ * @brief Deferred error process function for the logger. Copies the parameters (and not the formatted message)
+ * into a LoggerPage and adds it to the FastResourceContainer queue.
+ * @param[in] errorInfo the error information.
+ * @param[in] format the compiled message format.
+ * @param[in] parameters the message parameters.
+ * @return true if the message was added to the queue.
+ */
+/*lint -estring(459, "*LoggerDeferredErrorProcessFunction*") this function is supposed to have access to the Logger singleton and to the error information.*/
+static bool LoggerDeferredErrorProcessFunction(const ErrorManagement::ErrorInformation &errorInfo,
+                                               const CompiledFormat &format,
+                                               const AnyType parameters[]) {
+    //Only defer if the messages are still being sent to the logger
+    bool ok = (ErrorManagement::errorMessageProcessFunction == &LoggerErrorProcessFunction);
+    Logger *loggerService = NULL_PTR(Logger *);
+    if (ok) {
+        loggerService = Logger::Instance();
+        ok = (loggerService != NULL_PTR(Logger *));
+    }
+    LoggerPage *page = NULL_PTR(LoggerPage *);
+    if (ok) {
+        /*lint -e{613} loggerService is checked above*/
+        page = loggerService->GetPage();
+        ok = (page != NULL_PTR(LoggerPage *));
+    }
+    if (ok) {
+        /*lint -e{613} page and loggerService are checked above*/
+        ok = LoggerDeferParameters(*page, parameters);
+        if (ok) {
+            page->errorInfo = errorInfo;
+            page->deferredFormat = &format;
+            loggerService->AddLogEntry(page);
+        }
+        else {
+            loggerService->ReturnPage(page);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Formats the deferred message of a page into its errorStrBuffer.
+ * @param[in,out] page the page holding the deferred message.
+ */
+static void LoggerFormatDeferredPage(LoggerPage &page) {
+    AnyType parameters[LOGGER_MAX_DEFERRED_PARAMETERS + 1u];
+    const char8 * const data = reinterpret_cast<const char8 *>(&page.deferredData[0u]);
+    for (uint32 i = 0u; (i < page.numberOfDeferredParameters) && (i < LOGGER_MAX_DEFERRED_PARAMETERS); i++) {
+        const void *value = &data[page.deferredOffsets[i]];
+        if (page.deferredTypes[i].type == Pointer) {
+            (void) MemoryOperationsHelper::Copy(&value, value, static_cast<uint32>(sizeof(const void *)));
+        }
+        parameters[i] = AnyType(page.deferredTypes[i], 0u, value);
+    }
+    StreamMemoryReference smr(&page.errorStrBuffer[0u], MAX_ERROR_MESSAGE_SIZE - 1u);
+    /*lint -e{613} deferredFormat is checked by the caller*/
+    (void) (smr.PrintFormatted(*page.deferredFormat, &parameters[0u]));
+    page.errorStrBuffer[smr.Size()] = '\0';
+    page.deferredFormat = NULL_PTR(const CompiledFormat *);
+}
+
+#ifdef THREAD_LOCAL
+/**
+ * 1 + the index of the producer queue claimed by the calling thread, 0 if no queue was claimed yet
+ * and 0xFFFFFFFF if no queue was available.
+ */
+static THREAD_LOCAL uint32 loggerProducerQueue = 0u;
+#endif
+}
+
+/**
+ * @brief Single producer (one thread) single consumer ring of LoggerPage elements.
+ * @details head is only written by the producer and tail only by the consumer. They are kept
+ * in different cache lines so that the producer and the consumer do not share a written line
+ * (other than the pages themselves).
+ */
+/*lint -e{9109} forward declaration in Logger.h is required to define the class*/
+struct MARTe::LoggerProducerQueue {
+    /**
+     * Number of pages ever added by the producer.
+     */
+    volatile int32 head;
+
+    /**
+     * Keeps head and tail in different cache lines.
+     */
+    char8 headPadding[60];
+
+    /**
+     * Number of pages ever consumed.
+     */
+    volatile int32 tail;
+
+    /**
+     * Keeps tail and the next queue in different cache lines.
+     */
+    char8 tailPadding[60];
+};
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
-Logger *Logger::Instance(const uint32 numberOfPages) {
-    static Logger instance(numberOfPages);
+Logger *Logger::Instance(const uint32 numberOfPages,
+                         const uint32 numberOfProducerQueues,
+                         const uint32 producerQueuePages) {
+    static Logger instance(numberOfPages, numberOfProducerQueues, producerQueuePages);
     return &instance;
 }
 
-Logger::Logger(const uint32 numberOfPages) :
+Logger::Logger(const uint32 numberOfPages,
+               const uint32 numberOfProducerQueues,
+               const uint32 producerQueuePages) :
         nOfPages(numberOfPages),
         logsIndex(nOfPages, true),
         pagesIndex(nOfPages, false) {
+    nOfProducerQueues = numberOfProducerQueues;
+    nOfProducerQueuePages = producerQueuePages;
+    //The ring positions are computed with a mask
+    bool validQueuePages = (nOfProducerQueuePages > 0u);
+    if (validQueuePages) {
+        validQueuePages = ((nOfProducerQueuePages & (nOfProducerQueuePages - 1u)) == 0u);
+    }
+    if (!validQueuePages) {
+        nOfProducerQueues = 0u;
+    }
+    if (nOfProducerQueues == 0u) {
+        nOfProducerQueuePages = 0u;
+    }
+    nextProducerQueue = 0;
+    nextConsumerQueue = 0u;
+    uint32 nOfAllPages = nOfPages + (nOfProducerQueues * nOfProducerQueuePages);
     /*lint -e{1732} -e{1733} new in constructor safe as this class can only be used as a singleton*/
-    pages = new LoggerPage[nOfPages];
+    pages = new LoggerPage[nOfAllPages];
+    producerQueues = NULL_PTR(LoggerProducerQueue *);
+    if (nOfProducerQueues > 0u) {
+        producerQueues = new LoggerProducerQueue[nOfProducerQueues];
+        for (uint32 q = 0u; q < nOfProducerQueues; q++) {
+            producerQueues[q].head = 0;
+            producerQueues[q].tail = 0;
+        }
+    }
+    for (uint32 i = 0u; i < nOfAllPages; i++) {
+        pages[i].deferredFormat = NULL_PTR(const CompiledFormat *);
+        pages[i].numberOfDeferredParameters = 0u;
+    }
+    deferredFormatting = false;
+    consumerParked = 0;
+    consumerWakeUpFunction = NULL_PTR(LoggerWakeUpFunction);
+    consumerWakeUpParameter = NULL_PTR(void *);
     SetErrorProcessFunction(&LoggerErrorProcessFunction);
 }
 
 Logger::~Logger() {
+    if (deferredFormatting) {
+        ErrorManagement::SetDeferredErrorProcessFunction(NULL_PTR(ErrorManagement::DeferredErrorProcessFunctionType));
+    }
     if (pages != NULL_PTR(LoggerPage *)) {
         delete [] pages;
     }
+    if (producerQueues != NULL_PTR(LoggerProducerQueue *)) {
+        delete [] producerQueues;
+    }
 
 }
 
+uint32 Logger::GetProducerQueue() {
+    uint32 queue = 0xFFFFFFFFu;
+#ifdef THREAD_LOCAL
+    if (loggerProducerQueue == 0u) {
+        int32 claimed = Atomic::FetchAdd(&nextProducerQueue, 1);
+        if (static_cast<uint32>(claimed) < nOfProducerQueues) {
+            loggerProducerQueue = static_cast<uint32>(claimed) + 1u;
+        }
+        else {
+            loggerProducerQueue = 0xFFFFFFFFu;
+        }
+    }
+    if (loggerProducerQueue != 0xFFFFFFFFu) {
+        queue = loggerProducerQueue - 1u;
+    }
+#endif
+    return queue;
+}
+
 LoggerPage *Logger::GetPage() {
     LoggerPage *page = NULL_PTR(LoggerPage *);
     if (pages != NULL_PTR(LoggerPage *)) {
-        uint32 pageNo = pagesIndex.Take();
-        if ((pageNo != 0xFFFFFFFFu) && (pageNo < nOfPages)) {
-            page = &pages[pageNo];
-            page->index = pageNo;
+        if (producerQueues != NULL_PTR(LoggerProducerQueue *)) {
+            uint32 q = GetProducerQueue();
+            if (q < nOfProducerQueues) {
+                //Only this thread writes the head
+                uint32 head = static_cast<uint32>(producerQueues[q].head);
+                uint32 tail = static_cast<uint32>(Atomic::LoadAcquire(&producerQueues[q].tail));
+                if ((head - tail) < nOfProducerQueuePages) {
+                    uint32 pageNo = nOfPages + (q * nOfProducerQueuePages) + (head & (nOfProducerQueuePages - 1u));
+                    page = &pages[pageNo];
+                    page->index = pageNo;
+                }
+            }
+        }
+        //Threads without a queue (or with a full queue) share the remaining pages
+        if (page == NULL_PTR(LoggerPage *)) {
+            uint32 pageNo = pagesIndex.Take();
+            if ((pageNo != 0xFFFFFFFFu) && (pageNo < nOfPages)) {
+                page = &pages[pageNo];
+                page->index = pageNo;
+            }
         }
     }
     return page;
@@ -98,23 +368,84 @@ LoggerPage *Logger::GetPage() {
 void Logger::ReturnPage(const LoggerPage * const page) {
     if (pages != NULL_PTR(LoggerPage *)) {
         if (page != NULL_PTR(LoggerPage *)) {
-            pagesIndex.Return(page->index);
+            if (page->index < nOfPages) {
+                pagesIndex.Return(page->index);
+            }
+            else if (producerQueues != NULL_PTR(LoggerProducerQueue *)) {
+                uint32 q = (page->index - nOfPages) / nOfProducerQueuePages;
+                if (q < nOfProducerQueues) {
+                    //A page which was taken but never added is at the (unpublished) head and there is nothing to release
+                    uint32 tail = static_cast<uint32>(Atomic::LoadAcquire(&producerQueues[q].tail));
+                    uint32 head = static_cast<uint32>(Atomic::LoadAcquire(&producerQueues[q].head));
+                    uint32 tailPageNo = nOfPages + (q * nOfProducerQueuePages) + (tail & (nOfProducerQueuePages - 1u));
+                    if ((head != tail) && (page->index == tailPageNo)) {
+                        Atomic::StoreRelease(&producerQueues[q].tail, static_cast<int32>(tail + 1u));
+                    }
+                }
+            }
+            else {
+                //NOOP
+            }
         }
     }
 }
 
 void Logger::AddLogEntry(const LoggerPage * const page) {
     if (pages != NULL_PTR(LoggerPage *)) {
-        logsIndex.Return(page->index);
+        if (page->index < nOfPages) {
+            logsIndex.Return(page->index);
+        }
+        else if (producerQueues != NULL_PTR(LoggerProducerQueue *)) {
+            uint32 q = (page->index - nOfPages) / nOfProducerQueuePages;
+            if (q < nOfProducerQueues) {
+                //Publish the page (only the owner thread writes the head)
+                uint32 head = static_cast<uint32>(producerQueues[q].head);
+                Atomic::StoreRelease(&producerQueues[q].head, static_cast<int32>(head + 1u));
+            }
+        }
+        else {
+            //NOOP
+        }
+        //Only wake up the consumer if it announced that it is waiting
+        if (Atomic::Load(&consumerParked, Atomic::MemoryOrderSequential) != 0) {
+            int32 parked = 1;
+            if (Atomic::CompareExchange(&consumerParked, parked, 0)) {
+                LoggerWakeUpFunction wakeUpFunction = consumerWakeUpFunction;
+                if (wakeUpFunction != NULL_PTR(LoggerWakeUpFunction)) {
+                    wakeUpFunction(consumerWakeUpParameter);
+                }
+            }
+        }
     }
 }
 
 LoggerPage *Logger::GetLogEntry() {
     LoggerPage *page = NULL_PTR(LoggerPage *);
     if (pages != NULL_PTR(LoggerPage *)) {
-        uint32 pageNo = logsIndex.Take();
-        if ((pageNo != 0xFFFFFFFFu) && (pageNo < nOfPages)) {
-            page = &pages[pageNo];
+        //Visit the producer queues round-robin so that a flooding thread does not starve the others
+        for (uint32 n = 0u; (n < nOfProducerQueues) && (page == NULL_PTR(LoggerPage *)); n++) {
+            uint32 q = nextConsumerQueue;
+            nextConsumerQueue++;
+            if (nextConsumerQueue >= nOfProducerQueues) {
+                nextConsumerQueue = 0u;
+            }
+            /*lint -e{613} producerQueues is allocated when nOfProducerQueues > 0*/
+            uint32 tail = static_cast<uint32>(producerQueues[q].tail);
+            uint32 head = static_cast<uint32>(Atomic::LoadAcquire(&producerQueues[q].head));
+            if (head != tail) {
+                page = &pages[nOfPages + (q * nOfProducerQueuePages) + (tail & (nOfProducerQueuePages - 1u))];
+            }
+        }
+        if (page == NULL_PTR(LoggerPage *)) {
+            uint32 pageNo = logsIndex.Take();
+            if ((pageNo != 0xFFFFFFFFu) && (pageNo < nOfPages)) {
+                page = &pages[pageNo];
+            }
+        }
+        if (page != NULL_PTR(LoggerPage *)) {
+            if (page->deferredFormat != NULL_PTR(const CompiledFormat *)) {
+                LoggerFormatDeferredPage(*page);
+            }
         }
     }
     return page;
@@ -125,7 +456,56 @@ uint32 Logger::GetNumberOfPages() const {
 }
 
 uint32 Logger::GetNumberOfLogs() const {
-    return logsIndex.GetSize();
+    uint32 nOfLogs = logsIndex.GetSize();
+    for (uint32 q = 0u; q < nOfProducerQueues; q++) {
+        /*lint -e{613} producerQueues is allocated when nOfProducerQueues > 0*/
+        uint32 head = static_cast<uint32>(Atomic::LoadAcquire(&producerQueues[q].head));
+        uint32 tail = static_cast<uint32>(Atomic::LoadAcquire(&producerQueues[q].tail));
+        nOfLogs += (head - tail);
+    }
+    return nOfLogs;
+}
+
+uint32 Logger::GetNumberOfProducerQueues() const {
+    return nOfProducerQueues;
+}
+
+uint32 Logger::GetNumberOfProducerQueuePages() const {
+    return nOfProducerQueuePages;
+}
+
+void Logger::SetDeferredFormatting(const bool enable) {
+    deferredFormatting = enable;
+    if (deferredFormatting) {
+        ErrorManagement::SetDeferredErrorProcessFunction(&LoggerDeferredErrorProcessFunction);
+    }
+    else {
+        ErrorManagement::SetDeferredErrorProcessFunction(NULL_PTR(ErrorManagement::DeferredErrorProcessFunctionType));
+    }
+}
+
+bool Logger::IsDeferredFormatting() const {
+    return deferredFormatting;
+}
+
+void Logger::SetConsumerWakeUp(const LoggerWakeUpFunction wakeUpFunction,
+                               void * const wakeUpParameter) {
+    consumerWakeUpParameter = wakeUpParameter;
+    consumerWakeUpFunction = wakeUpFunction;
+}
+
+bool Logger::ParkConsumer() {
+    Atomic::Store(&consumerParked, 1, Atomic::MemoryOrderSequential);
+    //Check again after announcing it, so that a page added in between is not missed
+    bool canWait = (GetNumberOfLogs() == 0u);
+    if (!canWait) {
+        UnparkConsumer();
+    }
+    return canWait;
+}
+
+void Logger::UnparkConsumer() {
+    Atomic::Store(&consumerParked, 0, Atomic::MemoryOrderSequential);
 }
 
 }
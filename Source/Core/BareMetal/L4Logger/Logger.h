@@ -32,13 +32,20 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "CompiledFormat.h"
 #include "ErrorManagement.h"
 #include "FastResourceContainer.h"
+#include "TypeDescriptor.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * @brief Maximum number of parameters of a message whose formatting is deferred.
+ */
+static const uint32 LOGGER_MAX_DEFERRED_PARAMETERS = 10u;
+
 /**
  * @brief Structure to hold information about a log event.
  */
@@ -53,6 +60,31 @@ struct LoggerPage {
      */
     char8 errorStrBuffer[MAX_ERROR_MESSAGE_SIZE];
 
+    /**
+     * Compiled format of a message whose formatting was deferred. NULL if errorStrBuffer already holds the message.
+     */
+    const CompiledFormat *deferredFormat;
+
+    /**
+     * Number of parameters of the deferred message.
+     */
+    uint32 numberOfDeferredParameters;
+
+    /**
+     * Type of each parameter of the deferred message.
+     */
+    TypeDescriptor deferredTypes[LOGGER_MAX_DEFERRED_PARAMETERS];
+
+    /**
+     * Offset (in bytes) of each parameter of the deferred message in deferredData.
+     */
+    uint16 deferredOffsets[LOGGER_MAX_DEFERRED_PARAMETERS];
+
+    /**
+     * Raw copy of the parameters of the deferred message (uint64 to keep the values aligned).
+     */
+    uint64 deferredData[MAX_ERROR_MESSAGE_SIZE / 8u];
+
     /**
      * The page index.
      */
@@ -65,6 +97,22 @@ struct LoggerPage {
  */
 static const uint32 DEFAULT_NUMBER_OF_LOG_PAGES = 128u;
 
+/**
+ * @brief The default number of pages of each producer queue.
+ */
+static const uint32 DEFAULT_NUMBER_OF_PRODUCER_QUEUE_PAGES = 32u;
+
+/**
+ * Forward declaration of the per-thread page ring (see Logger::Instance).
+ */
+struct LoggerProducerQueue;
+
+/**
+ * @brief The type of the function called by the Logger to wake up a parked consumer.
+ * @param[in] parameter the parameter registered with Logger::SetConsumerWakeUp.
+ */
+typedef void (*LoggerWakeUpFunction)(void * const parameter);
+
 /**
  * @brief The Logger class registers a callback to the SetErrorProcessFunction and adds
  * the logs to a FastResourceContainer queue. These are expected to be consumed by
@@ -76,10 +124,20 @@ public:
     /**
      * @brief Singleton access to the Logger.
      * @param[in] numberOfPages to set for the logger. This value can only be set the first time this method is called.
+     * @param[in] numberOfProducerQueues number of per-thread page queues. This value can only be set the first time this method is called.
+     * @param[in] producerQueuePages number of pages of each per-thread queue (must be a power of 2, otherwise no per-thread queue is created).
+     * This value can only be set the first time this method is called.
      * @details Registers the error callback function to the logger.
+     * The first numberOfProducerQueues threads that log a message are each given a lock-free single producer queue
+     * of producerQueuePages pages, which are only written by that thread and read by the consumer. All the other threads
+     * (and the queue owners when their queue is full) share the numberOfPages pages. The messages of a thread
+     * are consumed in order as long as its queue does not overflow into the shared pages.
+     * Queues are assigned for the lifetime of the Logger, i.e. they are not reused when a thread terminates.
      * @return a pointer to the Logger.
      */
-    static Logger *Instance(const uint32 numberOfPages = DEFAULT_NUMBER_OF_LOG_PAGES);
+    static Logger *Instance(const uint32 numberOfPages = DEFAULT_NUMBER_OF_LOG_PAGES,
+                            const uint32 numberOfProducerQueues = 0u,
+                            const uint32 producerQueuePages = DEFAULT_NUMBER_OF_PRODUCER_QUEUE_PAGES);
 
     /**
      * @brief Destructor. NOOP.
@@ -88,6 +146,8 @@ public:
 
     /**
      * @brief Returns the oldest LoggerPage available or NULL if no LoggerPage is available.
+     * @details If the formatting of the message was deferred (see SetDeferredFormatting) the
+     * message is formatted into LoggerPage::errorStrBuffer by this method, i.e. in the context of the consumer.
      * @return the oldest LoggerPage available or NULL if no LoggerPage is available.
      * @warning this page must be later returned to the Logger (see ReturnPage)
      */
@@ -107,29 +167,96 @@ public:
 
     /**
      * @brief Adds a page to be consumed (see GetLogEntry) by a user of this class.
+     * @details If the consumer is parked (see ParkConsumer) it is woken up with the registered LoggerWakeUpFunction.
+     * Otherwise no synchronisation other than the page queue is performed.
      * @param[in] page the page to be consumed.
      */
     void AddLogEntry(const LoggerPage * const page);
 
     /**
      * @brief Gets the number of configured logger pages.
-     * @return the number of configured logger pages.
+     * @return the number of configured logger pages (not including the pages of the producer queues).
      */
     uint32 GetNumberOfPages() const;
 
+    /**
+     * @brief Gets the number of per-thread producer queues.
+     * @return the number of per-thread producer queues.
+     */
+    uint32 GetNumberOfProducerQueues() const;
+
+    /**
+     * @brief Gets the number of pages of each per-thread producer queue.
+     * @return the number of pages of each per-thread producer queue.
+     */
+    uint32 GetNumberOfProducerQueuePages() const;
+
     /**
      * @brief Gets the number of LoggerPage elements that were not consumed yet (i.e. returned with ReturnPage).
      * @return the number of LoggerPage elements that were not consumed.
      */
     uint32 GetNumberOfLogs() const;
+
+    /**
+     * @brief Enables or disables the deferred formatting of the log messages.
+     * @details When enabled, messages reported with a compiled format (see ErrorManagement::ReportErrorCompiled)
+     * only copy the format reference, the error information and the raw bytes of the parameters into
+     * a LoggerPage. The message is formatted later by GetLogEntry. Messages with parameters that cannot be copied
+     * (e.g. streams, structured data or arrays other than character arrays) are formatted on the calling thread as before.
+     * Strings are copied (and truncated to the space left in the page).
+     * @param[in] enable true to enable the deferred formatting.
+     * @warning the compiled format of the reporting call site must outlive the LoggerPage (which is always the case
+     * for the REPORT_ERROR macros, unless the code is unloaded before the page is consumed).
+     */
+    void SetDeferredFormatting(const bool enable);
+
+    /**
+     * @brief Checks if the deferred formatting of the log messages is enabled.
+     * @return true if the deferred formatting of the log messages is enabled.
+     */
+    bool IsDeferredFormatting() const;
+
+    /**
+     * @brief Registers the function that wakes up a parked consumer.
+     * @param[in] wakeUpFunction the function to be called (NULL to disable the wake up).
+     * @param[in] wakeUpParameter the parameter to be given to the wakeUpFunction.
+     * @pre
+     *   The consumer is not parked.
+     */
+    void SetConsumerWakeUp(const LoggerWakeUpFunction wakeUpFunction,
+                           void * const wakeUpParameter);
+
+    /**
+     * @brief Announces that the consumer is about to block waiting for new pages.
+     * @details After this call the next AddLogEntry calls the registered LoggerWakeUpFunction (once).
+     * The caller is expected to arm its wake up mechanism before calling this method, to block (with a timeout)
+     * only if true is returned, and to call UnparkConsumer in any case.
+     * @return true if there are no pages to consume (i.e. the consumer may block).
+     */
+    bool ParkConsumer();
+
+    /**
+     * @brief Announces that the consumer is no longer blocked.
+     */
+    void UnparkConsumer();
 private:
 
     /**
      * @brief Default constructor.
      * @param[in] numberOfPages the number of pages to set for the logger.
+     * @param[in] numberOfProducerQueues the number of per-thread producer queues.
+     * @param[in] producerQueuePages the number of pages of each producer queue.
      */
     /*lint -e{1704} private constructor for singleton implementation*/
-    Logger(const uint32 numberOfPages);
+    Logger(const uint32 numberOfPages,
+           const uint32 numberOfProducerQueues,
+           const uint32 producerQueuePages);
+
+    /**
+     * @brief Gets (claiming it the first time) the producer queue of the calling thread.
+     * @return the index of the producer queue or 0xFFFFFFFF if the thread has no queue.
+     */
+    uint32 GetProducerQueue();
 
     /**
      * The number of log pages.
@@ -137,10 +264,35 @@ private:
     uint32 nOfPages;
 
     /**
-     * Array of LoggerPages.
+     * Array of LoggerPages. The first nOfPages are shared and are followed by the pages of each producer queue.
      */
     LoggerPage *pages;
 
+    /**
+     * The number of per-thread producer queues.
+     */
+    uint32 nOfProducerQueues;
+
+    /**
+     * The number of pages of each producer queue (power of 2).
+     */
+    uint32 nOfProducerQueuePages;
+
+    /**
+     * The per-thread producer queues.
+     */
+    LoggerProducerQueue *producerQueues;
+
+    /**
+     * The next producer queue to be claimed.
+     */
+    volatile int32 nextProducerQueue;
+
+    /**
+     * The next producer queue to be visited by GetLogEntry.
+     */
+    uint32 nextConsumerQueue;
+
     /**
      * When a new log arrives a page is returned to this container (which is full in the beginning).
      * When a log is returned by the consumer a page is taken from this container. So that in the beginning
@@ -154,6 +306,26 @@ private:
      */
     FastResourceContainer pagesIndex;
 
+    /**
+     * True if the deferred formatting of the log messages is enabled.
+     */
+    bool deferredFormatting;
+
+    /**
+     * 1 while the consumer is parked (see ParkConsumer).
+     */
+    volatile int32 consumerParked;
+
+    /**
+     * The function that wakes up a parked consumer.
+     */
+    LoggerWakeUpFunction consumerWakeUpFunction;
+
+    /**
+     * The parameter of the consumerWakeUpFunction.
+     */
+    void *consumerWakeUpParameter;
+
     /*lint -e{1712} This class does not have a default constructor because
      * the numberOfPages must be defined on construction and remain constant
      * during object's lifetime*/
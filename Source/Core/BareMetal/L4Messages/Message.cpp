@@ -49,7 +49,8 @@ Message::Message() :
         destination(),
         function(),
         maxWait(),
-        flags() {
+        flags(),
+        replyEvent() {
     sender = NULL_PTR(const Object *);
 }
 
@@ -59,6 +60,12 @@ Message::~Message() {
 
 void Message::SetAsReply(const bool flag) {
     flags.isReply = flag;
+    if (flag) {
+        replyEvent.Post();
+    }
+    else {
+        replyEvent.Reset();
+    }
 }
 
 void Message::SetExpectsReply(const bool flag) {
@@ -154,6 +161,10 @@ TimeoutType Message::GetReplyTimeout() const {
     return maxWait;
 }
 
+ErrorManagement::ErrorType Message::WaitReply(const TimeoutType &timeout) {
+    return replyEvent.Wait(timeout);
+}
+
 CLASS_REGISTER(Message, "1.0")
 
 }
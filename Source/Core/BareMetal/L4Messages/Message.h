@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "AddressEventSem.h"
 #include "ReferenceContainer.h"
 #include "CString.h"
 #include "StreamString.h"
@@ -87,6 +88,8 @@ public:
     /**
      * @brief Sets or unsets this Message as a Reply.
      * @param[in] flag if true the message is set as a reply, otherwise it is not considered as a reply.
+     * @post
+     *   if flag is true the threads blocked in WaitReply are woken up.
      */
     void SetAsReply(const bool flag=true);
 
@@ -159,6 +162,14 @@ public:
      */
     TimeoutType GetReplyTimeout() const;
 
+    /**
+     * @brief Blocks the calling thread until this message is set as a reply (see SetAsReply).
+     * @details The thread is woken up by SetAsReply, i.e. without polling.
+     * @param[in] timeout the maximum time to wait.
+     * @return ErrorManagement::NoError if the message is (or becomes) a reply, ErrorManagement::Timeout otherwise.
+     */
+    ErrorManagement::ErrorType WaitReply(const TimeoutType &timeout);
+
 private:
 
     struct MessageFlags {
@@ -252,6 +263,11 @@ private:
      */
     MessageFlags flags;
 
+    /**
+     * Posted when the message is set as a reply.
+     */
+    AddressEventSem replyEvent;
+
 };
 
 /*---------------------------------------------------------------------------*/
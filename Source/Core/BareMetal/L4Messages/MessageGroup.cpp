@@ -0,0 +1,113 @@
+/**
+ * @file MessageGroup.cpp
+ * @brief Source file for class MessageGroup
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MessageGroup (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "MessageGroup.h"
+#include "ObjectRegistryDatabase.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MessageGroup::MessageGroup() :
+        Object() {
+    destinationNames = NULL_PTR(StreamString *);
+    destinations = NULL_PTR(ReferenceT<MessageI> *);
+    numberOfDestinations = 0u;
+    resolved = false;
+}
+
+MessageGroup::~MessageGroup() {
+    if (destinationNames != NULL_PTR(StreamString *)) {
+        delete[] destinationNames;
+    }
+    if (destinations != NULL_PTR(ReferenceT<MessageI> *)) {
+        delete[] destinations;
+    }
+}
+
+bool MessageGroup::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    if (ok) {
+        AnyType at = data.GetType("Destinations");
+        ok = !at.IsVoid();
+        if (ok) {
+            numberOfDestinations = at.GetNumberOfElements(0u);
+            ok = (numberOfDestinations > 0u);
+        }
+        if (ok) {
+            destinationNames = new StreamString[numberOfDestinations];
+            destinations = new ReferenceT<MessageI>[numberOfDestinations];
+            Vector<StreamString> names(destinationNames, numberOfDestinations);
+            ok = data.Read("Destinations", names);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "At least one of the Destinations shall be defined");
+        }
+    }
+    return ok;
+}
+
+uint32 MessageGroup::GetNumberOfDestinations() const {
+    return numberOfDestinations;
+}
+
+bool MessageGroup::ResolveDestinations() {
+    bool ok = true;
+    for (uint32 i = 0u; i < numberOfDestinations; i++) {
+        destinations[i] = ObjectRegistryDatabase::Instance()->Find(destinationNames[i].Buffer());
+        if (!destinations[i].IsValid()) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The destination %s does not exist or is not a MessageI", destinationNames[i].Buffer());
+            ok = false;
+        }
+    }
+    resolved = true;
+    return ok;
+}
+
+ErrorManagement::ErrorType MessageGroup::SendMessage(ReferenceT<Message> &message,
+                                                     const Object * const sender) {
+    if (!resolved) {
+        (void) ResolveDestinations();
+    }
+    return MessageI::SendMessage(message, sender, destinations, numberOfDestinations);
+}
+
+CLASS_REGISTER(MessageGroup, "1.0")
+
+}
@@ -0,0 +1,136 @@
+/**
+ * @file MessageGroup.h
+ * @brief Header file for class MessageGroup
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MessageGroup
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MESSAGEGROUP_H_
+#define MESSAGEGROUP_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "Message.h"
+#include "MessageI.h"
+#include "Object.h"
+#include "ReferenceT.h"
+#include "StreamString.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A set of destinations to which the same Message is sent (e.g. to broadcast a command to many objects).
+ * @details The destinations are searched in the ObjectRegistryDatabase once (by ResolveDestinations, or by the first
+ * SendMessage) and SendMessage then delivers a Reference to the same Message to all of them (see MessageI::SendMessage),
+ * so that neither the Message nor its payload are copied and no destination is searched again. The Destination of the
+ * Message is not used and the Message cannot expect a reply.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +ReloadGroup = {
+ *     Class = MessageGroup
+ *     Destinations = { "App.Functions.GAM1" "App.Functions.GAM2" "Logger" } //Compulsory. The absolute paths of the destinations.
+ * }
+ * </pre>
+ */
+class DLL_API MessageGroup: public Object {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    MessageGroup();
+
+    /**
+     * @brief Destructor. Frees the destinations.
+     */
+    virtual ~MessageGroup();
+
+    /**
+     * @brief Reads the Destinations.
+     * @param[in] data see the class description.
+     * @return true if Object::Initialise succeeds and at least one destination is defined.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Gets the number of destinations.
+     * @return the number of destinations.
+     */
+    uint32 GetNumberOfDestinations() const;
+
+    /**
+     * @brief Searches the destinations in the ObjectRegistryDatabase.
+     * @details Call it after the destinations are created (otherwise it is called by the first SendMessage) and again if
+     * they are destroyed and created again.
+     * @return true if all the destinations exist and are MessageI.
+     */
+    bool ResolveDestinations();
+
+    /**
+     * @brief Sends a message to all the destinations.
+     * @param[in,out] message the message to send, which shall not expect a reply.
+     * @param[in] sender the Object sending the message.
+     * @return see MessageI::SendMessage.
+     */
+    ErrorManagement::ErrorType SendMessage(ReferenceT<Message> &message,
+                                           const Object * const sender);
+
+private:
+
+    /**
+     * The paths of the destinations.
+     */
+    StreamString *destinationNames;
+
+    /**
+     * The destinations (valid after ResolveDestinations).
+     */
+    ReferenceT<MessageI> *destinations;
+
+    /**
+     * The number of destinations.
+     */
+    uint32 numberOfDestinations;
+
+    /**
+     * True if ResolveDestinations was called.
+     */
+    bool resolved;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MESSAGEGROUP_H_ */
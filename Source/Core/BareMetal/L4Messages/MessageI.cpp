@@ -150,6 +150,73 @@ ErrorManagement::ErrorType MessageI::SendMessage(ReferenceT<Message> &message,
     return ret;
 }
 
+ErrorManagement::ErrorType MessageI::SendMessage(ReferenceT<Message> &message,
+                                                 const Object * const sender,
+                                                 const ReferenceT<MessageI> &destination) {
+    ErrorManagement::ErrorType ret;
+    bool resolved = destination.IsValid();
+    if ((resolved) && (message.IsValid())) {
+        resolved = !message->IsReply();
+    }
+    if (!resolved) {
+        ret = SendMessage(message, sender);
+    }
+    else if (!message.IsValid()) {
+        ret.parametersError = true;
+        REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "Invalid message.");
+    }
+    else {
+        if (sender != NULL) {
+            message->SetSender(sender);
+        }
+        else {
+            if (message->ExpectsReply()) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::CommunicationError, "Message expects reply but no sender was set.");
+                ret.parametersError = true;
+            }
+        }
+        if (ret.ErrorsCleared()) {
+            ret = destination->messageFilters.ReceiveMessage(message);
+        }
+    }
+
+    return ret;
+}
+
+ErrorManagement::ErrorType MessageI::SendMessage(ReferenceT<Message> &message,
+                                                 const Object * const sender,
+                                                 const ReferenceT<MessageI> * const destinations,
+                                                 const uint32 numberOfDestinations) {
+    ErrorManagement::ErrorType ret;
+    if (!message.IsValid()) {
+        ret.parametersError = true;
+        REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "Invalid message.");
+    }
+    else if ((message->IsReply()) || (message->ExpectsReply())) {
+        //All the destinations would write their reply in the same message
+        ret.parametersError = true;
+        REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "A message sent to several destinations cannot be or expect a reply.");
+    }
+    else {
+        if (sender != NULL) {
+            message->SetSender(sender);
+        }
+        for (uint32 i = 0u; i < numberOfDestinations; i++) {
+            if (destinations[i].IsValid()) {
+                ErrorManagement::ErrorType err = destinations[i]->messageFilters.ReceiveMessage(message);
+                if (!err.ErrorsCleared()) {
+                    ret = (static_cast<ErrorManagement::ErrorIntegerFormat>(ret) | static_cast<ErrorManagement::ErrorIntegerFormat>(err));
+                }
+            }
+            else {
+                REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "The destination object does not have a MessageI interface.");
+                ret.unsupportedFeature = true;
+            }
+        }
+    }
+    return ret;
+}
+
 ErrorManagement::ErrorType MessageI::WaitForReply(const ReferenceT<Message> &message,
                                                   const TimeoutType &maxWait,
                                                   const uint32 pollingTimeUsec) {
@@ -168,20 +235,10 @@ ErrorManagement::ErrorType MessageI::WaitForReply(const ReferenceT<Message> &mes
         }
     }
 
-    uint64 start = HighResolutionTimer::Counter();
-    float32 pollingTime = static_cast<float32>(pollingTimeUsec);
-    pollingTime *= static_cast<float32>(1.0e-6);
-    bool isReply = false;
-    if(err.ErrorsCleared()){
-        isReply = message->IsReply();
-    }
-    while ((err.ErrorsCleared()) && (!isReply)) {
-        Sleep::NoMore(pollingTime);
-        if (maxWait != TTInfiniteWait) {
-            uint64 deltaT = HighResolutionTimer::Counter() - start;
-            err.timeout = maxWait.HighResolutionTimerTicks() > deltaT;
-        }
-        isReply = message->IsReply();
+    //The reply is signalled by Message::SetAsReply: no polling is needed
+    (void) pollingTimeUsec;
+    if (err.ErrorsCleared()) {
+        err = message->WaitReply(maxWait);
     }
 
     return err;
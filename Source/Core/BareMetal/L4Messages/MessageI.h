@@ -85,12 +85,46 @@ public:
      */
     static ErrorManagement::ErrorType SendMessage(ReferenceT<Message> &message,const Object * const sender = NULL_PTR(Object *));
 
+    /**
+     * @brief Sends a message to a destination which was already resolved.
+     * @details As SendMessage above, but without searching for the message destination. Use it when the message is sent
+     * repeatedly (e.g. from a real-time thread) and resolve the \a destination once (e.g. with ObjectRegistryDatabase::Find).
+     * Replies and invalid destinations are sent as in SendMessage above.
+     * @param[in,out] message is the message to be sent (see SendMessage above).
+     * @param[in] sender is the Object sending the message.
+     * @param[in] destination the object named by the message destination.
+     * @return see SendMessage above.
+     */
+    static ErrorManagement::ErrorType SendMessage(ReferenceT<Message> &message,
+                                                  const Object * const sender,
+                                                  const ReferenceT<MessageI> &destination);
+
+    /**
+     * @brief Sends the same message to several destinations which were already resolved (see MessageGroup).
+     * @details The Message (and its payload) is not copied: each destination receives a Reference to the same Message,
+     * which shall therefore be treated as immutable by the destinations (which may keep it, e.g. in a queue, after this
+     * function returns). As a consequence the message cannot expect a reply.
+     * @param[in,out] message is the message to be sent.
+     * @param[in] sender is the Object sending the message.
+     * @param[in] destinations the destinations (the invalid ones are skipped and reported).
+     * @param[in] numberOfDestinations the number of elements of \a destinations.
+     * @return
+     *   ErrorManagement::NoError() if the message was received by all the destinations.
+     *   ErrorManagement::ParametersError if the message is invalid, is a reply or expects a reply.
+     *   ErrorManagement::UnsupportedFeature if one of the destinations is not valid.
+     *   otherwise the errors of the destinations which failed to receive the message (see SendMessage above).
+     */
+    static ErrorManagement::ErrorType SendMessage(ReferenceT<Message> &message,
+                                                  const Object * const sender,
+                                                  const ReferenceT<MessageI> * const destinations,
+                                                  const uint32 numberOfDestinations);
+
     /**
      * @brief Waits for a reply.
-     * @details Deals only with direct replies by polling the status of the Message until it is marked as a reply
+     * @details Deals only with direct replies by blocking until the Message is marked as a reply (see Message::WaitReply).
      * @param[in,out] message is the message that was sent. It will contain the reply.
      * @param[in] maxWait is the maximum time allowed waiting for the message reply.
-     * @param[in] pollingTimeUsec is the period between check of the arrival as us
+     * @param[in] pollingTimeUsec not used (kept for compatibility): the waiting thread is woken up when the reply arrives.
      * @return
      *   ErrorManagement::NoError() if the reply is obtained on time.
      *   ErrorManagement::Timeout if a wait for reply times out
@@ -105,7 +139,7 @@ public:
      * @param[in,out] message is the message to be sent. It will be modified to contain the reply.
      * @param[in] sender is the Object sending the message.
      * @param[in] maxWait is the maximum time allowed waiting for the message reply.
-     * @param[in] pollingTimeUsec is the period between check of the arrival as us
+     * @param[in] pollingTimeUsec not used (kept for compatibility).
      * @return
      *   ErrorManagement::NoError() if the reply is obtained on time.
      *   ErrorManagement::ParametersError if message is no valid pointer
@@ -140,7 +174,7 @@ public:
      * @details Installs a ReplyMessageCatcherMessageFilter. Sends The message. Waits on the filter.
      * @param[in,out] message is the message to be sent. It can be modified if the destination re-sends it to the sender as a reply.
      * @param[in] maxWait is the maximum time allowed waiting for the message reply.
-     * @param[in] pollingTimeUsec is the period between check of the arrival as us
+     * @param[in] pollingTimeUsec not used (kept for compatibility).
      */
     ErrorManagement::ErrorType SendMessageAndWaitIndirectReply(ReferenceT<Message> &message,const TimeoutType &maxWait = TTInfiniteWait,
                                                                   const uint32 pollingTimeUsec = 1000u);
@@ -0,0 +1,189 @@
+/**
+ * @file MessagePool.cpp
+ * @brief Source file for class MessagePool
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MessagePool (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "GlobalObjectsDatabase.h"
+#include "MessagePool.h"
+#include "ObjectRegistryDatabase.h"
+#include "TypeConversion.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+MessagePool::MessagePool() :
+        Object() {
+    messages = NULL_PTR(ReferenceT<Message> *);
+    numberOfMessages = 0u;
+    nextMessage = 0u;
+    poolMux.Create();
+}
+
+/*lint -e{1551} the messages are freed in the destructor*/
+MessagePool::~MessagePool() {
+    if (messages != NULL_PTR(ReferenceT<Message> *)) {
+        delete[] messages;
+    }
+    messages = NULL_PTR(ReferenceT<Message> *);
+}
+
+bool MessagePool::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    uint32 numberOfMessagesIn = 1u;
+    if (ok) {
+        if (!data.Read("NumberOfMessages", numberOfMessagesIn)) {
+            numberOfMessagesIn = 1u;
+        }
+        ok = (numberOfMessagesIn > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfMessages shall be > 0");
+        }
+    }
+    if (ok) {
+        ok = data.MoveRelative("Message");
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The Message was not specified");
+        }
+        if (ok) {
+            ok = Create(data, numberOfMessagesIn);
+            if (!data.MoveToAncestor(1u)) {
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+bool MessagePool::Create(StructuredDataI &messageData,
+                         const uint32 numberOfMessagesIn) {
+    bool ok = (messages == NULL_PTR(ReferenceT<Message> *));
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::IllegalOperation, "The messages were already created");
+    }
+    if (ok) {
+        messages = new ReferenceT<Message>[numberOfMessagesIn];
+        numberOfMessages = numberOfMessagesIn;
+    }
+    uint32 i;
+    for (i = 0u; (i < numberOfMessages) && (ok); i++) {
+        messages[i] = ReferenceT<Message>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ok = messages[i].IsValid();
+        if (ok) {
+            ok = messages[i]->Initialise(messageData);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Could not create the message %u", i);
+        }
+    }
+    return ok;
+}
+
+uint32 MessagePool::GetNumberOfMessages() const {
+    return numberOfMessages;
+}
+
+ReferenceT<Message> MessagePool::GetMessage() {
+    ReferenceT<Message> message;
+    if (poolMux.FastLock() == ErrorManagement::NoError) {
+        uint32 i;
+        for (i = 0u; (i < numberOfMessages) && (!message.IsValid()); i++) {
+            uint32 n = (nextMessage + i) % numberOfMessages;
+            //Only referenced by the pool
+            if (messages[n].NumberOfReferences() == 1u) {
+                message = messages[n];
+                nextMessage = (n + 1u) % numberOfMessages;
+            }
+        }
+    }
+    poolMux.FastUnLock();
+    if (message.IsValid()) {
+        message->SetAsReply(false);
+        message->SetSender(NULL_PTR(Object *));
+    }
+    return message;
+}
+
+bool MessagePool::WriteParameter(ReferenceT<Message> &message,
+                                 const char8 * const name,
+                                 const AnyType &value) {
+    bool ok = message.IsValid();
+    ReferenceT<StructuredDataI> payload;
+    if (ok) {
+        ok = (message->Size() > 0u);
+    }
+    if (ok) {
+        payload = message->Get(0u);
+        ok = payload.IsValid();
+    }
+    if (ok) {
+        ok = payload->MoveToRoot();
+    }
+    AnyType leaf;
+    if (ok) {
+        leaf = payload->GetType(name);
+        TypeDescriptor leafDescriptor = leaf.GetTypeDescriptor();
+        //Only the numeric leaves keep their memory when written
+        ok = ((leafDescriptor.type == SignedInteger) || (leafDescriptor.type == UnsignedInteger) || (leafDescriptor.type == Float));
+        if (ok) {
+            ok = (leaf.GetDataPointer() != NULL_PTR(void *));
+        }
+    }
+    if (ok) {
+        ok = TypeConvert(leaf, value);
+    }
+    return ok;
+}
+
+bool MessagePool::ResolveDestination() {
+    bool ok = (numberOfMessages > 0u);
+    if (ok) {
+        destination = ObjectRegistryDatabase::Instance()->Find(messages[0u]->GetDestination());
+        ok = destination.IsValid();
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The destination %s does not exist or is not a MessageI", messages[0u]->GetDestination().GetList());
+        }
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType MessagePool::SendMessage(ReferenceT<Message> &message,
+                                                    const Object * const sender) const {
+    return MessageI::SendMessage(message, sender, destination);
+}
+
+CLASS_REGISTER(MessagePool, "1.0")
+
+}
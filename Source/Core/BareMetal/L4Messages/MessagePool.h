@@ -0,0 +1,181 @@
+/**
+ * @file MessagePool.h
+ * @brief Header file for class MessagePool
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MessagePool
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MESSAGEPOOL_H_
+#define MESSAGEPOOL_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "FastPollingMutexSem.h"
+#include "Message.h"
+#include "MessageI.h"
+#include "Object.h"
+#include "ReferenceT.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A pool of pre-built Message instances that can be sent without any memory allocation.
+ * @details All the messages of the pool are created (at Initialise or Create) from the same configuration, including
+ * their payload, i.e. the StructuredDataI (e.g. ConfigurationDatabase) at the first position of the Message. The
+ * leaves of the payload (typically param1, param2, ...) are pre-allocated with their configured type and are
+ * overwritten by WriteParameter, which only accepts numeric leaves, so that their size never changes.
+ *
+ * A message is free when the pool holds the only Reference to it, i.e. after the sender and the destination are done with it.
+ * GetMessage returns one of the free messages. The destination of the messages is resolved by ResolveDestination and
+ * SendMessage only uses this Reference (see MessageI::SendMessage).
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +ErrorMessages = {
+ *     Class = MessagePool
+ *     NumberOfMessages = 4 //Optional. Default = 1.
+ *     Message = { //As for the Message Class (see Message::Initialise).
+ *         Destination = StateMachine
+ *         Function = Error
+ *         +Parameters = {
+ *             Class = ConfigurationDatabase
+ *             param1 = (uint32) 0
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class DLL_API MessagePool: public Object {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    MessagePool();
+
+    /**
+     * @brief Destructor. Frees the messages.
+     */
+    virtual ~MessagePool();
+
+    /**
+     * @brief Reads the NumberOfMessages and creates the messages from the Message configuration (see Create).
+     * @param[in] data see the class description.
+     * @return true if Object::Initialise succeeds, NumberOfMessages > 0 and Create succeeds.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Creates the messages of the pool.
+     * @param[in] messageData the configuration of each Message (see Message::Initialise).
+     * @param[in] numberOfMessagesIn the number of messages to create.
+     * @return true if all the messages could be created and initialised.
+     * @pre
+     *   GetNumberOfMessages() == 0
+     */
+    bool Create(StructuredDataI &messageData,
+                const uint32 numberOfMessagesIn);
+
+    /**
+     * @brief Gets the number of messages in the pool.
+     * @return the number of messages in the pool.
+     */
+    uint32 GetNumberOfMessages() const;
+
+    /**
+     * @brief Gets a free message of the pool.
+     * @details The message is reset as not being a reply and with no sender. The payload keeps the last written values.
+     * @return a free message or an invalid Reference if all the messages are being used.
+     */
+    ReferenceT<Message> GetMessage();
+
+    /**
+     * @brief Writes a value into the pre-allocated payload of a message.
+     * @param[in] message the message to write (see GetMessage).
+     * @param[in] name the name of the payload leaf.
+     * @param[in] value the value to write. It is converted to the type of the leaf.
+     * @return true if the payload has a numeric leaf with this \a name and the value could be converted.
+     */
+    static bool WriteParameter(ReferenceT<Message> &message,
+                               const char8 * const name,
+                               const AnyType &value);
+
+    /**
+     * @brief Searches the destination of the messages in the ObjectRegistryDatabase.
+     * @details Call it after the destination is created and before the first SendMessage.
+     * @return true if the destination exists and is a MessageI.
+     */
+    bool ResolveDestination();
+
+    /**
+     * @brief Sends a message to the destination found by ResolveDestination.
+     * @param[in,out] message the message to send (see GetMessage).
+     * @param[in] sender the Object sending the message.
+     * @return see MessageI::SendMessage.
+     */
+    ErrorManagement::ErrorType SendMessage(ReferenceT<Message> &message,
+                                           const Object * const sender) const;
+
+private:
+
+    /**
+     * The messages of the pool.
+     */
+    ReferenceT<Message> *messages;
+
+    /**
+     * The number of elements in messages.
+     */
+    uint32 numberOfMessages;
+
+    /**
+     * The first message checked by the next GetMessage.
+     */
+    uint32 nextMessage;
+
+    /**
+     * The destination of the messages.
+     */
+    ReferenceT<MessageI> destination;
+
+    /**
+     * Protects GetMessage.
+     */
+    FastPollingMutexSem poolMux;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MESSAGEPOOL_H_ */
@@ -42,7 +42,8 @@ namespace MARTe {
 
 ReplyMessageCatcherMessageFilter::ReplyMessageCatcherMessageFilter() :
         MessageFilter(false),
-        Object() {
+        Object(),
+        caughtEvent() {
     caught = false;
 }
 
@@ -78,26 +79,15 @@ ErrorManagement::ErrorType ReplyMessageCatcherMessageFilter::ConsumeMessage(Refe
 
 ErrorManagement::ErrorType ReplyMessageCatcherMessageFilter::Wait(const TimeoutType &maxWait,
                                                                   const uint32 pollingTimeUsec) {
-    ErrorManagement::ErrorType err(true);
-
-    uint64 start = HighResolutionTimer::Counter();
-    float32 pollingTime = static_cast<float32>(pollingTimeUsec);
-    pollingTime *= static_cast<float32>(1.0e-6);
-
-    while ((err.ErrorsCleared()) && (!caught)) {
-        Sleep::NoMore(pollingTime);
-        if (maxWait != TTInfiniteWait) {
-            uint64 deltaT = HighResolutionTimer::Counter() - start;
-            err.timeout = (deltaT > maxWait.HighResolutionTimerTicks());
-        }
-    }
-
-    return err;
+    //Posted by HandleReplyMessage: no polling is needed
+    (void) pollingTimeUsec;
+    return caughtEvent.Wait(maxWait);
 }
 
 /*lint -e{715} [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12] symbol available to classes that specialise this method*/
 void ReplyMessageCatcherMessageFilter::HandleReplyMessage(ReferenceT<Message> &replyMessage) {
     caught = true;
+    caughtEvent.Post();
 }
 
 CLASS_REGISTER(ReplyMessageCatcherMessageFilter, "1.0")
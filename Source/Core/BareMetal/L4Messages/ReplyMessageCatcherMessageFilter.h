@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "AddressEventSem.h"
 #include "MessageFilter.h"
 
 /*---------------------------------------------------------------------------*/
@@ -68,9 +69,9 @@ public:
 
     /**
      * @brief Waits for the message to be caught.
-     * @details This implementation polls with a sleep time of \a pollingTimeUsec.
+     * @details The calling thread is woken up when the message is caught (i.e. without polling).
      * @param[in] maxWait Maximum time to wait for the message to be caught.
-     * @param[in] pollingTimeUsec Time to wait on the polling sleep.
+     * @param[in] pollingTimeUsec Not used (kept for compatibility).
      * @return ErrorManagement::NoError if the message was caught or ErrorManagement::Timeout if the time specified in \a maxWait has expired.
      */
     /*lint -e(1735) [MISRA C++ Rule 8-3-1] the derived classes shall use this default parameter or no default parameter at all*/
@@ -99,6 +100,11 @@ private:
      */
     bool caught;
 
+    /**
+     * Posted when the message is caught.
+     */
+    AddressEventSem caughtEvent;
+
     /**
      * The message to catch.
      */
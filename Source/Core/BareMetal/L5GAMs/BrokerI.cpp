@@ -132,6 +132,9 @@ bool BrokerI::InitFunctionPointers(const SignalDirection direction,
     if (ret) {
         ret = dataSource.GetFunctionNumberOfSignals(direction, functionIdx, functionNumberOfSignals);
     }
+    if (ret) {
+        ret = CheckSignalTypes(direction, functionIdx, functionNumberOfSignals, dataSource, brokerClassName);
+    }
     numberOfCopies = 0u;
     uint32 numberOfByteOffsets = 0u;
     uint32 samples = 0u;
@@ -269,6 +272,9 @@ bool BrokerI::InitFunctionPointersOptim(const SignalDirection direction,
     if (ret) {
         ret = dataSource.GetFunctionNumberOfSignals(direction, functionIdx, functionNumberOfSignals);
     }
+    if (ret) {
+        ret = CheckSignalTypes(direction, functionIdx, functionNumberOfSignals, dataSource, brokerClassName);
+    }
     //Elements to be copies
     uint32 auxNumberOfCopies;
     basicCopyTable *bcp = NULL_PTR(basicCopyTable*);
@@ -339,6 +345,22 @@ bool BrokerI::InitFunctionPointersOptim(const SignalDirection direction,
     return ret;
 }
 
+void BrokerI::MergeCopies(const bool * const mergeWithPrevious) {
+    if ((copyTableInfo != NULL_PTR(memoryInfo*)) && (numberOfCopies > 0u)) {
+        uint32 last = 0u;
+        for (uint32 i = 1u; i < numberOfCopies; i++) {
+            if (mergeWithPrevious[i]) {
+                copyTableInfo[last].copyByteSize += copyTableInfo[i].copyByteSize;
+            }
+            else {
+                last++;
+                copyTableInfo[last] = copyTableInfo[i];
+            }
+        }
+        numberOfCopies = (last + 1u);
+    }
+}
+
 StreamString BrokerI::GetOwnerFunctionName() const {
     return ownerFunctionName;
 }
@@ -347,6 +369,35 @@ StreamString BrokerI::GetOwnerDataSourceName() const {
     return ownerDataSourceName;
 }
 
+bool BrokerI::CheckSignalTypes(const SignalDirection direction,
+                               const uint32 functionIdx,
+                               const uint32 functionNumberOfSignals,
+                               DataSourceI &dataSource,
+                               const char8 *const brokerClassName) const {
+    bool ret = true;
+    for (uint32 i = 0u; (i < functionNumberOfSignals) && (ret); i++) {
+        TypeDescriptor functionSignalType;
+        if (dataSource.IsSupportedBroker(direction, functionIdx, i, brokerClassName)) {
+            if (dataSource.GetFunctionSignalType(direction, functionIdx, i, functionSignalType)) {
+                StreamString functionSignalName;
+                uint32 signalIdx = 0u;
+                ret = dataSource.GetFunctionSignalAlias(direction, functionIdx, i, functionSignalName);
+                if (ret) {
+                    ret = dataSource.GetSignalIndex(signalIdx, functionSignalName.Buffer());
+                }
+                if (ret) {
+                    ret = (functionSignalType == dataSource.GetSignalType(signalIdx));
+                    if (!ret) {
+                        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "The signal %s of %s has a different type in the function and %s cannot convert it",
+                                            functionSignalName.Buffer(), dataSource.GetName(), brokerClassName);
+                    }
+                }
+            }
+        }
+    }
+    return ret;
+}
+
 uint32 BrokerI::GetNumberOfRawCopies(const SignalDirection direction,
                                      const uint32 functionIdx,
                                      const uint32 functionNumberOfSignals,
@@ -185,6 +185,17 @@ protected:
                                    const char8 *const functionName,
                                    void *const gamMemoryAddress);
 
+    /**
+     * @brief Merges copy operations with the previous ones.
+     * @details A merged copy operation keeps the offset, signal index and function pointer of
+     * the first operation and its byte size is the sum of the merged operations byte sizes.
+     * @param[in] mergeWithPrevious array with GetNumberOfCopies() elements. If mergeWithPrevious[i] is true
+     * the copy operation i is merged with the copy operation i - 1 (mergeWithPrevious[0] is ignored).
+     * @post
+     *   GetNumberOfCopies() == 1 + number of false elements in mergeWithPrevious[1...]
+     */
+    void MergeCopies(const bool * const mergeWithPrevious);
+
     /**
      * Number of copy operations to be performed by this BrokerI.
      */
@@ -253,6 +264,23 @@ private:
         uint32 signalDSByteOffsets;
     };
 
+    /**
+     * @brief Checks that the signals of this broker have the same type in the function and in the DataSourceI.
+     * @details The signals whose type is converted (see DataSourceI::GetFunctionSignalType) can only be copied by a converting broker
+     * (e.g. MemoryMapConvertingInputBroker) and not by the brokers built with InitFunctionPointers.
+     * @param[in] direction direction of the signals. It can be InputSignals or OutputSignals
+     * @param[in] functionIdx the function index.
+     * @param[in] functionNumberOfSignals the number of signals of the function in this direction.
+     * @param[in] dataSource the dataSource involved in the copy operation.
+     * @param[in] brokerClassName the name of this broker.
+     * @return true if no signal of this broker has a different type in the function and in the \a dataSource.
+     */
+    bool CheckSignalTypes(const SignalDirection direction,
+                          const uint32 functionIdx,
+                          const uint32 functionNumberOfSignals,
+                          DataSourceI &dataSource,
+                          const char8 *const brokerClassName) const;
+
     /**
      * @brief Get the number of copies before copy optimisation.
      * @details The function interprets each sample as a possible different copy.
@@ -44,6 +44,13 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * Bits of DataSourceISignalsMetadata::available.
+ */
+static const uint8 SIGNAL_METADATA_DIMENSIONS = 0x1u;
+static const uint8 SIGNAL_METADATA_ELEMENTS = 0x2u;
+static const uint8 SIGNAL_METADATA_BYTE_SIZE = 0x4u;
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -51,10 +58,17 @@ namespace MARTe {
 DataSourceI::DataSourceI() :
         ReferenceContainer() {
     numberOfSignals = 0u;
+    signalsMetadata.numberOfSignals = 0u;
+    signalsMetadata.types = NULL_PTR(TypeDescriptor *);
+    signalsMetadata.numberOfDimensions = NULL_PTR(uint8 *);
+    signalsMetadata.numberOfElements = NULL_PTR(uint32 *);
+    signalsMetadata.byteSizes = NULL_PTR(uint32 *);
+    signalsMetadata.available = NULL_PTR(uint8 *);
 }
 
+/*lint -e{1551} no exception should be thrown*/
 DataSourceI::~DataSourceI() {
-
+    FreeSignalsMetadata();
 }
 
 bool DataSourceI::Initialise(StructuredDataI & data) {
@@ -85,8 +99,23 @@ bool DataSourceI::AddSignals(StructuredDataI &data) {
 bool DataSourceI::SetConfiguredDatabase(StructuredDataI & data) {
     configuredDatabase = dynamic_cast<ConfigurationDatabase &>(data);
     configuredDatabase.SetCurrentNodeAsRootNode();
+    signalsIndex.Reset();
+    functionsIndex.Reset();
+    FreeSignalsMetadata();
+    uint32 numberOfFunctions = 0u;
     if (configuredDatabase.MoveAbsolute("Functions")) {
         functionsDatabaseNode = configuredDatabase;
+        numberOfFunctions = configuredDatabase.GetNumberOfChildren();
+    }
+    uint32 f;
+    for (f = 0u; f < numberOfFunctions; f++) {
+        StreamString functionName;
+        if (configuredDatabase.MoveToChild(f)) {
+            if (configuredDatabase.Read("QualifiedName", functionName)) {
+                (void) functionsIndex.Insert(functionsIndex.Key(functionName.Buffer()), f);
+            }
+            (void) configuredDatabase.MoveToAncestor(1u);
+        }
     }
     bool ret = configuredDatabase.MoveAbsolute("Signals");
     if (ret) {
@@ -101,16 +130,73 @@ bool DataSourceI::SetConfiguredDatabase(StructuredDataI & data) {
             ret = configuredDatabase.Read("QualifiedName", signalName);
         }
         if (ret) {
-            uint32 nn = n;
-            ret = signalNameCache.Write(signalName.Buffer(), nn);
+            ret = signalsIndex.Insert(signalsIndex.Key(signalName.Buffer()), n);
         }
         if (ret) {
             ret = configuredDatabase.MoveToAncestor(1u);
         }
     }
+    if (ret) {
+        BuildSignalsMetadata();
+    }
     return ret;
 }
 
+void DataSourceI::BuildSignalsMetadata() {
+    uint32 n = numberOfSignals;
+    if (n > 0u) {
+        signalsMetadata.types = new TypeDescriptor[n];
+        signalsMetadata.numberOfDimensions = new uint8[n];
+        signalsMetadata.numberOfElements = new uint32[n];
+        signalsMetadata.byteSizes = new uint32[n];
+        uint8 *available = new uint8[n];
+        uint32 s;
+        for (s = 0u; s < n; s++) {
+            //Still reads from the configured database, as signalsMetadata.available is not set
+            available[s] = 0u;
+            signalsMetadata.types[s] = GetSignalType(s);
+            signalsMetadata.numberOfDimensions[s] = 0u;
+            if (GetSignalNumberOfDimensions(s, signalsMetadata.numberOfDimensions[s])) {
+                available[s] |= SIGNAL_METADATA_DIMENSIONS;
+            }
+            signalsMetadata.numberOfElements[s] = 0u;
+            if (GetSignalNumberOfElements(s, signalsMetadata.numberOfElements[s])) {
+                available[s] |= SIGNAL_METADATA_ELEMENTS;
+            }
+            signalsMetadata.byteSizes[s] = 0u;
+            if (GetSignalByteSize(s, signalsMetadata.byteSizes[s])) {
+                available[s] |= SIGNAL_METADATA_BYTE_SIZE;
+            }
+        }
+        signalsMetadata.numberOfSignals = n;
+        signalsMetadata.available = available;
+    }
+}
+
+void DataSourceI::FreeSignalsMetadata() {
+    if (signalsMetadata.types != NULL_PTR(TypeDescriptor *)) {
+        delete[] signalsMetadata.types;
+    }
+    if (signalsMetadata.numberOfDimensions != NULL_PTR(uint8 *)) {
+        delete[] signalsMetadata.numberOfDimensions;
+    }
+    if (signalsMetadata.numberOfElements != NULL_PTR(uint32 *)) {
+        delete[] signalsMetadata.numberOfElements;
+    }
+    if (signalsMetadata.byteSizes != NULL_PTR(uint32 *)) {
+        delete[] signalsMetadata.byteSizes;
+    }
+    if (signalsMetadata.available != NULL_PTR(uint8 *)) {
+        delete[] signalsMetadata.available;
+    }
+    signalsMetadata.numberOfSignals = 0u;
+    signalsMetadata.types = NULL_PTR(TypeDescriptor *);
+    signalsMetadata.numberOfDimensions = NULL_PTR(uint8 *);
+    signalsMetadata.numberOfElements = NULL_PTR(uint32 *);
+    signalsMetadata.byteSizes = NULL_PTR(uint32 *);
+    signalsMetadata.available = NULL_PTR(uint8 *);
+}
+
 uint32 DataSourceI::GetNumberOfSignals() const {
     return numberOfSignals;
 }
@@ -124,43 +210,100 @@ bool DataSourceI::GetSignalName(const uint32 signalIdx, StreamString &signalName
 }
 
 bool DataSourceI::GetSignalIndex(uint32 &signalIdx, const char8* const signalName) {
-    return signalNameCache.Read(signalName, signalIdx);
+    bool found = false;
+    uint32 key = signalsIndex.Key(signalName);
+    uint32 cursor = 0u;
+    uint32 candidate = 0u;
+    //Different names might share the same key
+    while ((!found) && (signalsIndex.Search(key, cursor, candidate))) {
+        StreamString candidateName;
+        if (GetSignalName(candidate, candidateName)) {
+            found = (StringHelper::Compare(signalName, candidateName.Buffer()) == 0);
+        }
+    }
+    if (found) {
+        signalIdx = candidate;
+    }
+    return found;
 }
 
 TypeDescriptor DataSourceI::GetSignalType(const uint32 signalIdx) {
     TypeDescriptor signalTypeDescriptor = InvalidType;
-    bool ret = MoveToSignalIndex(signalIdx);
-    StreamString signalType;
-    if (ret) {
-        ret = configuredDatabase.Read("Type", signalType);
+    if (signalsMetadata.available != NULL_PTR(uint8 *)) {
+        if (signalIdx < signalsMetadata.numberOfSignals) {
+            signalTypeDescriptor = signalsMetadata.types[signalIdx];
+        }
     }
-    if (ret) {
-        signalTypeDescriptor = TypeDescriptor::GetTypeDescriptorFromTypeName(signalType.Buffer());
+    else {
+        bool ret = MoveToSignalIndex(signalIdx);
+        StreamString signalType;
+        if (ret) {
+            ret = configuredDatabase.Read("Type", signalType);
+        }
+        if (ret) {
+            signalTypeDescriptor = TypeDescriptor::GetTypeDescriptorFromTypeName(signalType.Buffer());
+        }
     }
     return signalTypeDescriptor;
 }
 
 bool DataSourceI::GetSignalNumberOfDimensions(const uint32 signalIdx, uint8 &numberOfDimensions) {
-    bool ret = MoveToSignalIndex(signalIdx);
-    if (ret) {
-        ret = configuredDatabase.Read("NumberOfDimensions", numberOfDimensions);
+    bool ret;
+    if (signalsMetadata.available != NULL_PTR(uint8 *)) {
+        ret = (signalIdx < signalsMetadata.numberOfSignals);
+        if (ret) {
+            ret = ((signalsMetadata.available[signalIdx] & SIGNAL_METADATA_DIMENSIONS) != 0u);
+        }
+        if (ret) {
+            numberOfDimensions = signalsMetadata.numberOfDimensions[signalIdx];
+        }
+    }
+    else {
+        ret = MoveToSignalIndex(signalIdx);
+        if (ret) {
+            ret = configuredDatabase.Read("NumberOfDimensions", numberOfDimensions);
+        }
     }
     return ret;
 }
 
 bool DataSourceI::GetSignalNumberOfElements(const uint32 signalIdx, uint32 &numberOfElements) {
-    bool ret = MoveToSignalIndex(signalIdx);
-    if (ret) {
-        ret = configuredDatabase.Read("NumberOfElements", numberOfElements);
+    bool ret;
+    if (signalsMetadata.available != NULL_PTR(uint8 *)) {
+        ret = (signalIdx < signalsMetadata.numberOfSignals);
+        if (ret) {
+            ret = ((signalsMetadata.available[signalIdx] & SIGNAL_METADATA_ELEMENTS) != 0u);
+        }
+        if (ret) {
+            numberOfElements = signalsMetadata.numberOfElements[signalIdx];
+        }
+    }
+    else {
+        ret = MoveToSignalIndex(signalIdx);
+        if (ret) {
+            ret = configuredDatabase.Read("NumberOfElements", numberOfElements);
+        }
     }
     return ret;
 }
 
 bool DataSourceI::GetSignalByteSize(const uint32 signalIdx, uint32 &byteSize) {
-    bool ret = MoveToSignalIndex(signalIdx);
-    if (ret) {
-        if (!configuredDatabase.Read("MemberSize", byteSize)) {
-            ret = configuredDatabase.Read("ByteSize", byteSize);
+    bool ret;
+    if (signalsMetadata.available != NULL_PTR(uint8 *)) {
+        ret = (signalIdx < signalsMetadata.numberOfSignals);
+        if (ret) {
+            ret = ((signalsMetadata.available[signalIdx] & SIGNAL_METADATA_BYTE_SIZE) != 0u);
+        }
+        if (ret) {
+            byteSize = signalsMetadata.byteSizes[signalIdx];
+        }
+    }
+    else {
+        ret = MoveToSignalIndex(signalIdx);
+        if (ret) {
+            if (!configuredDatabase.Read("MemberSize", byteSize)) {
+                ret = configuredDatabase.Read("ByteSize", byteSize);
+            }
         }
     }
     return ret;
@@ -354,23 +497,21 @@ bool DataSourceI::GetFunctionName(const uint32 functionIdx, StreamString &functi
 }
 
 bool DataSourceI::GetFunctionIndex(uint32 &functionIdx, const char8* const functionName) {
-
-    uint32 numberOfFunctions = GetNumberOfFunctions();
-    bool ret = true;
     bool found = false;
-    uint32 i;
-    for (i = 0u; (i < numberOfFunctions) && (ret) && (!found); i++) {
-        StreamString searchName;
-        ret = GetFunctionName(i, searchName);
-        if (ret) {
-            found = (StringHelper::Compare(functionName, searchName.Buffer()) == 0);
-            functionIdx = i;
+    uint32 key = functionsIndex.Key(functionName);
+    uint32 cursor = 0u;
+    uint32 candidate = 0u;
+    //Different names might share the same key
+    while ((!found) && (functionsIndex.Search(key, cursor, candidate))) {
+        StreamString candidateName;
+        if (GetFunctionName(candidate, candidateName)) {
+            found = (StringHelper::Compare(functionName, candidateName.Buffer()) == 0);
         }
     }
-    if (ret) {
-        ret = found;
+    if (found) {
+        functionIdx = candidate;
     }
-    return ret;
+    return found;
 }
 
 bool DataSourceI::GetFunctionNumberOfSignals(const SignalDirection direction, const uint32 functionIdx, uint32 &numSignals) {
@@ -510,6 +651,22 @@ bool DataSourceI::GetFunctionSignalTrigger(const SignalDirection direction, cons
     return ret;
 }
 
+bool DataSourceI::GetFunctionSignalDecimation(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, uint32 &decimation) {
+    bool ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
+    if (!configuredDatabase.Read("Decimation", decimation)) {
+        decimation = 1u;
+    }
+    return ret;
+}
+
+bool DataSourceI::GetFunctionSignalReduction(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, StreamString &reduction) {
+    bool ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
+    if (!configuredDatabase.Read("Reduction", reduction)) {
+        reduction = "Mean";
+    }
+    return ret;
+}
+
 bool DataSourceI::GetFunctionSignalGAMMemoryOffset(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, uint32 &memoryOffset) {
 
     bool ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
@@ -519,6 +676,19 @@ bool DataSourceI::GetFunctionSignalGAMMemoryOffset(const SignalDirection directi
     return ret;
 }
 
+bool DataSourceI::GetFunctionSignalType(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, TypeDescriptor &type) {
+    bool ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
+    StreamString typeName;
+    if (ret) {
+        ret = configuredDatabase.Read("Type", typeName);
+    }
+    if (ret) {
+        type = TypeDescriptor::GetTypeDescriptorFromTypeName(typeName.Buffer());
+        ret = (type != InvalidType);
+    }
+    return ret;
+}
+
 bool DataSourceI::IsSupportedBroker(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, const char8* const brokerClassName) {
     bool ret = MoveToFunctionSignalIndex(direction, functionIdx, functionSignalIdx);
     if (ret) {
@@ -842,6 +1012,9 @@ bool DataSourceI::GetOutputBrokers(ReferenceContainer &outputBrokers,
 void DataSourceI::Purge(ReferenceContainer &purgeList){
     signalsDatabaseNode.Purge();
     functionsDatabaseNode.Purge();
+    FreeSignalsMetadata();
+    signalsIndex.Reset();
+    functionsIndex.Reset();
     ReferenceContainer::Purge(purgeList);
 }
 
@@ -874,6 +1047,23 @@ bool DataSourceI::GetOutputOffset(const uint32 signalIdx, const uint32 numberOfS
     return false;
 }
 
+/*lint -e{613} segments is not NULL if numberOfBuffers > 0.*/
+bool DataSourceI::SynchroniseBatch(const DataSourceBufferSegment * const segments, const uint32 numberOfBuffers, const uint32 numberOfSegmentsPerBuffer) {
+    bool ret = true;
+    uint32 b;
+    for (b = 0u; (b < numberOfBuffers) && (ret); b++) {
+        uint32 s;
+        for (s = 0u; (s < numberOfSegmentsPerBuffer) && (ret); s++) {
+            const DataSourceBufferSegment &segment = segments[(b * numberOfSegmentsPerBuffer) + s];
+            ret = MemoryOperationsHelper::Copy(segment.destination, segment.source, segment.size);
+        }
+        if (ret) {
+            ret = Synchronise();
+        }
+    }
+    return ret;
+}
+
 /*lint -e{715} The symbols are not referenced because this is a default implementation, i.e. it is expected to be implemented on derived classes.*/
 bool DataSourceI::TerminateInputCopy(const uint32 signalIdx, const uint32 offset, const uint32 numberOfSamples) {
     return true;
@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "ConfigurationDatabase.h"
+#include "HashIndex.h"
 #include "ReferenceContainer.h"
 #include "ReferenceT.h"
 #include "StatefulI.h"
@@ -50,6 +51,68 @@ enum SignalDirection {
     InputSignals, OutputSignals, None
 };
 
+/**
+ * @brief Describes a block of memory, ready to be consumed by a DataSourceI, and the DataSourceI memory where it belongs (see DataSourceI::SynchroniseBatch).
+ */
+struct DataSourceBufferSegment {
+    /**
+     * The address of the data to be consumed.
+     */
+    const void *source;
+
+    /**
+     * The address of the DataSourceI memory where the data would be copied to.
+     */
+    void *destination;
+
+    /**
+     * The number of bytes of the segment.
+     */
+    uint32 size;
+
+    /**
+     * The HighResolutionTimer::Counter() when the buffer was produced (0 if unknown). The same for all the segments of a buffer.
+     */
+    uint64 timestamp;
+};
+
+/**
+ * @brief The properties of the signals of a DataSourceI, copied from the configured database by
+ * DataSourceI::SetConfiguredDatabase (one array per property, indexed by the signal index).
+ */
+struct DataSourceISignalsMetadata {
+    /**
+     * The number of signals in the arrays.
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * The signal types.
+     */
+    TypeDescriptor *types;
+
+    /**
+     * The signal number of dimensions.
+     */
+    uint8 *numberOfDimensions;
+
+    /**
+     * The signal number of elements.
+     */
+    uint32 *numberOfElements;
+
+    /**
+     * The signal sizes in bytes (MemberSize or ByteSize).
+     */
+    uint32 *byteSizes;
+
+    /**
+     * For each signal, the bitmask of the properties found in the configured database.
+     * NULL until all the arrays are filled.
+     */
+    uint8 *available;
+};
+
 /**
  * @brief Interface for the components that interact with hardware.
  * @details The main role of components that implement this interface is to
@@ -132,6 +195,7 @@ public:
      *            Signals = {
      *              *NUMBER = {
      *                QualifiedName = "QualifiedName of the Signal"
+     *                Type = "Type of the signal in the Function"
      *                +ByteOffset = { { min_idx_bytes range_bytes } { min_idx_bytes range_bytes } ... }
      *                Frequency = -1|NUMBER>0
      *                Trigger = 0|1
@@ -460,6 +524,32 @@ public:
      */
     bool GetFunctionSignalTrigger(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, uint32 &trigger);
 
+    /**
+     * @brief Gets the decimation that was set for the signal with index \a functionSignalIdx.
+     * @details The Decimation parameter defines the number of cycles that are reduced into one value by the broker (see MemoryMapDecimatingBroker).
+     * @param[in] direction the signal direction.
+     * @param[in] functionIdx the index of the function.
+     * @param[in] functionSignalIdx the index of the signal in this function.
+     * @param[out] decimation the number of cycles reduced into one value (one if the Decimation parameter was not set).
+     * @return true if the functionIdx and the functionSignalIdx exist in the specified direction.
+     * @pre
+     *   SetConfiguredDatabase
+     */
+    bool GetFunctionSignalDecimation(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, uint32 &decimation);
+
+    /**
+     * @brief Gets the reduction that was set for the signal with index \a functionSignalIdx.
+     * @details The Reduction parameter defines how the Decimation cycles are reduced into one value (see MemoryMapDecimatingBroker).
+     * @param[in] direction the signal direction.
+     * @param[in] functionIdx the index of the function.
+     * @param[in] functionSignalIdx the index of the signal in this function.
+     * @param[out] reduction the name of the reduction (Mean if the Reduction parameter was not set).
+     * @return true if the functionIdx and the functionSignalIdx exist in the specified direction.
+     * @pre
+     *   SetConfiguredDatabase
+     */
+    bool GetFunctionSignalReduction(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, StreamString &reduction);
+
     /**
      * @brief Gets the offset in bytes of this signal with respect to the beginning of the GAM signal memory address.
      * @param[in] direction the signal direction.
@@ -472,6 +562,20 @@ public:
      */
     bool GetFunctionSignalGAMMemoryOffset(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, uint32 &memoryOffset);
 
+    /**
+     * @brief Gets the type of the signal with index \a functionSignalIdx as declared by the function.
+     * @details It differs from the GetSignalType of the DataSourceI signal only when the function asked for a type
+     * conversion (see DataSourceType in RealTimeApplicationConfigurationBuilder).
+     * @param[in] direction the signal direction.
+     * @param[in] functionIdx the index of the function.
+     * @param[in] functionSignalIdx the index of the signal in this function.
+     * @param[out] type the type of the signal in the function.
+     * @return true if the functionIdx and the functionSignalIdx exist in the specified direction and the Type is a valid type.
+     * @pre
+     *   SetConfiguredDatabase
+     */
+    bool GetFunctionSignalType(const SignalDirection direction, const uint32 functionIdx, const uint32 functionSignalIdx, TypeDescriptor &type);
+
     /**
      * @brief Checks if the broker with name \a brokerClassName is suitable for this signal
      * @param[in] direction the signal direction.
@@ -499,6 +603,18 @@ public:
      */
     virtual bool Synchronise() = 0;
 
+    /**
+     * @brief Consumes a batch of consecutive buffers produced asynchronously (e.g. by the MemoryMapAsyncOutputBroker).
+     * @details The segment \a s of the buffer \a b is segments[(b * numberOfSegmentsPerBuffer) + s] and the buffers are ordered from the oldest to the newest.
+     * The default implementation copies, for each buffer, all its segments into the DataSourceI memory (destination) and calls Synchronise, i.e. the buffers are
+     * consumed one by one. A DataSourceI may override it to consume the whole batch at once directly from the source addresses (e.g. with a single writev).
+     * @param[in] segments the list of segments.
+     * @param[in] numberOfBuffers the number of buffers in the batch.
+     * @param[in] numberOfSegmentsPerBuffer the number of segments of each buffer.
+     * @return true if all the buffers were successfully consumed.
+     */
+    virtual bool SynchroniseBatch(const DataSourceBufferSegment * const segments, const uint32 numberOfBuffers, const uint32 numberOfSegmentsPerBuffer);
+
     /**
      * @brief Allocate the memory for this DataSourceI.
      * @return true if the memory can be successfully allocated.
@@ -693,9 +809,29 @@ private:
     ConfigurationDatabase functionsDatabaseNode;
 
     /**
-     * Accelerator for the signal names.
+     * @brief Copies the signal properties from the configured database into signalsMetadata.
+     */
+    void BuildSignalsMetadata();
+
+    /**
+     * @brief Frees the signalsMetadata arrays.
+     */
+    void FreeSignalsMetadata();
+
+    /**
+     * The signal properties, so that the GetSignal* methods do not need to read the configured database.
+     */
+    DataSourceISignalsMetadata signalsMetadata;
+
+    /**
+     * Index of the signal QualifiedNames. The values are the signal indexes.
+     */
+    HashIndex<uint32, WyHashFunction> signalsIndex;
+
+    /**
+     * Index of the Function QualifiedNames. The values are the function indexes.
      */
-    ConfigurationDatabase signalNameCache;
+    HashIndex<uint32, WyHashFunction> functionsIndex;
 };
 
 }
@@ -43,9 +43,12 @@ namespace MARTe {
 
 ExecutableI::ExecutableI() {
     timingSignalAddress = NULL_PTR(uint32 * const);
+    timingHistogram = NULL_PTR(LatencyHistogram *);
+    performanceCounters = NULL_PTR(ExecutablePerformanceCounters *);
+    traceNameId = 0u;
 }
 
-/*lint -e{1540} the timingSignalAddress is to freed by the class that uses the ExecutableI, typically a GAMSchedulerI.*/
+/*lint -e{1540} the timingSignalAddress, the timingHistogram and the performanceCounters are to freed by the class that uses the ExecutableI, typically a GAMSchedulerI.*/
 ExecutableI::~ExecutableI() {
 }
 
@@ -53,4 +56,16 @@ void ExecutableI::SetTimingSignalAddress(uint32 * const timingSignalAddressIn) {
     timingSignalAddress = timingSignalAddressIn;
 }
 
+void ExecutableI::SetTimingHistogram(LatencyHistogram * const timingHistogramIn) {
+    timingHistogram = timingHistogramIn;
+}
+
+void ExecutableI::SetPerformanceCounters(ExecutablePerformanceCounters * const performanceCountersIn) {
+    performanceCounters = performanceCountersIn;
+}
+
+void ExecutableI::SetTraceNameId(const uint32 traceNameIdIn) {
+    traceNameId = traceNameIdIn;
+}
+
 }
@@ -31,6 +31,8 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "LatencyHistogram.h"
+#include "PerformanceCounters.h"
 #include "ReferenceContainer.h"
 
 /*---------------------------------------------------------------------------*/
@@ -38,6 +40,27 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe{
 
+/**
+ * @brief The hardware performance counters of an ExecutableI (see TimingDataSource).
+ */
+struct ExecutablePerformanceCounters {
+    /**
+     * The signals where the number of events of the last execution are written, indexed as PerformanceCounters::Read
+     * (NULL for the counters which are not read by any GAM).
+     */
+    uint64 *outputs[PerformanceCounters::NUMBER_OF_COUNTERS];
+
+    /**
+     * The number of events accumulated over all the executions.
+     */
+    uint64 totals[PerformanceCounters::NUMBER_OF_COUNTERS];
+
+    /**
+     * The number of executions accumulated in totals.
+     */
+    uint64 numberOfSamples;
+};
+
 /**
  * @brief Classes that implement this interface are schedulable and can be
  *  executed by a GAMSchedulerI.
@@ -75,9 +98,51 @@ public:
      */
     inline uint32 *GetTimingSignalAddress();
 
+    /**
+     * @brief Sets the histogram to be updated with the execution time of this component.
+     * @param[in] timingHistogramIn the histogram (NULL if no histogram is to be updated).
+     */
+    void SetTimingHistogram(LatencyHistogram * const timingHistogramIn);
+
+    /**
+     * @brief Gets the histogram to be updated with the execution time of this component.
+     * @return the histogram to be updated with the execution time of this component (may be NULL).
+     */
+    inline LatencyHistogram *GetTimingHistogram();
+
+    /**
+     * @brief Sets the performance counters to be updated with the events counted during the execution of this component.
+     * @param[in] performanceCountersIn the performance counters (NULL if the events are not to be counted).
+     */
+    void SetPerformanceCounters(ExecutablePerformanceCounters * const performanceCountersIn);
+
+    /**
+     * @brief Gets the performance counters to be updated with the events counted during the execution of this component.
+     * @return the performance counters to be updated (may be NULL).
+     */
+    inline ExecutablePerformanceCounters *GetPerformanceCounters();
+
+    /**
+     * @brief Sets the identifier of the name with which the executions of this component are traced (see Trace).
+     * @param[in] traceNameIdIn the identifier returned by Trace::RegisterName.
+     */
+    void SetTraceNameId(const uint32 traceNameIdIn);
+
+    /**
+     * @brief Gets the identifier of the name with which the executions of this component are traced.
+     * @return the identifier of the name (0 if not set).
+     */
+    inline uint32 GetTraceNameId() const;
+
 private:
 
     uint32 * timingSignalAddress;
+
+    LatencyHistogram * timingHistogram;
+
+    ExecutablePerformanceCounters * performanceCounters;
+
+    uint32 traceNameId;
 };
 
 
@@ -89,6 +154,18 @@ uint32 * ExecutableI::GetTimingSignalAddress() {
     return timingSignalAddress;
 }
 
+LatencyHistogram * ExecutableI::GetTimingHistogram() {
+    return timingHistogram;
+}
+
+ExecutablePerformanceCounters * ExecutableI::GetPerformanceCounters() {
+    return performanceCounters;
+}
+
+uint32 ExecutableI::GetTraceNameId() const {
+    return traceNameId;
+}
+
 }
 #endif /* EXECUTORI_H_ */
 	
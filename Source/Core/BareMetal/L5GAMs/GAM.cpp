@@ -31,6 +31,8 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "BrokerI.h"
 #include "GAM.h"
 #include "Reference.h"
@@ -39,6 +41,33 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+/**
+ * Bits of GAMSignalsMetadata::available.
+ */
+static const uint8 SIGNAL_METADATA_DIMENSIONS = 0x1u;
+static const uint8 SIGNAL_METADATA_ELEMENTS = 0x2u;
+static const uint8 SIGNAL_METADATA_BYTE_SIZE = 0x4u;
+static const uint8 SIGNAL_METADATA_SAMPLES = 0x8u;
+static const uint8 SIGNAL_METADATA_FREQUENCY = 0x10u;
+
+/**
+ * @brief Sets all the GAMSignalsMetadata arrays to NULL.
+ */
+static void ResetSignalsMetadata(GAMSignalsMetadata &metadata) {
+    metadata.numberOfSignals = 0u;
+    metadata.types = NULL_PTR(TypeDescriptor *);
+    metadata.numberOfDimensions = NULL_PTR(uint32 *);
+    metadata.numberOfElements = NULL_PTR(uint32 *);
+    metadata.byteSizes = NULL_PTR(uint32 *);
+    metadata.numberOfSamples = NULL_PTR(uint32 *);
+    metadata.frequencies = NULL_PTR(float32 *);
+    metadata.available = NULL_PTR(uint8 *);
+}
+
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -55,6 +84,13 @@ GAM::GAM() :
     inputSignalsMemoryIndexer = NULL_PTR(void**);
     outputSignalsMemoryIndexer = NULL_PTR(void**);
     gamHeap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
+    ResetSignalsMetadata(inputSignalsMetadata);
+    ResetSignalsMetadata(outputSignalsMetadata);
+    parametersCommitted = 0;
+    executeOnChange = false;
+    previousInputSignalsMemory = NULL_PTR(void*);
+    inputSignalsByteSize = 0u;
+    inputsInvalid = true;
 }
 
 /*lint -e{1551} no exception should be thrown*/
@@ -62,6 +98,9 @@ GAM::~GAM() {
     if (inputSignalsMemory != NULL_PTR(void*)) {
         gamHeap->Free(inputSignalsMemory);
     }
+    if (previousInputSignalsMemory != NULL_PTR(void*)) {
+        gamHeap->Free(previousInputSignalsMemory);
+    }
     if (outputSignalsMemory != NULL_PTR(void*)) {
         gamHeap->Free(outputSignalsMemory);
     }
@@ -71,6 +110,8 @@ GAM::~GAM() {
     if (outputSignalsMemoryIndexer != NULL_PTR(void**)) {
         delete[] outputSignalsMemoryIndexer;
     }
+    FreeSignalsMetadata(inputSignalsMetadata);
+    FreeSignalsMetadata(outputSignalsMetadata);
     /*lint -e{1740} pointer member 'gamHeap' points to a static object
      * returned by GlobalObjectsDatabase::Instance()->GetStandardHeap() */
 }
@@ -78,6 +119,11 @@ GAM::~GAM() {
 bool GAM::Initialise(StructuredDataI &data) {
 
     bool ret = ReferenceContainer::Initialise(data);
+    uint8 executeOnChangeIn = 0u;
+    if (!data.Read("ExecuteOnChange", executeOnChangeIn)) {
+        executeOnChangeIn = 0u;
+    }
+    executeOnChange = (executeOnChangeIn == 1u);
     if (data.MoveRelative("InputSignals")) {
         ret = signalsDatabase.Write("InputSignals", data);
         if (ret) {
@@ -119,6 +165,11 @@ bool GAM::AllocateInputSignalsMemory() {
             else {
                 ret = false;
             }
+            inputSignalsByteSize = totalByteSize;
+        }
+        if ((ret) && (executeOnChange)) {
+            previousInputSignalsMemory = gamHeap->Malloc(totalByteSize);
+            ret = (previousInputSignalsMemory != NULL_PTR(void*));
         }
         if (ret) {
             if (inputSignalsMemory != NULL_PTR(void*)) {
@@ -232,6 +283,66 @@ void* GAM::GetOutputSignalMemory(const uint32 signalIdx) const {
     return ret;
 }
 
+bool GAM::GetSignalMemoryElements(const SignalDirection direction,
+                                  const uint32 signalIdx,
+                                  const TypeDescriptor &type,
+                                  const uint32 numberOfRows,
+                                  void *&signalMemory,
+                                  uint32 &numberOfElements) {
+    if (direction == InputSignals) {
+        signalMemory = GetInputSignalMemory(signalIdx);
+    }
+    else {
+        signalMemory = GetOutputSignalMemory(signalIdx);
+    }
+    bool ret = (signalMemory != NULL_PTR(void*));
+    if (ret) {
+        ret = (GetSignalType(direction, signalIdx) == type);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The type of the signal %d does not match the type of the view", signalIdx);
+        }
+    }
+    uint32 byteSize = 0u;
+    if (ret) {
+        ret = GetSignalByteSize(direction, signalIdx, byteSize);
+    }
+    if (ret) {
+        uint32 samples = 1u;
+        if (GetSignalNumberOfSamples(direction, signalIdx, samples)) {
+            byteSize *= samples;
+        }
+        numberOfElements = (byteSize * 8u) / static_cast<uint32>(type.numberOfBits);
+        ret = (numberOfRows > 0u);
+        if (ret) {
+            ret = ((numberOfElements % numberOfRows) == 0u);
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The number of elements of the signal %d (%d) is not a multiple of %d", signalIdx, numberOfElements,
+                         numberOfRows);
+        }
+    }
+    return ret;
+}
+
+bool GAM::AliasInputSignalMemory(const uint32 signalIdx,
+                                 const GAM &producer,
+                                 const uint32 producerSignalIdx) {
+    bool ret = (signalIdx < numberOfInputSignals);
+    if (ret) {
+        ret = (inputSignalsMemoryIndexer != NULL_PTR(void**));
+    }
+    void *signalAddress = NULL_PTR(void*);
+    if (ret) {
+        signalAddress = producer.GetOutputSignalMemory(producerSignalIdx);
+        ret = (signalAddress != NULL_PTR(void*));
+    }
+    if (ret) {
+        /*lint -e{613} inputSignalsMemoryIndexer checked before.*/
+        inputSignalsMemoryIndexer[signalIdx] = signalAddress;
+    }
+    return ret;
+}
+
 bool GAM::SetConfiguredDatabase(const ConfigurationDatabase &data) {
     configuredDatabase = data;
     configuredDatabase.SetCurrentNodeAsRootNode();
@@ -245,10 +356,104 @@ bool GAM::SetConfiguredDatabase(const ConfigurationDatabase &data) {
         //-1 to ignore the ByteSize field
         numberOfOutputSignals = (configuredDatabase.GetNumberOfChildren() - 1u);
     }
+    inputSignalsIndex.Reset();
+    outputSignalsIndex.Reset();
+    FreeSignalsMetadata(inputSignalsMetadata);
+    FreeSignalsMetadata(outputSignalsMetadata);
+    uint32 i;
+    for (i = 0u; i < numberOfInputSignals; i++) {
+        StreamString signalName;
+        if (GetSignalName(InputSignals, i, signalName)) {
+            (void) inputSignalsIndex.Insert(inputSignalsIndex.Key(signalName.Buffer()), i);
+        }
+    }
+    for (i = 0u; i < numberOfOutputSignals; i++) {
+        StreamString signalName;
+        if (GetSignalName(OutputSignals, i, signalName)) {
+            (void) outputSignalsIndex.Insert(outputSignalsIndex.Key(signalName.Buffer()), i);
+        }
+    }
+    BuildSignalsMetadata(InputSignals, inputSignalsMetadata);
+    BuildSignalsMetadata(OutputSignals, outputSignalsMetadata);
 
     return true;
 }
 
+void GAM::BuildSignalsMetadata(const SignalDirection direction,
+                               GAMSignalsMetadata &metadata) {
+    uint32 n = (direction == InputSignals) ? (numberOfInputSignals) : (numberOfOutputSignals);
+    if (n > 0u) {
+        metadata.types = new TypeDescriptor[n];
+        metadata.numberOfDimensions = new uint32[n];
+        metadata.numberOfElements = new uint32[n];
+        metadata.byteSizes = new uint32[n];
+        metadata.numberOfSamples = new uint32[n];
+        metadata.frequencies = new float32[n];
+        uint8 *available = new uint8[n];
+        uint32 s;
+        for (s = 0u; s < n; s++) {
+            //Still reads from the configured database, as metadata.available is not set
+            available[s] = 0u;
+            metadata.types[s] = GetSignalType(direction, s);
+            metadata.numberOfDimensions[s] = 0u;
+            if (GetSignalNumberOfDimensions(direction, s, metadata.numberOfDimensions[s])) {
+                available[s] |= SIGNAL_METADATA_DIMENSIONS;
+            }
+            metadata.numberOfElements[s] = 0u;
+            if (GetSignalNumberOfElements(direction, s, metadata.numberOfElements[s])) {
+                available[s] |= SIGNAL_METADATA_ELEMENTS;
+            }
+            metadata.byteSizes[s] = 0u;
+            if (GetSignalByteSize(direction, s, metadata.byteSizes[s])) {
+                available[s] |= SIGNAL_METADATA_BYTE_SIZE;
+            }
+            metadata.numberOfSamples[s] = 0u;
+            if (GetSignalNumberOfSamples(direction, s, metadata.numberOfSamples[s])) {
+                available[s] |= SIGNAL_METADATA_SAMPLES;
+            }
+            metadata.frequencies[s] = 0.F;
+            if (GetSignalFrequency(direction, s, metadata.frequencies[s])) {
+                available[s] |= SIGNAL_METADATA_FREQUENCY;
+            }
+        }
+        metadata.numberOfSignals = n;
+        metadata.available = available;
+    }
+}
+
+void GAM::FreeSignalsMetadata(GAMSignalsMetadata &metadata) {
+    if (metadata.types != NULL_PTR(TypeDescriptor *)) {
+        delete[] metadata.types;
+    }
+    if (metadata.numberOfDimensions != NULL_PTR(uint32 *)) {
+        delete[] metadata.numberOfDimensions;
+    }
+    if (metadata.numberOfElements != NULL_PTR(uint32 *)) {
+        delete[] metadata.numberOfElements;
+    }
+    if (metadata.byteSizes != NULL_PTR(uint32 *)) {
+        delete[] metadata.byteSizes;
+    }
+    if (metadata.numberOfSamples != NULL_PTR(uint32 *)) {
+        delete[] metadata.numberOfSamples;
+    }
+    if (metadata.frequencies != NULL_PTR(float32 *)) {
+        delete[] metadata.frequencies;
+    }
+    if (metadata.available != NULL_PTR(uint8 *)) {
+        delete[] metadata.available;
+    }
+    ResetSignalsMetadata(metadata);
+}
+
+const GAMSignalsMetadata *GAM::GetSignalsMetadata(const SignalDirection direction) const {
+    const GAMSignalsMetadata *metadata = (direction == InputSignals) ? (&inputSignalsMetadata) : (&outputSignalsMetadata);
+    if (metadata->available == NULL_PTR(uint8 *)) {
+        metadata = NULL_PTR(const GAMSignalsMetadata *);
+    }
+    return metadata;
+}
+
 /*lint -e{715} The symbol 'context' is not referenced because
  * this is a default implementation, i.e. it is expected to be
  * implemented on derived classes.
@@ -262,6 +467,10 @@ void GAM::Purge(ReferenceContainer &purgeList) {
     outputBrokers.Purge(purgeList);
     inputSignalsDatabaseNode.Purge();
     outputSignalsDatabaseNode.Purge();
+    inputSignalsIndex.Reset();
+    outputSignalsIndex.Reset();
+    FreeSignalsMetadata(inputSignalsMetadata);
+    FreeSignalsMetadata(outputSignalsMetadata);
     signalsDatabase.Purge();
     configuredDatabase.Purge();
     ReferenceContainer::Purge(purgeList);
@@ -296,28 +505,22 @@ bool GAM::GetSignalName(const SignalDirection direction,
 bool GAM::GetSignalIndex(const SignalDirection direction,
                          uint32 &signalIdx,
                          const char8 *const signalName) {
-    uint32 numberOfSignals = 0u;
-    if (direction == InputSignals) {
-        numberOfSignals = GetNumberOfInputSignals();
-    }
-    else {
-        numberOfSignals = GetNumberOfOutputSignals();
-    }
-    bool ret = true;
+    HashIndex<uint32, WyHashFunction> &signalsIndex = (direction == InputSignals) ? (inputSignalsIndex) : (outputSignalsIndex);
     bool found = false;
-    uint32 i;
-    for (i = 0u; (i < numberOfSignals) && (ret) && (!found); i++) {
-        StreamString searchName;
-        ret = GetSignalName(direction, i, searchName);
-        if (ret) {
-            found = (StringHelper::Compare(signalName, searchName.Buffer()) == 0);
-            signalIdx = i;
+    uint32 key = signalsIndex.Key(signalName);
+    uint32 cursor = 0u;
+    uint32 candidate = 0u;
+    //Different names might share the same key
+    while ((!found) && (signalsIndex.Search(key, cursor, candidate))) {
+        StreamString candidateName;
+        if (GetSignalName(direction, candidate, candidateName)) {
+            found = (StringHelper::Compare(signalName, candidateName.Buffer()) == 0);
         }
     }
-    if (ret) {
-        ret = found;
+    if (found) {
+        signalIdx = candidate;
     }
-    return ret;
+    return found;
 }
 
 bool GAM::GetSignalDataSourceName(const SignalDirection direction,
@@ -334,13 +537,21 @@ bool GAM::GetSignalDataSourceName(const SignalDirection direction,
 TypeDescriptor GAM::GetSignalType(const SignalDirection direction,
                                   const uint32 signalIdx) {
     TypeDescriptor signalTypeDescriptor = InvalidType;
-    bool ret = MoveToSignalIndex(direction, signalIdx);
-    StreamString signalType;
-    if (ret) {
-        ret = configuredDatabase.Read("Type", signalType);
+    const GAMSignalsMetadata *metadata = GetSignalsMetadata(direction);
+    if (metadata != NULL_PTR(const GAMSignalsMetadata *)) {
+        if (signalIdx < metadata->numberOfSignals) {
+            signalTypeDescriptor = metadata->types[signalIdx];
+        }
     }
-    if (ret) {
-        signalTypeDescriptor = TypeDescriptor::GetTypeDescriptorFromTypeName(signalType.Buffer());
+    else {
+        bool ret = MoveToSignalIndex(direction, signalIdx);
+        StreamString signalType;
+        if (ret) {
+            ret = configuredDatabase.Read("Type", signalType);
+        }
+        if (ret) {
+            signalTypeDescriptor = TypeDescriptor::GetTypeDescriptorFromTypeName(signalType.Buffer());
+        }
     }
     return signalTypeDescriptor;
 }
@@ -348,9 +559,22 @@ TypeDescriptor GAM::GetSignalType(const SignalDirection direction,
 bool GAM::GetSignalNumberOfDimensions(const SignalDirection direction,
                                       const uint32 signalIdx,
                                       uint32 &numberOfDimensions) {
-    bool ret = MoveToSignalIndex(direction, signalIdx);
-    if (ret) {
-        ret = configuredDatabase.Read("NumberOfDimensions", numberOfDimensions);
+    bool ret;
+    const GAMSignalsMetadata *metadata = GetSignalsMetadata(direction);
+    if (metadata != NULL_PTR(const GAMSignalsMetadata *)) {
+        ret = (signalIdx < metadata->numberOfSignals);
+        if (ret) {
+            ret = ((metadata->available[signalIdx] & SIGNAL_METADATA_DIMENSIONS) != 0u);
+        }
+        if (ret) {
+            numberOfDimensions = metadata->numberOfDimensions[signalIdx];
+        }
+    }
+    else {
+        ret = MoveToSignalIndex(direction, signalIdx);
+        if (ret) {
+            ret = configuredDatabase.Read("NumberOfDimensions", numberOfDimensions);
+        }
     }
     return ret;
 }
@@ -358,9 +582,22 @@ bool GAM::GetSignalNumberOfDimensions(const SignalDirection direction,
 bool GAM::GetSignalNumberOfElements(const SignalDirection direction,
                                     const uint32 signalIdx,
                                     uint32 &numberOfElements) {
-    bool ret = MoveToSignalIndex(direction, signalIdx);
-    if (ret) {
-        ret = configuredDatabase.Read("NumberOfElements", numberOfElements);
+    bool ret;
+    const GAMSignalsMetadata *metadata = GetSignalsMetadata(direction);
+    if (metadata != NULL_PTR(const GAMSignalsMetadata *)) {
+        ret = (signalIdx < metadata->numberOfSignals);
+        if (ret) {
+            ret = ((metadata->available[signalIdx] & SIGNAL_METADATA_ELEMENTS) != 0u);
+        }
+        if (ret) {
+            numberOfElements = metadata->numberOfElements[signalIdx];
+        }
+    }
+    else {
+        ret = MoveToSignalIndex(direction, signalIdx);
+        if (ret) {
+            ret = configuredDatabase.Read("NumberOfElements", numberOfElements);
+        }
     }
     return ret;
 }
@@ -380,11 +617,23 @@ bool GAM::GetSignalDefaultValue(const SignalDirection direction,
 bool GAM::GetSignalByteSize(const SignalDirection direction,
                             const uint32 signalIdx,
                             uint32 &byteSize) {
-
-    bool ret = MoveToSignalIndex(direction, signalIdx);
-    if (ret) {
-        if (!configuredDatabase.Read("MemberSize", byteSize)) {
-            ret = configuredDatabase.Read("ByteSize", byteSize);
+    bool ret;
+    const GAMSignalsMetadata *metadata = GetSignalsMetadata(direction);
+    if (metadata != NULL_PTR(const GAMSignalsMetadata *)) {
+        ret = (signalIdx < metadata->numberOfSignals);
+        if (ret) {
+            ret = ((metadata->available[signalIdx] & SIGNAL_METADATA_BYTE_SIZE) != 0u);
+        }
+        if (ret) {
+            byteSize = metadata->byteSizes[signalIdx];
+        }
+    }
+    else {
+        ret = MoveToSignalIndex(direction, signalIdx);
+        if (ret) {
+            if (!configuredDatabase.Read("MemberSize", byteSize)) {
+                ret = configuredDatabase.Read("ByteSize", byteSize);
+            }
         }
     }
     return ret;
@@ -482,51 +731,64 @@ bool GAM::GetSignalRangesInfo(const SignalDirection direction,
 bool GAM::GetSignalNumberOfSamples(const SignalDirection direction,
                                    const uint32 signalIdx,
                                    uint32 &numberOfSamples) {
-    StreamString dataSourceName;
-
-    bool ret = GetSignalDataSourceName(direction, signalIdx, dataSourceName);
-
-    if (ret) {
-        ret = configuredDatabase.MoveToRoot();
-    }
-    //This information is stored in the Memory node
-    const char8 *signalDirection = "Memory.InputSignals";
-    if (direction == OutputSignals) {
-        signalDirection = "Memory.OutputSignals";
-    }
-    if (ret) {
-        ret = configuredDatabase.MoveRelative(signalDirection);
+    bool ret;
+    const GAMSignalsMetadata *metadata = GetSignalsMetadata(direction);
+    if (metadata != NULL_PTR(const GAMSignalsMetadata *)) {
+        ret = (signalIdx < metadata->numberOfSignals);
+        if (ret) {
+            ret = ((metadata->available[signalIdx] & SIGNAL_METADATA_SAMPLES) != 0u);
+        }
+        if (ret) {
+            numberOfSamples = metadata->numberOfSamples[signalIdx];
+        }
     }
+    else {
+        StreamString dataSourceName;
+
+        ret = GetSignalDataSourceName(direction, signalIdx, dataSourceName);
 
-    uint32 n;
-    uint32 numberOfDataSources = configuredDatabase.GetNumberOfChildren();
-    bool found = false;
-    ConfigurationDatabase configuredDatabaseBeforeMove = configuredDatabase;
-    for (n = 0u; (n < numberOfDataSources) && (!found) && (ret); n++) {
-        //Move to the next DataSource
-        ret = configuredDatabase.MoveToChild(n);
-        StreamString thisDataSourceName;
         if (ret) {
-            ret = configuredDatabase.Read("DataSource", thisDataSourceName);
+            ret = configuredDatabase.MoveToRoot();
+        }
+        //This information is stored in the Memory node
+        const char8 *signalDirection = "Memory.InputSignals";
+        if (direction == OutputSignals) {
+            signalDirection = "Memory.OutputSignals";
         }
         if (ret) {
-            found = (thisDataSourceName == dataSourceName);
-            if (found) {
-                ret = configuredDatabase.MoveRelative("Signals");
-                if (ret) {
-                    StreamString signalIdxStr;
-                    ret = signalIdxStr.Printf("%d", signalIdx);
+            ret = configuredDatabase.MoveRelative(signalDirection);
+        }
+
+        uint32 n;
+        uint32 numberOfDataSources = configuredDatabase.GetNumberOfChildren();
+        bool found = false;
+        ConfigurationDatabase configuredDatabaseBeforeMove = configuredDatabase;
+        for (n = 0u; (n < numberOfDataSources) && (!found) && (ret); n++) {
+            //Move to the next DataSource
+            ret = configuredDatabase.MoveToChild(n);
+            StreamString thisDataSourceName;
+            if (ret) {
+                ret = configuredDatabase.Read("DataSource", thisDataSourceName);
+            }
+            if (ret) {
+                found = (thisDataSourceName == dataSourceName);
+                if (found) {
+                    ret = configuredDatabase.MoveRelative("Signals");
                     if (ret) {
-                        ret = configuredDatabase.MoveRelative(signalIdxStr.Buffer());
+                        StreamString signalIdxStr;
+                        ret = signalIdxStr.Printf("%d", signalIdx);
+                        if (ret) {
+                            ret = configuredDatabase.MoveRelative(signalIdxStr.Buffer());
+                        }
+                    }
+                    if (ret) {
+                        ret = configuredDatabase.Read("Samples", numberOfSamples);
                     }
-                }
-                if (ret) {
-                    ret = configuredDatabase.Read("Samples", numberOfSamples);
                 }
             }
-        }
-        if (ret) {
-            configuredDatabase = configuredDatabaseBeforeMove;
+            if (ret) {
+                configuredDatabase = configuredDatabaseBeforeMove;
+            }
         }
     }
     return ret;
@@ -535,51 +797,64 @@ bool GAM::GetSignalNumberOfSamples(const SignalDirection direction,
 bool GAM::GetSignalFrequency(const SignalDirection direction,
                              const uint32 signalIdx,
                              float32 &frequency) {
-    StreamString dataSourceName;
-
-    bool ret = GetSignalDataSourceName(direction, signalIdx, dataSourceName);
-
-    if (ret) {
-        ret = configuredDatabase.MoveToRoot();
-    }
-    //This information is stored in the Memory node
-    const char8 *signalDirection = "Memory.InputSignals";
-    if (direction == OutputSignals) {
-        signalDirection = "Memory.OutputSignals";
-    }
-    if (ret) {
-        ret = configuredDatabase.MoveRelative(signalDirection);
+    bool ret;
+    const GAMSignalsMetadata *metadata = GetSignalsMetadata(direction);
+    if (metadata != NULL_PTR(const GAMSignalsMetadata *)) {
+        ret = (signalIdx < metadata->numberOfSignals);
+        if (ret) {
+            ret = ((metadata->available[signalIdx] & SIGNAL_METADATA_FREQUENCY) != 0u);
+        }
+        if (ret) {
+            frequency = metadata->frequencies[signalIdx];
+        }
     }
+    else {
+        StreamString dataSourceName;
+
+        ret = GetSignalDataSourceName(direction, signalIdx, dataSourceName);
 
-    uint32 n;
-    uint32 numberOfDataSources = configuredDatabase.GetNumberOfChildren();
-    bool found = false;
-    ConfigurationDatabase configuredDatabaseBeforeMove = configuredDatabase;
-    for (n = 0u; (n < numberOfDataSources) && (!found) && (ret); n++) {
-        //Move to the next DataSource
-        StreamString thisDataSourceName;
-        ret = configuredDatabase.MoveToChild(n);
         if (ret) {
-            ret = configuredDatabase.Read("DataSource", thisDataSourceName);
+            ret = configuredDatabase.MoveToRoot();
+        }
+        //This information is stored in the Memory node
+        const char8 *signalDirection = "Memory.InputSignals";
+        if (direction == OutputSignals) {
+            signalDirection = "Memory.OutputSignals";
         }
         if (ret) {
-            found = (thisDataSourceName == dataSourceName);
-            if (found) {
-                ret = configuredDatabase.MoveRelative("Signals");
-                if (ret) {
-                    StreamString signalIdxStr;
-                    ret = signalIdxStr.Printf("%d", signalIdx);
+            ret = configuredDatabase.MoveRelative(signalDirection);
+        }
+
+        uint32 n;
+        uint32 numberOfDataSources = configuredDatabase.GetNumberOfChildren();
+        bool found = false;
+        ConfigurationDatabase configuredDatabaseBeforeMove = configuredDatabase;
+        for (n = 0u; (n < numberOfDataSources) && (!found) && (ret); n++) {
+            //Move to the next DataSource
+            StreamString thisDataSourceName;
+            ret = configuredDatabase.MoveToChild(n);
+            if (ret) {
+                ret = configuredDatabase.Read("DataSource", thisDataSourceName);
+            }
+            if (ret) {
+                found = (thisDataSourceName == dataSourceName);
+                if (found) {
+                    ret = configuredDatabase.MoveRelative("Signals");
                     if (ret) {
-                        ret = configuredDatabase.MoveRelative(signalIdxStr.Buffer());
+                        StreamString signalIdxStr;
+                        ret = signalIdxStr.Printf("%d", signalIdx);
+                        if (ret) {
+                            ret = configuredDatabase.MoveRelative(signalIdxStr.Buffer());
+                        }
+                    }
+                    if (ret) {
+                        ret = configuredDatabase.Read("Frequency", frequency);
                     }
-                }
-                if (ret) {
-                    ret = configuredDatabase.Read("Frequency", frequency);
                 }
             }
-        }
-        if (ret) {
-            configuredDatabase = configuredDatabaseBeforeMove;
+            if (ret) {
+                configuredDatabase = configuredDatabaseBeforeMove;
+            }
         }
     }
     return ret;
@@ -696,6 +971,56 @@ bool GAM::GetOutputBrokers(ReferenceContainer &brokers) {
     return ret;
 }
 
+/*lint -e{715} data is not used by the default implementation.*/
+bool GAM::PrepareParameters(StructuredDataI &data) {
+    REPORT_ERROR(ErrorManagement::UnsupportedFeature, "The parameters of the GAM cannot be reloaded");
+    return false;
+}
+
+void GAM::CommitParameters() {
+    Atomic::StoreRelease(&parametersCommitted, 1);
+}
+
+bool GAM::IsCommitPending() const {
+    return (Atomic::LoadAcquire(&parametersCommitted) != 0);
+}
+
+bool GAM::IsExecuteOnChange() const {
+    return executeOnChange;
+}
+
+bool GAM::InputsChanged() {
+    bool changed = true;
+    if (previousInputSignalsMemory != NULL_PTR(void*)) {
+        if (inputsInvalid) {
+            inputsInvalid = false;
+        }
+        else {
+            //Vectorised by the C library
+            changed = (MemoryOperationsHelper::Compare(inputSignalsMemory, previousInputSignalsMemory, inputSignalsByteSize) != 0);
+        }
+        if (changed) {
+            (void) MemoryOperationsHelper::Copy(previousInputSignalsMemory, inputSignalsMemory, inputSignalsByteSize);
+        }
+        else {
+            changed = IsCommitPending();
+        }
+    }
+    return changed;
+}
+
+void GAM::InvalidateInputs() {
+    inputsInvalid = true;
+}
+
+bool GAM::ParametersCommitted() {
+    bool committed = (Atomic::LoadAcquire(&parametersCommitted) != 0);
+    if (committed) {
+        committed = (Atomic::Exchange(&parametersCommitted, 0) != 0);
+    }
+    return committed;
+}
+
 bool GAM::ExportData(StructuredDataI &data) {
     bool ok = ReferenceContainer::ExportData(data);
     if (numberOfInputSignals > 0u) {
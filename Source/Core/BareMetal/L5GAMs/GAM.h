@@ -34,6 +34,9 @@
 
 #include "DataSourceI.h"
 #include "ExecutableI.h"
+#include "HashIndex.h"
+#include "MatrixView.h"
+#include "VectorView.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -41,6 +44,53 @@
 
 namespace MARTe {
 
+/**
+ * @brief The properties of the signals of a GAM (in one direction), copied from the configured database by
+ * GAM::SetConfiguredDatabase (one array per property, indexed by the signal index).
+ */
+struct GAMSignalsMetadata {
+    /**
+     * The number of signals in the arrays.
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * The signal types.
+     */
+    TypeDescriptor *types;
+
+    /**
+     * The signal number of dimensions.
+     */
+    uint32 *numberOfDimensions;
+
+    /**
+     * The signal number of elements.
+     */
+    uint32 *numberOfElements;
+
+    /**
+     * The signal sizes in bytes (MemberSize or ByteSize).
+     */
+    uint32 *byteSizes;
+
+    /**
+     * The signal number of samples.
+     */
+    uint32 *numberOfSamples;
+
+    /**
+     * The signal frequencies.
+     */
+    float32 *frequencies;
+
+    /**
+     * For each signal, the bitmask of the properties found in the configured database.
+     * NULL until all the arrays are filled.
+     */
+    uint8 *available;
+};
+
 /**
  * @brief The MARTe application module.
  *
@@ -51,6 +101,7 @@ namespace MARTe {
  * in RealTimeApplicationConfigurationBuilder):
  * +ThisGAMName = {"
  *    Class = ClassThatInheritsFromGAM"
+ *    ExecuteOnChange = 0|1 //Optional. Default = 0. If 1 the GAM, and its output brokers, are only executed when its inputs change (see InputsChanged).
  *    Signals = {
  *        InputSignals|OutputSignals = {
  *            NAME*={
@@ -393,6 +444,21 @@ public:
      */
     bool GetOutputBrokers(ReferenceContainer &brokers);
 
+    /**
+     * @brief Redirects the memory of an input signal to the output memory of the GAM that produces it.
+     * @details Called by the RealTimeApplication, before Setup(), for the input signals that the RealTimeApplicationConfigurationBuilder
+     *  resolved as zero-copy (see GAMDataSource). From then on GetInputSignalMemory(signalIdx) returns
+     *  producer.GetOutputSignalMemory(producerSignalIdx).
+     * @param[in] signalIdx the index of the input signal.
+     * @param[in] producer the GAM that produces the signal.
+     * @param[in] producerSignalIdx the index of the output signal in the \a producer.
+     * @return true if signalIdx < GetNumberOfInputSignals(), producerSignalIdx < producer.GetNumberOfOutputSignals() and
+     *  the memory of both GAMs was allocated.
+     */
+    bool AliasInputSignalMemory(const uint32 signalIdx,
+                                const GAM &producer,
+                                const uint32 producerSignalIdx);
+
     /**
      * @brief Sets a GAM shared context.
      * @details If this GAM belongs to a GAMGroup (association performed in the configuration stage of a RealTimeApplication)
@@ -423,9 +489,57 @@ public:
      */
     virtual bool ExportData(StructuredDataI & data);
 
+    /**
+     * @brief Prepares new values of the GAM parameters while the GAM is being executed (see RealTimeLoader::Reload).
+     * @details The new values shall be kept aside (i.e. not used by Execute) until CommitParameters is called. This method is called
+     * by a non real-time thread and may allocate memory.
+     * @param[in] data the new configuration node of the GAM (with the same signals of the node given to Initialise).
+     * @return true if the new parameters are valid. The default implementation returns false (the parameters cannot be reloaded).
+     * @pre !IsCommitPending()
+     */
+    virtual bool PrepareParameters(StructuredDataI & data);
+
+    /**
+     * @brief Requests the GAM to use the parameters prepared with PrepareParameters from its next cycle (see ParametersCommitted).
+     */
+    void CommitParameters();
+
+    /**
+     * @brief Checks if the last CommitParameters was not yet seen by Execute.
+     * @return true if the parameters were committed but not yet taken by Execute.
+     */
+    bool IsCommitPending() const;
+
+    /**
+     * @brief Checks if the GAM is only to be executed when its inputs change.
+     * @return true if ExecuteOnChange = 1.
+     */
+    bool IsExecuteOnChange() const;
+
+    /**
+     * @brief Checks if the input signals memory changed since the last call (called by the scheduler after the input brokers).
+     * @details The input signals memory is compared with a copy of the values seen by the previous execution, which is only
+     * updated when they differ.
+     * @return true if ExecuteOnChange is not set, if the GAM has no inputs, if the inputs changed, if the parameters were committed (see CommitParameters)
+     * or if this is the first call after InvalidateInputs.
+     */
+    bool InputsChanged();
+
+    /**
+     * @brief Forces the next InputsChanged to return true (called by the scheduler when the state changes).
+     */
+    void InvalidateInputs();
 
 protected:
 
+    /**
+     * @brief Checks, and clears, if CommitParameters was called since the last check.
+     * @details Meant to be called at the beginning of Execute, i.e. at a cycle boundary, where the GAM can swap the parameters
+     * prepared with PrepareParameters with the ones in use. Only an atomic load if nothing was committed.
+     * @return true if the prepared parameters shall be used from this cycle.
+     */
+    bool ParametersCommitted();
+
     /**
      * @brief Returns a pointer to the beginning of the input signals memory.
      * @return a pointer to the beginning of the input signals memory.
@@ -462,6 +576,77 @@ protected:
      */
     void *GetOutputSignalMemory(const uint32 signalIdx) const;
 
+    /**
+     * @brief Returns a view over the memory of the input signal with index \a signalIdx.
+     * @details The view aliases the GAM signal memory (no copy is performed) and covers all the elements of the signal
+     * (i.e. NumberOfElements * Samples, or the Ranges if they were specified).
+     * @param[in] signalIdx the index of the signal.
+     * @param[out] view the view over the signal memory.
+     * @return true if the signal exists, the memory is allocated and the signal type is T.
+     * @pre
+     *   The ConfiguredDatabase must be set
+     */
+    template<typename T>
+    bool GetInputSignalMemory(const uint32 signalIdx,
+                              VectorView<T> &view);
+
+    /**
+     * @brief Returns a row-major matrix view over the memory of the input signal with index \a signalIdx.
+     * @details The view aliases the GAM signal memory (no copy is performed). Sub-blocks, rows and columns can then be
+     * addressed in place with MatrixView::SubMatrix, MatrixView::Row and MatrixView::Column.
+     * @param[in] signalIdx the index of the signal.
+     * @param[out] view the view over the signal memory.
+     * @param[in] numberOfRows the number of rows of the matrix. The number of columns is the number of elements of the signal divided by \a numberOfRows.
+     * @return true if the signal exists, the memory is allocated, the signal type is T
+     * and the number of elements of the signal is a multiple of \a numberOfRows.
+     * @pre
+     *   The ConfiguredDatabase must be set
+     */
+    template<typename T>
+    bool GetInputSignalMemory(const uint32 signalIdx,
+                              MatrixView<T> &view,
+                              const uint32 numberOfRows);
+
+    /**
+     * @brief Returns a view over the memory of the output signal with index \a signalIdx.
+     * @param[in] signalIdx the index of the signal.
+     * @param[out] view the view over the signal memory.
+     * @return see GetInputSignalMemory(const uint32, VectorView<T> &)
+     */
+    template<typename T>
+    bool GetOutputSignalMemory(const uint32 signalIdx,
+                               VectorView<T> &view);
+
+    /**
+     * @brief Returns a row-major matrix view over the memory of the output signal with index \a signalIdx.
+     * @param[in] signalIdx the index of the signal.
+     * @param[out] view the view over the signal memory.
+     * @param[in] numberOfRows the number of rows of the matrix.
+     * @return see GetInputSignalMemory(const uint32, MatrixView<T> &, const uint32)
+     */
+    template<typename T>
+    bool GetOutputSignalMemory(const uint32 signalIdx,
+                               MatrixView<T> &view,
+                               const uint32 numberOfRows);
+
+    /**
+     * @brief Gets the memory and the number of elements of a signal, verifying its type.
+     * @param[in] direction the signal direction.
+     * @param[in] signalIdx the index of the signal.
+     * @param[in] type the expected type of the signal.
+     * @param[in] numberOfRows the number of elements shall be a multiple of this value.
+     * @param[out] signalMemory the memory of the signal.
+     * @param[out] numberOfElements the number of elements of type \a type held in \a signalMemory.
+     * @return true if the signal exists, the memory is allocated, the signal type is \a type
+     * and the number of elements is a multiple of \a numberOfRows.
+     */
+    bool GetSignalMemoryElements(const SignalDirection direction,
+                                 const uint32 signalIdx,
+                                 const TypeDescriptor &type,
+                                 const uint32 numberOfRows,
+                                 void *&signalMemory,
+                                 uint32 &numberOfElements);
+
     /**
      * Holds the Signals definition which are received in the Initialise phase.
      */
@@ -535,12 +720,128 @@ protected:
      * Accelerator reference for the outputSignalsDatabaseNode.
      */
     ConfigurationDatabase outputSignalsDatabaseNode;
+
+    /**
+     * @brief Copies the properties of the signals in one direction from the configured database into \a metadata.
+     * @param[in] direction the signal direction.
+     * @param[out] metadata the arrays to allocate and fill.
+     */
+    void BuildSignalsMetadata(const SignalDirection direction,
+                              GAMSignalsMetadata &metadata);
+
+    /**
+     * @brief Frees the arrays of \a metadata.
+     * @param[in,out] metadata the arrays to free.
+     */
+    static void FreeSignalsMetadata(GAMSignalsMetadata &metadata);
+
+    /**
+     * @brief Gets the metadata of the signals in one direction, if already built.
+     * @param[in] direction the signal direction.
+     * @return the metadata or NULL if SetConfiguredDatabase has not built it yet.
+     */
+    const GAMSignalsMetadata *GetSignalsMetadata(const SignalDirection direction) const;
+
+    /**
+     * The properties of the input signals, so that the GetSignal* methods do not need to read the configured database.
+     */
+    GAMSignalsMetadata inputSignalsMetadata;
+
+    /**
+     * The properties of the output signals.
+     */
+    GAMSignalsMetadata outputSignalsMetadata;
+
+    /**
+     * Index of the input signal QualifiedNames. The values are the signal indexes.
+     */
+    HashIndex<uint32, WyHashFunction> inputSignalsIndex;
+
+    /**
+     * Index of the output signal QualifiedNames. The values are the signal indexes.
+     */
+    HashIndex<uint32, WyHashFunction> outputSignalsIndex;
+
+    /**
+     * 1 from CommitParameters until ParametersCommitted.
+     */
+    volatile int32 parametersCommitted;
+
+    /**
+     * True if the GAM is only to be executed when its inputs change.
+     */
+    bool executeOnChange;
+
+    /**
+     * The input signals seen by the last execution (NULL if executeOnChange is false).
+     */
+    void *previousInputSignalsMemory;
+
+    /**
+     * The size in bytes of the input signals memory.
+     */
+    uint32 inputSignalsByteSize;
+
+    /**
+     * True if previousInputSignalsMemory is not to be trusted by the next InputsChanged.
+     */
+    bool inputsInvalid;
 };
 
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+template<typename T>
+bool GAM::GetInputSignalMemory(const uint32 signalIdx,
+                               VectorView<T> &view) {
+    void *signalMemory = NULL_PTR(void*);
+    uint32 numberOfElements = 0u;
+    bool ret = GetSignalMemoryElements(InputSignals, signalIdx, Type2TypeDescriptor<T>(), 1u, signalMemory, numberOfElements);
+    if (ret) {
+        view = VectorView<T>(static_cast<T*>(signalMemory), numberOfElements);
+    }
+    return ret;
+}
+
+template<typename T>
+bool GAM::GetInputSignalMemory(const uint32 signalIdx,
+                               MatrixView<T> &view,
+                               const uint32 numberOfRows) {
+    void *signalMemory = NULL_PTR(void*);
+    uint32 numberOfElements = 0u;
+    bool ret = GetSignalMemoryElements(InputSignals, signalIdx, Type2TypeDescriptor<T>(), numberOfRows, signalMemory, numberOfElements);
+    if (ret) {
+        view = MatrixView<T>(static_cast<T*>(signalMemory), numberOfRows, numberOfElements / numberOfRows);
+    }
+    return ret;
+}
+
+template<typename T>
+bool GAM::GetOutputSignalMemory(const uint32 signalIdx,
+                                VectorView<T> &view) {
+    void *signalMemory = NULL_PTR(void*);
+    uint32 numberOfElements = 0u;
+    bool ret = GetSignalMemoryElements(OutputSignals, signalIdx, Type2TypeDescriptor<T>(), 1u, signalMemory, numberOfElements);
+    if (ret) {
+        view = VectorView<T>(static_cast<T*>(signalMemory), numberOfElements);
+    }
+    return ret;
+}
+
+template<typename T>
+bool GAM::GetOutputSignalMemory(const uint32 signalIdx,
+                                MatrixView<T> &view,
+                                const uint32 numberOfRows) {
+    void *signalMemory = NULL_PTR(void*);
+    uint32 numberOfElements = 0u;
+    bool ret = GetSignalMemoryElements(OutputSignals, signalIdx, Type2TypeDescriptor<T>(), numberOfRows, signalMemory, numberOfElements);
+    if (ret) {
+        view = MatrixView<T>(static_cast<T*>(signalMemory), numberOfRows, numberOfElements / numberOfRows);
+    }
+    return ret;
+}
+
 }
 
 #endif /* GAM_H_ */
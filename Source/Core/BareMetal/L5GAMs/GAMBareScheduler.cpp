@@ -29,8 +29,11 @@
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "Atomic.h"
 #include "GAMBareScheduler.h"
 #include "RealTimeApplication.h"
+#include "Sleep.h"
+#include "Trace.h"
 
 namespace MARTe {
 
@@ -46,10 +49,17 @@ GAMBareScheduler::GAMBareScheduler() : GAMSchedulerI() {
     isAlive = false;
     maxCycles = 0u;
     nCycle = 0u;
+    numberOfCores = 0u;
+    cores = NULL_PTR(GAMBareSchedulerCore *);
+    stateWord = 0;
+    stateChangeTimeout = 1000u;
 }
 
 /*lint -e{1540} the scheduledStates life-cycle is managed by the GAMSchedulerI*/
 GAMBareScheduler::~GAMBareScheduler() {
+    if (cores != NULL_PTR(GAMBareSchedulerCore *)) {
+        delete[] cores;
+    }
 }
 
 bool GAMBareScheduler::ConfigureScheduler(Reference realTimeAppIn) {
@@ -62,17 +72,22 @@ bool GAMBareScheduler::ConfigureScheduler(Reference realTimeAppIn) {
 }
 
 ErrorManagement::ErrorType GAMBareScheduler::StartNextStateExecution() {
+    ErrorManagement::ErrorType err;
     isAlive = true;
-    
-    while(isAlive) { 
-        Cycle(0u); 
-        if (maxCycles != 0u) {
-            isAlive = (nCycle < maxCycles);
-            nCycle++;
+    if (numberOfCores > 0u) {
+        err = PublishState(true);
+    }
+    else {
+        while(isAlive) { 
+            ExecuteThreadCycle(realTimeApplication->GetIndex(), 0u); 
+            if (maxCycles != 0u) {
+                isAlive = (nCycle < maxCycles);
+                nCycle++;
+            }
         }
     }
     
-    return ErrorManagement::NoError;
+    return err;
 }
 
 bool GAMBareScheduler::Initialise(StructuredDataI & data) {
@@ -80,6 +95,21 @@ bool GAMBareScheduler::Initialise(StructuredDataI & data) {
     if (ok) {
         (void) (data.Read("MaxCycles", maxCycles));
         REPORT_ERROR(ErrorManagement::Information, "MaxCycles set to %d", maxCycles);
+        (void) (data.Read("ExternalCores", numberOfCores));
+        (void) (data.Read("StateChangeTimeout", stateChangeTimeout));
+        if (numberOfCores > 0u) {
+            REPORT_ERROR(ErrorManagement::Information, "ExternalCores set to %d", numberOfCores);
+            cores = new GAMBareSchedulerCore[numberOfCores];
+            for (uint32 i = 0u; i < numberOfCores; i++) {
+                cores[i].acknowledged = -1;
+                cores[i].buffer = 0u;
+                cores[i].running = false;
+                cores[i].numberOfCycles = 0u;
+                cores[i].lastCycleStart = 0u;
+                cores[i].lastExecutionTime = 0u;
+                cores[i].maxExecutionTime = 0u;
+            }
+        }
     }
     return ok;
 }
@@ -89,18 +119,136 @@ void GAMBareScheduler::CustomPrepareNextState() {
 }
 
 ErrorManagement::ErrorType GAMBareScheduler::StopCurrentStateExecution() {
+    ErrorManagement::ErrorType err;
     isAlive = false;
-    return ErrorManagement::NoError;
+    if (numberOfCores > 0u) {
+        err = PublishState(false);
+    }
+    return err;
+}
+
+ErrorManagement::ErrorType GAMBareScheduler::PublishState(const bool running) {
+    ErrorManagement::ErrorType err;
+    int32 current = Atomic::LoadAcquire(&stateWord);
+    int32 generation = ((current >> 2) + 1) & 0x1FFFFFFF;
+    int32 buffer = (current & 1);
+    if (running) {
+        buffer = static_cast<int32>(realTimeApplication->GetIndex() & 1u);
+    }
+    int32 word = (generation << 2) | buffer;
+    if (running) {
+        word |= 2;
+    }
+    Atomic::StoreRelease(&stateWord, word);
+    //Cores which never called Cycle are not waited for: they will adopt the word in their first Cycle.
+    uint32 elapsed = 0u;
+    bool pending = true;
+    while (pending) {
+        pending = false;
+        for (uint32 i = 0u; (i < numberOfCores) && (!pending); i++) {
+            int32 acknowledged = Atomic::LoadAcquire(&cores[i].acknowledged);
+            pending = ((acknowledged != -1) && (acknowledged != word));
+        }
+        if (pending) {
+            if (elapsed >= stateChangeTimeout) {
+                REPORT_ERROR(ErrorManagement::Timeout, "Not all the cores adopted the state change within %d ms", stateChangeTimeout);
+                err = ErrorManagement::Timeout;
+                pending = false;
+            }
+            else {
+                Sleep::MSec(1u);
+                elapsed++;
+            }
+        }
+    }
+    return err;
+}
+
+bool GAMBareScheduler::Cycle(const uint32 coreId) {
+    bool ok = (coreId < numberOfCores);
+    if (ok) {
+        GAMBareSchedulerCore &core = cores[coreId];
+        int32 word = Atomic::LoadAcquire(&stateWord);
+        if (word != core.acknowledged) {
+            core.buffer = static_cast<uint32>(word & 1);
+            core.running = ((word & 2) != 0);
+            if (core.running) {
+                core.numberOfCycles = 0u;
+                core.lastCycleStart = 0u;
+                core.lastExecutionTime = 0u;
+                core.maxExecutionTime = 0u;
+            }
+            //From now on the previous buffer is no longer accessed by this core
+            Atomic::StoreRelease(&core.acknowledged, word);
+        }
+        ok = core.running;
+        if (ok) {
+            /*lint -e{613} scheduledStates != NULL as otherwise the state could not have been started.*/
+            ok = (coreId < scheduledStates[core.buffer]->numberOfThreads);
+        }
+        if (ok) {
+            ScheduledThread &thread = scheduledStates[core.buffer]->threads[coreId];
+            uint64 cycleStart = HighResolutionTimer::Counter();
+            uint32 absTime = 0u;
+            if (core.lastCycleStart != 0u) {
+                absTime = static_cast<uint32>(HighResolutionTimer::TicksToMicroSeconds(cycleStart - core.lastCycleStart));  //us
+                if (thread.cycleTimeHistogram != NULL_PTR(LatencyHistogram *)) {
+                    thread.cycleTimeHistogram->Add(absTime);
+                }
+            }
+            if (thread.cycleTime != NULL_PTR(uint32 *)) {
+                *thread.cycleTime = absTime;
+            }
+            core.lastCycleStart = cycleStart;
+            ExecuteThreadCycle(core.buffer, coreId);
+            core.lastExecutionTime = static_cast<uint32>(HighResolutionTimer::TicksToMicroSeconds(HighResolutionTimer::Counter() - cycleStart));
+            if (core.lastExecutionTime > core.maxExecutionTime) {
+                core.maxExecutionTime = core.lastExecutionTime;
+            }
+            core.numberOfCycles++;
+        }
+    }
+    return ok;
+}
+
+bool GAMBareScheduler::GetCoreStatistics(const uint32 coreId, uint64 &numberOfCycles, uint32 &lastExecutionTime, uint32 &maxExecutionTime) const {
+    bool ok = (coreId < numberOfCores);
+    if (ok) {
+        numberOfCycles = cores[coreId].numberOfCycles;
+        lastExecutionTime = cores[coreId].lastExecutionTime;
+        maxExecutionTime = cores[coreId].maxExecutionTime;
+    }
+    return ok;
 }
 
 /*lint -e{1762} function cannot be made constant as it indirectly modifies the scheduledStates.*/
-void GAMBareScheduler::Cycle(const uint32 threadId) {
+void GAMBareScheduler::ExecuteThreadCycle(const uint32 buffer, const uint32 threadId) {
     
-    uint32 rtAppIndex = realTimeApplication->GetIndex();
+    uint32 rtAppIndex = buffer;
+    uint64 cycleStartTicks = HighResolutionTimer::Counter();
     /*lint -e{613} scheduledStates != NULL as otherwise StartNextStateExecution (and thus Cycle) would never be called.*/
-    (void) ExecuteSingleCycle(
-        scheduledStates[rtAppIndex]->threads[threadId].executables, 
-        scheduledStates[rtAppIndex]->threads[threadId].numberOfExecutables);
+    MARTe2_TRACE_EVENT(Trace::EVENT_CYCLE_BEGIN, scheduledStates[rtAppIndex]->threads[threadId].traceNameId, 0u)
+    if (scheduledStates[rtAppIndex]->threads[threadId].flat != NULL_PTR(FlatCycle *)) {
+        (void) ExecuteFlatCycle(*scheduledStates[rtAppIndex]->threads[threadId].flat);
+    }
+    else if (scheduledStates[rtAppIndex]->threads[threadId].multiRate != NULL_PTR(MultiRateSchedule *)) {
+        (void) ExecuteMultiRateCycle(
+            scheduledStates[rtAppIndex]->threads[threadId].executables,
+            *scheduledStates[rtAppIndex]->threads[threadId].multiRate,
+            cycleStartTicks,
+            scheduledStates[rtAppIndex]->threads[threadId].prefetch);
+    }
+    else {
+        (void) ExecuteSingleCycle(
+            scheduledStates[rtAppIndex]->threads[threadId].executables, 
+            scheduledStates[rtAppIndex]->threads[threadId].numberOfExecutables,
+            cycleStartTicks,
+            scheduledStates[rtAppIndex]->threads[threadId].prefetch);
+    }
+    MARTe2_TRACE_EVENT(Trace::EVENT_CYCLE_END, scheduledStates[rtAppIndex]->threads[threadId].traceNameId, 0u)
+    if (scheduledStates[rtAppIndex]->threads[threadId].budgetMonitor != NULL_PTR(CycleBudgetMonitor *)) {
+        (void) CheckCycleBudget(*scheduledStates[rtAppIndex]->threads[threadId].budgetMonitor, cycleStartTicks);
+    }
 }
 CLASS_REGISTER(GAMBareScheduler, "1.0")
 }
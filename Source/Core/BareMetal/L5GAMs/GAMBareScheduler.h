@@ -45,12 +45,70 @@
 /*---------------------------------------------------------------------------*/
 
 namespace MARTe {
+
 /**
- * @brief A single-threaded GAM scheduler that can be used without an operating system support.
- * @details The GAMBareScheduler will execute in an infinite loop all the GAM declared for a given RealTimeThread.
+ * @brief State and timing of a core which drives a GAMBareScheduler in the ExternalCores mode.
+ * @details The acknowledged word is only written by the core and read by the thread which changes the state.
+ * The timing fields are only written by the core.
+ */
+struct GAMBareSchedulerCore {
+    /**
+     * The last state word (see GAMBareScheduler) adopted by the core (-1 if the core never called Cycle).
+     */
+    volatile int32 acknowledged;
+
+    /**
+     * The scheduledStates buffer executed by the core.
+     */
+    uint32 buffer;
+
+    /**
+     * True if the core executes its thread (false after StopCurrentStateExecution).
+     */
+    bool running;
+
+    /**
+     * The number of cycles executed in the current state.
+     */
+    uint64 numberOfCycles;
+
+    /**
+     * The HighResolutionTimer counter at the beginning of the last cycle (0 before the first cycle of the state).
+     */
+    uint64 lastCycleStart;
+
+    /**
+     * The execution time of the last cycle in micro-seconds.
+     */
+    uint32 lastExecutionTime;
+
+    /**
+     * The longest execution time of a cycle in the current state in micro-seconds.
+     */
+    uint32 maxExecutionTime;
+
+    /**
+     * Keeps the fields above of consecutive cores in different cache lines.
+     */
+    uint8 padding[64];
+};
+
+/**
+ * @brief A GAM scheduler that can be used without an operating system support.
+ * @details By default the GAMBareScheduler will execute in an infinite loop all the GAM declared for a given RealTimeThread.
+ *
+ * If ExternalCores is set, no thread or loop is created and StartNextStateExecution returns immediately: each core calls Cycle(coreId)
+ * from its own loop and executes the RealTimeThread with the same index (in the order of declaration in the state). The state changes
+ * are published in a single word (generation, running flag and scheduledStates buffer) which each core adopts, without locks, at the
+ * beginning of its next Cycle. StartNextStateExecution and StopCurrentStateExecution wait (up to StateChangeTimeout) until all the cores
+ * which already called Cycle have adopted the new word, so that the buffer of the previous state is no longer in use when the next state
+ * is prepared. The RealTimeThread _CycleTime signal of the TimingDataSource is written by each core.
+ *
  * +BareScheduler = {
  *    Class = GAMBareScheduler
- *    MaxCycles = 0 //Optional, if not 0 the scheduler will stop executing after MaxCycles have been executed.
+ *    MaxCycles = 0 //Optional, if not 0 the scheduler will stop executing after MaxCycles have been executed. Ignored if ExternalCores is set.
+ *    ExternalCores = 0 //Optional, if not 0 the number of cores which call Cycle(coreId), with 0 <= coreId < ExternalCores.
+ *    StateChangeTimeout = 1000 //Optional, maximum time in milli-seconds that a state change waits for the cores to adopt it.
  * }
  */
 class GAMBareScheduler: public GAMSchedulerI {
@@ -96,6 +154,24 @@ public:
      */
     virtual bool Initialise(StructuredDataI & data);
 
+    /**
+     * @brief Executes one cycle of the RealTimeThread of a core (ExternalCores mode).
+     * @details Lock-free: the state word published by StartNextStateExecution and StopCurrentStateExecution is adopted before the cycle.
+     * @param[in] coreId the core identifier (< ExternalCores), which is also the index of the RealTimeThread in the state.
+     * @return true if a cycle was executed, false if the execution is stopped or the state has no RealTimeThread for \a coreId.
+     */
+    bool Cycle(const uint32 coreId);
+
+    /**
+     * @brief Gets the timing of a core in the current state (ExternalCores mode).
+     * @param[in] coreId the core identifier.
+     * @param[out] numberOfCycles the number of cycles executed.
+     * @param[out] lastExecutionTime the execution time of the last cycle in micro-seconds.
+     * @param[out] maxExecutionTime the longest execution time of a cycle in micro-seconds.
+     * @return true if \a coreId < ExternalCores.
+     */
+    bool GetCoreStatistics(const uint32 coreId, uint64 &numberOfCycles, uint32 &lastExecutionTime, uint32 &maxExecutionTime) const;
+
 protected: 
     /**
      * @brief Resets the current cycle counter to zero (only meaningful if MaxCycles != 0) 
@@ -117,9 +193,17 @@ private:
 
    /**
      * @brief Executes a single cycle of the RealTimeApplication executables for the specified thread identifier
+     * @param buffer the scheduledStates buffer
      * @param threadId Identifier of the thread 
      */
-    void Cycle(uint32 threadId);
+    void ExecuteThreadCycle(const uint32 buffer, const uint32 threadId);
+
+    /**
+     * @brief Publishes a new state word and waits until all the attached cores adopted it.
+     * @param running true if the cores shall execute their threads.
+     * @return ErrorManagement::Timeout if a core did not adopt the word within the StateChangeTimeout.
+     */
+    ErrorManagement::ErrorType PublishState(const bool running);
 
     /**
      * Maximum number of cycles to execute. 0=>Forever
@@ -130,6 +214,26 @@ private:
      * Current cycle number, only meaningful if maxCycles > 0
      */
     uint32 nCycle;
+
+    /**
+     * Number of cores which call Cycle. 0=>single-threaded loop in StartNextStateExecution
+     */
+    uint32 numberOfCores;
+
+    /**
+     * The state of each core (numberOfCores elements)
+     */
+    GAMBareSchedulerCore *cores;
+
+    /**
+     * The state word: generation (bits 2 to 30), running flag (bit 1) and scheduledStates buffer (bit 0)
+     */
+    volatile int32 stateWord;
+
+    /**
+     * Maximum time in milli-seconds that a state change waits for the cores
+     */
+    uint32 stateChangeTimeout;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,202 @@
+/**
+ * @file GAMDataDependencies.cpp
+ * @brief Source file for class GAMDataDependencies
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class GAMDataDependencies (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "DataSourceI.h"
+#include "GAM.h"
+#include "GAMDataDependencies.h"
+#include "GAMDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+GAMDataDependencies::GAMDataDependencies() {
+    dataSources = NULL_PTR(StreamString *);
+    signals = NULL_PTR(StreamString *);
+    isSignal = NULL_PTR(bool *);
+    isOutput = NULL_PTR(bool *);
+    firstAccess = NULL_PTR(uint32 *);
+    numberOfGAMs = 0u;
+}
+
+GAMDataDependencies::~GAMDataDependencies() {
+    if (dataSources != NULL_PTR(StreamString *)) {
+        delete [] dataSources;
+    }
+    if (signals != NULL_PTR(StreamString *)) {
+        delete [] signals;
+    }
+    if (isSignal != NULL_PTR(bool *)) {
+        delete [] isSignal;
+    }
+    if (isOutput != NULL_PTR(bool *)) {
+        delete [] isOutput;
+    }
+    if (firstAccess != NULL_PTR(uint32 *)) {
+        delete [] firstAccess;
+    }
+}
+
+bool GAMDataDependencies::Initialise(Reference realTimeApp,
+                                     ReferenceContainer &gams) {
+    ReferenceT<ReferenceContainer> application = realTimeApp;
+    bool ret = (application.IsValid()) && (numberOfGAMs == 0u);
+    uint32 numberOfAccesses = 0u;
+    uint32 nOfGAMs = gams.Size();
+    for (uint32 k = 0u; (k < nOfGAMs) && (ret); k++) {
+        ReferenceT<GAM> gam = gams.Get(k);
+        ret = gam.IsValid();
+        if (ret) {
+            numberOfAccesses += gam->GetNumberOfInputSignals() + gam->GetNumberOfOutputSignals();
+        }
+    }
+    if (ret) {
+        numberOfGAMs = nOfGAMs;
+        dataSources = new StreamString[numberOfAccesses + 1u];
+        signals = new StreamString[numberOfAccesses + 1u];
+        isSignal = new bool[numberOfAccesses + 1u];
+        isOutput = new bool[numberOfAccesses + 1u];
+        firstAccess = new uint32[numberOfGAMs + 1u];
+    }
+    uint32 n = 0u;
+    for (uint32 k = 0u; (k < numberOfGAMs) && (ret); k++) {
+        ReferenceT<GAM> gam = gams.Get(k);
+        firstAccess[k] = n;
+        StreamString gamFullName;
+        ret = gam->GetQualifiedName(gamFullName);
+        for (uint32 d = 0u; (d < 2u) && (ret); d++) {
+            SignalDirection direction = (d == 0u) ? (InputSignals) : (OutputSignals);
+            uint32 numberOfSignals = (d == 0u) ? (gam->GetNumberOfInputSignals()) : (gam->GetNumberOfOutputSignals());
+            for (uint32 s = 0u; (s < numberOfSignals) && (ret); s++) {
+                StreamString dataSourceName;
+                ret = gam->GetSignalDataSourceName(direction, s, dataSourceName);
+                ReferenceT<DataSourceI> dataSource;
+                if (ret) {
+                    StreamString dataSourceFullName = "Data.";
+                    dataSourceFullName += dataSourceName;
+                    dataSource = application->Find(dataSourceFullName.Buffer());
+                    ret = dataSource.IsValid();
+                    if (!ret) {
+                        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "DataSource %s not found", dataSourceName.Buffer());
+                    }
+                }
+                if (ret) {
+                    dataSources[n] = dataSourceName;
+                    isOutput[n] = (direction == OutputSignals);
+                    //Only the brokers of a GAMDataSource are known to be independent for different signals
+                    ReferenceT<GAMDataSource> gamDataSource = dataSource;
+                    StreamString signalName;
+                    bool perSignal = gamDataSource.IsValid();
+                    if (perSignal) {
+                        perSignal = gam->GetSignalName(direction, s, signalName);
+                    }
+                    uint32 functionIdx = 0u;
+                    if (perSignal) {
+                        perSignal = dataSource->GetFunctionIndex(functionIdx, gamFullName.Buffer());
+                    }
+                    uint32 functionSignalIdx = 0u;
+                    if (perSignal) {
+                        perSignal = dataSource->GetFunctionSignalIndex(direction, functionIdx, functionSignalIdx, signalName.Buffer());
+                    }
+                    StreamString alias;
+                    if (perSignal) {
+                        perSignal = dataSource->GetFunctionSignalAlias(direction, functionIdx, functionSignalIdx, alias);
+                    }
+                    isSignal[n] = perSignal;
+                    if (perSignal) {
+                        signals[n] = dataSourceName;
+                        signals[n] += ".";
+                        if (alias.Size() > 0u) {
+                            signals[n] += alias;
+                        }
+                        else {
+                            signals[n] += signalName;
+                        }
+                    }
+                    n++;
+                }
+            }
+        }
+    }
+    if (ret) {
+        firstAccess[numberOfGAMs] = n;
+    }
+    return ret;
+}
+
+uint32 GAMDataDependencies::GetNumberOfGAMs() const {
+    return numberOfGAMs;
+}
+
+bool GAMDataDependencies::Matches(const uint32 gamA,
+                                  const uint32 gamB,
+                                  const bool signalsOnly,
+                                  const bool aWrites) const {
+    bool found = false;
+    if ((gamA < numberOfGAMs) && (gamB < numberOfGAMs)) {
+        for (uint32 x = firstAccess[gamA]; (x < firstAccess[gamA + 1u]) && (!found); x++) {
+            if ((isSignal[x] == signalsOnly) && ((!aWrites) || (isOutput[x]))) {
+                for (uint32 y = firstAccess[gamB]; (y < firstAccess[gamB + 1u]) && (!found); y++) {
+                    if (signalsOnly) {
+                        found = ((isSignal[y]) && (signals[x] == signals[y]));
+                    }
+                    else {
+                        //Any access to the same DataSourceI (even if identified by signal)
+                        found = (dataSources[x] == dataSources[y]);
+                    }
+                }
+            }
+        }
+    }
+    return found;
+}
+
+bool GAMDataDependencies::WritesSignal(const uint32 producer,
+                                       const uint32 consumer) const {
+    return Matches(producer, consumer, true, true);
+}
+
+bool GAMDataDependencies::WritesDataSource(const uint32 producer,
+                                           const uint32 consumer) const {
+    return Matches(producer, consumer, false, true);
+}
+
+bool GAMDataDependencies::SharesDataSource(const uint32 gamA,
+                                           const uint32 gamB) const {
+    return Matches(gamA, gamB, false, false);
+}
+
+}
@@ -0,0 +1,161 @@
+/**
+ * @file GAMDataDependencies.h
+ * @brief Header file for class GAMDataDependencies
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class GAMDataDependencies
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef GAMDATADEPENDENCIES_H_
+#define GAMDATADEPENDENCIES_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ReferenceContainer.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief The data read and written by a list of GAMs, used by the schedulers to know which GAMs depend on each other.
+ * @details The signals of a GAMDataSource are identified by DataSourceName.Alias, i.e. the same identity used by the
+ * RealTimeApplicationConfigurationBuilder to verify the producers and the consumers of each signal. The signals of
+ * any other DataSourceI are only identified by the DataSourceI, given that its brokers might not be independent for
+ * different signals (e.g. a synchronising broker).
+ */
+class DLL_API GAMDataDependencies {
+
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetNumberOfGAMs() == 0
+     */
+    GAMDataDependencies();
+
+    /**
+     * @brief Destructor.
+     */
+    ~GAMDataDependencies();
+
+    /**
+     * @brief Collects the data read and written by each GAM.
+     * @param[in] realTimeApp the configured RealTimeApplication that owns the GAMs.
+     * @param[in] gams the GAMs.
+     * @return true if the DataSourceI of all the signals of the GAMs can be found.
+     * @pre
+     *   GetNumberOfGAMs() == 0
+     */
+    bool Initialise(Reference realTimeApp,
+                    ReferenceContainer &gams);
+
+    /**
+     * @brief Gets the number of GAMs.
+     * @return the number of GAMs.
+     */
+    uint32 GetNumberOfGAMs() const;
+
+    /**
+     * @brief Checks if a GAM writes a GAMDataSource signal that is read or written by another GAM.
+     * @param[in] producer the index of the GAM that writes.
+     * @param[in] consumer the index of the other GAM.
+     * @return true if \a producer writes a GAMDataSource signal used by \a consumer.
+     */
+    bool WritesSignal(const uint32 producer,
+                      const uint32 consumer) const;
+
+    /**
+     * @brief Checks if a GAM writes to a DataSourceI (which is not a GAMDataSource) that is used by another GAM.
+     * @param[in] producer the index of the GAM that writes.
+     * @param[in] consumer the index of the other GAM.
+     * @return true if \a producer writes to a DataSourceI used by \a consumer.
+     */
+    bool WritesDataSource(const uint32 producer,
+                          const uint32 consumer) const;
+
+    /**
+     * @brief Checks if a GAM uses a DataSourceI (which is not a GAMDataSource) that is also used by another GAM.
+     * @param[in] gamA the index of the first GAM.
+     * @param[in] gamB the index of the second GAM.
+     * @return true if both GAMs read or write the same DataSourceI.
+     */
+    bool SharesDataSource(const uint32 gamA,
+                          const uint32 gamB) const;
+
+private:
+
+    /**
+     * @brief Checks if an access of a GAM matches an access of another GAM.
+     * @param[in] gamA the index of the first GAM.
+     * @param[in] gamB the index of the second GAM.
+     * @param[in] signalsOnly if true only the GAMDataSource signals are checked, otherwise the accesses of \a gamA to the other DataSourceI.
+     * @param[in] aWrites if true only the accesses of \a gamA which write are checked.
+     * @return true if there is a match.
+     */
+    bool Matches(const uint32 gamA,
+                 const uint32 gamB,
+                 const bool signalsOnly,
+                 const bool aWrites) const;
+
+    /**
+     * The DataSourceI name of each access.
+     */
+    StreamString *dataSources;
+
+    /**
+     * The DataSourceName.Alias of each access (only for GAMDataSource signals).
+     */
+    StreamString *signals;
+
+    /**
+     * True if the access is a GAMDataSource signal.
+     */
+    bool *isSignal;
+
+    /**
+     * True if the access writes.
+     */
+    bool *isOutput;
+
+    /**
+     * The index of the first access of each GAM (numberOfGAMs + 1 elements).
+     */
+    uint32 *firstAccess;
+
+    /**
+     * The number of GAMs.
+     */
+    uint32 numberOfGAMs;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* GAMDATADEPENDENCIES_H_ */
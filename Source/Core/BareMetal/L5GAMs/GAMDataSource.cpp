@@ -35,11 +35,16 @@
 #include "ConfigurationDatabase.h"
 #include "GAMDataSource.h"
 #include "GAM.h"
+#include "MemoryMapConvertingInputBroker.h"
+#include "MemoryMapConvertingOutputBroker.h"
+#include "MemoryMapDecimatingInputBroker.h"
+#include "MemoryMapDecimatingOutputBroker.h"
 #include "MemoryMapInputBroker.h"
 #include "MemoryMapOutputBroker.h"
 #include "ReferenceT.h"
 #include "StandardParser.h"
 #include "CLASSREGISTER.h"
+#include INCLUDE_FILE_ARCHITECTURE(BareMetal,L1Portability,ARCHITECTURE,ProcessorA.h)
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -58,13 +63,25 @@ GAMDataSource::GAMDataSource() :
     allowNoProducers = false;
     resetUnusedVariablesAtStateChange = true;
     forceResetUnusedVariablesAtStateChange = true;
+    zeroCopy = false;
+    allocatedMemory = NULL_PTR(void*);
+    memorySize = 0u;
+    cacheLineLayout = false;
+    cacheLineSize = 64u;
+    resetSignals = NULL_PTR(GAMDataSourceResetSignal *);
+    numberOfResetSignals = 0u;
+    resetStateNames = NULL_PTR(StreamString *);
+    numberOfResetStates = 0u;
+    resetStateSignals = NULL_PTR(uint32 *);
+    resetStateFirstSignal = NULL_PTR(uint32 *);
 }
 
 GAMDataSource::~GAMDataSource() {
+    FreeResetSignals();
     if (memoryHeap != NULL_PTR(HeapI*)) {
-        if (signalMemory != NULL_PTR(void*)) {
+        if (allocatedMemory != NULL_PTR(void*)) {
             /*lint -e{1551} HeapManager::Free is expected to be exception free*/
-            memoryHeap->Free(signalMemory);
+            memoryHeap->Free(allocatedMemory);
         }
         if (signalOffsets != NULL_PTR(uint32*)) {
             delete[] signalOffsets;
@@ -98,6 +115,31 @@ bool GAMDataSource::Initialise(StructuredDataI &data) {
         (void) (data.Read("ResetUnusedVariablesAtStateChange", resetUnusedVariablesAtStateChangeUInt32));
         resetUnusedVariablesAtStateChange = (resetUnusedVariablesAtStateChangeUInt32 == 1u);
     }
+    if (ret) {
+        uint32 zeroCopyUInt32 = 0u;
+        (void) (data.Read("ZeroCopy", zeroCopyUInt32));
+        zeroCopy = (zeroCopyUInt32 == 1u);
+    }
+    if (ret) {
+        uint32 cacheLineLayoutUInt32 = 0u;
+        (void) (data.Read("CacheLineLayout", cacheLineLayoutUInt32));
+        cacheLineLayout = (cacheLineLayoutUInt32 == 1u);
+    }
+    if (ret) {
+        if (!data.Read("CacheLineSize", cacheLineSize)) {
+            cacheLineSize = Processor::DataCacheLineSizeRegister();
+            if (cacheLineSize == 0u) {
+                cacheLineSize = 64u;
+            }
+        }
+        ret = (cacheLineSize > 0u);
+        if (ret) {
+            ret = ((cacheLineSize & (cacheLineSize - 1u)) == 0u);
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The CacheLineSize (%d) shall be a power of 2", cacheLineSize);
+        }
+    }
     forceResetUnusedVariablesAtStateChange = true;
     return ret;
 }
@@ -140,30 +182,127 @@ bool GAMDataSource::AllocateMemory() {
         REPORT_ERROR(ErrorManagement::FatalError, "No signals defined for DataSource with name %s", GetName());
     }
     if (ret) {
-        signalOffsets = new uint32[nOfSignals];
+        //The layout is already computed if SetConfiguredDatabase was called
+        if (signalOffsets == NULL_PTR(uint32*)) {
+            ret = ComputeSignalLayout();
+        }
     }
+    if (ret) {
+        if (memoryHeap != NULL_PTR(HeapI*)) {
+            uint32 alignment = 0u;
+            if (cacheLineLayout) {
+                alignment = cacheLineSize;
+            }
+            allocatedMemory = memoryHeap->Malloc(memorySize + alignment);
+            signalMemory = allocatedMemory;
+            if ((alignment > 0u) && (allocatedMemory != NULL_PTR(void*))) {
+                /*lint -e{923} -e{9091} the address has to be converted to an integer in order to be aligned*/
+                uintp base = reinterpret_cast<uintp>(allocatedMemory);
+                base = (base + (alignment - 1u)) & ~(static_cast<uintp>(alignment) - 1u);
+                /*lint -e{923} -e{9091} the aligned address is inside the allocated memory*/
+                signalMemory = reinterpret_cast<void*>(base);
+            }
+        }
+        ret = MemoryOperationsHelper::Set(signalMemory, '\0', memorySize);
+    }
+    if (ret) {
+        ret = PrepareResetSignals();
+    }
+    return ret;
+}
 
-    uint32 memorySize = 0u;
-    for (uint32 s = 0u; (s < nOfSignals) && (ret); s++) {
-        uint32 thisSignalMemorySize;
-        ret = GetSignalByteSize(s, thisSignalMemorySize);
-        if (ret) {
-            if (signalOffsets != NULL_PTR(uint32*)) {
-                signalOffsets[s] = memorySize;
+bool GAMDataSource::ComputeSignalLayout() {
+    uint32 nOfSignals = GetNumberOfSignals();
+    bool ret = (nOfSignals > 0u);
+    uint32 *signalGroups = NULL_PTR(uint32*);
+    StreamString *groupNames = NULL_PTR(StreamString*);
+    uint32 numberOfGroups = 0u;
+    if (ret) {
+        if (signalOffsets == NULL_PTR(uint32*)) {
+            signalOffsets = new uint32[nOfSignals];
+        }
+        signalGroups = new uint32[nOfSignals];
+        groupNames = new StreamString[nOfSignals];
+    }
+    //Assign each signal to the group of its first producer
+    for (uint32 s = 0u; (s < nOfSignals) && (ret) && (cacheLineLayout); s++) {
+        uint32 nStates = 0u;
+        if (!GetSignalNumberOfStates(s, nStates)) {
+            nStates = 0u;
+        }
+        StreamString producerName;
+        bool found = false;
+        for (uint32 n = 0u; (n < nStates) && (ret) && (!found); n++) {
+            StreamString stateName;
+            uint32 nProducers = 0u;
+            ret = GetSignalStateName(s, n, stateName);
+            if (ret) {
+                if (!GetSignalNumberOfProducers(s, stateName.Buffer(), nProducers)) {
+                    nProducers = 0u;
+                }
+            }
+            if ((ret) && (nProducers > 0u)) {
+                ret = GetSignalProducerName(s, stateName.Buffer(), 0u, producerName);
+                found = ret;
             }
         }
-        if (ret) {
-            ret = (thisSignalMemorySize > 0u);
+        uint32 g;
+        found = false;
+        for (g = 0u; (g < numberOfGroups) && (!found); g++) {
+            found = (groupNames[g] == producerName);
         }
-        if (ret) {
-            memorySize += thisSignalMemorySize;
+        if (found) {
+            signalGroups[s] = (g - 1u);
+        }
+        else {
+            groupNames[numberOfGroups] = producerName;
+            signalGroups[s] = numberOfGroups;
+            numberOfGroups++;
         }
     }
-    if (ret) {
-        if (memoryHeap != NULL_PTR(HeapI*)) {
-            signalMemory = memoryHeap->Malloc(memorySize);
+    if (!cacheLineLayout) {
+        for (uint32 s = 0u; (s < nOfSignals) && (ret); s++) {
+            signalGroups[s] = 0u;
+        }
+        numberOfGroups = 1u;
+    }
+    memorySize = 0u;
+    for (uint32 g = 0u; (g < numberOfGroups) && (ret); g++) {
+        if (cacheLineLayout) {
+            memorySize = (memorySize + (cacheLineSize - 1u)) & ~(cacheLineSize - 1u);
+        }
+        for (uint32 s = 0u; (s < nOfSignals) && (ret); s++) {
+            if (signalGroups[s] == g) {
+                uint32 thisSignalMemorySize;
+                ret = GetSignalByteSize(s, thisSignalMemorySize);
+                if (ret) {
+                    signalOffsets[s] = memorySize;
+                    ret = (thisSignalMemorySize > 0u);
+                }
+                if (ret) {
+                    memorySize += thisSignalMemorySize;
+                }
+            }
+        }
+    }
+    if ((ret) && (cacheLineLayout)) {
+        memorySize = (memorySize + (cacheLineSize - 1u)) & ~(cacheLineSize - 1u);
+    }
+    //Publish the layout in the configured database
+    for (uint32 s = 0u; (s < nOfSignals) && (ret); s++) {
+        ret = MoveToSignalIndex(s);
+        if (ret) {
+            ret = configuredDatabase.Write("MemoryOffset", signalOffsets[s]);
+        }
+        if ((ret) && (cacheLineLayout)) {
+            ret = configuredDatabase.Write("LayoutGroup", groupNames[signalGroups[s]].Buffer());
         }
-        ret = MemoryOperationsHelper::Set(signalMemory, '\0', memorySize);
+    }
+    if (signalGroups != NULL_PTR(uint32*)) {
+        delete[] signalGroups;
+    }
+    if (groupNames != NULL_PTR(StreamString*)) {
+        delete[] groupNames;
     }
     return ret;
 }
@@ -181,12 +320,45 @@ const char8* GAMDataSource::GetBrokerName(StructuredDataI &data,
         samples = 1u;
     }
 
-    if ((freq < 0.) && (samples == 1u)) {
+    //The signals stored with a different type are converted by the broker
+    bool convert = false;
+    StreamString dataSourceType;
+    if (data.Read("DataSourceType", dataSourceType)) {
+        StreamString signalType;
+        if (data.Read("Type", signalType)) {
+            convert = (signalType != dataSourceType.Buffer());
+        }
+    }
+
+    //The signals with Decimation are reduced by the broker
+    uint32 decimation;
+    if (!data.Read("Decimation", decimation)) {
+        decimation = 1u;
+    }
+
+    if ((freq < 0.) && (samples == 1u) && (decimation != 1u)) {
+        if (convert) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "A signal with Decimation cannot have a DataSourceType different from its Type");
+        }
+        else if (direction == InputSignals) {
+            brokerName = "MemoryMapDecimatingInputBroker";
+        }
+        else {
+            brokerName = "MemoryMapDecimatingOutputBroker";
+        }
+    }
+    else if ((freq < 0.) && (samples == 1u)) {
         if (direction == InputSignals) {
             brokerName = "MemoryMapInputBroker";
+            if (convert) {
+                brokerName = "MemoryMapConvertingInputBroker";
+            }
         }
         else {
             brokerName = "MemoryMapOutputBroker";
+            if (convert) {
+                brokerName = "MemoryMapConvertingOutputBroker";
+            }
         }
     }
     return brokerName;
@@ -196,8 +368,6 @@ const char8* GAMDataSource::GetBrokerName(StructuredDataI &data,
 /*lint -e{715} this implementation of the StatefulI interface does not need to know about the nextStateName*/
 bool GAMDataSource::PrepareNextState(const char8 *const currentStateName,
                                      const char8 *const nextStateName) {
-//Set the default value for all the input signals
-    uint32 numberOfFunctions = GetNumberOfFunctions();
     bool ret = true;
 
     //At least the first time, reset all the variables to the default value.
@@ -207,7 +377,59 @@ bool GAMDataSource::PrepareNextState(const char8 *const currentStateName,
         forceResetUnusedVariablesAtStateChange = false;
     }
 
-    for (uint32 n = 0u; (n < numberOfFunctions) && (ret) && (resetUnusedVariables); n++) {
+    if (resetUnusedVariables) {
+        //The signals are prepared by AllocateMemory (unless the memory was not allocated through it)
+        if (resetStateFirstSignal == NULL_PTR(uint32 *)) {
+            ret = PrepareResetSignals();
+        }
+    }
+    if ((resetUnusedVariables) && (ret)) {
+        //Signals not produced in the current state (or all of them if the current state does not produce any)
+        uint32 first = 0u;
+        uint32 last = numberOfResetSignals;
+        const uint32 *signalsToReset = NULL_PTR(const uint32 *);
+        bool found = false;
+        for (uint32 s = 0u; (s < numberOfResetStates) && (!found); s++) {
+            found = (resetStateNames[s] == currentStateName);
+            if (found) {
+                signalsToReset = resetStateSignals;
+                first = resetStateFirstSignal[s];
+                last = resetStateFirstSignal[s + 1u];
+            }
+        }
+        for (uint32 i = first; (i < last) && (ret); i++) {
+            uint32 r = i;
+            if (signalsToReset != NULL_PTR(const uint32 *)) {
+                r = signalsToReset[i];
+            }
+            //lint -e{613} resetSignals cannot be NULL if numberOfResetSignals > 0
+            if (resetSignals[r].value == NULL_PTR(uint8 *)) {
+                ret = MemoryOperationsHelper::Set(resetSignals[r].memory, '\0', resetSignals[r].byteSize);
+            }
+            else {
+                ret = MemoryOperationsHelper::Copy(resetSignals[r].memory, resetSignals[r].value, resetSignals[r].byteSize);
+            }
+        }
+    }
+    return ret;
+}
+
+bool GAMDataSource::PrepareResetSignals() {
+    FreeResetSignals();
+    uint32 numberOfFunctions = GetNumberOfFunctions();
+    uint32 numberOfSignals = GetNumberOfSignals();
+    bool ret = true;
+    //The input signals of all the functions, without repetitions.
+    uint32 *signalIndexes = NULL_PTR(uint32 *);
+    bool *isInput = NULL_PTR(bool *);
+    if (numberOfSignals > 0u) {
+        signalIndexes = new uint32[numberOfSignals];
+        isInput = new bool[numberOfSignals];
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            isInput[i] = false;
+        }
+    }
+    for (uint32 n = 0u; (n < numberOfFunctions) && (ret); n++) {
         uint32 numberOfFunctionInputSignals;
         ret = GetFunctionNumberOfSignals(InputSignals, n, numberOfFunctionInputSignals);
         for (uint32 i = 0u; (i < numberOfFunctionInputSignals) && (ret); i++) {
@@ -217,113 +439,248 @@ bool GAMDataSource::PrepareNextState(const char8 *const currentStateName,
             if (ret) {
                 ret = GetSignalIndex(signalIdx, functionSignalAlias.Buffer());
             }
-            bool update = false;
-            //Variable used in the current state?
             if (ret) {
-                uint32 numberOfProducersCurrentState;
-                if (!GetSignalNumberOfProducers(signalIdx, currentStateName, numberOfProducersCurrentState)) {
-                    numberOfProducersCurrentState = 0u;
-                }
-                //If the variable was not used update!
-                update = (numberOfProducersCurrentState == 0u);
+                ret = (signalIdx < numberOfSignals);
             }
-            TypeDescriptor typeDesc;
-            if (update) {
-                if (ret) {
-                    typeDesc = GetSignalType(signalIdx);
-                    ret = (typeDesc != InvalidType);
+            if (ret) {
+                //lint -e{613} isInput and signalIndexes cannot be NULL if signalIdx < numberOfSignals
+                if (!isInput[signalIdx]) {
+                    isInput[signalIdx] = true;
+                    signalIndexes[numberOfResetSignals] = signalIdx;
+                    numberOfResetSignals++;
                 }
             }
-            if (update) {
-                //if the default value is declared use it to initialise
-                //otherwise null the memory
-                AnyType defaultValueType = GetSignalDefaultValueType(signalIdx);
-                void *thisSignalMemory = NULL_PTR(void*);
+        }
+    }
+    if ((ret) && (numberOfResetSignals > 0u)) {
+        resetSignals = new GAMDataSourceResetSignal[numberOfResetSignals];
+        for (uint32 r = 0u; r < numberOfResetSignals; r++) {
+            resetSignals[r].memory = NULL_PTR(void *);
+            resetSignals[r].byteSize = 0u;
+            resetSignals[r].value = NULL_PTR(uint8 *);
+        }
+    }
+    //The memory of each signal and the Default value converted to the signal type
+    for (uint32 r = 0u; (r < numberOfResetSignals) && (ret); r++) {
+        //lint -e{613} signalIndexes and resetSignals cannot be NULL if numberOfResetSignals > 0
+        uint32 signalIdx = signalIndexes[r];
+        TypeDescriptor typeDesc = GetSignalType(signalIdx);
+        ret = (typeDesc != InvalidType);
+        if (ret) {
+            ret = GetSignalMemoryBuffer(signalIdx, 0u, resetSignals[r].memory);
+        }
+        if (ret) {
+            ret = GetSignalByteSize(signalIdx, resetSignals[r].byteSize);
+        }
+        if (ret) {
+            AnyType defaultValueType = GetSignalDefaultValueType(signalIdx);
+            if (defaultValueType.GetTypeDescriptor() != VoidType) {
+                resetSignals[r].value = new uint8[resetSignals[r].byteSize];
+                ret = MemoryOperationsHelper::Set(resetSignals[r].value, '\0', resetSignals[r].byteSize);
                 if (ret) {
-                    ret = GetSignalMemoryBuffer(signalIdx, 0u, thisSignalMemory);
+                    ret = ConvertDefaultValue(signalIdx, typeDesc, resetSignals[r].value);
                 }
-                if (defaultValueType.GetTypeDescriptor() == VoidType) {
-                    uint32 size = 0u;
-                    if (ret) {
-                        ret = GetSignalByteSize(signalIdx, size);
-                    }
-                    if (ret) {
-                        ret = MemoryOperationsHelper::Set(thisSignalMemory, '\0', size);
-                    }
-                }
-                else {
-                    AnyType thisSignal(typeDesc, 0u, thisSignalMemory);
-                    uint32 thisSignalNumberOfElements = 0u;
-                    uint8 thisSignalNumberOfDimensions = 0u;
-                    StreamString signalName;
-                    if (ret) {
-                        ret = GetSignalName(signalIdx, signalName);
-                    }
-                    if (ret) {
-                        ret = signalName.Seek(0LLU);
-                    }
-                    if (ret) {
-                        ret = GetSignalNumberOfElements(signalIdx, thisSignalNumberOfElements);
-                    }
-                    if (ret) {
-                        ret = GetSignalNumberOfDimensions(signalIdx, thisSignalNumberOfDimensions);
-                    }
-                    if (ret) {
-                        ret = (thisSignalNumberOfDimensions == defaultValueType.GetNumberOfDimensions());
-                        if (!ret) {
-                            if (thisSignalNumberOfDimensions == 1u) {
-                                if (defaultValueType.GetNumberOfDimensions() == 0u) {
-                                    ret = (defaultValueType.GetNumberOfElements(0u) == 1u);
-                                }
-                            }
-                        }
-                    }
-                    if (ret) {
-                        thisSignal.SetNumberOfDimensions(defaultValueType.GetNumberOfDimensions());
-                    }
-                    else {
-                        REPORT_ERROR(ErrorManagement::FatalError, "Default value has different number of dimensions w.r.t. to the signal %s", signalName);
-                    }
-
-                    uint32 defaultValueNumberOfElements = 1u;
-                    uint32 d;
-                    for (d = 0u; (d < thisSignalNumberOfDimensions) && (ret); d++) {
-                        uint32 elementsInDimensionN = defaultValueType.GetNumberOfElements(d);
-                        defaultValueNumberOfElements *= elementsInDimensionN;
-                    }
-                    if (ret) {
-                        ret = (thisSignalNumberOfElements == defaultValueNumberOfElements);
-                    }
-                    else {
-                        REPORT_ERROR(ErrorManagement::FatalError, "Default value has different number of elements w.r.t. to the signal %s", signalName);
-                    }
-                    for (d = 0u; (d < thisSignalNumberOfDimensions) && (ret); d++) {
-                        uint32 elementsInDimensionN = defaultValueType.GetNumberOfElements(d);
-                        thisSignal.SetNumberOfElements(d, elementsInDimensionN);
-                    }
-                    if (!GetSignalDefaultValue(signalIdx, thisSignal)) {
-                        ret = false;
-                        REPORT_ERROR(ErrorManagement::FatalError, "Could not read existent Default value for signal %s", signalName);
-                    }
+            }
+        }
+    }
+    //The states where at least one of the signals is produced
+    StreamString *stateNames = NULL_PTR(StreamString *);
+    uint32 maxNumberOfStates = 0u;
+    for (uint32 r = 0u; (r < numberOfResetSignals) && (ret); r++) {
+        uint32 numberOfStates = 0u;
+        //lint -e{613} signalIndexes cannot be NULL if numberOfResetSignals > 0
+        if (GetSignalNumberOfStates(signalIndexes[r], numberOfStates)) {
+            maxNumberOfStates += numberOfStates;
+        }
+    }
+    if (maxNumberOfStates > 0u) {
+        stateNames = new StreamString[maxNumberOfStates];
+    }
+    for (uint32 r = 0u; (r < numberOfResetSignals) && (ret); r++) {
+        uint32 numberOfStates = 0u;
+        //lint -e{613} signalIndexes cannot be NULL if numberOfResetSignals > 0
+        if (!GetSignalNumberOfStates(signalIndexes[r], numberOfStates)) {
+            numberOfStates = 0u;
+        }
+        for (uint32 s = 0u; (s < numberOfStates) && (ret); s++) {
+            StreamString stateName;
+            ret = GetSignalStateName(signalIndexes[r], s, stateName);
+            bool exists = false;
+            for (uint32 k = 0u; (k < numberOfResetStates) && (ret) && (!exists); k++) {
+                //lint -e{613} stateNames cannot be NULL if numberOfResetStates > 0
+                exists = (stateNames[k] == stateName);
+            }
+            if ((ret) && (!exists) && (numberOfResetStates < maxNumberOfStates)) {
+                //lint -e{613} stateNames cannot be NULL if maxNumberOfStates > 0
+                stateNames[numberOfResetStates] = stateName;
+                numberOfResetStates++;
+            }
+        }
+    }
+    //For each state the signals which are not produced in it
+    if (ret) {
+        resetStateNames = stateNames;
+        stateNames = NULL_PTR(StreamString *);
+        resetStateFirstSignal = new uint32[numberOfResetStates + 1u];
+        resetStateFirstSignal[0u] = 0u;
+        if ((numberOfResetStates * numberOfResetSignals) > 0u) {
+            resetStateSignals = new uint32[numberOfResetStates * numberOfResetSignals];
+        }
+    }
+    uint32 numberOfStateSignals = 0u;
+    for (uint32 s = 0u; (s < numberOfResetStates) && (ret); s++) {
+        for (uint32 r = 0u; r < numberOfResetSignals; r++) {
+            uint32 numberOfProducers;
+            //lint -e{613} resetStateNames and signalIndexes cannot be NULL if numberOfResetStates > 0
+            if (!GetSignalNumberOfProducers(signalIndexes[r], resetStateNames[s].Buffer(), numberOfProducers)) {
+                numberOfProducers = 0u;
+            }
+            //If the variable is not used in this state update it!
+            if (numberOfProducers == 0u) {
+                //lint -e{613} resetStateSignals cannot be NULL if numberOfResetStates * numberOfResetSignals > 0
+                resetStateSignals[numberOfStateSignals] = r;
+                numberOfStateSignals++;
+            }
+        }
+        //lint -e{613} resetStateFirstSignal was allocated above
+        resetStateFirstSignal[s + 1u] = numberOfStateSignals;
+    }
+    if (stateNames != NULL_PTR(StreamString *)) {
+        delete[] stateNames;
+    }
+    if (signalIndexes != NULL_PTR(uint32 *)) {
+        delete[] signalIndexes;
+    }
+    if (isInput != NULL_PTR(bool *)) {
+        delete[] isInput;
+    }
+    if (!ret) {
+        FreeResetSignals();
+    }
+    return ret;
+}
 
+bool GAMDataSource::ConvertDefaultValue(const uint32 signalIdx,
+                                        const TypeDescriptor &typeDesc,
+                                        void * const destination) {
+    AnyType defaultValueType = GetSignalDefaultValueType(signalIdx);
+    AnyType thisSignal(typeDesc, 0u, destination);
+    uint32 thisSignalNumberOfElements = 0u;
+    uint8 thisSignalNumberOfDimensions = 0u;
+    StreamString signalName;
+    bool ret = GetSignalName(signalIdx, signalName);
+    if (ret) {
+        ret = signalName.Seek(0LLU);
+    }
+    if (ret) {
+        ret = GetSignalNumberOfElements(signalIdx, thisSignalNumberOfElements);
+    }
+    if (ret) {
+        ret = GetSignalNumberOfDimensions(signalIdx, thisSignalNumberOfDimensions);
+    }
+    if (ret) {
+        ret = (thisSignalNumberOfDimensions == defaultValueType.GetNumberOfDimensions());
+        if (!ret) {
+            if (thisSignalNumberOfDimensions == 1u) {
+                if (defaultValueType.GetNumberOfDimensions() == 0u) {
+                    ret = (defaultValueType.GetNumberOfElements(0u) == 1u);
                 }
             }
         }
     }
+    if (ret) {
+        thisSignal.SetNumberOfDimensions(defaultValueType.GetNumberOfDimensions());
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "Default value has different number of dimensions w.r.t. to the signal %s", signalName);
+    }
+
+    uint32 defaultValueNumberOfElements = 1u;
+    uint32 d;
+    for (d = 0u; (d < thisSignalNumberOfDimensions) && (ret); d++) {
+        uint32 elementsInDimensionN = defaultValueType.GetNumberOfElements(d);
+        defaultValueNumberOfElements *= elementsInDimensionN;
+    }
+    if (ret) {
+        ret = (thisSignalNumberOfElements == defaultValueNumberOfElements);
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "Default value has different number of elements w.r.t. to the signal %s", signalName);
+    }
+    for (d = 0u; (d < thisSignalNumberOfDimensions) && (ret); d++) {
+        uint32 elementsInDimensionN = defaultValueType.GetNumberOfElements(d);
+        thisSignal.SetNumberOfElements(d, elementsInDimensionN);
+    }
+    if (ret) {
+        if (!GetSignalDefaultValue(signalIdx, thisSignal)) {
+            ret = false;
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not read existent Default value for signal %s", signalName);
+        }
+    }
     return ret;
 }
 
+void GAMDataSource::FreeResetSignals() {
+    if (resetSignals != NULL_PTR(GAMDataSourceResetSignal *)) {
+        for (uint32 r = 0u; r < numberOfResetSignals; r++) {
+            if (resetSignals[r].value != NULL_PTR(uint8 *)) {
+                delete[] resetSignals[r].value;
+            }
+        }
+        delete[] resetSignals;
+    }
+    if (resetStateNames != NULL_PTR(StreamString *)) {
+        delete[] resetStateNames;
+    }
+    if (resetStateSignals != NULL_PTR(uint32 *)) {
+        delete[] resetStateSignals;
+    }
+    if (resetStateFirstSignal != NULL_PTR(uint32 *)) {
+        delete[] resetStateFirstSignal;
+    }
+    resetSignals = NULL_PTR(GAMDataSourceResetSignal *);
+    numberOfResetSignals = 0u;
+    resetStateNames = NULL_PTR(StreamString *);
+    numberOfResetStates = 0u;
+    resetStateSignals = NULL_PTR(uint32 *);
+    resetStateFirstSignal = NULL_PTR(uint32 *);
+}
+
 bool GAMDataSource::GetInputBrokers(ReferenceContainer &inputBrokers,
                                     const char8 *const functionName,
                                     void *const gamMemPtr) {
 //generally a loop for each supported broker
-    ReferenceT<MemoryMapInputBroker> broker("MemoryMapInputBroker");
-    bool ret = broker.IsValid();
-    if (ret) {
-        ret = broker->Init(InputSignals, *this, functionName, gamMemPtr, true);
+    bool ret = true;
+    //All the signals of this function might be zero-copy
+    if (HasBrokerSignals(InputSignals, functionName, "MemoryMapInputBroker")) {
+        ReferenceT<MemoryMapInputBroker> broker("MemoryMapInputBroker");
+        ret = broker.IsValid();
+        if (ret) {
+            ret = broker->Init(InputSignals, *this, functionName, gamMemPtr, true);
+        }
+        if (ret) {
+            if (broker->GetNumberOfCopies() > 0u) {
+                ret = inputBrokers.Insert(broker);
+            }
+        }
     }
-    if (ret) {
-        if (broker->GetNumberOfCopies() > 0u) {
+    if ((ret) && (HasBrokerSignals(InputSignals, functionName, "MemoryMapConvertingInputBroker"))) {
+        ReferenceT<MemoryMapConvertingInputBroker> broker("MemoryMapConvertingInputBroker");
+        ret = broker.IsValid();
+        if (ret) {
+            ret = broker->Init(InputSignals, *this, functionName, gamMemPtr);
+        }
+        if (ret) {
+            ret = inputBrokers.Insert(broker);
+        }
+    }
+    if ((ret) && (HasBrokerSignals(InputSignals, functionName, "MemoryMapDecimatingInputBroker"))) {
+        ReferenceT<MemoryMapDecimatingInputBroker> broker("MemoryMapDecimatingInputBroker");
+        ret = broker.IsValid();
+        if (ret) {
+            ret = broker->Init(InputSignals, *this, functionName, gamMemPtr);
+        }
+        if (ret) {
             ret = inputBrokers.Insert(broker);
         }
     }
@@ -333,13 +690,36 @@ bool GAMDataSource::GetInputBrokers(ReferenceContainer &inputBrokers,
 bool GAMDataSource::GetOutputBrokers(ReferenceContainer &outputBrokers,
                                      const char8 *const functionName,
                                      void *const gamMemPtr) {
-    ReferenceT<MemoryMapOutputBroker> broker("MemoryMapOutputBroker");
-    bool ret = broker.IsValid();
-    if (ret) {
-        ret = broker->Init(OutputSignals, *this, functionName, gamMemPtr, true);
+    bool ret = true;
+    if (HasBrokerSignals(OutputSignals, functionName, "MemoryMapOutputBroker")) {
+        ReferenceT<MemoryMapOutputBroker> broker("MemoryMapOutputBroker");
+        ret = broker.IsValid();
+        if (ret) {
+            ret = broker->Init(OutputSignals, *this, functionName, gamMemPtr, true);
+        }
+        if (ret) {
+            if (broker->GetNumberOfCopies() > 0u) {
+                ret = outputBrokers.Insert(broker);
+            }
+        }
     }
-    if (ret) {
-        if (broker->GetNumberOfCopies() > 0u) {
+    if ((ret) && (HasBrokerSignals(OutputSignals, functionName, "MemoryMapConvertingOutputBroker"))) {
+        ReferenceT<MemoryMapConvertingOutputBroker> broker("MemoryMapConvertingOutputBroker");
+        ret = broker.IsValid();
+        if (ret) {
+            ret = broker->Init(OutputSignals, *this, functionName, gamMemPtr);
+        }
+        if (ret) {
+            ret = outputBrokers.Insert(broker);
+        }
+    }
+    if ((ret) && (HasBrokerSignals(OutputSignals, functionName, "MemoryMapDecimatingOutputBroker"))) {
+        ReferenceT<MemoryMapDecimatingOutputBroker> broker("MemoryMapDecimatingOutputBroker");
+        ret = broker.IsValid();
+        if (ret) {
+            ret = broker->Init(OutputSignals, *this, functionName, gamMemPtr);
+        }
+        if (ret) {
             ret = outputBrokers.Insert(broker);
         }
     }
@@ -387,6 +767,12 @@ bool GAMDataSource::SetConfiguredDatabase(StructuredDataI &data) {
             }
         }
     }
+    if ((ret) && (nSignals > 0u)) {
+        ret = ComputeSignalLayout();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In GAMDataSource %s, could not compute the signal layout", GetName());
+        }
+    }
     return ret;
 }
 
@@ -394,6 +780,27 @@ bool GAMDataSource::Synchronise() {
     return false;
 }
 
+bool GAMDataSource::IsZeroCopy() const {
+    return zeroCopy;
+}
+
+bool GAMDataSource::HasBrokerSignals(const SignalDirection direction,
+                                     const char8 *const functionName,
+                                     const char8 *const brokerClassName) {
+    uint32 functionIdx = 0u;
+    bool ret = GetFunctionIndex(functionIdx, functionName);
+    uint32 numberOfSignals = 0u;
+    if (ret) {
+        ret = GetFunctionNumberOfSignals(direction, functionIdx, numberOfSignals);
+    }
+    bool found = false;
+    for (uint32 i = 0u; (i < numberOfSignals) && (ret) && (!found); i++) {
+        found = IsSupportedBroker(direction, functionIdx, i, brokerClassName);
+    }
+    //Let the broker Init report the error if the function cannot be found
+    return (found) || (!ret);
+}
+
 CLASS_REGISTER(GAMDataSource, "1.0")
 
 }
@@ -43,6 +43,26 @@
 
 namespace MARTe {
 
+/**
+ * @brief A signal that is reset by GAMDataSource::PrepareNextState.
+ */
+struct GAMDataSourceResetSignal {
+    /**
+     * The memory of the signal.
+     */
+    void *memory;
+
+    /**
+     * The number of bytes of the signal.
+     */
+    uint32 byteSize;
+
+    /**
+     * The Default value already converted to the signal type (byteSize bytes) or NULL to reset the signal to zero.
+     */
+    uint8 *value;
+};
+
 /**
  * @brief DataSource implementation for the exchange of signals between GAM components.
  *
@@ -56,7 +76,27 @@ namespace MARTe {
  *    HeapName = "The name of the Heap to use" If not specified GlobalObjectsDatabase::GetStandardHeap() will be used.
  *    AllowNoProducers = 0 //Optional. If 1 the GAMDataSource will allow for signals not to be connected (only issuing a warning).
  *    ResetUnusedVariablesAtStateChange = 1 //Optional. If 1 the GAMDataSource will reset the value of any input to its default value if the producer was not executed in the current state. 
+ *    ZeroCopy = 0 //Optional. If 1 the signals that qualify (see below) are exchanged by aliasing the GAM memory instead of being copied through this GAMDataSource.
+ *    CacheLineLayout = 0 //Optional. If 1 the signals are grouped by producer and each group is placed in its own set of cache lines (see below).
+ *    CacheLineSize = 64 //Optional. Only meaningful if CacheLineLayout = 1. Shall be a power of 2. If not specified it is read from the processor (64 if not available).
  * }
+ *
+ * @details When ZeroCopy = 1 the RealTimeApplicationConfigurationBuilder (see ResolveZeroCopySignals) looks for signals
+ *  which, in every state where they are consumed, are written by the same single producer, are read and written as a whole
+ *  (no Ranges, Samples = 1) and whose producer is executed, in the same RealTimeThread, before all the consumers.
+ *  The input memory of each consumer of such a signal is then made to point at the output memory of the producer
+ *  (see GAM::AliasInputSignalMemory) and no broker copies are performed for it. The consumer GAMs must access these signals
+ *  with GAM::GetInputSignalMemory() (and not through the contiguous input memory block) and must not modify them.
+ *
+ * @details When CacheLineLayout = 1 the signals are grouped by the GAM that produces them (the first producer of the first
+ *  state where the signal is produced) and every group starts at a cache line boundary, so that GAMs executing in different
+ *  RealTimeThreads never write into the same cache line. The signals of a group are packed in the order they were declared.
+ *  The resulting layout is written in the configured database: every signal node gets a MemoryOffset (the byte offset
+ *  of the signal in the DataSource memory) and a LayoutGroup (the name of the producer that defined the group).
+ *
+ * @details A GAM signal with Decimation = N (see MemoryMapDecimatingBroker) is reduced over N cycles by its broker: e.g. a GAM in a fast
+ *  RealTimeThread writes a signal with Decimation = 10 and Reduction = Mean, and the GAMs of a ten times slower RealTimeThread read
+ *  the mean of the last ten cycles, without any averaging GAM in the fast thread.
  */
 class DLL_API GAMDataSource: public DataSourceI {
 public:
@@ -101,6 +141,7 @@ public:
 
     /**
      * @brief Allocates the memory required to hold all the signal data allocated to this GAMDataSource.
+     * @details Also prepares the signals to be reset by PrepareNextState (see PrepareNextState).
      * @return true if the memory can be successfully allocated. This function will return false if it called more than once
      *  (to avoid memory leaks).
      */
@@ -110,6 +151,8 @@ public:
      * @brief See DataSourceI::GetBrokerName()
      * @return MemoryMapInputBroker if direction is InputSignals, MemoryMapOutputBroker if the direction is OutputSignals
      *  or NULL if Frequency != -1 and Samples != 1.
+     *  The MemoryMapConvertingInputBroker and MemoryMapConvertingOutputBroker are returned instead for the signals whose DataSourceType differs from the Type
+     *  and the MemoryMapDecimatingInputBroker and MemoryMapDecimatingOutputBroker for the signals with a Decimation (which cannot also be converted).
      */
     virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
 
@@ -118,6 +161,9 @@ public:
      * details For every signal that was not used in the previous state and that has a default value specified on its configuration,
      *  the first of value of this signal on the next state will be the specified the Default (see RealTimeApplicationConfigurationBuilder).
      *  If the Default is not specified then the signal memory is set to zero for the next state.
+     * @details The input signals which are not produced in each state, and their Default converted to the signal type, are computed
+     *  once (when the memory is allocated), so that a state change only copies the values of the signals to be reset,
+     *  without reading the configured database.
      * @param[in] currentStateName the name of the current state being executed.
      * @param[in] nextStateName the name of the next state to be executed.
      * @return true if the state change can be performed and all the default values successfully applied.
@@ -131,6 +177,7 @@ public:
      * @param[in] functionName name of the function being queried.
      * @param[in] gamMemPtr the GAM memory where the signals will be read from.
      * @return true if a the MemoryMapInputBroker can be successfully initialised (see MemoryMapInputBroker::Init)
+     * @details The MemoryMapConvertingInputBroker and the MemoryMapDecimatingInputBroker are also added for the signals that need them.
      */
     virtual bool GetInputBrokers(
             ReferenceContainer &inputBrokers,
@@ -143,6 +190,7 @@ public:
      * @param[in] functionName name of the function being queried.
      * @param[in] gamMemPtr the GAM memory where the signals will be read from.
      * @return true if a the MemoryMapOutputBroker can be successfully initialised (see MemoryMapOutputBroker::Init)
+     * @details The MemoryMapConvertingOutputBroker and the MemoryMapDecimatingOutputBroker are also added for the signals that need them.
      */
     virtual bool GetOutputBrokers(
             ReferenceContainer &outputBrokers,
@@ -158,12 +206,19 @@ public:
     /**
      * @brief Calls DataSourceI::SetConfiguredDatabase and verifies that there is one and only one
      * producer for each consumer on each state.
+     * @details Computes the signal layout (see CacheLineLayout) and writes it in the configured database.
      * @param[in] data see DataSourceI::SetConfiguredDatabase
      * @return true if DataSourceI::SetConfiguredDatabase returns true and if there is one and only one
      * producer for each consumer on each state.
      */
     virtual bool SetConfiguredDatabase(StructuredDataI & data);
 
+    /**
+     * @brief Returns true if the ZeroCopy option was set.
+     * @return true if the ZeroCopy option was set.
+     */
+    bool IsZeroCopy() const;
+
 protected:
     /**
      * The single buffer memory.
@@ -195,6 +250,103 @@ protected:
      */
     bool forceResetUnusedVariablesAtStateChange;
 
+    /**
+     * Alias the GAM memory of the signals that qualify?
+     */
+    bool zeroCopy;
+
+private:
+
+    /**
+     * @brief Computes the signalOffsets and the memorySize, grouping the signals by producer if cacheLineLayout is set.
+     * @return true if the size of all the signals can be retrieved and is greater than zero.
+     */
+    bool ComputeSignalLayout();
+
+    /**
+     * The memory returned by the memoryHeap (signalMemory may be aligned inside it).
+     */
+    void *allocatedMemory;
+
+    /**
+     * The number of bytes required to hold all the signals.
+     */
+    uint32 memorySize;
+
+    /**
+     * Group the signals by producer and align the groups to the cache line size?
+     */
+    bool cacheLineLayout;
+
+    /**
+     * The cache line size used when cacheLineLayout is set.
+     */
+    uint32 cacheLineSize;
+
+    /**
+     * @brief Checks if at least one signal of the function is to be copied by \a brokerClassName (i.e. is not zero-copy).
+     * @param[in] direction the signal direction.
+     * @param[in] functionName name of the function being queried.
+     * @param[in] brokerClassName the name of the broker class.
+     * @return true if at least one signal of the function is to be copied by \a brokerClassName or if the function signals cannot be queried.
+     */
+    bool HasBrokerSignals(const SignalDirection direction,
+                          const char8 * const functionName,
+                          const char8 * const brokerClassName);
+
+    /**
+     * @brief Computes the resetSignals and, for each state, the resetStateSignals.
+     * @return true if the memory, the size and the Default value of all the input signals can be retrieved.
+     */
+    bool PrepareResetSignals();
+
+    /**
+     * @brief Converts the Default value of a signal to the signal type.
+     * @param[in] signalIdx the index of the signal.
+     * @param[in] typeDesc the type of the signal.
+     * @param[out] destination where to write the value (with the size of the signal).
+     * @return true if the dimensions and the number of elements of the Default match the signal and the value can be converted.
+     */
+    bool ConvertDefaultValue(const uint32 signalIdx,
+                             const TypeDescriptor &typeDesc,
+                             void * const destination);
+
+    /**
+     * @brief Frees the resetSignals and the resetStateSignals.
+     */
+    void FreeResetSignals();
+
+    /**
+     * The input signals of all the functions (without repetitions), to be reset at a state change.
+     */
+    GAMDataSourceResetSignal *resetSignals;
+
+    /**
+     * The number of elements of resetSignals.
+     */
+    uint32 numberOfResetSignals;
+
+    /**
+     * The names of the states where at least one of the input signals is produced.
+     */
+    StreamString *resetStateNames;
+
+    /**
+     * The number of elements of resetStateNames.
+     */
+    uint32 numberOfResetStates;
+
+    /**
+     * For each state, the indexes (in resetSignals) of the signals that are not produced in the state. The indexes of the state s
+     * are the ones between resetStateFirstSignal[s] and resetStateFirstSignal[s + 1].
+     */
+    uint32 *resetStateSignals;
+
+    /**
+     * The first index in resetStateSignals of each state (with numberOfResetStates + 1 elements).
+     */
+    uint32 *resetStateFirstSignal;
+
 };
 
 }
@@ -32,14 +32,22 @@
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "BrokerI.h"
 #include "ConfigurationDatabase.h"
 #include "DataSourceI.h"
 #include "GAM.h"
+#include "GAMDataDependencies.h"
 #include "GAMSchedulerI.h"
+#include "HeapManager.h"
+#include "MemoryMapBroker.h"
+#include "MemoryMapInputBroker.h"
+#include "MemoryMapOutputBroker.h"
+#include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
 #include "RealTimeThread.h"
 #include "ReferenceContainerFilterReferences.h"
+#include "Trace.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -47,6 +55,67 @@
 
 namespace MARTe {
 
+/**
+ * @brief Reads the performance counters after the execution of an ExecutableI and updates its signals and totals.
+ * @param[in,out] counters the performance counters of the ExecutableI.
+ * @param[in] before the counter values read before the execution.
+ */
+static void UpdatePerformanceCounters(ExecutablePerformanceCounters &counters,
+                                      const uint64 * const before) {
+    uint64 after[PerformanceCounters::NUMBER_OF_COUNTERS];
+    if (PerformanceCounters::Read(&after[0u])) {
+        for (uint32 c = 0u; c < PerformanceCounters::NUMBER_OF_COUNTERS; c++) {
+            uint64 events = after[c] - before[c];
+            counters.totals[c] += events;
+            if (counters.outputs[c] != NULL_PTR(uint64 *)) {
+                *counters.outputs[c] = events;
+            }
+        }
+        counters.numberOfSamples++;
+    }
+}
+
+#ifdef THREAD_LOCAL
+/**
+ * The progress published by the calling thread (see GAMSchedulerI::BeginCycleProgress).
+ */
+static THREAD_LOCAL ExecutionProgress *threadProgress = NULL_PTR(ExecutionProgress *);
+#else
+/**
+ * The progress is not published without thread local storage.
+ */
+static ExecutionProgress * const threadProgress = NULL_PTR(ExecutionProgress *);
+#endif
+
+/**
+ * @brief Publishes the ExecutableI being executed by the calling thread.
+ * @param[in] index the index of the ExecutableI plus one (0 if the thread is outside its ExecutableIs).
+ */
+static inline void PublishProgress(const uint32 index) {
+    ExecutionProgress * const progress = threadProgress;
+    if (progress != NULL_PTR(ExecutionProgress *)) {
+        uint64 word = (static_cast<uint64>(progress->cycle) << 32u) | static_cast<uint64>(index);
+        Atomic::Store(&progress->word, static_cast<int64>(word), Atomic::MemoryOrderRelaxed);
+    }
+}
+
+/**
+ * @brief Registers the name with which the executions of a broker are traced (GAM_NAME:BROKER_CLASS).
+ * @param[in] gamFullName the name of the GAM which owns the broker.
+ * @param[in] broker the broker.
+ * @return the identifier of the name.
+ */
+static uint32 RegisterBrokerTraceName(const char8 * const gamFullName,
+                                      const Reference &broker) {
+    StreamString traceName = gamFullName;
+    traceName += ":";
+    const ClassProperties *properties = broker->GetClassProperties();
+    if (properties != NULL_PTR(const ClassProperties *)) {
+        traceName += properties->GetName();
+    }
+    return Trace::RegisterName(traceName.Buffer());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -60,6 +129,7 @@ GAMSchedulerI::GAMSchedulerI() :
     numberOfStates = 0u;
     currentStateIdentifier = NULL_PTR(uint32 *);
     nextStateIdentifier = 0u;
+    flattenCycles = false;
 }
 
 /*lint -e{1740} currentStateIdentifier is a pointer to a memory block allocated elsewhere*/
@@ -75,6 +145,40 @@ GAMSchedulerI::~GAMSchedulerI() {
                         if (states[s].threads[t].executables != NULL_PTR(ExecutableI **)) {
                             delete [] states[s].threads[t].executables;
                         }
+                        ParallelSchedule *parallel = states[s].threads[t].parallel;
+                        if (parallel != NULL_PTR(ParallelSchedule *)) {
+                            delete [] parallel->executables;
+                            delete [] parallel->segments;
+                            delete [] parallel->workerCPUs;
+                            delete parallel;
+                        }
+                        FlatCycle *flat = states[s].threads[t].flat;
+                        if (flat != NULL_PTR(FlatCycle *)) {
+                            delete [] flat->operations;
+                            delete flat;
+                        }
+                        MultiRateSchedule *multiRate = states[s].threads[t].multiRate;
+                        if (multiRate != NULL_PTR(MultiRateSchedule *)) {
+                            delete [] multiRate->first;
+                            delete [] multiRate->divider;
+                            delete [] multiRate->phase;
+                            delete [] multiRate->countdown;
+                            delete [] multiRate->changeDriven;
+                            delete [] multiRate->gamExecutable;
+                            delete multiRate;
+                        }
+                        PrefetchTable *prefetch = states[s].threads[t].prefetch;
+                        if (prefetch != NULL_PTR(PrefetchTable *)) {
+                            delete [] prefetch->ranges;
+                            delete [] prefetch->first;
+                            delete prefetch;
+                        }
+                        if (states[s].threads[t].budgetMonitor != NULL_PTR(CycleBudgetMonitor *)) {
+                            delete states[s].threads[t].budgetMonitor;
+                        }
+                        if (states[s].threads[t].progress != NULL_PTR(ExecutionProgress *)) {
+                            delete states[s].threads[t].progress;
+                        }
                     }
                     delete [] states[s].threads;
                 }
@@ -94,6 +198,34 @@ bool GAMSchedulerI::Initialise(StructuredDataI & data) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Please specify the TimingDataSource address");
         }
     }
+    if (ret) {
+        uint8 flattenCyclesIn = 0u;
+        if (!data.Read("FlattenCycles", flattenCyclesIn)) {
+            flattenCyclesIn = 0u;
+        }
+        flattenCycles = (flattenCyclesIn == 1u);
+    }
+    if (ret) {
+        uint32 realTimeHeapCheck = 0u;
+        if (data.Read("RealTimeHeapCheck", realTimeHeapCheck)) {
+            HeapManager::SetRealTimeCheck(true, realTimeHeapCheck);
+        }
+    }
+    if (ret) {
+        uint32 n;
+        for (n = 0u; (n < Size()) && (!overrunMessage.IsValid()); n++) {
+            Reference child = Get(n);
+            if (child.IsValid()) {
+                if (StringHelper::Compare(child->GetName(), "OverrunMessage") == 0) {
+                    overrunMessage = child;
+                    ret = overrunMessage.IsValid();
+                    if (!ret) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "The OverrunMessage is not a Message");
+                    }
+                }
+            }
+        }
+    }
 
     return ret;
 }
@@ -137,6 +269,18 @@ bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
                     states[i].name = stateElement->GetName();
 
                     states[i].threads = new ScheduledThread[numberOfThreads];
+                    for (uint32 j = 0u; j < numberOfThreads; j++) {
+                        states[i].threads[j].executables = NULL_PTR(ExecutableI **);
+                        states[i].threads[j].parallel = NULL_PTR(ParallelSchedule *);
+                        states[i].threads[j].flat = NULL_PTR(FlatCycle *);
+                        states[i].threads[j].multiRate = NULL_PTR(MultiRateSchedule *);
+                        states[i].threads[j].prefetch = NULL_PTR(PrefetchTable *);
+                        states[i].threads[j].budgetMonitor = NULL_PTR(CycleBudgetMonitor *);
+                        states[i].threads[j].traceNameId = 0u;
+                        states[i].threads[j].progress = new ExecutionProgress;
+                        states[i].threads[j].progress->word = 0;
+                        states[i].threads[j].progress->cycle = 0u;
+                    }
 
                     for (uint32 j = 0u; (j < numberOfThreads) && (ret); j++) {
                         ReferenceT<RealTimeThread> threadElement = threadContainer->Get(j);
@@ -174,12 +318,22 @@ bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
                                 states[i].threads[j].name = threadElement->GetName();
                                 states[i].threads[j].cpu = threadElement->GetCPU();
                                 states[i].threads[j].stackSize = threadElement->GetStackSize();
+                                states[i].threads[j].prefaultStackSize = threadElement->GetPrefaultStackSize();
+                                (void) threadElement->GetDeadline(states[i].threads[j].deadlineRuntime, states[i].threads[j].deadlineDeadline,
+                                                                  states[i].threads[j].deadlinePeriod);
+                                states[i].threads[j].cycleTimeHistogram = NULL_PTR(LatencyHistogram *);
+                                states[i].threads[j].lateness = NULL_PTR(uint32 *);
+                                states[i].threads[j].period = threadElement->GetPeriod();
+                                states[i].threads[j].phase = threadElement->GetPhase();
+                                states[i].threads[j].busyWaitTail = threadElement->GetBusyWaitTail();
                             }
                             uint32 c = 0u;
+                            uint32 *gamExecutables = new uint32[numberOfGams + 1u];
                             for (uint32 k = 0u; (k < numberOfGams) && (ret); k++) {
                                 //add input brokers
                                 StreamString gamFullName;
                                 ReferenceT<GAM> gam = gams.Get(k);
+                                gamExecutables[k] = c;
                                 ret = gam->GetQualifiedName(gamFullName);
                                 if (ret) {
                                     ret = InsertInputBrokers(gam, gamFullName.Buffer(), i, j, c);
@@ -197,6 +351,43 @@ bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
                                     ret = InsertOutputBrokers(gam, gamFullName.Buffer(), i, j, c);
                                 }
                             }
+                            gamExecutables[numberOfGams] = c;
+
+                            //Compute the dependency graph of the GAMs to be executed in parallel
+                            if ((ret) && (threadElement->GetNumberOfWorkers() > 0u)) {
+                                ret = BuildParallelSchedule(gams, gamExecutables, threadElement->GetWorkerCPUs(), threadElement->GetNumberOfWorkers(),
+                                                            states[i].threads[j]);
+                            }
+
+                            //Compute the cycles in which each GAM is executed
+                            if (ret) {
+                                ret = BuildMultiRateSchedule(gams, *(threadElement.operator->()), gamExecutables, states[i].threads[j]);
+                            }
+                            delete [] gamExecutables;
+
+                            //Prefetch the memory of the brokers of the threads executed sequentially
+                            if ((ret) && (threadElement->GetPrefetchBrokers()) && (states[i].threads[j].parallel == NULL_PTR(ParallelSchedule *))) {
+                                ret = BuildPrefetchTable(states[i].threads[j]);
+                            }
+
+                            //Merge the broker copies of the threads executed sequentially
+                            if ((ret) && (flattenCycles) && (states[i].threads[j].parallel == NULL_PTR(ParallelSchedule *))
+                                    && (states[i].threads[j].multiRate == NULL_PTR(MultiRateSchedule *))) {
+                                ret = BuildFlatCycle(states[i].threads[j]);
+                            }
+
+                            //Monitor the execution time of the cycles
+                            if ((ret) && (threadElement->GetCycleBudget() > 0u)) {
+                                CycleBudgetMonitor *monitor = new CycleBudgetMonitor;
+                                monitor->budget = threadElement->GetCycleBudget();
+                                monitor->budgetTicks = (static_cast<uint64>(monitor->budget) * HighResolutionTimer::Frequency()) / 1000000ULL;
+                                monitor->messageThreshold = threadElement->GetOverrunMessageThreshold();
+                                monitor->numberOfCycles = 0u;
+                                monitor->numberOfOverruns = 0u;
+                                monitor->consecutiveOverruns = 0u;
+                                monitor->worstTicks = 0u;
+                                states[i].threads[j].budgetMonitor = monitor;
+                            }
 
                             //Add the cycle time
                             if (ret) {
@@ -209,6 +400,29 @@ bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
                                 if (ret) {
                                     ret = timingDataSource->GetSignalMemoryBuffer(signalIdx, 0u, reinterpret_cast<void*&>(states[i].threads[j].cycleTime));
                                 }
+                                if (ret) {
+                                    states[i].threads[j].cycleTimeHistogram = timingDataSource->GetSignalHistogram(signalIdx);
+                                }
+                                if (ret) {
+                                    //The cycles are traced with the name STATE_NAME.THREAD_NAME
+                                    StreamString traceName = states[i].name;
+                                    traceName += ".";
+                                    traceName += states[i].threads[j].name;
+                                    states[i].threads[j].traceNameId = Trace::RegisterName(traceName.Buffer());
+                                }
+                            }
+
+                            //Add the release lateness of periodically released threads
+                            if ((ret) && (states[i].threads[j].period > 0u)) {
+                                StreamString threadFullName = states[i].name;
+                                threadFullName += ".";
+                                threadFullName += states[i].threads[j].name;
+                                threadFullName += "_Lateness";
+                                uint32 signalIdx;
+                                ret = timingDataSource->GetSignalIndex(signalIdx, threadFullName.Buffer());
+                                if (ret) {
+                                    ret = timingDataSource->GetSignalMemoryBuffer(signalIdx, 0u, reinterpret_cast<void*&>(states[i].threads[j].lateness));
+                                }
                             }
 
                             //Get the current state identifier
@@ -273,6 +487,13 @@ bool GAMSchedulerI::InsertInputBrokers(ReferenceT<GAM> gam,
             states[stateIdx].threads[threadIdx].executables[executableIdx] = input.operator->();
             //lint -e{613} states != NULL checked before entering here.
             states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTimingSignalAddress(reinterpret_cast<uint32*>(signalAddress));
+            //lint -e{613} states != NULL checked before entering here.
+            states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTraceNameId(RegisterBrokerTraceName(gamFullName, input));
+            //All the brokers write the same signal, only the last one (which writes the final value) updates the histogram
+            if (n == (numberOfInputBrokers - 1u)) {
+                //lint -e{613} states != NULL checked before entering here.
+                states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTimingHistogram(timingDataSource->GetSignalHistogram(signalIdx));
+            }
         }
         executableIdx++;
     }
@@ -310,10 +531,101 @@ bool GAMSchedulerI::InsertGAM(ReferenceT<GAM> gam,
         states[stateIdx].threads[threadIdx].executables[executableIdx] = gam.operator->();
         //lint -e{613} states != NULL checked before entering here.
         states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTimingSignalAddress(reinterpret_cast<uint32*>(signalAddress));
+        //lint -e{613} states != NULL checked before entering here.
+        states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTimingHistogram(timingDataSource->GetSignalHistogram(signalIdx));
+        //lint -e{613} states != NULL checked before entering here.
+        states[stateIdx].threads[threadIdx].executables[executableIdx]->SetPerformanceCounters(timingDataSource->GetSignalPerformanceCounters(signalIdx));
+        //lint -e{613} states != NULL checked before entering here.
+        states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTraceNameId(Trace::RegisterName(gamFullName));
     }
     return ret;
 }
 
+bool GAMSchedulerI::BuildParallelSchedule(ReferenceContainer &gams,
+                                          const uint32 * const gamExecutables,
+                                          const uint32 * const workerCPUs,
+                                          const uint32 numberOfWorkers,
+                                          ScheduledThread &thread) const {
+    GAMDataDependencies dependencies;
+    bool ret = dependencies.Initialise(realTimeApp, gams);
+    uint32 numberOfGams = gams.Size();
+
+    //Each GAM is one level after the last of the previous GAMs it depends on
+    uint32 *gamLevel = new uint32[numberOfGams + 1u];
+    uint32 numberOfLevels = 0u;
+    for (uint32 k = 0u; (k < numberOfGams) && (ret); k++) {
+        gamLevel[k] = 0u;
+        for (uint32 a = 0u; a < k; a++) {
+            bool depends = (dependencies.WritesSignal(a, k)) || (dependencies.WritesSignal(k, a));
+            if (!depends) {
+                depends = (dependencies.SharesDataSource(a, k)) || (dependencies.SharesDataSource(k, a));
+            }
+            if (depends) {
+                if (gamLevel[k] < (gamLevel[a] + 1u)) {
+                    gamLevel[k] = gamLevel[a] + 1u;
+                }
+            }
+        }
+        if (numberOfLevels < (gamLevel[k] + 1u)) {
+            numberOfLevels = gamLevel[k] + 1u;
+        }
+    }
+
+    if (ret) {
+        uint32 numberOfLanes = numberOfWorkers + 1u;
+        ParallelSchedule *parallel = new ParallelSchedule;
+        parallel->numberOfLevels = numberOfLevels;
+        parallel->numberOfLanes = numberOfLanes;
+        parallel->executables = new ExecutableI*[thread.numberOfExecutables];
+        parallel->segments = new uint32[(numberOfLevels * numberOfLanes) + 1u];
+        parallel->workerCPUs = new uint32[numberOfWorkers];
+        for (uint32 w = 0u; w < numberOfWorkers; w++) {
+            parallel->workerCPUs[w] = workerCPUs[w];
+        }
+        //Assign the GAMs of each level to the lane with the least ExecutableIs (keeping the GAM order inside each lane)
+        uint32 *gamLane = new uint32[numberOfGams + 1u];
+        uint32 *laneLoad = new uint32[numberOfLanes];
+        uint32 e = 0u;
+        for (uint32 l = 0u; l < numberOfLevels; l++) {
+            for (uint32 n = 0u; n < numberOfLanes; n++) {
+                laneLoad[n] = 0u;
+            }
+            for (uint32 k = 0u; k < numberOfGams; k++) {
+                if (gamLevel[k] == l) {
+                    uint32 lane = 0u;
+                    for (uint32 n = 1u; n < numberOfLanes; n++) {
+                        if (laneLoad[n] < laneLoad[lane]) {
+                            lane = n;
+                        }
+                    }
+                    gamLane[k] = lane;
+                    laneLoad[lane] += gamExecutables[k + 1u] - gamExecutables[k];
+                }
+            }
+            for (uint32 n = 0u; n < numberOfLanes; n++) {
+                parallel->segments[(l * numberOfLanes) + n] = e;
+                for (uint32 k = 0u; k < numberOfGams; k++) {
+                    if ((gamLevel[k] == l) && (gamLane[k] == n)) {
+                        for (uint32 x = gamExecutables[k]; x < gamExecutables[k + 1u]; x++) {
+                            parallel->executables[e] = thread.executables[x];
+                            e++;
+                        }
+                    }
+                }
+            }
+        }
+        parallel->segments[numberOfLevels * numberOfLanes] = e;
+        delete [] gamLane;
+        delete [] laneLoad;
+        thread.parallel = parallel;
+        REPORT_ERROR(ErrorManagement::Information, "Thread %s: %d GAMs in %d levels executed by %d lanes", thread.name, numberOfGams, numberOfLevels,
+                     numberOfLanes);
+    }
+
+    delete [] gamLevel;
+    return ret;
+}
+
 bool GAMSchedulerI::InsertOutputBrokers(ReferenceT<GAM> gam,
                                         const char8 * const gamFullName,
                                         const uint32 stateIdx,
@@ -353,6 +665,13 @@ bool GAMSchedulerI::InsertOutputBrokers(ReferenceT<GAM> gam,
             states[stateIdx].threads[threadIdx].executables[executableIdx] = output.operator->();
             //lint -e{613} states != NULL checked before entering here.
             states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTimingSignalAddress(reinterpret_cast<uint32*>(signalAddress));
+            //lint -e{613} states != NULL checked before entering here.
+            states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTraceNameId(RegisterBrokerTraceName(gamFullName, output));
+            //All the brokers write the same signal, only the last one (which writes the final value) updates the histogram
+            if (n == (numberOfOutputBrokers - 1u)) {
+                //lint -e{613} states != NULL checked before entering here.
+                states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTimingHistogram(timingDataSource->GetSignalHistogram(signalIdx));
+            }
         }
         executableIdx++;
     }
@@ -390,6 +709,45 @@ bool GAMSchedulerI::PrepareNextState(const char8 * const currentStateName,
         ret = found;
     }
     if (ret) {
+        MARTe2_TRACE_EVENT(Trace::EVENT_STATE_CHANGE, Trace::RegisterName(nextStateName), 0u)
+    }
+    if (ret) {
+        for (uint32 i = 0u; i < numberOfStates; i++) {
+            //lint -e{613} states != NULL checked before entering here.
+            if ((currentStateName != NULL_PTR(const char8 *)) && (StringHelper::Compare(currentStateName, states[i].name) == 0)) {
+                ReportCycleBudgets(states[i]);
+            }
+        }
+        ScheduledState *nextState = scheduledStates[nextBuffer];
+        for (uint32 t = 0u; t < nextState->numberOfThreads; t++) {
+            CycleBudgetMonitor *monitor = nextState->threads[t].budgetMonitor;
+            if (monitor != NULL_PTR(CycleBudgetMonitor *)) {
+                monitor->numberOfCycles = 0u;
+                monitor->numberOfOverruns = 0u;
+                monitor->consecutiveOverruns = 0u;
+                monitor->worstTicks = 0u;
+            }
+            //A thread stopped within a cycle of the previous execution of the state shall not look stalled
+            ExecutionProgress *progress = nextState->threads[t].progress;
+            if (progress != NULL_PTR(ExecutionProgress *)) {
+                progress->cycle = 0u;
+                Atomic::Store(&progress->word, static_cast<int64>(0), Atomic::MemoryOrderRelaxed);
+            }
+            //The cycles of the multi-rate GAMs are counted from the beginning of the state
+            MultiRateSchedule *multiRate = nextState->threads[t].multiRate;
+            if (multiRate != NULL_PTR(MultiRateSchedule *)) {
+                for (uint32 g = 0u; g < multiRate->numberOfGroups; g++) {
+                    multiRate->countdown[g] = multiRate->phase[g];
+                    if (multiRate->changeDriven[g] != NULL_PTR(GAM *)) {
+                        multiRate->changeDriven[g]->InvalidateInputs();
+                    }
+                }
+            }
+        }
+        if (overrunMessage.IsValid()) {
+            //The overrunMessage is sent from the real-time threads
+            overrunMessageDestination = ObjectRegistryDatabase::Instance()->Find(overrunMessage->GetDestination());
+        }
         CustomPrepareNextState();
     }
 
@@ -398,42 +756,509 @@ bool GAMSchedulerI::PrepareNextState(const char8 * const currentStateName,
 
 bool GAMSchedulerI::ExecuteSingleCycle(ExecutableI * const * const executables,
                                        const uint32 numberOfExecutables) const {
+    return ExecuteSingleCycle(executables, numberOfExecutables, HighResolutionTimer::Counter());
+}
+
+bool GAMSchedulerI::ExecuteSingleCycle(ExecutableI * const * const executables,
+                                       const uint32 numberOfExecutables,
+                                       const uint64 cycleStartTicks) const {
+    return ExecuteSingleCycle(executables, numberOfExecutables, cycleStartTicks, NULL_PTR(const PrefetchTable *));
+}
+
+bool GAMSchedulerI::ExecuteSingleCycle(ExecutableI * const * const executables,
+                                       const uint32 numberOfExecutables,
+                                       const uint64 cycleStartTicks,
+                                       const PrefetchTable * const prefetch) const {
+    HeapManager::RealTimeCycle();
+    return ExecuteExecutables(executables, 0u, numberOfExecutables, cycleStartTicks, prefetch);
+}
+
+bool GAMSchedulerI::ExecuteMultiRateCycle(ExecutableI * const * const executables,
+                                          MultiRateSchedule &schedule,
+                                          const uint64 cycleStartTicks,
+                                          const PrefetchTable * const prefetch) const {
+    HeapManager::RealTimeCycle();
+    bool ret = true;
+    for (uint32 g = 0u; (g < schedule.numberOfGroups) && (ret); g++) {
+        if (schedule.countdown[g] == 0u) {
+            GAM *gam = schedule.changeDriven[g];
+            if (gam == NULL_PTR(GAM *)) {
+                ret = ExecuteExecutables(executables, schedule.first[g], schedule.first[g + 1u], cycleStartTicks, prefetch);
+            }
+            else {
+                //The input brokers are always executed, the GAM and its output brokers only if the inputs changed
+                ret = ExecuteExecutables(executables, schedule.first[g], schedule.gamExecutable[g], cycleStartTicks, prefetch);
+                if ((ret) && (gam->InputsChanged())) {
+                    ret = ExecuteExecutables(executables, schedule.gamExecutable[g], schedule.first[g + 1u], cycleStartTicks, prefetch);
+                }
+            }
+            schedule.countdown[g] = schedule.divider[g] - 1u;
+        }
+        else {
+            schedule.countdown[g]--;
+        }
+    }
+    return ret;
+}
+
+bool GAMSchedulerI::ExecuteExecutables(ExecutableI * const * const executables,
+                                       const uint32 first,
+                                       const uint32 last,
+                                       const uint64 cycleStartTicks,
+                                       const PrefetchTable * const prefetch) const {
     // warning: possible segmentation faults if the previous operations
     // lack or fail and the pointers are invalid.
 
     bool ret = true;
-    uint64 absTicks = HighResolutionTimer::Counter();
-    for (uint32 i = 0u; (i < numberOfExecutables) && (ret); i++) {
+    uint64 absTicks = cycleStartTicks;
+    for (uint32 i = first; (i < last) && (ret); i++) {
+        if (prefetch != NULL_PTR(const PrefetchTable *)) {
+            // the memory of the next brokers is loaded while this one executes
+            for (uint32 r = prefetch->first[i]; r < prefetch->first[i + 1u]; r++) {
+                MemoryOperationsHelper::Prefetch(prefetch->ranges[r].address, prefetch->ranges[r].size, prefetch->ranges[r].forWrite);
+            }
+        }
+        PublishProgress(i + 1u);
+        ExecutablePerformanceCounters *counters = executables[i]->GetPerformanceCounters();
+        uint64 countersBefore[PerformanceCounters::NUMBER_OF_COUNTERS];
+        bool countEvents = false;
+        if (counters != NULL_PTR(ExecutablePerformanceCounters *)) {
+            countEvents = PerformanceCounters::Read(&countersBefore[0u]);
+        }
         // save the time before
         // execute the gam
+        MARTe2_TRACE_EVENT(Trace::EVENT_EXECUTABLE_BEGIN, executables[i]->GetTraceNameId(), 0u)
         ret = executables[i]->Execute();
+        MARTe2_TRACE_EVENT(Trace::EVENT_EXECUTABLE_END, executables[i]->GetTraceNameId(), 0u)
+        if (countEvents) {
+            UpdatePerformanceCounters(*counters, &countersBefore[0u]);
+        }
         uint64 tmp = (HighResolutionTimer::Counter() - absTicks);
-        float64 ticksToTime = (static_cast<float64>(tmp) * clockPeriod) * 1e6;
-        uint32 absTime = static_cast<uint32>(ticksToTime);  //us
+        uint32 absTime = static_cast<uint32>(HighResolutionTimer::TicksToMicroSeconds(tmp));  //us
         if (ret) {
             uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
             ret = MemoryOperationsHelper::Copy(executables[i]->GetTimingSignalAddress(), &absTime, sizeToCopy);
+            LatencyHistogram *histogram = executables[i]->GetTimingHistogram();
+            if (histogram != NULL_PTR(LatencyHistogram *)) {
+                histogram->Add(absTime);
+            }
         }
         else {
-            BrokerI *broker = dynamic_cast<BrokerI *>(executables[i]);
-            if (broker != NULL_PTR(BrokerI *)) {
-                StreamString ownerFunctionName = broker->GetOwnerFunctionName();
-                StreamString ownerDataSourceName = broker->GetOwnerDataSourceName();
-                StreamString brokerName = "unnamed";
-                if (broker->GetName() != NULL_PTR(const char8 * const)) {
-                    brokerName = broker->GetName();
+            ReportExecutableFailure(executables[i]);
+        }
+    }
+
+    return ret;
+}
+
+bool GAMSchedulerI::ExecuteFlatCycle(const FlatCycle &cycle) const {
+    HeapManager::RealTimeCycle();
+    bool ret = true;
+    uint64 absTicks = HighResolutionTimer::Counter();
+    const FlatCycleOperation * const operations = cycle.operations;
+    uint32 numberOfOperations = cycle.numberOfOperations;
+    for (uint32 i = 0u; (i < numberOfOperations) && (ret); i++) {
+        const FlatCycleOperation &operation = operations[i];
+        PublishProgress(operation.executableIndex + 1u);
+        if (operation.executable == NULL_PTR(ExecutableI *)) {
+            //The pointers were validated by MemoryMapBroker::Init
+            MemoryOperationsHelper::CopyTagged(operation.destination, operation.source, operation.size, operation.fixedSize);
+        }
+        else {
+            for (uint32 r = 0u; r < operation.numberOfPrefetches; r++) {
+                MemoryOperationsHelper::Prefetch(operation.prefetch[r].address, operation.prefetch[r].size, operation.prefetch[r].forWrite);
+            }
+            ExecutablePerformanceCounters *counters = operation.executable->GetPerformanceCounters();
+            uint64 countersBefore[PerformanceCounters::NUMBER_OF_COUNTERS];
+            bool countEvents = false;
+            if (counters != NULL_PTR(ExecutablePerformanceCounters *)) {
+                countEvents = PerformanceCounters::Read(&countersBefore[0u]);
+            }
+            MARTe2_TRACE_EVENT(Trace::EVENT_EXECUTABLE_BEGIN, operation.executable->GetTraceNameId(), 0u)
+            ret = operation.executable->Execute();
+            MARTe2_TRACE_EVENT(Trace::EVENT_EXECUTABLE_END, operation.executable->GetTraceNameId(), 0u)
+            if (countEvents) {
+                UpdatePerformanceCounters(*counters, &countersBefore[0u]);
+            }
+            if (!ret) {
+                ReportExecutableFailure(operation.executable);
+            }
+        }
+        if ((ret) && (operation.timingSignal != NULL_PTR(uint32 *))) {
+            uint64 tmp = (HighResolutionTimer::Counter() - absTicks);
+            uint32 absTime = static_cast<uint32>(HighResolutionTimer::TicksToMicroSeconds(tmp));  //us
+            *operation.timingSignal = absTime;
+            if (operation.histogram != NULL_PTR(LatencyHistogram *)) {
+                operation.histogram->Add(absTime);
+            }
+        }
+    }
+    return ret;
+}
+
+void GAMSchedulerI::ReportExecutableFailure(ExecutableI * const executable) const {
+    BrokerI *broker = dynamic_cast<BrokerI *>(executable);
+    if (broker != NULL_PTR(BrokerI *)) {
+        //The owner names are only copied if the report is not rate limited
+        const char8 *brokerName = broker->GetName();
+        if (brokerName == NULL_PTR(const char8 *)) {
+            brokerName = "unnamed";
+        }
+        REPORT_ERROR (ErrorManagement::Warning, "BrokerI %s failed, owner function: %s, owner DataSource: %s", brokerName, broker->GetOwnerFunctionName().Buffer(), broker->GetOwnerDataSourceName().Buffer());
+    }
+    else {
+        Object *obj = dynamic_cast<Object *>(executable);
+        if (obj != NULL_PTR(Object *)) {
+            REPORT_ERROR (ErrorManagement::Warning, "ExecutableI %s failed", obj->GetName());
+        }
+    }
+}
+
+bool GAMSchedulerI::ExecuteParallelSegment(const ParallelSchedule &schedule,
+                                           const uint32 level,
+                                           const uint32 lane,
+                                           const uint64 cycleStartTicks) const {
+    uint32 segment = (level * schedule.numberOfLanes) + lane;
+    uint32 first = schedule.segments[segment];
+    uint32 numberOfSegmentExecutables = schedule.segments[segment + 1u] - first;
+    return ExecuteSingleCycle(&schedule.executables[first], numberOfSegmentExecutables, cycleStartTicks);
+}
+
+bool GAMSchedulerI::BuildFlatCycle(ScheduledThread &thread) const {
+    uint32 numberOfExecutables = thread.numberOfExecutables;
+    ExecutableI * const * const executables = thread.executables;
+    //The copy table of each ExecutableI that is merged (NULL if it is executed)
+    const MemoryMapBrokerCopyTableEntry **copyTables = new const MemoryMapBrokerCopyTableEntry*[numberOfExecutables];
+    uint32 *numberOfCopies = new uint32[numberOfExecutables];
+    bool *isInput = new bool[numberOfExecutables];
+    uint32 numberOfOperations = 0u;
+    uint32 numberOfMerged = 0u;
+    for (uint32 e = 0u; e < numberOfExecutables; e++) {
+        copyTables[e] = NULL_PTR(const MemoryMapBrokerCopyTableEntry *);
+        numberOfCopies[e] = 0u;
+        isInput[e] = false;
+        MemoryMapBroker *broker = dynamic_cast<MemoryMapBroker *>(executables[e]);
+        if (broker != NULL_PTR(MemoryMapBroker *)) {
+            const ClassProperties *properties = broker->GetClassProperties();
+            if (properties != NULL_PTR(const ClassProperties *)) {
+                isInput[e] = (StringHelper::Compare(properties->GetName(), "MemoryMapInputBroker") == 0);
+                bool isOutput = (StringHelper::Compare(properties->GetName(), "MemoryMapOutputBroker") == 0);
+                if ((isInput[e]) || (isOutput)) {
+                    copyTables[e] = broker->GetStatelessCopyTable();
+                    numberOfCopies[e] = broker->GetNumberOfCopies();
+                }
+                //The brokers with strided (gather/scatter) copies are executed
+                for (uint32 n = 0u; (n < numberOfCopies[e]) && (copyTables[e] != NULL_PTR(const MemoryMapBrokerCopyTableEntry *)); n++) {
+                    if (copyTables[e][n].numberOfElements > 1u) {
+                        copyTables[e] = NULL_PTR(const MemoryMapBrokerCopyTableEntry *);
+                    }
                 }
-                REPORT_ERROR (ErrorManagement::Warning, "BrokerI %s failed, owner function: %s, owner DataSource: %s", brokerName.Buffer(), ownerFunctionName.Buffer(), ownerDataSourceName.Buffer());
             }
-            else {
-                Object *obj = dynamic_cast<Object *>(executables[i]);
-                if (obj != NULL_PTR(Object *)) {
-                    REPORT_ERROR (ErrorManagement::Warning, "ExecutableI %s failed", obj->GetName());
+        }
+        if (copyTables[e] != NULL_PTR(const MemoryMapBrokerCopyTableEntry *)) {
+            //The copies plus (at most) one operation to store the timing signal
+            numberOfOperations += (numberOfCopies[e] + 1u);
+            numberOfMerged++;
+        }
+        else {
+            numberOfOperations++;
+        }
+    }
+    FlatCycle *flat = new FlatCycle;
+    flat->operations = new FlatCycleOperation[numberOfOperations];
+    uint32 o = 0u;
+    for (uint32 e = 0u; e < numberOfExecutables; e++) {
+        const MemoryMapBrokerCopyTableEntry *copyTable = copyTables[e];
+        if (copyTable == NULL_PTR(const MemoryMapBrokerCopyTableEntry *)) {
+            flat->operations[o].executable = executables[e];
+            flat->operations[o].destination = NULL_PTR(void *);
+            flat->operations[o].source = NULL_PTR(const void *);
+            flat->operations[o].size = 0u;
+            flat->operations[o].fixedSize = 0u;
+            flat->operations[o].timingSignal = executables[e]->GetTimingSignalAddress();
+            flat->operations[o].histogram = executables[e]->GetTimingHistogram();
+            flat->operations[o].prefetch = NULL_PTR(const PrefetchRange *);
+            flat->operations[o].numberOfPrefetches = 0u;
+            if (thread.prefetch != NULL_PTR(PrefetchTable *)) {
+                flat->operations[o].prefetch = &thread.prefetch->ranges[thread.prefetch->first[e]];
+                flat->operations[o].numberOfPrefetches = thread.prefetch->first[e + 1u] - thread.prefetch->first[e];
+            }
+            flat->operations[o].executableIndex = e;
+            o++;
+        }
+        else {
+            for (uint32 n = 0u; n < numberOfCopies[e]; n++) {
+                flat->operations[o].executable = NULL_PTR(ExecutableI *);
+                if (isInput[e]) {
+                    flat->operations[o].destination = copyTable[n].gamPointer;
+                    flat->operations[o].source = copyTable[n].dataSourcePointer;
+                }
+                else {
+                    flat->operations[o].destination = copyTable[n].dataSourcePointer;
+                    flat->operations[o].source = copyTable[n].gamPointer;
                 }
+                flat->operations[o].size = copyTable[n].copySize;
+                flat->operations[o].fixedSize = copyTable[n].fixedCopySize;
+                flat->operations[o].timingSignal = NULL_PTR(uint32 *);
+                flat->operations[o].histogram = NULL_PTR(LatencyHistogram *);
+                flat->operations[o].prefetch = NULL_PTR(const PrefetchRange *);
+                flat->operations[o].numberOfPrefetches = 0u;
+                flat->operations[o].executableIndex = e;
+                o++;
+            }
+            //The timing signal is overwritten by the next broker if it is merged and writes the same signal
+            bool storeTime = true;
+            if ((e + 1u) < numberOfExecutables) {
+                if (copyTables[e + 1u] != NULL_PTR(const MemoryMapBrokerCopyTableEntry *)) {
+                    storeTime = ((executables[e + 1u]->GetTimingSignalAddress() != executables[e]->GetTimingSignalAddress())
+                            || (executables[e]->GetTimingHistogram() != NULL_PTR(LatencyHistogram *)));
+                }
+            }
+            if (storeTime) {
+                if (numberOfCopies[e] == 0u) {
+                    //Empty copy, only to store the timing signal
+                    flat->operations[o].executable = NULL_PTR(ExecutableI *);
+                    flat->operations[o].destination = executables[e]->GetTimingSignalAddress();
+                    flat->operations[o].source = executables[e]->GetTimingSignalAddress();
+                    flat->operations[o].size = 0u;
+                    flat->operations[o].fixedSize = 0u;
+                    flat->operations[o].prefetch = NULL_PTR(const PrefetchRange *);
+                    flat->operations[o].numberOfPrefetches = 0u;
+                    flat->operations[o].executableIndex = e;
+                    o++;
+                }
+                flat->operations[o - 1u].timingSignal = executables[e]->GetTimingSignalAddress();
+                flat->operations[o - 1u].histogram = executables[e]->GetTimingHistogram();
             }
         }
     }
+    flat->numberOfOperations = o;
+    thread.flat = flat;
+    REPORT_ERROR(ErrorManagement::Information, "Thread %s: %d of %d ExecutableIs merged in a flat cycle of %d operations", thread.name, numberOfMerged,
+                 numberOfExecutables, o);
+    delete [] copyTables;
+    delete [] numberOfCopies;
+    delete [] isInput;
+    return true;
+}
 
+bool GAMSchedulerI::BuildPrefetchTable(ScheduledThread &thread) const {
+    uint32 numberOfExecutables = thread.numberOfExecutables;
+    ExecutableI * const * const executables = thread.executables;
+    //The brokers whose memory can be prefetched (NULL otherwise)
+    MemoryMapBroker **brokers = new MemoryMapBroker*[numberOfExecutables];
+    bool *isInput = new bool[numberOfExecutables];
+    uint32 numberOfRanges = 0u;
+    for (uint32 e = 0u; e < numberOfExecutables; e++) {
+        MemoryMapInputBroker *input = dynamic_cast<MemoryMapInputBroker *>(executables[e]);
+        MemoryMapOutputBroker *output = dynamic_cast<MemoryMapOutputBroker *>(executables[e]);
+        isInput[e] = (input != NULL_PTR(MemoryMapInputBroker *));
+        brokers[e] = NULL_PTR(MemoryMapBroker *);
+        if (isInput[e]) {
+            brokers[e] = input;
+        }
+        else if (output != NULL_PTR(MemoryMapOutputBroker *)) {
+            brokers[e] = output;
+        }
+        else {
+            //Not prefetched
+        }
+        if (brokers[e] != NULL_PTR(MemoryMapBroker *)) {
+            if (brokers[e]->GetStatelessCopyTable() != NULL_PTR(const MemoryMapBrokerCopyTableEntry *)) {
+                //The input brokers also prefetch the GAM memory
+                numberOfRanges += (isInput[e] ? (2u * brokers[e]->GetNumberOfCopies()) : brokers[e]->GetNumberOfCopies());
+            }
+        }
+    }
+    PrefetchTable *prefetch = new PrefetchTable;
+    prefetch->ranges = new PrefetchRange[numberOfRanges + 1u];
+    prefetch->first = new uint32[numberOfExecutables + 1u];
+    uint32 r = 0u;
+    uint32 numberOfPrefetching = 0u;
+    for (uint32 e = 0u; e < numberOfExecutables; e++) {
+        prefetch->first[e] = r;
+        if (brokers[e] == NULL_PTR(MemoryMapBroker *)) {
+            for (uint32 b = (e + 1u); (b < numberOfExecutables) && (brokers[b] != NULL_PTR(MemoryMapBroker *)); b++) {
+                const MemoryMapBrokerCopyTableEntry *copyTable = brokers[b]->GetStatelessCopyTable();
+                if (copyTable != NULL_PTR(const MemoryMapBrokerCopyTableEntry *)) {
+                    uint32 numberOfCopies = brokers[b]->GetNumberOfCopies();
+                    for (uint32 n = 0u; n < numberOfCopies; n++) {
+                        //The elements of a strided copy are spread over the DataSourceI memory
+                        uint32 elements = copyTable[n].numberOfElements;
+                        prefetch->ranges[r].address = copyTable[n].dataSourcePointer;
+                        prefetch->ranges[r].size = ((elements - 1u) * copyTable[n].dataSourceStride) + copyTable[n].copySize;
+                        prefetch->ranges[r].forWrite = !isInput[b];
+                        r++;
+                        if (isInput[b]) {
+                            prefetch->ranges[r].address = copyTable[n].gamPointer;
+                            prefetch->ranges[r].size = elements * copyTable[n].copySize;
+                            prefetch->ranges[r].forWrite = true;
+                            r++;
+                        }
+                    }
+                }
+            }
+            if (prefetch->first[e] != r) {
+                numberOfPrefetching++;
+            }
+        }
+    }
+    prefetch->first[numberOfExecutables] = r;
+    thread.prefetch = prefetch;
+    REPORT_ERROR(ErrorManagement::Information, "Thread %s: %d memory ranges prefetched by %d ExecutableIs", thread.name, r, numberOfPrefetching);
+    delete [] brokers;
+    delete [] isInput;
+    return true;
+}
+
+bool GAMSchedulerI::BuildMultiRateSchedule(ReferenceContainer &gams,
+                                           const RealTimeThread &threadElement,
+                                           const uint32 * const gamExecutables,
+                                           ScheduledThread &thread) const {
+    uint32 numberOfGams = gams.Size();
+    //The GAMs with ExecuteOnChange (NULL otherwise)
+    GAM **gamChangeDriven = new GAM*[numberOfGams + 1u];
+    bool build = threadElement.IsMultiRate();
+    for (uint32 k = 0u; k < numberOfGams; k++) {
+        ReferenceT<GAM> gam = gams.Get(k);
+        gamChangeDriven[k] = NULL_PTR(GAM *);
+        if (gam.IsValid()) {
+            if (gam->IsExecuteOnChange()) {
+                gamChangeDriven[k] = gam.operator->();
+                build = true;
+            }
+        }
+    }
+    if ((build) && ((thread.parallel != NULL_PTR(ParallelSchedule *)) || (threadElement.GetNumberOfPipelineStages() > 0u))) {
+        //Only the ExecuteOnChange can get here (the ExecutionDividers are refused by the RealTimeThread)
+        REPORT_ERROR(ErrorManagement::Warning, "Thread %s: ExecuteOnChange is ignored with WorkerCPUs or PipelineStages", thread.name);
+        build = false;
+    }
+    if (!build) {
+        //All the GAMs are executed in every cycle
+        numberOfGams = 0u;
+    }
+    uint32 *gamDivider = new uint32[numberOfGams + 1u];
+    uint32 *gamPhase = new uint32[numberOfGams + 1u];
+    bool *placed = new bool[numberOfGams + 1u];
+    uint32 numberOfUnplaced = 0u;
+    for (uint32 k = 0u; k < numberOfGams; k++) {
+        gamDivider[k] = threadElement.GetExecutionDivider(k);
+        gamPhase[k] = 0u;
+        //The GAMs executed in every cycle add the same load to all the cycles
+        placed[k] = ((gamDivider[k] == 1u) || (threadElement.GetExecutionPhase(k, gamPhase[k])));
+        if (!placed[k]) {
+            numberOfUnplaced++;
+        }
+    }
+    while (numberOfUnplaced > 0u) {
+        //Place the GAM with the most ExecutableIs first
+        uint32 next = numberOfGams;
+        for (uint32 k = 0u; k < numberOfGams; k++) {
+            if (!placed[k]) {
+                if (next == numberOfGams) {
+                    next = k;
+                }
+                else if ((gamExecutables[k + 1u] - gamExecutables[k]) > (gamExecutables[next + 1u] - gamExecutables[next])) {
+                    next = k;
+                }
+                else {
+                    //Keep the heavier
+                }
+            }
+        }
+        //The cost of a phase is the mean number of ExecutableIs of the other divided GAMs executed in the same cycles
+        uint32 divider = gamDivider[next];
+        float64 bestCost = 0.0;
+        for (uint32 p = 0u; p < divider; p++) {
+            float64 cost = 0.0;
+            for (uint32 k = 0u; k < numberOfGams; k++) {
+                if ((placed[k]) && (gamDivider[k] > 1u)) {
+                    uint32 a = divider;
+                    uint32 b = gamDivider[k];
+                    while (b > 0u) {
+                        uint32 r = a % b;
+                        a = b;
+                        b = r;
+                    }
+                    if ((p % a) == (gamPhase[k] % a)) {
+                        cost += (static_cast<float64>(gamExecutables[k + 1u] - gamExecutables[k]) * static_cast<float64>(a))
+                                / static_cast<float64>(gamDivider[k]);
+                    }
+                }
+            }
+            if ((p == 0u) || (cost < bestCost)) {
+                bestCost = cost;
+                gamPhase[next] = p;
+            }
+        }
+        placed[next] = true;
+        numberOfUnplaced--;
+    }
+
+    //The consecutive GAMs with the same divider and phase are executed as a single group
+    bool ret = true;
+    uint32 numberOfGroups = 0u;
+    for (uint32 k = 0u; k < numberOfGams; k++) {
+        bool newGroup = (k == 0u);
+        if (!newGroup) {
+            newGroup = ((gamDivider[k] != gamDivider[k - 1u]) || (gamPhase[k] != gamPhase[k - 1u]) || (gamChangeDriven[k] != NULL_PTR(GAM *))
+                    || (gamChangeDriven[k - 1u] != NULL_PTR(GAM *)));
+        }
+        if (newGroup) {
+            numberOfGroups++;
+        }
+    }
+    MultiRateSchedule *multiRate = NULL_PTR(MultiRateSchedule *);
+    if (numberOfGroups > 0u) {
+        multiRate = new MultiRateSchedule;
+        multiRate->numberOfGroups = numberOfGroups;
+        multiRate->first = new uint32[numberOfGroups + 1u];
+        multiRate->divider = new uint32[numberOfGroups + 1u];
+        multiRate->phase = new uint32[numberOfGroups + 1u];
+        multiRate->countdown = new uint32[numberOfGroups + 1u];
+        multiRate->changeDriven = new GAM*[numberOfGroups + 1u];
+        multiRate->gamExecutable = new uint32[numberOfGroups + 1u];
+    }
+    uint32 g = 0u;
+    for (uint32 k = 0u; (k < numberOfGams) && (ret); k++) {
+        bool newGroup = (k == 0u);
+        if (!newGroup) {
+            newGroup = ((gamDivider[k] != gamDivider[k - 1u]) || (gamPhase[k] != gamPhase[k - 1u]) || (gamChangeDriven[k] != NULL_PTR(GAM *))
+                    || (gamChangeDriven[k - 1u] != NULL_PTR(GAM *)));
+        }
+        if ((newGroup) && (multiRate != NULL_PTR(MultiRateSchedule *))) {
+            multiRate->first[g] = gamExecutables[k];
+            multiRate->divider[g] = gamDivider[k];
+            multiRate->phase[g] = gamPhase[k];
+            multiRate->countdown[g] = gamPhase[k];
+            multiRate->changeDriven[g] = gamChangeDriven[k];
+            multiRate->gamExecutable[g] = gamExecutables[k];
+            if (gamChangeDriven[k] != NULL_PTR(GAM *)) {
+                //The GAM is inserted after its input brokers
+                ReferenceContainer inputBrokers;
+                ret = gamChangeDriven[k]->GetInputBrokers(inputBrokers);
+                multiRate->gamExecutable[g] += inputBrokers.Size();
+                REPORT_ERROR(ErrorManagement::Information, "Thread %s: %s executed when its inputs change", thread.name, gamChangeDriven[k]->GetName());
+            }
+            g++;
+        }
+        if (gamDivider[k] > 1u) {
+            Reference gam = gams.Get(k);
+            if (gam.IsValid()) {
+                REPORT_ERROR(ErrorManagement::Information, "Thread %s: %s executed once every %d cycles with phase %d", thread.name, gam->GetName(),
+                             gamDivider[k], gamPhase[k]);
+            }
+        }
+    }
+    if (multiRate != NULL_PTR(MultiRateSchedule *)) {
+        multiRate->first[numberOfGroups] = gamExecutables[numberOfGams];
+    }
+    thread.multiRate = multiRate;
+    delete [] gamChangeDriven;
+    delete [] gamDivider;
+    delete [] gamPhase;
+    delete [] placed;
     return ret;
 }
 
@@ -463,6 +1288,105 @@ uint32 GAMSchedulerI::GetNumberOfExecutables(const char8 * const stateName,
     return numberOfExecutables;
 }
 
+bool GAMSchedulerI::CheckCycleBudget(CycleBudgetMonitor &monitor,
+                                     const uint64 cycleStartTicks) {
+    uint64 cycleTicks = (HighResolutionTimer::Counter() - cycleStartTicks);
+    monitor.numberOfCycles++;
+    if (cycleTicks > monitor.worstTicks) {
+        monitor.worstTicks = cycleTicks;
+    }
+    bool ok = (cycleTicks <= monitor.budgetTicks);
+    if (ok) {
+        monitor.consecutiveOverruns = 0u;
+    }
+    else {
+        monitor.numberOfOverruns++;
+        monitor.consecutiveOverruns++;
+        if ((monitor.consecutiveOverruns == monitor.messageThreshold) && (overrunMessage.IsValid())) {
+            if (MessageI::SendMessage(overrunMessage, this, overrunMessageDestination) != ErrorManagement::NoError) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to SendMessage.");
+            }
+        }
+    }
+    return ok;
+}
+
+bool GAMSchedulerI::GetCycleBudgetStatistics(const char8 * const stateName,
+                                             const char8 * const threadName,
+                                             CycleBudgetMonitor &statistics) const {
+    bool found = false;
+    if (states != NULL) {
+        for (uint32 i = 0u; (i < numberOfStates) && (!found); i++) {
+            if (StringHelper::Compare(stateName, states[i].name) == 0) {
+                for (uint32 j = 0u; (j < states[i].numberOfThreads) && (!found); j++) {
+                    if (StringHelper::Compare(threadName, states[i].threads[j].name) == 0) {
+                        found = (states[i].threads[j].budgetMonitor != NULL_PTR(CycleBudgetMonitor *));
+                        if (found) {
+                            statistics = *states[i].threads[j].budgetMonitor;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return found;
+}
+
+void GAMSchedulerI::ReportCycleBudgets(const ScheduledState &state) const {
+    for (uint32 t = 0u; t < state.numberOfThreads; t++) {
+        const CycleBudgetMonitor *monitor = state.threads[t].budgetMonitor;
+        if (monitor != NULL_PTR(const CycleBudgetMonitor *)) {
+            if (monitor->numberOfCycles > 0u) {
+                uint32 worst = static_cast<uint32>(HighResolutionTimer::TicksToMicroSeconds(monitor->worstTicks));
+                ErrorManagement::ErrorType level = ErrorManagement::Information;
+                if (monitor->numberOfOverruns > 0u) {
+                    level = ErrorManagement::Warning;
+                }
+                REPORT_ERROR(level, "Thread %s.%s: %d of %d cycles exceeded the budget of %d us (worst %d us)", state.name, state.threads[t].name,
+                             monitor->numberOfOverruns, monitor->numberOfCycles, monitor->budget, worst);
+            }
+        }
+    }
+}
+
+bool GAMSchedulerI::IsOverrunMessage(const Reference &child) const {
+    bool isOverrunMessage = overrunMessage.IsValid();
+    if (isOverrunMessage) {
+        isOverrunMessage = (child == overrunMessage);
+    }
+    return isOverrunMessage;
+}
+
+uint32 GAMSchedulerI::GetNumberOfStates() const {
+    uint32 n = 0u;
+    if (states != NULL_PTR(ScheduledState *)) {
+        n = numberOfStates;
+    }
+    return n;
+}
+
+const ScheduledState *GAMSchedulerI::GetState(const uint32 stateIdx) const {
+    const ScheduledState *state = NULL_PTR(const ScheduledState *);
+    if (stateIdx < GetNumberOfStates()) {
+        state = &states[stateIdx];
+    }
+    return state;
+}
+
+void GAMSchedulerI::BeginCycleProgress(ExecutionProgress * const progress) {
+#ifdef THREAD_LOCAL
+    threadProgress = progress;
+#endif
+    if (progress != NULL_PTR(ExecutionProgress *)) {
+        progress->cycle++;
+    }
+    PublishProgress(0u);
+}
+
+void GAMSchedulerI::EndCycleProgress() {
+    PublishProgress(0u);
+}
+
 ScheduledState * const * GAMSchedulerI::GetSchedulableStates() {
     return scheduledStates;
 
@@ -34,6 +34,8 @@
 
 #include "ExecutableI.h"
 #include "GAM.h"
+#include "Message.h"
+#include "MessageI.h"
 #include "ProcessorType.h"
 #include "ReferenceContainer.h"
 #include "ReferenceT.h"
@@ -46,6 +48,266 @@
 
 namespace MARTe {
 
+class RealTimeThread;
+
+/**
+ * @brief POD to store the parallel execution schedule of a thread (see RealTimeThread WorkerCPUs).
+ * @details The GAMs of the thread are grouped in levels of the dependency graph: the GAMs of a level only depend on
+ * the GAMs of the previous levels. Each level is split in numberOfLanes segments (lane 0 is executed by the thread
+ * itself and lane n by the worker n - 1) and all the lanes shall complete a level before any lane starts the next one.
+ */
+struct ParallelSchedule {
+    /**
+     * The ExecutableI components of the thread, sorted by level and, inside each level, by lane.
+     */
+    ExecutableI ** executables;
+
+    /**
+     * The executables of the level l and lane n are [segments[(l * numberOfLanes) + n], segments[(l * numberOfLanes) + n + 1]).
+     */
+    uint32 *segments;
+
+    /**
+     * The number of levels of the dependency graph.
+     */
+    uint32 numberOfLevels;
+
+    /**
+     * The number of lanes (the thread itself plus the workers).
+     */
+    uint32 numberOfLanes;
+
+    /**
+     * The CPU number of each worker (numberOfLanes - 1 elements).
+     */
+    uint32 *workerCPUs;
+};
+
+/**
+ * @brief POD to store a memory range to be prefetched (see RealTimeThread PrefetchBrokers).
+ */
+struct PrefetchRange {
+    /**
+     * The beginning of the range.
+     */
+    const void *address;
+
+    /**
+     * The size of the range in bytes.
+     */
+    uint32 size;
+
+    /**
+     * True if the range is going to be written, false if it is going to be read.
+     */
+    bool forWrite;
+};
+
+/**
+ * @brief POD to store the memory ranges to be prefetched before each ExecutableI of a thread.
+ * @details Before the ExecutableI e is executed, the ranges [first[e], first[e + 1]) are prefetched. These are the memory areas copied by
+ * the MemoryMapInputBroker and MemoryMapOutputBroker components that follow e, up to the next ExecutableI which is not one of these brokers
+ * (i.e. the output brokers of a GAM and the input brokers of the next GAM), so that their cache misses are served while e executes.
+ */
+struct PrefetchTable {
+    /**
+     * The ranges to be prefetched, sorted by ExecutableI.
+     */
+    PrefetchRange *ranges;
+
+    /**
+     * The index of the first range of each ExecutableI (numberOfExecutables + 1 elements).
+     */
+    uint32 *first;
+};
+
+/**
+ * @brief POD to store the cycle budget of a thread and the statistics of its overruns (see GAMSchedulerI::CheckCycleBudget).
+ * @details The statistics are only written by the thread being monitored and are reset when its state is prepared.
+ */
+struct CycleBudgetMonitor {
+    /**
+     * The maximum execution time of a cycle in HighResolutionTimer ticks.
+     */
+    uint64 budgetTicks;
+
+    /**
+     * The maximum execution time of a cycle in micro-seconds.
+     */
+    uint32 budget;
+
+    /**
+     * The number of consecutive overruns after which the OverrunMessage is sent (0 if never sent).
+     */
+    uint32 messageThreshold;
+
+    /**
+     * The number of cycles monitored.
+     */
+    uint64 numberOfCycles;
+
+    /**
+     * The number of cycles which exceeded the budget.
+     */
+    uint64 numberOfOverruns;
+
+    /**
+     * The number of consecutive cycles which exceeded the budget, up to the last one.
+     */
+    uint32 consecutiveOverruns;
+
+    /**
+     * The longest execution time of a cycle in HighResolutionTimer ticks.
+     */
+    uint64 worstTicks;
+};
+
+/**
+ * @brief POD to store the progress of a thread, published by the thread while it executes its cycles and sampled by
+ * a watchdog (see ExecutionWatchdog).
+ * @details The word holds the cycle counter in the upper 32 bits and the index (plus one) of the ExecutableI being executed
+ * in the lower 32 bits (0 while the thread is outside its ExecutableIs, e.g. waiting for the next release). It is written
+ * with a relaxed store before each ExecutableI, only by the thread, and the structure is padded so that it does not share a
+ * cache line with the data of the thread.
+ */
+struct ExecutionProgress {
+    /**
+     * The cycle counter and the index of the ExecutableI being executed.
+     */
+    volatile int64 word;
+
+    /**
+     * The cycle counter (only accessed by the thread).
+     */
+    uint32 cycle;
+
+    /**
+     * Keeps the word of consecutive threads in different cache lines.
+     */
+    uint8 padding[64];
+};
+
+/**
+ * @brief POD to store an operation of a FlatCycle.
+ * @details If executable is NULL the operation copies size bytes from source to destination, otherwise it calls executable->Execute().
+ * If timingSignal is not NULL, the time elapsed since the beginning of the cycle is written in timingSignal after the operation
+ * (and added to the histogram, if not NULL).
+ */
+struct FlatCycleOperation {
+    /**
+     * The ExecutableI to be executed (NULL for a copy).
+     */
+    ExecutableI *executable;
+
+    /**
+     * The destination of the copy.
+     */
+    void *destination;
+
+    /**
+     * The source of the copy.
+     */
+    const void *source;
+
+    /**
+     * The number of bytes to copy.
+     */
+    uint32 size;
+
+    /**
+     * The MemoryOperationsHelper::CopyTagged tag of the copy.
+     */
+    uint32 fixedSize;
+
+    /**
+     * Memory address where the execution time is stored after the operation (NULL if not stored).
+     */
+    uint32 *timingSignal;
+
+    /**
+     * Histogram of the execution time (may be NULL).
+     */
+    LatencyHistogram *histogram;
+
+    /**
+     * The memory ranges to be prefetched before the executable is executed (see PrefetchTable).
+     */
+    const PrefetchRange *prefetch;
+
+    /**
+     * The number of memory ranges to be prefetched.
+     */
+    uint32 numberOfPrefetches;
+
+    /**
+     * The index of the ExecutableI from which the operation was built (see ExecutionProgress).
+     */
+    uint32 executableIndex;
+};
+
+/**
+ * @brief POD to store the flattened cycle of a thread (see GAMSchedulerI FlattenCycles).
+ * @details The copies of the consecutive MemoryMapInputBroker and MemoryMapOutputBroker components are merged in a single
+ * sequence of copy operations, which are executed without calling the brokers, and the timing signal addresses are cached
+ * in the operations. The execution time of a sequence of brokers which write the same timing signal (e.g. all the input
+ * brokers of a GAM) is only stored after the last one (which is the value that the sequential execution leaves in the signal).
+ */
+struct FlatCycle {
+    /**
+     * The operations, in the execution order.
+     */
+    FlatCycleOperation *operations;
+
+    /**
+     * The number of operations.
+     */
+    uint32 numberOfOperations;
+};
+
+/**
+ * @brief POD to store the execution rates of the GAMs of a thread (see RealTimeThread ExecutionDividers and GAM ExecuteOnChange).
+ * @details The ExecutableIs of the thread are split in groups of consecutive GAMs (each with its input and output brokers) with the same
+ * divider and phase. The group g is executed in the cycles c with (c % divider[g]) == phase[g] and is skipped in the other cycles.
+ * A GAM with ExecuteOnChange is alone in its group: its input brokers are executed and then the GAM and its output brokers are
+ * only executed if GAM::InputsChanged.
+ */
+struct MultiRateSchedule {
+    /**
+     * The ExecutableIs of the group g are [first[g], first[g + 1]) (numberOfGroups + 1 elements).
+     */
+    uint32 *first;
+
+    /**
+     * The number of cycles between two executions of each group.
+     */
+    uint32 *divider;
+
+    /**
+     * The cycle (modulo the divider) in which each group is executed.
+     */
+    uint32 *phase;
+
+    /**
+     * The number of cycles before the next execution of each group (only written by the thread, reset to the phase when the state is prepared).
+     */
+    uint32 *countdown;
+
+    /**
+     * The GAM of each group which is only executed when its inputs change (NULL if the group is always executed).
+     */
+    GAM **changeDriven;
+
+    /**
+     * The index of the ExecutableI of the changeDriven GAM (i.e. after its input brokers) of each group.
+     */
+    uint32 *gamExecutable;
+
+    /**
+     * The number of groups.
+     */
+    uint32 numberOfGroups;
+};
+
 /**
  * @brief POD to store information about a thread that is schedulable by a GAMSchedulerI.
  */
@@ -65,6 +327,31 @@ struct ScheduledThread {
      */
     uint32 *cycleTime;
 
+    /**
+     * Histogram of the total cycle time (NULL if the TimingDataSource has no histograms).
+     */
+    LatencyHistogram *cycleTimeHistogram;
+
+    /**
+     * Memory address where the release lateness signal is stored (NULL if the thread is not periodically released).
+     */
+    uint32 *lateness;
+
+    /**
+     * The absolute-deadline release period in micro-seconds (0 if the thread is not periodically released).
+     */
+    uint32 period;
+
+    /**
+     * The release offset in micro-seconds.
+     */
+    uint32 phase;
+
+    /**
+     * The time in micro-seconds before each release that is spent busy waiting.
+     */
+    uint32 busyWaitTail;
+
     /**
      * The cpus where is possible to run the thread
      */
@@ -75,6 +362,61 @@ struct ScheduledThread {
      */
     uint32 stackSize;
 
+    /**
+     * The number of stack bytes to prefault when the thread starts
+     */
+    uint32 prefaultStackSize;
+
+    /**
+     * The SCHED_DEADLINE runtime in micro-seconds
+     */
+    uint32 deadlineRuntime;
+
+    /**
+     * The SCHED_DEADLINE relative deadline in micro-seconds
+     */
+    uint32 deadlineDeadline;
+
+    /**
+     * The SCHED_DEADLINE period in micro-seconds (0 if the thread is not scheduled with a deadline policy)
+     */
+    uint32 deadlinePeriod;
+
+    /**
+     * The parallel execution schedule (NULL if the GAMs are executed sequentially).
+     */
+    ParallelSchedule *parallel;
+
+    /**
+     * The flattened cycle (NULL if the ExecutableIs are executed with ExecuteSingleCycle).
+     */
+    FlatCycle *flat;
+
+    /**
+     * The execution rates of the GAMs (NULL if all the GAMs are executed in every cycle).
+     */
+    MultiRateSchedule *multiRate;
+
+    /**
+     * The memory ranges to be prefetched before each ExecutableI (NULL if RealTimeThread PrefetchBrokers is not set).
+     */
+    PrefetchTable *prefetch;
+
+    /**
+     * The cycle budget and the overrun statistics (NULL if RealTimeThread CycleBudget is not set).
+     */
+    CycleBudgetMonitor *budgetMonitor;
+
+    /**
+     * The identifier of the name (STATE_NAME.THREAD_NAME) with which the cycles are traced (see Trace).
+     */
+    uint32 traceNameId;
+
+    /**
+     * The progress of the thread (see ExecutionProgress).
+     */
+    ExecutionProgress *progress;
+
     /**
      * This thread name.
      */
@@ -113,8 +455,16 @@ struct ScheduledState {
  *    Class = Scheduler_name
  *     ...\n
  *    TimingDataSource = "Name of the TimingDataSource"
+ *    FlattenCycles = 0|1 //Optional. Default = 0. If 1 the cycles of the threads without WorkerCPUs (nor ExecutionDividers) are executed from a FlatCycle (see ExecuteFlatCycle).
+ *    RealTimeHeapCheck = 100 //Optional. If set, the allocations and frees made by the real-time threads after their first RealTimeHeapCheck cycles are detected (see HeapManager::SetRealTimeCheck).
+ *    +OverrunMessage = { //Optional. Sent when a thread exceeds its CycleBudget (see RealTimeThread) OverrunMessageThreshold consecutive times.
+ *        Class = Message
+ *        ...
+ *    }
  * }\n
  *
+ * The overrun statistics of each thread with a CycleBudget are reported when its state is left (see PrepareNextState).
+ *
  * and it has to be contained in the [RealTimeApplication] declaration.
  */
 class DLL_API GAMSchedulerI: public ReferenceContainer, public StatefulI {
@@ -148,6 +498,7 @@ public:
 
     /**
      * @brief Stores the GAMSchedulerRecord for the new state in the next buffer.
+     * @details Also reports the overrun statistics of the threads of the current state and resets the ones of the next state.
      * @param[in] currentStateName is the name of the current state
      * @param[in] nextStateName is the name of the next state
      * @return true if the next state name is found, false otherwise.
@@ -161,6 +512,59 @@ public:
      */
     bool ExecuteSingleCycle(ExecutableI * const * const executables, const uint32 numberOfExecutables) const;
 
+    /**
+     * @brief Executes a list of ExecutableIs storing their execution times with respect to a given start time instant.
+     * @param[in] executables the list of ExecutablesIs to be executed
+     * @param[in] numberOfExecutables how many ExecutableIs have to be executed.
+     * @param[in] cycleStartTicks the HighResolutionTimer::Counter at the beginning of the cycle.
+     */
+    bool ExecuteSingleCycle(ExecutableI * const * const executables, const uint32 numberOfExecutables, const uint64 cycleStartTicks) const;
+
+    /**
+     * @brief Executes a list of ExecutableIs storing their execution times with respect to a given start time instant and prefetching
+     * before each ExecutableI the memory of the brokers that follow it.
+     * @details The hardware performance counters of the calling thread are read around the ExecutableIs with
+     * ExecutableI::GetPerformanceCounters() != NULL (see TimingDataSource PerformanceCounters).
+     * @param[in] executables the list of ExecutablesIs to be executed
+     * @param[in] numberOfExecutables how many ExecutableIs have to be executed.
+     * @param[in] cycleStartTicks the HighResolutionTimer::Counter at the beginning of the cycle.
+     * @param[in] prefetch the memory ranges to be prefetched before each ExecutableI (NULL for no prefetching).
+     */
+    bool ExecuteSingleCycle(ExecutableI * const * const executables, const uint32 numberOfExecutables, const uint64 cycleStartTicks,
+                            const PrefetchTable * const prefetch) const;
+
+    /**
+     * @brief Executes the segment of a level of a ParallelSchedule that belongs to a lane.
+     * @param[in] schedule the parallel schedule of the thread.
+     * @param[in] level the level of the dependency graph.
+     * @param[in] lane the lane (0 for the thread itself, n for the worker n - 1).
+     * @param[in] cycleStartTicks the HighResolutionTimer::Counter at the beginning of the cycle.
+     * @return true if all the ExecutableIs of the segment are successfully executed.
+     */
+    bool ExecuteParallelSegment(const ParallelSchedule &schedule, const uint32 level, const uint32 lane, const uint64 cycleStartTicks) const;
+
+    /**
+     * @brief Executes the operations of a FlatCycle storing their execution times with respect to the start time instant.
+     * @details Equivalent to ExecuteSingleCycle on the ExecutableIs from which the FlatCycle was built, but the merged
+     * MemoryMapBroker copies are executed in a single loop, without virtual calls.
+     * @param[in] cycle the flattened cycle of the thread.
+     * @return true if all the operations are successfully executed.
+     */
+    bool ExecuteFlatCycle(const FlatCycle &cycle) const;
+
+    /**
+     * @brief Executes the groups of a MultiRateSchedule which are due in this cycle and counts down the cycles of the others.
+     * @details The ExecutableIs of the skipped groups (and the GAMs with ExecuteOnChange whose inputs did not change, together with
+     * their output brokers) are not called and their timing signals keep the values of their last execution.
+     * @param[in] executables the ExecutableIs of the thread.
+     * @param[in,out] schedule the execution rates of the thread.
+     * @param[in] cycleStartTicks the HighResolutionTimer::Counter at the beginning of the cycle.
+     * @param[in] prefetch the memory ranges to be prefetched before each ExecutableI (NULL for no prefetching).
+     * @return true if all the executed ExecutableIs are successfully executed.
+     */
+    bool ExecuteMultiRateCycle(ExecutableI * const * const executables, MultiRateSchedule &schedule, const uint64 cycleStartTicks,
+                               const PrefetchTable * const prefetch) const;
+
     /**
      * @brief Gets the number of ExecutableI components for this \a threadName in this \a stateName.
      * @param[in] stateName the name of the state.
@@ -169,6 +573,39 @@ public:
      */
     uint32 GetNumberOfExecutables(const char8 * const stateName, const char8 * const threadName) const;
 
+    /**
+     * @brief Checks the execution time of a cycle against the budget of the thread and updates the overrun statistics.
+     * @details To be called by the thread at the end of each cycle. The check is an integer comparison of HighResolutionTimer
+     * ticks and nothing is allocated: when the number of consecutive overruns reaches the threshold the pre-built OverrunMessage
+     * (if defined) is sent to its destination, which is resolved before the state starts.
+     * @param[in,out] monitor the budget and the statistics of the thread.
+     * @param[in] cycleStartTicks the HighResolutionTimer counter at the beginning of the cycle.
+     * @return true if the cycle did not exceed the budget.
+     */
+    bool CheckCycleBudget(CycleBudgetMonitor &monitor, const uint64 cycleStartTicks);
+
+    /**
+     * @brief Gets the overrun statistics of a thread.
+     * @param[in] stateName the name of the state.
+     * @param[in] threadName the name of the thread.
+     * @param[out] statistics a copy of the budget and of the statistics of the thread.
+     * @return true if the thread exists and has a CycleBudget.
+     */
+    bool GetCycleBudgetStatistics(const char8 * const stateName, const char8 * const threadName, CycleBudgetMonitor &statistics) const;
+
+    /**
+     * @brief Gets the number of states which can be executed by this GAMSchedulerI.
+     * @return the number of states (0 before ConfigureScheduler).
+     */
+    uint32 GetNumberOfStates() const;
+
+    /**
+     * @brief Gets the schedule of a state (e.g. to sample the ExecutionProgress of its threads).
+     * @param[in] stateIdx the index of the state (< GetNumberOfStates()).
+     * @return the schedule of the state or NULL if \a stateIdx is not valid.
+     */
+    const ScheduledState *GetState(const uint32 stateIdx) const;
+
     /**
      * @brief Starts the execution of the next state threads.
      * @pre
@@ -200,6 +637,18 @@ protected:
      */
     virtual void CustomPrepareNextState()=0;
 
+    /**
+     * @brief Starts a cycle of the calling thread: increments the cycle counter of \a progress and publishes, until EndCycleProgress,
+     * the ExecutableI executed by ExecuteSingleCycle, ExecuteFlatCycle and ExecuteMultiRateCycle in \a progress.
+     * @param[in] progress the progress of the calling thread (NULL not to publish the progress).
+     */
+    static void BeginCycleProgress(ExecutionProgress * const progress);
+
+    /**
+     * @brief Ends the cycle of the calling thread (publishes that the thread is outside its ExecutableIs).
+     */
+    static void EndCycleProgress();
+
     /**
      * Clock period
      */
@@ -277,6 +726,102 @@ protected:
      */
     bool InsertGAM(ReferenceT<GAM> gam, const char8 * const gamFullName, const uint32 stateIdx, const uint32 threadIdx, const uint32 executableIdx) const;
 
+    /**
+     * @brief Helper function to compute the ParallelSchedule of a thread.
+     * @details Two GAMs depend on each other if one writes a signal which is read or written by the other, or if both use the same
+     * DataSourceI which is not a GAMDataSource (whose brokers might not be safe to execute concurrently). A GAM depends on the GAMs that
+     * precede it in the Functions list, so that the values read and written are the same as in the sequential execution.
+     * The GAMs of each level are assigned to the lane with the least number of ExecutableIs.
+     * @param[in] gams the GAMs of the thread, in the execution order.
+     * @param[in] gamExecutables the index of the first ExecutableI of each GAM (numberOfGAMs + 1 elements).
+     * @param[in] workerCPUs the CPU numbers of the workers.
+     * @param[in] numberOfWorkers the number of workers.
+     * @param[in,out] thread the thread, whose executables are already inserted.
+     * @return true if the ParallelSchedule can be computed.
+     */
+    bool BuildParallelSchedule(ReferenceContainer &gams, const uint32 * const gamExecutables, const uint32 * const workerCPUs, const uint32 numberOfWorkers,
+                               ScheduledThread &thread) const;
+
+    /**
+     * @brief Helper function to compute the FlatCycle of a thread.
+     * @details Only the brokers whose class is exactly MemoryMapInputBroker or MemoryMapOutputBroker (derived classes add
+     * behaviour to Execute), whose DataSourceI has a single stateful memory buffer and which have no strided copies are merged.
+     * @param[in,out] thread the thread, whose executables are already inserted.
+     * @return true if the FlatCycle can be computed.
+     */
+    bool BuildFlatCycle(ScheduledThread &thread) const;
+
+    /**
+     * @brief Helper function to compute the MultiRateSchedule of a thread (only if any of its GAMs has an ExecutionDivider or ExecuteOnChange
+     * and the thread has neither WorkerCPUs nor PipelineStages).
+     * @details The GAMs without an ExecutionPhase are placed, the ones with more ExecutableIs first, in the phase which minimises the
+     * number of ExecutableIs of the other divided GAMs which are executed in the same cycles (two GAMs with dividers d1 and d2 are executed
+     * in the same cycles iff their phases are equal modulo gcd(d1, d2)), so that the cycle load is spread as evenly as possible.
+     * @param[in] gams the GAMs of the thread, in the execution order.
+     * @param[in] threadElement the RealTimeThread, with the ExecutionDividers and the ExecutionPhases of its GAMs.
+     * @param[in] gamExecutables the index of the first ExecutableI of each GAM (numberOfGAMs + 1 elements).
+     * @param[in,out] thread the thread, whose executables are already inserted.
+     * @return true if the MultiRateSchedule can be computed.
+     */
+    bool BuildMultiRateSchedule(ReferenceContainer &gams, const RealTimeThread &threadElement, const uint32 * const gamExecutables,
+                                ScheduledThread &thread) const;
+
+    /**
+     * @brief Executes the ExecutableIs [first, last) of a thread (see ExecuteSingleCycle).
+     * @param[in] executables the ExecutableIs of the thread.
+     * @param[in] first the index of the first ExecutableI to be executed.
+     * @param[in] last the index after the last ExecutableI to be executed.
+     * @param[in] cycleStartTicks the HighResolutionTimer::Counter at the beginning of the cycle.
+     * @param[in] prefetch the memory ranges to be prefetched before each ExecutableI of the thread (NULL for no prefetching).
+     * @return true if all the ExecutableIs are successfully executed.
+     */
+    bool ExecuteExecutables(ExecutableI * const * const executables, const uint32 first, const uint32 last, const uint64 cycleStartTicks,
+                            const PrefetchTable * const prefetch) const;
+
+    /**
+     * @brief Helper function to compute the PrefetchTable of a thread.
+     * @details Only the copies of the MemoryMapInputBroker and MemoryMapOutputBroker (and derived) components whose DataSourceI has a single
+     * stateful memory buffer are prefetched: the DataSourceI memory is prefetched for read (input) or write (output) and the GAM memory
+     * of the input brokers for write.
+     * @param[in,out] thread the thread, whose executables are already inserted.
+     * @return true if the PrefetchTable can be computed.
+     */
+    bool BuildPrefetchTable(ScheduledThread &thread) const;
+
+    /**
+     * @brief Reports the failure of an ExecutableI.
+     * @param[in] executable the ExecutableI that failed.
+     */
+    void ReportExecutableFailure(ExecutableI * const executable) const;
+
+    /**
+     * @brief Checks if a child of the scheduler is the OverrunMessage (so that the derived schedulers do not take it as their ErrorMessage).
+     * @param[in] child the child to check.
+     * @return true if \a child is the OverrunMessage.
+     */
+    bool IsOverrunMessage(const Reference &child) const;
+
+    /**
+     * @brief Reports the overrun statistics of the threads of a state.
+     * @param[in] state the state.
+     */
+    void ReportCycleBudgets(const ScheduledState &state) const;
+
+    /**
+     * True if the cycles of the threads without WorkerCPUs are to be flattened.
+     */
+    bool flattenCycles;
+
+    /**
+     * The message sent when a thread overruns its cycle budget.
+     */
+    ReferenceT<Message> overrunMessage;
+
+    /**
+     * The destination of the overrunMessage, resolved before each state starts.
+     */
+    ReferenceT<MessageI> overrunMessageDestination;
+
 };
 
 }
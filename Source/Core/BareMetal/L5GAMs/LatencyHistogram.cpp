@@ -0,0 +1,241 @@
+/**
+ * @file LatencyHistogram.cpp
+ * @brief Source file for Source file for class LatencyHistogram
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LatencyHistogram (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "LatencyHistogram.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The tracked percentiles are percentileNumerators[k] / percentileDenominators[k], i.e. p50, p99 and p99.9.
+ */
+static const uint32 percentileNumerators[LATENCY_HISTOGRAM_NUMBER_OF_PERCENTILES] = { 1u, 99u, 999u };
+
+/**
+ * See percentileNumerators.
+ */
+static const uint32 percentileDenominators[LATENCY_HISTOGRAM_NUMBER_OF_PERCENTILES] = { 2u, 100u, 1000u };
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+LatencyHistogram::LatencyHistogram() {
+    uint32 i;
+    for (i = 0u; i < LATENCY_HISTOGRAM_NUMBER_OF_BUCKETS; i++) {
+        counts[i] = 0u;
+    }
+    for (i = 0u; i < LATENCY_HISTOGRAM_NUMBER_OF_PERCENTILES; i++) {
+        cursors[i] = 0u;
+        below[i] = 0u;
+        targetFloor[i] = 0u;
+        targetRemainder[i] = 0u;
+        percentileOutputs[i] = NULL_PTR(uint32 *);
+    }
+    total = 0u;
+    max = 0u;
+    maxOutput = NULL_PTR(uint32 *);
+}
+
+/*lint -e{1540} the outputs are owned by the caller of SetOutputs.*/
+LatencyHistogram::~LatencyHistogram() {
+}
+
+void LatencyHistogram::Add(const uint32 value) {
+    uint32 bucket = GetBucket(value);
+    counts[bucket]++;
+    total++;
+    if (value > max) {
+        max = value;
+    }
+    for (uint32 k = 0u; k < LATENCY_HISTOGRAM_NUMBER_OF_PERCENTILES; k++) {
+        //target = ceil(total * percentile), updated without divisions
+        targetRemainder[k] += percentileNumerators[k];
+        if (targetRemainder[k] >= percentileDenominators[k]) {
+            targetRemainder[k] -= percentileDenominators[k];
+            targetFloor[k]++;
+        }
+        uint64 target = targetFloor[k];
+        if (targetRemainder[k] > 0u) {
+            target++;
+        }
+        uint32 cursor = cursors[k];
+        if (bucket < cursor) {
+            below[k]++;
+        }
+        //the cursor is the first bucket where the cumulative count reaches the target
+        while ((cursor > 0u) && (below[k] >= target)) {
+            cursor--;
+            below[k] -= counts[cursor];
+        }
+        while ((below[k] + counts[cursor]) < target) {
+            below[k] += counts[cursor];
+            cursor++;
+        }
+        cursors[k] = cursor;
+        if (percentileOutputs[k] != NULL_PTR(uint32 *)) {
+            *percentileOutputs[k] = GetBucketValue(cursor);
+        }
+    }
+    if (maxOutput != NULL_PTR(uint32 *)) {
+        *maxOutput = max;
+    }
+}
+
+void LatencyHistogram::SetOutputs(uint32 * const p50In,
+                                  uint32 * const p99In,
+                                  uint32 * const p999In,
+                                  uint32 * const maxIn) {
+    percentileOutputs[0u] = p50In;
+    percentileOutputs[1u] = p99In;
+    percentileOutputs[2u] = p999In;
+    maxOutput = maxIn;
+}
+
+uint64 LatencyHistogram::GetCount() const {
+    return total;
+}
+
+uint32 LatencyHistogram::GetMax() const {
+    return max;
+}
+
+uint32 LatencyHistogram::GetPercentile(const float64 percentile) const {
+    uint32 ret = 0u;
+    uint64 n = total;
+    if (n > 0u) {
+        float64 targetF = (static_cast<float64>(n) * percentile) / 100.0;
+        uint64 target = static_cast<uint64>(targetF);
+        if (static_cast<float64>(target) < targetF) {
+            target++;
+        }
+        if (target < 1u) {
+            target = 1u;
+        }
+        uint64 cumulative = 0u;
+        uint32 bucket = 0u;
+        bool found = false;
+        while ((!found) && (bucket < LATENCY_HISTOGRAM_NUMBER_OF_BUCKETS)) {
+            cumulative += counts[bucket];
+            found = (cumulative >= target);
+            if (!found) {
+                bucket++;
+            }
+        }
+        if (found) {
+            ret = GetBucketValue(bucket);
+        }
+        else {
+            ret = max;
+        }
+    }
+    return ret;
+}
+
+uint32 LatencyHistogram::GetP50() const {
+    return (total > 0u) ? (GetBucketValue(cursors[0u])) : (0u);
+}
+
+uint32 LatencyHistogram::GetP99() const {
+    return (total > 0u) ? (GetBucketValue(cursors[1u])) : (0u);
+}
+
+uint32 LatencyHistogram::GetP999() const {
+    return (total > 0u) ? (GetBucketValue(cursors[2u])) : (0u);
+}
+
+uint64 LatencyHistogram::GetBucketCount(const uint32 bucket) const {
+    uint64 ret = 0u;
+    if (bucket < LATENCY_HISTOGRAM_NUMBER_OF_BUCKETS) {
+        ret = counts[bucket];
+    }
+    return ret;
+}
+
+bool LatencyHistogram::Export(StructuredDataI &data) const {
+    bool ret = data.Write("Count", GetCount());
+    if (ret) {
+        ret = data.Write("P50", GetP50());
+    }
+    if (ret) {
+        ret = data.Write("P99", GetP99());
+    }
+    if (ret) {
+        ret = data.Write("P999", GetP999());
+    }
+    if (ret) {
+        ret = data.Write("Max", GetMax());
+    }
+    return ret;
+}
+
+void LatencyHistogram::Report(const char8 * const name,
+                              const char8 * const unit) const {
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "%s (%s): Count = %u P50 = %u P99 = %u P999 = %u Max = %u", name, unit, GetCount(), GetP50(),
+                        GetP99(), GetP999(), GetMax());
+    uint32 bucket;
+    for (bucket = 0u; bucket < LATENCY_HISTOGRAM_NUMBER_OF_BUCKETS; bucket++) {
+        uint64 count = counts[bucket];
+        if (count > 0u) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "%s <= %u %s: %u", name, GetBucketUpperBound(bucket), unit, count);
+        }
+    }
+}
+
+uint32 LatencyHistogram::GetBucketUpperBound(const uint32 bucket) {
+    uint32 ret = bucket;
+    if (bucket >= LATENCY_HISTOGRAM_SUB_BUCKETS) {
+        uint32 octave = bucket / LATENCY_HISTOGRAM_SUB_BUCKETS;
+        uint32 subBucket = bucket % LATENCY_HISTOGRAM_SUB_BUCKETS;
+        uint32 lowerBound = (LATENCY_HISTOGRAM_SUB_BUCKETS + subBucket) << (octave - 1u);
+        ret = lowerBound + ((1u << (octave - 1u)) - 1u);
+    }
+    return ret;
+}
+
+uint32 LatencyHistogram::GetBucketValue(const uint32 bucket) const {
+    uint32 ret = GetBucketUpperBound(bucket);
+    uint32 maxValue = max;
+    if (ret > maxValue) {
+        ret = maxValue;
+    }
+    return ret;
+}
+
+}
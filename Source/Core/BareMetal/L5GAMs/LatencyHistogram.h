@@ -0,0 +1,266 @@
+/**
+ * @file LatencyHistogram.h
+ * @brief Header file for Header file for class LatencyHistogram
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class LatencyHistogram
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LATENCYHISTOGRAM_H_
+#define LATENCYHISTOGRAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "GeneralDefinitions.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Number of bits of a value (after the most significant one) that select the
+ * bucket inside an octave, i.e. each power of two is split in 8 buckets.
+ */
+static const uint32 LATENCY_HISTOGRAM_SUB_BUCKET_BITS = 3u;
+
+/**
+ * Number of buckets per octave.
+ */
+static const uint32 LATENCY_HISTOGRAM_SUB_BUCKETS = (1u << LATENCY_HISTOGRAM_SUB_BUCKET_BITS);
+
+/**
+ * Total number of buckets needed to cover the uint32 range.
+ */
+static const uint32 LATENCY_HISTOGRAM_NUMBER_OF_BUCKETS = ((32u - LATENCY_HISTOGRAM_SUB_BUCKET_BITS) + 1u) * LATENCY_HISTOGRAM_SUB_BUCKETS;
+
+/**
+ * Number of percentiles that are tracked while samples are added.
+ */
+static const uint32 LATENCY_HISTOGRAM_NUMBER_OF_PERCENTILES = 3u;
+
+/**
+ * @brief Fixed-bucket log-linear histogram of uint32 latencies.
+ * @details Values smaller than 8 have a bucket each; every following power of
+ * two is split in 8 linear buckets, so that the relative resolution is always
+ * better than 12.5% and the whole uint32 range is covered by 240 buckets.
+ *
+ * The histogram is designed to be updated by a single real-time thread (see Add)
+ * and read, without locks, by any other thread. Reads are not atomic w.r.t. the
+ * whole histogram but each counter is.
+ *
+ * The p50, p99 and p99.9 percentiles are tracked while the samples are added, by
+ * moving a cursor by the buckets that are crossed since the previous sample
+ * (amortised constant time). Together with the maximum they can optionally be
+ * written, after every Add, to user memory locations (see SetOutputs).
+ * The returned percentile is the upper bound of the bucket where it falls,
+ * limited to the maximum.
+ */
+class DLL_API LatencyHistogram {
+public:
+    /**
+     * @brief Constructor. Sets all the counters to zero.
+     */
+    LatencyHistogram();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~LatencyHistogram();
+
+    /**
+     * @brief Adds a sample.
+     * @details Updates the bucket counter, the maximum, the tracked percentiles and
+     * writes their value to the outputs (if set).
+     * @param[in] value the sample to add.
+     * @pre only one thread calls this method.
+     */
+    void Add(const uint32 value);
+
+    /**
+     * @brief Sets the memory where the percentiles and the maximum are written after each Add.
+     * @param[in] p50In where to write the p50 (may be NULL).
+     * @param[in] p99In where to write the p99 (may be NULL).
+     * @param[in] p999In where to write the p99.9 (may be NULL).
+     * @param[in] maxIn where to write the maximum (may be NULL).
+     */
+    void SetOutputs(uint32 * const p50In,
+                    uint32 * const p99In,
+                    uint32 * const p999In,
+                    uint32 * const maxIn);
+
+    /**
+     * @brief Gets the number of samples added.
+     * @return the number of samples added.
+     */
+    uint64 GetCount() const;
+
+    /**
+     * @brief Gets the largest sample added.
+     * @return the largest sample added.
+     */
+    uint32 GetMax() const;
+
+    /**
+     * @brief Computes any percentile by walking the buckets.
+     * @details Not to be called from the real-time thread, as the cost is linear with the number of buckets.
+     * @param[in] percentile the percentile \in [0, 100].
+     * @return the upper bound of the bucket where the percentile falls (limited to the maximum), or 0 if there are no samples.
+     */
+    uint32 GetPercentile(const float64 percentile) const;
+
+    /**
+     * @brief Gets the tracked p50.
+     * @return the tracked p50.
+     */
+    uint32 GetP50() const;
+
+    /**
+     * @brief Gets the tracked p99.
+     * @return the tracked p99.
+     */
+    uint32 GetP99() const;
+
+    /**
+     * @brief Gets the tracked p99.9.
+     * @return the tracked p99.9.
+     */
+    uint32 GetP999() const;
+
+    /**
+     * @brief Gets the number of samples counted in a bucket.
+     * @param[in] bucket the bucket index.
+     * @return the number of samples counted in \a bucket (0 if \a bucket is not valid).
+     */
+    uint64 GetBucketCount(const uint32 bucket) const;
+
+    /**
+     * @brief Writes the Count, P50, P99, P999 and Max in the current node of \a data.
+     * @param[out] data where to write the statistics.
+     * @return true if all the statistics could be written.
+     */
+    bool Export(StructuredDataI &data) const;
+
+    /**
+     * @brief Reports (as ErrorManagement::Information) the statistics and the count of every non-empty bucket.
+     * @details Not to be called from the real-time thread. Meant to dump the histogram when a measurement is over.
+     * @param[in] name the name of the measurement (prefix of every line).
+     * @param[in] unit the unit of the samples.
+     */
+    void Report(const char8 * const name,
+                const char8 * const unit) const;
+
+    /**
+     * @brief Gets the bucket where a value is counted.
+     * @param[in] value the value.
+     * @return the bucket index \in [0, LATENCY_HISTOGRAM_NUMBER_OF_BUCKETS[.
+     */
+    static inline uint32 GetBucket(const uint32 value);
+
+    /**
+     * @brief Gets the largest value counted in a bucket.
+     * @param[in] bucket the bucket index.
+     * @return the largest value counted in \a bucket.
+     */
+    static uint32 GetBucketUpperBound(const uint32 bucket);
+
+private:
+
+    /**
+     * @brief Gets the upper bound of a bucket limited to the maximum.
+     * @param[in] bucket the bucket index.
+     * @return the smallest between the bucket upper bound and the maximum.
+     */
+    uint32 GetBucketValue(const uint32 bucket) const;
+
+    /**
+     * The bucket counters.
+     */
+    volatile uint64 counts[LATENCY_HISTOGRAM_NUMBER_OF_BUCKETS];
+
+    /**
+     * Number of samples added.
+     */
+    volatile uint64 total;
+
+    /**
+     * The largest sample.
+     */
+    volatile uint32 max;
+
+    /**
+     * Bucket where each tracked percentile currently falls.
+     */
+    volatile uint32 cursors[LATENCY_HISTOGRAM_NUMBER_OF_PERCENTILES];
+
+    /**
+     * For each tracked percentile, the number of samples in the buckets below its cursor.
+     */
+    uint64 below[LATENCY_HISTOGRAM_NUMBER_OF_PERCENTILES];
+
+    /**
+     * For each tracked percentile, floor(total * percentile).
+     */
+    uint64 targetFloor[LATENCY_HISTOGRAM_NUMBER_OF_PERCENTILES];
+
+    /**
+     * For each tracked percentile, the remainder of targetFloor (so that no division is needed in Add).
+     */
+    uint32 targetRemainder[LATENCY_HISTOGRAM_NUMBER_OF_PERCENTILES];
+
+    /**
+     * Where to write each tracked percentile.
+     */
+    uint32 *percentileOutputs[LATENCY_HISTOGRAM_NUMBER_OF_PERCENTILES];
+
+    /**
+     * Where to write the maximum.
+     */
+    uint32 *maxOutput;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+uint32 LatencyHistogram::GetBucket(const uint32 value) {
+    uint32 bucket = value;
+    if (value >= LATENCY_HISTOGRAM_SUB_BUCKETS) {
+        /*lint -e{9119} __builtin_clz of a non-zero value is in [0, 28]*/
+        uint32 msb = 31u - static_cast<uint32>(__builtin_clz(value));
+        uint32 octave = (msb - LATENCY_HISTOGRAM_SUB_BUCKET_BITS) + 1u;
+        uint32 subBucket = (value >> (msb - LATENCY_HISTOGRAM_SUB_BUCKET_BITS)) & (LATENCY_HISTOGRAM_SUB_BUCKETS - 1u);
+        bucket = (octave * LATENCY_HISTOGRAM_SUB_BUCKETS) + subBucket;
+    }
+    return bucket;
+}
+
+}
+
+#endif /* LATENCYHISTOGRAM_H_ */
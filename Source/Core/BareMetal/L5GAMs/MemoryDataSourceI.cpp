@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "MemoryDataSourceI.h"
+#include "PinnedMemory.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -51,9 +52,30 @@ MemoryDataSourceI::MemoryDataSourceI() :
     signalOffsets = NULL_PTR(uint32 *);
     memoryHeap = NULL_PTR(HeapI *);
     signalSize = NULL_PTR(uint32 *);
+    allocatedMemory = NULL_PTR(void *);
+    pinnedMemorySize = 0u;
+    usePinnedMemory = false;
+    hugePages = false;
+    lockMemory = false;
+    numaNode = -1;
+    signalAlignment = 0u;
 }
 
 MemoryDataSourceI::~MemoryDataSourceI() {
+    if (allocatedMemory != NULL_PTR(void *)) {
+        if (pinnedMemorySize > 0u) {
+            (void) PinnedMemory::Free(allocatedMemory, pinnedMemorySize);
+        }
+        else if (memoryHeap != NULL_PTR(HeapI *)) {
+            /*lint -e{1551} HeapManager::Free is expected to be exception free*/
+            memoryHeap->Free(allocatedMemory);
+        }
+        else {
+            //NOOP
+        }
+        allocatedMemory = NULL_PTR(void *);
+        memory = NULL_PTR(uint8 *);
+    }
     if (memoryHeap != NULL_PTR(HeapI *)) {
         if (memory != NULL_PTR(uint8 *)) {
             /*lint -e{1551} HeapManager::Free is expected to be exception free*/
@@ -74,7 +96,39 @@ MemoryDataSourceI::~MemoryDataSourceI() {
 }
 
 bool MemoryDataSourceI::AllocateMemory() {
+    bool ret = ComputeMemoryLayout();
+    if (ret) {
+        if (usePinnedMemory) {
+            //Page aligned
+            allocatedMemory = PinnedMemory::Allocate(totalMemorySize, hugePages, lockMemory, numaNode, pinnedMemorySize);
+            memory = reinterpret_cast<uint8 *>(allocatedMemory);
+        }
+        else if (memoryHeap != NULL_PTR(HeapI *)) {
+            //The heaps only guarantee the alignment of the fundamental types
+            uint32 padding = (signalAlignment > 16u) ? (signalAlignment) : (0u);
+            allocatedMemory = memoryHeap->Malloc(totalMemorySize + padding);
+            if ((allocatedMemory != NULL_PTR(void *)) && (padding > 0u)) {
+                /*lint -e{923} -e{9091} the alignment requires the conversion of the pointer to an integer*/
+                uintp address = reinterpret_cast<uintp>(allocatedMemory);
+                address = (address + (padding - 1u)) & ~static_cast<uintp>(padding - 1u);
+                /*lint -e{923} -e{9091} the alignment requires the conversion of the integer to a pointer*/
+                memory = reinterpret_cast<uint8 *>(address);
+            }
+            else {
+                memory = reinterpret_cast<uint8 *>(allocatedMemory);
+            }
+        }
+        else {
+            //NOOP
+        }
+        //Also prefaults all the pages
+        ret = MemoryOperationsHelper::Set(memory, '\0', totalMemorySize);
+    }
+    return ret;
+
+}
 
+bool MemoryDataSourceI::ComputeMemoryLayout() {
     uint32 nOfSignals = GetNumberOfSignals();
     bool ret = (memory == NULL_PTR(uint8 *));
     if (ret) {
@@ -94,6 +148,9 @@ bool MemoryDataSourceI::AllocateMemory() {
         ret = GetSignalByteSize(s, thisSignalMemorySize);
 
         if (ret) {
+            if (signalAlignment > 0u) {
+                stateMemorySize = (stateMemorySize + (signalAlignment - 1u)) & ~(signalAlignment - 1u);
+            }
             if (signalOffsets != NULL_PTR(uint32 *)) {
                 signalOffsets[s] = stateMemorySize;
             }
@@ -107,19 +164,18 @@ bool MemoryDataSourceI::AllocateMemory() {
             signalSize[s] = thisSignalMemorySize;
         }
     }
+    //Keep every state buffer aligned
+    if ((ret) && (signalAlignment > 0u)) {
+        stateMemorySize = (stateMemorySize + (signalAlignment - 1u)) & ~(signalAlignment - 1u);
+    }
     uint32 numberOfStateBuffers = GetNumberOfStatefulMemoryBuffers();
     if (ret) {
         ret = (numberOfStateBuffers > 0u);
     }
     if (ret) {
         totalMemorySize = stateMemorySize * numberOfStateBuffers;
-        if (memoryHeap != NULL_PTR(HeapI *)) {
-            memory = reinterpret_cast<uint8 *>(memoryHeap->Malloc(totalMemorySize));
-        }
-        ret = MemoryOperationsHelper::Set(memory, '\0', totalMemorySize);
     }
     return ret;
-
 }
 
 uint32 MemoryDataSourceI::GetNumberOfMemoryBuffers() {
@@ -151,6 +207,43 @@ bool MemoryDataSourceI::Initialise(StructuredDataI & data) {
             memoryHeap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
         }
     }
+    if (ret) {
+        uint32 hugePagesUInt32 = 0u;
+        uint32 lockMemoryUInt32 = 0u;
+        (void) data.Read("HugePages", hugePagesUInt32);
+        (void) data.Read("LockMemory", lockMemoryUInt32);
+        hugePages = (hugePagesUInt32 == 1u);
+        lockMemory = (lockMemoryUInt32 == 1u);
+        uint32 numaCPU = 0u;
+        if (data.Read("NUMACPU", numaCPU)) {
+            numaNode = PinnedMemory::NodeOfCPU(numaCPU);
+            if (numaNode < 0) {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not find the NUMA node of CPU %u. The memory will not be bound", numaCPU);
+            }
+        }
+        else if (!data.Read("NUMANode", numaNode)) {
+            numaNode = -1;
+        }
+        else {
+            //NOOP
+        }
+        usePinnedMemory = (hugePages || lockMemory || (numaNode >= 0));
+        if (usePinnedMemory) {
+            StreamString heapName;
+            ret = !data.Read("HeapName", heapName);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "HeapName cannot be set together with HugePages, LockMemory, NUMANode or NUMACPU");
+            }
+        }
+    }
+    if (ret) {
+        if (data.Read("SignalAlignment", signalAlignment)) {
+            ret = ((signalAlignment & (signalAlignment - 1u)) == 0u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "SignalAlignment shall be a power of two");
+            }
+        }
+    }
     return ret;
 }
 
@@ -41,13 +41,23 @@ namespace MARTe {
  * @brief A DataSourceI which defines a memory area with sufficient space to store all the signals declared by the DataSource instance.
  *
  * @details The memory is allocated in a contiguous memory region: S_1|S_2|...|S_N, where S_N has sufficient space to hold the signal N x number of buffers.
+ * If SignalAlignment is set, each S_i (and each state buffer) starts at an address multiple of SignalAlignment.
+ *
+ * The memory can be allocated directly from the operating system (see PinnedMemory) instead of from a heap, in order to
+ * back it with huge pages, lock it in memory and bind it to the NUMA node of the CPU where the consuming RealTimeThread runs.
+ * The memory is always zero initialised, which also prefaults all of its pages.
  *
  * A possible configuration structure is:
  * <pre>
  * +ThisDataSourceIObjectName = {
  *    Class = ClassThatImplementsDataSourceI
  *    NumberOfBuffers = 3 //Optional. Default = 1. Each buffer contains a copy of each signal.
- *    HeapName = "Default" //Optional. Default = GlobalObjectsDatabase::Instance()->GetStandardHeap();
+ *    HeapName = "Default" //Optional. Default = GlobalObjectsDatabase::Instance()->GetStandardHeap(); Cannot be set together with HugePages, LockMemory, NUMANode or NUMACPU.
+ *    HugePages = 0|1 //Optional. Default = 0. If 1 the memory is backed by huge pages (when available).
+ *    LockMemory = 0|1 //Optional. Default = 0. If 1 the memory is locked (mlock) so that it is never paged out.
+ *    NUMANode = 0 //Optional. The NUMA node where the memory is allocated.
+ *    NUMACPU = 4 //Optional. Alternative to NUMANode: the memory is allocated in the NUMA node of this CPU (e.g. the CPU of the consuming RealTimeThread).
+ *    SignalAlignment = 64 //Optional. Default = 0 (signals packed back-to-back). Power of two alignment (in bytes) of each signal, typically the cache line size.
  *    Signals = {
  *        +*NAME = {
  *            +Type = BasicType|StructuredType
@@ -97,13 +107,23 @@ public:
     virtual bool GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 bufferIdx, void *&signalAddress);
 
     /**
-     * @brief See DataSourceI::Initialise. Reads the optional NumberOfBuffers and HeapName parameters.
+     * @brief See DataSourceI::Initialise. Reads the optional NumberOfBuffers, HeapName, HugePages, LockMemory, NUMANode, NUMACPU and SignalAlignment parameters.
      * @param[in] data The configuration information which may include a Signals node.
      * @return true if the DataSourceI is successfully initialised.
      */
     virtual bool Initialise(StructuredDataI & data);
 
 protected:
+    /**
+     * @brief Computes the signalOffsets, signalSize, stateMemorySize and totalMemorySize of the memory layout described in
+     * the class description, without allocating the memory.
+     * @details Allows derived classes to place the signals in memory that they allocate themselves.
+     * @return true if all the signals have a valid size and GetNumberOfStatefulMemoryBuffers() > 0.
+     * @pre
+     *   memory == NULL
+     */
+    bool ComputeMemoryLayout();
+
     /**
      * The memory address.
      */
@@ -138,6 +158,43 @@ protected:
      * The size in bytes of each signal.
      */
     uint32 *signalSize;
+
+private:
+
+    /**
+     * The address returned by the heap (or by PinnedMemory::Allocate), which may differ from memory due to the SignalAlignment.
+     */
+    void *allocatedMemory;
+
+    /**
+     * The number of bytes mapped with PinnedMemory::Allocate (zero if the memory was allocated from the memoryHeap).
+     */
+    uint32 pinnedMemorySize;
+
+    /**
+     * True if the memory is to be allocated with PinnedMemory::Allocate.
+     */
+    bool usePinnedMemory;
+
+    /**
+     * True if the memory is to be backed by huge pages.
+     */
+    bool hugePages;
+
+    /**
+     * True if the memory is to be locked.
+     */
+    bool lockMemory;
+
+    /**
+     * The NUMA node where the memory is to be allocated (-1 for any).
+     */
+    int32 numaNode;
+
+    /**
+     * The alignment of each signal (0 for packed signals).
+     */
+    uint32 signalAlignment;
 };
 }
 
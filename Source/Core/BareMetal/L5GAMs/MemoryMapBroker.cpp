@@ -31,6 +31,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "AdvancedErrorManagement.h"
 #include "MemoryMapBroker.h"
 
 /*---------------------------------------------------------------------------*/
@@ -43,11 +44,18 @@
 
 namespace MARTe {
 
+/**
+ * Minimum number of equally spaced entries that are replaced by a strided entry.
+ */
+static const uint32 MEMORY_MAP_BROKER_MIN_GATHER_ELEMENTS = 4u;
+
 MemoryMapBroker::MemoryMapBroker() :
         BrokerI() {
     copyTable = NULL_PTR(MemoryMapBrokerCopyTableEntry*);
     dataSource = NULL_PTR(DataSourceI*);
     numberOfCopies = 0u;
+    coalesceCopyTable = true;
+    gatherCopyTable = false;
 }
 
 MemoryMapBroker::~MemoryMapBroker() {
@@ -117,14 +125,23 @@ bool MemoryMapBroker::Init(const SignalDirection direction,
         for (uint32 numberOfCopiesIdx = 0u; (numberOfCopiesIdx < numberOfCopies) && (ret); numberOfCopiesIdx++) {
             //if (dataSource->IsSupportedBroker(direction, functionIdx, n, brokerClassName)) {
             copyTable[c].copySize = GetCopyByteSize(numberOfCopiesIdx);
+            copyTable[c].numberOfElements = 1u;
+            copyTable[c].dataSourceStride = copyTable[c].copySize;
             copyTable[c].gamPointer = GetFunctionPointer(numberOfCopiesIdx);
             //To maintain compatibility with previous code. Currently, signal type make no sense since we are copying several signals (of several types) at once. Nevertheless MemoryMapInputBroker uses it.
             copyTable[c].type = dataSource->GetSignalType(GetDSCopySignalIndex(numberOfCopiesIdx));
             uint32 dataSourceOffset = GetCopyOffset(numberOfCopiesIdx);
 
-            void *dataSourceSignalAddress;
+            void *dataSourceSignalAddress = NULL_PTR(void*);
             ret = dataSource->GetSignalMemoryBuffer(GetDSCopySignalIndex(numberOfCopiesIdx), c0, dataSourceSignalAddress);
             char8 *dataSourceSignalAddressChar = reinterpret_cast<char8*>(dataSourceSignalAddress);
+            //The pointers are validated here once so that Execute can use MemoryOperationsHelper::CopyUnchecked
+            if (ret) {
+                ret = ((dataSourceSignalAddressChar != NULL_PTR(char8*)) && (copyTable[c].gamPointer != NULL_PTR(void*)));
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Invalid memory address for the copy %d of %s", numberOfCopiesIdx, functionName);
+                }
+            }
             if (ret) {
                 dataSourceSignalAddressChar = &dataSourceSignalAddressChar[dataSourceOffset];
                 copyTable[c].dataSourcePointer = reinterpret_cast<void*>(dataSourceSignalAddressChar);
@@ -133,7 +150,149 @@ bool MemoryMapBroker::Init(const SignalDirection direction,
         }
 //        }
     }
+    if ((ret) && (coalesceCopyTable)) {
+        CoalesceCopyTable(numberOfBuffers);
+    }
+    if ((ret) && (gatherCopyTable)) {
+        GatherCopyTable(numberOfBuffers);
+    }
+    if (ret) {
+        //The copy sizes are final (after coalescing): select the copy specialisation of each entry once
+        uint32 totalNumberOfElements = (numberOfCopies * numberOfBuffers);
+        for (uint32 n = 0u; n < totalNumberOfElements; n++) {
+            copyTable[n].fixedCopySize = MemoryOperationsHelper::GetFixedCopySize(copyTable[n].copySize);
+        }
+    }
     return ret;
 }
 
+const MemoryMapBrokerCopyTableEntry *MemoryMapBroker::GetStatelessCopyTable() const {
+    const MemoryMapBrokerCopyTableEntry *statelessCopyTable = NULL_PTR(const MemoryMapBrokerCopyTableEntry *);
+    if (dataSource != NULL_PTR(DataSourceI *)) {
+        if (dataSource->GetNumberOfStatefulMemoryBuffers() == 1u) {
+            statelessCopyTable = copyTable;
+        }
+    }
+    return statelessCopyTable;
+}
+
+void MemoryMapBroker::CoalesceCopyTable(const uint32 numberOfBuffers) {
+    if ((copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) && (numberOfCopies > 1u)) {
+        bool *mergeWithPrevious = new bool[numberOfCopies];
+        bool anyMerge = false;
+        mergeWithPrevious[0u] = false;
+        for (uint32 n = 1u; n < numberOfCopies; n++) {
+            char8 *gamEnd = reinterpret_cast<char8*>(copyTable[n - 1u].gamPointer);
+            gamEnd = &gamEnd[copyTable[n - 1u].copySize];
+            bool merge = (gamEnd == reinterpret_cast<char8*>(copyTable[n].gamPointer));
+            for (uint32 b = 0u; (b < numberOfBuffers) && (merge); b++) {
+                uint32 idx = (b * numberOfCopies) + n;
+                char8 *dataSourceEnd = reinterpret_cast<char8*>(copyTable[idx - 1u].dataSourcePointer);
+                dataSourceEnd = &dataSourceEnd[copyTable[idx - 1u].copySize];
+                merge = (dataSourceEnd == reinterpret_cast<char8*>(copyTable[idx].dataSourcePointer));
+            }
+            mergeWithPrevious[n] = merge;
+            if (merge) {
+                anyMerge = true;
+            }
+        }
+        if (anyMerge) {
+            //Compact in place, buffer by buffer. The destination index is always <= the source index.
+            uint32 c = 0u;
+            for (uint32 b = 0u; b < numberOfBuffers; b++) {
+                for (uint32 n = 0u; n < numberOfCopies; n++) {
+                    uint32 idx = (b * numberOfCopies) + n;
+                    if (mergeWithPrevious[n]) {
+                        copyTable[c - 1u].copySize += copyTable[idx].copySize;
+                    }
+                    else {
+                        copyTable[c] = copyTable[idx];
+                        c++;
+                    }
+                }
+            }
+            MergeCopies(mergeWithPrevious);
+        }
+        delete[] mergeWithPrevious;
+    }
+}
+
+void MemoryMapBroker::GatherCopyTable(const uint32 numberOfBuffers) {
+    if ((copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) && (numberOfCopies >= MEMORY_MAP_BROKER_MIN_GATHER_ELEMENTS)) {
+        bool *mergeWithPrevious = new bool[numberOfCopies];
+        //The number of elements and the stride of the strided entry starting at each copy (numberOfElements = 1 if none)
+        uint32 *runElements = new uint32[numberOfCopies];
+        uint32 *runStride = new uint32[numberOfCopies];
+        bool anyMerge = false;
+        for (uint32 n = 0u; n < numberOfCopies; n++) {
+            mergeWithPrevious[n] = false;
+            runElements[n] = 1u;
+            runStride[n] = copyTable[n].copySize;
+        }
+        uint32 first = 0u;
+        while (first < numberOfCopies) {
+            uint32 stride = 0u;
+            uint32 last = first + 1u;
+            bool inRun = true;
+            while ((last < numberOfCopies) && (inRun)) {
+                char8 *gamEnd = reinterpret_cast<char8*>(copyTable[last - 1u].gamPointer);
+                gamEnd = &gamEnd[copyTable[last - 1u].copySize];
+                inRun = ((copyTable[last].copySize == copyTable[first].copySize) && (gamEnd == reinterpret_cast<char8*>(copyTable[last].gamPointer)));
+                for (uint32 b = 0u; (b < numberOfBuffers) && (inRun); b++) {
+                    uint32 idx = (b * numberOfCopies) + last;
+                    char8 *previous = reinterpret_cast<char8*>(copyTable[idx - 1u].dataSourcePointer);
+                    char8 *current = reinterpret_cast<char8*>(copyTable[idx].dataSourcePointer);
+                    inRun = (current > previous);
+                    if (inRun) {
+                        uint64 distance = static_cast<uint64>(current - previous);
+                        if (stride == 0u) {
+                            inRun = (distance <= 0xFFFFFFFFu);
+                            if (inRun) {
+                                stride = static_cast<uint32>(distance);
+                            }
+                        }
+                        else {
+                            inRun = (distance == stride);
+                        }
+                    }
+                }
+                if (inRun) {
+                    last++;
+                }
+            }
+            if ((last - first) >= MEMORY_MAP_BROKER_MIN_GATHER_ELEMENTS) {
+                runElements[first] = (last - first);
+                runStride[first] = stride;
+                for (uint32 n = (first + 1u); n < last; n++) {
+                    mergeWithPrevious[n] = true;
+                }
+                anyMerge = true;
+                first = last;
+            }
+            else {
+                first++;
+            }
+        }
+        if (anyMerge) {
+            //Compact in place, buffer by buffer. The destination index is always <= the source index.
+            uint32 c = 0u;
+            for (uint32 b = 0u; b < numberOfBuffers; b++) {
+                for (uint32 n = 0u; n < numberOfCopies; n++) {
+                    uint32 idx = (b * numberOfCopies) + n;
+                    if (!mergeWithPrevious[n]) {
+                        copyTable[c] = copyTable[idx];
+                        copyTable[c].numberOfElements = runElements[n];
+                        copyTable[c].dataSourceStride = runStride[n];
+                        c++;
+                    }
+                }
+            }
+            MergeCopies(mergeWithPrevious);
+        }
+        delete[] mergeWithPrevious;
+        delete[] runElements;
+        delete[] runStride;
+    }
+}
+
 }
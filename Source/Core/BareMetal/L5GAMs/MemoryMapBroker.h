@@ -55,9 +55,22 @@ struct MemoryMapBrokerCopyTableEntry {
      */
     void *dataSourcePointer;
     /**
-     * The size of the copy
+     * The size of the copy (of each element if numberOfElements > 1)
      */
     uint32 copySize;
+    /**
+     * The MemoryOperationsHelper::CopyTagged tag of the copy (see MemoryOperationsHelper::GetFixedCopySize).
+     */
+    uint32 fixedCopySize;
+    /**
+     * The number of elements of a strided (gather/scatter) copy, 1 for a plain copy. The elements are contiguous in the GAM memory
+     * and dataSourceStride bytes apart in the DataSourceI memory
+     */
+    uint32 numberOfElements;
+    /**
+     * The distance in bytes between two elements in the DataSourceI memory (only meaningful if numberOfElements > 1)
+     */
+    uint32 dataSourceStride;
     /**
      * The signal type
      */
@@ -70,6 +83,12 @@ struct MemoryMapBrokerCopyTableEntry {
  * For each GAM signal, the signal name is searched in the provided DataSourceI (see Init) and the memory
  * memory address of the signal retrieved using the GetSignalMemoryBuffer function. The information of each element to
  *  be copied is stored in a MemoryMapBrokerCopyTableEntry.
+ * @details After the copy table is built, consecutive entries whose memory is contiguous both in the GAM and in all the
+ *  DataSourceI buffers are merged in a single entry (unless coalesceCopyTable is set to false by the derived class), so that
+ *  a GAM reading many contiguous signals is served with a handful of copies.
+ * @details If gatherCopyTable is set by the derived class, runs of entries of the same size whose memory is contiguous in the GAM
+ *  and equally spaced in all the DataSourceI buffers (e.g. the Ranges that pick a channel from an interleaved frame) are then
+ *  replaced by a single strided entry (see MemoryOperationsHelper::GatherStrided and MemoryOperationsHelper::ScatterStrided).
  */
 class DLL_API MemoryMapBroker: public BrokerI {
 
@@ -127,13 +146,48 @@ public:
                       void *const gamMemoryAddress,
                       const bool optim);
 
+    /**
+     * @brief Gets the copy table when the copies do not depend on the current state buffer of the DataSourceI.
+     * @details Allows to execute the copies of the broker without calling Execute (see GAMSchedulerI FlattenCycles).
+     * @return the copyTable (GetNumberOfCopies() entries) or NULL if the DataSourceI has more than one stateful memory buffer.
+     */
+    const MemoryMapBrokerCopyTableEntry *GetStatelessCopyTable() const;
+
 protected:
 
+    /**
+     * @brief Merges the contiguous copyTable entries.
+     * @details The entry n is merged with the entry n - 1 if the GAM memory and the DataSourceI memory
+     * of all the buffers are contiguous. The type of a merged entry is the type of the first one.
+     * @param[in] numberOfBuffers the number of DataSourceI buffers in the copyTable.
+     */
+    void CoalesceCopyTable(const uint32 numberOfBuffers);
+
+    /**
+     * @brief Replaces the runs of equally spaced copyTable entries by strided entries.
+     * @details A run is replaced if it has at least four entries with the same copySize, contiguous in the GAM memory and
+     * separated by the same (positive) distance in all the DataSourceI buffers.
+     * @param[in] numberOfBuffers the number of DataSourceI buffers in the copyTable.
+     */
+    void GatherCopyTable(const uint32 numberOfBuffers);
+
     /**
      * A table with all the elements to be copied
      */
     MemoryMapBrokerCopyTableEntry *copyTable;
 
+    /**
+     * If true (default) the contiguous copyTable entries are merged in Init. Derived classes that need one entry per signal
+     * (e.g. because the type of each entry is relevant) shall set it to false before calling Init.
+     */
+    bool coalesceCopyTable;
+
+    /**
+     * If true the equally spaced copyTable entries are replaced by strided entries in Init (false by default). Only to be set by
+     * the derived classes whose Execute handles the strided entries.
+     */
+    bool gatherCopyTable;
+
     /**
      * The DataSourceI instance
      */
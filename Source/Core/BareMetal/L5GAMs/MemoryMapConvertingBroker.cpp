@@ -0,0 +1,240 @@
+/**
+ * @file MemoryMapConvertingBroker.cpp
+ * @brief Source file for class MemoryMapConvertingBroker
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryMapConvertingBroker (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "MemoryMapConvertingBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MemoryMapConvertingBroker::MemoryMapConvertingBroker() :
+        BrokerI() {
+    copyTable = NULL_PTR(MemoryMapConvertingBrokerCopyTableEntry*);
+    dataSource = NULL_PTR(DataSourceI*);
+    numberOfCopies = 0u;
+}
+
+MemoryMapConvertingBroker::~MemoryMapConvertingBroker() {
+    if (copyTable != NULL_PTR(MemoryMapConvertingBrokerCopyTableEntry*)) {
+        delete[] copyTable;
+    }
+    /*lint -e{1740} dataSource contains a copy of a pointer. No need to be freed.*/
+}
+
+bool MemoryMapConvertingBroker::Init(const SignalDirection direction,
+                                     DataSourceI &dataSourceIn,
+                                     const char8 *const functionName,
+                                     void *const gamMemoryAddress) {
+    dataSource = &dataSourceIn;
+    const ClassProperties *properties = GetClassProperties();
+    bool ret = (properties != NULL);
+    const char8 *brokerClassName = NULL_PTR(const char8*);
+    if (ret) {
+        brokerClassName = properties->GetName();
+        ret = (brokerClassName != NULL);
+    }
+    uint32 functionIdx = 0u;
+    if (ret) {
+        ret = dataSourceIn.GetFunctionIndex(functionIdx, functionName);
+    }
+    uint32 functionNumberOfSignals = 0u;
+    if (ret) {
+        ret = dataSourceIn.GetFunctionNumberOfSignals(direction, functionIdx, functionNumberOfSignals);
+    }
+    if (ret) {
+        ret = (gamMemoryAddress != NULL_PTR(void*));
+    }
+    if (ret) {
+        ret = (copyTable == NULL_PTR(MemoryMapConvertingBrokerCopyTableEntry*));
+    }
+    uint32 numberOfBuffers = 0u;
+    if (ret) {
+        numberOfBuffers = dataSourceIn.GetNumberOfStatefulMemoryBuffers();
+        ret = (numberOfBuffers > 0u);
+    }
+    //The first pass counts the copies (copyTable == NULL), the second fills the copyTable.
+    for (uint32 pass = 0u; (pass < 2u) && (ret); pass++) {
+        uint32 c = 0u;
+        for (uint32 i = 0u; (i < functionNumberOfSignals) && (ret); i++) {
+            if (dataSourceIn.IsSupportedBroker(direction, functionIdx, i, brokerClassName)) {
+                ret = AddSignal(direction, functionIdx, i, reinterpret_cast<char8*>(gamMemoryAddress), numberOfBuffers, c);
+            }
+        }
+        if (ret) {
+            if (copyTable == NULL_PTR(MemoryMapConvertingBrokerCopyTableEntry*)) {
+                numberOfCopies = c;
+                ret = (numberOfCopies > 0u);
+                if (ret) {
+                    copyTable = new MemoryMapConvertingBrokerCopyTableEntry[numberOfCopies * numberOfBuffers];
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+bool MemoryMapConvertingBroker::AddSignal(const SignalDirection direction,
+                                          const uint32 functionIdx,
+                                          const uint32 functionSignalIdx,
+                                          char8 *const gamMemoryAddress,
+                                          const uint32 numberOfBuffers,
+                                          uint32 &copyIdx) {
+    uint32 numberOfByteOffsets = 0u;
+    /*lint -e{613} dataSource is set in Init before calling this method.*/
+    bool ret = dataSource->GetFunctionSignalNumberOfByteOffsets(direction, functionIdx, functionSignalIdx, numberOfByteOffsets);
+    uint32 samples = 0u;
+    if (ret) {
+        ret = dataSource->GetFunctionSignalSamples(direction, functionIdx, functionSignalIdx, samples);
+    }
+    if (ret) {
+        if (samples == 0u) {
+            samples = 1u;
+        }
+    }
+    uint32 memoryOffset = 0u;
+    if (ret) {
+        ret = dataSource->GetFunctionSignalGAMMemoryOffset(direction, functionIdx, functionSignalIdx, memoryOffset);
+    }
+    StreamString functionSignalName;
+    if (ret) {
+        ret = dataSource->GetFunctionSignalAlias(direction, functionIdx, functionSignalIdx, functionSignalName);
+    }
+    uint32 signalIdx = 0u;
+    if (ret) {
+        ret = dataSource->GetSignalIndex(signalIdx, functionSignalName.Buffer());
+    }
+    uint32 numberOfElements = 0u;
+    if (ret) {
+        ret = dataSource->GetSignalNumberOfElements(signalIdx, numberOfElements);
+    }
+    uint32 byteSize = 0u;
+    if (ret) {
+        ret = dataSource->GetSignalByteSize(signalIdx, byteSize);
+    }
+    TypeDescriptor dataSourceType;
+    TypeDescriptor functionType;
+    if (ret) {
+        dataSourceType = dataSource->GetSignalType(signalIdx);
+        if (!dataSource->GetFunctionSignalType(direction, functionIdx, functionSignalIdx, functionType)) {
+            functionType = dataSourceType;
+        }
+    }
+    TypeConversionKernel kernel = NULL_PTR(TypeConversionKernel);
+    if (ret) {
+        if (direction == InputSignals) {
+            kernel = TypeConversionKernels::Find(functionType, dataSourceType);
+        }
+        else {
+            kernel = TypeConversionKernels::Find(dataSourceType, functionType);
+        }
+        ret = (kernel != NULL_PTR(TypeConversionKernel));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Cannot convert the signal %s between %s and %s", functionSignalName.Buffer(),
+                         TypeDescriptor::GetTypeNameFromTypeDescriptor(functionType), TypeDescriptor::GetTypeNameFromTypeDescriptor(dataSourceType));
+        }
+    }
+    //The ByteOffset of the signal is in bytes of the function type
+    uint32 functionElementSize = (functionType.numberOfBits / 8u);
+    uint32 dataSourceElementSize = (dataSourceType.numberOfBits / 8u);
+    uint32 offsetStart = 0u;
+    uint32 copySize = 0u;
+    if (ret) {
+        ret = dataSource->GetFunctionSignalByteOffsetInfo(direction, functionIdx, functionSignalIdx, 0u, offsetStart, copySize);
+    }
+    if (ret) {
+        bool noRanges = ((numberOfByteOffsets == 1u) && (copySize == (numberOfElements * functionElementSize)));
+        if (noRanges) {
+            ret = SetCopyTableEntry(copyIdx, &gamMemoryAddress[memoryOffset], signalIdx, 0u, (numberOfElements * samples), kernel, numberOfBuffers);
+            copyIdx++;
+        }
+        else {
+            //Take into account different ranges for the same signal
+            for (uint32 j = 0u; (j < numberOfByteOffsets) && (ret); j++) {
+                ret = dataSource->GetFunctionSignalByteOffsetInfo(direction, functionIdx, functionSignalIdx, j, offsetStart, copySize);
+                uint32 dataSourceOffset = ((offsetStart / functionElementSize) * dataSourceElementSize);
+                for (uint32 h = 0u; (h < samples) && (ret); h++) {
+                    ret = SetCopyTableEntry(copyIdx, &gamMemoryAddress[memoryOffset], signalIdx, dataSourceOffset, (copySize / functionElementSize), kernel,
+                                            numberOfBuffers);
+                    copyIdx++;
+                    //skip the whole sample
+                    dataSourceOffset += byteSize;
+                    //in the gam shift the sub-block size
+                    memoryOffset += copySize;
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+bool MemoryMapConvertingBroker::SetCopyTableEntry(const uint32 copyIdx,
+                                                  void *const gamPointer,
+                                                  const uint32 signalIdx,
+                                                  const uint32 dataSourceOffset,
+                                                  const uint32 numberOfElements,
+                                                  const TypeConversionKernel kernel,
+                                                  const uint32 numberOfBuffers) {
+    bool ret = true;
+    if (copyTable != NULL_PTR(MemoryMapConvertingBrokerCopyTableEntry*)) {
+        for (uint32 b = 0u; (b < numberOfBuffers) && (ret); b++) {
+            void *dataSourceSignalAddress = NULL_PTR(void*);
+            /*lint -e{613} dataSource is set in Init before calling this method.*/
+            ret = dataSource->GetSignalMemoryBuffer(signalIdx, b, dataSourceSignalAddress);
+            //The pointers are validated here once so that Execute can call the kernels directly
+            if (ret) {
+                ret = (dataSourceSignalAddress != NULL_PTR(void*));
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Invalid memory address for the copy %d", copyIdx);
+                }
+            }
+            if (ret) {
+                char8 *dataSourceSignalAddressChar = reinterpret_cast<char8*>(dataSourceSignalAddress);
+                MemoryMapConvertingBrokerCopyTableEntry &entry = copyTable[(b * numberOfCopies) + copyIdx];
+                entry.gamPointer = gamPointer;
+                entry.dataSourcePointer = reinterpret_cast<void*>(&dataSourceSignalAddressChar[dataSourceOffset]);
+                entry.numberOfElements = numberOfElements;
+                entry.kernel = kernel;
+            }
+        }
+    }
+    return ret;
+}
+
+}
@@ -0,0 +1,181 @@
+/**
+ * @file MemoryMapConvertingBroker.h
+ * @brief Header file for class MemoryMapConvertingBroker
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MemoryMapConvertingBroker
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MEMORYMAPCONVERTINGBROKER_H_
+#define MEMORYMAPCONVERTINGBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "BrokerI.h"
+#include "DataSourceI.h"
+#include "TypeConversionKernels.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Helper structure which holds the memory pointers of the GAM and DataSource elements
+ * that are to be converted by this MemoryMapConvertingBroker.
+ */
+struct MemoryMapConvertingBrokerCopyTableEntry {
+    /**
+     * The pointer to the GAM.
+     */
+    void *gamPointer;
+    /**
+     * The pointer to the datasource
+     */
+    void *dataSourcePointer;
+    /**
+     * The number of elements to convert
+     */
+    uint32 numberOfElements;
+    /**
+     * Converts the elements in the direction of the broker (DataSource to GAM for the input brokers).
+     */
+    TypeConversionKernel kernel;
+};
+
+/**
+ * @brief Memory mapped BrokerI implementation which converts the signals whose type in the GAM differs from the type in the DataSourceI.
+ * @details A GAM signal asks for the conversion by declaring the type of the DataSourceI signal in DataSourceType, e.g.
+ * <pre>
+ * Current = {
+ *     DataSource = DDB1
+ *     Type = float32
+ *     DataSourceType = int16
+ * }
+ * </pre>
+ * The GAM memory holds the signal with its Type, while the DataSourceI holds it with the DataSourceType,
+ * so that the signal does not need a GAM (and a buffer) just for the conversion.
+ *
+ * For each signal (and for each range of the signal) the TypeConversionKernel that converts between the two types is resolved
+ * in Init (see TypeConversionKernels::Find), so that Execute converts the elements in the same pass as the copy and without any per element dispatch.
+ * Only the numeric types are supported.
+ */
+class DLL_API MemoryMapConvertingBroker: public BrokerI {
+
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetNumberOfCopies() == 0
+     */
+    MemoryMapConvertingBroker();
+
+    /**
+     * @brief Destructor. Frees the created MemoryMapConvertingBrokerCopyTableEntry entries.
+     */
+    virtual ~MemoryMapConvertingBroker();
+
+    /**
+     * @brief Initialises the MemoryMapConvertingBroker.
+     * @details For each signal in the \a functionName, which wishes to use this MemoryMapConvertingBroker instance
+     * (i.e. IsSupportedBroker(class inhering from MemoryMapConvertingBroker) == true), the memory address of the signal is retrieved
+     * from the provided \a dataSourceIn (see GetSignalMemoryBuffer) and the conversion kernel between the function type (see
+     * DataSourceI::GetFunctionSignalType) and the DataSourceI signal type is resolved.
+     * @param[in] direction the signal direction (InputSignals or OutputSignals).
+     * @param[in] dataSourceIn the DataSourceI to be queried.
+     * @param[in] functionName the name of GAM the to which this BrokerI is being allocated to.
+     * @param[in] gamMemoryAddress the base address of the GAM memory (where signal data is stored)
+     * @return true if all the copy information related to \a functionName can be successfully retrieved
+     * and a kernel exists for each pair of types.
+     * @post
+     *   GetNumberOfCopies() > 0
+     */
+    virtual bool Init(const SignalDirection direction,
+                      DataSourceI &dataSourceIn,
+                      const char8 *const functionName,
+                      void *const gamMemoryAddress);
+
+protected:
+
+    /**
+     * A table with all the elements to be converted (GetNumberOfCopies() entries for each DataSourceI buffer).
+     */
+    MemoryMapConvertingBrokerCopyTableEntry *copyTable;
+
+    /**
+     * The DataSourceI instance
+     */
+    DataSourceI *dataSource;
+
+private:
+
+    /**
+     * @brief Adds the copies of one signal of the function to the copyTable.
+     * @details One copy is added for the whole signal or, if Ranges are defined, one copy for each range and for each sample.
+     * @param[in] direction the signal direction (InputSignals or OutputSignals).
+     * @param[in] functionIdx the index of the function.
+     * @param[in] functionSignalIdx the index of the signal in this function.
+     * @param[in] gamMemoryAddress the base address of the GAM memory.
+     * @param[in] numberOfBuffers the number of DataSourceI buffers.
+     * @param[in,out] copyIdx the index of the first copy of the signal. Incremented by the number of copies added.
+     * @return true if the signal information can be retrieved and the types can be converted.
+     * @post
+     *   if copyTable == NULL only \a copyIdx is updated.
+     */
+    bool AddSignal(const SignalDirection direction,
+                   const uint32 functionIdx,
+                   const uint32 functionSignalIdx,
+                   char8 *const gamMemoryAddress,
+                   const uint32 numberOfBuffers,
+                   uint32 &copyIdx);
+
+    /**
+     * @brief Sets the entry \a copyIdx of the copyTable for all the DataSourceI buffers.
+     * @param[in] copyIdx the index of the copy.
+     * @param[in] gamPointer the address of the elements in the GAM memory.
+     * @param[in] signalIdx the index of the DataSourceI signal.
+     * @param[in] dataSourceOffset the offset in bytes of the elements w.r.t. the DataSourceI signal address.
+     * @param[in] numberOfElements the number of elements to convert.
+     * @param[in] kernel the kernel that converts the elements.
+     * @param[in] numberOfBuffers the number of DataSourceI buffers.
+     * @return true if the DataSourceI signal address is valid for all the buffers (or if copyTable == NULL).
+     */
+    bool SetCopyTableEntry(const uint32 copyIdx,
+                           void *const gamPointer,
+                           const uint32 signalIdx,
+                           const uint32 dataSourceOffset,
+                           const uint32 numberOfElements,
+                           const TypeConversionKernel kernel,
+                           const uint32 numberOfBuffers);
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MEMORYMAPCONVERTINGBROKER_H_ */
@@ -0,0 +1,73 @@
+/**
+ * @file MemoryMapConvertingInputBroker.h
+ * @brief Header file for class MemoryMapConvertingInputBroker
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MemoryMapConvertingInputBroker
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+#ifndef MEMORYMAPCONVERTINGINPUTBROKER_H_
+#define MEMORYMAPCONVERTINGINPUTBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MemoryMapConvertingBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Input MemoryMapConvertingBroker implementation.
+ * @details This class converts all the signals declared on a MemoryMapConvertingBroker
+ * from the DataSourceI memory to the GAM memory.
+ */
+class DLL_API MemoryMapConvertingInputBroker: public MemoryMapConvertingBroker {
+public:
+    CLASS_REGISTER_DECLARATION()
+    /**
+     * @brief Default constructor. NOOP.
+     */
+    MemoryMapConvertingInputBroker();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~MemoryMapConvertingInputBroker();
+
+    /**
+     * @brief Sequentially converts all the signals from the DataSourceI memory to the GAM memory.
+     * @details This implementation supports multi-state buffers and will query the DataSource for the GetCurrentStateBuffer.
+     * @return true if all the elements could be converted (see TypeConversionKernel).
+     */
+    virtual bool Execute();
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MEMORYMAPCONVERTINGINPUTBROKER_H_ */
+
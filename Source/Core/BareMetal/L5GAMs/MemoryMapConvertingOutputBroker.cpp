@@ -0,0 +1,68 @@
+/**
+ * @file MemoryMapConvertingOutputBroker.cpp
+ * @brief Source file for class MemoryMapConvertingOutputBroker
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryMapConvertingOutputBroker (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MemoryMapConvertingOutputBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+MemoryMapConvertingOutputBroker::MemoryMapConvertingOutputBroker() :
+        MemoryMapConvertingBroker() {
+
+}
+
+MemoryMapConvertingOutputBroker::~MemoryMapConvertingOutputBroker() {
+
+}
+
+bool MemoryMapConvertingOutputBroker::Execute() {
+    bool ret = true;
+    if (copyTable != NULL_PTR(MemoryMapConvertingBrokerCopyTableEntry *)) {
+        //The pointers and the kernels were validated by MemoryMapConvertingBroker::Init
+        for (uint32 n = 0u; n < numberOfCopies; n++) {
+            const MemoryMapConvertingBrokerCopyTableEntry &entry = copyTable[n];
+            if (!entry.kernel(entry.dataSourcePointer, entry.gamPointer, entry.numberOfElements)) {
+                ret = false;
+            }
+        }
+    }
+    return ret;
+}
+
+CLASS_REGISTER(MemoryMapConvertingOutputBroker, "1.0")
+}
+
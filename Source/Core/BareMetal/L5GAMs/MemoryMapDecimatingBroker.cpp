@@ -0,0 +1,816 @@
+/**
+ * @file MemoryMapDecimatingBroker.cpp
+ * @brief Source file for class MemoryMapDecimatingBroker
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryMapDecimatingBroker (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "CPUFeatures.h"
+#include "MemoryMapDecimatingBroker.h"
+#include "MemoryOperationsHelper.h"
+
+//After CPUFeatures.h, which tells if the compiler can generate the SVE kernels
+#ifdef MARTe2_SVE_KERNELS
+#include <arm_sve.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+using namespace MARTe;
+
+/**
+ * @brief Vectorised part of the sum accumulation.
+ * @return the number of elements accumulated (the remaining ones are accumulated by the scalar loop).
+ */
+template<typename T>
+inline uint32 VectorSum(float64 * const accumulator,
+                        const T * const samples,
+                        const uint32 numberOfElements,
+                        const bool first) {
+    return 0u;
+}
+
+/**
+ * @brief Vectorised part of the minimum (\a minimum = true) or maximum accumulation.
+ * @return the number of elements accumulated (the remaining ones are accumulated by the scalar loop).
+ */
+template<typename T>
+inline uint32 VectorMinMax(T * const accumulator,
+                           const T * const samples,
+                           const uint32 numberOfElements,
+                           const bool minimum) {
+    return 0u;
+}
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+
+inline uint32 VectorSum(float64 * const accumulator,
+                        const float32 * const samples,
+                        const uint32 numberOfElements,
+                        const bool first) {
+    uint32 i = 0u;
+    while ((i + 4u) <= numberOfElements) {
+        float32x4_t x = vld1q_f32(&samples[i]);
+        float64x2_t low = vcvt_f64_f32(vget_low_f32(x));
+        float64x2_t high = vcvt_high_f64_f32(x);
+        if (!first) {
+            low = vaddq_f64(low, vld1q_f64(&accumulator[i]));
+            high = vaddq_f64(high, vld1q_f64(&accumulator[i + 2u]));
+        }
+        vst1q_f64(&accumulator[i], low);
+        vst1q_f64(&accumulator[i + 2u], high);
+        i += 4u;
+    }
+    return i;
+}
+
+inline uint32 VectorSum(float64 * const accumulator,
+                        const float64 * const samples,
+                        const uint32 numberOfElements,
+                        const bool first) {
+    uint32 i = 0u;
+    while ((i + 4u) <= numberOfElements) {
+        float64x2_t low = vld1q_f64(&samples[i]);
+        float64x2_t high = vld1q_f64(&samples[i + 2u]);
+        if (!first) {
+            low = vaddq_f64(low, vld1q_f64(&accumulator[i]));
+            high = vaddq_f64(high, vld1q_f64(&accumulator[i + 2u]));
+        }
+        vst1q_f64(&accumulator[i], low);
+        vst1q_f64(&accumulator[i + 2u], high);
+        i += 4u;
+    }
+    return i;
+}
+
+inline uint32 VectorMinMax(float32 * const accumulator,
+                           const float32 * const samples,
+                           const uint32 numberOfElements,
+                           const bool minimum) {
+    uint32 i = 0u;
+    while ((i + 4u) <= numberOfElements) {
+        float32x4_t x = vld1q_f32(&samples[i]);
+        float32x4_t a = vld1q_f32(&accumulator[i]);
+        vst1q_f32(&accumulator[i], minimum ? vminq_f32(a, x) : vmaxq_f32(a, x));
+        i += 4u;
+    }
+    return i;
+}
+
+inline uint32 VectorMinMax(float64 * const accumulator,
+                           const float64 * const samples,
+                           const uint32 numberOfElements,
+                           const bool minimum) {
+    uint32 i = 0u;
+    while ((i + 2u) <= numberOfElements) {
+        float64x2_t x = vld1q_f64(&samples[i]);
+        float64x2_t a = vld1q_f64(&accumulator[i]);
+        vst1q_f64(&accumulator[i], minimum ? vminq_f64(a, x) : vmaxq_f64(a, x));
+        i += 2u;
+    }
+    return i;
+}
+
+#endif
+
+/**
+ * @brief SVE sum accumulation. This generic version falls back to VectorSum.
+ * @return the number of elements accumulated (the SVE overloads accumulate all the elements).
+ */
+template<typename T>
+inline uint32 SVESum(float64 * const accumulator,
+                     const T * const samples,
+                     const uint32 numberOfElements,
+                     const bool first) {
+    return VectorSum(accumulator, samples, numberOfElements, first);
+}
+
+/**
+ * @brief SVE minimum (\a minimum = true) or maximum accumulation. This generic version falls back to VectorMinMax.
+ * @return the number of elements accumulated (the SVE overloads accumulate all the elements).
+ */
+template<typename T>
+inline uint32 SVEMinMax(T * const accumulator,
+                        const T * const samples,
+                        const uint32 numberOfElements,
+                        const bool minimum) {
+    return VectorMinMax(accumulator, samples, numberOfElements, minimum);
+}
+
+#ifdef MARTe2_SVE_KERNELS
+
+__attribute__((target("+sve")))
+uint32 SVESum(float64 * const accumulator,
+              const float32 * const samples,
+              const uint32 numberOfElements,
+              const bool first) {
+    /*lint -e{9176} the float32 are loaded (zero extended) in the low half of the 64 bit lanes and widened from there*/
+    const uint32 * const bits = reinterpret_cast<const uint32 *>(samples);
+    uint32 i = 0u;
+    svbool_t pg = svwhilelt_b64(i, numberOfElements);
+    while (svptest_any(svptrue_b8(), pg)) {
+        svfloat64_t x = svcvt_f64_f32_x(pg, svreinterpret_f32_u64(svld1uw_u64(pg, &bits[i])));
+        if (!first) {
+            x = svadd_f64_x(pg, x, svld1_f64(pg, &accumulator[i]));
+        }
+        svst1_f64(pg, &accumulator[i], x);
+        i += static_cast<uint32>(svcntd());
+        pg = svwhilelt_b64(i, numberOfElements);
+    }
+    return numberOfElements;
+}
+
+__attribute__((target("+sve")))
+uint32 SVESum(float64 * const accumulator,
+              const float64 * const samples,
+              const uint32 numberOfElements,
+              const bool first) {
+    uint32 i = 0u;
+    svbool_t pg = svwhilelt_b64(i, numberOfElements);
+    while (svptest_any(svptrue_b8(), pg)) {
+        svfloat64_t x = svld1_f64(pg, &samples[i]);
+        if (!first) {
+            x = svadd_f64_x(pg, x, svld1_f64(pg, &accumulator[i]));
+        }
+        svst1_f64(pg, &accumulator[i], x);
+        i += static_cast<uint32>(svcntd());
+        pg = svwhilelt_b64(i, numberOfElements);
+    }
+    return numberOfElements;
+}
+
+__attribute__((target("+sve")))
+uint32 SVEMinMax(float32 * const accumulator,
+                 const float32 * const samples,
+                 const uint32 numberOfElements,
+                 const bool minimum) {
+    uint32 i = 0u;
+    svbool_t pg = svwhilelt_b32(i, numberOfElements);
+    while (svptest_any(svptrue_b8(), pg)) {
+        svfloat32_t x = svld1_f32(pg, &samples[i]);
+        svfloat32_t a = svld1_f32(pg, &accumulator[i]);
+        svst1_f32(pg, &accumulator[i], minimum ? svmin_f32_x(pg, a, x) : svmax_f32_x(pg, a, x));
+        i += static_cast<uint32>(svcntw());
+        pg = svwhilelt_b32(i, numberOfElements);
+    }
+    return numberOfElements;
+}
+
+__attribute__((target("+sve")))
+uint32 SVEMinMax(float64 * const accumulator,
+                 const float64 * const samples,
+                 const uint32 numberOfElements,
+                 const bool minimum) {
+    uint32 i = 0u;
+    svbool_t pg = svwhilelt_b64(i, numberOfElements);
+    while (svptest_any(svptrue_b8(), pg)) {
+        svfloat64_t x = svld1_f64(pg, &samples[i]);
+        svfloat64_t a = svld1_f64(pg, &accumulator[i]);
+        svst1_f64(pg, &accumulator[i], minimum ? svmin_f64_x(pg, a, x) : svmax_f64_x(pg, a, x));
+        i += static_cast<uint32>(svcntd());
+        pg = svwhilelt_b64(i, numberOfElements);
+    }
+    return numberOfElements;
+}
+
+#endif
+
+/**
+ * @brief The vector instructions of the baseline of the architecture (see VectorSum and VectorMinMax).
+ */
+struct BaselineDecimationVectors {
+    template<typename T>
+    static inline uint32 Sum(float64 * const accumulator,
+                             const T * const samples,
+                             const uint32 numberOfElements,
+                             const bool first) {
+        return VectorSum(accumulator, samples, numberOfElements, first);
+    }
+
+    template<typename T>
+    static inline uint32 MinMax(T * const accumulator,
+                                const T * const samples,
+                                const uint32 numberOfElements,
+                                const bool minimum) {
+        return VectorMinMax(accumulator, samples, numberOfElements, minimum);
+    }
+};
+
+/**
+ * @brief The SVE instructions (see SVESum and SVEMinMax). Only used if CPUFeatures::Has(CPU_FEATURE_SVE).
+ */
+struct SVEDecimationVectors {
+    template<typename T>
+    static inline uint32 Sum(float64 * const accumulator,
+                             const T * const samples,
+                             const uint32 numberOfElements,
+                             const bool first) {
+        return SVESum(accumulator, samples, numberOfElements, first);
+    }
+
+    template<typename T>
+    static inline uint32 MinMax(T * const accumulator,
+                                const T * const samples,
+                                const uint32 numberOfElements,
+                                const bool minimum) {
+        return SVEMinMax(accumulator, samples, numberOfElements, minimum);
+    }
+};
+
+/**
+ * @brief MemoryMapDecimationAccumulateKernel of the Mean and of the Boxcar for the type T.
+ */
+template<typename T, typename Vectors>
+void DecimationSum(void * const accumulator,
+                   const void * const samples,
+                   const uint32 numberOfElements,
+                   const bool first) {
+    float64 * const a = static_cast<float64 *>(accumulator);
+    const T * const x = static_cast<const T *>(samples);
+    uint32 i = Vectors::Sum(a, x, numberOfElements, first);
+    if (first) {
+        for (; i < numberOfElements; i++) {
+            a[i] = static_cast<float64>(x[i]);
+        }
+    }
+    else {
+        for (; i < numberOfElements; i++) {
+            a[i] += static_cast<float64>(x[i]);
+        }
+    }
+}
+
+/**
+ * @brief MemoryMapDecimationAccumulateKernel of the Min for the type T.
+ */
+template<typename T, typename Vectors>
+void DecimationMin(void * const accumulator,
+                   const void * const samples,
+                   const uint32 numberOfElements,
+                   const bool first) {
+    T * const a = static_cast<T *>(accumulator);
+    const T * const x = static_cast<const T *>(samples);
+    if (first) {
+        (void) MemoryOperationsHelper::Copy(a, x, static_cast<uint32>(sizeof(T)) * numberOfElements);
+    }
+    else {
+        uint32 i = Vectors::MinMax(a, x, numberOfElements, true);
+        for (; i < numberOfElements; i++) {
+            a[i] = (x[i] < a[i]) ? (x[i]) : (a[i]);
+        }
+    }
+}
+
+/**
+ * @brief MemoryMapDecimationAccumulateKernel of the Max for the type T.
+ */
+template<typename T, typename Vectors>
+void DecimationMax(void * const accumulator,
+                   const void * const samples,
+                   const uint32 numberOfElements,
+                   const bool first) {
+    T * const a = static_cast<T *>(accumulator);
+    const T * const x = static_cast<const T *>(samples);
+    if (first) {
+        (void) MemoryOperationsHelper::Copy(a, x, static_cast<uint32>(sizeof(T)) * numberOfElements);
+    }
+    else {
+        uint32 i = Vectors::MinMax(a, x, numberOfElements, false);
+        for (; i < numberOfElements; i++) {
+            a[i] = (x[i] > a[i]) ? (x[i]) : (a[i]);
+        }
+    }
+}
+
+/**
+ * @brief MemoryMapDecimationResultKernel of the Mean for the type T.
+ */
+template<typename T>
+void DecimationMeanResult(void * const result,
+                          const void * const accumulator,
+                          const uint32 numberOfElements,
+                          const uint32 decimation) {
+    T * const r = static_cast<T *>(result);
+    const float64 * const a = static_cast<const float64 *>(accumulator);
+    const float64 d = static_cast<float64>(decimation);
+    uint32 i;
+    for (i = 0u; i < numberOfElements; i++) {
+        r[i] = static_cast<T>(a[i] / d);
+    }
+}
+
+/**
+ * @brief MemoryMapDecimationResultKernel of the Boxcar for the type T.
+ */
+template<typename T>
+void DecimationSumResult(void * const result,
+                         const void * const accumulator,
+                         const uint32 numberOfElements,
+                         const uint32 decimation) {
+    T * const r = static_cast<T *>(result);
+    const float64 * const a = static_cast<const float64 *>(accumulator);
+    uint32 i;
+    for (i = 0u; i < numberOfElements; i++) {
+        r[i] = static_cast<T>(a[i]);
+    }
+}
+
+/**
+ * @brief MemoryMapDecimationResultKernel of the Min and of the Max for the type T.
+ */
+template<typename T>
+void DecimationCopyResult(void * const result,
+                          const void * const accumulator,
+                          const uint32 numberOfElements,
+                          const uint32 decimation) {
+    (void) MemoryOperationsHelper::Copy(result, accumulator, static_cast<uint32>(sizeof(T)) * numberOfElements);
+}
+
+/**
+ * @brief Selects the kernels of a reduction for the type T, accumulated with the Vectors (BaselineDecimationVectors or SVEDecimationVectors).
+ * @param[out] accumulatorSize the size in bytes of each element of the accumulator.
+ */
+template<typename T, typename Vectors>
+void SelectDecimationKernels(const uint32 reduction,
+                             MemoryMapDecimationAccumulateKernel &accumulateKernel,
+                             MemoryMapDecimationResultKernel &resultKernel,
+                             uint32 &accumulatorSize) {
+    accumulateKernel = NULL_PTR(MemoryMapDecimationAccumulateKernel);
+    resultKernel = NULL_PTR(MemoryMapDecimationResultKernel);
+    accumulatorSize = static_cast<uint32>(sizeof(T));
+    if (reduction == DECIMATION_REDUCTION_MEAN) {
+        accumulateKernel = &DecimationSum<T, Vectors>;
+        resultKernel = &DecimationMeanResult<T>;
+        accumulatorSize = static_cast<uint32>(sizeof(float64));
+    }
+    else if (reduction == DECIMATION_REDUCTION_BOXCAR) {
+        accumulateKernel = &DecimationSum<T, Vectors>;
+        resultKernel = &DecimationSumResult<T>;
+        accumulatorSize = static_cast<uint32>(sizeof(float64));
+    }
+    else if (reduction == DECIMATION_REDUCTION_MIN) {
+        accumulateKernel = &DecimationMin<T, Vectors>;
+        resultKernel = &DecimationCopyResult<T>;
+    }
+    else if (reduction == DECIMATION_REDUCTION_MAX) {
+        accumulateKernel = &DecimationMax<T, Vectors>;
+        resultKernel = &DecimationCopyResult<T>;
+    }
+    else {
+        //Last: no accumulation
+    }
+}
+
+/**
+ * @brief Selects the kernels of a reduction for a type.
+ * @details The float32 and float64 kernels use SVE if the processor implements it.
+ * @return false if the type cannot be decimated.
+ */
+bool FindDecimationKernels(const TypeDescriptor &type,
+                           const uint32 reduction,
+                           MemoryMapDecimationAccumulateKernel &accumulateKernel,
+                           MemoryMapDecimationResultKernel &resultKernel,
+                           uint32 &accumulatorSize) {
+    bool ok = true;
+#ifdef MARTe2_SVE_KERNELS
+    const bool useSVE = CPUFeatures::Has(CPUFeatures::CPU_FEATURE_SVE);
+#else
+    const bool useSVE = false;
+#endif
+    if (type == UnsignedInteger8Bit) {
+        SelectDecimationKernels<uint8, BaselineDecimationVectors>(reduction, accumulateKernel, resultKernel, accumulatorSize);
+    }
+    else if (type == UnsignedInteger16Bit) {
+        SelectDecimationKernels<uint16, BaselineDecimationVectors>(reduction, accumulateKernel, resultKernel, accumulatorSize);
+    }
+    else if (type == UnsignedInteger32Bit) {
+        SelectDecimationKernels<uint32, BaselineDecimationVectors>(reduction, accumulateKernel, resultKernel, accumulatorSize);
+    }
+    else if (type == UnsignedInteger64Bit) {
+        SelectDecimationKernels<uint64, BaselineDecimationVectors>(reduction, accumulateKernel, resultKernel, accumulatorSize);
+    }
+    else if (type == SignedInteger8Bit) {
+        SelectDecimationKernels<int8, BaselineDecimationVectors>(reduction, accumulateKernel, resultKernel, accumulatorSize);
+    }
+    else if (type == SignedInteger16Bit) {
+        SelectDecimationKernels<int16, BaselineDecimationVectors>(reduction, accumulateKernel, resultKernel, accumulatorSize);
+    }
+    else if (type == SignedInteger32Bit) {
+        SelectDecimationKernels<int32, BaselineDecimationVectors>(reduction, accumulateKernel, resultKernel, accumulatorSize);
+    }
+    else if (type == SignedInteger64Bit) {
+        SelectDecimationKernels<int64, BaselineDecimationVectors>(reduction, accumulateKernel, resultKernel, accumulatorSize);
+    }
+    else if (type == Float32Bit) {
+        if (useSVE) {
+            SelectDecimationKernels<float32, SVEDecimationVectors>(reduction, accumulateKernel, resultKernel, accumulatorSize);
+        }
+        else {
+            SelectDecimationKernels<float32, BaselineDecimationVectors>(reduction, accumulateKernel, resultKernel, accumulatorSize);
+        }
+    }
+    else if (type == Float64Bit) {
+        if (useSVE) {
+            SelectDecimationKernels<float64, SVEDecimationVectors>(reduction, accumulateKernel, resultKernel, accumulatorSize);
+        }
+        else {
+            SelectDecimationKernels<float64, BaselineDecimationVectors>(reduction, accumulateKernel, resultKernel, accumulatorSize);
+        }
+    }
+    else {
+        ok = false;
+    }
+    return ok;
+}
+
+/**
+ * @brief Converts the name of a reduction.
+ * @return false if \a name is not one of Last, Mean, Min, Max or Boxcar.
+ */
+bool GetDecimationReduction(const StreamString &name,
+                            uint32 &reduction) {
+    bool ok = true;
+    if (name == "Last") {
+        reduction = DECIMATION_REDUCTION_LAST;
+    }
+    else if (name == "Mean") {
+        reduction = DECIMATION_REDUCTION_MEAN;
+    }
+    else if (name == "Min") {
+        reduction = DECIMATION_REDUCTION_MIN;
+    }
+    else if (name == "Max") {
+        reduction = DECIMATION_REDUCTION_MAX;
+    }
+    else if (name == "Boxcar") {
+        reduction = DECIMATION_REDUCTION_BOXCAR;
+    }
+    else {
+        ok = false;
+    }
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MemoryMapDecimatingBroker::MemoryMapDecimatingBroker() :
+        MemoryMapBroker() {
+    groups = NULL_PTR(MemoryMapDecimatingBrokerGroup *);
+    numberOfGroups = 0u;
+    //The signals are reduced signal by signal (each with its own type)
+    coalesceCopyTable = false;
+}
+
+/*lint -e{1551} memory is freed in the destructor*/
+MemoryMapDecimatingBroker::~MemoryMapDecimatingBroker() {
+    if (groups != NULL_PTR(MemoryMapDecimatingBrokerGroup *)) {
+        uint32 g;
+        for (g = 0u; g < numberOfGroups; g++) {
+            delete[] groups[g].copies;
+            delete[] groups[g].offsets;
+            if (groups[g].samples != NULL_PTR(char8 *)) {
+                delete[] groups[g].samples;
+            }
+            if (groups[g].accumulator != NULL_PTR(float64 *)) {
+                delete[] groups[g].accumulator;
+            }
+            if (groups[g].result != NULL_PTR(char8 *)) {
+                delete[] groups[g].result;
+            }
+        }
+        delete[] groups;
+    }
+}
+
+bool MemoryMapDecimatingBroker::Init(const SignalDirection direction,
+                                     DataSourceI &dataSourceIn,
+                                     const char8 *const functionName,
+                                     void *const gamMemoryAddress) {
+    bool ok = MemoryMapBroker::Init(direction, dataSourceIn, functionName, gamMemoryAddress);
+    uint32 functionIdx = 0u;
+    if (ok) {
+        ok = dataSourceIn.GetFunctionIndex(functionIdx, functionName);
+    }
+    uint32 numberOfSignals = 0u;
+    if (ok) {
+        ok = dataSourceIn.GetFunctionNumberOfSignals(direction, functionIdx, numberOfSignals);
+    }
+    const char8 *brokerClassName = NULL_PTR(const char8 *);
+    if (ok) {
+        const ClassProperties *properties = GetClassProperties();
+        ok = (properties != NULL_PTR(const ClassProperties *));
+        if (ok) {
+            brokerClassName = properties->GetName();
+        }
+    }
+
+    //The Decimation and the Reduction of each copy are the ones of the signal whose GAM memory contains the copy
+    uint32 *copyDecimation = NULL_PTR(uint32 *);
+    uint32 *copyReduction = NULL_PTR(uint32 *);
+    uint32 *copySignalOffset = NULL_PTR(uint32 *);
+    bool *copyFound = NULL_PTR(bool *);
+    uint32 i;
+    if (ok) {
+        copyDecimation = new uint32[numberOfCopies];
+        copyReduction = new uint32[numberOfCopies];
+        copySignalOffset = new uint32[numberOfCopies];
+        copyFound = new bool[numberOfCopies];
+        for (i = 0u; i < numberOfCopies; i++) {
+            copyFound[i] = false;
+        }
+    }
+    char8 *gamMemory = static_cast<char8 *>(gamMemoryAddress);
+    uint32 s;
+    for (s = 0u; (s < numberOfSignals) && (ok); s++) {
+        if (dataSourceIn.IsSupportedBroker(direction, functionIdx, s, brokerClassName)) {
+            uint32 signalOffset = 0u;
+            uint32 decimation = 1u;
+            uint32 reduction = DECIMATION_REDUCTION_MEAN;
+            StreamString reductionName;
+            StreamString signalName;
+            ok = dataSourceIn.GetFunctionSignalAlias(direction, functionIdx, s, signalName);
+            if (ok) {
+                ok = dataSourceIn.GetFunctionSignalGAMMemoryOffset(direction, functionIdx, s, signalOffset);
+            }
+            if (ok) {
+                ok = dataSourceIn.GetFunctionSignalDecimation(direction, functionIdx, s, decimation);
+            }
+            if (ok) {
+                ok = (decimation > 0u);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The Decimation of the signal %s of %s shall be > 0", signalName.Buffer(), functionName);
+                }
+            }
+            if (ok) {
+                ok = dataSourceIn.GetFunctionSignalReduction(direction, functionIdx, s, reductionName);
+            }
+            if (ok) {
+                ok = GetDecimationReduction(reductionName, reduction);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The Reduction %s of the signal %s of %s shall be Last, Mean, Min, Max or Boxcar",
+                                 reductionName.Buffer(), signalName.Buffer(), functionName);
+                }
+            }
+            for (i = 0u; (i < numberOfCopies) && (ok); i++) {
+                /*lint -e{946} -e{947} the pointers belong to the same GAM memory.*/
+                uint32 copyOffset = static_cast<uint32>(static_cast<char8 *>(copyTable[i].gamPointer) - gamMemory);
+                if (copyOffset >= signalOffset) {
+                    if ((!copyFound[i]) || (signalOffset >= copySignalOffset[i])) {
+                        copyFound[i] = true;
+                        copySignalOffset[i] = signalOffset;
+                        copyDecimation[i] = decimation;
+                        copyReduction[i] = reduction;
+                    }
+                }
+            }
+        }
+    }
+    for (i = 0u; (i < numberOfCopies) && (ok); i++) {
+        ok = copyFound[i];
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not find the signal of the copy %d of %s", i, functionName);
+        }
+    }
+
+    //Group the signals by type, Decimation and Reduction, resolving the kernels only once
+    uint32 *copyGroup = NULL_PTR(uint32 *);
+    MemoryMapDecimatingBrokerGroup *candidates = NULL_PTR(MemoryMapDecimatingBrokerGroup *);
+    TypeDescriptor *groupTypes = NULL_PTR(TypeDescriptor *);
+    uint32 *groupBytes = NULL_PTR(uint32 *);
+    uint32 *groupAccumulatorSize = NULL_PTR(uint32 *);
+    if (ok) {
+        copyGroup = new uint32[numberOfCopies];
+        candidates = new MemoryMapDecimatingBrokerGroup[numberOfCopies];
+        groupTypes = new TypeDescriptor[numberOfCopies];
+        groupBytes = new uint32[numberOfCopies];
+        groupAccumulatorSize = new uint32[numberOfCopies];
+    }
+    uint32 g;
+    for (i = 0u; (i < numberOfCopies) && (ok); i++) {
+        bool found = false;
+        for (g = 0u; (g < numberOfGroups) && (!found); g++) {
+            found = ((groupTypes[g] == copyTable[i].type) && (candidates[g].decimation == copyDecimation[i]) && (candidates[g].reduction == copyReduction[i]));
+            if (found) {
+                copyGroup[i] = g;
+            }
+        }
+        if (!found) {
+            MemoryMapDecimatingBrokerGroup &candidate = candidates[numberOfGroups];
+            ok = FindDecimationKernels(copyTable[i].type, copyReduction[i], candidate.accumulateKernel, candidate.resultKernel,
+                                       groupAccumulatorSize[numberOfGroups]);
+            if (ok) {
+                groupTypes[numberOfGroups] = copyTable[i].type;
+                groupBytes[numberOfGroups] = 0u;
+                candidate.numberOfCopies = 0u;
+                candidate.decimation = copyDecimation[i];
+                candidate.reduction = copyReduction[i];
+                copyGroup[i] = numberOfGroups;
+                numberOfGroups++;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The type of the copy %d of %s cannot be decimated", i, functionName);
+            }
+        }
+        if (ok) {
+            candidates[copyGroup[i]].numberOfCopies++;
+            groupBytes[copyGroup[i]] += copyTable[i].copySize;
+        }
+    }
+    if ((ok) && (numberOfGroups > 0u)) {
+        groups = new MemoryMapDecimatingBrokerGroup[numberOfGroups];
+        for (g = 0u; g < numberOfGroups; g++) {
+            MemoryMapDecimatingBrokerGroup &group = groups[g];
+            uint32 byteSize = static_cast<uint32>(groupTypes[g].numberOfBits);
+            byteSize /= 8u;
+            group.accumulateKernel = candidates[g].accumulateKernel;
+            group.resultKernel = candidates[g].resultKernel;
+            group.decimation = candidates[g].decimation;
+            group.reduction = candidates[g].reduction;
+            group.copies = new uint32[candidates[g].numberOfCopies];
+            group.offsets = new uint32[candidates[g].numberOfCopies];
+            group.numberOfCopies = 0u;
+            group.numberOfElements = groupBytes[g] / byteSize;
+            group.counter = 0u;
+            group.samples = NULL_PTR(char8 *);
+            group.accumulator = NULL_PTR(float64 *);
+            group.result = NULL_PTR(char8 *);
+            if (group.accumulateKernel != NULL_PTR(MemoryMapDecimationAccumulateKernel)) {
+                uint32 accumulatorBytes = group.numberOfElements * groupAccumulatorSize[g];
+                group.accumulator = new float64[(accumulatorBytes / static_cast<uint32>(sizeof(float64))) + 1u];
+                if (candidates[g].numberOfCopies > 1u) {
+                    group.samples = new char8[groupBytes[g]];
+                    group.result = new char8[groupBytes[g]];
+                }
+            }
+        }
+        uint32 *offset = new uint32[numberOfGroups];
+        for (g = 0u; g < numberOfGroups; g++) {
+            offset[g] = 0u;
+        }
+        for (i = 0u; i < numberOfCopies; i++) {
+            g = copyGroup[i];
+            MemoryMapDecimatingBrokerGroup &group = groups[g];
+            group.copies[group.numberOfCopies] = i;
+            group.offsets[group.numberOfCopies] = offset[g];
+            group.numberOfCopies++;
+            offset[g] += copyTable[i].copySize;
+        }
+        delete[] offset;
+    }
+    if (copyDecimation != NULL_PTR(uint32 *)) {
+        delete[] copyDecimation;
+        delete[] copyReduction;
+        delete[] copySignalOffset;
+        delete[] copyFound;
+    }
+    if (copyGroup != NULL_PTR(uint32 *)) {
+        delete[] copyGroup;
+        delete[] candidates;
+        delete[] groupTypes;
+        delete[] groupBytes;
+        delete[] groupAccumulatorSize;
+    }
+    return ok;
+}
+
+/*lint -e{613} copyTable cannot be NULL as otherwise MemoryMapBroker::Init would have failed and this function would not be called*/
+void MemoryMapDecimatingBroker::Decimate(const bool toGAM) {
+    uint32 bufferOffset = dataSource->GetCurrentStateBuffer() * numberOfCopies;
+    uint32 g;
+    for (g = 0u; g < numberOfGroups; g++) {
+        MemoryMapDecimatingBrokerGroup &group = groups[g];
+        group.counter++;
+        uint32 c;
+        if (group.accumulateKernel != NULL_PTR(MemoryMapDecimationAccumulateKernel)) {
+            const void *samples;
+            if (group.numberOfCopies == 1u) {
+                //Accumulate directly from the source memory
+                uint32 i = group.copies[0u];
+                samples = (toGAM) ? (copyTable[bufferOffset + i].dataSourcePointer) : (copyTable[i].gamPointer);
+            }
+            else {
+                for (c = 0u; c < group.numberOfCopies; c++) {
+                    uint32 i = group.copies[c];
+                    const void *source = (toGAM) ? (copyTable[bufferOffset + i].dataSourcePointer) : (copyTable[i].gamPointer);
+                    MemoryOperationsHelper::CopyTagged(&group.samples[group.offsets[c]], source, copyTable[i].copySize, copyTable[i].fixedCopySize);
+                }
+                samples = group.samples;
+            }
+            group.accumulateKernel(group.accumulator, samples, group.numberOfElements, (group.counter == 1u));
+        }
+        if (group.counter >= group.decimation) {
+            group.counter = 0u;
+            if (group.resultKernel == NULL_PTR(MemoryMapDecimationResultKernel)) {
+                //Last: only the value of this cycle is copied
+                for (c = 0u; c < group.numberOfCopies; c++) {
+                    uint32 i = group.copies[c];
+                    if (toGAM) {
+                        MemoryOperationsHelper::CopyTagged(copyTable[i].gamPointer, copyTable[bufferOffset + i].dataSourcePointer, copyTable[i].copySize,
+                                                           copyTable[i].fixedCopySize);
+                    }
+                    else {
+                        MemoryOperationsHelper::CopyTagged(copyTable[bufferOffset + i].dataSourcePointer, copyTable[i].gamPointer, copyTable[i].copySize,
+                                                           copyTable[i].fixedCopySize);
+                    }
+                }
+            }
+            else if (group.numberOfCopies == 1u) {
+                //Write directly in the destination memory
+                uint32 i = group.copies[0u];
+                void *destination = (toGAM) ? (copyTable[i].gamPointer) : (copyTable[bufferOffset + i].dataSourcePointer);
+                group.resultKernel(destination, group.accumulator, group.numberOfElements, group.decimation);
+            }
+            else {
+                group.resultKernel(group.result, group.accumulator, group.numberOfElements, group.decimation);
+                for (c = 0u; c < group.numberOfCopies; c++) {
+                    uint32 i = group.copies[c];
+                    void *destination = (toGAM) ? (copyTable[i].gamPointer) : (copyTable[bufferOffset + i].dataSourcePointer);
+                    MemoryOperationsHelper::CopyTagged(destination, &group.result[group.offsets[c]], copyTable[i].copySize, copyTable[i].fixedCopySize);
+                }
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,217 @@
+/**
+ * @file MemoryMapDecimatingBroker.h
+ * @brief Header file for class MemoryMapDecimatingBroker
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MemoryMapDecimatingBroker
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MEMORYMAPDECIMATINGBROKER_H_
+#define MEMORYMAPDECIMATINGBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "MemoryMapBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The reductions of a MemoryMapDecimatingBroker.
+ */
+static const uint32 DECIMATION_REDUCTION_LAST = 0u;
+static const uint32 DECIMATION_REDUCTION_MEAN = 1u;
+static const uint32 DECIMATION_REDUCTION_MIN = 2u;
+static const uint32 DECIMATION_REDUCTION_MAX = 3u;
+static const uint32 DECIMATION_REDUCTION_BOXCAR = 4u;
+
+/**
+ * @brief Accumulates numberOfElements contiguous samples of a given type.
+ * @details If \a first the accumulator is (re)started with the samples.
+ */
+typedef void (*MemoryMapDecimationAccumulateKernel)(void * const accumulator,
+                                                    const void * const samples,
+                                                    const uint32 numberOfElements,
+                                                    const bool first);
+
+/**
+ * @brief Writes the reduced values of numberOfElements contiguous accumulated elements of a given type.
+ */
+typedef void (*MemoryMapDecimationResultKernel)(void * const result,
+                                                const void * const accumulator,
+                                                const uint32 numberOfElements,
+                                                const uint32 decimation);
+
+/**
+ * @brief The signals of a MemoryMapDecimatingBroker with the same type, Decimation and Reduction.
+ * @details The samples of all the signals in the group are accumulated contiguously, so that the kernels (selected once for the type and
+ * the reduction) process all the elements of all the signals of the group with a single call.
+ */
+struct MemoryMapDecimatingBrokerGroup {
+    /**
+     * The indexes in the copy table of the signals of the group.
+     */
+    uint32 *copies;
+
+    /**
+     * The offset in bytes of each signal in samples and result.
+     */
+    uint32 *offsets;
+
+    /**
+     * The number of signals in the group.
+     */
+    uint32 numberOfCopies;
+
+    /**
+     * The total number of elements of the signals in the group.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * The number of cycles reduced into one value.
+     */
+    uint32 decimation;
+
+    /**
+     * The number of cycles accumulated since the last reduced value was handed over.
+     */
+    uint32 counter;
+
+    /**
+     * One of the DECIMATION_REDUCTION values.
+     */
+    uint32 reduction;
+
+    /**
+     * The samples of the current cycle (only used if numberOfCopies > 1).
+     */
+    char8 *samples;
+
+    /**
+     * The accumulated values (float64 for the Mean and the Boxcar, the signal type for the Min and the Max). Allocated as float64 so that
+     * it is aligned for any type.
+     */
+    float64 *accumulator;
+
+    /**
+     * The reduced values (only used if numberOfCopies > 1).
+     */
+    char8 *result;
+
+    /**
+     * The kernel that accumulates the samples (NULL for the Last reduction).
+     */
+    MemoryMapDecimationAccumulateKernel accumulateKernel;
+
+    /**
+     * The kernel that writes the reduced values (NULL for the Last reduction).
+     */
+    MemoryMapDecimationResultKernel resultKernel;
+};
+
+/**
+ * @brief Memory mapped BrokerI implementation which reduces the signals over a number of cycles.
+ * @details A GAM signal asks for the decimation by declaring the number of cycles to be reduced into one value and the reduction, e.g.
+ * <pre>
+ * CurrentMean = {
+ *     DataSource = DDB1
+ *     Type = float32
+ *     Decimation = 10
+ *     Reduction = Mean //Optional. Last|Mean|Min|Max|Boxcar. Default = Mean.
+ * }
+ * </pre>
+ * Every Execute accumulates the signal and, once every Decimation cycles, the reduced value is handed over to the other side (see
+ * MemoryMapDecimatingInputBroker and MemoryMapDecimatingOutputBroker). In between the other side keeps the previous reduced value.
+ * The reductions are:
+ * - Last: the value of the last cycle (no arithmetic, only one copy every Decimation cycles);
+ * - Mean: the mean of the Decimation cycles (computed in float64);
+ * - Min: the minimum of the Decimation cycles;
+ * - Max: the maximum of the Decimation cycles;
+ * - Boxcar: the sum of the Decimation cycles (boxcar integration, computed in float64).
+ *
+ * The signals are grouped by type, Decimation and Reduction, and each group is accumulated, for all its signals and elements at once,
+ * by a kernel selected at Init. The float32 and float64 kernels are vectorised with NEON when available (__ARM_NEON), or with SVE if the
+ * processor implements it (see CPUFeatures).
+ * Each element (also of array signals and of each range) is reduced independently. Only the numeric types are supported.
+ */
+class DLL_API MemoryMapDecimatingBroker: public MemoryMapBroker {
+
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetNumberOfCopies() == 0
+     */
+    MemoryMapDecimatingBroker();
+
+    /**
+     * @brief Destructor. Frees the groups.
+     */
+    virtual ~MemoryMapDecimatingBroker();
+
+    /**
+     * @brief See MemoryMapBroker::Init.
+     * @details Also reads the Decimation and the Reduction of each signal (see DataSourceI::GetFunctionSignalDecimation and
+     * DataSourceI::GetFunctionSignalReduction) and groups the signals.
+     * @return true if MemoryMapBroker::Init returns true, all the Decimation are > 0, all the Reduction are valid and all the types are numeric.
+     */
+    virtual bool Init(const SignalDirection direction,
+                      DataSourceI &dataSourceIn,
+                      const char8 *const functionName,
+                      void *const gamMemoryAddress);
+
+protected:
+
+    /**
+     * @brief Accumulates all the groups and hands over the reduced values of the groups which completed their Decimation.
+     * @param[in] toGAM true if the signals are read from the DataSourceI and handed over to the GAM (input), false if they are read from
+     * the GAM and handed over to the DataSourceI (output).
+     */
+    void Decimate(const bool toGAM);
+
+private:
+
+    /**
+     * The signals grouped by type, Decimation and Reduction (see MemoryMapDecimatingBrokerGroup).
+     */
+    MemoryMapDecimatingBrokerGroup *groups;
+
+    /**
+     * The number of groups.
+     */
+    uint32 numberOfGroups;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MEMORYMAPDECIMATINGBROKER_H_ */
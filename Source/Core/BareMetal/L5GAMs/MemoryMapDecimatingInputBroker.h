@@ -0,0 +1,73 @@
+/**
+ * @file MemoryMapDecimatingInputBroker.h
+ * @brief Header file for class MemoryMapDecimatingInputBroker
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MemoryMapDecimatingInputBroker
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MEMORYMAPDECIMATINGINPUTBROKER_H_
+#define MEMORYMAPDECIMATINGINPUTBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MemoryMapDecimatingBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Input MemoryMapDecimatingBroker implementation.
+ * @details This class reduces all the signals declared on a MemoryMapDecimatingBroker
+ * from the DataSourceI memory to the GAM memory.
+ */
+class DLL_API MemoryMapDecimatingInputBroker: public MemoryMapDecimatingBroker {
+public:
+    CLASS_REGISTER_DECLARATION()
+    /**
+     * @brief Default constructor. NOOP.
+     */
+    MemoryMapDecimatingInputBroker();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~MemoryMapDecimatingInputBroker();
+
+    /**
+     * @brief Accumulates the signals read from the DataSourceI memory and, once every Decimation cycles, writes the reduced values in the GAM memory.
+     * @details This implementation supports multi-state buffers and will query the DataSource for the GetCurrentStateBuffer.
+     * @return true.
+     */
+    virtual bool Execute();
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MEMORYMAPDECIMATINGINPUTBROKER_H_ */
@@ -0,0 +1,73 @@
+/**
+ * @file MemoryMapDecimatingOutputBroker.h
+ * @brief Header file for class MemoryMapDecimatingOutputBroker
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MemoryMapDecimatingOutputBroker
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MEMORYMAPDECIMATINGOUTPUTBROKER_H_
+#define MEMORYMAPDECIMATINGOUTPUTBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MemoryMapDecimatingBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Output MemoryMapDecimatingBroker implementation.
+ * @details This class reduces all the signals declared on a MemoryMapDecimatingBroker
+ * from the GAM memory to the DataSourceI memory.
+ */
+class DLL_API MemoryMapDecimatingOutputBroker: public MemoryMapDecimatingBroker {
+public:
+    CLASS_REGISTER_DECLARATION()
+    /**
+     * @brief Default constructor. NOOP.
+     */
+    MemoryMapDecimatingOutputBroker();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~MemoryMapDecimatingOutputBroker();
+
+    /**
+     * @brief Accumulates the signals written by the GAM and, once every Decimation cycles, writes the reduced values in the DataSourceI memory.
+     * @details This implementation supports multi-state buffers and will query the DataSource for the GetCurrentStateBuffer.
+     * @return true.
+     */
+    virtual bool Execute();
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MEMORYMAPDECIMATINGOUTPUTBROKER_H_ */
@@ -42,7 +42,7 @@
 namespace MARTe {
 MemoryMapInputBroker::MemoryMapInputBroker() :
         MemoryMapBroker() {
-
+    gatherCopyTable = true;
 }
 
 MemoryMapInputBroker::~MemoryMapInputBroker() {
@@ -53,14 +53,21 @@ bool MemoryMapInputBroker::Execute() {
     uint32 n;
     /*lint -e{613} null pointer checked before.*/
     uint32 i = dataSource->GetCurrentStateBuffer();
-    bool ret = true;
     if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) {
-        for (n = 0u; (n < numberOfCopies) && (ret); n++) {
+        //The pointers were validated by MemoryMapBroker::Init
+        for (n = 0u; n < numberOfCopies; n++) {
             uint32 dataSourceIndex = ((i * numberOfCopies) + n);
-            ret = MemoryOperationsHelper::Copy(copyTable[n].gamPointer, copyTable[dataSourceIndex].dataSourcePointer, copyTable[n].copySize);
+            if (copyTable[n].numberOfElements == 1u) {
+                MemoryOperationsHelper::CopyTagged(copyTable[n].gamPointer, copyTable[dataSourceIndex].dataSourcePointer, copyTable[n].copySize,
+                                                   copyTable[n].fixedCopySize);
+            }
+            else {
+                MemoryOperationsHelper::GatherStrided(copyTable[n].gamPointer, copyTable[dataSourceIndex].dataSourcePointer, copyTable[n].copySize,
+                                                      copyTable[n].dataSourceStride, copyTable[n].numberOfElements);
+            }
         }
     }
-    return ret;
+    return true;
 }
 
 CLASS_REGISTER(MemoryMapInputBroker, "1.0")
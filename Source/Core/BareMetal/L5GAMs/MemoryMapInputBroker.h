@@ -41,12 +41,13 @@ namespace MARTe {
  * @brief Input MemoryMapBroker implementation.
  * @details This class copies all the signals declared on a MemoryMapBroker
  * from the DataSourceI memory to the GAM memory.
+ * @details The equally spaced signal ranges are gathered with a single strided copy (see MemoryMapBroker).
  */
 class DLL_API MemoryMapInputBroker: public MemoryMapBroker {
 public:
     CLASS_REGISTER_DECLARATION()
     /**
-     * @brief Default constructor. NOOP.
+     * @brief Default constructor. Enables the strided entries of the copy table.
      */
     MemoryMapInputBroker();
 
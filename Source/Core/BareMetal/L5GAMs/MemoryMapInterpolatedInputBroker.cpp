@@ -25,16 +25,403 @@
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
 
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "CPUFeatures.h"
 #include "MemoryMapInterpolatedInputBroker.h"
 
+//After CPUFeatures.h, which tells if the compiler can generate the SVE kernels
+#ifdef MARTe2_SVE_KERNELS
+#include <arm_sve.h>
+#endif
+
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace {
+
+using namespace MARTe;
+
+/**
+ * The maximum number of groups: (u)int{8,16,32,64} and float{32,64}.
+ */
+const uint32 MAX_INTERPOLATION_GROUPS = 10u;
+
+/**
+ * @brief Vectorised part of the slopes computation.
+ * @return the number of elements computed (the remaining ones are computed by the scalar loop).
+ */
+template<typename T>
+inline uint32 VectorSlopes(float64 * const m,
+                           const T * const y0,
+                           const T * const y1,
+                           const uint32 numberOfElements,
+                           const float64 dx) {
+    return 0u;
+}
+
+/**
+ * @brief Vectorised part of the interpolation.
+ * @return the number of elements computed (the remaining ones are computed by the scalar loop).
+ */
+template<typename T>
+inline uint32 VectorInterpolate(T * const y,
+                                const T * const y0,
+                                const float64 * const m,
+                                const uint32 numberOfElements,
+                                const float64 dt) {
+    return 0u;
+}
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+
+inline uint32 VectorSlopes(float64 * const m,
+                           const float32 * const y0,
+                           const float32 * const y1,
+                           const uint32 numberOfElements,
+                           const float64 dx) {
+    float64x2_t vdx = vdupq_n_f64(dx);
+    uint32 i = 0u;
+    while ((i + 4u) <= numberOfElements) {
+        float32x4_t a = vld1q_f32(&y0[i]);
+        float32x4_t b = vld1q_f32(&y1[i]);
+        float64x2_t low = vsubq_f64(vcvt_f64_f32(vget_low_f32(b)), vcvt_f64_f32(vget_low_f32(a)));
+        float64x2_t high = vsubq_f64(vcvt_high_f64_f32(b), vcvt_high_f64_f32(a));
+        vst1q_f64(&m[i], vdivq_f64(low, vdx));
+        vst1q_f64(&m[i + 2u], vdivq_f64(high, vdx));
+        i += 4u;
+    }
+    return i;
+}
+
+inline uint32 VectorSlopes(float64 * const m,
+                           const float64 * const y0,
+                           const float64 * const y1,
+                           const uint32 numberOfElements,
+                           const float64 dx) {
+    float64x2_t vdx = vdupq_n_f64(dx);
+    uint32 i = 0u;
+    while ((i + 4u) <= numberOfElements) {
+        float64x2_t low = vsubq_f64(vld1q_f64(&y1[i]), vld1q_f64(&y0[i]));
+        float64x2_t high = vsubq_f64(vld1q_f64(&y1[i + 2u]), vld1q_f64(&y0[i + 2u]));
+        vst1q_f64(&m[i], vdivq_f64(low, vdx));
+        vst1q_f64(&m[i + 2u], vdivq_f64(high, vdx));
+        i += 4u;
+    }
+    return i;
+}
+
+/*
+ * The multiplication and the addition are not fused, so that the results are the same as the ones of the scalar loop.
+ */
+inline uint32 VectorInterpolate(float32 * const y,
+                                const float32 * const y0,
+                                const float64 * const m,
+                                const uint32 numberOfElements,
+                                const float64 dt) {
+    float64x2_t vdt = vdupq_n_f64(dt);
+    uint32 i = 0u;
+    while ((i + 4u) <= numberOfElements) {
+        float32x4_t a = vld1q_f32(&y0[i]);
+        float64x2_t low = vaddq_f64(vcvt_f64_f32(vget_low_f32(a)), vmulq_f64(vld1q_f64(&m[i]), vdt));
+        float64x2_t high = vaddq_f64(vcvt_high_f64_f32(a), vmulq_f64(vld1q_f64(&m[i + 2u]), vdt));
+        vst1q_f32(&y[i], vcvt_high_f32_f64(vcvt_f32_f64(low), high));
+        i += 4u;
+    }
+    return i;
+}
+
+inline uint32 VectorInterpolate(float64 * const y,
+                                const float64 * const y0,
+                                const float64 * const m,
+                                const uint32 numberOfElements,
+                                const float64 dt) {
+    float64x2_t vdt = vdupq_n_f64(dt);
+    uint32 i = 0u;
+    while ((i + 4u) <= numberOfElements) {
+        vst1q_f64(&y[i], vaddq_f64(vld1q_f64(&y0[i]), vmulq_f64(vld1q_f64(&m[i]), vdt)));
+        vst1q_f64(&y[i + 2u], vaddq_f64(vld1q_f64(&y0[i + 2u]), vmulq_f64(vld1q_f64(&m[i + 2u]), vdt)));
+        i += 4u;
+    }
+    return i;
+}
+
+#endif
+
+/**
+ * @brief SVE slopes computation. This generic version falls back to VectorSlopes.
+ * @return the number of elements computed (the SVE overloads compute all the elements).
+ */
+template<typename T>
+inline uint32 SVESlopes(float64 * const m,
+                        const T * const y0,
+                        const T * const y1,
+                        const uint32 numberOfElements,
+                        const float64 dx) {
+    return VectorSlopes(m, y0, y1, numberOfElements, dx);
+}
+
+/**
+ * @brief SVE interpolation. This generic version falls back to VectorInterpolate.
+ * @return the number of elements computed (the SVE overloads compute all the elements).
+ */
+template<typename T>
+inline uint32 SVEInterpolate(T * const y,
+                             const T * const y0,
+                             const float64 * const m,
+                             const uint32 numberOfElements,
+                             const float64 dt) {
+    return VectorInterpolate(y, y0, m, numberOfElements, dt);
+}
+
+#ifdef MARTe2_SVE_KERNELS
+
+/*
+ * The float32 are loaded (zero extended) in the low half of the 64 bit lanes, converted to float64 from there and, as with NEON,
+ * the multiplication and the addition are not fused.
+ */
+__attribute__((target("+sve")))
+uint32 SVESlopes(float64 * const m,
+                 const float32 * const y0,
+                 const float32 * const y1,
+                 const uint32 numberOfElements,
+                 const float64 dx) {
+    /*lint -e{9176} see above*/
+    const uint32 * const a = reinterpret_cast<const uint32 *>(y0);
+    /*lint -e{9176} see above*/
+    const uint32 * const b = reinterpret_cast<const uint32 *>(y1);
+    uint32 i = 0u;
+    svbool_t pg = svwhilelt_b64(i, numberOfElements);
+    while (svptest_any(svptrue_b8(), pg)) {
+        svfloat64_t va = svcvt_f64_f32_x(pg, svreinterpret_f32_u64(svld1uw_u64(pg, &a[i])));
+        svfloat64_t vb = svcvt_f64_f32_x(pg, svreinterpret_f32_u64(svld1uw_u64(pg, &b[i])));
+        svst1_f64(pg, &m[i], svdiv_n_f64_x(pg, svsub_f64_x(pg, vb, va), dx));
+        i += static_cast<uint32>(svcntd());
+        pg = svwhilelt_b64(i, numberOfElements);
+    }
+    return numberOfElements;
+}
+
+__attribute__((target("+sve")))
+uint32 SVESlopes(float64 * const m,
+                 const float64 * const y0,
+                 const float64 * const y1,
+                 const uint32 numberOfElements,
+                 const float64 dx) {
+    uint32 i = 0u;
+    svbool_t pg = svwhilelt_b64(i, numberOfElements);
+    while (svptest_any(svptrue_b8(), pg)) {
+        svfloat64_t d = svsub_f64_x(pg, svld1_f64(pg, &y1[i]), svld1_f64(pg, &y0[i]));
+        svst1_f64(pg, &m[i], svdiv_n_f64_x(pg, d, dx));
+        i += static_cast<uint32>(svcntd());
+        pg = svwhilelt_b64(i, numberOfElements);
+    }
+    return numberOfElements;
+}
+
+__attribute__((target("+sve")))
+uint32 SVEInterpolate(float32 * const y,
+                      const float32 * const y0,
+                      const float64 * const m,
+                      const uint32 numberOfElements,
+                      const float64 dt) {
+    /*lint -e{9176} see SVESlopes*/
+    const uint32 * const a = reinterpret_cast<const uint32 *>(y0);
+    /*lint -e{9176} the float32 results are in the low half of the 64 bit lanes*/
+    uint32 * const out = reinterpret_cast<uint32 *>(y);
+    uint32 i = 0u;
+    svbool_t pg = svwhilelt_b64(i, numberOfElements);
+    while (svptest_any(svptrue_b8(), pg)) {
+        svfloat64_t va = svcvt_f64_f32_x(pg, svreinterpret_f32_u64(svld1uw_u64(pg, &a[i])));
+        svfloat64_t r = svadd_f64_x(pg, va, svmul_n_f64_x(pg, svld1_f64(pg, &m[i]), dt));
+        svst1w_u64(pg, &out[i], svreinterpret_u64_f32(svcvt_f32_f64_x(pg, r)));
+        i += static_cast<uint32>(svcntd());
+        pg = svwhilelt_b64(i, numberOfElements);
+    }
+    return numberOfElements;
+}
+
+__attribute__((target("+sve")))
+uint32 SVEInterpolate(float64 * const y,
+                      const float64 * const y0,
+                      const float64 * const m,
+                      const uint32 numberOfElements,
+                      const float64 dt) {
+    uint32 i = 0u;
+    svbool_t pg = svwhilelt_b64(i, numberOfElements);
+    while (svptest_any(svptrue_b8(), pg)) {
+        svfloat64_t r = svadd_f64_x(pg, svld1_f64(pg, &y0[i]), svmul_n_f64_x(pg, svld1_f64(pg, &m[i]), dt));
+        svst1_f64(pg, &y[i], r);
+        i += static_cast<uint32>(svcntd());
+        pg = svwhilelt_b64(i, numberOfElements);
+    }
+    return numberOfElements;
+}
+
+#endif
+
+/**
+ * @brief The vector instructions of the baseline of the architecture (see VectorSlopes and VectorInterpolate).
+ */
+struct BaselineInterpolationVectors {
+    template<typename T>
+    static inline uint32 Slopes(float64 * const m,
+                                const T * const y0,
+                                const T * const y1,
+                                const uint32 numberOfElements,
+                                const float64 dx) {
+        return VectorSlopes(m, y0, y1, numberOfElements, dx);
+    }
+
+    template<typename T>
+    static inline uint32 Interpolate(T * const y,
+                                     const T * const y0,
+                                     const float64 * const m,
+                                     const uint32 numberOfElements,
+                                     const float64 dt) {
+        return VectorInterpolate(y, y0, m, numberOfElements, dt);
+    }
+};
+
+/**
+ * @brief The SVE instructions (see SVESlopes and SVEInterpolate). Only used if CPUFeatures::Has(CPU_FEATURE_SVE).
+ */
+struct SVEInterpolationVectors {
+    template<typename T>
+    static inline uint32 Slopes(float64 * const m,
+                                const T * const y0,
+                                const T * const y1,
+                                const uint32 numberOfElements,
+                                const float64 dx) {
+        return SVESlopes(m, y0, y1, numberOfElements, dx);
+    }
+
+    template<typename T>
+    static inline uint32 Interpolate(T * const y,
+                                     const T * const y0,
+                                     const float64 * const m,
+                                     const uint32 numberOfElements,
+                                     const float64 dt) {
+        return SVEInterpolate(y, y0, m, numberOfElements, dt);
+    }
+};
+
+/**
+ * @brief MemoryMapInterpolationSlopesKernel for the type T.
+ */
+template<typename T, typename Vectors>
+void InterpolationSlopes(float64 * const m,
+                         const void * const y0,
+                         const void * const y1,
+                         const uint32 numberOfElements,
+                         const float64 dx) {
+    const T * const y0t = static_cast<const T *>(y0);
+    const T * const y1t = static_cast<const T *>(y1);
+    uint32 i = Vectors::Slopes(m, y0t, y1t, numberOfElements, dx);
+    for (; i < numberOfElements; i++) {
+        //The difference is computed in float64 so that the unsigned types do not wrap around
+        m[i] = (static_cast<float64>(y1t[i]) - static_cast<float64>(y0t[i])) / dx;
+    }
+}
+
+/**
+ * @brief MemoryMapInterpolationKernel for the type T.
+ */
+template<typename T, typename Vectors>
+void Interpolation(void * const y,
+                   const void * const y0,
+                   const float64 * const m,
+                   const uint32 numberOfElements,
+                   const float64 dt) {
+    T * const yt = static_cast<T *>(y);
+    const T * const y0t = static_cast<const T *>(y0);
+    uint32 i = Vectors::Interpolate(yt, y0t, m, numberOfElements, dt);
+    for (; i < numberOfElements; i++) {
+        yt[i] = static_cast<T>(static_cast<float64>(y0t[i]) + (m[i] * dt));
+    }
+}
+
+/**
+ * @brief Selects the kernels for a type.
+ * @details The float32 and float64 kernels use SVE if the processor implements it.
+ * @return false if the type cannot be interpolated.
+ */
+bool FindInterpolationKernels(const TypeDescriptor &type,
+                              MemoryMapInterpolationSlopesKernel &slopesKernel,
+                              MemoryMapInterpolationKernel &interpolationKernel) {
+    bool ok = true;
+#ifdef MARTe2_SVE_KERNELS
+    const bool useSVE = CPUFeatures::Has(CPUFeatures::CPU_FEATURE_SVE);
+#else
+    const bool useSVE = false;
+#endif
+    if (type == UnsignedInteger8Bit) {
+        slopesKernel = &InterpolationSlopes<uint8, BaselineInterpolationVectors>;
+        interpolationKernel = &Interpolation<uint8, BaselineInterpolationVectors>;
+    }
+    else if (type == UnsignedInteger16Bit) {
+        slopesKernel = &InterpolationSlopes<uint16, BaselineInterpolationVectors>;
+        interpolationKernel = &Interpolation<uint16, BaselineInterpolationVectors>;
+    }
+    else if (type == UnsignedInteger32Bit) {
+        slopesKernel = &InterpolationSlopes<uint32, BaselineInterpolationVectors>;
+        interpolationKernel = &Interpolation<uint32, BaselineInterpolationVectors>;
+    }
+    else if (type == UnsignedInteger64Bit) {
+        slopesKernel = &InterpolationSlopes<uint64, BaselineInterpolationVectors>;
+        interpolationKernel = &Interpolation<uint64, BaselineInterpolationVectors>;
+    }
+    else if (type == SignedInteger8Bit) {
+        slopesKernel = &InterpolationSlopes<int8, BaselineInterpolationVectors>;
+        interpolationKernel = &Interpolation<int8, BaselineInterpolationVectors>;
+    }
+    else if (type == SignedInteger16Bit) {
+        slopesKernel = &InterpolationSlopes<int16, BaselineInterpolationVectors>;
+        interpolationKernel = &Interpolation<int16, BaselineInterpolationVectors>;
+    }
+    else if (type == SignedInteger32Bit) {
+        slopesKernel = &InterpolationSlopes<int32, BaselineInterpolationVectors>;
+        interpolationKernel = &Interpolation<int32, BaselineInterpolationVectors>;
+    }
+    else if (type == SignedInteger64Bit) {
+        slopesKernel = &InterpolationSlopes<int64, BaselineInterpolationVectors>;
+        interpolationKernel = &Interpolation<int64, BaselineInterpolationVectors>;
+    }
+    else if (type == Float32Bit) {
+        if (useSVE) {
+            slopesKernel = &InterpolationSlopes<float32, SVEInterpolationVectors>;
+            interpolationKernel = &Interpolation<float32, SVEInterpolationVectors>;
+        }
+        else {
+            slopesKernel = &InterpolationSlopes<float32, BaselineInterpolationVectors>;
+            interpolationKernel = &Interpolation<float32, BaselineInterpolationVectors>;
+        }
+    }
+    else if (type == Float64Bit) {
+        if (useSVE) {
+            slopesKernel = &InterpolationSlopes<float64, SVEInterpolationVectors>;
+            interpolationKernel = &Interpolation<float64, SVEInterpolationVectors>;
+        }
+        else {
+            slopesKernel = &InterpolationSlopes<float64, BaselineInterpolationVectors>;
+            interpolationKernel = &Interpolation<float64, BaselineInterpolationVectors>;
+        }
+    }
+    else {
+        ok = false;
+    }
+    return ok;
+}
+
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -47,33 +434,25 @@ MemoryMapInterpolatedInputBroker::MemoryMapInterpolatedInputBroker() :
     interpolatedXAxis = 0LLU;
     reset = false;
     dataSourceXAxis = NULL_PTR(uint64*);
-    m = NULL_PTR(float64*);
-    y0 = NULL_PTR(void**);
-    y1 = NULL_PTR(void**);
-    numberOfElements = NULL_PTR(uint32*);
+    groups = NULL_PTR(MemoryMapInterpolatedInputBrokerGroup *);
+    numberOfGroups = 0u;
+    //The interpolation is performed signal by signal (each with its own type)
+    coalesceCopyTable = false;
 }
 
 /*lint -e{1551} memory is freed in the destructor*/
 MemoryMapInterpolatedInputBroker::~MemoryMapInterpolatedInputBroker() {
-    if (numberOfElements != NULL_PTR(uint32*)) {
-        delete numberOfElements;
-    }
-    if (y0 != NULL_PTR(void**)) {
-        uint32 i;
-        for (i = 0u; i < numberOfCopies; i++) {
-            GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(y0[i]);
+    if (groups != NULL_PTR(MemoryMapInterpolatedInputBrokerGroup *)) {
+        uint32 g;
+        for (g = 0u; g < numberOfGroups; g++) {
+            delete[] groups[g].copies;
+            delete[] groups[g].offsets;
+            delete[] groups[g].y0;
+            delete[] groups[g].y1;
+            delete[] groups[g].y;
+            delete[] groups[g].m;
         }
-        delete y0;
-    }
-    if (y1 != NULL_PTR(void**)) {
-        uint32 i;
-        for (i = 0u; i < numberOfCopies; i++) {
-            GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(y1[i]);
-        }
-        delete y1;
-    }
-    if (m != NULL_PTR(float64*)) {
-        delete m;
+        delete[] groups;
     }
     /*lint -e{1740} the dataSourceXAxis is freed by the DataSourceI*/
 }
@@ -84,22 +463,90 @@ bool MemoryMapInterpolatedInputBroker::Init(const SignalDirection direction,
                                             void *const gamMemoryAddress) {
     bool ok = MemoryMapBroker::Init(direction, dataSourceIn, functionName, gamMemoryAddress);
 
+    //Group the signals by type, resolving the kernels only once
+    TypeDescriptor groupTypes[MAX_INTERPOLATION_GROUPS];
+    uint32 groupCopies[MAX_INTERPOLATION_GROUPS];
+    uint32 groupBytes[MAX_INTERPOLATION_GROUPS];
+    MemoryMapInterpolationSlopesKernel groupSlopesKernels[MAX_INTERPOLATION_GROUPS];
+    MemoryMapInterpolationKernel groupKernels[MAX_INTERPOLATION_GROUPS];
+    uint32 *copyGroup = NULL_PTR(uint32 *);
     if (ok) {
-        numberOfElements = new uint32[numberOfCopies];
-        m = new float64[numberOfCopies];
-        y0 = new void*[numberOfCopies];
-        y1 = new void*[numberOfCopies];
+        copyGroup = new uint32[numberOfCopies];
     }
     uint32 i;
+    uint32 g;
     /*lint -e{613} copyTable cannot be NULL as otherwise MemoryMapBroker::Init would have failed => ok = false*/
     for (i = 0u; (i < numberOfCopies) && (ok); i++) {
-        uint32 byteSize = static_cast<uint32>(copyTable[i].type.numberOfBits);
-        byteSize /= 8u;
-        numberOfElements[i] = copyTable[i].copySize;
-        numberOfElements[i] /= byteSize;
-        m[i] = 0.;
-        y0[i] = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(copyTable[i].copySize);
-        y1[i] = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(copyTable[i].copySize);
+        copyGroup[i] = MAX_INTERPOLATION_GROUPS;
+        bool found = false;
+        for (g = 0u; (g < numberOfGroups) && (!found); g++) {
+            found = (groupTypes[g] == copyTable[i].type);
+            if (found) {
+                copyGroup[i] = g;
+            }
+        }
+        if (!found) {
+            MemoryMapInterpolationSlopesKernel slopesKernel = NULL_PTR(MemoryMapInterpolationSlopesKernel);
+            MemoryMapInterpolationKernel interpolationKernel = NULL_PTR(MemoryMapInterpolationKernel);
+            if (FindInterpolationKernels(copyTable[i].type, slopesKernel, interpolationKernel)) {
+                groupTypes[numberOfGroups] = copyTable[i].type;
+                groupCopies[numberOfGroups] = 0u;
+                groupBytes[numberOfGroups] = 0u;
+                groupSlopesKernels[numberOfGroups] = slopesKernel;
+                groupKernels[numberOfGroups] = interpolationKernel;
+                copyGroup[i] = numberOfGroups;
+                numberOfGroups++;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::Warning, "The type of the signal %d cannot be interpolated and will not be copied", i);
+            }
+        }
+        if (copyGroup[i] < MAX_INTERPOLATION_GROUPS) {
+            groupCopies[copyGroup[i]]++;
+            groupBytes[copyGroup[i]] += copyTable[i].copySize;
+        }
+    }
+    if ((ok) && (numberOfGroups > 0u)) {
+        groups = new MemoryMapInterpolatedInputBrokerGroup[numberOfGroups];
+        for (g = 0u; g < numberOfGroups; g++) {
+            uint32 byteSize = static_cast<uint32>(groupTypes[g].numberOfBits);
+            byteSize /= 8u;
+            groups[g].copies = new uint32[groupCopies[g]];
+            groups[g].offsets = new uint32[groupCopies[g]];
+            groups[g].numberOfCopies = 0u;
+            groups[g].numberOfElements = groupBytes[g] / byteSize;
+            groups[g].y0 = new char8[groupBytes[g]];
+            groups[g].y1 = new char8[groupBytes[g]];
+            groups[g].y = new char8[groupBytes[g]];
+            groups[g].m = new float64[groups[g].numberOfElements];
+            groups[g].slopesKernel = groupSlopesKernels[g];
+            groups[g].interpolationKernel = groupKernels[g];
+            ok = MemoryOperationsHelper::Set(groups[g].y0, '\0', groupBytes[g]);
+            if (ok) {
+                ok = MemoryOperationsHelper::Set(groups[g].y1, '\0', groupBytes[g]);
+            }
+            uint32 e;
+            for (e = 0u; e < groups[g].numberOfElements; e++) {
+                groups[g].m[e] = 0.;
+            }
+        }
+        uint32 offset[MAX_INTERPOLATION_GROUPS];
+        for (g = 0u; g < numberOfGroups; g++) {
+            offset[g] = 0u;
+        }
+        for (i = 0u; i < numberOfCopies; i++) {
+            g = copyGroup[i];
+            if (g < MAX_INTERPOLATION_GROUPS) {
+                MemoryMapInterpolatedInputBrokerGroup &group = groups[g];
+                group.copies[group.numberOfCopies] = i;
+                group.offsets[group.numberOfCopies] = offset[g];
+                group.numberOfCopies++;
+                offset[g] += copyTable[i].copySize;
+            }
+        }
+    }
+    if (copyGroup != NULL_PTR(uint32 *)) {
+        delete[] copyGroup;
     }
 
     return ok;
@@ -116,7 +563,6 @@ void MemoryMapInterpolatedInputBroker::ChangeInterpolationSegments() {
     if (dataSourceXAxis != NULL_PTR(uint64*)) {
         x0 = x1;
         x1 = *dataSourceXAxis;
-        uint32 i;
         uint64 dt;
         if (x1 == x0) {
             //kick-start the first assignment of y0
@@ -125,41 +571,21 @@ void MemoryMapInterpolatedInputBroker::ChangeInterpolationSegments() {
         else {
             dt = (x1 - x0);
         }
+        float64 dx = static_cast<float64>(dt);
 
-        for (i = 0u; (i < numberOfCopies); i++) {
-            if (copyTable[i].type == UnsignedInteger8Bit) {
-                ChangeInterpolationSegment<uint8>(i, dt);
-            }
-            else if (copyTable[i].type == UnsignedInteger16Bit) {
-                ChangeInterpolationSegment<uint16>(i, dt);
-            }
-            else if (copyTable[i].type == UnsignedInteger32Bit) {
-                ChangeInterpolationSegment<uint32>(i, dt);
-            }
-            else if (copyTable[i].type == UnsignedInteger64Bit) {
-                ChangeInterpolationSegment<uint64>(i, dt);
-            }
-            else if (copyTable[i].type == SignedInteger8Bit) {
-                ChangeInterpolationSegment<int8>(i, dt);
-            }
-            else if (copyTable[i].type == SignedInteger16Bit) {
-                ChangeInterpolationSegment<int16>(i, dt);
-            }
-            else if (copyTable[i].type == SignedInteger32Bit) {
-                ChangeInterpolationSegment<int32>(i, dt);
-            }
-            else if (copyTable[i].type == SignedInteger64Bit) {
-                ChangeInterpolationSegment<int64>(i, dt);
-            }
-            else if (copyTable[i].type == Float32Bit) {
-                ChangeInterpolationSegment<float32>(i, dt);
-            }
-            else if (copyTable[i].type == Float64Bit) {
-                ChangeInterpolationSegment<float64>(i, dt);
-            }
-            else {
-                //Unreachable?
+        uint32 g;
+        for (g = 0u; g < numberOfGroups; g++) {
+            MemoryMapInterpolatedInputBrokerGroup &group = groups[g];
+            //The new y0 is the old y1, which is then overwritten with the data source values
+            char8 *swap = group.y0;
+            group.y0 = group.y1;
+            group.y1 = swap;
+            uint32 c;
+            for (c = 0u; c < group.numberOfCopies; c++) {
+                uint32 i = group.copies[c];
+                (void) MemoryOperationsHelper::Copy(&group.y1[group.offsets[c]], copyTable[i].dataSourcePointer, copyTable[i].copySize);
             }
+            group.slopesKernel(group.m, group.y0, group.y1, group.numberOfElements, dx);
         }
     }
 }
@@ -211,39 +637,22 @@ bool MemoryMapInterpolatedInputBroker::Execute() {
             ChangeInterpolationSegments();
         }
 
-        for (i = 0u; (i < numberOfCopies) && (ok); i++) {
-            if (copyTable[i].type == UnsignedInteger8Bit) {
-                Interpolate<uint8>(i);
-            }
-            else if (copyTable[i].type == UnsignedInteger16Bit) {
-                Interpolate<uint16>(i);
-            }
-            else if (copyTable[i].type == UnsignedInteger32Bit) {
-                Interpolate<uint32>(i);
-            }
-            else if (copyTable[i].type == UnsignedInteger64Bit) {
-                Interpolate<uint64>(i);
-            }
-            else if (copyTable[i].type == SignedInteger8Bit) {
-                Interpolate<int8>(i);
-            }
-            else if (copyTable[i].type == SignedInteger16Bit) {
-                Interpolate<int16>(i);
-            }
-            else if (copyTable[i].type == SignedInteger32Bit) {
-                Interpolate<int32>(i);
-            }
-            else if (copyTable[i].type == SignedInteger64Bit) {
-                Interpolate<int64>(i);
-            }
-            else if (copyTable[i].type == Float32Bit) {
-                Interpolate<float32>(i);
-            }
-            else if (copyTable[i].type == Float64Bit) {
-                Interpolate<float64>(i);
+        //How long as elapsed in this interpolation segment: y = y0 + m * (t - x0)
+        float64 cttns = static_cast<float64>(interpolatedXAxis - x0);
+        uint32 g;
+        for (g = 0u; (g < numberOfGroups) && (ok); g++) {
+            MemoryMapInterpolatedInputBrokerGroup &group = groups[g];
+            if (group.numberOfCopies == 1u) {
+                //Write directly in the GAM memory
+                group.interpolationKernel(copyTable[group.copies[0]].gamPointer, group.y0, group.m, group.numberOfElements, cttns);
             }
             else {
-                //Unreachable/unsupported type? Should be stopped by the DataSourceI before...
+                group.interpolationKernel(group.y, group.y0, group.m, group.numberOfElements, cttns);
+                uint32 c;
+                for (c = 0u; (c < group.numberOfCopies) && (ok); c++) {
+                    i = group.copies[c];
+                    ok = MemoryOperationsHelper::Copy(copyTable[i].gamPointer, &group.y[group.offsets[c]], copyTable[i].copySize);
+                }
             }
         }
     }
@@ -38,6 +38,81 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * @brief Computes the slopes m = (y1 - y0) / dx of numberOfElements contiguous samples of a given type.
+ */
+typedef void (*MemoryMapInterpolationSlopesKernel)(float64 * const m,
+                                                   const void * const y0,
+                                                   const void * const y1,
+                                                   const uint32 numberOfElements,
+                                                   const float64 dx);
+
+/**
+ * @brief Computes the interpolated values y = y0 + m * dt of numberOfElements contiguous samples of a given type.
+ */
+typedef void (*MemoryMapInterpolationKernel)(void * const y,
+                                             const void * const y0,
+                                             const float64 * const m,
+                                             const uint32 numberOfElements,
+                                             const float64 dt);
+
+/**
+ * @brief The signals of a MemoryMapInterpolatedInputBroker with the same type.
+ * @details The samples of all the signals in the group are stored contiguously, so that the kernels (selected once for the type)
+ * process all the elements of all the signals of the group with a single call.
+ */
+struct MemoryMapInterpolatedInputBrokerGroup {
+    /**
+     * The indexes in the copy table of the signals of the group.
+     */
+    uint32 *copies;
+
+    /**
+     * The offset in bytes of each signal in y0, y1 and y.
+     */
+    uint32 *offsets;
+
+    /**
+     * The number of signals in the group.
+     */
+    uint32 numberOfCopies;
+
+    /**
+     * The total number of elements of the signals in the group.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * The y0 values of the current interpolation segment.
+     */
+    char8 *y0;
+
+    /**
+     * The y1 values of the current interpolation segment.
+     */
+    char8 *y1;
+
+    /**
+     * The interpolated values, which are then copied to the GAM memory.
+     */
+    char8 *y;
+
+    /**
+     * The slope of each element.
+     */
+    float64 *m;
+
+    /**
+     * The kernel that computes the slopes.
+     */
+    MemoryMapInterpolationSlopesKernel slopesKernel;
+
+    /**
+     * The kernel that computes the interpolated values.
+     */
+    MemoryMapInterpolationKernel interpolationKernel;
+};
+
 /**
  * @brief Input MemoryMapBroker implementation which allows to automatically interpolate samples from any DataSourceI.
  * @details This class interpolates the signals from the DataSourceI and copies the interpolated values to the GAM memory.
@@ -46,6 +121,11 @@ namespace MARTe {
  * The independent variable vector (typically a time vector) shall not have zero derivative between any two consecutive points and will be used as the basis
  * to compute the interpolation segments for all the other DataSource signals.
  *
+ * The signals are grouped by type and the interpolation of each group is computed, for all its signals and elements at once, by a kernel
+ * selected at Init for the type. The float32 and float64 kernels are vectorised with NEON when available (__ARM_NEON),
+ * or with SVE if the processor implements it (see CPUFeatures).
+ * Each element has its own slope, also for array signals.
+ *
  * @warning the Reset function shall be called before the first Execute and the DataSourceI shall have its first data points (x0, y0)
  * loaded into its memory (i.e. all the pointers returned by DataSourceI::GetSignalMemoryBuffer shall have valid values).
  */
@@ -100,23 +180,7 @@ public:CLASS_REGISTER_DECLARATION()
 
 private:
     /**
-     * @brief Interpolates between samples for any signal type.
-     * @param[in] copyIdx the index of the signal to be updated.
-     */
-    template<typename valueType>
-    void Interpolate(uint32 copyIdx);
-
-    /**
-     * @brief Generate a new interpolation segment. To be performed every time the interpolated vector is greater than the last time read from the data source.
-     * @param[in] copyIdx the index of the signal to be updated.
-     * @param[in] dx the interpolation segment length.
-     */
-    template<typename valueType>
-    void ChangeInterpolationSegment(uint32 copyIdx,
-                                    uint64 dx);
-
-    /**
-     * @brief Calls ChangeInterpolationSegment for all the broker signals.
+     * @brief Calls the slopes kernel of all the groups.
      */
     void ChangeInterpolationSegments();
 
@@ -146,24 +210,14 @@ private:
     uint64 interpolatedXAxis;
 
     /**
-     * Pointers to the addresses of the y0 values of the current interpolation segment
-     */
-    void **y0;
-
-    /**
-     * Pointers to the addresses of the y1 values of the current interpolation segment
+     * The signals grouped by type (see MemoryMapInterpolatedInputBrokerGroup).
      */
-    void **y1;
-
-    /**
-     * Pointers to the addresses of the m values
-     */
-    float64 *m;
+    MemoryMapInterpolatedInputBrokerGroup *groups;
 
     /**
-     * Accelerator for number of elements in any given signal
+     * The number of groups (i.e. of different signal types).
      */
-    uint32 *numberOfElements;
+    uint32 numberOfGroups;
 
     /**
      * Was the broker reset
@@ -176,43 +230,6 @@ private:
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
-namespace MARTe {
-
-template<typename valueType>
-void MemoryMapInterpolatedInputBroker::Interpolate(uint32 copyIdx) {
-    uint32 i;
-    for (i = 0u; i < numberOfElements[copyIdx]; i++) {
-
-        valueType *y0p = (valueType*) (y0[copyIdx]);
-        float64 y = static_cast<float64>(y0p[i]);
-        //How long as elapsed in this interpolation segment
-        float64 cttns = static_cast<float64>(interpolatedXAxis - x0);
-        //y = y0p + m * (t - x0), where y0p and t0p are the initial values for the interpolation period
-        float64 newy = m[copyIdx] * cttns;
-        y += newy;
-        valueType *dest = static_cast<valueType*>(copyTable[copyIdx].gamPointer);
-        dest[i] = static_cast<valueType>(y);
-    }
-}
-
-template<typename valueType>
-void MemoryMapInterpolatedInputBroker::ChangeInterpolationSegment(uint32 copyIdx,
-                                                                  uint64 dx) {
-    uint32 i;
-    for (i = 0u; i < numberOfElements[copyIdx]; i++) {
-        valueType *y0p = (valueType*) (y0[copyIdx]);
-        valueType *y1p = (valueType*) (y1[copyIdx]);
-        valueType *y1pds = (valueType*) (copyTable[copyIdx].dataSourcePointer);
-
-        y0p[i] = y1p[i];
-        y1p[i] = y1pds[i];
-        //Compute the derivative m = (y1-y0)/(x1-x0)
-        m[copyIdx] = static_cast<float64>(y1p[i] - y0p[i]);
-        m[copyIdx] /= dx;
-    }
-}
-
-}
 
 #endif /* L5GAMS_MEMORYMAPINTERPOLATEDINPUTBROKER_H_ */
 
@@ -49,6 +49,7 @@ MemoryMapMultiBufferBroker::MemoryMapMultiBufferBroker() :
     signalIdxArr = NULL_PTR(uint32*);
     samples = NULL_PTR(uint32*);
     maxOffset = NULL_PTR(int32*);
+    tripleBuffer = NULL_PTR(TripleBuffer *);
 }
 
 MemoryMapMultiBufferBroker::~MemoryMapMultiBufferBroker() {
@@ -70,7 +71,15 @@ MemoryMapMultiBufferBroker::~MemoryMapMultiBufferBroker() {
 bool MemoryMapMultiBufferBroker::CopyInputs() {
     uint32 n;
     bool ret = true;
-    uint32 currentBuffer = dataSource->GetCurrentStateBuffer();
+    uint32 currentBuffer;
+    if (tripleBuffer != NULL_PTR(TripleBuffer *)) {
+        //The last published buffer (or the one already being read if nothing new was published)
+        (void) tripleBuffer->Acquire();
+        currentBuffer = tripleBuffer->GetReadBuffer();
+    }
+    else {
+        currentBuffer = dataSource->GetCurrentStateBuffer();
+    }
 
     if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
         for (n = 0u; (n < numberOfCopies) && (ret); n++) {
@@ -153,8 +162,14 @@ bool MemoryMapMultiBufferBroker::CopyOutputs() {
 
     uint32 n;
     bool ret = true;
-    /*lint -e{613} null pointer checked before.*/
-    uint32 currentBuffer = dataSource->GetCurrentStateBuffer();
+    uint32 currentBuffer;
+    if (tripleBuffer != NULL_PTR(TripleBuffer *)) {
+        currentBuffer = tripleBuffer->GetWriteBuffer();
+    }
+    else {
+        /*lint -e{613} null pointer checked before.*/
+        currentBuffer = dataSource->GetCurrentStateBuffer();
+    }
     if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
         for (n = 0u; (n < numberOfCopies) && (ret); n++) {
             uint32 uintoffset = 0u;
@@ -213,6 +228,27 @@ bool MemoryMapMultiBufferBroker::CopyOutputs() {
             }
         }
     }
+    if ((ret) && (tripleBuffer != NULL_PTR(TripleBuffer *))) {
+        //Only complete buffers are published
+        tripleBuffer->Publish();
+    }
+    return ret;
+}
+
+bool MemoryMapMultiBufferBroker::SetTripleBuffer(TripleBuffer * const tripleBufferIn) {
+    bool ret = true;
+    if (tripleBufferIn != NULL_PTR(TripleBuffer *)) {
+        ret = (dataSource != NULL_PTR(DataSourceI *));
+        if (ret) {
+            ret = (dataSource->GetNumberOfStatefulMemoryBuffers() == 3u);
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The triple-buffer mode requires a DataSourceI with three stateful memory buffers");
+        }
+    }
+    if (ret) {
+        tripleBuffer = tripleBufferIn;
+    }
     return ret;
 }
 
@@ -318,6 +354,9 @@ bool MemoryMapMultiBufferBroker::Init(const SignalDirection direction,
                     /*lint -e{613} copyTable cannot be NULL as otherwise ret would be false*/
                     for (uint32 h = 0u; (h < nFakeSamples) && (ret); h++) {
                         copyTable[c].copySize = GetCopyByteSize(c % (numberOfCopies));
+                        copyTable[c].fixedCopySize = MemoryOperationsHelper::GetFixedCopySize(copyTable[c].copySize);
+                        copyTable[c].numberOfElements = 1u;
+                        copyTable[c].dataSourceStride = copyTable[c].copySize;
                         copyTable[c].gamPointer = GetFunctionPointer(c % (numberOfCopies));
                         copyTable[c].type = signalType;
                         uint32 dataSourceOffset = GetCopyOffset(c % (numberOfCopies));
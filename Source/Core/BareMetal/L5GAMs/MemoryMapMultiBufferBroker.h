@@ -39,6 +39,7 @@
 #include "DataSourceI.h"
 #include "FastPollingMutexSem.h"
 #include "MemoryMapBroker.h"
+#include "TripleBuffer.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
@@ -57,6 +58,11 @@ namespace MARTe {
  *
  * The reason why the offset needs to be computed for every signal is that there might be DataSourceI implementations where a given signal is ready
  *  before others and thus can be copied in advanced.
+ *
+ * In triple-buffer mode (see SetTripleBuffer) the stateful buffer is not the DataSourceI::GetCurrentStateBuffer but is exchanged, without locks,
+ *  through a TripleBuffer shared by the output broker of the writing thread and the input broker of the reading thread: the output broker
+ *  copies to the buffer owned by the writer and publishes it, while the input broker copies from the freshest published buffer. Neither of the threads
+ *  ever blocks, which allows e.g. a slow monitoring thread to read the signals produced by a fast real-time thread.
  */
 class MemoryMapMultiBufferBroker: public MemoryMapBroker {
 public:
@@ -82,6 +88,18 @@ public:
                       const char8 *const functionName,
                       void *const gamMemoryAddress);
 
+    /**
+     * @brief Selects the triple-buffer mode.
+     * @details Shall be called by the DataSourceI (e.g. in GetInputBrokers/GetOutputBrokers, after Init) with the same TripleBuffer
+     * for the output broker of the writing function and for the input broker of the reading function.
+     * @param[in] tripleBufferIn the TripleBuffer that selects the stateful buffer (NULL to go back to DataSourceI::GetCurrentStateBuffer).
+     * The TripleBuffer is not destroyed by the broker and shall be valid for as long as the broker is executed.
+     * @return true if tripleBufferIn is NULL or if the DataSourceI has exactly three stateful memory buffers.
+     * @pre
+     *   Init()
+     */
+    bool SetTripleBuffer(TripleBuffer * const tripleBufferIn);
+
 protected:
 
     /**
@@ -110,6 +128,11 @@ protected:
      * The offset in bytes to be copied for each copy. Needed to trap out-of-bounds exceptions in circular buffer implementations.
      */
     int32 *maxOffset;
+
+    /**
+     * The TripleBuffer used in triple-buffer mode (NULL otherwise).
+     */
+    TripleBuffer *tripleBuffer;
 };
 }
 
@@ -42,7 +42,7 @@
 namespace MARTe {
 MemoryMapOutputBroker::MemoryMapOutputBroker() :
         MemoryMapBroker() {
-
+    gatherCopyTable = true;
 }
 
 MemoryMapOutputBroker::~MemoryMapOutputBroker() {
@@ -51,13 +51,19 @@ MemoryMapOutputBroker::~MemoryMapOutputBroker() {
 
 bool MemoryMapOutputBroker::Execute() {
     uint32 n;
-    bool ret = true;
-    for (n = 0u; (n < numberOfCopies) && (ret); n++) {
-        if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) {
-            ret = MemoryOperationsHelper::Copy(copyTable[n].dataSourcePointer, copyTable[n].gamPointer, copyTable[n].copySize);
+    if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) {
+        //The pointers were validated by MemoryMapBroker::Init
+        for (n = 0u; n < numberOfCopies; n++) {
+            if (copyTable[n].numberOfElements == 1u) {
+                MemoryOperationsHelper::CopyTagged(copyTable[n].dataSourcePointer, copyTable[n].gamPointer, copyTable[n].copySize, copyTable[n].fixedCopySize);
+            }
+            else {
+                MemoryOperationsHelper::ScatterStrided(copyTable[n].dataSourcePointer, copyTable[n].gamPointer, copyTable[n].copySize,
+                                                       copyTable[n].dataSourceStride, copyTable[n].numberOfElements);
+            }
         }
     }
-    return ret;
+    return true;
 }
 
 CLASS_REGISTER(MemoryMapOutputBroker, "1.0")
@@ -43,12 +43,13 @@ namespace MARTe {
  * @brief Output MemoryMapBroker implementation.
  * @details This class copies all the signals declared on a MemoryMapBroker
  * from the GAM memory to the DataSourceI memory.
+ * @details The equally spaced signal ranges are scattered with a single strided copy (see MemoryMapBroker).
  */
 class DLL_API MemoryMapOutputBroker: public MemoryMapBroker {
 public:
     CLASS_REGISTER_DECLARATION()
     /**
-     * @brief Default constructor. NOOP.
+     * @brief Default constructor. Enables the strided entries of the copy table.
      */
     MemoryMapOutputBroker();
 
@@ -34,6 +34,7 @@
 #include "AdvancedErrorManagement.h"
 #include "GAM.h"
 #include "GAMSchedulerI.h"
+#include "HeapManager.h"
 #include "Matrix.h"
 #include "RealTimeApplication.h"
 #include "RealTimeApplicationConfigurationBuilder.h"
@@ -64,6 +65,9 @@ RealTimeApplication::RealTimeApplication() :
     index=1u;
     checkSameGamInMoreThreads=true;
     checkMultipleProducersWrites=true;
+    stateArenas[0u] = NULL_PTR(ArenaHeap *);
+    stateArenas[1u] = NULL_PTR(ArenaHeap *);
+    stateArenaIndex = 0u;
 }
 
 /*lint -e{1551} Guarantess that the execution is stopped upon destrucion of the RealTimeApplication*/
@@ -72,7 +76,13 @@ RealTimeApplication::~RealTimeApplication() {
     if (!ret.ErrorsCleared()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the RealTimeApplication. Was it ever started?");
     }
-
+    for (uint32 i = 0u; i < 2u; i++) {
+        if (stateArenas[i] != NULL_PTR(ArenaHeap *)) {
+            (void) HeapManager::RemoveHeap(stateArenas[i]);
+            delete stateArenas[i];
+            stateArenas[i] = NULL_PTR(ArenaHeap *);
+        }
+    }
 }
 bool RealTimeApplication::Initialise(StructuredDataI & data) {
     index = 1u;
@@ -93,6 +103,35 @@ bool RealTimeApplication::Initialise(StructuredDataI & data) {
         }
         checkMultipleProducersWrites=(checkMultipleProducersWritesT>0u);
     }
+    if (ret) {
+        uint32 stateArenaSize = 0u;
+        if (!data.Read("StateArenaSize", stateArenaSize)) {
+            stateArenaSize = 0u;
+        }
+        for (uint32 i = 0u; (i < 2u) && (stateArenaSize > 0u) && (ret); i++) {
+            ret = (stateArenas[i] == NULL_PTR(ArenaHeap *));
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The state arenas of %s were already created", GetName());
+            }
+            StreamString arenaName;
+            if (ret) {
+                ret = arenaName.Printf("%s.StateArena%u", GetName(), i);
+            }
+            if (ret) {
+                stateArenas[i] = new ArenaHeap(arenaName.Buffer());
+                ret = stateArenas[i]->Initialise(stateArenaSize);
+                if (ret) {
+                    ret = HeapManager::AddHeap(stateArenas[i]);
+                }
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Could not create the state arena %s with %u bytes", arenaName.Buffer(),
+                                 stateArenaSize);
+                    delete stateArenas[i];
+                    stateArenas[i] = NULL_PTR(ArenaHeap *);
+                }
+            }
+        }
+    }
 
 
     if (data.MoveRelative("+Data")) {
@@ -377,11 +416,33 @@ bool RealTimeApplication::AllocateGAMMemory() {
                     if (ret) {
                         ret = gam->AllocateOutputSignalsMemory();
                     }
-                    if (ret) {
-                        ret = gam->Setup();
-                        if (!ret) {
-                            REPORT_ERROR(ErrorManagement::ParametersError, "GAM %s Setup failed", fullGAMName.Buffer());
-                        }
+                }
+            }
+        }
+        if (ret) {
+            ret = functionsDatabase.MoveToAncestor(1u);
+        }
+    }
+    //The zero-copy signals can only be aliased once the memory of all the producers is allocated
+    if (ret) {
+        ret = AliasGAMMemory();
+    }
+    if (ret) {
+        ret = functionsDatabase.MoveAbsolute("Functions");
+    }
+    for (uint32 i = 0u; (i < numberOfFunctions) && (ret); i++) {
+        const char8 * functionId = functionsDatabase.GetChildName(i);
+        ret = functionsDatabase.MoveRelative(functionId);
+        if (ret) {
+            StreamString fullGAMName = "Functions.";
+            ret = functionsDatabase.Read("QualifiedName", fullGAMName);
+            if (ret) {
+                ReferenceT<GAM> gam = Find(fullGAMName.Buffer());
+                ret = gam.IsValid();
+                if (ret) {
+                    ret = gam->Setup();
+                    if (!ret) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "GAM %s Setup failed", fullGAMName.Buffer());
                     }
                 }
             }
@@ -393,6 +454,58 @@ bool RealTimeApplication::AllocateGAMMemory() {
     return ret;
 }
 
+bool RealTimeApplication::AliasGAMMemory() {
+    bool ret = functionsDatabase.MoveAbsolute("Functions");
+    uint32 numberOfFunctions = functionsDatabase.GetNumberOfChildren();
+    ConfigurationDatabase functionsDatabaseBeforeMove = functionsDatabase;
+    for (uint32 i = 0u; (i < numberOfFunctions) && (ret); i++) {
+        functionsDatabase = functionsDatabaseBeforeMove;
+        ret = functionsDatabase.MoveToChild(i);
+        StreamString fullGAMName = "Functions.";
+        if (ret) {
+            ret = functionsDatabase.Read("QualifiedName", fullGAMName);
+        }
+        ReferenceT<GAM> gam;
+        if (ret) {
+            gam = Find(fullGAMName.Buffer());
+            ret = gam.IsValid();
+        }
+        bool hasInputSignals = false;
+        if (ret) {
+            hasInputSignals = functionsDatabase.MoveRelative("Signals.InputSignals");
+        }
+        if (hasInputSignals) {
+            uint32 numberOfSignals = functionsDatabase.GetNumberOfChildren();
+            ConfigurationDatabase functionsDatabaseBeforeSignalMove = functionsDatabase;
+            for (uint32 n = 0u; (n < numberOfSignals) && (ret); n++) {
+                functionsDatabase = functionsDatabaseBeforeSignalMove;
+                StreamString producerName = "Functions.";
+                bool isZeroCopy = functionsDatabase.MoveToChild(n);
+                if (isZeroCopy) {
+                    isZeroCopy = functionsDatabase.Read("ZeroCopyProducer", producerName);
+                }
+                if (isZeroCopy) {
+                    uint32 producerSignalIdx = 0u;
+                    ret = functionsDatabase.Read("ZeroCopyProducerSignal", producerSignalIdx);
+                    ReferenceT<GAM> producer;
+                    if (ret) {
+                        producer = Find(producerName.Buffer());
+                        ret = producer.IsValid();
+                    }
+                    if (ret) {
+                        ret = gam->AliasInputSignalMemory(n, *(producer.operator->()), producerSignalIdx);
+                    }
+                    if (!ret) {
+                        REPORT_ERROR(ErrorManagement::InitialisationError, "Could not alias the input signal %d of %s to the output of %s", n,
+                                     fullGAMName.Buffer(), producerName.Buffer());
+                    }
+                }
+            }
+        }
+    }
+    return ret;
+}
+
 bool RealTimeApplication::AllocateDataSourceMemory() {
     bool ret = dataSourcesDatabase.MoveAbsolute("Data");
     uint32 numberOfDs = dataSourcesDatabase.GetNumberOfChildren();
@@ -466,6 +579,13 @@ bool RealTimeApplication::AddBrokersToFunctions() {
 }
 
 ErrorManagement::ErrorType RealTimeApplication::PrepareNextState(StreamString nextStateName) {
+    uint32 nextIndex = (index + 1u) % 2u;
+    //The arena of the next state was last used by the state before the current one
+    stateArenaIndex = nextIndex;
+    if (stateArenas[nextIndex] != NULL_PTR(ArenaHeap *)) {
+        stateArenas[nextIndex]->Reset();
+    }
+    StatefulI::SetStateArena(stateArenas[nextIndex]);
     bool ret = nextStateName.Seek(0LLU);
     if (ret) {
         ret = statesContainer.IsValid();
@@ -499,7 +619,7 @@ ErrorManagement::ErrorType RealTimeApplication::PrepareNextState(StreamString ne
             ret = scheduler->PrepareNextState(stateNameHolder[index].Buffer(), nextStateName.Buffer());
         }
     }
-    uint32 nextIndex = (index + 1u) % 2u;
+    StatefulI::SetStateArena(NULL_PTR(HeapI *));
     stateNameHolder[nextIndex] = nextStateName;
     return ret;
 
@@ -535,6 +655,59 @@ bool RealTimeApplication::FindStatefulDataSources() {
     return ret;
 }
 
+bool RealTimeApplication::WarmUp(StreamString stateName, const uint32 numberOfCycles) {
+    bool ret = stateName.Seek(0LLU);
+    if (ret) {
+        ret = statesContainer.IsValid();
+    }
+    ReferenceT<RealTimeState> state;
+    if (ret) {
+        uint32 numberOfStates = statesContainer->Size();
+        for (uint32 i = 0u; (i < numberOfStates) && (!state.IsValid()); i++) {
+            ReferenceT<RealTimeState> candidate = statesContainer->Get(i);
+            if (candidate.IsValid()) {
+                if (StringHelper::Compare(candidate->GetName(), stateName.Buffer()) == 0) {
+                    state = candidate;
+                }
+            }
+        }
+        ret = state.IsValid();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Could not find the state %s to warm up", stateName.Buffer());
+        }
+    }
+    ReferenceT<ReferenceContainer> threadContainer;
+    if (ret) {
+        threadContainer = state->Find("Threads");
+        ret = threadContainer.IsValid();
+    }
+    ReferenceContainer gams;
+    if (ret) {
+        //The GAMs of each thread, thread after thread, as the threads of a state may exchange data through the DataSourceI
+        uint32 numberOfThreads = threadContainer->Size();
+        for (uint32 i = 0u; (i < numberOfThreads) && (ret); i++) {
+            ReferenceT<RealTimeThread> thread = threadContainer->Get(i);
+            if (thread.IsValid()) {
+                ret = thread->GetGAMs(gams);
+            }
+        }
+    }
+    uint32 numberOfGAMs = gams.Size();
+    for (uint32 c = 0u; (c < numberOfCycles) && (ret); c++) {
+        for (uint32 n = 0u; (n < numberOfGAMs) && (ret); n++) {
+            ReferenceT<GAM> gam = gams.Get(n);
+            ret = gam.IsValid();
+            if (ret) {
+                ret = gam->Execute();
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "GAM %s failed to execute while warming up the state %s", gam->GetName(), stateName.Buffer());
+                }
+            }
+        }
+    }
+    return ret;
+}
+
 bool RealTimeApplication::GetStates(ReferenceContainer &states) const {
     bool ret = statesContainer.IsValid();
 
@@ -556,6 +729,10 @@ uint32 RealTimeApplication::GetIndex() const {
     return index;
 }
 
+HeapI *RealTimeApplication::GetStateArena() const {
+    return stateArenas[stateArenaIndex];
+}
+
 void RealTimeApplication::Purge(ReferenceContainer &purgeList) {
     if (statesContainer.IsValid()) {
         statesContainer->Purge(purgeList);
@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "ArenaHeap.h"
 #include "ConfigurationDatabase.h"
 #include "CLASSMETHODREGISTER.h"
 #include "GAMSchedulerI.h"
@@ -112,7 +113,7 @@ public:
     RealTimeApplication();
 
     /**
-     * @brief Destructor. NOOP.
+     * @brief Destructor. Stops the execution and frees the state arenas.
      */
     virtual ~RealTimeApplication();
 
@@ -165,6 +166,7 @@ public:
      * @details The user can specify the following parameters
      *   CheckMultipleProducersWrites = 1 //enable-disable check multiple producers to write on the same data source signal. Default = 1
      *   CheckSameGamInMoreThreads = 1 //allow a GAM to be declared in more than one RTT per state. Default = 1
+     *   StateArenaSize = 65536 //size in bytes of each of the two per-state arenas (see GetStateArena). Default = 0 (no arenas)
      * @param[in] data contains the initialisation data.
      * @return true if the parameters +Functions, +States, +Data and +Scheduler
      * exist and each inherit from ReferenceContainer.
@@ -195,6 +197,8 @@ public:
      * @details Typically the StatefulI components are the GAMGroup, the GAMSchedulerI, DataSourceI and the RealTimeState components.
      * @param[in] nextStateName the name of the next state to be executed.
      * @return true iff PrepareNextState is successful on all the StatefulI components.
+     * @details If the application has state arenas (StateArenaSize), the arena of the next state is reset before and
+     * is returned by StatefulI::GetStateArena while the components are called.
      */
     ErrorManagement::ErrorType PrepareNextState(StreamString nextStateName);
 
@@ -210,6 +214,19 @@ public:
      */
     ErrorManagement::ErrorType StopCurrentStateExecution();
 
+    /**
+     * @brief Executes (in the calling thread) the GAMs of a state for a number of dry cycles.
+     * @details For each cycle the GAMs of all the RealTimeThreads of the state are executed in their scheduling order but without
+     * any BrokerI, so that the inputs are the current content of the GAM input memory and the outputs are never copied to the DataSourceI.
+     * This pages in, and loads in the caches, the code and the data of the GAMs before the state is started.
+     * @param[in] stateName the name of the state.
+     * @param[in] numberOfCycles the number of dry cycles.
+     * @return true if the state exists and all the GAMs execute successfully.
+     * @pre ConfigureApplication() and the GAMs shall tolerate being executed outside of the state (e.g. they shall not drive hardware
+     * nor wait for external events). Their internal state is expected to be reset by the following PrepareNextState.
+     */
+    bool WarmUp(StreamString stateName, const uint32 numberOfCycles);
+
     /**
      * @brief Gets the declared RealTimeState components.
      * @param[out] states container to add all the RealTimeApplication States.
@@ -223,6 +240,17 @@ public:
      */
     uint32 GetIndex() const;
 
+    /**
+     * @brief Gets the per-state arena, a bump-pointer heap (see ArenaHeap) for the scratch memory of a state.
+     * @details The application has two arenas (of StateArenaSize bytes each), used by alternate states in the same way as the
+     * execution index. PrepareNextState resets (in bulk) the arena of the next state, which was last used by the state before
+     * the current one, and the memory allocated from it during PrepareNextState or the execution of the next state is then
+     * valid until the second following state change. The memory does not have to be freed (HeapManager::Free is a NOOP).
+     * The arenas are registered in the HeapManager, with the names APPLICATION_NAME.StateArena0 and APPLICATION_NAME.StateArena1.
+     * @return the arena of the state being prepared (from PrepareNextState) or executed, NULL if StateArenaSize was not set.
+     */
+    HeapI *GetStateArena() const;
+
     /**
      * @see ReferenceContainer::Purge()
      */
@@ -243,11 +271,19 @@ public:
 private:
 
     /**
-     * @brief Calls GAM::AllocateInputSignalsMemory and GAM::AllocateOutputSignalsMemory on all the GAM components.
-     * @return true if all the GAM::AllocateInputSignalsMemory and GAM::AllocateOutputSignalsMemory calls return true.
+     * @brief Calls GAM::AllocateInputSignalsMemory and GAM::AllocateOutputSignalsMemory on all the GAM components, then
+     * AliasGAMMemory and finally GAM::Setup on all the GAM components.
+     * @return true if all the GAM::AllocateInputSignalsMemory, GAM::AllocateOutputSignalsMemory, AliasGAMMemory and GAM::Setup calls return true.
      */
     bool AllocateGAMMemory();
 
+    /**
+     * @brief Calls GAM::AliasInputSignalMemory for all the input signals that the RealTimeApplicationConfigurationBuilder
+     *  resolved as zero-copy (i.e. that have a ZeroCopyProducer in the functions database).
+     * @return true if all the GAM::AliasInputSignalMemory calls return true.
+     */
+    bool AliasGAMMemory();
+
     /**
      * @brief Calls DataSourceI::AllocateMemory on all the DataSourceI components.
      * @return true if all the DataSourceI::AllocateMemory calls return true.
@@ -330,6 +366,16 @@ private:
      * Check if each signal has only one producer in each state
      */
     bool checkMultipleProducersWrites;
+
+    /**
+     * The per-state arenas (NULL if StateArenaSize was not set).
+     */
+    ArenaHeap *stateArenas[2];
+
+    /**
+     * The index of the arena of the state which is prepared or executed.
+     */
+    uint32 stateArenaIndex;
 };
 
 }
@@ -30,6 +30,7 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "GAM.h"
+#include "GAMDataSource.h"
 #include "Introspection.h"
 #include "RealTimeApplicationConfigurationBuilder.h"
 #include "RealTimeState.h"
@@ -42,6 +43,94 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+/**
+ * An object found by FindQualifiedReferences together with its fully qualified name.
+ */
+struct QualifiedReference {
+    /**
+     * The object.
+     */
+    Reference reference;
+
+    /**
+     * The names of the containers below the first level container and of the object, separated by dots.
+     */
+    StreamString qualifiedName;
+};
+
+/**
+ * @brief Finds all the objects of type T below a container and computes their fully qualified names in the same walk.
+ * @details The tree is walked depth first in the same order of a RECURSIVE ReferenceContainerFilterReferencesTemplate<T>
+ * search, so that the objects are found in the same order, without searching again the path of each one.
+ * @param[in] container the container to walk.
+ * @param[in] path the qualified name of \a container (empty for the first two levels).
+ * @param[in] level the depth of the children of \a container (0 for the first level, which is not part of the qualified names).
+ * @param[in] checkNested if true an object of type T below another object of type T (below the first level) is an error.
+ * @param[in] nested true if \a container is, or is below, an object of type T.
+ * @param[out] found where the objects and their qualified names are added (to be deleted by the caller).
+ * @return false if a nested object was found with \a checkNested or if the list could not be increased.
+ */
+template<typename T>
+static bool FindQualifiedReferences(ReferenceContainer &container,
+                                    const StreamString &path,
+                                    const uint32 level,
+                                    const bool checkNested,
+                                    const bool nested,
+                                    StaticList<QualifiedReference *> &found) {
+    bool ret = true;
+    uint32 numberOfElements = container.Size();
+    for (uint32 i = 0u; (i < numberOfElements) && (ret); i++) {
+        Reference element = container.Get(i);
+        if (element.IsValid()) {
+            StreamString elementPath = path;
+            if (level > 0u) {
+                if (elementPath.Size() > 0u) {
+                    elementPath += ".";
+                }
+                elementPath += element->GetName();
+            }
+            ReferenceT<T> elementT = element;
+            bool isT = elementT.IsValid();
+            if (isT) {
+                ret = !(checkNested && nested);
+                if (ret) {
+                    QualifiedReference *qualifiedReference = new QualifiedReference();
+                    qualifiedReference->reference = element;
+                    qualifiedReference->qualifiedName = elementPath;
+                    ret = found.Add(qualifiedReference);
+                    if (!ret) {
+                        delete qualifiedReference;
+                    }
+                }
+                else {
+                    REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Unsupported nested GAMs in path %s", elementPath.Buffer());
+                }
+            }
+            ReferenceT<ReferenceContainer> elementContainer = element;
+            if ((ret) && (elementContainer.IsValid())) {
+                ret = FindQualifiedReferences<T>(*(elementContainer.operator->()), elementPath, level + 1u, checkNested,
+                                                 (nested || (isT && (level > 0u))), found);
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Deletes the objects found by FindQualifiedReferences.
+ * @param[in,out] found the list to empty.
+ */
+static void DeleteQualifiedReferences(StaticList<QualifiedReference *> &found) {
+    QualifiedReference *qualifiedReference = NULL_PTR(QualifiedReference *);
+    while (found.Extract(found.GetSize() - 1u, qualifiedReference)) {
+        delete qualifiedReference;
+    }
+}
+
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -125,6 +214,13 @@ bool RealTimeApplicationConfigurationBuilder::ConfigureAfterInitialisation() {
             REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to VerifyConsumersAndProducers");
         }
     }
+    if (ret) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Going to ResolveZeroCopySignals");
+        ret = ResolveZeroCopySignals();
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to ResolveZeroCopySignals");
+        }
+    }
     REPORT_ERROR_STATIC(ErrorManagement::Information, "Going to CleanCaches");
     CleanCaches();
     return ret;
@@ -250,43 +346,28 @@ bool RealTimeApplicationConfigurationBuilder::InitialiseSignalsDatabase() {
         //Create the Functions master node
         ret = functionsDatabase.CreateAbsolute("Functions");
         if (ret) {
-            ReferenceContainer gamsFound;
-            //Look for all the GAMs inside the RealTimeApplication
-            ReferenceContainerFilterReferencesTemplate<GAM> gamFilter(-1, ReferenceContainerFilterMode::RECURSIVE);
-
+            //Look for all the GAMs inside the RealTimeApplication, together with their fully qualified names
+            //(Functions in the sub-levels of the tree might have the same name)
+            StaticList<QualifiedReference *> gamsFound;
+            functionsReferenceIndex.Reset();
+            functionsObjects.Clean();
             //lint -e{613} realTimeApplication cannot be NULL. Value checked at the beginning of the function
-            realTimeApplication->Find(gamsFound, gamFilter);
-            uint32 numberOfGAMs = gamsFound.Size();
+            ret = FindQualifiedReferences<GAM>(*realTimeApplication, "", 0u, true, false, gamsFound);
+            uint32 numberOfGAMs = gamsFound.GetSize();
             uint32 i;
             for (i = 0u; (i < numberOfGAMs) && (ret); i++) {
                 ConfigurationDatabase functionsDatabaseToModify = functionsDatabase;
-                // build the GAM qualified name searching each GAM by path
-                ReferenceT<GAM> gam = gamsFound.Get(i);
-                StreamString qualifiedName = "";
-                ReferenceContainerFilterReferences qualifiedNameFilter(1, ReferenceContainerFilterMode::PATH, gam);
-                ReferenceContainer result;
-                //lint -e{613} realTimeApplication cannot be NULL. Value checked at the beginning of the function
-                realTimeApplication->Find(result, qualifiedNameFilter);
-                //Store the fully qualified name (Functions in the sub-levels of the tree might have the same name)
-                uint32 r;
-                uint32 pathLength = result.Size();
-                //r == 0 => Functions
-                for (r = 1u; (r < pathLength) && ret; r++) {
-                    Reference element = result.Get(r);
-                    ReferenceT<GAM> gamElement = element;
-                    if (gamElement.IsValid()) {
-                        ret = (r == (pathLength - 1u));
-                        if (!ret) {
-                            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Unsupported nested GAMs in path %s", qualifiedName.Buffer());
-                        }
-                    }
-                    StreamString name = element->GetName();
-                    if (r > 1u) {
-                        ret = qualifiedName.Printf(".", voidAnyType);
-                    }
-                    if (ret) {
-                        ret = qualifiedName.Printf("%s", name.Buffer());
-                    }
+                QualifiedReference *gamFound = NULL_PTR(QualifiedReference *);
+                ret = gamsFound.Peek(i, gamFound);
+                ReferenceT<GAM> gam;
+                StreamString qualifiedName;
+                if (ret) {
+                    gam = gamFound->reference;
+                    qualifiedName = gamFound->qualifiedName;
+                    ret = functionsObjects.Add(gam.operator->());
+                }
+                if (ret) {
+                    ret = functionsReferenceIndex.Insert(functionsReferenceIndex.Key(gam->GetName()), i);
                 }
                 //Having the fully qualified name add a new node to the Function node, where the name of the node is the index of the
                 //Function (GAM) and the fully qualified name is stored as a property.
@@ -321,9 +402,10 @@ bool RealTimeApplicationConfigurationBuilder::InitialiseSignalsDatabase() {
                     }
                 }
                 if (!ret) {
-                    REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Failed to AddSignals for %s", gam->GetName());
+                    REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Failed to AddSignals for %s", qualifiedName.Buffer());
                 }
             }
+            DeleteQualifiedReferences(gamsFound);
         }
 
         if (ret) {
@@ -334,34 +416,23 @@ bool RealTimeApplicationConfigurationBuilder::InitialiseSignalsDatabase() {
             ret = dataSourcesDatabase.CreateAbsolute("Data");
         }
         if (ret) {
-            ReferenceContainer dataSourcesFound;
-            //Look for all the DataSources
-            ReferenceContainerFilterReferencesTemplate<DataSourceI> dataSourceFilter(-1, ReferenceContainerFilterMode::RECURSIVE);
+            //Look for all the DataSources, together with their fully qualified names
+            //(DataSources in sub-levels of the tree might have the same name)
+            StaticList<QualifiedReference *> dataSourcesFound;
             //lint -e{613} realTimeApplication cannot be NULL. Value checked at the beginning of the function
-            realTimeApplication->Find(dataSourcesFound, dataSourceFilter);
-            uint32 numberOfDataSources = dataSourcesFound.Size();
+            ret = FindQualifiedReferences<DataSourceI>(*realTimeApplication, "", 0u, false, false, dataSourcesFound);
+            uint32 numberOfDataSources = dataSourcesFound.GetSize();
             uint32 isTimeStamp = 0u;
             uint32 i;
             StreamString timeStampDsName;
             for (i = 0u; (i < numberOfDataSources) && (ret); i++) {
-                ReferenceT<DataSourceI> dataSource = dataSourcesFound.Get(i);
-
-                StreamString qualifiedName = "";
-                ReferenceContainerFilterReferences qualifiedNameFilter(1, ReferenceContainerFilterMode::PATH, dataSource);
-                ReferenceContainer result;
-                //lint -e{613} realTimeApplication cannot be NULL. Value checked at the beginning of the function
-                realTimeApplication->Find(result, qualifiedNameFilter);
-                //Store the fully qualified name (DataSources in sub-levels of the tree might have the same name)
-                uint32 r;
-                uint32 pathLength = result.Size();
-                for (r = 1u; (r < pathLength) && (ret); r++) {
-                    StreamString name = result.Get(r)->GetName();
-                    if (r > 1u) {
-                        ret = qualifiedName.Printf(".", voidAnyType);
-                    }
-                    if (ret) {
-                        ret = qualifiedName.Printf("%s", name.Buffer());
-                    }
+                QualifiedReference *dataSourceFound = NULL_PTR(QualifiedReference *);
+                ret = dataSourcesFound.Peek(i, dataSourceFound);
+                ReferenceT<DataSourceI> dataSource;
+                StreamString qualifiedName;
+                if (ret) {
+                    dataSource = dataSourceFound->reference;
+                    qualifiedName = dataSourceFound->qualifiedName;
                 }
                 //Having the fully qualified name add a new node to the Data node, where the name of the node is the index of the
                 //DataSource and the fully qualified name is stored as a property.
@@ -404,6 +475,7 @@ bool RealTimeApplicationConfigurationBuilder::InitialiseSignalsDatabase() {
                     ret = dataSourcesDatabase.MoveAbsolute("Data");
                 }
             }
+            DeleteQualifiedReferences(dataSourcesFound);
             if (ret) {
                 ret = (isTimeStamp == 1u);
                 if (isTimeStamp > 1u) {
@@ -568,7 +640,7 @@ bool RealTimeApplicationConfigurationBuilder::FlattenSignalsDatabase(Configurati
                         }
                         if (ret) {
                             //Move to the next Signal
-                            signalDatabase = signalDatabaseBeforeFlatten;
+                            signalDatabase = MARTe2_MOVE(signalDatabaseBeforeFlatten);
                         }
                     }
                     else {
@@ -662,7 +734,7 @@ bool RealTimeApplicationConfigurationBuilder::FlattenSignal(const bool isFunctio
                             ret = FlattenSignal(isFunctionsDatabase, signalFullName.Buffer(), resolvedSignal, signalNumber);
                         }
                         if (ret) {
-                            signalDatabase = signalDatabaseBeforeMove;
+                            signalDatabase = MARTe2_MOVE(signalDatabaseBeforeMove);
                         }
                     }
                 }
@@ -703,12 +775,17 @@ bool RealTimeApplicationConfigurationBuilder::FlattenSignal(const bool isFunctio
                     tempAlias = signalName;
                 }
 
+                //The full type of a converted signal is the one in the DataSource
+                StreamString fullTypeName;
+                if (!signalDatabase.Read("DataSourceType", fullTypeName)) {
+                    fullTypeName = signalType;
+                }
                 ret = tempAlias.Seek(0LLU);
                 if (ret) {
                     while (tempAlias.SkipTokens(1u, ".")) {
                         fullType += "Node.";
                     }
-                    fullType += signalType.Buffer();
+                    fullType += fullTypeName.Buffer();
                 }
             }
 
@@ -875,8 +952,8 @@ bool RealTimeApplicationConfigurationBuilder::FlattenSignal(const bool isFunctio
                 ret = resolvedSignal.Write("QualifiedName", signalName);
             }
             //Loop and copy all known properties at this time.
-            const char8 *properties[] = { "Type", "NumberOfDimensions", "NumberOfElements", "Alias", "Ranges", "DataSource", "Samples", "Default", "Frequency",
-                    "Trigger", NULL_PTR(char8*) };
+            const char8 *properties[] = { "Type", "DataSourceType", "NumberOfDimensions", "NumberOfElements", "Alias", "Ranges", "DataSource", "Samples",
+                    "Default", "Frequency", "Trigger", "Decimation", "Reduction", NULL_PTR(char8*) };
             uint32 p = 0u;
             while ((properties[p] != NULL_PTR(char8*)) && (ret)) {
                 AnyType element = signalDatabase.GetType(properties[p]);
@@ -893,7 +970,7 @@ bool RealTimeApplicationConfigurationBuilder::FlattenSignal(const bool isFunctio
             }
             if (ret) {
                 //Move to the next Signal
-                signalDatabase = signalDatabaseBeforeChanges;
+                signalDatabase = MARTe2_MOVE(signalDatabaseBeforeChanges);
             }
         }
     }
@@ -1197,14 +1274,22 @@ bool RealTimeApplicationConfigurationBuilder::AddSignalToDataSource(StreamString
         const char8 *properties[] = { "Type", "NumberOfDimensions", "NumberOfElements", "Default", "MemberSize", NULL_PTR(char8*) };
         uint32 p = 0u;
         while ((properties[p] != NULL_PTR(char8*)) && (ret)) {
-            AnyType elementSignalDatabase = functionsDatabase.GetType(properties[p]);
+            //A signal that is converted by the broker is checked against (and defines) the DataSource type with its DataSourceType
+            const char8 *signalProperty = properties[p];
+            if (StringHelper::Compare(properties[p], "Type") == 0) {
+                AnyType dataSourceType = functionsDatabase.GetType("DataSourceType");
+                if (!dataSourceType.IsVoid()) {
+                    signalProperty = "DataSourceType";
+                }
+            }
+            AnyType elementSignalDatabase = functionsDatabase.GetType(signalProperty);
             AnyType elementDataSourceDatabase = dataSourcesDatabase.GetType(properties[p]);
             //Property already exists, check compatibility!
             if (elementSignalDatabase.GetTypeDescriptor() != VoidType) {
                 if (elementDataSourceDatabase.GetTypeDescriptor() != VoidType) {
                     StreamString sElementSignalDatabase;
                     StreamString sElementDataSourceDatabase;
-                    ret = functionsDatabase.Read(properties[p], sElementSignalDatabase);
+                    ret = functionsDatabase.Read(signalProperty, sElementSignalDatabase);
                     if (ret) {
                         ret = dataSourcesDatabase.Read(properties[p], sElementDataSourceDatabase);
                     }
@@ -1214,7 +1299,7 @@ bool RealTimeApplicationConfigurationBuilder::AddSignalToDataSource(StreamString
                     if (!ret) {
                         //Report mismatch!
                         StreamString fullPropertyName;
-                        bool retPrintf = fullPropertyName.Printf("%s.%s", originalSignalName.Buffer(), properties[p]);
+                        bool retPrintf = fullPropertyName.Printf("%s.%s", originalSignalName.Buffer(), signalProperty);
                         if (!retPrintf) {
                             fullPropertyName = "Unknown";
                         }
@@ -1537,6 +1622,9 @@ bool RealTimeApplicationConfigurationBuilder::ResolveStates() {
                             REPORT_ERROR(ErrorManagement::Information, "Resolving thread %s", threadFullName.Buffer());
 
                             ret = AddThreadCycleTime(threadFullName.Buffer());
+                            if ((ret) && (thread->GetPeriod() > 0u)) {
+                                ret = AddThreadLateness(threadFullName.Buffer());
+                            }
                             ReferenceContainer gams;
                             if (ret) {
                                 ret = thread->GetGAMs(gams);
@@ -1549,33 +1637,21 @@ bool RealTimeApplicationConfigurationBuilder::ResolveStates() {
                             //...get the GAMs that are executed by this thread....
                             for (z = 0u; (z < numberOfGAMs) && (ret); z++) {
                                 ReferenceT<GAM> gam = gams.Get(z);
-                                StreamString qualifiedName = "";
-                                ReferenceContainerFilterReferences qualifiedNameFilter(1, ReferenceContainerFilterMode::PATH, gam);
-                                ReferenceContainer result;
-                                realTimeApplication->Find(result, qualifiedNameFilter);
-                                //Store the fully qualified name (Functions in the sub-levels of the tree might have the same name)
-                                uint32 r;
-                                uint32 pathLength = result.Size();
-                                //r == 0 => Functions
-                                for (r = 1u; (r < pathLength); r++) {
-                                    StreamString name = result.Get(r)->GetName();
-                                    if (r > 1u) {
-                                        ret = qualifiedName.Printf(".", voidAnyType);
-                                    }
-                                    if (ret) {
-                                        ret = qualifiedName.Printf("%s", name.Buffer());
-                                    }
-                                }
-                                REPORT_ERROR(ErrorManagement::Information, "Resolving %s", qualifiedName.Buffer());
                                 StreamString functionNumber;
-                                //Look for the FunctionNumber which has this qualified name
-                                ret = FindFunctionNumber(qualifiedName, functionNumber);
+                                //Look for the FunctionNumber of this GAM (found, with its qualified name, by InitialiseSignalsDatabase)
+                                ret = FindFunctionNumber(gam, functionNumber);
                                 if (ret) {
                                     ret = functionsDatabase.MoveAbsolute("Functions");
                                 }
                                 if (ret) {
                                     ret = functionsDatabase.MoveRelative(functionNumber.Buffer());
                                 }
+                                if (ret) {
+                                    StreamString qualifiedName;
+                                    if (functionsDatabase.Read("QualifiedName", qualifiedName)) {
+                                        REPORT_ERROR(ErrorManagement::Information, "Resolving %s", qualifiedName.Buffer());
+                                    }
+                                }
                                 if (ret) {
                                     syncSignals += GetNumberOfSyncSignals("Signals.InputSignals", ret);
                                     if (ret) {
@@ -1865,6 +1941,13 @@ bool RealTimeApplicationConfigurationBuilder::ResolveStatesFromConfiguration() {
                             threadFullName += ".";
                             threadFullName += &threadName[1];
                             ret = AddThreadCycleTime(threadFullName.Buffer());
+                            uint32 threadPeriod = 0u;
+                            if (!globalDatabase.Read("Period", threadPeriod)) {
+                                threadPeriod = 0u;
+                            }
+                            if ((ret) && (threadPeriod > 0u)) {
+                                ret = AddThreadLateness(threadFullName.Buffer());
+                            }
 
                             AnyType at = globalDatabase.GetType("Functions");
                             if (ret) {
@@ -1921,11 +2004,20 @@ bool RealTimeApplicationConfigurationBuilder::ResolveStatesFromConfiguration() {
 }
 
 bool RealTimeApplicationConfigurationBuilder::AddThreadCycleTime(const char8 *const threadFullName) {
+    return AddThreadTimeSignal(threadFullName, "_CycleTime");
+}
+
+bool RealTimeApplicationConfigurationBuilder::AddThreadLateness(const char8 *const threadFullName) {
+    return AddThreadTimeSignal(threadFullName, "_Lateness");
+}
+
+bool RealTimeApplicationConfigurationBuilder::AddThreadTimeSignal(const char8 *const threadFullName,
+                                                                  const char8 *const signalSuffix) {
     bool ret = dataSourcesDatabase.MoveAbsolute("Data");
     uint32 numberOfDataSources = dataSourcesDatabase.GetNumberOfChildren();
 
     StreamString signalName = threadFullName;
-    signalName += "_CycleTime";
+    signalName += signalSuffix;
     uint32 i;
     ConfigurationDatabase dataSourcesDatabaseBeforeMove = dataSourcesDatabase;
     for (i = 0u; (i < numberOfDataSources) && (ret); i++) {
@@ -1940,21 +2032,13 @@ bool RealTimeApplicationConfigurationBuilder::AddThreadCycleTime(const char8 *co
                         ret = dataSourcesDatabase.MoveRelative("Signals");
                     }
                     if (ret) {
-                        uint32 numberOfTimeSignals = dataSourcesDatabase.GetNumberOfChildren();
-                        bool found = false;
-                        uint32 j;
+                        uint32 foundSignalId = 0u;
+                        bool found = dataSourcesSignalIndexCache.Read(signalName.Buffer(), foundSignalId);
                         ConfigurationDatabase dataSourcesDatabaseBeforeTimeSignals = dataSourcesDatabase;
-                        for (j = 0u; (j < numberOfTimeSignals) && (ret) && (!found); j++) {
-                            ret = dataSourcesDatabase.MoveToChild(j);
-                            StreamString qualifiedName;
-                            if (ret) {
-                                ret = dataSourcesDatabase.Read("QualifiedName", qualifiedName);
-                            }
+                        if (found) {
+                            ret = dataSourcesDatabase.MoveToChild(foundSignalId);
                             if (ret) {
-                                found = (qualifiedName == signalName);
-                                if (found) {
-                                    ret = CheckTimeSignalInfo();
-                                }
+                                ret = CheckTimeSignalInfo();
                             }
                             if (ret) {
                                 dataSourcesDatabase = dataSourcesDatabaseBeforeTimeSignals;
@@ -2377,8 +2461,463 @@ bool RealTimeApplicationConfigurationBuilder::CheckProducersRanges(const uint32
     return ret;
 }
 
+////////////////////////////////
+////////////////////////////////
+// ResolveZeroCopySignals
+////////////////////////////////
+////////////////////////////////
+bool RealTimeApplicationConfigurationBuilder::ResolveZeroCopySignals() {
+    bool ret = (realTimeApplication != NULL_PTR(RealTimeApplication *));
+    if (ret) {
+        ret = dataSourcesDatabase.MoveAbsolute("Data");
+    }
+    uint32 numberOfDataSources = dataSourcesDatabase.GetNumberOfChildren();
+    ConfigurationDatabase dataSourcesDatabaseBeforeMove = dataSourcesDatabase;
+    for (uint32 i = 0u; (i < numberOfDataSources) && (ret); i++) {
+        dataSourcesDatabase = dataSourcesDatabaseBeforeMove;
+        ret = dataSourcesDatabase.MoveToChild(i);
+        StreamString dataSourceName;
+        if (ret) {
+            ret = dataSourcesDatabase.Read("QualifiedName", dataSourceName);
+        }
+        bool zeroCopy = false;
+        if (ret) {
+            StreamString fullDsPath = "Data.";
+            fullDsPath += dataSourceName;
+            /*lint -e{613} NULL pointer checking done before entering here */
+            ReferenceT<GAMDataSource> gamDataSource = realTimeApplication->Find(fullDsPath.Buffer());
+            if (gamDataSource.IsValid()) {
+                zeroCopy = gamDataSource->IsZeroCopy();
+            }
+        }
+        if (zeroCopy) {
+            ConfigurationDatabase dataSourceNode = dataSourcesDatabase;
+            uint32 numberOfSignals = 0u;
+            if (dataSourcesDatabase.MoveRelative("Signals")) {
+                numberOfSignals = dataSourcesDatabase.GetNumberOfChildren();
+            }
+            ConfigurationDatabase dataSourcesDatabaseBeforeSignalMove = dataSourcesDatabase;
+            for (uint32 j = 0u; (j < numberOfSignals) && (ret); j++) {
+                dataSourcesDatabase = dataSourcesDatabaseBeforeSignalMove;
+                ret = dataSourcesDatabase.MoveToChild(j);
+                if (ret) {
+                    ret = ResolveZeroCopySignal(dataSourceNode);
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+bool RealTimeApplicationConfigurationBuilder::ResolveZeroCopySignal(const ConfigurationDatabase &dataSourceNode) {
+    ConfigurationDatabase dataSourceNodeCopy = dataSourceNode;
+    StreamString dataSourceName;
+    StreamString signalName;
+    bool ret = dataSourceNodeCopy.Read("QualifiedName", dataSourceName);
+    if (ret) {
+        ret = dataSourcesDatabase.Read("QualifiedName", signalName);
+    }
+    uint32 signalByteSize = 0u;
+    if (ret) {
+        ret = dataSourcesDatabase.Read("ByteSize", signalByteSize);
+    }
+    ConfigurationDatabase statesNode = dataSourcesDatabase;
+    uint32 numberOfStates = 0u;
+    if (ret) {
+        if (statesNode.MoveRelative("States")) {
+            numberOfStates = statesNode.GetNumberOfChildren();
+        }
+    }
+    StreamString producerId;
+    StreamString producerSignalId;
+    uint32 producerMemoryOffset = 0u;
+    //For each consumer function the GAMMemoryOffset of each of its zero-copy signals
+    ConfigurationDatabase consumers;
+    bool eligible = (ret);
+    for (uint32 s = 0u; (s < numberOfStates) && (eligible); s++) {
+        ConfigurationDatabase stateNode = statesNode;
+        eligible = stateNode.MoveToChild(s);
+        uint32 numberOfConsumers = 0u;
+        if (eligible) {
+            AnyType consumersType = stateNode.GetType("GAMConsumers");
+            if (!consumersType.IsVoid()) {
+                numberOfConsumers = consumersType.GetNumberOfElements(0u);
+            }
+        }
+        if (numberOfConsumers > 0u) {
+            //One and only one producer, the same in all the states where the signal is consumed
+            AnyType producersType = stateNode.GetType("GAMProducers");
+            eligible = !producersType.IsVoid();
+            if (eligible) {
+                eligible = (producersType.GetNumberOfElements(0u) == 1u);
+            }
+            StreamString stateProducerId;
+            StreamString stateProducerSignalId;
+            if (eligible) {
+                Vector<StreamString> gamProducers(&stateProducerId, 1u);
+                Vector<StreamString> signalProducers(&stateProducerSignalId, 1u);
+                eligible = stateNode.Read("GAMProducers", gamProducers);
+                if (eligible) {
+                    eligible = stateNode.Read("SignalProducers", signalProducers);
+                }
+            }
+            if (eligible) {
+                if (producerId.Size() == 0u) {
+                    producerId = stateProducerId;
+                    producerSignalId = stateProducerSignalId;
+                    eligible = IsZeroCopyFunctionSignal(OutputSignals, dataSourceName.Buffer(), producerId, producerSignalId, signalByteSize,
+                                                        producerMemoryOffset);
+                }
+                else {
+                    eligible = ((producerId == stateProducerId.Buffer()) && (producerSignalId == stateProducerSignalId.Buffer()));
+                }
+            }
+            Vector<StreamString> gamConsumers(numberOfConsumers);
+            Vector<StreamString> signalConsumers(numberOfConsumers);
+            if (eligible) {
+                eligible = stateNode.Read("GAMConsumers", gamConsumers);
+            }
+            if (eligible) {
+                eligible = stateNode.Read("SignalConsumers", signalConsumers);
+            }
+            for (uint32 c = 0u; (c < numberOfConsumers) && (eligible); c++) {
+                uint32 consumerMemoryOffset = 0u;
+                eligible = IsZeroCopyFunctionSignal(InputSignals, dataSourceName.Buffer(), gamConsumers[c], signalConsumers[c], signalByteSize,
+                                                    consumerMemoryOffset);
+                if (eligible) {
+                    eligible = consumers.MoveToRoot();
+                }
+                if (eligible) {
+                    if (!consumers.MoveRelative(gamConsumers[c].Buffer())) {
+                        eligible = consumers.CreateRelative(gamConsumers[c].Buffer());
+                    }
+                }
+                if (eligible) {
+                    eligible = consumers.Write(signalConsumers[c].Buffer(), consumerMemoryOffset);
+                }
+            }
+            if (eligible) {
+                eligible = IsZeroCopyExecutionOrder(stateNode.GetName(), producerId, gamConsumers);
+            }
+        }
+    }
+    if (eligible) {
+        eligible = consumers.MoveToRoot();
+    }
+    uint32 numberOfConsumerFunctions = 0u;
+    if (eligible) {
+        numberOfConsumerFunctions = consumers.GetNumberOfChildren();
+    }
+    if (numberOfConsumerFunctions > 0u) {
+        StreamString producerName;
+        ConfigurationDatabase producerNode = functionsDatabase;
+        ret = producerNode.MoveAbsolute("Functions");
+        if (ret) {
+            ret = producerNode.MoveRelative(producerId.Buffer());
+        }
+        if (ret) {
+            ret = producerNode.Read("QualifiedName", producerName);
+        }
+        if (ret) {
+            ret = SetZeroCopyFunctionSignal(OutputSignals, dataSourceNode, producerName.Buffer(), producerMemoryOffset);
+        }
+        for (uint32 f = 0u; (f < numberOfConsumerFunctions) && (ret); f++) {
+            ConfigurationDatabase consumerSignals = consumers;
+            ret = consumerSignals.MoveToChild(f);
+            StreamString consumerId = consumerSignals.GetName();
+            ConfigurationDatabase consumerNode = functionsDatabase;
+            StreamString consumerName;
+            if (ret) {
+                ret = consumerNode.MoveAbsolute("Functions");
+            }
+            if (ret) {
+                ret = consumerNode.MoveRelative(consumerId.Buffer());
+            }
+            if (ret) {
+                ret = consumerNode.Read("QualifiedName", consumerName);
+            }
+            if (ret) {
+                ret = consumerNode.MoveRelative("Signals.InputSignals");
+            }
+            uint32 numberOfConsumerSignals = consumerSignals.GetNumberOfChildren();
+            for (uint32 n = 0u; (n < numberOfConsumerSignals) && (ret); n++) {
+                const char8 *const consumerSignalId = consumerSignals.GetChildName(n);
+                uint32 consumerMemoryOffset = 0u;
+                ret = consumerSignals.Read(consumerSignalId, consumerMemoryOffset);
+                ConfigurationDatabase consumerSignalNode = consumerNode;
+                if (ret) {
+                    ret = consumerSignalNode.MoveRelative(consumerSignalId);
+                }
+                if (ret) {
+                    ret = consumerSignalNode.Write("ZeroCopyProducer", producerName.Buffer());
+                }
+                if (ret) {
+                    ret = consumerSignalNode.Write("ZeroCopyProducerSignal", producerSignalId.Buffer());
+                }
+                if (ret) {
+                    ret = SetZeroCopyFunctionSignal(InputSignals, dataSourceNode, consumerName.Buffer(), consumerMemoryOffset);
+                }
+            }
+        }
+        if (ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Signal %s in %s is exchanged without copies", signalName.Buffer(), dataSourceName.Buffer());
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to alias the signal %s in %s", signalName.Buffer(), dataSourceName.Buffer());
+        }
+    }
+    return ret;
+}
+
+bool RealTimeApplicationConfigurationBuilder::IsZeroCopyFunctionSignal(const SignalDirection direction,
+                                                                       const char8 *const dataSourceName,
+                                                                       StreamString functionId,
+                                                                       StreamString signalId,
+                                                                       const uint32 signalByteSize,
+                                                                       uint32 &gamMemoryOffset) {
+    const char8 *signalDirection = "InputSignals";
+    if (direction == OutputSignals) {
+        signalDirection = "OutputSignals";
+    }
+    ConfigurationDatabase functionNode = functionsDatabase;
+    bool ret = functionNode.MoveAbsolute("Functions");
+    if (ret) {
+        ret = functionNode.MoveRelative(functionId.Buffer());
+    }
+    //The whole signal must be read (or written)
+    ConfigurationDatabase signalNode = functionNode;
+    if (ret) {
+        ret = signalNode.MoveRelative("Signals");
+    }
+    if (ret) {
+        ret = signalNode.MoveRelative(signalDirection);
+    }
+    if (ret) {
+        ret = signalNode.MoveRelative(signalId.Buffer());
+    }
+    if (ret) {
+        AnyType ranges = signalNode.GetType("Ranges");
+        ret = ranges.IsVoid();
+    }
+    //The signal is not converted by the broker
+    if (ret) {
+        AnyType dataSourceType = signalNode.GetType("DataSourceType");
+        ret = dataSourceType.IsVoid();
+    }
+    uint32 functionSignalByteSize = 0u;
+    if (ret) {
+        ret = signalNode.Read("ByteSize", functionSignalByteSize);
+    }
+    if (ret) {
+        ret = (functionSignalByteSize == signalByteSize);
+    }
+    //Look for the signal in the memory allocated to this DataSource
+    ConfigurationDatabase memoryNode = functionNode;
+    if (ret) {
+        ret = memoryNode.MoveRelative("Memory");
+    }
+    if (ret) {
+        ret = memoryNode.MoveRelative(signalDirection);
+    }
+    uint32 numberOfDataSources = 0u;
+    if (ret) {
+        numberOfDataSources = memoryNode.GetNumberOfChildren();
+    }
+    bool found = false;
+    ConfigurationDatabase memoryNodeBeforeMove = memoryNode;
+    for (uint32 d = 0u; (d < numberOfDataSources) && (ret) && (!found); d++) {
+        memoryNode = memoryNodeBeforeMove;
+        StreamString memoryDataSourceName;
+        ret = memoryNode.MoveToChild(d);
+        if (ret) {
+            ret = memoryNode.Read("DataSource", memoryDataSourceName);
+        }
+        if (ret) {
+            found = (memoryDataSourceName == dataSourceName);
+        }
+    }
+    if (ret) {
+        ret = found;
+    }
+    if (ret) {
+        ret = memoryNode.MoveRelative("Signals");
+    }
+    if (ret) {
+        ret = memoryNode.MoveRelative(signalId.Buffer());
+    }
+    uint32 samples = 0u;
+    if (ret) {
+        ret = memoryNode.Read("Samples", samples);
+    }
+    if (ret) {
+        ret = (samples == 1u);
+    }
+    float32 frequency = -1.0F;
+    if (ret) {
+        if (memoryNode.Read("Frequency", frequency)) {
+            ret = (frequency < 0.0F);
+        }
+    }
+    uint32 trigger = 0u;
+    if (ret) {
+        if (memoryNode.Read("Trigger", trigger)) {
+            ret = (trigger == 0u);
+        }
+    }
+    uint32 decimation = 1u;
+    if (ret) {
+        if (memoryNode.Read("Decimation", decimation)) {
+            ret = (decimation == 1u);
+        }
+    }
+    if (ret) {
+        ret = memoryNode.Read("GAMMemoryOffset", gamMemoryOffset);
+    }
+    return ret;
+}
+
+bool RealTimeApplicationConfigurationBuilder::IsZeroCopyExecutionOrder(const char8 *const stateName,
+                                                                       StreamString producerId,
+                                                                       Vector<StreamString> &consumerIds) {
+    ConfigurationDatabase functionNode = functionsDatabase;
+    bool ret = functionNode.MoveAbsolute("Functions");
+    ConfigurationDatabase functionNodeBeforeMove = functionNode;
+    if (ret) {
+        ret = functionNode.MoveRelative(producerId.Buffer());
+    }
+    StreamString producerName = "Functions.";
+    if (ret) {
+        ret = functionNode.Read("QualifiedName", producerName);
+    }
+    StreamString threadName;
+    if (ret) {
+        ret = functionNode.MoveRelative("States");
+    }
+    if (ret) {
+        ret = functionNode.Read(stateName, threadName);
+    }
+    ReferenceT<RealTimeThread> thread;
+    if (ret) {
+        StreamString threadPath = "States.";
+        threadPath += stateName;
+        threadPath += ".Threads.";
+        threadPath += threadName;
+        /*lint -e{613} NULL pointer checking done before entering here */
+        thread = realTimeApplication->Find(threadPath.Buffer());
+        ret = thread.IsValid();
+    }
+    ReferenceContainer gams;
+    if (ret) {
+        ret = thread->GetGAMs(gams);
+    }
+    //The producer must be executed, in the same thread, before all the consumers
+    uint32 numberOfGAMs = gams.Size();
+    uint32 producerPosition = numberOfGAMs;
+    if (ret) {
+        /*lint -e{613} NULL pointer checking done before entering here */
+        Reference producer = realTimeApplication->Find(producerName.Buffer());
+        for (uint32 z = 0u; (z < numberOfGAMs) && (producerPosition == numberOfGAMs); z++) {
+            if (gams.Get(z) == producer) {
+                producerPosition = z;
+            }
+        }
+        ret = (producerPosition < numberOfGAMs);
+    }
+    uint32 numberOfConsumers = consumerIds.GetNumberOfElements();
+    for (uint32 c = 0u; (c < numberOfConsumers) && (ret); c++) {
+        functionNode = functionNodeBeforeMove;
+        StreamString consumerName = "Functions.";
+        ret = functionNode.MoveRelative(consumerIds[c].Buffer());
+        if (ret) {
+            ret = functionNode.Read("QualifiedName", consumerName);
+        }
+        if (ret) {
+            /*lint -e{613} NULL pointer checking done before entering here */
+            Reference consumer = realTimeApplication->Find(consumerName.Buffer());
+            uint32 consumerPosition = numberOfGAMs;
+            for (uint32 z = (producerPosition + 1u); (z < numberOfGAMs) && (consumerPosition == numberOfGAMs); z++) {
+                if (gams.Get(z) == consumer) {
+                    consumerPosition = z;
+                }
+            }
+            ret = (consumerPosition < numberOfGAMs);
+        }
+    }
+    return ret;
+}
+
+bool RealTimeApplicationConfigurationBuilder::SetZeroCopyFunctionSignal(const SignalDirection direction,
+                                                                        const ConfigurationDatabase &dataSourceNode,
+                                                                        const char8 *const functionName,
+                                                                        const uint32 gamMemoryOffset) {
+    const char8 *signalDirection = "InputSignals";
+    if (direction == OutputSignals) {
+        signalDirection = "OutputSignals";
+    }
+    ConfigurationDatabase functionNode = dataSourceNode;
+    bool ret = functionNode.MoveRelative("Functions");
+    uint32 numberOfFunctions = 0u;
+    if (ret) {
+        numberOfFunctions = functionNode.GetNumberOfChildren();
+    }
+    bool found = false;
+    ConfigurationDatabase functionNodeBeforeMove = functionNode;
+    for (uint32 f = 0u; (f < numberOfFunctions) && (ret) && (!found); f++) {
+        functionNode = functionNodeBeforeMove;
+        StreamString qualifiedName;
+        ret = functionNode.MoveToChild(f);
+        if (ret) {
+            ret = functionNode.Read("QualifiedName", qualifiedName);
+        }
+        if (ret) {
+            found = (qualifiedName == functionName);
+        }
+    }
+    if (ret) {
+        ret = found;
+    }
+    if (ret) {
+        ret = functionNode.MoveRelative(signalDirection);
+    }
+    uint32 numberOfSignals = 0u;
+    if (ret) {
+        numberOfSignals = functionNode.GetNumberOfChildren();
+    }
+    found = false;
+    ConfigurationDatabase functionNodeBeforeSignalMove = functionNode;
+    for (uint32 n = 0u; (n < numberOfSignals) && (ret) && (!found); n++) {
+        functionNode = functionNodeBeforeSignalMove;
+        uint32 offset = 0u;
+        //Skip the ByteSize leaf
+        if (functionNode.MoveToChild(n)) {
+            ret = functionNode.Read("GAMMemoryOffset", offset);
+            if (ret) {
+                found = (offset == gamMemoryOffset);
+            }
+        }
+    }
+    if (ret) {
+        ret = found;
+    }
+    //Without a Broker the signal is ignored when the DataSource builds the brokers of the function
+    if (ret) {
+        AnyType broker = functionNode.GetType("Broker");
+        if (!broker.IsVoid()) {
+            ret = functionNode.Delete("Broker");
+        }
+    }
+    if (ret) {
+        ret = functionNode.Write("ZeroCopy", 1u);
+    }
+    return ret;
+}
+
 bool RealTimeApplicationConfigurationBuilder::AddTimingSignals() {
-    bool ret = dataSourcesDatabase.MoveRelative("Signals");
+    //The flattened signals of the DataSource are indexed by name in the dataSourcesSignalIndexCache
+    bool ret = dataSourcesSignalIndexCache.MoveAbsolute(dataSourcesDatabase.GetName());
+    if (ret) {
+        ret = dataSourcesDatabase.MoveRelative("Signals");
+    }
     if (ret) {
         ret = functionsDatabase.MoveAbsolute("Functions");
     }
@@ -2399,22 +2938,13 @@ bool RealTimeApplicationConfigurationBuilder::AddTimingSignals() {
             for (uint32 k = 0u; (postfix[k] != NULL) && ret; k++) {
                 StreamString signalNameStr = functionName;
                 signalNameStr += postfix[k];
-                uint32 numberOfPresentSignals = dataSourcesDatabase.GetNumberOfChildren();
-                bool found = false;
-                uint32 j;
+                uint32 foundSignalId = 0u;
+                bool found = dataSourcesSignalIndexCache.Read(signalNameStr.Buffer(), foundSignalId);
                 ConfigurationDatabase dataSourcesDatabaseBeforeSignalMove = dataSourcesDatabase;
-                for (j = 0u; (j < numberOfPresentSignals) && (ret) && (!found); j++) {
-                    dataSourcesDatabase = dataSourcesDatabaseBeforeSignalMove;
-                    ret = dataSourcesDatabase.MoveToChild(j);
-                    StreamString toAdd;
-                    if (ret) {
-                        ret = dataSourcesDatabase.Read("QualifiedName", toAdd);
-                    }
+                if (found) {
+                    ret = dataSourcesDatabase.MoveToChild(foundSignalId);
                     if (ret) {
-                        found = (toAdd == signalNameStr);
-                        if (found) {
-                            ret = CheckTimeSignalInfo();
-                        }
+                        ret = CheckTimeSignalInfo();
                     }
                 }
                 if (ret) {
@@ -2428,6 +2958,9 @@ bool RealTimeApplicationConfigurationBuilder::AddTimingSignals() {
                     if (ret) {
                         ret = dataSourcesDatabase.CreateRelative(newSignalIdx.Buffer());
                     }
+                    if (ret) {
+                        ret = dataSourcesSignalIndexCache.Write(signalNameStr.Buffer(), nextIndex);
+                    }
                     if (ret) {
                         ret = WriteTimeSignalInfo(signalNameStr.Buffer());
                     }
@@ -2601,12 +3134,16 @@ bool RealTimeApplicationConfigurationBuilder::ResolveFunctionsMemory(const Signa
     StreamString signalName;
     StreamString alias;
     StreamString dataSourceName;
+    StreamString signalType;
+    StreamString dataSourceType;
     uint32 numberOfOffsetElements = 0u;
     uint32 *offsetMatrixBackend = NULL_PTR(uint32*);
     uint32 samplesBackend = 1u;
     uint32 byteSize = 0u;
     float32 frequencyBackend = -1.0F;
     uint32 triggerBackend = 0u;
+    uint32 decimationBackend = 1u;
+    StreamString reductionBackend;
 
     ConfigurationDatabase beforeOperations = functionsDatabase;
 
@@ -2622,6 +3159,16 @@ bool RealTimeApplicationConfigurationBuilder::ResolveFunctionsMemory(const Signa
         ret = functionsDatabase.Read("DataSource", dataSourceName);
     }
 
+    if (ret) {
+        ret = functionsDatabase.Read("Type", signalType);
+    }
+
+    if (ret) {
+        if (!functionsDatabase.Read("DataSourceType", dataSourceType)) {
+            dataSourceType = "";
+        }
+    }
+
     if (ret) {
         if (!functionsDatabase.Read("MemberSize", byteSize)) {
             ret = functionsDatabase.Read("ByteSize", byteSize);
@@ -2669,6 +3216,12 @@ bool RealTimeApplicationConfigurationBuilder::ResolveFunctionsMemory(const Signa
         if (triggerBackend != 1u) {
             triggerBackend = 0u;
         }
+        if (!functionsDatabase.Read("Decimation", decimationBackend)) {
+            decimationBackend = 1u;
+        }
+        if (!functionsDatabase.Read("Reduction", reductionBackend)) {
+            reductionBackend = "";
+        }
     }
     //Move to the function level
     if (ret) {
@@ -2742,6 +3295,14 @@ bool RealTimeApplicationConfigurationBuilder::ResolveFunctionsMemory(const Signa
     if (ret) {
         ret = functionsDatabase.Write("Alias", alias.Buffer());
     }
+    if (ret) {
+        ret = functionsDatabase.Write("Type", signalType.Buffer());
+    }
+    if (ret) {
+        if (dataSourceType.Size() > 0u) {
+            ret = functionsDatabase.Write("DataSourceType", dataSourceType.Buffer());
+        }
+    }
     if (ret) {
         if (offsetMatrixBackend != NULL_PTR(void*)) {
             Matrix<uint32> offsetMat(offsetMatrixBackend, numberOfOffsetElements, 2u);
@@ -2763,6 +3324,18 @@ bool RealTimeApplicationConfigurationBuilder::ResolveFunctionsMemory(const Signa
         ret = functionsDatabase.Write("Trigger", triggerBackend);
     }
 
+    if (ret) {
+        if (decimationBackend != 1u) {
+            ret = functionsDatabase.Write("Decimation", decimationBackend);
+        }
+    }
+
+    if (ret) {
+        if (reductionBackend.Size() > 0u) {
+            ret = functionsDatabase.Write("Reduction", reductionBackend.Buffer());
+        }
+    }
+
     if (ret) {
         ret = functionsDatabase.Write("GAMMemoryOffset", allocatedByteSize);
     }
@@ -3180,6 +3753,28 @@ bool RealTimeApplicationConfigurationBuilder::FindFunctionNumber(StreamString fu
     return functionsIndexesCache.Read(functionName.Buffer(), functionNumber);
 }
 
+bool RealTimeApplicationConfigurationBuilder::FindFunctionNumber(const Reference &function,
+                                                                 StreamString &functionNumber) {
+    bool found = function.IsValid();
+    if (found) {
+        found = false;
+        uint32 key = functionsReferenceIndex.Key(function->GetName());
+        uint32 cursor = 0u;
+        uint32 candidate = 0u;
+        while ((!found) && (functionsReferenceIndex.Search(key, cursor, candidate))) {
+            Object *candidateObject = NULL_PTR(Object *);
+            if (functionsObjects.Peek(candidate, candidateObject)) {
+                found = (candidateObject == function.operator->());
+            }
+        }
+        if (found) {
+            functionNumber = "";
+            found = functionNumber.Printf("%d", candidate);
+        }
+    }
+    return found;
+}
+
 bool RealTimeApplicationConfigurationBuilder::CheckTypeCompatibility(StreamString &fullType,
                                                                      StreamString &otherFullType,
                                                                      StreamString &signalName,
@@ -3652,7 +4247,7 @@ bool RealTimeApplicationConfigurationBuilder::SignalIntrospectionToStructuredDat
             ret = data.Write("FullType", typeNameStr.Buffer());
         }
         if (ret) {
-            signalDatabase = signalDatabaseBeforeMove;
+            signalDatabase = MARTe2_MOVE(signalDatabaseBeforeMove);
         }
         ConfigurationDatabase dataBeforeMove = data;
         if (ret) {
@@ -4006,6 +4601,8 @@ void RealTimeApplicationConfigurationBuilder::CleanCaches() {
     REPORT_ERROR_STATIC(ErrorManagement::Debug, "Purged functionsMemoryIndexesCache. Number of children:%d", functionsMemoryIndexesCache.GetNumberOfChildren());
     cachedIntrospections.Purge();
     REPORT_ERROR_STATIC(ErrorManagement::Debug, "Purged cachedIntrospections. Number of children:%d", cachedIntrospections.GetNumberOfChildren());
+    functionsReferenceIndex.Reset();
+    functionsObjects.Clean();
 }
 
 bool RealTimeApplicationConfigurationBuilder::WriteDefault(StructuredDataI &sdi,
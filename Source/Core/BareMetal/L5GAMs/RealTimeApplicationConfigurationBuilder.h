@@ -32,7 +32,10 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "DataSourceI.h"
+#include "HashIndex.h"
 #include "RealTimeApplication.h"
+#include "StaticList.h"
+#include "WyHashFunction.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -128,12 +131,15 @@ public:
      *                 +Alias = "Path.In.Data.Source (Otherwise SignalName = NAME)"
      *                 +DataSource = "QualifiedName of the DataSource"
      *                 +Type = BasicType|StructuredType
+     *                 +DataSourceType = BasicType, the type of the signal in the DataSource when it differs from Type. The broker converts the signal (e.g. MemoryMapConvertingInputBroker).
      *                 +NumberOfDimensions = 0|1|2
      *                 +NumberOfElements = NUMBER>0
      *                 +Ranges = {{min_idx:max_idx} {min_idx:max_idx} ...} (min_idx<=max_idx indexes may not overlap)
      *                 +Samples = NUMBER > 0, defines the number of (time) samples to be copied on each operation. The default value is one.
      *                 +Frequency = NUMBER>0, defines the cycle time frequency. Only and only one signal may define this property.
      *                 +Trigger = 0|1, defines if the signal should trigger the destination DataSourceI
+     *                 +Decimation = NUMBER>0, the number of cycles reduced into one value by the broker (see MemoryMapDecimatingBroker). The default value is one.
+     *                 +Reduction = Last|Mean|Min|Max|Boxcar, how the Decimation cycles are reduced (see MemoryMapDecimatingBroker). The default value is Mean.
      *                 +Default = "Default value as a string". The value to be used when the signal is not produced in a previous state.
      *                 +MemberAliases = {//Only valid for StructuredType signals
      *                    OriginalMemberName1 = NewMemberName1
@@ -525,6 +531,24 @@ public:
      */
     bool VerifyConsumersAndProducers();
 
+    /**
+     * @brief For every GAMDataSource with ZeroCopy = 1, finds the signals that can be exchanged without copies and aliases them.
+     * @details A signal qualifies if, in every state where it is consumed: it has one and only one producer (the same in all the states);
+     *  the producer and all the consumers read (or write) the whole signal (no Ranges, Samples = 1, no Frequency nor Trigger);
+     *  and the producer is executed before all the consumers in the same RealTimeThread.
+     *  For each consumer of a qualifying signal the following is added to the functions database:
+     * <pre>
+     *   Functions.NUMBER.Signals.InputSignals.NUMBER = {
+     *     ZeroCopyProducer = "QualifiedName of the function that produces the signal"
+     *     ZeroCopyProducerSignal = "Index of the signal in the OutputSignals of the producer"
+     *   }
+     * </pre>
+     *  and the Broker of the producer and consumers entries of the signal in the data sources database is replaced by ZeroCopy = 1,
+     *  so that no BrokerI copies the signal (see RealTimeApplication::AliasGAMMemory and GAM::AliasInputSignalMemory).
+     * @return true if all the qualifying signals can be aliased.
+     */
+    bool ResolveZeroCopySignals();
+
 
     /**
      * @brief For each GAM signal, the DataSource will write the name of the BrokerI to be used.
@@ -658,7 +682,7 @@ public:
      *   InitialiseSignalsDatabase(), FlattenSignalsDatabases(), ResolveDataSources(),
      * VerifyDataSourcesSignals(), ResolveFunctionSignals(), VerifyFunctionSignals(), ResolveStates(),
      * ResolveConsumersAndProducers(), VerifyConsumersAndProducers(), ResolveFunctionSignalsMemorySize(), ResolveFunctionsMemory(),
-     * AssignFunctionsMemoryToDataSource)() and AssignBrokersToFunctions()
+     * AssignFunctionsMemoryToDataSource)(), AssignBrokersToFunctions() and ResolveZeroCopySignals()
      * @post
      *   The functions PostConfigureDataSources() and PostConfigureFunctions() can now be called.
      */
@@ -751,6 +775,16 @@ private:
      */
     ConfigurationDatabase functionsMemoryIndexesCache;
 
+    /**
+     * Index by name of the Function objects found by InitialiseSignalsDatabase. The values are the Function numbers.
+     */
+    HashIndex<uint32, WyHashFunction> functionsReferenceIndex;
+
+    /**
+     * The Function objects found by InitialiseSignalsDatabase, in the order of the Function numbers.
+     */
+    StaticList<Object *> functionsObjects;
+
     /**
      * The default DataSource name to be used if this is not defined in any of the signals.
      */
@@ -855,6 +889,54 @@ private:
      */
     bool CheckProducersRanges(const uint32 * const rangesArray,
                               const uint32 numberOfElements) const;
+
+    /**
+     * @brief Checks if the data source signal where the dataSourcesDatabase is pointing to qualifies for zero-copy and, if so, aliases it.
+     * @param[in] dataSourceNode the data source node (in the dataSourcesDatabase) of the signal.
+     * @return true if the signal does not qualify or if it can be successfully aliased (see ResolveZeroCopySignals).
+     */
+    bool ResolveZeroCopySignal(const ConfigurationDatabase &dataSourceNode);
+
+    /**
+     * @brief Checks if the function signal reads (or writes) the whole data source signal in a single sample.
+     * @param[in] direction the signal direction.
+     * @param[in] dataSourceName the name of the data source.
+     * @param[in] functionId the identifier of the function in the functionsDatabase.
+     * @param[in] signalId the identifier of the signal in the function.
+     * @param[in] signalByteSize the byte size of the data source signal.
+     * @param[out] gamMemoryOffset the offset of the signal in the GAM memory.
+     * @return true if the whole signal is read (or written) in a single sample.
+     */
+    bool IsZeroCopyFunctionSignal(const SignalDirection direction,
+                                  const char8 * const dataSourceName,
+                                  StreamString functionId,
+                                  StreamString signalId,
+                                  const uint32 signalByteSize,
+                                  uint32 &gamMemoryOffset);
+
+    /**
+     * @brief Checks if, in the state  stateName, the producer is executed before all the consumers in the same RealTimeThread.
+     * @param[in] stateName the name of the state.
+     * @param[in] producerId the identifier of the producer in the functionsDatabase.
+     * @param[in] consumerIds the identifiers of the consumers in the functionsDatabase.
+     * @return true if the producer is executed before all the consumers in the same RealTimeThread.
+     */
+    bool IsZeroCopyExecutionOrder(const char8 * const stateName,
+                                  StreamString producerId,
+                                  Vector<StreamString> &consumerIds);
+
+    /**
+     * @brief Replaces the Broker of a function signal in the data sources database by ZeroCopy = 1.
+     * @param[in] direction the signal direction.
+     * @param[in] dataSourceNode the data source node in the dataSourcesDatabase.
+     * @param[in] functionName the QualifiedName of the function.
+     * @param[in] gamMemoryOffset the offset of the signal in the GAM memory.
+     * @return true if the function signal exists and can be updated.
+     */
+    bool SetZeroCopyFunctionSignal(const SignalDirection direction,
+                                   const ConfigurationDatabase &dataSourceNode,
+                                   const char8 * const functionName,
+                                   const uint32 gamMemoryOffset);
     /**
      * @brief @see ResolveFunctionSignalsMemorySize()
      * @param[in] direction can be either InputSignals or OutputSignals
@@ -906,6 +988,15 @@ private:
     bool FindFunctionNumber(StreamString functionName,
                             StreamString &functionNumber);
 
+    /**
+     * @brief Find the unique number associated to a Function object found by InitialiseSignalsDatabase.
+     * @param[in] function the Function (GAM) to search.
+     * @param[out] functionNumber the number associated to the \a function.
+     * @return true iff the \a function was found by InitialiseSignalsDatabase.
+     */
+    bool FindFunctionNumber(const Reference &function,
+                            StreamString &functionNumber);
+
     /**
      * @brief Check that two types are compatible. Notice that the two types can belong to different structures  and
      *  they will be compatible iff the full structure path is equivalent.
@@ -1056,6 +1147,22 @@ private:
      */
     bool AddThreadCycleTime(const char8 * const threadFullName);
 
+    /**
+     * @brief Adds to the TimingDataSource the release lateness signal (x_Lateness where x is the RealTimeThread name)
+     * of a RealTimeThread that has a Period defined.
+     * @return true if the RealTimeThread lateness signal can be successfully added.
+     */
+    bool AddThreadLateness(const char8 * const threadFullName);
+
+    /**
+     * @brief Adds to the TimingDataSource a uint32 signal named threadFullName + signalSuffix (if it does not exist yet).
+     * @param[in] threadFullName the full name (State.Thread) of the RealTimeThread.
+     * @param[in] signalSuffix the suffix to be appended to \a threadFullName.
+     * @return true if the signal can be successfully added.
+     */
+    bool AddThreadTimeSignal(const char8 * const threadFullName,
+                             const char8 * const signalSuffix);
+
     /**
      * @brief Writes all the properties related to the TimingDataSource signals.
      * @param[in] signalName the signal name to be updated.
@@ -55,6 +55,24 @@ RealTimeThread::RealTimeThread() :
     numberOfGAMs = 0u;
     cpuMask = ProcessorType::GetDefaultCPUs();
     stackSize = THREADS_DEFAULT_STACKSIZE;
+    period = 0u;
+    phase = 0u;
+    busyWaitTail = 0u;
+    deadlineRuntime = 0u;
+    deadlineDeadline = 0u;
+    deadlinePeriod = 0u;
+    prefaultStackSize = 0u;
+    workerCPUs = NULL_PTR(uint32 *);
+    numberOfWorkers = 0u;
+    pipelineStages = NULL_PTR(StreamString *);
+    pipelineCPUs = NULL_PTR(uint32 *);
+    numberOfPipelineStages = 0u;
+    prefetchBrokers = false;
+    cycleBudget = 0u;
+    overrunMessageThreshold = 1u;
+    executionDividers = NULL_PTR(uint32 *);
+    executionPhases = NULL_PTR(uint32 *);
+    gamFunctions = NULL_PTR(uint32 *);
     configured = false;
 }
 
@@ -63,6 +81,24 @@ RealTimeThread::~RealTimeThread() {
     if (functions != NULL) {
         delete[] functions;
     }
+    if (workerCPUs != NULL_PTR(uint32 *)) {
+        delete[] workerCPUs;
+    }
+    if (pipelineStages != NULL_PTR(StreamString *)) {
+        delete[] pipelineStages;
+    }
+    if (pipelineCPUs != NULL_PTR(uint32 *)) {
+        delete[] pipelineCPUs;
+    }
+    if (executionDividers != NULL_PTR(uint32 *)) {
+        delete[] executionDividers;
+    }
+    if (executionPhases != NULL_PTR(uint32 *)) {
+        delete[] executionPhases;
+    }
+    if (gamFunctions != NULL_PTR(uint32 *)) {
+        delete[] gamFunctions;
+    }
 }
 bool RealTimeThread::ConfigureArchitecture() {
 
@@ -100,6 +136,8 @@ bool RealTimeThread::ConfigureArchitecture() {
         }
         ret = isAppFound && isStateFound;
         absoluteFunctionPath += "Functions.";
+        //The number of GAMs after each Function, to map the GAMs to the ExecutionDividers
+        uint32 *functionEnd = new uint32[numberOfFunctions];
 
         for (uint32 i = 0u; (i < numberOfFunctions) && (ret); i++) {
 
@@ -122,6 +160,8 @@ bool RealTimeThread::ConfigureArchitecture() {
 
                     functionGeneric->Find(GAMs, gamFilter);
                     numberOfGAMs = GAMs.Size();
+                    /*lint -e{613} functionEnd has numberOfFunctions elements*/
+                    functionEnd[i] = numberOfGAMs;
                 }
                 else {
                     REPORT_ERROR(ErrorManagement::FatalError, "Insert into GAMs failed", "");
@@ -157,6 +197,17 @@ bool RealTimeThread::ConfigureArchitecture() {
             }
 
         }
+        if ((ret) && (executionDividers != NULL_PTR(uint32 *)) && (numberOfGAMs > 0u)) {
+            gamFunctions = new uint32[numberOfGAMs];
+            uint32 f = 0u;
+            for (uint32 n = 0u; n < numberOfGAMs; n++) {
+                while (functionEnd[f] <= n) {
+                    f++;
+                }
+                gamFunctions[n] = f;
+            }
+        }
+        delete[] functionEnd;
         configured = true;
     }
     return ret;
@@ -184,15 +235,174 @@ bool RealTimeThread::Initialise(StructuredDataI & data) {
         REPORT_ERROR(ErrorManagement::FatalError, "No functions defined for the RealTimeThread %s", GetName());
     }
     if (ret) {
-        // TODO using better way to read/write BitSet
-        uint32 cpuConfig = 0u;
-        if (!data.Read("CPUs", cpuConfig)) {
+        //A mask (e.g. 0xF) or a list of CPUs (e.g. "0-3,64-67"), see ProcessorType::SetFromString
+        StreamString cpuConfig;
+        if (data.Read("CPUs", cpuConfig)) {
+            ret = cpuMask.SetFromString(cpuConfig.Buffer());
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Invalid CPUs %s for the RealTimeThread %s", cpuConfig.Buffer(), GetName());
+            }
+        }
+        else {
             REPORT_ERROR(ErrorManagement::Information, "No CPUs defined for the RealTimeThread %s", GetName());
+            cpuMask = ProcessorType(0u);
         }
         if (!data.Read("StackSize", stackSize)) {
             REPORT_ERROR(ErrorManagement::Information, "No StackSize defined for the RealTimeThread %s", GetName());
         }
-        cpuMask = ProcessorType(cpuConfig);
+        if ((ret) && (data.Read("Period", period))) {
+            if (!data.Read("Phase", phase)) {
+                phase = 0u;
+            }
+            if (!data.Read("BusyWaitTail", busyWaitTail)) {
+                busyWaitTail = 0u;
+            }
+            if (period > 0u) {
+                ret = (phase < period);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "The Phase shall be smaller than the Period for the RealTimeThread %s", GetName());
+                }
+                if (ret) {
+                    ret = (busyWaitTail < period);
+                    if (!ret) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "The BusyWaitTail shall be smaller than the Period for the RealTimeThread %s", GetName());
+                    }
+                }
+            }
+        }
+    }
+    if (ret) {
+        if (data.Read("PrefaultStackSize", prefaultStackSize)) {
+            ret = (prefaultStackSize < stackSize);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The PrefaultStackSize shall be smaller than the StackSize for the RealTimeThread %s", GetName());
+            }
+        }
+    }
+    if (ret) {
+        if (data.MoveRelative("SchedDeadline")) {
+            ret = data.Read("Runtime", deadlineRuntime);
+            if (ret) {
+                ret = data.Read("Period", deadlinePeriod);
+            }
+            if (ret) {
+                if (!data.Read("Deadline", deadlineDeadline)) {
+                    deadlineDeadline = deadlinePeriod;
+                }
+                ret = ((deadlineRuntime > 0u) && (deadlineRuntime <= deadlineDeadline) && (deadlineDeadline <= deadlinePeriod));
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The SchedDeadline shall define 0 < Runtime <= Deadline <= Period for the RealTimeThread %s", GetName());
+            }
+            if (!data.MoveToAncestor(1u)) {
+                ret = false;
+            }
+        }
+    }
+    if (ret) {
+        AnyType workersArray = data.GetType("WorkerCPUs");
+        if (workersArray.GetDataPointer() != NULL) {
+            numberOfWorkers = workersArray.GetNumberOfElements(0u);
+            ret = (numberOfWorkers > 0u);
+            if (ret) {
+                workerCPUs = new uint32[numberOfWorkers];
+                Vector<uint32> workersVector(workerCPUs, numberOfWorkers);
+                ret = data.Read("WorkerCPUs", workersVector);
+            }
+            for (uint32 w = 0u; (w < numberOfWorkers) && (ret); w++) {
+                ret = (workerCPUs[w] < PROCESSOR_TYPE_MAX_CPUS);
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Invalid WorkerCPUs for the RealTimeThread %s", GetName());
+            }
+        }
+    }
+    if (ret) {
+        AnyType stagesArray = data.GetType("PipelineStages");
+        if (stagesArray.GetDataPointer() != NULL) {
+            numberOfPipelineStages = stagesArray.GetNumberOfElements(0u);
+            ret = (numberOfPipelineStages > 0u);
+            if (ret) {
+                pipelineStages = new StreamString[numberOfPipelineStages];
+                Vector<StreamString> stagesVector(pipelineStages, numberOfPipelineStages);
+                ret = data.Read("PipelineStages", stagesVector);
+            }
+            if (ret) {
+                AnyType cpusArray = data.GetType("PipelineCPUs");
+                ret = (cpusArray.GetDataPointer() != NULL);
+                if (ret) {
+                    ret = (cpusArray.GetNumberOfElements(0u) == numberOfPipelineStages);
+                }
+            }
+            if (ret) {
+                pipelineCPUs = new uint32[numberOfPipelineStages];
+                Vector<uint32> cpusVector(pipelineCPUs, numberOfPipelineStages);
+                ret = data.Read("PipelineCPUs", cpusVector);
+            }
+            for (uint32 s = 0u; (s < numberOfPipelineStages) && (ret); s++) {
+                ret = (pipelineCPUs[s] < PROCESSOR_TYPE_MAX_CPUS);
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError,
+                             "PipelineStages requires one PipelineCPUs element (smaller than PROCESSOR_TYPE_MAX_CPUS) per stage for the RealTimeThread %s", GetName());
+            }
+        }
+    }
+    if (ret) {
+        uint8 prefetchBrokersIn = 0u;
+        if (!data.Read("PrefetchBrokers", prefetchBrokersIn)) {
+            prefetchBrokersIn = 0u;
+        }
+        prefetchBrokers = (prefetchBrokersIn == 1u);
+    }
+    if (ret) {
+        if (!data.Read("CycleBudget", cycleBudget)) {
+            cycleBudget = 0u;
+        }
+        if (!data.Read("OverrunMessageThreshold", overrunMessageThreshold)) {
+            overrunMessageThreshold = 1u;
+        }
+    }
+    if (ret) {
+        AnyType dividersArray = data.GetType("ExecutionDividers");
+        if (dividersArray.GetDataPointer() != NULL) {
+            ret = (dividersArray.GetNumberOfElements(0u) == numberOfFunctions);
+            if (ret) {
+                executionDividers = new uint32[numberOfFunctions];
+                Vector<uint32> dividersVector(executionDividers, numberOfFunctions);
+                ret = data.Read("ExecutionDividers", dividersVector);
+            }
+            for (uint32 f = 0u; (f < numberOfFunctions) && (ret); f++) {
+                ret = (executionDividers[f] > 0u);
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "ExecutionDividers requires one element (greater than zero) per Function for the RealTimeThread %s",
+                             GetName());
+            }
+            if (ret) {
+                ret = ((numberOfWorkers == 0u) && (numberOfPipelineStages == 0u));
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "ExecutionDividers cannot be combined with WorkerCPUs nor PipelineStages for the RealTimeThread %s",
+                                 GetName());
+                }
+            }
+            AnyType phasesArray = data.GetType("ExecutionPhases");
+            if ((ret) && (phasesArray.GetDataPointer() != NULL)) {
+                ret = (phasesArray.GetNumberOfElements(0u) == numberOfFunctions);
+                if (ret) {
+                    executionPhases = new uint32[numberOfFunctions];
+                    Vector<uint32> phasesVector(executionPhases, numberOfFunctions);
+                    ret = data.Read("ExecutionPhases", phasesVector);
+                }
+                for (uint32 f = 0u; (f < numberOfFunctions) && (ret); f++) {
+                    ret = (executionPhases[f] < executionDividers[f]);
+                }
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::ParametersError,
+                                 "ExecutionPhases requires one element (smaller than its ExecutionDivider) per Function for the RealTimeThread %s", GetName());
+                }
+            }
+        }
     }
 
     return ret;
@@ -227,6 +437,90 @@ ProcessorType RealTimeThread::GetCPU() const {
     return cpuMask;
 }
 
+uint32 RealTimeThread::GetPeriod() const {
+    return period;
+}
+
+uint32 RealTimeThread::GetPhase() const {
+    return phase;
+}
+
+uint32 RealTimeThread::GetBusyWaitTail() const {
+    return busyWaitTail;
+}
+
+bool RealTimeThread::GetDeadline(uint32 &runtime,
+                                 uint32 &deadline,
+                                 uint32 &periodOut) const {
+    runtime = deadlineRuntime;
+    deadline = deadlineDeadline;
+    periodOut = deadlinePeriod;
+    return (deadlinePeriod > 0u);
+}
+
+uint32 RealTimeThread::GetNumberOfWorkers() const {
+    return numberOfWorkers;
+}
+
+const uint32 *RealTimeThread::GetWorkerCPUs() const {
+    return workerCPUs;
+}
+
+uint32 RealTimeThread::GetNumberOfPipelineStages() const {
+    return numberOfPipelineStages;
+}
+
+const StreamString *RealTimeThread::GetPipelineStages() const {
+    return pipelineStages;
+}
+
+const uint32 *RealTimeThread::GetPipelineCPUs() const {
+    return pipelineCPUs;
+}
+
+bool RealTimeThread::GetPrefetchBrokers() const {
+    return prefetchBrokers;
+}
+
+uint32 RealTimeThread::GetCycleBudget() const {
+    return cycleBudget;
+}
+
+uint32 RealTimeThread::GetOverrunMessageThreshold() const {
+    return overrunMessageThreshold;
+}
+
+bool RealTimeThread::IsMultiRate() const {
+    bool multiRate = false;
+    if (executionDividers != NULL_PTR(uint32 *)) {
+        for (uint32 f = 0u; (f < numberOfFunctions) && (!multiRate); f++) {
+            multiRate = (executionDividers[f] > 1u);
+        }
+    }
+    return multiRate;
+}
+
+uint32 RealTimeThread::GetExecutionDivider(const uint32 gamIdx) const {
+    uint32 divider = 1u;
+    if ((gamFunctions != NULL_PTR(uint32 *)) && (gamIdx < numberOfGAMs)) {
+        divider = executionDividers[gamFunctions[gamIdx]];
+    }
+    return divider;
+}
+
+bool RealTimeThread::GetExecutionPhase(const uint32 gamIdx,
+                                       uint32 &phaseOut) const {
+    bool ok = ((gamFunctions != NULL_PTR(uint32 *)) && (executionPhases != NULL_PTR(uint32 *)) && (gamIdx < numberOfGAMs));
+    if (ok) {
+        phaseOut = executionPhases[gamFunctions[gamIdx]];
+    }
+    return ok;
+}
+
+uint32 RealTimeThread::GetPrefaultStackSize() const {
+    return prefaultStackSize;
+}
+
 bool RealTimeThread::ToStructuredData(StructuredDataI& data) {
     const char8 * objName = GetName();
     StreamString objNameToPrint = (IsDomain()) ? ("$") : ("+");
@@ -49,8 +49,21 @@ namespace MARTe {
  * +RealTimeThread_name = {\n
  *     Class = RealTimeThread\n
  *     Functions = { GAM1_name, GAMGroup2_name, ... }
- *     CPUs = 0xf //CPU affinity mask for the thread. Optional parameter.
+ *     CPUs = 0xf //CPU affinity mask for the thread (or a list of CPUs, e.g. "0-3,64-67"). Optional parameter.
  *     StackSize = 32768 //Stack size for the thread. Optional parameter.
+ *     Period = 1000 //Absolute-deadline release period in micro-seconds. Optional parameter.
+ *     Phase = 0 //Release offset in micro-seconds with respect to a multiple of the Period. Optional parameter.
+ *     BusyWaitTail = 0 //Micro-seconds before each release that are spent busy waiting. Optional parameter.
+ *     SchedDeadline = { Runtime = 200 Deadline = 1000 Period = 1000 } //SCHED_DEADLINE reservation in micro-seconds. Optional parameter.
+ *     PrefaultStackSize = 16384 //Number of stack bytes to prefault when the thread starts. Optional parameter.
+ *     WorkerCPUs = { 2 3 } //CPUs of the worker threads that execute the independent GAMs in parallel. Optional parameter.
+ *     PipelineStages = { GAM3 GAM5 } //First Function of each pipeline stage after the first one. Optional parameter.
+ *     PipelineCPUs = { 2 3 } //CPU of each pipeline stage after the first one. Mandatory if PipelineStages is set.
+ *     PrefetchBrokers = 0 //If 1 the memory of the brokers is prefetched while the previous GAM executes. Optional parameter.
+ *     CycleBudget = 800 //Maximum execution time of a cycle in micro-seconds, monitored by the scheduler. Optional parameter.
+ *     OverrunMessageThreshold = 1 //Consecutive overruns of the CycleBudget that send the scheduler OverrunMessage. Optional parameter.
+ *     ExecutionDividers = { 1 10 ... } //Each Function is executed once every ExecutionDividers cycles. Optional parameter.
+ *     ExecutionPhases = { 0 3 ... } //The cycle (modulo its ExecutionDivider) in which each Function is executed. Optional parameter.
  * }\n
  */
 class DLL_API RealTimeThread: public ReferenceContainer {
@@ -66,7 +79,10 @@ public:
      *   GetGAMs() == NULL &&
      *   GetNumberOfGAMs() == 0 &&
      *   GetCPU() == ProcessorType::GetDefaultCPUs() &&
-     *   GetStackSize() == THREADS_DEFAULT_STACKSIZE
+     *   GetStackSize() == THREADS_DEFAULT_STACKSIZE &&
+     *   GetPeriod() == 0 &&
+     *   GetPhase() == 0 &&
+     *   GetBusyWaitTail() == 0
      */
     RealTimeThread();
 
@@ -92,11 +108,38 @@ public:
      * The following fields can be defined
      *
      *   StackSize = (the memory stack size in byte to be associated to the this thread)
-     *   CPUs = cpu mask where this thread is preferable to be executed (i.e 0x1 means the first cpu, 0x2 means the second, 0x3 first and second, ...).
+     *   CPUs = cpu mask where this thread is preferable to be executed (i.e 0x1 means the first cpu, 0x2 means the second, 0x3 first and second, ...) or list of CPUs
+     *   (e.g. "0-3,64-67" for the CPUs 0 to 3 and 64 to 67, see ProcessorType::SetFromString).
+     *   Period = (the release period in micro-seconds. If greater than zero the scheduler releases each cycle at an absolute monotonic deadline).
+     *   Phase = (the release offset in micro-seconds. Shall be smaller than the Period).
+     *   BusyWaitTail = (the last micro-seconds before each release that are spent busy waiting instead of sleeping. Shall be smaller than the Period).
+     *   SchedDeadline = { Runtime Deadline Period } (the SCHED_DEADLINE reservation in micro-seconds, see Threads::SetDeadline. Shall verify 0 < Runtime <= Deadline <= Period. Deadline defaults to the Period).
+     *   PrefaultStackSize = (the number of stack bytes to prefault when the thread starts. Shall be smaller than the StackSize).
+     *   WorkerCPUs = { cpu1 cpu2 ... } (the CPU numbers where the worker threads of the parallel execution mode are pinned, one worker
+     *     per element). If set, the GAMs which do not depend on each other (see GAMSchedulerI) are executed in parallel by this thread and
+     *     by the workers, with a fork/join barrier between each level of the dependency graph. Only honoured by the GAMScheduler.
+     *   PipelineStages = { gam1 gam2 ... } (the names of the Functions that start each pipeline stage after the first one). If set,
+     *     the Functions are split in consecutive stages which execute different cycles at the same time. Only honoured by the PipelineScheduler.
+     *   PipelineCPUs = { cpu1 cpu2 ... } (the CPU number where the thread of each pipeline stage after the first one is pinned).
+     *   PrefetchBrokers = (if 1, before each GAM is executed, the memory copied by the MemoryMap brokers that follow it is prefetched in
+     *     the cache, so that the cache misses of the brokers are served while the GAM executes. Not honoured for threads with WorkerCPUs).
+     *   CycleBudget = (the maximum execution time of a cycle in micro-seconds. If greater than zero the scheduler counts the cycles which
+     *     exceed it and keeps the worst execution time, see GAMSchedulerI::CheckCycleBudget).
+     *   OverrunMessageThreshold = (the number of consecutive overruns of the CycleBudget after which the OverrunMessage of the scheduler is sent,
+     *     once per sequence of overruns. Zero disables the message. Default = 1).
+     *   ExecutionDividers = { divider1 divider2 ... } (one element per Function. The GAMs of the Function, and their brokers, are only executed
+     *     once every divider cycles of the thread and are skipped, at no cost, in the other cycles. Default = 1 for all the Functions).
+     *   ExecutionPhases = { phase1 phase2 ... } (one element per Function, each smaller than its divider. The GAMs of the Function are executed
+     *     in the cycles c, counted from the beginning of the state, with (c % divider) == phase. If not set, the scheduler chooses the phases
+     *     of the divided Functions so that the GAMs are spread as evenly as possible over the cycles, see GAMSchedulerI).
+     *     ExecutionDividers cannot be combined with WorkerCPUs nor with PipelineStages.
      *
-     * The default value for StackSize is THREADS_DEFAULT_STACKSIZE, while for CPUs is ProcessorType::GetDefaultCPUs().\n
+     * The default value for StackSize is THREADS_DEFAULT_STACKSIZE, while for CPUs is ProcessorType::GetDefaultCPUs().
+     * Period, Phase and BusyWaitTail are zero by default, i.e. the thread runs as fast as its GAMs and DataSources allow.\n
      * @param[in] data is the StructuredData to be read from.
-     * @return true if the parameters Functions is declared in \a data and the number of elements in Functions is greater than zero.
+     * @return true if the parameters Functions is declared in \a data and the number of elements in Functions is greater than zero
+     * and, if the Period is set, the Phase and the BusyWaitTail are smaller than the Period and, if the ExecutionDividers are set, there is
+     * one (greater than zero) for each Function and the ExecutionPhases are valid.
      * @post
      *   GetFunctions() != NULL  &&
      *   GetNumberOfFunctions() > 0
@@ -154,6 +197,115 @@ public:
      */
     ProcessorType GetCPU() const;
 
+    /**
+     * @brief Retrieves the absolute-deadline release period of this thread.
+     * @return the period in micro-seconds (0 if the thread is not periodically released).
+     */
+    uint32 GetPeriod() const;
+
+    /**
+     * @brief Retrieves the release offset of this thread.
+     * @return the phase in micro-seconds.
+     */
+    uint32 GetPhase() const;
+
+    /**
+     * @brief Retrieves the time before each release that is spent busy waiting.
+     * @return the busy wait tail in micro-seconds.
+     */
+    uint32 GetBusyWaitTail() const;
+
+    /**
+     * @brief Retrieves the SCHED_DEADLINE reservation of this thread.
+     * @param[out] runtime the CPU time reserved in each period in micro-seconds.
+     * @param[out] deadline the relative deadline in micro-seconds.
+     * @param[out] periodOut the reservation period in micro-seconds.
+     * @return true if a SchedDeadline was defined.
+     */
+    bool GetDeadline(uint32 &runtime,
+                     uint32 &deadline,
+                     uint32 &periodOut) const;
+
+    /**
+     * @brief Retrieves the number of stack bytes to prefault when the thread starts.
+     * @return the number of stack bytes to prefault.
+     */
+    uint32 GetPrefaultStackSize() const;
+
+    /**
+     * @brief Gets the number of worker threads of the parallel execution mode.
+     * @return the number of elements of WorkerCPUs (0 if the GAMs are to be executed sequentially).
+     */
+    uint32 GetNumberOfWorkers() const;
+
+    /**
+     * @brief Gets the CPU numbers where the worker threads are to be pinned.
+     * @return the WorkerCPUs array (NULL if GetNumberOfWorkers() == 0).
+     */
+    const uint32 *GetWorkerCPUs() const;
+
+    /**
+     * @brief Gets the number of pipeline stages after the first one.
+     * @return the number of elements of PipelineStages (0 if the Functions are not split in pipeline stages).
+     */
+    uint32 GetNumberOfPipelineStages() const;
+
+    /**
+     * @brief Gets the names of the Functions that start each pipeline stage after the first one.
+     * @return the PipelineStages array (NULL if GetNumberOfPipelineStages() == 0).
+     */
+    const StreamString *GetPipelineStages() const;
+
+    /**
+     * @brief Gets the CPU numbers where the threads of the pipeline stages after the first one are to be pinned.
+     * @return the PipelineCPUs array (NULL if GetNumberOfPipelineStages() == 0).
+     */
+    const uint32 *GetPipelineCPUs() const;
+
+    /**
+     * @brief Checks if the memory of the brokers is to be prefetched.
+     * @return true if PrefetchBrokers = 1.
+     */
+    bool GetPrefetchBrokers() const;
+
+    /**
+     * @brief Gets the maximum execution time of a cycle.
+     * @return the CycleBudget in micro-seconds (0 if the cycles are not monitored).
+     */
+    uint32 GetCycleBudget() const;
+
+    /**
+     * @brief Gets the number of consecutive overruns of the CycleBudget after which the OverrunMessage is sent.
+     * @return the OverrunMessageThreshold.
+     */
+    uint32 GetOverrunMessageThreshold() const;
+
+    /**
+     * @brief Checks if any of the Functions is not executed in every cycle.
+     * @return true if any of the ExecutionDividers is greater than one.
+     */
+    bool IsMultiRate() const;
+
+    /**
+     * @brief Gets the number of cycles between two executions of a GAM.
+     * @param[in] gamIdx the index of the GAM (in the GetGAMs order).
+     * @return the ExecutionDivider of the Function of the GAM (1 if not set).
+     * @pre
+     *   ConfigureArchitecture()
+     */
+    uint32 GetExecutionDivider(const uint32 gamIdx) const;
+
+    /**
+     * @brief Gets the cycle (modulo its ExecutionDivider) in which a GAM is executed.
+     * @param[in] gamIdx the index of the GAM (in the GetGAMs order).
+     * @param[out] phaseOut the ExecutionPhase of the Function of the GAM.
+     * @return false if the ExecutionPhases are not set (i.e. the phase is to be chosen by the scheduler).
+     * @pre
+     *   ConfigureArchitecture()
+     */
+    bool GetExecutionPhase(const uint32 gamIdx,
+                           uint32 &phaseOut) const;
+
     /**
      * @see Object::ToStructuredData(*)
      */
@@ -196,6 +348,96 @@ private:
      */
     uint32 stackSize;
 
+    /**
+     * The release period in micro-seconds.
+     */
+    uint32 period;
+
+    /**
+     * The release offset in micro-seconds.
+     */
+    uint32 phase;
+
+    /**
+     * The busy wait tail in micro-seconds.
+     */
+    uint32 busyWaitTail;
+
+    /**
+     * The SCHED_DEADLINE runtime in micro-seconds.
+     */
+    uint32 deadlineRuntime;
+
+    /**
+     * The SCHED_DEADLINE relative deadline in micro-seconds.
+     */
+    uint32 deadlineDeadline;
+
+    /**
+     * The SCHED_DEADLINE period in micro-seconds (0 => not used).
+     */
+    uint32 deadlinePeriod;
+
+    /**
+     * The number of stack bytes to prefault.
+     */
+    uint32 prefaultStackSize;
+
+    /**
+     * The CPU numbers of the worker threads.
+     */
+    uint32 *workerCPUs;
+
+    /**
+     * The number of worker threads.
+     */
+    uint32 numberOfWorkers;
+
+    /**
+     * The names of the Functions that start each pipeline stage after the first one.
+     */
+    StreamString *pipelineStages;
+
+    /**
+     * The CPU numbers of the pipeline stages after the first one.
+     */
+    uint32 *pipelineCPUs;
+
+    /**
+     * The number of pipeline stages after the first one.
+     */
+    uint32 numberOfPipelineStages;
+
+    /**
+     * True if the memory of the brokers is to be prefetched.
+     */
+    bool prefetchBrokers;
+
+    /**
+     * The maximum execution time of a cycle in micro-seconds.
+     */
+    uint32 cycleBudget;
+
+    /**
+     * The consecutive overruns of the cycleBudget after which the OverrunMessage is sent.
+     */
+    uint32 overrunMessageThreshold;
+
+    /**
+     * The ExecutionDividers of the Functions (NULL if not set).
+     */
+    uint32 *executionDividers;
+
+    /**
+     * The ExecutionPhases of the Functions (NULL if not set).
+     */
+    uint32 *executionPhases;
+
+    /**
+     * The index of the Function of each GAM (NULL if the ExecutionDividers are not set).
+     */
+    uint32 *gamFunctions;
+
     /**
      * Set to true after ConfigureArchitecture has been called at least once
      */
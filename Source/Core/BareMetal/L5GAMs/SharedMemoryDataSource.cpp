@@ -0,0 +1,573 @@
+/**
+ * @file SharedMemoryDataSource.cpp
+ * @brief Source file for class SharedMemoryDataSource
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryDataSource (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "MemoryOperationsHelper.h"
+#include "SharedMemory.h"
+#include "SharedMemoryDataSource.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The header, the sequences, the descriptors and each buffer start at a multiple of this size,
+ * so that the writer and the readers only share the cache lines that they need to share.
+ */
+static const uint32 SHARED_MEMORY_DATASOURCE_CACHE_LINE_SIZE = 64u;
+
+/**
+ * Maximum number of times that a reader tries to take a consistent copy of the last published buffer.
+ */
+static const uint32 SHARED_MEMORY_DATASOURCE_MAX_READ_RETRIES = 1000u;
+
+/**
+ * Size of the name in a SharedMemoryDataSourceSignal.
+ */
+static const uint32 SHARED_MEMORY_DATASOURCE_NAME_SIZE = 64u;
+
+/**
+ * Size of the type in a SharedMemoryDataSourceSignal.
+ */
+static const uint32 SHARED_MEMORY_DATASOURCE_TYPE_SIZE = 32u;
+
+static uint32 SharedMemoryDataSourceAlign(const uint32 size) {
+    return (size + (SHARED_MEMORY_DATASOURCE_CACHE_LINE_SIZE - 1u)) & ~(SHARED_MEMORY_DATASOURCE_CACHE_LINE_SIZE - 1u);
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+SharedMemoryDataSource::SharedMemoryDataSource() :
+        MemoryDataSourceI() {
+    writer = false;
+    lockSegment = false;
+    numberOfSegmentBuffers = 0u;
+    segment = NULL_PTR(uint8 *);
+    segmentSize = 0u;
+    header = NULL_PTR(SharedMemoryDataSourceHeader *);
+    writeBuffer = 0u;
+    segmentOffsets = NULL_PTR(uint32 *);
+    attachFailureReported = false;
+    publishedSamples = 0;
+    staleReads = 0;
+    overruns = 0;
+}
+
+/*lint -e{1551} the destructor must guarantee that the segment is released.*/
+SharedMemoryDataSource::~SharedMemoryDataSource() {
+    if (writer) {
+        if (header != NULL_PTR(SharedMemoryDataSourceHeader *)) {
+            //The readers of this segment look for a new one
+            Atomic::Store(&header->state, SHARED_MEMORY_DATASOURCE_CLOSED, Atomic::MemoryOrderRelease);
+        }
+        DetachSegment();
+        if (segmentName.Size() > 0u) {
+            (void) SharedMemory::Remove(segmentName.Buffer());
+        }
+        //The memory is inside of the segment and shall not be freed by the MemoryDataSourceI
+        memory = NULL_PTR(uint8 *);
+    }
+    else {
+        DetachSegment();
+    }
+    if (segmentOffsets != NULL_PTR(uint32 *)) {
+        delete[] segmentOffsets;
+    }
+}
+
+bool SharedMemoryDataSource::Initialise(StructuredDataI & data) {
+    bool ret = MemoryDataSourceI::Initialise(data);
+    if (ret) {
+        ret = data.Read("SegmentName", segmentName);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In SharedMemoryDataSource %s, SegmentName shall be set", GetName());
+        }
+    }
+    if (ret) {
+        //Each buffer of the segment holds one sample of each signal
+        numberOfSegmentBuffers = numberOfBuffers;
+        numberOfBuffers = 1u;
+        uint32 lockMemoryUInt32 = 0u;
+        (void) data.Read("LockMemory", lockMemoryUInt32);
+        lockSegment = (lockMemoryUInt32 == 1u);
+    }
+    return ret;
+}
+
+bool SharedMemoryDataSource::SetConfiguredDatabase(StructuredDataI & data) {
+    bool ret = MemoryDataSourceI::SetConfiguredDatabase(data);
+    uint32 numberOfWriters = 0u;
+    uint32 numberOfReaders = 0u;
+    uint32 nOfFunctions = GetNumberOfFunctions();
+    uint32 f;
+    for (f = 0u; (f < nOfFunctions) && (ret); f++) {
+        StreamString functionName;
+        ret = GetFunctionName(f, functionName);
+        uint32 nOfOutputSignals = 0u;
+        uint32 nOfInputSignals = 0u;
+        if (ret) {
+            ret = GetFunctionNumberOfSignals(OutputSignals, f, nOfOutputSignals);
+        }
+        if (ret) {
+            ret = GetFunctionNumberOfSignals(InputSignals, f, nOfInputSignals);
+        }
+        if ((ret) && (nOfOutputSignals > 0u)) {
+            numberOfWriters++;
+            ret = (numberOfWriters == 1u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "In SharedMemoryDataSource %s, only one GAM can write (%s is the second)", GetName(),
+                             functionName.Buffer());
+            }
+        }
+        if (nOfInputSignals > 0u) {
+            numberOfReaders++;
+        }
+        SignalDirection direction = (nOfOutputSignals > 0u) ? (OutputSignals) : (InputSignals);
+        uint32 nOfSignals = (nOfOutputSignals > 0u) ? (nOfOutputSignals) : (nOfInputSignals);
+        uint32 s;
+        for (s = 0u; (s < nOfSignals) && (ret); s++) {
+            uint32 samples = 0u;
+            ret = GetFunctionSignalSamples(direction, f, s, samples);
+            if (ret) {
+                ret = (samples <= 1u);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "In SharedMemoryDataSource %s, the signals of %s shall have Samples = 1", GetName(),
+                                 functionName.Buffer());
+                }
+            }
+        }
+    }
+    if (ret) {
+        ret = ((numberOfWriters == 0u) || (numberOfReaders == 0u));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In SharedMemoryDataSource %s, the signals shall be either written or read (the readers are other processes)",
+                         GetName());
+        }
+    }
+    writer = (numberOfWriters > 0u);
+    if ((ret) && (writer)) {
+        ret = (numberOfSegmentBuffers >= 2u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In SharedMemoryDataSource %s, NumberOfBuffers shall be >= 2", GetName());
+        }
+        uint32 nOfSignals = GetNumberOfSignals();
+        uint32 s;
+        for (s = 0u; (s < nOfSignals) && (ret); s++) {
+            StreamString signalName;
+            ret = GetSignalName(s, signalName);
+            if (ret) {
+                ret = (signalName.Size() < SHARED_MEMORY_DATASOURCE_NAME_SIZE);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "In SharedMemoryDataSource %s, the name of the signal %s shall be shorter than %u characters",
+                                 GetName(), signalName.Buffer(), SHARED_MEMORY_DATASOURCE_NAME_SIZE);
+                }
+            }
+            if (ret) {
+                const char8 * const typeName = TypeDescriptor::GetTypeNameFromTypeDescriptor(GetSignalType(s));
+                ret = (typeName != NULL_PTR(const char8 *));
+                if (ret) {
+                    ret = (StringHelper::Length(typeName) < SHARED_MEMORY_DATASOURCE_TYPE_SIZE);
+                }
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "In SharedMemoryDataSource %s, the type of the signal %s is not supported", GetName(),
+                                 signalName.Buffer());
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+bool SharedMemoryDataSource::AllocateMemory() {
+    bool ret;
+    if (writer) {
+        ret = ComputeMemoryLayout();
+        if (ret) {
+            stateMemorySize = SharedMemoryDataSourceAlign(stateMemorySize);
+            totalMemorySize = stateMemorySize * numberOfSegmentBuffers;
+            ret = CreateSegment();
+        }
+    }
+    else {
+        ret = MemoryDataSourceI::AllocateMemory();
+        if (ret) {
+            //The writer may not exist yet. Synchronise tries again.
+            (void) AttachSegment();
+        }
+    }
+    return ret;
+}
+
+bool SharedMemoryDataSource::CreateSegment() {
+    uint32 nOfSignals = GetNumberOfSignals();
+    uint32 sequencesOffset = SHARED_MEMORY_DATASOURCE_CACHE_LINE_SIZE;
+    uint32 descriptorsOffset = sequencesOffset + (numberOfSegmentBuffers * static_cast<uint32>(sizeof(SharedMemoryDataSourceSequence)));
+    uint32 dataOffset = SharedMemoryDataSourceAlign(descriptorsOffset + (nOfSignals * static_cast<uint32>(sizeof(SharedMemoryDataSourceSignal))));
+    uint32 size = dataOffset + totalMemorySize;
+
+    //A previous writer (e.g. a crashed one) may have left the segment. Its readers are told to look for the new one.
+    uint32 oldSize = 0u;
+    void *oldSegment = SharedMemory::Open(segmentName.Buffer(), false, oldSize);
+    if (oldSegment != NULL_PTR(void *)) {
+        if (oldSize >= static_cast<uint32>(sizeof(SharedMemoryDataSourceHeader))) {
+            SharedMemoryDataSourceHeader *oldHeader = reinterpret_cast<SharedMemoryDataSourceHeader *>(oldSegment);
+            if (Atomic::Load(&oldHeader->magic, Atomic::MemoryOrderAcquire) == SHARED_MEMORY_DATASOURCE_MAGIC) {
+                Atomic::Store(&oldHeader->state, SHARED_MEMORY_DATASOURCE_CLOSED, Atomic::MemoryOrderRelease);
+            }
+        }
+        (void) SharedMemory::Close(oldSegment, oldSize);
+    }
+    segment = reinterpret_cast<uint8 *>(SharedMemory::Create(segmentName.Buffer(), size, lockSegment, segmentSize));
+    bool ret = (segment != NULL_PTR(uint8 *));
+    if (!ret) {
+        REPORT_ERROR(ErrorManagement::FatalError, "In SharedMemoryDataSource %s, could not create the segment %s", GetName(), segmentName.Buffer());
+    }
+    if (ret) {
+        header = reinterpret_cast<SharedMemoryDataSourceHeader *>(segment);
+        header->version = SHARED_MEMORY_DATASOURCE_VERSION;
+        header->numberOfSignals = nOfSignals;
+        header->numberOfBuffers = numberOfSegmentBuffers;
+        header->bufferSize = stateMemorySize;
+        header->descriptorsOffset = descriptorsOffset;
+        header->sequencesOffset = sequencesOffset;
+        header->dataOffset = dataOffset;
+        header->state = SHARED_MEMORY_DATASOURCE_LIVE;
+        header->publishedSamples = 0;
+        SharedMemoryDataSourceSignal *descriptors = reinterpret_cast<SharedMemoryDataSourceSignal *>(&segment[descriptorsOffset]);
+        uint32 s;
+        for (s = 0u; (s < nOfSignals) && (ret); s++) {
+            StreamString signalName;
+            ret = GetSignalName(s, signalName);
+            if (ret) {
+                ret = StringHelper::CopyN(&descriptors[s].name[0], signalName.Buffer(), SHARED_MEMORY_DATASOURCE_NAME_SIZE - 1u);
+            }
+            if (ret) {
+                ret = StringHelper::CopyN(&descriptors[s].type[0], TypeDescriptor::GetTypeNameFromTypeDescriptor(GetSignalType(s)),
+                                          SHARED_MEMORY_DATASOURCE_TYPE_SIZE - 1u);
+            }
+            uint8 numberOfDimensions = 0u;
+            uint32 numberOfElements = 0u;
+            if (ret) {
+                ret = GetSignalNumberOfDimensions(s, numberOfDimensions);
+            }
+            if (ret) {
+                ret = GetSignalNumberOfElements(s, numberOfElements);
+            }
+            if (ret) {
+                descriptors[s].numberOfDimensions = numberOfDimensions;
+                descriptors[s].numberOfElements = numberOfElements;
+                /*lint -e{613} signalOffsets and signalSize cannot be NULL if there are signals*/
+                descriptors[s].offset = signalOffsets[s];
+                descriptors[s].byteSize = signalSize[s];
+            }
+        }
+    }
+    if (ret) {
+        memory = &segment[dataOffset];
+        writeBuffer = 0u;
+        //The first buffer is owned by the writer
+        Atomic::Store(&GetSequence(0u)->sequence, 1, Atomic::MemoryOrderRelaxed);
+        //The magic is written last, so that the readers only use a complete header
+        Atomic::Store(&header->magic, SHARED_MEMORY_DATASOURCE_MAGIC, Atomic::MemoryOrderRelease);
+    }
+    return ret;
+}
+
+bool SharedMemoryDataSource::AttachSegment() {
+    uint32 size = 0u;
+    void *address = SharedMemory::Open(segmentName.Buffer(), true, size);
+    bool ret = (address != NULL_PTR(void *));
+    bool valid = true;
+    if (ret) {
+        segment = reinterpret_cast<uint8 *>(address);
+        segmentSize = size;
+        ret = (size >= static_cast<uint32>(sizeof(SharedMemoryDataSourceHeader)));
+    }
+    if (ret) {
+        header = reinterpret_cast<SharedMemoryDataSourceHeader *>(segment);
+        //The segment is being created (or was closed) by the writer: not an error, try again later
+        ret = (Atomic::Load(&header->magic, Atomic::MemoryOrderAcquire) == SHARED_MEMORY_DATASOURCE_MAGIC);
+        if (ret) {
+            ret = (Atomic::Load(&header->state, Atomic::MemoryOrderAcquire) == SHARED_MEMORY_DATASOURCE_LIVE);
+        }
+    }
+    if (ret) {
+        ret = (header->version == SHARED_MEMORY_DATASOURCE_VERSION);
+        if (ret) {
+            ret = (header->numberOfBuffers > 0u);
+        }
+        if (ret) {
+            uint64 sequencesEnd = static_cast<uint64>(header->sequencesOffset)
+                    + (static_cast<uint64>(header->numberOfBuffers) * static_cast<uint64>(sizeof(SharedMemoryDataSourceSequence)));
+            uint64 descriptorsEnd = static_cast<uint64>(header->descriptorsOffset)
+                    + (static_cast<uint64>(header->numberOfSignals) * static_cast<uint64>(sizeof(SharedMemoryDataSourceSignal)));
+            uint64 dataEnd = static_cast<uint64>(header->dataOffset) + (static_cast<uint64>(header->numberOfBuffers) * static_cast<uint64>(header->bufferSize));
+            ret = ((sequencesEnd <= size) && (descriptorsEnd <= size) && (dataEnd <= size));
+        }
+        if ((!ret) && (!attachFailureReported)) {
+            REPORT_ERROR(ErrorManagement::FatalError, "In SharedMemoryDataSource %s, the segment %s is not a valid SharedMemoryDataSource segment", GetName(),
+                         segmentName.Buffer());
+        }
+        valid = ret;
+    }
+    uint32 nOfSignals = GetNumberOfSignals();
+    if ((ret) && (segmentOffsets == NULL_PTR(uint32 *)) && (nOfSignals > 0u)) {
+        segmentOffsets = new uint32[nOfSignals];
+    }
+    uint32 s;
+    for (s = 0u; (s < nOfSignals) && (ret); s++) {
+        StreamString signalName;
+        ret = GetSignalName(s, signalName);
+        const SharedMemoryDataSourceSignal *descriptors = reinterpret_cast<const SharedMemoryDataSourceSignal *>(&segment[header->descriptorsOffset]);
+        bool found = false;
+        uint32 d;
+        for (d = 0u; (d < header->numberOfSignals) && (ret) && (!found); d++) {
+            char8 name[SHARED_MEMORY_DATASOURCE_NAME_SIZE];
+            ret = StringHelper::CopyN(&name[0], &descriptors[d].name[0], SHARED_MEMORY_DATASOURCE_NAME_SIZE - 1u);
+            name[SHARED_MEMORY_DATASOURCE_NAME_SIZE - 1u] = '\0';
+            found = (signalName == &name[0]);
+            if (found) {
+                char8 type[SHARED_MEMORY_DATASOURCE_TYPE_SIZE];
+                ret = StringHelper::CopyN(&type[0], &descriptors[d].type[0], SHARED_MEMORY_DATASOURCE_TYPE_SIZE - 1u);
+                type[SHARED_MEMORY_DATASOURCE_TYPE_SIZE - 1u] = '\0';
+                const char8 * const typeName = TypeDescriptor::GetTypeNameFromTypeDescriptor(GetSignalType(s));
+                uint32 byteSize = 0u;
+                if (ret) {
+                    ret = GetSignalByteSize(s, byteSize);
+                }
+                if (ret) {
+                    ret = (typeName != NULL_PTR(const char8 *));
+                }
+                if (ret) {
+                    ret = ((StringHelper::Compare(typeName, &type[0]) == 0) && (byteSize == descriptors[d].byteSize));
+                }
+                if (ret) {
+                    ret = ((static_cast<uint64>(descriptors[d].offset) + static_cast<uint64>(byteSize)) <= static_cast<uint64>(header->bufferSize));
+                }
+                if ((!ret) && (!attachFailureReported)) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "In SharedMemoryDataSource %s, the signal %s has a different type or size in the segment %s",
+                                 GetName(), signalName.Buffer(), segmentName.Buffer());
+                }
+                if (ret) {
+                    /*lint -e{613} segmentOffsets cannot be NULL if there are signals*/
+                    segmentOffsets[s] = descriptors[d].offset;
+                }
+            }
+        }
+        if ((ret) && (!found)) {
+            ret = false;
+            if (!attachFailureReported) {
+                REPORT_ERROR(ErrorManagement::FatalError, "In SharedMemoryDataSource %s, the signal %s is not in the segment %s", GetName(), signalName.Buffer(),
+                             segmentName.Buffer());
+            }
+        }
+        valid = ret;
+    }
+    if (ret) {
+        numberOfSegmentBuffers = header->numberOfBuffers;
+        publishedSamples = 0;
+        attachFailureReported = false;
+        REPORT_ERROR(ErrorManagement::Information, "SharedMemoryDataSource %s attached to the segment %s", GetName(), segmentName.Buffer());
+    }
+    else {
+        if (!valid) {
+            attachFailureReported = true;
+        }
+        DetachSegment();
+    }
+    return ret;
+}
+
+void SharedMemoryDataSource::DetachSegment() {
+    if (segment != NULL_PTR(uint8 *)) {
+        void *address = segment;
+        (void) SharedMemory::Close(address, segmentSize);
+    }
+    segment = NULL_PTR(uint8 *);
+    segmentSize = 0u;
+    header = NULL_PTR(SharedMemoryDataSourceHeader *);
+}
+
+SharedMemoryDataSourceSequence *SharedMemoryDataSource::GetSequence(const uint32 bufferIdx) const {
+    /*lint -e{613} the segment is mapped*/
+    return reinterpret_cast<SharedMemoryDataSourceSequence *>(&segment[header->sequencesOffset + (bufferIdx * static_cast<uint32>(sizeof(SharedMemoryDataSourceSequence)))]);
+}
+
+uint32 SharedMemoryDataSource::GetNumberOfStatefulMemoryBuffers() {
+    return (writer) ? (numberOfSegmentBuffers) : (1u);
+}
+
+uint32 SharedMemoryDataSource::GetCurrentStateBuffer() {
+    return (writer) ? (writeBuffer) : (0u);
+}
+
+uint32 SharedMemoryDataSource::GetNumberOfMemoryBuffers() {
+    return 1u;
+}
+
+/*lint -e{715} the buffer is selected by GetCurrentStateBuffer*/
+bool SharedMemoryDataSource::GetOutputOffset(const uint32 signalIdx, const uint32 numberOfSamples, uint32 &offset) {
+    offset = 0u;
+    return true;
+}
+
+/*lint -e{715} the broker does not depend on the signal configuration*/
+const char8 *SharedMemoryDataSource::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    const char8 *brokerName;
+    if (direction == OutputSignals) {
+        brokerName = "MemoryMapSynchronisedMultiBufferOutputBroker";
+    }
+    else {
+        brokerName = "MemoryMapSynchronisedInputBroker";
+    }
+    return brokerName;
+}
+
+/*lint -e{715} the segment does not depend on the state*/
+bool SharedMemoryDataSource::PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName) {
+    return true;
+}
+
+bool SharedMemoryDataSource::Synchronise() {
+    if (writer) {
+        if (header != NULL_PTR(SharedMemoryDataSourceHeader *)) {
+            //Publish the buffer written by the broker
+            SharedMemoryDataSourceSequence *sequence = GetSequence(writeBuffer);
+            int32 current = Atomic::Load(&sequence->sequence, Atomic::MemoryOrderRelaxed);
+            Atomic::Store(&sequence->sequence, current + 1, Atomic::MemoryOrderRelease);
+            publishedSamples++;
+            Atomic::Store(&header->publishedSamples, publishedSamples, Atomic::MemoryOrderRelease);
+            //Take the ownership of the next buffer of the ring
+            writeBuffer = ((writeBuffer + 1u) % numberOfSegmentBuffers);
+            sequence = GetSequence(writeBuffer);
+            current = Atomic::Load(&sequence->sequence, Atomic::MemoryOrderRelaxed);
+            Atomic::Store(&sequence->sequence, current + 1, Atomic::MemoryOrderRelaxed);
+            //The readers shall see the odd sequence before any change to the buffer
+            Atomic::ThreadFence(Atomic::MemoryOrderRelease);
+        }
+    }
+    else {
+        if (header != NULL_PTR(SharedMemoryDataSourceHeader *)) {
+            if (Atomic::Load(&header->state, Atomic::MemoryOrderAcquire) != SHARED_MEMORY_DATASOURCE_LIVE) {
+                //The writer was destroyed or replaced
+                DetachSegment();
+            }
+        }
+        if (header == NULL_PTR(SharedMemoryDataSourceHeader *)) {
+            (void) AttachSegment();
+        }
+        if (header != NULL_PTR(SharedMemoryDataSourceHeader *)) {
+            int64 latest = Atomic::Load(&header->publishedSamples, Atomic::MemoryOrderAcquire);
+            if (latest == publishedSamples) {
+                (void) Atomic::FetchAdd(&staleReads, 1, Atomic::MemoryOrderRelaxed);
+            }
+            bool consistent = (latest == publishedSamples);
+            uint32 nOfSignals = GetNumberOfSignals();
+            const uint8 *data = &segment[header->dataOffset];
+            uint32 retries;
+            for (retries = 0u; (!consistent) && (retries < SHARED_MEMORY_DATASOURCE_MAX_READ_RETRIES); retries++) {
+                uint32 bufferIdx = static_cast<uint32>(static_cast<uint64>(latest - 1) % static_cast<uint64>(numberOfSegmentBuffers));
+                SharedMemoryDataSourceSequence *sequence = GetSequence(bufferIdx);
+                int32 before = Atomic::Load(&sequence->sequence, Atomic::MemoryOrderAcquire);
+                if ((before & 1) == 0) {
+                    const uint8 *buffer = &data[bufferIdx * header->bufferSize];
+                    uint32 s;
+                    for (s = 0u; s < nOfSignals; s++) {
+                        /*lint -e{613} signalOffsets, signalSize and segmentOffsets cannot be NULL if there are signals*/
+                        (void) MemoryOperationsHelper::Copy(&memory[signalOffsets[s]], &buffer[segmentOffsets[s]], signalSize[s]);
+                    }
+                    //The copy shall be completed before checking if the sequence has changed
+                    Atomic::ThreadFence(Atomic::MemoryOrderAcquire);
+                    consistent = (Atomic::Load(&sequence->sequence, Atomic::MemoryOrderRelaxed) == before);
+                }
+                else {
+                    //The writer is writing the buffer
+                    Atomic::WaitWhileEqual(&sequence->sequence, before);
+                }
+                if (consistent) {
+                    publishedSamples = latest;
+                }
+                else {
+                    (void) Atomic::FetchAdd(&overruns, 1, Atomic::MemoryOrderRelaxed);
+                    latest = Atomic::Load(&header->publishedSamples, Atomic::MemoryOrderAcquire);
+                }
+            }
+        }
+    }
+    //A reader without segment keeps the last values
+    return true;
+}
+
+bool SharedMemoryDataSource::IsAttached() const {
+    return (segment != NULL_PTR(uint8 *));
+}
+
+uint64 SharedMemoryDataSource::GetNumberOfPublishedSamples() const {
+    return static_cast<uint64>(publishedSamples);
+}
+
+uint64 SharedMemoryDataSource::GetStaleReads() const {
+    return static_cast<uint64>(Atomic::Load(&staleReads, Atomic::MemoryOrderRelaxed));
+}
+
+uint64 SharedMemoryDataSource::GetOverruns() const {
+    return static_cast<uint64>(Atomic::Load(&overruns, Atomic::MemoryOrderRelaxed));
+}
+
+bool SharedMemoryDataSource::ExportData(StructuredDataI & data) {
+    bool ret = MemoryDataSourceI::ExportData(data);
+    if (ret) {
+        ret = data.Write("SegmentName", segmentName.Buffer());
+    }
+    if (ret) {
+        ret = data.Write("NumberOfPublishedSamples", GetNumberOfPublishedSamples());
+    }
+    if (ret) {
+        ret = data.Write("StaleReads", GetStaleReads());
+    }
+    if (ret) {
+        ret = data.Write("Overruns", GetOverruns());
+    }
+    return ret;
+}
+
+CLASS_REGISTER(SharedMemoryDataSource, "1.0")
+
+}
@@ -0,0 +1,441 @@
+/**
+ * @file SharedMemoryDataSource.h
+ * @brief Header file for class SharedMemoryDataSource
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemoryDataSource
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SHAREDMEMORYDATASOURCE_H_
+#define SHAREDMEMORYDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MemoryDataSourceI.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Value of SharedMemoryDataSourceHeader::magic once the segment is ready to be read.
+ */
+const int32 SHARED_MEMORY_DATASOURCE_MAGIC = 0x4D32534D;
+
+/**
+ * Value of SharedMemoryDataSourceHeader::version for the layout described in SharedMemoryDataSource.
+ */
+const uint32 SHARED_MEMORY_DATASOURCE_VERSION = 1u;
+
+/**
+ * Value of SharedMemoryDataSourceHeader::state while the writer is running.
+ */
+const int32 SHARED_MEMORY_DATASOURCE_LIVE = 1;
+
+/**
+ * Value of SharedMemoryDataSourceHeader::state after the writer was destroyed (or replaced by a new segment).
+ */
+const int32 SHARED_MEMORY_DATASOURCE_CLOSED = 2;
+
+/**
+ * @brief The header at the beginning of a SharedMemoryDataSource segment (one cache line).
+ * @details All the offsets are in bytes with respect to the beginning of the segment.
+ */
+struct SharedMemoryDataSourceHeader {
+    /**
+     * SHARED_MEMORY_DATASOURCE_MAGIC. Written last by the writer, so that the rest of the header and the signal
+     * descriptors are valid once the magic is seen.
+     */
+    volatile int32 magic;
+
+    /**
+     * SHARED_MEMORY_DATASOURCE_LIVE or SHARED_MEMORY_DATASOURCE_CLOSED.
+     */
+    volatile int32 state;
+
+    /**
+     * SHARED_MEMORY_DATASOURCE_VERSION.
+     */
+    uint32 version;
+
+    /**
+     * The number of SharedMemoryDataSourceSignal descriptors.
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * The number of buffers (each one with a copy of all the signals).
+     */
+    uint32 numberOfBuffers;
+
+    /**
+     * The distance in bytes between two buffers.
+     */
+    uint32 bufferSize;
+
+    /**
+     * The offset of the first SharedMemoryDataSourceSignal descriptor.
+     */
+    uint32 descriptorsOffset;
+
+    /**
+     * The offset of the first SharedMemoryDataSourceSequence.
+     */
+    uint32 sequencesOffset;
+
+    /**
+     * The offset of the first buffer.
+     */
+    uint32 dataOffset;
+
+    /**
+     * Reserved.
+     */
+    uint32 reserved;
+
+    /**
+     * The number of buffers published so far. The last published buffer is (publishedSamples - 1) % numberOfBuffers.
+     */
+    volatile int64 publishedSamples;
+
+    /**
+     * Pads the header to a cache line.
+     */
+    uint32 padding[4];
+};
+
+/**
+ * @brief The sequence lock of a buffer (one cache line).
+ */
+struct SharedMemoryDataSourceSequence {
+    /**
+     * Odd while the buffer is being written.
+     */
+    volatile int32 sequence;
+
+    /**
+     * Pads the sequence to a cache line.
+     */
+    uint32 padding[15];
+};
+
+/**
+ * @brief The description of a signal in a SharedMemoryDataSource segment.
+ */
+struct SharedMemoryDataSourceSignal {
+    /**
+     * The name of the signal (zero terminated).
+     */
+    char8 name[64];
+
+    /**
+     * The type of the signal as in TypeDescriptor::GetTypeNameFromTypeDescriptor (zero terminated).
+     */
+    char8 type[32];
+
+    /**
+     * The number of dimensions of the signal.
+     */
+    uint32 numberOfDimensions;
+
+    /**
+     * The number of elements of the signal.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * The offset of the signal with respect to the beginning of each buffer.
+     */
+    uint32 offset;
+
+    /**
+     * The size of the signal in bytes.
+     */
+    uint32 byteSize;
+};
+
+/**
+ * @brief A MemoryDataSourceI whose signals are published in a named shared memory segment (see SharedMemory), so that other
+ * processes (other MARTe applications or external tools) can read them without any copy or system call.
+ * @details A SharedMemoryDataSource is either the writer of the segment (it has output signals, written by one GAM) or
+ * a reader of a segment written by another process (it only has input signals).
+ *
+ * The writer creates the segment in AllocateMemory. The segment starts with a SharedMemoryDataSourceHeader, followed by
+ * NumberOfBuffers SharedMemoryDataSourceSequence and by one SharedMemoryDataSourceSignal descriptor for each signal
+ * (name, type, dimensions, elements, offset and size), so that the segment is self-describing. The address of the signal
+ * s in the buffer b is: segment + dataOffset + (b * bufferSize) + descriptor[s].offset.
+ *
+ * The buffers are the stateful memory buffers of the MemoryDataSourceI, so that the MemoryMapSynchronisedMultiBufferOutputBroker
+ * of the writing GAM copies the signals directly into the buffer owned by the writer (whose sequence is odd). Synchronise
+ * then publishes that buffer (even sequence, publishedSamples incremented) and moves to the next buffer of the ring. A reader:
+ * - reads publishedSamples (if 0 there is nothing to read yet) and the sequence of the last published buffer;
+ * - retries if the sequence is odd, otherwise copies the signals that it needs;
+ * - reads the sequence again and retries if it changed (the writer reused the buffer in the meanwhile).
+ *
+ * The readers never write into the segment (i.e. it can be mapped read-only) and never block the writer. With more
+ * buffers a slow reader is less likely to have to retry.
+ *
+ * A reader SharedMemoryDataSource maps the segment as soon as it exists (i.e. the writer may start later or be restarted)
+ * and looks for each of its signals by name in the descriptors (the type and the number of elements shall be the same as
+ * in the writer, but the reader may declare only some of the signals, in any order). Its input broker
+ * (MemoryMapSynchronisedInputBroker) calls Synchronise, which copies the last published buffer (with the protocol above)
+ * to the memory of the DataSource. While the segment does not exist (or after the writer was destroyed) the signals keep
+ * their last value and each Synchronise tries again to map the segment.
+ *
+ * The following counters are kept (and exported in ExportData):
+ * - NumberOfPublishedSamples: the number of buffers published (writer) or the publishedSamples of the last read (reader);
+ * - StaleReads (reader): the number of Synchronise where no new buffer was published since the previous one;
+ * - Overruns (reader): the number of times that a copy had to be retried because the buffer was rewritten while being read.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Plant = {
+ *     Class = SharedMemoryDataSource
+ *     SegmentName = "/marte_plant" //Compulsory. See SharedMemory (e.g. "/dev/hugepages/marte_plant" for a segment in a hugetlbfs mount).
+ *     NumberOfBuffers = 3 //Compulsory for the writer (>= 2). Ignored by the readers (the number of buffers is read from the segment).
+ *     LockMemory = 1 //Optional. Default = 0. If 1 the writer locks the segment in memory.
+ *     Signals = {
+ *         Current = {
+ *             Type = float32
+ *         }
+ *         Profile = {
+ *             Type = float32
+ *             NumberOfElements = 16
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * The writing GAM shall write all the signals (the buffers of the ring are not copied into each other), with Samples = 1.
+ * The input signals shall have Samples = 1.
+ */
+class DLL_API SharedMemoryDataSource: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    SharedMemoryDataSource();
+
+    /**
+     * @brief Destructor. Marks the segment as closed and removes it (writer) or unmaps it (reader).
+     */
+    virtual ~SharedMemoryDataSource();
+
+    /**
+     * @brief see MemoryDataSourceI::Initialise.
+     * @details Also reads the SegmentName and LockMemory parameters.
+     * @param[in] data see MemoryDataSourceI::Initialise.
+     * @return true if MemoryDataSourceI::Initialise returns true and the SegmentName is set.
+     */
+    virtual bool Initialise(StructuredDataI & data);
+
+    /**
+     * @brief see DataSourceI::SetConfiguredDatabase.
+     * @details Checks that the signals are either written by one GAM or only read, with Samples = 1. The writer
+     * also checks that NumberOfBuffers >= 2 and that the signal names fit in the descriptors.
+     * @param[in] data see DataSourceI::SetConfiguredDatabase.
+     * @return true if all the conditions above are met.
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI & data);
+
+    /**
+     * @brief Creates and initialises the segment (writer) or allocates the local memory and tries to map the segment (reader).
+     * @return true if the memory can be allocated and, for the writer, the segment created.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief Gets the number of stateful memory buffers.
+     * @return NumberOfBuffers for the writer and 1 for a reader.
+     */
+    virtual uint32 GetNumberOfStatefulMemoryBuffers();
+
+    /**
+     * @brief Gets the buffer owned by the writer.
+     * @return the buffer where the next sample is written (0 for a reader).
+     */
+    virtual uint32 GetCurrentStateBuffer();
+
+    /**
+     * @brief Gets the number of memory buffers.
+     * @return 1.
+     */
+    virtual uint32 GetNumberOfMemoryBuffers();
+
+    /**
+     * @brief see DataSourceI::GetOutputOffset.
+     * @return true with offset = 0 (the buffer is selected by GetCurrentStateBuffer).
+     */
+    virtual bool GetOutputOffset(const uint32 signalIdx, const uint32 numberOfSamples, uint32 &offset);
+
+    /**
+     * @brief see DataSourceI::GetBrokerName.
+     * @return MemoryMapSynchronisedMultiBufferOutputBroker for the output signals and MemoryMapSynchronisedInputBroker for the input signals.
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+
+    /**
+     * @brief NOOP.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName);
+
+    /**
+     * @brief Publishes the buffer written in this cycle (writer) or copies the last published buffer from the segment (reader).
+     * @return true (a reader without segment keeps the last values).
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Checks if the segment is mapped.
+     * @return true if the segment is mapped (always true for the writer after AllocateMemory).
+     */
+    bool IsAttached() const;
+
+    /**
+     * @brief Gets the number of published buffers.
+     * @return the number of buffers published (writer) or the number of published buffers at the last read (reader).
+     */
+    uint64 GetNumberOfPublishedSamples() const;
+
+    /**
+     * @brief Gets the StaleReads counter.
+     * @return the number of reads where no new buffer was published since the previous read.
+     */
+    uint64 GetStaleReads() const;
+
+    /**
+     * @brief Gets the Overruns counter.
+     * @return the number of copies retried because the buffer was rewritten while being read.
+     */
+    uint64 GetOverruns() const;
+
+    /**
+     * @brief see DataSourceI::ExportData.
+     * @details Also exports the SegmentName, NumberOfPublishedSamples, StaleReads and Overruns.
+     * @param[out] data see DataSourceI::ExportData.
+     * @return true if the data is successfully exported.
+     */
+    virtual bool ExportData(StructuredDataI & data);
+
+private:
+
+    /**
+     * @brief Creates the segment and writes the header and the descriptors.
+     */
+    bool CreateSegment();
+
+    /**
+     * @brief Maps the segment and finds the signals of the reader in the descriptors.
+     * @return true if the segment exists, is valid and has all the signals of the reader.
+     */
+    bool AttachSegment();
+
+    /**
+     * @brief Unmaps the segment.
+     */
+    void DetachSegment();
+
+    /**
+     * @brief Gets the sequence lock of a buffer.
+     */
+    SharedMemoryDataSourceSequence *GetSequence(const uint32 bufferIdx) const;
+
+    /**
+     * The name of the segment.
+     */
+    StreamString segmentName;
+
+    /**
+     * True if the signals are written by this DataSource.
+     */
+    bool writer;
+
+    /**
+     * True if the writer shall lock the segment in memory.
+     */
+    bool lockSegment;
+
+    /**
+     * The number of buffers in the segment.
+     */
+    uint32 numberOfSegmentBuffers;
+
+    /**
+     * The mapped segment (NULL if not mapped).
+     */
+    uint8 *segment;
+
+    /**
+     * The mapped size of the segment.
+     */
+    uint32 segmentSize;
+
+    /**
+     * The header of the segment.
+     */
+    SharedMemoryDataSourceHeader *header;
+
+    /**
+     * The buffer owned by the writer.
+     */
+    uint32 writeBuffer;
+
+    /**
+     * Reader: the offset of each signal in a buffer of the segment.
+     */
+    uint32 *segmentOffsets;
+
+    /**
+     * Reader: set once the failure to attach to an invalid segment was reported, so that it is not reported every cycle.
+     */
+    bool attachFailureReported;
+
+    /**
+     * The number of buffers published (writer) or read (reader).
+     */
+    int64 publishedSamples;
+
+    /**
+     * StaleReads counter.
+     */
+    volatile int64 staleReads;
+
+    /**
+     * Overruns counter.
+     */
+    volatile int64 overruns;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SHAREDMEMORYDATASOURCE_H_ */
@@ -0,0 +1,201 @@
+/**
+ * @file SnapshotDataSource.cpp
+ * @brief Source file for class SnapshotDataSource
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SnapshotDataSource (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "MemoryOperationsHelper.h"
+#include "SnapshotDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Maximum number of times that GetSnapshot tries to take a consistent copy of the snapshot.
+ */
+static const uint32 SNAPSHOT_MAX_READ_RETRIES = 1000u;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+SnapshotDataSource::SnapshotDataSource() :
+        MemoryDataSourceI() {
+    snapshot = NULL_PTR(uint8 *);
+    sequence = 0;
+    snapshotCycle = 0u;
+    cycle = 0u;
+    decimation = 1u;
+}
+
+SnapshotDataSource::~SnapshotDataSource() {
+    if (snapshot != NULL_PTR(uint8 *)) {
+        delete[] snapshot;
+    }
+}
+
+bool SnapshotDataSource::Initialise(StructuredDataI & data) {
+    bool ret = MemoryDataSourceI::Initialise(data);
+    if (ret) {
+        if (!data.Read("Decimation", decimation)) {
+            decimation = 1u;
+        }
+        ret = (decimation > 0u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In SnapshotDataSource %s, Decimation shall be > 0", GetName());
+        }
+    }
+    return ret;
+}
+
+bool SnapshotDataSource::AllocateMemory() {
+    bool ret = MemoryDataSourceI::AllocateMemory();
+    if ((ret) && (stateMemorySize > 0u)) {
+        snapshot = new uint8[stateMemorySize];
+        ret = MemoryOperationsHelper::Set(snapshot, '\0', stateMemorySize);
+    }
+    return ret;
+}
+
+/*lint -e{715} the broker does not depend on the signal configuration*/
+const char8 *SnapshotDataSource::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == OutputSignals) {
+        brokerName = "MemoryMapSynchronisedOutputBroker";
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "In SnapshotDataSource %s, the signals cannot be read by GAMs", GetName());
+    }
+    return brokerName;
+}
+
+/*lint -e{715} the snapshot does not depend on the state*/
+bool SnapshotDataSource::PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName) {
+    return true;
+}
+
+bool SnapshotDataSource::Synchronise() {
+    bool ret = true;
+    cycle++;
+    if ((snapshot != NULL_PTR(uint8 *)) && ((cycle % decimation) == 0u)) {
+        int32 current = Atomic::Load(&sequence, Atomic::MemoryOrderRelaxed);
+        Atomic::Store(&sequence, current + 1, Atomic::MemoryOrderRelaxed);
+        //The readers shall see the odd sequence before any change to the snapshot
+        Atomic::ThreadFence(Atomic::MemoryOrderRelease);
+        ret = MemoryOperationsHelper::Copy(snapshot, memory, stateMemorySize);
+        snapshotCycle = cycle;
+        Atomic::Store(&sequence, current + 2, Atomic::MemoryOrderRelease);
+    }
+    return ret;
+}
+
+bool SnapshotDataSource::GetSnapshot(void * const buffer, const uint32 size, uint64 &cycleOut) {
+    bool ret = (snapshot != NULL_PTR(uint8 *));
+    if (ret) {
+        ret = ((buffer != NULL_PTR(void *)) && (size >= stateMemorySize));
+    }
+    bool consistent = false;
+    uint64 readCycle = 0u;
+    uint32 retries;
+    for (retries = 0u; (ret) && (!consistent) && (retries < SNAPSHOT_MAX_READ_RETRIES); retries++) {
+        int32 before = Atomic::Load(&sequence, Atomic::MemoryOrderAcquire);
+        if ((before & 1) == 0) {
+            ret = MemoryOperationsHelper::Copy(buffer, snapshot, stateMemorySize);
+            readCycle = snapshotCycle;
+            //The copy shall be completed before checking if the sequence has changed
+            Atomic::ThreadFence(Atomic::MemoryOrderAcquire);
+            consistent = (Atomic::Load(&sequence, Atomic::MemoryOrderRelaxed) == before);
+        }
+        else {
+            //The real-time thread is writing the snapshot
+            Atomic::WaitWhileEqual(&sequence, before);
+        }
+    }
+    if (ret) {
+        ret = ((consistent) && (readCycle > 0u));
+    }
+    if (ret) {
+        cycleOut = readCycle;
+    }
+    return ret;
+}
+
+bool SnapshotDataSource::ExportData(StructuredDataI & data) {
+    bool ret = MemoryDataSourceI::ExportData(data);
+    if ((ret) && (snapshot != NULL_PTR(uint8 *))) {
+        uint8 *values = new uint8[stateMemorySize];
+        uint64 valuesCycle = 0u;
+        if (GetSnapshot(values, stateMemorySize, valuesCycle)) {
+            ret = data.Write("Cycle", valuesCycle);
+            if (ret) {
+                ret = data.CreateRelative("Signals");
+            }
+            uint32 nOfSignals = GetNumberOfSignals();
+            uint32 n;
+            for (n = 0u; (n < nOfSignals) && (ret); n++) {
+                StreamString signalName;
+                uint8 numberOfDimensions = 0u;
+                uint32 numberOfElements = 0u;
+                ret = GetSignalName(n, signalName);
+                if (ret) {
+                    ret = GetSignalNumberOfDimensions(n, numberOfDimensions);
+                }
+                if (ret) {
+                    ret = GetSignalNumberOfElements(n, numberOfElements);
+                }
+                if (ret) {
+                    /*lint -e{613} signalOffsets cannot be NULL if there are signals*/
+                    AnyType value(GetSignalType(n), 0u, &values[signalOffsets[n]]);
+                    //Matrices are exported as vectors with all the elements
+                    if (numberOfDimensions > 0u) {
+                        value.SetNumberOfDimensions(1u);
+                        value.SetNumberOfElements(0u, numberOfElements);
+                    }
+                    ret = data.Write(signalName.Buffer(), value);
+                }
+            }
+            if (ret) {
+                ret = data.MoveToAncestor(1u);
+            }
+        }
+        delete[] values;
+    }
+    return ret;
+}
+
+CLASS_REGISTER(SnapshotDataSource, "1.0")
+
+}
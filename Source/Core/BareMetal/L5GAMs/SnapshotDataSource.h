@@ -0,0 +1,173 @@
+/**
+ * @file SnapshotDataSource.h
+ * @brief Header file for class SnapshotDataSource
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SnapshotDataSource
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SNAPSHOTDATASOURCE_H_
+#define SNAPSHOTDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MemoryDataSourceI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Output only MemoryDataSourceI that publishes the latest value of its signals for non real-time readers.
+ * @details The signals are written by the GAMs using a MemoryMapSynchronisedOutputBroker. Every Decimation calls
+ * to Synchronise the signal memory is copied to a snapshot buffer protected by a sequence lock, i.e. the real-time
+ * thread never waits for (nor is delayed by) the readers. The readers (e.g. an HttpSignalStream or the
+ * HttpObjectBrowser, through ExportData) copy the snapshot and retry if it was updated while being copied.
+ *
+ * Each snapshot is tagged with the number of Synchronise calls (Cycle) at the time it was published, so that a reader
+ * can detect whether the snapshot has changed since its last read.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Live = {
+ *     Class = SnapshotDataSource
+ *     Decimation = 10 //Optional. Publish one snapshot every Decimation cycles. Default = 1.
+ *     Signals = {
+ *         Current = {
+ *             Type = float32
+ *         }
+ *         Profile = {
+ *             Type = float32
+ *             NumberOfElements = 16
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * ExportData writes, after the MemoryDataSourceI information, the Cycle of the last published snapshot and a node
+ * named Signals with the value of every signal (nothing is written before the first snapshot is published).
+ */
+class DLL_API SnapshotDataSource: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    SnapshotDataSource();
+
+    /**
+     * @brief Destructor. Frees the snapshot buffer.
+     */
+    virtual ~SnapshotDataSource();
+
+    /**
+     * @brief see MemoryDataSourceI::Initialise.
+     * @details Also reads the optional Decimation parameter.
+     * @param[in] data see MemoryDataSourceI::Initialise.
+     * @return true if MemoryDataSourceI::Initialise returns true and Decimation > 0.
+     */
+    virtual bool Initialise(StructuredDataI & data);
+
+    /**
+     * @brief see MemoryDataSourceI::AllocateMemory.
+     * @details Also allocates the snapshot buffer.
+     * @return true if MemoryDataSourceI::AllocateMemory returns true.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief see DataSourceI::GetBrokerName.
+     * @return MemoryMapSynchronisedOutputBroker for OutputSignals and NULL otherwise (the signals cannot be read by GAMs).
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+
+    /**
+     * @brief NOOP.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName);
+
+    /**
+     * @brief Publishes a new snapshot every Decimation calls.
+     * @details Never blocks: the readers detect that the snapshot was updated while they were copying it and retry.
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Copies the last published snapshot.
+     * @param[out] buffer where to copy the snapshot. The signal i is at the offset of GetSignalMemoryBuffer(i, 0) with
+     * respect to GetSignalMemoryBuffer(0, 0).
+     * @param[in] size the size of \a buffer, which shall be at least the memory size of one state buffer.
+     * @param[out] cycle the number of Synchronise calls when the snapshot was published.
+     * @return true if a snapshot was published and a consistent copy could be taken.
+     */
+    bool GetSnapshot(void * const buffer, const uint32 size, uint64 &cycle);
+
+    /**
+     * @brief see MemoryDataSourceI::ExportData.
+     * @details Also exports the Cycle and the value of all the Signals of the last published snapshot (see class
+     * description).
+     * @param[out] data see MemoryDataSourceI::ExportData.
+     * @return true if the data is successfully exported.
+     */
+    virtual bool ExportData(StructuredDataI & data);
+
+private:
+
+    /**
+     * The copy of the signal memory read by the non real-time threads.
+     */
+    uint8 *snapshot;
+
+    /**
+     * Sequence lock of the snapshot. Odd while the snapshot is being written.
+     */
+    volatile int32 sequence;
+
+    /**
+     * The Cycle of the snapshot. Written under the sequence lock.
+     */
+    uint64 snapshotCycle;
+
+    /**
+     * Number of Synchronise calls.
+     */
+    uint64 cycle;
+
+    /**
+     * Publish one snapshot every decimation cycles.
+     */
+    uint32 decimation;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SNAPSHOTDATASOURCE_H_ */
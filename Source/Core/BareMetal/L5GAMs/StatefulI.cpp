@@ -0,0 +1,69 @@
+/**
+ * @file StatefulI.cpp
+ * @brief Source file for class StatefulI
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class StatefulI (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "StatefulI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+namespace {
+#ifdef THREAD_LOCAL
+/**
+ * The arena of the RealTimeApplication which is calling PrepareNextState from this thread.
+ */
+static THREAD_LOCAL HeapI *statefulStateArena = NULL_PTR(HeapI *);
+#else
+/**
+ * The arena of the RealTimeApplication which is calling PrepareNextState.
+ */
+static HeapI *statefulStateArena = NULL_PTR(HeapI *);
+#endif
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+HeapI *StatefulI::GetStateArena() {
+    return statefulStateArena;
+}
+
+void StatefulI::SetStateArena(HeapI * const arena) {
+    statefulStateArena = arena;
+}
+
+}
@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "HeapI.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -60,6 +61,22 @@ public:
     virtual bool PrepareNextState(const char8 * const currentStateName,
                                   const char8 * const nextStateName)=0;
 
+    /**
+     * @brief Gets the per-state arena of the RealTimeApplication which is calling PrepareNextState (see RealTimeApplication::GetStateArena).
+     * @details The memory allocated from the arena (e.g. HeapManager::Malloc(size, GetStateArena()->Name()) or
+     * GetStateArena()->Malloc(size)) does not have to be freed and is valid while the next state is executed, i.e. until the
+     * second following state change.
+     * @return the arena or NULL if not called from PrepareNextState or if the application has no StateArenaSize.
+     */
+    static HeapI *GetStateArena();
+
+    /**
+     * @brief Sets the arena returned by GetStateArena in the calling thread (called by the RealTimeApplication around the
+     * PrepareNextState calls).
+     * @param[in] arena the arena (NULL to unset it).
+     */
+    static void SetStateArena(HeapI * const arena);
+
 };
 
 }
@@ -0,0 +1,150 @@
+/**
+ * @file ThreadChannelBroker.cpp
+ * @brief Source file for class ThreadChannelBroker
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ThreadChannelBroker (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MemoryOperationsHelper.h"
+#include "ThreadChannelBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ThreadChannelBroker::ThreadChannelBroker() :
+        BrokerI() {
+    channel = NULL_PTR(ThreadChannelDataSource *);
+    signalDirection = InputSignals;
+    slotOffsets = NULL_PTR(uint32 *);
+    samples = NULL_PTR(uint32 *);
+    sampleSizes = NULL_PTR(uint32 *);
+    lastPublishedSamples = 0u;
+}
+
+ThreadChannelBroker::~ThreadChannelBroker() {
+    if (slotOffsets != NULL_PTR(uint32 *)) {
+        delete[] slotOffsets;
+    }
+    if (samples != NULL_PTR(uint32 *)) {
+        delete[] samples;
+    }
+    if (sampleSizes != NULL_PTR(uint32 *)) {
+        delete[] sampleSizes;
+    }
+    channel = NULL_PTR(ThreadChannelDataSource *);
+}
+
+bool ThreadChannelBroker::Init(const SignalDirection direction,
+                               DataSourceI &dataSourceIn,
+                               const char8 *const functionName,
+                               void *const gamMemoryAddress) {
+    signalDirection = direction;
+    channel = dynamic_cast<ThreadChannelDataSource *>(&dataSourceIn);
+    bool ret = (channel != NULL_PTR(ThreadChannelDataSource *));
+    if (!ret) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "ThreadChannelBroker can only be used with a ThreadChannelDataSource");
+    }
+    if (ret) {
+        ret = InitFunctionPointers(direction, dataSourceIn, functionName, gamMemoryAddress);
+    }
+    uint32 numberOfCopies = GetNumberOfCopies();
+    if ((ret) && (numberOfCopies > 0u)) {
+        slotOffsets = new uint32[numberOfCopies];
+        samples = new uint32[numberOfCopies];
+        sampleSizes = new uint32[numberOfCopies];
+    }
+    uint32 c;
+    for (c = 0u; (c < numberOfCopies) && (ret); c++) {
+        uint32 signalIdx = GetDSCopySignalIndex(c);
+        uint32 byteSize = 0u;
+        ret = dataSourceIn.GetSignalByteSize(signalIdx, byteSize);
+        if (ret) {
+            ret = (byteSize > 0u);
+        }
+        if (ret) {
+            uint32 copySize = GetCopyByteSize(c);
+            /*lint -e{613} the arrays are allocated if there are copies*/
+            slotOffsets[c] = channel->GetSignalOffset(signalIdx) + GetCopyOffset(c);
+            //Ranges are only allowed with one sample (checked by the ThreadChannelDataSource), so that a copy larger than the signal has several samples
+            samples[c] = copySize / byteSize;
+            if (samples[c] == 0u) {
+                samples[c] = 1u;
+            }
+            sampleSizes[c] = copySize / samples[c];
+        }
+    }
+    return ret;
+}
+
+/*lint -e{613} a valid Init is a pre-condition for the Execute method*/
+bool ThreadChannelBroker::Execute() {
+    bool ret = true;
+    uint32 numberOfCopies = GetNumberOfCopies();
+    uint32 c;
+    if (signalDirection == OutputSignals) {
+        uint8 *slot = channel->BeginWrite();
+        for (c = 0u; (c < numberOfCopies) && (ret); c++) {
+            ret = MemoryOperationsHelper::Copy(&slot[slotOffsets[c]], GetFunctionPointer(c), sampleSizes[c]);
+        }
+        channel->EndWrite();
+    }
+    else {
+        uint64 published = channel->GetNumberOfPublishedSamples();
+        if (published == lastPublishedSamples) {
+            channel->AddStaleRead();
+        }
+        lastPublishedSamples = published;
+        for (c = 0u; (c < numberOfCopies) && (ret) && (published > 0u); c++) {
+            uint8 *destination = static_cast<uint8 *>(GetFunctionPointer(c));
+            uint32 h;
+            for (h = 0u; (h < samples[c]) && (ret); h++) {
+                //The oldest sample first. The first published sample is repeated if not enough samples were published yet
+                uint64 sample = 0u;
+                uint64 back = static_cast<uint64>(samples[c] - h);
+                if (published >= back) {
+                    sample = published - back;
+                }
+                ret = channel->Read(sample, slotOffsets[c], &destination[h * sampleSizes[c]], sampleSizes[c]);
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::Warning, "In ThreadChannelBroker %s, could not read a consistent copy of the signals", GetName());
+            }
+        }
+    }
+    return ret;
+}
+
+CLASS_REGISTER(ThreadChannelBroker, "1.0")
+
+}
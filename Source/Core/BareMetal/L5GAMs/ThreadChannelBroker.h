@@ -0,0 +1,121 @@
+/**
+ * @file ThreadChannelBroker.h
+ * @brief Header file for class ThreadChannelBroker
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ThreadChannelBroker
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef THREADCHANNELBROKER_H_
+#define THREADCHANNELBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BrokerI.h"
+#include "ThreadChannelDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief BrokerI of the ThreadChannelDataSource.
+ * @details The output broker copies the GAM signals directly into the next slot of the ThreadChannelDataSource and
+ * publishes it. The input broker copies the most recently published samples (as many as the Samples of each signal,
+ * the oldest first) directly from the slots into the GAM memory. Before the first sample is published the GAM memory
+ * is not changed. See ThreadChannelDataSource.
+ */
+class DLL_API ThreadChannelBroker: public BrokerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    ThreadChannelBroker();
+
+    /**
+     * @brief Destructor. Frees the copy information.
+     */
+    virtual ~ThreadChannelBroker();
+
+    /**
+     * @brief See BrokerI::Init.
+     * @param[in] direction the signal direction.
+     * @param[in] dataSourceIn shall be a ThreadChannelDataSource.
+     * @param[in] functionName see BrokerI::Init.
+     * @param[in] gamMemoryAddress see BrokerI::Init.
+     * @return true if \a dataSourceIn is a ThreadChannelDataSource and BrokerI::InitFunctionPointers returns true.
+     */
+    virtual bool Init(const SignalDirection direction,
+                      DataSourceI &dataSourceIn,
+                      const char8 *const functionName,
+                      void *const gamMemoryAddress);
+
+    /**
+     * @brief Writes (OutputSignals) or reads (InputSignals) the signals of the GAM.
+     * @return true if all the copies are successful.
+     */
+    virtual bool Execute();
+
+private:
+
+    /**
+     * The ThreadChannelDataSource.
+     */
+    ThreadChannelDataSource *channel;
+
+    /**
+     * The direction of the signals.
+     */
+    SignalDirection signalDirection;
+
+    /**
+     * The offset of each copy with respect to the beginning of the data of a slot.
+     */
+    uint32 *slotOffsets;
+
+    /**
+     * The number of samples of each copy.
+     */
+    uint32 *samples;
+
+    /**
+     * The number of bytes of one sample of each copy.
+     */
+    uint32 *sampleSizes;
+
+    /**
+     * The number of published samples at the previous Execute (input only).
+     */
+    uint64 lastPublishedSamples;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* THREADCHANNELBROKER_H_ */
@@ -0,0 +1,384 @@
+/**
+ * @file ThreadChannelDataSource.cpp
+ * @brief Source file for class ThreadChannelDataSource
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ThreadChannelDataSource (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "MemoryOperationsHelper.h"
+#include "ThreadChannelDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The slots and the number of published samples are aligned to (and padded to a multiple of) this size,
+ * so that the writer and the readers only share the cache lines that they need to share.
+ */
+static const uint32 THREAD_CHANNEL_CACHE_LINE_SIZE = 64u;
+
+/**
+ * Alignment of each signal inside of a slot.
+ */
+static const uint32 THREAD_CHANNEL_SIGNAL_ALIGNMENT = 8u;
+
+/**
+ * Maximum number of times that Read tries to take a consistent copy of a sample.
+ */
+static const uint32 THREAD_CHANNEL_MAX_READ_RETRIES = 1000u;
+
+/**
+ * The header at the beginning of each slot (the data starts at the next cache line).
+ */
+struct ThreadChannelSlotHeader {
+    /**
+     * Sequence lock of the slot. Odd while the slot is being written.
+     */
+    volatile int32 sequence;
+
+    /**
+     * Set by the readers when the sample is read.
+     */
+    volatile int32 consumed;
+
+    /**
+     * The index of the sample stored in the slot (-1 if none).
+     */
+    volatile int64 sample;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ThreadChannelDataSource::ThreadChannelDataSource() :
+        DataSourceI() {
+    allocatedMemory = NULL_PTR(uint8 *);
+    publishedSamples = NULL_PTR(volatile int64 *);
+    slots = NULL_PTR(uint8 *);
+    slotSize = 0u;
+    signalOffsets = NULL_PTR(uint32 *);
+    numberOfBuffers = 2u;
+    writeSlot = NULL_PTR(uint8 *);
+    overwrites = 0;
+    staleReads = 0;
+    overruns = 0;
+}
+
+ThreadChannelDataSource::~ThreadChannelDataSource() {
+    if (allocatedMemory != NULL_PTR(uint8 *)) {
+        delete[] allocatedMemory;
+    }
+    if (signalOffsets != NULL_PTR(uint32 *)) {
+        delete[] signalOffsets;
+    }
+}
+
+bool ThreadChannelDataSource::Initialise(StructuredDataI & data) {
+    bool ret = DataSourceI::Initialise(data);
+    if (ret) {
+        if (!data.Read("NumberOfBuffers", numberOfBuffers)) {
+            numberOfBuffers = 2u;
+        }
+        ret = (numberOfBuffers > 0u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In ThreadChannelDataSource %s, NumberOfBuffers shall be > 0", GetName());
+        }
+    }
+    return ret;
+}
+
+bool ThreadChannelDataSource::SetConfiguredDatabase(StructuredDataI & data) {
+    bool ret = DataSourceI::SetConfiguredDatabase(data);
+    uint32 numberOfWriters = 0u;
+    uint32 nOfFunctions = GetNumberOfFunctions();
+    uint32 f;
+    for (f = 0u; (f < nOfFunctions) && (ret); f++) {
+        StreamString functionName;
+        ret = GetFunctionName(f, functionName);
+        uint32 nOfOutputSignals = 0u;
+        if (ret) {
+            ret = GetFunctionNumberOfSignals(OutputSignals, f, nOfOutputSignals);
+        }
+        if ((ret) && (nOfOutputSignals > 0u)) {
+            numberOfWriters++;
+            ret = (numberOfWriters == 1u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "In ThreadChannelDataSource %s, only one GAM can write (%s is the second)", GetName(),
+                             functionName.Buffer());
+            }
+        }
+        uint32 s;
+        for (s = 0u; (s < nOfOutputSignals) && (ret); s++) {
+            uint32 samples = 0u;
+            ret = GetFunctionSignalSamples(OutputSignals, f, s, samples);
+            if (ret) {
+                ret = (samples <= 1u);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "In ThreadChannelDataSource %s, the output signals of %s shall have Samples = 1",
+                                 GetName(), functionName.Buffer());
+                }
+            }
+        }
+        uint32 nOfInputSignals = 0u;
+        if (ret) {
+            ret = GetFunctionNumberOfSignals(InputSignals, f, nOfInputSignals);
+        }
+        for (s = 0u; (s < nOfInputSignals) && (ret); s++) {
+            uint32 samples = 0u;
+            ret = GetFunctionSignalSamples(InputSignals, f, s, samples);
+            if (ret) {
+                ret = (samples <= numberOfBuffers);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "In ThreadChannelDataSource %s, the input signals of %s shall have Samples <= %d",
+                                 GetName(), functionName.Buffer(), numberOfBuffers);
+                }
+            }
+            if ((ret) && (samples > 1u)) {
+                uint32 numberOfByteOffsets = 0u;
+                uint32 offsetStart = 0u;
+                uint32 copySize = 0u;
+                uint32 byteSize = 0u;
+                StreamString signalName;
+                uint32 signalIdx = 0u;
+                ret = GetFunctionSignalNumberOfByteOffsets(InputSignals, f, s, numberOfByteOffsets);
+                if (ret) {
+                    ret = GetFunctionSignalByteOffsetInfo(InputSignals, f, s, 0u, offsetStart, copySize);
+                }
+                if (ret) {
+                    ret = GetFunctionSignalAlias(InputSignals, f, s, signalName);
+                }
+                if (ret) {
+                    ret = GetSignalIndex(signalIdx, signalName.Buffer());
+                }
+                if (ret) {
+                    ret = GetSignalByteSize(signalIdx, byteSize);
+                }
+                if (ret) {
+                    ret = ((numberOfByteOffsets == 1u) && (copySize == byteSize));
+                    if (!ret) {
+                        REPORT_ERROR(ErrorManagement::InitialisationError, "In ThreadChannelDataSource %s, signal %s of %s cannot have Ranges and Samples > 1",
+                                     GetName(), signalName.Buffer(), functionName.Buffer());
+                    }
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+bool ThreadChannelDataSource::AllocateMemory() {
+    uint32 nOfSignals = GetNumberOfSignals();
+    bool ret = (allocatedMemory == NULL_PTR(uint8 *));
+    uint32 dataSize = 0u;
+    if ((ret) && (nOfSignals > 0u)) {
+        signalOffsets = new uint32[nOfSignals];
+        uint32 s;
+        for (s = 0u; (s < nOfSignals) && (ret); s++) {
+            uint32 byteSize = 0u;
+            ret = GetSignalByteSize(s, byteSize);
+            if (ret) {
+                signalOffsets[s] = dataSize;
+                dataSize += byteSize;
+                dataSize = (dataSize + (THREAD_CHANNEL_SIGNAL_ALIGNMENT - 1u)) & ~(THREAD_CHANNEL_SIGNAL_ALIGNMENT - 1u);
+            }
+        }
+    }
+    if (ret) {
+        dataSize = (dataSize + (THREAD_CHANNEL_CACHE_LINE_SIZE - 1u)) & ~(THREAD_CHANNEL_CACHE_LINE_SIZE - 1u);
+        slotSize = THREAD_CHANNEL_CACHE_LINE_SIZE + dataSize;
+        //The number of published samples, the slots and the margin to align the beginning of the memory
+        uint32 totalSize = (THREAD_CHANNEL_CACHE_LINE_SIZE + (slotSize * numberOfBuffers)) + THREAD_CHANNEL_CACHE_LINE_SIZE;
+        allocatedMemory = new uint8[totalSize];
+        ret = MemoryOperationsHelper::Set(allocatedMemory, '\0', totalSize);
+    }
+    if (ret) {
+        /*lint -e{923} -e{9091} the address has to be converted to an integer in order to be aligned*/
+        uintp base = reinterpret_cast<uintp>(allocatedMemory);
+        base = (base + (THREAD_CHANNEL_CACHE_LINE_SIZE - 1u)) & ~(static_cast<uintp>(THREAD_CHANNEL_CACHE_LINE_SIZE) - 1u);
+        /*lint -e{923} -e{9091} the aligned address is inside the allocated memory*/
+        uint8 *alignedMemory = reinterpret_cast<uint8 *>(base);
+        publishedSamples = reinterpret_cast<volatile int64 *>(alignedMemory);
+        slots = &alignedMemory[THREAD_CHANNEL_CACHE_LINE_SIZE];
+        uint32 b;
+        for (b = 0u; b < numberOfBuffers; b++) {
+            ThreadChannelSlotHeader *header = reinterpret_cast<ThreadChannelSlotHeader *>(&slots[b * slotSize]);
+            header->sample = -1;
+        }
+    }
+    return ret;
+}
+
+uint32 ThreadChannelDataSource::GetNumberOfMemoryBuffers() {
+    return 1u;
+}
+
+bool ThreadChannelDataSource::GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 bufferIdx, void *&signalAddress) {
+    bool ret = ((slots != NULL_PTR(uint8 *)) && (bufferIdx == 0u));
+    if (ret) {
+        ret = (signalIdx < GetNumberOfSignals());
+    }
+    if (ret) {
+        signalAddress = reinterpret_cast<void *>(&slots[THREAD_CHANNEL_CACHE_LINE_SIZE + GetSignalOffset(signalIdx)]);
+    }
+    return ret;
+}
+
+/*lint -e{715} the broker does not depend on the signal configuration*/
+const char8 *ThreadChannelDataSource::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    return "ThreadChannelBroker";
+}
+
+/*lint -e{715} the channel does not depend on the state*/
+bool ThreadChannelDataSource::PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName) {
+    return true;
+}
+
+bool ThreadChannelDataSource::Synchronise() {
+    return true;
+}
+
+uint32 ThreadChannelDataSource::GetSignalOffset(const uint32 signalIdx) const {
+    /*lint -e{613} signalOffsets cannot be NULL if there are signals*/
+    return signalOffsets[signalIdx];
+}
+
+uint8 *ThreadChannelDataSource::GetSlot(const uint64 sample) const {
+    uint64 slot = (sample % static_cast<uint64>(numberOfBuffers));
+    return &slots[static_cast<uint32>(slot) * slotSize];
+}
+
+uint8 *ThreadChannelDataSource::BeginWrite() {
+    //Only the writer changes the number of published samples
+    int64 sample = Atomic::Load(publishedSamples, Atomic::MemoryOrderRelaxed);
+    writeSlot = GetSlot(static_cast<uint64>(sample));
+    ThreadChannelSlotHeader *header = reinterpret_cast<ThreadChannelSlotHeader *>(writeSlot);
+    if ((header->sample >= 0) && (Atomic::Load(&header->consumed, Atomic::MemoryOrderRelaxed) == 0)) {
+        (void) Atomic::FetchAdd(&overwrites, 1, Atomic::MemoryOrderRelaxed);
+    }
+    int32 current = Atomic::Load(&header->sequence, Atomic::MemoryOrderRelaxed);
+    Atomic::Store(&header->sequence, current + 1, Atomic::MemoryOrderRelaxed);
+    //The readers shall see the odd sequence before any change to the slot
+    Atomic::ThreadFence(Atomic::MemoryOrderRelease);
+    Atomic::Store(&header->consumed, 0, Atomic::MemoryOrderRelaxed);
+    return &writeSlot[THREAD_CHANNEL_CACHE_LINE_SIZE];
+}
+
+void ThreadChannelDataSource::EndWrite() {
+    int64 sample = Atomic::Load(publishedSamples, Atomic::MemoryOrderRelaxed);
+    ThreadChannelSlotHeader *header = reinterpret_cast<ThreadChannelSlotHeader *>(writeSlot);
+    Atomic::Store(&header->sample, sample, Atomic::MemoryOrderRelaxed);
+    int32 current = Atomic::Load(&header->sequence, Atomic::MemoryOrderRelaxed);
+    Atomic::Store(&header->sequence, current + 1, Atomic::MemoryOrderRelease);
+    Atomic::Store(publishedSamples, sample + 1, Atomic::MemoryOrderRelease);
+}
+
+uint64 ThreadChannelDataSource::GetNumberOfPublishedSamples() const {
+    uint64 published = 0u;
+    if (publishedSamples != NULL_PTR(volatile int64 *)) {
+        published = static_cast<uint64>(Atomic::Load(publishedSamples, Atomic::MemoryOrderAcquire));
+    }
+    return published;
+}
+
+bool ThreadChannelDataSource::Read(const uint64 sample, const uint32 offset, void * const destination, const uint32 size) {
+    uint8 *slot = GetSlot(sample);
+    ThreadChannelSlotHeader *header = reinterpret_cast<ThreadChannelSlotHeader *>(slot);
+    bool ret = true;
+    bool consistent = false;
+    int64 readSample = -1;
+    uint32 retries;
+    for (retries = 0u; (ret) && (!consistent) && (retries < THREAD_CHANNEL_MAX_READ_RETRIES); retries++) {
+        int32 before = Atomic::Load(&header->sequence, Atomic::MemoryOrderAcquire);
+        if ((before & 1) == 0) {
+            readSample = Atomic::Load(&header->sample, Atomic::MemoryOrderRelaxed);
+            ret = MemoryOperationsHelper::Copy(destination, &slot[THREAD_CHANNEL_CACHE_LINE_SIZE + offset], size);
+            //The copy shall be completed before checking if the sequence has changed
+            Atomic::ThreadFence(Atomic::MemoryOrderAcquire);
+            consistent = (Atomic::Load(&header->sequence, Atomic::MemoryOrderRelaxed) == before);
+        }
+        else {
+            //The writer is writing the slot
+            Atomic::WaitWhileEqual(&header->sequence, before);
+        }
+    }
+    if (ret) {
+        ret = consistent;
+    }
+    if (ret) {
+        if (readSample != static_cast<int64>(sample)) {
+            (void) Atomic::FetchAdd(&overruns, 1, Atomic::MemoryOrderRelaxed);
+        }
+        Atomic::Store(&header->consumed, 1, Atomic::MemoryOrderRelaxed);
+    }
+    return ret;
+}
+
+void ThreadChannelDataSource::AddStaleRead() {
+    (void) Atomic::FetchAdd(&staleReads, 1, Atomic::MemoryOrderRelaxed);
+}
+
+uint64 ThreadChannelDataSource::GetOverwrites() const {
+    return static_cast<uint64>(Atomic::Load(&overwrites, Atomic::MemoryOrderRelaxed));
+}
+
+uint64 ThreadChannelDataSource::GetStaleReads() const {
+    return static_cast<uint64>(Atomic::Load(&staleReads, Atomic::MemoryOrderRelaxed));
+}
+
+uint64 ThreadChannelDataSource::GetOverruns() const {
+    return static_cast<uint64>(Atomic::Load(&overruns, Atomic::MemoryOrderRelaxed));
+}
+
+bool ThreadChannelDataSource::ExportData(StructuredDataI & data) {
+    bool ret = DataSourceI::ExportData(data);
+    if (ret) {
+        ret = data.Write("NumberOfPublishedSamples", GetNumberOfPublishedSamples());
+    }
+    if (ret) {
+        ret = data.Write("Overwrites", GetOverwrites());
+    }
+    if (ret) {
+        ret = data.Write("StaleReads", GetStaleReads());
+    }
+    if (ret) {
+        ret = data.Write("Overruns", GetOverruns());
+    }
+    return ret;
+}
+
+CLASS_REGISTER(ThreadChannelDataSource, "1.0")
+
+}
@@ -0,0 +1,291 @@
+/**
+ * @file ThreadChannelDataSource.h
+ * @brief Header file for class ThreadChannelDataSource
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ThreadChannelDataSource
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef THREADCHANNELDATASOURCE_H_
+#define THREADCHANNELDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "DataSourceI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief DataSourceI that exchanges signals between GAMs running in different RealTimeThreads, without locks and with
+ * a single copy on each side.
+ * @details The signals are stored in a ring of NumberOfBuffers slots. Each slot starts at a cache line boundary and is
+ * protected by its own sequence lock. The ThreadChannelBroker of the writing GAM copies the GAM signals directly into
+ * the next slot and publishes it; the ThreadChannelBroker of each reading GAM copies directly from the last published
+ * slot(s) into the GAM memory, and retries the copy of a signal if the slot was being rewritten at the same time.
+ * Neither side ever waits for the other and the brokers do not call Synchronise (i.e. this DataSourceI cannot be used
+ * to synchronise a RealTimeThread).
+ *
+ * The rates of the two threads are decoupled: an input signal with Samples = N reads the N most recently published
+ * samples (the oldest first), e.g. a thread running at 1 kHz can read all the samples produced by a 10 kHz thread with
+ * Samples = 10 and NumberOfBuffers >= 10 (plus some margin for the jitter of the reading thread).
+ *
+ * The following counters are kept (and exported in ExportData):
+ * - Overwrites: the number of published samples that were overwritten before being read by any reader (i.e. the
+ *   reader is too slow or NumberOfBuffers is too small);
+ * - StaleReads: the number of reads where no new sample was published since the previous read of the same GAM;
+ * - Overruns: the number of samples that were overwritten by the writer while a reader was trying to read them (a
+ *   newer sample is then read instead).
+ *
+ * Only one GAM may write in the DataSource, output signals shall have Samples = 1 and input signals with Samples > 1
+ * cannot have Ranges. Any number of GAMs may read the signals.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Channel = {
+ *     Class = ThreadChannelDataSource
+ *     NumberOfBuffers = 16 //Optional. Number of slots in the ring. Default = 2.
+ *     Signals = {
+ *         Current = {
+ *             Type = float32
+ *         }
+ *         Profile = {
+ *             Type = float32
+ *             NumberOfElements = 16
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class DLL_API ThreadChannelDataSource: public DataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    ThreadChannelDataSource();
+
+    /**
+     * @brief Destructor. Frees the slots.
+     */
+    virtual ~ThreadChannelDataSource();
+
+    /**
+     * @brief see DataSourceI::Initialise.
+     * @details Also reads the optional NumberOfBuffers parameter.
+     * @param[in] data see DataSourceI::Initialise.
+     * @return true if DataSourceI::Initialise returns true and NumberOfBuffers > 0.
+     */
+    virtual bool Initialise(StructuredDataI & data);
+
+    /**
+     * @brief see DataSourceI::SetConfiguredDatabase.
+     * @details Checks that there is at most one writing GAM, that the output signals have Samples = 1 and that the input
+     * signals have Samples <= NumberOfBuffers and no Ranges if Samples > 1.
+     * @param[in] data see DataSourceI::SetConfiguredDatabase.
+     * @return true if all the conditions above are met.
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI & data);
+
+    /**
+     * @brief Allocates the ring of slots.
+     * @return true if the memory can be allocated.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief Gets the number of memory buffers.
+     * @return 1 (the slots are managed by the ThreadChannelBroker).
+     */
+    virtual uint32 GetNumberOfMemoryBuffers();
+
+    /**
+     * @brief Gets the address of a signal in the first slot.
+     * @param[in] signalIdx the index of the signal.
+     * @param[in] bufferIdx shall be 0.
+     * @param[out] signalAddress the address of the signal in the first slot.
+     * @return true if the signal exists and bufferIdx == 0.
+     */
+    virtual bool GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 bufferIdx, void *&signalAddress);
+
+    /**
+     * @brief see DataSourceI::GetBrokerName.
+     * @return ThreadChannelBroker.
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+
+    /**
+     * @brief NOOP.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName);
+
+    /**
+     * @brief NOOP. The brokers never call it.
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Gets the offset of a signal with respect to the beginning of the data of a slot.
+     * @param[in] signalIdx the index of the signal.
+     * @return the offset in bytes.
+     * @pre
+     *   AllocateMemory() &&
+     *   signalIdx < GetNumberOfSignals()
+     */
+    uint32 GetSignalOffset(const uint32 signalIdx) const;
+
+    /**
+     * @brief Gets the data of the slot where the next sample is to be written, which is marked as being written.
+     * @return the beginning of the data of the slot.
+     * @pre
+     *   AllocateMemory()
+     * @post
+     *   EndWrite() shall be called after the data of the slot is written.
+     */
+    uint8 *BeginWrite();
+
+    /**
+     * @brief Publishes the slot returned by BeginWrite.
+     */
+    void EndWrite();
+
+    /**
+     * @brief Gets the number of samples published so far.
+     * @return the number of samples published.
+     */
+    uint64 GetNumberOfPublishedSamples() const;
+
+    /**
+     * @brief Copies part of a published sample.
+     * @details Retries the copy if the slot was being written at the same time. If the sample was overwritten, the newer
+     * sample that replaced it is copied instead and the Overruns counter is incremented.
+     * @param[in] sample the index of the sample (< GetNumberOfPublishedSamples()).
+     * @param[in] offset the offset with respect to the beginning of the data of the slot.
+     * @param[out] destination where to copy the data.
+     * @param[in] size the number of bytes to copy.
+     * @return true if a consistent copy could be taken.
+     */
+    bool Read(const uint64 sample, const uint32 offset, void * const destination, const uint32 size);
+
+    /**
+     * @brief Increments the StaleReads counter.
+     */
+    void AddStaleRead();
+
+    /**
+     * @brief Gets the number of published samples that were overwritten before being read.
+     * @return the Overwrites counter.
+     */
+    uint64 GetOverwrites() const;
+
+    /**
+     * @brief Gets the number of reads where no new sample was published since the previous read.
+     * @return the StaleReads counter.
+     */
+    uint64 GetStaleReads() const;
+
+    /**
+     * @brief Gets the number of samples overwritten while being read.
+     * @return the Overruns counter.
+     */
+    uint64 GetOverruns() const;
+
+    /**
+     * @brief see DataSourceI::ExportData.
+     * @details Also exports the NumberOfPublishedSamples, Overwrites, StaleReads and Overruns counters.
+     * @param[out] data see DataSourceI::ExportData.
+     * @return true if the data is successfully exported.
+     */
+    virtual bool ExportData(StructuredDataI & data);
+
+private:
+
+    /**
+     * @brief Gets the header of the slot where the sample is (to be) stored.
+     */
+    uint8 *GetSlot(const uint64 sample) const;
+
+    /**
+     * The memory returned by new, which may differ from the slots due to the alignment.
+     */
+    uint8 *allocatedMemory;
+
+    /**
+     * The number of published samples, in its own cache line.
+     */
+    volatile int64 *publishedSamples;
+
+    /**
+     * The first slot.
+     */
+    uint8 *slots;
+
+    /**
+     * The distance in bytes between two slots (multiple of the cache line size).
+     */
+    uint32 slotSize;
+
+    /**
+     * The offset of each signal with respect to the beginning of the data of a slot.
+     */
+    uint32 *signalOffsets;
+
+    /**
+     * The number of slots.
+     */
+    uint32 numberOfBuffers;
+
+    /**
+     * The slot being written (between BeginWrite and EndWrite).
+     */
+    uint8 *writeSlot;
+
+    /**
+     * Overwrites counter.
+     */
+    volatile int64 overwrites;
+
+    /**
+     * StaleReads counter.
+     */
+    volatile int64 staleReads;
+
+    /**
+     * Overruns counter.
+     */
+    volatile int64 overruns;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* THREADCHANNELDATASOURCE_H_ */
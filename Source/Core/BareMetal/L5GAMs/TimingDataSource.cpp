@@ -38,6 +38,30 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+/**
+ * Suffixes of the statistics signals, in the order expected by LatencyHistogram::SetOutputs.
+ */
+static const char8 * const timingStatisticsSuffixes[] = { "_P50", "_P99", "_P999", "_Max" };
+
+/**
+ * Number of elements in timingStatisticsSuffixes.
+ */
+static const uint32 TIMING_NUMBER_OF_STATISTICS = 4u;
+
+/**
+ * Suffixes of the performance counter signals, in the order of the PerformanceCounters indexes.
+ */
+static const char8 * const timingCountersSuffixes[] = { "_Cycles", "_Instructions", "_CacheMisses", "_BranchMisses" };
+
+/**
+ * Suffix of the GAM execution time signals.
+ */
+static const char8 * const timingExecTimeSuffix = "_ExecTime";
+
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -46,9 +70,231 @@ namespace MARTe {
 
 TimingDataSource::TimingDataSource() :
         GAMDataSource() {
+    useHistograms = false;
+    histograms = NULL_PTR(LatencyHistogram *);
+    numberOfHistograms = 0u;
+    usePerformanceCounters = false;
+    performanceCounters = NULL_PTR(ExecutablePerformanceCounters **);
+    numberOfPerformanceCounters = 0u;
 }
 
 TimingDataSource::~TimingDataSource() {
+    if (histograms != NULL_PTR(LatencyHistogram *)) {
+        delete[] histograms;
+    }
+    if (performanceCounters != NULL_PTR(ExecutablePerformanceCounters **)) {
+        for (uint32 n = 0u; n < numberOfPerformanceCounters; n++) {
+            if (performanceCounters[n] != NULL_PTR(ExecutablePerformanceCounters *)) {
+                delete performanceCounters[n];
+            }
+        }
+        delete[] performanceCounters;
+    }
+}
+
+bool TimingDataSource::Initialise(StructuredDataI & data) {
+    bool ret = GAMDataSource::Initialise(data);
+    if (ret) {
+        uint8 useHistogramsIn = 0u;
+        if (!data.Read("Histograms", useHistogramsIn)) {
+            useHistogramsIn = 0u;
+        }
+        useHistograms = (useHistogramsIn == 1u);
+        uint8 usePerformanceCountersIn = 0u;
+        if (!data.Read("PerformanceCounters", usePerformanceCountersIn)) {
+            usePerformanceCountersIn = 0u;
+        }
+        usePerformanceCounters = (usePerformanceCountersIn == 1u);
+    }
+    return ret;
+}
+
+bool TimingDataSource::AllocateMemory() {
+    bool ret = GAMDataSource::AllocateMemory();
+    if ((ret) && (useHistograms)) {
+        numberOfHistograms = GetNumberOfSignals();
+        histograms = new LatencyHistogram[numberOfHistograms];
+        uint32 *outputs[TIMING_NUMBER_OF_STATISTICS];
+        uint32 n;
+        for (n = 0u; (n < numberOfHistograms) && (ret); n++) {
+            StreamString signalName;
+            ret = GetSignalName(n, signalName);
+            uint32 s;
+            bool isStatistic = false;
+            for (s = 0u; (s < TIMING_NUMBER_OF_STATISTICS) && (ret); s++) {
+                StreamString statisticName = signalName;
+                statisticName += timingStatisticsSuffixes[s];
+                uint32 statisticIdx;
+                outputs[s] = NULL_PTR(uint32 *);
+                if (GetSignalIndex(statisticIdx, statisticName.Buffer())) {
+                    isStatistic = true;
+                    ret = (GetSignalType(statisticIdx) == UnsignedInteger32Bit);
+                    if (ret) {
+                        ret = GetSignalMemoryBuffer(statisticIdx, 0u, reinterpret_cast<void *&>(outputs[s]));
+                    }
+                    else {
+                        REPORT_ERROR(ErrorManagement::InitialisationError, "In TimingDataSource %s, signal %s shall be uint32", GetName(),
+                                     statisticName.Buffer());
+                    }
+                }
+            }
+            if ((ret) && (isStatistic)) {
+                histograms[n].SetOutputs(outputs[0u], outputs[1u], outputs[2u], outputs[3u]);
+            }
+        }
+    }
+    if ((ret) && (usePerformanceCounters)) {
+        ret = AllocatePerformanceCounters();
+    }
+    return ret;
+}
+
+bool TimingDataSource::AllocatePerformanceCounters() {
+    bool ret = true;
+    numberOfPerformanceCounters = GetNumberOfSignals();
+    performanceCounters = new ExecutablePerformanceCounters*[numberOfPerformanceCounters];
+    uint32 suffixSize = StringHelper::Length(timingExecTimeSuffix);
+    uint32 n;
+    for (n = 0u; n < numberOfPerformanceCounters; n++) {
+        performanceCounters[n] = NULL_PTR(ExecutablePerformanceCounters *);
+    }
+    for (n = 0u; (n < numberOfPerformanceCounters) && (ret); n++) {
+        StreamString signalName;
+        ret = GetSignalName(n, signalName);
+        uint32 signalNameSize = static_cast<uint32>(signalName.Size());
+        bool isExecTime = false;
+        if ((ret) && (signalNameSize > suffixSize)) {
+            isExecTime = (StringHelper::Compare(&(signalName.Buffer()[signalNameSize - suffixSize]), timingExecTimeSuffix) == 0);
+        }
+        if (isExecTime) {
+            StreamString gamName;
+            uint32 gamNameSize = signalNameSize - suffixSize;
+            ret = gamName.Write(signalName.Buffer(), gamNameSize);
+            ExecutablePerformanceCounters *counters = new ExecutablePerformanceCounters;
+            performanceCounters[n] = counters;
+            counters->numberOfSamples = 0u;
+            uint32 c;
+            for (c = 0u; (c < PerformanceCounters::NUMBER_OF_COUNTERS) && (ret); c++) {
+                counters->outputs[c] = NULL_PTR(uint64 *);
+                counters->totals[c] = 0u;
+                StreamString counterName = gamName;
+                counterName += timingCountersSuffixes[c];
+                uint32 counterIdx;
+                if (GetSignalIndex(counterIdx, counterName.Buffer())) {
+                    ret = (GetSignalType(counterIdx) == UnsignedInteger64Bit);
+                    if (ret) {
+                        ret = GetSignalMemoryBuffer(counterIdx, 0u, reinterpret_cast<void *&>(counters->outputs[c]));
+                    }
+                    else {
+                        REPORT_ERROR(ErrorManagement::InitialisationError, "In TimingDataSource %s, signal %s shall be uint64", GetName(),
+                                     counterName.Buffer());
+                    }
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+LatencyHistogram *TimingDataSource::GetSignalHistogram(const uint32 signalIdx) {
+    LatencyHistogram *histogram = NULL_PTR(LatencyHistogram *);
+    if ((histograms != NULL_PTR(LatencyHistogram *)) && (signalIdx < numberOfHistograms)) {
+        histogram = &histograms[signalIdx];
+    }
+    return histogram;
+}
+
+ExecutablePerformanceCounters *TimingDataSource::GetSignalPerformanceCounters(const uint32 signalIdx) {
+    ExecutablePerformanceCounters *counters = NULL_PTR(ExecutablePerformanceCounters *);
+    if ((performanceCounters != NULL_PTR(ExecutablePerformanceCounters **)) && (signalIdx < numberOfPerformanceCounters)) {
+        counters = performanceCounters[signalIdx];
+    }
+    return counters;
+}
+
+bool TimingDataSource::ExportData(StructuredDataI & data) {
+    bool ret = GAMDataSource::ExportData(data);
+    if ((ret) && (histograms != NULL_PTR(LatencyHistogram *))) {
+        ret = data.CreateRelative("Histograms");
+        uint32 n;
+        for (n = 0u; (n < numberOfHistograms) && (ret); n++) {
+            uint64 count = histograms[n].GetCount();
+            if (count > 0u) {
+                StreamString signalName;
+                ret = GetSignalName(n, signalName);
+                //The thread signals are named STATE_NAME.THREAD_NAME_CycleTime, i.e. CreateRelative creates one node per dot
+                uint32 depth = 1u;
+                const char8 *dot = StringHelper::SearchChar(signalName.Buffer(), '.');
+                while (dot != NULL_PTR(const char8 *)) {
+                    depth++;
+                    dot = StringHelper::SearchChar(&dot[1u], '.');
+                }
+                if (ret) {
+                    ret = data.CreateRelative(signalName.Buffer());
+                }
+                if (ret) {
+                    ret = histograms[n].Export(data);
+                }
+                if (ret) {
+                    ret = data.MoveToAncestor(depth);
+                }
+            }
+        }
+        if (ret) {
+            ret = data.MoveToAncestor(1u);
+        }
+    }
+    if ((ret) && (performanceCounters != NULL_PTR(ExecutablePerformanceCounters **))) {
+        ret = ExportPerformanceCounters(data);
+    }
+    return ret;
+}
+
+bool TimingDataSource::ExportPerformanceCounters(StructuredDataI & data) {
+    bool ret = data.CreateRelative("PerformanceCounters");
+    uint32 suffixSize = StringHelper::Length(timingExecTimeSuffix);
+    uint32 n;
+    for (n = 0u; (n < numberOfPerformanceCounters) && (ret); n++) {
+        const ExecutablePerformanceCounters *counters = performanceCounters[n];
+        bool hasSamples = (counters != NULL_PTR(const ExecutablePerformanceCounters *));
+        if (hasSamples) {
+            hasSamples = (counters->numberOfSamples > 0u);
+        }
+        if (hasSamples) {
+            StreamString signalName;
+            ret = GetSignalName(n, signalName);
+            StreamString gamName;
+            if (ret) {
+                uint32 gamNameSize = static_cast<uint32>(signalName.Size()) - suffixSize;
+                ret = gamName.Write(signalName.Buffer(), gamNameSize);
+            }
+            //As in the histograms, CreateRelative creates one node per dot
+            uint32 depth = 1u;
+            const char8 *dot = StringHelper::SearchChar(gamName.Buffer(), '.');
+            while (dot != NULL_PTR(const char8 *)) {
+                depth++;
+                dot = StringHelper::SearchChar(&dot[1u], '.');
+            }
+            if (ret) {
+                ret = data.CreateRelative(gamName.Buffer());
+            }
+            if (ret) {
+                ret = data.Write("Count", counters->numberOfSamples);
+            }
+            uint32 c;
+            for (c = 0u; (c < PerformanceCounters::NUMBER_OF_COUNTERS) && (ret); c++) {
+                //Skip the leading underscore of the suffix
+                ret = data.Write(&(timingCountersSuffixes[c][1u]), counters->totals[c]);
+            }
+            if (ret) {
+                ret = data.MoveToAncestor(depth);
+            }
+        }
+    }
+    if (ret) {
+        ret = data.MoveToAncestor(1u);
+    }
+    return ret;
 }
 
 bool TimingDataSource::SetConfiguredDatabase(StructuredDataI & data) {
@@ -32,7 +32,9 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "ExecutableI.h"
 #include "GAMDataSource.h"
+#include "LatencyHistogram.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -51,6 +53,20 @@ namespace MARTe {
  *  for this GAM_NAME have been executed. The GAM_NAME_WriteTime holds the time elapsed from the beginning of the cycle
  *  until all the output brokers for this GAM_NAME have been executed. The GAM_NAME_ExecTime holds the time elapsed
  *  from the beginning of the cycle until this GAM_NAME has finished its execution.
+ *
+ * If Histograms = 1 a LatencyHistogram is updated, by the GAMSchedulerI, with each thread cycle time and with each
+ * GAM_NAME_ReadTime, GAM_NAME_WriteTime and GAM_NAME_ExecTime. For any of these signals (e.g. GAM1_ExecTime) the signals
+ * GAM1_ExecTime_P50, GAM1_ExecTime_P99, GAM1_ExecTime_P999 and GAM1_ExecTime_Max (uint32) can be read from this
+ * DataSource and are updated after each sample. The histograms are also exported in ExportData (i.e. in the object browser).
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Timings = {
+ *     Class = TimingDataSource
+ *     Histograms = 1 //Optional. Default = 0.
+ *     PerformanceCounters = 1 //Optional. Default = 0.
+ * }
+ * </pre>
  */
 class DLL_API TimingDataSource: public GAMDataSource {
 public:
@@ -66,6 +82,46 @@ public:
      */
     virtual ~TimingDataSource();
 
+    /**
+     * @brief see GAMDataSource::Initialise.
+     * @details Also reads the optional Histograms and PerformanceCounters parameters.
+     * @param[in] data see GAMDataSource::Initialise.
+     * @return true if GAMDataSource::Initialise returns true.
+     */
+    virtual bool Initialise(StructuredDataI & data);
+
+    /**
+     * @brief see GAMDataSource::AllocateMemory.
+     * @details If Histograms = 1, also creates one LatencyHistogram per signal and links the _P50, _P99, _P999 and _Max
+     * signals to the histogram of the corresponding timing signal.
+     * If PerformanceCounters = 1, also creates the performance counters of every GAM_NAME_ExecTime signal and links the counter signals.
+     * @return true if GAMDataSource::AllocateMemory returns true, if all the statistics signals are uint32 and all the counter signals are uint64.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief Gets the histogram of a signal.
+     * @param[in] signalIdx the index of the signal.
+     * @return the histogram of the signal or NULL if Histograms = 0 or \a signalIdx is not valid.
+     */
+    LatencyHistogram *GetSignalHistogram(const uint32 signalIdx);
+
+    /**
+     * @brief Gets the performance counters of a GAM.
+     * @param[in] signalIdx the index of the GAM_NAME_ExecTime signal of the GAM.
+     * @return the performance counters of the GAM or NULL if PerformanceCounters = 0 or \a signalIdx is not the index of a GAM_NAME_ExecTime signal.
+     */
+    ExecutablePerformanceCounters *GetSignalPerformanceCounters(const uint32 signalIdx);
+
+    /**
+     * @brief see GAMDataSource::ExportData.
+     * @details If Histograms = 1, also exports for every signal with samples the Count, P50, P99, P999 and Max.
+     * If PerformanceCounters = 1, also exports for every GAM with samples the Count and the accumulated Cycles, Instructions, CacheMisses and BranchMisses.
+     * @param[out] data see GAMDataSource::ExportData.
+     * @return true if the data is successfully exported.
+     */
+    virtual bool ExportData(StructuredDataI & data);
+
     /**
      * @brief see GAMDataSource::Initialise.
      * @details Verifies that there are no producers assigned to this DataSourceI. The timing data will be produced by
@@ -74,6 +130,51 @@ public:
      * @return true if GAMDataSource::Initialise returns true and if there are no producers assigned to this DataSourceI.
      */
     virtual bool SetConfiguredDatabase(StructuredDataI & data);
+
+private:
+
+    /**
+     * @brief Creates the performance counters of the GAM_NAME_ExecTime signals and links the counter signals.
+     * @return true if all the counter signals are uint64.
+     */
+    bool AllocatePerformanceCounters();
+
+    /**
+     * @brief Exports the accumulated performance counters.
+     * @param[out] data where to export the counters.
+     * @return true if the data is successfully exported.
+     */
+    bool ExportPerformanceCounters(StructuredDataI & data);
+
+    /**
+     * True if Histograms = 1.
+     */
+    bool useHistograms;
+
+    /**
+     * One histogram per signal (if useHistograms).
+     */
+    LatencyHistogram *histograms;
+
+    /**
+     * Number of elements in histograms.
+     */
+    uint32 numberOfHistograms;
+
+    /**
+     * True if PerformanceCounters = 1.
+     */
+    bool usePerformanceCounters;
+
+    /**
+     * One pointer per signal to the performance counters of the GAM_NAME_ExecTime signals (NULL for the other signals).
+     */
+    ExecutablePerformanceCounters **performanceCounters;
+
+    /**
+     * Number of elements in performanceCounters.
+     */
+    uint32 numberOfPerformanceCounters;
 };
 
 }
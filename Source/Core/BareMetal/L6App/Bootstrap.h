@@ -63,6 +63,11 @@ public:
      * @param[out] loaderParameters the list of parsed parameters:
      * - Loader: the type of loader class to be used;
      * - Filename: the name of the file to be load;
+     * - ConfigurationFragments (optional): a comma separated list of the names of further configuration files to be merged with the Filename (see GetConfigurationFragments);
+     * - ParserThreads (optional): the maximum number of configuration files parsed at the same time (see Loader::Configure);
+     * - ConfigurationCache (optional): the name of the file where the compiled image of the configuration is kept (see GetConfigurationStream);
+     * - LibraryManifestFile (optional): the name of the file (cdb) that maps the class names to the shared libraries where they are registered (see GetConfigurationStream);
+     * - LibraryPreloadThreads (optional): the number of threads that open the libraries of the manifest (see Loader::Configure);
      * - DefaultCPUs: sets the threads defaults CPUs (see ProcessorType::SetDefaultCPUs);\n
      * - SchedulerGranularity: sets the scheduler granularity in micro-seconds (i.e. any requests to sleep no more than this value, will busy sleep).
      * - Parser: the type of parser to be parse the \a configuration as one of:cdb, xml and json;\n
@@ -75,12 +80,27 @@ public:
 
     /**
      * @brief Gets the configuration stream to be used for the application start.
+     * @details If the ConfigurationCache is set and the file has the image of a configuration with the same content and Parser, the image is
+     * memory mapped and returned instead of the configuration file. Otherwise the configuration file is parsed and its image written to the ConfigurationCache
+     * (see ConfigurationDatabaseImage) so that the next start with an unchanged configuration does not have to parse it again.
+     * If the LibraryManifestFile is set, the file is parsed and written in the LibraryManifest block of the \a loaderParameters
+     * (see Loader::Configure).
      * @param[in] loaderParameters the parameters that were read with ReadParameters.
      * @param[out] configurationStream the stream to be read.
      * @return ErrorManagement::NoError if the stream is ready to be read. A specific ErrorType otherwise.
      */
     ErrorManagement::ErrorType GetConfigurationStream(StructuredDataI &loaderParameters, StreamI *&configurationStream);
 
+    /**
+     * @brief Gets the streams of the configuration fragments to be merged with the configuration stream (see Loader::SetConfigurationFragments).
+     * @details The streams are valid until Run is called.
+     * @param[in] loaderParameters the parameters that were read with ReadParameters.
+     * @param[out] fragments the streams of the files listed in the ConfigurationFragments (NULL if not set).
+     * @param[out] numberOfFragments the number of elements of \a fragments (0 if the ConfigurationFragments is not set).
+     * @return ErrorManagement::NoError if all the files could be opened. A specific ErrorType otherwise.
+     */
+    ErrorManagement::ErrorType GetConfigurationFragments(StructuredDataI &loaderParameters, StreamI **&fragments, uint32 &numberOfFragments);
+
     /**
      * @brief Setup the execution specific environment and wait for (an environment specific) signal to terminate the program.
      * @return only when the program is to be terminated. ErrorManagement::NoError if the execution was successfully cleaned.
@@ -0,0 +1,190 @@
+/**
+ * @file ConfigurationParser.cpp
+ * @brief Source file for class ConfigurationParser
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ConfigurationParser (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationParser.h"
+#include "Loader.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ConfigurationParser::ConfigurationParser() {
+    parserType = NULL_PTR(const char8 *);
+    fragments = NULL_PTR(StreamI * const *);
+    parsed = NULL_PTR(ConfigurationDatabase *);
+    numberOfFragments = 0u;
+    nextFragment = 0u;
+    failed = false;
+    mux.Create();
+}
+
+ConfigurationParser::~ConfigurationParser() {
+    if (parsed != NULL_PTR(ConfigurationDatabase *)) {
+        delete[] parsed;
+    }
+}
+
+ErrorManagement::ErrorType ConfigurationParser::Parse(const char8 * const parserTypeIn,
+                                                      StreamI * const * const fragmentsIn,
+                                                      const uint32 numberOfFragmentsIn,
+                                                      ConfigurationDatabase &database,
+                                                      const uint32 numberOfThreads) {
+    if (parsed != NULL_PTR(ConfigurationDatabase *)) {
+        delete[] parsed;
+        parsed = NULL_PTR(ConfigurationDatabase *);
+    }
+    parserType = parserTypeIn;
+    fragments = fragmentsIn;
+    numberOfFragments = numberOfFragmentsIn;
+    nextFragment = 0u;
+    failed = false;
+    ErrorManagement::ErrorType ret;
+    ret.parametersError = (fragments == NULL_PTR(StreamI * const *)) || (numberOfFragments == 0u);
+    if (ret.ErrorsCleared()) {
+        parsed = new ConfigurationDatabase[numberOfFragments];
+        if ((numberOfThreads > 1u) && (numberOfFragments > 1u)) {
+            uint32 threads = (numberOfThreads < numberOfFragments) ? (numberOfThreads) : (numberOfFragments);
+            if (!RunWorkers(threads)) {
+                REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not start the parser threads. The fragments were parsed sequentially");
+            }
+        }
+        else {
+            Work();
+        }
+        ret.initialisationError = failed;
+    }
+    //Merged in order, so that the result does not depend on which fragment was parsed first
+    uint32 i;
+    for (i = 0u; (ret.ErrorsCleared()) && (i < numberOfFragments); i++) {
+        ret.fatalError = !parsed[i].MoveToRoot();
+        if (ret.ErrorsCleared()) {
+            ret.fatalError = !database.MoveToRoot();
+        }
+        if (ret.ErrorsCleared()) {
+            ret.parametersError = !Merge(parsed[i], database);
+            if (!ret) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to merge the configuration fragment %d", i);
+            }
+        }
+    }
+    return ret;
+}
+
+void ConfigurationParser::Work() {
+    bool done = false;
+    while (!done) {
+        if (mux.FastLock() != ErrorManagement::NoError) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "ConfigurationParser: Failed FastLock()");
+        }
+        uint32 fragmentIdx = nextFragment;
+        done = (fragmentIdx >= numberOfFragments);
+        if (!done) {
+            nextFragment++;
+        }
+        mux.FastUnLock();
+        if (!done) {
+            bool ok = (fragments[fragmentIdx] != NULL_PTR(StreamI *));
+            if (ok) {
+                ok = Loader::ParseConfiguration(parserType, *fragments[fragmentIdx], parsed[fragmentIdx]);
+            }
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to parse the configuration fragment %d", fragmentIdx);
+                if (mux.FastLock() != ErrorManagement::NoError) {
+                    REPORT_ERROR_STATIC(ErrorManagement::FatalError, "ConfigurationParser: Failed FastLock()");
+                }
+                failed = true;
+                mux.FastUnLock();
+            }
+        }
+    }
+}
+
+bool ConfigurationParser::Merge(ConfigurationDatabase &fragment,
+                                ConfigurationDatabase &destination) {
+    bool ok = true;
+    uint32 numberOfChildren = fragment.GetNumberOfChildren();
+    uint32 i;
+    for (i = 0u; (ok) && (i < numberOfChildren); i++) {
+        const char8 * const name = fragment.GetChildName(i);
+        ok = (name != NULL_PTR(const char8 *));
+        if (ok) {
+            if (fragment.MoveRelative(name)) {
+                if (!destination.MoveRelative(name)) {
+                    ok = !destination.GetLeaf(name).IsValid();
+                    if (ok) {
+                        ok = destination.CreateRelative(name);
+                    }
+                    else {
+                        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "%s is defined both as a leaf and as a node", name);
+                    }
+                }
+                if (ok) {
+                    ok = Merge(fragment, destination);
+                    if (!destination.MoveToAncestor(1u)) {
+                        ok = false;
+                    }
+                }
+                if (!fragment.MoveToAncestor(1u)) {
+                    ok = false;
+                }
+            }
+            else {
+                ReferenceT<AnyObject> leaf = fragment.GetLeaf(name);
+                ok = leaf.IsValid();
+                if (ok) {
+                    ok = !destination.GetLeaf(name).IsValid();
+                    if (ok) {
+                        ok = !destination.MoveRelative(name);
+                        if (!ok) {
+                            (void) destination.MoveToAncestor(1u);
+                        }
+                    }
+                    if (ok) {
+                        ok = destination.WriteLeaf(leaf);
+                    }
+                    else {
+                        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "%s is defined in more than one fragment", name);
+                    }
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+}
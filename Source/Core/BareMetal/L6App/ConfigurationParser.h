@@ -0,0 +1,165 @@
+/**
+ * @file ConfigurationParser.h
+ * @brief Header file for class ConfigurationParser
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ConfigurationParser
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef L6APP_CONFIGURATIONPARSER_H_
+#define L6APP_CONFIGURATIONPARSER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "ConfigurationDatabase.h"
+#include "ErrorType.h"
+#include "FastPollingMutexSem.h"
+#include "GeneralDefinitions.h"
+#include "StreamI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Parses the fragments of a configuration (e.g. one file per subsystem) on a bounded number of threads and merges them
+ * into a single database (see Loader).
+ * @details Each thread (the caller being one of them) takes the next fragment not yet taken and parses it, with
+ * Loader::ParseConfiguration, into its own ConfigurationDatabase. Once all the fragments are parsed they are merged, in the order
+ * in which they were given, into the destination database (see Merge): the nodes with the same path are joined, so that, for
+ * instance, each fragment can add its own GAMs to the same $App.Functions block.
+ *
+ * The leaves are not copied by the merge: the destination refers to the same leaf objects of the fragment databases
+ * (see ConfigurationDatabase::WriteLeaf), so that only the nodes are created again.
+ */
+class DLL_API ConfigurationParser {
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    ConfigurationParser();
+
+    /**
+     * @brief Destructor. Frees the parsed fragments.
+     */
+    ~ConfigurationParser();
+
+    /**
+     * @brief Parses all the fragments and merges them into \a database.
+     * @param[in] parserTypeIn the type of parser of all the fragments (see Loader::ParseConfiguration).
+     * @param[in] fragmentsIn the streams of the fragments (each one read from its current position).
+     * @param[in] numberOfFragmentsIn the number of elements of \a fragmentsIn.
+     * @param[in,out] database where the fragments are merged (after what it already holds).
+     * @param[in] numberOfThreads the maximum number of fragments parsed at the same time.
+     * @return ErrorManagement::NoError if all the fragments were parsed and merged without conflicts (see Merge).
+     */
+    ErrorManagement::ErrorType Parse(const char8 * const parserTypeIn,
+                                     StreamI * const * const fragmentsIn,
+                                     const uint32 numberOfFragmentsIn,
+                                     ConfigurationDatabase &database,
+                                     const uint32 numberOfThreads);
+
+    /**
+     * @brief Parses the fragments which were not yet taken, until all are taken.
+     * @details Executed by the caller of Parse and by each of the worker threads.
+     */
+    void Work();
+
+    /**
+     * @brief Merges the current node of \a fragment into the current node of \a destination.
+     * @details The nodes which do not exist in \a destination are appended (after its existing children) and the nodes which
+     * exist are merged recursively. A leaf is only written if \a destination does not have a leaf or a node with the same name.
+     * @param[in] fragment the parsed fragment.
+     * @param[in,out] destination where the fragment is merged.
+     * @return true if the fragment is merged and no leaf was defined twice.
+     */
+    static bool Merge(ConfigurationDatabase &fragment,
+                      ConfigurationDatabase &destination);
+
+private:
+
+    /**
+     * @brief Starts numberOfThreads - 1 threads executing Work, calls Work and waits for the threads to terminate.
+     * @details The implementation is environment specific.
+     * @return false if no thread could be started (Work was then only executed by the caller).
+     */
+    bool RunWorkers(const uint32 numberOfThreads);
+
+    /**
+     * The type of parser.
+     */
+    const char8 *parserType;
+
+    /**
+     * The streams of the fragments.
+     */
+    StreamI * const *fragments;
+
+    /**
+     * The parsed fragments.
+     */
+    ConfigurationDatabase *parsed;
+
+    /**
+     * The number of fragments.
+     */
+    uint32 numberOfFragments;
+
+    /**
+     * The index of the next fragment to be parsed.
+     */
+    uint32 nextFragment;
+
+    /**
+     * Set by the first fragment that fails to be parsed.
+     */
+    bool failed;
+
+    /**
+     * Protects nextFragment and failed.
+     */
+    FastPollingMutexSem mux;
+
+    /*lint -e{1704} non copyable*/
+    /**
+     * @brief Disallow the copy constructor.
+     */
+    ConfigurationParser(const ConfigurationParser &);
+
+    /**
+     * @brief Disallow the copy operator.
+     */
+    ConfigurationParser &operator=(const ConfigurationParser &);
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* L6APP_CONFIGURATIONPARSER_H_ */
@@ -45,7 +45,7 @@ namespace MARTe {
 /**
  * The list of linux MARTe applications.
  */
-static const char8 * const arguments = "Arguments are -l LOADERCLASS -f FILENAME [-p xml|json|cdb] [-s FIRST_STATE | -m MSG_DESTINATION:MSG_FUNCTION] [-c DEFAULT_CPUS] [-t BUILD_TOKENS] [-g SCHEDULER_GRANULARITY_US] [-k STOP_MSG_DESTINATION:STOP_MSG_FUNCTION]";
+static const char8 * const arguments = "Arguments are -l LOADERCLASS -f FILENAME [-p xml|json|cdb] [-s FIRST_STATE | -m MSG_DESTINATION:MSG_FUNCTION] [-c DEFAULT_CPUS] [-t BUILD_TOKENS] [-g SCHEDULER_GRANULARITY_US] [-k STOP_MSG_DESTINATION:STOP_MSG_FUNCTION] [-cf CONFIGURATION_CACHE_FILENAME] [-lm LIBRARY_MANIFEST_FILENAME] [-lp LIBRARY_PRELOAD_THREADS] [-i FRAGMENT_FILENAME,...] [-pt PARSER_THREADS]";
 
 }
 
@@ -98,6 +98,18 @@ ErrorManagement::ErrorType Bootstrap::ReadParameters(int32 argc, char8 **argv, S
             REPORT_ERROR_STATIC(ret, arguments);
         }
     }
+    if (ret) {
+        StreamString fragmentFilenames;
+        if (argsConfiguration.Read("-i", fragmentFilenames)) {
+            ret.parametersError = !loaderParameters.Write("ConfigurationFragments", fragmentFilenames.Buffer());
+        }
+    }
+    if (ret) {
+        uint32 parserThreads;
+        if (argsConfiguration.Read("-pt", parserThreads)) {
+            ret.parametersError = !loaderParameters.Write("ParserThreads", parserThreads);
+        }
+    }
     if (ret) {
         StreamString precompiledRealTimeFunctionsFilename;
         if (argsConfiguration.Read("-pf", precompiledRealTimeFunctionsFilename)) {
@@ -118,9 +130,31 @@ ErrorManagement::ErrorType Bootstrap::ReadParameters(int32 argc, char8 **argv, S
     }
 
     if (ret) {
-        uint32 defaultCPUs = 0x1;
+        StreamString configurationCacheFilename;
+        if (argsConfiguration.Read("-cf", configurationCacheFilename)) {
+            ret.parametersError = !loaderParameters.Write("ConfigurationCache", configurationCacheFilename.Buffer());
+        }
+    }
+
+    if (ret) {
+        StreamString libraryManifestFilename;
+        if (argsConfiguration.Read("-lm", libraryManifestFilename)) {
+            ret.parametersError = !loaderParameters.Write("LibraryManifestFile", libraryManifestFilename.Buffer());
+        }
+    }
+
+    if (ret) {
+        uint32 libraryPreloadThreads;
+        if (argsConfiguration.Read("-lp", libraryPreloadThreads)) {
+            ret.parametersError = !loaderParameters.Write("LibraryPreloadThreads", libraryPreloadThreads);
+        }
+    }
+
+    if (ret) {
+        //Given as is to the Loader, so that it can be a mask or a list of CPUs (see ProcessorType::SetFromString)
+        StreamString defaultCPUs = "0x1";
         (void) argsConfiguration.Read("-c", defaultCPUs);
-        ret.parametersError = !loaderParameters.Write("DefaultCPUs", defaultCPUs);
+        ret.parametersError = !loaderParameters.Write("DefaultCPUs", defaultCPUs.Buffer());
     }
     if (ret) {
         uint32 schedulerGranularity;
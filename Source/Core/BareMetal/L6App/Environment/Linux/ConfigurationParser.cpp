@@ -0,0 +1,78 @@
+/**
+ * @file ConfigurationParser.cpp
+ * @brief Source file for class ConfigurationParser
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the Linux specific methods of
+ * the class ConfigurationParser.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <pthread.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ConfigurationParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Entry point of the worker threads.
+ */
+static void *ConfigurationParserWorker(void * const parser) {
+    static_cast<ConfigurationParser *>(parser)->Work();
+    return NULL_PTR(void *);
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+bool ConfigurationParser::RunWorkers(const uint32 numberOfThreads) {
+    //As for the ParallelObjectBuilder, the workers are plain (joinable) pthreads, only alive while the fragments are parsed
+    pthread_t *workers = new pthread_t[numberOfThreads - 1u];
+    uint32 started = 0u;
+    bool ok = true;
+    while ((ok) && (started < (numberOfThreads - 1u))) {
+        ok = (pthread_create(&workers[started], NULL_PTR(pthread_attr_t *), &ConfigurationParserWorker, this) == 0);
+        if (ok) {
+            started++;
+        }
+    }
+    //The caller always works, so that all the fragments are parsed even if no thread could be started
+    Work();
+    uint32 i;
+    for (i = 0u; i < started; i++) {
+        (void) pthread_join(workers[i], NULL_PTR(void **));
+    }
+    delete[] workers;
+    return (started > 0u);
+}
+
+}
@@ -0,0 +1,96 @@
+/**
+ * @file LibraryPreloader.cpp
+ * @brief Source file for class LibraryPreloader
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LibraryPreloader (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "ClassRegistryDatabase.h"
+#include "LibraryPreloader.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+LibraryPreloader::LibraryPreloader() {
+    numberOfLibraries = 0u;
+    nextLibrary = 0u;
+    failed = false;
+    mux.Create();
+}
+
+LibraryPreloader::~LibraryPreloader() {
+}
+
+bool LibraryPreloader::Preload(const uint32 numberOfThreads) {
+    numberOfLibraries = ClassRegistryDatabase::Instance()->GetNumberOfManifestLibraries();
+    nextLibrary = 0u;
+    failed = false;
+    if ((numberOfThreads > 1u) && (numberOfLibraries > 1u)) {
+        uint32 threads = (numberOfThreads < numberOfLibraries) ? (numberOfThreads) : (numberOfLibraries);
+        if (!RunWorkers(threads)) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not start the preload threads. The libraries were opened sequentially");
+        }
+    }
+    else {
+        Work();
+    }
+    return (!failed);
+}
+
+void LibraryPreloader::Work() {
+    bool done = false;
+    while (!done) {
+        if (mux.FastLock() != ErrorManagement::NoError) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "LibraryPreloader: Failed FastLock()");
+        }
+        uint32 libraryIdx = nextLibrary;
+        done = (libraryIdx >= numberOfLibraries);
+        if (!done) {
+            nextLibrary++;
+        }
+        mux.FastUnLock();
+        if (!done) {
+            if (!ClassRegistryDatabase::Instance()->PreloadManifestLibrary(libraryIdx)) {
+                if (mux.FastLock() != ErrorManagement::NoError) {
+                    REPORT_ERROR_STATIC(ErrorManagement::FatalError, "LibraryPreloader: Failed FastLock()");
+                }
+                failed = true;
+                mux.FastUnLock();
+            }
+        }
+    }
+}
+
+}
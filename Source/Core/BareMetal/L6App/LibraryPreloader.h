@@ -0,0 +1,124 @@
+/**
+ * @file LibraryPreloader.h
+ * @brief Header file for class LibraryPreloader
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class LibraryPreloader
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef L6APP_LIBRARYPRELOADER_H_
+#define L6APP_LIBRARYPRELOADER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "FastPollingMutexSem.h"
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Opens all the libraries of the ClassRegistryDatabase library manifest on a bounded number of threads (see Loader).
+ * @details Each thread (the caller being one of them) takes the next library not yet taken and opens it with
+ * ClassRegistryDatabase::PreloadManifestLibrary, so that the classes are already registered when the objects are built.
+ * @warning The dynamic loader of the operating system may serialise part of the work (e.g. the relocations), so that the gain
+ * of more than one thread depends on how much of the time is spent reading the libraries from the storage.
+ */
+class DLL_API LibraryPreloader {
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    LibraryPreloader();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~LibraryPreloader();
+
+    /**
+     * @brief Opens all the libraries of the library manifest.
+     * @param[in] numberOfThreads the maximum number of libraries opened at the same time.
+     * @return true if all the libraries were opened.
+     */
+    bool Preload(const uint32 numberOfThreads);
+
+    /**
+     * @brief Opens the libraries which were not yet taken, until all are taken.
+     * @details Executed by the caller of Preload and by each of the worker threads.
+     */
+    void Work();
+
+private:
+
+    /**
+     * @brief Starts numberOfThreads - 1 threads executing Work, calls Work and waits for the threads to terminate.
+     * @details The implementation is environment specific.
+     * @return false if no thread could be started (Work was then only executed by the caller).
+     */
+    bool RunWorkers(const uint32 numberOfThreads);
+
+    /**
+     * The number of libraries in the manifest.
+     */
+    uint32 numberOfLibraries;
+
+    /**
+     * The index of the next library to be opened.
+     */
+    uint32 nextLibrary;
+
+    /**
+     * Set by the first library that fails to open.
+     */
+    bool failed;
+
+    /**
+     * Protects nextLibrary and failed.
+     */
+    FastPollingMutexSem mux;
+
+    /*lint -e{1704} non copyable*/
+    /**
+     * @brief Disallow the copy constructor.
+     */
+    LibraryPreloader(const LibraryPreloader &);
+
+    /**
+     * @brief Disallow the copy operator.
+     */
+    LibraryPreloader &operator=(const LibraryPreloader &);
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* L6APP_LIBRARYPRELOADER_H_ */
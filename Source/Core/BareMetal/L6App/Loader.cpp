@@ -30,11 +30,17 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "ClassRegistryDatabase.h"
 #include "ConfigurationDatabase.h"
+#include "ConfigurationDatabaseImage.h"
+#include "ConfigurationParser.h"
+#include "CPUFeatures.h"
 #include "JsonParser.h"
+#include "LibraryPreloader.h"
 #include "Loader.h"
 #include "MessageI.h"
 #include "ObjectRegistryDatabase.h"
+#include "ParallelObjectBuilder.h"
 #include "StandardParser.h"
 #include "XMLParser.h"
 
@@ -49,6 +55,8 @@ namespace MARTe {
 
 Loader::Loader() :
         Object() {
+    fragments = NULL_PTR(StreamI * const *);
+    numberOfFragments = 0u;
 }
 
 Loader::~Loader() {
@@ -56,12 +64,31 @@ Loader::~Loader() {
 
 ErrorManagement::ErrorType Loader::Configure(StructuredDataI &data, StreamI &configuration) {
     ErrorManagement::ErrorType ret = Object::Initialise(data);
-    uint32 defaultCPUs = 0x1u;
-    if (!data.Read("DefaultCPUs", defaultCPUs)) {
+    ProcessorType defaultCPUs(0x1u);
+    StreamString defaultCPUsConfig;
+    if (data.Read("DefaultCPUs", defaultCPUsConfig)) {
+        if (!defaultCPUs.SetFromString(defaultCPUsConfig.Buffer())) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Invalid DefaultCPUs %s", defaultCPUsConfig.Buffer());
+            ret.parametersError = true;
+        }
+    }
+    else {
         REPORT_ERROR_STATIC(ErrorManagement::Warning, "DefaultCPUs not specified");
     }
-    REPORT_ERROR_STATIC(ErrorManagement::Information, "DefaultCPUs set to %d", defaultCPUs);
-    ProcessorType::SetDefaultCPUs(defaultCPUs);
+    char8 defaultCPUsList[128];
+    (void) defaultCPUs.ToList(&defaultCPUsList[0], static_cast<uint32>(sizeof(defaultCPUsList)));
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "DefaultCPUs set to %s", &defaultCPUsList[0]);
+    ProcessorType::SetDefaultCPUs(defaultCPUs.GetProcessorMask());
+
+    //The kernels select their implementation from these (see CPUFeatures)
+    StreamString cpuFeatures;
+    uint32 feature;
+    for (feature = 1u; feature < CPUFeatures::CPU_FEATURE_LAST; feature <<= 1u) {
+        if (CPUFeatures::Has(feature)) {
+            (void) cpuFeatures.Printf(" %s", CPUFeatures::GetName(feature));
+        }
+    }
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "CPU features:%s", (cpuFeatures.Size() > 0u) ? (cpuFeatures.Buffer()) : (" none"));
 
     uint32 schedulerGranularity = 0u;
     if (data.Read("SchedulerGranularity", schedulerGranularity)) {
@@ -69,6 +96,23 @@ ErrorManagement::ErrorType Loader::Configure(StructuredDataI &data, StreamI &con
     }
     REPORT_ERROR_STATIC(ErrorManagement::Information, "SchedulerGranularity is %d", Sleep::GetSchedulerGranularity());
 
+    uint32 spinThreshold = 0u;
+    if (data.Read("SpinThreshold", spinThreshold)) {
+        Sleep::SetSpinThreshold(spinThreshold);
+    }
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "SpinThreshold is %d", Sleep::GetSpinThreshold());
+
+    uint32 timerSlack = 0u;
+    if (data.Read("TimerSlack", timerSlack)) {
+        if (Sleep::SetTimerSlack(timerSlack)) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "TimerSlack is %d", Sleep::GetTimerSlack());
+        }
+        else {
+            ret.initialisationError = true;
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Could not set the TimerSlack to %d", timerSlack);
+        }
+    }
+
     StreamString buildTokens;
     if (data.Read("BuildTokens", buildTokens)) {
         uint32 i;
@@ -100,8 +144,68 @@ ErrorManagement::ErrorType Loader::Configure(StructuredDataI &data, StreamI &con
         }
     }
 
+    if ((ret.ErrorsCleared()) && (data.MoveRelative("LibraryManifest"))) {
+        uint32 nEntries = data.GetNumberOfChildren();
+        uint32 i;
+        for (i = 0u; (ret.ErrorsCleared()) && (i < nEntries); i++) {
+            const char8 * const className = data.GetChildName(i);
+            StreamString libraryPath;
+            ret.parametersError = !data.Read(className, libraryPath);
+            if (ret.ErrorsCleared()) {
+                ret.parametersError = !ClassRegistryDatabase::Instance()->AddLibraryManifestEntry(className, libraryPath.Buffer());
+            }
+            if (!ret.ErrorsCleared()) {
+                REPORT_ERROR_STATIC(ret, "Invalid LibraryManifest entry for class %s", className);
+            }
+        }
+        if (!data.MoveToAncestor(1u)) {
+            ret.fatalError = true;
+        }
+        uint32 preloadThreads = 1u;
+        if (!data.Read("LibraryPreloadThreads", preloadThreads)) {
+            preloadThreads = 1u;
+        }
+        if ((ret.ErrorsCleared()) && (preloadThreads > 0u)) {
+            LibraryPreloader preloader;
+            if (preloader.Preload(preloadThreads)) {
+                REPORT_ERROR_STATIC(ErrorManagement::Information, "Preloaded %d libraries of the LibraryManifest on up to %d threads",
+                                    ClassRegistryDatabase::Instance()->GetNumberOfManifestLibraries(), preloadThreads);
+            }
+            else {
+                //Not fatal: the classes which are not found are still searched with all the library extensions
+                REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed to preload some of the libraries of the LibraryManifest");
+            }
+        }
+    }
+
+    if ((ret.ErrorsCleared()) && (data.MoveRelative("ObjectPools"))) {
+        uint32 nPools = data.GetNumberOfChildren();
+        uint32 i;
+        for (i = 0u; (ret.ErrorsCleared()) && (i < nPools); i++) {
+            const char8 * const className = data.GetChildName(i);
+            uint32 numberOfBlocks = 0u;
+            ret.parametersError = !data.Read(className, numberOfBlocks);
+            ClassRegistryItem *item = NULL_PTR(ClassRegistryItem *);
+            if (ret.ErrorsCleared()) {
+                item = ClassRegistryDatabase::Instance()->Find(className);
+                ret.parametersError = (item == NULL_PTR(ClassRegistryItem *));
+            }
+            if (ret.ErrorsCleared()) {
+                ret.initialisationError = !item->CreatePool(numberOfBlocks);
+            }
+            if (ret.ErrorsCleared()) {
+                REPORT_ERROR_STATIC(ErrorManagement::Information, "Created a pool with %d objects for class %s", numberOfBlocks, className);
+            }
+            else {
+                REPORT_ERROR_STATIC(ret, "Failed to create the object pool for class %s", className);
+            }
+        }
+        if (!data.MoveToAncestor(1u)) {
+            ret.fatalError = true;
+        }
+    }
+
     StreamString parserType;
-    StreamString parserError;
     //Read the parser type
     if (ret.ErrorsCleared()) {
         ret.parametersError = !data.Read("Parser", parserType);
@@ -113,33 +217,65 @@ ErrorManagement::ErrorType Loader::Configure(StructuredDataI &data, StreamI &con
         ret.initialisationError = !configuration.Seek(0LLU);
     }
     if (ret.ErrorsCleared()) {
-        if (parserType == "xml") {
-            XMLParser parser(configuration, parsedConfiguration, &parserError);
-            ret.initialisationError = !parser.Parse();
-        }
-        else if (parserType == "json") {
-            JsonParser parser(configuration, parsedConfiguration, &parserError);
-            ret.initialisationError = !parser.Parse();
-        }
-        else if (parserType == "cdb") {
-            StandardParser parser(configuration, parsedConfiguration, &parserError);
-            ret.initialisationError = !parser.Parse();
-        }
-        else {
-            ret = ErrorManagement::ParametersError;
-            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Unknown Parser specified");
+        //Images are compiled from an already parsed configuration (see ConfigurationDatabaseImage)
+        bool isImage = ConfigurationDatabaseImage::IsImage(configuration);
+        if (isImage) {
+            ret.initialisationError = !ConfigurationDatabaseImage::Read(configuration, parsedConfiguration);
+            if (ret.ErrorsCleared()) {
+                REPORT_ERROR_STATIC(ErrorManagement::Information, "Loaded the compiled configuration image");
+            }
         }
-        if (!ret) {
-            StreamString errPrint;
-            (void) errPrint.Printf("Failed to parse %s", parserError.Buffer());
-            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, errPrint.Buffer());
+        if (ret.ErrorsCleared()) {
+            if (numberOfFragments > 0u) {
+                //The configuration (unless already loaded) is parsed as the first fragment
+                uint32 numberOfStreams = numberOfFragments;
+                if (!isImage) {
+                    numberOfStreams++;
+                }
+                StreamI **streams = new StreamI*[numberOfStreams];
+                uint32 s = 0u;
+                if (!isImage) {
+                    streams[s] = &configuration;
+                    s++;
+                }
+                uint32 f;
+                for (f = 0u; f < numberOfFragments; f++) {
+                    streams[s] = fragments[f];
+                    s++;
+                }
+                uint32 parserThreads = numberOfStreams;
+                if (!data.Read("ParserThreads", parserThreads)) {
+                    parserThreads = numberOfStreams;
+                }
+                REPORT_ERROR_STATIC(ErrorManagement::Information, "Parsing %d configuration fragments on up to %d threads", numberOfStreams, parserThreads);
+                ConfigurationParser parser;
+                ret = parser.Parse(parserType.Buffer(), streams, numberOfStreams, parsedConfiguration, parserThreads);
+                delete[] streams;
+            }
+            else if (!isImage) {
+                ret = ParseConfiguration(parserType.Buffer(), configuration, parsedConfiguration);
+            }
+            else {
+                //Already loaded
+            }
         }
     }
     if (ret.ErrorsCleared()) {
         ret.fatalError = !parsedConfiguration.MoveToRoot();
     }
     if (ret.ErrorsCleared()) {
-        ret.initialisationError = !ObjectRegistryDatabase::Instance()->Initialise(parsedConfiguration);
+        uint32 initialisationThreads = 1u;
+        if (!data.Read("InitialisationThreads", initialisationThreads)) {
+            initialisationThreads = 1u;
+        }
+        if (initialisationThreads > 1u) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Building the objects with ParallelInitialise on up to %d threads", initialisationThreads);
+            ParallelObjectBuilder builder;
+            ret.initialisationError = !builder.Build(parsedConfiguration, *ObjectRegistryDatabase::Instance(), initialisationThreads);
+        }
+        else {
+            ret.initialisationError = !ObjectRegistryDatabase::Instance()->Initialise(parsedConfiguration);
+        }
         if (!ret) {
             REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Failed to initialise the ObjectRegistryDatabase");
         }
@@ -155,6 +291,41 @@ ErrorManagement::ErrorType Loader::Configure(StructuredDataI &data, StreamI &con
     return ret;
 }
 
+ErrorManagement::ErrorType Loader::ParseConfiguration(const char8 * const parserType,
+                                                      StreamI &configuration,
+                                                      StructuredDataI &database) {
+    ErrorManagement::ErrorType ret;
+    StreamString parserError;
+    StreamString parserName = parserType;
+    if (parserName == "xml") {
+        XMLParser parser(configuration, database, &parserError);
+        ret.initialisationError = !parser.Parse();
+    }
+    else if (parserName == "json") {
+        JsonParser parser(configuration, database, &parserError);
+        ret.initialisationError = !parser.Parse();
+    }
+    else if (parserName == "cdb") {
+        StandardParser parser(configuration, database, &parserError);
+        ret.initialisationError = !parser.Parse();
+    }
+    else {
+        ret = ErrorManagement::ParametersError;
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Unknown Parser specified");
+    }
+    if (!ret) {
+        StreamString errPrint;
+        (void) errPrint.Printf("Failed to parse %s", parserError.Buffer());
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, errPrint.Buffer());
+    }
+    return ret;
+}
+
+void Loader::SetConfigurationFragments(StreamI * const * const fragmentsIn, const uint32 numberOfFragmentsIn) {
+    fragments = fragmentsIn;
+    numberOfFragments = numberOfFragmentsIn;
+}
+
 ErrorManagement::ErrorType Loader::Start() {
     ErrorManagement::ErrorType ret;
     if (messageDestination.Size() > 0u) {
@@ -179,6 +350,12 @@ ErrorManagement::ErrorType Loader::Stop() {
     return ErrorManagement::NoError;
 }
 
+/*lint -e{715} configuration is not used by the Loader.*/
+ErrorManagement::ErrorType Loader::Reload(StreamI &configuration) {
+    REPORT_ERROR_STATIC(ErrorManagement::UnsupportedFeature, "The Loader cannot reload the configuration");
+    return ErrorManagement::UnsupportedFeature;
+}
+
 CLASS_REGISTER(Loader, "")
 
 }
@@ -66,14 +66,41 @@ public:
      * @param[in] data the loader parameters: \n
      * - DefaultCPUs (optional): sets the threads defaults CPUs (see ProcessorType::SetDefaultCPUs);\n
      * - SchedulerGranularity (optional): sets the scheduler granularity in micro-seconds (i.e. any requests to sleep no more than this value, will busy sleep).
+     * - SpinThreshold (optional): sets the time in nano-seconds at the end of a Sleep::Until/Sleep::Hybrid that is busy waited (see Sleep::SetSpinThreshold);\n
+     * - TimerSlack (optional): sets the operating system timer slack in nano-seconds, inherited by all the threads created afterwards (see Sleep::SetTimerSlack);\n
+     * - LibraryManifest (optional): a block where each element is the name of a class and the value the path of the shared library where the class is registered (see ClassRegistryDatabase::AddLibraryManifestEntry), e.g. LibraryManifest = { IOGAM = "/opt/MARTe2/GAMs/IOGAM.so" };\n
+     * - LibraryPreloadThreads (optional): the number of threads that open all the libraries of the LibraryManifest before the objects are built (see LibraryPreloader). 0 to only open the libraries when the classes are first needed. Default is 1;\n
+     * - ObjectPools (optional): a block where each element is the name of a registered class and the value the initial number of objects in the pool from where the instances of that class are allocated (see ClassRegistryItem::CreatePool), e.g. ObjectPools = { ConfigurationDatabaseNode = 4096 };\n
+     * - InitialisationThreads (optional): if greater than 1, the top-level objects which declare ParallelInitialise = 1 are built concurrently on up to this number of threads (see ParallelObjectBuilder). Default is 1 (all the objects are built one after the other);\n
      * - Parser: the type of parser to be parse the \a configuration as one of:cdb, xml and json;\n
+     * - ParserThreads (optional): the maximum number of configuration fragments (see SetConfigurationFragments) parsed at the same time (see ConfigurationParser). Default is the number of fragments;\n
      * - MessageDestination (optional): the name of the Object that will receive the message when Start is called;\n
      * - MessageFunction (optional, but compulsory if MessageDestination is set): the name of the Function to be called in the MessageDestination.
      * @param[in] configuration the MARTe configuration stream to be loaded (and parsed using the Parser defined above).
+     * If the stream is a compiled configuration image (see ConfigurationDatabaseImage) it is loaded directly and the Parser is not used.
+     * The configuration fragments (if any, see SetConfigurationFragments) are parsed, with the \a configuration, on up to ParserThreads threads and merged after it.
      * @return ErrorManagement::NoError if the Parser is specified, the \a configuration can be parsed and if the ObjectRegistryDatabase can be Initialised with the parsed configuration. An error is returned otherwise.
      */
     virtual ErrorManagement::ErrorType Configure(StructuredDataI &data, StreamI &configuration);
 
+    /**
+     * @brief Parses a configuration stream with one of the supported parsers.
+     * @param[in] parserType the type of parser as one of: cdb, xml and json.
+     * @param[in] configuration the configuration stream to be parsed.
+     * @param[out] database where the parsed configuration is written.
+     * @return ErrorManagement::NoError if the \a parserType is supported and the \a configuration could be parsed. An error is returned otherwise.
+     */
+    static ErrorManagement::ErrorType ParseConfiguration(const char8 * const parserType, StreamI &configuration, StructuredDataI &database);
+
+    /**
+     * @brief Sets the streams of further configuration fragments (e.g. one file per subsystem) to be merged, by Configure, with the configuration.
+     * @details The fragments are parsed with the same Parser and merged in order (see ConfigurationParser::Merge), so that each fragment can add
+     * its objects to the blocks declared by the configuration or by the previous fragments.
+     * @param[in] fragmentsIn the streams of the fragments, which shall be valid until Configure returns.
+     * @param[in] numberOfFragmentsIn the number of elements of \a fragmentsIn.
+     */
+    void SetConfigurationFragments(StreamI * const * const fragmentsIn, const uint32 numberOfFragmentsIn);
+
     /**
      * @brief If the MessageDestination was specified in Initialise, sends the Message to the specified destination.
      * @return ErrorManagement::NoError if the MessageDestination was specified and if the Message was successfully sent. An error is returned otherwise.
@@ -86,6 +113,13 @@ public:
      */
     virtual ErrorManagement::ErrorType Stop();
 
+    /**
+     * @brief Applies a new configuration to the running objects, without stopping them.
+     * @param[in] configuration the new configuration stream.
+     * @return ErrorManagement::UnsupportedFeature, as the Loader cannot apply a new configuration (see RealTimeLoader::Reload).
+     */
+    virtual ErrorManagement::ErrorType Reload(StreamI &configuration);
+
 protected:
     /**
      * @brief The loader parameters.
@@ -103,6 +137,16 @@ private:
      */
     StreamString messageFunction;
 
+    /**
+     * @brief The streams of the configuration fragments.
+     */
+    StreamI * const *fragments;
+
+    /**
+     * @brief The number of configuration fragments.
+     */
+    uint32 numberOfFragments;
+
 };
 
 }
@@ -0,0 +1,290 @@
+/**
+ * @file ParallelObjectBuilder.cpp
+ * @brief Source file for class ParallelObjectBuilder
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ParallelObjectBuilder (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "ParallelObjectBuilder.h"
+#include "Sleep.h"
+#include "StreamString.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The task states.
+ */
+static const uint8 PARALLEL_OBJECT_BUILDER_PENDING = 0u;
+static const uint8 PARALLEL_OBJECT_BUILDER_RUNNING = 1u;
+static const uint8 PARALLEL_OBJECT_BUILDER_BUILT = 2u;
+static const uint8 PARALLEL_OBJECT_BUILDER_INSERTED = 3u;
+
+/**
+ * Time that an idle thread waits before looking again for a ready task.
+ */
+static const uint32 PARALLEL_OBJECT_BUILDER_POLL_MSEC = 1u;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ParallelObjectBuilder::ParallelObjectBuilder() {
+    tasks = NULL_PTR(ParallelObjectBuilderTask *);
+    numberOfTasks = 0u;
+    numberOfInserted = 0u;
+    failed = false;
+    destination = NULL_PTR(ReferenceContainer *);
+    mux.Create();
+}
+
+ParallelObjectBuilder::~ParallelObjectBuilder() {
+    if (tasks != NULL_PTR(ParallelObjectBuilderTask *)) {
+        uint32 i;
+        for (i = 0u; i < numberOfTasks; i++) {
+            if (tasks[i].dependencies != NULL_PTR(uint32 *)) {
+                delete[] tasks[i].dependencies;
+            }
+        }
+        delete[] tasks;
+    }
+}
+
+bool ParallelObjectBuilder::Build(ConfigurationDatabase &data,
+                                  ReferenceContainer &destinationIn,
+                                  const uint32 numberOfThreads) {
+    destination = &destinationIn;
+    bool ok = Prepare(data);
+    if (ok) {
+        uint32 numberOfParallel = 0u;
+        uint32 i;
+        for (i = 0u; i < numberOfTasks; i++) {
+            if (tasks[i].parallel) {
+                numberOfParallel++;
+            }
+        }
+        if ((numberOfThreads > 1u) && (numberOfParallel > 1u)) {
+            uint32 threads = (numberOfThreads < numberOfParallel) ? (numberOfThreads) : (numberOfParallel);
+            if (!RunWorkers(threads)) {
+                REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not start the initialisation threads. The objects were built sequentially");
+            }
+        }
+        else {
+            Work();
+        }
+        ok = (!failed);
+    }
+    return ok;
+}
+
+bool ParallelObjectBuilder::Prepare(ConfigurationDatabase &data) {
+    uint32 numberOfChildren = data.GetNumberOfChildren();
+    uint32 i;
+    for (i = 0u; i < numberOfChildren; i++) {
+        const char8 *childName = data.GetChildName(i);
+        if (childName != NULL_PTR(const char8 *)) {
+            if ((ReferenceContainer::IsBuildToken(childName[0])) || (ReferenceContainer::IsDomainToken(childName[0]))) {
+                numberOfTasks++;
+            }
+        }
+    }
+    bool ok = true;
+    if (numberOfTasks > 0u) {
+        tasks = new ParallelObjectBuilderTask[numberOfTasks];
+        for (i = 0u; i < numberOfTasks; i++) {
+            tasks[i].nodeName = NULL_PTR(const char8 *);
+            tasks[i].dependencies = NULL_PTR(uint32 *);
+            tasks[i].numberOfDependencies = 0u;
+            tasks[i].barrier = 0u;
+            tasks[i].parallel = false;
+            tasks[i].state = PARALLEL_OBJECT_BUILDER_PENDING;
+        }
+    }
+    uint32 t = 0u;
+    uint32 barrier = 0u;
+    for (i = 0u; (i < numberOfChildren) && (ok); i++) {
+        const char8 *childName = data.GetChildName(i);
+        bool isObject = (childName != NULL_PTR(const char8 *));
+        if (isObject) {
+            isObject = ((ReferenceContainer::IsBuildToken(childName[0])) || (ReferenceContainer::IsDomainToken(childName[0])));
+        }
+        if (isObject) {
+            ParallelObjectBuilderTask &task = tasks[t];
+            task.nodeName = childName;
+            task.data = data;
+            ok = task.data.MoveRelative(childName);
+            uint32 parallel = 0u;
+            if (ok) {
+                if (!task.data.Read("ParallelInitialise", parallel)) {
+                    parallel = 0u;
+                }
+            }
+            task.parallel = (parallel == 1u);
+            task.barrier = barrier;
+            if (!task.parallel) {
+                barrier = t + 1u;
+            }
+            AnyType after;
+            if (ok) {
+                after = task.data.GetType("InitialiseAfter");
+            }
+            if ((ok) && (!after.IsVoid())) {
+                uint32 numberOfNames = (after.GetNumberOfDimensions() == 0u) ? (1u) : (after.GetNumberOfElements(0u));
+                Vector<StreamString> names(numberOfNames);
+                if (after.GetNumberOfDimensions() == 0u) {
+                    ok = task.data.Read("InitialiseAfter", names[0u]);
+                }
+                else {
+                    ok = task.data.Read("InitialiseAfter", names);
+                }
+                if (ok) {
+                    task.dependencies = new uint32[numberOfNames];
+                }
+                uint32 n;
+                for (n = 0u; (n < numberOfNames) && (ok); n++) {
+                    //Only the objects declared before can be waited for, so that the dependencies never form a cycle
+                    ok = false;
+                    uint32 d;
+                    for (d = 0u; (d < t) && (!ok); d++) {
+                        ok = (names[n] == &(tasks[d].nodeName[1]));
+                        if (ok) {
+                            task.dependencies[task.numberOfDependencies] = d;
+                            task.numberOfDependencies++;
+                        }
+                    }
+                    if (!ok) {
+                        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "%s: InitialiseAfter %s is not an object declared before", childName,
+                                            names[n].Buffer());
+                    }
+                }
+            }
+            t++;
+        }
+    }
+    return ok;
+}
+
+bool ParallelObjectBuilder::IsReady(const uint32 taskIdx) const {
+    const ParallelObjectBuilderTask &task = tasks[taskIdx];
+    bool ready;
+    if (task.parallel) {
+        ready = (numberOfInserted >= task.barrier);
+        uint32 d;
+        for (d = 0u; (d < task.numberOfDependencies) && (ready); d++) {
+            ready = (tasks[task.dependencies[d]].state == PARALLEL_OBJECT_BUILDER_INSERTED);
+        }
+    }
+    else {
+        ready = (numberOfInserted == taskIdx);
+    }
+    return ready;
+}
+
+void ParallelObjectBuilder::Commit() {
+    bool ok = true;
+    while ((ok) && (numberOfInserted < numberOfTasks)) {
+        ParallelObjectBuilderTask &task = tasks[numberOfInserted];
+        ok = (task.state == PARALLEL_OBJECT_BUILDER_BUILT);
+        if (ok) {
+            if (ReferenceContainer::IsDomainToken(task.nodeName[0])) {
+                task.object->SetDomain(true);
+            }
+            if (destination->Insert(task.object)) {
+                task.state = PARALLEL_OBJECT_BUILDER_INSERTED;
+                task.object = Reference();
+                numberOfInserted++;
+            }
+            else {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to insert the object with name %s", task.nodeName);
+                failed = true;
+                ok = false;
+            }
+        }
+    }
+}
+
+void ParallelObjectBuilder::Work() {
+    bool done = false;
+    while (!done) {
+        uint32 taskIdx = numberOfTasks;
+        if (mux.FastLock() != ErrorManagement::NoError) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "ParallelObjectBuilder: Failed FastLock()");
+        }
+        done = ((failed) || (numberOfInserted == numberOfTasks));
+        uint32 i;
+        for (i = numberOfInserted; (i < numberOfTasks) && (!done) && (taskIdx == numberOfTasks); i++) {
+            if (tasks[i].state == PARALLEL_OBJECT_BUILDER_PENDING) {
+                if (IsReady(i)) {
+                    tasks[i].state = PARALLEL_OBJECT_BUILDER_RUNNING;
+                    taskIdx = i;
+                }
+            }
+        }
+        mux.FastUnLock();
+        if (taskIdx < numberOfTasks) {
+            ParallelObjectBuilderTask &task = tasks[taskIdx];
+            Reference newObject;
+            bool ok = newObject.Initialise(task.data, false);
+            if (ok) {
+                ok = newObject.IsValid();
+            }
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to Initialise object with name %s", task.nodeName);
+            }
+            if (mux.FastLock() != ErrorManagement::NoError) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "ParallelObjectBuilder: Failed FastLock()");
+            }
+            if (ok) {
+                task.object = newObject;
+                task.state = PARALLEL_OBJECT_BUILDER_BUILT;
+                Commit();
+            }
+            else {
+                failed = true;
+            }
+            mux.FastUnLock();
+        }
+        else if (!done) {
+            //Waiting for the objects being built by the other threads
+            Sleep::MSec(PARALLEL_OBJECT_BUILDER_POLL_MSEC);
+        }
+        else {
+            //All the objects were inserted or one failed
+        }
+    }
+}
+
+}
@@ -0,0 +1,222 @@
+/**
+ * @file ParallelObjectBuilder.h
+ * @brief Header file for class ParallelObjectBuilder
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ParallelObjectBuilder
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef L6APP_PARALLELOBJECTBUILDER_H_
+#define L6APP_PARALLELOBJECTBUILDER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "ConfigurationDatabase.h"
+#include "FastPollingMutexSem.h"
+#include "ReferenceContainer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A top-level object to be built by the ParallelObjectBuilder.
+ */
+struct ParallelObjectBuilderTask {
+    /**
+     * Cursor on the node of the object (independent of the cursors of the other tasks).
+     */
+    ConfigurationDatabase data;
+
+    /**
+     * The name of the node (with the build or domain token).
+     */
+    const char8 *nodeName;
+
+    /**
+     * The object once built.
+     */
+    Reference object;
+
+    /**
+     * Indexes of the tasks listed in InitialiseAfter.
+     */
+    uint32 *dependencies;
+
+    /**
+     * Number of elements of dependencies.
+     */
+    uint32 numberOfDependencies;
+
+    /**
+     * Index + 1 of the last task before this one without ParallelInitialise, 0 if none.
+     */
+    uint32 barrier;
+
+    /**
+     * True if ParallelInitialise = 1.
+     */
+    bool parallel;
+
+    /**
+     * One of the ParallelObjectBuilder task states.
+     */
+    uint8 state;
+};
+
+/**
+ * @brief Builds and initialises the top-level objects of a configuration on a bounded number of threads (see Loader).
+ * @details Equivalent to ReferenceContainer::Initialise but, instead of building the objects one after the other, the objects
+ * which declare ParallelInitialise = 1 are built concurrently (by up to numberOfThreads threads, the caller being one of them):
+ * <pre>
+ * +Camera = {
+ *     Class = ...
+ *     ParallelInitialise = 1 //Optional. Default is 0.
+ * }
+ * +Calibration = {
+ *     Class = ...
+ *     ParallelInitialise = 1
+ *     InitialiseAfter = { Camera } //Optional. Names of the top-level objects (declared before) that shall be initialised first.
+ * }
+ * </pre>
+ * An object without ParallelInitialise = 1 keeps the sequential semantics: it is built after all the objects declared before it and the
+ * objects declared after it are only built afterwards. An object with ParallelInitialise = 1 is built after the objects without
+ * ParallelInitialise declared before it and after the objects listed in its InitialiseAfter.
+ *
+ * The objects are inserted in the destination container in the order of the configuration (an object is only inserted once all the objects
+ * declared before it were inserted) so that the resulting tree is the same as with ReferenceContainer::Initialise, and an object
+ * can only be found (e.g. with ObjectRegistryDatabase::Find) by the objects which are initialised after it.
+ *
+ * The objects with ParallelInitialise = 1 shall be safe to build concurrently with each other (i.e. they shall not look for the objects
+ * which are not in their InitialiseAfter nor share unprotected global state).
+ */
+class DLL_API ParallelObjectBuilder {
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    ParallelObjectBuilder();
+
+    /**
+     * @brief Destructor. Frees the tasks.
+     */
+    ~ParallelObjectBuilder();
+
+    /**
+     * @brief Builds the objects (see class description) of the current node of \a data and inserts them in \a destination.
+     * @param[in] data the configuration. Each task moves on its own copy of \a data, whose current node is not changed.
+     * @param[in] destination where to insert the objects.
+     * @param[in] numberOfThreads the maximum number of objects built at the same time.
+     * @return true if all the objects were built and inserted. The building stops at the first failure (the objects already built
+     * are kept in \a destination as with ReferenceContainer::Initialise).
+     */
+    bool Build(ConfigurationDatabase &data,
+               ReferenceContainer &destination,
+               const uint32 numberOfThreads);
+
+    /**
+     * @brief Builds the tasks which are ready, until all the tasks are inserted or one fails.
+     * @details Executed by the caller of Build and by each of the worker threads.
+     */
+    void Work();
+
+private:
+
+    /**
+     * @brief Creates one task for each object of the current node of \a data and resolves the InitialiseAfter names.
+     * @return false if an InitialiseAfter name is not an object declared before.
+     */
+    bool Prepare(ConfigurationDatabase &data);
+
+    /**
+     * @brief Checks if all the tasks that \a taskIdx waits for were inserted.
+     * @pre mux is locked.
+     */
+    bool IsReady(const uint32 taskIdx) const;
+
+    /**
+     * @brief Inserts in the destination all the built tasks that follow the inserted ones.
+     * @pre mux is locked.
+     */
+    void Commit();
+
+    /**
+     * @brief Starts numberOfThreads - 1 threads executing Work, calls Work and waits for the threads to terminate.
+     * @details The implementation is environment specific.
+     * @return false if no thread could be started (Work was then only executed by the caller).
+     */
+    bool RunWorkers(const uint32 numberOfThreads);
+
+    /**
+     * The objects to be built.
+     */
+    ParallelObjectBuilderTask *tasks;
+
+    /**
+     * Number of elements of tasks.
+     */
+    uint32 numberOfTasks;
+
+    /**
+     * Number of tasks inserted in the destination.
+     */
+    uint32 numberOfInserted;
+
+    /**
+     * Set by the first task that fails.
+     */
+    bool failed;
+
+    /**
+     * Where to insert the objects.
+     */
+    ReferenceContainer *destination;
+
+    /**
+     * Protects the tasks states.
+     */
+    FastPollingMutexSem mux;
+
+    /*lint -e{1704} non copyable*/
+    /**
+     * @brief Disallow the copy constructor.
+     */
+    ParallelObjectBuilder(const ParallelObjectBuilder &);
+
+    /**
+     * @brief Disallow the copy operator.
+     */
+    ParallelObjectBuilder &operator=(const ParallelObjectBuilder &);
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* L6APP_PARALLELOBJECTBUILDER_H_ */
@@ -31,6 +31,11 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "ConfigurationDatabase.h"
+#include "ConfigurationDatabaseImage.h"
+#include "GAM.h"
+#include "PinnedMemory.h"
+#include "PowerManagement.h"
+#include "ProcessorType.h"
 #include "RealTimeLoader.h"
 #include "MessageI.h"
 #include "ObjectRegistryDatabase.h"
@@ -39,6 +44,145 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+/**
+ * @brief Checks if the leaf \a name has the same value in the current node of both configurations.
+ */
+static bool RealTimeLoaderSameLeaf(ConfigurationDatabase &running,
+                                   ConfigurationDatabase &reloaded,
+                                   const char8 * const name) {
+    AnyType runningValue = running.GetType(name);
+    AnyType reloadedValue = reloaded.GetType(name);
+    bool same = (!reloadedValue.IsVoid());
+    if (same) {
+        same = (runningValue.GetTypeDescriptor() == reloadedValue.GetTypeDescriptor());
+    }
+    StreamString runningString;
+    StreamString reloadedString;
+    if (same) {
+        same = (runningString.Printf("%!", runningValue)) && (reloadedString.Printf("%!", reloadedValue));
+    }
+    if (same) {
+        same = (runningString == reloadedString);
+    }
+    return same;
+}
+
+/**
+ * @brief Checks if the current nodes of both configurations have the same children, in the same order, with the same values.
+ */
+static bool RealTimeLoaderSameNode(ConfigurationDatabase &running,
+                                   ConfigurationDatabase &reloaded) {
+    uint32 numberOfChildren = running.GetNumberOfChildren();
+    bool same = (reloaded.GetNumberOfChildren() == numberOfChildren);
+    for (uint32 i = 0u; (i < numberOfChildren) && (same); i++) {
+        const char8 * const name = running.GetChildName(i);
+        same = (StringHelper::Compare(name, reloaded.GetChildName(i)) == 0);
+        if (same) {
+            if (running.GetType(name).IsVoid()) {
+                same = (running.MoveRelative(name)) && (reloaded.MoveRelative(name));
+                if (same) {
+                    same = RealTimeLoaderSameNode(running, reloaded);
+                    same = (running.MoveToAncestor(1u)) && (reloaded.MoveToAncestor(1u)) && (same);
+                }
+            }
+            else {
+                same = RealTimeLoaderSameLeaf(running, reloaded, name);
+            }
+        }
+    }
+    return same;
+}
+
+/**
+ * @brief Compares the current object nodes of both configurations and prepares the new parameters of the GAMs that changed.
+ * @param[in] path the ObjectRegistryDatabase path of the object of the nodes (empty at the root).
+ * @param[out] changed where the GAMs with prepared parameters are inserted.
+ * @return false if the configurations differ in anything else than the parameters of the GAMs or if a GAM did not accept its new parameters.
+ */
+static bool RealTimeLoaderPrepare(ConfigurationDatabase &running,
+                                  ConfigurationDatabase &reloaded,
+                                  StreamString path,
+                                  ReferenceContainer &changed) {
+    ReferenceT<GAM> gam;
+    if (path.Size() > 0u) {
+        gam = ObjectRegistryDatabase::Instance()->Find(path.Buffer());
+    }
+    bool parametersChanged = false;
+    uint32 numberOfChildren = running.GetNumberOfChildren();
+    bool ok = (reloaded.GetNumberOfChildren() == numberOfChildren);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::UnsupportedFeature, "Objects or parameters were added or removed in %s", path.Buffer());
+    }
+    for (uint32 i = 0u; (i < numberOfChildren) && (ok); i++) {
+        const char8 * const name = running.GetChildName(i);
+        ok = (StringHelper::Compare(name, reloaded.GetChildName(i)) == 0);
+        bool same = ok;
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::UnsupportedFeature, "%s was replaced by %s in %s", name, reloaded.GetChildName(i), path.Buffer());
+        }
+        else if (!running.GetType(name).IsVoid()) {
+            same = RealTimeLoaderSameLeaf(running, reloaded, name);
+        }
+        else {
+            ok = (running.MoveRelative(name)) && (reloaded.MoveRelative(name));
+            if (ok) {
+                if ((ReferenceContainer::IsBuildToken(name[0])) || (ReferenceContainer::IsDomainToken(name[0]))) {
+                    StreamString childPath = path;
+                    if (childPath.Size() > 0u) {
+                        ok = childPath.Printf("%s", ".");
+                    }
+                    if (ok) {
+                        ok = childPath.Printf("%s", &name[1]);
+                    }
+                    if (ok) {
+                        ok = RealTimeLoaderPrepare(running, reloaded, childPath, changed);
+                    }
+                }
+                else {
+                    same = RealTimeLoaderSameNode(running, reloaded);
+                }
+                ok = (running.MoveToAncestor(1u)) && (reloaded.MoveToAncestor(1u)) && (ok);
+            }
+        }
+        if ((ok) && (!same)) {
+            //Only the parameters of a GAM can change, the signals would require the memory and the brokers to be rebuilt
+            ok = (gam.IsValid());
+            if (ok) {
+                ok = (StringHelper::Compare(name, "Class") != 0) && (StringHelper::Compare(name, "InputSignals") != 0)
+                        && (StringHelper::Compare(name, "OutputSignals") != 0);
+            }
+            if (ok) {
+                parametersChanged = true;
+            }
+            else {
+                REPORT_ERROR_STATIC(ErrorManagement::UnsupportedFeature, "%s changed in %s", name, path.Buffer());
+            }
+        }
+    }
+    if ((ok) && (parametersChanged)) {
+        ok = !gam->IsCommitPending();
+        if (ok) {
+            //Independent cursor on the same node
+            ConfigurationDatabase gamData = reloaded;
+            ok = gam->PrepareParameters(gamData);
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::UnsupportedFeature, "The parameters previously reloaded were not yet used by %s", path.Buffer());
+        }
+        if (ok) {
+            ok = changed.Insert(gam);
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::UnsupportedFeature, "%s did not accept the reloaded parameters", path.Buffer());
+        }
+    }
+    return ok;
+}
+
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -46,14 +190,83 @@ namespace MARTe {
 
 RealTimeLoader::RealTimeLoader() :
         Loader() {
+    warmUpCycles = 0u;
+    wakeUpLatencySet = false;
+    cpuFrequencySet = false;
 }
 
 RealTimeLoader::~RealTimeLoader() {
+    if (cpuFrequencySet) {
+        (void) PowerManagement::RestoreCPUFrequencies();
+    }
+    if (wakeUpLatencySet) {
+        PowerManagement::ReleaseWakeUpLatency();
+    }
+}
 
+void RealTimeLoader::ConfigurePowerManagement(StructuredDataI &data) {
+    uint32 wakeUpLatency = 0u;
+    if (data.Read("WakeUpLatency", wakeUpLatency)) {
+        wakeUpLatencySet = PowerManagement::SetWakeUpLatency(wakeUpLatency);
+        if (wakeUpLatencySet) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "The wake-up latency of the CPUs is limited to %u us", wakeUpLatency);
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not limit the wake-up latency of the CPUs to %u us", wakeUpLatency);
+        }
+    }
+    StreamString realTimeCPUsString;
+    if (data.Read("RealTimeCPUs", realTimeCPUsString)) {
+        StreamString governor;
+        if (!data.Read("CPUGovernor", governor)) {
+            governor = "";
+        }
+        uint32 minFrequency = 0u;
+        if (!data.Read("CPUMinFrequency", minFrequency)) {
+            minFrequency = 0u;
+        }
+        ProcessorType realTimeCPUs(0u);
+        bool ok = realTimeCPUs.SetFromString(realTimeCPUsString.Buffer());
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Invalid RealTimeCPUs %s", realTimeCPUsString.Buffer());
+        }
+        uint32 numberOfCPUs = realTimeCPUs.GetCPUsNumber();
+        for (uint32 cpu = 0u; (cpu < numberOfCPUs) && (ok); cpu++) {
+            //CPUEnabled numbers the CPUs from 1
+            if (realTimeCPUs.CPUEnabled(cpu + 1u)) {
+                ok = PowerManagement::SetCPUFrequency(cpu, governor.Buffer(), minFrequency);
+                cpuFrequencySet = true;
+                if (!ok) {
+                    REPORT_ERROR_STATIC(ErrorManagement::Warning, "Could not set the frequency scaling of CPU %u", cpu);
+                }
+            }
+        }
+        if ((ok) && (cpuFrequencySet)) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "The frequency scaling of the CPUs %s is set", realTimeCPUsString.Buffer());
+        }
+    }
 }
 
 ErrorManagement::ErrorType RealTimeLoader::Configure(StructuredDataI& data, StreamI &configuration) {
-    ErrorManagement::ErrorType ret = Loader::Configure(data, configuration);
+    uint32 lockAllMemory = 0u;
+    if (!data.Read("LockAllMemory", lockAllMemory)) {
+        lockAllMemory = 0u;
+    }
+    if (!data.Read("Parser", parserType)) {
+        parserType = "";
+    }
+    ErrorManagement::ErrorType ret;
+    ConfigurePowerManagement(data);
+    if (lockAllMemory == 1u) {
+        //Before any real-time object (and thread stack) is allocated
+        ret.initialisationError = !PinnedMemory::LockAll();
+        if (ret.ErrorsCleared()) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "All the process memory is locked");
+        }
+    }
+    if (ret.ErrorsCleared()) {
+        ret = Loader::Configure(data, configuration);
+    }
 
     ObjectRegistryDatabase *objDb = ObjectRegistryDatabase::Instance();
     uint32 nOfObjs = objDb->Size();
@@ -75,6 +288,9 @@ ErrorManagement::ErrorType RealTimeLoader::Configure(StructuredDataI& data, Stre
     if (found > 0u) {
         if (data.Read("FirstState", firstState)) {
         }
+        if (!data.Read("WarmUpCycles", warmUpCycles)) {
+            warmUpCycles = 0u;
+        }
     }
     else {
         REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Could not find a RealTimeApplication");
@@ -95,6 +311,16 @@ ErrorManagement::ErrorType RealTimeLoader::Start() {
             StreamString destination;
             char8 term;
             err.fatalError = !firstState.GetToken(destination, ":", term);
+            if ((err.ErrorsCleared()) && (warmUpCycles > 0u)) {
+                //Before PrepareNextState, which resets the StatefulI GAMs
+                err.fatalError = !rtApp->WarmUp(destination.Buffer(), warmUpCycles);
+                if (err.ErrorsCleared()) {
+                    REPORT_ERROR_STATIC(ErrorManagement::Information, "Executed %u warm-up cycles of state %s ", warmUpCycles, destination.Buffer());
+                }
+                else {
+                    REPORT_ERROR_STATIC(err, "Failed to warm up state %s ", destination.Buffer());
+                }
+            }
             if (err.ErrorsCleared()) {
                 REPORT_ERROR_STATIC(ErrorManagement::Information, "Preparing state %s ", destination.Buffer());
                 err.initialisationError = !rtApp->PrepareNextState(destination.Buffer());
@@ -143,6 +369,42 @@ ErrorManagement::ErrorType RealTimeLoader::Stop() {
     return ret;
 }
 
+ErrorManagement::ErrorType RealTimeLoader::Reload(StreamI &configuration) {
+    //The shadow configuration is parsed and compared by the calling (non real-time) thread
+    ConfigurationDatabase reloaded;
+    ErrorManagement::ErrorType ret;
+    ret.initialisationError = !configuration.Seek(0LLU);
+    if (ret.ErrorsCleared()) {
+        if (ConfigurationDatabaseImage::IsImage(configuration)) {
+            ret.initialisationError = !ConfigurationDatabaseImage::Read(configuration, reloaded);
+        }
+        else {
+            ret = ParseConfiguration(parserType.Buffer(), configuration, reloaded);
+        }
+    }
+    if (ret.ErrorsCleared()) {
+        ret.fatalError = !(parsedConfiguration.MoveToRoot()) || !(reloaded.MoveToRoot());
+    }
+    ReferenceContainer changed;
+    if (ret.ErrorsCleared()) {
+        ret.unsupportedFeature = !RealTimeLoaderPrepare(parsedConfiguration, reloaded, "", changed);
+        if (!ret) {
+            REPORT_ERROR_STATIC(ret, "The configuration cannot be reloaded without stopping the application");
+        }
+    }
+    if (ret.ErrorsCleared()) {
+        //Only a flag per GAM: each GAM swaps to the new parameters at the beginning of its next cycle
+        uint32 numberOfChanged = changed.Size();
+        for (uint32 i = 0u; i < numberOfChanged; i++) {
+            ReferenceT<GAM> gam = changed.Get(i);
+            gam->CommitParameters();
+        }
+        parsedConfiguration = reloaded;
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Reloaded the parameters of %u GAMs", numberOfChanged);
+    }
+    return ret;
+}
+
 CLASS_REGISTER(RealTimeLoader, "")
 
 }
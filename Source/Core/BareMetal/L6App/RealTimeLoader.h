@@ -58,7 +58,7 @@ public:
     RealTimeLoader();
 
     /**
-     * @brief Destructor. NOOP.
+     * @brief Destructor. Restores the power management settings changed by Configure.
      */
     virtual ~RealTimeLoader();
 
@@ -67,6 +67,13 @@ public:
      * @details If Loader::Initialise succeeds, a RealTimeApplication is search in the ObjectRegistryDatabase and, if found, the RealTimeApplication::ConfigureApplication is called.
      * @param[in] data see Loader::Initialise for other parameters:
      * - FirstState (optional): the first state to be called in the RealTimeApplication when Start is called.
+     * - LockAllMemory (optional): if 1 all the current and future memory pages of the process are locked before parsing the configuration (see PinnedMemory::LockAll).
+     * - WarmUpCycles (optional): number of dry cycles of the FirstState to be executed by Start before the state is prepared (see RealTimeApplication::WarmUp). Default is 0.
+     * - WakeUpLatency (optional): the maximum wake-up latency of the CPUs in microseconds, held until the loader is destroyed (see PowerManagement::SetWakeUpLatency).
+     * - RealTimeCPUs (optional): the CPUs of the real-time threads (see ProcessorType::SetFromString), whose frequency scaling is set, until the loader is destroyed, with:
+     *   - CPUGovernor (optional): the cpufreq governor of the RealTimeCPUs (e.g. performance);
+     *   - CPUMinFrequency (optional): the minimum frequency of the RealTimeCPUs in kHz (see PowerManagement::SetCPUFrequency).
+     * A failure to set the power management options is only reported as a warning.
      * @param[in] configuration see Loader::Initialise.
      * @return ErrorManagement::NoError if the Parser is specified, the \a configuration can be parsed, the ObjectRegistryDatabase can be Initialised with the parsed configuration and if the RealTimeApplication::ConfigureApplication is successful. An error is returned otherwise.
      */
@@ -75,6 +82,9 @@ public:
     /**
      * @brief Start the RealTimeApplication.
      * @details If FirstState was set, calls RealTimeApplication::StartNextStateExecution with this state. Otherwise Loader::Start is called.
+     * If WarmUpCycles was set, RealTimeApplication::WarmUp is called with the FirstState before RealTimeApplication::PrepareNextState, so that
+     * the first real-time cycles do not take the page faults and the cache misses of the first execution of the GAMs (the stacks are prefaulted
+     * with the RealTimeThread PrefaultStackSize and the signal memory is written, and thus paged in, when it is allocated).
      * @return ErrorManagement::NoError if the FirstState was set and RealTimeApplication::StartNextStateExecution or if FirstState was not set and Loader::Start succeeds. An error is returned otherwise.
      */
     virtual ErrorManagement::ErrorType Start();
@@ -86,12 +96,53 @@ public:
      */
     virtual ErrorManagement::ErrorType Stop();
 
+    /**
+     * @brief Applies a new configuration to the running RealTimeApplication components, without stopping them.
+     * @details The \a configuration is parsed (with the Parser given to Configure) into a shadow database, which is compared with the
+     * running configuration. The only differences that can be applied are the parameters of the GAMs (i.e. anything in the node of a GAM
+     * but its Class, InputSignals and OutputSignals). Any other difference (e.g. a new object, a new state or a new signal) requires
+     * the application to be stopped and configured again and nothing is changed.
+     *
+     * The new parameters are given to each changed GAM with GAM::PrepareParameters, while the application keeps running, and only if all the
+     * GAMs accept them GAM::CommitParameters is called on all of them, so that each GAM swaps to the new parameters at the beginning of its
+     * next cycle. The new configuration then becomes the running one.
+     * @param[in] configuration the new configuration stream.
+     * @return ErrorManagement::NoError if the new configuration was applied. ErrorManagement::UnsupportedFeature if it differs in
+     * more than the GAM parameters or if a changed GAM cannot reload its parameters. Other errors if it cannot be parsed.
+     */
+    virtual ErrorManagement::ErrorType Reload(StreamI &configuration);
+
 private:
+    /**
+     * @brief Applies the WakeUpLatency and the RealTimeCPUs frequency scaling (see Configure).
+     */
+    void ConfigurePowerManagement(StructuredDataI &data);
+
     /**
      * @brief The (optional) first state of the RealTimeApplication.
      */
     StreamString firstState;
 
+    /**
+     * @brief The type of parser of the configuration (to parse the reloaded configurations).
+     */
+    StreamString parserType;
+
+    /**
+     * @brief The number of dry cycles of the first state.
+     */
+    uint32 warmUpCycles;
+
+    /**
+     * @brief True if the wake-up latency limit was set.
+     */
+    bool wakeUpLatencySet;
+
+    /**
+     * @brief True if the frequency scaling of the RealTimeCPUs was changed.
+     */
+    bool cpuFrequencySet;
+
     /**
      * @brief The RealTimeApplication.
      */
@@ -0,0 +1,253 @@
+/**
+ * @file AsyncFileIO.h
+ * @brief Header file for class AsyncFileIO
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class AsyncFileIO
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef ASYNCFILEIO_H_
+#define ASYNCFILEIO_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "TimeoutType.h"
+#include "BasicFile.h"
+
+#include INCLUDE_FILE_ENVIRONMENT(FileSystem,L1Portability,ENVIRONMENT,AsyncFileIOProperties.h)
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief Result of an asynchronous operation, as reported by AsyncFileIO::WaitCompletions.
+     */
+    struct AsyncFileIOCompletion {
+        /**
+         * The userData of the operation.
+         */
+        void *userData;
+
+        /**
+         * The number of bytes transferred or, if negative, the operating system error code (e.g. -EIO).
+         */
+        int32 result;
+    };
+
+    /**
+     * @brief Queue of asynchronous read, write and flush operations on BasicFile objects.
+     * @details The operations are queued with PrepareRead, PrepareWrite and PrepareFlush, sent to the
+     * operating system with Submit and their results collected with WaitCompletions. Many operations
+     * (up to the queue depth) can be in flight at the same time, which allows a single thread to keep
+     * a fast storage device busy without blocking on each write.
+     *
+     * The operations are positional (the file position is neither used nor changed) and the buffers
+     * shall not be modified (or released) until the operation is reported as completed.
+     *
+     * Buffers which are reused for the whole lifetime of the queue can be registered with RegisterBuffers
+     * and then referred by their index, so that the operating system does not have to map them for
+     * every operation.
+     *
+     * On Linux the operations are executed by io_uring. If io_uring is not available (kernel < 5.6 or
+     * disabled by the system administrator) the operations are executed synchronously by the Prepare
+     * methods and only their completion is deferred, so that the same code works everywhere
+     * (see IsAsynchronous).
+     *
+     * The class is not thread safe: the operations shall be prepared, submitted and completed by the same thread.
+     */
+    class DLL_API AsyncFileIO {
+
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param[in] queueDepth the maximum number of operations which can be prepared or in flight at the same time.
+         * @post
+         *   IsValid() if the operating system resources were successfully allocated.
+         */
+        AsyncFileIO(const uint32 queueDepth = 64u);
+
+        /**
+         * @brief Destructor. Waits for the operations in flight and releases the operating system resources.
+         * The files are not closed.
+         */
+        virtual ~AsyncFileIO();
+
+        /**
+         * @brief Checks if the resources were successfully allocated.
+         * @return true if the AsyncFileIO can be used.
+         */
+        bool IsValid() const;
+
+        /**
+         * @brief Checks if the operations are executed asynchronously by the operating system.
+         * @return false if the synchronous fallback is being used.
+         */
+        bool IsAsynchronous() const;
+
+        /**
+         * @brief Registers the buffers to be used by the operations with a bufferIndex.
+         * @param[in] buffers the array of buffers.
+         * @param[in] sizes the size of each buffer.
+         * @param[in] numberOfBuffers the number of elements in \a buffers and \a sizes.
+         * @pre
+         *   GetNumberOfPendingOperations() == 0 &&
+         *   No buffers are registered.
+         * @return true if the buffers were registered (they are kept mapped until UnregisterBuffers or the destructor).
+         */
+        bool RegisterBuffers(char8 * const * const buffers,
+                             const uint32 * const sizes,
+                             const uint32 numberOfBuffers);
+
+        /**
+         * @brief Unregisters the buffers registered with RegisterBuffers.
+         * @pre
+         *   GetNumberOfPendingOperations() == 0
+         * @return true if the buffers were unregistered.
+         */
+        bool UnregisterBuffers();
+
+        /**
+         * @brief Queues the read of \a size bytes at \a offset of \a file into \a buffer.
+         * @param[in] file the file, which shall be open for reading.
+         * @param[in] offset the position in the file.
+         * @param[out] buffer the destination buffer.
+         * @param[in] size the number of bytes to read.
+         * @param[in] userData the pointer to be reported with the completion.
+         * @param[in] bufferIndex the index of the registered buffer containing \a buffer or -1 if not registered.
+         * @return false if the queue is full (GetNumberOfPendingOperations() == queueDepth) or in case of errors.
+         */
+        bool PrepareRead(const BasicFile &file,
+                         const uint64 offset,
+                         char8 * const buffer,
+                         const uint32 size,
+                         void * const userData,
+                         const int32 bufferIndex = -1);
+
+        /**
+         * @brief Queues the write of \a size bytes from \a buffer at \a offset of \a file.
+         * @param[in] file the file, which shall be open for writing.
+         * @param[in] offset the position in the file.
+         * @param[in] buffer the source buffer.
+         * @param[in] size the number of bytes to write.
+         * @param[in] userData the pointer to be reported with the completion.
+         * @param[in] bufferIndex the index of the registered buffer containing \a buffer or -1 if not registered.
+         * @return false if the queue is full (GetNumberOfPendingOperations() == queueDepth) or in case of errors.
+         */
+        bool PrepareWrite(const BasicFile &file,
+                          const uint64 offset,
+                          const char8 * const buffer,
+                          const uint32 size,
+                          void * const userData,
+                          const int32 bufferIndex = -1);
+
+        /**
+         * @brief Queues the flush of the data of \a file to the storage device (fdatasync).
+         * @details The flush is not ordered with respect to the other operations in flight: to make sure
+         * that some writes are flushed it shall be prepared after their completion.
+         * @param[in] file the file.
+         * @param[in] userData the pointer to be reported with the completion.
+         * @return false if the queue is full or in case of errors.
+         */
+        bool PrepareFlush(const BasicFile &file,
+                          void * const userData);
+
+        /**
+         * @brief Sends the prepared operations to the operating system.
+         * @return the number of submitted operations or -1 in case of errors.
+         */
+        int32 Submit();
+
+        /**
+         * @brief Submits the prepared operations and waits until at least \a minCompletions operations are completed.
+         * @param[in] minCompletions the number of completions to wait for (0 to collect the completed ones without blocking).
+         * @param[in] timeout the maximum time to wait.
+         * @return -1 in case of errors, otherwise the number of completions collected (which can be less than
+         * \a minCompletions if the timeout expired). These can be queried with GetCompletion.
+         */
+        int32 WaitCompletions(const uint32 minCompletions,
+                              const TimeoutType &timeout = TTInfiniteWait);
+
+        /**
+         * @brief Gets a completion collected by the last WaitCompletions.
+         * @param[in] index the completion index (< the value returned by WaitCompletions).
+         * @return the completion or a completion with NULL userData and result -1 if the index is invalid.
+         */
+        AsyncFileIOCompletion GetCompletion(const uint32 index) const;
+
+        /**
+         * @brief Gets the number of operations which were prepared and are not completed yet.
+         * @return the number of operations prepared, in flight or completed but not collected by WaitCompletions.
+         */
+        uint32 GetNumberOfPendingOperations() const;
+
+    private:
+
+        /**
+         * @brief Reserves the next operation slot.
+         * @return false if the queue is full.
+         */
+        bool ReserveOperation();
+
+        /**
+         * @brief Collects the completions reported by the operating system without blocking.
+         */
+        void CollectCompletions();
+
+        /**
+         * The operating system resources.
+         */
+        AsyncFileIOProperties properties;
+
+        /**
+         * The maximum number of pending operations.
+         */
+        uint32 depth;
+
+        /**
+         * Number of operations prepared and not yet collected.
+         */
+        uint32 pending;
+
+        /**
+         * Completions collected by the last WaitCompletions (capacity depth).
+         */
+        AsyncFileIOCompletion *completions;
+
+        /**
+         * Number of completions collected by the last WaitCompletions.
+         */
+        uint32 nOfCompletions;
+    };
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* ASYNCFILEIO_H_ */
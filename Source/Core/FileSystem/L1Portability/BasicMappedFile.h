@@ -0,0 +1,211 @@
+/**
+ * @file BasicMappedFile.h
+ * @brief Header file for class BasicMappedFile
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BasicMappedFile
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BASICMAPPEDFILE_H_
+#define BASICMAPPEDFILE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "BasicFile.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief Maps the content of a file in memory, so that it can be accessed directly through a pointer.
+     * @details The pages are read from the file when accessed for the first time (unless MAP_FLAG_POPULATE is set)
+     * and, for a writable mapping, the modified pages are written back to the file by the operating system
+     * (or explicitly with Sync).
+     *
+     * The access modes and the advice are the BasicFile ones (BasicFile::ACCESS_MODE_R, BasicFile::ACCESS_MODE_W
+     * and BasicFile::ADVICE_*).
+     */
+    class DLL_API BasicMappedFile {
+
+    public:
+
+        /**
+         * Read all the pages of the file when it is mapped, so that the first accesses do not take page faults.
+         */
+        static const uint32 MAP_FLAG_POPULATE = 0x00010000u;
+
+        /**
+         * Back the mapping with transparent huge pages, if supported by the file system (less TLB misses on large tables).
+         * A failure is only reported as a warning.
+         */
+        static const uint32 MAP_FLAG_HUGE_PAGES = 0x00020000u;
+
+        /**
+         * Lock the pages of the mapping in memory (implies reading all the pages). A failure is only reported as a warning.
+         */
+        static const uint32 MAP_FLAG_LOCK = 0x00040000u;
+
+        /**
+         * @brief Default constructor.
+         * @post
+         *   not IsMapped() &&
+         *   GetData() == NULL &&
+         *   GetMappedSize() == 0
+         */
+        BasicMappedFile();
+
+        /**
+         * @brief Destructor. Unmaps the file.
+         */
+        virtual ~BasicMappedFile();
+
+        /**
+         * @brief Opens and maps a file.
+         * @param[in] pathname the file to map.
+         * @param[in] flags BasicFile::ACCESS_MODE_R for a read-only mapping or BasicFile::ACCESS_MODE_W for a read-write
+         * mapping (the file is created if it does not exist), plus the MAP_FLAG_ options.
+         * @param[in] size the number of bytes to map (0 to map the whole file). If the mapping is writable and the file is
+         * smaller, the file is extended to \a size.
+         * @pre
+         *   not IsMapped()
+         * @return true if the file was mapped.
+         */
+        virtual bool Open(const char8 * const pathname,
+                          const uint32 flags,
+                          const uint64 size = 0u);
+
+        /**
+         * @brief Unmaps and closes the file. The modified pages are written back by the operating system in background.
+         * @return true if the file was unmapped.
+         */
+        virtual bool Close();
+
+        /**
+         * @brief Checks if a file is mapped.
+         * @return true if a file is mapped.
+         */
+        bool IsMapped() const;
+
+        /**
+         * @brief Gets the address of the beginning of the mapping.
+         * @return the address of the first byte or NULL if not mapped.
+         */
+        inline char8 *GetData() const;
+
+        /**
+         * @brief Gets the number of bytes mapped.
+         * @return the size of the mapping or 0 if not mapped.
+         */
+        inline uint64 GetMappedSize() const;
+
+        /**
+         * @brief Checks if the mapping is writable.
+         * @return true if the mapping was opened with BasicFile::ACCESS_MODE_W.
+         */
+        inline bool IsWritable() const;
+
+        /**
+         * @brief Declares how a range of the mapping will be accessed (madvise).
+         * @param[in] offset the beginning of the range.
+         * @param[in] size the size of the range (0 for up to the end of the mapping).
+         * @param[in] advice one of the BasicFile::ADVICE_ constants (BasicFile::ADVICE_NOREUSE is ignored).
+         * @pre
+         *   IsMapped()
+         * @return true if the advice was accepted.
+         */
+        bool Advise(const uint64 offset,
+                    const uint64 size,
+                    const uint32 advice) const;
+
+        /**
+         * @brief Writes the modified pages of a range back to the file.
+         * @param[in] offset the beginning of the range.
+         * @param[in] size the size of the range (0 for up to the end of the mapping).
+         * @param[in] wait if true returns after the pages are written, otherwise only schedules the write.
+         * @pre
+         *   IsMapped()
+         * @return true if the range was written (or scheduled).
+         */
+        bool Sync(const uint64 offset,
+                  const uint64 size,
+                  const bool wait = true) const;
+
+    private:
+
+        /**
+         * @brief Computes the page aligned range of the mapping containing [offset, offset + size).
+         * @return false if the range is outside of the mapping.
+         */
+        bool GetPageRange(const uint64 offset,
+                          const uint64 size,
+                          char8 *&pageStart,
+                          uint64 &pageSize) const;
+
+        /**
+         * The mapped file.
+         */
+        BasicFile file;
+
+        /**
+         * The beginning of the mapping.
+         */
+        char8 *data;
+
+        /**
+         * The size of the mapping.
+         */
+        uint64 mappedSize;
+
+        /**
+         * True if the mapping is writable.
+         */
+        bool writable;
+    };
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    char8 *BasicMappedFile::GetData() const {
+        return data;
+    }
+
+    uint64 BasicMappedFile::GetMappedSize() const {
+        return mappedSize;
+    }
+
+    bool BasicMappedFile::IsWritable() const {
+        return writable;
+    }
+
+}
+
+#endif /* BASICMAPPEDFILE_H_ */
@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "TimeoutType.h"
+#include "BasicFile.h"
 #include "BasicSocket.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -40,6 +41,11 @@
 
 namespace MARTe {
 
+/**
+ * The maximum number of buffers which can be written at once by BasicTCPSocket::WriteVector.
+ */
+static const uint32 BASIC_TCP_SOCKET_MAX_VECTORS = 16u;
+
 /**
  * @brief Class which represents a stream network socket, also known as
  * connection-oriented socket, which use Transmission Control Protocol (TCP).
@@ -92,6 +98,9 @@ public:
      * @return false in case of errors or timeout.
      * @post
      *   size is the number of read bytes.
+     * @details The data already received is read without waiting. Otherwise the socket is waited with poll()
+     * until the timeout expires, so that reading with a timeout does not change the socket options
+     * (a single recv() if the data is available and no system call at all to apply or remove the timeout).
      * @remark If the socket is in non-block mode, the timeout has no meaning.
      */
     virtual bool Read(char8* const output,
@@ -106,6 +115,8 @@ public:
      * @return false in case of errors or timeout.
      * @post
      *   size is the number of read bytes.
+     * @details The bytes are sent without blocking and, when the socket buffer is full, the socket is waited with poll()
+     * until all the bytes are sent or the timeout expires (size is then the number of bytes sent before the timeout).
      * @remark If the socket is in non-block mode, the timeout has no meaning.
      */
     virtual bool Write(const char8* const input,
@@ -203,6 +214,46 @@ public:
      */
     bool IsConnected() const;
 
+    /**
+     * @brief Shuts down both directions of the connection without releasing the socket descriptor.
+     * @details Any thread blocked (or polling) on the socket is woken up and sees the end of the connection.
+     * The socket still has to be closed with Close.
+     * @return false in case of errors.
+     */
+    bool Shutdown();
+
+    /**
+     * @brief Sends (a part of) a file without copying its content through user space buffers.
+     * @details Any data buffered by a stream built on top of this socket (e.g. an HTTP header) shall be flushed before.
+     * @param[in] file the file to send, which shall be open for reading. Its position is not changed.
+     * @param[in] offset the position in the file of the first byte to send.
+     * @param[in,out] size is the number of bytes to send.
+     * @return false in case of errors, timeout or if the file ends before all the bytes are sent.
+     * @post
+     *   size is the number of sent bytes.
+     */
+    bool SendFile(const BasicFile &file,
+                  const uint64 offset,
+                  uint64 &size);
+
+    /**
+     * @brief Writes several buffers, in order, with as few system calls as possible (gathered write, e.g. sendmsg).
+     * @details Allows to send data assembled from different memory areas (e.g. a protocol header, a payload and a trailer) in
+     * the same TCP segments without copying them into a single buffer. In blocking mode the call returns once all the bytes are
+     * written (or the timeout expires), in non-blocking mode after the first (possibly partial) write.
+     * @param[in] buffers the buffers to write.
+     * @param[in] sizes the number of bytes of each buffer.
+     * @param[in] numberOfBuffers the number of buffers (<= BASIC_TCP_SOCKET_MAX_VECTORS).
+     * @param[out] size the total number of written bytes.
+     * @param[in] timeout the maximum time to wait for the socket to accept all the bytes (only in blocking mode).
+     * @return false in case of errors, timeout or if numberOfBuffers > BASIC_TCP_SOCKET_MAX_VECTORS.
+     */
+    bool WriteVector(const char8 * const * const buffers,
+                     const uint32 * const sizes,
+                     const uint32 numberOfBuffers,
+                     uint32 &size,
+                     const TimeoutType &timeout = TTInfiniteWait);
+
     /**
      * @brief Accepts the next connection in the pending queue returning the relative socket.
      * @param[in] timeout is the desired timeout.
@@ -214,6 +265,117 @@ public:
     BasicTCPSocket *WaitConnection(const TimeoutType &timeout = TTInfiniteWait,
                                    BasicTCPSocket *client = static_cast<BasicTCPSocket *>(NULL));
 
+    /**
+     * @brief Disables (or enables) the Nagle algorithm (TCP_NODELAY).
+     * @details With \a flag true the small writes are sent immediately instead of being coalesced,
+     * which lowers the latency of request/reply protocols.
+     * @param[in] flag true to send the data without delay.
+     * @return true if the option was successfully set.
+     */
+    bool SetNoDelay(const bool flag);
+
+    /**
+     * @brief Holds back (or releases) the partial segments (TCP_CORK).
+     * @details While corked only full segments are sent, so that a reply written with several small writes leaves in as few
+     * segments as possible. Uncorking sends at once any pending data. The operating system sends the pending data anyway
+     * after a short time (200 ms in Linux), so that the socket shall be uncorked as soon as the reply is complete.
+     * Not supported by all operating systems.
+     * @param[in] flag true to cork, false to uncork.
+     * @return true if the option was successfully set.
+     */
+    bool SetCork(const bool flag);
+
+    /**
+     * @brief Gets the size of the send buffer of the socket in the kernel (SO_SNDBUF).
+     * @param[out] size the size of the send buffer in bytes.
+     * @return true if the option was successfully read.
+     */
+    bool GetSendBufferSize(uint32 &size);
+
+    /**
+     * @brief Sends the acknowledgements immediately instead of delaying them (TCP_QUICKACK).
+     * @details The operating system may revert to delayed acknowledgements after some operations, so
+     * the option may have to be set again (e.g. after each read). Not supported by all operating systems.
+     * @param[in] flag true to acknowledge immediately.
+     * @return true if the option was successfully set.
+     */
+    bool SetQuickAck(const bool flag);
+
+    /**
+     * @brief Sets the time to busy poll the device queue on blocking reads (SO_BUSY_POLL).
+     * @details Trades CPU time for lower receive latency. Not supported by all operating systems and
+     * may require special privileges.
+     * @param[in] microseconds the busy poll time in microseconds (0 to disable).
+     * @return true if the option was successfully set.
+     */
+    bool SetBusyPoll(const uint32 microseconds);
+
+    /**
+     * @brief Enables the zero-copy transmission (SO_ZEROCOPY) used by WriteZeroCopy.
+     * @details The zero-copy counters are reset, so that the option shall be set before the first WriteZeroCopy.
+     * Not supported by all operating systems (requires Linux >= 4.14).
+     * @return true if the option was successfully set.
+     */
+    bool SetZeroCopy();
+
+    /**
+     * @brief Writes a buffer without copying it into the kernel (MSG_ZEROCOPY).
+     * @details The pages of \a input are pinned and sent directly by the network device. The buffer shall therefore
+     * not be modified nor released until IsZeroCopyCompleted (or WaitZeroCopyCompleted) reports that the
+     * returned \a sequence is completed. Only worth for large buffers (tens of kilobytes or more): for
+     * small writes the page pinning and the completion handling cost more than the copy.
+     * If SetZeroCopy was not called (or failed) the buffer is copied as by Write and the \a sequence is completed at once.
+     * @param[in] input is the buffer which contains the data to be written.
+     * @param[in,out] size is the number of bytes to write.
+     * @param[out] sequence the identifier of the transmission to be checked for completion.
+     * @return false in case of errors.
+     * @post
+     *   size is the number of written bytes.
+     */
+    bool WriteZeroCopy(const char8* const input,
+                       uint32 &size,
+                       uint32 &sequence);
+
+    /**
+     * @brief Checks, without blocking, if the kernel released the buffer of the WriteZeroCopy identified by \a sequence.
+     * @details The pending completion notifications are read from the socket error queue.
+     * @param[in] sequence the identifier returned by WriteZeroCopy.
+     * @return true if the buffer can be reused.
+     */
+    bool IsZeroCopyCompleted(const uint32 sequence);
+
+    /**
+     * @brief Waits until the kernel releases the buffer of the WriteZeroCopy identified by \a sequence.
+     * @param[in] sequence the identifier returned by WriteZeroCopy.
+     * @param[in] timeout is the desired timeout.
+     * @return true if the buffer can be reused, false in case of errors or timeout.
+     */
+    bool WaitZeroCopyCompleted(const uint32 sequence,
+                               const TimeoutType &timeout = TTInfiniteWait);
+
+private:
+
+    /**
+     * @brief Reads all the zero-copy completion notifications pending in the socket error queue.
+     * @return false in case of errors.
+     */
+    bool ReadZeroCopyCompletions();
+
+    /**
+     * True if SO_ZEROCOPY was successfully set.
+     */
+    bool zeroCopyEnabled;
+
+    /**
+     * Number of send() calls issued with MSG_ZEROCOPY (the kernel identifies them with a counter starting at 0).
+     */
+    uint32 zeroCopySent;
+
+    /**
+     * Number of MSG_ZEROCOPY send() calls that were notified as completed.
+     */
+    uint32 zeroCopyCompleted;
+
 };
 
 }
@@ -71,6 +71,9 @@ public:
     /**
      * @brief Sets the speed of the UART. Shall be called before the Open
      * method.
+     * @details Speeds without a standard termios code (e.g. 250000 or
+     * 3686400) are set as custom rates (termios2 BOTHER on Linux), if
+     * the driver supports them.
      * @param[in] serial the speed to set.
      * @return true if the speed was successfully updated.
      */
@@ -86,6 +89,18 @@ public:
      */
     bool Open(const char8 *name);
 
+    /**
+     * @brief Asks the driver to deliver the received bytes without
+     * delay (ASYNC_LOW_LATENCY), instead of batching them for some
+     * milliseconds.
+     * @details Can be called before or after Open. Not supported by all
+     * the drivers (a failure is reported when the UART is open).
+     * @param[in] flag true to enable the low latency mode.
+     * @return true if the mode was successfully set (or, before Open,
+     * stored).
+     */
+    bool SetLowLatency(const bool flag);
+
     /**
      * @brief Closes the UART.
      * @pre
@@ -119,6 +134,24 @@ public:
      */
     bool Read(char8 *buffer, uint32 &size, const uint32 timeoutUsec);
 
+    /**
+     * @brief Reads all the bytes available (up to \a size), waiting at most
+     * \a timeoutUsec micro-seconds for the first one.
+     * @details Contrary to Read with a timeout, does not wait for \a size
+     * bytes: every byte received since the last call is returned at once,
+     * so that a periodic reader wakes up once per period.
+     * @param[in] buffer the memory where to write the read bytes.
+     * @param[in,out] size the capacity of \a buffer and the number of bytes
+     * that were actually read.
+     * @param[in] timeoutUsec the maximum time to wait for the first byte.
+     * @param[out] timestamp the HighResolutionTimer::Counter() when the
+     * data was found available.
+     * @return true if at least one byte was read.
+     * @pre
+     *   Open
+     */
+    bool ReadAvailable(char8 *buffer, uint32 &size, const uint32 timeoutUsec, uint64 &timestamp);
+
     /**
      * @brief Waits \a timeoutUsec micro-seconds for data to be available for
      * reading in the UART.
@@ -90,6 +90,115 @@ public:
     virtual bool Write(const char8* const input,
             uint32 &size);
 
+    /**
+     * @brief Writes several datagrams with as few system calls as possible.
+     * @details Each buffer is sent as an independent datagram (in order). Where supported by the
+     * operating system all the datagrams are handed over with a single call (e.g. sendmmsg).
+     * @param[in] buffers the datagrams to be written.
+     * @param[in] sizes the size in bytes of each datagram.
+     * @param[in,out] numberOfBuffers the number of datagrams to be written.
+     * @param[in] destinations the destination of each datagram. If NULL all the datagrams are sent to GetDestination().
+     * @return true if all the datagrams were written.
+     * @post
+     *   numberOfBuffers is the number of datagrams that were written.
+     */
+    bool WriteBatch(const char8 * const * const buffers,
+            const uint32 * const sizes,
+            uint32 &numberOfBuffers,
+            InternetHost * const destinations = NULL_PTR(InternetHost *));
+
+    /**
+     * @brief Reads several datagrams with as few system calls as possible.
+     * @details Blocks (up to timeout) until at least one datagram is available and then reads, without blocking,
+     * all the datagrams that are already queued, up to numberOfBuffers. Where supported by the operating system
+     * the datagrams are read with a single call (e.g. recvmmsg).
+     * @param[in] buffers where to store each datagram.
+     * @param[in,out] sizes the size in bytes of each buffer. On output the size of each datagram that was read.
+     * @param[in,out] numberOfBuffers the maximum number of datagrams to read.
+     * @param[out] sources if not NULL the source of each datagram.
+     * @param[in] timeout the maximum time to wait for the first datagram.
+     * @return true if at least one datagram was read.
+     * @post
+     *   numberOfBuffers is the number of datagrams that were read.
+     */
+    bool ReadBatch(char8 * const * const buffers,
+            uint32 * const sizes,
+            uint32 &numberOfBuffers,
+            InternetHost * const sources = NULL_PTR(InternetHost *),
+            const TimeoutType &timeout = TTInfiniteWait);
+
+    /**
+     * @brief Enables the reception timestamps reported by ReadWithTimestamp.
+     * @details Software timestamps are taken by the kernel when the datagram is received by the network stack.
+     * Hardware timestamps are taken by the network interface card, if it supports it.
+     * If interfaceName is set, the receive hardware timestamping of the device is also enabled (for all the
+     * packets), which typically requires special privileges. Otherwise it is assumed that the device was already configured.
+     * @param[in] hardware if true the hardware timestamps are also requested.
+     * @param[in] interfaceName the name of the network device whose hardware timestamping is to be enabled (e.g. eth0).
+     * @return true if the timestamping options were successfully set.
+     */
+    bool EnableTimestamping(const bool hardware,
+            const char8 * const interfaceName = NULL_PTR(const char8 *));
+
+    /**
+     * @brief Reads a datagram together with its reception timestamps.
+     * @details The timestamps are in nanoseconds since the epoch (i.e. on the system real-time clock for the
+     * software timestamp and on the NIC clock for the hardware timestamp). A timestamp which is not
+     * available (e.g. EnableTimestamping was not called or the device does not support it) is set to 0.
+     * @param[out] output is the buffer used to store the read data.
+     * @param[in,out] size is the number of bytes to read.
+     * @param[out] softwareTimestamp the kernel reception timestamp.
+     * @param[out] hardwareTimestamp the NIC reception timestamp.
+     * @param[in] timeout the maximum time to wait for the datagram.
+     * @return true if a datagram was read.
+     * @post
+     *   size is the number of read bytes.
+     *   GetSource() is the source of the datagram.
+     */
+    bool ReadWithTimestamp(char8 * const output,
+            uint32 &size,
+            uint64 &softwareTimestamp,
+            uint64 &hardwareTimestamp,
+            const TimeoutType &timeout = TTInfiniteWait);
+
+    /**
+     * @brief Sets the size of the socket receive buffer (SO_RCVBUF).
+     * @details Larger buffers allow to absorb bursts of datagrams between reads. The operating system
+     * may clip (or double) the requested value.
+     * @param[in] size the requested size in bytes.
+     * @return true if the option was successfully set.
+     */
+    bool SetReceiveBufferSize(const uint32 size);
+
+    /**
+     * @brief Sets the time to busy poll the device queue on blocking reads (SO_BUSY_POLL).
+     * @details Trades CPU time for lower receive latency. Not supported by all operating systems and
+     * may require special privileges.
+     * @param[in] microseconds the busy poll time in microseconds (0 to disable).
+     * @return true if the option was successfully set.
+     */
+    bool SetBusyPoll(const uint32 microseconds);
+
+    /**
+     * @brief Allows several sockets to bind the same port (SO_REUSEPORT), so that the received datagrams are spread between them.
+     * @details Shall be called before Listen on all the sockets of the group. By default the operating system selects the socket
+     * of each datagram with a hash of its source and destination, so that the datagrams of a given source are always received,
+     * in order, by the same socket.
+     * @param[in] reuse true to enable the option.
+     * @return true if the option was successfully set.
+     */
+    bool SetReusePort(const bool reuse);
+
+    /**
+     * @brief Selects the socket of a SO_REUSEPORT group that receives each datagram from its source address.
+     * @details Attaches a classic BPF program (SO_ATTACH_REUSEPORT_CBPF) which selects the socket with index
+     * (source IPv4 address modulo \a numberOfSockets), where the index of a socket is the order in which it was bound.
+     * Applies to the whole group and thus only needs to be called on one of its sockets, after Listen.
+     * @param[in] numberOfSockets the number of sockets of the group.
+     * @return true if the program was attached.
+     */
+    bool SetReusePortSteering(const uint32 numberOfSockets);
+
     /**
      * @brief Opens an UDP socket.
      * @return true if the socket is successfully initialised.
@@ -106,9 +215,34 @@ public:
     /**
      * @brief Sets the multicast group where the socket will register itself.
      * @param[in] group the multicast IP address.
+     * @param[in] interfaceAddress the IP address of the local interface where to join the group (NULL for the
+     * interface chosen by the operating system).
      * @return true if the socket is successfully registered to the multicast group..
      */
-    bool Join(const char8 * const group) const;
+    bool Join(const char8 * const group,
+            const char8 * const interfaceAddress = NULL_PTR(const char8 *)) const;
+
+    /**
+     * @brief Sets the local interface used to send the multicast datagrams (IP_MULTICAST_IF).
+     * @param[in] interfaceAddress the IP address of the local interface.
+     * @return true if the option was successfully set.
+     */
+    bool SetMulticastInterface(const char8 * const interfaceAddress);
+
+    /**
+     * @brief Sets the time to live of the multicast datagrams sent (IP_MULTICAST_TTL), i.e. the number of routers they
+     * can cross (1 = local network only).
+     * @param[in] ttl the time to live.
+     * @return true if the option was successfully set.
+     */
+    bool SetMulticastTTL(const uint8 ttl);
+
+    /**
+     * @brief Sets if the multicast datagrams sent are also delivered to the sockets of the local host (IP_MULTICAST_LOOP).
+     * @param[in] loopback true to deliver the datagrams locally.
+     * @return true if the option was successfully set.
+     */
+    bool SetMulticastLoopback(const bool loopback);
 
     /**
      * @brief Sets the writing destination address.
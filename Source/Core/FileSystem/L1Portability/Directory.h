@@ -130,6 +130,14 @@ namespace MARTe {
          */
         TimeStamp GetLastWriteTime();
 
+        /**
+         * @brief Gets the last write time as the number of seconds from the epoch (1/1/1970 00:00:00 UTC).
+         * @details Unlike GetLastWriteTime the value does not depend on the local time zone, so that it can be used
+         * e.g. to build HTTP dates and cache validators.
+         * @return the last write time or 0 if the file/directory does not exist.
+         */
+        uint64 GetLastWriteTimeSeconds();
+
         /**
          * @brief Gets the last access time.
          * @return the last access time.
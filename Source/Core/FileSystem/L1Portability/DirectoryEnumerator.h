@@ -0,0 +1,170 @@
+/**
+ * @file DirectoryEnumerator.h
+ * @brief Header file for class DirectoryEnumerator
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class DirectoryEnumerator
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef DIRECTORYENUMERATOR_H_
+#define DIRECTORYENUMERATOR_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+#include INCLUDE_FILE_ENVIRONMENT(FileSystem,L1Portability,ENVIRONMENT,DirectoryEnumeratorProperties.h)
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * @brief Streams the entries of a directory, one at a time and in the order returned by the file system.
+     * @details Differently from DirectoryScanner, the entries are neither stored nor sorted and the file
+     * properties are only read (and then cached until the next entry) when one of the Get methods is called.
+     * The type of the entry is in most cases known without reading the file properties, so that listing a
+     * directory with a large number of files only costs the reading of the directory itself.
+     *
+     * The order of the entries does not change while the directory is not modified, which allows to page a
+     * listing with Skip.
+     */
+    class DLL_API DirectoryEnumerator {
+
+    public:
+
+        /**
+         * @brief Default constructor.
+         * @post
+         *   not IsOpen()
+         */
+        DirectoryEnumerator();
+
+        /**
+         * @brief Destructor. Closes the directory.
+         */
+        virtual ~DirectoryEnumerator();
+
+        /**
+         * @brief Opens a directory for enumeration.
+         * @param[in] path the path of the directory.
+         * @param[in] fileMask shell wildcard pattern that the names of the entries shall match.
+         * @pre
+         *   not IsOpen()
+         * @return true if the directory was opened.
+         */
+        bool Open(const char8 * const path,
+                  const char8 * const fileMask = "*");
+
+        /**
+         * @brief Closes the directory.
+         * @return true if the directory was closed.
+         */
+        bool Close();
+
+        /**
+         * @brief Checks if a directory is open.
+         * @return true if a directory is open.
+         */
+        bool IsOpen() const;
+
+        /**
+         * @brief Moves to the next entry matching the file mask.
+         * @return false if there are no more entries or in case of errors.
+         */
+        bool Next();
+
+        /**
+         * @brief Moves over (up to) \a numberOfEntries entries, without reading their properties.
+         * @param[in] numberOfEntries the number of entries to skip.
+         * @return the number of entries skipped (less than \a numberOfEntries if the end of the directory was reached).
+         * @post
+         *   The current entry is the last one skipped.
+         */
+        uint32 Skip(const uint32 numberOfEntries);
+
+        /**
+         * @brief Restarts the enumeration from the first entry.
+         * @return true if the directory is open and could be rewound.
+         */
+        bool Rewind();
+
+        /**
+         * @brief Gets the name of the current entry.
+         * @return the name (without path) of the current entry or NULL if there is no current entry.
+         */
+        const char8 *GetName() const;
+
+        /**
+         * @brief Checks if the current entry is a directory (symbolic links are followed).
+         * @return true if the current entry is a directory.
+         */
+        bool IsDirectory();
+
+        /**
+         * @brief Checks if the current entry is a regular file (symbolic links are followed).
+         * @return true if the current entry is a regular file.
+         */
+        bool IsFile();
+
+        /**
+         * @brief Gets the size of the current entry.
+         * @return the size in bytes or 0 if the properties of the entry cannot be read.
+         */
+        uint64 GetSize();
+
+        /**
+         * @brief Gets the last write time of the current entry as the number of seconds from the epoch (1/1/1970 00:00:00 UTC).
+         * @return the last write time or 0 if the properties of the entry cannot be read.
+         */
+        uint64 GetLastWriteTimeSeconds();
+
+    private:
+
+        /**
+         * @brief Moves to the next entry matching the file mask (without resetting the cached properties).
+         * @return false if there are no more entries or in case of errors.
+         */
+        bool NextEntry();
+
+        /**
+         * @brief Reads the properties of the current entry, if not read yet.
+         * @return true if the properties are available.
+         */
+        bool ReadProperties();
+
+        /**
+         * The operating system specific state.
+         */
+        DirectoryEnumeratorProperties properties;
+    };
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DIRECTORYENUMERATOR_H_ */
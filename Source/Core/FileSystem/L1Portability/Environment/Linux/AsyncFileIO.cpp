@@ -0,0 +1,538 @@
+/**
+ * @file AsyncFileIO.cpp
+ * @brief Source file for class AsyncFileIO
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class AsyncFileIO (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AsyncFileIO.h"
+#include "ErrorManagement.h"
+#include "HighResolutionTimer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+//IORING_OP_READ is an enumerator: headers defining IORING_FEAT_FAST_POLL (added one release later) also define it
+#if defined(__NR_io_uring_setup) && defined(IORING_FEAT_FAST_POLL)
+#define ASYNC_FILE_IO_URING 1
+#endif
+
+namespace MARTe {
+
+#ifdef ASYNC_FILE_IO_URING
+/**
+ * @brief Calls io_uring_enter retrying when interrupted by a signal.
+ * @return the number of submitted operations or -errno.
+ */
+static int32 AsyncFileIOEnter(const int32 ringHandle,
+                              const uint32 toSubmit,
+                              const uint32 minComplete,
+                              const uint32 flags) {
+    int32 ret = -EINTR;
+    while (ret == -EINTR) {
+        long err = syscall(__NR_io_uring_enter, ringHandle, toSubmit, minComplete, flags, NULL, 0);
+        if (err < 0) {
+            ret = -errno;
+        }
+        else {
+            ret = static_cast<int32>(err);
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Fills the next submission queue entry.
+ */
+static void AsyncFileIOPrepare(AsyncFileIOProperties &properties,
+                               const uint8 opcode,
+                               const Handle fd,
+                               const uint64 offset,
+                               const void * const buffer,
+                               const uint32 size,
+                               void * const userData,
+                               const int32 bufferIndex) {
+    uint32 tail = *properties.sqTail;
+    uint32 index = (tail & properties.sqMask);
+    struct io_uring_sqe *sqe = &properties.sqes[index];
+    (void) memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->off = offset;
+    /*lint -e{923} -e{9091} [MISRA C++ Rule 5-2-9]. Justification: the kernel interface transports pointers as 64 bit integers.*/
+    sqe->addr = static_cast<uint64>(reinterpret_cast<uintp>(buffer));
+    sqe->len = size;
+    /*lint -e{923} -e{9091} [MISRA C++ Rule 5-2-9]. Justification: the kernel interface transports pointers as 64 bit integers.*/
+    sqe->user_data = static_cast<uint64>(reinterpret_cast<uintp>(userData));
+    if (bufferIndex >= 0) {
+        sqe->buf_index = static_cast<uint16>(bufferIndex);
+    }
+    if (opcode == IORING_OP_FSYNC) {
+        sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+    }
+    properties.sqArray[index] = index;
+    //The entry shall be visible to the kernel before the new tail
+    __atomic_store_n(properties.sqTail, tail + 1u, __ATOMIC_RELEASE);
+    properties.toSubmit++;
+}
+#endif
+
+/**
+ * @brief Executes an operation synchronously (fallback when io_uring is not available).
+ * @return the number of bytes transferred or -errno.
+ */
+static int32 AsyncFileIOExecute(const uint32 operation,
+                                const Handle fd,
+                                const uint64 offset,
+                                char8 * const buffer,
+                                const uint32 size) {
+    ssize_t ret = -1;
+    bool retry = true;
+    while (retry) {
+        if (operation == 0u) {
+            ret = pread(fd, buffer, static_cast<size_t>(size), static_cast<off_t>(offset));
+        }
+        else if (operation == 1u) {
+            ret = pwrite(fd, buffer, static_cast<size_t>(size), static_cast<off_t>(offset));
+        }
+        else {
+            ret = fdatasync(fd);
+        }
+        retry = ((ret < 0) && (errno == EINTR));
+    }
+    int32 result = static_cast<int32>(ret);
+    if (ret < 0) {
+        result = -errno;
+    }
+    return result;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+AsyncFileIO::AsyncFileIO(const uint32 queueDepth) {
+    depth = queueDepth;
+    if (depth == 0u) {
+        depth = 1u;
+    }
+    pending = 0u;
+    nOfCompletions = 0u;
+    completions = new AsyncFileIOCompletion[depth];
+    (void) memset(&properties, 0, sizeof(properties));
+    properties.ringHandle = -1;
+#ifdef ASYNC_FILE_IO_URING
+    struct io_uring_params params;
+    (void) memset(&params, 0, sizeof(params));
+    long fd = syscall(__NR_io_uring_setup, depth, &params);
+    bool ok = (fd >= 0);
+    if (ok) {
+        properties.ringHandle = static_cast<int32>(fd);
+        properties.sqRingSize = params.sq_off.array + (params.sq_entries * sizeof(uint32));
+        properties.cqRingSize = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+        bool singleMap = ((params.features & IORING_FEAT_SINGLE_MMAP) != 0u);
+        if (singleMap) {
+            if (properties.cqRingSize > properties.sqRingSize) {
+                properties.sqRingSize = properties.cqRingSize;
+            }
+            properties.cqRingSize = properties.sqRingSize;
+        }
+        properties.sqRing = mmap(NULL, properties.sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, properties.ringHandle,
+                                 static_cast<off_t>(IORING_OFF_SQ_RING));
+        ok = (properties.sqRing != MAP_FAILED);
+        if (ok) {
+            if (singleMap) {
+                properties.cqRing = properties.sqRing;
+            }
+            else {
+                properties.cqRing = mmap(NULL, properties.cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, properties.ringHandle,
+                                         static_cast<off_t>(IORING_OFF_CQ_RING));
+                ok = (properties.cqRing != MAP_FAILED);
+                if (!ok) {
+                    properties.cqRing = NULL_PTR(void *);
+                }
+            }
+        }
+        else {
+            properties.sqRing = NULL_PTR(void *);
+        }
+        if (ok) {
+            properties.sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+            void *sqes = mmap(NULL, properties.sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, properties.ringHandle,
+                              static_cast<off_t>(IORING_OFF_SQES));
+            ok = (sqes != MAP_FAILED);
+            if (ok) {
+                properties.sqes = static_cast<struct io_uring_sqe *>(sqes);
+            }
+        }
+        if (ok) {
+            char8 *sq = static_cast<char8 *>(properties.sqRing);
+            char8 *cq = static_cast<char8 *>(properties.cqRing);
+            /*lint -e{927} -e{826} Justification: the ring layout is given by the kernel offsets.*/
+            properties.sqHead = reinterpret_cast<uint32 *>(&sq[params.sq_off.head]);
+            properties.sqTail = reinterpret_cast<uint32 *>(&sq[params.sq_off.tail]);
+            properties.sqMask = *reinterpret_cast<uint32 *>(&sq[params.sq_off.ring_mask]);
+            properties.sqArray = reinterpret_cast<uint32 *>(&sq[params.sq_off.array]);
+            properties.cqHead = reinterpret_cast<uint32 *>(&cq[params.cq_off.head]);
+            properties.cqTail = reinterpret_cast<uint32 *>(&cq[params.cq_off.tail]);
+            properties.cqMask = *reinterpret_cast<uint32 *>(&cq[params.cq_off.ring_mask]);
+            properties.cqes = reinterpret_cast<struct io_uring_cqe *>(&cq[params.cq_off.cqes]);
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "AsyncFileIO: Failed mmap() of the io_uring rings");
+            if (properties.sqRing != NULL) {
+                (void) munmap(properties.sqRing, properties.sqRingSize);
+            }
+            if ((properties.cqRing != NULL) && (properties.cqRing != properties.sqRing)) {
+                (void) munmap(properties.cqRing, properties.cqRingSize);
+            }
+            properties.sqRing = NULL_PTR(void *);
+            properties.cqRing = NULL_PTR(void *);
+            (void) close(properties.ringHandle);
+            properties.ringHandle = -1;
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::Information, "AsyncFileIO: io_uring is not available. The operations will be executed synchronously");
+    }
+#endif
+    if (properties.ringHandle < 0) {
+        properties.deferredUserData = new void*[depth];
+        properties.deferredResults = new int32[depth];
+    }
+}
+
+AsyncFileIO::~AsyncFileIO() {
+    //The buffers of the operations in flight shall not be released by the kernel after the destruction
+    while ((properties.ringHandle >= 0) && (pending > 0u)) {
+        if (WaitCompletions(pending) < 0) {
+            pending = 0u;
+        }
+    }
+#ifdef ASYNC_FILE_IO_URING
+    if (properties.ringHandle >= 0) {
+        if (properties.sqes != NULL) {
+            (void) munmap(properties.sqes, properties.sqesSize);
+        }
+        if ((properties.cqRing != NULL) && (properties.cqRing != properties.sqRing)) {
+            (void) munmap(properties.cqRing, properties.cqRingSize);
+        }
+        if (properties.sqRing != NULL) {
+            (void) munmap(properties.sqRing, properties.sqRingSize);
+        }
+        (void) close(properties.ringHandle);
+    }
+#endif
+    if (properties.deferredUserData != NULL) {
+        delete[] properties.deferredUserData;
+    }
+    if (properties.deferredResults != NULL) {
+        delete[] properties.deferredResults;
+    }
+    delete[] completions;
+}
+
+bool AsyncFileIO::IsValid() const {
+    return ((properties.ringHandle >= 0) || (properties.deferredResults != NULL));
+}
+
+bool AsyncFileIO::IsAsynchronous() const {
+    return (properties.ringHandle >= 0);
+}
+
+bool AsyncFileIO::RegisterBuffers(char8 * const * const buffers,
+                                  const uint32 * const sizes,
+                                  const uint32 numberOfBuffers) {
+    bool ok = (!properties.buffersRegistered) && (pending == 0u);
+    if (ok) {
+#ifdef ASYNC_FILE_IO_URING
+        if (properties.ringHandle >= 0) {
+            struct iovec *iov = new struct iovec[numberOfBuffers];
+            for (uint32 i = 0u; i < numberOfBuffers; i++) {
+                iov[i].iov_base = buffers[i];
+                iov[i].iov_len = sizes[i];
+            }
+            ok = (syscall(__NR_io_uring_register, properties.ringHandle, IORING_REGISTER_BUFFERS, iov, numberOfBuffers) >= 0);
+            delete[] iov;
+            if (!ok) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "AsyncFileIO: Failed io_uring_register() of the buffers (check the locked memory limit)");
+            }
+        }
+#endif
+        properties.buffersRegistered = ok;
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::IllegalOperation, "AsyncFileIO: The buffers are already registered or operations are pending");
+    }
+    return ok;
+}
+
+bool AsyncFileIO::UnregisterBuffers() {
+    bool ok = (properties.buffersRegistered) && (pending == 0u);
+    if (ok) {
+#ifdef ASYNC_FILE_IO_URING
+        if (properties.ringHandle >= 0) {
+            ok = (syscall(__NR_io_uring_register, properties.ringHandle, IORING_UNREGISTER_BUFFERS, NULL, 0) >= 0);
+            if (!ok) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "AsyncFileIO: Failed io_uring_register() unregistering the buffers");
+            }
+        }
+#endif
+        properties.buffersRegistered = false;
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::IllegalOperation, "AsyncFileIO: No buffers registered or operations are pending");
+    }
+    return ok;
+}
+
+bool AsyncFileIO::ReserveOperation() {
+    bool ok = IsValid();
+    if (ok) {
+        ok = (pending < depth);
+        if (ok) {
+            pending++;
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "AsyncFileIO: The queue is full");
+        }
+    }
+    return ok;
+}
+
+bool AsyncFileIO::PrepareRead(const BasicFile &file,
+                              const uint64 offset,
+                              char8 * const buffer,
+                              const uint32 size,
+                              void * const userData,
+                              const int32 bufferIndex) {
+    bool ok = ReserveOperation();
+    if (ok) {
+#ifdef ASYNC_FILE_IO_URING
+        if (properties.ringHandle >= 0) {
+            uint8 opcode = static_cast<uint8>((bufferIndex >= 0) ? IORING_OP_READ_FIXED : IORING_OP_READ);
+            AsyncFileIOPrepare(properties, opcode, file.GetReadHandle(), offset, buffer, size, userData, bufferIndex);
+        }
+        else
+#endif
+        {
+            properties.deferredUserData[properties.nOfDeferred] = userData;
+            properties.deferredResults[properties.nOfDeferred] = AsyncFileIOExecute(0u, file.GetReadHandle(), offset, buffer, size);
+            properties.nOfDeferred++;
+        }
+    }
+    return ok;
+}
+
+bool AsyncFileIO::PrepareWrite(const BasicFile &file,
+                               const uint64 offset,
+                               const char8 * const buffer,
+                               const uint32 size,
+                               void * const userData,
+                               const int32 bufferIndex) {
+    bool ok = ReserveOperation();
+    if (ok) {
+#ifdef ASYNC_FILE_IO_URING
+        if (properties.ringHandle >= 0) {
+            uint8 opcode = static_cast<uint8>((bufferIndex >= 0) ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE);
+            AsyncFileIOPrepare(properties, opcode, file.GetWriteHandle(), offset, buffer, size, userData, bufferIndex);
+        }
+        else
+#endif
+        {
+            properties.deferredUserData[properties.nOfDeferred] = userData;
+            /*lint -e{1773} Justification: the buffer is only read by pwrite.*/
+            properties.deferredResults[properties.nOfDeferred] = AsyncFileIOExecute(1u, file.GetWriteHandle(), offset, const_cast<char8 *>(buffer), size);
+            properties.nOfDeferred++;
+        }
+    }
+    return ok;
+}
+
+bool AsyncFileIO::PrepareFlush(const BasicFile &file,
+                               void * const userData) {
+    bool ok = ReserveOperation();
+    if (ok) {
+#ifdef ASYNC_FILE_IO_URING
+        if (properties.ringHandle >= 0) {
+            AsyncFileIOPrepare(properties, static_cast<uint8>(IORING_OP_FSYNC), file.GetWriteHandle(), 0u, NULL_PTR(void *), 0u, userData, -1);
+        }
+        else
+#endif
+        {
+            properties.deferredUserData[properties.nOfDeferred] = userData;
+            properties.deferredResults[properties.nOfDeferred] = AsyncFileIOExecute(2u, file.GetWriteHandle(), 0u, NULL_PTR(char8 *), 0u);
+            properties.nOfDeferred++;
+        }
+    }
+    return ok;
+}
+
+int32 AsyncFileIO::Submit() {
+    int32 ret = 0;
+#ifdef ASYNC_FILE_IO_URING
+    if ((properties.ringHandle >= 0) && (properties.toSubmit > 0u)) {
+        ret = AsyncFileIOEnter(properties.ringHandle, properties.toSubmit, 0u, 0u);
+        if (ret >= 0) {
+            properties.toSubmit -= static_cast<uint32>(ret);
+        }
+        else if ((ret == -EAGAIN) || (ret == -EBUSY)) {
+            //Kernel resources temporarily exhausted, the operations stay in the queue
+            ret = 0;
+        }
+        else {
+            ret = -1;
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "AsyncFileIO: Failed io_uring_enter()");
+        }
+    }
+#endif
+    return ret;
+}
+
+void AsyncFileIO::CollectCompletions() {
+#ifdef ASYNC_FILE_IO_URING
+    if (properties.ringHandle >= 0) {
+        uint32 head = *properties.cqHead;
+        uint32 tail = __atomic_load_n(properties.cqTail, __ATOMIC_ACQUIRE);
+        while ((head != tail) && (nOfCompletions < depth)) {
+            const struct io_uring_cqe *cqe = &properties.cqes[head & properties.cqMask];
+            /*lint -e{923} -e{9091} [MISRA C++ Rule 5-2-9]. Justification: the kernel interface transports pointers as 64 bit integers.*/
+            completions[nOfCompletions].userData = reinterpret_cast<void *>(static_cast<uintp>(cqe->user_data));
+            completions[nOfCompletions].result = cqe->res;
+            nOfCompletions++;
+            pending--;
+            head++;
+        }
+        //The entries are released to the kernel after being read
+        __atomic_store_n(properties.cqHead, head, __ATOMIC_RELEASE);
+    }
+    else
+#endif
+    {
+        uint32 i;
+        for (i = 0u; (i < properties.nOfDeferred) && (nOfCompletions < depth); i++) {
+            completions[nOfCompletions].userData = properties.deferredUserData[i];
+            completions[nOfCompletions].result = properties.deferredResults[i];
+            nOfCompletions++;
+            pending--;
+        }
+        properties.nOfDeferred = 0u;
+    }
+}
+
+int32 AsyncFileIO::WaitCompletions(const uint32 minCompletions,
+                                   const TimeoutType &timeout) {
+    int32 ret = -1;
+    nOfCompletions = 0u;
+    if (IsValid()) {
+        ret = Submit();
+        uint32 toWait = minCompletions;
+        if (toWait > pending) {
+            toWait = pending;
+        }
+        uint64 deadline = 0u;
+        if (timeout.IsFinite()) {
+            uint64 ticks = (static_cast<uint64>(timeout.GetTimeoutMSec()) * HighResolutionTimer::Frequency()) / 1000u;
+            deadline = HighResolutionTimer::Counter() + ticks;
+        }
+        bool waiting = (ret >= 0);
+        while (waiting) {
+            CollectCompletions();
+            waiting = (nOfCompletions < toWait);
+#ifdef ASYNC_FILE_IO_URING
+            if (waiting) {
+                if (properties.toSubmit > 0u) {
+                    waiting = (Submit() >= 0);
+                }
+            }
+            if (waiting) {
+                if (timeout.IsFinite()) {
+                    int32 timeoutMSec = 0;
+                    uint64 now = HighResolutionTimer::Counter();
+                    if (now < deadline) {
+                        timeoutMSec = static_cast<int32>((((deadline - now) * 1000u) + (HighResolutionTimer::Frequency() - 1u)) / HighResolutionTimer::Frequency());
+                    }
+                    //The ring handle is readable when the completion queue is not empty
+                    struct pollfd pollDescriptor;
+                    pollDescriptor.fd = properties.ringHandle;
+                    pollDescriptor.events = POLLIN;
+                    pollDescriptor.revents = 0;
+                    int32 ready = poll(&pollDescriptor, 1u, timeoutMSec);
+                    if (ready == 0) {
+                        waiting = false;
+                        CollectCompletions();
+                    }
+                    else if ((ready < 0) && (errno != EINTR)) {
+                        waiting = false;
+                        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "AsyncFileIO: Failed poll()");
+                    }
+                    else {
+                        //Completions ready
+                    }
+                }
+                else {
+                    int32 err = AsyncFileIOEnter(properties.ringHandle, 0u, toWait - nOfCompletions, IORING_ENTER_GETEVENTS);
+                    if (err < 0) {
+                        waiting = false;
+                        ret = -1;
+                        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "AsyncFileIO: Failed io_uring_enter() waiting for completions");
+                    }
+                }
+            }
+#endif
+        }
+        if (ret >= 0) {
+            ret = static_cast<int32>(nOfCompletions);
+        }
+    }
+    return ret;
+}
+
+AsyncFileIOCompletion AsyncFileIO::GetCompletion(const uint32 index) const {
+    AsyncFileIOCompletion completion;
+    completion.userData = NULL_PTR(void *);
+    completion.result = -1;
+    if (index < nOfCompletions) {
+        completion = completions[index];
+    }
+    return completion;
+}
+
+uint32 AsyncFileIO::GetNumberOfPendingOperations() const {
+    return pending;
+}
+
+}
@@ -0,0 +1,80 @@
+/**
+ * @file AsyncFileIOProperties.h
+ * @brief Header file for class AsyncFileIOProperties
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class AsyncFileIOProperties
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef ASYNCFILEIOPROPERTIES_H_
+#define ASYNCFILEIOPROPERTIES_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <stddef.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace MARTe {
+/**
+ * io_uring rings shared with the kernel (ringHandle < 0 if the synchronous fallback is used).
+ */
+struct AsyncFileIOProperties {
+    int32 ringHandle;
+    void *sqRing;
+    size_t sqRingSize;
+    void *cqRing;
+    size_t cqRingSize;
+    struct io_uring_sqe *sqes;
+    size_t sqesSize;
+    uint32 *sqHead;
+    uint32 *sqTail;
+    uint32 sqMask;
+    uint32 *sqArray;
+    uint32 *cqHead;
+    uint32 *cqTail;
+    uint32 cqMask;
+    struct io_uring_cqe *cqes;
+    uint32 toSubmit;
+    bool buffersRegistered;
+    /*
+     * Results of the operations executed by the synchronous fallback and not collected yet.
+     */
+    void **deferredUserData;
+    int32 *deferredResults;
+    uint32 nOfDeferred;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /*ASYNCFILEIOPROPERTIES_H_ */
@@ -25,6 +25,7 @@
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
 
+#include <errno.h>
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -70,6 +71,9 @@ MARTe::uint32 ConvertToLinuxFlags(const MARTe::uint32 flags) {
         linuxFlags |= static_cast<MARTe::uint32>(O_EXCL);
         linuxFlags |= static_cast<MARTe::uint32>(O_CREAT);
     }
+    if ((flags & MARTe::BasicFile::FLAG_DIRECT) == MARTe::BasicFile::FLAG_DIRECT) {
+        linuxFlags |= static_cast<MARTe::uint32>(O_DIRECT);
+    }
     return linuxFlags;
 }
 
@@ -97,6 +101,9 @@ MARTe::uint32 ConvertToBasicFileFlags(const MARTe::uint32 flags) {
     if ((flags & static_cast<MARTe::uint32>(O_EXCL)) == static_cast<MARTe::uint32>(O_EXCL)) {
         BasicFileFlags |= MARTe::BasicFile::FLAG_CREAT_EXCLUSIVE;
     }
+    if ((flags & static_cast<MARTe::uint32>(O_DIRECT)) == static_cast<MARTe::uint32>(O_DIRECT)) {
+        BasicFileFlags |= MARTe::BasicFile::FLAG_DIRECT;
+    }
     return BasicFileFlags;
 }
 
@@ -213,8 +220,8 @@ bool BasicFile::SetFlags(const uint32 setFlags) {
 
     if (IsOpen()) {
         uint32 linuxFlags = ConvertToLinuxFlags(setFlags);
-        uint32 clear = ~(static_cast<uint32>(O_APPEND));
-        properties.saveFlags &= clear; //remove the APPEND. It is the only changed flag.
+        uint32 clear = ~(static_cast<uint32>(O_APPEND) | static_cast<uint32>(O_DIRECT));
+        properties.saveFlags &= clear; //remove the APPEND and the DIRECT. These are the only changed flags.
         properties.saveFlags |= linuxFlags; // Add the new flag to the existing saveFlags.
         uint32 retFcntl = static_cast<uint32>(fcntl(properties.identifier, F_SETFL, properties.saveFlags));
         if ((retFcntl & properties.saveFlags) != properties.saveFlags) {
@@ -548,6 +555,91 @@ bool BasicFile::SetSize(const uint64 size) {
     return retVal;
 }
 
+bool BasicFile::Preallocate(const uint64 offset,
+                            const uint64 size,
+                            const bool keepSize) {
+    bool retVal = CanWrite();
+    if (retVal) {
+        int32 mode = 0;
+        if (keepSize) {
+            mode = FALLOC_FL_KEEP_SIZE;
+        }
+        int32 ret = fallocate(properties.identifier, mode, static_cast<off_t>(offset), static_cast<off_t>(size));
+        if ((ret != 0) && (errno == EOPNOTSUPP) && (!keepSize)) {
+            //The file system does not support fallocate: posix_fallocate writes the blocks instead
+            ret = posix_fallocate(properties.identifier, static_cast<off_t>(offset), static_cast<off_t>(size));
+        }
+        retVal = (ret == 0);
+        if (!retVal) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicFile::Preallocate(). The storage cannot be reserved");
+        }
+    }
+    return retVal;
+}
+
+bool BasicFile::Advise(const uint64 offset,
+                       const uint64 size,
+                       const uint32 advice) {
+    bool retVal = IsOpen();
+    if (retVal) {
+        int32 linuxAdvice = POSIX_FADV_NORMAL;
+        if (advice == ADVICE_SEQUENTIAL) {
+            linuxAdvice = POSIX_FADV_SEQUENTIAL;
+        }
+        else if (advice == ADVICE_RANDOM) {
+            linuxAdvice = POSIX_FADV_RANDOM;
+        }
+        else if (advice == ADVICE_NOREUSE) {
+            linuxAdvice = POSIX_FADV_NOREUSE;
+        }
+        else if (advice == ADVICE_WILLNEED) {
+            linuxAdvice = POSIX_FADV_WILLNEED;
+        }
+        else if (advice == ADVICE_DONTNEED) {
+            linuxAdvice = POSIX_FADV_DONTNEED;
+            if (CanWrite()) {
+                //The modified pages are not dropped from the cache: write them first
+                uint32 syncFlags = static_cast<uint32>(SYNC_FILE_RANGE_WAIT_BEFORE) | static_cast<uint32>(SYNC_FILE_RANGE_WRITE)
+                        | static_cast<uint32>(SYNC_FILE_RANGE_WAIT_AFTER);
+                if (sync_file_range(properties.identifier, static_cast<off_t>(offset), static_cast<off_t>(size), syncFlags) != 0) {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "BasicFile::Advise(). The range cannot be written to the storage device");
+                }
+            }
+        }
+        else {
+            //ADVICE_NORMAL
+        }
+        retVal = (posix_fadvise(properties.identifier, static_cast<off_t>(offset), static_cast<off_t>(size), linuxAdvice) == 0);
+        if (!retVal) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicFile::Advise(). The advice cannot be set");
+        }
+    }
+    return retVal;
+}
+
+uint32 BasicFile::GetDirectIOAlignment() const {
+    uint32 alignment = 4096u;
+#if defined(STATX_DIOALIGN)
+    if (IsOpen()) {
+        struct statx information;
+        if (statx(properties.identifier, "", AT_EMPTY_PATH, STATX_DIOALIGN, &information) == 0) {
+            if ((information.stx_mask & STATX_DIOALIGN) != 0u) {
+                //Both the memory and the file offsets shall be aligned
+                alignment = information.stx_dio_offset_align;
+                if (information.stx_dio_mem_align > alignment) {
+                    alignment = information.stx_dio_mem_align;
+                }
+                if (alignment == 0u) {
+                    //Direct I/O not supported on this file
+                    alignment = 4096u;
+                }
+            }
+        }
+    }
+#endif
+    return alignment;
+}
+
 StreamString BasicFile::GetPathName() const {
     return properties.pathName;
 }
@@ -0,0 +1,244 @@
+/**
+ * @file BasicMappedFile.cpp
+ * @brief Source file for class BasicMappedFile
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BasicMappedFile (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <sys/mman.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "BasicMappedFile.h"
+#include "ErrorManagement.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+BasicMappedFile::BasicMappedFile() :
+        file() {
+    data = NULL_PTR(char8 *);
+    mappedSize = 0u;
+    writable = false;
+}
+
+BasicMappedFile::~BasicMappedFile() {
+    if (IsMapped()) {
+        (void) BasicMappedFile::Close();
+    }
+}
+
+bool BasicMappedFile::Open(const char8 * const pathname,
+                           const uint32 flags,
+                           const uint64 size) {
+    bool ok = !IsMapped();
+    if (ok) {
+        writable = ((flags & BasicFile::ACCESS_MODE_W) == BasicFile::ACCESS_MODE_W);
+        uint32 fileFlags = BasicFile::ACCESS_MODE_R;
+        if (writable) {
+            //A shared writable mapping requires the file to be also readable
+            fileFlags |= (BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
+        }
+        ok = file.Open(pathname, fileFlags);
+        if (ok) {
+            uint64 fileSize = file.Size();
+            mappedSize = size;
+            if (mappedSize == 0u) {
+                mappedSize = fileSize;
+            }
+            if ((writable) && (mappedSize > fileSize)) {
+                ok = file.SetSize(mappedSize);
+            }
+            else if (mappedSize > fileSize) {
+                ok = false;
+                REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "BasicMappedFile: The size is larger than the read-only file");
+            }
+            else {
+                //Size ok
+            }
+            if ((ok) && (mappedSize == 0u)) {
+                ok = false;
+                REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "BasicMappedFile: Cannot map an empty file");
+            }
+        }
+        if (ok) {
+            int32 protection = PROT_READ;
+            if (writable) {
+                protection |= PROT_WRITE;
+            }
+            int32 mapFlags = MAP_SHARED;
+            if ((flags & (MAP_FLAG_POPULATE | MAP_FLAG_LOCK)) != 0u) {
+                mapFlags |= MAP_POPULATE;
+            }
+            void *address = mmap(NULL, static_cast<size_t>(mappedSize), protection, mapFlags, file.GetReadHandle(), 0);
+            ok = (address != MAP_FAILED);
+            if (ok) {
+                data = static_cast<char8 *>(address);
+            }
+            else {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicMappedFile: Failed mmap()");
+            }
+        }
+        if (ok) {
+            if ((flags & MAP_FLAG_HUGE_PAGES) == MAP_FLAG_HUGE_PAGES) {
+#ifdef MADV_HUGEPAGE
+                if (madvise(data, static_cast<size_t>(mappedSize), MADV_HUGEPAGE) != 0) {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "BasicMappedFile: Huge pages not supported for this file. Using normal pages");
+                }
+#else
+                REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "BasicMappedFile: Huge pages not supported. Using normal pages");
+#endif
+            }
+            if ((flags & MAP_FLAG_LOCK) == MAP_FLAG_LOCK) {
+                if (mlock(data, static_cast<size_t>(mappedSize)) != 0) {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "BasicMappedFile: Failed mlock(). The mapping is not locked in memory");
+                }
+            }
+        }
+        else {
+            if (file.IsOpen()) {
+                (void) file.Close();
+            }
+            data = NULL_PTR(char8 *);
+            mappedSize = 0u;
+            writable = false;
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::IllegalOperation, "BasicMappedFile: A file is already mapped");
+    }
+    return ok;
+}
+
+bool BasicMappedFile::Close() {
+    bool ok = IsMapped();
+    if (ok) {
+        ok = (munmap(data, static_cast<size_t>(mappedSize)) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicMappedFile: Failed munmap()");
+        }
+        if (!file.Close()) {
+            ok = false;
+        }
+        data = NULL_PTR(char8 *);
+        mappedSize = 0u;
+        writable = false;
+    }
+    return ok;
+}
+
+bool BasicMappedFile::IsMapped() const {
+    return (data != NULL);
+}
+
+bool BasicMappedFile::GetPageRange(const uint64 offset,
+                                   const uint64 size,
+                                   char8 *&pageStart,
+                                   uint64 &pageSize) const {
+    bool ok = (IsMapped()) && (offset < mappedSize);
+    if (ok) {
+        uint64 end = offset + size;
+        if ((size == 0u) || (end > mappedSize)) {
+            end = mappedSize;
+        }
+        //The mapping starts at a page boundary: align the beginning of the range down
+        uint64 page = static_cast<uint64>(sysconf(_SC_PAGESIZE));
+        uint64 start = (offset / page) * page;
+        pageStart = &data[start];
+        pageSize = end - start;
+    }
+    return ok;
+}
+
+bool BasicMappedFile::Advise(const uint64 offset,
+                             const uint64 size,
+                             const uint32 advice) const {
+    char8 *pageStart = NULL_PTR(char8 *);
+    uint64 pageSize = 0u;
+    bool ok = GetPageRange(offset, size, pageStart, pageSize);
+    if (ok) {
+        int32 linuxAdvice = MADV_NORMAL;
+        if (advice == BasicFile::ADVICE_SEQUENTIAL) {
+            linuxAdvice = MADV_SEQUENTIAL;
+        }
+        else if (advice == BasicFile::ADVICE_RANDOM) {
+            linuxAdvice = MADV_RANDOM;
+        }
+        else if (advice == BasicFile::ADVICE_WILLNEED) {
+            linuxAdvice = MADV_WILLNEED;
+        }
+        else if (advice == BasicFile::ADVICE_DONTNEED) {
+            linuxAdvice = MADV_DONTNEED;
+            if (writable) {
+                //The modified pages would be written back anyway, but not dropped before
+                ok = Sync(offset, size, true);
+            }
+        }
+        else {
+            //ADVICE_NORMAL and ADVICE_NOREUSE
+        }
+        if (ok) {
+            ok = (madvise(pageStart, static_cast<size_t>(pageSize), linuxAdvice) == 0);
+            if (!ok) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicMappedFile: Failed madvise()");
+            }
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "BasicMappedFile: The range is not mapped");
+    }
+    return ok;
+}
+
+bool BasicMappedFile::Sync(const uint64 offset,
+                           const uint64 size,
+                           const bool wait) const {
+    char8 *pageStart = NULL_PTR(char8 *);
+    uint64 pageSize = 0u;
+    bool ok = GetPageRange(offset, size, pageStart, pageSize);
+    if (ok) {
+        int32 syncFlags = MS_ASYNC;
+        if (wait) {
+            syncFlags = MS_SYNC;
+        }
+        ok = (msync(pageStart, static_cast<size_t>(pageSize), syncFlags) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicMappedFile: Failed msync()");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "BasicMappedFile: The range is not mapped");
+    }
+    return ok;
+}
+
+}
@@ -1,531 +1,1036 @@
-/**
- * @file BasicTCPSocket.cpp
- * @brief Source file for class BasicTCPSocket
- * @date 23/10/2015
- * @author Giuseppe Ferrò
- *
- * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
- * the Development of Fusion Energy ('Fusion for Energy').
- * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
- * by the European Commission - subsequent versions of the EUPL (the "Licence")
- * You may not use this work except in compliance with the Licence.
- * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
- *
- * @warning Unless required by applicable law or agreed to in writing, 
- * software distributed under the Licence is distributed on an "AS IS"
- * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
- * or implied. See the Licence permissions and limitations under the Licence.
-
- * @details This source file contains the definition of all the methods for
- * the class BasicTCPSocket (public, protected, and private). Be aware that some 
- * methods, such as those inline could be defined on the header file, instead.
- */
-
-/*---------------------------------------------------------------------------*/
-/*                         Standard header includes                          */
-/*---------------------------------------------------------------------------*/
-#include <signal.h>
-#include <sys/select.h>
-#include <sys/socket.h>
-#include <net/if.h>
-#include <netinet/in.h>
-#include <netdb.h>
-#include <sys/ioctl.h>
-#include <unistd.h>
-#include <errno.h>
-/*---------------------------------------------------------------------------*/
-/*                         Project header includes                           */
-/*---------------------------------------------------------------------------*/
-#include "BasicSocket.h"
-#include "BasicTCPSocket.h"
-#include "ErrorManagement.h"
-#include "Select.h"
-
-/*---------------------------------------------------------------------------*/
-/*                           Static definitions                              */
-/*---------------------------------------------------------------------------*/
-
-/*---------------------------------------------------------------------------*/
-/*                           Method definitions                              */
-/*---------------------------------------------------------------------------*/
-
-#define sock_errno()  errno
-
-namespace MARTe {
-
-BasicTCPSocket::BasicTCPSocket() :
-        BasicSocket() {
-
-    /*lint -e{1924} [MISRA C++ Rule 5-2-4]. Justification: C-style cast made at operating system API.*/
-    /*lint -e{923} [MISRA C++ Rule 5-2-7]. Justification: cast from integer to pointer made at operating system API level. */
-    if (signal(SIGPIPE, SIG_IGN) == SIG_ERR) {
-        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed signal() trying to ignore SIGPIPE signal");
-    }
-}
-
-BasicTCPSocket::~BasicTCPSocket() {
-
-}
-
-bool BasicTCPSocket::Open() {
-
-    /*lint -e{641} .Justification: The function socket returns an integer.*/
-    connectionSocket = socket(PF_INET, SOCK_STREAM, 0);
-    const int32 one = 1;
-    bool ret = false;
-    if (setsockopt(connectionSocket, SOL_SOCKET, SO_REUSEADDR, &one, static_cast<uint32>(sizeof(one))) >= 0) {
-        if (connectionSocket >= 0) {
-            ret = true;
-        }
-    }
-    else {
-        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed setsockopt() setting the address as reusable");
-
-    }
-    return ret;
-}
-
-bool BasicTCPSocket::Listen(const uint16 port,
-                            const int32 maxConnections) const {
-
-    bool ret = false;
-    if (IsValid()) {
-        InternetHost server;
-
-        server.SetPort(port);
-        /*lint -e{740} [MISRA C++ Rule 5-2-6], [MISRA C++ Rule 5-2-7]. Justification: Pointer to Pointer cast required by operating system API.*/
-        int32 errorCode = bind(connectionSocket, reinterpret_cast<struct sockaddr *>(server.GetInternetHost()), server.Size());
-
-        if (errorCode >= 0) {
-            errorCode = listen(connectionSocket, maxConnections);
-            if (errorCode >= 0) {
-                ret = true;
-            }
-            else {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed listen()");
-            }
-        }
-        else {
-
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed bind()");
-        }
-    }
-    else {
-        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
-    }
-
-    return ret;
-}
-
-bool BasicTCPSocket::Connect(const char8 * const address,
-                             const uint16 port,
-                             const TimeoutType &timeout) {
-    destination.SetPort(port);
-    bool ret = IsValid();
-    bool wasBlocking = IsBlocking();
-
-    if (ret) {
-
-        if (!destination.SetAddress(address)) {
-            if (!destination.SetAddressByHostName(address)) {
-                ret = false;
-            }
-        }
-        if (ret) {
-            source = destination;
-            if (timeout.IsFinite()) {
-                //set as unblocking if the timeout is finite.
-                if (wasBlocking) {
-                    ret = SetBlocking(false);
-                    if (!ret) {
-                        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Socket set to non-block mode failed.");
-                    }
-                }
-            }
-            if (ret) {
-                /*lint -e{740} [MISRA C++ Rule 5-2-6], [MISRA C++ Rule 5-2-7]. Justification: Pointer to Pointer cast required by operating system API.*/
-                int32 errorCode = connect(connectionSocket, reinterpret_cast<struct sockaddr *>(destination.GetInternetHost()), destination.Size());
-                if (errorCode < 0) {
-                    errorCode = sock_errno();
-                    switch (errorCode) {
-                    case (EINTR): {
-                        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: failed connect() because interrupted by a signal");
-                        ret = false;
-
-                    }
-                        break;
-                    case (EINPROGRESS): {
-                        if (timeout.IsFinite() || (!wasBlocking)) {
-                            Select sel;
-                            ret = sel.AddWriteHandle(*this);
-                            if (ret) {
-                                if (wasBlocking) {
-                                    ret = (sel.WaitUntil(timeout) > 0);
-                                }
-                                else {
-                                    ret = (sel.WaitUntil(0u) > 0);
-                                }
-                            }
-                            if (ret) {
-                                uint32 lon = static_cast<uint32>(sizeof(int32));
-                                int32 valopt;
-                                if (getsockopt(connectionSocket, SOL_SOCKET, SO_ERROR, static_cast<void*>(&valopt), &lon) < 0) {
-                                    ret = false;
-                                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: failed getsockopt() trying to check if the connection is alive");
-                                }
-                                else {
-                                    if (valopt > 0) {
-                                        REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "BasicTCPSocket: connection with timeout failed");
-                                        ret = false;
-                                    }
-                                }
-                            }
-                            else {
-                                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed connection on select().");
-                            }
-                        }
-                        else {
-                            ret = false;
-                            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed connect(); errno = EINPROGRESS");
-                        }
-
-                    }
-                        break;
-                    default: {
-                        ret = false;
-                        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed connect()");
-                    }
-                    }
-                }
-            }
-
-            if (timeout.IsFinite()) {
-                if (wasBlocking) {
-                    if (!SetBlocking(true)) {
-                        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: Socket reset to blocking mode failed");
-                        ret = false;
-                    }
-                }
-            }
-        }
-        else {
-            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: Failed setting the destination address");
-        }
-    }
-    else {
-        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
-    }
-
-    return ret;
-}
-
-bool BasicTCPSocket::IsConnected() const {
-
-    int32 ret = -1;
-    if (IsValid()) {
-        InternetHost information;
-
-        socklen_t len = information.Size();
-        /*lint -e{740} [MISRA C++ Rule 5-2-6], [MISRA C++ Rule 5-2-7]. Justification: Pointer to Pointer cast required by operating system API.*/
-        ret = getpeername(connectionSocket, reinterpret_cast<struct sockaddr *>(information.GetInternetHost()), &len);
-    }
-    else {
-        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
-    }
-    return (ret == 0);
-
-}
-
-BasicTCPSocket *BasicTCPSocket::WaitConnection(const TimeoutType &timeout,
-                                               BasicTCPSocket *client) {
-    BasicTCPSocket *ret = static_cast<BasicTCPSocket *>(NULL);
-
-    if (IsValid()) {
-        bool created=false;
-        bool wasBlocking = IsBlocking();
-
-        bool ok=true;
-        if (timeout.IsFinite()) {
-            if(wasBlocking) {
-                if(!SetBlocking(false)) {
-                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Socket set to non-block mode failed.");
-                    ok=false;
-                }
-            }
-        }
-
-        uint32 occasions=1u;
-        for(uint32 i=0u; (i<occasions) && (ok); i++) {
-            uint32 size = source.Size();
-            /*lint -e{740} [MISRA C++ Rule 5-2-6], [MISRA C++ Rule 5-2-7]. Justification: Pointer to Pointer cast required by operating system API.*/
-            int32 newSocket = accept(connectionSocket, reinterpret_cast<struct sockaddr *>(source.GetInternetHost()), reinterpret_cast<socklen_t *>(&size));
-
-            if (newSocket != -1) {
-                if (client == NULL) {
-                    client = new BasicTCPSocket();
-                    created=true;
-                }
-
-                client->SetDestination(source);
-                client->SetSource(source);
-                client->connectionSocket = newSocket;
-                ret = client;
-
-            }
-            else {
-                if (wasBlocking) {
-                    if (timeout.IsFinite()) {
-                        int32 errorCode;
-                        errorCode = sock_errno();
-                        if ((errorCode == 0) || (errorCode == EINPROGRESS) || (errorCode == EWOULDBLOCK)) {
-                            Select sel;
-                            if(sel.AddReadHandle(*this)) {
-                                if (sel.WaitUntil(timeout)>0) {
-                                    if(occasions==1u) {
-                                        occasions++;
-                                    }
-                                }
-                            }
-
-                        }
-                    }
-                    else {
-
-                        REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "BasicTCPSocket: Timeout expired");
-                    }
-                }
-                else {
-                    REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: Failed accept in unblocking mode");
-                }
-
-            }
-        }
-        if (timeout.IsFinite()) {
-            if(wasBlocking) {
-                if(!SetBlocking(true)) {
-                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Socket reset to non-block mode failed.");
-                    if(created) {
-                        delete client;
-                    }
-                    ret=static_cast<BasicTCPSocket *>(NULL);
-                }
-            }
-        }
-    }
-    else {
-
-        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
-    }
-
-    return ret;
-}
-
-bool BasicTCPSocket::Peek(char8* const buffer,
-                          uint32 &size) const {
-    int32 ret = -1;
-    uint32 sizeToRead = size;
-    size = 0u;
-
-    if (IsValid()) {
-        ret = static_cast<int32>(recv(connectionSocket, buffer, static_cast<size_t>(sizeToRead), MSG_PEEK));
-        if (ret > 0) {
-            /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
-            size = static_cast<uint32>(ret);
-        }
-    }
-    else {
-        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
-    }
-    return (ret > 0);
-}
-
-bool BasicTCPSocket::Read(char8* const output,
-                          uint32 &size) {
-    uint32 sizetoRead = size;
-    size = 0u;
-    int32 readBytes = 0;
-    if (IsValid()) {
-        readBytes = static_cast<int32>(recv(connectionSocket, output, static_cast<size_t>(sizetoRead), 0));
-
-        if (readBytes >= 0) {
-
-            /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
-            size = static_cast<uint32>(readBytes);
-        }
-        else {
-            bool ewouldblock = (sock_errno() == EWOULDBLOCK);
-            bool eagain = (sock_errno() == EAGAIN);
-            bool blocking = IsBlocking();
-            if ((ewouldblock || eagain) && (blocking)) {
-                REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "BasicTCPSocket: Timeout expired in recv()");
-            }
-            else {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed recv()");
-            }
-        }
-    }
-    else {
-        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
-    }
-    return (readBytes > 0);
-}
-
-bool BasicTCPSocket::Write(const char8* const input,
-                           uint32 &size) {
-    int32 writtenBytes = 0;
-    uint32 sizeToWrite = size;
-    size = 0u;
-    if (IsValid()) {
-        writtenBytes = static_cast<int32>(send(connectionSocket, input, static_cast<size_t>(sizeToWrite), 0));
-        if (writtenBytes >= 0) {
-
-            /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
-            size = static_cast<uint32>(writtenBytes);
-        }
-        else {
-            bool ewouldblock = (sock_errno() == EWOULDBLOCK);
-            bool eagain = (sock_errno() == EAGAIN);
-            bool blocking = IsBlocking();
-            if ((ewouldblock || eagain) && (blocking)) {
-                REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "BasicTCPSocket: Timeout expired in send()");
-            }
-            else {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed send()");
-            }
-        }
-    }
-    else {
-        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
-    }
-    return (writtenBytes > 0);
-}
-
-bool BasicTCPSocket::Read(char8* const output,
-                          uint32 &size,
-                          const TimeoutType &timeout) {
-
-    uint32 sizeToRead = size;
-    size = 0u;
-    if (IsValid()) {
-        if (timeout.IsFinite()) {
-
-            struct timeval timeoutVal;
-            /*lint -e{9117} -e{9114} -e{9125}  [MISRA C++ Rule 5-0-3] [MISRA C++ Rule 5-0-4]. Justification: the time structure requires a signed integer. */
-            timeoutVal.tv_sec = static_cast<int32>(timeout.GetTimeoutMSec() / 1000u);
-            /*lint -e{9117} -e{9114} -e{9125} [MISRA C++ Rule 5-0-3] [MISRA C++ Rule 5-0-4]. Justification: the time structure requires a signed integer. */
-            timeoutVal.tv_usec = static_cast<int32>((timeout.GetTimeoutMSec() % 1000u) * 1000u);
-            int32 ret = setsockopt(connectionSocket, SOL_SOCKET, SO_RCVTIMEO, &timeoutVal, static_cast<socklen_t>(sizeof(timeoutVal)));
-
-            if (ret < 0) {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed setsockopt() setting the socket timeout");
-            }
-            else {
-                if (BasicTCPSocket::Read(output, sizeToRead)) {
-                    size = sizeToRead;
-                }
-            }
-            timeoutVal.tv_sec = 0;
-            timeoutVal.tv_usec = 0;
-            if (setsockopt(connectionSocket, SOL_SOCKET, SO_RCVTIMEO, &timeoutVal, static_cast<socklen_t>(sizeof(timeoutVal))) < 0) {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed setsockopt() removing the socket timeout");
-            }
-        }
-
-        else {
-            struct timeval timeoutVal;
-
-            timeoutVal.tv_sec = 0;
-            timeoutVal.tv_usec = 0;
-            if (setsockopt(connectionSocket, SOL_SOCKET, SO_RCVTIMEO, &timeoutVal, static_cast<socklen_t>(sizeof(timeoutVal))) < 0) {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed setsockopt() removing the socket timeout");
-            }
-            if (BasicTCPSocket::Read(output, sizeToRead)) {
-                size = sizeToRead;
-            }
-        }
-    }
-    else {
-        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
-    }
-    return (size > 0u);
-}
-
-bool BasicTCPSocket::Write(const char8* const input,
-                           uint32 &size,
-                           const TimeoutType &timeout) {
-
-    uint32 sizeToWrite = size;
-    size = 0u;
-    if (IsValid()) {
-        if (timeout.IsFinite()) {
-            struct timeval timeoutVal;
-            /*lint -e{9117} -e{9114} -e{9125}  [MISRA C++ Rule 5-0-3] [MISRA C++ Rule 5-0-4]. Justification: the time structure requires a signed integer. */
-            timeoutVal.tv_sec = timeout.GetTimeoutMSec() / 1000u;
-            /*lint -e{9117} -e{9114} -e{9125}  [MISRA C++ Rule 5-0-3] [MISRA C++ Rule 5-0-4]. Justification: the time structure requires a signed integer. */
-            timeoutVal.tv_usec = (timeout.GetTimeoutMSec() % 1000u) * 1000u;
-            int32 ret = setsockopt(connectionSocket, SOL_SOCKET, SO_SNDTIMEO, &timeoutVal, static_cast<socklen_t>(sizeof(timeoutVal)));
-
-            if (ret < 0) {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed setsockopt() setting the socket timeoutVal");
-            }
-            else {
-                if (BasicTCPSocket::Write(input, sizeToWrite)) {
-                    size = sizeToWrite;
-                }
-            }
-            timeoutVal.tv_sec = 0;
-            timeoutVal.tv_usec = 0;
-            if (setsockopt(connectionSocket, SOL_SOCKET, SO_SNDTIMEO, &timeoutVal, static_cast<socklen_t>(sizeof(timeoutVal))) < 0) {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed setsockopt() removing the socket timeoutVal");
-            }
-        }
-        else {
-            if (BasicTCPSocket::Write(input, sizeToWrite)) {
-                size = sizeToWrite;
-            }
-        }
-    }
-
-    else {
-        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
-    }
-    return (size > 0u);
-}
-
-/*lint -e{715} [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: sockets cannot seek. */
-bool BasicTCPSocket::Seek(const uint64 pos) {
-    return false;
-}
-
-uint64 BasicTCPSocket::Size() {
-    return 0xffffffffffffffffu;
-}
-
-/*lint -e{715} [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: sockets cannot seek. */
-bool BasicTCPSocket::RelativeSeek(const int64 deltaPos) {
-    return false;
-}
-
-uint64 BasicTCPSocket::Position() {
-    return 0xffffffffffffffffu;
-}
-
-/*lint -e{715} [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the size of a socket is undefined. */
-bool BasicTCPSocket::SetSize(const uint64 size) {
-    return false;
-}
-
-bool BasicTCPSocket::CanWrite() const {
-    return true;
-}
-
-bool BasicTCPSocket::CanRead() const {
-    return true;
-}
-
-bool BasicTCPSocket::CanSeek() const {
-    return false;
-}
-
-}
-
+/**
+ * @file BasicTCPSocket.cpp
+ * @brief Source file for class BasicTCPSocket
+ * @date 23/10/2015
+ * @author Giuseppe Ferrò
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BasicTCPSocket (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <signal.h>
+#include <poll.h>
+#include <sys/select.h>
+#include <sys/sendfile.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <linux/errqueue.h>
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "BasicSocket.h"
+#include "BasicTCPSocket.h"
+#include "ErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "Select.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Waits until the socket is ready for the \a events or the \a deadline expires.
+ * @param[in] connectionSocket the socket.
+ * @param[in] events the poll events to wait for (POLLIN or POLLOUT).
+ * @param[in] deadline the HighResolutionTimer::Counter at which the wait expires.
+ * @return > 0 if the socket is ready, 0 if the deadline expired and < 0 in case of error.
+ */
+static MARTe::int32 BasicTCPSocketWait(const MARTe::SocketCore connectionSocket,
+                                       const MARTe::int16 events,
+                                       const MARTe::uint64 deadline) {
+    MARTe::int32 ret = -1;
+    bool retry = true;
+    while (retry) {
+        retry = false;
+        MARTe::uint64 now = MARTe::HighResolutionTimer::Counter();
+        MARTe::int32 timeoutMSec = 0;
+        if (now < deadline) {
+            //round up so that the deadline is not missed by less than one millisecond
+            MARTe::uint64 remaining = (((deadline - now) * 1000u) + (MARTe::HighResolutionTimer::Frequency() - 1u)) / MARTe::HighResolutionTimer::Frequency();
+            if (remaining > 0x7FFFFFFFu) {
+                remaining = 0x7FFFFFFFu;
+            }
+            timeoutMSec = static_cast<MARTe::int32>(remaining);
+        }
+        struct pollfd pollDescriptor;
+        pollDescriptor.fd = connectionSocket;
+        pollDescriptor.events = events;
+        pollDescriptor.revents = 0;
+        ret = poll(&pollDescriptor, 1u, timeoutMSec);
+        if (ret < 0) {
+            retry = (errno == EINTR);
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Computes the HighResolutionTimer::Counter at which a \a timeout started now expires.
+ */
+static MARTe::uint64 BasicTCPSocketDeadline(const MARTe::TimeoutType &timeout) {
+    MARTe::uint64 ticks = (static_cast<MARTe::uint64>(timeout.GetTimeoutMSec()) * MARTe::HighResolutionTimer::Frequency()) / 1000u;
+    return MARTe::HighResolutionTimer::Counter() + ticks;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+#define sock_errno()  errno
+
+namespace MARTe {
+
+BasicTCPSocket::BasicTCPSocket() :
+        BasicSocket() {
+    zeroCopyEnabled = false;
+    zeroCopySent = 0u;
+    zeroCopyCompleted = 0u;
+
+    /*lint -e{1924} [MISRA C++ Rule 5-2-4]. Justification: C-style cast made at operating system API.*/
+    /*lint -e{923} [MISRA C++ Rule 5-2-7]. Justification: cast from integer to pointer made at operating system API level. */
+    if (signal(SIGPIPE, SIG_IGN) == SIG_ERR) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed signal() trying to ignore SIGPIPE signal");
+    }
+}
+
+BasicTCPSocket::~BasicTCPSocket() {
+
+}
+
+bool BasicTCPSocket::Open() {
+
+    /*lint -e{641} .Justification: The function socket returns an integer.*/
+    connectionSocket = socket(PF_INET, SOCK_STREAM, 0);
+    const int32 one = 1;
+    bool ret = false;
+    if (setsockopt(connectionSocket, SOL_SOCKET, SO_REUSEADDR, &one, static_cast<uint32>(sizeof(one))) >= 0) {
+        if (connectionSocket >= 0) {
+            ret = true;
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed setsockopt() setting the address as reusable");
+
+    }
+    return ret;
+}
+
+bool BasicTCPSocket::Listen(const uint16 port,
+                            const int32 maxConnections) const {
+
+    bool ret = false;
+    if (IsValid()) {
+        InternetHost server;
+
+        server.SetPort(port);
+        /*lint -e{740} [MISRA C++ Rule 5-2-6], [MISRA C++ Rule 5-2-7]. Justification: Pointer to Pointer cast required by operating system API.*/
+        int32 errorCode = bind(connectionSocket, reinterpret_cast<struct sockaddr *>(server.GetInternetHost()), server.Size());
+
+        if (errorCode >= 0) {
+            errorCode = listen(connectionSocket, maxConnections);
+            if (errorCode >= 0) {
+                ret = true;
+            }
+            else {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed listen()");
+            }
+        }
+        else {
+
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed bind()");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+
+    return ret;
+}
+
+bool BasicTCPSocket::Connect(const char8 * const address,
+                             const uint16 port,
+                             const TimeoutType &timeout) {
+    destination.SetPort(port);
+    bool ret = IsValid();
+    bool wasBlocking = IsBlocking();
+
+    if (ret) {
+
+        if (!destination.SetAddress(address)) {
+            if (!destination.SetAddressByHostName(address)) {
+                ret = false;
+            }
+        }
+        if (ret) {
+            source = destination;
+            if (timeout.IsFinite()) {
+                //set as unblocking if the timeout is finite.
+                if (wasBlocking) {
+                    ret = SetBlocking(false);
+                    if (!ret) {
+                        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Socket set to non-block mode failed.");
+                    }
+                }
+            }
+            if (ret) {
+                /*lint -e{740} [MISRA C++ Rule 5-2-6], [MISRA C++ Rule 5-2-7]. Justification: Pointer to Pointer cast required by operating system API.*/
+                int32 errorCode = connect(connectionSocket, reinterpret_cast<struct sockaddr *>(destination.GetInternetHost()), destination.Size());
+                if (errorCode < 0) {
+                    errorCode = sock_errno();
+                    switch (errorCode) {
+                    case (EINTR): {
+                        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: failed connect() because interrupted by a signal");
+                        ret = false;
+
+                    }
+                        break;
+                    case (EINPROGRESS): {
+                        if (timeout.IsFinite() || (!wasBlocking)) {
+                            Select sel;
+                            ret = sel.AddWriteHandle(*this);
+                            if (ret) {
+                                if (wasBlocking) {
+                                    ret = (sel.WaitUntil(timeout) > 0);
+                                }
+                                else {
+                                    ret = (sel.WaitUntil(0u) > 0);
+                                }
+                            }
+                            if (ret) {
+                                uint32 lon = static_cast<uint32>(sizeof(int32));
+                                int32 valopt;
+                                if (getsockopt(connectionSocket, SOL_SOCKET, SO_ERROR, static_cast<void*>(&valopt), &lon) < 0) {
+                                    ret = false;
+                                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: failed getsockopt() trying to check if the connection is alive");
+                                }
+                                else {
+                                    if (valopt > 0) {
+                                        REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "BasicTCPSocket: connection with timeout failed");
+                                        ret = false;
+                                    }
+                                }
+                            }
+                            else {
+                                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed connection on select().");
+                            }
+                        }
+                        else {
+                            ret = false;
+                            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed connect(); errno = EINPROGRESS");
+                        }
+
+                    }
+                        break;
+                    default: {
+                        ret = false;
+                        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed connect()");
+                    }
+                    }
+                }
+            }
+
+            if (timeout.IsFinite()) {
+                if (wasBlocking) {
+                    if (!SetBlocking(true)) {
+                        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: Socket reset to blocking mode failed");
+                        ret = false;
+                    }
+                }
+            }
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: Failed setting the destination address");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+
+    return ret;
+}
+
+bool BasicTCPSocket::IsConnected() const {
+
+    int32 ret = -1;
+    if (IsValid()) {
+        InternetHost information;
+
+        socklen_t len = information.Size();
+        /*lint -e{740} [MISRA C++ Rule 5-2-6], [MISRA C++ Rule 5-2-7]. Justification: Pointer to Pointer cast required by operating system API.*/
+        ret = getpeername(connectionSocket, reinterpret_cast<struct sockaddr *>(information.GetInternetHost()), &len);
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return (ret == 0);
+
+}
+
+bool BasicTCPSocket::Shutdown() {
+    int32 ret = -1;
+    if (IsValid()) {
+        ret = shutdown(connectionSocket, SHUT_RDWR);
+        if (ret < 0) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed shutdown()");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return (ret == 0);
+}
+
+bool BasicTCPSocket::SendFile(const BasicFile &file,
+                              const uint64 offset,
+                              uint64 &size) {
+    uint64 sizeToSend = size;
+    size = 0u;
+    bool ret = IsValid();
+    if (ret) {
+        off_t fileOffset = static_cast<off_t>(offset);
+        while ((ret) && (size < sizeToSend)) {
+            //sendfile transfers at most 0x7ffff000 bytes per call (and size_t may be 32 bits)
+            uint64 chunkSize = (sizeToSend - size);
+            if (chunkSize > 0x40000000u) {
+                chunkSize = 0x40000000u;
+            }
+            ssize_t sentBytes = sendfile(connectionSocket, file.GetReadHandle(), &fileOffset, static_cast<size_t>(chunkSize));
+            if (sentBytes > 0) {
+                /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
+                size += static_cast<uint64>(sentBytes);
+            }
+            else if (sentBytes == 0) {
+                ret = false;
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: The file ended before all the bytes were sent");
+            }
+            else if (sock_errno() == EINTR) {
+                //Try again
+            }
+            else {
+                ret = false;
+                bool ewouldblock = (sock_errno() == EWOULDBLOCK);
+                bool eagain = (sock_errno() == EAGAIN);
+                bool blocking = IsBlocking();
+                if ((ewouldblock || eagain) && (blocking)) {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "BasicTCPSocket: Timeout expired in sendfile()");
+                }
+                else {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed sendfile()");
+                }
+            }
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return ret;
+}
+
+bool BasicTCPSocket::WriteVector(const char8 * const * const buffers,
+                                 const uint32 * const sizes,
+                                 const uint32 numberOfBuffers,
+                                 uint32 &size,
+                                 const TimeoutType &timeout) {
+    size = 0u;
+    bool ok = IsValid();
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    if ((ok) && (numberOfBuffers > BASIC_TCP_SOCKET_MAX_VECTORS)) {
+        ok = false;
+        REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "BasicTCPSocket: Too many buffers for WriteVector");
+    }
+    uint32 sizeToWrite = 0u;
+    uint32 i;
+    if (ok) {
+        for (i = 0u; i < numberOfBuffers; i++) {
+            sizeToWrite += sizes[i];
+        }
+    }
+    bool blocking = IsBlocking();
+    //As in Write, with a finite timeout wait with poll() instead of changing SO_SNDTIMEO
+    bool finite = ((timeout.IsFinite()) && (blocking));
+    uint64 deadline = 0u;
+    int32 flags = 0;
+    if (finite) {
+        deadline = BasicTCPSocketDeadline(timeout);
+        flags = MSG_DONTWAIT;
+    }
+    bool done = (sizeToWrite == 0u);
+    struct iovec vectors[BASIC_TCP_SOCKET_MAX_VECTORS];
+    while ((ok) && (!done)) {
+        //Skip what was already written
+        uint32 skip = size;
+        uint32 numberOfVectors = 0u;
+        for (i = 0u; i < numberOfBuffers; i++) {
+            if (skip >= sizes[i]) {
+                skip -= sizes[i];
+            }
+            else {
+                /*lint -e{9005} -e{1773} the buffer is only read by sendmsg()*/
+                vectors[numberOfVectors].iov_base = const_cast<char8 *>(&buffers[i][skip]);
+                vectors[numberOfVectors].iov_len = static_cast<size_t>(sizes[i] - skip);
+                numberOfVectors++;
+                skip = 0u;
+            }
+        }
+        struct msghdr message;
+        (void) memset(&message, 0, sizeof(message));
+        message.msg_iov = &vectors[0];
+        message.msg_iovlen = numberOfVectors;
+        ssize_t writtenBytes = sendmsg(connectionSocket, &message, flags);
+        if (writtenBytes >= 0) {
+            /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
+            size += static_cast<uint32>(writtenBytes);
+            done = ((size == sizeToWrite) || (!blocking));
+        }
+        else if (sock_errno() == EINTR) {
+            //Try again
+        }
+        else if (((sock_errno() == EWOULDBLOCK) || (sock_errno() == EAGAIN)) && (finite)) {
+            int32 ready = BasicTCPSocketWait(connectionSocket, POLLOUT, deadline);
+            if (ready == 0) {
+                ok = false;
+                REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "BasicTCPSocket: Timeout expired in sendmsg()");
+            }
+            else if (ready < 0) {
+                ok = false;
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed poll()");
+            }
+            else {
+                //Ready to write
+            }
+        }
+        else {
+            ok = false;
+            bool ewouldblock = (sock_errno() == EWOULDBLOCK);
+            bool eagain = (sock_errno() == EAGAIN);
+            if ((ewouldblock || eagain) && (blocking)) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "BasicTCPSocket: Timeout expired in sendmsg()");
+            }
+            else {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed sendmsg()");
+            }
+        }
+    }
+    return ok;
+}
+
+BasicTCPSocket *BasicTCPSocket::WaitConnection(const TimeoutType &timeout,
+                                               BasicTCPSocket *client) {
+    BasicTCPSocket *ret = static_cast<BasicTCPSocket *>(NULL);
+
+    if (IsValid()) {
+        bool created=false;
+        bool wasBlocking = IsBlocking();
+
+        bool ok=true;
+        if (timeout.IsFinite()) {
+            if(wasBlocking) {
+                if(!SetBlocking(false)) {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Socket set to non-block mode failed.");
+                    ok=false;
+                }
+            }
+        }
+
+        uint32 occasions=1u;
+        for(uint32 i=0u; (i<occasions) && (ok); i++) {
+            uint32 size = source.Size();
+            /*lint -e{740} [MISRA C++ Rule 5-2-6], [MISRA C++ Rule 5-2-7]. Justification: Pointer to Pointer cast required by operating system API.*/
+            int32 newSocket = accept(connectionSocket, reinterpret_cast<struct sockaddr *>(source.GetInternetHost()), reinterpret_cast<socklen_t *>(&size));
+
+            if (newSocket != -1) {
+                if (client == NULL) {
+                    client = new BasicTCPSocket();
+                    created=true;
+                }
+
+                client->SetDestination(source);
+                client->SetSource(source);
+                client->connectionSocket = newSocket;
+                client->zeroCopyEnabled = false;
+                client->zeroCopySent = 0u;
+                client->zeroCopyCompleted = 0u;
+                ret = client;
+
+            }
+            else {
+                if (wasBlocking) {
+                    if (timeout.IsFinite()) {
+                        int32 errorCode;
+                        errorCode = sock_errno();
+                        if ((errorCode == 0) || (errorCode == EINPROGRESS) || (errorCode == EWOULDBLOCK)) {
+                            Select sel;
+                            if(sel.AddReadHandle(*this)) {
+                                if (sel.WaitUntil(timeout)>0) {
+                                    if(occasions==1u) {
+                                        occasions++;
+                                    }
+                                }
+                            }
+
+                        }
+                    }
+                    else {
+
+                        REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "BasicTCPSocket: Timeout expired");
+                    }
+                }
+                else {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: Failed accept in unblocking mode");
+                }
+
+            }
+        }
+        if (timeout.IsFinite()) {
+            if(wasBlocking) {
+                if(!SetBlocking(true)) {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Socket reset to non-block mode failed.");
+                    if(created) {
+                        delete client;
+                    }
+                    ret=static_cast<BasicTCPSocket *>(NULL);
+                }
+            }
+        }
+    }
+    else {
+
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+
+    return ret;
+}
+
+bool BasicTCPSocket::Peek(char8* const buffer,
+                          uint32 &size) const {
+    int32 ret = -1;
+    uint32 sizeToRead = size;
+    size = 0u;
+
+    if (IsValid()) {
+        ret = static_cast<int32>(recv(connectionSocket, buffer, static_cast<size_t>(sizeToRead), MSG_PEEK));
+        if (ret > 0) {
+            /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
+            size = static_cast<uint32>(ret);
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return (ret > 0);
+}
+
+bool BasicTCPSocket::Read(char8* const output,
+                          uint32 &size) {
+    uint32 sizetoRead = size;
+    size = 0u;
+    int32 readBytes = 0;
+    if (IsValid()) {
+        readBytes = static_cast<int32>(recv(connectionSocket, output, static_cast<size_t>(sizetoRead), 0));
+
+        if (readBytes >= 0) {
+
+            /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
+            size = static_cast<uint32>(readBytes);
+        }
+        else {
+            bool ewouldblock = (sock_errno() == EWOULDBLOCK);
+            bool eagain = (sock_errno() == EAGAIN);
+            bool blocking = IsBlocking();
+            if ((ewouldblock || eagain) && (blocking)) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "BasicTCPSocket: Timeout expired in recv()");
+            }
+            else {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed recv()");
+            }
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return (readBytes > 0);
+}
+
+bool BasicTCPSocket::Write(const char8* const input,
+                           uint32 &size) {
+    int32 writtenBytes = 0;
+    uint32 sizeToWrite = size;
+    size = 0u;
+    if (IsValid()) {
+        writtenBytes = static_cast<int32>(send(connectionSocket, input, static_cast<size_t>(sizeToWrite), 0));
+        if (writtenBytes >= 0) {
+
+            /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
+            size = static_cast<uint32>(writtenBytes);
+        }
+        else {
+            bool ewouldblock = (sock_errno() == EWOULDBLOCK);
+            bool eagain = (sock_errno() == EAGAIN);
+            bool blocking = IsBlocking();
+            if ((ewouldblock || eagain) && (blocking)) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "BasicTCPSocket: Timeout expired in send()");
+            }
+            else {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed send()");
+            }
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return (writtenBytes > 0);
+}
+
+bool BasicTCPSocket::Read(char8* const output,
+                          uint32 &size,
+                          const TimeoutType &timeout) {
+
+    uint32 sizeToRead = size;
+    size = 0u;
+    if (IsValid()) {
+        if ((timeout.IsFinite()) && (IsBlocking())) {
+            //The data already received is read without waiting. Otherwise wait with poll() instead of changing SO_RCVTIMEO,
+            //so that the socket option is never modified.
+            uint64 deadline = BasicTCPSocketDeadline(timeout);
+            bool retry = true;
+            while (retry) {
+                retry = false;
+                ssize_t readBytes = recv(connectionSocket, output, static_cast<size_t>(sizeToRead), MSG_DONTWAIT);
+                if (readBytes >= 0) {
+                    /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
+                    size = static_cast<uint32>(readBytes);
+                }
+                else if (sock_errno() == EINTR) {
+                    retry = true;
+                }
+                else if ((sock_errno() == EWOULDBLOCK) || (sock_errno() == EAGAIN)) {
+                    int32 ready = BasicTCPSocketWait(connectionSocket, POLLIN, deadline);
+                    if (ready > 0) {
+                        retry = true;
+                    }
+                    else if (ready == 0) {
+                        REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "BasicTCPSocket: Timeout expired in recv()");
+                    }
+                    else {
+                        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed poll()");
+                    }
+                }
+                else {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed recv()");
+                }
+            }
+        }
+        else {
+            //If the socket is in non-block mode, the timeout has no meaning
+            if (BasicTCPSocket::Read(output, sizeToRead)) {
+                size = sizeToRead;
+            }
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return (size > 0u);
+}
+
+bool BasicTCPSocket::Write(const char8* const input,
+                           uint32 &size,
+                           const TimeoutType &timeout) {
+
+    uint32 sizeToWrite = size;
+    size = 0u;
+    if (IsValid()) {
+        if ((timeout.IsFinite()) && (IsBlocking())) {
+            //As a blocking send() with SO_SNDTIMEO, write until all the bytes are sent or the timeout expires.
+            uint64 deadline = BasicTCPSocketDeadline(timeout);
+            bool ok = true;
+            while ((ok) && (size < sizeToWrite)) {
+                ssize_t writtenBytes = send(connectionSocket, &input[size], static_cast<size_t>(sizeToWrite - size), MSG_DONTWAIT);
+                if (writtenBytes >= 0) {
+                    /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
+                    size += static_cast<uint32>(writtenBytes);
+                }
+                else if (sock_errno() == EINTR) {
+                    //Try again
+                }
+                else if ((sock_errno() == EWOULDBLOCK) || (sock_errno() == EAGAIN)) {
+                    int32 ready = BasicTCPSocketWait(connectionSocket, POLLOUT, deadline);
+                    if (ready == 0) {
+                        ok = false;
+                        REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "BasicTCPSocket: Timeout expired in send()");
+                    }
+                    else if (ready < 0) {
+                        ok = false;
+                        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed poll()");
+                    }
+                    else {
+                        //Ready to write
+                    }
+                }
+                else {
+                    ok = false;
+                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed send()");
+                }
+            }
+        }
+        else {
+            if (BasicTCPSocket::Write(input, sizeToWrite)) {
+                size = sizeToWrite;
+            }
+        }
+    }
+
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return (size > 0u);
+}
+
+bool BasicTCPSocket::SetNoDelay(const bool flag) {
+    bool ok = IsValid();
+    if (ok) {
+        int32 value = 0;
+        if (flag) {
+            value = 1;
+        }
+        ok = (setsockopt(connectionSocket, IPPROTO_TCP, TCP_NODELAY, &value, static_cast<socklen_t>(sizeof(value))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed setsockopt() setting TCP_NODELAY");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return ok;
+}
+
+bool BasicTCPSocket::SetCork(const bool flag) {
+    bool ok = IsValid();
+    if (ok) {
+#ifdef TCP_CORK
+        int32 value = 0;
+        if (flag) {
+            value = 1;
+        }
+        ok = (setsockopt(connectionSocket, IPPROTO_TCP, TCP_CORK, &value, static_cast<socklen_t>(sizeof(value))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed setsockopt() setting TCP_CORK");
+        }
+#else
+        ok = false;
+        REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "BasicTCPSocket: TCP_CORK is not supported");
+#endif
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return ok;
+}
+
+bool BasicTCPSocket::GetSendBufferSize(uint32 &size) {
+    bool ok = IsValid();
+    if (ok) {
+        int32 value = 0;
+        socklen_t valueSize = static_cast<socklen_t>(sizeof(value));
+        ok = (getsockopt(connectionSocket, SOL_SOCKET, SO_SNDBUF, &value, &valueSize) >= 0);
+        if (ok) {
+            ok = (value > 0);
+        }
+        if (ok) {
+            size = static_cast<uint32>(value);
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed getsockopt() reading SO_SNDBUF");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return ok;
+}
+
+bool BasicTCPSocket::SetQuickAck(const bool flag) {
+    bool ok = IsValid();
+    if (ok) {
+#ifdef TCP_QUICKACK
+        int32 value = 0;
+        if (flag) {
+            value = 1;
+        }
+        ok = (setsockopt(connectionSocket, IPPROTO_TCP, TCP_QUICKACK, &value, static_cast<socklen_t>(sizeof(value))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed setsockopt() setting TCP_QUICKACK");
+        }
+#else
+        ok = false;
+        REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "BasicTCPSocket: TCP_QUICKACK is not supported");
+#endif
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return ok;
+}
+
+bool BasicTCPSocket::SetBusyPoll(const uint32 microseconds) {
+    bool ok = IsValid();
+    if (ok) {
+#ifdef SO_BUSY_POLL
+        int32 value = static_cast<int32>(microseconds);
+        ok = (setsockopt(connectionSocket, SOL_SOCKET, SO_BUSY_POLL, &value, static_cast<socklen_t>(sizeof(value))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed setsockopt() setting SO_BUSY_POLL");
+        }
+#else
+        ok = false;
+        REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "BasicTCPSocket: SO_BUSY_POLL is not supported");
+#endif
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return ok;
+}
+
+bool BasicTCPSocket::SetZeroCopy() {
+    bool ok = IsValid();
+    if (ok) {
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+        int32 one = 1;
+        ok = (setsockopt(connectionSocket, SOL_SOCKET, SO_ZEROCOPY, &one, static_cast<socklen_t>(sizeof(one))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed setsockopt() setting SO_ZEROCOPY");
+        }
+#else
+        ok = false;
+        REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "BasicTCPSocket: SO_ZEROCOPY is not supported");
+#endif
+        zeroCopyEnabled = ok;
+        zeroCopySent = 0u;
+        zeroCopyCompleted = 0u;
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return ok;
+}
+
+bool BasicTCPSocket::WriteZeroCopy(const char8* const input,
+                                   uint32 &size,
+                                   uint32 &sequence) {
+    bool ok = IsValid();
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+    if ((ok) && (zeroCopyEnabled)) {
+        uint32 sizeToWrite = size;
+        size = 0u;
+        bool sent = false;
+        while ((ok) && (size < sizeToWrite)) {
+            ssize_t writtenBytes = send(connectionSocket, &input[size], static_cast<size_t>(sizeToWrite - size), MSG_ZEROCOPY);
+            if (writtenBytes >= 0) {
+                /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
+                size += static_cast<uint32>(writtenBytes);
+                //Each successful call gets its own notification identifier
+                zeroCopySent++;
+                sent = true;
+            }
+            else if (sock_errno() == EINTR) {
+                //Try again
+            }
+            else if ((sock_errno() == ENOBUFS) && (sent)) {
+                //The optmem limit is reached by the pinned pages: release the completed ones and try again
+                ok = WaitZeroCopyCompleted(zeroCopySent - 1u);
+            }
+            else {
+                ok = false;
+                bool ewouldblock = (sock_errno() == EWOULDBLOCK);
+                bool eagain = (sock_errno() == EAGAIN);
+                if ((ewouldblock || eagain) && (IsBlocking())) {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "BasicTCPSocket: Timeout expired in send()");
+                }
+                else {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed send() with MSG_ZEROCOPY");
+                }
+            }
+        }
+        //The buffer is released when the last send() is completed
+        sequence = zeroCopySent - 1u;
+        if (!sent) {
+            ok = false;
+        }
+    }
+    else
+#endif
+    if (ok) {
+        ok = BasicTCPSocket::Write(input, size);
+        //Already copied: the sequence is always completed
+        sequence = zeroCopyCompleted - 1u;
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return ok;
+}
+
+bool BasicTCPSocket::ReadZeroCopyCompletions() {
+    bool ok = true;
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+    bool pending = true;
+    while ((ok) && (pending)) {
+        char8 control[128];
+        struct msghdr message;
+        (void) memset(&message, 0, sizeof(message));
+        message.msg_control = &control[0];
+        message.msg_controllen = sizeof(control);
+        ssize_t ret = recvmsg(connectionSocket, &message, MSG_ERRQUEUE | MSG_DONTWAIT);
+        if (ret >= 0) {
+            /*lint -e{9079} -e{826} [MISRA C++ Rule 5-2-8]. Justification: control message parsing required by operating system API.*/
+            for (struct cmsghdr *cm = CMSG_FIRSTHDR(&message); cm != NULL; cm = CMSG_NXTHDR(&message, cm)) {
+                bool isRecvErr = ((cm->cmsg_level == SOL_IP) && (cm->cmsg_type == IP_RECVERR));
+                isRecvErr = isRecvErr || ((cm->cmsg_level == SOL_IPV6) && (cm->cmsg_type == IPV6_RECVERR));
+                if (isRecvErr) {
+                    const struct sock_extended_err *extendedError = reinterpret_cast<const struct sock_extended_err *>(CMSG_DATA(cm));
+                    if ((extendedError->ee_errno == 0u) && (extendedError->ee_origin == SO_EE_ORIGIN_ZEROCOPY)) {
+                        //[ee_info, ee_data] is the range of completed calls; TCP notifies them in order
+                        uint32 next = extendedError->ee_data + 1u;
+                        if (static_cast<int32>(next - zeroCopyCompleted) > 0) {
+                            zeroCopyCompleted = next;
+                        }
+                    }
+                }
+            }
+        }
+        else if (sock_errno() == EINTR) {
+            //Try again
+        }
+        else {
+            pending = false;
+            if ((sock_errno() != EWOULDBLOCK) && (sock_errno() != EAGAIN)) {
+                ok = false;
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed recvmsg() on the error queue");
+            }
+        }
+    }
+#endif
+    return ok;
+}
+
+bool BasicTCPSocket::IsZeroCopyCompleted(const uint32 sequence) {
+    bool completed = (static_cast<int32>(zeroCopyCompleted - sequence) > 0);
+    if (!completed) {
+        if (ReadZeroCopyCompletions()) {
+            completed = (static_cast<int32>(zeroCopyCompleted - sequence) > 0);
+        }
+    }
+    return completed;
+}
+
+bool BasicTCPSocket::WaitZeroCopyCompleted(const uint32 sequence,
+                                           const TimeoutType &timeout) {
+    bool ok = IsValid();
+    bool completed = false;
+    if (ok) {
+        uint64 deadline = 0u;
+        if (timeout.IsFinite()) {
+            deadline = BasicTCPSocketDeadline(timeout);
+        }
+        while ((ok) && (!completed)) {
+            completed = IsZeroCopyCompleted(sequence);
+            if (!completed) {
+                //The completions are signalled as POLLERR, which is always polled
+                int32 ready = 0;
+                if (timeout.IsFinite()) {
+                    ready = BasicTCPSocketWait(connectionSocket, 0, deadline);
+                }
+                else {
+                    struct pollfd pollDescriptor;
+                    pollDescriptor.fd = connectionSocket;
+                    pollDescriptor.events = 0;
+                    pollDescriptor.revents = 0;
+                    ready = poll(&pollDescriptor, 1u, -1);
+                    if ((ready < 0) && (errno == EINTR)) {
+                        ready = 1;
+                    }
+                }
+                if (ready == 0) {
+                    ok = false;
+                    REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "BasicTCPSocket: Timeout expired waiting for the zero-copy completion");
+                }
+                else if (ready < 0) {
+                    ok = false;
+                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed poll()");
+                }
+                else {
+                    //Notification ready
+                }
+            }
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+    return completed;
+}
+
+/*lint -e{715} [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: sockets cannot seek. */
+bool BasicTCPSocket::Seek(const uint64 pos) {
+    return false;
+}
+
+uint64 BasicTCPSocket::Size() {
+    return 0xffffffffffffffffu;
+}
+
+/*lint -e{715} [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: sockets cannot seek. */
+bool BasicTCPSocket::RelativeSeek(const int64 deltaPos) {
+    return false;
+}
+
+uint64 BasicTCPSocket::Position() {
+    return 0xffffffffffffffffu;
+}
+
+/*lint -e{715} [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the size of a socket is undefined. */
+bool BasicTCPSocket::SetSize(const uint64 size) {
+    return false;
+}
+
+bool BasicTCPSocket::CanWrite() const {
+    return true;
+}
+
+bool BasicTCPSocket::CanRead() const {
+    return true;
+}
+
+bool BasicTCPSocket::CanSeek() const {
+    return false;
+}
+
+}
+
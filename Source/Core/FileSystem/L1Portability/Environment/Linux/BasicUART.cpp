@@ -25,11 +25,15 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <linux/serial.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "BasicUART.h"
+#include "HighResolutionTimer.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -66,6 +70,50 @@ const SpeedTable speedTable[] = {
                                 { B4000000, 4000000u }
                                 };
 
+/**
+ * The termios2 structure of the Linux kernel (asm/termbits.h cannot be included together with termios.h),
+ * which allows to set any speed with BOTHER.
+ */
+struct BasicUARTTermios2 {
+    MARTe::uint32 c_iflag;
+    MARTe::uint32 c_oflag;
+    MARTe::uint32 c_cflag;
+    MARTe::uint32 c_lflag;
+    MARTe::uint8 c_line;
+    MARTe::uint8 c_cc[19];
+    MARTe::uint32 c_ispeed;
+    MARTe::uint32 c_ospeed;
+};
+
+#if defined(TCGETS2) && defined(_IOR) && defined(_IOW)
+#define BASIC_UART_TCGETS2 _IOR('T', 0x2A, struct BasicUARTTermios2)
+#define BASIC_UART_TCSETS2 _IOW('T', 0x2B, struct BasicUARTTermios2)
+#define BASIC_UART_BOTHER 0010000u
+#define BASIC_UART_CBAUD 0010017u
+#endif
+
+/**
+ * @brief Sets (or clears) ASYNC_LOW_LATENCY on the serial driver.
+ */
+static bool BasicUARTApplyLowLatency(const MARTe::int32 fileDescriptor,
+                                     const bool lowLatency) {
+    bool ok = false;
+#ifdef ASYNC_LOW_LATENCY
+    struct serial_struct serial;
+    ok = (ioctl(fileDescriptor, TIOCGSERIAL, &serial) == 0);
+    if (ok) {
+        if (lowLatency) {
+            serial.flags |= ASYNC_LOW_LATENCY;
+        }
+        else {
+            serial.flags &= ~ASYNC_LOW_LATENCY;
+        }
+        ok = (ioctl(fileDescriptor, TIOCSSERIAL, &serial) == 0);
+    }
+#endif
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -77,6 +125,8 @@ BasicUART::BasicUART() {
     
     properties.fileDescriptor = -1;
     properties.speedCode = B19200;
+    properties.customSpeed = 0u;
+    properties.lowLatency = false;
     FD_ZERO(&properties.readFDS);
     FD_ZERO(&properties.readFDS_done);
     FD_ZERO(&properties.writeFDS);
@@ -99,7 +149,16 @@ bool BasicUART::SetSpeed(const uint32 speed) {
             ix++;
         }
         properties.speedCode = speedTable[ix].code;
+        properties.customSpeed = 0u;
         ok = (speed == speedTable[ix].speed);
+#ifdef BASIC_UART_TCSETS2
+        if ((!ok) && (speed > 0u)) {
+            //Set with termios2 after the other parameters, see Open
+            properties.speedCode = B38400;
+            properties.customSpeed = speed;
+            ok = true;
+        }
+#endif
     }
 
     return ok;
@@ -221,6 +280,30 @@ bool BasicUART::Open(const char8* name) {
             REPORT_ERROR_STATIC(errorCode, "BasicUART::Open - %s serial device "
                 "parameters.", ok ? "successfully set" : "could not set");
         }
+#ifdef BASIC_UART_TCSETS2
+        if ((ok) && (properties.customSpeed > 0u)) {
+            struct BasicUARTTermios2 tio2;
+            ok = (ioctl(properties.fileDescriptor, BASIC_UART_TCGETS2, &tio2) == 0);
+            if (ok) {
+                tio2.c_cflag &= ~BASIC_UART_CBAUD;
+                tio2.c_cflag |= BASIC_UART_BOTHER;
+                tio2.c_ispeed = properties.customSpeed;
+                tio2.c_ospeed = properties.customSpeed;
+                ok = (ioctl(properties.fileDescriptor, BASIC_UART_TCSETS2, &tio2) == 0);
+            }
+            errorCode = ok ? ErrorManagement::Information :
+                        ErrorManagement::OSError;
+            REPORT_ERROR_STATIC(errorCode, "BasicUART::Open - %s serial device "
+                "custom speed to %u.", ok ? "successfully set" : "could not set",
+                properties.customSpeed);
+        }
+#endif
+        if ((ok) && (properties.lowLatency)) {
+            if (!BasicUARTApplyLowLatency(properties.fileDescriptor, true)) {
+                REPORT_ERROR_STATIC(ErrorManagement::Warning, "BasicUART::Open - "
+                    "the driver of %s does not support the low latency mode.", name);
+            }
+        }
     }
 
     return ok;
@@ -241,6 +324,21 @@ void BasicUART::Close() {
 
 }
 
+bool BasicUART::SetLowLatency(const bool flag) {
+
+    bool ok = true;
+    properties.lowLatency = flag;
+    if (properties.fileDescriptor != -1) {
+        ok = BasicUARTApplyLowLatency(properties.fileDescriptor, flag);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "BasicUART::SetLowLatency - "
+                "could not %s the low latency mode.", flag ? "set" : "clear");
+        }
+    }
+
+    return ok;
+}
+
 /*lint -e{952} [MISRA C++ Rule 7-1-1]. Justification: Parameter 'buffer' kept
         as non const.*/
 /*lint -e{1762} [MISRA C++ Rule 9-3-3]. Justification: Member function :Read()
@@ -326,6 +424,42 @@ bool BasicUART::Write(char8 *buffer, uint32 size) {
     return ok;
 }
 
+/*lint -e{952} [MISRA C++ Rule 7-1-1]. Justification: Parameter 'buffer' kept
+        as non const.*/
+bool BasicUART::ReadAvailable(char8* buffer, uint32 &size, const uint32 timeoutUsec, uint64 &timestamp) {
+
+    uint32 capacity = size;
+    size = 0u;
+    struct pollfd pollDescriptor;
+    pollDescriptor.fd = properties.fileDescriptor;
+    pollDescriptor.events = POLLIN;
+    pollDescriptor.revents = 0;
+    //Round up so that a timeout shorter than one millisecond still waits
+    int32 timeoutMSec = static_cast<int32>((timeoutUsec + 999u) / 1000u);
+    int32 readyCount = poll(&pollDescriptor, 1u, timeoutMSec);
+    timestamp = HighResolutionTimer::Counter();
+    bool ok = (readyCount > 0);
+    //The descriptor is non-blocking: read until the driver has no more bytes
+    while ((ok) && (size < capacity)) {
+        ssize_t readBytes = read(properties.fileDescriptor, &buffer[size], static_cast<size_t>(capacity - size));
+        if (readBytes > 0) {
+            size += static_cast<uint32>(readBytes);
+        }
+        else if ((readBytes < 0) && (errno == EINTR)) {
+            //Try again
+        }
+        else {
+            if ((readBytes < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+                REPORT_ERROR_STATIC(ErrorManagement::OSError, "BasicUART::ReadAvailable - "
+                    "failed read with error %s.", strerror(errno));
+            }
+            ok = false;
+        }
+    }
+
+    return (size > 0u);
+}
+
 bool BasicUART::WaitRead(const uint32 timeoutUsec) {
 
     struct timeval timeWait;
@@ -82,6 +82,16 @@ struct BasicUARTProperties {
      */
     fd_set writeFDS_done;
 
+    /**
+     * The speed in bits/s if it has no standard termios code (0 otherwise).
+     */
+    uint32 customSpeed;
+
+    /**
+     * True if the ASYNC_LOW_LATENCY driver mode is requested.
+     */
+    bool lowLatency;
+
 };
 
 }
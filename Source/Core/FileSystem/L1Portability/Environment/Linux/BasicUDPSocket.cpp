@@ -30,8 +30,16 @@
 #include <net/if.h>
 #include <netinet/in.h>
 #include <netdb.h>
+#include <arpa/inet.h>
 #include <sys/ioctl.h>
 #include <unistd.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <linux/errqueue.h>
+#include <linux/filter.h>
+#include <linux/net_tstamp.h>
+#include <linux/sockios.h>
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
@@ -42,6 +50,27 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+/**
+ * Maximum number of datagrams handed over to the kernel in a single sendmmsg call.
+ */
+static const MARTe::uint32 BASIC_UDP_SOCKET_MAX_BATCH = 64u;
+
+/**
+ * @brief Sets the SO_RCVTIMEO option of a socket.
+ * @param[in] connectionSocket the socket.
+ * @param[in] timeoutUSec the timeout to set in microseconds (0 disables the timeout).
+ * @return true if the option was successfully set.
+ */
+static bool BasicUDPSocketSetReadTimeout(const MARTe::SocketCore connectionSocket,
+                                         const MARTe::uint64 timeoutUSec) {
+    struct timeval timeoutVal;
+    /*lint -e{9117} -e{9114} -e{9125}  [MISRA C++ Rule 5-0-3] [MISRA C++ Rule 5-0-4]. Justification: the time structure requires a signed integer. */
+    timeoutVal.tv_sec = static_cast<MARTe::oslong>(timeoutUSec / 1000000u);
+    /*lint -e{9117} -e{9114} -e{9125}  [MISRA C++ Rule 5-0-3] [MISRA C++ Rule 5-0-4]. Justification: the time structure requires a signed integer. */
+    timeoutVal.tv_usec = static_cast<MARTe::oslong>(timeoutUSec % 1000000u);
+    return (setsockopt(connectionSocket, SOL_SOCKET, SO_RCVTIMEO, &timeoutVal, static_cast<socklen_t>(sizeof(timeoutVal))) >= 0);
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -133,6 +162,255 @@ bool BasicUDPSocket::Write(const char8 *const input,
     return (ret > 0);
 }
 
+bool BasicUDPSocket::WriteBatch(const char8 * const * const buffers,
+                                const uint32 * const sizes,
+                                uint32 &numberOfBuffers,
+                                InternetHost * const destinations) {
+    uint32 toWrite = numberOfBuffers;
+    numberOfBuffers = 0u;
+    bool ok = IsValid();
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    struct mmsghdr messages[BASIC_UDP_SOCKET_MAX_BATCH];
+    struct iovec vectors[BASIC_UDP_SOCKET_MAX_BATCH];
+    while ((ok) && (numberOfBuffers < toWrite)) {
+        uint32 chunk = (toWrite - numberOfBuffers);
+        if (chunk > BASIC_UDP_SOCKET_MAX_BATCH) {
+            chunk = BASIC_UDP_SOCKET_MAX_BATCH;
+        }
+        uint32 i;
+        for (i = 0u; i < chunk; i++) {
+            /*lint -e{9005} -e{1773} [MISRA C++ Rule 5-2-5]. Justification: the operating system API is not const correct but does not modify the buffer.*/
+            vectors[i].iov_base = const_cast<char8 *>(buffers[numberOfBuffers + i]);
+            vectors[i].iov_len = static_cast<size_t>(sizes[numberOfBuffers + i]);
+            (void) memset(&messages[i], 0, sizeof(struct mmsghdr));
+            if (destinations != NULL_PTR(InternetHost *)) {
+                messages[i].msg_hdr.msg_name = destinations[numberOfBuffers + i].GetInternetHost();
+                messages[i].msg_hdr.msg_namelen = static_cast<socklen_t>(destinations[numberOfBuffers + i].Size());
+            }
+            else {
+                messages[i].msg_hdr.msg_name = destination.GetInternetHost();
+                messages[i].msg_hdr.msg_namelen = static_cast<socklen_t>(destination.Size());
+            }
+            messages[i].msg_hdr.msg_iov = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1u;
+        }
+        int32 ret = static_cast<int32>(sendmmsg(connectionSocket, &messages[0], chunk, 0));
+        ok = (ret > 0);
+        if (ok) {
+            /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
+            numberOfBuffers += static_cast<uint32>(ret);
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed sendmmsg()");
+        }
+    }
+    return ok;
+}
+
+bool BasicUDPSocket::ReadBatch(char8 * const * const buffers,
+                               uint32 * const sizes,
+                               uint32 &numberOfBuffers,
+                               InternetHost * const sources,
+                               const TimeoutType &timeout) {
+    uint32 toRead = numberOfBuffers;
+    numberOfBuffers = 0u;
+    bool ok = IsValid();
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    bool timeoutSet = false;
+    if ((ok) && (timeout.IsFinite())) {
+        ok = BasicUDPSocketSetReadTimeout(connectionSocket, timeout.GetTimeoutUSec());
+        timeoutSet = ok;
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting the read timeout");
+        }
+    }
+    struct mmsghdr messages[BASIC_UDP_SOCKET_MAX_BATCH];
+    struct iovec vectors[BASIC_UDP_SOCKET_MAX_BATCH];
+    bool more = ok;
+    while ((more) && (numberOfBuffers < toRead)) {
+        uint32 chunk = (toRead - numberOfBuffers);
+        if (chunk > BASIC_UDP_SOCKET_MAX_BATCH) {
+            chunk = BASIC_UDP_SOCKET_MAX_BATCH;
+        }
+        uint32 i;
+        for (i = 0u; i < chunk; i++) {
+            vectors[i].iov_base = buffers[numberOfBuffers + i];
+            vectors[i].iov_len = static_cast<size_t>(sizes[numberOfBuffers + i]);
+            (void) memset(&messages[i], 0, sizeof(struct mmsghdr));
+            if (sources != NULL_PTR(InternetHost *)) {
+                messages[i].msg_hdr.msg_name = sources[numberOfBuffers + i].GetInternetHost();
+                messages[i].msg_hdr.msg_namelen = static_cast<socklen_t>(sources[numberOfBuffers + i].Size());
+            }
+            messages[i].msg_hdr.msg_iov = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1u;
+        }
+        //Only the first datagram may block, the following chunks only collect what is already queued
+        int32 flags = MSG_WAITFORONE;
+        if (numberOfBuffers > 0u) {
+            flags = MSG_DONTWAIT;
+        }
+        int32 ret = static_cast<int32>(recvmmsg(connectionSocket, &messages[0], chunk, flags, NULL_PTR(struct timespec *)));
+        if (ret > 0) {
+            for (i = 0u; i < static_cast<uint32>(ret); i++) {
+                sizes[numberOfBuffers + i] = static_cast<uint32>(messages[i].msg_len);
+            }
+            /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
+            numberOfBuffers += static_cast<uint32>(ret);
+            more = (static_cast<uint32>(ret) == chunk);
+        }
+        else {
+            more = false;
+            if ((numberOfBuffers == 0u) && (errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed recvmmsg()");
+            }
+        }
+    }
+    if (timeoutSet) {
+        if (!BasicUDPSocketSetReadTimeout(connectionSocket, 0u)) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() removing the read timeout");
+        }
+    }
+    return (numberOfBuffers > 0u);
+}
+
+bool BasicUDPSocket::EnableTimestamping(const bool hardware,
+                                        const char8 * const interfaceName) {
+    bool ok = IsValid();
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    if ((ok) && (hardware) && (interfaceName != NULL_PTR(const char8 *))) {
+        struct hwtstamp_config config;
+        (void) memset(&config, 0, sizeof(config));
+        config.tx_type = HWTSTAMP_TX_OFF;
+        config.rx_filter = HWTSTAMP_FILTER_ALL;
+        struct ifreq request;
+        (void) memset(&request, 0, sizeof(request));
+        (void) strncpy(&request.ifr_name[0], interfaceName, static_cast<size_t>(IFNAMSIZ - 1));
+        /*lint -e{9176} Justification: the operating system API requires a pointer to the configuration.*/
+        request.ifr_data = reinterpret_cast<char8 *>(&config);
+        ok = (ioctl(connectionSocket, static_cast<osulong>(SIOCSHWTSTAMP), &request) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed ioctl(SIOCSHWTSTAMP) enabling the device hardware timestamping");
+        }
+    }
+    if (ok) {
+        int32 flags = static_cast<int32>(SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE);
+        if (hardware) {
+            flags |= static_cast<int32>(SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE);
+        }
+        ok = (setsockopt(connectionSocket, SOL_SOCKET, SO_TIMESTAMPING, &flags, static_cast<socklen_t>(sizeof(flags))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting SO_TIMESTAMPING");
+        }
+    }
+    return ok;
+}
+
+bool BasicUDPSocket::ReadWithTimestamp(char8 * const output,
+                                       uint32 &size,
+                                       uint64 &softwareTimestamp,
+                                       uint64 &hardwareTimestamp,
+                                       const TimeoutType &timeout) {
+    uint32 sizeToRead = size;
+    size = 0u;
+    softwareTimestamp = 0u;
+    hardwareTimestamp = 0u;
+    bool ok = IsValid();
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    bool timeoutSet = false;
+    if ((ok) && (timeout.IsFinite())) {
+        ok = BasicUDPSocketSetReadTimeout(connectionSocket, timeout.GetTimeoutUSec());
+        timeoutSet = ok;
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting the read timeout");
+        }
+    }
+    if (ok) {
+        struct iovec vector;
+        vector.iov_base = output;
+        vector.iov_len = static_cast<size_t>(sizeToRead);
+        //Room for the timestamping control message (and for any other enabled control message)
+        uint64 control[64];
+        struct msghdr message;
+        (void) memset(&message, 0, sizeof(message));
+        message.msg_name = source.GetInternetHost();
+        message.msg_namelen = static_cast<socklen_t>(source.Size());
+        message.msg_iov = &vector;
+        message.msg_iovlen = 1u;
+        message.msg_control = &control[0];
+        message.msg_controllen = sizeof(control);
+        int32 ret = static_cast<int32>(recvmsg(connectionSocket, &message, 0));
+        ok = (ret >= 0);
+        if (ok) {
+            /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
+            size = static_cast<uint32>(ret);
+            struct cmsghdr *cmsg;
+            for (cmsg = CMSG_FIRSTHDR(&message); cmsg != NULL_PTR(struct cmsghdr *); cmsg = CMSG_NXTHDR(&message, cmsg)) {
+                if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SCM_TIMESTAMPING)) {
+                    struct scm_timestamping timestamps;
+                    (void) memcpy(&timestamps, CMSG_DATA(cmsg), sizeof(timestamps));
+                    //ts[0] is the software timestamp, ts[1] is deprecated and ts[2] is the raw hardware timestamp
+                    softwareTimestamp = (static_cast<uint64>(timestamps.ts[0].tv_sec) * 1000000000u) + static_cast<uint64>(timestamps.ts[0].tv_nsec);
+                    hardwareTimestamp = (static_cast<uint64>(timestamps.ts[2].tv_sec) * 1000000000u) + static_cast<uint64>(timestamps.ts[2].tv_nsec);
+                }
+            }
+        }
+        else {
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed recvmsg()");
+            }
+        }
+    }
+    if (timeoutSet) {
+        if (!BasicUDPSocketSetReadTimeout(connectionSocket, 0u)) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() removing the read timeout");
+        }
+    }
+    return (size > 0u);
+}
+
+bool BasicUDPSocket::SetReceiveBufferSize(const uint32 size) {
+    bool ok = IsValid();
+    if (ok) {
+        int32 value = static_cast<int32>(size);
+        ok = (setsockopt(connectionSocket, SOL_SOCKET, SO_RCVBUF, &value, static_cast<socklen_t>(sizeof(value))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting SO_RCVBUF");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    return ok;
+}
+
+bool BasicUDPSocket::SetBusyPoll(const uint32 microseconds) {
+    bool ok = IsValid();
+    if (ok) {
+#ifdef SO_BUSY_POLL
+        int32 value = static_cast<int32>(microseconds);
+        ok = (setsockopt(connectionSocket, SOL_SOCKET, SO_BUSY_POLL, &value, static_cast<socklen_t>(sizeof(value))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting SO_BUSY_POLL");
+        }
+#else
+        ok = false;
+        REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "BasicUDPSocket: SO_BUSY_POLL is not supported");
+#endif
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    return ok;
+}
+
 bool BasicUDPSocket::Open() {
     /*lint -e{641} .Justification the socket type descriptor is an integer */
     connectionSocket = (socket(PF_INET, SOCK_DGRAM, 0));
@@ -140,6 +418,63 @@ bool BasicUDPSocket::Open() {
 }
 
 /*lint -e{1762}  [MISRA C++ Rule 9-3-3]. Justification: The function member could be non-const in other operating system implementations*/
+bool BasicUDPSocket::SetReusePort(const bool reuse) {
+    bool ok = IsValid();
+    if (ok) {
+        int32 value = 0;
+        if (reuse) {
+            value = 1;
+        }
+        ok = (setsockopt(connectionSocket, SOL_SOCKET, SO_REUSEPORT, &value, static_cast<socklen_t>(sizeof(value))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting SO_REUSEPORT");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    return ok;
+}
+
+bool BasicUDPSocket::SetReusePortSteering(const uint32 numberOfSockets) {
+    bool ok = IsValid();
+    if (ok) {
+        ok = (numberOfSockets > 0u);
+    }
+    if (ok) {
+#ifdef SO_ATTACH_REUSEPORT_CBPF
+        //A = source IPv4 address (offset 12 of the IP header); A %= numberOfSockets; return A
+        struct sock_filter code[3];
+        code[0].code = static_cast<uint16>(BPF_LD | BPF_W | BPF_ABS);
+        code[0].jt = 0u;
+        code[0].jf = 0u;
+        code[0].k = static_cast<uint32>(SKF_NET_OFF + 12);
+        code[1].code = static_cast<uint16>(BPF_ALU | BPF_MOD | BPF_K);
+        code[1].jt = 0u;
+        code[1].jf = 0u;
+        code[1].k = numberOfSockets;
+        code[2].code = static_cast<uint16>(BPF_RET | BPF_A);
+        code[2].jt = 0u;
+        code[2].jf = 0u;
+        code[2].k = 0u;
+        struct sock_fprog program;
+        program.len = 3u;
+        program.filter = &code[0];
+        ok = (setsockopt(connectionSocket, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, static_cast<socklen_t>(sizeof(program))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting SO_ATTACH_REUSEPORT_CBPF");
+        }
+#else
+        ok = false;
+        REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "BasicUDPSocket: SO_ATTACH_REUSEPORT_CBPF is not supported");
+#endif
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    return ok;
+}
+
 bool BasicUDPSocket::Listen(const uint16 port) {
     int32 errorCode = -1;
     if (IsValid()) {
@@ -154,18 +489,68 @@ bool BasicUDPSocket::Listen(const uint16 port) {
     return (errorCode >= 0);
 }
 
-bool BasicUDPSocket::Join(const char8 *const group) const {
+bool BasicUDPSocket::Join(const char8 *const group,
+                          const char8 *const interfaceAddress) const {
     int32 opt = 1;
     /* Allow multiple sockets to use the same addr and port number */
     bool ok = setsockopt(connectionSocket, SOL_SOCKET, SO_REUSEADDR, &opt, static_cast<socklen_t>(sizeof(opt))) >= 0;
     if (ok) {
         InternetHost host;
         host.SetMulticastGroup(group);
+        if (interfaceAddress != NULL) {
+            host.GetInternetMulticastHost()->imr_interface.s_addr = inet_addr(interfaceAddress);
+        }
         ok = setsockopt(connectionSocket, IPPROTO_IP, IP_ADD_MEMBERSHIP, host.GetInternetMulticastHost(), static_cast<socklen_t>(host.MulticastSize())) >= 0;
     }
     return ok;
 }
 
+bool BasicUDPSocket::SetMulticastInterface(const char8 * const interfaceAddress) {
+    bool ok = (IsValid()) && (interfaceAddress != NULL);
+    if (ok) {
+        struct in_addr localInterface;
+        localInterface.s_addr = inet_addr(interfaceAddress);
+        ok = (setsockopt(connectionSocket, IPPROTO_IP, IP_MULTICAST_IF, &localInterface, static_cast<socklen_t>(sizeof(localInterface))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting IP_MULTICAST_IF");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid or the interface is NULL");
+    }
+    return ok;
+}
+
+bool BasicUDPSocket::SetMulticastTTL(const uint8 ttl) {
+    bool ok = IsValid();
+    if (ok) {
+        uint8 value = ttl;
+        ok = (setsockopt(connectionSocket, IPPROTO_IP, IP_MULTICAST_TTL, &value, static_cast<socklen_t>(sizeof(value))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting IP_MULTICAST_TTL");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    return ok;
+}
+
+bool BasicUDPSocket::SetMulticastLoopback(const bool loopback) {
+    bool ok = IsValid();
+    if (ok) {
+        uint8 value = loopback ? 1u : 0u;
+        ok = (setsockopt(connectionSocket, IPPROTO_IP, IP_MULTICAST_LOOP, &value, static_cast<socklen_t>(sizeof(value))) >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicUDPSocket: Failed setsockopt() setting IP_MULTICAST_LOOP");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicUDPSocket: The socket handle is not valid");
+    }
+    return ok;
+}
+
 bool BasicUDPSocket::Connect(const char8 *const address,
                              const uint16 port) {
 
@@ -147,6 +147,19 @@ TimeStamp Directory::GetLastWriteTime() {
     return timeStamp;
 }
 
+uint64 Directory::GetLastWriteTimeSeconds() {
+    uint64 secondsFromEpoch = 0u;
+    if (stat(GetName(), &directoryHandle) == 0) {
+        if (directoryHandle.st_mtime > 0) {
+            secondsFromEpoch = static_cast<uint64>(directoryHandle.st_mtime);
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: stat()");
+    }
+    return secondsFromEpoch;
+}
+
 TimeStamp Directory::GetLastAccessTime() {
     TimeStamp timeStamp;
     if (stat(GetName(), &directoryHandle) == 0) {
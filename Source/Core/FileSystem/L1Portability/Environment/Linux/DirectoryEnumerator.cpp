@@ -0,0 +1,278 @@
+/**
+ * @file DirectoryEnumerator.cpp
+ * @brief Source file for class DirectoryEnumerator
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DirectoryEnumerator (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <dirent.h>
+#include <fcntl.h>
+#include <fnmatch.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "DirectoryEnumerator.h"
+#include "ErrorManagement.h"
+#include "HeapManager.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Size of the buffer filled by each getdents64 (several hundreds of entries).
+ */
+static const uint32 DIRECTORY_ENUMERATOR_BUFFER_SIZE = 32768u;
+
+/**
+ * Layout of the records returned by getdents64 (not exported by all the libc versions).
+ */
+struct DirectoryEnumeratorDirent64 {
+    uint64 d_ino;
+    int64 d_off;
+    uint16 d_reclen;
+    uint8 d_type;
+    char8 d_name[1];
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+DirectoryEnumerator::DirectoryEnumerator() {
+    properties.handle = -1;
+    properties.buffer = NULL_PTR(char8 *);
+    properties.bufferFill = 0u;
+    properties.bufferPosition = 0u;
+    properties.fileMask = NULL_PTR(char8 *);
+    properties.name = NULL_PTR(const char8 *);
+    properties.type = DT_UNKNOWN;
+    properties.statusRead = false;
+    properties.statusValid = false;
+}
+
+DirectoryEnumerator::~DirectoryEnumerator() {
+    if (IsOpen()) {
+        (void) DirectoryEnumerator::Close();
+    }
+}
+
+bool DirectoryEnumerator::Open(const char8 * const path,
+                               const char8 * const fileMask) {
+    bool ok = (!IsOpen()) && (path != NULL);
+    if (ok) {
+        properties.handle = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        ok = (properties.handle >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "DirectoryEnumerator: Failed open()");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::IllegalOperation, "DirectoryEnumerator: A directory is already open or the path is NULL");
+    }
+    if (ok) {
+        properties.buffer = static_cast<char8 *>(HeapManager::Malloc(DIRECTORY_ENUMERATOR_BUFFER_SIZE));
+        ok = (properties.buffer != NULL);
+        if ((ok) && (fileMask != NULL)) {
+            properties.fileMask = StringHelper::StringDup(fileMask);
+            ok = (properties.fileMask != NULL);
+        }
+        if (!ok) {
+            (void) Close();
+        }
+    }
+    return ok;
+}
+
+bool DirectoryEnumerator::Close() {
+    bool ok = IsOpen();
+    if (ok) {
+        ok = (close(properties.handle) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "DirectoryEnumerator: Failed close()");
+        }
+        properties.handle = -1;
+    }
+    if (properties.buffer != NULL) {
+        (void) HeapManager::Free(reinterpret_cast<void *&>(properties.buffer));
+        properties.buffer = NULL_PTR(char8 *);
+    }
+    if (properties.fileMask != NULL) {
+        (void) HeapManager::Free(reinterpret_cast<void *&>(properties.fileMask));
+        properties.fileMask = NULL_PTR(char8 *);
+    }
+    properties.bufferFill = 0u;
+    properties.bufferPosition = 0u;
+    properties.name = NULL_PTR(const char8 *);
+    properties.statusRead = false;
+    properties.statusValid = false;
+    return ok;
+}
+
+bool DirectoryEnumerator::IsOpen() const {
+    return (properties.handle >= 0);
+}
+
+bool DirectoryEnumerator::NextEntry() {
+    bool found = false;
+    bool ok = IsOpen();
+    properties.name = NULL_PTR(const char8 *);
+    while ((ok) && (!found)) {
+        if (properties.bufferPosition >= properties.bufferFill) {
+            long readSize = syscall(SYS_getdents64, properties.handle, properties.buffer, DIRECTORY_ENUMERATOR_BUFFER_SIZE);
+            ok = (readSize > 0);
+            if (readSize < 0) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "DirectoryEnumerator: Failed getdents64()");
+            }
+            if (ok) {
+                properties.bufferFill = static_cast<uint32>(readSize);
+                properties.bufferPosition = 0u;
+            }
+        }
+        if (ok) {
+            /*lint -e{927} -e{826} the buffer is filled with linux_dirent64 records*/
+            const DirectoryEnumeratorDirent64 *entry = reinterpret_cast<const DirectoryEnumeratorDirent64 *>(&properties.buffer[properties.bufferPosition]);
+            properties.bufferPosition += entry->d_reclen;
+            found = true;
+            if (properties.fileMask != NULL) {
+                found = (fnmatch(properties.fileMask, &entry->d_name[0], 0) == 0);
+            }
+            if (found) {
+                properties.name = &entry->d_name[0];
+                properties.type = entry->d_type;
+            }
+        }
+    }
+    return found;
+}
+
+bool DirectoryEnumerator::Next() {
+    properties.statusRead = false;
+    properties.statusValid = false;
+    return NextEntry();
+}
+
+uint32 DirectoryEnumerator::Skip(const uint32 numberOfEntries) {
+    properties.statusRead = false;
+    properties.statusValid = false;
+    uint32 skipped = 0u;
+    while ((skipped < numberOfEntries) && (NextEntry())) {
+        skipped++;
+    }
+    return skipped;
+}
+
+bool DirectoryEnumerator::Rewind() {
+    bool ok = IsOpen();
+    if (ok) {
+        ok = (lseek(properties.handle, 0, SEEK_SET) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "DirectoryEnumerator: Failed lseek()");
+        }
+        properties.bufferFill = 0u;
+        properties.bufferPosition = 0u;
+        properties.name = NULL_PTR(const char8 *);
+        properties.statusRead = false;
+        properties.statusValid = false;
+    }
+    return ok;
+}
+
+const char8 *DirectoryEnumerator::GetName() const {
+    return properties.name;
+}
+
+bool DirectoryEnumerator::ReadProperties() {
+    if ((!properties.statusRead) && (properties.name != NULL)) {
+        properties.statusRead = true;
+        properties.statusValid = (fstatat(properties.handle, properties.name, &properties.status, 0) == 0);
+    }
+    return properties.statusValid;
+}
+
+bool DirectoryEnumerator::IsDirectory() {
+    bool ret = false;
+    if (properties.name != NULL) {
+        if (properties.type == DT_DIR) {
+            ret = true;
+        }
+        else if ((properties.type == DT_UNKNOWN) || (properties.type == DT_LNK)) {
+            //The type is not reported by the file system or the link shall be followed
+            if (ReadProperties()) {
+                /*lint -e{9130} -e{9117} [MISRA C++ Rule 5-0-4]. Justification: Operating system APIs are not linted.*/
+                ret = S_ISDIR(properties.status.st_mode);
+            }
+        }
+        else {
+            //Any other type
+        }
+    }
+    return ret;
+}
+
+bool DirectoryEnumerator::IsFile() {
+    bool ret = false;
+    if (properties.name != NULL) {
+        if (properties.type == DT_REG) {
+            ret = true;
+        }
+        else if ((properties.type == DT_UNKNOWN) || (properties.type == DT_LNK)) {
+            if (ReadProperties()) {
+                /*lint -e{9130} -e{9117} [MISRA C++ Rule 5-0-4]. Justification: Operating system APIs are not linted.*/
+                ret = S_ISREG(properties.status.st_mode);
+            }
+        }
+        else {
+            //Any other type
+        }
+    }
+    return ret;
+}
+
+uint64 DirectoryEnumerator::GetSize() {
+    uint64 size = 0u;
+    if (ReadProperties()) {
+        size = static_cast<uint64>(properties.status.st_size);
+    }
+    return size;
+}
+
+uint64 DirectoryEnumerator::GetLastWriteTimeSeconds() {
+    uint64 seconds = 0u;
+    if (ReadProperties()) {
+        seconds = static_cast<uint64>(properties.status.st_mtime);
+    }
+    return seconds;
+}
+
+}
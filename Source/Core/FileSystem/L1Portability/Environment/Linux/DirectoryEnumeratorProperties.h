@@ -0,0 +1,68 @@
+/**
+ * @file DirectoryEnumeratorProperties.h
+ * @brief Header file for class DirectoryEnumeratorProperties
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class DirectoryEnumeratorProperties
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef DIRECTORYENUMERATORPROPERTIES_H_
+#define DIRECTORYENUMERATORPROPERTIES_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <sys/types.h>
+#include <sys/stat.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+/**
+ * Directory handle and the buffer of linux_dirent64 records read with getdents64.
+ */
+struct DirectoryEnumeratorProperties {
+    int32 handle;
+    char8 *buffer;
+    uint32 bufferFill;
+    uint32 bufferPosition;
+    char8 *fileMask;
+    /*
+     * The current entry: name (in the buffer), d_type and the properties read on demand.
+     */
+    const char8 *name;
+    uint8 type;
+    bool statusRead;
+    bool statusValid;
+    struct stat status;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /*DIRECTORYENUMERATORPROPERTIES_H_ */
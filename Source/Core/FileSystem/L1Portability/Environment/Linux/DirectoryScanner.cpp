@@ -24,21 +24,21 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
-#include <dirent.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
-#include <fnmatch.h>
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
 #include "DirectoryScanner.h"
 #include "Directory.h"
+#include "DirectoryEnumerator.h"
 #include "GlobalObjectsDatabase.h"
 #include "StringHelper.h"
 #include "HeapManager.h"
 #include "MemoryOperationsHelper.h"
+#include "SortFilter.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -49,16 +49,69 @@
 
 namespace MARTe {
 
-/*lint -estring(459, *MARTe::fileFilter*) global variable required for file filtering with scandir in Linux*/
-// This function is called by the scandir and it is used for file filtering
-static char8 *fileFilterSearchMask;
-
-// match a shell wildcard pattern
-static int32 fileFilter(const struct dirent * const de) {
-    /*lint -e{9125} -e{9123} [MISRA C++ Rule 5-0-8].Justification: cast from bool to int required by this implementation*/
-    return static_cast<int32>(fnmatch(fileFilterSearchMask, &de->d_name[0], 0) == 0);
+/**
+ * @brief Orders two entries with the sorter or, if NULL, alphabetically. The name is the tie-breaker of the sorter.
+ */
+static int32 DirectoryScannerCompare(Directory * const entry1,
+                                     Directory * const entry2,
+                                     SortFilter * const sorter) {
+    int32 ret = 0;
+    if (sorter != NULL) {
+        ret = sorter->Compare(entry1, entry2);
+    }
+    if (ret == 0) {
+        //StringHelper::Compare returns 1 if entry1 < entry2 and 2 if entry1 > entry2
+        int32 order = StringHelper::Compare(entry1->GetName(), entry2->GetName());
+        if (order == 1) {
+            ret = -1;
+        }
+        else if (order == 2) {
+            ret = 1;
+        }
+        else {
+            ret = 0;
+        }
+    }
+    return ret;
 }
 
+/**
+ * @brief Orders the scanned entries (see DirectoryScannerCompare).
+ */
+class DirectoryScannerSorter: public SortFilter {
+public:
+    /**
+     * @brief Constructor.
+     * @param[in] sorterIn the sorter given to Scan (may be NULL).
+     */
+    explicit DirectoryScannerSorter(SortFilter * const sorterIn) :
+            SortFilter() {
+        sorter = sorterIn;
+    }
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~DirectoryScannerSorter() {
+        sorter = NULL_PTR(SortFilter *);
+    }
+
+    /**
+     * @see DirectoryScannerCompare
+     */
+    virtual int32 Compare(LinkedListable *data1,
+                          LinkedListable *data2) {
+        /*lint -e{929} -e{1774} all the elements of a DirectoryScanner are Directory objects*/
+        return DirectoryScannerCompare(static_cast<Directory *>(data1), static_cast<Directory *>(data2), sorter);
+    }
+
+private:
+    /**
+     * The sorter given to Scan.
+     */
+    SortFilter *sorter;
+};
+
 DirectoryScanner::DirectoryScanner() :
         LinkedListHolder() {
     basePath = static_cast<char8 *>(NULL);
@@ -125,109 +178,52 @@ bool DirectoryScanner::Scan(const char8 * const path,
         }
     }
 
+    // if the file mask is NULL it becomes * (all the files)
+    if (fileMask == NULL) {
+        fileMask = "*";
+    }
+    DirectoryEnumerator enumerator;
     if (ret) {
-
-        // if the file mask is NULL it becomes * (all the files)
-        if (fileMask == NULL) {
-            fileMask = "*";
-        }
-
-        // copy fileMask in fileFilterSearchMask
-
-        fileFilterSearchMask = static_cast<char8 *>(HeapManager::Malloc(StringHelper::Length(fileMask) + 1u));
-
-        if (!StringHelper::Copy(fileFilterSearchMask, fileMask)) {
-            ret = false;
-        }
-
+        ret = enumerator.Open(basePath, fileMask);
     }
     if (ret) {
-        uint32 pathSize = 512u;
-        char8 statAddr[512];
-
-        struct dirent **namelist;
-
-        // mallocs the filenames matched in basePath into nameList
-        /*lint -e{9025} [MISRA C++ Rule 5-0-19]. Justification: struct dirent*** required by scandir(*) operating system API */
-        int32 n = scandir(basePath, &namelist, &fileFilter, &alphasort);
-
-        if (n < 0) {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: Failed scandir()");
-            ret = false;
-        }
-        else {
-            n--;
-            while (n >= 0) {
-                Directory *entry = new Directory();
-
-                // empties statAddr
-                if (!MemoryOperationsHelper::Set(&statAddr[0], '\0', pathSize)) {
-                    ret = false;
-                }
-
-                if (ret) {
-                    // put in statAddr the base path
-                    if (!StringHelper::Concatenate(&statAddr[0], basePath)) {
-                        ret = false;
-                    }
-                    // put the separator
-                    //if (!StringHelper::Concatenate(&statAddr[0], &DIRECTORY_SEPARATOR)) {
-                    //    ret = false;
-                    //}
-                }
-
-                if (ret) {
-                    // concatenate it with the file name to create the full path
-                    if (!StringHelper::Concatenate(&statAddr[0], &(namelist[n]->d_name[0]))) {
-                        ret = false;
-                    }
-                }
-
-                if (ret) {
-
-                    // store the file name
-                    if (!entry->SetByName(&statAddr[0])) {
-                        ret = false;
-                    }
-
-                }
-
-                if (ret) {
-                    if (sorter == NULL) {
-                        ListInsert(entry);
-                    }
-                    else {
-                        ListInsert(entry, sorter);
-                    }
-                }
-                else {
-                    delete entry;
-                    break;
-                }
-
-                bool testOneDot = (StringHelper::Compare(&(namelist[n]->d_name[0]), ".") != 0);
-                bool testTwoDots = (StringHelper::Compare(&(namelist[n]->d_name[0]), "..") != 0);
+        // the names of the entries are at most NAME_MAX (255) characters long
+        uint32 baseLength = StringHelper::Length(basePath);
+        char8 *fullPath = static_cast<char8 *>(HeapManager::Malloc(baseLength + 256u));
+        ret = StringHelper::Copy(fullPath, basePath);
+        // the entries are inserted unsorted (in constant time) and then sorted only once
+        while ((ret) && (enumerator.Next())) {
+            ret = StringHelper::CopyN(&fullPath[baseLength], enumerator.GetName(), 256u);
+            Directory *entry = new Directory();
+            // store the file name
+            if (ret) {
+                ret = entry->SetByName(fullPath);
+            }
+            if (ret) {
+                FastListInsertSingle(*entry);
+                bool testOneDot = (StringHelper::Compare(enumerator.GetName(), ".") != 0);
+                bool testTwoDots = (StringHelper::Compare(enumerator.GetName(), "..") != 0);
                 if (testOneDot && testTwoDots) {
                     size += entry->GetSize();
                 }
-
-                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(namelist[n]));
-                n--;
             }
-            if (namelist != NULL_PTR(struct dirent **)) {
-                /*lint -e{9025} [MISRA C++ Rule 5-0-19]. Justification: struct dirent*** required by scandir(*) operating system API */
-                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(namelist));
+            else {
+                delete entry;
             }
         }
+        if (fullPath != NULL) {
+            (void) HeapManager::Free(reinterpret_cast<void *&>(fullPath));
+        }
+    }
+    if (ret) {
+        DirectoryScannerSorter entriesSorter(sorter);
+        ListSort(&entriesSorter);
     }
 
     if (!ret) {
         CleanUp();
     }
 
-    if (!HeapManager::Free(reinterpret_cast<void *&>(fileFilterSearchMask))) {
-
-    }
     return ret;
 }
 
@@ -0,0 +1,220 @@
+/**
+ * @file EventPoller.cpp
+ * @brief Source file for class EventPoller
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class EventPoller (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "EventPoller.h"
+#include "ErrorManagement.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+EventPoller::EventPoller(const uint32 maxEventsPerWait) {
+    maxEvents = maxEventsPerWait;
+    if (maxEvents == 0u) {
+        maxEvents = 1u;
+    }
+    nOfEvents = 0u;
+    readyEvents = new EventPollerEvent[maxEvents];
+    pollHandle = epoll_create1(EPOLL_CLOEXEC);
+    if (pollHandle < 0) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "EventPoller: Failed epoll_create1()");
+    }
+}
+
+EventPoller::~EventPoller() {
+    if (pollHandle >= 0) {
+        if (close(pollHandle) < 0) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "EventPoller: Failed close()");
+        }
+    }
+    delete[] readyEvents;
+}
+
+bool EventPoller::IsValid() const {
+    return (pollHandle >= 0);
+}
+
+bool EventPoller::Control(const int32 operation,
+                          const Handle descriptor,
+                          const uint32 events,
+                          void * const userData) const {
+    EventPollerEvent event;
+    event.events = 0u;
+    if ((events & EventPollerRead) != 0u) {
+        event.events |= static_cast<uint32>(EPOLLIN | EPOLLRDHUP);
+    }
+    if ((events & EventPollerWrite) != 0u) {
+        event.events |= static_cast<uint32>(EPOLLOUT);
+    }
+    if ((events & EventPollerEdgeTriggered) != 0u) {
+        event.events |= static_cast<uint32>(EPOLLET);
+    }
+    if ((events & EventPollerOneShot) != 0u) {
+        event.events |= static_cast<uint32>(EPOLLONESHOT);
+    }
+    event.data.ptr = userData;
+    bool ok = (epoll_ctl(pollHandle, operation, descriptor, &event) >= 0);
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "EventPoller: Failed epoll_ctl()");
+    }
+    return ok;
+}
+
+bool EventPoller::ControlHandle(const int32 operation,
+                                const HandleI &handle,
+                                const uint32 events,
+                                void * const userData) const {
+    void *data = userData;
+    if (data == NULL_PTR(void *)) {
+        /*lint -e{9005} -e{1773} Justification: the handle is only returned to the caller, which owns it.*/
+        data = const_cast<HandleI *>(&handle);
+    }
+    Handle readDescriptor = handle.GetReadHandle();
+    Handle writeDescriptor = handle.GetWriteHandle();
+    bool ok = IsValid();
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "EventPoller: The poller is not valid");
+    }
+    if (ok) {
+        if (readDescriptor == writeDescriptor) {
+            ok = (readDescriptor >= 0);
+            if (ok) {
+                ok = Control(operation, readDescriptor, events, data);
+            }
+        }
+        else {
+            //Double handle (i.e. a different handle for reading and writing): each one only monitors its own mode
+            uint32 modifiers = (events & (EventPollerEdgeTriggered | EventPollerOneShot));
+            if ((operation == EPOLL_CTL_DEL) || ((events & EventPollerRead) != 0u)) {
+                ok = (readDescriptor >= 0);
+                if (ok) {
+                    ok = Control(operation, readDescriptor, (events & EventPollerRead) | modifiers, data);
+                }
+            }
+            if ((ok) && ((operation == EPOLL_CTL_DEL) || ((events & EventPollerWrite) != 0u))) {
+                ok = (writeDescriptor >= 0);
+                if (ok) {
+                    ok = Control(operation, writeDescriptor, (events & EventPollerWrite) | modifiers, data);
+                }
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "EventPoller: Invalid descriptor or failed to update the watch list.");
+        }
+    }
+    return ok;
+}
+
+bool EventPoller::Add(const HandleI &handle,
+                      const uint32 events,
+                      void * const userData) {
+    return ControlHandle(EPOLL_CTL_ADD, handle, events, userData);
+}
+
+bool EventPoller::Modify(const HandleI &handle,
+                         const uint32 events,
+                         void * const userData) {
+    return ControlHandle(EPOLL_CTL_MOD, handle, events, userData);
+}
+
+bool EventPoller::Remove(const HandleI &handle) {
+    return ControlHandle(EPOLL_CTL_DEL, handle, 0u, NULL_PTR(void *));
+}
+
+int32 EventPoller::WaitUntil(const TimeoutType &timeout) {
+    int32 ret = -1;
+    nOfEvents = 0u;
+    if (IsValid()) {
+        int32 timeoutMSec = -1;
+        if (timeout.IsFinite()) {
+            timeoutMSec = static_cast<int32>(timeout.GetTimeoutMSec());
+        }
+        ret = epoll_wait(pollHandle, &readyEvents[0], static_cast<int32>(maxEvents), timeoutMSec);
+        if (ret > 0) {
+            nOfEvents = static_cast<uint32>(ret);
+        }
+        else if (ret < 0) {
+            //A signal interrupting the wait is reported as a timeout
+            if (errno == EINTR) {
+                ret = 0;
+            }
+            else {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "EventPoller: Failed epoll_wait()");
+            }
+        }
+        else {
+            //Timeout
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "EventPoller: The poller is not valid");
+    }
+    return ret;
+}
+
+void *EventPoller::GetEventUserData(const uint32 index) const {
+    void *data = NULL_PTR(void *);
+    if (index < nOfEvents) {
+        data = readyEvents[index].data.ptr;
+    }
+    return data;
+}
+
+uint32 EventPoller::GetEvents(const uint32 index) const {
+    uint32 ret = 0u;
+    if (index < nOfEvents) {
+        uint32 osEvents = readyEvents[index].events;
+        if ((osEvents & static_cast<uint32>(EPOLLIN)) != 0u) {
+            ret |= EventPollerRead;
+        }
+        if ((osEvents & static_cast<uint32>(EPOLLOUT)) != 0u) {
+            ret |= EventPollerWrite;
+        }
+        if ((osEvents & static_cast<uint32>(EPOLLERR)) != 0u) {
+            ret |= EventPollerError;
+        }
+        if ((osEvents & static_cast<uint32>(EPOLLHUP | EPOLLRDHUP)) != 0u) {
+            ret |= EventPollerHangUp;
+        }
+    }
+    return ret;
+}
+
+}
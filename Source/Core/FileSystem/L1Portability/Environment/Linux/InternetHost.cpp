@@ -24,6 +24,7 @@
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
 #include <stdio.h>
+#include <string.h>
 #include <sys/socket.h>
 #include <net/if.h>
 #include <netinet/in.h>
@@ -38,6 +39,9 @@
 #include "InternetHost.h"
 #include "FastPollingMutexSem.h"
 #include "ErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "StringHelper.h"
+#include "Threads.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -137,6 +141,251 @@ private:
 
 };
 
+/**
+ * Number of host names whose address is cached.
+ */
+static const uint32 HOST_NAME_CACHE_SIZE = 64u;
+
+/**
+ * Maximum length of a cached host name (longer names are not cached).
+ */
+static const uint32 HOST_NAME_CACHE_MAX_NAME = 256u;
+
+/**
+ * @brief Process-wide cache of the host name resolutions.
+ * @details An entry younger than the time to live is used without querying the resolver. An entry older than the
+ * time to live, but younger than twice the time to live, is still used while a thread refreshes it in background,
+ * so that the callers never wait for the resolver if the host name is used at least once per time to live.
+ */
+class HostNameCache {
+
+public:
+
+    static HostNameCache* Instance() {
+        static HostNameCache instance;
+        return &instance;
+    }
+
+    /**
+     * @brief Resolves a host name, using the cached address if available.
+     */
+    bool Resolve(const char8 * const hostName,
+                 uint32 &addressOut) {
+        bool found = false;
+        bool ret = false;
+        uint32 refresh = HOST_NAME_CACHE_SIZE;
+        uint32 length = StringHelper::Length(hostName);
+        bool cacheable = (length < HOST_NAME_CACHE_MAX_NAME);
+        if (cacheable) {
+            if (cacheSem.FastLock() == ErrorManagement::NoError) {
+                uint64 ttl = timeToLive;
+                if (ttl > 0u) {
+                    uint64 now = HighResolutionTimer::Counter();
+                    for (uint32 i = 0u; (i < HOST_NAME_CACHE_SIZE) && (!found); i++) {
+                        HostNameCacheEntry &entry = entries[i];
+                        if (entry.valid) {
+                            found = (StringHelper::Compare(&entry.name[0], hostName) == 0);
+                        }
+                        if (found) {
+                            uint64 age = now - entry.resolved;
+                            if (age < ttl) {
+                                addressOut = entry.address;
+                                ret = true;
+                            }
+                            else if (age < (2u * ttl)) {
+                                addressOut = entry.address;
+                                ret = true;
+                                if (!entry.refreshing) {
+                                    entry.refreshing = true;
+                                    refresh = i;
+                                }
+                            }
+                            else {
+                                //Too old: resolve again
+                            }
+                        }
+                    }
+                }
+                else {
+                    cacheable = false;
+                }
+            }
+            cacheSem.FastUnLock();
+        }
+        if (refresh < HOST_NAME_CACHE_SIZE) {
+            //The thread is not started while holding the lock
+            /*lint -e{923} the index of the entry is passed as the thread parameter*/
+            ThreadIdentifier tid = Threads::BeginThread(&HostNameCache::Refresh, reinterpret_cast<void *>(static_cast<uintp>(refresh)));
+            if (tid == InvalidThreadIdentifier) {
+                if (cacheSem.FastLock() == ErrorManagement::NoError) {
+                    entries[refresh].refreshing = false;
+                }
+                cacheSem.FastUnLock();
+            }
+        }
+        if (!ret) {
+            ret = Query(hostName, addressOut);
+            if ((ret) && (cacheable)) {
+                Store(hostName, addressOut);
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Sets the time to live of the entries (0 disables the cache).
+     */
+    void SetTimeToLive(const uint32 seconds) {
+        if (cacheSem.FastLock() == ErrorManagement::NoError) {
+            timeToLive = static_cast<uint64>(seconds) * HighResolutionTimer::Frequency();
+        }
+        cacheSem.FastUnLock();
+    }
+
+    /**
+     * @brief Removes all the entries.
+     */
+    void Clear() {
+        if (cacheSem.FastLock() == ErrorManagement::NoError) {
+            for (uint32 i = 0u; i < HOST_NAME_CACHE_SIZE; i++) {
+                entries[i].valid = false;
+            }
+        }
+        cacheSem.FastUnLock();
+    }
+
+private:
+
+    /**
+     * A cached resolution.
+     */
+    struct HostNameCacheEntry {
+        char8 name[HOST_NAME_CACHE_MAX_NAME];
+        uint32 address;
+        uint64 resolved;
+        bool valid;
+        bool refreshing;
+    };
+
+    /*lint -e{1704} .Justification: The constructor is private because this is a singleton.*/
+    HostNameCache() :
+            cacheSem() {
+        timeToLive = 60u * HighResolutionTimer::Frequency();
+        for (uint32 i = 0u; i < HOST_NAME_CACHE_SIZE; i++) {
+            entries[i].name[0] = '\0';
+            entries[i].address = 0u;
+            entries[i].resolved = 0u;
+            entries[i].valid = false;
+            entries[i].refreshing = false;
+        }
+    }
+
+    /**
+     * @brief Queries the resolver (getaddrinfo is reentrant, differently from gethostbyname).
+     */
+    static bool Query(const char8 * const hostName,
+                      uint32 &addressOut) {
+        struct addrinfo hints;
+        (void) memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        struct addrinfo *result = static_cast<struct addrinfo *>(NULL);
+        bool ret = (getaddrinfo(hostName, static_cast<const char8 *>(NULL), &hints, &result) == 0);
+        if (ret) {
+            ret = (result != NULL);
+        }
+        if (ret) {
+            /*lint -e{740} -e{826} ai_addr is a sockaddr_in for AF_INET*/
+            addressOut = reinterpret_cast<struct sockaddr_in *>(result->ai_addr)->sin_addr.s_addr;
+        }
+        if (result != NULL) {
+            freeaddrinfo(result);
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Stores a resolution, replacing the entry of the same host name or else the oldest one.
+     */
+    void Store(const char8 * const hostName,
+               const uint32 addressIn) {
+        if (cacheSem.FastLock() == ErrorManagement::NoError) {
+            uint64 now = HighResolutionTimer::Counter();
+            uint32 slot = HOST_NAME_CACHE_SIZE;
+            bool found = false;
+            for (uint32 i = 0u; (i < HOST_NAME_CACHE_SIZE) && (!found); i++) {
+                if (entries[i].valid) {
+                    found = (StringHelper::Compare(&entries[i].name[0], hostName) == 0);
+                }
+                if (found) {
+                    slot = i;
+                }
+            }
+            //Otherwise use a free entry or the oldest one which is not being refreshed
+            for (uint32 i = 0u; (i < HOST_NAME_CACHE_SIZE) && (slot == HOST_NAME_CACHE_SIZE); i++) {
+                if (!entries[i].valid) {
+                    slot = i;
+                }
+            }
+            for (uint32 i = 0u; (i < HOST_NAME_CACHE_SIZE) && (!found); i++) {
+                if (!entries[i].refreshing) {
+                    if (slot == HOST_NAME_CACHE_SIZE) {
+                        slot = i;
+                    }
+                    else if (entries[slot].valid) {
+                        if ((now - entries[i].resolved) > (now - entries[slot].resolved)) {
+                            slot = i;
+                        }
+                    }
+                    else {
+                        //A free entry is available
+                    }
+                }
+            }
+            if (slot < HOST_NAME_CACHE_SIZE) {
+                HostNameCacheEntry &entry = entries[slot];
+                if (!found) {
+                    (void) StringHelper::Copy(&entry.name[0], hostName);
+                    entry.valid = true;
+                }
+                entry.address = addressIn;
+                entry.resolved = now;
+            }
+        }
+        cacheSem.FastUnLock();
+    }
+
+    /**
+     * @brief Thread callback which refreshes an expired entry.
+     */
+    static void Refresh(const void * const parameters) {
+        /*lint -e{923} the index of the entry is passed as the thread parameter*/
+        uint32 i = static_cast<uint32>(reinterpret_cast<uintp>(parameters));
+        HostNameCache *cache = Instance();
+        char8 hostName[HOST_NAME_CACHE_MAX_NAME];
+        hostName[0] = '\0';
+        if (cache->cacheSem.FastLock() == ErrorManagement::NoError) {
+            (void) StringHelper::Copy(&hostName[0], &cache->entries[i].name[0]);
+        }
+        cache->cacheSem.FastUnLock();
+        uint32 addressOut = 0u;
+        if (Query(&hostName[0], addressOut)) {
+            cache->Store(&hostName[0], addressOut);
+        }
+        //On failure the entry expires and the next caller queries the resolver
+        if (cache->cacheSem.FastLock() == ErrorManagement::NoError) {
+            cache->entries[i].refreshing = false;
+        }
+        cache->cacheSem.FastUnLock();
+    }
+
+    FastPollingMutexSem cacheSem;
+
+    uint64 timeToLive;
+
+    HostNameCacheEntry entries[HOST_NAME_CACHE_SIZE];
+};
+
 StreamString InternetHost::GetHostName() const {
 
     if (hostnameFastSem.FastLock() != ErrorManagement::NoError) {
@@ -238,18 +487,25 @@ bool InternetHost::SetAddressByHostName(const char8 *hostName) {
     if (hostName == NULL) {
         hostName = "localhost";
     }
-    struct hostent *h = gethostbyname(hostName);
-
-    if (h != NULL) {
-        address.sin_addr.s_addr = *(reinterpret_cast<uint32 *>(h->h_addr_list[0]));
-        ret= true;
+    uint32 resolved = 0u;
+    ret = HostNameCache::Instance()->Resolve(hostName, resolved);
+    if (ret) {
+        address.sin_addr.s_addr = resolved;
     }
     else {
-        REPORT_ERROR_STATIC_0(ErrorManagement::OSError,"InternetHost: Failed gethostbyname()");
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError,"InternetHost: Failed getaddrinfo()");
     }
     return ret;
 }
 
+void InternetHost::SetResolutionCacheTimeToLive(const uint32 seconds) {
+    HostNameCache::Instance()->SetTimeToLive(seconds);
+}
+
+void InternetHost::ClearResolutionCache() {
+    HostNameCache::Instance()->Clear();
+}
+
 void InternetHost::SetAddressByNumber(const uint32 number) {
     address.sin_addr.s_addr = number;
 }
@@ -0,0 +1,309 @@
+/**
+ * @file PacketRingSocket.cpp
+ * @brief Source file for class PacketRingSocket
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PacketRingSocket (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <arpa/inet.h>
+#include <errno.h>
+#include <net/if.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <linux/if_packet.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
+#include "PacketRingSocket.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The tp_frame_size of the ring, which in TPACKET_V3 only bounds the number of frames that the kernel accounts for.
+ */
+static const uint32 PACKET_RING_SOCKET_FRAME_SIZE = 2048u;
+
+/**
+ * @brief Gets the header of a block of the ring.
+ */
+static struct tpacket_block_desc *PacketRingSocketBlock(const PacketRingSocketProperties &properties,
+                                                        const uint32 block) {
+    /*lint -e{927} -e{826} the blocks of the ring start with a tpacket_block_desc*/
+    return reinterpret_cast<struct tpacket_block_desc *>(&properties.ring[block * properties.blockSize]);
+}
+
+/**
+ * @brief Checks (with acquire semantics) if a block was handed over to the process.
+ */
+static bool PacketRingSocketBlockReady(const struct tpacket_block_desc * const blockDescriptor) {
+    uint32 status = __atomic_load_n(&blockDescriptor->hdr.bh1.block_status, __ATOMIC_ACQUIRE);
+    return ((status & static_cast<uint32>(TP_STATUS_USER)) != 0u);
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+PacketRingSocket::PacketRingSocket() {
+    properties.socketHandle = -1;
+    properties.ring = NULL_PTR(char8 *);
+    properties.ringSize = 0u;
+    properties.blockSize = 0u;
+    properties.numberOfBlocks = 0u;
+    properties.currentBlock = 0u;
+    properties.blockInUse = false;
+    properties.nextFrame = NULL_PTR(char8 *);
+    properties.remainingFrames = 0u;
+    properties.dropped = 0u;
+}
+
+PacketRingSocket::~PacketRingSocket() {
+    (void) Close();
+}
+
+bool PacketRingSocket::Open(const char8 * const interfaceName,
+                            const uint16 etherType,
+                            const uint32 blockSize,
+                            const uint32 numberOfBlocks,
+                            const uint32 blockTimeout) {
+    bool ok = !IsOpen();
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::IllegalOperation, "PacketRingSocket: The socket is already open");
+    }
+    uint32 interfaceIndex = 0u;
+    if (ok) {
+        uint32 pageSize = static_cast<uint32>(sysconf(_SC_PAGESIZE));
+        ok = ((blockSize >= PACKET_RING_SOCKET_FRAME_SIZE) && ((blockSize % pageSize) == 0u) && (numberOfBlocks > 0u));
+        if (ok) {
+            interfaceIndex = if_nametoindex(interfaceName);
+            ok = (interfaceIndex > 0u);
+            if (!ok) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "PacketRingSocket: Unknown network interface");
+            }
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "PacketRingSocket: The block size shall be a multiple of the page size and the number of blocks > 0");
+        }
+    }
+    if (ok) {
+        properties.socketHandle = socket(AF_PACKET, SOCK_RAW, static_cast<int32>(htons(etherType)));
+        ok = (properties.socketHandle >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PacketRingSocket: Failed socket(AF_PACKET) (check the CAP_NET_RAW capability)");
+        }
+    }
+    if (ok) {
+        int32 version = TPACKET_V3;
+        ok = (setsockopt(properties.socketHandle, SOL_PACKET, PACKET_VERSION, &version, static_cast<socklen_t>(sizeof(version))) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PacketRingSocket: TPACKET_V3 is not supported");
+        }
+    }
+    if (ok) {
+        struct tpacket_req3 request;
+        (void) memset(&request, 0, sizeof(request));
+        request.tp_block_size = blockSize;
+        request.tp_block_nr = numberOfBlocks;
+        request.tp_frame_size = PACKET_RING_SOCKET_FRAME_SIZE;
+        request.tp_frame_nr = (blockSize / PACKET_RING_SOCKET_FRAME_SIZE) * numberOfBlocks;
+        request.tp_retire_blk_tov = blockTimeout;
+        ok = (setsockopt(properties.socketHandle, SOL_PACKET, PACKET_RX_RING, &request, static_cast<socklen_t>(sizeof(request))) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PacketRingSocket: Failed setsockopt() setting PACKET_RX_RING");
+        }
+    }
+    if (ok) {
+        properties.ringSize = static_cast<size_t>(blockSize) * numberOfBlocks;
+        void *ring = mmap(NULL, properties.ringSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_LOCKED, properties.socketHandle, 0);
+        if (ring == MAP_FAILED) {
+            //The ring is not locked if RLIMIT_MEMLOCK does not allow it
+            ring = mmap(NULL, properties.ringSize, PROT_READ | PROT_WRITE, MAP_SHARED, properties.socketHandle, 0);
+        }
+        ok = (ring != MAP_FAILED);
+        if (ok) {
+            properties.ring = static_cast<char8 *>(ring);
+            properties.blockSize = blockSize;
+            properties.numberOfBlocks = numberOfBlocks;
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PacketRingSocket: Failed mmap() of the ring");
+        }
+    }
+    if (ok) {
+        //Bound after the ring is set up, so that no frame is queued outside the ring
+        struct sockaddr_ll address;
+        (void) memset(&address, 0, sizeof(address));
+        address.sll_family = static_cast<uint16>(AF_PACKET);
+        address.sll_protocol = htons(etherType);
+        address.sll_ifindex = static_cast<int32>(interfaceIndex);
+        /*lint -e{740} Pointer to Pointer cast required by operating system API.*/
+        ok = (bind(properties.socketHandle, reinterpret_cast<struct sockaddr *>(&address), static_cast<socklen_t>(sizeof(address))) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PacketRingSocket: Failed bind() to the network interface");
+        }
+    }
+    if (ok) {
+        properties.currentBlock = 0u;
+        properties.blockInUse = false;
+        properties.nextFrame = NULL_PTR(char8 *);
+        properties.remainingFrames = 0u;
+        properties.dropped = 0u;
+    }
+    else {
+        (void) Close();
+    }
+    return ok;
+}
+
+bool PacketRingSocket::Close() {
+    bool ok = true;
+    if (properties.ring != NULL_PTR(char8 *)) {
+        ok = (munmap(properties.ring, properties.ringSize) == 0);
+        properties.ring = NULL_PTR(char8 *);
+    }
+    if (properties.socketHandle >= 0) {
+        ok = (close(properties.socketHandle) == 0) && (ok);
+        properties.socketHandle = -1;
+    }
+    properties.blockInUse = false;
+    properties.remainingFrames = 0u;
+    return ok;
+}
+
+bool PacketRingSocket::IsOpen() const {
+    return (properties.ring != NULL_PTR(char8 *));
+}
+
+void PacketRingSocket::ReleaseBlock() {
+    if (properties.blockInUse) {
+        struct tpacket_block_desc *blockDescriptor = PacketRingSocketBlock(properties, properties.currentBlock);
+        //All the reads of the block happen before it is given back
+        __atomic_store_n(&blockDescriptor->hdr.bh1.block_status, static_cast<uint32>(TP_STATUS_KERNEL), __ATOMIC_RELEASE);
+        properties.currentBlock = ((properties.currentBlock + 1u) % properties.numberOfBlocks);
+        properties.blockInUse = false;
+        properties.remainingFrames = 0u;
+    }
+}
+
+bool PacketRingSocket::Receive(const char8 *&frame,
+                               uint32 &size,
+                               const TimeoutType &timeout) {
+    bool ok = IsOpen();
+    uint64 deadline = 0u;
+    if (timeout.IsFinite()) {
+        deadline = HighResolutionTimer::Counter() + timeout.HighResolutionTimerTicks();
+    }
+    bool waiting = (ok) && (properties.remainingFrames == 0u);
+    while (waiting) {
+        ReleaseBlock();
+        struct tpacket_block_desc *blockDescriptor = PacketRingSocketBlock(properties, properties.currentBlock);
+        if (PacketRingSocketBlockReady(blockDescriptor)) {
+            properties.blockInUse = true;
+            properties.remainingFrames = blockDescriptor->hdr.bh1.num_pkts;
+            properties.nextFrame = &(reinterpret_cast<char8 *>(blockDescriptor)[blockDescriptor->hdr.bh1.offset_to_first_pkt]);
+            //An empty block is released in the next iteration
+            waiting = (properties.remainingFrames == 0u);
+        }
+        else {
+            int32 timeoutMSec = -1;
+            if (timeout.IsFinite()) {
+                timeoutMSec = 0;
+                uint64 now = HighResolutionTimer::Counter();
+                if (now < deadline) {
+                    timeoutMSec = static_cast<int32>((((deadline - now) * 1000u) + (HighResolutionTimer::Frequency() - 1u)) / HighResolutionTimer::Frequency());
+                }
+            }
+            //The socket is readable when a block is handed over to the process
+            struct pollfd pollDescriptor;
+            pollDescriptor.fd = properties.socketHandle;
+            pollDescriptor.events = static_cast<int16>(POLLIN | POLLERR);
+            pollDescriptor.revents = 0;
+            int32 ready = poll(&pollDescriptor, 1u, timeoutMSec);
+            if (ready == 0) {
+                waiting = PacketRingSocketBlockReady(blockDescriptor);
+                ok = waiting;
+            }
+            else if ((ready < 0) && (errno != EINTR)) {
+                waiting = false;
+                ok = false;
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PacketRingSocket: Failed poll()");
+            }
+            else {
+                //Check the block again
+            }
+        }
+    }
+    if (ok) {
+        /*lint -e{927} -e{826} the frames of the block start with a tpacket3_hdr*/
+        const struct tpacket3_hdr *header = reinterpret_cast<const struct tpacket3_hdr *>(properties.nextFrame);
+        frame = &properties.nextFrame[header->tp_mac];
+        size = header->tp_snaplen;
+        properties.nextFrame = &properties.nextFrame[header->tp_next_offset];
+        properties.remainingFrames--;
+    }
+    return ok;
+}
+
+bool PacketRingSocket::Read(char8 * const output,
+                            uint32 &size,
+                            const TimeoutType &timeout) {
+    const char8 *frame = NULL_PTR(const char8 *);
+    uint32 frameSize = 0u;
+    bool ok = Receive(frame, frameSize, timeout);
+    if (ok) {
+        ok = (frameSize <= size);
+    }
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(output, frame, frameSize);
+        size = frameSize;
+    }
+    return ok;
+}
+
+uint64 PacketRingSocket::GetNumberOfDropped() {
+    if (IsOpen()) {
+        struct tpacket_stats_v3 statistics;
+        socklen_t length = static_cast<socklen_t>(sizeof(statistics));
+        if (getsockopt(properties.socketHandle, SOL_PACKET, PACKET_STATISTICS, &statistics, &length) == 0) {
+            properties.dropped += statistics.tp_drops;
+        }
+    }
+    return properties.dropped;
+}
+
+}
@@ -0,0 +1,73 @@
+/**
+ * @file PacketRingSocketProperties.h
+ * @brief Header file for class PacketRingSocketProperties
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class PacketRingSocketProperties
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PACKETRINGSOCKETPROPERTIES_H_
+#define PACKETRINGSOCKETPROPERTIES_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <stddef.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+/**
+ * AF_PACKET socket and TPACKET_V3 ring shared with the kernel (socketHandle < 0 if not open).
+ */
+struct PacketRingSocketProperties {
+    int32 socketHandle;
+    char8 *ring;
+    size_t ringSize;
+    uint32 blockSize;
+    uint32 numberOfBlocks;
+    /*
+     * The block being walked by Receive (owned by the process if blockInUse).
+     */
+    uint32 currentBlock;
+    bool blockInUse;
+    /*
+     * The next frame of the current block and the number of frames left.
+     */
+    char8 *nextFrame;
+    uint32 remainingFrames;
+    /*
+     * The PACKET_STATISTICS counters are reset when read.
+     */
+    uint64 dropped;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /*PACKETRINGSOCKETPROPERTIES_H_ */
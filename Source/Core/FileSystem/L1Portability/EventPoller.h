@@ -0,0 +1,227 @@
+/**
+ * @file EventPoller.h
+ * @brief Header file for class EventPoller
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class EventPoller
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EVENTPOLLER_H_
+#define EVENTPOLLER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "TimeoutType.h"
+#include "HandleI.h"
+
+#include INCLUDE_FILE_ENVIRONMENT(FileSystem,L1Portability,ENVIRONMENT,EventPollerProperties.h)
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * Monitor the handle for reading (and report when it is readable).
+     */
+    static const uint32 EventPollerRead = 0x1u;
+
+    /**
+     * Monitor the handle for writing (and report when it is writable).
+     */
+    static const uint32 EventPollerWrite = 0x2u;
+
+    /**
+     * Report the events only when the state of the handle changes (edge-triggered), instead of for as long as the condition holds.
+     */
+    static const uint32 EventPollerEdgeTriggered = 0x4u;
+
+    /**
+     * Disable the handle after the first reported event. It can be re-armed with EventPoller::Modify.
+     */
+    static const uint32 EventPollerOneShot = 0x8u;
+
+    /**
+     * Reported if an error condition occurred on the handle (always monitored).
+     */
+    static const uint32 EventPollerError = 0x10u;
+
+    /**
+     * Reported if the peer closed the connection (always monitored).
+     */
+    static const uint32 EventPollerHangUp = 0x20u;
+
+    /**
+     * @brief Class for monitoring I/O events on a large number of handles.
+     * @details Contrary to Select, the handles are registered once (and stay registered across waits)
+     * and the cost of WaitUntil only depends on the number of handles that received an event, not on the
+     * number (or the values) of the handles being monitored. This makes it adequate for services with many
+     * connections (e.g. servers with hundreds of clients).
+     *
+     * Each handle is registered with a user data pointer which is returned, together with the triggered events,
+     * by GetEventUserData and GetEvents for each of the events reported by the last WaitUntil.
+     *
+     * With EventPollerEdgeTriggered the handle is only reported when new data arrives (or space becomes
+     * available), so that the handle shall be non-blocking and be read (or written) until it would block.
+     */
+    class DLL_API EventPoller {
+
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param[in] maxEventsPerWait the maximum number of events that WaitUntil can report at once.
+         * @post
+         *   IsValid() if the operating system resources were successfully allocated.
+         */
+        EventPoller(const uint32 maxEventsPerWait = 64u);
+
+        /**
+         * @brief Destructor. Releases the operating system resources. The handles are not closed.
+         */
+        virtual ~EventPoller();
+
+        /**
+         * @brief Checks if the operating system resources were successfully allocated.
+         * @return true if the EventPoller can be used.
+         */
+        bool IsValid() const;
+
+        /**
+         * @brief Adds a handle to be monitored.
+         * @details The read handle is monitored for EventPollerRead and the write handle for EventPollerWrite.
+         * If these are different (e.g. for a console) and both modes are requested, the two handles are registered.
+         * @param[in] handle the handle to be monitored.
+         * @param[in] events combination of EventPollerRead, EventPollerWrite, EventPollerEdgeTriggered and EventPollerOneShot.
+         * @param[in] userData the pointer to be returned by GetEventUserData. If NULL, the address of handle is used.
+         * @pre
+         *   The handle must be valid &&
+         *   The handle must not have been added previously.
+         * @return true if the handle is correctly added to the watch list.
+         */
+        bool Add(const HandleI &handle,
+                 const uint32 events,
+                 void * const userData = NULL_PTR(void *));
+
+        /**
+         * @brief Changes the events being monitored on a handle (and re-arms an EventPollerOneShot handle).
+         * @param[in] handle the handle being monitored.
+         * @param[in] events see Add.
+         * @param[in] userData see Add.
+         * @pre
+         *   The handle must have been added previously.
+         * @return true if the monitored events are correctly updated.
+         */
+        bool Modify(const HandleI &handle,
+                    const uint32 events,
+                    void * const userData = NULL_PTR(void *));
+
+        /**
+         * @brief Removes a handle from being monitored.
+         * @param[in] handle the handle to be removed.
+         * @pre
+         *   The handle must have been added previously.
+         * @return true if the handle is correctly removed from the watch list.
+         */
+        bool Remove(const HandleI &handle);
+
+        /**
+         * @brief Blocks until an I/O event occurs in one of the added handles, or the function timeouts.
+         * @param[in] timeout is the timeout of the function, @see TimeoutType. Default is no timeout.
+         * @return -1 in case of errors, 0 if timeout expires, otherwise the number of events reported (at most maxEventsPerWait).
+         */
+        int32 WaitUntil(const TimeoutType &timeout = TTInfiniteWait);
+
+        /**
+         * @brief Gets the user data of an event reported by the last WaitUntil.
+         * @param[in] index the event index (< the value returned by WaitUntil).
+         * @return the userData of the handle which triggered the event or NULL if index is invalid.
+         */
+        void *GetEventUserData(const uint32 index) const;
+
+        /**
+         * @brief Gets the events reported by the last WaitUntil.
+         * @param[in] index the event index (< the value returned by WaitUntil).
+         * @return combination of EventPollerRead, EventPollerWrite, EventPollerError and EventPollerHangUp (0 if index is invalid).
+         */
+        uint32 GetEvents(const uint32 index) const;
+
+    private:
+
+        /**
+         * @brief Registers, modifies or removes one operating system handle.
+         * @param[in] operation the operating system operation.
+         * @param[in] descriptor the handle.
+         * @param[in] events see Add.
+         * @param[in] userData see Add.
+         * @return true if the operation succeeds.
+         */
+        bool Control(const int32 operation,
+                     const Handle descriptor,
+                     const uint32 events,
+                     void * const userData) const;
+
+        /**
+         * @brief Applies an operation to the read and/or the write handles.
+         * @param[in] operation the operating system operation.
+         * @param[in] handle the handle.
+         * @param[in] events see Add.
+         * @param[in] userData see Add.
+         * @return true if the operation succeeds for all the handles.
+         */
+        bool ControlHandle(const int32 operation,
+                           const HandleI &handle,
+                           const uint32 events,
+                           void * const userData) const;
+
+        /**
+         * The operating system poller handle.
+         */
+        Handle pollHandle;
+
+        /**
+         * Events reported by the last WaitUntil.
+         */
+        EventPollerEvent *readyEvents;
+
+        /**
+         * Capacity of readyEvents.
+         */
+        uint32 maxEvents;
+
+        /**
+         * Number of events reported by the last WaitUntil.
+         */
+        uint32 nOfEvents;
+    };
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EVENTPOLLER_H_ */
+
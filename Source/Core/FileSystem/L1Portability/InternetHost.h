@@ -123,11 +123,26 @@ namespace MARTe {
 
         /**
          * @brief Sets the host name.
+         * @details The address of the host name is kept in a process-wide cache (see SetResolutionCacheTimeToLive), so that
+         * reconnecting clients do not wait for the resolver each time.
          * @param[in] hostName the host name to be set.
          * @return true if the host name is set correctly, false otherwise.
          */
         bool SetAddressByHostName(const char8 * hostName);
 
+        /**
+         * @brief Sets for how long a resolved host name is used without querying the resolver again.
+         * @details After the time to live the cached address is still used, while it is refreshed in background,
+         * for another time to live period. Older addresses are resolved again by the caller. Default = 60 s.
+         * @param[in] seconds the time to live (0 disables the cache).
+         */
+        static void SetResolutionCacheTimeToLive(const uint32 seconds);
+
+        /**
+         * @brief Removes all the host names from the resolution cache (e.g. after a network configuration change).
+         */
+        static void ClearResolutionCache();
+
         /**
          * @brief Set the IP address a.b.c.d passing the equivalent input [a + 256*b + (256^2)*c + (256^3)*d].
          * @param[in] number is the IP address in unsigned int format.
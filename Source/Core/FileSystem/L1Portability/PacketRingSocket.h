@@ -0,0 +1,163 @@
+/**
+ * @file PacketRingSocket.h
+ * @brief Header file for class PacketRingSocket
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class PacketRingSocket
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PACKETRINGSOCKET_H_
+#define PACKETRINGSOCKET_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "TimeoutType.h"
+
+#include INCLUDE_FILE_ENVIRONMENT(FileSystem,L1Portability,ENVIRONMENT,PacketRingSocketProperties.h)
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+    /**
+     * The EtherType which receives the frames of all the protocols.
+     */
+    static const uint16 PACKET_RING_SOCKET_ALL_PROTOCOLS = 0x0003u;
+
+    /**
+     * @brief Receives the raw Ethernet frames of a network interface from a ring shared with the operating system.
+     * @details The frames bypass the IP and UDP stacks: the network driver writes them directly in a ring of blocks mapped in the
+     * memory of the process (on Linux a PACKET_MMAP TPACKET_V3 ring of an AF_PACKET socket). The blocks are handed over in bulk:
+     * the operating system gives a block to the process when it is full (or when blockTimeout elapses) and Receive walks the
+     * frames of the block without any system call, only waiting (poll) when the next block is not ready yet.
+     *
+     * Receive returns a pointer to the frame in the ring (no copy), which is valid until the next call to Receive or Read.
+     * Read copies the frame, e.g. to implement the DriverRead of a CircularBufferThreadInputDataSource:
+     * <pre>
+     * bool MyADCDataSource::DriverRead(char8 * const bufferToFill, uint32 &sizeToRead, const uint32 signalIdx) {
+     *     return packetRing.Read(bufferToFill, sizeToRead, timeout);
+     * }
+     * </pre>
+     * while a DriverReadBatch can de-interleave the frames straight from the ring with Receive.
+     *
+     * The class is not thread safe: the frames shall be received by a single thread. Opening the socket requires the CAP_NET_RAW
+     * capability.
+     */
+    class DLL_API PacketRingSocket {
+
+    public:
+
+        /**
+         * @brief Constructor.
+         * @post
+         *   not IsOpen()
+         */
+        PacketRingSocket();
+
+        /**
+         * @brief Destructor. Closes the socket.
+         */
+        ~PacketRingSocket();
+
+        /**
+         * @brief Opens the socket, binds it to a network interface and maps the ring.
+         * @param[in] interfaceName the network interface (e.g. eth1).
+         * @param[in] etherType the EtherType of the frames to receive (e.g. 0x88B5), or PACKET_RING_SOCKET_ALL_PROTOCOLS.
+         * @param[in] blockSize the size of each block of the ring in bytes (a multiple of the page size, larger than the frames).
+         * @param[in] numberOfBlocks the number of blocks of the ring.
+         * @param[in] blockTimeout the time in milliseconds after which a block which is not full is handed over to the process
+         * (i.e. the maximum latency added by the ring when the traffic is low).
+         * @pre
+         *   not IsOpen()
+         * @return true if the socket was opened and the ring mapped.
+         */
+        bool Open(const char8 * const interfaceName,
+                  const uint16 etherType = PACKET_RING_SOCKET_ALL_PROTOCOLS,
+                  const uint32 blockSize = 65536u,
+                  const uint32 numberOfBlocks = 64u,
+                  const uint32 blockTimeout = 1u);
+
+        /**
+         * @brief Unmaps the ring and closes the socket.
+         * @return true if the socket was closed.
+         */
+        bool Close();
+
+        /**
+         * @brief Checks if the socket is open.
+         * @return true if the socket is open.
+         */
+        bool IsOpen() const;
+
+        /**
+         * @brief Gets the next frame, without copying it.
+         * @param[out] frame the first byte (i.e. the Ethernet header) of the frame in the ring, valid until the next call to Receive or Read.
+         * @param[out] size the number of bytes of the frame.
+         * @param[in] timeout the maximum time to wait for the next frame.
+         * @return true if a frame was received (false on timeout).
+         */
+        bool Receive(const char8 *&frame,
+                     uint32 &size,
+                     const TimeoutType &timeout = TTInfiniteWait);
+
+        /**
+         * @brief Copies the next frame.
+         * @param[out] output where to write the frame.
+         * @param[in,out] size the size of \a output. On output the number of bytes of the frame.
+         * @param[in] timeout the maximum time to wait for the next frame.
+         * @return true if a frame was received (false on timeout, or if the frame did not fit in \a output, in which case it is discarded).
+         */
+        bool Read(char8 * const output,
+                  uint32 &size,
+                  const TimeoutType &timeout = TTInfiniteWait);
+
+        /**
+         * @brief Gets the number of frames discarded by the operating system because the ring was full.
+         * @return the number of frames discarded since the socket was opened.
+         */
+        uint64 GetNumberOfDropped();
+
+    private:
+
+        /**
+         * @brief Hands the current block back to the operating system.
+         */
+        void ReleaseBlock();
+
+        /**
+         * The operating system specific properties.
+         */
+        PacketRingSocketProperties properties;
+    };
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* PACKETRINGSOCKET_H_ */
@@ -0,0 +1,87 @@
+/**
+ * @file MappedFile.cpp
+ * @brief Source file for class MappedFile
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MappedFile (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MappedFile.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MappedFile::MappedFile() :
+        StreamMemoryReference(),
+        BasicMappedFile() {
+
+}
+
+MappedFile::~MappedFile() {
+    if (IsMapped()) {
+        (void) MappedFile::Close();
+    }
+}
+
+bool MappedFile::Open(const char8 * const pathname,
+                      const uint32 flags,
+                      const uint64 size) {
+    bool ok = BasicMappedFile::Open(pathname, flags, size);
+    if (ok) {
+        uint32 streamSize = 0xFFFFFFFFu;
+        if (GetMappedSize() < static_cast<uint64>(streamSize)) {
+            streamSize = static_cast<uint32>(GetMappedSize());
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "MappedFile: The stream only addresses the first 4 GB of the mapping");
+        }
+        IOBuffer *buffer = GetReadBuffer();
+        if (IsWritable()) {
+            buffer->SetBufferReferencedMemory(GetData(), streamSize, 0u);
+        }
+        else {
+            buffer->SetBufferReadOnlyReferencedMemory(GetData(), streamSize, 0u);
+            buffer->SetUsedSize(streamSize);
+        }
+    }
+    return ok;
+}
+
+bool MappedFile::Close() {
+    GetReadBuffer()->SetBufferReadOnlyReferencedMemory(NULL_PTR(const char8 *), 0u, 0u);
+    return BasicMappedFile::Close();
+}
+
+}
@@ -0,0 +1,89 @@
+/**
+ * @file MappedFile.h
+ * @brief Header file for class MappedFile
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MappedFile
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_CORE_FILESYSTEM_L3STREAMS_MAPPEDFILE_H_
+#define SOURCE_CORE_FILESYSTEM_L3STREAMS_MAPPEDFILE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "BasicMappedFile.h"
+#include "StreamMemoryReference.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Stream over a memory mapped file.
+ * @details The stream is a StreamMemoryReference over the mapped pages, so that the file can be given to any parser
+ * (or consumer of a BufferedStreamI) and the reads and the tokens are served directly from the mapping, without
+ * system calls nor intermediate buffers. The data can also be accessed directly with GetData().
+ *
+ * For a read-only mapping the stream Size() is the size of the mapping. For a writable mapping the stream starts
+ * empty (as a StreamMemoryReference over a read/write buffer) and the written bytes go directly into the file.
+ *
+ * @warning The stream interface addresses at most 4 GB (uint32 positions): larger mappings are only accessible
+ * after the first 4 GB through GetData().
+ */
+class MappedFile: public StreamMemoryReference, public BasicMappedFile {
+
+public:
+    /**
+     * @brief Default constructor. NOOP.
+     */
+    MappedFile();
+
+    /**
+     * @brief Default destructor. Unmaps the file.
+     */
+    virtual ~MappedFile();
+
+    /**
+     * @brief Maps the file and binds the stream to the mapping.
+     * @see BasicMappedFile::Open
+     */
+    virtual bool Open(const char8 * const pathname,
+                      const uint32 flags,
+                      const uint64 size = 0u);
+
+    /**
+     * @brief Unbinds the stream and unmaps the file.
+     * @see BasicMappedFile::Close
+     */
+    virtual bool Close();
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_CORE_FILESYSTEM_L3STREAMS_MAPPEDFILE_H_ */
@@ -0,0 +1,186 @@
+/**
+ * @file MulticastPublisher.cpp
+ * @brief Source file for class MulticastPublisher
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MulticastPublisher (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MemoryOperationsHelper.h"
+#include "MulticastPublisher.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MulticastPublisher::MulticastPublisher() :
+        socket() {
+    sequence = 0u;
+    datagramSize = MULTICAST_DEFAULT_DATAGRAM_SIZE;
+    datagrams = NULL_PTR(char8 *);
+    datagramsCapacity = 0u;
+    buffers = NULL_PTR(char8 **);
+    sizes = NULL_PTR(uint32 *);
+}
+
+MulticastPublisher::~MulticastPublisher() {
+    (void) MulticastPublisher::Close();
+}
+
+bool MulticastPublisher::Open(const char8 * const group,
+                              const uint16 port,
+                              const char8 * const interfaceAddress,
+                              const uint8 ttl,
+                              const uint32 maxDatagramSize) {
+    bool ok = !IsOpen();
+    if (ok) {
+        ok = (maxDatagramSize > MULTICAST_FRAME_HEADER_SIZE);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "MulticastPublisher: The datagram size shall be larger than %d", MULTICAST_FRAME_HEADER_SIZE);
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::IllegalOperation, "MulticastPublisher: The socket is already open");
+    }
+    if (ok) {
+        datagramSize = maxDatagramSize;
+        ok = socket.Open();
+    }
+    if (ok) {
+        ok = socket.Connect(group, port);
+    }
+    if ((ok) && (interfaceAddress != NULL)) {
+        ok = socket.SetMulticastInterface(interfaceAddress);
+    }
+    if (ok) {
+        ok = socket.SetMulticastTTL(ttl);
+    }
+    if (!ok) {
+        if (socket.IsValid()) {
+            (void) socket.Close();
+        }
+    }
+    return ok;
+}
+
+bool MulticastPublisher::Close() {
+    bool ok = true;
+    if (IsOpen()) {
+        ok = socket.Close();
+    }
+    if (datagrams != NULL) {
+        delete[] datagrams;
+        delete[] buffers;
+        delete[] sizes;
+        datagrams = NULL_PTR(char8 *);
+        buffers = NULL_PTR(char8 **);
+        sizes = NULL_PTR(uint32 *);
+        datagramsCapacity = 0u;
+    }
+    return ok;
+}
+
+bool MulticastPublisher::IsOpen() const {
+    return socket.IsValid();
+}
+
+bool MulticastPublisher::Publish(const char8 * const frame,
+                                 const uint32 size) {
+    uint32 payloadSize = datagramSize - MULTICAST_FRAME_HEADER_SIZE;
+    uint32 numberOfFragments = (size + payloadSize - 1u) / payloadSize;
+    if (numberOfFragments == 0u) {
+        //An empty frame is still sent, so that the subscribers see the sequence number
+        numberOfFragments = 1u;
+    }
+    bool ok = IsOpen();
+    if (ok) {
+        ok = (numberOfFragments <= 0xFFFFu);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "MulticastPublisher: The frame is too large (%d bytes)", size);
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::IllegalOperation, "MulticastPublisher: The socket is not open");
+    }
+    if ((ok) && (numberOfFragments > datagramsCapacity)) {
+        if (datagrams != NULL) {
+            delete[] datagrams;
+            delete[] buffers;
+            delete[] sizes;
+        }
+        datagramsCapacity = numberOfFragments;
+        datagrams = new char8[datagramsCapacity * datagramSize];
+        buffers = new char8*[datagramsCapacity];
+        sizes = new uint32[datagramsCapacity];
+    }
+    if (ok) {
+        MulticastFrameHeader header;
+        header.sequence = sequence;
+        header.frameSize = size;
+        header.numberOfFragments = static_cast<uint16>(numberOfFragments);
+        uint32 offset = 0u;
+        for (uint32 i = 0u; (i < numberOfFragments) && (ok); i++) {
+            uint32 fragmentSize = size - offset;
+            if (fragmentSize > payloadSize) {
+                fragmentSize = payloadSize;
+            }
+            char8 *datagram = &datagrams[i * datagramSize];
+            header.fragment = static_cast<uint16>(i);
+            MulticastFrameHeaderWrite(header, datagram);
+            if (fragmentSize > 0u) {
+                ok = MemoryOperationsHelper::Copy(&datagram[MULTICAST_FRAME_HEADER_SIZE], &frame[offset], fragmentSize);
+            }
+            buffers[i] = datagram;
+            sizes[i] = MULTICAST_FRAME_HEADER_SIZE + fragmentSize;
+            offset += fragmentSize;
+        }
+    }
+    if (ok) {
+        uint32 written = numberOfFragments;
+        ok = socket.WriteBatch(buffers, sizes, written);
+    }
+    sequence++;
+    return ok;
+}
+
+uint32 MulticastPublisher::GetSequenceNumber() const {
+    return sequence;
+}
+
+BasicUDPSocket &MulticastPublisher::GetSocket() {
+    return socket;
+}
+
+}
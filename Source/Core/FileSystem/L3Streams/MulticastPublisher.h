@@ -0,0 +1,246 @@
+/**
+ * @file MulticastPublisher.h
+ * @brief Header file for class MulticastPublisher
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MulticastPublisher
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef SOURCE_CORE_FILESYSTEM_L3STREAMS_MULTICASTPUBLISHER_H_
+#define SOURCE_CORE_FILESYSTEM_L3STREAMS_MULTICASTPUBLISHER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "BasicUDPSocket.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Header of each datagram sent by the MulticastPublisher (see MulticastFrameHeaderWrite for the wire format, which is big endian).
+ */
+struct MulticastFrameHeader {
+    /**
+     * Sequence number of the frame (incremented by one for each published frame).
+     */
+    uint32 sequence;
+
+    /**
+     * Size in bytes of the whole frame.
+     */
+    uint32 frameSize;
+
+    /**
+     * Index of the fragment in the frame.
+     */
+    uint16 fragment;
+
+    /**
+     * Number of fragments of the frame.
+     */
+    uint16 numberOfFragments;
+};
+
+/**
+ * Size of the MulticastFrameHeader on the wire.
+ */
+static const uint32 MULTICAST_FRAME_HEADER_SIZE = 12u;
+
+/**
+ * @brief Writes a MulticastFrameHeader in the wire format.
+ * @param[in] header the header.
+ * @param[out] buffer the destination (at least MULTICAST_FRAME_HEADER_SIZE bytes).
+ */
+inline void MulticastFrameHeaderWrite(const MulticastFrameHeader &header,
+                                      char8 * const buffer);
+
+/**
+ * @brief Reads a MulticastFrameHeader from the wire format.
+ * @param[in] buffer the source (at least MULTICAST_FRAME_HEADER_SIZE bytes).
+ * @param[out] header the header.
+ */
+inline void MulticastFrameHeaderRead(const char8 * const buffer,
+                                     MulticastFrameHeader &header);
+
+/**
+ * Default maximum datagram size (the UDP payload of an Ethernet frame with MTU 1500 bytes).
+ */
+static const uint32 MULTICAST_DEFAULT_DATAGRAM_SIZE = 1472u;
+
+/**
+ * @brief Publishes frames (e.g. the signals of a DataSource for each cycle) to a multicast group, so that any number
+ * of MulticastSubscriber instances, on any node, receive them with a single transmission.
+ * @details Each frame gets a sequence number and is split in fragments that fit in a datagram (each prefixed by a
+ * MulticastFrameHeader). All the fragments of a frame are sent with a single BasicUDPSocket::WriteBatch (sendmmsg).
+ *
+ * There are no acknowledgements nor retransmissions: a subscriber that loses a fragment drops the frame and reports
+ * the gap (see MulticastSubscriber).
+ */
+class MulticastPublisher {
+
+public:
+    /**
+     * @brief Default constructor.
+     * @post
+     *   not IsOpen()
+     */
+    MulticastPublisher();
+
+    /**
+     * @brief Destructor. Closes the socket.
+     */
+    virtual ~MulticastPublisher();
+
+    /**
+     * @brief Opens the socket that sends to a multicast group.
+     * @param[in] group the multicast group IP address (e.g. 239.0.0.1).
+     * @param[in] port the destination port.
+     * @param[in] interfaceAddress the IP address of the local interface to send from (NULL for the interface chosen by
+     * the operating system).
+     * @param[in] ttl the multicast time to live (1 = local network only).
+     * @param[in] maxDatagramSize the maximum size of each datagram (header included).
+     * @pre
+     *   not IsOpen()
+     * @return true if the socket was opened and configured.
+     */
+    bool Open(const char8 * const group,
+              const uint16 port,
+              const char8 * const interfaceAddress = NULL_PTR(const char8 *),
+              const uint8 ttl = 1u,
+              const uint32 maxDatagramSize = MULTICAST_DEFAULT_DATAGRAM_SIZE);
+
+    /**
+     * @brief Closes the socket.
+     * @return true if the socket was closed.
+     */
+    bool Close();
+
+    /**
+     * @brief Checks if the socket is open.
+     * @return true if the socket is open.
+     */
+    bool IsOpen() const;
+
+    /**
+     * @brief Sends a frame.
+     * @param[in] frame the frame.
+     * @param[in] size the size of the frame (at most 65535 fragments).
+     * @return true if all the fragments were sent.
+     * @post
+     *   GetSequenceNumber() is incremented (also if the frame could not be sent, so that the subscribers detect the gap).
+     */
+    bool Publish(const char8 * const frame,
+                 const uint32 size);
+
+    /**
+     * @brief Gets the sequence number of the next frame.
+     * @return the sequence number of the next frame.
+     */
+    uint32 GetSequenceNumber() const;
+
+    /**
+     * @brief Gets the socket, e.g. to change other socket options.
+     * @return the socket.
+     */
+    BasicUDPSocket &GetSocket();
+
+private:
+
+    /**
+     * The socket.
+     */
+    BasicUDPSocket socket;
+
+    /**
+     * The sequence number of the next frame.
+     */
+    uint32 sequence;
+
+    /**
+     * The maximum size of each datagram.
+     */
+    uint32 datagramSize;
+
+    /**
+     * The datagrams of the frame being sent (header and payload).
+     */
+    char8 *datagrams;
+
+    /**
+     * The number of datagrams which fit in datagrams.
+     */
+    uint32 datagramsCapacity;
+
+    /**
+     * The pointer to each datagram.
+     */
+    char8 **buffers;
+
+    /**
+     * The size of each datagram.
+     */
+    uint32 *sizes;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+void MulticastFrameHeaderWrite(const MulticastFrameHeader &header,
+                               char8 * const buffer) {
+    uint8 * const bytes = reinterpret_cast<uint8 *>(buffer);
+    bytes[0] = static_cast<uint8>(header.sequence >> 24u);
+    bytes[1] = static_cast<uint8>(header.sequence >> 16u);
+    bytes[2] = static_cast<uint8>(header.sequence >> 8u);
+    bytes[3] = static_cast<uint8>(header.sequence);
+    bytes[4] = static_cast<uint8>(header.frameSize >> 24u);
+    bytes[5] = static_cast<uint8>(header.frameSize >> 16u);
+    bytes[6] = static_cast<uint8>(header.frameSize >> 8u);
+    bytes[7] = static_cast<uint8>(header.frameSize);
+    bytes[8] = static_cast<uint8>(header.fragment >> 8u);
+    bytes[9] = static_cast<uint8>(header.fragment);
+    bytes[10] = static_cast<uint8>(header.numberOfFragments >> 8u);
+    bytes[11] = static_cast<uint8>(header.numberOfFragments);
+}
+
+void MulticastFrameHeaderRead(const char8 * const buffer,
+                              MulticastFrameHeader &header) {
+    const uint8 * const bytes = reinterpret_cast<const uint8 *>(buffer);
+    header.sequence = (static_cast<uint32>(bytes[0]) << 24u) | (static_cast<uint32>(bytes[1]) << 16u) | (static_cast<uint32>(bytes[2]) << 8u)
+            | static_cast<uint32>(bytes[3]);
+    header.frameSize = (static_cast<uint32>(bytes[4]) << 24u) | (static_cast<uint32>(bytes[5]) << 16u) | (static_cast<uint32>(bytes[6]) << 8u)
+            | static_cast<uint32>(bytes[7]);
+    header.fragment = static_cast<uint16>((static_cast<uint32>(bytes[8]) << 8u) | static_cast<uint32>(bytes[9]));
+    header.numberOfFragments = static_cast<uint16>((static_cast<uint32>(bytes[10]) << 8u) | static_cast<uint32>(bytes[11]));
+}
+
+}
+
+#endif /* SOURCE_CORE_FILESYSTEM_L3STREAMS_MULTICASTPUBLISHER_H_ */
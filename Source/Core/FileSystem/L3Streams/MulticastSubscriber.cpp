@@ -0,0 +1,313 @@
+/**
+ * @file MulticastSubscriber.cpp
+ * @brief Source file for class MulticastSubscriber
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MulticastSubscriber (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
+#include "MulticastSubscriber.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Maximum number of datagrams read with a single ReadBatch.
+ */
+static const uint32 MULTICAST_SUBSCRIBER_BATCH = 32u;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MulticastSubscriber::MulticastSubscriber() :
+        socket() {
+    datagramSize = MULTICAST_DEFAULT_DATAGRAM_SIZE;
+    frameCapacity = 0u;
+    datagrams = NULL_PTR(char8 *);
+    buffers = NULL_PTR(char8 **);
+    sizes = NULL_PTR(uint32 *);
+    numberOfDatagrams = 0u;
+    nextDatagram = 0u;
+    assembly = NULL_PTR(char8 *);
+    fragmentReceived = NULL_PTR(bool *);
+    current.sequence = 0u;
+    current.frameSize = 0u;
+    current.fragment = 0u;
+    current.numberOfFragments = 0u;
+    fragmentsReceived = 0u;
+    assembling = false;
+    expectedSequence = 0u;
+    synchronised = false;
+    receivedFrames = 0u;
+    lostFrames = 0u;
+}
+
+MulticastSubscriber::~MulticastSubscriber() {
+    (void) MulticastSubscriber::Close();
+}
+
+bool MulticastSubscriber::Open(const char8 * const group,
+                               const uint16 port,
+                               const uint32 maxFrameSize,
+                               const char8 * const interfaceAddress,
+                               const uint32 maxDatagramSize,
+                               const uint32 receiveBufferSize) {
+    bool ok = !IsOpen();
+    if (ok) {
+        ok = (maxDatagramSize > MULTICAST_FRAME_HEADER_SIZE);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "MulticastSubscriber: The datagram size shall be larger than %d", MULTICAST_FRAME_HEADER_SIZE);
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::IllegalOperation, "MulticastSubscriber: The socket is already open");
+    }
+    if (ok) {
+        datagramSize = maxDatagramSize;
+        frameCapacity = maxFrameSize;
+        ok = socket.Open();
+    }
+    if (ok) {
+        //Join sets SO_REUSEADDR, which shall be set before binding
+        ok = socket.Join(group, interfaceAddress);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "MulticastSubscriber: Failed to join the group %s", group);
+        }
+    }
+    if (ok) {
+        ok = socket.Listen(port);
+    }
+    if ((ok) && (receiveBufferSize > 0u)) {
+        ok = socket.SetReceiveBufferSize(receiveBufferSize);
+    }
+    if (ok) {
+        uint32 payloadSize = datagramSize - MULTICAST_FRAME_HEADER_SIZE;
+        uint32 maxFragments = (frameCapacity / payloadSize) + 1u;
+        datagrams = new char8[MULTICAST_SUBSCRIBER_BATCH * datagramSize];
+        buffers = new char8*[MULTICAST_SUBSCRIBER_BATCH];
+        sizes = new uint32[MULTICAST_SUBSCRIBER_BATCH];
+        for (uint32 i = 0u; i < MULTICAST_SUBSCRIBER_BATCH; i++) {
+            buffers[i] = &datagrams[i * datagramSize];
+        }
+        assembly = new char8[frameCapacity + 1u];
+        fragmentReceived = new bool[maxFragments];
+        numberOfDatagrams = 0u;
+        nextDatagram = 0u;
+        assembling = false;
+        synchronised = false;
+        receivedFrames = 0u;
+        lostFrames = 0u;
+    }
+    if (!ok) {
+        if (socket.IsValid()) {
+            (void) socket.Close();
+        }
+    }
+    return ok;
+}
+
+void MulticastSubscriber::FreeBuffers() {
+    if (datagrams != NULL) {
+        delete[] datagrams;
+        delete[] buffers;
+        delete[] sizes;
+        delete[] assembly;
+        delete[] fragmentReceived;
+        datagrams = NULL_PTR(char8 *);
+        buffers = NULL_PTR(char8 **);
+        sizes = NULL_PTR(uint32 *);
+        assembly = NULL_PTR(char8 *);
+        fragmentReceived = NULL_PTR(bool *);
+    }
+}
+
+bool MulticastSubscriber::Close() {
+    bool ok = true;
+    if (IsOpen()) {
+        ok = socket.Close();
+    }
+    FreeBuffers();
+    return ok;
+}
+
+bool MulticastSubscriber::IsOpen() const {
+    return socket.IsValid();
+}
+
+bool MulticastSubscriber::ProcessDatagram(const char8 * const datagram,
+                                          const uint32 datagramLength) {
+    bool complete = false;
+    MulticastFrameHeader header;
+    uint32 payloadSize = datagramSize - MULTICAST_FRAME_HEADER_SIZE;
+    bool valid = (datagramLength >= MULTICAST_FRAME_HEADER_SIZE);
+    uint32 fragmentOffset = 0u;
+    uint32 fragmentSize = 0u;
+    if (valid) {
+        MulticastFrameHeaderRead(datagram, header);
+        uint32 numberOfFragments = (header.frameSize + payloadSize - 1u) / payloadSize;
+        if (numberOfFragments == 0u) {
+            numberOfFragments = 1u;
+        }
+        valid = (header.frameSize <= frameCapacity);
+        if (valid) {
+            valid = (header.numberOfFragments == numberOfFragments) && (header.fragment < header.numberOfFragments);
+        }
+        if (valid) {
+            fragmentOffset = static_cast<uint32>(header.fragment) * payloadSize;
+            fragmentSize = header.frameSize - fragmentOffset;
+            if (fragmentSize > payloadSize) {
+                fragmentSize = payloadSize;
+            }
+            valid = ((datagramLength - MULTICAST_FRAME_HEADER_SIZE) == fragmentSize);
+        }
+    }
+    if ((valid) && (assembling)) {
+        int32 age = static_cast<int32>(header.sequence - current.sequence);
+        //A fragment of an older frame is ignored
+        valid = (age >= 0);
+        if ((valid) && (age > 0)) {
+            //The frame being assembled will never be completed
+            lostFrames++;
+            assembling = false;
+        }
+    }
+    else if ((valid) && (synchronised)) {
+        valid = (static_cast<int32>(header.sequence - expectedSequence) >= 0);
+    }
+    else {
+        //First frame or invalid datagram
+    }
+    if ((valid) && (!assembling)) {
+        if (synchronised) {
+            lostFrames += (header.sequence - expectedSequence);
+        }
+        synchronised = true;
+        expectedSequence = header.sequence + 1u;
+        current = header;
+        fragmentsReceived = 0u;
+        for (uint32 i = 0u; i < header.numberOfFragments; i++) {
+            fragmentReceived[i] = false;
+        }
+        assembling = true;
+    }
+    if (valid) {
+        if (!fragmentReceived[header.fragment]) {
+            fragmentReceived[header.fragment] = true;
+            fragmentsReceived++;
+            if (fragmentSize > 0u) {
+                (void) MemoryOperationsHelper::Copy(&assembly[fragmentOffset], &datagram[MULTICAST_FRAME_HEADER_SIZE], fragmentSize);
+            }
+        }
+        complete = (fragmentsReceived == static_cast<uint32>(current.numberOfFragments));
+        if (complete) {
+            assembling = false;
+        }
+    }
+    return complete;
+}
+
+bool MulticastSubscriber::Receive(char8 * const frame,
+                                  uint32 &size,
+                                  uint32 &sequence,
+                                  const TimeoutType &timeout) {
+    bool ok = IsOpen();
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::IllegalOperation, "MulticastSubscriber: The socket is not open");
+    }
+    uint64 deadline = 0u;
+    if (timeout.IsFinite()) {
+        deadline = HighResolutionTimer::Counter() + timeout.HighResolutionTimerTicks();
+    }
+    bool complete = false;
+    while ((ok) && (!complete)) {
+        if (nextDatagram >= numberOfDatagrams) {
+            TimeoutType remaining = TTInfiniteWait;
+            if (timeout.IsFinite()) {
+                uint64 now = HighResolutionTimer::Counter();
+                ok = (now < deadline);
+                if (ok) {
+                    remaining.SetTimeoutHighResolutionTimerTicks(deadline - now);
+                    //A zero timeout would disable the socket timeout
+                    ok = (remaining.GetTimeoutUSec() > 0u);
+                }
+            }
+            if (ok) {
+                numberOfDatagrams = MULTICAST_SUBSCRIBER_BATCH;
+                for (uint32 i = 0u; i < MULTICAST_SUBSCRIBER_BATCH; i++) {
+                    sizes[i] = datagramSize;
+                }
+                ok = socket.ReadBatch(buffers, sizes, numberOfDatagrams, NULL_PTR(InternetHost *), remaining);
+                nextDatagram = 0u;
+            }
+        }
+        if (ok) {
+            complete = ProcessDatagram(buffers[nextDatagram], sizes[nextDatagram]);
+            nextDatagram++;
+        }
+    }
+    if (complete) {
+        ok = (current.frameSize <= size);
+        if (ok) {
+            size = current.frameSize;
+            sequence = current.sequence;
+            if (size > 0u) {
+                ok = MemoryOperationsHelper::Copy(frame, assembly, size);
+            }
+            receivedFrames++;
+        }
+        else {
+            lostFrames++;
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "MulticastSubscriber: The frame (%d bytes) does not fit in the buffer", current.frameSize);
+        }
+    }
+    return ok;
+}
+
+uint64 MulticastSubscriber::GetNumberOfReceivedFrames() const {
+    return receivedFrames;
+}
+
+uint64 MulticastSubscriber::GetNumberOfLostFrames() const {
+    return lostFrames;
+}
+
+BasicUDPSocket &MulticastSubscriber::GetSocket() {
+    return socket;
+}
+
+}
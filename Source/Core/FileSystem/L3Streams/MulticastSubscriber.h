@@ -0,0 +1,242 @@
+/**
+ * @file MulticastSubscriber.h
+ * @brief Header file for class MulticastSubscriber
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MulticastSubscriber
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef SOURCE_CORE_FILESYSTEM_L3STREAMS_MULTICASTSUBSCRIBER_H_
+#define SOURCE_CORE_FILESYSTEM_L3STREAMS_MULTICASTSUBSCRIBER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "BasicUDPSocket.h"
+#include "MulticastPublisher.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Receives the frames sent by a MulticastPublisher.
+ * @details The datagrams are read in batches (BasicUDPSocket::ReadBatch, i.e. recvmmsg) and the fragments are
+ * reassembled. A frame is delivered only when all its fragments were received. A frame whose fragments
+ * are still missing when a fragment of a newer frame arrives is dropped, and fragments of older frames are ignored.
+ *
+ * The sequence numbers of the delivered frames allow to detect the gaps: GetNumberOfLostFrames counts the frames
+ * which were never delivered (completely missed or incomplete).
+ *
+ * Only one publisher shall send to the same group and port.
+ */
+class MulticastSubscriber {
+
+public:
+    /**
+     * @brief Default constructor.
+     * @post
+     *   not IsOpen()
+     */
+    MulticastSubscriber();
+
+    /**
+     * @brief Destructor. Closes the socket.
+     */
+    virtual ~MulticastSubscriber();
+
+    /**
+     * @brief Opens the socket and joins a multicast group.
+     * @param[in] group the multicast group IP address (e.g. 239.0.0.1).
+     * @param[in] port the port where the publisher sends.
+     * @param[in] maxFrameSize the maximum size of a frame. Larger frames are discarded.
+     * @param[in] interfaceAddress the IP address of the local interface where to join the group (NULL for the
+     * interface chosen by the operating system).
+     * @param[in] maxDatagramSize the maximum size of each datagram, which shall be the same as in the publisher.
+     * @param[in] receiveBufferSize the size of the socket receive buffer (0 for the operating system default). Shall
+     * be large enough to absorb the largest frames.
+     * @pre
+     *   not IsOpen()
+     * @return true if the socket was opened and the group joined.
+     */
+    bool Open(const char8 * const group,
+              const uint16 port,
+              const uint32 maxFrameSize,
+              const char8 * const interfaceAddress = NULL_PTR(const char8 *),
+              const uint32 maxDatagramSize = MULTICAST_DEFAULT_DATAGRAM_SIZE,
+              const uint32 receiveBufferSize = 0u);
+
+    /**
+     * @brief Closes the socket.
+     * @return true if the socket was closed.
+     */
+    bool Close();
+
+    /**
+     * @brief Checks if the socket is open.
+     * @return true if the socket is open.
+     */
+    bool IsOpen() const;
+
+    /**
+     * @brief Waits for the next complete frame.
+     * @param[out] frame where to write the frame.
+     * @param[in,out] size the size of \a frame. On output the size of the received frame.
+     * @param[out] sequence the sequence number of the received frame.
+     * @param[in] timeout the maximum time to wait.
+     * @return true if a frame was received (false on timeout, or if the frame did not fit in \a frame, in which case it is discarded).
+     */
+    bool Receive(char8 * const frame,
+                 uint32 &size,
+                 uint32 &sequence,
+                 const TimeoutType &timeout = TTInfiniteWait);
+
+    /**
+     * @brief Gets the number of frames which were delivered by Receive.
+     * @return the number of frames received.
+     */
+    uint64 GetNumberOfReceivedFrames() const;
+
+    /**
+     * @brief Gets the number of frames which were sent by the publisher but not delivered.
+     * @return the number of lost frames.
+     */
+    uint64 GetNumberOfLostFrames() const;
+
+    /**
+     * @brief Gets the socket, e.g. to change other socket options.
+     * @return the socket.
+     */
+    BasicUDPSocket &GetSocket();
+
+private:
+
+    /**
+     * @brief Adds a datagram to the frame being assembled.
+     * @param[in] datagram the datagram.
+     * @param[in] datagramLength the size of the datagram.
+     * @return true if the frame is complete.
+     */
+    bool ProcessDatagram(const char8 * const datagram,
+                         const uint32 datagramLength);
+
+    /**
+     * @brief Releases the buffers.
+     */
+    void FreeBuffers();
+
+    /**
+     * The socket.
+     */
+    BasicUDPSocket socket;
+
+    /**
+     * The maximum size of each datagram.
+     */
+    uint32 datagramSize;
+
+    /**
+     * The maximum size of a frame.
+     */
+    uint32 frameCapacity;
+
+    /**
+     * The datagrams read by the last ReadBatch.
+     */
+    char8 *datagrams;
+
+    /**
+     * The pointer to each datagram.
+     */
+    char8 **buffers;
+
+    /**
+     * The size of each datagram.
+     */
+    uint32 *sizes;
+
+    /**
+     * Number of datagrams read by the last ReadBatch.
+     */
+    uint32 numberOfDatagrams;
+
+    /**
+     * Index of the next datagram to process.
+     */
+    uint32 nextDatagram;
+
+    /**
+     * The frame being assembled.
+     */
+    char8 *assembly;
+
+    /**
+     * One flag for each fragment of the frame being assembled.
+     */
+    bool *fragmentReceived;
+
+    /**
+     * The header of the frame being assembled.
+     */
+    MulticastFrameHeader current;
+
+    /**
+     * Number of fragments of the frame being assembled received so far.
+     */
+    uint32 fragmentsReceived;
+
+    /**
+     * True while a frame is being assembled.
+     */
+    bool assembling;
+
+    /**
+     * The sequence number expected for the next new frame.
+     */
+    uint32 expectedSequence;
+
+    /**
+     * True after the first frame, whose sequence number is not counted as a gap.
+     */
+    bool synchronised;
+
+    /**
+     * Number of frames delivered.
+     */
+    uint64 receivedFrames;
+
+    /**
+     * Number of frames not delivered.
+     */
+    uint64 lostFrames;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_CORE_FILESYSTEM_L3STREAMS_MULTICASTSUBSCRIBER_H_ */
@@ -0,0 +1,295 @@
+/**
+ * @file UDPShardedReceiver.cpp
+ * @brief Source file for class UDPShardedReceiver
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class UDPShardedReceiver (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "MemoryOperationsHelper.h"
+#include "Sleep.h"
+#include "UDPShardedReceiver.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The maximum time (in milliseconds) that a shard thread blocks on its socket before checking if it shall terminate.
+ */
+static const uint32 UDP_SHARDED_RECEIVER_POLL_TIMEOUT = 100u;
+
+/**
+ * @brief The shard thread: reads the socket of the shard into its queue until asked to stop.
+ * @param[in] parameters the UDPShardedReceiverShard.
+ */
+static void UDPShardedReceiverThread(const void * const parameters) {
+    /*lint -e{925} the parameters are the shard given to Threads::BeginThread*/
+    UDPShardedReceiverShard * const shard = static_cast<UDPShardedReceiverShard *>(const_cast<void *>(parameters));
+    const uint32 mask = shard->queueDepth - 1u;
+    const TimeoutType timeout(UDP_SHARDED_RECEIVER_POLL_TIMEOUT);
+    while (Atomic::Load(&shard->stop, Atomic::MemoryOrderAcquire) == 0) {
+        //Only this thread writes the writeIndex
+        uint32 write = static_cast<uint32>(shard->writeIndex);
+        uint32 read = static_cast<uint32>(Atomic::Load(&shard->readIndex, Atomic::MemoryOrderAcquire));
+        uint32 position = (write & mask);
+        //The free slots up to the end of the ring, so that ReadBatch writes them directly
+        uint32 numberOfSlots = shard->queueDepth - (write - read);
+        if (numberOfSlots > (shard->queueDepth - position)) {
+            numberOfSlots = (shard->queueDepth - position);
+        }
+        if (numberOfSlots > UDP_SHARDED_RECEIVER_BATCH) {
+            numberOfSlots = UDP_SHARDED_RECEIVER_BATCH;
+        }
+        if (numberOfSlots > 0u) {
+            for (uint32 k = 0u; k < numberOfSlots; k++) {
+                shard->sizes[position + k] = shard->datagramSize;
+            }
+            if (shard->socket.ReadBatch(&shard->slotPointers[position], &shard->sizes[position], numberOfSlots, &shard->sources[position], timeout)) {
+                Atomic::StoreRelease(&shard->writeIndex, static_cast<int32>(write + numberOfSlots));
+            }
+        }
+        else {
+            //The queue is full: the datagram is read into the spare slot and discarded
+            uint32 discarded = 1u;
+            shard->sizes[shard->queueDepth] = shard->datagramSize;
+            if (shard->socket.ReadBatch(&shard->slotPointers[shard->queueDepth], &shard->sizes[shard->queueDepth], discarded, NULL_PTR(InternetHost *), timeout)) {
+                Atomic::StoreRelease(&shard->dropped, shard->dropped + static_cast<int64>(discarded));
+            }
+        }
+    }
+    Atomic::StoreRelease(&shard->running, 0);
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+UDPShardedReceiver::UDPShardedReceiver() {
+    shards = NULL_PTR(UDPShardedReceiverShard **);
+    numberOfShards = 0u;
+    nextShard = 0u;
+}
+
+UDPShardedReceiver::~UDPShardedReceiver() {
+    (void) UDPShardedReceiver::Close();
+}
+
+bool UDPShardedReceiver::Open(const uint16 port,
+                              const uint32 numberOfShardsIn,
+                              const uint32 datagramSizeIn,
+                              const uint32 queueDepthIn,
+                              const ProcessorType &shardCPUs,
+                              const bool steerBySource,
+                              const uint32 receiveBufferSize) {
+    bool ok = !IsOpen();
+    if (ok) {
+        ok = ((numberOfShardsIn > 0u) && (datagramSizeIn > 0u) && (queueDepthIn > 0u));
+        if (ok) {
+            ok = ((queueDepthIn & (queueDepthIn - 1u)) == 0u);
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "UDPShardedReceiver: The number of shards and the datagram size shall be > 0 and the queue depth a power of 2");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::IllegalOperation, "UDPShardedReceiver: The shards are already open");
+    }
+    if (ok) {
+        numberOfShards = numberOfShardsIn;
+        nextShard = 0u;
+        shards = new UDPShardedReceiverShard*[numberOfShards];
+        for (uint32 s = 0u; s < numberOfShards; s++) {
+            UDPShardedReceiverShard *shard = new UDPShardedReceiverShard;
+            shard->queueDepth = queueDepthIn;
+            shard->datagramSize = datagramSizeIn;
+            //One spare slot, where the datagrams discarded when the queue is full are read
+            shard->slots = new char8[(queueDepthIn + 1u) * datagramSizeIn];
+            shard->slotPointers = new char8*[queueDepthIn + 1u];
+            shard->sizes = new uint32[queueDepthIn + 1u];
+            shard->sources = new InternetHost[queueDepthIn];
+            for (uint32 k = 0u; k <= queueDepthIn; k++) {
+                shard->slotPointers[k] = &shard->slots[k * datagramSizeIn];
+                shard->sizes[k] = 0u;
+            }
+            shard->writeIndex = 0;
+            shard->dropped = 0;
+            shard->readIndex = 0;
+            shard->stop = 0;
+            shard->running = 0;
+            shard->threadId = InvalidThreadIdentifier;
+            shards[s] = shard;
+        }
+    }
+    //All the sockets shall be bound before the steering program is attached to the group
+    for (uint32 s = 0u; (s < numberOfShards) && (ok); s++) {
+        BasicUDPSocket &socket = shards[s]->socket;
+        ok = socket.Open();
+        if (ok) {
+            ok = socket.SetReusePort(true);
+        }
+        if ((ok) && (receiveBufferSize > 0u)) {
+            ok = socket.SetReceiveBufferSize(receiveBufferSize);
+        }
+        if (ok) {
+            ok = socket.Listen(port);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::OSError, "UDPShardedReceiver: Could not bind shard %u to port %u", s, static_cast<uint32>(port));
+            }
+        }
+    }
+    if ((ok) && (steerBySource)) {
+        ok = shards[0u]->socket.SetReusePortSteering(numberOfShards);
+    }
+    uint32 numberOfCPUs = shardCPUs.GetCPUsNumber();
+    uint32 cpu = 0u;
+    for (uint32 s = 0u; (s < numberOfShards) && (ok); s++) {
+        //The next CPU of shardCPUs (CPUEnabled numbers the CPUs from 1), round-robin
+        ProcessorType runOnCPUs(UndefinedCPUs);
+        bool found = false;
+        for (uint32 n = 0u; (n < numberOfCPUs) && (!found); n++) {
+            uint32 candidate = ((cpu + n) % numberOfCPUs);
+            found = shardCPUs.CPUEnabled(candidate + 1u);
+            if (found) {
+                runOnCPUs.AddCPU(candidate + 1u);
+                cpu = candidate + 1u;
+            }
+        }
+        StreamString threadName;
+        (void) threadName.Printf("UDPShard%u", s);
+        shards[s]->running = 1;
+        shards[s]->threadId = Threads::BeginThread(&UDPShardedReceiverThread, shards[s], THREADS_DEFAULT_STACKSIZE, threadName.Buffer(),
+                                                   ExceptionHandler::NotHandled, runOnCPUs);
+        ok = (shards[s]->threadId != InvalidThreadIdentifier);
+        if (!ok) {
+            shards[s]->running = 0;
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "UDPShardedReceiver: Could not start the thread of shard %u", s);
+        }
+    }
+    if ((!ok) && (shards != NULL_PTR(UDPShardedReceiverShard **))) {
+        (void) Close();
+    }
+    return ok;
+}
+
+void UDPShardedReceiver::FreeShards() {
+    if (shards != NULL_PTR(UDPShardedReceiverShard **)) {
+        for (uint32 s = 0u; s < numberOfShards; s++) {
+            delete[] shards[s]->slots;
+            delete[] shards[s]->slotPointers;
+            delete[] shards[s]->sizes;
+            delete[] shards[s]->sources;
+            delete shards[s];
+        }
+        delete[] shards;
+        shards = NULL_PTR(UDPShardedReceiverShard **);
+    }
+    numberOfShards = 0u;
+}
+
+bool UDPShardedReceiver::Close() {
+    bool ok = true;
+    for (uint32 s = 0u; s < numberOfShards; s++) {
+        Atomic::StoreRelease(&shards[s]->stop, 1);
+    }
+    for (uint32 s = 0u; s < numberOfShards; s++) {
+        //The thread notices the stop at most after UDP_SHARDED_RECEIVER_POLL_TIMEOUT
+        uint32 waited = 0u;
+        while ((Atomic::Load(&shards[s]->running, Atomic::MemoryOrderAcquire) != 0) && (waited < (10u * UDP_SHARDED_RECEIVER_POLL_TIMEOUT))) {
+            Sleep::MSec(1u);
+            waited++;
+        }
+        if (Atomic::Load(&shards[s]->running, Atomic::MemoryOrderAcquire) != 0) {
+            ok = Threads::Kill(shards[s]->threadId);
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "UDPShardedReceiver: Killed the thread of shard %u", s);
+        }
+        if (shards[s]->socket.IsValid()) {
+            ok = (shards[s]->socket.Close()) && (ok);
+        }
+    }
+    FreeShards();
+    return ok;
+}
+
+bool UDPShardedReceiver::IsOpen() const {
+    return (numberOfShards > 0u);
+}
+
+bool UDPShardedReceiver::Read(char8 * const output,
+                              uint32 &size,
+                              uint32 &shard,
+                              InternetHost * const source) {
+    bool found = false;
+    bool ok = false;
+    for (uint32 n = 0u; (n < numberOfShards) && (!found); n++) {
+        uint32 s = ((nextShard + n) % numberOfShards);
+        UDPShardedReceiverShard * const candidate = shards[s];
+        //Only this thread writes the readIndex
+        uint32 read = static_cast<uint32>(candidate->readIndex);
+        uint32 write = static_cast<uint32>(Atomic::Load(&candidate->writeIndex, Atomic::MemoryOrderAcquire));
+        found = (write != read);
+        if (found) {
+            uint32 position = (read & (candidate->queueDepth - 1u));
+            uint32 datagramLength = candidate->sizes[position];
+            ok = (datagramLength <= size);
+            if (ok) {
+                ok = MemoryOperationsHelper::Copy(output, candidate->slotPointers[position], datagramLength);
+                size = datagramLength;
+                shard = s;
+                if (source != NULL_PTR(InternetHost *)) {
+                    *source = candidate->sources[position];
+                }
+            }
+            //The slot is released to the shard thread only after it was copied
+            Atomic::StoreRelease(&candidate->readIndex, static_cast<int32>(read + 1u));
+            nextShard = ((s + 1u) % numberOfShards);
+        }
+    }
+    return ok;
+}
+
+uint32 UDPShardedReceiver::GetNumberOfShards() const {
+    return numberOfShards;
+}
+
+uint64 UDPShardedReceiver::GetNumberOfDropped() const {
+    uint64 dropped = 0u;
+    for (uint32 s = 0u; s < numberOfShards; s++) {
+        dropped += static_cast<uint64>(Atomic::Load(&shards[s]->dropped, Atomic::MemoryOrderAcquire));
+    }
+    return dropped;
+}
+
+}
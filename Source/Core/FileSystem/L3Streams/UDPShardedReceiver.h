@@ -0,0 +1,243 @@
+/**
+ * @file UDPShardedReceiver.h
+ * @brief Header file for class UDPShardedReceiver
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class UDPShardedReceiver
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef SOURCE_CORE_FILESYSTEM_L3STREAMS_UDPSHARDEDRECEIVER_H_
+#define SOURCE_CORE_FILESYSTEM_L3STREAMS_UDPSHARDEDRECEIVER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "BasicUDPSocket.h"
+#include "ProcessorType.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Maximum number of datagrams read by a shard with a single ReadBatch.
+ */
+static const uint32 UDP_SHARDED_RECEIVER_BATCH = 32u;
+
+/**
+ * @brief A shard of a UDPShardedReceiver: a socket, the thread which reads it and the queue where the thread writes the datagrams.
+ * @details The queue is a single producer (the shard thread), single consumer (the UDPShardedReceiver::Read caller) ring, whose
+ * free running indices are published with release semantics and read with acquire semantics.
+ */
+struct UDPShardedReceiverShard {
+    /**
+     * The socket bound (with SO_REUSEPORT) to the shared port.
+     */
+    BasicUDPSocket socket;
+
+    /**
+     * The queueDepth slots of datagramSize bytes.
+     */
+    char8 *slots;
+
+    /**
+     * The address of each slot (for BasicUDPSocket::ReadBatch).
+     */
+    char8 **slotPointers;
+
+    /**
+     * The size of the datagram in each slot.
+     */
+    uint32 *sizes;
+
+    /**
+     * The source of the datagram in each slot.
+     */
+    InternetHost *sources;
+
+    /**
+     * The number of slots (a power of 2).
+     */
+    uint32 queueDepth;
+
+    /**
+     * The size of each slot.
+     */
+    uint32 datagramSize;
+
+    /**
+     * The number of datagrams written by the shard thread (only written by the shard thread).
+     */
+    volatile int32 writeIndex;
+
+    /**
+     * The number of datagrams discarded because the queue was full (only written by the shard thread).
+     */
+    volatile int64 dropped;
+
+    /**
+     * Keeps the consumer index in a different cache line.
+     */
+    char8 padding[64];
+
+    /**
+     * The number of datagrams read by UDPShardedReceiver::Read (only written by the consumer).
+     */
+    volatile int32 readIndex;
+
+    /**
+     * Set to ask the shard thread to terminate.
+     */
+    volatile int32 stop;
+
+    /**
+     * Cleared by the shard thread when it terminates.
+     */
+    volatile int32 running;
+
+    /**
+     * The shard thread.
+     */
+    ThreadIdentifier threadId;
+};
+
+/**
+ * @brief Receives the datagrams sent to a port with several sockets and threads, so that the reception scales with the number of cores.
+ * @details Each shard has its own socket, bound to the same port with SO_REUSEPORT (see BasicUDPSocket::SetReusePort), and its own thread,
+ * which can be pinned to its own CPU, reading the socket in batches (see BasicUDPSocket::ReadBatch) into the queue of the shard.
+ * The operating system spreads the datagrams between the sockets with a hash of the source and destination, or, if steerBySource is set,
+ * with the source IPv4 address modulo the number of shards (see BasicUDPSocket::SetReusePortSteering). Either way all the datagrams of a
+ * given source are received by the same shard and Read returns them in the order in which they were received.
+ *
+ * Read does not block and visits the queues round-robin, so that a busy shard cannot starve the others. It shall be called by a single
+ * thread (e.g. the DataSource thread which forwards the datagrams to the real-time threads). The datagrams received while the queue of a
+ * shard is full are discarded (see GetNumberOfDropped).
+ */
+class DLL_API UDPShardedReceiver {
+
+public:
+    /**
+     * @brief Default constructor.
+     * @post
+     *   not IsOpen()
+     */
+    UDPShardedReceiver();
+
+    /**
+     * @brief Destructor. Closes the shards.
+     */
+    ~UDPShardedReceiver();
+
+    /**
+     * @brief Opens the sockets of the shards and starts their threads.
+     * @param[in] port the port where to receive.
+     * @param[in] numberOfShardsIn the number of shards.
+     * @param[in] datagramSizeIn the maximum size of a datagram. Larger datagrams are truncated.
+     * @param[in] queueDepthIn the number of datagrams that can be queued in each shard (a power of 2).
+     * @param[in] shardCPUs the CPUs of the shard threads, assigned in order (the first CPU to the first shard, ...) and reused
+     * round-robin if there are more shards than CPUs. If no CPU is set the threads are not pinned.
+     * @param[in] steerBySource if true the shard of each datagram is selected from its source address (see class description).
+     * @param[in] receiveBufferSize the size of the receive buffer of each socket (0 for the operating system default).
+     * @pre
+     *   not IsOpen()
+     * @return true if all the sockets were bound and all the threads started.
+     */
+    bool Open(const uint16 port,
+              const uint32 numberOfShardsIn,
+              const uint32 datagramSizeIn,
+              const uint32 queueDepthIn,
+              const ProcessorType &shardCPUs = UndefinedCPUs,
+              const bool steerBySource = false,
+              const uint32 receiveBufferSize = 0u);
+
+    /**
+     * @brief Stops the shard threads and closes the sockets.
+     * @return true if all the threads terminated.
+     */
+    bool Close();
+
+    /**
+     * @brief Checks if the shards are open.
+     * @return true if the shards are open.
+     */
+    bool IsOpen() const;
+
+    /**
+     * @brief Gets the next datagram queued by any of the shards, without blocking.
+     * @param[out] output where to write the datagram.
+     * @param[in,out] size the size of \a output. On output the size of the datagram.
+     * @param[out] shard the shard which received the datagram.
+     * @param[out] source if not NULL the source of the datagram.
+     * @return true if a datagram was read (false if no shard has queued datagrams, or if the datagram did not fit in \a output,
+     * in which case it is discarded).
+     */
+    bool Read(char8 * const output,
+              uint32 &size,
+              uint32 &shard,
+              InternetHost * const source = NULL_PTR(InternetHost *));
+
+    /**
+     * @brief Gets the number of shards.
+     * @return the number of shards.
+     */
+    uint32 GetNumberOfShards() const;
+
+    /**
+     * @brief Gets the number of datagrams discarded by all the shards because their queue was full.
+     * @return the number of discarded datagrams.
+     */
+    uint64 GetNumberOfDropped() const;
+
+private:
+
+    /**
+     * @brief Releases the shards.
+     */
+    void FreeShards();
+
+    /**
+     * The shards.
+     */
+    UDPShardedReceiverShard **shards;
+
+    /**
+     * The number of shards.
+     */
+    uint32 numberOfShards;
+
+    /**
+     * The shard where the next Read starts looking for datagrams.
+     */
+    uint32 nextShard;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_CORE_FILESYSTEM_L3STREAMS_UDPSHARDEDRECEIVER_H_ */
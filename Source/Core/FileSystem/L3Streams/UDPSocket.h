@@ -44,6 +44,9 @@ namespace MARTe {
 
 /**
  * @brief Buffered implementation of the BasicUDPSocket.
+ * @details The datagram batch methods (BasicUDPSocket::ReadBatch and BasicUDPSocket::WriteBatch) and the socket
+ * options (BasicUDPSocket::SetReceiveBufferSize and BasicUDPSocket::SetBusyPoll) are also available on this class.
+ * The batch methods bypass the stream buffers and thus shall not be mixed with buffered reads/writes that are still pending.
  */
 class UDPSocket: public BufferedStreamGenerator<DoubleBufferedStream, BasicUDPSocket>{
 
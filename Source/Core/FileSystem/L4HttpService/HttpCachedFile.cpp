@@ -0,0 +1,160 @@
+/**
+ * @file HttpCachedFile.cpp
+ * @brief Source file for class HttpCachedFile
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HttpCachedFile (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BasicFile.h"
+#include "HttpCachedFile.h"
+#include "HttpDefinition.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+HttpCachedFile::HttpCachedFile() :
+        Object() {
+    size = 0u;
+    lastWriteTime = 0u;
+    content = NULL_PTR(char8 *);
+    hasContent = false;
+    uint32 i;
+    for (i = 0u; i < HTTP_CACHED_FILE_ENCODINGS; i++) {
+        isEncoded[i] = false;
+    }
+    encodeSem.Create();
+}
+
+HttpCachedFile::~HttpCachedFile() {
+    if (content != NULL_PTR(char8 *)) {
+        delete[] content;
+    }
+}
+
+bool HttpCachedFile::Load(const char8 * const pathIn, const uint64 sizeIn, const uint64 lastWriteTimeIn, const bool loadContent) {
+    path = pathIn;
+    size = sizeIn;
+    lastWriteTime = lastWriteTimeIn;
+    bool ok = eTag.Printf("\"%x-%x\"", size, lastWriteTime);
+    if (ok) {
+        ok = HttpDefinition::PrintHttpDate(lastModified, lastWriteTime);
+    }
+    if ((ok) && (loadContent)) {
+        BasicFile f;
+        ok = f.Open(path.Buffer(), BasicFile::ACCESS_MODE_R);
+        if ((ok) && (size > 0u)) {
+            content = new char8[size];
+            uint64 readSize = 0u;
+            while ((ok) && (readSize < size)) {
+                uint32 toRead = static_cast<uint32>(size - readSize);
+                ok = f.Read(&content[readSize], toRead);
+                if (ok) {
+                    //The file was truncated after the size was read
+                    ok = (toRead > 0u);
+                }
+                readSize += toRead;
+            }
+        }
+        if (f.IsOpen()) {
+            (void) f.Close();
+        }
+        hasContent = ok;
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not read the content of %s", path.Buffer());
+        }
+    }
+    return ok;
+}
+
+bool HttpCachedFile::IsUpToDate(const uint64 sizeIn, const uint64 lastWriteTimeIn) const {
+    return ((size == sizeIn) && (lastWriteTime == lastWriteTimeIn));
+}
+
+const char8 *HttpCachedFile::GetPath() {
+    return path.Buffer();
+}
+
+uint64 HttpCachedFile::GetSize() const {
+    return size;
+}
+
+const char8 *HttpCachedFile::GetETag() {
+    return eTag.Buffer();
+}
+
+const char8 *HttpCachedFile::GetLastModified() {
+    return lastModified.Buffer();
+}
+
+bool HttpCachedFile::HasContent() const {
+    return hasContent;
+}
+
+const char8 *HttpCachedFile::GetContent() const {
+    return content;
+}
+
+const char8 *HttpCachedFile::GetEncodedContent(const uint32 encoding, const uint32 level, uint32 &encodedSize) {
+    const char8 *encoded = NULL_PTR(const char8 *);
+    encodedSize = 0u;
+    bool ok = ((hasContent) && (encoding > HTTP_CONTENT_ENCODING_IDENTITY) && (encoding <= HTTP_CACHED_FILE_ENCODINGS));
+    if (ok) {
+        ok = (encodeSem.FastLock() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        uint32 idx = encoding - 1u;
+        if (!isEncoded[idx]) {
+            //Only the files smaller than the CacheSize have their content loaded
+            if (!HttpContentEncoder::Encode(encoding, level, content, static_cast<uint32>(size), encodedContent[idx])) {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not compress the content of %s", path.Buffer());
+                encodedContent[idx] = "";
+            }
+            else if (encodedContent[idx].Size() >= size) {
+                encodedContent[idx] = "";
+            }
+            else {
+                //Already compressed
+            }
+            isEncoded[idx] = true;
+        }
+        if (encodedContent[idx].Size() > 0u) {
+            encoded = encodedContent[idx].Buffer();
+            encodedSize = static_cast<uint32>(encodedContent[idx].Size());
+        }
+        encodeSem.FastUnLock();
+    }
+    return encoded;
+}
+
+CLASS_REGISTER(HttpCachedFile, "1.0")
+}
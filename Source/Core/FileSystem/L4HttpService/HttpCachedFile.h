@@ -0,0 +1,204 @@
+/**
+ * @file HttpCachedFile.h
+ * @brief Header file for class HttpCachedFile
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HttpCachedFile
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef L4HTTPSERVICE_HTTPCACHEDFILE_H_
+#define L4HTTPSERVICE_HTTPCACHEDFILE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "FastPollingMutexSem.h"
+#include "HttpContentEncoder.h"
+#include "Object.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * The number of compressed variants of the content which can be kept by an HttpCachedFile (gzip and deflate).
+ */
+static const uint32 HTTP_CACHED_FILE_ENCODINGS = 2u;
+
+/**
+ * @brief The properties (and optionally the content) of a file served by the HttpDirectoryResource.
+ * @details Holds the HTTP validators of the file (ETag and Last-Modified) and, for small files, a copy of its content.
+ * Once loaded an HttpCachedFile is never modified, so that it can be safely shared by the threads serving the file, with
+ * the exception of the compressed variants of the content, which are computed (under a semaphore) the first time that they
+ * are requested (see GetEncodedContent) and then kept as long as the file.
+ * When the file changes a new HttpCachedFile shall be loaded.
+ */
+class HttpCachedFile: public Object {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   HasContent() == false
+     */
+    HttpCachedFile();
+
+    /**
+     * @brief Destructor. Frees the content and its compressed variants.
+     */
+    virtual ~HttpCachedFile();
+
+    /**
+     * @brief Computes the validators of the file and, if \a loadContent, reads its content.
+     * @param[in] pathIn the path of the file.
+     * @param[in] sizeIn the size of the file.
+     * @param[in] lastWriteTimeIn the last write time of the file in seconds from the epoch.
+     * @param[in] loadContent if true the content of the file is read into memory.
+     * @return true if the validators were computed and, if requested, the content was completely read.
+     * @pre
+     *   Load was not called before.
+     */
+    bool Load(const char8 * const pathIn,
+              const uint64 sizeIn,
+              const uint64 lastWriteTimeIn,
+              const bool loadContent);
+
+    /**
+     * @brief Checks if the file was modified after being loaded.
+     * @param[in] sizeIn the current size of the file.
+     * @param[in] lastWriteTimeIn the current last write time of the file in seconds from the epoch.
+     * @return true if \a sizeIn and \a lastWriteTimeIn are the ones of the loaded file.
+     */
+    bool IsUpToDate(const uint64 sizeIn,
+                    const uint64 lastWriteTimeIn) const;
+
+    /**
+     * @brief Gets the path of the file.
+     * @return the path of the file.
+     */
+    const char8 *GetPath();
+
+    /**
+     * @brief Gets the size of the file.
+     * @return the size of the file.
+     */
+    uint64 GetSize() const;
+
+    /**
+     * @brief Gets the entity tag of the file (built from its size and last write time).
+     * @return the entity tag, including the quotes.
+     */
+    const char8 *GetETag();
+
+    /**
+     * @brief Gets the last write time of the file as an HTTP date.
+     * @return the last write time as an HTTP date.
+     */
+    const char8 *GetLastModified();
+
+    /**
+     * @brief Checks if the content of the file was loaded.
+     * @return true if the content of the file is available in GetContent.
+     */
+    bool HasContent() const;
+
+    /**
+     * @brief Gets the content of the file.
+     * @return the GetSize() bytes of the file or NULL if !HasContent().
+     */
+    const char8 *GetContent() const;
+
+    /**
+     * @brief Gets the content of the file compressed with a given content coding.
+     * @details The content is compressed the first time that an encoding is requested and the result is kept for the next calls
+     * (also if it is not worth sending).
+     * @param[in] encoding HTTP_CONTENT_ENCODING_GZIP or HTTP_CONTENT_ENCODING_DEFLATE.
+     * @param[in] level the compression level (only used by the first call with a given \a encoding).
+     * @param[out] encodedSize the number of bytes of the compressed content.
+     * @return the compressed content or NULL if !HasContent(), if the \a encoding is not valid or if the compressed content
+     * is not smaller than the content.
+     */
+    const char8 *GetEncodedContent(const uint32 encoding,
+                                   const uint32 level,
+                                   uint32 &encodedSize);
+
+private:
+
+    /**
+     * The path of the file.
+     */
+    StreamString path;
+
+    /**
+     * The size of the file.
+     */
+    uint64 size;
+
+    /**
+     * The last write time in seconds from the epoch.
+     */
+    uint64 lastWriteTime;
+
+    /**
+     * The entity tag.
+     */
+    StreamString eTag;
+
+    /**
+     * The last write time as an HTTP date.
+     */
+    StreamString lastModified;
+
+    /**
+     * The content of the file (if loaded).
+     */
+    char8 *content;
+
+    /**
+     * True if the content was loaded.
+     */
+    bool hasContent;
+
+    /**
+     * The compressed variants of the content, indexed by encoding - 1.
+     */
+    StreamString encodedContent[HTTP_CACHED_FILE_ENCODINGS];
+
+    /**
+     * True if the variant was computed (encodedContent is empty if it was not worth keeping).
+     */
+    bool isEncoded[HTTP_CACHED_FILE_ENCODINGS];
+
+    /**
+     * Protects the computation of the compressed variants.
+     */
+    FastPollingMutexSem encodeSem;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* L4HTTPSERVICE_HTTPCACHEDFILE_H_ */
@@ -32,6 +32,7 @@
 #include "AdvancedErrorManagement.h"
 #include "ErrorManagement.h"
 #include "HttpChunkedStream.h"
+#include "MemoryOperationsHelper.h"
 #include "StreamString.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -47,6 +48,8 @@ HttpChunkedStream::HttpChunkedStream() :
         TCPSocket() {
     //use always buffer mode
     chunkMode = false;
+    contentEncoder = NULL_PTR(HttpContentEncoder *);
+    prefetchedPosition = 0u;
     calibReadParam = 0u;
     calibWriteParam = 0u;
 
@@ -68,52 +71,222 @@ HttpChunkedStream::~HttpChunkedStream() {
 }
 
 bool HttpChunkedStream::Flush() {
+    bool ret;
+    if (chunkMode) {
+        ret = FlushChunk(false);
+    }
+    else {
+        //plain socket
+        ret = DoubleBufferedStream::Flush();
+    }
+    return ret;
+}
 
-    bool ret = true;
-    uint32 size = writeBuffer.UsedSize();
-
+bool HttpChunkedStream::FinalChunk() {
+    bool ret;
     if (chunkMode) {
-        //get the size
-        if (size > 0u) {
-            StreamString totStr;
-            ret = totStr.Printf("%x\r\n", size);
+        ret = FlushChunk(true);
+    }
+    else {
+        ret = DoubleBufferedStream::Flush();
+        if (ret) {
+            const char8 *finalChunk = "0\r\n\r\n";
+            uint32 totalSize = StringHelper::Length(finalChunk);
+            ret = OSWrite(finalChunk, totalSize);
+        }
+    }
+    return ret;
+}
 
-            uint32 totalSize = static_cast<uint32>(totStr.Size());
-            if (ret) {
-                ret = OSWrite(totStr.Buffer(), totalSize);
-            }
+bool HttpChunkedStream::AdaptChunkSize() {
+    uint32 sendBufferSize = 0u;
+    bool ret = GetSendBufferSize(sendBufferSize);
+    if (ret) {
+        uint32 chunkSize = (sendBufferSize / 2u);
+        if (chunkSize < HTTP_CHUNKED_STREAM_MIN_CHUNK_SIZE) {
+            chunkSize = HTTP_CHUNKED_STREAM_MIN_CHUNK_SIZE;
+        }
+        if (chunkSize > HTTP_CHUNKED_STREAM_MAX_CHUNK_SIZE) {
+            chunkSize = HTTP_CHUNKED_STREAM_MAX_CHUNK_SIZE;
         }
+        ret = SetBufferSize(GetReadBufferSize(), chunkSize);
+    }
+    return ret;
+}
 
+bool HttpChunkedStream::FlushChunk(const bool last) {
+    bool ret = true;
+    uint32 size = writeBuffer.UsedSize();
+    if (contentEncoder != NULL_PTR(HttpContentEncoder *)) {
+        //the compressed bytes are sent once the encoder completes a block
+        if (size > 0u) {
+            ret = contentEncoder->Compress(writeBuffer.Buffer(), size, encoded);
+            writeBuffer.Empty();
+        }
+        if ((ret) && (last)) {
+            ret = contentEncoder->Finish(encoded);
+            contentEncoder = NULL_PTR(HttpContentEncoder *);
+        }
+        if ((ret) && ((encoded.Size() > 0u) || (last))) {
+            ret = WriteChunk(encoded.Buffer(), static_cast<uint32>(encoded.Size()), last);
+        }
+        //keep the memory for the next chunks
+        encoded = "";
+    }
+    else if ((size > 0u) || (last)) {
+        //sent directly from the write buffer
+        ret = WriteChunk(writeBuffer.Buffer(), size, last);
+        writeBuffer.Empty();
+    }
+    else {
+        //nothing to send
     }
+    return ret;
+}
 
+bool HttpChunkedStream::StartContentEncoding(HttpContentEncoder &encoderIn,
+                                             const uint32 encoding,
+                                             const uint32 level) {
+    bool ret = chunkMode;
     if (ret) {
-        ret = DoubleBufferedStream::Flush();
+        ret = encoderIn.Start(encoding, level);
     }
     if (ret) {
+        contentEncoder = &encoderIn;
+    }
+    return ret;
+}
 
-        if (chunkMode && (size > 0u)) {
-            uint32 totalSize = 2u;
-            ret = OSWrite("\r\n", totalSize);
+void HttpChunkedStream::SetChunkMode(const bool chunkModeIn) {
+    chunkMode = chunkModeIn;
+    if ((!chunkMode) && (contentEncoder != NULL_PTR(HttpContentEncoder *))) {
+        contentEncoder->Reset();
+        contentEncoder = NULL_PTR(HttpContentEncoder *);
+        encoded = "";
+    }
+}
+
+bool HttpChunkedStream::WriteChunk(const char8 * const data,
+                                   const uint32 size,
+                                   const bool last) {
+    //the chunk size in hexadecimal followed by \r\n, composed without heap allocations
+    char8 sizeLine[12];
+    uint32 nibbles = 1u;
+    while ((nibbles < 8u) && ((size >> (4u * nibbles)) > 0u)) {
+        nibbles++;
+    }
+    const char8 * const hexDigits = "0123456789abcdef";
+    uint32 i;
+    for (i = 0u; i < nibbles; i++) {
+        sizeLine[i] = hexDigits[(size >> (4u * ((nibbles - i) - 1u))) & 0xFu];
+    }
+    sizeLine[nibbles] = '\r';
+    sizeLine[nibbles + 1u] = '\n';
+    //the trailer of the chunk, followed by the final chunk if requested
+    const char8 * const trailer = "\r\n0\r\n\r\n";
+    const char8 *buffers[3];
+    uint32 sizes[3];
+    uint32 numberOfBuffers = 0u;
+    if (size > 0u) {
+        buffers[0] = &sizeLine[0];
+        sizes[0] = nibbles + 2u;
+        buffers[1] = data;
+        sizes[1] = size;
+        buffers[2] = trailer;
+        sizes[2] = 2u;
+        if (last) {
+            sizes[2] = 7u;
         }
+        numberOfBuffers = 3u;
     }
+    else if (last) {
+        buffers[0] = &trailer[2];
+        sizes[0] = 5u;
+        numberOfBuffers = 1u;
+    }
+    else {
+        //an empty chunk would end the body
+    }
+    uint32 writtenSize = 0u;
+    return WriteVector(&buffers[0], &sizes[0], numberOfBuffers, writtenSize, GetTimeout());
+}
 
-    return ret;
+bool HttpChunkedStream::IsChunkMode() const {
+    return chunkMode;
 }
 
-bool HttpChunkedStream::FinalChunk() {
-    const char8 *finalChunk = "0\r\n\r\n";
-    uint32 totalSize = StringHelper::Length(finalChunk);
+uint32 HttpChunkedStream::Prefetch(const uint32 maxSize) {
+    uint32 received = 0u;
+    char8 chunk[512];
+    bool more = true;
+    while ((more) && (GetPrefetchedSize() < maxSize)) {
+        uint32 size = (maxSize - GetPrefetchedSize());
+        if (size > static_cast<uint32>(sizeof(chunk))) {
+            size = static_cast<uint32>(sizeof(chunk));
+        }
+        uint32 requested = size;
+        //Peek does not block nor complain if there is nothing to read; the peeked bytes can then be read without blocking
+        more = BasicTCPSocket::Peek(&chunk[0], size);
+        if (more) {
+            more = BasicTCPSocket::Read(&chunk[0], size);
+        }
+        if (more) {
+            if (prefetchedPosition == prefetched.Size()) {
+                //empty the buffer but keep its memory for the next requests
+                prefetchedPosition = 0u;
+                prefetched = "";
+            }
+            more = prefetched.Seek(prefetched.Size());
+            if (more) {
+                uint32 writeSize = size;
+                more = prefetched.Write(&chunk[0], writeSize);
+            }
+            received += size;
+            more = (more) && (size == requested);
+        }
+    }
+    return received;
+}
 
-    return OSWrite(finalChunk, totalSize);
+bool HttpChunkedStream::IsHeaderPrefetched() {
+    bool found = (GetPrefetchedSize() > 0u);
+    if (found) {
+        const char8 * const pending = &(prefetched.Buffer()[prefetchedPosition]);
+        found = (StringHelper::SearchString(pending, "\n\r\n") != NULL_PTR(const char8 *));
+        if (!found) {
+            found = (StringHelper::SearchString(pending, "\n\n") != NULL_PTR(const char8 *));
+        }
+    }
+    return found;
+}
 
+uint32 HttpChunkedStream::GetPrefetchedSize() {
+    return (static_cast<uint32>(prefetched.Size()) - prefetchedPosition);
 }
 
-void HttpChunkedStream::SetChunkMode(const bool chunkModeIn) {
-    chunkMode = chunkModeIn;
+bool HttpChunkedStream::HasBufferedInput() {
+    return ((GetPrefetchedSize() > 0u) || (readBuffer.UsedAmountLeft() > 0u));
 }
 
-bool HttpChunkedStream::IsChunkMode() const {
-    return chunkMode;
+bool HttpChunkedStream::OSRead(char8 * const data,
+                               uint32 &size) {
+    bool ret;
+    uint32 available = GetPrefetchedSize();
+    if (available > 0u) {
+        if (size > available) {
+            size = available;
+        }
+        ret = MemoryOperationsHelper::Copy(data, &(prefetched.Buffer()[prefetchedPosition]), size);
+        prefetchedPosition += size;
+        if (prefetchedPosition == prefetched.Size()) {
+            prefetchedPosition = 0u;
+            prefetched = "";
+        }
+    }
+    else {
+        ret = TCPSocket::OSRead(data, size);
+    }
+    return ret;
 }
 
 }
@@ -31,6 +31,8 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "HttpContentEncoder.h"
+#include "StreamString.h"
 #include "TCPSocket.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -38,6 +40,12 @@
 
 namespace MARTe{
 
+/**
+ * The bounds of the chunk size set by HttpChunkedStream::AdaptChunkSize.
+ */
+static const uint32 HTTP_CHUNKED_STREAM_MIN_CHUNK_SIZE = 4096u;
+static const uint32 HTTP_CHUNKED_STREAM_MAX_CHUNK_SIZE = 65536u;
+
 /**
  * @brief Implementation of the chunked body send for the HTTP protocol.
  * @see HttpService.
@@ -52,6 +60,13 @@ namespace MARTe{
  *   ld\n
  *   0\n
  *   \n
+ * In chunk mode the body can be compressed (see StartContentEncoding): the chunks then carry the compressed bytes,
+ * which are sent as the encoder completes its blocks.
+ *
+ * Each chunk (size line, data and trailing \r\n) is sent with a single gathered write (see BasicTCPSocket::WriteVector),
+ * directly from the write buffer, and the final chunk is appended to the last data chunk, so that a body written with many
+ * small writes leaves in as few segments (and system calls) as its size allows. The maximum size of the chunks is the size of
+ * the write buffer, which can be adapted to the socket with AdaptChunkSize.
  */
 class HttpChunkedStream: public TCPSocket{
 
@@ -79,14 +94,41 @@ public:
     /**
      * @brief Sends a zero-size final chunk to tell the host that the HTTP
      * message is terminated.
+     * @details The data still in the write buffer (and, if the body is compressed, the end of the compressed stream)
+     * is sent first, with the final chunk in the same write.
      */
     bool FinalChunk();
 
+    /**
+     * @brief Sizes the chunks after the send buffer of the connected socket.
+     * @details The write buffer, i.e. the maximum size of the chunks, is set to half of the send buffer of the socket
+     * (see BasicTCPSocket::GetSendBufferSize), bounded between HTTP_CHUNKED_STREAM_MIN_CHUNK_SIZE and
+     * HTTP_CHUNKED_STREAM_MAX_CHUNK_SIZE, so that a chunk fills several TCP segments while the kernel can still queue the
+     * next one without blocking.
+     * @return true if the send buffer size is read and the write buffer resized.
+     * @pre
+     *   The socket is connected and nothing was written yet.
+     */
+    bool AdaptChunkSize();
+
+    /**
+     * @brief Compresses the body sent in chunk mode, until the FinalChunk.
+     * @details The data written is compressed by the Flush in the calling thread (i.e. the service thread which writes
+     * the reply). The Content-Encoding shall have been written in the header (see HttpProtocol::WriteContentEncoding).
+     * @param[in] encoderIn the encoder (see HttpProtocol::GetContentEncoder), which shall be valid until the FinalChunk.
+     * @param[in] encoding HTTP_CONTENT_ENCODING_GZIP or HTTP_CONTENT_ENCODING_DEFLATE.
+     * @param[in] level the compression level.
+     * @return true if the stream is in chunk mode and the encoder is started.
+     */
+    bool StartContentEncoding(HttpContentEncoder &encoderIn,
+                              const uint32 encoding,
+                              const uint32 level);
+
     /**
      * @brief Sets the chunk mode.
      * @details If this stream is in chunk mode, the Flush implements the chunk transfer
      * encoding protocol, otherwise it will flush the data on the socket as it is a normal
-     * TCPSocket object
+     * TCPSocket object. Leaving the chunk mode discards any compression started with StartContentEncoding
      * @param[in] chunkModeIn the chunk mode.
      */
     void SetChunkMode(const bool chunkModeIn);
@@ -97,12 +139,85 @@ public:
      */
     bool IsChunkMode() const;
 
+    /**
+     * @brief Moves the bytes that are already available on the socket into an internal buffer, without blocking.
+     * @details Allows to accumulate a request as its bytes arrive (e.g. in the HttpService reactor mode),
+     *  so that it is only parsed once it is complete. The buffered bytes are returned by the next reads
+     *  on this stream before any data is read from the socket.
+     * @param[in] maxSize the maximum number of bytes to keep buffered.
+     * @return the number of bytes received.
+     */
+    uint32 Prefetch(const uint32 maxSize);
+
+    /**
+     * @brief Checks if the prefetched bytes contain the end of an HTTP header (an empty line).
+     * @return true if a complete header was prefetched.
+     */
+    bool IsHeaderPrefetched();
+
+    /**
+     * @brief Gets the number of prefetched bytes which were not yet read.
+     * @return the number of prefetched bytes which were not yet read.
+     */
+    uint32 GetPrefetchedSize();
+
+    /**
+     * @brief Checks if there are received bytes which were not yet read (either prefetched or in the read buffer).
+     * @return true if there are received bytes which were not yet read.
+     */
+    bool HasBufferedInput();
+
+protected:
+
+    /**
+     * @brief Returns the prefetched bytes (if any) and otherwise reads from the socket.
+     * @see TCPSocket::OSRead
+     */
+    virtual bool OSRead(char8 * const data,
+                        uint32 &size);
+
 private:
 
+    /**
+     * @brief Sends \a size bytes of \a data as a chunk, with a single write.
+     * @param[in] data the chunk data.
+     * @param[in] size the number of bytes of \a data (if 0 only the final chunk, if \a last, is sent).
+     * @param[in] last if true the final chunk is appended.
+     */
+    bool WriteChunk(const char8 * const data,
+                    const uint32 size,
+                    const bool last);
+
+    /**
+     * @brief Sends the content of the write buffer (compressed if StartContentEncoding was called) as a chunk.
+     * @param[in] last if true the compressed stream (if any) is terminated and the final chunk is appended.
+     */
+    bool FlushChunk(const bool last);
+
     /**
      * Chunk mode flag
      */
     bool chunkMode;
+
+    /**
+     * The encoder of the body (NULL if not compressed).
+     */
+    HttpContentEncoder *contentEncoder;
+
+    /**
+     * The compressed bytes to be sent in the next chunk.
+     */
+    StreamString encoded;
+
+    /**
+     * Bytes moved from the socket by Prefetch.
+     */
+    StreamString prefetched;
+
+    /**
+     * Number of prefetched bytes already read.
+     */
+    uint32 prefetchedPosition;
 };
 
 }
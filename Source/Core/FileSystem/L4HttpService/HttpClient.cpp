@@ -32,6 +32,7 @@
 #include "Base64Encoder.h"
 #include "HttpClient.h"
 #include "Md5Encrypt.h"
+#include "Select.h"
 #include "Threads.h"
 
 /*---------------------------------------------------------------------------*/
@@ -182,12 +183,13 @@ bool HttpClient::AutenticationProcedure(const int32 command, const TimeoutType &
 
     // discard bodyF
     StreamString nullStream;
-    bool ret = protocol.CompleteReadOperation(&nullStream, msecTimeout);
+    bool ret = protocol.ReadBody(nullStream, msecTimeout);
     StreamString auth;
     if (ret) {
-        ret = protocol.MoveAbsolute("InputOptions");
+        const char8 *authenticate = protocol.GetInputOption(HTTP_HEADER_WWW_AUTHENTICATE);
+        ret = (authenticate != NULL_PTR(const char8 *));
         if (ret) {
-            ret = protocol.Read("WWW-Authenticate", auth);
+            ret = (auth = authenticate);
         }
     }
 
@@ -221,6 +223,10 @@ bool HttpClient::AutenticationProcedure(const int32 command, const TimeoutType &
 }
 
 bool HttpClient::HttpExchange(BufferedStreamI &streamDataRead, const int32 command, BufferedStreamI * const payload, TimeoutType msecTimeout, int32 operationId) {
+    return HttpStreamExchange(streamDataRead, command, payload, msecTimeout, operationId);
+}
+
+bool HttpClient::HttpStreamExchange(StreamI &bodyOut, const int32 command, BufferedStreamI * const payload, TimeoutType msecTimeout, int32 operationId) {
 
     // absolute time for timeout !
     uint64 startCounter = HighResolutionTimer::Counter();
@@ -234,6 +240,16 @@ bool HttpClient::HttpExchange(BufferedStreamI &streamDataRead, const int32 comma
     if (!reConnect) {
         reConnect = (!socket.IsConnected());
     }
+    if (!reConnect) {
+        //an idle persistent connection has nothing to read: if it is readable the server has closed it
+        Select sel;
+        if (sel.AddReadHandle(socket)) {
+            reConnect = (sel.WaitUntil(TTNoWait) > 0);
+        }
+        if (reConnect) {
+            REPORT_ERROR(ErrorManagement::Information, "The server closed the connection, reconnecting");
+        }
+    }
 
     int32 errorCode;
     bool ret = !HttpDefinition::IsReplyCode(command, errorCode);
@@ -301,22 +317,36 @@ bool HttpClient::HttpExchange(BufferedStreamI &streamDataRead, const int32 comma
             if (ret) {
                 if (protocol.KeepAlive()) {
                     //try again with new authorization
-                    ret = HttpExchange(streamDataRead, command, payload, msecTimeout, operationId);
+                    ret = HttpStreamExchange(bodyOut, command, payload, msecTimeout, operationId);
                 }
             }
 
         }
         else {
-            // read body
-            //TODO here we can read the body inside a structured data?
-            ret = protocol.CompleteReadOperation(&streamDataRead, msecTimeout);
+            // read body, if the reply has one
+            int32 replyCode = protocol.GetHttpCommand() - HttpDefinition::HSHCReply;
+            bool noBody = (command == HttpDefinition::HSHCHead);
+            if (!noBody) {
+                noBody = ((replyCode < 200) || (replyCode == 204) || (replyCode == 304));
+            }
+            if (noBody) {
+                protocol.SetNoBody();
+            }
+            else {
+                ret = protocol.ReadBody(bodyOut, msecTimeout);
+            }
         }
 
         // close if the server says so...
         if (!protocol.KeepAlive()) {
             (void) socket.Close();
+            reConnect = true;
         }
     }
+    if (!ret) {
+        //the state of the connection is unknown: do not reuse it
+        reConnect = true;
+    }
 
     return ret;
 
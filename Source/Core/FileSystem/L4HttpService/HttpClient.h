@@ -99,6 +99,10 @@ public:
      * @brief Sends the HTTP request and waits for reply. If the request has not been authorised,
      * then it updates the Authorization field depending on what has been sent from the server and
      * tries again (if the connection has not been closed by the server itself)
+     * @details The connection is kept open (keep-alive) and reused by the next calls, unless the server closes it,
+     * in which case a new connection is transparently opened. The internal HttpProtocol (and its buffers) is reused
+     * by all the exchanges.
+     * @details The reply body is read with HttpStreamExchange.
      * @param[out] streamDataRead contains the server reply body in output.
      * @param[in] command the HTTP command code. It can be one of the following:
      *   HttpDefinition::HSHCGet, HttpDefinition::HSHCPut, HttpDefinition::HSHCPost, HttpDefinition::HSHCHead.
@@ -110,6 +114,21 @@ public:
      */
     bool HttpExchange(BufferedStreamI &streamDataRead, const int32 command, BufferedStreamI * const payload = NULL_PTR(BufferedStreamI *), TimeoutType msecTimeout = TTInfiniteWait, int32 operationId = -1);
 
+    /**
+     * @brief As HttpExchange, but the reply body is written to \a bodyOut as it is received.
+     * @details The body is read with HttpProtocol::ReadBody, i.e. in blocks of bounded size and with the chunked transfer encoding
+     * decoded on the fly, so that a large reply (e.g. a file) is never held in memory and can be processed (e.g. stored or parsed by
+     * the StreamI) while it is still being received. The replies without body (to a HEAD request, 204 and 304) write nothing.
+     * @param[out] bodyOut the stream where the server reply body is written.
+     * @param[in] command the HTTP command code (see HttpExchange).
+     * @param[in] payload is the body to be sent with the HTTP request.
+     * @param[in] msecTimeout the operation timeout.
+     * @param[in] operationId the operation id.
+     * @return true if the HTTP request has been sent correctly and the whole reply has been received. False if timeout of
+     * errors occur.
+     */
+    bool HttpStreamExchange(StreamI &bodyOut, const int32 command, BufferedStreamI * const payload = NULL_PTR(BufferedStreamI *), TimeoutType msecTimeout = TTInfiniteWait, int32 operationId = -1);
+
     /**
      * @brief Sets the server ip address.
      * @param[in] serverAddressIn the server ip address to be set.
@@ -59,6 +59,11 @@ bool HttpDataExportI::GetAsStructuredData(StreamStructuredDataI &data, HttpProto
     if (ok) {
         ok = protocol.Write("Content-Type", "text/json");
     }
+    //the size is not known in advance
+    uint32 encoding = protocol.GetReplyEncoding("text/json", 0xFFFFFFFFFFFFFFFFull);
+    if (ok) {
+        ok = protocol.WriteContentEncoding("text/json", encoding);
+    }
     if (ok) {
         //empty string... go in chunked mode
         StreamString hstream;
@@ -72,6 +77,9 @@ bool HttpDataExportI::GetAsStructuredData(StreamStructuredDataI &data, HttpProto
     if (ok) {
         sstream->SetChunkMode(true);
     }
+    if ((ok) && (encoding != HTTP_CONTENT_ENCODING_IDENTITY)) {
+        ok = sstream->StartContentEncoding(protocol.GetContentEncoder(), encoding, protocol.GetCompressionLevel());
+    }
     return ok;
 }
 
@@ -84,6 +92,11 @@ bool HttpDataExportI::GetAsText(StreamI &stream, HttpProtocol &protocol) {
     if (ok) {
         ok = protocol.Write("Content-Type", "text/html");
     }
+    //the size is not known in advance
+    uint32 encoding = protocol.GetReplyEncoding("text/html", 0xFFFFFFFFFFFFFFFFull);
+    if (ok) {
+        ok = protocol.WriteContentEncoding("text/html", encoding);
+    }
     if (ok) {
         //empty string... go in chunked mode
         StreamString hstream;
@@ -97,6 +110,9 @@ bool HttpDataExportI::GetAsText(StreamI &stream, HttpProtocol &protocol) {
     if (ok) {
         sstream->SetChunkMode(true);
     }
+    if ((ok) && (encoding != HTTP_CONTENT_ENCODING_IDENTITY)) {
+        ok = sstream->StartContentEncoding(protocol.GetContentEncoder(), encoding, protocol.GetCompressionLevel());
+    }
     return ok;
 }
 
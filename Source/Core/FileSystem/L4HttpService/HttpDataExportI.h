@@ -58,6 +58,7 @@ public:
     /**
      * @brief Streams the data as a json structure.
      * @details This method already implements the setting of the appropriated HTTP header announcing that data will be chunked (see HttpChunkedStream).
+     * If the compression is enabled and accepted by the client (see HttpProtocol::GetReplyEncoding) the chunked body is also compressed.
      * Classes specialising this method will typically call it in order to prepare the HTTP header.
      * @param[out] data holds the tree mapping the json structure to be created and streamed.
      * @param[out] protocol writes the HTTP header  with the json and chunked options.
@@ -68,6 +69,7 @@ public:
     /**
      * @brief Streams the data as text (text/html).
      * @details This method already implements the setting of the appropriated HTTP header announcing that data will be chunked (see HttpChunkedStream).
+     * If the compression is enabled and accepted by the client (see HttpProtocol::GetReplyEncoding) the chunked body is also compressed.
      * Classes specialising this method will typically call it in order to prepare the HTTP header.
      * @param[out] stream holds the tree mapping the json structure to be created and streamed.
      * @param[out] protocol writes the HTTP header with the text/html and chunked options.
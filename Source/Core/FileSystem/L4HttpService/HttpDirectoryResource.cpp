@@ -29,7 +29,10 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "BasicFile.h"
+#include "BasicTCPSocket.h"
 #include "Directory.h"
+#include "DirectoryEnumerator.h"
 #include "DirectoryScanner.h"
 #include "HttpDirectoryResource.h"
 #include "HttpDefinition.h"
@@ -47,6 +50,11 @@ namespace MARTe {
 
 HttpDirectoryResource::HttpDirectoryResource() : Object(), HttpDataExportI() {
     replyNotFound = true;
+    cacheMaxFileSize = 65536u;
+    cacheSize = 4194304u;
+    cachedContentSize = 0u;
+    preGzipped = false;
+    cacheSem.Create();
 }
 
 HttpDirectoryResource::~HttpDirectoryResource() {
@@ -64,6 +72,19 @@ bool HttpDirectoryResource::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::FatalError, "The BaseDir directory shall be specified");
         }
     }
+    if (ok) {
+        if (!data.Read("CacheMaxFileSize", cacheMaxFileSize)) {
+            cacheMaxFileSize = 65536u;
+        }
+        if (!data.Read("CacheSize", cacheSize)) {
+            cacheSize = 4194304u;
+        }
+        uint8 preGzippedIn = 0u;
+        if (!data.Read("PreGzipped", preGzippedIn)) {
+            preGzippedIn = 0u;
+        }
+        preGzipped = (preGzippedIn == 1u);
+    }
     return ok;
 }
 
@@ -87,14 +108,26 @@ bool HttpDirectoryResource::GetAsStructuredData(StreamStructuredDataI &data, Htt
             fullPath += DIRECTORY_SEPARATOR;
             fullPath += path.Buffer();
             Directory d(fullPath.Buffer());
+            uint32 offset = 0u;
+            uint32 limit = 0u;
+            bool paged = protocol.GetInputCommand("offset", offset);
+            if (protocol.GetInputCommand("limit", limit)) {
+                paged = true;
+            }
+            paged = (paged) && (d.IsDirectory());
+            uint32 numberOfFiles = 0u;
             ok = data.CreateRelative("Files");
             if (ok) {
-                if (d.IsDirectory()) {
+                if (paged) {
+                    ok = ListPage(data, fullPath, offset, limit, numberOfFiles);
+                }
+                else if (d.IsDirectory()) {
                     DirectoryScanner ds;
                     ok = ds.Scan(fullPath.Buffer());
+                    LinkedListable *element = ds.List();
                     uint32 i = 0u;
-                    while ((ds.ListPeek(i) != NULL) && (ok)) {
-                        Directory *dt = dynamic_cast<Directory *>(ds.ListPeek(i));
+                    while ((element != NULL) && (ok)) {
+                        Directory *dt = dynamic_cast<Directory *>(element);
                         if (dt != NULL_PTR(Directory *)) {
                             StreamString idx;
                             ok = idx.Printf("%d", i);
@@ -116,6 +149,7 @@ bool HttpDirectoryResource::GetAsStructuredData(StreamStructuredDataI &data, Htt
                                 ok = data.MoveToAncestor(1u);
                             }
                         }
+                        element = element->Next();
                         i++;
                     }
                 }
@@ -140,6 +174,9 @@ bool HttpDirectoryResource::GetAsStructuredData(StreamStructuredDataI &data, Htt
             if (ok) {
                 ok = data.MoveToAncestor(1u);
             }
+            if ((ok) && (paged)) {
+                ok = data.Write("NumberOfFiles", numberOfFiles);
+            }
         }
         if (ok) {
             ok = sdata->GetPrinter()->PrintEnd();
@@ -148,7 +185,62 @@ bool HttpDirectoryResource::GetAsStructuredData(StreamStructuredDataI &data, Htt
     return ok;
 }
 
-/*lint -e{715} stream not required by this implementation*/
+bool HttpDirectoryResource::ListPage(StreamStructuredDataI &data, const StreamString &fullPath, const uint32 offset, const uint32 limit,
+                                     uint32 &numberOfFiles) const {
+    StreamString basePath = fullPath;
+    const char8 * const pathBuffer = basePath.Buffer();
+    uint32 pathLength = static_cast<uint32>(basePath.Size());
+    bool ok = true;
+    if (pathLength > 0u) {
+        if (pathBuffer[pathLength - 1u] != DIRECTORY_SEPARATOR) {
+            ok = basePath.Printf("%c", DIRECTORY_SEPARATOR);
+        }
+    }
+    DirectoryEnumerator de;
+    if (ok) {
+        ok = de.Open(basePath.Buffer());
+    }
+    uint32 i = 0u;
+    if (ok) {
+        //Only the entries in the page are stat-ed
+        i = de.Skip(offset);
+    }
+    bool more = (ok) && (i == offset);
+    while ((ok) && (more) && ((limit == 0u) || (i < (offset + limit)))) {
+        more = de.Next();
+        if (more) {
+            StreamString idx;
+            ok = idx.Printf("%d", i);
+            if (ok) {
+                ok = data.CreateRelative(idx.Buffer());
+            }
+            if (ok) {
+                StreamString name = basePath;
+                name += de.GetName();
+                ok = data.Write("Name", name.Buffer());
+            }
+            if (ok) {
+                ok = data.Write("IsDirectory", de.IsDirectory() ? "1" : "0");
+            }
+            if (ok) {
+                StreamString ss;
+                (void) ss.Printf("%d", de.GetSize());
+                ok = data.Write("Size", ss.Buffer());
+            }
+            if (ok) {
+                ok = data.MoveToAncestor(1u);
+            }
+            i++;
+        }
+    }
+    if ((ok) && (more)) {
+        //Count the remaining entries (the names are only read)
+        i += de.Skip(0xFFFFFFFFu);
+    }
+    numberOfFiles = i;
+    return ok;
+}
+
 bool HttpDirectoryResource::GetAsText(StreamI &stream, HttpProtocol &protocol) {
     StreamString path;
     if (!protocol.GetInputCommand("path", path)) {
@@ -158,7 +250,7 @@ bool HttpDirectoryResource::GetAsText(StreamI &stream, HttpProtocol &protocol) {
     fullPath += DIRECTORY_SEPARATOR;
     fullPath += path.Buffer();
     REPORT_ERROR(ErrorManagement::Debug, "Serving %s", fullPath.Buffer());
-    bool ok = ServeFile(fullPath, protocol);
+    bool ok = ServeFile(fullPath, stream, protocol);
     return ok;
 }
 
@@ -174,88 +266,272 @@ bool HttpDirectoryResource::CheckExtension(StreamString &fname, const char8 * co
     return ok;
 }
 
-bool HttpDirectoryResource::ServeFile(StreamString &fname, HttpProtocol &protocol) const {
-    File f;
-    bool ok = f.Open(fname.Buffer(), MARTe::BasicFile::ACCESS_MODE_R);
+bool HttpDirectoryResource::ServeFile(StreamString &fname, StreamI &stream, HttpProtocol &protocol) {
     StreamString mime = "binary";
 
     /*lint -e{9007} no side effects on CheckExtension function call*/
+    if (CheckExtension(fname, ".html") || CheckExtension(fname, ".htm")) {
+        mime = "text/html";
+    }
+    else if (CheckExtension(fname, ".txt")) {
+        mime = "text/plain";
+    }
+    else if (CheckExtension(fname, ".csv")) {
+        mime = "text/csv";
+    }
+    else if (CheckExtension(fname, ".css")) {
+        mime = "text/css";
+    }
+    else if (CheckExtension(fname, ".gif")) {
+        mime = "image/gif";
+    }
+    else if (CheckExtension(fname, ".jpeg") || CheckExtension(fname, ".jpg")) {
+        mime = "image/jpg";
+    }
+    else if (CheckExtension(fname, ".jnlp")) {
+        mime = "image/jnlp";
+    }
+    else if (CheckExtension(fname, ".js")) {
+        mime = "application/x-javascript";
+    }
+    else {
+        mime = "binary";
+    }
+
+    ReferenceT<HttpCachedFile> file;
+    bool gzipped = false;
+    if (preGzipped) {
+        if (AcceptsGzip(protocol)) {
+            StreamString gzipName = fname;
+            gzipName += ".gz";
+            file = GetFile(gzipName.Buffer());
+            gzipped = file.IsValid();
+        }
+    }
+    if (!gzipped) {
+        file = GetFile(fname.Buffer());
+    }
+    bool ok = file.IsValid();
+    bool notModified = false;
     if (ok) {
-        if (CheckExtension(fname, ".html") || CheckExtension(fname, ".htm")) {
-            mime = "text/html";
+        notModified = IsNotModified(protocol, file);
+        ok = protocol.MoveAbsolute("OutputOptions");
+    }
+    else {
+        if (replyNotFound) {
+            (void) HttpDataExportI::ReplyNotFound(protocol);
         }
-        else if (CheckExtension(fname, ".txt")) {
-            mime = "text/plain";
+    }
+    uint32 encoding = HTTP_CONTENT_ENCODING_IDENTITY;
+    const char8 *encodedContent = NULL_PTR(const char8 *);
+    uint32 encodedSize = 0u;
+    if ((ok) && (!gzipped) && (file->HasContent())) {
+        //Only the cached files are compressed, so that the compressed content is kept with them
+        encoding = protocol.GetReplyEncoding(mime.Buffer(), file->GetSize());
+        if (encoding != HTTP_CONTENT_ENCODING_IDENTITY) {
+            encodedContent = file->GetEncodedContent(encoding, protocol.GetCompressionLevel(), encodedSize);
+            if (encodedContent == NULL_PTR(const char8 *)) {
+                encoding = HTTP_CONTENT_ENCODING_IDENTITY;
+            }
         }
-        else if (CheckExtension(fname, ".csv")) {
-            mime = "text/csv";
+    }
+    if (ok) {
+        if (encoding != HTTP_CONTENT_ENCODING_IDENTITY) {
+            //The same validator is used for all the encodings
+            StreamString weakETag = "W/";
+            weakETag += file->GetETag();
+            ok = protocol.Write("ETag", weakETag.Buffer());
         }
-        else if (CheckExtension(fname, ".css")) {
-            mime = "text/css";
+        else {
+            ok = protocol.Write("ETag", file->GetETag());
         }
-        else if (CheckExtension(fname, ".gif")) {
-            mime = "image/gif";
+    }
+    if (ok) {
+        ok = protocol.Write("Last-Modified", file->GetLastModified());
+    }
+    if ((ok) && (preGzipped)) {
+        ok = protocol.Write("Vary", "Accept-Encoding");
+    }
+    else if (ok) {
+        //Only the Vary, also in the Not Modified reply
+        ok = protocol.WriteContentEncoding(mime.Buffer(), HTTP_CONTENT_ENCODING_IDENTITY);
+    }
+    else {
+        //The file was not found
+    }
+    if ((ok) && (notModified)) {
+        ok = protocol.WriteHeader(false, HttpDefinition::HSHCReplyNotModified, NULL_PTR(BufferedStreamI *), NULL_PTR(const char8*));
+    }
+    else if (ok) {
+        ok = protocol.Write("Content-Type", mime.Buffer());
+        if ((ok) && (gzipped)) {
+            ok = protocol.Write("Content-Encoding", "gzip");
         }
-        else if (CheckExtension(fname, ".jpeg") || CheckExtension(fname, ".jpg")) {
-            mime = "image/jpg";
+        else if ((ok) && (encodedContent != NULL_PTR(const char8 *))) {
+            ok = protocol.Write("Content-Encoding", HttpContentEncoder::GetEncodingName(encoding));
         }
-        else if (CheckExtension(fname, ".jnlp")) {
-            mime = "image/jnlp";
+        else {
+            //Sent as it is
         }
-        else if (CheckExtension(fname, ".js")) {
-            mime = "application/x-javascript";
+        uint64 fileSize = file->GetSize();
+        if (encodedContent != NULL_PTR(const char8 *)) {
+            fileSize = encodedSize;
         }
-        else {
-            mime = "binary";
+        if (ok) {
+            ok = protocol.Write("Content-Length", fileSize);
         }
-        ok = protocol.MoveAbsolute("OutputOptions");
-    }
-    else {
-        if (replyNotFound) {
-            (void) HttpDataExportI::ReplyNotFound(protocol);
+        if (ok) {
+            //The header is flushed before the body is sent
+            ok = protocol.WriteHeader(false, HttpDefinition::HSHCReplyOK, NULL_PTR(BufferedStreamI *), NULL_PTR(const char8*));
+        }
+        //With the HEAD just inform that the file exists
+        bool sendBody = (protocol.GetHttpCommand() != HttpDefinition::HSHCHead);
+        if ((ok) && (sendBody) && (fileSize > 0u)) {
+            if (encodedContent != NULL_PTR(const char8 *)) {
+                uint32 writeSize = encodedSize;
+                ok = stream.Write(encodedContent, writeSize);
+            }
+            else if (file->HasContent()) {
+                uint32 writeSize = static_cast<uint32>(fileSize);
+                ok = stream.Write(file->GetContent(), writeSize);
+            }
+            else {
+                BasicFile f;
+                ok = f.Open(file->GetPath(), BasicFile::ACCESS_MODE_R);
+                BasicTCPSocket *socket = dynamic_cast<BasicTCPSocket *>(&stream);
+                if ((ok) && (socket != NULL_PTR(BasicTCPSocket *))) {
+                    uint64 sentSize = fileSize;
+                    ok = socket->SendFile(f, 0u, sentSize);
+                }
+                else if (ok) {
+                    const uint32 bufferSize = 65536u;
+                    char8 *buffer = new char8[bufferSize];
+                    uint64 sentSize = 0u;
+                    while ((ok) && (sentSize < fileSize)) {
+                        uint32 readSize = bufferSize;
+                        ok = f.Read(buffer, readSize);
+                        if (ok) {
+                            ok = (readSize > 0u);
+                        }
+                        if (ok) {
+                            ok = stream.Write(buffer, readSize);
+                        }
+                        sentSize += readSize;
+                    }
+                    delete[] buffer;
+                }
+                else {
+                    REPORT_ERROR(ErrorManagement::Warning, "Could not open %s", file->GetPath());
+                }
+                if (f.IsOpen()) {
+                    (void) f.Close();
+                }
+            }
         }
     }
-    if (ok) {
-        ok = protocol.Write("Content-Type", mime.Buffer());
+    else {
+        //The file was not found
     }
-    if (ok) {
-        //With the HEAD just inform that the file exists
-        if (protocol.GetHttpCommand() == HttpDefinition::HSHCHead) {
-            StreamString s;
-            ok = s.SetSize(0LLU);
-            if (ok) {
-                ok = protocol.WriteHeader(true, HttpDefinition::HSHCReplyOK, &s, NULL_PTR(const char8*));
+    return ok;
+}
+
+ReferenceT<HttpCachedFile> HttpDirectoryResource::GetFile(const char8 * const fname) {
+    ReferenceT<HttpCachedFile> file;
+    Directory d(fname);
+    if (d.IsFile()) {
+        uint64 fileSize = d.GetSize();
+        uint64 lastWriteTime = d.GetLastWriteTimeSeconds();
+        bool loadContent = false;
+        if (cacheSem.FastLock() == ErrorManagement::NoError) {
+            uint32 nOfFiles = cache.Size();
+            uint32 i;
+            for (i = 0u; (i < nOfFiles) && (!file.IsValid()); i++) {
+                ReferenceT<HttpCachedFile> cached = cache.Get(i);
+                if (cached.IsValid()) {
+                    if (StringHelper::Compare(cached->GetPath(), fname) == 0) {
+                        if (cached->IsUpToDate(fileSize, lastWriteTime)) {
+                            file = cached;
+                        }
+                    }
+                }
+            }
+            if (!file.IsValid()) {
+                loadContent = (fileSize <= cacheMaxFileSize);
+                if (loadContent) {
+                    loadContent = ((cachedContentSize + fileSize) <= cacheSize);
+                }
             }
+            cacheSem.FastUnLock();
         }
-        else {
-            ok = protocol.WriteHeader(true, HttpDefinition::HSHCReplyOK, &f, NULL_PTR(const char8*));
+        //The file is read outside of the lock, so that other files can be served in the meanwhile
+        if (!file.IsValid()) {
+            ReferenceT<HttpCachedFile> loaded(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+            if (loaded->Load(fname, fileSize, lastWriteTime, loadContent)) {
+                file = loaded;
+            }
+        }
+        //Replace any older version of the file (also if another thread has loaded it in the meanwhile)
+        if ((file.IsValid()) && (cacheSem.FastLock() == ErrorManagement::NoError)) {
+            uint32 i = cache.Size();
+            bool inserted = false;
+            while (i > 0u) {
+                i--;
+                ReferenceT<HttpCachedFile> cached = cache.Get(i);
+                if (cached.IsValid()) {
+                    if (cached == file) {
+                        inserted = true;
+                    }
+                    else if (StringHelper::Compare(cached->GetPath(), fname) == 0) {
+                        if (cached->HasContent()) {
+                            cachedContentSize -= cached->GetSize();
+                        }
+                        (void) cache.Delete(cached);
+                    }
+                    else {
+                        //Another file
+                    }
+                }
+            }
+            if (!inserted) {
+                if (cache.Insert(file)) {
+                    if (file->HasContent()) {
+                        cachedContentSize += file->GetSize();
+                    }
+                }
+            }
+            cacheSem.FastUnLock();
         }
     }
-    /*if (ok) {
-     ok = f.Size()Seek(0LLU);
-     }
-     const uint32 bufReadSize = 128000u;
-     char8 *buf = NULL_PTR(char8 *);
-     if (ok) {
-     buf = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(bufReadSize));
-     uint32 bufSize = 128000u;
-     while ((f.Read(buf, bufSize)) && (ok)) {
-     ok = stream.Write(buf, bufSize);
-     bufSize = bufReadSize;
-     }
-     }
-     if (ok) {
-     if (buf != NULL_PTR(char8 *)) {
-     GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(buf));
-     }
-     }
-     if (ok) {
-     ok = f.Close();
-     }*/
-    if (ok) {
-        ok = f.Close();
+    return file;
+}
+
+/*lint -e{1746} file is a reference*/
+bool HttpDirectoryResource::IsNotModified(HttpProtocol &protocol, ReferenceT<HttpCachedFile> file) const {
+    bool notModified = false;
+    const char8 *condition = protocol.GetInputOption(HTTP_HEADER_IF_NONE_MATCH);
+    if (condition != NULL_PTR(const char8 *)) {
+        notModified = (StringHelper::Compare(condition, "*") == 0);
+        if (!notModified) {
+            notModified = (StringHelper::SearchString(condition, file->GetETag()) != NULL_PTR(const char8 *));
+        }
     }
-    return ok;
+    else {
+        condition = protocol.GetInputOption(HTTP_HEADER_IF_MODIFIED_SINCE);
+        if (condition != NULL_PTR(const char8 *)) {
+            //The clients send back the Last-Modified of the cached version
+            notModified = (StringHelper::Compare(condition, file->GetLastModified()) == 0);
+        }
+    }
+    return notModified;
+}
+
+bool HttpDirectoryResource::AcceptsGzip(HttpProtocol &protocol) const {
+    bool accepts = false;
+    const char8 *encodings = protocol.GetInputOption(HTTP_HEADER_ACCEPT_ENCODING);
+    if (encodings != NULL_PTR(const char8 *)) {
+        accepts = (StringHelper::SearchString(encodings, "gzip") != NULL_PTR(const char8 *));
+    }
+    return accepts;
 }
 
 void HttpDirectoryResource::SetReplyNotFound(const bool replyNotFoundIn) {
@@ -31,9 +31,13 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "FastPollingMutexSem.h"
+#include "HttpCachedFile.h"
 #include "HttpDataExportI.h"
 #include "File.h"
 #include "Object.h"
+#include "ReferenceContainer.h"
+#include "ReferenceT.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -42,11 +46,33 @@ namespace MARTe {
 /**
  * @brief HTTP browsing of files and directories.
  *
- * @details The configuration syntax is (names are only given as an example):
+ * @details The files are served with ETag and Last-Modified headers and a 304 (Not Modified) is replied, without
+ * body, when the If-None-Match (or, if not set, the If-Modified-Since) header of the request matches the file.
+ * The validators of the served files are cached (see HttpCachedFile) and recomputed only when the size or the last
+ * write time of the file changes. The content of the files not larger than CacheMaxFileSize is also cached in memory,
+ * up to a total of CacheSize bytes. The other files are sent with BasicTCPSocket::SendFile, i.e. without being copied
+ * through user space.
+ *
+ * Directory listings are sorted by name. Large directories can be paged with the offset and limit parameters of the request
+ * (e.g. ?path=records&offset=1000&limit=100): the paged listing is streamed in the (stable) order of the file system, only
+ * the properties of the entries in the page are read, the entries keep their index in the directory as name and the listing
+ * also includes the total NumberOfFiles.
+ *
+ * If PreGzipped = 1 and the client accepts the gzip encoding, a request for FILE is served with the content of
+ * FILE.gz (with Content-Encoding: gzip), if such file exists in the same directory.
+ * Otherwise, if the compression is enabled in the HttpService (see HttpProtocol::GetReplyEncoding), the text files whose
+ * content is cached are sent compressed. Each file is compressed once per encoding and the compressed variant is kept
+ * with its cached content (see HttpCachedFile::GetEncodedContent), without being counted in the CacheSize. The compressed
+ * replies carry a weak ETag.
+ *
+ * The configuration syntax is (names are only given as an example):
  * <pre>
  * +HttpDirectoryResource1 = {
  *     Class = HttpDirectoryResource
  *     BaseDir = "/" //Compulsory. The base directory w.r.t. to which all the paths are evaluated.
+ *     CacheMaxFileSize = 65536 //Optional. Maximum size in bytes of a file whose content is cached in memory. Default = 65536.
+ *     CacheSize = 4194304 //Optional. Maximum total size in bytes of the content cached in memory (0 => no content is cached). Default = 4194304.
+ *     PreGzipped = 0 //Optional. If 1 serve the FILE.gz files to the clients that accept the gzip encoding. Default = 0.
  * }
  * </pre>
  */
@@ -65,7 +91,7 @@ HttpDirectoryResource    ();
     virtual ~HttpDirectoryResource();
 
     /**
-     * @brief Calls Object::Initialise and reads the BaseDir parameters (see class description) .
+     * @brief Calls Object::Initialise and reads the BaseDir, CacheMaxFileSize, CacheSize and PreGzipped parameters (see class description) .
      * @return true if the parameters are correctly specified.
      */
     virtual bool Initialise(StructuredDataI &data);
@@ -101,13 +127,49 @@ private:
      */
     bool CheckExtension(StreamString &fname, const char8 * const ext) const;
 
+    /**
+     * @brief Helper function which lists a page of the entries of a directory, in the order of the file system.
+     * @param[out] data output where the entries are written into.
+     * @param[in] fullPath the directory.
+     * @param[in] offset index of the first entry to list.
+     * @param[in] limit maximum number of entries to list (0 for all).
+     * @param[out] numberOfFiles the total number of entries in the directory.
+     * @return true if the directory could be read and all the data write operations are successful.
+     */
+    bool ListPage(StreamStructuredDataI &data, const StreamString &fullPath, const uint32 offset, const uint32 limit,
+                  uint32 &numberOfFiles) const;
+
     /**
      * @brief Helper function which streams the filename over the provided stream.
      * @param[in] fname the name of the file to stream.
+     * @param[out] stream the stream where to write the file.
      * @param[out] protocol to write the Content-type.
      * @return true if the file can be successfully streamed.
      */
-    bool ServeFile(StreamString &fname, HttpProtocol &protocol) const;
+    bool ServeFile(StreamString &fname, StreamI &stream, HttpProtocol &protocol);
+
+    /**
+     * @brief Gets the cached properties of a file, (re)loading them if the file is not cached or was modified.
+     * @param[in] fname the name of the file.
+     * @return the file properties or an invalid reference if the file does not exist or cannot be read.
+     */
+    ReferenceT<HttpCachedFile> GetFile(const char8 * const fname);
+
+    /**
+     * @brief Checks if the client already has the current version of the file.
+     * @param[in] protocol the protocol holding the request headers.
+     * @param[in] file the file to be served.
+     * @return true if the If-None-Match header matches the file ETag or, if not set, the If-Modified-Since header is
+     * equal to the file Last-Modified.
+     */
+    bool IsNotModified(HttpProtocol &protocol, ReferenceT<HttpCachedFile> file) const;
+
+    /**
+     * @brief Checks if the client accepts the gzip encoding.
+     * @param[in] protocol the protocol holding the request headers.
+     * @return true if the Accept-Encoding header contains gzip.
+     */
+    bool AcceptsGzip(HttpProtocol &protocol) const;
 
     /**
      * The base directory w.r.t. which all the paths are evaluated.
@@ -118,6 +180,36 @@ private:
      * True if ReplyNotFound should be set when a file is not found.
      */
     bool replyNotFound;
+
+    /**
+     * The cached files (HttpCachedFile).
+     */
+    ReferenceContainer cache;
+
+    /**
+     * Protects the cache.
+     */
+    FastPollingMutexSem cacheSem;
+
+    /**
+     * Maximum size of a file whose content is cached.
+     */
+    uint32 cacheMaxFileSize;
+
+    /**
+     * Maximum total size of the cached content.
+     */
+    uint32 cacheSize;
+
+    /**
+     * Total size of the cached content.
+     */
+    uint64 cachedContentSize;
+
+    /**
+     * True if the FILE.gz files are served to the clients that accept the gzip encoding.
+     */
+    bool preGzipped;
 };
 }
 
@@ -31,6 +31,8 @@
 #include "AdvancedErrorManagement.h"
 #include "HttpChunkedStream.h"
 
+#include "HeapManager.h"
+#include "HighResolutionTimer.h"
 #include "HttpDirectoryResource.h"
 #include "HttpObjectBrowser.h"
 #include "HttpProtocol.h"
@@ -51,6 +53,14 @@ HttpObjectBrowser::HttpObjectBrowser() :
         ReferenceContainer(), HttpDataExportI() {
     closeOnAuthFail = 1u;
     root = NULL_PTR(ReferenceContainer *);
+    cacheMux.Create();
+    cacheNamesVersion = Object::GetNamesVersion();
+    for (uint32 i = 0u; i < HTTP_OBJECT_BROWSER_CACHE_SIZE; i++) {
+        cache[i].container = NULL_PTR(const ReferenceContainer *);
+        cache[i].childrenVersion = 0u;
+        cache[i].offset = 0u;
+        cache[i].limit = 0u;
+    }
 }
 
 HttpObjectBrowser::~HttpObjectBrowser() {
@@ -58,6 +68,10 @@ HttpObjectBrowser::~HttpObjectBrowser() {
 }
 
 void HttpObjectBrowser::Purge(ReferenceContainer &purgeList) {
+    if (cacheMux.FastLock() == ErrorManagement::NoError) {
+        CacheClear();
+    }
+    cacheMux.FastUnLock();
     ReferenceContainer::Purge(purgeList);
 }
 
@@ -226,70 +240,50 @@ Reference HttpObjectBrowser::FindTarget(HttpProtocol &protocol) {
 bool HttpObjectBrowser::GetAsStructuredData(StreamStructuredDataI &data, HttpProtocol &protocol) {
     bool ok = CheckSecurity(protocol);
     if (ok) {
+        StreamString requestedPath;
+        protocol.GetUnmatchedId(requestedPath);
         Reference target = FindTarget(protocol);
         ok = target.IsValid();
+        bool heapStatistics = false;
+        if (!ok) {
+            heapStatistics = (requestedPath == HTTP_OBJECT_BROWSER_HEAP_STATISTICS);
+            ok = heapStatistics;
+        }
         StreamStructuredData<JsonPrinter> *sdata;
         if (ok) {
             sdata = dynamic_cast<StreamStructuredData<JsonPrinter> *>(&data);
             /*lint -e{665} StreamStructuredData<JsonPrinter> is only used to define the pointer type of the NULL_PTR*/
             ok = (sdata != NULL_PTR(StreamStructuredData<JsonPrinter> *));
         }
-        if (ok) {
+        if ((ok) && (heapStatistics)) {
+            ok = ReplyHeapStatistics(*sdata, protocol);
+        }
+        else if (ok) {
             bool isThis = (target == this);
             //If we are printing ourselves list all the elements belonging to the root (note that the root might be pointing elsewhere).
             if (isThis) {
-                ok = HttpDataExportI::GetAsStructuredData(data, protocol);
-                //Print the opening {
-                if (ok) {
-                    //lint -e{644} sdata initialised otherwise ok would be false*/
-                    ok = sdata->GetPrinter()->PrintBegin();
-                }
-                if (ok) {
-                    //Export the data.
-                    ok = Object::ExportData(data);
-                }
                 //List the elements that belong to the root (cannot point directly to the RC implementation as otherwise it would print the wrong class name).
-                uint32 numberOfChildren = root->Size();
-                for (uint32 i = 0u; (i < numberOfChildren) && (ok); i++) {
-                    StreamString nname;
-                    uint32 ii = i;
-                    ok = nname.Printf("%d", ii);
-                    if (ok) {
-                        ok = data.CreateRelative(nname.Buffer());
-                    }
-                    Reference child;
-                    if (ok) {
-                        child = root->Get(i);
-                        ok = child.IsValid();
-                    }
-                    if (ok) {
-                        ReferenceT<ReferenceContainer> childRC = child;
-                        //Do not go recursive
-                        if (childRC.IsValid()) {
-                            ok = child->Object::ExportData(data);
-                            if (ok) {
-                                ok = data.Write("IsContainer", 1);
-                            }
-                        }
-                        else {
-                            ok = child->ExportData(data);
-                        }
-                    }
-                    if (ok) {
-                        ok = data.MoveToAncestor(1u);
-                    }
-                }
-                //Print the closing {
-                if (ok) {
-                    ok = sdata->GetPrinter()->PrintEnd();
-                }
+                ok = ReplyContainer(*this, *root, Reference(), protocol);
             }
             else {
                 //Not pointing at ourselves. It can be a HttpDataExportI in which case we forward the work.
                 ReferenceT<HttpDataExportI> httpDataExportI = target;
+                ReferenceT<ReferenceContainer> targetRC = target;
+                bool isPlainContainer = targetRC.IsValid();
+                if (isPlainContainer) {
+                    //Derived classes may export more than the children (e.g. the GAM signals)
+                    const ClassProperties *properties = target->GetClassProperties();
+                    isPlainContainer = (properties != NULL_PTR(const ClassProperties *));
+                    if (isPlainContainer) {
+                        isPlainContainer = (StringHelper::Compare(properties->GetName(), "ReferenceContainer") == 0);
+                    }
+                }
                 if (httpDataExportI.IsValid()) {
                     ok = httpDataExportI->GetAsStructuredData(data, protocol);
                 }
+                else if (isPlainContainer) {
+                    ok = ReplyContainer(*targetRC.operator ->(), *targetRC.operator ->(), target, protocol);
+                }
                 else {
                     //Otherwise dump the object values.
                     ok = HttpDataExportI::GetAsStructuredData(data, protocol);
@@ -355,6 +349,280 @@ bool HttpObjectBrowser::GetAsText(StreamI &stream, HttpProtocol &protocol) {
     return ok;
 }
 
+bool HttpObjectBrowser::ReplyContainer(Object &owner, ReferenceContainer &container, const Reference &holder, HttpProtocol &protocol) {
+    uint32 offset = 0u;
+    uint32 limit = 0u;
+    bool paged = protocol.GetInputCommand("offset", offset);
+    if (protocol.GetInputCommand("limit", limit)) {
+        paged = true;
+    }
+    if (!paged) {
+        offset = 0u;
+        limit = 0u;
+    }
+    uint32 slot = static_cast<uint32>(reinterpret_cast<uintp>(&container) >> 4u);
+    slot ^= (offset * 31u);
+    slot ^= (limit * 17u);
+    slot &= (HTTP_OBJECT_BROWSER_CACHE_SIZE - 1u);
+
+    uint32 namesVersion = Object::GetNamesVersion();
+    uint32 childrenVersion = container.GetChildrenVersion();
+    StreamString page;
+    StreamString eTag;
+    bool cached = false;
+    if (cacheMux.FastLock() == ErrorManagement::NoError) {
+        if (cacheNamesVersion != namesVersion) {
+            CacheClear();
+            cacheNamesVersion = namesVersion;
+        }
+        CacheEntry &entry = cache[slot];
+        if (entry.container == &container) {
+            cached = ((entry.childrenVersion == childrenVersion) && (entry.offset == offset) && (entry.limit == limit));
+        }
+        if (cached) {
+            page = entry.page.Buffer();
+            eTag = entry.eTag.Buffer();
+        }
+    }
+    cacheMux.FastUnLock();
+
+    bool ok = true;
+    if (!cached) {
+        bool cacheable = false;
+        ok = PrintContainer(owner, container, offset, limit, paged, page, cacheable);
+        if ((ok) && (cacheable)) {
+            uint64 now = HighResolutionTimer::Counter();
+            ok = eTag.Printf("\"%x-%x\"", now, childrenVersion);
+        }
+        if ((ok) && (cacheable)) {
+            if (cacheMux.FastLock() == ErrorManagement::NoError) {
+                //Only if nothing changed while serialising
+                if ((cacheNamesVersion == namesVersion) && (container.GetChildrenVersion() == childrenVersion)) {
+                    CacheEntry &entry = cache[slot];
+                    entry.container = &container;
+                    entry.reference = holder;
+                    entry.childrenVersion = childrenVersion;
+                    entry.offset = offset;
+                    entry.limit = limit;
+                    entry.page = page.Buffer();
+                    entry.eTag = eTag.Buffer();
+                }
+            }
+            cacheMux.FastUnLock();
+        }
+    }
+    bool notModified = false;
+    if ((ok) && (eTag.Size() > 0u)) {
+        const char8 *condition = protocol.GetInputOption(HTTP_HEADER_IF_NONE_MATCH);
+        if (condition != NULL_PTR(const char8 *)) {
+            notModified = (StringHelper::SearchString(condition, eTag.Buffer()) != NULL_PTR(const char8 *));
+        }
+    }
+    if (ok) {
+        ok = protocol.MoveAbsolute("OutputOptions");
+    }
+    if (ok) {
+        ok = protocol.Write("Content-Type", "text/json");
+    }
+    if ((ok) && (eTag.Size() > 0u)) {
+        ok = protocol.Write("ETag", eTag.Buffer());
+        if (ok) {
+            //Revalidate on every request
+            ok = protocol.Write("Cache-Control", "no-cache");
+        }
+    }
+    if ((ok) && (notModified)) {
+        ok = protocol.WriteHeader(false, HttpDefinition::HSHCReplyNotModified, NULL_PTR(BufferedStreamI *), NULL_PTR(const char8*));
+    }
+    else if (ok) {
+        ok = page.Seek(0LLU);
+        if (ok) {
+            ok = protocol.WriteHeader(true, HttpDefinition::HSHCReplyOK, &page, NULL_PTR(const char8*));
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to list %s", container.GetName());
+    }
+    return ok;
+}
+
+bool HttpObjectBrowser::ReplyHeapStatistics(StreamStructuredData<JsonPrinter> &data, HttpProtocol &protocol) {
+    //Copied before anything is written, as the reply itself allocates memory
+    HeapI *heaps[HTTP_OBJECT_BROWSER_MAX_HEAPS];
+    uint32 numberOfHeaps = HeapManager::ListHeaps(&heaps[0u], HTTP_OBJECT_BROWSER_MAX_HEAPS);
+    HeapManager::RealTimeViolation violations[HeapManager::HEAP_MANAGER_REAL_TIME_VIOLATIONS];
+    uint32 numberOfViolations = 0u;
+    uint64 totalViolations = HeapManager::GetRealTimeViolations(&violations[0u], HeapManager::HEAP_MANAGER_REAL_TIME_VIOLATIONS, numberOfViolations);
+
+    bool ok = HttpDataExportI::GetAsStructuredData(data, protocol);
+    //Print the opening {
+    if (ok) {
+        ok = data.GetPrinter()->PrintBegin();
+    }
+    if (ok) {
+        ok = data.Write("NumberOfRealTimeViolations", totalViolations);
+    }
+    if (ok) {
+        ok = data.CreateRelative("Heaps");
+    }
+    for (uint32 i = 0u; (i < numberOfHeaps) && (ok); i++) {
+        HeapManager::HeapStatistics statistics;
+        if (HeapManager::GetStatistics(heaps[i], statistics)) {
+            StreamString nname;
+            ok = nname.Printf("%d", i);
+            if (ok) {
+                ok = data.CreateRelative(nname.Buffer());
+            }
+            if (ok) {
+                ok = data.Write("Name", heaps[i]->Name());
+            }
+            if (ok) {
+                ok = data.Write("NumberOfAllocations", statistics.numberOfAllocations);
+            }
+            if (ok) {
+                ok = data.Write("NumberOfFrees", statistics.numberOfFrees);
+            }
+            if (ok) {
+                ok = data.Write("NumberOfFailures", statistics.numberOfFailures);
+            }
+            if (ok) {
+                ok = data.Write("AllocatedBytes", statistics.allocatedBytes);
+            }
+            if (ok) {
+                ok = data.Write("BlocksInUse", statistics.blocksInUse);
+            }
+            if (ok) {
+                ok = data.Write("MaxBlocksInUse", statistics.maxBlocksInUse);
+            }
+            if (ok) {
+                ok = data.Write("RealTimeAllocations", statistics.realTimeAllocations);
+            }
+            if (ok) {
+                ok = data.Write("RealTimeFrees", statistics.realTimeFrees);
+            }
+            if (ok) {
+                ok = data.MoveToAncestor(1u);
+            }
+        }
+    }
+    if (ok) {
+        ok = data.MoveToAncestor(1u);
+    }
+    if (ok) {
+        ok = data.CreateRelative("RealTimeViolations");
+    }
+    const char8 * const operationNames[] = { "Malloc", "Free", "Realloc", "Duplicate" };
+    for (uint32 i = 0u; (i < numberOfViolations) && (ok); i++) {
+        StreamString nname;
+        ok = nname.Printf("%d", i);
+        if (ok) {
+            ok = data.CreateRelative(nname.Buffer());
+        }
+        StreamString callSite;
+        if (ok) {
+            uint64 address = static_cast<uint64>(violations[i].callSite);
+            ok = callSite.Printf("0x%x", address);
+        }
+        if (ok) {
+            ok = data.Write("CallSite", callSite.Buffer());
+        }
+        if (ok) {
+            ok = data.Write("Operation", operationNames[violations[i].operation]);
+        }
+        if (ok) {
+            const char8 *heapName = "Unknown";
+            for (uint32 h = 0u; h < numberOfHeaps; h++) {
+                if (heaps[h] == violations[i].heap) {
+                    heapName = heaps[h]->Name();
+                }
+            }
+            ok = data.Write("Heap", heapName);
+        }
+        if (ok) {
+            ok = data.Write("Cycle", violations[i].cycle);
+        }
+        if (ok) {
+            ok = data.MoveToAncestor(1u);
+        }
+    }
+    if (ok) {
+        ok = data.MoveToAncestor(1u);
+    }
+    //Print the closing }
+    if (ok) {
+        ok = data.GetPrinter()->PrintEnd();
+    }
+    return ok;
+}
+
+bool HttpObjectBrowser::PrintContainer(Object &owner, ReferenceContainer &container, const uint32 offset, const uint32 limit, const bool paged,
+                                       StreamString &page, bool &cacheable) const {
+    StreamStructuredData<JsonPrinter> data(page);
+    cacheable = true;
+    //Print the opening {
+    bool ok = data.GetPrinter()->PrintBegin();
+    if (ok) {
+        ok = owner.Object::ExportData(data);
+    }
+    uint32 numberOfChildren = container.Size();
+    if ((ok) && (paged)) {
+        ok = data.Write("NumberOfChildren", numberOfChildren);
+    }
+    uint32 end = numberOfChildren;
+    if (limit > 0u) {
+        if (offset < numberOfChildren) {
+            if (limit < (numberOfChildren - offset)) {
+                end = offset + limit;
+            }
+        }
+    }
+    for (uint32 i = offset; (i < end) && (ok); i++) {
+        StreamString nname;
+        uint32 ii = i;
+        ok = nname.Printf("%d", ii);
+        if (ok) {
+            ok = data.CreateRelative(nname.Buffer());
+        }
+        Reference child;
+        if (ok) {
+            child = container.Get(i);
+            ok = child.IsValid();
+        }
+        if (ok) {
+            ReferenceT<ReferenceContainer> childRC = child;
+            //Do not go recursive
+            if (childRC.IsValid()) {
+                ok = child->Object::ExportData(data);
+                if (ok) {
+                    ok = data.Write("IsContainer", 1);
+                }
+            }
+            else {
+                //The exported data may change at any time
+                cacheable = false;
+                ok = child->ExportData(data);
+            }
+        }
+        if (ok) {
+            ok = data.MoveToAncestor(1u);
+        }
+    }
+    //Print the closing }
+    if (ok) {
+        ok = data.GetPrinter()->PrintEnd();
+    }
+    return ok;
+}
+
+void HttpObjectBrowser::CacheClear() {
+    for (uint32 i = 0u; i < HTTP_OBJECT_BROWSER_CACHE_SIZE; i++) {
+        cache[i].container = NULL_PTR(const ReferenceContainer *);
+        cache[i].reference = Reference();
+        (void) cache[i].page.SetSize(0LLU);
+        (void) cache[i].eTag.SetSize(0LLU);
+    }
+}
+
 Reference HttpObjectBrowser::FindReference(const char8 * const unmatchedPath) {
     Reference target;
     if (StringHelper::Length(unmatchedPath) > 0u) {
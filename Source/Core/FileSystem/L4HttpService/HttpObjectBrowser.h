@@ -31,13 +31,33 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "FastPollingMutexSem.h"
 #include "HttpDataExportI.h"
 #include "HttpRealmI.h"
+#include "JsonPrinter.h"
+#include "StreamString.h"
+#include "StreamStructuredData.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+
+/**
+ * Number of container listings cached by each HttpObjectBrowser (a power of two).
+ */
+const uint32 HTTP_OBJECT_BROWSER_CACHE_SIZE = 16u;
+
+/**
+ * The path (w.r.t. the HttpObjectBrowser) of the heap statistics, when no object with this name exists in the Root.
+ */
+static const char8 * const HTTP_OBJECT_BROWSER_HEAP_STATISTICS = "HeapStatistics";
+
+/**
+ * The maximum number of heaps listed in the heap statistics.
+ */
+const uint32 HTTP_OBJECT_BROWSER_MAX_HEAPS = 17u;
+
 /**
  * @brief HTTP browsing of any ReferenceContainer.
  *
@@ -58,6 +78,20 @@ namespace MARTe {
  *    - None of the above: reply HttpDataExportI::ReplyNotFound.
  * If GetAsText is called and the path points at any other
  *
+ * The listings of the Root and of the targets that are plain ReferenceContainer instances can be paged with the offset and limit
+ * parameters of the request (e.g. ?offset=100&limit=50). The children keep their index in the container as name and, when paged,
+ * the listing also includes the total NumberOfChildren.
+ *
+ * The listings where all the listed children are ReferenceContainer instances (whose Name and Class are the only exported data)
+ * are cached, until an element is inserted in or removed from the container (see ReferenceContainer::GetChildrenVersion) or
+ * any Object is renamed (see Object::GetNamesVersion). These replies have
+ * an ETag and requests with a matching If-None-Match are replied with 304 (Not Modified). Listings with other objects are
+ * serialised on every request, given that their ExportData may report values that change over time.
+ *
+ * The path HTTP_OBJECT_BROWSER_HEAP_STATISTICS (unless an object with this name exists in the Root) is replied with the
+ * HeapManager::HeapStatistics of every heap and with the most recent HeapManager::RealTimeViolation records (with the call
+ * sites in hexadecimal, to be resolved with e.g. addr2line), see HeapManager::SetRealTimeCheck.
+ *
  * @details The configuration syntax is (names are only given as an example):
  * <pre>
  * +HttpObjectBrowser1 = {
@@ -83,7 +117,7 @@ public:
     virtual ~HttpObjectBrowser();
 
     /**
-     * @brief See ReferenceContainer::Purge.
+     * @brief Releases the cached listings and calls ReferenceContainer::Purge.
      */
     virtual void Purge(ReferenceContainer &purgeList);
 
@@ -132,6 +166,99 @@ private:
      */
     Reference FindTarget(HttpProtocol &protocol);
 
+    /**
+     * @brief Replies with the (cached if possible) listing of a container (see class description).
+     * @param[in] owner the object whose Name and Class are listed before the children.
+     * @param[in] container the container whose children are listed.
+     * @param[in] holder a Reference to the container, if it may be destroyed while this instance exists.
+     * @param[in] protocol the HTTP request.
+     * @return true if the reply was successfully written.
+     */
+    bool ReplyContainer(Object &owner, ReferenceContainer &container, const Reference &holder, HttpProtocol &protocol);
+
+    /**
+     * @brief Replies with the heap statistics and the real-time violations (see class description).
+     * @param[out] data where the statistics are written.
+     * @param[in] protocol the HTTP request.
+     * @return true if the reply was successfully written.
+     */
+    bool ReplyHeapStatistics(StreamStructuredData<JsonPrinter> &data, HttpProtocol &protocol);
+
+    /**
+     * @brief Serialises in JSON the listing of a container.
+     * @param[in] owner the object whose Name and Class are listed before the children.
+     * @param[in] container the container whose children are listed.
+     * @param[in] offset index of the first child to list.
+     * @param[in] limit maximum number of children to list (0 for all).
+     * @param[in] paged if true the total NumberOfChildren is also listed.
+     * @param[out] page where the listing is written.
+     * @param[out] cacheable true if all the listed children are ReferenceContainer instances.
+     * @return true if the listing was successfully written.
+     */
+    bool PrintContainer(Object &owner, ReferenceContainer &container, const uint32 offset, const uint32 limit, const bool paged, StreamString &page,
+                        bool &cacheable) const;
+
+    /**
+     * @brief Releases all the entries of the cache.
+     * @pre cacheMux is locked.
+     */
+    void CacheClear();
+
+    /**
+     * A cached container listing.
+     */
+    struct CacheEntry {
+        /**
+         * The listed container (only compared, never accessed), NULL if the entry is empty.
+         */
+        const ReferenceContainer *container;
+
+        /**
+         * Holds the listed container (unless it is the Root), so that its address cannot be reused while the entry exists.
+         */
+        Reference reference;
+
+        /**
+         * The ReferenceContainer::GetChildrenVersion() of the container when the listing was serialised.
+         */
+        uint32 childrenVersion;
+
+        /**
+         * The offset of the listing.
+         */
+        uint32 offset;
+
+        /**
+         * The limit of the listing.
+         */
+        uint32 limit;
+
+        /**
+         * The serialised listing.
+         */
+        StreamString page;
+
+        /**
+         * The ETag of the listing.
+         */
+        StreamString eTag;
+    };
+
+    /**
+     * The cached listings.
+     */
+    CacheEntry cache[HTTP_OBJECT_BROWSER_CACHE_SIZE];
+
+    /**
+     * The Object::GetNamesVersion() for which the cache entries are valid.
+     */
+    uint32 cacheNamesVersion;
+
+    /**
+     * Protects the cache.
+     */
+    FastPollingMutexSem cacheMux;
+
     /**
      * The realm associated to this browser.
      */
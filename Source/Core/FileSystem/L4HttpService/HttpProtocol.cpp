@@ -38,6 +38,53 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace {
+
+/**
+ * The number of characters kept of a chunk size (or trailer) line.
+ */
+const MARTe::uint32 HTTP_CHUNK_LINE_SIZE = 32u;
+
+/**
+ * @brief Parses the hexadecimal size at the beginning of a chunk size line (i.e. before any chunk extension).
+ */
+bool ParseChunkSize(const MARTe::char8 * const line,
+                    MARTe::uint32 &chunkSize) {
+    using namespace MARTe;
+    chunkSize = 0u;
+    uint32 nDigits = 0u;
+    bool ret = true;
+    bool done = false;
+    while ((ret) && (!done)) {
+        char8 c = line[nDigits];
+        uint32 digit = 0u;
+        if ((c >= '0') && (c <= '9')) {
+            digit = static_cast<uint32>(c - '0');
+        }
+        else if ((c >= 'a') && (c <= 'f')) {
+            digit = static_cast<uint32>(c - 'a') + 10u;
+        }
+        else if ((c >= 'A') && (c <= 'F')) {
+            digit = static_cast<uint32>(c - 'A') + 10u;
+        }
+        else {
+            done = true;
+        }
+        if (!done) {
+            //do not overflow the 32 bits
+            ret = (nDigits < 8u);
+            chunkSize = (chunkSize << 4u) | digit;
+            nDigits++;
+        }
+    }
+    if (ret) {
+        ret = (nDigits > 0u);
+    }
+    return ret;
+}
+
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -56,6 +103,8 @@ HttpProtocol::HttpProtocol(DoubleBufferedStream &outputStreamIn) :
     unreadInput = -1;
     textMode = -1;
     isChunked = false;
+    compressionLevel = 0u;
+    compressionMinimumSize = 0u;
 }
 
 /*lint -e{1551} the HttpProtocol must be purged.*/
@@ -143,26 +192,203 @@ bool HttpProtocol::CompleteReadOperation(BufferedStreamI * const streamout, Time
 
 }
 
+bool HttpProtocol::ReadBody(StreamI &bodyOut, const TimeoutType &msecTimeout, const uint32 bufferReadSize) {
+    bool ret = (bufferReadSize > 0u);
+    uint64 maxTicks = 0u;
+    if (msecTimeout.IsFinite()) {
+        maxTicks = HighResolutionTimer::Counter() + msecTimeout.HighResolutionTimerTicks();
+    }
+    char8 *buffer = NULL_PTR(char8 *);
+    if (ret) {
+        buffer = new char8[bufferReadSize];
+    }
+    if (ret) {
+        if (isChunked) {
+            //decode the chunks on the fly: size line, data, CRLF ... zero size line, trailer, empty line
+            char8 line[HTTP_CHUNK_LINE_SIZE];
+            bool done = false;
+            while ((ret) && (!done)) {
+                uint32 chunkSize = 0u;
+                ret = ReadChunkLine(&line[0], HTTP_CHUNK_LINE_SIZE, msecTimeout, maxTicks);
+                if (ret) {
+                    ret = ParseChunkSize(&line[0], chunkSize);
+                    if (!ret) {
+                        REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "Invalid chunk size %s", &line[0]);
+                    }
+                }
+                if (ret) {
+                    if (chunkSize > 0u) {
+                        ret = CopyBody(bodyOut, chunkSize, buffer, bufferReadSize, msecTimeout, maxTicks);
+                        if (ret) {
+                            ret = ReadChunkLine(&line[0], HTTP_CHUNK_LINE_SIZE, msecTimeout, maxTicks);
+                        }
+                        if (ret) {
+                            ret = (line[0] == '\0');
+                            if (!ret) {
+                                REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "Chunk data longer than the chunk size");
+                            }
+                        }
+                    }
+                    else {
+                        //skip the trailer
+                        bool emptyLine = false;
+                        while ((ret) && (!emptyLine)) {
+                            ret = ReadChunkLine(&line[0], HTTP_CHUNK_LINE_SIZE, msecTimeout, maxTicks);
+                            emptyLine = (line[0] == '\0');
+                        }
+                        done = true;
+                    }
+                }
+            }
+        }
+        else if (unreadInput >= 0) {
+            ret = CopyBody(bodyOut, static_cast<uint32>(unreadInput), buffer, bufferReadSize, msecTimeout, maxTicks);
+        }
+        else {
+            //the body ends when the connection is closed
+            bool done = false;
+            while ((ret) && (!done)) {
+                uint32 readSize = bufferReadSize;
+                ret = ReadBodyBytes(buffer, readSize, msecTimeout, maxTicks);
+                done = (readSize == 0u);
+                if ((ret) && (!done)) {
+                    uint32 writeSize = readSize;
+                    ret = bodyOut.Write(buffer, writeSize);
+                    if (ret) {
+                        ret = (writeSize == readSize);
+                    }
+                    if (!ret) {
+                        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed writing the body");
+                    }
+                }
+            }
+        }
+    }
+    if (ret) {
+        unreadInput = 0;
+    }
+    if (buffer != NULL_PTR(char8 *)) {
+        delete[] buffer;
+    }
+    return ret;
+}
+
+void HttpProtocol::SetNoBody() {
+    unreadInput = 0;
+    isChunked = false;
+}
+
+bool HttpProtocol::ReadBodyBytes(char8 * const buffer, uint32 &size, const TimeoutType &msecTimeout, const uint64 maxTicks) {
+    bool ret = true;
+    TimeoutType timeout = msecTimeout;
+    if (msecTimeout.IsFinite()) {
+        uint64 lastCounter = HighResolutionTimer::Counter();
+        ret = (lastCounter < maxTicks);
+        if (ret) {
+            timeout.SetTimeoutHighResolutionTimerTicks(maxTicks - lastCounter);
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::Timeout, "Timeout reading the body");
+        }
+    }
+    if (ret) {
+        if (!outputStream->Read(buffer, size, timeout)) {
+            size = 0u;
+        }
+    }
+    return ret;
+}
+
+bool HttpProtocol::CopyBody(StreamI &bodyOut, uint32 size, char8 * const buffer, const uint32 bufferSize, const TimeoutType &msecTimeout, const uint64 maxTicks) {
+    bool ret = true;
+    while ((ret) && (size > 0u)) {
+        uint32 readSize = size;
+        if (readSize > bufferSize) {
+            readSize = bufferSize;
+        }
+        ret = ReadBodyBytes(buffer, readSize, msecTimeout, maxTicks);
+        if (ret) {
+            ret = (readSize > 0u);
+            if (!ret) {
+                REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "The connection was closed before the end of the body");
+            }
+        }
+        if (ret) {
+            uint32 writeSize = readSize;
+            ret = bodyOut.Write(buffer, writeSize);
+            if (ret) {
+                ret = (writeSize == readSize);
+            }
+            if (!ret) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed writing the body");
+            }
+        }
+        if (ret) {
+            size -= readSize;
+        }
+    }
+    return ret;
+}
+
+bool HttpProtocol::ReadChunkLine(char8 * const line, const uint32 lineSize, const TimeoutType &msecTimeout, const uint64 maxTicks) {
+    bool ret = true;
+    bool done = false;
+    uint32 n = 0u;
+    while ((ret) && (!done)) {
+        //byte by byte from the read buffer, not to read beyond the body
+        char8 c = '\0';
+        uint32 readSize = 1u;
+        ret = ReadBodyBytes(&c, readSize, msecTimeout, maxTicks);
+        if (ret) {
+            ret = (readSize == 1u);
+            if (!ret) {
+                REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "The connection was closed before the end of the body");
+            }
+        }
+        if (ret) {
+            if (c == '\n') {
+                done = true;
+            }
+            else if (c != '\r') {
+                if ((n + 1u) < lineSize) {
+                    line[n] = c;
+                    n++;
+                }
+            }
+            else {
+                //the CR of the CRLF
+            }
+        }
+    }
+    line[n] = '\0';
+    return ret;
+}
+
 bool HttpProtocol::ReadHeader(const uint32 bufferReadSize) {
     /** unknown information length */
     unreadInput = -1;
     lastUpdateTime = HighResolutionTimer::Counter();
+    //discard the commands of the previous message on the same connection
+    textMode = -1;
+    if (MoveToRoot()) {
+        (void) Delete("InputCommands");
+        (void) Delete("InputOptions");
+    }
 
-    StreamString line;
     char8 terminator;
-    // Reads the HTTP command
-    bool ret = outputStream->GetLine(line, false);
-    if (!ret) {
-        REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "Failed reading a line from socket");
+    bool ret = ReceiveHeader();
+    if (ret) {
+        //reusing the memory of the line
+        ret = (headerLine = requestParser.GetStartLine());
     }
     if (ret) {
-        ret = line.Seek(0ull);
+        ret = headerLine.Seek(0ull);
     }
     if (ret) {
         StreamString command;
         //check the arrived command
-        (void) line.GetToken(command, " \r\n\t", terminator, " \r\n\t");
-        ret = RetrieveHttpCommand(command, line);
+        (void) headerLine.GetToken(command, " \r\n\t", terminator, " \r\n\t");
+        ret = RetrieveHttpCommand(command, headerLine);
     }
 
     // if httpCommand is a HttpDefinition::HSHCReply then the version has already been calculated
@@ -170,10 +396,10 @@ bool HttpProtocol::ReadHeader(const uint32 bufferReadSize) {
 
         if (ret) {
             // extract the uri and build a path based n that
-            char8 termChar = BuildUrl(line);
+            char8 termChar = BuildUrl(headerLine);
             if (termChar == '?') {
                 // extracts commands
-                ret = StoreCommands(line);
+                ret = StoreCommands(headerLine);
                 if (ret) {
                     int8 textModeT = textMode;
                     if (!Read("TextMode", textMode)) {
@@ -186,7 +412,7 @@ bool HttpProtocol::ReadHeader(const uint32 bufferReadSize) {
         //store the HTTP version
         if (ret) {
             StreamString version;
-            ret = line.GetToken(version, " \r\n\t", terminator, " \r\n\t");
+            ret = headerLine.GetToken(version, " \r\n\t", terminator, " \r\n\t");
             if (ret) {
                 float32 fVersion = 0.F;
                 //skip HTTP
@@ -205,40 +431,36 @@ bool HttpProtocol::ReadHeader(const uint32 bufferReadSize) {
         }
     }
 
-    if (ret) {
-        ret = StoreInputOptions();
-    }
-
-    StreamString contentType;
     if (ret) {
         // now evaluate options
         // first check what policy to follow: if dataSize is available and connection keep-alive,
         // then do not shut the connection and load only the specified size
         keepAlive = (httpVersion >= 1100u);
-        StreamString connection;
-        if (Read("Connection", connection)) {
-            if (StringHelper::CompareNoCaseSensN(connection.Buffer(), "keep-alive", 10u) == 0) {
+        const char8 *connection = requestParser.GetHeader(HTTP_HEADER_CONNECTION);
+        if (connection != NULL_PTR(const char8 *)) {
+            if (StringHelper::CompareNoCaseSensN(connection, "keep-alive", 10u) == 0) {
                 keepAlive = true;
             }
-            else if (StringHelper::CompareNoCaseSensN(connection.Buffer(), "close", 5u) == 0) {
+            else if (StringHelper::CompareNoCaseSensN(connection, "close", 5u) == 0) {
                 keepAlive = false;
             }
             else {
 
             }
         }
-        if (!Read("Content-Length", unreadInput)) {
-            unreadInput = HttpDefinition::HTTPNoContentLengthSpecified;
+        const char8 *contentLength = requestParser.GetHeader(HTTP_HEADER_CONTENT_LENGTH);
+        bool hasContentLength = (contentLength != NULL_PTR(const char8 *));
+        if (hasContentLength) {
+            hasContentLength = TypeConvert(unreadInput, contentLength);
         }
-
-        if (!Read("Content-Type", contentType)) {
-            contentType = "";
+        if (!hasContentLength) {
+            unreadInput = HttpDefinition::HTTPNoContentLengthSpecified;
         }
 
+        const char8 *encoding = requestParser.GetHeader(HTTP_HEADER_TRANSFER_ENCODING);
         isChunked = false;
-        StreamString encoding;
-        if (Read("Transfer-Encoding", encoding)) {
-            isChunked = (encoding == "chunked");
+        if (encoding != NULL_PTR(const char8 *)) {
+            isChunked = (StringHelper::Compare(encoding, "chunked") == 0);
         }
 
     }
@@ -246,11 +468,12 @@ bool HttpProtocol::ReadHeader(const uint32 bufferReadSize) {
     //write the peer in the configuration
     if (ret) {
         //HTTP 1.1 might require to reply to 100-continue so that the client will continue to send more information
-        StreamString expectStr;
-        if (!Read("Expect", expectStr)) {
-            expectStr = "";
+        const char8 *expect = requestParser.GetHeader(HTTP_HEADER_EXPECT);
+        bool expectContinue = (expect != NULL_PTR(const char8 *));
+        if (expectContinue) {
+            expectContinue = (StringHelper::Compare(expect, "100-continue") == 0);
         }
-        if (expectStr == "100-continue") {
+        if (expectContinue) {
             (void) outputStream->Printf("%s", "HTTP/1.1 100 Continue\r\n");
             (void) outputStream->Flush();
         }
@@ -274,6 +497,12 @@ bool HttpProtocol::ReadHeader(const uint32 bufferReadSize) {
     if (ret) {
         //If it post read the body
         if (httpCommand == HttpDefinition::HSHCPost) {
+            //Only materialised for the POST, which needs it to decode the body
+            StreamString contentType;
+            const char8 *contentTypeValue = requestParser.GetHeader(HTTP_HEADER_CONTENT_TYPE);
+            if (contentTypeValue != NULL_PTR(const char8 *)) {
+                contentType = contentTypeValue;
+            }
             ret = (contentType.Size() > 0u);
             if (!ret) {
                 REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "If using POST the Content-Type MUST be specified");
@@ -298,6 +527,10 @@ bool HttpProtocol::ReadHeader(const uint32 bufferReadSize) {
                     char8 *buffer = new char8[bufferReadSize];
                     while ((unreadInput > 0) && (ret)) {
                         uint32 readSize = bufferReadSize;
+                        //Not beyond the body, which may be followed by the next (pipelined) request
+                        if (readSize > static_cast<uint32>(unreadInput)) {
+                            readSize = static_cast<uint32>(unreadInput);
+                        }
                         ret = outputStream->Read(&buffer[0], readSize);
                         if (!ret) {
                             REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "Failed reading from socket in POST section");
@@ -384,11 +617,45 @@ bool HttpProtocol::WriteHeader(const bool isMessageCompleted, const int32 comman
             ret = CreateAbsolute("OutputOptions");
         }
     }
+    //the complete replies are compressed, unless the payload is already encoded
+    BufferedStreamI *body = payload;
+    StreamString encodedBody;
+    if ((ret) && (isReply) && (isMessageCompleted) && (payload != NULL_PTR(BufferedStreamI*)) && (compressionLevel > 0u)) {
+        StreamString contentEncoding;
+        if (!Read("Content-Encoding", contentEncoding)) {
+            StreamString contentType;
+            (void) Read("Content-Type", contentType);
+            uint32 encoding = GetReplyEncoding(contentType.Buffer(), payload->Size());
+            if (encoding != HTTP_CONTENT_ENCODING_IDENTITY) {
+                ret = EncodePayload(*payload, encoding, encodedBody, bufferWriteSize);
+                if (!ret) {
+                    //sent as it is
+                    encoding = HTTP_CONTENT_ENCODING_IDENTITY;
+                    ret = payload->Seek(0LLU);
+                }
+            }
+            if (ret) {
+                ret = WriteContentEncoding(contentType.Buffer(), encoding);
+            }
+            if ((ret) && (encoding != HTTP_CONTENT_ENCODING_IDENTITY)) {
+                body = &encodedBody;
+                StreamString eTag;
+                if (Read("ETag", eTag)) {
+                    //the same validator is used for all the encodings
+                    if (StringHelper::CompareN(eTag.Buffer(), "W/", 2u) != 0) {
+                        StreamString weakETag = "W/";
+                        weakETag += eTag.Buffer();
+                        ret = Write("ETag", weakETag.Buffer());
+                    }
+                }
+            }
+        }
+    }
     if (ret) {
         if (isMessageCompleted) {
             uint32 payloadSize = 0u;
-            if (payload != NULL_PTR(BufferedStreamI*)) {
-                payloadSize = static_cast<uint32>(payload->Size());
+            if (body != NULL_PTR(BufferedStreamI*)) {
+                payloadSize = static_cast<uint32>(body->Size());
             }
             ret = Write("Content-Length", payloadSize);
         }
@@ -434,8 +701,8 @@ bool HttpProtocol::WriteHeader(const bool isMessageCompleted, const int32 comman
     }
     if (ret) {
         // send out the body
-        if (payload != NULL_PTR(BufferedStreamI*)) {
-            uint32 toWrite = static_cast<uint32>(payload->Size());
+        if (body != NULL_PTR(BufferedStreamI*)) {
+            uint32 toWrite = static_cast<uint32>(body->Size());
             char8 *buff = new char8[bufferWriteSize];
             while (toWrite > 0u) {
                 uint32 wSize = toWrite;
@@ -443,7 +710,7 @@ bool HttpProtocol::WriteHeader(const bool isMessageCompleted, const int32 comman
                     wSize = bufferWriteSize;
                 }
 
-                ret = payload->Read(&buff[0], wSize);
+                ret = body->Read(&buff[0], wSize);
                 if (ret) {
                     ret = outputStream->Write(&buff[0], wSize);
                 }
@@ -530,10 +797,10 @@ char8 HttpProtocol::BuildUrl(StreamString &line) {
             bool ok = true;
             StreamString urlPart;
             char8 saveTerm;
-            //build url and path
-            ret = url.SetSize(0ULL);
+            //build url and path (keeping the memory of the previous request)
+            ret = (url = "");
             if (ret) {
-                ret = path.SetSize(0ULL);
+                ret = (path = "");
             }
             if (ret) {
                 while (ok) {
@@ -612,10 +879,43 @@ bool HttpProtocol::StoreCommands(StreamString &line) {
     return ret;
 }
 
+bool HttpProtocol::ReceiveHeader() {
+    requestParser.Reset();
+    const uint32 MAX_RETRIES = 5u;
+    uint32 nOfRetries = MAX_RETRIES;
+    uint32 state = HTTP_REQUEST_PARSER_INCOMPLETE;
+    bool ret = true;
+    while ((ret) && (state == HTTP_REQUEST_PARSER_INCOMPLETE)) {
+        const char8 *data = NULL_PTR(const char8 *);
+        uint32 available = 0u;
+        ret = outputStream->PeekRead(data, available);
+        if ((ret) && (available > 0u)) {
+            nOfRetries = MAX_RETRIES;
+            uint32 consumed = 0u;
+            state = requestParser.Parse(data, available, consumed);
+            ret = outputStream->Consume(consumed);
+        }
+        else if (requestParser.IsEmpty()) {
+            //Nothing at all was received (e.g. the connection was closed)
+            ret = false;
+        }
+        else {
+            nOfRetries--;
+            ret = (nOfRetries > 0u);
+        }
+    }
+    if (!ret) {
+        REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "Failed reading the header from socket");
+    }
+    else {
+        ret = (state == HTTP_REQUEST_PARSER_COMPLETE);
+    }
+    return ret;
+}
+
 bool HttpProtocol::StoreInputOptions() {
 
     bool ret = MoveToRoot();
-    char8 terminator;
 
     if (ret) {
 //delete existing
@@ -623,55 +923,25 @@ bool HttpProtocol::StoreInputOptions() {
         ret = CreateRelative("InputOptions");
 
     }
+    uint32 numberOfFields = requestParser.GetNumberOfFields();
+    uint32 i;
+    for (i = 0u; (i < numberOfFields) && (ret); i++) {
+        ret = Write(requestParser.GetFieldName(i), requestParser.GetFieldValue(i));
+    }
     if (ret) {
-        bool ok = true;
-        const uint32 MAX_RETRIES = 5u;
-        uint32 nOfRetries = MAX_RETRIES;
-        while (ok) {
-            StreamString line;
-            ret = outputStream->GetLine(line);
-            if (!ret) {
-                nOfRetries--;
-                REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "Failed reading a line from socket");
-            }
-            if (nOfRetries == 0u) {
-                ok = false;
-            }
-
-            if (ret) {
-                nOfRetries = MAX_RETRIES;
-                ok = (line.Size() > 0ull);
-                // parse HTTP Options and add to CDB
-                if (ok) {
-                    ret = line.Seek(0ull);
-                    StreamString key;
-                    StreamString value;
-
-                    if (ret) {
-                        ret = line.GetToken(key, " \t:", terminator);
-                    }
-                    if (ret) {
-                        (void) line.GetToken(value, " \t", terminator);
-                        // any other part separated by spaces add to the token
-                        // use a space as separator
-                        uint64 linePosition = line.Position();
-                        if (line.Size() > linePosition) {
-                            uint32 sizeW = 1u;
-                            char8 space = ' ';
-                            ret = value.Write(&space, sizeW);
-                        }
-                        if (ret) {
-                            (void) line.GetToken(value, "", terminator);
-                            ret = Write(key.Buffer(), value.Buffer());
-                        }
-                    }
-                }
-            }
-        }
+        ret = MoveToRoot();
     }
     return ret;
 }
 
+const char8 *HttpProtocol::GetInputOption(const char8 * const name) const {
+    return requestParser.GetHeader(name);
+}
+
+const char8 *HttpProtocol::GetInputOption(const uint32 headerId) const {
+    return requestParser.GetHeader(headerId);
+}
+
 bool HttpProtocol::HandlePostHeader(StreamString &line, StreamString &content, StreamString &name, StreamString &filename) {
     const char8 *temp = NULL_PTR(const char8 *);
 
@@ -922,19 +1192,45 @@ bool HttpProtocol::SecurityCheck(ReferenceT<HttpRealmI> realm) {
 
     // no valid realm !
     if (realm.IsValid()) {
+        /*lint -e{740} outputStream may be a BasicSocket*/
+        BasicSocket* mySocket = dynamic_cast<BasicSocket *>(outputStream);
+        bool hasSocket = (mySocket != NULL_PTR(BasicSocket*));
+        uint32 ipNumber = 0u;
+        if (hasSocket) {
+            /*lint -e{613} NULL pointer checked*/
+            ipNumber = (mySocket->GetSource()).GetAddressAsNumber();
+        }
+        const char8 *authorisationKey = requestParser.GetHeader(HTTP_HEADER_AUTHORIZATION);
+        HttpSessionTokens &sessionTokens = realm->GetSessionTokens();
+        bool useTokens = ((hasSocket) && (sessionTokens.IsEnabled()));
+        if (useTokens) {
+            //the credentials were already validated when the token was issued
+            StreamString token;
+            if (HttpSessionTokens::GetRequestToken(requestParser.GetHeader(HTTP_HEADER_COOKIE), authorisationKey, token)) {
+                ret = sessionTokens.Validate(token.Buffer(), ipNumber);
+            }
+        }
         // get key. on failure exit
-        StreamString authorisationKey;
-        if (MoveAbsolute("InputOptions")) {
-            if (Read("Authorization", authorisationKey)) {
-                /*lint -e{740} outputStream may be a BasicSocket*/
-                BasicSocket* mySocket = dynamic_cast<BasicSocket *>(outputStream);
-                ret = mySocket != NULL_PTR(BasicSocket*);
-                if (ret) {
-                    /*lint -e{613} NULL pointer checked*/
-                    ret = realm->Validate(authorisationKey.Buffer(), httpCommand, (mySocket->GetSource()).GetAddressAsNumber());
+        if ((!ret) && (hasSocket) && (authorisationKey != NULL_PTR(const char8 *))) {
+            ret = realm->Validate(authorisationKey, httpCommand, ipNumber);
+            StreamString token;
+            if ((ret) && (useTokens) && (sessionTokens.Issue(ipNumber, token))) {
+                StreamString cookie;
+                bool ok = cookie.Printf("%s=%s; Max-Age=%u; Path=/; HttpOnly; SameSite=Strict", HTTP_SESSION_TOKEN_COOKIE, token.Buffer(),
+                                        sessionTokens.GetLifetime());
+                if (ok) {
+                    if (!MoveAbsolute("OutputOptions")) {
+                        ok = CreateAbsolute("OutputOptions");
+                    }
+                }
+                if (ok) {
+                    ok = Write("Set-Cookie", cookie.Buffer());
+                }
+                if (!ok) {
+                    //the next request will be validated again
+                    REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed to write the session token");
                 }
             }
-            (void) MoveToAncestor(1u);
         }
     }
     return ret;
@@ -969,6 +1265,82 @@ void HttpProtocol::GetId(StreamString& idOut) const {
     idOut = url;
 }
 
+void HttpProtocol::SetCompression(const uint32 level,
+                                  const uint32 minimumSize) {
+    compressionLevel = level;
+    compressionMinimumSize = minimumSize;
+}
+
+uint32 HttpProtocol::GetCompressionLevel() const {
+    return compressionLevel;
+}
+
+uint32 HttpProtocol::GetReplyEncoding(const char8 * const contentType,
+                                      const uint64 bodySize) const {
+    uint32 encoding = HTTP_CONTENT_ENCODING_IDENTITY;
+    if ((compressionLevel > 0u) && (bodySize >= compressionMinimumSize)) {
+        if (HttpContentEncoder::IsCompressible(contentType)) {
+            encoding = HttpContentEncoder::GetAcceptedEncoding(requestParser.GetHeader(HTTP_HEADER_ACCEPT_ENCODING));
+        }
+    }
+    return encoding;
+}
+
+bool HttpProtocol::WriteContentEncoding(const char8 * const contentType,
+                                        const uint32 encoding) {
+    bool ret = true;
+    if ((compressionLevel > 0u) && (HttpContentEncoder::IsCompressible(contentType))) {
+        ret = Write("Vary", "Accept-Encoding");
+    }
+    if ((ret) && (encoding != HTTP_CONTENT_ENCODING_IDENTITY)) {
+        ret = Write("Content-Encoding", HttpContentEncoder::GetEncodingName(encoding));
+    }
+    return ret;
+}
+
+HttpContentEncoder &HttpProtocol::GetContentEncoder() {
+    return contentEncoder;
+}
+
+bool HttpProtocol::EncodePayload(BufferedStreamI &payload,
+                                 const uint32 encoding,
+                                 StreamString &encoded,
+                                 const uint32 bufferWriteSize) {
+    bool ret = contentEncoder.Start(encoding, compressionLevel);
+    if (ret) {
+        uint32 toRead = static_cast<uint32>(payload.Size());
+        char8 *buff = new char8[bufferWriteSize];
+        while ((ret) && (toRead > 0u)) {
+            uint32 rSize = toRead;
+            if (rSize > bufferWriteSize) {
+                rSize = bufferWriteSize;
+            }
+            ret = payload.Read(&buff[0], rSize);
+            if (ret) {
+                ret = (rSize > 0u);
+            }
+            if (ret) {
+                ret = contentEncoder.Compress(&buff[0], rSize, encoded);
+            }
+            toRead -= rSize;
+        }
+        delete[] buff;
+    }
+    if (ret) {
+        ret = contentEncoder.Finish(encoded);
+    }
+    else {
+        contentEncoder.Reset();
+    }
+    if (ret) {
+        ret = encoded.Seek(0LLU);
+    }
+    if (!ret) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to compress the body");
+    }
+    return ret;
+}
+
 int8 HttpProtocol::TextMode() const {
     return textMode;
 }
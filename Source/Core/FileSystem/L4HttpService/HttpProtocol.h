@@ -33,8 +33,10 @@
 /*---------------------------------------------------------------------------*/
 #include "ConfigurationDatabase.h"
 #include "DoubleBufferedStream.h"
+#include "HttpContentEncoder.h"
 #include "HttpDefinition.h"
 #include "HttpRealmI.h"
+#include "HttpRequestParser.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
@@ -63,25 +65,53 @@ public:
     /**
      * @brief Reads the HTTP header.
      * @details Parses the HTTP header recognising the HTTP, GET, PUT, POST, HEAD commands.
+     * The header is parsed incrementally from the read buffer of the stream by a HttpRequestParser, without allocating
+     * memory for the header fields, which are then available with GetInputOption (or, if needed, as a InputOptions block
+     * with StoreInputOptions).
      * In case of POST command:\n
      *   If the content type is multipart/form-data the data between boundaries is saved into
-     *   variables in InputOptions block. This variables can be accessed also using the
+     *   variables in InputCommands block. This variables can be accessed also using the
      *   GetInputCommand method.\n
      *   If the content type is application/x-www-form-urlencoded the url in the body is decoded
-     *   and also in this case the variables are saved in the InputOptions block.
+     *   and also in this case the variables are saved in the InputCommands block.
      * @param[in] bufferReadSize the size of the buffer to be used in the read operations.
      * @details Use the CompleteReadOperation method to get the unread data of the HTTP message after a
      * ReadHeader call.
+     * @details The same HttpProtocol can be used to read all the messages of a persistent (keep-alive) connection:
+     * the InputOptions and InputCommands of the previous message are discarded and the internal buffers are reused.
      * @return true if the read operation succeeds, false otherwise.
      */
     bool ReadHeader(uint32 bufferReadSize = 1024u);
 
+    /**
+     * @brief Gets a header field of the message read by the last ReadHeader.
+     * @param[in] name the name of the field (case insensitive).
+     * @return the value of the field or NULL if the message does not have it. Valid until the next ReadHeader.
+     */
+    const char8 *GetInputOption(const char8 * const name) const;
+
+    /**
+     * @brief Gets a header field recognised by the HttpRequestParser (in constant time).
+     * @param[in] headerId one of the HTTP_HEADER values.
+     * @return the value of the field or NULL if the message does not have it. Valid until the next ReadHeader.
+     */
+    const char8 *GetInputOption(const uint32 headerId) const;
+
+    /**
+     * @brief Stores all the header fields of the message read by the last ReadHeader in the InputOptions block.
+     * @details Only for the users which need the header as a StructuredDataI, as ReadHeader does not create the block.
+     * @return true if the block is created.
+     */
+    bool StoreInputOptions();
+
 
     /**
      * @brief Writes the HTTP header.
      * @param[in] isMessageCompleted specifies if the message is completed. In this case the Content-Length
      * is computed as the size of the \a payload stream passed in input and the payload is appended to the
-     * header and sent as the HTTP body.
+     * header and sent as the HTTP body. If the message is a reply, the compression is enabled (see SetCompression)
+     * and the OutputOptions have no Content-Encoding, the payload is compressed as negotiated by GetReplyEncoding
+     * (the ETag, if any, is then sent as a weak validator).
      * @param[in] command the HTTP command and can be one of HTTP, GET, PUT, POST, HEAD.
      * @param[in] payload contains the body to be appended to the header. If NULL or empty, only the header will be sent.
      * @param[in] id the url to write in the header if command is not a reply (!=HTTP).
@@ -94,6 +124,52 @@ public:
                              const char8 * const id,
                              uint32 bufferWriteSize = 1024u);
 
+    /**
+     * @brief Sets the compression of the replies.
+     * @param[in] level the compression level (1 to 9, see HttpContentEncoder). 0 disables the compression.
+     * @param[in] minimumSize the replies whose size is known and smaller than this are not compressed.
+     */
+    void SetCompression(const uint32 level,
+                        const uint32 minimumSize);
+
+    /**
+     * @brief Gets the compression level of the replies.
+     * @return the compression level (0 if the compression is disabled).
+     */
+    uint32 GetCompressionLevel() const;
+
+    /**
+     * @brief Chooses the content coding of a reply.
+     * @param[in] contentType the Content-Type of the reply.
+     * @param[in] bodySize the size of the body (0xFFFFFFFFFFFFFFFF if not known, e.g. for the chunked replies).
+     * @return the encoding accepted by the request (see HttpContentEncoder::GetAcceptedEncoding) if the compression is enabled,
+     * the \a contentType is compressible (see HttpContentEncoder::IsCompressible) and the body is not smaller than the minimum
+     * size, HTTP_CONTENT_ENCODING_IDENTITY otherwise.
+     */
+    uint32 GetReplyEncoding(const char8 * const contentType,
+                            const uint64 bodySize) const;
+
+    /**
+     * @brief Writes the header fields related to the content coding of a reply.
+     * @details If the compression is enabled and the \a contentType is compressible writes Vary: Accept-Encoding (as the reply
+     * depends on it also if it is not compressed) and, if \a encoding is not HTTP_CONTENT_ENCODING_IDENTITY, the Content-Encoding.
+     * @param[in] contentType the Content-Type of the reply.
+     * @param[in] encoding the HTTP_CONTENT_ENCODING with which the body is sent.
+     * @return true if the header fields are written.
+     * @pre
+     *   The current node is the OutputOptions block.
+     */
+    bool WriteContentEncoding(const char8 * const contentType,
+                              const uint32 encoding);
+
+    /**
+     * @brief Gets the encoder used to compress the replies.
+     * @details Shared by all the replies of the connection (e.g. also by the HttpChunkedStream), so that the encoder
+     * memory is only allocated once.
+     * @return the encoder.
+     */
+    HttpContentEncoder &GetContentEncoder();
+
     /**
      * @brief Reads the unread data after a ReadHeader call.
      * @param[out] streamout the stream where the unread data will be written.
@@ -105,8 +181,34 @@ public:
                                TimeoutType msecTimeout = TTInfiniteWait,
                                uint32 bufferReadSize = 1024u);
 
+    /**
+     * @brief Reads the body of the message after a ReadHeader call, writing it to \a bodyOut as it is received.
+     * @details Reads exactly the body of the message: the Content-Length bytes, the chunks of a chunked body (Transfer-Encoding: chunked),
+     * which are decoded on the fly (i.e. only the chunk data is written to \a bodyOut and the chunk sizes, extensions and trailer are
+     * discarded), or, if the length of the body is not known, the bytes until the connection is closed. The body is read in blocks of
+     * at most \a bufferReadSize bytes, so that the memory used does not depend on the size of the body, and each block is written
+     * to \a bodyOut before the next is read (e.g. into a File, or into a StreamI which parses it as it arrives).
+     * @param[out] bodyOut the stream where the body is written.
+     * @param[in] msecTimeout the maximum time allowed to read the whole body.
+     * @param[in] bufferReadSize the maximum number of bytes read and written on each operation.
+     * @return true if the whole body is read and written to \a bodyOut, false otherwise.
+     */
+    bool ReadBody(StreamI &bodyOut,
+                  const TimeoutType &msecTimeout = TTInfiniteWait,
+                  const uint32 bufferReadSize = 1024u);
+
+    /**
+     * @brief Declares that the message read by the last ReadHeader has no body, whatever its header says (e.g. the reply to a
+     * HEAD request), so that the next WriteHeader does not wait for it.
+     */
+    void SetNoBody();
+
     /**
      * @brief Performs a security check using the realm passed in input.
+     * @details If the session tokens of the realm are enabled (see HttpRealmI::GetSessionTokens) a request with a valid token
+     * (see HttpSessionTokens::GetRequestToken) is accepted without validating the credentials. Otherwise, once the credentials
+     * are validated by the realm, a new token is issued and written in the OutputOptions as a Set-Cookie header, so that the
+     * realm only validates the credentials again once the token expires.
      * @param[in] realm the realm that implements the security check.
      * @return true if the security check succeeds, false otherwise.
      */
@@ -243,6 +345,32 @@ protected:
      */
     bool isChunked;
 
+    /**
+     * Holds the header line being parsed. Kept as a member so that its memory is reused by all the
+     * messages read by this HttpProtocol.
+     */
+    StreamString headerLine;
+
+    /**
+     * Parses the header of each message read by this HttpProtocol.
+     */
+    HttpRequestParser requestParser;
+
+    /**
+     * Compresses the replies.
+     */
+    HttpContentEncoder contentEncoder;
+
+    /**
+     * The compression level of the replies (0 if disabled).
+     */
+    uint32 compressionLevel;
+
+    /**
+     * The minimum size of a compressed reply.
+     */
+    uint32 compressionMinimumSize;
+
 private:
 
     /**
@@ -267,9 +395,47 @@ private:
     bool StoreOutputOptions();
 
     /**
-     * @brief Called by ReadHeader. Stores the received input options in the InputOptions block.
+     * @brief Called by ReadHeader. Feeds the requestParser from the read buffer of the stream until the end of the header.
+     * @return false if the stream fails before the end of the header or if the header cannot be parsed.
      */
-    bool StoreInputOptions();
+    bool ReceiveHeader();
+
+    /**
+     * @brief Called by WriteHeader. Compresses the payload into \a encoded.
+     */
+    bool EncodePayload(BufferedStreamI &payload,
+                       const uint32 encoding,
+                       StreamString &encoded,
+                       const uint32 bufferWriteSize);
+
+    /**
+     * @brief Called by ReadBody. Reads up to \a size bytes of the body before the time \a maxTicks.
+     * @details \a size is set to the number of bytes read, which is 0 if the connection is closed.
+     * @return false if the time allowed to read the body is elapsed.
+     */
+    bool ReadBodyBytes(char8 * const buffer,
+                       uint32 &size,
+                       const TimeoutType &msecTimeout,
+                       const uint64 maxTicks);
+
+    /**
+     * @brief Called by ReadBody. Copies \a size bytes of the body to \a bodyOut.
+     */
+    bool CopyBody(StreamI &bodyOut,
+                  uint32 size,
+                  char8 * const buffer,
+                  const uint32 bufferSize,
+                  const TimeoutType &msecTimeout,
+                  const uint64 maxTicks);
+
+    /**
+     * @brief Called by ReadBody. Reads a line of a chunked body (chunk size or trailer), keeping at most \a lineSize - 1 characters
+     * without the CRLF.
+     */
+    bool ReadChunkLine(char8 * const line,
+                       const uint32 lineSize,
+                       const TimeoutType &msecTimeout,
+                       const uint64 maxTicks);
 
     /**
      * @brief Called by ReadHeader. Recognises the content-type and calls the relative
@@ -31,6 +31,7 @@
 
 #include "AdvancedErrorManagement.h"
 #include "CLASSMETHODREGISTER.h"
+#include "HighResolutionTimer.h"
 #include "HttpProtocol.h"
 #include "HttpRealmI.h"
 #include "HttpService.h"
@@ -41,6 +42,38 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Maximum size of a request header that is accumulated in reactor mode (the largest header that HttpProtocol can parse).
+ */
+const MARTe::uint32 HTTP_SERVICE_REACTOR_MAX_HEADER_SIZE = MARTe::HTTP_REQUEST_PARSER_MAX_SIZE;
+
+/**
+ * Size of the read buffer of the connections. The request headers are parsed directly in this buffer (see HttpProtocol::ReadHeader),
+ * so that it is large enough to receive a typical header with a single read.
+ */
+const MARTe::uint32 HTTP_SERVICE_READ_BUFFER_SIZE = 1024u;
+
+/**
+ * Maximum number of events handled by a reactor thread in each cycle.
+ */
+const MARTe::uint32 HTTP_SERVICE_REACTOR_EVENTS_PER_WAIT = 16u;
+
+/**
+ * @brief Replies with HttpDefinition::HSHCReplyTooManyRequests.
+ * @param[in] client the connection to be rejected.
+ */
+void HttpServiceRejectClient(MARTe::HttpChunkedStream &client) {
+    using namespace MARTe;
+    HttpProtocol hprotocol(client);
+    StreamString s;
+    (void) s.SetSize(0LLU);
+    if (!hprotocol.WriteHeader(false, HttpDefinition::HSHCReplyTooManyRequests, &s, NULL_PTR(const char8*))) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Too many connections");
+    }
+    REPORT_ERROR_STATIC(ErrorManagement::Warning, "Too many connections");
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -55,6 +88,14 @@ HttpService::HttpService() :
     listenMaxConnections = 0;
     textMode = 1u;
     chunkSize = 0u;
+    cork = 0u;
+    reactorThreads = 0u;
+    reactorMaxConnections = 1024u;
+    reactorPoller = NULL_PTR(EventPoller *);
+    reactorNextIdleCheck = 0u;
+    idleTimeout = 0u;
+    compressionLevel = 0u;
+    compressionMinimumSize = 0u;
     filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -70,11 +111,33 @@ HttpService::~HttpService() {
         REPORT_ERROR(ErrorManagement::Warning, "Could not Stop. Going to kill the service");
         (void) Stop();
     }
+    HttpServiceConnection *client;
+    while (reactorClients.Extract(0u, client)) {
+        (void) client->Close();
+        delete client;
+    }
+    if (reactorPoller != NULL_PTR(EventPoller *)) {
+        delete reactorPoller;
+    }
 }
 
 bool HttpService::Initialise(StructuredDataI &data) {
-    //Cannot have more than one thread listening for the request.
-    bool ret = data.Write("MinNumberOfThreads", 1);
+    if (!data.Read("ReactorThreads", reactorThreads)) {
+        reactorThreads = 0u;
+    }
+    bool ret;
+    if (reactorThreads > 0u) {
+        //The reactor threads share the EventPoller and never request new threads.
+        ret = data.Write("MinNumberOfThreads", reactorThreads);
+        if (ret) {
+            ret = data.Write("MaxNumberOfThreads", reactorThreads + 1u);
+        }
+        (void) data.Read("ReactorMaxConnections", reactorMaxConnections);
+    }
+    else {
+        //Cannot have more than one thread listening for the request.
+        ret = data.Write("MinNumberOfThreads", 1);
+    }
     if (ret) {
         ret = MultiClientService::Initialise(data);
     }
@@ -99,8 +162,24 @@ bool HttpService::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::Information, "IsTextMode unspecified: using default %d", textMode);
         }
         if (!data.Read("ChunkSize", chunkSize)) {
-            chunkSize = 32u;
-            REPORT_ERROR(ErrorManagement::Information, "ChunkSize not specified: using default %d", chunkSize);
+            chunkSize = 0u;
+            REPORT_ERROR(ErrorManagement::Information, "ChunkSize not specified: adapting it to the socket send buffer");
+        }
+        if (!data.Read("Cork", cork)) {
+            cork = 0u;
+        }
+        if (!data.Read("IdleTimeout", idleTimeout)) {
+            idleTimeout = 0u;
+        }
+        if (!data.Read("CompressionLevel", compressionLevel)) {
+            compressionLevel = 0u;
+        }
+        if (!data.Read("CompressionMinimumSize", compressionMinimumSize)) {
+            compressionMinimumSize = 1024u;
+        }
+        if (compressionLevel > 9u) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The CompressionLevel shall be <= 9");
+            ret = false;
         }
         Reference ref = this->Find("WebRoot");
         if (ref.IsValid()) {
@@ -136,6 +215,15 @@ ErrorManagement::ErrorType HttpService::Start() {
         if (err.ErrorsCleared()) {
             err = !(server.Listen(port, listenMaxConnections));
 
+            if ((err.ErrorsCleared()) && (reactorThreads > 0u)) {
+                if (reactorPoller == NULL_PTR(EventPoller *)) {
+                    reactorPoller = new EventPoller(HTTP_SERVICE_REACTOR_EVENTS_PER_WAIT);
+                }
+                err = !(reactorPoller->Add(server, EventPollerRead | EventPollerOneShot, &server));
+                if (!err.ErrorsCleared()) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Failed to register the server socket in the reactor");
+                }
+            }
             if (err.ErrorsCleared()) {
                 err = MultiClientService::Start();
             }
@@ -144,7 +232,7 @@ ErrorManagement::ErrorType HttpService::Start() {
     return err;
 }
 
-ErrorManagement::ErrorType HttpService::ClientService(HttpChunkedStream * const commClient) const {
+ErrorManagement::ErrorType HttpService::ClientService(HttpServiceConnection * const commClient) const {
     ErrorManagement::ErrorType err = !(commClient == NULL);
 
     if (err.ErrorsCleared()) {
@@ -152,55 +240,38 @@ ErrorManagement::ErrorType HttpService::ClientService(HttpChunkedStream * const
     }
     Select sel;
     if (err.ErrorsCleared()) {
-        commClient->SetChunkMode(false);
         err = !(sel.AddReadHandle(*commClient));
     }
     //give the possibility to stop the thread
     if (err.ErrorsCleared()) {
-        uint8 requestedTextMode = textMode;
-        HttpProtocol hprotocol(*commClient);
-        if (sel.WaitUntil(1000u) > 0) {
-            //you want plain text or data
-            if (!hprotocol.ReadHeader()) {
-                err = ErrorManagement::CommunicationError;
-                REPORT_ERROR(ErrorManagement::CommunicationError, "Error while reading HTTP header");
+        bool keepAlive = true;
+        //pipelined requests might already be buffered
+        bool requestReady = commClient->HasBufferedInput();
+        if (!requestReady) {
+            requestReady = (sel.WaitUntil(1000u) > 0);
+            if (requestReady) {
+                //readable but with nothing to read means that the client has closed the connection
+                char8 c;
+                uint32 size = 1u;
+                keepAlive = commClient->Peek(&c, size);
+                requestReady = keepAlive;
             }
-            bool pagePrepared = false;
-
-            if (err.ErrorsCleared()) {
-                if (hprotocol.TextMode() >= 0) {
-                    requestedTextMode = static_cast<uint8>(hprotocol.TextMode());
+            else if (idleTimeout > 0u) {
+                uint64 idleTicks = (HighResolutionTimer::Counter() - commClient->GetLastActivity());
+                keepAlive = ((idleTicks * 1000ULL) < (static_cast<uint64>(idleTimeout) * HighResolutionTimer::Frequency()));
+                if (!keepAlive) {
+                    REPORT_ERROR(ErrorManagement::Information, "Closing idle connection");
                 }
             }
-            if (err.ErrorsCleared()) {
-                if (!hprotocol.MoveAbsolute("OutputOptions")) {
-                    err = !(hprotocol.CreateAbsolute("OutputOptions"));
-                }
-                if (requestedTextMode > 0u) {
-                    pagePrepared = webRoot->GetAsText(*commClient, hprotocol);
-                }
-                else {
-                    StreamStructuredData<JsonPrinter> sdata;
-                    sdata.SetStream(*commClient);
-                    pagePrepared = webRoot->GetAsStructuredData(sdata, hprotocol);
-                }
-                if (err.ErrorsCleared()) {
-                    err = !(commClient->Flush());
-                }
-                if (err.ErrorsCleared()) {
-                    if (commClient->IsChunkMode()) {
-                        err = !(commClient->FinalChunk());
-                    }
-                }
-            }
-            if (err.ErrorsCleared()) {
-                if (!pagePrepared) {
-                    //TODO??
-                }
+            else {
+                //no request yet
             }
         }
+        if (requestReady) {
+            err = ServeRequest(commClient, keepAlive);
+        }
         if (err.ErrorsCleared()) {
-            if (!hprotocol.KeepAlive()) {
+            if (!keepAlive) {
                 REPORT_ERROR(ErrorManagement::Information, "Connection closed");
                 err = !(commClient->Close());
                 if (err.ErrorsCleared()) {
@@ -222,6 +293,236 @@ ErrorManagement::ErrorType HttpService::ClientService(HttpChunkedStream * const
 
 }
 
+ErrorManagement::ErrorType HttpService::ServeRequest(HttpServiceConnection * const commClient,
+                                                     bool &keepAlive) const {
+    ErrorManagement::ErrorType err;
+    uint8 requestedTextMode = textMode;
+    //the protocol (and its buffers) is reused by all the requests of the connection
+    HttpProtocol &hprotocol = commClient->GetProtocol();
+    commClient->SetChunkMode(false);
+    commClient->UpdateLastActivity();
+    hprotocol.SetCompression(compressionLevel, compressionMinimumSize);
+    //you want plain text or data
+    if (!hprotocol.ReadHeader()) {
+        err = ErrorManagement::CommunicationError;
+        REPORT_ERROR(ErrorManagement::CommunicationError, "Error while reading HTTP header");
+    }
+    bool pagePrepared = false;
+    bool corked = false;
+    if ((err.ErrorsCleared()) && (cork > 0u)) {
+        //the header and the body leave in full segments
+        corked = commClient->SetCork(true);
+    }
+
+    if (err.ErrorsCleared()) {
+        if (hprotocol.TextMode() >= 0) {
+            requestedTextMode = static_cast<uint8>(hprotocol.TextMode());
+        }
+    }
+    if (err.ErrorsCleared()) {
+        //the reply options of the previous request on the same connection shall not be sent again
+        err = !(hprotocol.MoveToRoot());
+        if (err.ErrorsCleared()) {
+            (void) hprotocol.Delete("OutputOptions");
+            err = !(hprotocol.CreateAbsolute("OutputOptions"));
+        }
+        if ((err.ErrorsCleared()) && (idleTimeout > 0u) && (hprotocol.KeepAlive())) {
+            //tell the client when an unused connection will be closed
+            StreamString keepAliveOption;
+            err = !(keepAliveOption.Printf("timeout=%u", (idleTimeout / 1000u)));
+            if (err.ErrorsCleared()) {
+                err = !(hprotocol.Write("Keep-Alive", keepAliveOption.Buffer()));
+            }
+        }
+    }
+    if (err.ErrorsCleared()) {
+        if (requestedTextMode > 0u) {
+            pagePrepared = webRoot->GetAsText(*commClient, hprotocol);
+        }
+        else {
+            StreamStructuredData<JsonPrinter> sdata;
+            sdata.SetStream(*commClient);
+            pagePrepared = webRoot->GetAsStructuredData(sdata, hprotocol);
+        }
+        if (err.ErrorsCleared()) {
+            err = !(commClient->Flush());
+        }
+        if (err.ErrorsCleared()) {
+            if (commClient->IsChunkMode()) {
+                err = !(commClient->FinalChunk());
+            }
+        }
+    }
+    if (corked) {
+        //send at once the last partial segment
+        (void) commClient->SetCork(false);
+    }
+    if (err.ErrorsCleared()) {
+        if (!pagePrepared) {
+            //TODO??
+        }
+    }
+    keepAlive = hprotocol.KeepAlive();
+    return err;
+}
+
+uint32 HttpService::GetInitialChunkSize() const {
+    uint32 initialChunkSize = chunkSize;
+    if (initialChunkSize == 0u) {
+        initialChunkSize = HTTP_CHUNKED_STREAM_MIN_CHUNK_SIZE;
+    }
+    return initialChunkSize;
+}
+
+ErrorManagement::ErrorType HttpService::ReactorCycle() {
+    ErrorManagement::ErrorType err = ErrorManagement::Timeout;
+    int32 nOfEvents = reactorPoller->WaitUntil(acceptTimeout);
+    int32 i;
+    for (i = 0; i < nOfEvents; i++) {
+        void *userData = reactorPoller->GetEventUserData(static_cast<uint32>(i));
+        if (userData == &server) {
+            ReactorAccept();
+        }
+        else {
+            ReactorService(reinterpret_cast<HttpServiceConnection *>(userData), reactorPoller->GetEvents(static_cast<uint32>(i)));
+        }
+    }
+    if (idleTimeout > 0u) {
+        uint64 idleTicks = ((static_cast<uint64>(idleTimeout) * HighResolutionTimer::Frequency()) / 1000ULL);
+        uint64 now = HighResolutionTimer::Counter();
+        if (reactorClientsSem.FastLock() == ErrorManagement::NoError) {
+            if (now >= reactorNextIdleCheck) {
+                reactorNextIdleCheck = now + (idleTicks / 2ULL);
+                uint32 n = reactorClients.GetSize();
+                for (i = 0; static_cast<uint32>(i) < n; i++) {
+                    HttpServiceConnection *c = NULL_PTR(HttpServiceConnection *);
+                    if (reactorClients.Peek(static_cast<uint32>(i), c)) {
+                        if ((now - c->GetLastActivity()) > idleTicks) {
+                            //The descriptor is not released here (the connection might be handled by another thread):
+                            //the hang-up wakes up the EventPoller and the connection is closed by ReactorService.
+                            REPORT_ERROR(ErrorManagement::Information, "Closing idle connection");
+                            (void) c->Shutdown();
+                            //do not shut it down again before the hang-up is handled
+                            c->UpdateLastActivity();
+                        }
+                    }
+                }
+            }
+            reactorClientsSem.FastUnLock();
+        }
+    }
+    return err;
+}
+
+void HttpService::ReactorAccept() {
+    HttpServiceConnection *newClient = new HttpServiceConnection();
+    newClient->SetChunkMode(false);
+    newClient->SetCalibWriteParam(0u);
+    bool ok = newClient->SetBufferSize(HTTP_SERVICE_READ_BUFFER_SIZE, GetInitialChunkSize());
+    if (ok) {
+        ok = (server.WaitConnection(acceptTimeout, newClient) != NULL);
+    }
+    if ((ok) && (chunkSize == 0u)) {
+        //keeps the initial size if the send buffer cannot be read
+        (void) newClient->AdaptChunkSize();
+    }
+    if (ok) {
+        bool full = true;
+        if (reactorClientsSem.FastLock() == ErrorManagement::NoError) {
+            full = (reactorClients.GetSize() >= reactorMaxConnections);
+            if (!full) {
+                full = !reactorClients.Add(newClient);
+            }
+            reactorClientsSem.FastUnLock();
+        }
+        if (full) {
+            HttpServiceRejectClient(*newClient);
+            (void) newClient->Close();
+            delete newClient;
+        }
+        else {
+            ok = newClient->SetBlocking(false);
+            if (ok) {
+                ok = reactorPoller->Add(*newClient, EventPollerRead | EventPollerOneShot, newClient);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::OSError, "Failed to register the client connection in the reactor");
+                ReactorClose(newClient, false);
+            }
+        }
+    }
+    else {
+        delete newClient;
+    }
+    //Re-arm the server socket (it is one shot so that a single thread accepts each connection)
+    if (!reactorPoller->Modify(server, EventPollerRead | EventPollerOneShot, &server)) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to re-arm the server socket in the reactor");
+    }
+}
+
+void HttpService::ReactorService(HttpServiceConnection * const client,
+                                 const uint32 events) {
+    bool keep = ((events & EventPollerError) == 0u);
+    bool hangUp = ((events & EventPollerHangUp) != 0u);
+    if (keep) {
+        uint32 received = client->Prefetch(HTTP_SERVICE_REACTOR_MAX_HEADER_SIZE);
+        if (client->IsHeaderPrefetched()) {
+            //The header is complete: parse and serve it in blocking mode, as in ClientService
+            keep = client->SetBlocking(true);
+            bool more = keep;
+            while (more) {
+                ErrorManagement::ErrorType err = ServeRequest(client, keep);
+                keep = (keep) && (err.ErrorsCleared());
+                //Serve the pipelined requests that were already received
+                more = (keep) && (client->HasBufferedInput());
+            }
+            keep = (keep) && (!hangUp);
+            if (keep) {
+                keep = client->SetBlocking(false);
+            }
+        }
+        else if (client->GetPrefetchedSize() >= HTTP_SERVICE_REACTOR_MAX_HEADER_SIZE) {
+            REPORT_ERROR(ErrorManagement::CommunicationError, "HTTP header too large");
+            keep = false;
+        }
+        else {
+            //Wait for the rest of the header unless the client is gone (readable with nothing to read)
+            keep = (!hangUp) && (received > 0u);
+        }
+    }
+    if (keep) {
+        keep = reactorPoller->Modify(*client, EventPollerRead | EventPollerOneShot, client);
+    }
+    if (!keep) {
+        ReactorClose(client, true);
+    }
+}
+
+void HttpService::ReactorClose(HttpServiceConnection * const client,
+                               const bool registered) {
+    //first remove it from the list so that the idle check no longer uses it
+    if (reactorClientsSem.FastLock() == ErrorManagement::NoError) {
+        uint32 n = reactorClients.GetSize();
+        bool found = false;
+        uint32 i;
+        for (i = 0u; (i < n) && (!found); i++) {
+            HttpServiceConnection *c = NULL_PTR(HttpServiceConnection *);
+            if (reactorClients.Peek(i, c)) {
+                found = (c == client);
+                if (found) {
+                    (void) reactorClients.Remove(i);
+                }
+            }
+        }
+        reactorClientsSem.FastUnLock();
+    }
+    if (registered) {
+        (void) reactorPoller->Remove(*client);
+    }
+    (void) client->Close();
+    delete client;
+}
+
 ErrorManagement::ErrorType HttpService::ServerCycle(MARTe::ExecutionInfo &information) {
     ErrorManagement::ErrorType err;
     if (information.GetStage() == MARTe::ExecutionInfo::StartupStage) {
@@ -229,27 +530,28 @@ ErrorManagement::ErrorType HttpService::ServerCycle(MARTe::ExecutionInfo &inform
     if (information.GetStage() == MARTe::ExecutionInfo::MainStage) {
 
         /*lint -e{593} -e{429} the newClient pointer will be freed within the thread*/
-        if (information.GetStageSpecific() == MARTe::ExecutionInfo::WaitRequestStageSpecific) {
+        if ((information.GetStageSpecific() == MARTe::ExecutionInfo::WaitRequestStageSpecific) && (reactorThreads > 0u)) {
+            err = ReactorCycle();
+        }
+        else if (information.GetStageSpecific() == MARTe::ExecutionInfo::WaitRequestStageSpecific) {
             /*lint -e{429} the newClient pointer will be freed within the thread*/
-            HttpChunkedStream *newClient = new HttpChunkedStream();
+            HttpServiceConnection *newClient = new HttpServiceConnection();
             newClient->SetChunkMode(false);
             newClient->SetCalibWriteParam(0u);
-            err = !(newClient->SetBufferSize(32u, chunkSize));
+            err = !(newClient->SetBufferSize(HTTP_SERVICE_READ_BUFFER_SIZE, GetInitialChunkSize()));
             if (err.ErrorsCleared()) {
                 if (server.WaitConnection(acceptTimeout, newClient) == NULL) {
                     err = MARTe::ErrorManagement::Timeout;
                     delete newClient;
                 }
                 else {
+                    if (chunkSize == 0u) {
+                        //keeps the initial size if the send buffer cannot be read
+                        (void) newClient->AdaptChunkSize();
+                    }
                     if (GetNumberOfActiveThreads() == GetMaximumNumberOfPoolThreads()) {
                         err = MARTe::ErrorManagement::Timeout;
-                        HttpProtocol hprotocol(*newClient);
-                        StreamString s;
-                        (void) s.SetSize(0LLU);
-                        if (!hprotocol.WriteHeader(false, HttpDefinition::HSHCReplyTooManyRequests, &s, NULL_PTR(const char8*))) {
-                            REPORT_ERROR(ErrorManagement::FatalError, "Too many connections");
-                        }
-                        REPORT_ERROR(ErrorManagement::Warning, "Too many connections");
+                        HttpServiceRejectClient(*newClient);
                         (void) newClient->Close();
                         delete newClient;
                     }
@@ -261,7 +563,7 @@ ErrorManagement::ErrorType HttpService::ServerCycle(MARTe::ExecutionInfo &inform
             }
         }
         if (information.GetStageSpecific() == MARTe::ExecutionInfo::ServiceRequestStageSpecific) {
-            HttpChunkedStream *newClient = reinterpret_cast<HttpChunkedStream *>(information.GetThreadSpecificContext());
+            HttpServiceConnection *newClient = reinterpret_cast<HttpServiceConnection *>(information.GetThreadSpecificContext());
             err = ClientService(newClient);
         }
     }
@@ -273,6 +575,10 @@ uint16 HttpService::GetPort() const {
     return port;
 }
 
+uint32 HttpService::GetIdleTimeout() const {
+    return idleTimeout;
+}
+
 int32 HttpService::GetMaxConnections() const {
     return listenMaxConnections;
 }
@@ -281,6 +587,19 @@ ReferenceT<HttpDataExportI> HttpService::GetWebRoot() const {
     return webRoot;
 }
 
+uint32 HttpService::GetReactorThreads() const {
+    return reactorThreads;
+}
+
+uint32 HttpService::GetNumberOfReactorConnections() {
+    uint32 n = 0u;
+    if (reactorClientsSem.FastLock() == ErrorManagement::NoError) {
+        n = reactorClients.GetSize();
+        reactorClientsSem.FastUnLock();
+    }
+    return n;
+}
+
 CLASS_REGISTER(HttpService, "1.0")
 CLASS_METHOD_REGISTER(HttpService, Start)
 }
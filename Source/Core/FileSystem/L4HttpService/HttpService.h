@@ -32,13 +32,15 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "EmbeddedServiceMethodBinderT.h"
+#include "EventPoller.h"
 #include "FastPollingMutexSem.h"
-#include "HttpChunkedStream.h"
 #include "HttpDataExportI.h"
+#include "HttpServiceConnection.h"
 #include "MessageI.h"
 #include "MultiClientService.h"
 #include "ReferenceT.h"
 #include "RegisteredMethodsMessageFilter.h"
+#include "StaticList.h"
 #include "StreamString.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -64,6 +66,17 @@ namespace MARTe{
  * TextMode=0. In this second case a StructuredDataStream<JsonPrinter> is passed in input to the DatExportI::GetAsStructuredData
  * in order to send to the client data written in json language.
  *
+ * @details If ReactorThreads > 0 the service runs in reactor mode instead: a fixed pool of ReactorThreads threads
+ * multiplexes all the connections with an EventPoller. The bytes of a request are accumulated as they arrive
+ * (see HttpChunkedStream::Prefetch) and the request is only parsed by the HttpProtocol, and served, once its header
+ * is complete. Idle (keep-alive) connections are thus not bound to any thread and only cost the socket and its buffers.
+ * Requests that were pipelined by the client (i.e. already received) are served in sequence by the same thread.
+ *
+ * @details In both modes the connections are persistent (unless the client asks for Connection: close or uses HTTP/1.0):
+ * all the requests of a connection are parsed by the same HttpProtocol (see HttpServiceConnection), pipelined requests
+ * are served without waiting for more data and, if IdleTimeout > 0, a connection that does not send any request for
+ * IdleTimeout milliseconds is closed by the server.
+ *
  * @details The HttpService replies to the client always using the HTTP chunked transfer encoding. This allows to stream out
  * data to the socket without knowing a priori the full length of the HTTP message body. This allows to avoid having to store the
  * whole body in memory before sending it.
@@ -79,9 +92,20 @@ namespace MARTe{
  *     ListenMaxConnections = 255 //Compulsory. The maximum number of HTTP connections.
  *     WebRoot = ARoot //Compulsory. Path in the ObjectConfigurationDatabase of the object that acts as the root for the service. This object shall inherit from HttpDataExportI.
  *     IsTextMode = 1 //Optional (default = 1). If the GET option TextMode is not set, the reply is either sent as text/html (IsTextMode = 1) or as text/json (IsTextMode = 0). With the former GetAsText is called on the web root object, while with the latter GetAsStructuredData is called instead.
- *     ChunkSize = 32 //Optional (default = 32). The maximum size of the chunks in which the reply bode is divided to perform the chunked transfer encoding mode.
+ *     ChunkSize = 0 //Optional (default = 0). The maximum size of the chunks in which the reply bode is divided to perform the chunked transfer encoding mode. If 0 it is adapted to the send buffer of each connection (see HttpChunkedStream::AdaptChunkSize).
+ *     Cork = 1 //Optional (default = 0). If 1 the socket is corked while each reply is written (see BasicTCPSocket::SetCork), so that the header and the body leave in full segments.
+ *     ReactorThreads = 2 //Optional (default = 0). If > 0 the service runs in reactor mode with this number of threads (MinNumberOfThreads and MaxNumberOfThreads are then ignored).
+ *     ReactorMaxConnections = 1024 //Optional (default = 1024). Only in reactor mode. The maximum number of simultaneous client connections.
+ *     IdleTimeout = 30000 //Optional (default = 0, i.e. never). Time in milliseconds after which a connection without requests is closed.
+ *     CompressionLevel = 6 //Optional (default = 0, i.e. disabled). The deflate level (1 to 9) of the compressed replies.
+ *     CompressionMinimumSize = 1024 //Optional (default = 1024). The minimum size in bytes of a reply body to be compressed.
  * }
  * </pre>
+ *
+ * @details If CompressionLevel > 0 the text, JSON, JavaScript and XML replies are compressed with gzip or deflate when the
+ * client accepts it (see HttpProtocol::GetReplyEncoding). The compression is performed by the threads of the service, never by
+ * the real-time threads. The chunked replies (whose size is not known) are always compressed, while the event streams
+ * (see HttpSignalStream) are never compressed, so that each event is delivered as soon as it is written.
  */
 class HttpService: public MultiClientService, public MessageI {
 public:
@@ -109,7 +133,14 @@ public:
      *     by the clients.
      *   IsTextMode: The default data sending mode. A client can change this mode by sending the HTTP command called TextMode=[0(false), 1(true)].
      *     Default=1 (text mode).
-     *   ChunkSize: the maximum size of the chunks in which the reply bode is divided to perform the chunked transfer encoding mode. Default = 32
+     *   ChunkSize: the maximum size of the chunks in which the reply bode is divided to perform the chunked transfer encoding mode.
+     *     Default = 0 (adapted to the socket send buffer).
+     *   Cork: if 1 the socket is corked while each reply is written. Default = 0.
+     *   ReactorThreads: if > 0 the number of threads of the reactor mode (see class description). Default = 0.
+     *   ReactorMaxConnections: the maximum number of client connections in reactor mode. Default = 1024.
+     *   IdleTimeout: the time in milliseconds after which a persistent connection without new requests is closed. Default = 0 (never).
+     *   CompressionLevel: the compression level of the replies (0 to 9). Default = 0 (no compression).
+     *   CompressionMinimumSize: the minimum size in bytes of a reply body to be compressed. Default = 1024.
      * @return true if all the parameters are set and valid.
      */
     virtual bool Initialise(StructuredDataI &data);
@@ -117,6 +148,7 @@ public:
     /**
      * @see MultiClientService::Start
      * @details Before starting the thread, it finds the root object specified in the \a WebRoot configuration parameter.
+     * In reactor mode the server socket is also registered in the EventPoller.
      * If the path is wrong, ErrorManagement::FatalError is returned.
      */
     virtual ErrorManagement::ErrorType Start();
@@ -135,9 +167,11 @@ public:
      * @details Until the connection is keep alive by the client, the HttpService receives HTTP messages
      * and calls the objects at the paths specified by the client (that must implement a DataExportI interface)
      * to get the required data to be sent as a HTTP reply.
+     * @details Requests which were already received (pipelined) are served without waiting on the socket. The connection
+     * is closed when the client closes it or, if IdleTimeout > 0, when no request is received for IdleTimeout milliseconds.
      * @param[in] commClient is the socket to communicate with the client.
      */
-    ErrorManagement::ErrorType ClientService(HttpChunkedStream * const commClient) const;
+    ErrorManagement::ErrorType ClientService(HttpServiceConnection * const commClient) const;
 
     /**
      * @brief Gets the configured port.
@@ -145,6 +179,12 @@ public:
      */
     uint16 GetPort() const;
 
+    /**
+     * @brief Gets the configured idle timeout.
+     * @return the time in milliseconds after which a connection without requests is closed (0 if never).
+     */
+    uint32 GetIdleTimeout() const;
+
     /**
      * @brief Gets the maximum number of connections.
      * @return the maximum number of connections.
@@ -157,7 +197,64 @@ public:
      */
     ReferenceT<HttpDataExportI> GetWebRoot() const;
 
+    /**
+     * @brief Gets the number of reactor threads.
+     * @return the number of reactor threads (0 if the service is not in reactor mode).
+     */
+    uint32 GetReactorThreads() const;
+
+    /**
+     * @brief Gets the number of client connections currently handled in reactor mode.
+     * @return the number of client connections currently handled in reactor mode.
+     */
+    uint32 GetNumberOfReactorConnections();
+
 private:
+
+    /**
+     * @brief Reads and serves one HTTP request using the HttpProtocol of the connection.
+     * @param[in] commClient is the socket to communicate with the client.
+     * @param[out] keepAlive true if the client requested to keep the connection alive.
+     * @return ErrorManagement::NoError if the request was successfully served.
+     */
+    ErrorManagement::ErrorType ServeRequest(HttpServiceConnection * const commClient,
+                                            bool &keepAlive) const;
+
+    /**
+     * @brief Gets the write buffer size of a new connection, before it is accepted.
+     * @return the ChunkSize or, if the chunk size is adapted once connected, HTTP_CHUNKED_STREAM_MIN_CHUNK_SIZE.
+     */
+    uint32 GetInitialChunkSize() const;
+
+    /**
+     * @brief Waits (up to AcceptTimeout) for events in the reactor EventPoller and handles them.
+     * @details If IdleTimeout > 0 the idle connections are periodically shut down, so that their
+     * hang-up is then handled (and the connection closed) as any other event.
+     * @return ErrorManagement::Timeout so that the MultiClientEmbeddedThread keeps calling it.
+     */
+    ErrorManagement::ErrorType ReactorCycle();
+
+    /**
+     * @brief Accepts a new client connection and registers it in the reactor EventPoller.
+     */
+    void ReactorAccept();
+
+    /**
+     * @brief Handles the events of a client connection in reactor mode.
+     * @param[in] client the client connection.
+     * @param[in] events the events reported by the EventPoller.
+     */
+    void ReactorService(HttpServiceConnection * const client,
+                        const uint32 events);
+
+    /**
+     * @brief Closes and destroys a client connection in reactor mode.
+     * @param[in] client the client connection.
+     * @param[in] registered true if the connection was registered in the EventPoller.
+     */
+    void ReactorClose(HttpServiceConnection * const client,
+                      const bool registered);
+
     /**
      * The server socket
      */
@@ -201,14 +298,64 @@ private:
     TimeoutType acceptTimeout;
 
     /**
-     * The HTTP reply body chunk size.
+     * The HTTP reply body chunk size (0 if adapted to the socket send buffer).
      */
     uint32 chunkSize;
 
+    /**
+     * If 1 the socket is corked while each reply is written.
+     */
+    uint8 cork;
+
+    /**
+     * Time in milliseconds after which a connection without requests is closed (0 if never).
+     */
+    uint32 idleTimeout;
+
+    /**
+     * The compression level of the replies (0 if disabled).
+     */
+    uint32 compressionLevel;
+
+    /**
+     * The minimum size of a reply body to be compressed.
+     */
+    uint32 compressionMinimumSize;
+
     /**
      * Filter to receive the RPC
      */
     ReferenceT<RegisteredMethodsMessageFilter> filter;
+
+    /**
+     * Number of threads in reactor mode (0 if not in reactor mode).
+     */
+    uint32 reactorThreads;
+
+    /**
+     * Maximum number of client connections in reactor mode.
+     */
+    uint32 reactorMaxConnections;
+
+    /**
+     * Multiplexes the server socket and the client connections in reactor mode.
+     */
+    EventPoller *reactorPoller;
+
+    /**
+     * The client connections in reactor mode.
+     */
+    StaticList<HttpServiceConnection *> reactorClients;
+
+    /**
+     * HighResolutionTimer::Counter() value after which the idle reactor connections are checked again.
+     */
+    uint64 reactorNextIdleCheck;
+
+    /**
+     * Protects reactorClients and reactorNextIdleCheck.
+     */
+    FastPollingMutexSem reactorClientsSem;
 };
 
 }
@@ -0,0 +1,66 @@
+/**
+ * @file HttpServiceConnection.cpp
+ * @brief Source file for class HttpServiceConnection
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HttpServiceConnection (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "HighResolutionTimer.h"
+#include "HttpServiceConnection.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/*lint -e{1732} -e{1733} the protocol only stores a reference to this stream*/
+HttpServiceConnection::HttpServiceConnection() :
+        HttpChunkedStream(),
+        protocol(*this) {
+    lastActivity = HighResolutionTimer::Counter();
+}
+
+HttpServiceConnection::~HttpServiceConnection() {
+}
+
+HttpProtocol &HttpServiceConnection::GetProtocol() {
+    return protocol;
+}
+
+void HttpServiceConnection::UpdateLastActivity() {
+    lastActivity = HighResolutionTimer::Counter();
+}
+
+uint64 HttpServiceConnection::GetLastActivity() const {
+    return lastActivity;
+}
+
+}
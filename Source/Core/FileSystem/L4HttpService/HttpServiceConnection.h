@@ -0,0 +1,103 @@
+/**
+ * @file HttpServiceConnection.h
+ * @brief Header file for class HttpServiceConnection
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HttpServiceConnection
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef HTTPSERVICECONNECTION_H_
+#define HTTPSERVICECONNECTION_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "HttpChunkedStream.h"
+#include "HttpProtocol.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A client connection accepted by the HttpService.
+ * @details Holds the HttpProtocol that parses all the requests received on the connection, so that
+ * its buffers are allocated once and reused by every request of a persistent (keep-alive) connection,
+ * together with the time of the last request, which is used to close idle connections.
+ * @see HttpService.
+ */
+class HttpServiceConnection: public HttpChunkedStream {
+
+public:
+
+    /**
+     * @brief Default constructor.
+     * @post
+     *   GetLastActivity() == HighResolutionTimer::Counter() at construction time.
+     */
+    HttpServiceConnection();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~HttpServiceConnection();
+
+    /**
+     * @brief Gets the HttpProtocol that parses the requests received on this connection.
+     * @return the HttpProtocol associated to this connection.
+     */
+    HttpProtocol &GetProtocol();
+
+    /**
+     * @brief Records that a request was received on the connection.
+     * @post
+     *   GetLastActivity() == HighResolutionTimer::Counter()
+     */
+    void UpdateLastActivity();
+
+    /**
+     * @brief Gets the HighResolutionTimer::Counter() value when the last request was received.
+     * @return the counter value when the last request was received.
+     */
+    uint64 GetLastActivity() const;
+
+private:
+
+    /**
+     * The protocol reused by all the requests of this connection.
+     */
+    HttpProtocol protocol;
+
+    /**
+     * The HighResolutionTimer::Counter() value when the last request was received.
+     */
+    uint64 lastActivity;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* HTTPSERVICECONNECTION_H_ */
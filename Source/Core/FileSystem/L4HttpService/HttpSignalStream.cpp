@@ -0,0 +1,352 @@
+/**
+ * @file HttpSignalStream.cpp
+ * @brief Source file for class HttpSignalStream
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HttpSignalStream (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "HttpChunkedStream.h"
+#include "HttpDefinition.h"
+#include "HttpSignalStream.h"
+#include "JsonPrinter.h"
+#include "ObjectRegistryDatabase.h"
+#include "Sleep.h"
+#include "StreamStructuredData.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+/**
+ * Time in nanoseconds after which a comment is sent if there were no events.
+ */
+const MARTe::uint64 HTTP_SIGNAL_STREAM_HEARTBEAT = 1000000000ULL;
+
+/**
+ * @brief Writes a server-sent event with the \a frame data.
+ * @details Each line of the frame is sent as a data field (the client joins them back with new lines).
+ * @param[out] stream where to write the event.
+ * @param[in] frame the event data.
+ * @return true if the event was successfully written.
+ */
+bool HttpSignalStreamWriteEvent(MARTe::BufferedStreamI &stream, MARTe::StreamString &frame) {
+    using namespace MARTe;
+    bool ok = true;
+    const char8 *line = frame.Buffer();
+    const char8 *lineEnd = StringHelper::SearchChar(line, '\n');
+    while ((ok) && (lineEnd != NULL_PTR(const char8 *))) {
+        /*lint -e{9125,946,947} allow for pointers to be subtracted and cast to uint32*/
+        uint32 lineSize = static_cast<uint32>(lineEnd - line);
+        ok = stream.Printf("%s", "data: ");
+        if (ok) {
+            ok = stream.Write(line, lineSize);
+        }
+        if (ok) {
+            ok = stream.Printf("%s", "\n");
+        }
+        line = &lineEnd[1u];
+        lineEnd = StringHelper::SearchChar(line, '\n');
+    }
+    if (ok) {
+        ok = stream.Printf("data: %s\n\n", line);
+    }
+    return ok;
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+HttpSignalStream::HttpSignalStream() :
+        Object(),
+        HttpDataExportI() {
+    period = 100u;
+    maxDuration = 60u;
+}
+
+HttpSignalStream::~HttpSignalStream() {
+
+}
+
+bool HttpSignalStream::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    if (ok) {
+        ok = data.Read("Source", source);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The Source shall be specified");
+        }
+    }
+    if (ok) {
+        if (!data.Read("Period", period)) {
+            period = 100u;
+        }
+        ok = (period > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The Period shall be > 0");
+        }
+    }
+    if (ok) {
+        if (!data.Read("MaxDuration", maxDuration)) {
+            maxDuration = 60u;
+        }
+    }
+    return ok;
+}
+
+uint32 HttpSignalStream::GetPeriod() const {
+    return period;
+}
+
+uint32 HttpSignalStream::GetMaxDuration() const {
+    return maxDuration;
+}
+
+void HttpSignalStream::GetRequestedSignals(HttpProtocol &protocol, StreamString &signals) const {
+    StreamString requested;
+    signals = "";
+    if (protocol.GetInputCommand("Signals", requested)) {
+        if (requested.Size() > 0u) {
+            signals = ",";
+            signals += requested;
+            signals += ",";
+        }
+    }
+}
+
+bool HttpSignalStream::ExportSource(ConfigurationDatabase &values, StreamString &signals) {
+    bool ok = values.MoveToRoot();
+    while ((ok) && (values.GetNumberOfChildren() > 0u)) {
+        StreamString childName = values.GetChildName(0u);
+        ok = values.Delete(childName.Buffer());
+    }
+    ReferenceT<Object> target;
+    if (ok) {
+        target = ObjectRegistryDatabase::Instance()->Find(source.Buffer());
+        ok = target.IsValid();
+    }
+    if (ok) {
+        ok = target->ExportData(values);
+    }
+    if (ok) {
+        ok = values.MoveToRoot();
+    }
+    //Remove the signals that were not requested
+    if ((ok) && (signals.Size() > 0u) && (values.MoveRelative("Signals"))) {
+        uint32 n = values.GetNumberOfChildren();
+        while ((ok) && (n > 0u)) {
+            n--;
+            StreamString signalToken = ",";
+            signalToken += values.GetChildName(n);
+            signalToken += ",";
+            if (StringHelper::SearchString(signals.Buffer(), signalToken.Buffer()) == NULL_PTR(const char8 *)) {
+                StreamString signalName = values.GetChildName(n);
+                ok = values.Delete(signalName.Buffer());
+            }
+        }
+        if (ok) {
+            ok = values.MoveToRoot();
+        }
+    }
+    return ok;
+}
+
+bool HttpSignalStream::PrintFrame(ConfigurationDatabase &values, StreamString &json, StreamString &frame) {
+    json = "";
+    frame = "";
+    StreamStructuredData<JsonPrinter> sdata(json);
+    bool ok = sdata.GetPrinter()->PrintBegin();
+    if (ok) {
+        ok = values.Copy(sdata);
+    }
+    if (ok) {
+        ok = sdata.GetPrinter()->PrintEnd();
+    }
+    //Remove the new lines that StreamStructuredData writes between the elements (but not those inside strings)
+    const char8 *printed = json.Buffer();
+    uint32 jsonSize = static_cast<uint32>(json.Size());
+    uint32 spanStart = 0u;
+    bool inString = false;
+    bool escaped = false;
+    uint32 i;
+    for (i = 0u; (i <= jsonSize) && (ok); i++) {
+        bool removed = (i == jsonSize);
+        if (!removed) {
+            char8 c = printed[i];
+            if (inString) {
+                if (escaped) {
+                    escaped = false;
+                }
+                else if (c == '\\') {
+                    escaped = true;
+                }
+                else {
+                    inString = (c != '"');
+                }
+            }
+            else if (c == '"') {
+                inString = true;
+            }
+            else {
+                removed = ((c == '\n') || (c == '\r'));
+            }
+        }
+        if (removed) {
+            uint32 spanSize = (i - spanStart);
+            if (spanSize > 0u) {
+                ok = frame.Write(&printed[spanStart], spanSize);
+            }
+            spanStart = (i + 1u);
+        }
+    }
+    return ok;
+}
+
+/*lint -e{613} sdata cannot be NULL as otherwise ok would be false*/
+bool HttpSignalStream::GetAsStructuredData(StreamStructuredDataI &data, HttpProtocol &protocol) {
+    StreamString signals;
+    GetRequestedSignals(protocol, signals);
+    ConfigurationDatabase values;
+    bool ok = ExportSource(values, signals);
+    if (ok) {
+        ok = HttpDataExportI::GetAsStructuredData(data, protocol);
+        StreamStructuredData<JsonPrinter> *sdata = NULL_PTR(StreamStructuredData<JsonPrinter> *);
+        if (ok) {
+            sdata = dynamic_cast<StreamStructuredData<JsonPrinter> *>(&data);
+            /*lint -e{665} StreamStructuredData<JsonPrinter> is only used to define the pointer type of the NULL_PTR*/
+            ok = (sdata != NULL_PTR(StreamStructuredData<JsonPrinter> *));
+        }
+        if (ok) {
+            ok = sdata->GetPrinter()->PrintBegin();
+        }
+        if (ok) {
+            ok = values.Copy(data);
+        }
+        if (ok) {
+            ok = sdata->GetPrinter()->PrintEnd();
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::Warning, "Could not export the Source %s", source.Buffer());
+        ok = HttpDataExportI::ReplyNotFound(protocol);
+    }
+    return ok;
+}
+
+/*lint -e{613} sstream cannot be NULL as otherwise ok would be false*/
+bool HttpSignalStream::GetAsText(StreamI &stream, HttpProtocol &protocol) {
+    StreamString signals;
+    GetRequestedSignals(protocol, signals);
+    ConfigurationDatabase values;
+    bool ok = ExportSource(values, signals);
+    if (ok) {
+        ok = protocol.MoveAbsolute("OutputOptions");
+        if (ok) {
+            ok = protocol.Write("Transfer-Encoding", "chunked");
+        }
+        if (ok) {
+            ok = protocol.Write("Content-Type", "text/event-stream");
+        }
+        if (ok) {
+            ok = protocol.Write("Cache-Control", "no-cache");
+        }
+        if (ok) {
+            //empty string... go in chunked mode
+            StreamString hstream;
+            ok = protocol.WriteHeader(false, HttpDefinition::HSHCReplyOK, &hstream, NULL_PTR(const char8*));
+        }
+        HttpChunkedStream *sstream = NULL_PTR(HttpChunkedStream *);
+        if (ok) {
+            sstream = dynamic_cast<HttpChunkedStream *>(&stream);
+            ok = (sstream != NULL_PTR(HttpChunkedStream *));
+        }
+        if (ok) {
+            sstream->SetChunkMode(true);
+            //Reconnection delay of the client once the stream is closed
+            ok = sstream->Printf("retry: %u\n\n", period);
+        }
+        if (ok) {
+            ok = sstream->Flush();
+        }
+        if (ok) {
+            //each event shall leave as soon as it is flushed, also if the HttpService corks the replies
+            (void) sstream->SetCork(false);
+        }
+        uint64 lastSent = Sleep::GetMonotonicNanoSeconds();
+        uint64 maxDurationNs = static_cast<uint64>(maxDuration) * 1000000000ULL;
+        uint64 end = lastSent + maxDurationNs;
+        StreamString json;
+        StreamString frame;
+        StreamString lastFrame;
+        bool streaming = ok;
+        //A failure to write means that the client is gone
+        while (streaming) {
+            streaming = ExportSource(values, signals);
+            if (streaming) {
+                streaming = PrintFrame(values, json, frame);
+            }
+            uint64 now = Sleep::GetMonotonicNanoSeconds();
+            bool send = false;
+            if (streaming) {
+                if (!(frame == lastFrame)) {
+                    streaming = HttpSignalStreamWriteEvent(*sstream, frame);
+                    lastFrame = frame;
+                    send = true;
+                }
+                else if ((now - lastSent) >= HTTP_SIGNAL_STREAM_HEARTBEAT) {
+                    streaming = sstream->Printf("%s", ":\n\n");
+                    send = true;
+                }
+                else {
+                    //Nothing has changed
+                }
+            }
+            if ((streaming) && (send)) {
+                streaming = sstream->Flush();
+                lastSent = now;
+            }
+            if ((streaming) && (maxDuration > 0u)) {
+                streaming = (now < end);
+            }
+            if (streaming) {
+                Sleep::MSec(period);
+            }
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::Warning, "Could not export the Source %s", source.Buffer());
+        ok = HttpDataExportI::ReplyNotFound(protocol);
+    }
+    return ok;
+}
+
+CLASS_REGISTER(HttpSignalStream, "1.0")
+
+}
@@ -0,0 +1,162 @@
+/**
+ * @file HttpSignalStream.h
+ * @brief Header file for class HttpSignalStream
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HttpSignalStream
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef L4HTTPSERVICE_HTTPSIGNALSTREAM_H_
+#define L4HTTPSERVICE_HTTPSIGNALSTREAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "HttpDataExportI.h"
+#include "Object.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Pushes the data exported by an Object (typically a SnapshotDataSource) to HTTP clients as server-sent events.
+ * @details When requested in text mode (e.g. new EventSource("/Live?TextMode=1")) the reply is a text/event-stream
+ * where, every Period, the ExportData of the Source is sent as a compact json event (data: {...}) if it has changed
+ * since the last event. If the query contains Signals=A,B only the signals A and B of the exported Signals node
+ * are sent (the other exported values, e.g. the SnapshotDataSource Cycle, are always sent).
+ * A comment is sent if there were no events for one second, so that disconnected clients are detected.
+ * The stream ends when the client disconnects or after MaxDuration seconds (the client is expected to reconnect,
+ * which EventSource does automatically).
+ *
+ * When requested in data mode the current value is replied once, as a json structure with the same content of one event.
+ *
+ * @warning Each stream holds a service thread of the HttpService (also in reactor mode) for its whole duration, so
+ * that the HttpService shall be configured with enough threads for the expected number of clients.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Live = {
+ *     Class = HttpSignalStream
+ *     Source = "App.Data.Live" //Compulsory. The path, in the ObjectRegistryDatabase, of the Object to stream. It is resolved at every request.
+ *     Period = 10 //Optional. The minimum time in milliseconds between events. Default = 100.
+ *     MaxDuration = 60 //Optional. The maximum duration of a stream in seconds (0 => until the client disconnects). Default = 60.
+ * }
+ * </pre>
+ */
+class HttpSignalStream: public Object, public HttpDataExportI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    HttpSignalStream();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~HttpSignalStream();
+
+    /**
+     * @brief Calls Object::Initialise and reads the Source, Period and MaxDuration parameters (see class description).
+     * @return true if the parameters are correctly specified.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Replies once with the data exported by the Source (see class description).
+     * @param[out] data see HttpDataExportI::GetAsStructuredData.
+     * @param[out] protocol see HttpDataExportI::GetAsStructuredData.
+     * @return true if the data was successfully replied.
+     */
+    virtual bool GetAsStructuredData(StreamStructuredDataI &data, HttpProtocol &protocol);
+
+    /**
+     * @brief Streams the data exported by the Source as server-sent events (see class description).
+     * @param[out] stream see HttpDataExportI::GetAsText.
+     * @param[out] protocol see HttpDataExportI::GetAsText.
+     * @return true if the stream was started and ended because of the MaxDuration or of the client disconnection.
+     */
+    virtual bool GetAsText(StreamI &stream, HttpProtocol &protocol);
+
+    /**
+     * @brief Gets the configured Period.
+     * @return the minimum time in milliseconds between events.
+     */
+    uint32 GetPeriod() const;
+
+    /**
+     * @brief Gets the configured MaxDuration.
+     * @return the maximum duration of a stream in seconds.
+     */
+    uint32 GetMaxDuration() const;
+
+private:
+
+    /**
+     * @brief Reads the Signals query parameter.
+     * @param[in] protocol the protocol holding the query.
+     * @param[out] signals the requested signal names, as ",A,B,", or empty if all the signals are requested.
+     */
+    void GetRequestedSignals(HttpProtocol &protocol, StreamString &signals) const;
+
+    /**
+     * @brief Exports the Source into \a values and removes the signals that were not requested.
+     * @param[out] values where to export the Source. Any previous content is removed.
+     * @param[in] signals the requested signals (see GetRequestedSignals).
+     * @return true if the Source exists and was successfully exported.
+     */
+    bool ExportSource(ConfigurationDatabase &values, StreamString &signals);
+
+    /**
+     * @brief Writes \a values as compact json, i.e. in a single line unless a string value has new lines.
+     * @param[in] values the exported Source.
+     * @param[out] json scratch buffer where StreamStructuredData writes the json. Any previous content is removed.
+     * @param[out] frame where to write the compact json. Any previous content is removed.
+     * @return true if the json was successfully written.
+     */
+    static bool PrintFrame(ConfigurationDatabase &values, StreamString &json, StreamString &frame);
+
+    /**
+     * The path of the Object to stream.
+     */
+    StreamString source;
+
+    /**
+     * The minimum time in milliseconds between events.
+     */
+    uint32 period;
+
+    /**
+     * The maximum duration of a stream in seconds.
+     */
+    uint32 maxDuration;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* L4HTTPSERVICE_HTTPSIGNALSTREAM_H_ */
@@ -29,11 +29,73 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
 #include "UDPLogger.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Default number of datagrams in the batch.
+ */
+const MARTe::uint32 UDP_LOGGER_DEFAULT_BATCH_DATAGRAMS = 16u;
+
+/**
+ * Default MaxBatchLatency in milliseconds.
+ */
+const MARTe::uint32 UDP_LOGGER_DEFAULT_MAX_BATCH_LATENCY = 10u;
+
+/**
+ * Minimum DatagramSize allowed in batched mode.
+ */
+const MARTe::uint32 UDP_LOGGER_MIN_DATAGRAM_SIZE = 64u;
+
+/**
+ * Size of the fixed part of a binary record (recordSize, errorType, hrtTime, timeSeconds and lineNumber).
+ */
+const MARTe::uint32 UDP_LOGGER_BINARY_HEADER_SIZE = 20u;
+
+/**
+ * Maximum length of a string in a binary record.
+ */
+const MARTe::uint32 UDP_LOGGER_BINARY_MAX_STRING_SIZE = 255u;
+
+/**
+ * @brief Appends a length prefixed string to a binary record.
+ * @param[in] str the string to append (NULL is encoded as an empty string).
+ * @param[out] output the start of the record (NULL to only compute the size).
+ * @param[in] maxSize the size available for the record.
+ * @param[in,out] position the current size of the record.
+ */
+void UDPLoggerEncodeString(const MARTe::char8 * const str,
+                           MARTe::char8 * const output,
+                           const MARTe::uint32 maxSize,
+                           MARTe::uint32 &position) {
+    using namespace MARTe;
+    if (position < maxSize) {
+        uint32 len = 0u;
+        if (str != NULL_PTR(const char8 *)) {
+            len = StringHelper::Length(str);
+        }
+        if (len > UDP_LOGGER_BINARY_MAX_STRING_SIZE) {
+            len = UDP_LOGGER_BINARY_MAX_STRING_SIZE;
+        }
+        if (len > (maxSize - position - 1u)) {
+            len = (maxSize - position - 1u);
+        }
+        if (output != NULL_PTR(char8 *)) {
+            output[position] = static_cast<char8>(len);
+            if (len > 0u) {
+                (void) MemoryOperationsHelper::Copy(&output[position + 1u], str, len);
+            }
+        }
+        position += (len + 1u);
+    }
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -41,20 +103,122 @@
 namespace MARTe {
 UDPLogger::UDPLogger() :
         Object(), LoggerConsumerI() {
+    datagramSize = 0u;
+    batchDatagrams = 0u;
+    maxBatchLatencyTicks = 0u;
+    binaryEncoding = false;
+    batchMemory = NULL_PTR(char8 *);
+    batchDatagramsStart = NULL_PTR(const char8 **);
+    batchDatagramsSize = NULL_PTR(uint32 *);
+    currentDatagram = 0u;
+    batchStartCounter = 0u;
 }
 
 /*lint -e{1551} the destructor must guarantee that the socket is closed.*/
 UDPLogger::~UDPLogger() {
+    FlushLogMessages();
     if (!udpSocket.Close()) {
         REPORT_ERROR(ErrorManagement::Warning, "Failed to close the UDP socket");
     }
+    if (batchMemory != NULL_PTR(char8 *)) {
+        delete[] batchMemory;
+    }
+    if (batchDatagramsStart != NULL_PTR(const char8 **)) {
+        delete[] batchDatagramsStart;
+    }
+    if (batchDatagramsSize != NULL_PTR(uint32 *)) {
+        delete[] batchDatagramsSize;
+    }
 }
 
 void UDPLogger::ConsumeLogMessage(LoggerPage * const logPage) {
-    StreamString logMsg;
-    PrintToStream(logPage, logMsg);
-    uint32 msgSize = static_cast<uint32>(logMsg.Size());
-    (void) udpSocket.Write(logMsg.Buffer(), msgSize);
+    if (datagramSize == 0u) {
+        StreamString logMsg;
+        PrintToStream(logPage, logMsg);
+        uint32 msgSize = static_cast<uint32>(logMsg.Size());
+        (void) udpSocket.Write(logMsg.Buffer(), msgSize);
+    }
+    else {
+        uint32 capacity = 0u;
+        if (binaryEncoding) {
+            uint32 recordSize = EncodeBinary(logPage, NULL_PTR(char8 *), datagramSize);
+            char8 *record = ReserveInBatch(recordSize, capacity);
+            (void) EncodeBinary(logPage, record, capacity);
+        }
+        else {
+            StreamString logMsg;
+            PrintToStream(logPage, logMsg);
+            //+1 for the separator
+            uint32 msgSize = static_cast<uint32>(logMsg.Size()) + 1u;
+            char8 *entry = ReserveInBatch(msgSize, capacity);
+            (void) MemoryOperationsHelper::Copy(entry, logMsg.Buffer(), capacity - 1u);
+            entry[capacity - 1u] = '\n';
+        }
+        if ((HighResolutionTimer::Counter() - batchStartCounter) > maxBatchLatencyTicks) {
+            FlushLogMessages();
+        }
+    }
+}
+
+void UDPLogger::FlushLogMessages() {
+    if (batchDatagramsSize != NULL_PTR(uint32 *)) {
+        uint32 nOfDatagrams = currentDatagram;
+        if (batchDatagramsSize[currentDatagram] > 0u) {
+            nOfDatagrams++;
+        }
+        if (nOfDatagrams > 0u) {
+            (void) udpSocket.WriteBatch(batchDatagramsStart, batchDatagramsSize, nOfDatagrams);
+        }
+        uint32 i;
+        for (i = 0u; i <= currentDatagram; i++) {
+            batchDatagramsSize[i] = 0u;
+        }
+        currentDatagram = 0u;
+    }
+}
+
+char8 *UDPLogger::ReserveInBatch(const uint32 entrySize,
+                                 uint32 &capacity) {
+    capacity = entrySize;
+    if (capacity > datagramSize) {
+        capacity = datagramSize;
+    }
+    if ((batchDatagramsSize[currentDatagram] + capacity) > datagramSize) {
+        currentDatagram++;
+        if (currentDatagram == batchDatagrams) {
+            currentDatagram--;
+            FlushLogMessages();
+        }
+    }
+    if ((currentDatagram == 0u) && (batchDatagramsSize[0u] == 0u)) {
+        batchStartCounter = HighResolutionTimer::Counter();
+    }
+    char8 *entry = &batchMemory[(currentDatagram * datagramSize) + batchDatagramsSize[currentDatagram]];
+    batchDatagramsSize[currentDatagram] += capacity;
+    return entry;
+}
+
+uint32 UDPLogger::EncodeBinary(const LoggerPage * const logPage,
+                               char8 * const output,
+                               const uint32 maxSize) const {
+    const ErrorManagement::ErrorInformation &errorInfo = logPage->errorInfo;
+    uint32 position = UDP_LOGGER_BINARY_HEADER_SIZE;
+    UDPLoggerEncodeString(errorInfo.objectName, output, maxSize, position);
+    UDPLoggerEncodeString(errorInfo.className, output, maxSize, position);
+    UDPLoggerEncodeString(errorInfo.functionName, output, maxSize, position);
+    UDPLoggerEncodeString(errorInfo.fileName, output, maxSize, position);
+    UDPLoggerEncodeString(&logPage->errorStrBuffer[0], output, maxSize, position);
+    if (output != NULL_PTR(char8 *)) {
+        uint16 recordSize = static_cast<uint16>(position);
+        uint32 errorType = errorInfo.header.errorType.format_as_integer;
+        int16 lineNumber = errorInfo.header.lineNumber;
+        (void) MemoryOperationsHelper::Copy(&output[0u], &recordSize, static_cast<uint32>(sizeof(uint16)));
+        (void) MemoryOperationsHelper::Copy(&output[2u], &errorType, static_cast<uint32>(sizeof(uint32)));
+        (void) MemoryOperationsHelper::Copy(&output[6u], &errorInfo.hrtTime, static_cast<uint32>(sizeof(uint64)));
+        (void) MemoryOperationsHelper::Copy(&output[14u], &errorInfo.timeSeconds, static_cast<uint32>(sizeof(int32)));
+        (void) MemoryOperationsHelper::Copy(&output[18u], &lineNumber, static_cast<uint32>(sizeof(int16)));
+    }
+    return position;
 }
 
 bool UDPLogger::Initialise(StructuredDataI &data) {
@@ -73,6 +237,51 @@ bool UDPLogger::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "The Port parameter is compulsory");
         }
     }
+    if (ok) {
+        if (!data.Read("DatagramSize", datagramSize)) {
+            datagramSize = 0u;
+        }
+    }
+    if ((ok) && (datagramSize > 0u)) {
+        ok = (datagramSize >= UDP_LOGGER_MIN_DATAGRAM_SIZE);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "DatagramSize shall be at least %d", UDP_LOGGER_MIN_DATAGRAM_SIZE);
+        }
+        if (ok) {
+            if (!data.Read("BatchDatagrams", batchDatagrams)) {
+                batchDatagrams = UDP_LOGGER_DEFAULT_BATCH_DATAGRAMS;
+            }
+            ok = (batchDatagrams > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "BatchDatagrams shall be > 0");
+            }
+        }
+        if (ok) {
+            uint32 maxBatchLatency;
+            if (!data.Read("MaxBatchLatency", maxBatchLatency)) {
+                maxBatchLatency = UDP_LOGGER_DEFAULT_MAX_BATCH_LATENCY;
+            }
+            maxBatchLatencyTicks = (static_cast<uint64>(maxBatchLatency) * HighResolutionTimer::Frequency()) / 1000u;
+            StreamString encoding;
+            if (data.Read("Encoding", encoding)) {
+                binaryEncoding = (encoding == "Binary");
+                ok = ((binaryEncoding) || (encoding == "Text"));
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "Unsupported Encoding %s", encoding.Buffer());
+                }
+            }
+        }
+        if (ok) {
+            batchMemory = new char8[batchDatagrams * datagramSize];
+            batchDatagramsStart = new const char8*[batchDatagrams];
+            batchDatagramsSize = new uint32[batchDatagrams];
+            uint32 i;
+            for (i = 0u; i < batchDatagrams; i++) {
+                batchDatagramsStart[i] = &batchMemory[i * datagramSize];
+                batchDatagramsSize[i] = 0u;
+            }
+        }
+    }
     if (ok) {
         ok = udpSocket.Open();
     }
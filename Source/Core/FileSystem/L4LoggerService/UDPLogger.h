@@ -49,8 +49,24 @@ namespace MARTe {
  *     Port = 44444 //Compulsory. The port of the destination where the logs are to be sent to.
  *     Format = ItOoFm //Compulsory. As described in LoggerConsumerI::LoadPrintPreferences
  *     PrintKeys = 1 //Optional. As described in LoggerConsumerI::LoadPrintPreferences
+ *     DatagramSize = 1472 //Optional. If > 0 the log messages are batched, i.e. packed into datagrams of at most DatagramSize bytes (e.g. the path MTU minus the IP and UDP headers). Default = 0 (one datagram per log message).
+ *     BatchDatagrams = 16 //Optional. Only if DatagramSize > 0. Number of datagrams that are buffered before being sent with a single BasicUDPSocket::WriteBatch. Default = 16.
+ *     MaxBatchLatency = 10 //Optional. Only if DatagramSize > 0. Maximum time in milliseconds that a log message may wait in the batch while the LoggerService is still busy consuming messages. Default = 10.
+ *     Encoding = Text //Optional. Only if DatagramSize > 0. Text (the log messages are printed as in the non-batched mode and separated by a new line) or Binary (see below). Default = Text.
  * }
  * </pre>
+ *
+ * In batched mode the pending datagrams are also sent when the LoggerService has no more log messages (see FlushLogMessages), so that
+ *  the latency is only bounded by MaxBatchLatency during log bursts.
+ *
+ * With Encoding = Binary the Format and PrintKeys parameters are ignored and each log message is one record with the following layout
+ *  (all integers in the host byte order):
+ * <pre>
+ * uint16 recordSize (including this field) | uint32 errorType | uint64 hrtTime | int32 timeSeconds | int16 lineNumber |
+ * objectName | className | functionName | fileName | message
+ * </pre>
+ * where each string is encoded as a uint8 length followed by the characters (no terminator). Strings are truncated to 255 characters
+ *  or to the space left in the datagram. A record never spans two datagrams.
  */
 class UDPLogger: public Object, public LoggerConsumerI {
 public:
@@ -72,19 +88,91 @@ public:
      */
     virtual void ConsumeLogMessage(LoggerPage *logPage);
 
+    /**
+     * @brief Sends all the pending datagrams (only meaningful in batched mode).
+     */
+    virtual void FlushLogMessages();
+
     /**
      * @brief Calls Object::Initialise and reads the Format parameter (see class description) .
      * @param[in] data see Object::Initialise.
-     * @return true if Object::Initialise returns true.
+     * @return true if Object::Initialise returns true and all the batching parameters are valid.
      */
     virtual bool Initialise(StructuredDataI &data);
 private:
 
+    /**
+     * @brief Reserves space for an entry in the current datagram of the batch.
+     * @details If the entry does not fit in the current datagram the next datagram is used. If all the datagrams are
+     *  full the batch is sent first.
+     * @param[in] entrySize the number of bytes required by the entry.
+     * @param[out] capacity the number of bytes reserved (less than entrySize if the entry is larger than DatagramSize).
+     * @return the location where the entry is to be written.
+     */
+    char8 *ReserveInBatch(const uint32 entrySize,
+                          uint32 &capacity);
+
+    /**
+     * @brief Encodes the logPage in the binary format described in the class description.
+     * @param[in] logPage the log message to be encoded.
+     * @param[out] output where to write the record. If NULL only the size of the record is computed.
+     * @param[in] maxSize the maximum number of bytes to write.
+     * @return the size of the record.
+     */
+    uint32 EncodeBinary(const LoggerPage * const logPage,
+                        char8 * const output,
+                        const uint32 maxSize) const;
+
     /**
      *  The UDP socket where the logs are printed to.
      */
     UDPSocket udpSocket;
 
+    /**
+     * Maximum size of a datagram in batched mode (0 if batching is disabled).
+     */
+    uint32 datagramSize;
+
+    /**
+     * Number of datagrams in the batch.
+     */
+    uint32 batchDatagrams;
+
+    /**
+     * MaxBatchLatency in HighResolutionTimer ticks.
+     */
+    uint64 maxBatchLatencyTicks;
+
+    /**
+     * True if Encoding = Binary.
+     */
+    bool binaryEncoding;
+
+    /**
+     * Memory of all the datagrams in the batch (batchDatagrams * datagramSize bytes).
+     */
+    char8 *batchMemory;
+
+    /**
+     * Start of each datagram in batchMemory.
+     */
+    const char8 **batchDatagramsStart;
+
+    /**
+     * Number of bytes used in each datagram.
+     */
+    uint32 *batchDatagramsSize;
+
+    /**
+     * Index of the datagram currently being filled.
+     */
+    uint32 currentDatagram;
+
+    /**
+     * HighResolutionTimer counter when the first entry of the batch was added.
+     */
+    uint64 batchStartCounter;
+
 };
 }
 
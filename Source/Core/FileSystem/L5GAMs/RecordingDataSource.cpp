@@ -0,0 +1,664 @@
+/**
+ * @file RecordingDataSource.cpp
+ * @brief Source file for class RecordingDataSource
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RecordingDataSource (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "BasicFile.h"
+#include "BlockCompression.h"
+#include "Directory.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
+#include "RecordingDataSource.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Alignment of each signal inside of a frame (and of the frame size).
+ */
+static const uint32 RECORDING_SIGNAL_ALIGNMENT = 8u;
+
+/**
+ * Alignment of the first frame in the file.
+ */
+static const uint32 RECORDING_DATA_ALIGNMENT = 4096u;
+
+/**
+ * Default number of pages of the MemoryMapAsyncOutputBroker.
+ */
+static const uint32 RECORDING_DEFAULT_NUMBER_OF_BUFFERS = 16u;
+
+/**
+ * Default number of frames of each compressed block.
+ */
+static const uint32 RECORDING_DEFAULT_FRAMES_PER_BLOCK = 64u;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+RecordingDataSource::RecordingDataSource() :
+        DataSourceI() {
+    maxNumberOfFrames = 0u;
+    numberOfBrokerBuffers = RECORDING_DEFAULT_NUMBER_OF_BUFFERS;
+    cpuMask = ProcessorType(0u);
+    stackSize = THREADS_DEFAULT_STACKSIZE;
+    ignoreBufferOverrun = false;
+    header = NULL_PTR(RecordingFileHeader *);
+    frames = NULL_PTR(uint8 *);
+    frameSize = 0u;
+    signalOffsets = NULL_PTR(uint32 *);
+    memory = NULL_PTR(uint8 *);
+    frameIndex = 0u;
+    numberOfFrames = 0;
+    droppedFrames = 0;
+    compression = RECORDING_COMPRESSION_NONE;
+    framesPerBlock = RECORDING_DEFAULT_FRAMES_PER_BLOCK;
+    deltaSizes = NULL_PTR(uint32 *);
+    blocks = NULL_PTR(RecordingBlockDescriptor *);
+    maxNumberOfBlocks = 0u;
+    numberOfBlocks = 0u;
+    block = NULL_PTR(uint8 *);
+    pendingFrames = 0u;
+    shuffled = NULL_PTR(uint8 *);
+    hashTable = NULL_PTR(uint32 *);
+    dataSize = 0;
+}
+
+/*lint -e{1551} the destructor must guarantee that the file is unmapped.*/
+RecordingDataSource::~RecordingDataSource() {
+    if (file.IsMapped()) {
+        CloseFile();
+    }
+    if (signalOffsets != NULL_PTR(uint32 *)) {
+        delete[] signalOffsets;
+    }
+    if (memory != NULL_PTR(uint8 *)) {
+        delete[] memory;
+    }
+    if (deltaSizes != NULL_PTR(uint32 *)) {
+        delete[] deltaSizes;
+    }
+    if (block != NULL_PTR(uint8 *)) {
+        delete[] block;
+    }
+    if (shuffled != NULL_PTR(uint8 *)) {
+        delete[] shuffled;
+    }
+    if (hashTable != NULL_PTR(uint32 *)) {
+        delete[] hashTable;
+    }
+}
+
+bool RecordingDataSource::Initialise(StructuredDataI & data) {
+    bool ret = DataSourceI::Initialise(data);
+    if (ret) {
+        ret = data.Read("FileName", fileName);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In RecordingDataSource %s, FileName shall be set", GetName());
+        }
+    }
+    if (ret) {
+        ret = data.Read("MaxNumberOfFrames", maxNumberOfFrames);
+        if (ret) {
+            ret = (maxNumberOfFrames > 0u);
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In RecordingDataSource %s, MaxNumberOfFrames shall be set and > 0", GetName());
+        }
+    }
+    if (ret) {
+        if (!data.Read("NumberOfBuffers", numberOfBrokerBuffers)) {
+            numberOfBrokerBuffers = RECORDING_DEFAULT_NUMBER_OF_BUFFERS;
+        }
+        ret = (numberOfBrokerBuffers > 0u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In RecordingDataSource %s, NumberOfBuffers shall be > 0", GetName());
+        }
+    }
+    if (ret) {
+        StreamString cpus;
+        if (data.Read("CPUs", cpus)) {
+            ret = cpuMask.SetFromString(cpus.Buffer());
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "In RecordingDataSource %s, invalid CPUs %s", GetName(), cpus.Buffer());
+            }
+        }
+    }
+    if (ret) {
+        if (!data.Read("StackSize", stackSize)) {
+            stackSize = THREADS_DEFAULT_STACKSIZE;
+        }
+        uint32 ignoreBufferOverrunUInt32 = 0u;
+        (void) data.Read("IgnoreBufferOverrun", ignoreBufferOverrunUInt32);
+        ignoreBufferOverrun = (ignoreBufferOverrunUInt32 == 1u);
+    }
+    if (ret) {
+        StreamString compressionName;
+        if (data.Read("Compression", compressionName)) {
+            if (compressionName == "LZ4") {
+                compression = RECORDING_COMPRESSION_LZ4;
+            }
+            else if (compressionName == "ShuffleLZ4") {
+                compression = RECORDING_COMPRESSION_SHUFFLE_LZ4;
+            }
+            else {
+                ret = (compressionName == "None");
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "In RecordingDataSource %s, Compression shall be None, LZ4 or ShuffleLZ4", GetName());
+                }
+            }
+        }
+    }
+    if (ret) {
+        if (!data.Read("FramesPerBlock", framesPerBlock)) {
+            framesPerBlock = RECORDING_DEFAULT_FRAMES_PER_BLOCK;
+        }
+        ret = (framesPerBlock > 0u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In RecordingDataSource %s, FramesPerBlock shall be > 0", GetName());
+        }
+    }
+    return ret;
+}
+
+bool RecordingDataSource::SetConfiguredDatabase(StructuredDataI & data) {
+    bool ret = DataSourceI::SetConfiguredDatabase(data);
+    uint32 nOfFunctions = GetNumberOfFunctions();
+    if (ret) {
+        ret = (nOfFunctions <= 1u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In RecordingDataSource %s, only one GAM can write the signals", GetName());
+        }
+    }
+    uint32 f;
+    for (f = 0u; (f < nOfFunctions) && (ret); f++) {
+        uint32 nOfInputSignals = 0u;
+        ret = GetFunctionNumberOfSignals(InputSignals, f, nOfInputSignals);
+        if (ret) {
+            ret = (nOfInputSignals == 0u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "In RecordingDataSource %s, the signals cannot be read by GAMs", GetName());
+            }
+        }
+        uint32 nOfOutputSignals = 0u;
+        if (ret) {
+            ret = GetFunctionNumberOfSignals(OutputSignals, f, nOfOutputSignals);
+        }
+        uint32 s;
+        for (s = 0u; (s < nOfOutputSignals) && (ret); s++) {
+            uint32 samples = 0u;
+            ret = GetFunctionSignalSamples(OutputSignals, f, s, samples);
+            if (ret) {
+                ret = (samples <= 1u);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "In RecordingDataSource %s, the signals shall have Samples = 1", GetName());
+                }
+            }
+        }
+    }
+    uint32 nOfSignals = GetNumberOfSignals();
+    uint32 s;
+    for (s = 0u; (s < nOfSignals) && (ret); s++) {
+        StreamString signalName;
+        ret = GetSignalName(s, signalName);
+        if (ret) {
+            ret = (signalName.Size() < sizeof(RecordingSignalDescriptor::name));
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "In RecordingDataSource %s, the name of the signal %s is too long", GetName(),
+                             signalName.Buffer());
+            }
+        }
+        if (ret) {
+            const char8 * const typeName = TypeDescriptor::GetTypeNameFromTypeDescriptor(GetSignalType(s));
+            ret = (typeName != NULL_PTR(const char8 *));
+            if (ret) {
+                ret = (StringHelper::Length(typeName) < sizeof(RecordingSignalDescriptor::type));
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "In RecordingDataSource %s, the type of the signal %s is not supported", GetName(),
+                             signalName.Buffer());
+            }
+        }
+    }
+    if ((ret) && (nOfSignals > 0u)) {
+        deltaSizes = new uint32[nOfSignals];
+    }
+    for (s = 0u; (s < nOfSignals) && (ret); s++) {
+        deltaSizes[s] = 0u;
+        //Delta is only in the signals declared in the DataSource
+        uint32 delta = 0u;
+        StreamString signalName;
+        ret = GetSignalName(s, signalName);
+        if ((ret) && (signalsDatabase.MoveAbsolute("Signals"))) {
+            if (signalsDatabase.MoveRelative(signalName.Buffer())) {
+                (void) signalsDatabase.Read("Delta", delta);
+            }
+        }
+        if (ret) {
+            ret = signalsDatabase.MoveToRoot();
+        }
+        if ((ret) && (delta == 1u)) {
+            TypeDescriptor signalType = GetSignalType(s);
+            ret = ((compression != RECORDING_COMPRESSION_NONE) && (!signalType.isStructuredData)
+                    && ((signalType.type == SignedInteger) || (signalType.type == UnsignedInteger)));
+            if (ret) {
+                deltaSizes[s] = static_cast<uint32>(signalType.numberOfBits) / 8u;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "In RecordingDataSource %s, Delta is only allowed for the integer signals of a compressed recording (%s)",
+                             GetName(), signalName.Buffer());
+            }
+        }
+    }
+    return ret;
+}
+
+bool RecordingDataSource::AllocateMemory() {
+    uint32 nOfSignals = GetNumberOfSignals();
+    bool ret = (!file.IsMapped());
+    frameSize = static_cast<uint32>(sizeof(RecordingFrameHeader));
+    if ((ret) && (nOfSignals > 0u)) {
+        signalOffsets = new uint32[nOfSignals];
+    }
+    uint32 s;
+    for (s = 0u; (s < nOfSignals) && (ret); s++) {
+        uint32 byteSize = 0u;
+        ret = GetSignalByteSize(s, byteSize);
+        if (ret) {
+            /*lint -e{613} signalOffsets cannot be NULL if there are signals*/
+            signalOffsets[s] = frameSize;
+            frameSize += byteSize;
+            frameSize = (frameSize + (RECORDING_SIGNAL_ALIGNMENT - 1u)) & ~(RECORDING_SIGNAL_ALIGNMENT - 1u);
+        }
+    }
+    uint32 descriptorsOffset = static_cast<uint32>(sizeof(RecordingFileHeader));
+    uint32 blocksOffset = descriptorsOffset + (nOfSignals * static_cast<uint32>(sizeof(RecordingSignalDescriptor)));
+    uint32 dataOffset = blocksOffset;
+    if (compression != RECORDING_COMPRESSION_NONE) {
+        uint64 nOfBlocks = (maxNumberOfFrames + (framesPerBlock - 1u)) / framesPerBlock;
+        uint64 blocksEnd = static_cast<uint64>(blocksOffset) + (nOfBlocks * static_cast<uint64>(sizeof(RecordingBlockDescriptor)));
+        ret = (blocksEnd < 0x80000000u);
+        if (ret) {
+            maxNumberOfBlocks = static_cast<uint32>(nOfBlocks);
+            dataOffset = static_cast<uint32>(blocksEnd);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In RecordingDataSource %s, too many blocks. Increase the FramesPerBlock", GetName());
+        }
+    }
+    dataOffset = (dataOffset + (RECORDING_DATA_ALIGNMENT - 1u)) & ~(RECORDING_DATA_ALIGNMENT - 1u);
+    if (ret) {
+        memory = new uint8[frameSize];
+        ret = MemoryOperationsHelper::Set(memory, '\0', frameSize);
+    }
+    if ((ret) && (compression != RECORDING_COMPRESSION_NONE)) {
+        uint64 blockSize = static_cast<uint64>(framesPerBlock) * static_cast<uint64>(frameSize);
+        ret = (blockSize < 0x80000000u);
+        if (ret) {
+            block = new uint8[blockSize];
+            if (compression == RECORDING_COMPRESSION_SHUFFLE_LZ4) {
+                shuffled = new uint8[blockSize];
+            }
+            hashTable = new uint32[BlockCompression::HASH_TABLE_SIZE];
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In RecordingDataSource %s, the blocks are too large. Decrease the FramesPerBlock", GetName());
+        }
+    }
+    if (ret) {
+        //A previous (possibly longer) recording is replaced
+        Directory previous(fileName.Buffer());
+        if ((previous.Exists()) && (previous.IsFile())) {
+            ret = previous.Delete();
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::FatalError, "In RecordingDataSource %s, could not delete the file %s", GetName(), fileName.Buffer());
+            }
+        }
+    }
+    if (ret) {
+        uint64 fileSize = static_cast<uint64>(dataOffset) + (maxNumberOfFrames * static_cast<uint64>(frameSize));
+        ret = file.Open(fileName.Buffer(), BasicFile::ACCESS_MODE_W, fileSize);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "In RecordingDataSource %s, could not create the file %s", GetName(), fileName.Buffer());
+        }
+    }
+    if (ret) {
+        uint8 *fileData = reinterpret_cast<uint8 *>(file.GetData());
+        (void) file.Advise(static_cast<uint64>(dataOffset), 0u, BasicFile::ADVICE_SEQUENTIAL);
+        header = reinterpret_cast<RecordingFileHeader *>(fileData);
+        header->magic = RECORDING_FILE_MAGIC;
+        header->version = RECORDING_FILE_VERSION;
+        header->numberOfSignals = nOfSignals;
+        header->frameSize = frameSize;
+        header->descriptorsOffset = descriptorsOffset;
+        header->dataOffset = dataOffset;
+        header->maxNumberOfFrames = maxNumberOfFrames;
+        header->numberOfFrames = 0;
+        header->timerFrequency = HighResolutionTimer::Frequency();
+        header->compression = compression;
+        header->numberOfBlocks = 0;
+        if (compression != RECORDING_COMPRESSION_NONE) {
+            header->framesPerBlock = framesPerBlock;
+            header->blocksOffset = blocksOffset;
+            blocks = reinterpret_cast<RecordingBlockDescriptor *>(&fileData[blocksOffset]);
+        }
+        else {
+            header->framesPerBlock = 0u;
+            header->blocksOffset = 0u;
+        }
+        RecordingSignalDescriptor *descriptors = reinterpret_cast<RecordingSignalDescriptor *>(&fileData[descriptorsOffset]);
+        for (s = 0u; (s < nOfSignals) && (ret); s++) {
+            StreamString signalName;
+            ret = GetSignalName(s, signalName);
+            if (ret) {
+                ret = StringHelper::CopyN(&descriptors[s].name[0], signalName.Buffer(), static_cast<uint32>(sizeof(descriptors[s].name)) - 1u);
+            }
+            if (ret) {
+                ret = StringHelper::CopyN(&descriptors[s].type[0], TypeDescriptor::GetTypeNameFromTypeDescriptor(GetSignalType(s)),
+                                          static_cast<uint32>(sizeof(descriptors[s].type)) - 1u);
+            }
+            uint8 numberOfDimensions = 0u;
+            uint32 numberOfElements = 0u;
+            uint32 byteSize = 0u;
+            if (ret) {
+                ret = GetSignalNumberOfDimensions(s, numberOfDimensions);
+            }
+            if (ret) {
+                ret = GetSignalNumberOfElements(s, numberOfElements);
+            }
+            if (ret) {
+                ret = GetSignalByteSize(s, byteSize);
+            }
+            if (ret) {
+                descriptors[s].numberOfDimensions = numberOfDimensions;
+                descriptors[s].numberOfElements = numberOfElements;
+                /*lint -e{613} signalOffsets cannot be NULL if there are signals*/
+                descriptors[s].offset = signalOffsets[s];
+                descriptors[s].byteSize = byteSize;
+                /*lint -e{613} deltaSizes cannot be NULL if there are signals*/
+                descriptors[s].deltaSize = deltaSizes[s];
+                descriptors[s].reserved = 0u;
+            }
+        }
+        frames = &fileData[dataOffset];
+    }
+    return ret;
+}
+
+uint32 RecordingDataSource::GetNumberOfMemoryBuffers() {
+    return 1u;
+}
+
+bool RecordingDataSource::GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 bufferIdx, void *&signalAddress) {
+    bool ret = ((memory != NULL_PTR(uint8 *)) && (bufferIdx == 0u));
+    if (ret) {
+        ret = (signalIdx < GetNumberOfSignals());
+    }
+    if (ret) {
+        /*lint -e{613} signalOffsets cannot be NULL if there are signals*/
+        signalAddress = reinterpret_cast<void *>(&memory[signalOffsets[signalIdx]]);
+    }
+    return ret;
+}
+
+/*lint -e{715} the broker does not depend on the signal configuration*/
+const char8 *RecordingDataSource::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == OutputSignals) {
+        brokerName = "MemoryMapAsyncOutputBroker";
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "In RecordingDataSource %s, the signals cannot be read by GAMs", GetName());
+    }
+    return brokerName;
+}
+
+bool RecordingDataSource::GetOutputBrokers(ReferenceContainer &outputBrokers, const char8* const functionName, void * const gamMemPtr) {
+    ReferenceT<MemoryMapAsyncOutputBroker> newBroker("MemoryMapAsyncOutputBroker");
+    bool ret = newBroker.IsValid();
+    if (ret) {
+        StreamString brokerName = functionName;
+        brokerName += ".OutputBroker.MemoryMapAsyncOutputBroker";
+        newBroker->SetName(brokerName.Buffer());
+        newBroker->SetIgnoreBufferOverrun(ignoreBufferOverrun);
+        ret = newBroker->InitWithBufferParameters(OutputSignals, *this, functionName, gamMemPtr, numberOfBrokerBuffers, cpuMask, stackSize);
+    }
+    if (ret) {
+        ret = outputBrokers.Insert(newBroker);
+    }
+    if (ret) {
+        broker = newBroker;
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "In RecordingDataSource %s, could not initialise the MemoryMapAsyncOutputBroker", GetName());
+    }
+    return ret;
+}
+
+/*lint -e{715} the recording does not depend on the state*/
+bool RecordingDataSource::PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName) {
+    return true;
+}
+
+uint8 *RecordingDataSource::BeginFrame(const uint64 timestamp) {
+    uint8 *frame = NULL_PTR(uint8 *);
+    //Only the broker thread writes the frames
+    uint64 recorded = static_cast<uint64>(numberOfFrames);
+    if ((frames != NULL_PTR(uint8 *)) && (recorded < maxNumberOfFrames)) {
+        if (compression == RECORDING_COMPRESSION_NONE) {
+            frame = &frames[recorded * static_cast<uint64>(frameSize)];
+        }
+        else {
+            if (pendingFrames == framesPerBlock) {
+                WriteBlock();
+            }
+            frame = &block[pendingFrames * frameSize];
+            pendingFrames++;
+        }
+        RecordingFrameHeader *frameHeader = reinterpret_cast<RecordingFrameHeader *>(frame);
+        frameHeader->timestamp = timestamp;
+        frameHeader->index = frameIndex;
+        Atomic::Store(&numberOfFrames, static_cast<int64>(recorded + 1u), Atomic::MemoryOrderRelaxed);
+    }
+    else {
+        (void) Atomic::FetchAdd(&droppedFrames, 1, Atomic::MemoryOrderRelaxed);
+    }
+    frameIndex++;
+    return frame;
+}
+
+void RecordingDataSource::EndFrames() {
+    if (header != NULL_PTR(RecordingFileHeader *)) {
+        //The frames which are still in block are not in the file yet
+        int64 written = Atomic::Load(&numberOfFrames, Atomic::MemoryOrderRelaxed) - static_cast<int64>(pendingFrames);
+        Atomic::Store(&header->numberOfFrames, written, Atomic::MemoryOrderRelease);
+    }
+}
+
+/*lint -e{613} the block memory is allocated if compressed.*/
+void RecordingDataSource::WriteBlock() {
+    if ((pendingFrames > 0u) && (numberOfBlocks < maxNumberOfBlocks)) {
+        uint32 rawSize = pendingFrames * frameSize;
+        //The frame headers (time stamp and index) are always delta encoded
+        (void) BlockCompression::DeltaEncode(block, pendingFrames, frameSize, 0u, 8u, 2u);
+        uint32 nOfSignals = GetNumberOfSignals();
+        uint32 s;
+        for (s = 0u; s < nOfSignals; s++) {
+            if (deltaSizes[s] > 0u) {
+                uint32 byteSize = 0u;
+                (void) GetSignalByteSize(s, byteSize);
+                (void) BlockCompression::DeltaEncode(block, pendingFrames, frameSize, signalOffsets[s], deltaSizes[s], byteSize / deltaSizes[s]);
+            }
+        }
+        const uint8 *source = block;
+        if (compression == RECORDING_COMPRESSION_SHUFFLE_LZ4) {
+            BlockCompression::Shuffle(block, shuffled, pendingFrames, frameSize);
+            source = shuffled;
+        }
+        //The blocks are never larger than the frames, so that the file preallocated for the frames is large enough
+        uint64 offset = static_cast<uint64>(Atomic::Load(&dataSize, Atomic::MemoryOrderRelaxed));
+        uint8 *destination = &frames[offset];
+        uint32 size = BlockCompression::Compress(source, rawSize, destination, rawSize - 1u, hashTable);
+        if (size == 0u) {
+            MemoryOperationsHelper::CopyUnchecked(destination, source, rawSize);
+            size = rawSize;
+        }
+        blocks[numberOfBlocks].offset = offset;
+        blocks[numberOfBlocks].size = size;
+        blocks[numberOfBlocks].numberOfFrames = pendingFrames;
+        numberOfBlocks++;
+        Atomic::Store(&header->numberOfBlocks, static_cast<int32>(numberOfBlocks), Atomic::MemoryOrderRelease);
+        Atomic::Store(&dataSize, static_cast<int64>(offset + size), Atomic::MemoryOrderRelaxed);
+        pendingFrames = 0u;
+    }
+}
+
+void RecordingDataSource::CloseFile() {
+    WriteBlock();
+    EndFrames();
+    uint64 fileSize = static_cast<uint64>(header->dataOffset) + static_cast<uint64>(Atomic::Load(&dataSize, Atomic::MemoryOrderRelaxed));
+    if (!file.Close()) {
+        REPORT_ERROR(ErrorManagement::Warning, "In RecordingDataSource %s, could not close the file %s", GetName(), fileName.Buffer());
+    }
+    header = NULL_PTR(RecordingFileHeader *);
+    frames = NULL_PTR(uint8 *);
+    blocks = NULL_PTR(RecordingBlockDescriptor *);
+    if (compression != RECORDING_COMPRESSION_NONE) {
+        //Only the space used by the blocks is kept
+        BasicFile truncated;
+        bool ok = truncated.Open(fileName.Buffer(), BasicFile::ACCESS_MODE_W);
+        if (ok) {
+            ok = truncated.SetSize(fileSize);
+            (void) truncated.Close();
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "In RecordingDataSource %s, could not truncate the file %s", GetName(), fileName.Buffer());
+        }
+    }
+}
+
+bool RecordingDataSource::Synchronise() {
+    uint8 *frame = BeginFrame(HighResolutionTimer::Counter());
+    if (frame != NULL_PTR(uint8 *)) {
+        uint32 headerSize = static_cast<uint32>(sizeof(RecordingFrameHeader));
+        (void) MemoryOperationsHelper::Copy(&frame[headerSize], &memory[headerSize], frameSize - headerSize);
+    }
+    EndFrames();
+    return true;
+}
+
+/*lint -e{613} segments is not NULL if numberOfBuffers > 0.*/
+bool RecordingDataSource::SynchroniseBatch(const DataSourceBufferSegment * const segments, const uint32 numberOfBuffers, const uint32 numberOfSegmentsPerBuffer) {
+    uint32 b;
+    for (b = 0u; b < numberOfBuffers; b++) {
+        const DataSourceBufferSegment *buffer = &segments[b * numberOfSegmentsPerBuffer];
+        uint64 timestamp = (numberOfSegmentsPerBuffer > 0u) ? (buffer[0].timestamp) : (HighResolutionTimer::Counter());
+        uint8 *frame = BeginFrame(timestamp);
+        uint32 s;
+        for (s = 0u; (s < numberOfSegmentsPerBuffer) && (frame != NULL_PTR(uint8 *)); s++) {
+            //The memory of the DataSource has the layout of a frame
+            /*lint -e{946} -e{947} the destination is inside of the memory of the DataSource*/
+            uint32 offset = static_cast<uint32>(static_cast<uint8 *>(buffer[s].destination) - memory);
+            MemoryOperationsHelper::CopyUnchecked(&frame[offset], buffer[s].source, buffer[s].size);
+        }
+    }
+    if ((compression != RECORDING_COMPRESSION_NONE) && (pendingFrames == framesPerBlock)) {
+        WriteBlock();
+    }
+    EndFrames();
+    return true;
+}
+
+void RecordingDataSource::Purge(ReferenceContainer &purgeList) {
+    if (broker.IsValid()) {
+        //Record the pages which are still in the broker
+        if (!broker->Flush()) {
+            REPORT_ERROR(ErrorManagement::Warning, "In RecordingDataSource %s, could not flush the broker", GetName());
+        }
+        broker->UnlinkDataSource();
+        broker = ReferenceT<MemoryMapAsyncOutputBroker>();
+    }
+    if (file.IsMapped()) {
+        //The last (partial) block
+        WriteBlock();
+        EndFrames();
+    }
+    DataSourceI::Purge(purgeList);
+}
+
+uint64 RecordingDataSource::GetNumberOfFrames() const {
+    return static_cast<uint64>(Atomic::Load(&numberOfFrames, Atomic::MemoryOrderRelaxed));
+}
+
+uint64 RecordingDataSource::GetDroppedFrames() const {
+    return static_cast<uint64>(Atomic::Load(&droppedFrames, Atomic::MemoryOrderRelaxed));
+}
+
+uint64 RecordingDataSource::GetDataSize() const {
+    uint64 size;
+    if (compression == RECORDING_COMPRESSION_NONE) {
+        size = GetNumberOfFrames() * static_cast<uint64>(frameSize);
+    }
+    else {
+        size = static_cast<uint64>(Atomic::Load(&dataSize, Atomic::MemoryOrderRelaxed));
+    }
+    return size;
+}
+
+bool RecordingDataSource::ExportData(StructuredDataI & data) {
+    bool ret = DataSourceI::ExportData(data);
+    if (ret) {
+        ret = data.Write("FileName", fileName.Buffer());
+    }
+    if (ret) {
+        ret = data.Write("NumberOfFrames", GetNumberOfFrames());
+    }
+    if (ret) {
+        ret = data.Write("DroppedFrames", GetDroppedFrames());
+    }
+    if (ret) {
+        ret = data.Write("DataSize", GetDataSize());
+    }
+    return ret;
+}
+
+CLASS_REGISTER(RecordingDataSource, "1.0")
+
+}
@@ -0,0 +1,559 @@
+/**
+ * @file RecordingDataSource.h
+ * @brief Header file for class RecordingDataSource
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class RecordingDataSource
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef L5GAMS_RECORDINGDATASOURCE_H_
+#define L5GAMS_RECORDINGDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BasicMappedFile.h"
+#include "DataSourceI.h"
+#include "MemoryMapAsyncOutputBroker.h"
+#include "ProcessorType.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Value of RecordingFileHeader::magic.
+ */
+const uint32 RECORDING_FILE_MAGIC = 0x4D325243u;
+
+/**
+ * Value of RecordingFileHeader::version for the layout described in RecordingDataSource.
+ */
+const uint32 RECORDING_FILE_VERSION = 2u;
+
+/**
+ * RecordingFileHeader::compression of the files whose frames are not compressed.
+ */
+const uint32 RECORDING_COMPRESSION_NONE = 0u;
+
+/**
+ * RecordingFileHeader::compression of the files whose blocks of frames are compressed with BlockCompression::Compress.
+ */
+const uint32 RECORDING_COMPRESSION_LZ4 = 1u;
+
+/**
+ * RecordingFileHeader::compression of the files whose blocks of frames are shuffled (BlockCompression::Shuffle with the frame
+ * as element) and then compressed with BlockCompression::Compress.
+ */
+const uint32 RECORDING_COMPRESSION_SHUFFLE_LZ4 = 2u;
+
+/**
+ * @brief The header at the beginning of a recording file (64 bytes).
+ * @details All the offsets are in bytes with respect to the beginning of the file.
+ */
+struct RecordingFileHeader {
+    /**
+     * RECORDING_FILE_MAGIC.
+     */
+    uint32 magic;
+
+    /**
+     * RECORDING_FILE_VERSION.
+     */
+    uint32 version;
+
+    /**
+     * The number of RecordingSignalDescriptor.
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * The size of a frame (RecordingFrameHeader and signals) in bytes.
+     */
+    uint32 frameSize;
+
+    /**
+     * The offset of the first RecordingSignalDescriptor.
+     */
+    uint32 descriptorsOffset;
+
+    /**
+     * The offset of the first frame (or of the first compressed block).
+     */
+    uint32 dataOffset;
+
+    /**
+     * The number of frames preallocated in the file.
+     */
+    uint64 maxNumberOfFrames;
+
+    /**
+     * The number of frames recorded so far (updated after each batch of frames is written).
+     */
+    volatile int64 numberOfFrames;
+
+    /**
+     * The HighResolutionTimer::Frequency() of the recording, to convert the frame timestamps.
+     */
+    uint64 timerFrequency;
+
+    /**
+     * One of the RECORDING_COMPRESSION_ constants.
+     */
+    uint32 compression;
+
+    /**
+     * The number of frames of each compressed block (the last block may have less). 0 if not compressed.
+     */
+    uint32 framesPerBlock;
+
+    /**
+     * The offset of the first RecordingBlockDescriptor. 0 if not compressed.
+     */
+    uint32 blocksOffset;
+
+    /**
+     * The number of compressed blocks written so far.
+     */
+    volatile int32 numberOfBlocks;
+};
+
+/**
+ * @brief The header at the beginning of each frame.
+ */
+struct RecordingFrameHeader {
+    /**
+     * The HighResolutionTimer::Counter() when the signals were written by the GAM.
+     */
+    uint64 timestamp;
+
+    /**
+     * The index of the frame (counting also the frames that were dropped because the file was full).
+     */
+    uint64 index;
+};
+
+/**
+ * @brief The description of a signal in a recording file.
+ */
+struct RecordingSignalDescriptor {
+    /**
+     * The name of the signal (zero terminated).
+     */
+    char8 name[64];
+
+    /**
+     * The type of the signal as in TypeDescriptor::GetTypeNameFromTypeDescriptor (zero terminated).
+     */
+    char8 type[32];
+
+    /**
+     * The number of dimensions of the signal.
+     */
+    uint32 numberOfDimensions;
+
+    /**
+     * The number of elements of the signal.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * The offset of the signal with respect to the beginning of each frame.
+     */
+    uint32 offset;
+
+    /**
+     * The size of the signal in bytes.
+     */
+    uint32 byteSize;
+
+    /**
+     * The size of the integers of the signal if delta encoded in the compressed blocks (see BlockCompression::DeltaEncode), 0 otherwise.
+     */
+    uint32 deltaSize;
+
+    /**
+     * Pads the descriptor to a multiple of 8 bytes.
+     */
+    uint32 reserved;
+};
+
+/**
+ * @brief The position of a compressed block of frames in a recording file.
+ */
+struct RecordingBlockDescriptor {
+    /**
+     * The offset of the block with respect to RecordingFileHeader::dataOffset.
+     */
+    uint64 offset;
+
+    /**
+     * The size of the block in the file. If equal to numberOfFrames * frameSize the block is stored without compression.
+     */
+    uint32 size;
+
+    /**
+     * The number of frames of the block.
+     */
+    uint32 numberOfFrames;
+};
+
+/**
+ * @brief A DataSourceI which records the signals written by a GAM into a preallocated memory-mapped file, to be replayed
+ * with the ReplayDataSource.
+ * @details The file starts with a RecordingFileHeader, followed by one RecordingSignalDescriptor for each signal (so that the
+ * file is self-describing) and by MaxNumberOfFrames frames of frameSize bytes. Each frame starts with a RecordingFrameHeader
+ * (HighResolutionTimer time stamp and index) followed by the signals. The frame k is at dataOffset + (k * frameSize).
+ *
+ * The file is created (or extended) to its final size and mapped when the memory is allocated, so that recording a frame is only a
+ * copy into the mapping (the operating system writes the pages back to the file in background).
+ *
+ * The signals are copied by a MemoryMapAsyncOutputBroker: the real-time thread copies (and time stamps) the signals into one of
+ * the NumberOfBuffers pages of the broker and the broker thread copies all the pages ready at once from the pages into the mapped
+ * file (see SynchroniseBatch). When the file is full the new frames are counted as dropped.
+ *
+ * If Compression is set the broker thread (never the real-time thread) instead collects FramesPerBlock frames and writes them as one
+ * compressed block, so that a block can be decompressed without the others: the frame headers and the integer signals with Delta = 1
+ * are delta encoded with respect to the previous frame of the block, the frames are optionally shuffled (ShuffleLZ4, so that the
+ * same byte of all the frames is contiguous) and the block is compressed (see BlockCompression). The blocks follow each other
+ * from dataOffset and are listed in a table of RecordingBlockDescriptor at blocksOffset (so that the ReplayDataSource can find the block
+ * of any frame). The file is truncated to the size of the blocks when closed.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Recorder = {
+ *     Class = RecordingDataSource
+ *     FileName = "/data/plant.rec" //Compulsory. The file is overwritten.
+ *     MaxNumberOfFrames = 3600000 //Compulsory. The number of frames preallocated in the file.
+ *     NumberOfBuffers = 64 //Optional. Default = 16. The number of pages of the MemoryMapAsyncOutputBroker.
+ *     CPUs = 0x4 //Optional. The CPUs of the broker thread (see ProcessorType::SetFromString).
+ *     StackSize = 1048576 //Optional. Default = THREADS_DEFAULT_STACKSIZE. The stack size of the broker thread.
+ *     IgnoreBufferOverrun = 1 //Optional. Default = 0. If 1 the real-time thread does not fail when all the pages are in use (the oldest are overwritten).
+ *     Compression = ShuffleLZ4 //Optional. None (default), LZ4 or ShuffleLZ4.
+ *     FramesPerBlock = 256 //Optional. Default = 64. The number of frames of each compressed block.
+ *     Signals = {
+ *         Current = {
+ *             Type = float32
+ *         }
+ *         Counter = {
+ *             Type = uint32
+ *             Delta = 1 //Optional. Default = 0. Only for integer signals with Compression. Delta encodes the slowly varying signals.
+ *         }
+ *         Profile = {
+ *             Type = float32
+ *             NumberOfElements = 16
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * Only one GAM can write the signals, with Samples = 1.
+ */
+class DLL_API RecordingDataSource: public DataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    RecordingDataSource();
+
+    /**
+     * @brief Destructor. Writes the pending frames and the number of recorded frames, unmaps the file and, if compressed, truncates it.
+     */
+    virtual ~RecordingDataSource();
+
+    /**
+     * @brief see DataSourceI::Initialise.
+     * @details Reads the parameters listed in the class description.
+     * @param[in] data see DataSourceI::Initialise.
+     * @return true if DataSourceI::Initialise returns true and the compulsory parameters are valid.
+     */
+    virtual bool Initialise(StructuredDataI & data);
+
+    /**
+     * @brief see DataSourceI::SetConfiguredDatabase.
+     * @details Checks that the signals are only written, by one GAM, with Samples = 1, that the signal names and types fit in the descriptors
+     * and that only the integer signals of a compressed recording have Delta = 1.
+     * @param[in] data see DataSourceI::SetConfiguredDatabase.
+     * @return true if all the conditions above are met.
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI & data);
+
+    /**
+     * @brief Creates, maps and initialises the file.
+     * @return true if the file can be created and mapped.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief Gets the number of memory buffers.
+     * @return 1.
+     */
+    virtual uint32 GetNumberOfMemoryBuffers();
+
+    /**
+     * @brief see DataSourceI::GetSignalMemoryBuffer.
+     * @details The memory of the signals has the layout of a frame, so that the address of a signal in a frame is known from its
+     * address in the memory of the DataSource.
+     */
+    virtual bool GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 bufferIdx, void *&signalAddress);
+
+    /**
+     * @brief see DataSourceI::GetBrokerName.
+     * @return MemoryMapAsyncOutputBroker for the output signals and NULL for the input signals.
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+
+    /**
+     * @brief Creates the MemoryMapAsyncOutputBroker with the NumberOfBuffers, CPUs and StackSize parameters.
+     * @param[out] outputBrokers where the broker is added.
+     * @param[in] functionName the name of the GAM.
+     * @param[in] gamMemPtr the memory of the GAM.
+     * @return true if the broker can be initialised.
+     */
+    virtual bool GetOutputBrokers(ReferenceContainer &outputBrokers, const char8* const functionName, void * const gamMemPtr);
+
+    /**
+     * @brief NOOP.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName);
+
+    /**
+     * @brief Records the memory of the DataSource as the next frame (time stamped with the current HighResolutionTimer::Counter()).
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Records each of the buffers of the batch as a frame, copying the segments directly from the broker pages into the file.
+     * @param[in] segments see DataSourceI::SynchroniseBatch.
+     * @param[in] numberOfBuffers see DataSourceI::SynchroniseBatch.
+     * @param[in] numberOfSegmentsPerBuffer see DataSourceI::SynchroniseBatch.
+     * @return true.
+     */
+    virtual bool SynchroniseBatch(const DataSourceBufferSegment * const segments, const uint32 numberOfBuffers, const uint32 numberOfSegmentsPerBuffer);
+
+    /**
+     * @brief Flushes the pending frames (and writes the last compressed block) and unlinks the broker (see MemoryMapAsyncOutputBroker::UnlinkDataSource).
+     * @param[in] purgeList see DataSourceI::Purge.
+     */
+    virtual void Purge(ReferenceContainer &purgeList);
+
+    /**
+     * @brief Gets the number of recorded frames.
+     * @return the number of frames written in the file (including the frames of the compressed block not yet written).
+     */
+    uint64 GetNumberOfFrames() const;
+
+    /**
+     * @brief Gets the number of bytes of the frames in the file.
+     * @return the number of bytes written from dataOffset (frameSize times the number of frames if not compressed).
+     */
+    uint64 GetDataSize() const;
+
+    /**
+     * @brief Gets the number of frames dropped because the file was full.
+     * @return the number of frames dropped.
+     */
+    uint64 GetDroppedFrames() const;
+
+    /**
+     * @brief see DataSourceI::ExportData.
+     * @details Also exports the FileName, NumberOfFrames, DroppedFrames and DataSize.
+     * @param[out] data see DataSourceI::ExportData.
+     * @return true if the data is successfully exported.
+     */
+    virtual bool ExportData(StructuredDataI & data);
+
+private:
+
+    /**
+     * @brief Gets the next frame of the file and writes its header.
+     * @param[in] timestamp the time stamp of the frame.
+     * @return the beginning of the frame or NULL if the file is full (the frame is counted as dropped).
+     */
+    uint8 *BeginFrame(const uint64 timestamp);
+
+    /**
+     * @brief Publishes the number of recorded frames in the file header.
+     */
+    void EndFrames();
+
+    /**
+     * @brief Delta encodes, shuffles and compresses the frames collected in block and writes them in the file as the next block.
+     */
+    void WriteBlock();
+
+    /**
+     * @brief Writes the pending frames, unmaps the file and, if compressed, truncates it to the size of the blocks.
+     */
+    void CloseFile();
+
+    /**
+     * The name of the file.
+     */
+    StreamString fileName;
+
+    /**
+     * The number of frames preallocated in the file.
+     */
+    uint64 maxNumberOfFrames;
+
+    /**
+     * The number of pages of the MemoryMapAsyncOutputBroker.
+     */
+    uint32 numberOfBrokerBuffers;
+
+    /**
+     * The CPUs of the broker thread.
+     */
+    ProcessorType cpuMask;
+
+    /**
+     * The stack size of the broker thread.
+     */
+    uint32 stackSize;
+
+    /**
+     * True if the broker shall ignore the buffer overruns.
+     */
+    bool ignoreBufferOverrun;
+
+    /**
+     * The mapped file.
+     */
+    BasicMappedFile file;
+
+    /**
+     * The header of the file.
+     */
+    RecordingFileHeader *header;
+
+    /**
+     * The first frame in the file.
+     */
+    uint8 *frames;
+
+    /**
+     * The size of a frame.
+     */
+    uint32 frameSize;
+
+    /**
+     * The offset of each signal in a frame.
+     */
+    uint32 *signalOffsets;
+
+    /**
+     * The memory of the signals (with the layout of a frame).
+     */
+    uint8 *memory;
+
+    /**
+     * The number of frames (recorded and dropped).
+     */
+    uint64 frameIndex;
+
+    /**
+     * The number of recorded frames.
+     */
+    volatile int64 numberOfFrames;
+
+    /**
+     * The number of dropped frames.
+     */
+    volatile int64 droppedFrames;
+
+    /**
+     * One of the RECORDING_COMPRESSION_ constants.
+     */
+    uint32 compression;
+
+    /**
+     * The number of frames of each compressed block.
+     */
+    uint32 framesPerBlock;
+
+    /**
+     * The size of the delta encoded integers of each signal (0 if not delta encoded).
+     */
+    uint32 *deltaSizes;
+
+    /**
+     * The table of blocks in the file.
+     */
+    RecordingBlockDescriptor *blocks;
+
+    /**
+     * The number of elements of blocks.
+     */
+    uint32 maxNumberOfBlocks;
+
+    /**
+     * The number of blocks written.
+     */
+    uint32 numberOfBlocks;
+
+    /**
+     * The frames being collected for the next block.
+     */
+    uint8 *block;
+
+    /**
+     * The number of frames in block.
+     */
+    uint32 pendingFrames;
+
+    /**
+     * Where the block is shuffled.
+     */
+    uint8 *shuffled;
+
+    /**
+     * The hash table of BlockCompression::Compress.
+     */
+    uint32 *hashTable;
+
+    /**
+     * The number of bytes written from dataOffset.
+     */
+    volatile int64 dataSize;
+
+    /**
+     * The broker (unlinked in Purge).
+     */
+    ReferenceT<MemoryMapAsyncOutputBroker> broker;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* L5GAMS_RECORDINGDATASOURCE_H_ */
@@ -0,0 +1,96 @@
+/**
+ * @file ReplayBroker.cpp
+ * @brief Source file for class ReplayBroker
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ReplayBroker (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MemoryOperationsHelper.h"
+#include "ReplayBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ReplayBroker::ReplayBroker() :
+        BrokerI() {
+    replay = NULL_PTR(ReplayDataSource *);
+    frameOffsets = NULL_PTR(uint32 *);
+}
+
+ReplayBroker::~ReplayBroker() {
+    if (frameOffsets != NULL_PTR(uint32 *)) {
+        delete[] frameOffsets;
+    }
+    replay = NULL_PTR(ReplayDataSource *);
+}
+
+bool ReplayBroker::Init(const SignalDirection direction,
+                        DataSourceI &dataSourceIn,
+                        const char8 *const functionName,
+                        void *const gamMemoryAddress) {
+    replay = dynamic_cast<ReplayDataSource *>(&dataSourceIn);
+    bool ret = ((replay != NULL_PTR(ReplayDataSource *)) && (direction == InputSignals));
+    if (!ret) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "ReplayBroker can only read the signals of a ReplayDataSource");
+    }
+    if (ret) {
+        ret = InitFunctionPointers(direction, dataSourceIn, functionName, gamMemoryAddress);
+    }
+    uint32 numberOfCopies = GetNumberOfCopies();
+    if ((ret) && (numberOfCopies > 0u)) {
+        frameOffsets = new uint32[numberOfCopies];
+    }
+    uint32 c;
+    for (c = 0u; (c < numberOfCopies) && (ret); c++) {
+        /*lint -e{613} the array is allocated if there are copies*/
+        frameOffsets[c] = replay->GetFrameOffset(GetDSCopySignalIndex(c)) + GetCopyOffset(c);
+    }
+    return ret;
+}
+
+/*lint -e{613} a valid Init is a pre-condition for the Execute method*/
+bool ReplayBroker::Execute() {
+    bool ret = true;
+    uint32 numberOfCopies = GetNumberOfCopies();
+    const uint8 *frame = replay->NextFrame();
+    uint32 c;
+    for (c = 0u; (c < numberOfCopies) && (ret); c++) {
+        ret = MemoryOperationsHelper::Copy(GetFunctionPointer(c), &frame[frameOffsets[c]], GetCopyByteSize(c));
+    }
+    return ret;
+}
+
+CLASS_REGISTER(ReplayBroker, "1.0")
+
+}
@@ -0,0 +1,100 @@
+/**
+ * @file ReplayBroker.h
+ * @brief Header file for class ReplayBroker
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ReplayBroker
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REPLAYBROKER_H_
+#define REPLAYBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BrokerI.h"
+#include "ReplayDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Input BrokerI of the ReplayDataSource.
+ * @details Each Execute asks the ReplayDataSource for the next frame (see ReplayDataSource::NextFrame) and copies the
+ * signals directly from the frame in the mapped recording into the GAM memory.
+ */
+class DLL_API ReplayBroker: public BrokerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    ReplayBroker();
+
+    /**
+     * @brief Destructor. Frees the copy information.
+     */
+    virtual ~ReplayBroker();
+
+    /**
+     * @brief See BrokerI::Init.
+     * @param[in] direction shall be InputSignals.
+     * @param[in] dataSourceIn shall be a ReplayDataSource.
+     * @param[in] functionName see BrokerI::Init.
+     * @param[in] gamMemoryAddress see BrokerI::Init.
+     * @return true if \a dataSourceIn is a ReplayDataSource and BrokerI::InitFunctionPointers returns true.
+     */
+    virtual bool Init(const SignalDirection direction,
+                      DataSourceI &dataSourceIn,
+                      const char8 *const functionName,
+                      void *const gamMemoryAddress);
+
+    /**
+     * @brief Copies the signals of the next frame into the GAM memory.
+     * @return true if all the copies are successful.
+     */
+    virtual bool Execute();
+
+private:
+
+    /**
+     * The ReplayDataSource.
+     */
+    ReplayDataSource *replay;
+
+    /**
+     * The offset of each copy with respect to the beginning of a frame.
+     */
+    uint32 *frameOffsets;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REPLAYBROKER_H_ */
@@ -0,0 +1,496 @@
+/**
+ * @file ReplayDataSource.cpp
+ * @brief Source file for class ReplayDataSource
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ReplayDataSource (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "BasicFile.h"
+#include "BlockCompression.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
+#include "ReplayDataSource.h"
+#include "Sleep.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ReplayDataSource::ReplayDataSource() :
+        DataSourceI() {
+    realTime = false;
+    loop = false;
+    frames = NULL_PTR(const uint8 *);
+    header = NULL_PTR(const RecordingFileHeader *);
+    compression = RECORDING_COMPRESSION_NONE;
+    blocks = NULL_PTR(const RecordingBlockDescriptor *);
+    numberOfBlocks = 0u;
+    framesPerBlock = 0u;
+    block = NULL_PTR(uint8 *);
+    shuffled = NULL_PTR(uint8 *);
+    currentBlock = 0u;
+    firstFrame = 0u;
+    lastFrame = NULL_PTR(const uint8 *);
+    frameSize = 0u;
+    numberOfFrames = 0u;
+    recordingFrequency = 0u;
+    frameOffsets = NULL_PTR(uint32 *);
+    nextFrame = 0u;
+    replayedFrames = 0;
+    startCounter = 0u;
+    startTimestamp = 0u;
+    finished = 0;
+}
+
+/*lint -e{1551} the destructor must guarantee that the file is unmapped.*/
+ReplayDataSource::~ReplayDataSource() {
+    if (file.IsMapped()) {
+        (void) file.Close();
+    }
+    if (frameOffsets != NULL_PTR(uint32 *)) {
+        delete[] frameOffsets;
+    }
+    if (block != NULL_PTR(uint8 *)) {
+        delete[] block;
+    }
+    if (shuffled != NULL_PTR(uint8 *)) {
+        delete[] shuffled;
+    }
+}
+
+bool ReplayDataSource::Initialise(StructuredDataI & data) {
+    bool ret = DataSourceI::Initialise(data);
+    if (ret) {
+        ret = data.Read("FileName", fileName);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In ReplayDataSource %s, FileName shall be set", GetName());
+        }
+    }
+    if (ret) {
+        uint32 realTimeUInt32 = 0u;
+        uint32 loopUInt32 = 0u;
+        (void) data.Read("RealTime", realTimeUInt32);
+        (void) data.Read("Loop", loopUInt32);
+        realTime = (realTimeUInt32 == 1u);
+        loop = (loopUInt32 == 1u);
+        if (!data.Read("FirstFrame", firstFrame)) {
+            firstFrame = 0u;
+        }
+    }
+    return ret;
+}
+
+bool ReplayDataSource::SetConfiguredDatabase(StructuredDataI & data) {
+    bool ret = DataSourceI::SetConfiguredDatabase(data);
+    uint32 nOfFunctions = GetNumberOfFunctions();
+    if (ret) {
+        //Each execution of the broker moves to the next frame
+        ret = (nOfFunctions <= 1u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "In ReplayDataSource %s, only one GAM can read the signals", GetName());
+        }
+    }
+    uint32 f;
+    for (f = 0u; (f < nOfFunctions) && (ret); f++) {
+        uint32 nOfOutputSignals = 0u;
+        ret = GetFunctionNumberOfSignals(OutputSignals, f, nOfOutputSignals);
+        if (ret) {
+            ret = (nOfOutputSignals == 0u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "In ReplayDataSource %s, the signals cannot be written by GAMs", GetName());
+            }
+        }
+        uint32 nOfInputSignals = 0u;
+        if (ret) {
+            ret = GetFunctionNumberOfSignals(InputSignals, f, nOfInputSignals);
+        }
+        uint32 s;
+        for (s = 0u; (s < nOfInputSignals) && (ret); s++) {
+            uint32 samples = 0u;
+            ret = GetFunctionSignalSamples(InputSignals, f, s, samples);
+            if (ret) {
+                ret = (samples <= 1u);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "In ReplayDataSource %s, the signals shall have Samples = 1", GetName());
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+bool ReplayDataSource::AllocateMemory() {
+    bool ret = (!file.IsMapped());
+    if (ret) {
+        ret = file.Open(fileName.Buffer(), BasicFile::ACCESS_MODE_R);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "In ReplayDataSource %s, could not open the file %s", GetName(), fileName.Buffer());
+        }
+    }
+    if (ret) {
+        ret = ReadDescriptors();
+    }
+    return ret;
+}
+
+bool ReplayDataSource::ReadDescriptors() {
+    const uint8 *fileData = reinterpret_cast<const uint8 *>(file.GetData());
+    uint64 fileSize = file.GetMappedSize();
+    bool ret = (fileSize >= static_cast<uint64>(sizeof(RecordingFileHeader)));
+    header = reinterpret_cast<const RecordingFileHeader *>(fileData);
+    if (ret) {
+        ret = ((header->magic == RECORDING_FILE_MAGIC) && (header->version == RECORDING_FILE_VERSION));
+    }
+    if (ret) {
+        numberOfFrames = static_cast<uint64>(header->numberOfFrames);
+        frameSize = header->frameSize;
+        recordingFrequency = header->timerFrequency;
+        compression = header->compression;
+        uint64 descriptorsEnd = static_cast<uint64>(header->descriptorsOffset)
+                + (static_cast<uint64>(header->numberOfSignals) * static_cast<uint64>(sizeof(RecordingSignalDescriptor)));
+        uint64 dataEnd = static_cast<uint64>(header->dataOffset);
+        if (compression == RECORDING_COMPRESSION_NONE) {
+            dataEnd += (numberOfFrames * static_cast<uint64>(frameSize));
+        }
+        ret = ((descriptorsEnd <= fileSize) && (dataEnd <= fileSize) && (numberOfFrames <= header->maxNumberOfFrames)
+                && (frameSize >= static_cast<uint32>(sizeof(RecordingFrameHeader))) && (recordingFrequency > 0u)
+                && (compression <= RECORDING_COMPRESSION_SHUFFLE_LZ4));
+    }
+    if (ret) {
+        frames = &fileData[header->dataOffset];
+        if (compression != RECORDING_COMPRESSION_NONE) {
+            ret = ReadBlocks();
+        }
+    }
+    if (!ret) {
+        REPORT_ERROR(ErrorManagement::FatalError, "In ReplayDataSource %s, %s is not a valid recording", GetName(), fileName.Buffer());
+    }
+    if (ret) {
+        ret = (numberOfFrames > 0u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "In ReplayDataSource %s, the recording %s is empty", GetName(), fileName.Buffer());
+        }
+    }
+    if (ret) {
+        ret = (firstFrame < numberOfFrames);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "In ReplayDataSource %s, the FirstFrame is not in the recording %s", GetName(), fileName.Buffer());
+        }
+    }
+    uint32 nOfSignals = GetNumberOfSignals();
+    if ((ret) && (nOfSignals > 0u)) {
+        frameOffsets = new uint32[nOfSignals];
+    }
+    uint32 s;
+    for (s = 0u; (s < nOfSignals) && (ret); s++) {
+        StreamString signalName;
+        ret = GetSignalName(s, signalName);
+        const RecordingSignalDescriptor *descriptors = reinterpret_cast<const RecordingSignalDescriptor *>(&fileData[header->descriptorsOffset]);
+        bool found = false;
+        uint32 d;
+        for (d = 0u; (d < header->numberOfSignals) && (ret) && (!found); d++) {
+            char8 name[sizeof(RecordingSignalDescriptor::name)];
+            ret = StringHelper::CopyN(&name[0], &descriptors[d].name[0], static_cast<uint32>(sizeof(name)) - 1u);
+            name[sizeof(name) - 1u] = '\0';
+            found = (signalName == &name[0]);
+            if (found) {
+                char8 type[sizeof(RecordingSignalDescriptor::type)];
+                ret = StringHelper::CopyN(&type[0], &descriptors[d].type[0], static_cast<uint32>(sizeof(type)) - 1u);
+                type[sizeof(type) - 1u] = '\0';
+                const char8 * const typeName = TypeDescriptor::GetTypeNameFromTypeDescriptor(GetSignalType(s));
+                uint32 byteSize = 0u;
+                if (ret) {
+                    ret = GetSignalByteSize(s, byteSize);
+                }
+                if (ret) {
+                    ret = (typeName != NULL_PTR(const char8 *));
+                }
+                if (ret) {
+                    ret = ((StringHelper::Compare(typeName, &type[0]) == 0) && (byteSize == descriptors[d].byteSize));
+                }
+                if (ret) {
+                    ret = ((static_cast<uint64>(descriptors[d].offset) + static_cast<uint64>(byteSize)) <= static_cast<uint64>(frameSize));
+                }
+                if (ret) {
+                    /*lint -e{613} frameOffsets cannot be NULL if there are signals*/
+                    frameOffsets[s] = descriptors[d].offset;
+                }
+                else {
+                    REPORT_ERROR(ErrorManagement::FatalError, "In ReplayDataSource %s, the signal %s has a different type or size in the recording %s", GetName(),
+                                 signalName.Buffer(), fileName.Buffer());
+                }
+            }
+        }
+        if ((ret) && (!found)) {
+            ret = false;
+            REPORT_ERROR(ErrorManagement::FatalError, "In ReplayDataSource %s, the signal %s is not in the recording %s", GetName(), signalName.Buffer(),
+                         fileName.Buffer());
+        }
+    }
+    if (ret) {
+        (void) file.Advise(static_cast<uint64>(header->dataOffset), 0u, BasicFile::ADVICE_SEQUENTIAL);
+        nextFrame = firstFrame;
+        //Repeated if the first frame cannot be decompressed
+        lastFrame = (compression == RECORDING_COMPRESSION_NONE) ? (&frames[firstFrame * static_cast<uint64>(frameSize)]) : (block);
+    }
+    return ret;
+}
+
+bool ReplayDataSource::ReadBlocks() {
+    uint64 fileSize = file.GetMappedSize();
+    numberOfBlocks = static_cast<uint32>(header->numberOfBlocks);
+    framesPerBlock = header->framesPerBlock;
+    uint64 blocksEnd = static_cast<uint64>(header->blocksOffset) + (static_cast<uint64>(numberOfBlocks) * static_cast<uint64>(sizeof(RecordingBlockDescriptor)));
+    uint64 blockSize = static_cast<uint64>(framesPerBlock) * static_cast<uint64>(frameSize);
+    bool ret = ((header->numberOfBlocks >= 0) && (framesPerBlock > 0u) && (blocksEnd <= fileSize) && (blockSize < 0x80000000u));
+    const RecordingSignalDescriptor *descriptors = reinterpret_cast<const RecordingSignalDescriptor *>(&(reinterpret_cast<const uint8 *>(header))[header->descriptorsOffset]);
+    uint32 d;
+    for (d = 0u; (d < header->numberOfSignals) && (ret); d++) {
+        uint32 deltaSize = descriptors[d].deltaSize;
+        if (deltaSize > 0u) {
+            ret = (((deltaSize == 1u) || (deltaSize == 2u) || (deltaSize == 4u) || (deltaSize == 8u)) && ((descriptors[d].byteSize % deltaSize) == 0u)
+                    && ((static_cast<uint64>(descriptors[d].offset) + static_cast<uint64>(descriptors[d].byteSize)) <= static_cast<uint64>(frameSize)));
+        }
+    }
+    if (ret) {
+        blocks = reinterpret_cast<const RecordingBlockDescriptor *>(&(reinterpret_cast<const uint8 *>(header))[header->blocksOffset]);
+    }
+    //All the blocks but the last are full, so that the block of a frame is frameIdx / framesPerBlock
+    uint64 dataSize = fileSize - static_cast<uint64>(header->dataOffset);
+    uint64 blockFrames = 0u;
+    uint32 b;
+    for (b = 0u; (b < numberOfBlocks) && (ret); b++) {
+        uint32 n = blocks[b].numberOfFrames;
+        ret = ((n > 0u) && (n <= framesPerBlock) && ((n == framesPerBlock) || (b == (numberOfBlocks - 1u))));
+        if (ret) {
+            ret = ((blocks[b].size <= (n * frameSize)) && (blocks[b].offset <= dataSize));
+        }
+        if (ret) {
+            ret = (static_cast<uint64>(blocks[b].size) <= (dataSize - blocks[b].offset));
+        }
+        blockFrames += n;
+    }
+    if (ret) {
+        ret = (blockFrames == numberOfFrames);
+    }
+    if (ret) {
+        block = new uint8[blockSize];
+        ret = MemoryOperationsHelper::Set(block, '\0', static_cast<uint32>(blockSize));
+        if (compression == RECORDING_COMPRESSION_SHUFFLE_LZ4) {
+            shuffled = new uint8[blockSize];
+        }
+        currentBlock = numberOfBlocks;
+    }
+    return ret;
+}
+
+uint32 ReplayDataSource::GetNumberOfMemoryBuffers() {
+    return 1u;
+}
+
+bool ReplayDataSource::GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 bufferIdx, void *&signalAddress) {
+    bool ret = ((frames != NULL_PTR(const uint8 *)) && (bufferIdx == 0u));
+    if (ret) {
+        ret = (signalIdx < GetNumberOfSignals());
+    }
+    if (ret) {
+        const uint8 *firstFrameAddress = (compression == RECORDING_COMPRESSION_NONE) ? (frames) : (block);
+        signalAddress = const_cast<void *>(reinterpret_cast<const void *>(&firstFrameAddress[GetFrameOffset(signalIdx)]));
+    }
+    return ret;
+}
+
+/*lint -e{715} the broker does not depend on the signal configuration*/
+const char8 *ReplayDataSource::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == InputSignals) {
+        brokerName = "ReplayBroker";
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "In ReplayDataSource %s, the signals cannot be written by GAMs", GetName());
+    }
+    return brokerName;
+}
+
+/*lint -e{715} the replay does not depend on the state*/
+bool ReplayDataSource::PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName) {
+    return true;
+}
+
+bool ReplayDataSource::Synchronise() {
+    return true;
+}
+
+const uint8 *ReplayDataSource::NextFrame() {
+    if ((nextFrame >= numberOfFrames) && (loop)) {
+        nextFrame = firstFrame;
+    }
+    const uint8 *frame = NULL_PTR(const uint8 *);
+    bool failed = false;
+    if ((nextFrame < numberOfFrames) && (Atomic::Load(&finished, Atomic::MemoryOrderRelaxed) == 0)) {
+        frame = GetFrame(nextFrame);
+        failed = (frame == NULL_PTR(const uint8 *));
+    }
+    if (frame != NULL_PTR(const uint8 *)) {
+        if (realTime) {
+            uint64 timestamp = reinterpret_cast<const RecordingFrameHeader *>(frame)->timestamp;
+            if (nextFrame == firstFrame) {
+                startCounter = HighResolutionTimer::Counter();
+                startTimestamp = timestamp;
+            }
+            else if (timestamp > startTimestamp) {
+                uint64 elapsed = (timestamp - startTimestamp);
+                uint64 frequency = HighResolutionTimer::Frequency();
+                if (recordingFrequency != frequency) {
+                    elapsed = static_cast<uint64>(static_cast<float64>(elapsed) * (static_cast<float64>(frequency) / static_cast<float64>(recordingFrequency)));
+                }
+                Sleep::Until(startCounter + elapsed);
+            }
+            else {
+                //Not later than the first frame
+            }
+        }
+        nextFrame++;
+        (void) Atomic::FetchAdd(&replayedFrames, 1, Atomic::MemoryOrderRelaxed);
+        lastFrame = frame;
+    }
+    else {
+        //The last frame is repeated
+        frame = lastFrame;
+        if (Atomic::Load(&finished, Atomic::MemoryOrderRelaxed) == 0) {
+            Atomic::Store(&finished, 1, Atomic::MemoryOrderRelaxed);
+            if (failed) {
+                REPORT_ERROR(ErrorManagement::FatalError, "In ReplayDataSource %s, could not decompress the frame %u of %s", GetName(), nextFrame,
+                             fileName.Buffer());
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::Information, "ReplayDataSource %s replayed all the %u frames of %s", GetName(), numberOfFrames, fileName.Buffer());
+            }
+        }
+    }
+    return frame;
+}
+
+const uint8 *ReplayDataSource::GetFrame(const uint64 frameIdx) {
+    const uint8 *frame = NULL_PTR(const uint8 *);
+    if (compression == RECORDING_COMPRESSION_NONE) {
+        frame = &frames[frameIdx * static_cast<uint64>(frameSize)];
+    }
+    else {
+        uint32 blockIdx = static_cast<uint32>(frameIdx / framesPerBlock);
+        bool ok = (blockIdx == currentBlock);
+        if (!ok) {
+            ok = LoadBlock(blockIdx);
+        }
+        if (ok) {
+            frame = &block[static_cast<uint32>(frameIdx % framesPerBlock) * frameSize];
+        }
+    }
+    return frame;
+}
+
+/*lint -e{613} the block memory is allocated if compressed.*/
+bool ReplayDataSource::LoadBlock(const uint32 blockIdx) {
+    currentBlock = numberOfBlocks;
+    const RecordingBlockDescriptor &descriptor = blocks[blockIdx];
+    uint32 nOfFrames = descriptor.numberOfFrames;
+    uint32 rawSize = nOfFrames * frameSize;
+    uint8 *destination = (compression == RECORDING_COMPRESSION_SHUFFLE_LZ4) ? (shuffled) : (block);
+    const uint8 *source = &frames[descriptor.offset];
+    bool ok = true;
+    if (descriptor.size == rawSize) {
+        //Stored without compression
+        MemoryOperationsHelper::CopyUnchecked(destination, source, rawSize);
+    }
+    else {
+        ok = BlockCompression::Decompress(source, descriptor.size, destination, rawSize);
+    }
+    if (ok) {
+        if (compression == RECORDING_COMPRESSION_SHUFFLE_LZ4) {
+            BlockCompression::Unshuffle(shuffled, block, nOfFrames, frameSize);
+        }
+        (void) BlockCompression::DeltaDecode(block, nOfFrames, frameSize, 0u, 8u, 2u);
+        const RecordingSignalDescriptor *descriptors = reinterpret_cast<const RecordingSignalDescriptor *>(&(reinterpret_cast<const uint8 *>(header))[header->descriptorsOffset]);
+        uint32 d;
+        for (d = 0u; d < header->numberOfSignals; d++) {
+            uint32 deltaSize = descriptors[d].deltaSize;
+            if (deltaSize > 0u) {
+                (void) BlockCompression::DeltaDecode(block, nOfFrames, frameSize, descriptors[d].offset, deltaSize, descriptors[d].byteSize / deltaSize);
+            }
+        }
+        currentBlock = blockIdx;
+    }
+    return ok;
+}
+
+uint32 ReplayDataSource::GetFrameOffset(const uint32 signalIdx) const {
+    /*lint -e{613} frameOffsets cannot be NULL if there are signals*/
+    return frameOffsets[signalIdx];
+}
+
+uint64 ReplayDataSource::GetNumberOfFrames() const {
+    return numberOfFrames;
+}
+
+uint64 ReplayDataSource::GetNumberOfReplayedFrames() const {
+    return static_cast<uint64>(Atomic::Load(&replayedFrames, Atomic::MemoryOrderRelaxed));
+}
+
+bool ReplayDataSource::IsFinished() const {
+    return (Atomic::Load(&finished, Atomic::MemoryOrderRelaxed) != 0);
+}
+
+bool ReplayDataSource::ExportData(StructuredDataI & data) {
+    bool ret = DataSourceI::ExportData(data);
+    if (ret) {
+        ret = data.Write("FileName", fileName.Buffer());
+    }
+    if (ret) {
+        ret = data.Write("NumberOfFrames", GetNumberOfFrames());
+    }
+    if (ret) {
+        ret = data.Write("NumberOfReplayedFrames", GetNumberOfReplayedFrames());
+    }
+    if (ret) {
+        uint32 finishedUInt32 = IsFinished() ? (1u) : (0u);
+        ret = data.Write("Finished", finishedUInt32);
+    }
+    return ret;
+}
+
+CLASS_REGISTER(ReplayDataSource, "1.0")
+
+}
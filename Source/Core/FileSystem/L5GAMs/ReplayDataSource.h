@@ -0,0 +1,343 @@
+/**
+ * @file ReplayDataSource.h
+ * @brief Header file for class ReplayDataSource
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ReplayDataSource
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef L5GAMS_REPLAYDATASOURCE_H_
+#define L5GAMS_REPLAYDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BasicMappedFile.h"
+#include "DataSourceI.h"
+#include "RecordingDataSource.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A DataSourceI which replays, frame by frame, a file recorded by the RecordingDataSource.
+ * @details The file is mapped (read-only) when the memory is allocated and each of the signals of the ReplayDataSource is found
+ * by name in the descriptors of the file (the type and the number of elements shall be the same as in the recording, but only
+ * some of the signals may be declared, in any order).
+ *
+ * The signals are read by the ReplayBroker, which copies them directly from the mapped frame into the GAM memory (i.e. the
+ * file is neither parsed nor copied into the DataSource). Each execution of the ReplayBroker moves to the next frame:
+ * - if RealTime = 1 the broker waits until the time elapsed since the first frame replayed is the same as in the recording
+ * (from the time stamps of the frames), so that the ReplayDataSource can be used as the synchronisation point of the
+ * real-time thread, in place of the DataSource which was recorded;
+ * - otherwise the frames are replayed as fast as the real-time thread executes (e.g. to replay hours of data in an offline run).
+ *
+ * After the last frame, the frames are replayed again from FirstFrame if Loop = 1, otherwise the last frame is repeated
+ * (see IsFinished).
+ *
+ * The frames of a compressed recording (see RecordingDataSource) are decompressed one block at a time, by the ReplayBroker,
+ * into a buffer of the ReplayDataSource (from which the broker copies the signals). The block of any frame is found in the block
+ * table of the file, so that the replay can start from any FirstFrame without decompressing the previous blocks.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Replay = {
+ *     Class = ReplayDataSource
+ *     FileName = "/data/plant.rec" //Compulsory.
+ *     RealTime = 1 //Optional. Default = 0.
+ *     Loop = 1 //Optional. Default = 0.
+ *     FirstFrame = 1000 //Optional. Default = 0. The index (in the file) of the first frame to replay.
+ *     Signals = {
+ *         Current = {
+ *             Type = float32
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * Only one GAM can read the signals, with Samples = 1.
+ */
+class DLL_API ReplayDataSource: public DataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    ReplayDataSource();
+
+    /**
+     * @brief Destructor. Unmaps the file.
+     */
+    virtual ~ReplayDataSource();
+
+    /**
+     * @brief see DataSourceI::Initialise.
+     * @details Reads the parameters listed in the class description.
+     * @param[in] data see DataSourceI::Initialise.
+     * @return true if DataSourceI::Initialise returns true and the FileName is set.
+     */
+    virtual bool Initialise(StructuredDataI & data);
+
+    /**
+     * @brief see DataSourceI::SetConfiguredDatabase.
+     * @details Checks that the signals are only read, by one GAM, with Samples = 1.
+     * @param[in] data see DataSourceI::SetConfiguredDatabase.
+     * @return true if all the conditions above are met.
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI & data);
+
+    /**
+     * @brief Maps the file and finds the signals in the descriptors.
+     * @return true if the file is a valid recording, with at least one frame, and contains all the signals.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief Gets the number of memory buffers.
+     * @return 1.
+     */
+    virtual uint32 GetNumberOfMemoryBuffers();
+
+    /**
+     * @brief see DataSourceI::GetSignalMemoryBuffer.
+     * @return the address of the signal in the first frame of the file.
+     */
+    virtual bool GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 bufferIdx, void *&signalAddress);
+
+    /**
+     * @brief see DataSourceI::GetBrokerName.
+     * @return ReplayBroker for the input signals and NULL for the output signals.
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+
+    /**
+     * @brief NOOP (the replay continues from the current frame).
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName);
+
+    /**
+     * @brief NOOP (the frames are moved by the ReplayBroker, see NextFrame).
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Moves to the next frame (waiting for its time if RealTime = 1).
+     * @details If the frame cannot be decompressed the replay is finished (see IsFinished) and the error is reported.
+     * @return the beginning of the frame.
+     */
+    const uint8 *NextFrame();
+
+    /**
+     * @brief Gets the offset of a signal in the frames of the file.
+     * @param[in] signalIdx the index of the signal.
+     * @return the offset of the signal with respect to the beginning of a frame.
+     */
+    uint32 GetFrameOffset(const uint32 signalIdx) const;
+
+    /**
+     * @brief Gets the number of frames in the file.
+     * @return the number of frames in the file.
+     */
+    uint64 GetNumberOfFrames() const;
+
+    /**
+     * @brief Gets the number of frames replayed.
+     * @return the number of frames replayed (including the repetitions if Loop = 1).
+     */
+    uint64 GetNumberOfReplayedFrames() const;
+
+    /**
+     * @brief Checks if the last frame was replayed (and Loop = 0).
+     * @return true if the last frame was replayed and the replay is not looping.
+     */
+    bool IsFinished() const;
+
+    /**
+     * @brief see DataSourceI::ExportData.
+     * @details Also exports the FileName, NumberOfFrames, NumberOfReplayedFrames and Finished.
+     * @param[out] data see DataSourceI::ExportData.
+     * @return true if the data is successfully exported.
+     */
+    virtual bool ExportData(StructuredDataI & data);
+
+private:
+
+    /**
+     * @brief Checks the header of the mapped file and finds the signals in the descriptors.
+     */
+    bool ReadDescriptors();
+
+    /**
+     * @brief Checks the table of the compressed blocks and allocates the memory to decompress a block.
+     */
+    bool ReadBlocks();
+
+    /**
+     * @brief Gets a frame, decompressing its block if needed.
+     * @param[in] frameIdx the index of the frame in the file.
+     * @return the beginning of the frame or NULL if its block cannot be decompressed.
+     */
+    const uint8 *GetFrame(const uint64 frameIdx);
+
+    /**
+     * @brief Decompresses a block into block.
+     * @param[in] blockIdx the index of the block.
+     * @return true if the block is valid.
+     */
+    bool LoadBlock(const uint32 blockIdx);
+
+    /**
+     * The name of the file.
+     */
+    StreamString fileName;
+
+    /**
+     * True if the frames are replayed at the time of the recording.
+     */
+    bool realTime;
+
+    /**
+     * True if the frames are replayed again from the beginning after the last one.
+     */
+    bool loop;
+
+    /**
+     * The mapped file.
+     */
+    BasicMappedFile file;
+
+    /**
+     * The first frame in the file (or the first compressed block).
+     */
+    const uint8 *frames;
+
+    /**
+     * The file header.
+     */
+    const RecordingFileHeader *header;
+
+    /**
+     * One of the RECORDING_COMPRESSION_ constants.
+     */
+    uint32 compression;
+
+    /**
+     * The table of compressed blocks.
+     */
+    const RecordingBlockDescriptor *blocks;
+
+    /**
+     * The number of compressed blocks.
+     */
+    uint32 numberOfBlocks;
+
+    /**
+     * The number of frames of each compressed block.
+     */
+    uint32 framesPerBlock;
+
+    /**
+     * The decompressed frames of currentBlock.
+     */
+    uint8 *block;
+
+    /**
+     * Where a shuffled block is decompressed.
+     */
+    uint8 *shuffled;
+
+    /**
+     * The index of the block in block (numberOfBlocks if none).
+     */
+    uint32 currentBlock;
+
+    /**
+     * The index of the first frame to replay.
+     */
+    uint64 firstFrame;
+
+    /**
+     * The frame returned by the previous NextFrame.
+     */
+    const uint8 *lastFrame;
+
+    /**
+     * The size of a frame.
+     */
+    uint32 frameSize;
+
+    /**
+     * The number of frames in the file.
+     */
+    uint64 numberOfFrames;
+
+    /**
+     * The frequency of the time stamps of the frames.
+     */
+    uint64 recordingFrequency;
+
+    /**
+     * The offset of each signal in a frame.
+     */
+    uint32 *frameOffsets;
+
+    /**
+     * The index of the next frame.
+     */
+    uint64 nextFrame;
+
+    /**
+     * The number of frames replayed.
+     */
+    volatile int64 replayedFrames;
+
+    /**
+     * The HighResolutionTimer::Counter() when the first frame was replayed (RealTime = 1).
+     */
+    uint64 startCounter;
+
+    /**
+     * The time stamp of the first frame replayed (RealTime = 1).
+     */
+    uint64 startTimestamp;
+
+    /**
+     * Set after the last frame was replayed (Loop = 0).
+     */
+    volatile int32 finished;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* L5GAMS_REPLAYDATASOURCE_H_ */
@@ -24,9 +24,11 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <fcntl.h>
 #include <signal.h>
 #include <stdio.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
@@ -35,8 +37,11 @@
 #include "AdvancedErrorManagement.h"
 #include "Bootstrap.h"
 #include "ConfigurationDatabase.h"
+#include "ConfigurationDatabaseImage.h"
 #include "File.h"
+#include "Loader.h"
 #include "MessageI.h"
+#include "StreamMemoryReference.h"
 #include "StructuredDataI.h"
 
 /*---------------------------------------------------------------------------*/
@@ -48,6 +53,30 @@ namespace MARTe {
  * The configuration file.
  */
 static File inputConfigurationFile;
+/**
+ * The configuration fragment files (see GetConfigurationFragments).
+ */
+static File *fragmentFiles = NULL_PTR(File *);
+/**
+ * The streams of the fragmentFiles.
+ */
+static StreamI **fragmentStreams = NULL_PTR(StreamI **);
+/**
+ * The number of fragmentFiles.
+ */
+static uint32 numberOfFragmentFiles = 0u;
+/**
+ * The memory mapped configuration image (see ConfigurationCache in GetConfigurationStream).
+ */
+static void *configurationImage = MAP_FAILED;
+/**
+ * The size of the configurationImage.
+ */
+static uint32 configurationImageSize = 0u;
+/**
+ * The stream over the configurationImage.
+ */
+static StreamMemoryReference *configurationImageStream = NULL_PTR(StreamMemoryReference *);
 /**
  * True while the application is to be running.
  */
@@ -87,6 +116,135 @@ static void StopApp(int sig) {
     REPORT_ERROR_STATIC(ErrorManagement::Information, "Application successfully stopped.\n");
     keepRunning = false;
 }
+
+/**
+ * Unmaps the configurationImage.
+ */
+static void UnmapConfigurationImage() {
+    if (configurationImageStream != NULL_PTR(StreamMemoryReference *)) {
+        delete configurationImageStream;
+        configurationImageStream = NULL_PTR(StreamMemoryReference *);
+    }
+    if (configurationImage != MAP_FAILED) {
+        (void) munmap(configurationImage, configurationImageSize);
+        configurationImage = MAP_FAILED;
+    }
+    configurationImageSize = 0u;
+}
+
+/**
+ * Closes and frees the fragmentFiles.
+ */
+static void CloseConfigurationFragments() {
+    if (fragmentFiles != NULL_PTR(File *)) {
+        uint32 i;
+        for (i = 0u; i < numberOfFragmentFiles; i++) {
+            (void) fragmentFiles[i].Close();
+        }
+        delete[] fragmentFiles;
+        fragmentFiles = NULL_PTR(File *);
+    }
+    if (fragmentStreams != NULL_PTR(StreamI **)) {
+        delete[] fragmentStreams;
+        fragmentStreams = NULL_PTR(StreamI **);
+    }
+    numberOfFragmentFiles = 0u;
+}
+
+/**
+ * Maps a configuration image file if it was compiled from a source with the given key.
+ */
+static bool MapConfigurationImage(const char8 * const filename, const uint64 key) {
+    int32 fd = open(filename, O_RDONLY);
+    bool ok = (fd >= 0);
+    if (ok) {
+        struct stat fileStat;
+        ok = (fstat(fd, &fileStat) == 0);
+        if (ok) {
+            ok = (fileStat.st_size > 0) && (static_cast<uint64>(fileStat.st_size) < 0xFFFFFFFFLLU);
+        }
+        if (ok) {
+            configurationImageSize = static_cast<uint32>(fileStat.st_size);
+            configurationImage = mmap(NULL_PTR(void *), configurationImageSize, PROT_READ, MAP_PRIVATE, fd, 0);
+            ok = (configurationImage != MAP_FAILED);
+        }
+        (void) close(fd);
+    }
+    if (ok) {
+        uint64 imageKey = 0u;
+        ok = ConfigurationDatabaseImage::GetKey(static_cast<const char8 *>(configurationImage), configurationImageSize, imageKey);
+        if (ok) {
+            ok = (imageKey == key);
+        }
+    }
+    if (ok) {
+        configurationImageStream = new StreamMemoryReference(static_cast<const char8 *>(configurationImage), configurationImageSize);
+    }
+    else {
+        UnmapConfigurationImage();
+    }
+    return ok;
+}
+
+/**
+ * Parses a library manifest file (e.g. IOGAM = "/opt/MARTe2/GAMs/IOGAM.so") into the LibraryManifest block of the loader parameters.
+ */
+static bool ReadLibraryManifest(const char8 * const filename, StructuredDataI &loaderParameters) {
+    File manifestFile;
+    bool ok = manifestFile.Open(filename, BasicFile::ACCESS_MODE_R);
+    ConfigurationDatabase manifest;
+    if (ok) {
+        ok = Loader::ParseConfiguration("cdb", manifestFile, manifest);
+        (void) manifestFile.Close();
+    }
+    if (ok) {
+        ok = manifest.MoveToRoot();
+    }
+    if (ok) {
+        ok = loaderParameters.CreateAbsolute("LibraryManifest");
+    }
+    if (ok) {
+        ok = manifest.Copy(loaderParameters);
+    }
+    if (!loaderParameters.MoveToRoot()) {
+        ok = false;
+    }
+    return ok;
+}
+
+/**
+ * Parses the configuration file and writes its image into a configuration image file.
+ */
+static bool CompileConfigurationImage(const char8 * const filename, const char8 * const parserType, const uint64 key) {
+    ConfigurationDatabase parsedConfiguration;
+    bool ok = Loader::ParseConfiguration(parserType, inputConfigurationFile, parsedConfiguration);
+    if (ok) {
+        ok = parsedConfiguration.MoveToRoot();
+    }
+    //Written aside and renamed so that a partially written image is never used
+    StreamString temporaryFilename;
+    if (ok) {
+        ok = temporaryFilename.Printf("%s.%d", filename, static_cast<int32>(getpid()));
+    }
+    if (ok) {
+        File imageFile;
+        ok = imageFile.Open(temporaryFilename.Buffer(), BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT | BasicFile::FLAG_TRUNC);
+        if (ok) {
+            ok = ConfigurationDatabaseImage::Write(parsedConfiguration, key, imageFile);
+            if (!imageFile.Close()) {
+                ok = false;
+            }
+            if (ok) {
+                ok = (rename(temporaryFilename.Buffer(), filename) == 0);
+            }
+            if (!ok) {
+                (void) unlink(temporaryFilename.Buffer());
+            }
+        }
+    }
+    (void) inputConfigurationFile.Seek(0LLU);
+    return ok;
+}
 }
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -130,14 +288,86 @@ ErrorManagement::ErrorType Bootstrap::GetConfigurationStream(StructuredDataI &lo
             }
         }
     }
+    if (ret) {
+        StreamString manifestFilename;
+        if (loaderParameters.Read("LibraryManifestFile", manifestFilename)) {
+            ret.parametersError = !ReadLibraryManifest(manifestFilename.Buffer(), loaderParameters);
+            if (!ret) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to read the library manifest %s", manifestFilename.Buffer());
+            }
+        }
+    }
     if (ret) {
         configurationStream = &inputConfigurationFile;
     }
+    if (ret) {
+        //Use (or update) the compiled image of the configuration file
+        StreamString cacheFilename;
+        if (loaderParameters.Read("ConfigurationCache", cacheFilename)) {
+            StreamString parserType;
+            (void) loaderParameters.Read("Parser", parserType);
+            uint64 key = ConfigurationDatabaseImage::ComputeKey(inputConfigurationFile, parserType.Buffer());
+            bool cached = MapConfigurationImage(cacheFilename.Buffer(), key);
+            if (!cached) {
+                REPORT_ERROR_STATIC(ErrorManagement::Information, "Compiling the configuration image %s", cacheFilename.Buffer());
+                if (CompileConfigurationImage(cacheFilename.Buffer(), parserType.Buffer(), key)) {
+                    cached = MapConfigurationImage(cacheFilename.Buffer(), key);
+                }
+                if (!cached) {
+                    REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed to compile the configuration image %s", cacheFilename.Buffer());
+                }
+            }
+            if (cached) {
+                configurationStream = configurationImageStream;
+            }
+        }
+    }
+    return ret;
+}
+
+ErrorManagement::ErrorType Bootstrap::GetConfigurationFragments(StructuredDataI &loaderParameters, StreamI **&fragments, uint32 &numberOfFragments) {
+    ErrorManagement::ErrorType ret;
+    CloseConfigurationFragments();
+    StreamString fragmentFilenames;
+    if (loaderParameters.Read("ConfigurationFragments", fragmentFilenames)) {
+        uint32 i;
+        uint32 nCharacters = static_cast<uint32>(fragmentFilenames.Size());
+        uint32 nFilenames = 1u;
+        for (i = 0u; i < nCharacters; i++) {
+            if (fragmentFilenames[i] == ',') {
+                nFilenames++;
+            }
+        }
+        fragmentFiles = new File[nFilenames];
+        fragmentStreams = new StreamI*[nFilenames];
+        ret.OSError = !fragmentFilenames.Seek(0LLU);
+        StreamString filename;
+        char8 term;
+        while ((ret) && (numberOfFragmentFiles < nFilenames) && (fragmentFilenames.GetToken(filename, ",", term))) {
+            ret.OSError = !fragmentFiles[numberOfFragmentFiles].Open(filename.Buffer(), BasicFile::ACCESS_MODE_R);
+            if (ret) {
+                fragmentStreams[numberOfFragmentFiles] = &fragmentFiles[numberOfFragmentFiles];
+                numberOfFragmentFiles++;
+            }
+            else {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to open the configuration fragment %s", filename.Buffer());
+            }
+            filename = "";
+        }
+        if (!ret) {
+            CloseConfigurationFragments();
+        }
+    }
+    fragments = fragmentStreams;
+    numberOfFragments = numberOfFragmentFiles;
     return ret;
 }
 
 ErrorManagement::ErrorType Bootstrap::Run() {
     ErrorManagement::ErrorType ret = inputConfigurationFile.Close();
+    //The configuration was already loaded
+    UnmapConfigurationImage();
+    CloseConfigurationFragments();
     if (ret) {
         mlockall(MCL_CURRENT | MCL_FUTURE);
         if(signal(SIGTERM, StopApp) == SIG_ERR){
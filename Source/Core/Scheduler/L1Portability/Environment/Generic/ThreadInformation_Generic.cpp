@@ -48,6 +48,7 @@ ThreadInformation::ThreadInformation() {
     userData = static_cast<void *>(NULL);
     name = static_cast<char8 *>(NULL);
     threadId = InvalidThreadIdentifier;
+    osThreadId = 0;
     priorityClass = Threads::UnknownPriorityClass;
     priorityLevel = 0u;
     /*lint -e{534} possible failure is not handled nor propagated.*/
@@ -74,6 +75,7 @@ ThreadInformation::ThreadInformation(const ThreadFunctionType threadFunction,
         }
     }
     threadId = InvalidThreadIdentifier;
+    osThreadId = 0;
     priorityClass = Threads::UnknownPriorityClass;
     priorityLevel = 0u;
     /*lint -e{534} possible failure is not handled nor propagated.*/
@@ -103,6 +105,7 @@ void ThreadInformation::Copy(const ThreadInformation &threadInfo) {
     }
     name = StringHelper::StringDup(threadInfo.name);
     threadId = threadInfo.threadId;
+    osThreadId = threadInfo.osThreadId;
     priorityClass = threadInfo.priorityClass;
     priorityLevel = threadInfo.priorityLevel;
 }
@@ -133,6 +136,14 @@ void ThreadInformation::SetPriorityLevel(const uint8 &newPriorityLevel) {
     this->priorityLevel = newPriorityLevel;
 }
 
+int32 ThreadInformation::GetOSThreadId() const {
+    return osThreadId;
+}
+
+void ThreadInformation::SetOSThreadId(const int32 newOSThreadId) {
+    this->osThreadId = newOSThreadId;
+}
+
 ThreadIdentifier ThreadInformation::GetThreadIdentifier() const {
     return threadId;
 }
@@ -35,6 +35,8 @@
 #include "StringHelper.h"
 #include "ErrorManagement.h"
 #include "FastPollingMutexSem.h"
+#include "HashIndex.h"
+#include "WyHashFunction.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -64,6 +66,52 @@ static uint32 maxNOfEntries = 0u;
  */
 static ThreadInformation **entries = static_cast<ThreadInformation **>(NULL);
 
+/**
+ * Index of entries by ThreadIdentifier. Allocated and freed together with entries.
+ */
+static HashIndex<uint32, WyHashFunction> *entriesIndex = static_cast<HashIndex<uint32, WyHashFunction> *>(NULL);
+
+#ifdef THREAD_LOCAL
+/**
+ * The ThreadInformation of the calling thread (see SetCurrentThreadInformation).
+ */
+static THREAD_LOCAL ThreadInformation *currentThreadInformation = static_cast<ThreadInformation *>(NULL);
+
+/**
+ * The index in entries of currentThreadInformation.
+ */
+static THREAD_LOCAL uint32 currentThreadIndex = 0u;
+#endif
+
+/**
+ * @brief Computes the entriesIndex key of a ThreadIdentifier.
+ */
+static uint32 ThreadsDatabaseKey(const ThreadIdentifier &threadId) {
+    /*lint -e{927} the identifier is hashed as a sequence of bytes.*/
+    return entriesIndex->Key(reinterpret_cast<const char8 *>(&threadId), static_cast<uint32>(sizeof(ThreadIdentifier)));
+}
+
+/**
+ * @brief Searches the index in entries of a ThreadIdentifier.
+ * @return true if the thread is in the database.
+ */
+static bool ThreadsDatabaseSearch(const ThreadIdentifier &threadId,
+                                  uint32 &entryIndex) {
+    bool found = false;
+    if (entriesIndex != NULL) {
+        uint32 key = ThreadsDatabaseKey(threadId);
+        uint32 cursor = 0u;
+        uint32 candidate = 0u;
+        while ((!found) && (entriesIndex->Search(key, cursor, candidate))) {
+            found = (entries[candidate]->GetThreadIdentifier() == threadId);
+            if (found) {
+                entryIndex = candidate;
+            }
+        }
+    }
+    return found;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -81,7 +129,12 @@ bool NewEntry(ThreadInformation * const threadInformation) {
                 if (entries[index] == NULL) {
                     entries[index] = threadInformation;
                     nOfEntries++;
-                    ok = true;
+                    ok = entriesIndex->Insert(ThreadsDatabaseKey(threadInformation->GetThreadIdentifier()), index);
+                    if (!ok) {
+                        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Error: cannot index the thread");
+                        entries[index] = static_cast<ThreadInformation *>(NULL);
+                        nOfEntries--;
+                    }
                     break;
                 }
                 index++;
@@ -100,31 +153,28 @@ bool NewEntry(ThreadInformation * const threadInformation) {
 
 ThreadInformation *RemoveEntry(const ThreadIdentifier &threadId) {
     ThreadInformation *threadInfo = static_cast<ThreadInformation *>(NULL);
-    // search for empty space staring from guess
     uint32 index = 0u;
-    while (index < maxNOfEntries) {
-        ThreadInformation *threadInfoIdx = entries[index];
-        if (threadInfoIdx != NULL) {
-            if (threadInfoIdx->GetThreadIdentifier() == threadId) {
-                entries[index] = static_cast<ThreadInformation *>(NULL);
-                nOfEntries--;
-
-                // free at the end
-                if (nOfEntries == 0u) {
-                    /*lint -e{9025} We are passing a double-pointer to a reference */
-                    /*lint -e{929} Type handled inside HeapManager::Free through a HeapI interface */
-                    bool ok = HeapManager::Free(reinterpret_cast<void *&>(entries));
-                    if (!ok) {
-                        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Error: database memory cleanup failed");
-                    }
-                    //For AllocMore to reallocate again!
-                    maxNOfEntries = 0u;
-                }
-                threadInfo = threadInfoIdx;
-                break;
+    if (ThreadsDatabaseSearch(threadId, index)) {
+        threadInfo = entries[index];
+        if (!entriesIndex->Remove(ThreadsDatabaseKey(threadId), index)) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Error: the thread is not indexed");
+        }
+        entries[index] = static_cast<ThreadInformation *>(NULL);
+        nOfEntries--;
+
+        // free at the end
+        if (nOfEntries == 0u) {
+            /*lint -e{9025} We are passing a double-pointer to a reference */
+            /*lint -e{929} Type handled inside HeapManager::Free through a HeapI interface */
+            bool ok = HeapManager::Free(reinterpret_cast<void *&>(entries));
+            if (!ok) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Error: database memory cleanup failed");
             }
+            delete entriesIndex;
+            entriesIndex = static_cast<HashIndex<uint32, WyHashFunction> *>(NULL);
+            //For AllocMore to reallocate again!
+            maxNOfEntries = 0u;
         }
-        index++;
     }
 
     return threadInfo;
@@ -133,21 +183,40 @@ ThreadInformation *RemoveEntry(const ThreadIdentifier &threadId) {
 
 ThreadInformation *GetThreadInformation(const ThreadIdentifier &threadId) {
     ThreadInformation *threadInfo = static_cast<ThreadInformation *>(NULL);
-    // search for empty space staring from guess
-    uint32 index = 0u;
-    while (index < maxNOfEntries) {
-        ThreadInformation *threadInfoIdx = entries[index];
-        if (threadInfoIdx != NULL) {
-            if (threadInfoIdx->GetThreadIdentifier() == threadId) {
-                threadInfo = threadInfoIdx;
-                break;
+#ifdef THREAD_LOCAL
+    //The cached entry is only used if it is still in the database (e.g. it could have been killed), so that it is never dereferenced after being freed
+    if (currentThreadInformation != NULL) {
+        if (currentThreadIndex < maxNOfEntries) {
+            if (entries[currentThreadIndex] == currentThreadInformation) {
+                if (currentThreadInformation->GetThreadIdentifier() == threadId) {
+                    threadInfo = currentThreadInformation;
+                }
             }
         }
-        index++;
+    }
+#endif
+    uint32 index = 0u;
+    if (threadInfo == NULL) {
+        if (ThreadsDatabaseSearch(threadId, index)) {
+            threadInfo = entries[index];
+        }
     }
     return threadInfo;
 }
 
+void SetCurrentThreadInformation(const ThreadIdentifier &threadId) {
+#ifdef THREAD_LOCAL
+    uint32 index = 0u;
+    if (ThreadsDatabaseSearch(threadId, index)) {
+        currentThreadInformation = entries[index];
+        currentThreadIndex = index;
+    }
+    else {
+        currentThreadInformation = static_cast<ThreadInformation *>(NULL);
+    }
+#endif
+}
+
 bool Lock() {
     ErrorManagement::ErrorType err = internalMutex.FastLock();
     return (err == ErrorManagement::NoError);
@@ -230,6 +299,7 @@ bool AllocMore() {
             if (entries != NULL) {
                 maxNOfEntries = THREADS_DATABASE_GRANULARITY;
                 nOfEntries = 0u;
+                entriesIndex = new HashIndex<uint32, WyHashFunction>();
             }
             else {
                 REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Error: memory allocation for the database failed");
@@ -58,12 +58,22 @@ namespace ThreadsDatabase {
 
     /**
      * @brief Returns the ThreadInformation associated to a given ThreadIidentifier.
+     * @details Constant time (see SetCurrentThreadInformation).
      * @param[in] threadId the ThreadIdentifier of the requested thread.
      * @return the ThreadInformation object related to the to the requested ThreadIdentifier, or NULL if the
      * ThreadIdentifier does not exist in the database.
      */
     DLL_API ThreadInformation *GetThreadInformation(const ThreadIdentifier &threadId);
 
+    /**
+     * @brief Caches, for the calling thread, its ThreadInformation so that GetThreadInformation(threadId) does not search the database.
+     * @details Shall be called by the thread itself, after its entry was added. The other threads are found with a hashed index
+     * by ThreadIdentifier.
+     * @param[in] threadId the ThreadIdentifier of the calling thread.
+     * @pre the database is locked.
+     */
+    DLL_API void SetCurrentThreadInformation(const ThreadIdentifier &threadId);
+
     /**
      * @brief Locks a spinlock mutex to allow exclusive access to the database.
      * @return false if the mutex lock fails.
@@ -25,9 +25,12 @@
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
 
-#include <pthread.h>
-#include <math.h>
-#include <sys/timeb.h>
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -35,6 +38,7 @@
 #include "Atomic.h"
 #include "ErrorManagement.h"
 #include "EventSem.h"
+#include "Trace.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -42,34 +46,35 @@
 
 namespace MARTe {
 
-/*lint -e{9109} forward declaration in EventSem.h is required to define the class*/
-struct EventSemProperties {
+/**
+ * Bit of the futex word which is set when the barrier is lowered (i.e. after a Post).
+ */
+static const int32 EVENTSEM_POSTED = 0x1;
 
-    /**
-     * Mutex Handle
-     */
-    pthread_mutex_t mutexHandle;
+/**
+ * Bit of the futex word which is set when at least one thread is (or is about to be) blocked in the kernel.
+ */
+static const int32 EVENTSEM_WAITERS = 0x2;
 
-    /**
-     * Mutex Attributes
-     */
-    pthread_mutexattr_t mutexAttributes;
+/**
+ * The remaining bits of the futex word count the number of Post calls, so that a thread which was
+ * woken up is released even if the semaphore was Reset before it is rescheduled.
+ */
+static const int32 EVENTSEM_GENERATION = 0x4;
+
+/*lint -e{9109} forward declaration in EventSem.h is required to define the class*/
+struct EventSemProperties {
 
     /**
-     * Conditional Variable
+     * The futex word. A Post counter (in units of EVENTSEM_GENERATION) and the EVENTSEM_POSTED and EVENTSEM_WAITERS bits.
      */
-    pthread_cond_t eventVariable;
+    volatile int32 futexWord;
 
     /**
      * The number of handle references pointing at this structure.
      */
     uint32 references;
 
-    /**
-     * Implementation of the barrier in Linux. When true the EventSem will stop.
-     */
-    bool stop;
-
     /**
      * Is the semaphore closed?
      */
@@ -77,6 +82,40 @@ struct EventSemProperties {
 
 };
 
+/**
+ * @brief Blocks the calling thread while *word == expected.
+ * @param[in] word the futex word.
+ * @param[in] expected the value that keeps the thread blocked.
+ * @param[in] deadline absolute CLOCK_MONOTONIC deadline or NULL to wait forever.
+ * @return 0 if woken up (possibly spuriously) or the errno value (ETIMEDOUT if the deadline expired).
+ */
+static int32 EventSemFutexWait(volatile int32 *word,
+                               const int32 expected,
+                               const struct timespec *deadline) {
+    /*lint -e{923} the futex syscall requires this cast*/
+    long ret = syscall(SYS_futex, word, FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG, expected, deadline, NULL, FUTEX_BITSET_MATCH_ANY);
+    return (ret == 0) ? (0) : (errno);
+}
+
+/**
+ * @brief Wakes all the threads blocked on the futex word.
+ * @param[in] word the futex word.
+ * @return true if the syscall succeeded.
+ */
+static bool EventSemFutexWakeAll(volatile int32 *word) {
+    long ret = syscall(SYS_futex, word, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, INT_MAX, NULL, NULL, 0);
+    return (ret >= 0);
+}
+
+/**
+ * @brief Gets the identifier of the name with which the blocking waits are traced (registered on the first call).
+ * @return the identifier of the name "EventSem".
+ */
+static uint32 EventSemTraceNameId() {
+    static const uint32 traceNameId = Trace::RegisterName("EventSem");
+    return traceNameId;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -88,7 +127,7 @@ EventSem::EventSem() {
     handle = new EventSemProperties();
     handle->closed = true;
     handle->references = 1u;
-    handle->stop = true;
+    handle->futexWord = 0;
     mux.Create();
 }
 
@@ -134,24 +173,9 @@ EventSem::~EventSem() {
 bool EventSem::Create() {
     bool ok = false;
     if (mux.FastLock() == ErrorManagement::NoError) {
+        Atomic::StoreRelease(&handle->futexWord, 0);
         handle->closed = false;
-        handle->stop = true;
-        ok = (pthread_mutexattr_init(&handle->mutexAttributes) == 0);
-        if (ok) {
-            ok = (pthread_mutex_init(&handle->mutexHandle, &handle->mutexAttributes) == 0);
-            if (ok) {
-                ok = (pthread_cond_init(&handle->eventVariable, static_cast<const pthread_condattr_t *>(NULL)) == 0);
-                if (!ok) {
-                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_cond_init()");
-                }
-            }
-            else {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutex_init()");
-            }
-        }
-        else {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutexattr_init()");
-        }
+        ok = true;
     }
     mux.FastUnLock();
     return ok;
@@ -160,120 +184,79 @@ bool EventSem::Create() {
 /*lint -e{613} guaranteed by design that it is not possible to call this function with a NULL
  * reference to handle*/
 bool EventSem::Close() {
-    bool ok = true;
     if (!handle->closed) {
-        handle->closed = true;
         /*lint -e{534} the post is allowed to fail (and it will if the semaphore was never used).
          *The semaphore has to be closed whatever the result.*/
         Post();
-        ok = (pthread_mutexattr_destroy(&handle->mutexAttributes) == 0);
-        if (ok) {
-            ok = (pthread_mutex_destroy(&handle->mutexHandle) == 0);
-            if (!ok) {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutex_destroy()");
-            }
-        }
-        else {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutexattr_destroy()");
-        }
-        if (ok) {
-            ok = (pthread_cond_destroy(&handle->eventVariable) == 0);
-            if (!ok) {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_cond_destroy()");
-            }
-        }
+        handle->closed = true;
     }
-    return ok;
+    return true;
 }
 
 /*lint -e{613} guaranteed by design that it is not possible to call this function with a NULL
  * reference to handle*/
 ErrorManagement::ErrorType EventSem::Wait() {
-    bool ok = false;
-    ErrorManagement::ErrorType err = ErrorManagement::NoError;
-    if (!handle->closed) {
-        bool okLock = (pthread_mutex_lock(&handle->mutexHandle) == 0);
-        if (!okLock) {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutex_lock()");
-        }
-
-        bool okWait = true;
-        if (handle->stop) {
-            okWait = (pthread_cond_wait(&handle->eventVariable, &handle->mutexHandle) == 0);
-        }
-        if (!okWait) {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_cond_wait()");
-        }
-
-        bool okUnLock = (pthread_mutex_unlock(&handle->mutexHandle) == 0);
-        if (!okUnLock) {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutex_unlock()");
-        }
-        ok = (okLock && okWait && okUnLock);
-        if (!ok) {
-            err = ErrorManagement::OSError;
-        }
-    }
-    else {
-        err = ErrorManagement::FatalError;
-        REPORT_ERROR_STATIC_0(err, "Error: the semaphore handle is closed");
-    }
-
-    return err;
+    return Wait(TTInfiniteWait);
 }
 
 /*lint -e{613} guaranteed by design that it is not possible to call this function with a NULL
  * reference to handle*/
 ErrorManagement::ErrorType EventSem::Wait(const TimeoutType &timeout) {
-    bool ok = !handle->closed;
     ErrorManagement::ErrorType err = ErrorManagement::NoError;
-    if (timeout == TTInfiniteWait) {
-        err = Wait();
-    }
-    else {
-        if (ok) {
-            struct timespec timesValues;
-            timeb tb;
-            ok = (ftime(&tb) == 0);
-
-            if (ok) {
-                float64 sec = static_cast<float64>(timeout.GetTimeoutMSec());
-                sec += static_cast<float64>(tb.millitm);
-                sec *= 1e-3;
-                sec += static_cast<float64>(tb.time);
-
-                float64 roundValue = floor(sec);
-                timesValues.tv_sec = static_cast<int32>(roundValue);
-                float64 nSec = (sec - roundValue);
-                nSec *= 1e9;
-                timesValues.tv_nsec = static_cast<int32>(nSec);
-                ok = (pthread_mutex_timedlock(&handle->mutexHandle, &timesValues) == 0);
-                if (ok) {
-                    if (handle->stop) {
-                        ok = (pthread_cond_timedwait(&handle->eventVariable, &handle->mutexHandle, &timesValues) == 0);
-                        if (!ok) {
-                            err = ErrorManagement::Timeout;
-                    //        REPORT_ERROR_STATIC_0(err, "Information: timeout occurred");
-                        }
-                    }
-                }
-
-                /*lint -e{455} false positive from that does not understand that pthread_mutex_timedlock locks the semaphore*/
-                bool okOs = (pthread_mutex_unlock(&handle->mutexHandle) == 0);
-                if (!okOs) {
-                    err = ErrorManagement::OSError;
-                    REPORT_ERROR_STATIC_0(err, "Error: pthread_mutex_unlock()");
+    if (!handle->closed) {
+        bool infinite = (timeout == TTInfiniteWait);
+        struct timespec deadline;
+        if (!infinite) {
+            if (clock_gettime(CLOCK_MONOTONIC, &deadline) == 0) {
+                uint64 usec = timeout.GetTimeoutUSec();
+                deadline.tv_sec += static_cast<time_t>(usec / 1000000u);
+                deadline.tv_nsec += static_cast<long>((usec % 1000000u) * 1000u);
+                if (deadline.tv_nsec >= 1000000000L) {
+                    deadline.tv_nsec -= 1000000000L;
+                    deadline.tv_sec++;
                 }
             }
             else {
                 err = ErrorManagement::OSError;
-                REPORT_ERROR_STATIC_0(err, "Error: ftime()");
+                REPORT_ERROR_STATIC_0(err, "Error: clock_gettime()");
             }
         }
-        else {
-            err = ErrorManagement::FatalError;
-            REPORT_ERROR_STATIC_0(err, "Error: the semaphore handle is closed");
+        /* Fast path: if the barrier is already lowered there is no syscall. */
+        int32 value = Atomic::LoadAcquire(&handle->futexWord);
+        const int32 generation = (value & ~(EVENTSEM_POSTED | EVENTSEM_WAITERS));
+        bool blocked = false;
+        while ((err == ErrorManagement::NoError) && ((value & EVENTSEM_POSTED) == 0) && ((value & ~EVENTSEM_WAITERS) == generation)) {
+            /* Only the waits that block are traced. */
+            if (!blocked) {
+                blocked = true;
+                MARTe2_TRACE_EVENT(Trace::EVENT_SEMAPHORE_WAIT_BEGIN, EventSemTraceNameId(), 0u)
+            }
+            if ((value & EVENTSEM_WAITERS) == 0) {
+                /* Announce that the Post will have to wake someone. */
+                if (!Atomic::CompareExchange(&handle->futexWord, value, (value | EVENTSEM_WAITERS), Atomic::MemoryOrderAcquire)) {
+                    continue;
+                }
+                value |= EVENTSEM_WAITERS;
+            }
+            int32 ret = EventSemFutexWait(&handle->futexWord, value, infinite ? static_cast<const struct timespec *>(NULL) : &deadline);
+            if (ret == ETIMEDOUT) {
+                err = ErrorManagement::Timeout;
+            }
+            else if ((ret != 0) && (ret != EAGAIN) && (ret != EINTR)) {
+                err = ErrorManagement::OSError;
+                REPORT_ERROR_STATIC_0(err, "Error: futex(FUTEX_WAIT)");
+            }
+            else {
+                value = Atomic::LoadAcquire(&handle->futexWord);
+            }
         }
+        if (blocked) {
+            MARTe2_TRACE_EVENT(Trace::EVENT_SEMAPHORE_WAIT_END, EventSemTraceNameId(), 0u)
+        }
+    }
+    else {
+        err = ErrorManagement::FatalError;
+        REPORT_ERROR_STATIC_0(err, "Error: the semaphore handle is closed");
     }
     return err;
 }
@@ -283,11 +266,21 @@ ErrorManagement::ErrorType EventSem::Wait(const TimeoutType &timeout) {
 bool EventSem::Post() {
     bool ok = false;
     if (!handle->closed) {
-        bool okLock = (pthread_mutex_lock(&handle->mutexHandle) == 0);
-        handle->stop = false;
-        bool okUnLock = (pthread_mutex_unlock(&handle->mutexHandle) == 0);
-        bool okBroadcast = (pthread_cond_broadcast(&handle->eventVariable) == 0);
-        ok = (okLock && okUnLock && okBroadcast);
+        /* Fast path: if nobody is waiting there is no syscall. */
+        int32 previous = Atomic::Load(&handle->futexWord, Atomic::MemoryOrderRelaxed);
+        int32 next;
+        do {
+            /*lint -e{9130} bitwise operations on signed values are intended (the counter is allowed to wrap)*/
+            next = static_cast<int32>(((static_cast<uint32>(previous) + static_cast<uint32>(EVENTSEM_GENERATION)) & ~static_cast<uint32>(EVENTSEM_WAITERS)) | static_cast<uint32>(EVENTSEM_POSTED));
+        }
+        while (!Atomic::CompareExchange(&handle->futexWord, previous, next, Atomic::MemoryOrderAcquireRelease));
+        ok = true;
+        if ((previous & EVENTSEM_WAITERS) != 0) {
+            ok = EventSemFutexWakeAll(&handle->futexWord);
+            if (!ok) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: futex(FUTEX_WAKE)");
+            }
+        }
     }
 
     return ok;
@@ -298,10 +291,13 @@ bool EventSem::Post() {
 bool EventSem::Reset() {
     bool ok = false;
     if (!handle->closed) {
-        bool okLock = (pthread_mutex_lock(&handle->mutexHandle) == 0);
-        bool okUnLock = (pthread_mutex_unlock(&handle->mutexHandle) == 0);
-        ok = (okLock && okUnLock);
-        handle->stop = true;
+        int32 value = Atomic::Load(&handle->futexWord, Atomic::MemoryOrderRelaxed);
+        while ((value & EVENTSEM_POSTED) != 0) {
+            if (Atomic::CompareExchange(&handle->futexWord, value, (value & ~EVENTSEM_POSTED), Atomic::MemoryOrderAcquireRelease)) {
+                value = 0;
+            }
+        }
+        ok = true;
     }
     return ok;
 }
@@ -25,9 +25,12 @@
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
 
+#include <errno.h>
+#include <linux/futex.h>
 #include <pthread.h>
-#include <math.h>
-#include <sys/timeb.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -45,14 +48,15 @@ namespace MARTe {
 struct MutexSemProperties {
 
     /**
-     * Mutex Handle
+     * The priority-inheritance futex word. Holds the TID of the owner (0 if unlocked) and,
+     * when there are waiters blocked in the kernel, the FUTEX_WAITERS bit.
      */
-    pthread_mutex_t mutexHandle;
+    volatile int32 futexWord;
 
     /**
-     * Mutex Attributes
+     * Number of times the owner has locked a recursive semaphore.
      */
-    pthread_mutexattr_t mutexAttributes;
+    uint32 recursionCount;
 
     /**
      * The number of handle references pointing at this structure.
@@ -76,6 +80,64 @@ struct MutexSemProperties {
 
 };
 
+/**
+ * Cached kernel thread identifier of the calling thread (0 until first used).
+ */
+static __thread int32 mutexSemThreadId = 0;
+
+/**
+ * @brief Gets the kernel thread identifier of the calling thread.
+ * @return the TID as stored in the priority-inheritance futex word.
+ */
+static inline int32 MutexSemGetThreadId() {
+    if (mutexSemThreadId == 0) {
+        mutexSemThreadId = static_cast<int32>(syscall(SYS_gettid));
+    }
+    return mutexSemThreadId;
+}
+
+/**
+ * @brief Locks (or tries to lock up to the deadline) the priority-inheritance futex.
+ * @details The uncontended case is a single compare-and-swap. Otherwise the kernel queues the
+ * thread and boosts the priority of the owner (FUTEX_LOCK_PI).
+ * @param[in] properties the semaphore properties.
+ * @param[in] deadline the absolute CLOCK_REALTIME deadline or NULL to wait forever.
+ * @return ErrorManagement::NoError if the lock was acquired, ErrorManagement::Timeout if
+ * the deadline expired or ErrorManagement::OSError otherwise.
+ */
+static ErrorManagement::ErrorType MutexSemLockPI(MutexSemProperties * const properties,
+                                                 const struct timespec * const deadline) {
+    ErrorManagement::ErrorType err = ErrorManagement::NoError;
+    int32 tid = MutexSemGetThreadId();
+    bool owner = ((Atomic::Load(&properties->futexWord, Atomic::MemoryOrderRelaxed) & FUTEX_TID_MASK) == tid);
+    if ((owner) && (properties->recursive)) {
+        properties->recursionCount++;
+    }
+    else {
+        int32 expected = 0;
+        if (!Atomic::CompareExchange(&properties->futexWord, expected, tid, Atomic::MemoryOrderAcquire)) {
+            long ret = -1;
+            do {
+                ret = syscall(SYS_futex, &properties->futexWord, FUTEX_LOCK_PI | FUTEX_PRIVATE_FLAG, 0, deadline, NULL, 0);
+            }
+            while ((ret != 0) && (errno == EINTR));
+            if (ret != 0) {
+                if (errno == ETIMEDOUT) {
+                    err = ErrorManagement::Timeout;
+                }
+                else {
+                    err = ErrorManagement::OSError;
+                    REPORT_ERROR_STATIC_0(err, "Error: futex(FUTEX_LOCK_PI)");
+                }
+            }
+        }
+        if (err == ErrorManagement::NoError) {
+            properties->recursionCount = 1u;
+        }
+    }
+    return err;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -89,6 +151,8 @@ MutexSem::MutexSem() {
     handle->recursive = false;
     handle->references = 1u;
     handle->referencesMux = 0;
+    handle->futexWord = 0;
+    handle->recursionCount = 0u;
 }
 
 MutexSem::MutexSem(MutexSem &source) {
@@ -132,65 +196,21 @@ MutexSem::~MutexSem() {
 bool MutexSem::Create(const bool &recursive) {
     while (!Atomic::TestAndSet(&handle->referencesMux)) {
     }
+    handle->recursive = recursive;
+    handle->recursionCount = 0u;
+    Atomic::StoreRelease(&handle->futexWord, 0);
     handle->closed = false;
-    bool ok = (pthread_mutexattr_init(&handle->mutexAttributes) == 0);
-    if (ok) {
-        ok = (pthread_mutexattr_setprotocol(&handle->mutexAttributes, PTHREAD_PRIO_INHERIT) == 0);
-
-        if (ok) {
-            if (recursive) {
-                //The deadlock condition causes a crash at operating system level.
-                ok = (pthread_mutexattr_settype(&handle->mutexAttributes, PTHREAD_MUTEX_RECURSIVE) == 0);
-                handle->recursive = true;
-            }
-            else {
-                //This was pthread PTHREAD_MUTEX_RECURSIVE but it was crashing when a deadlock was forced on purpose
-                //with PTHREAD_MUTEX_NORMAL the same thread cannot lock the semaphore without unlocking it first.
-                ok = (pthread_mutexattr_settype(&handle->mutexAttributes, PTHREAD_MUTEX_NORMAL) == 0);
-                if (!ok) {
-                    REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutexattr_settype()");
-                }
-                handle->recursive = false;
-            }
-        }
-        else {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutexattr_setprotocol()");
-        }
-
-
-        if (ok) {
-            ok = (pthread_mutex_init(&handle->mutexHandle, &handle->mutexAttributes) == 0);
-            if (!ok) {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutex_init()");
-            }
-        }
-
-    }
-    else {
-        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutexattr_init()");
-    }
     handle->referencesMux = 0;
-    return ok;
+    return true;
 }
 
 /*lint -e{613} guaranteed by design that it is not possible to call this function with a NULL
  * reference to handle*/
 bool MutexSem::Close() {
-    bool ok = true;
     if (!handle->closed) {
         handle->closed = true;
-        ok = (pthread_mutexattr_destroy(&handle->mutexAttributes) == 0);
-        if (ok) {
-            ok = (pthread_mutex_destroy(&handle->mutexHandle) == 0);
-            if (!ok) {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutex_destroy()");
-            }
-        }
-        else {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutexattr_destroy()");
-        }
     }
-    return ok;
+    return true;
 }
 
 /*lint -e{613} guaranteed by design that it is not possible to call this function with a NULL
@@ -200,16 +220,12 @@ ErrorManagement::ErrorType MutexSem::Lock() {
     ErrorManagement::ErrorType err = ErrorManagement::NoError;
     if (!handle->closed) {
         bool okCancel = (pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, static_cast<int32 *>(NULL)) == 0);
-        bool okLock = (pthread_mutex_lock(&handle->mutexHandle) == 0);
+        err = MutexSemLockPI(handle, static_cast<const struct timespec *>(NULL));
 
         if (!okCancel) {
             err = ErrorManagement::OSError;
             REPORT_ERROR_STATIC_0(err, "Error: pthread_setcancelstate()");
         }
-        if (!okLock) {
-            err = ErrorManagement::OSError;
-            REPORT_ERROR_STATIC_0(err, "Error: pthread_mutex_lock()");
-        }
     }
     else {
         err = ErrorManagement::FatalError;
@@ -229,33 +245,26 @@ ErrorManagement::ErrorType MutexSem::Lock(const TimeoutType &timeout) {
     }
     else {
         if (ok) {
-            struct timespec timesValues;
-            timeb tb;
-            ok = (ftime(&tb) == 0);
+            /* FUTEX_LOCK_PI takes an absolute CLOCK_REALTIME deadline. */
+            struct timespec deadline;
+            ok = (clock_gettime(CLOCK_REALTIME, &deadline) == 0);
 
             if (ok) {
-                float64 sec = static_cast<float64>(timeout.GetTimeoutMSec());
-                sec += static_cast<float64>(tb.millitm);
-                sec *= 1e-3;
-                sec += static_cast<float64>(tb.time);
-
-                float64 roundValue = floor(sec);
-                timesValues.tv_sec = static_cast<int32>(roundValue);
-                float64 nSec = (sec - roundValue);
-                nSec *= 1e9;
-                timesValues.tv_nsec = static_cast<int32>(nSec);
-
-                ok = (pthread_mutex_timedlock(&handle->mutexHandle, &timesValues) == 0);
-                if (!ok) {
-                    err = ErrorManagement::Timeout;
-                    REPORT_ERROR_STATIC_0(err, "Information: timeout occurred");
+                uint64 usec = timeout.GetTimeoutUSec();
+                deadline.tv_sec += static_cast<time_t>(usec / 1000000u);
+                deadline.tv_nsec += static_cast<long>((usec % 1000000u) * 1000u);
+                if (deadline.tv_nsec >= 1000000000L) {
+                    deadline.tv_nsec -= 1000000000L;
+                    deadline.tv_sec++;
                 }
-                else {
-                    err = ErrorManagement::NoError;
+
+                err = MutexSemLockPI(handle, &deadline);
+                if (err == ErrorManagement::Timeout) {
+                    REPORT_ERROR_STATIC_0(err, "Information: timeout occurred");
                 }
             }
             else {
-                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: ftime()");
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: clock_gettime()");
             }
         }
         else {
@@ -271,17 +280,28 @@ ErrorManagement::ErrorType MutexSem::Lock(const TimeoutType &timeout) {
 bool MutexSem::UnLock() {
     bool ok = false;
     if (!handle->closed) {
-        /*lint -e{455} false positive, locked by the Lock function*/
-        ok = (pthread_mutex_unlock(&handle->mutexHandle) == 0);
+        if (handle->recursionCount > 1u) {
+            handle->recursionCount--;
+            ok = true;
+        }
+        else {
+            handle->recursionCount = 0u;
+            int32 expected = MutexSemGetThreadId();
+            /* Fast path: no waiters (the kernel would have set FUTEX_WAITERS), no syscall. */
+            ok = Atomic::CompareExchange(&handle->futexWord, expected, 0, Atomic::MemoryOrderRelease);
+            if (!ok) {
+                ok = (syscall(SYS_futex, &handle->futexWord, FUTEX_UNLOCK_PI | FUTEX_PRIVATE_FLAG, 0, NULL, NULL, 0) == 0);
+            }
+            if (!ok) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: futex(FUTEX_UNLOCK_PI)");
+            }
+        }
         if (ok) {
             ok = (pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, static_cast<int32 *>(NULL)) == 0);
             if (!ok) {
                 REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_setcancelstate()");
             }
         }
-        else {
-            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "Error: pthread_mutex_unlock()");
-        }
     }
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Error: the semaphore handle is closed");
@@ -25,6 +25,9 @@
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
@@ -48,6 +51,225 @@ uint32 Available() {
     return static_cast<uint32>(sysconf(_SC_NPROCESSORS_ONLN));
 }
 
+/**
+ * Maximum number of core clusters that can be discovered.
+ */
+static const uint32 PROCESSOR_MAX_CLUSTERS = 16u;
+
+/**
+ * @brief Reads the first line of a sysfs file.
+ * @param[in] path the file path.
+ * @param[out] line the buffer where to write the line (without the trailing new line).
+ * @param[in] lineSize the size of \a line.
+ * @return true if the file could be read.
+ */
+static bool ReadSysLine(const char8 * const path,
+                        char8 * const line,
+                        const uint32 lineSize) {
+    bool ok = false;
+    FILE *sysFile = fopen(path, "r");
+    if (sysFile != NULL) {
+        ok = (fgets(line, static_cast<int32>(lineSize), sysFile) != NULL);
+        (void) fclose(sysFile);
+    }
+    if (ok) {
+        char8 *newLine = strchr(line, '\n');
+        if (newLine != NULL) {
+            *newLine = '\0';
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Parses a Linux cpu list (e.g. 0,2-3,8).
+ * @param[in] list the cpu list.
+ * @return the mask of the CPUs in the list.
+ */
+static ProcessorType ParseCPUList(const char8 * const list) {
+    ProcessorType cpus(0u);
+    const char8 *token = list;
+    while ((token != NULL) && (*token != '\0')) {
+        char8 *end = NULL_PTR(char8 *);
+        uint32 first = static_cast<uint32>(strtoul(token, &end, 10));
+        if (end == token) {
+            token = NULL_PTR(const char8 *);
+        }
+        else {
+            uint32 last = first;
+            if (*end == '-') {
+                token = &end[1];
+                last = static_cast<uint32>(strtoul(token, &end, 10));
+            }
+            for (uint32 c = first; c <= last; c++) {
+                cpus.AddCPU(c + 1u);
+            }
+            token = (*end == ',') ? (&end[1]) : (NULL_PTR(const char8 *));
+        }
+    }
+    return cpus;
+}
+
+/**
+ * @brief Parses a sysfs cache size (e.g. 32K, 2048K or 2M).
+ * @param[in] size the size string.
+ * @return the size in bytes.
+ */
+static uint32 ParseCacheSize(const char8 * const size) {
+    char8 *end = NULL_PTR(char8 *);
+    uint32 value = static_cast<uint32>(strtoul(size, &end, 10));
+    if (*end == 'K') {
+        value *= 1024u;
+    }
+    else if (*end == 'M') {
+        value *= (1024u * 1024u);
+    }
+    else {
+        //Already in bytes
+    }
+    return value;
+}
+
+/**
+ * @brief Discovers the core clusters.
+ * @param[out] clusterMainId the MainId of each cluster.
+ * @param[out] clusterCapacity the Capacity of each cluster.
+ * @return the number of clusters, sorted by decreasing capacity.
+ */
+static uint32 DiscoverClusters(uint32 (&clusterMainId)[PROCESSOR_MAX_CLUSTERS],
+                               uint32 (&clusterCapacity)[PROCESSOR_MAX_CLUSTERS]) {
+    uint32 numberOfClusters = 0u;
+    uint32 numberOfCPUs = static_cast<uint32>(sysconf(_SC_NPROCESSORS_CONF));
+    for (uint32 cpu = 0u; cpu < numberOfCPUs; cpu++) {
+        uint32 mainId = MainId(cpu);
+        uint32 capacity = Capacity(cpu);
+        bool found = false;
+        for (uint32 k = 0u; (k < numberOfClusters) && (!found); k++) {
+            found = ((clusterMainId[k] == mainId) && (clusterCapacity[k] == capacity));
+        }
+        if ((!found) && (numberOfClusters < PROCESSOR_MAX_CLUSTERS)) {
+            //Insertion sort by decreasing capacity
+            uint32 k = numberOfClusters;
+            while ((k > 0u) && (clusterCapacity[k - 1u] < capacity)) {
+                clusterMainId[k] = clusterMainId[k - 1u];
+                clusterCapacity[k] = clusterCapacity[k - 1u];
+                k--;
+            }
+            clusterMainId[k] = mainId;
+            clusterCapacity[k] = capacity;
+            numberOfClusters++;
+        }
+    }
+    return numberOfClusters;
+}
+
+uint32 CacheLineSize() {
+    uint32 lineSize = DataCacheLineSizeRegister();
+    if (lineSize == 0u) {
+        char8 line[32];
+        if (ReadSysLine("/sys/devices/system/cpu/cpu0/cache/index0/coherency_line_size", &line[0], static_cast<uint32>(sizeof(line)))) {
+            lineSize = static_cast<uint32>(strtoul(&line[0], NULL_PTR(char8 **), 10));
+        }
+    }
+    if (lineSize == 0u) {
+        long sysLineSize = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+        if (sysLineSize > 0) {
+            lineSize = static_cast<uint32>(sysLineSize);
+        }
+    }
+    if (lineSize == 0u) {
+        lineSize = 64u;
+    }
+    return lineSize;
+}
+
+uint32 CacheSize(const uint32 cpu,
+                 const uint32 level) {
+    uint32 size = 0u;
+    bool exists = true;
+    for (uint32 index = 0u; (exists) && (size == 0u); index++) {
+        char8 path[128];
+        char8 line[32];
+        (void) snprintf(&path[0], sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/level", cpu, index);
+        exists = ReadSysLine(&path[0], &line[0], static_cast<uint32>(sizeof(line)));
+        if (exists) {
+            if (static_cast<uint32>(strtoul(&line[0], NULL_PTR(char8 **), 10)) == level) {
+                (void) snprintf(&path[0], sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/type", cpu, index);
+                if (ReadSysLine(&path[0], &line[0], static_cast<uint32>(sizeof(line)))) {
+                    if (strcmp(&line[0], "Instruction") != 0) {
+                        (void) snprintf(&path[0], sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/size", cpu, index);
+                        if (ReadSysLine(&path[0], &line[0], static_cast<uint32>(sizeof(line)))) {
+                            size = ParseCacheSize(&line[0]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return size;
+}
+
+uint32 MainId(const uint32 cpu) {
+    uint32 mainId = 0u;
+    char8 path[128];
+    char8 line[32];
+    (void) snprintf(&path[0], sizeof(path), "/sys/devices/system/cpu/cpu%u/regs/identification/midr_el1", cpu);
+    if (ReadSysLine(&path[0], &line[0], static_cast<uint32>(sizeof(line)))) {
+        mainId = static_cast<uint32>(strtoul(&line[0], NULL_PTR(char8 **), 16));
+    }
+    return mainId;
+}
+
+uint32 Capacity(const uint32 cpu) {
+    uint32 capacity = 1024u;
+    char8 path[128];
+    char8 line[32];
+    (void) snprintf(&path[0], sizeof(path), "/sys/devices/system/cpu/cpu%u/cpu_capacity", cpu);
+    if (ReadSysLine(&path[0], &line[0], static_cast<uint32>(sizeof(line)))) {
+        capacity = static_cast<uint32>(strtoul(&line[0], NULL_PTR(char8 **), 10));
+    }
+    return capacity;
+}
+
+uint32 NumberOfClusters() {
+    uint32 clusterMainId[PROCESSOR_MAX_CLUSTERS];
+    uint32 clusterCapacity[PROCESSOR_MAX_CLUSTERS];
+    return DiscoverClusters(clusterMainId, clusterCapacity);
+}
+
+ProcessorType ClusterCPUs(const uint32 cluster) {
+    ProcessorType cpus(0u);
+    uint32 clusterMainId[PROCESSOR_MAX_CLUSTERS];
+    uint32 clusterCapacity[PROCESSOR_MAX_CLUSTERS];
+    uint32 numberOfClusters = DiscoverClusters(clusterMainId, clusterCapacity);
+    if (cluster < numberOfClusters) {
+        uint32 numberOfCPUs = static_cast<uint32>(sysconf(_SC_NPROCESSORS_CONF));
+        for (uint32 cpu = 0u; cpu < numberOfCPUs; cpu++) {
+            if ((MainId(cpu) == clusterMainId[cluster]) && (Capacity(cpu) == clusterCapacity[cluster])) {
+                cpus.AddCPU(cpu + 1u);
+            }
+        }
+    }
+    return cpus;
+}
+
+ProcessorType IsolatedCPUs() {
+    char8 line[256];
+    if (!ReadSysLine("/sys/devices/system/cpu/isolated", &line[0], static_cast<uint32>(sizeof(line)))) {
+        line[0] = '\0';
+    }
+    return ParseCPUList(&line[0]);
+}
+
+ProcessorType NoHzFullCPUs() {
+    char8 line[256];
+    if (!ReadSysLine("/sys/devices/system/cpu/nohz_full", &line[0], static_cast<uint32>(sizeof(line)))) {
+        line[0] = '\0';
+    }
+    //When nohz_full is not enabled the kernel reports "(null)"
+    return ParseCPUList(&line[0]);
+}
+
 }
 
 }
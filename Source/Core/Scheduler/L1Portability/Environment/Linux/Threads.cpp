@@ -25,8 +25,14 @@
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
 
+#include <alloca.h>
 #include <pthread.h>
 #include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -53,11 +59,17 @@ namespace Threads {
 static void* SystemThreadFunction(ThreadInformation *const threadInfo) {
 
     if (threadInfo != NULL) {
+        threadInfo->SetOSThreadId(static_cast<int32>(syscall(SYS_gettid)));
 
         //Guarantee that the OS finishes the housekeeping before releasing the thread to the user
         ErrorManagement::ErrorType err = threadInfo->ThreadWait();
         //Start the user thread
         if (err == ErrorManagement::NoError) {
+            //The entry was added by BeginThread before the ThreadPost
+            if (ThreadsDatabase::Lock()) {
+                ThreadsDatabase::SetCurrentThreadInformation(Threads::Id());
+            }
+            ThreadsDatabase::UnLock();
             threadInfo->UserThreadFunction();
 
             bool ok = ThreadsDatabase::Lock();
@@ -88,6 +100,55 @@ static ThreadInformation* threadInitialisationInterfaceConstructor(const ThreadF
     return new ThreadInformation(userThreadFunction, userData, threadName);
 }
 
+/**
+ * @brief Reads the first \a size - 1 bytes of a /proc/self/task/TID/ file.
+ * @param[in] tid the Linux thread identifier.
+ * @param[in] fileName the name of the file in the task directory.
+ * @param[out] buffer where the zero terminated content is written.
+ * @param[in] size the size of \a buffer.
+ * @return true if the file could be read.
+ */
+static bool ReadTaskFile(const int32 tid,
+                         const char8 * const fileName,
+                         char8 * const buffer,
+                         const uint32 size) {
+    char8 path[64];
+    /*lint -e{960} -e{1960} snprintf is required to build the /proc path.*/
+    (void) snprintf(&path[0], sizeof(path), "/proc/self/task/%d/%s", tid, fileName);
+    FILE *taskFile = fopen(&path[0], "r");
+    bool ok = (taskFile != NULL);
+    if (ok) {
+        size_t nRead = fread(buffer, 1u, static_cast<size_t>(size - 1u), taskFile);
+        buffer[nRead] = '\0';
+        (void) fclose(taskFile);
+        ok = (nRead > 0u);
+    }
+    return ok;
+}
+
+/**
+ * @brief Gets the value of a "name: value" line of a /proc/self/task/TID/ file.
+ * @param[in] content the content of the file.
+ * @param[in] name the name of the value.
+ * @return the value or 0 if \a name is not found.
+ */
+static uint64 GetTaskFileValue(const char8 * const content,
+                               const char8 * const name) {
+    uint64 value = 0u;
+    const char8 *line = strstr(content, name);
+    if (line != NULL) {
+        line = strchr(line, ':');
+    }
+    if (line != NULL) {
+        unsigned long long valueRead = 0u;
+        /*lint -e{960} -e{1960} sscanf is required to parse the /proc files.*/
+        if (sscanf(&line[1], "%llu", &valueRead) == 1) {
+            value = static_cast<uint64>(valueRead);
+        }
+    }
+    return value;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -97,8 +158,8 @@ ThreadStateType GetState(const ThreadIdentifier &threadId) {
     return UnknownThreadStateType;
 }
 
-uint32 GetCPUs(const ThreadIdentifier &threadId) {
-    uint32 cpus = 0u;
+ProcessorType GetCPUs(const ThreadIdentifier &threadId) {
+    ProcessorType cpus(UndefinedCPUs);
     (void) ThreadsDatabase::Lock();
     cpu_set_t cpuset;
     CPU_ZERO(&cpuset);
@@ -106,8 +167,8 @@ uint32 GetCPUs(const ThreadIdentifier &threadId) {
         int32 j;
         for (j = 0; j < CPU_SETSIZE; j++) {
             if (CPU_ISSET(j, &cpuset) > 0) {
-                uint32 cpuBit = 1u;
-                cpus |= (cpuBit << j);
+                //AddCPU numbers the CPUs from 1
+                cpus.AddCPU(static_cast<uint32>(j) + 1u);
             }
         }
     }
@@ -182,6 +243,67 @@ void SetPriority(const ThreadIdentifier &threadId,
     ThreadsDatabase::UnLock();
 }
 
+#ifndef SCHED_DEADLINE
+#define SCHED_DEADLINE 6
+#endif
+
+/**
+ * @brief sched_attr as defined by the Linux kernel (not exported by all the C libraries).
+ */
+struct ThreadsSchedAttr {
+    uint32 size;
+    uint32 schedPolicy;
+    uint64 schedFlags;
+    int32 schedNice;
+    uint32 schedPriority;
+    uint64 schedRuntime;
+    uint64 schedDeadline;
+    uint64 schedPeriod;
+};
+
+bool SetDeadline(const uint64 runtime,
+                 const uint64 deadline,
+                 const uint64 period) {
+    bool ok = ((runtime <= deadline) && (deadline <= period) && (runtime > 0u));
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "SetDeadline: runtime <= deadline <= period shall hold and runtime > 0");
+    }
+#ifdef SYS_sched_setattr
+    if (ok) {
+        ThreadsSchedAttr attr;
+        (void) memset(&attr, 0, sizeof(attr));
+        attr.size = static_cast<uint32>(sizeof(attr));
+        attr.schedPolicy = static_cast<uint32>(SCHED_DEADLINE);
+        attr.schedRuntime = runtime;
+        attr.schedDeadline = deadline;
+        attr.schedPeriod = period;
+        //pid 0 is the calling thread
+        ok = (syscall(SYS_sched_setattr, 0, &attr, 0u) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "Failed to set the SCHED_DEADLINE policy (likely due to insufficient permissions, CPU affinity or failed admission control)");
+        }
+    }
+#else
+    if (ok) {
+        ok = false;
+        REPORT_ERROR_STATIC_0(ErrorManagement::UnsupportedFeature, "SCHED_DEADLINE is not supported in this platform");
+    }
+#endif
+    return ok;
+}
+
+void PrefaultStack(const uint32 size) {
+    if (size > 0u) {
+        /*lint -e{9005} alloca is the only portable way to reserve a variable amount of stack*/
+        volatile char8 *stackArea = static_cast<volatile char8 *>(alloca(static_cast<osulong>(size)));
+        const uint32 pageSize = static_cast<uint32>(sysconf(_SC_PAGESIZE));
+        for (uint32 i = 0u; i < size; i += pageSize) {
+            stackArea[i] = '\0';
+        }
+        stackArea[size - 1u] = '\0';
+    }
+}
+
 uint8 GetPriorityLevel(const ThreadIdentifier &threadId) {
     uint8 priorityLevel = 0u;
 
@@ -405,6 +527,103 @@ const char8* Name(const ThreadIdentifier &threadId) {
     return name;
 }
 
+bool GetRuntimeStatistics(const ThreadIdentifier &threadId,
+                          RuntimeStatistics &statistics) {
+    statistics.userTime = 0u;
+    statistics.systemTime = 0u;
+    statistics.runQueueWaitTime = 0u;
+    statistics.voluntaryContextSwitches = 0u;
+    statistics.involuntaryContextSwitches = 0u;
+    statistics.migrations = 0u;
+    statistics.minorPageFaults = 0u;
+    statistics.majorPageFaults = 0u;
+    statistics.lastCPU = 0u;
+    bool self = (pthread_equal(threadId, Id()) != 0);
+    int32 tid = 0;
+    if (self) {
+        tid = static_cast<int32>(syscall(SYS_gettid));
+    }
+    else if (ThreadsDatabase::Lock()) {
+        ThreadInformation *threadInfo = ThreadsDatabase::GetThreadInformation(threadId);
+        if (threadInfo != NULL) {
+            tid = threadInfo->GetOSThreadId();
+        }
+        ThreadsDatabase::UnLock();
+    }
+    else {
+        ThreadsDatabase::UnLock();
+    }
+    char8 content[4096];
+    bool ok = (tid > 0);
+    if (ok) {
+        ok = ReadTaskFile(tid, "stat", &content[0], static_cast<uint32>(sizeof(content)));
+    }
+    if (ok) {
+        //The fields after the (comm), which may contain spaces. Field 3 is the state.
+        const char8 *field = strrchr(&content[0], ')');
+        ok = (field != NULL);
+        uint32 fieldNumber = 2u;
+        uint64 clockTicks = static_cast<uint64>(sysconf(_SC_CLK_TCK));
+        while ((ok) && (field != NULL) && (fieldNumber < 39u)) {
+            field = strchr(&field[1], ' ');
+            if (field != NULL) {
+                fieldNumber++;
+                unsigned long long valueRead = 0u;
+                /*lint -e{960} -e{1960} sscanf is required to parse the /proc files.*/
+                bool isNumber = (sscanf(&field[1], "%llu", &valueRead) == 1);
+                uint64 value = static_cast<uint64>(valueRead);
+                if (isNumber) {
+                    if (fieldNumber == 10u) {
+                        statistics.minorPageFaults = value;
+                    }
+                    else if (fieldNumber == 12u) {
+                        statistics.majorPageFaults = value;
+                    }
+                    else if ((fieldNumber == 14u) && (clockTicks > 0u)) {
+                        statistics.userTime = (value * 1000000ull) / clockTicks;
+                    }
+                    else if ((fieldNumber == 15u) && (clockTicks > 0u)) {
+                        statistics.systemTime = (value * 1000000ull) / clockTicks;
+                    }
+                    else if (fieldNumber == 39u) {
+                        statistics.lastCPU = static_cast<uint32>(value);
+                    }
+                    else {
+                        //Field not used
+                    }
+                }
+            }
+        }
+    }
+    if (ok) {
+        if (ReadTaskFile(tid, "status", &content[0], static_cast<uint32>(sizeof(content)))) {
+            statistics.voluntaryContextSwitches = GetTaskFileValue(&content[0], "\nvoluntary_ctxt_switches");
+            statistics.involuntaryContextSwitches = GetTaskFileValue(&content[0], "nonvoluntary_ctxt_switches");
+        }
+        if (ReadTaskFile(tid, "schedstat", &content[0], static_cast<uint32>(sizeof(content)))) {
+            unsigned long long runTime = 0u;
+            unsigned long long waitTime = 0u;
+            /*lint -e{960} -e{1960} sscanf is required to parse the /proc files.*/
+            if (sscanf(&content[0], "%llu %llu", &runTime, &waitTime) == 2) {
+                statistics.runQueueWaitTime = static_cast<uint64>(waitTime) / 1000u;
+            }
+        }
+        //Only available if the kernel has CONFIG_SCHED_DEBUG
+        if (ReadTaskFile(tid, "sched", &content[0], static_cast<uint32>(sizeof(content)))) {
+            statistics.migrations = GetTaskFileValue(&content[0], "se.nr_migrations");
+        }
+    }
+    if ((ok) && (self)) {
+        //Micro-second resolution for the calling thread
+        struct rusage usage;
+        if (getrusage(RUSAGE_THREAD, &usage) == 0) {
+            statistics.userTime = (static_cast<uint64>(usage.ru_utime.tv_sec) * 1000000ull) + static_cast<uint64>(usage.ru_utime.tv_usec);
+            statistics.systemTime = (static_cast<uint64>(usage.ru_stime.tv_sec) * 1000000ull) + static_cast<uint64>(usage.ru_stime.tv_usec);
+        }
+    }
+    return ok;
+}
+
 ThreadIdentifier FindByIndex(const uint32 &n) {
     return ThreadsDatabase::GetThreadID(n);
 }
@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "GeneralDefinitions.h"
+#include "ProcessorType.h"
 #include INCLUDE_FILE_ARCHITECTURE(BareMetal,L1Portability,ARCHITECTURE,ProcessorA.h)
 
 /*---------------------------------------------------------------------------*/
@@ -65,6 +66,64 @@ namespace MARTe {
          * @returns the number of available CPU cores.
          */
         DLL_API uint32 Available();
+
+        /**
+         * @brief Returns the size of the data cache line.
+         * @details Read from the architecture registers (CTR_EL0 in ARMv8) or, if not available, from the operating system.
+         * @return the cache line size in bytes (64 if it cannot be discovered).
+         */
+        DLL_API uint32 CacheLineSize();
+
+        /**
+         * @brief Returns the size of the data (or unified) cache of a given level as seen by a given CPU.
+         * @param[in] cpu the CPU number (starting at 0).
+         * @param[in] level the cache level (1 for L1, 2 for L2, ...).
+         * @return the cache size in bytes or 0 if the cache does not exist or cannot be discovered.
+         */
+        DLL_API uint32 CacheSize(const uint32 cpu, const uint32 level);
+
+        /**
+         * @brief Returns the main identification register of a given CPU (MIDR_EL1 in ARMv8).
+         * @details Encodes the implementer, variant, part number (i.e. the core type) and revision.
+         * @param[in] cpu the CPU number (starting at 0).
+         * @return the main identification register or 0 if it cannot be discovered.
+         */
+        DLL_API uint32 MainId(const uint32 cpu);
+
+        /**
+         * @brief Returns the relative computing capacity of a given CPU.
+         * @details In heterogeneous systems (e.g. big.LITTLE or DynamIQ) the fastest cores have capacity 1024.
+         * @param[in] cpu the CPU number (starting at 0).
+         * @return the CPU capacity or 1024 if it cannot be discovered.
+         */
+        DLL_API uint32 Capacity(const uint32 cpu);
+
+        /**
+         * @brief Returns the number of core clusters.
+         * @details A cluster is a group of CPUs with the same core type (MainId) and capacity. Clusters are numbered
+         * by decreasing capacity, i.e. cluster 0 holds the fastest cores.
+         * @return the number of core clusters.
+         */
+        DLL_API uint32 NumberOfClusters();
+
+        /**
+         * @brief Returns the CPUs which belong to a given cluster.
+         * @param[in] cluster the cluster number (see NumberOfClusters).
+         * @return the mask of the CPUs in the cluster (empty if the cluster does not exist).
+         */
+        DLL_API ProcessorType ClusterCPUs(const uint32 cluster);
+
+        /**
+         * @brief Returns the CPUs which are isolated from the general purpose scheduler (e.g. isolcpus kernel parameter).
+         * @return the mask of the isolated CPUs (empty if none).
+         */
+        DLL_API ProcessorType IsolatedCPUs();
+
+        /**
+         * @brief Returns the CPUs running without the periodic scheduler tick (e.g. nohz_full kernel parameter).
+         * @return the mask of the tick-less CPUs (empty if none).
+         */
+        DLL_API ProcessorType NoHzFullCPUs();
     }
 
 }
@@ -0,0 +1,129 @@
+/**
+ * @file SpinningBarrier.cpp
+ * @brief Source file for class SpinningBarrier
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SpinningBarrier (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "SpinningBarrier.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+SpinningBarrier::SpinningBarrier() {
+    arrived = 0;
+    generation = 0;
+    forced = 0;
+    numberOfActors = 0u;
+    spinTicks = 0u;
+}
+
+/*lint -e{1551} ForcePass does not throw exceptions*/
+SpinningBarrier::~SpinningBarrier() {
+    (void) ForcePass();
+}
+
+bool SpinningBarrier::Create(const uint32 numberOfActorsIn,
+                             const uint64 spinTicksIn) {
+    bool ret = (numberOfActorsIn > 0u);
+    if (ret) {
+        numberOfActors = numberOfActorsIn;
+        spinTicks = spinTicksIn;
+        Atomic::Store(&arrived, 0, Atomic::MemoryOrderRelaxed);
+        Atomic::Store(&forced, 0, Atomic::MemoryOrderRelaxed);
+        if (phaseSem[0u].IsClosed()) {
+            ret = phaseSem[0u].Create();
+        }
+        if ((ret) && (phaseSem[1u].IsClosed())) {
+            ret = phaseSem[1u].Create();
+        }
+        if (ret) {
+            int32 currentGeneration = Atomic::Load(&generation, Atomic::MemoryOrderRelaxed);
+            ret = phaseSem[static_cast<uint32>(currentGeneration) & 0x1u].Reset();
+        }
+    }
+    return ret;
+}
+
+ErrorManagement::ErrorType SpinningBarrier::Wait() {
+    ErrorManagement::ErrorType err;
+    int32 myGeneration = Atomic::LoadAcquire(&generation);
+    if (Atomic::LoadAcquire(&forced) == 0) {
+        uint32 phase = (static_cast<uint32>(myGeneration) & 0x1u);
+        int32 nArrived = Atomic::FetchAdd(&arrived, 1, Atomic::MemoryOrderAcquireRelease) + 1;
+        if (static_cast<uint32>(nArrived) >= numberOfActors) {
+            Atomic::Store(&arrived, 0, Atomic::MemoryOrderRelaxed);
+            //Nobody can wait on the semaphore of the next phase before the generation is incremented.
+            err = !phaseSem[phase ^ 0x1u].Reset();
+            Atomic::StoreRelease(&generation, myGeneration + 1);
+            //No syscall is performed if no thread is blocked.
+            if (!phaseSem[phase].Post()) {
+                err = ErrorManagement::OSError;
+            }
+        }
+        else {
+            uint64 ticksStop = HighResolutionTimer::Counter() + spinTicks;
+            bool spin = (spinTicks > 0u);
+            while ((Atomic::LoadAcquire(&generation) == myGeneration) && (Atomic::LoadAcquire(&forced) == 0) && (err.ErrorsCleared())) {
+                if (spin) {
+                    Atomic::WaitWhileEqual(&generation, myGeneration);
+                    spin = (HighResolutionTimer::Counter() < ticksStop);
+                }
+                else {
+                    err = phaseSem[phase].Wait();
+                }
+            }
+        }
+    }
+    return err;
+}
+
+bool SpinningBarrier::ForcePass() {
+    Atomic::StoreRelease(&forced, 1);
+    (void) Atomic::FetchAdd(&generation, 1, Atomic::MemoryOrderAcquireRelease);
+    bool ret = true;
+    if (!phaseSem[0u].IsClosed()) {
+        ret = phaseSem[0u].Post();
+    }
+    if (!phaseSem[1u].IsClosed()) {
+        ret = (phaseSem[1u].Post()) && (ret);
+    }
+    return ret;
+}
+
+uint32 SpinningBarrier::GetNumberOfActors() const {
+    return numberOfActors;
+}
+
+}
@@ -0,0 +1,157 @@
+/**
+ * @file SpinningBarrier.h
+ * @brief Header file for class SpinningBarrier
+ * @date 14/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SpinningBarrier
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SPINNINGBARRIER_H_
+#define SPINNINGBARRIER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "EventSem.h"
+#include "GeneralDefinitions.h"
+#include "HighResolutionTimer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Size of the padding used to keep the barrier shared variables in different cache lines.
+ */
+static const uint32 SPINNING_BARRIER_CACHE_LINE_SIZE = 64u;
+
+/**
+ * @brief Sense-reversing barrier which spins before blocking.
+ *
+ * @details Each call to Wait blocks the caller until numberOfActors threads have called Wait.
+ * The last thread to arrive reverses the barrier sense (implemented as a generation counter, so that
+ * no thread local state is needed) which releases all the other threads.
+ *
+ * @details The waiting threads first spin (using Atomic::WaitWhileEqual, i.e. WFE on ARMv8) on the
+ * generation counter for up to spinTicks HighResolutionTimer ticks and then block on an EventSem.
+ * Two EventSem are alternated between consecutive phases so that a semaphore is never reset while
+ * threads of the phase that it serves can still be waiting on it.
+ *
+ * @details The arrival counter and the generation counter are kept in different cache lines to avoid
+ * the releasing store being delayed by the arrivals.
+ */
+class DLL_API SpinningBarrier {
+public:
+
+    /**
+     * @brief Constructor. The barrier must be created before being used.
+     */
+    SpinningBarrier();
+
+    /**
+     * @brief Destructor. Releases any thread waiting on the barrier.
+     */
+    ~SpinningBarrier();
+
+    /**
+     * @brief Creates the barrier for a number of actors.
+     * @param[in] numberOfActorsIn the number of threads that have to call Wait before they are all released.
+     * @param[in] spinTicksIn the number of HighResolutionTimer ticks to spin before blocking (0 to block immediately).
+     * @return true if the internal semaphores could be created and numberOfActorsIn > 0.
+     */
+    bool Create(const uint32 numberOfActorsIn,
+                const uint64 spinTicksIn);
+
+    /**
+     * @brief Waits for all the actors to arrive at the barrier.
+     * @return ErrorManagement::NoError if the barrier was released (or forcefully passed) or
+     * ErrorManagement::OSError if the blocking semaphore returned an error.
+     * @pre Create()
+     */
+    ErrorManagement::ErrorType Wait();
+
+    /**
+     * @brief Releases all the threads waiting on the barrier and lets any future Wait pass until the next Create.
+     * @return true if the internal semaphores could be posted.
+     */
+    bool ForcePass();
+
+    /**
+     * @brief Gets the number of actors given at Create time.
+     * @return the number of actors.
+     */
+    uint32 GetNumberOfActors() const;
+
+private:
+
+    /**
+     * Number of threads that have already arrived in the current phase.
+     */
+    volatile int32 arrived;
+
+    /**
+     * Keeps arrived and generation in different cache lines.
+     */
+    uint8 paddingArrived[SPINNING_BARRIER_CACHE_LINE_SIZE - sizeof(int32)];
+
+    /**
+     * Incremented by the last arriving thread of each phase.
+     */
+    volatile int32 generation;
+
+    /**
+     * Keeps generation and the remaining members in different cache lines.
+     */
+    uint8 paddingGeneration[SPINNING_BARRIER_CACHE_LINE_SIZE - sizeof(int32)];
+
+    /**
+     * Set by ForcePass.
+     */
+    volatile int32 forced;
+
+    /**
+     * Number of threads to wait for.
+     */
+    uint32 numberOfActors;
+
+    /**
+     * Number of ticks to spin before blocking.
+     */
+    uint64 spinTicks;
+
+    /**
+     * Semaphores where the threads block after spinning (one for even and one for odd phases).
+     */
+    EventSem phaseSem[2];
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SPINNINGBARRIER_H_ */
+
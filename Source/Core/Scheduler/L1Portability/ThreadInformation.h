@@ -142,6 +142,18 @@ public:
      */
     void SetPriorityLevel(const uint8 &newPriorityLevel);
 
+    /**
+     * @brief Returns the operating system identifier of the thread (e.g. the Linux TID).
+     * @return the operating system identifier or 0 if unknown.
+     */
+    int32 GetOSThreadId() const;
+
+    /**
+     * @brief Updates the operating system identifier of the thread.
+     * @param newOSThreadId the operating system identifier.
+     */
+    void SetOSThreadId(const int32 newOSThreadId);
+
 private:
 
     /**
@@ -149,6 +161,11 @@ private:
      */
     ThreadIdentifier threadId;
 
+    /**
+     * The operating system identifier of the thread
+     */
+    int32 osThreadId;
+
     /**
      * The thread priority class
      */
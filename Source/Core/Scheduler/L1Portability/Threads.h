@@ -123,6 +123,57 @@ enum PriorityClassType {
     RealTimePriorityClass
 };
 
+/**
+ * @brief Runtime behaviour of a thread since it was started (see GetRuntimeStatistics).
+ * @details The counters which are not available in a given operating system are set to 0.
+ */
+struct RuntimeStatistics {
+    /**
+     * CPU time spent in user mode (micro-seconds).
+     */
+    uint64 userTime;
+
+    /**
+     * CPU time spent in kernel mode (micro-seconds).
+     */
+    uint64 systemTime;
+
+    /**
+     * Time spent ready to run but waiting for a CPU (micro-seconds).
+     */
+    uint64 runQueueWaitTime;
+
+    /**
+     * Number of times the thread gave up the CPU (e.g. blocked on a semaphore or sleeping).
+     */
+    uint64 voluntaryContextSwitches;
+
+    /**
+     * Number of times the thread was pre-empted.
+     */
+    uint64 involuntaryContextSwitches;
+
+    /**
+     * Number of times the thread moved to another CPU.
+     */
+    uint64 migrations;
+
+    /**
+     * Page faults served without I/O.
+     */
+    uint64 minorPageFaults;
+
+    /**
+     * Page faults which required I/O.
+     */
+    uint64 majorPageFaults;
+
+    /**
+     * The CPU where the thread last run.
+     */
+    uint32 lastCPU;
+};
+
 /**
  * @brief Changes the thread priority level for the already set priority class.
  * @details The currently set priority class (GetPriorityClass()) will not be changed.
@@ -135,6 +186,28 @@ DLL_API void SetPriority(const ThreadIdentifier &threadId,
                          const PriorityClassType &priorityClass,
                          const uint8 &priorityLevel);
 
+/**
+ * @brief Sets the calling thread under the deadline (constant bandwidth server) scheduling policy.
+ * @details In Linux this is the SCHED_DEADLINE policy, whose admission control guarantees that the thread is
+ * given \a runtime nano-seconds of CPU every \a period nano-seconds, within \a deadline nano-seconds of the period start.
+ * It overrides the priority class and level set with SetPriority.
+ * @param[in] runtime the CPU time reserved in each period (in nano-seconds).
+ * @param[in] deadline the relative deadline (in nano-seconds). Shall be runtime <= deadline <= period.
+ * @param[in] period the reservation period (in nano-seconds).
+ * @return true if the operating system accepted the reservation.
+ */
+DLL_API bool SetDeadline(const uint64 runtime,
+                         const uint64 deadline,
+                         const uint64 period);
+
+/**
+ * @brief Touches the first \a size bytes of the calling thread stack.
+ * @details Forces the operating system to map (and, if the process memory is locked, to lock) the stack pages
+ * before the thread enters its real-time loop, so that the first cycles do not take page faults.
+ * @param[in] size the number of stack bytes to prefault. Shall be smaller than the thread stack size.
+ */
+DLL_API void PrefaultStack(const uint32 size);
+
 /**
  * @brief Start a new thread.
  * @details This function will dynamically allocate an object of type
@@ -214,9 +287,18 @@ DLL_API PriorityClassType GetPriorityClass(const ThreadIdentifier &threadId);
 /**
  * @brief Returns the CPU mask associated to the specified thread.
  * @param[in] threadId is the thread identifier.
- * @return the CPU mask or 0 if the information cannot be retrieved.
+ * @return the CPU mask (with all the CPUs of the thread affinity, also above 31) or an empty mask if the information cannot be retrieved.
+ */
+DLL_API ProcessorType GetCPUs(const ThreadIdentifier &threadId);
+
+/**
+ * @brief Gets the runtime behaviour (CPU time, context switches, migrations and page faults) of a thread.
+ * @param[in] threadId the thread identifier.
+ * @param[out] statistics the thread runtime statistics.
+ * @return true if the thread is known and its statistics could be read.
  */
-DLL_API uint32 GetCPUs(const ThreadIdentifier &threadId);
+DLL_API bool GetRuntimeStatistics(const ThreadIdentifier &threadId,
+                                  RuntimeStatistics &statistics);
 
 /**
  * @brief Returns the id of the n-th thread in the database.
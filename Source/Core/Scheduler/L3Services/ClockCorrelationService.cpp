@@ -0,0 +1,134 @@
+/**
+ * @file ClockCorrelationService.cpp
+ * @brief Source file for class ClockCorrelationService
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ClockCorrelationService (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ClockCorrelation.h"
+#include "ClockCorrelationService.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+ClockCorrelationService::ClockCorrelationService() :
+        Object(), EmbeddedServiceMethodBinderI(), executor(*this) {
+    period = 1000u;
+    (void) periodSem.Create();
+}
+
+/*lint -e{1551} the destructor must guarantee that the sampling thread is stopped*/
+ClockCorrelationService::~ClockCorrelationService() {
+    if (Stop() != ErrorManagement::NoError) {
+        if (Stop() != ErrorManagement::NoError) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not Stop the sampling thread");
+        }
+    }
+    (void) periodSem.Close();
+}
+
+bool ClockCorrelationService::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    if (ok) {
+        (void) data.Read("Period", period);
+        ok = (period > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Period must be > 0");
+        }
+    }
+    if (ok) {
+        StreamString device;
+        if (data.Read("Device", device)) {
+            ok = ClockCorrelation::SetReferenceClock(device.Buffer());
+        }
+        else {
+            ok = ClockCorrelation::SetReferenceClock();
+        }
+        if (ok) {
+            ok = ClockCorrelation::Sample();
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Could not read the reference clock");
+        }
+    }
+    if (ok) {
+        StreamString cpus;
+        if (data.Read("CPUs", cpus)) {
+            ProcessorType cpuMask;
+            ok = cpuMask.SetFromString(cpus.Buffer());
+            if (ok) {
+                executor.SetCPUMask(cpuMask);
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Invalid CPUs");
+            }
+        }
+    }
+    if (ok) {
+        uint32 stackSize;
+        if (data.Read("StackSize", stackSize)) {
+            executor.SetStackSize(stackSize);
+        }
+        executor.SetName(GetName());
+        ok = (executor.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start the sampling thread.");
+        }
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType ClockCorrelationService::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::StartupStage) {
+        (void) periodSem.Reset();
+    }
+    else if (info.GetStage() == ExecutionInfo::MainStage) {
+        //Stop posts the semaphore so that the thread does not wait for the end of the period
+        ErrorManagement::ErrorType err = periodSem.Wait(period);
+        if (err == ErrorManagement::Timeout) {
+            (void) ClockCorrelation::Sample();
+        }
+    }
+    else {
+        //Other stages not used.
+    }
+    return ErrorManagement::NoError;
+}
+
+ErrorManagement::ErrorType ClockCorrelationService::Stop() {
+    (void) periodSem.Post();
+    return executor.Stop();
+}
+
+CLASS_REGISTER(ClockCorrelationService, "1.0")
+}
@@ -0,0 +1,123 @@
+/**
+ * @file ClockCorrelationService.h
+ * @brief Header file for class ClockCorrelationService
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ClockCorrelationService
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CLOCKCORRELATIONSERVICE_H_
+#define CLOCKCORRELATIONSERVICE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "Object.h"
+#include "SingleThreadService.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Periodically samples the reference clock of the ClockCorrelation, so that the real-time threads can convert their
+ * HighResolutionTimer::Counter timestamps to UTC (see ClockCorrelation::CounterToUTC).
+ * @details The samples are taken by a SingleThreadService, which should run on a housekeeping CPU. The reference clock is the
+ * operating system real-time clock (disciplined by NTP or by a PTP daemon, e.g. phc2sys) or, if Device is set, the PTP hardware
+ * clock of the network card which receives the PTP messages. One instance is expected per application.
+ *
+ * The configuration syntax is (names are only given as an example):
+ *
+ * <pre>
+ * +ClockCorrelation = {
+ *     Class = ClockCorrelationService
+ *     Period = 1000 //Optional. The time between samples in milliseconds. Default is 1000.
+ *     Device = "/dev/ptp0" //Optional. The PTP hardware clock. Default is the operating system real-time clock.
+ *     CPUs = "0-0" //Optional. The CPUs where the sampling thread runs (see ProcessorType::SetFromString).
+ *     StackSize = 65536 //Optional. The stack size of the sampling thread.
+ * }
+ * </pre>
+ */
+class ClockCorrelationService: public Object, public EmbeddedServiceMethodBinderI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor.
+     */
+    ClockCorrelationService();
+
+    /**
+     * @brief Destructor. Stops the sampling thread.
+     */
+    virtual ~ClockCorrelationService();
+
+    /**
+     * @brief Reads the parameters (see class description), takes the first sample and starts the sampling thread.
+     * @param[in] data see class description.
+     * @return true if all the parameters are valid, the reference clock can be read and the thread could be started.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Callback function of the sampling thread (samples the reference clock every Period).
+     * @param[in] info see EmbeddedServiceMethodBinderI.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Stops the sampling thread.
+     * @return see SingleThreadService::Stop.
+     */
+    ErrorManagement::ErrorType Stop();
+
+private:
+
+    /**
+     * The sampling thread.
+     */
+    SingleThreadService executor;
+
+    /**
+     * Where the sampling thread waits between samples (posted by Stop).
+     */
+    EventSem periodSem;
+
+    /**
+     * The time between samples in milliseconds.
+     */
+    uint32 period;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* CLOCKCORRELATIONSERVICE_H_ */
@@ -48,6 +48,10 @@ EmbeddedServiceI::EmbeddedServiceI() :
     msecTimeout = TTInfiniteWait;
     cpuMask = UndefinedCPUs;
     stackSize = THREADS_DEFAULT_STACKSIZE;
+    deadlineRuntime = 0u;
+    deadlineDeadline = 0u;
+    deadlinePeriod = 0u;
+    prefaultStackSize = 0u;
 }
 
 EmbeddedServiceI::~EmbeddedServiceI() {
@@ -74,14 +78,72 @@ bool EmbeddedServiceI::Initialise(StructuredDataI &data) {
     if (data.Read("PriorityLevel", priorityLevelRead)) {
         SetPriorityLevel(priorityLevelRead);
     }
-    uint32 cpuMaskRead = 0u;
+    StreamString cpuMaskRead;
     if (data.Read("CPUMask", cpuMaskRead)) {
-        SetCPUMask(cpuMaskRead);
+        ProcessorType cpuMaskIn(UndefinedCPUs);
+        if (cpuMaskIn.SetFromString(cpuMaskRead.Buffer())) {
+            SetCPUMask(cpuMaskIn);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Invalid CPUMask %s", cpuMaskRead.Buffer());
+            err.parametersError = true;
+        }
+    }
+    AnyType allowedCPUsType = data.GetType("AllowedCPUs");
+    if (!allowedCPUsType.IsVoid()) {
+        uint32 numberOfAllowedCPUs = allowedCPUsType.GetNumberOfElements(0u);
+        if (numberOfAllowedCPUs > 0u) {
+            Vector<uint32> allowedCPUs(numberOfAllowedCPUs);
+            if (data.Read("AllowedCPUs", allowedCPUs)) {
+                ProcessorType allowedMask(UndefinedCPUs);
+                for (uint32 i = 0u; i < numberOfAllowedCPUs; i++) {
+                    //AddCPU numbers the CPUs from 1
+                    allowedMask.AddCPU(allowedCPUs[i] + 1u);
+                }
+                SetCPUMask(allowedMask);
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "AllowedCPUs shall be an array of CPU numbers.");
+                err.parametersError = true;
+            }
+        }
     }
     uint32 stackSizeRead = 0u;
     if (data.Read("StackSize", stackSizeRead)) {
         SetStackSize(stackSizeRead);
     }
+    uint32 prefaultStackSizeRead = 0u;
+    if (data.Read("PrefaultStackSize", prefaultStackSizeRead)) {
+        SetPrefaultStackSize(prefaultStackSizeRead);
+    }
+    if (data.MoveRelative("SchedDeadline")) {
+        uint32 runtimeRead = 0u;
+        uint32 deadlineRead = 0u;
+        uint32 periodRead = 0u;
+        if (!data.Read("Runtime", runtimeRead)) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "SchedDeadline.Runtime has to be specified.");
+            err.parametersError = true;
+        }
+        if (!data.Read("Period", periodRead)) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "SchedDeadline.Period has to be specified.");
+            err.parametersError = true;
+        }
+        if (!data.Read("Deadline", deadlineRead)) {
+            deadlineRead = periodRead;
+        }
+        if (err.ErrorsCleared()) {
+            err.parametersError = !((runtimeRead > 0u) && (runtimeRead <= deadlineRead) && (deadlineRead <= periodRead));
+            if (err.ErrorsCleared()) {
+                SetDeadline(static_cast<uint64>(runtimeRead) * 1000LLU, static_cast<uint64>(deadlineRead) * 1000LLU, static_cast<uint64>(periodRead) * 1000LLU);
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "SchedDeadline shall verify 0 < Runtime <= Deadline <= Period.");
+            }
+        }
+        if (!data.MoveToAncestor(1u)) {
+            err.parametersError = true;
+        }
+    }
     StreamString priorityClassStr;
     if (data.Read("PriorityClass", priorityClassStr)) {
         if (priorityClassStr == "IdlePriorityClass") {
@@ -134,6 +196,31 @@ void EmbeddedServiceI::SetStackSize(const uint32 stackSizeIn) {
     stackSize = stackSizeIn;
 }
 
+bool EmbeddedServiceI::GetDeadline(uint64 &runtimeOut,
+                                   uint64 &deadlineOut,
+                                   uint64 &periodOut) const {
+    runtimeOut = deadlineRuntime;
+    deadlineOut = deadlineDeadline;
+    periodOut = deadlinePeriod;
+    return (deadlinePeriod > 0u);
+}
+
+void EmbeddedServiceI::SetDeadline(const uint64 runtimeIn,
+                                   const uint64 deadlineIn,
+                                   const uint64 periodIn) {
+    deadlineRuntime = runtimeIn;
+    deadlineDeadline = deadlineIn;
+    deadlinePeriod = periodIn;
+}
+
+uint32 EmbeddedServiceI::GetPrefaultStackSize() const {
+    return prefaultStackSize;
+}
+
+void EmbeddedServiceI::SetPrefaultStackSize(const uint32 prefaultStackSizeIn) {
+    prefaultStackSize = prefaultStackSizeIn;
+}
+
 ProcessorType EmbeddedServiceI::GetCPUMask() const {
     return cpuMask;
 }
@@ -57,7 +57,9 @@ public:
      *   GetPriorityClass() == NormalPriorityClass &&
      *   GetTimeout() == TTInfiniteWait &&
      *   GetCPUMask() == UndefinedCPUs &&
-     *   GetStackSize() == THREADS_DEFAULT_STACKSIZE
+     *   GetStackSize() == THREADS_DEFAULT_STACKSIZE &&
+     *   GetDeadline() == false &&
+     *   GetPrefaultStackSize() == 0
      */
     EmbeddedServiceI();
 
@@ -85,7 +87,13 @@ public:
      * data may contain a parameter with name "PriorityLevel" holding the thread priority level (default is 0).
      * data may contain a parameter with name "PriorityClass" holding the thread priority class.
      *   Possible values are: IdlePriorityClass; NormalPriorityClass and RealTimePriorityClass (default is NormalPriorityClass)
-     * data may contain a parameter with name "CPUMask" holding the thread CPU affinity encoded as uint32 mask (default value is UndefinedCPUs).
+     * data may contain a parameter with name "CPUMask" holding the thread CPU affinity encoded as a mask (e.g. 0xF) or as a list
+     *   of CPUs (e.g. "0-3,64-67"), see ProcessorType::SetFromString (default value is UndefinedCPUs).
+     * data may contain an array with name "AllowedCPUs" holding the numbers (starting from 0) of the CPUs where the threads may run (e.g. the housekeeping CPUs,
+     *   so that the service threads do not run on the real-time CPUs). Overrides CPUMask.
+     * data may contain a block with name "SchedDeadline" holding the SCHED_DEADLINE reservation "Runtime", "Deadline" and "Period" in micro-seconds
+     *   (see Threads::SetDeadline). If the "Deadline" is not set, it is equal to the "Period".
+     * data may contain a parameter with name "PrefaultStackSize" holding the number of stack bytes to prefault when the thread starts (default is 0).
      * @return true if all the parameters are valid.
      */
     virtual bool Initialise(StructuredDataI &data);
@@ -138,6 +146,39 @@ public:
      */
     virtual void SetCPUMask(const ProcessorType& cpuMaskIn);
 
+    /**
+     * @brief Gets the thread SCHED_DEADLINE reservation.
+     * @param[out] runtimeOut the CPU time reserved in each period (in nano-seconds).
+     * @param[out] deadlineOut the relative deadline (in nano-seconds).
+     * @param[out] periodOut the reservation period (in nano-seconds).
+     * @return true if a reservation was set.
+     */
+    bool GetDeadline(uint64 &runtimeOut,
+                     uint64 &deadlineOut,
+                     uint64 &periodOut) const;
+
+    /**
+     * @brief Sets the thread SCHED_DEADLINE reservation (see EmbeddedThreadI::SetDeadline).
+     * @param[in] runtimeIn the CPU time reserved in each period (in nano-seconds).
+     * @param[in] deadlineIn the relative deadline (in nano-seconds).
+     * @param[in] periodIn the reservation period (in nano-seconds).
+     */
+    virtual void SetDeadline(const uint64 runtimeIn,
+                             const uint64 deadlineIn,
+                             const uint64 periodIn);
+
+    /**
+     * @brief Gets the number of stack bytes to be prefaulted when the thread starts.
+     * @return the number of stack bytes to be prefaulted.
+     */
+    uint32 GetPrefaultStackSize() const;
+
+    /**
+     * @brief Sets the number of stack bytes to be prefaulted when the thread starts (see EmbeddedThreadI::SetPrefaultStackSize).
+     * @param[in] prefaultStackSizeIn the number of stack bytes to be prefaulted.
+     */
+    virtual void SetPrefaultStackSize(const uint32 prefaultStackSizeIn);
+
     /**
      * @brief Sets the maximum time to execute a state change.
      * @param[in] msecTimeoutIn the maximum time in milliseconds to execute a state change.
@@ -176,6 +217,26 @@ protected:
      * The thread CPU mask
      */
     ProcessorType cpuMask;
+
+    /**
+     * The SCHED_DEADLINE runtime in nano-seconds
+     */
+    uint64 deadlineRuntime;
+
+    /**
+     * The SCHED_DEADLINE relative deadline in nano-seconds
+     */
+    uint64 deadlineDeadline;
+
+    /**
+     * The SCHED_DEADLINE period in nano-seconds (0 => not used)
+     */
+    uint64 deadlinePeriod;
+
+    /**
+     * The number of stack bytes to prefault
+     */
+    uint32 prefaultStackSize;
 };
 
 /*---------------------------------------------------------------------------*/
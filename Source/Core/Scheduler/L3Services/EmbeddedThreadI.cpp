@@ -40,6 +40,7 @@ static void ServiceThreadLauncher(const void * const parameters) {
 
     // call
     if (thread != NULL_PTR(EmbeddedThreadI *)) {
+        thread->PrepareThreadContext();
         thread->ThreadLoop();
     }
     else {
@@ -66,6 +67,10 @@ EmbeddedThreadI::EmbeddedThreadI(EmbeddedServiceMethodBinderI &binder) :
     priorityLevel = 0u;
     cpuMask = UndefinedCPUs;
     stackSize = THREADS_DEFAULT_STACKSIZE;
+    deadlineRuntime = 0u;
+    deadlineDeadline = 0u;
+    deadlinePeriod = 0u;
+    prefaultStackSize = 0u;
 }
 
 EmbeddedThreadI::EmbeddedThreadI(EmbeddedServiceMethodBinderI &binder, const uint16 threadNumberIn) :
@@ -80,6 +85,10 @@ EmbeddedThreadI::EmbeddedThreadI(EmbeddedServiceMethodBinderI &binder, const uin
     priorityLevel = 0u;
     cpuMask = UndefinedCPUs;
     stackSize = THREADS_DEFAULT_STACKSIZE;
+    deadlineRuntime = 0u;
+    deadlineDeadline = 0u;
+    deadlinePeriod = 0u;
+    prefaultStackSize = 0u;
     mux.Create();
 }
 
@@ -305,6 +314,51 @@ void EmbeddedThreadI::SetCPUMask(const ProcessorType& cpuMaskIn) {
     }
 }
 
+void EmbeddedThreadI::SetDeadline(const uint64 runtimeIn,
+                                  const uint64 deadlineIn,
+                                  const uint64 periodIn) {
+    if (GetStatus() == OffState) {
+        deadlineRuntime = runtimeIn;
+        deadlineDeadline = deadlineIn;
+        deadlinePeriod = periodIn;
+    }
+}
+
+bool EmbeddedThreadI::GetDeadline(uint64 &runtimeOut,
+                                  uint64 &deadlineOut,
+                                  uint64 &periodOut) const {
+    runtimeOut = deadlineRuntime;
+    deadlineOut = deadlineDeadline;
+    periodOut = deadlinePeriod;
+    return (deadlinePeriod > 0u);
+}
+
+void EmbeddedThreadI::SetPrefaultStackSize(const uint32 prefaultStackSizeIn) {
+    if (GetStatus() == OffState) {
+        prefaultStackSize = prefaultStackSizeIn;
+    }
+}
+
+uint32 EmbeddedThreadI::GetPrefaultStackSize() const {
+    return prefaultStackSize;
+}
+
+void EmbeddedThreadI::PrepareThreadContext() const {
+    if (prefaultStackSize > 0u) {
+        if (prefaultStackSize < stackSize) {
+            Threads::PrefaultStack(prefaultStackSize);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The PrefaultStackSize (%u) shall be smaller than the StackSize (%u)", prefaultStackSize, stackSize);
+        }
+    }
+    if (deadlinePeriod > 0u) {
+        if (!Threads::SetDeadline(deadlineRuntime, deadlineDeadline, deadlinePeriod)) {
+            REPORT_ERROR(ErrorManagement::Warning, "Thread %s will not run under SCHED_DEADLINE", GetName());
+        }
+    }
+}
+
 
 }
 
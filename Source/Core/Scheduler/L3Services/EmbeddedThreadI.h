@@ -63,7 +63,9 @@ public:
      *   GetPriorityClass() == Threads::NormalPriorityClass &&
      *   GetPriorityLevel() == 0 &&
      *   GetCPUMask() == UndefinedCPUs &&
-     *   GetStackSize() == THREADS_DEFAULT_STACKSIZE
+     *   GetStackSize() == THREADS_DEFAULT_STACKSIZE &&
+     *   GetDeadline() == false &&
+     *   GetPrefaultStackSize() == 0
      */
     EmbeddedThreadI(EmbeddedServiceMethodBinderI &binder);
 
@@ -78,7 +80,9 @@ public:
      *   GetPriorityClass() == Threads::NormalPriorityClass &&
      *   GetPriorityLevel() == 0 &&
      *   GetCPUMask() == UndefinedCPUs &&
-     *   GetStackSize() == THREADS_DEFAULT_STACKSIZE
+     *   GetStackSize() == THREADS_DEFAULT_STACKSIZE &&
+     *   GetDeadline() == false &&
+     *   GetPrefaultStackSize() == 0
      */
     EmbeddedThreadI(EmbeddedServiceMethodBinderI &binder, uint16 threadNumberIn);
 
@@ -301,6 +305,49 @@ public:
      */
     void SetCPUMask(const ProcessorType& cpuMaskIn);
 
+    /**
+     * @brief Sets the SCHED_DEADLINE reservation of the thread (see Threads::SetDeadline).
+     * @param[in] runtimeIn the CPU time reserved in each period (in nano-seconds).
+     * @param[in] deadlineIn the relative deadline (in nano-seconds).
+     * @param[in] periodIn the reservation period (in nano-seconds). If 0 the thread is not scheduled with a deadline policy.
+     * @pre
+     *   GetStatus() == OffState
+     */
+    void SetDeadline(const uint64 runtimeIn,
+                     const uint64 deadlineIn,
+                     const uint64 periodIn);
+
+    /**
+     * @brief Gets the SCHED_DEADLINE reservation of the thread.
+     * @param[out] runtimeOut the CPU time reserved in each period (in nano-seconds).
+     * @param[out] deadlineOut the relative deadline (in nano-seconds).
+     * @param[out] periodOut the reservation period (in nano-seconds).
+     * @return true if a reservation was set (i.e. periodOut > 0).
+     */
+    bool GetDeadline(uint64 &runtimeOut,
+                     uint64 &deadlineOut,
+                     uint64 &periodOut) const;
+
+    /**
+     * @brief Sets the number of stack bytes to be prefaulted when the thread starts (see Threads::PrefaultStack).
+     * @param[in] prefaultStackSizeIn the number of bytes to prefault (0 => no prefault). Shall be smaller than GetStackSize().
+     * @pre
+     *   GetStatus() == OffState
+     */
+    void SetPrefaultStackSize(const uint32 prefaultStackSizeIn);
+
+    /**
+     * @brief Gets the number of stack bytes to be prefaulted when the thread starts.
+     * @return the number of stack bytes to be prefaulted.
+     */
+    uint32 GetPrefaultStackSize() const;
+
+    /**
+     * @brief Applies the SCHED_DEADLINE reservation and prefaults the stack of the calling thread.
+     * @details Called in the context of the embedded thread, before ThreadLoop.
+     */
+    void PrepareThreadContext() const;
+
 protected:
     /**
      * Embedded thread identifier.
@@ -367,6 +414,26 @@ private:
      */
     ProcessorType cpuMask;
 
+    /**
+     * The SCHED_DEADLINE runtime in nano-seconds
+     */
+    uint64 deadlineRuntime;
+
+    /**
+     * The SCHED_DEADLINE relative deadline in nano-seconds
+     */
+    uint64 deadlineDeadline;
+
+    /**
+     * The SCHED_DEADLINE period in nano-seconds (0 => not used)
+     */
+    uint64 deadlinePeriod;
+
+    /**
+     * The number of stack bytes to prefault
+     */
+    uint32 prefaultStackSize;
+
     /*lint -e{1712} This class does not have a default constructor because
      * the callback method must be defined at construction and will remain constant
      * during the object's lifetime*/
@@ -61,6 +61,11 @@ void MultiClientEmbeddedThread::ThreadLoop() {
     //Allow new threads to enter....
     bool moreThanEnoughtThreads = false;
     ErrorManagement::ErrorType err;
+    //The manager counts a new thread as waiting for a connection
+    bool idle = true;
+    bool released = false;
+    uint64 idleTimeoutTicks = (static_cast<uint64>(manager.GetIdleTimeout()) * HighResolutionTimer::Frequency()) / 1000ULL;
+    uint64 idleSince = HighResolutionTimer::Counter();
     while ((GetCommands() == KeepRunningCommand) && (!moreThanEnoughtThreads)) {
         information.SetStage(ExecutionInfo::StartupStage);
         information.SetStageSpecific(ExecutionInfo::NullStageSpecific);
@@ -73,6 +78,11 @@ void MultiClientEmbeddedThread::ThreadLoop() {
         while ((GetCommands() == KeepRunningCommand) && (errorsCleared)) {
             information.SetStage(ExecutionInfo::MainStage);
             information.SetStageSpecific(ExecutionInfo::WaitRequestStageSpecific);
+            if (!idle) {
+                idle = true;
+                manager.SetThreadIdle(true);
+                idleSince = HighResolutionTimer::Counter();
+            }
 
             // simulate timeout to allow entering next loop
             err.timeout = true;
@@ -83,12 +93,30 @@ void MultiClientEmbeddedThread::ThreadLoop() {
             while ((GetCommands() == KeepRunningCommand) && (hasToContinue)) {
                 err = Execute(information);
                 hasToContinue = (err == ErrorManagement::Timeout);
+                if ((hasToContinue) && (idleTimeoutTicks > 0u)) {
+                    if ((HighResolutionTimer::Counter() - idleSince) > idleTimeoutTicks) {
+                        released = manager.ReleaseIdleThread();
+                        if (released) {
+                            idle = false;
+                            hasToContinue = false;
+                            err = ErrorManagement::Completed;
+                        }
+                        else {
+                            //Still needed: wait another IdleTimeout before trying again
+                            idleSince = HighResolutionTimer::Counter();
+                        }
+                    }
+                }
             } // wait service
 
             errorsCleared = err.ErrorsCleared();
             if ((GetCommands() == KeepRunningCommand) && (errorsCleared)) {
-                // Try start new service thread
-                bool threadAddedOk = manager.AddThread();
+                if (idle) {
+                    idle = false;
+                    manager.SetThreadIdle(false);
+                }
+                // Try start new service threads
+                bool threadAddedOk = manager.GrowPool();
                 if (!threadAddedOk) {
                     REPORT_ERROR(ErrorManagement::RecoverableError, "Failed to AddThread... Increase the maximum number of threads allowed in the MultiClientService...");
                 }
@@ -117,9 +145,25 @@ void MultiClientEmbeddedThread::ThreadLoop() {
             REPORT_ERROR(ErrorManagement::RecoverableError, "Callback returned error. Restarting MultiClientEmbeddedThread loop.");
         }
 
-        moreThanEnoughtThreads = manager.MoreThanEnoughThreads();
+        if (released) {
+            moreThanEnoughtThreads = true;
+        }
+        else if (idleTimeoutTicks == 0u) {
+            moreThanEnoughtThreads = manager.MoreThanEnoughThreads();
+        }
+        else {
+            //Only terminated by ReleaseIdleThread
+        }
     } // main loop (start - loop (wait service - loop (service) ) - end)
-    err = manager.RemoveThread(GetThreadId());
+    if (idle) {
+        manager.SetThreadIdle(false);
+    }
+    if (released) {
+        err = manager.RemoveReleasedThread(GetThreadId());
+    }
+    else {
+        err = manager.RemoveThread(GetThreadId());
+    }
     if (!err.ErrorsCleared()) {
         REPORT_ERROR(ErrorManagement::RecoverableError, "Failed to remove thread from pool");
     }
@@ -43,7 +43,7 @@ namespace MARTe {
  * @brief Multiple client connection oriented EmbeddedThreadI implementation.
  * @details The ThreadLoop only terminates when the GetCommands !== KeepRunningCommand or when
  *  the MultiClientService already has enough threads handling client connections (see
- *   MultiClientService::MoreThanEnoughThreads).
+ *   MultiClientService::MoreThanEnoughThreads or, if the MultiClientService has an IdleTimeout, MultiClientService::ReleaseIdleThread).
  *
  * The user callback function should not block and should return ErrorManagement::Timeout
  * while waiting to serve. In this stage, it will be continuously called by the ThreadLoop with
@@ -51,7 +51,7 @@ namespace MARTe {
  *
  * When the user callback returns with no error it will be recalled with ExecutionInfo::ServiceRequestStageSpecific
  *  so to handle the connection request.
- * In parallel, a new thread will be launched by the manager to handle any new subsequent connection requests (see MultiClientService::AddThread)
+ * In parallel, new threads will be launched by the manager to handle any new subsequent connection requests (see MultiClientService::GrowPool)
  */
 class MultiClientEmbeddedThread: public EmbeddedThreadI {
 
@@ -29,6 +29,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "MultiClientEmbeddedThread.h"
 #include "MultiClientService.h"
 #include "ReferenceT.h"
@@ -51,6 +52,11 @@ MultiClientService::MultiClientService(EmbeddedServiceMethodBinderI &binder) :
         MultiThreadService(binder) {
     minNumberOfThreads = 1u;
     maxNumberOfThreads = 3u;
+    warmThreads = 1u;
+    idleTimeout = 0u;
+    numberOfIdleThreads = 0;
+    numberOfReleasedThreads = 0u;
+    poolMux.Create();
 }
 
 bool MultiClientService::Initialise(StructuredDataI &data) {
@@ -80,6 +86,18 @@ bool MultiClientService::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "MinNumberOfThreads must be > 0");
         }
     }
+    if (err.ErrorsCleared()) {
+        if (!data.Read("WarmThreads", warmThreads)) {
+            warmThreads = 1u;
+        }
+        if (!data.Read("IdleTimeout", idleTimeout)) {
+            idleTimeout = 0u;
+        }
+        err.parametersError = (warmThreads > maxNumberOfThreads);
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "WarmThreads must be <= MaxNumberOfThreads");
+        }
+    }
 
     return err;
 }
@@ -98,7 +116,12 @@ ErrorManagement::ErrorType MultiClientService::AddThread() {
             StreamString tname;
             (void)tname.Printf("%s_%d", GetName(), HighResolutionTimer::Counter32());
             thread->SetName(tname.Buffer());
+            //The new thread starts waiting for a connection
+            SetThreadIdle(true);
             err = thread->Start();
+            if (!err.ErrorsCleared()) {
+                SetThreadIdle(false);
+            }
         }
 
         if (err.ErrorsCleared()) {
@@ -109,6 +132,66 @@ ErrorManagement::ErrorType MultiClientService::AddThread() {
     return err;
 }
 
+ErrorManagement::ErrorType MultiClientService::GrowPool() {
+    ErrorManagement::ErrorType err;
+    if (poolMux.FastLock() == ErrorManagement::NoError) {
+        bool grow = (GetNumberOfIdleThreads() < warmThreads);
+        while ((grow) && (err.ErrorsCleared())) {
+            err = AddThread();
+            grow = (GetNumberOfIdleThreads() < warmThreads);
+        }
+        poolMux.FastUnLock();
+    }
+    return err;
+}
+
+bool MultiClientService::ReleaseIdleThread() {
+    bool ok = false;
+    if (poolMux.FastLock() == ErrorManagement::NoError) {
+        uint32 numberOfThreads = threadPool.Size();
+        if (numberOfThreads > numberOfReleasedThreads) {
+            numberOfThreads -= numberOfReleasedThreads;
+        }
+        ok = ((numberOfThreads > minNumberOfThreads) && (GetNumberOfIdleThreads() > warmThreads));
+        if (ok) {
+            numberOfReleasedThreads++;
+            SetThreadIdle(false);
+        }
+        poolMux.FastUnLock();
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType MultiClientService::RemoveReleasedThread(const ThreadIdentifier threadId) {
+    ErrorManagement::ErrorType err;
+    err.fatalError = (poolMux.FastLock() != ErrorManagement::NoError);
+    if (err.ErrorsCleared()) {
+        if (numberOfReleasedThreads > 0u) {
+            numberOfReleasedThreads--;
+        }
+        err = RemoveThread(threadId);
+        poolMux.FastUnLock();
+    }
+    return err;
+}
+
+void MultiClientService::SetThreadIdle(const bool idle) {
+    if (idle) {
+        Atomic::Increment(&numberOfIdleThreads);
+    }
+    else {
+        Atomic::Decrement(&numberOfIdleThreads);
+    }
+}
+
+uint16 MultiClientService::GetNumberOfIdleThreads() const {
+    int32 idle = Atomic::Load(&numberOfIdleThreads, Atomic::MemoryOrderRelaxed);
+    if (idle < 0) {
+        idle = 0;
+    }
+    return static_cast<uint16>(idle);
+}
+
 ErrorManagement::ErrorType MultiClientService::RemoveThread(const ThreadIdentifier threadId) {
     uint32 i = 0u;
     ErrorManagement::ErrorType err;
@@ -145,7 +228,13 @@ ErrorManagement::ErrorType MultiClientService::Start() {
     ErrorManagement::ErrorType err;
     err.illegalOperation = (threadPool.Size() > 0u);
     bool errorsCleared = err.ErrorsCleared();
-    while ((threadPool.Size() < minNumberOfThreads) && (errorsCleared)) {
+    numberOfIdleThreads = 0;
+    numberOfReleasedThreads = 0u;
+    uint16 numberOfThreadsToStart = minNumberOfThreads;
+    if (warmThreads > numberOfThreadsToStart) {
+        numberOfThreadsToStart = warmThreads;
+    }
+    while ((threadPool.Size() < numberOfThreadsToStart) && (errorsCleared)) {
         ReferenceT<MultiClientEmbeddedThread> thread(new (NULL) MultiClientEmbeddedThread(method, *this));
         err.fatalError = !thread.IsValid();
         if (err.ErrorsCleared()) {
@@ -154,7 +243,11 @@ ErrorManagement::ErrorType MultiClientService::Start() {
             thread->SetCPUMask(GetCPUMask());
             thread->SetTimeout(GetTimeout());
             thread->SetName(GetName());
+            SetThreadIdle(true);
             err = thread->Start();
+            if (!err.ErrorsCleared()) {
+                SetThreadIdle(false);
+            }
         }
         if (err.ErrorsCleared()) {
             err.fatalError = !threadPool.Insert(thread);
@@ -196,6 +289,34 @@ void MultiClientService::SetMinimumNumberOfPoolThreads(const uint16 minNumberOfT
     }
 }
 
+uint16 MultiClientService::GetWarmThreads() const {
+    return warmThreads;
+}
+
+void MultiClientService::SetWarmThreads(const uint16 warmThreadsIn) {
+    if (threadPool.Size() == 0u) {
+        if (warmThreadsIn <= maxNumberOfThreads) {
+            warmThreads = warmThreadsIn;
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Number of warm threads cannot be changed if the service is running");
+    }
+}
+
+uint32 MultiClientService::GetIdleTimeout() const {
+    return idleTimeout;
+}
+
+void MultiClientService::SetIdleTimeout(const uint32 idleTimeoutIn) {
+    if (threadPool.Size() == 0u) {
+        idleTimeout = idleTimeoutIn;
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Idle timeout cannot be changed if the service is running");
+    }
+}
+
 void MultiClientService::SetPriorityClass(const Threads::PriorityClassType priorityClassIn) {
     if (threadPool.Size() == 0u) {
         EmbeddedServiceI::SetPriorityClass(priorityClassIn);
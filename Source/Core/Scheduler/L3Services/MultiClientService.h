@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "FastPollingMutexSem.h"
 #include "MultiThreadService.h"
 
 /*---------------------------------------------------------------------------*/
@@ -44,6 +45,12 @@ namespace MARTe {
  * @details This class allows associating a class method in the form (MARTe::ErrorManagement::ErrorType (*)(MARTe::EmbeddedServiceI::ExecutionInfo &)) to a pool of threads.
  * This method will be continuously called (see Start) with the stage encoded in the Information parameter.
  * Notice that the user-callback should not block and should return ErrorManagement::Timeout while waiting for a connection to be established.
+ *
+ * The pool keeps WarmThreads threads waiting for a connection (pre-spawned at Start): when a thread starts serving a connection and fewer than
+ * WarmThreads threads are left waiting, new threads are launched (up to MaxNumberOfThreads), so that a burst of connections does not wait for the
+ * thread creation. If IdleTimeout is 0 a thread terminates after serving a connection if there are more than MinNumberOfThreads threads. Otherwise
+ * the thread goes back to wait and only terminates after having waited IdleTimeout without a connection while more than WarmThreads threads were
+ * waiting (the growth and shrink thresholds differ by one thread and by IdleTimeout, so that the pool does not oscillate under a steady load).
  */
 class MultiClientService: public MultiThreadService {
 
@@ -80,6 +87,8 @@ public:
      * and another parameter named "Timeout" with the timeout to apply to each of the SingleThreadService instances.
      * If "Timeout=0" => Timeout = TTInfiniteWait.
      * The MinNumberOfThreads shall be > 1.
+     * Optionally "WarmThreads" (default 1), the number of threads to keep waiting for a connection (<= MaxNumberOfThreads),
+     * and "IdleTimeout" (default 0), the time in milliseconds a thread shall wait without a connection before being terminated (0 => legacy behaviour).
      * @return true if all the parameters are available and valid (i.e. MinNumberOfThreads > 1).
      */
     virtual bool Initialise(StructuredDataI &data);
@@ -140,7 +149,68 @@ public:
     inline bool MoreThanEnoughThreads();
 
     /**
-     * @brief Starts N (GetMinimumNumberOfPoolThreads()) MultiClientEmbeddedThread instances.
+     * @brief Launches new threads while fewer than GetWarmThreads() threads are waiting for a connection.
+     * @return ErrorManagement::IllegalOperation if a thread was needed but GetMaximumNumberOfPoolThreads() threads are already allocated.
+     */
+    ErrorManagement::ErrorType GrowPool();
+
+    /**
+     * @brief Checks if a thread which timed-out waiting for a connection can be terminated.
+     * @details If the thread can be terminated it is no longer counted as waiting for a connection.
+     * @return true if more than GetWarmThreads() threads are waiting and more than GetMinimumNumberOfPoolThreads() threads are allocated.
+     */
+    bool ReleaseIdleThread();
+
+    /**
+     * @brief Removes a thread which was granted by ReleaseIdleThread (see RemoveThread).
+     * @param[in] threadId the identifier of the thread to be removed.
+     * @return see RemoveThread.
+     */
+    ErrorManagement::ErrorType RemoveReleasedThread(const ThreadIdentifier threadId);
+
+    /**
+     * @brief Updates the number of threads waiting for a connection.
+     * @param[in] idle true if the calling thread starts waiting for a connection, false if it stops waiting.
+     */
+    void SetThreadIdle(const bool idle);
+
+    /**
+     * @brief Gets the number of threads waiting for a connection (including the threads which are being started).
+     * @return the number of threads waiting for a connection.
+     */
+    uint16 GetNumberOfIdleThreads() const;
+
+    /**
+     * @brief Gets the number of threads to keep waiting for a connection.
+     * @return the number of threads to keep waiting for a connection.
+     */
+    uint16 GetWarmThreads() const;
+
+    /**
+     * @brief Sets the number of threads to keep waiting for a connection.
+     * @param[in] warmThreadsIn the number of threads to keep waiting for a connection.
+     * @pre
+     *   Stop() &&
+     *   warmThreadsIn <= GetMaximumNumberOfPoolThreads()
+     */
+    void SetWarmThreads(const uint16 warmThreadsIn);
+
+    /**
+     * @brief Gets the time a thread shall wait without a connection before being terminated.
+     * @return the time in milliseconds (0 => threads terminate after serving a connection, see MoreThanEnoughThreads).
+     */
+    uint32 GetIdleTimeout() const;
+
+    /**
+     * @brief Sets the time a thread shall wait without a connection before being terminated.
+     * @param[in] idleTimeoutIn the time in milliseconds.
+     * @pre
+     *   Stop()
+     */
+    void SetIdleTimeout(const uint32 idleTimeoutIn);
+
+    /**
+     * @brief Starts N (max(GetMinimumNumberOfPoolThreads(), GetWarmThreads())) MultiClientEmbeddedThread instances.
      * @return ErrorManagement::NoError if all the instances can be successfully started.
      * ErrorManagement::IllegalOperation if start is called twice without calling stop beforehand.
      */
@@ -187,6 +257,31 @@ protected:
      */
     uint16 minNumberOfThreads;
 
+    /**
+     * Number of threads to keep waiting for a connection.
+     */
+    uint16 warmThreads;
+
+    /**
+     * Time in milliseconds after which a thread waiting for a connection can be terminated.
+     */
+    uint32 idleTimeout;
+
+    /**
+     * Number of threads waiting for a connection.
+     */
+    volatile int32 numberOfIdleThreads;
+
+    /**
+     * Number of threads granted by ReleaseIdleThread and not removed yet.
+     */
+    uint32 numberOfReleasedThreads;
+
+    /**
+     * Protects the growth and the shrinking of the pool.
+     */
+    FastPollingMutexSem poolMux;
+
     /*lint -e{1712} This class does not have a default constructor because
      * the callback method must be defined at construction time and will remain constant
      * during the object's lifetime*/
@@ -208,6 +303,11 @@ MultiClientService::MultiClientService(EmbeddedServiceMethodBinderT<className> &
         MultiThreadService(binder) {
     minNumberOfThreads = 1u;
     maxNumberOfThreads = 3u;
+    warmThreads = 1u;
+    idleTimeout = 0u;
+    numberOfIdleThreads = 0;
+    numberOfReleasedThreads = 0u;
+    poolMux.Create();
 }
 
 }
@@ -262,6 +262,8 @@ ErrorManagement::ErrorType MultiThreadService::CreateThreads() {
             thread->SetPriorityLevel(GetPriorityLevel());
             thread->SetCPUMask(GetCPUMask());
             thread->SetTimeout(GetTimeout());
+            thread->SetDeadline(deadlineRuntime, deadlineDeadline, deadlinePeriod);
+            thread->SetPrefaultStackSize(GetPrefaultStackSize());
             StreamString tname;
             (void) tname.Printf("%s_%d", GetName(), threadNumber);
             thread->SetName(tname.Buffer());
@@ -464,6 +466,48 @@ void MultiThreadService::SetCPUMask(const ProcessorType& cpuMaskIn) {
     }
 }
 
+void MultiThreadService::SetDeadline(const uint64 runtimeIn,
+                                     const uint64 deadlineIn,
+                                     const uint64 periodIn) {
+    bool allStop = true;
+    uint32 i;
+    for (i = 0u; (i < threadPool.Size()) && (allStop); i++) {
+        allStop = (GetStatus(i) == EmbeddedThreadI::OffState);
+    }
+    if (allStop) {
+        EmbeddedServiceI::SetDeadline(runtimeIn, deadlineIn, periodIn);
+        for (i = 0u; i < threadPool.Size(); i++) {
+            ReferenceT<EmbeddedThreadI> thread = threadPool.Get(i);
+            if (thread.IsValid()) {
+                thread->SetDeadline(runtimeIn, deadlineIn, periodIn);
+            }
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "SchedDeadline cannot be changed if the service is running");
+    }
+}
+
+void MultiThreadService::SetPrefaultStackSize(const uint32 prefaultStackSizeIn) {
+    bool allStop = true;
+    uint32 i;
+    for (i = 0u; (i < threadPool.Size()) && (allStop); i++) {
+        allStop = (GetStatus(i) == EmbeddedThreadI::OffState);
+    }
+    if (allStop) {
+        EmbeddedServiceI::SetPrefaultStackSize(prefaultStackSizeIn);
+        for (i = 0u; i < threadPool.Size(); i++) {
+            ReferenceT<EmbeddedThreadI> thread = threadPool.Get(i);
+            if (thread.IsValid()) {
+                thread->SetPrefaultStackSize(prefaultStackSizeIn);
+            }
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "PrefaultStackSize cannot be changed if the service is running");
+    }
+}
+
 Threads::PriorityClassType MultiThreadService::GetPriorityClassThreadPool(const uint32 threadIdx) {
     Threads::PriorityClassType prioClass = Threads::UnknownPriorityClass;
     if (threadIdx < threadPool.Size()) {
@@ -582,5 +626,33 @@ void MultiThreadService::SetCPUMaskThreadPool(const ProcessorType& cpuMaskIn, co
     }
 }
 
+void MultiThreadService::SetDeadlineThreadPool(const uint64 runtimeIn,
+                                               const uint64 deadlineIn,
+                                               const uint64 periodIn,
+                                               const uint32 threadIdx) {
+    if (GetStatus(threadIdx) == EmbeddedThreadI::OffState) {
+        ReferenceT<EmbeddedThreadI> thread = threadPool.Get(threadIdx);
+        if (thread.IsValid()) {
+            thread->SetDeadline(runtimeIn, deadlineIn, periodIn);
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "SchedDeadline cannot be changed if the service is running");
+    }
+}
+
+void MultiThreadService::SetPrefaultStackSizeThreadPool(const uint32 prefaultStackSizeIn,
+                                                        const uint32 threadIdx) {
+    if (GetStatus(threadIdx) == EmbeddedThreadI::OffState) {
+        ReferenceT<EmbeddedThreadI> thread = threadPool.Get(threadIdx);
+        if (thread.IsValid()) {
+            thread->SetPrefaultStackSize(prefaultStackSizeIn);
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "PrefaultStackSize cannot be changed if the service is running");
+    }
+}
+
 }
 
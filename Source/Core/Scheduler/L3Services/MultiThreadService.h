@@ -172,6 +172,26 @@ public:
      */
     virtual void SetCPUMask(const ProcessorType& cpuMaskIn);
 
+    /**
+     * @brief Sets the SCHED_DEADLINE reservation for all the threads.
+     * @param[in] runtimeIn the CPU time reserved in each period (in nano-seconds).
+     * @param[in] deadlineIn the relative deadline (in nano-seconds).
+     * @param[in] periodIn the reservation period (in nano-seconds).
+     * @pre
+     *   GetStatus(*) == OffState
+     */
+    virtual void SetDeadline(const uint64 runtimeIn,
+                             const uint64 deadlineIn,
+                             const uint64 periodIn);
+
+    /**
+     * @brief Sets the number of stack bytes to be prefaulted for all the threads.
+     * @param[in] prefaultStackSizeIn the number of stack bytes to be prefaulted.
+     * @pre
+     *   GetStatus(*) == OffState
+     */
+    virtual void SetPrefaultStackSize(const uint32 prefaultStackSizeIn);
+
     /**
      * @brief Gets the thread priority class for the thread with index \a threadIdx.
      * @param[in] threadIdx the index of the thread.
@@ -270,6 +290,28 @@ public:
      */
     void SetThreadNameThreadPool(const char8 * const threadName, uint32 threadIdx);
 
+    /**
+     * @brief Sets the SCHED_DEADLINE reservation for the thread with index \a threadIdx.
+     * @param[in] runtimeIn the CPU time reserved in each period (in nano-seconds).
+     * @param[in] deadlineIn the relative deadline (in nano-seconds).
+     * @param[in] periodIn the reservation period (in nano-seconds). If 0 the thread is not scheduled with a deadline policy.
+     * @param[in] threadIdx the index of the thread.
+     * @pre
+     *   GetStatus(threadIdx) == OffState
+     *   threadIdx < GetNumberOfPoolThreads()
+     */
+    void SetDeadlineThreadPool(const uint64 runtimeIn, const uint64 deadlineIn, const uint64 periodIn, uint32 threadIdx);
+
+    /**
+     * @brief Sets the number of stack bytes to be prefaulted for the thread with index \a threadIdx.
+     * @param[in] prefaultStackSizeIn the number of stack bytes to be prefaulted.
+     * @param[in] threadIdx the index of the thread.
+     * @pre
+     *   GetStatus(threadIdx) == OffState
+     *   threadIdx < GetNumberOfPoolThreads()
+     */
+    void SetPrefaultStackSizeThreadPool(const uint32 prefaultStackSizeIn, uint32 threadIdx);
+
 
 protected:
     /**
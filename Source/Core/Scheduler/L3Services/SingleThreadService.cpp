@@ -119,4 +119,26 @@ void SingleThreadService::SetCPUMask(const ProcessorType& cpuMaskIn) {
     }
 }
 
+void SingleThreadService::SetDeadline(const uint64 runtimeIn,
+                                      const uint64 deadlineIn,
+                                      const uint64 periodIn) {
+    if (GetStatus() == EmbeddedThreadI::OffState) {
+        EmbeddedServiceI::SetDeadline(runtimeIn, deadlineIn, periodIn);
+        embeddedThread.SetDeadline(runtimeIn, deadlineIn, periodIn);
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "SchedDeadline cannot be changed if the service is running");
+    }
+}
+
+void SingleThreadService::SetPrefaultStackSize(const uint32 prefaultStackSizeIn) {
+    if (GetStatus() == EmbeddedThreadI::OffState) {
+        EmbeddedServiceI::SetPrefaultStackSize(prefaultStackSizeIn);
+        embeddedThread.SetPrefaultStackSize(prefaultStackSizeIn);
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "PrefaultStackSize cannot be changed if the service is running");
+    }
+}
+
 }
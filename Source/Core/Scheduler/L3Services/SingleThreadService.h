@@ -138,6 +138,26 @@ public:
      */
     virtual void SetCPUMask(const ProcessorType& cpuMaskIn);
 
+    /**
+     * @brief Sets the thread SCHED_DEADLINE reservation.
+     * @param[in] runtimeIn the CPU time reserved in each period (in nano-seconds).
+     * @param[in] deadlineIn the relative deadline (in nano-seconds).
+     * @param[in] periodIn the reservation period (in nano-seconds).
+     * @pre
+     *   GetStatus() == OffState
+     */
+    virtual void SetDeadline(const uint64 runtimeIn,
+                             const uint64 deadlineIn,
+                             const uint64 periodIn);
+
+    /**
+     * @brief Sets the number of stack bytes to be prefaulted when the thread starts.
+     * @param[in] prefaultStackSizeIn the number of stack bytes to be prefaulted.
+     * @pre
+     *   GetStatus() == OffState
+     */
+    virtual void SetPrefaultStackSize(const uint32 prefaultStackSizeIn);
+
 private:
 
     /**
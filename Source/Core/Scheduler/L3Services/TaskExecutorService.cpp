@@ -0,0 +1,305 @@
+/**
+ * @file TaskExecutorService.cpp
+ * @brief Source file for class TaskExecutorService
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class TaskExecutorService (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "TaskExecutorService.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+TaskExecutorService::TaskExecutorService() :
+        ReferenceContainer(), EmbeddedServiceMethodBinderI(), workerThreads(*this) {
+    workers = NULL_PTR(TaskExecutorWorker *);
+    numberOfWorkers = 0u;
+    queueSize = 256u;
+    injectedTasks = NULL_PTR(EmbeddedServiceMethodBinderI **);
+    injectedHead = 0u;
+    numberOfInjectedTasks = 0;
+    numberOfParkedWorkers = 0;
+    spinIterations = 1000u;
+    parkTimeout = 100u;
+    injectionMux.Create();
+    (void) parkSem.Create();
+}
+
+/*lint -e{1551} the destructor must guarantee that the workers are stopped before the queues are freed*/
+TaskExecutorService::~TaskExecutorService() {
+    if (Stop() != ErrorManagement::NoError) {
+        REPORT_ERROR(ErrorManagement::Warning, "Could not Stop the workers");
+    }
+    if (workers != NULL_PTR(TaskExecutorWorker *)) {
+        for (uint32 i = 0u; i < numberOfWorkers; i++) {
+            delete[] workers[i].tasks;
+        }
+        delete[] workers;
+    }
+    if (injectedTasks != NULL_PTR(EmbeddedServiceMethodBinderI **)) {
+        delete[] injectedTasks;
+    }
+    (void) parkSem.Close();
+}
+
+bool TaskExecutorService::Initialise(StructuredDataI &data) {
+    bool ok = ReferenceContainer::Initialise(data);
+    if (ok) {
+        (void) data.Read("QueueSize", queueSize);
+        ok = (queueSize > 0u);
+        if (ok) {
+            ok = ((queueSize & (queueSize - 1u)) == 0u);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "QueueSize must be a power of 2");
+        }
+    }
+    if (ok) {
+        (void) data.Read("SpinIterations", spinIterations);
+        (void) data.Read("ParkTimeout", parkTimeout);
+        ok = (parkTimeout > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "ParkTimeout must be > 0");
+        }
+    }
+    if (ok) {
+        workerThreads.SetName(GetName());
+        ok = workerThreads.Initialise(data);
+    }
+    if (ok) {
+        numberOfWorkers = workerThreads.GetNumberOfPoolThreads();
+        ok = (numberOfWorkers > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfPoolThreads must be > 0");
+        }
+    }
+    if (ok) {
+        workers = new TaskExecutorWorker[numberOfWorkers];
+        for (uint32 i = 0u; i < numberOfWorkers; i++) {
+            workers[i].top = 0;
+            workers[i].bottom = 0;
+            workers[i].tasks = new EmbeddedServiceMethodBinderI*[queueSize];
+            workers[i].threadId = InvalidThreadIdentifier;
+            workers[i].numberOfExecutedTasks = 0u;
+            workers[i].numberOfStolenTasks = 0u;
+        }
+        injectedTasks = new EmbeddedServiceMethodBinderI*[queueSize];
+        ok = workerThreads.Start();
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start the workers.");
+        }
+    }
+    return ok;
+}
+
+bool TaskExecutorService::Submit(EmbeddedServiceMethodBinderI &task) {
+    bool ok = false;
+    //A task submitted by a worker goes to the deque of that worker
+    ThreadIdentifier caller = Threads::Id();
+    for (uint32 i = 0u; (i < numberOfWorkers) && (!ok); i++) {
+        if (workers[i].threadId == caller) {
+            ok = PushTask(workers[i], &task);
+        }
+    }
+    if ((!ok) && (injectedTasks != NULL_PTR(EmbeddedServiceMethodBinderI **))) {
+        if (injectionMux.FastLock() == ErrorManagement::NoError) {
+            uint32 queued = static_cast<uint32>(numberOfInjectedTasks);
+            ok = (queued < queueSize);
+            if (ok) {
+                injectedTasks[(injectedHead + queued) & (queueSize - 1u)] = &task;
+                Atomic::StoreRelease(&numberOfInjectedTasks, static_cast<int32>(queued + 1u));
+            }
+            injectionMux.FastUnLock();
+        }
+    }
+    if (ok) {
+        //The task is visible before the parked workers are checked (see Execute)
+        Atomic::ThreadFence(Atomic::MemoryOrderSequential);
+        if (Atomic::Load(&numberOfParkedWorkers, Atomic::MemoryOrderRelaxed) > 0) {
+            (void) parkSem.Post();
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::Warning, "The task queue is full");
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType TaskExecutorService::Stop() {
+    //Wake up the parked workers so that they see the stop command
+    (void) parkSem.Post();
+    return workerThreads.Stop();
+}
+
+ErrorManagement::ErrorType TaskExecutorService::Execute(ExecutionInfo &info) {
+    uint32 workerNumber = info.GetThreadNumber();
+    if ((workerNumber < numberOfWorkers) && (info.GetStage() == ExecutionInfo::StartupStage)) {
+        workers[workerNumber].threadId = Threads::Id();
+    }
+    else if ((workerNumber < numberOfWorkers) && (info.GetStage() == ExecutionInfo::MainStage)) {
+        EmbeddedServiceMethodBinderI *task = FindTask(workerNumber);
+        for (uint32 n = 0u; (n < spinIterations) && (task == NULL_PTR(EmbeddedServiceMethodBinderI *)); n++) {
+            task = FindTask(workerNumber);
+        }
+        if (task != NULL_PTR(EmbeddedServiceMethodBinderI *)) {
+            ExecutionInfo taskInfo;
+            taskInfo.SetThreadNumber(workerNumber);
+            taskInfo.SetStage(ExecutionInfo::MainStage);
+            ErrorManagement::ErrorType taskErr = task->Execute(taskInfo);
+            if (!taskErr.ErrorsCleared()) {
+                REPORT_ERROR(ErrorManagement::Warning, "Task executed by worker %d returned an error", workerNumber);
+            }
+            workers[workerNumber].numberOfExecutedTasks++;
+        }
+        else {
+            //Announce the parking before the last check, so that a Submit either is seen here or posts the semaphore
+            Atomic::Increment(&numberOfParkedWorkers);
+            (void) parkSem.Reset();
+            Atomic::ThreadFence(Atomic::MemoryOrderSequential);
+            if (!HasPendingTasks()) {
+                (void) parkSem.Wait(parkTimeout);
+            }
+            Atomic::Decrement(&numberOfParkedWorkers);
+        }
+    }
+    else {
+        //Other stages not used.
+    }
+    return ErrorManagement::NoError;
+}
+
+uint32 TaskExecutorService::GetNumberOfWorkers() const {
+    return numberOfWorkers;
+}
+
+bool TaskExecutorService::GetWorkerStatistics(const uint32 worker,
+                                              uint64 &numberOfExecutedTasks,
+                                              uint64 &numberOfStolenTasks) const {
+    bool ok = (worker < numberOfWorkers);
+    if (ok) {
+        numberOfExecutedTasks = workers[worker].numberOfExecutedTasks;
+        numberOfStolenTasks = workers[worker].numberOfStolenTasks;
+    }
+    return ok;
+}
+
+bool TaskExecutorService::PushTask(TaskExecutorWorker &worker,
+                                   EmbeddedServiceMethodBinderI * const task) const {
+    int64 b = Atomic::Load(&worker.bottom, Atomic::MemoryOrderRelaxed);
+    int64 t = Atomic::LoadAcquire(&worker.top);
+    bool ok = ((b - t) < static_cast<int64>(queueSize));
+    if (ok) {
+        worker.tasks[static_cast<uint32>(b) & (queueSize - 1u)] = task;
+        Atomic::StoreRelease(&worker.bottom, b + 1);
+    }
+    return ok;
+}
+
+EmbeddedServiceMethodBinderI *TaskExecutorService::PopTask(TaskExecutorWorker &worker) const {
+    EmbeddedServiceMethodBinderI *task = NULL_PTR(EmbeddedServiceMethodBinderI *);
+    int64 b = Atomic::Load(&worker.bottom, Atomic::MemoryOrderRelaxed) - 1;
+    Atomic::Store(&worker.bottom, b, Atomic::MemoryOrderRelaxed);
+    //The reservation of the bottom task must be visible before top is read (races with StealTask)
+    Atomic::ThreadFence(Atomic::MemoryOrderSequential);
+    int64 t = Atomic::Load(&worker.top, Atomic::MemoryOrderRelaxed);
+    if (t <= b) {
+        task = worker.tasks[static_cast<uint32>(b) & (queueSize - 1u)];
+        if (t == b) {
+            //Last task: compete with the thieves
+            if (!Atomic::CompareExchange(&worker.top, t, t + 1)) {
+                task = NULL_PTR(EmbeddedServiceMethodBinderI *);
+            }
+            Atomic::Store(&worker.bottom, b + 1, Atomic::MemoryOrderRelaxed);
+        }
+    }
+    else {
+        Atomic::Store(&worker.bottom, b + 1, Atomic::MemoryOrderRelaxed);
+    }
+    return task;
+}
+
+EmbeddedServiceMethodBinderI *TaskExecutorService::StealTask(TaskExecutorWorker &worker) const {
+    EmbeddedServiceMethodBinderI *task = NULL_PTR(EmbeddedServiceMethodBinderI *);
+    int64 t = Atomic::LoadAcquire(&worker.top);
+    Atomic::ThreadFence(Atomic::MemoryOrderSequential);
+    int64 b = Atomic::LoadAcquire(&worker.bottom);
+    if (t < b) {
+        task = worker.tasks[static_cast<uint32>(t) & (queueSize - 1u)];
+        if (!Atomic::CompareExchange(&worker.top, t, t + 1)) {
+            task = NULL_PTR(EmbeddedServiceMethodBinderI *);
+        }
+    }
+    return task;
+}
+
+EmbeddedServiceMethodBinderI *TaskExecutorService::TakeInjectedTask() {
+    EmbeddedServiceMethodBinderI *task = NULL_PTR(EmbeddedServiceMethodBinderI *);
+    if (Atomic::LoadAcquire(&numberOfInjectedTasks) > 0) {
+        if (injectionMux.FastLock() == ErrorManagement::NoError) {
+            if (numberOfInjectedTasks > 0) {
+                task = injectedTasks[injectedHead];
+                injectedHead = ((injectedHead + 1u) & (queueSize - 1u));
+                Atomic::StoreRelease(&numberOfInjectedTasks, numberOfInjectedTasks - 1);
+            }
+            injectionMux.FastUnLock();
+        }
+    }
+    return task;
+}
+
+EmbeddedServiceMethodBinderI *TaskExecutorService::FindTask(const uint32 workerNumber) {
+    EmbeddedServiceMethodBinderI *task = PopTask(workers[workerNumber]);
+    if (task == NULL_PTR(EmbeddedServiceMethodBinderI *)) {
+        task = TakeInjectedTask();
+    }
+    for (uint32 i = 1u; (i < numberOfWorkers) && (task == NULL_PTR(EmbeddedServiceMethodBinderI *)); i++) {
+        task = StealTask(workers[(workerNumber + i) % numberOfWorkers]);
+        if (task != NULL_PTR(EmbeddedServiceMethodBinderI *)) {
+            workers[workerNumber].numberOfStolenTasks++;
+        }
+    }
+    return task;
+}
+
+bool TaskExecutorService::HasPendingTasks() const {
+    bool pending = (Atomic::LoadAcquire(&numberOfInjectedTasks) > 0);
+    for (uint32 i = 0u; (i < numberOfWorkers) && (!pending); i++) {
+        pending = (Atomic::LoadAcquire(&workers[i].bottom) > Atomic::LoadAcquire(&workers[i].top));
+    }
+    return pending;
+}
+
+CLASS_REGISTER(TaskExecutorService, "1.0")
+}
@@ -0,0 +1,278 @@
+/**
+ * @file TaskExecutorService.h
+ * @brief Header file for class TaskExecutorService
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class TaskExecutorService
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TASKEXECUTORSERVICE_H_
+#define TASKEXECUTORSERVICE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "FastPollingMutexSem.h"
+#include "MultiThreadService.h"
+#include "ReferenceContainer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief The tasks queue of a TaskExecutorService worker.
+ * @details Fixed capacity work-stealing deque: only the worker pushes and pops at the bottom, the other workers steal from the top.
+ */
+struct TaskExecutorWorker {
+    /**
+     * Index of the next task to be stolen.
+     */
+    volatile int64 top;
+
+    /**
+     * Index after the last task pushed by the worker.
+     */
+    volatile int64 bottom;
+
+    /**
+     * The tasks (capacity = mask + 1).
+     */
+    EmbeddedServiceMethodBinderI ** tasks;
+
+    /**
+     * The identifier of the worker thread (InvalidThreadIdentifier until the worker starts).
+     */
+    ThreadIdentifier threadId;
+
+    /**
+     * Number of tasks executed by the worker.
+     */
+    uint64 numberOfExecutedTasks;
+
+    /**
+     * Number of tasks that the worker stole from other workers.
+     */
+    uint64 numberOfStolenTasks;
+
+    /**
+     * Keeps the indexes of consecutive workers in different cache lines.
+     */
+    uint8 padding[64];
+};
+
+/**
+ * @brief Shared pool of worker threads which executes short, non real-time, tasks submitted by other components.
+ * @details Instead of each component (HTTP handlers, file flushing, message processing, ...) having its own mostly idle threads, the tasks are
+ * submitted to a few workers running on the housekeeping CPUs.
+ *
+ * A task is an EmbeddedServiceMethodBinderI which is called once (ExecutionInfo::MainStage, with the worker number as the thread number).
+ * The tasks submitted by a worker (e.g. a task which splits its work) are pushed in the deque of that worker, the others in a shared
+ * injection queue. An idle worker takes the tasks from its own deque, then from the injection queue and then steals from the other workers.
+ * When no task is found for SpinIterations attempts, the worker parks until a new task is submitted (or ParkTimeout elapses).
+ *
+ * The worker threads are a MultiThreadService and all its parameters apply (NumberOfPoolThreads is the number of workers, CPUMask or AllowedCPUs
+ * the CPUs where the workers run, ...). The workers are started by Initialise. The tasks which were not executed when the service is stopped are discarded.
+ *
+ * The configuration syntax is (names are only given as an example):
+ *
+ * <pre>
+ * +Executor = {
+ *     Class = TaskExecutorService
+ *     NumberOfPoolThreads = 2 //Compulsory. The number of workers.
+ *     Timeout = 1000 //Compulsory. See EmbeddedServiceI.
+ *     AllowedCPUs = {0 1} //Optional. See EmbeddedServiceI.
+ *     QueueSize = 256 //Optional. Capacity of the deque of each worker and of the injection queue. Must be a power of 2. Default is 256.
+ *     SpinIterations = 1000 //Optional. Number of attempts to find a task before a worker parks. Default is 1000.
+ *     ParkTimeout = 100 //Optional. Maximum time (in milliseconds) that a parked worker waits before looking for tasks again. Default is 100.
+ * }
+ * </pre>
+ */
+class TaskExecutorService: public ReferenceContainer, public EmbeddedServiceMethodBinderI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. Registers the worker callback function.
+     */
+    TaskExecutorService();
+
+    /**
+     * @brief Destructor. Stops the workers.
+     */
+    virtual ~TaskExecutorService();
+
+    /**
+     * @brief Reads the parameters (see class description) and starts the workers.
+     * @param[in] data see class description.
+     * @return true if all the parameters are valid and the workers could be started.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Submits a task for execution.
+     * @param[in] task the task. It shall not be destroyed before it is executed.
+     * @return false if the queue is full (the task will not be executed).
+     */
+    bool Submit(EmbeddedServiceMethodBinderI &task);
+
+    /**
+     * @brief Stops the workers.
+     * @return see MultiThreadService::Stop.
+     */
+    ErrorManagement::ErrorType Stop();
+
+    /**
+     * @brief Callback function of the workers (executes the tasks).
+     * @param[in] info see EmbeddedServiceMethodBinderI.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Gets the number of workers.
+     * @return the number of workers.
+     */
+    uint32 GetNumberOfWorkers() const;
+
+    /**
+     * @brief Gets the statistics of a worker.
+     * @param[in] worker the worker number.
+     * @param[out] numberOfExecutedTasks the number of tasks executed by the worker.
+     * @param[out] numberOfStolenTasks the number of tasks that the worker stole from the other workers.
+     * @return true if worker < GetNumberOfWorkers().
+     */
+    bool GetWorkerStatistics(const uint32 worker,
+                             uint64 &numberOfExecutedTasks,
+                             uint64 &numberOfStolenTasks) const;
+
+private:
+
+    /**
+     * @brief Pushes a task at the bottom of the deque of a worker (only called by the worker).
+     * @return false if the deque is full.
+     */
+    bool PushTask(TaskExecutorWorker &worker,
+                  EmbeddedServiceMethodBinderI * const task) const;
+
+    /**
+     * @brief Pops a task from the bottom of the deque of a worker (only called by the worker).
+     * @return the task or NULL if the deque is empty.
+     */
+    EmbeddedServiceMethodBinderI *PopTask(TaskExecutorWorker &worker) const;
+
+    /**
+     * @brief Steals a task from the top of the deque of a worker.
+     * @return the task or NULL if the deque is empty or if another worker took the task first.
+     */
+    EmbeddedServiceMethodBinderI *StealTask(TaskExecutorWorker &worker) const;
+
+    /**
+     * @brief Takes the oldest task of the injection queue.
+     * @return the task or NULL if the injection queue is empty.
+     */
+    EmbeddedServiceMethodBinderI *TakeInjectedTask();
+
+    /**
+     * @brief Looks for a task in the deque of the worker, then in the injection queue and then in the deques of the other workers.
+     * @return the task or NULL if no task was found.
+     */
+    EmbeddedServiceMethodBinderI *FindTask(const uint32 workerNumber);
+
+    /**
+     * @brief Checks if there is any task in any queue.
+     * @return true if a task is pending.
+     */
+    bool HasPendingTasks() const;
+
+    /**
+     * The worker threads.
+     */
+    MultiThreadService workerThreads;
+
+    /**
+     * The workers (numberOfWorkers elements).
+     */
+    TaskExecutorWorker *workers;
+
+    /**
+     * The number of workers.
+     */
+    uint32 numberOfWorkers;
+
+    /**
+     * Capacity of each deque and of the injection queue.
+     */
+    uint32 queueSize;
+
+    /**
+     * Tasks submitted by threads which are not workers.
+     */
+    EmbeddedServiceMethodBinderI **injectedTasks;
+
+    /**
+     * Index of the oldest task in the injection queue.
+     */
+    uint32 injectedHead;
+
+    /**
+     * Number of tasks in the injection queue.
+     */
+    volatile int32 numberOfInjectedTasks;
+
+    /**
+     * Protects the injection queue.
+     */
+    FastPollingMutexSem injectionMux;
+
+    /**
+     * Where the idle workers park.
+     */
+    EventSem parkSem;
+
+    /**
+     * Number of parked workers.
+     */
+    volatile int32 numberOfParkedWorkers;
+
+    /**
+     * Number of attempts to find a task before parking.
+     */
+    uint32 spinIterations;
+
+    /**
+     * Maximum time that a worker stays parked.
+     */
+    uint32 parkTimeout;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TASKEXECUTORSERVICE_H_ */
@@ -71,9 +71,14 @@ bool ThreadsInformationQuery::ExportData(StructuredDataI & data) {
             }
             if (ok) {
                 ProcessorType cpuMask = Threads::GetCPUs(tinfo);
-                // TODO implement a correct setter and getter for cpu mask instead of using uint64
+                //Kept for compatibility, only with the first 32 CPUs
                 uint32 convertedMask = cpuMask.GetLegacyUint32Mask();
                 ok = data.Write("Affinity", convertedMask);
+                if (ok) {
+                    char8 cpus[128];
+                    (void) cpuMask.ToList(&cpus[0], static_cast<uint32>(sizeof(cpus)));
+                    ok = data.Write("CPUs", &cpus[0]);
+                }
             }
             if (ok) {
                 Threads::PriorityClassType pclass = Threads::GetPriorityClass(tinfo);
@@ -89,6 +94,34 @@ bool ThreadsInformationQuery::ExportData(StructuredDataI & data) {
                 uint8 level = Threads::GetPriorityLevel(tinfo);
                 ok = data.Write("PriorityLevel", level);
             }
+            Threads::RuntimeStatistics statistics;
+            if ((ok) && (Threads::GetRuntimeStatistics(tinfo, statistics))) {
+                ok = data.Write("UserTime", statistics.userTime);
+                if (ok) {
+                    ok = data.Write("SystemTime", statistics.systemTime);
+                }
+                if (ok) {
+                    ok = data.Write("RunQueueWaitTime", statistics.runQueueWaitTime);
+                }
+                if (ok) {
+                    ok = data.Write("VoluntaryContextSwitches", statistics.voluntaryContextSwitches);
+                }
+                if (ok) {
+                    ok = data.Write("InvoluntaryContextSwitches", statistics.involuntaryContextSwitches);
+                }
+                if (ok) {
+                    ok = data.Write("Migrations", statistics.migrations);
+                }
+                if (ok) {
+                    ok = data.Write("MinorPageFaults", statistics.minorPageFaults);
+                }
+                if (ok) {
+                    ok = data.Write("MajorPageFaults", statistics.majorPageFaults);
+                }
+                if (ok) {
+                    ok = data.Write("LastCPU", statistics.lastCPU);
+                }
+            }
             if (ok) {
                 ok = data.MoveToAncestor(1u);
             }
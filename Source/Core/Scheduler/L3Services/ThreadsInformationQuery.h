@@ -56,7 +56,11 @@ public:
 
     /**
      * @brief See Object::ExportData. Lists all the information known about all the currently spawned threads.
-     * @param[out] data a new entry will be added for every thread, listing the following properties: Name, Affinity, PriorityClass, State and PriorityLevel.
+     * @param[out] data a new entry will be added for every thread, listing the following properties: Name, Affinity (mask of the first 32 CPUs), CPUs (list of all the CPUs,
+     * e.g. "0-3,64-67"), PriorityClass, State and PriorityLevel.
+     * If the operating system provides them (see Threads::GetRuntimeStatistics), also UserTime, SystemTime and RunQueueWaitTime (in micro-seconds),
+     * VoluntaryContextSwitches, InvoluntaryContextSwitches, Migrations, MinorPageFaults, MajorPageFaults and LastCPU. A real-time thread which is
+     * being pre-empted shows increasing InvoluntaryContextSwitches and RunQueueWaitTime.
      * @return true if all the thread properties were successfully written into \a data.
      */
     virtual bool ExportData(StructuredDataI & data);
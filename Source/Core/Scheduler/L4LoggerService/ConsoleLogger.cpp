@@ -28,24 +28,71 @@
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
 #include "ConsoleLogger.h"
+#include "MemoryOperationsHelper.h"
 #include "StreamString.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Maximum time in milliseconds that the writer thread waits before looking again for pending messages.
+ */
+const MARTe::uint32 CONSOLE_LOGGER_WRITER_PERIOD = 100u;
+
+/**
+ * Time in milliseconds given to the writer thread to terminate (e.g. if blocked writing to the console).
+ */
+const MARTe::uint32 CONSOLE_LOGGER_WRITER_STOP_TIMEOUT = 1000u;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
-ConsoleLogger::ConsoleLogger() : Object(), LoggerConsumerI() {
+ConsoleLogger::ConsoleLogger() :
+        Object(),
+        LoggerConsumerI(),
+        writerBinder(*this, &ConsoleLogger::WriterCycle),
+        writerService(writerBinder) {
+    buffer = NULL_PTR(char8 *);
+    bufferSize = 0u;
+    bufferHead = 0u;
+    bufferUsed = 0u;
+    droppedMessages = 0u;
+    stopWriter = false;
+    (void) bufferMux.Create();
+    (void) writerSem.Create();
     (void) console.Open(BasicConsoleMode::Default);
 }
 
 /*lint -e{1551} the destructor must guarantee that the console is closed.*/
 ConsoleLogger::~ConsoleLogger() {
+    if (buffer != NULL_PTR(char8 *)) {
+        stopWriter = true;
+        (void) writerSem.Post();
+        bool stopped = (writerService.Stop() == ErrorManagement::NoError);
+        if (!stopped) {
+            if (writerService.Stop() != ErrorManagement::NoError) {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not Stop the writer thread");
+            }
+        }
+        //The messages still in the buffer are only written if the writer thread was not killed while writing them
+        if (stopped) {
+            WritePending();
+        }
+        if (droppedMessages > 0u) {
+            StreamString dropped;
+            (void) dropped.Printf("ConsoleLogger: %d log messages were dropped\n", droppedMessages);
+            uint32 size32 = static_cast<uint32>(dropped.Size());
+            (void) console.Write(dropped.Buffer(), size32);
+        }
+        delete[] buffer;
+    }
+    (void) writerSem.Close();
     (void) console.Close();
 }
 
@@ -54,6 +101,33 @@ bool ConsoleLogger::Initialise(StructuredDataI &data) {
     if (ok) {
         ok = LoadPrintPreferences(data);
     }
+    if (ok) {
+        if (!data.Read("BufferSize", bufferSize)) {
+            bufferSize = 0u;
+        }
+    }
+    if ((ok) && (bufferSize > 0u)) {
+        StreamString cpus;
+        if (data.Read("CPUs", cpus)) {
+            ProcessorType cpuMask;
+            ok = cpuMask.SetFromString(cpus.Buffer());
+            if (ok) {
+                writerService.SetCPUMask(cpuMask);
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Invalid CPUs %s", cpus.Buffer());
+            }
+        }
+        if (ok) {
+            buffer = new char8[bufferSize];
+            writerService.SetName(GetName());
+            writerService.SetTimeout(TimeoutType(CONSOLE_LOGGER_WRITER_STOP_TIMEOUT));
+            ok = writerService.Start();
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the writer thread");
+            }
+        }
+    }
     return ok;
 
 }
@@ -64,10 +138,113 @@ void ConsoleLogger::ConsumeLogMessage(LoggerPage * const logPage) {
         PrintToStream(logPage, err);
         err += "\n";
         uint32 size32 = static_cast<uint32>(err.Size());
-        (void) console.Write(err.Buffer(), size32);
+        if (buffer == NULL_PTR(char8 *)) {
+            (void) console.Write(err.Buffer(), size32);
+        }
+        else {
+            //droppedMessages is only modified by the thread consuming the log messages
+            StreamString dropped;
+            if (droppedMessages > 0u) {
+                (void) dropped.Printf("ConsoleLogger: %d log messages were dropped\n", droppedMessages);
+            }
+            if (bufferMux.FastLock() != ErrorManagement::NoError) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed FastLock()");
+            }
+            if (droppedMessages > 0u) {
+                if (Append(dropped.Buffer(), static_cast<uint32>(dropped.Size()))) {
+                    droppedMessages = 0u;
+                }
+            }
+            //A message is never written before the report of the messages dropped before it
+            bool appended = (droppedMessages == 0u);
+            if (appended) {
+                appended = Append(err.Buffer(), size32);
+            }
+            if (!appended) {
+                droppedMessages++;
+            }
+            bool wakeUp = (bufferUsed > (bufferSize / 2u));
+            bufferMux.FastUnLock();
+            if (wakeUp) {
+                (void) writerSem.Post();
+            }
+        }
+    }
+}
+
+void ConsoleLogger::FlushLogMessages() {
+    if (buffer != NULL_PTR(char8 *)) {
+        (void) writerSem.Post();
     }
 }
 
+bool ConsoleLogger::Append(const char8 * const data,
+                           const uint32 size) {
+    bool ok = (size <= (bufferSize - bufferUsed));
+    if (ok) {
+        uint32 firstSize = bufferSize - bufferHead;
+        if (firstSize > size) {
+            firstSize = size;
+        }
+        (void) MemoryOperationsHelper::Copy(&buffer[bufferHead], data, firstSize);
+        if (firstSize < size) {
+            (void) MemoryOperationsHelper::Copy(&buffer[0u], &data[firstSize], size - firstSize);
+        }
+        bufferHead += size;
+        if (bufferHead >= bufferSize) {
+            bufferHead -= bufferSize;
+        }
+        bufferUsed += size;
+    }
+    return ok;
+}
+
+void ConsoleLogger::WritePending() {
+    bool done = false;
+    while (!done) {
+        if (bufferMux.FastLock() != ErrorManagement::NoError) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed FastLock()");
+        }
+        uint32 tail = (bufferHead >= bufferUsed) ? (bufferHead - bufferUsed) : (bufferHead + (bufferSize - bufferUsed));
+        uint32 size = bufferUsed;
+        bufferMux.FastUnLock();
+        //Only up to the end of the buffer, the rest is written in the next iteration
+        if (size > (bufferSize - tail)) {
+            size = (bufferSize - tail);
+        }
+        done = (size == 0u);
+        if (!done) {
+            //The console is written without the lock, so that the messages can still be added meanwhile
+            uint32 written = size;
+            if (!console.Write(&buffer[tail], written)) {
+                //Discarded, as otherwise a broken console would be retried forever
+                written = size;
+            }
+            if (bufferMux.FastLock() != ErrorManagement::NoError) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed FastLock()");
+            }
+            bufferUsed -= written;
+            bufferMux.FastUnLock();
+        }
+    }
+}
+
+ErrorManagement::ErrorType ConsoleLogger::WriterCycle(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        //Reset before writing so that a Post issued in between is not lost
+        (void) writerSem.Reset();
+        WritePending();
+        if (!stopWriter) {
+            (void) writerSem.Wait(TimeoutType(CONSOLE_LOGGER_WRITER_PERIOD));
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+uint32 ConsoleLogger::GetNumberOfDroppedMessages() const {
+    return droppedMessages;
+}
+
 CLASS_REGISTER(ConsoleLogger, "1.0")
 }
 
@@ -32,8 +32,12 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "BasicConsole.h"
+#include "EmbeddedServiceMethodBinderT.h"
+#include "EventSem.h"
+#include "FastPollingMutexSem.h"
 #include "LoggerConsumerI.h"
 #include "Object.h"
+#include "SingleThreadService.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -42,11 +46,21 @@ namespace MARTe {
 /**
  * @brief A LoggerConsumerI which outputs the log messages to a console instance.
  * @details The configuration syntax is (names are only given as an example):
+ * <pre>
  * +ConsoleLogger = {
  *     Class = ConsoleLogger
  *     Format = ItOoFm //Compulsory. As described in LoggerConsumerI::LoadPrintPreferences
  *     PrintKeys = 1 //Optional. As described in LoggerConsumerI::LoadPrintPreferences
+ *     BufferSize = 65536 //Optional. If > 0 the log messages are written to the console by a dedicated thread through a buffer of BufferSize bytes (see below). Default = 0 (each log message is written by the LoggerService thread).
+ *     CPUs = 0x1 //Optional. Only if BufferSize > 0. The CPUs of the writer thread (as in ProcessorType::SetFromString).
  * }
+ * </pre>
+ *
+ * With BufferSize > 0 ConsumeLogMessage only copies the printed message into the buffer, so that a slow console (e.g. a serial
+ *  line or a pipe) never blocks the LoggerService. The writer thread is woken up at the end of each burst of log messages
+ *  (see FlushLogMessages) or when the buffer is half full, and writes all the pending messages with as few BasicConsole::Write
+ *  as possible. The messages which do not fit in the buffer are dropped and counted: the number of dropped messages
+ *  is printed as soon as there is space again.
  */
 class ConsoleLogger: public Object, public LoggerConsumerI {
 public:
@@ -68,19 +82,101 @@ ConsoleLogger    ();
      */
     virtual void ConsumeLogMessage(LoggerPage *logPage);
 
+    /**
+     * @brief Wakes up the writer thread (only meaningful if BufferSize > 0).
+     */
+    virtual void FlushLogMessages();
+
     /**
      * @brief Calls Object::Initialise and reads the Format parameter (see class description) .
      * @param[in] data see Object::Initialise.
-     * @return true if Object::Initialise returns true.
+     * @return true if Object::Initialise returns true and, if BufferSize > 0, the writer thread is started.
      */
     virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Callback of the writer thread. Writes the pending messages to the console and waits for more.
+     * @param[in] info see EmbeddedServiceMethodBinderI.
+     * @return ErrorManagement::NoError.
+     */
+    ErrorManagement::ErrorType WriterCycle(ExecutionInfo &info);
+
+    /**
+     * @brief Gets the number of log messages that were dropped because the buffer was full.
+     * @return the number of log messages dropped since the last time they were reported on the console.
+     */
+    uint32 GetNumberOfDroppedMessages() const;
 private:
 
+    /**
+     * @brief Copies \a size bytes at the end of the buffer.
+     * @return false if there is not enough free space in the buffer.
+     * @pre bufferMux is locked.
+     */
+    bool Append(const char8 * const data,
+                const uint32 size);
+
+    /**
+     * @brief Writes all the data in the buffer to the console.
+     * @details Only the writer thread (or the destructor, after stopping the writer thread) removes data from the buffer.
+     */
+    void WritePending();
+
     /**
      *  The basic console where the logs are printed to.
      */
     BasicConsole console;
 
+    /**
+     * The ring buffer (NULL if BufferSize = 0).
+     */
+    char8 *buffer;
+
+    /**
+     * The size of the buffer.
+     */
+    uint32 bufferSize;
+
+    /**
+     * Index in the buffer where the next message is to be copied.
+     */
+    uint32 bufferHead;
+
+    /**
+     * Number of bytes in the buffer not yet written to the console.
+     */
+    uint32 bufferUsed;
+
+    /**
+     * Number of messages dropped since the last report.
+     */
+    uint32 droppedMessages;
+
+    /**
+     * Protects the buffer indexes and droppedMessages.
+     */
+    FastPollingMutexSem bufferMux;
+
+    /**
+     * Wakes up the writer thread.
+     */
+    EventSem writerSem;
+
+    /**
+     * Set when the writer thread shall terminate.
+     */
+    bool stopWriter;
+
+    /**
+     * Binds WriterCycle to the writerService.
+     */
+    EmbeddedServiceMethodBinderT<ConsoleLogger> writerBinder;
+
+    /**
+     * The writer thread.
+     */
+    SingleThreadService writerService;
+
 };
 }
 
@@ -31,6 +31,7 @@
 #include "LoggerConsumerI.h"
 #include "Object.h"
 #include "StreamString.h"
+#include "StringHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -51,7 +52,11 @@ LoggerConsumerI::~LoggerConsumerI() {
 
 }
 
-void LoggerConsumerI::PrintToStream(LoggerPage * const logPage, BufferedStreamI &err) const {
+void LoggerConsumerI::FlushLogMessages() {
+
+}
+
+void LoggerConsumerI::PrintToStream(LoggerPage * const logPage, BufferedStreamI &err) {
     StreamString errorCodeStr;
     ErrorManagement::ErrorInformation errorInfo = logPage->errorInfo;
     const char8 *key = "";
@@ -82,10 +87,26 @@ void LoggerConsumerI::PrintToStream(LoggerPage * const logPage, BufferedStreamI
             key = "|";
         }
         TimeStamp ts;
-        if (ts.ConvertFromEpoch(static_cast<oslong>(errorInfo.timeSeconds))) {
+        if (timeStampCache.Convert(static_cast<oslong>(errorInfo.timeSeconds), ts)) {
             (void) err.Printf("%s%d:%d:%d (%d)", key, ts.GetHour(), ts.GetMinutes(), ts.GetSeconds(), errorInfo.hrtTime);
         }
     }
+    if (formatPrefs.timeISO8601.operator bool()) {
+        if (printKeys) {
+            key = "|TI=";
+        }
+        else {
+            key = "|";
+        }
+        const char8 * const iso8601 = timeStampCache.GetISO8601(static_cast<oslong>(errorInfo.timeSeconds));
+        if (iso8601 != NULL_PTR(const char8 *)) {
+            //Already formatted: copied as is into the buffer of the stream
+            uint32 size = StringHelper::Length(key);
+            (void) err.Write(key, size);
+            size = TIME_STAMP_CACHE_ISO8601_SIZE;
+            (void) err.Write(iso8601, size);
+        }
+    }
     if (formatPrefs.objectName.operator bool()) {
         if (printKeys) {
             key = "|o=";
@@ -188,6 +209,9 @@ bool LoggerConsumerI::LoadPrintPreferences(StructuredDataI &data) {
             case 't':
                 formatPrefs.timeFull = true;
                 break;
+            case 'i':
+                formatPrefs.timeISO8601 = true;
+                break;
             case 'O':
                 formatPrefs.objectName = true;
                 break;
@@ -34,6 +34,7 @@
 #include "Logger.h"
 #include "BufferedStreamI.h"
 #include "StructuredDataI.h"
+#include "TimeStampCache.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -62,15 +63,24 @@ public:
      */
     virtual void ConsumeLogMessage(LoggerPage *logPage) = 0;
 
+    /**
+     * @brief This function is called after a burst of log messages has been consumed, i.e. when there
+     * are no more pending log messages.
+     * @details Consumers which buffer the log messages (see e.g. UDPLogger) shall output any pending data. NOOP by default.
+     */
+    virtual void FlushLogMessages();
+
 protected:
     /**
      * @brief Helper function which prints the log message into a stream.
      * @param[in] logPage the logging information.
      * @param[out] err the stream where to write the information into.
+     * @details The calendar fields of the time (t and i, see LoadPrintPreferences) are only computed again when the minute changes
+     * (see TimeStampCache), which requires the messages of a consumer to be printed by a single thread (the one of the LoggerService).
      * @pre
      *   LoadPrintPreferences()
      */
-    void PrintToStream(LoggerPage *logPage, BufferedStreamI &err) const;
+    void PrintToStream(LoggerPage *logPage, BufferedStreamI &err);
 
     /**
      * @brief Reads the Printing preference from a StructuredDataI.
@@ -78,6 +88,7 @@ protected:
      * - E: error code
      * - T: time in HRT at which the error occurred
      * - t: time in the format HH:MM:SS at which the PrintToStream above was called plus the HRT at which the error occurred
+     * - i: time in the ISO-8601 format (YYYY-MM-DDThh:mm:ss+hh:mm, local time) at which the error occurred
      * - O: the object name
      * - o: the object pointer
      * - f: the function name
@@ -91,6 +102,7 @@ protected:
      * data may contain a parameter named "PrintKeys" with value 0 or 1. If 1 the a key identifying the logging error descriptions will prefix each description with the format |KEY=, where KEY is:
      * - |E= : error code
      * - |TM= : time in HRT at which the error occurred or time in the format HH:MM:SS at which the PrintToStream above was called plus the HRT at which the error occurred
+     * - |TI= : time in the ISO-8601 format at which the error occurred
      * - |o= : the object name
      * - |O= : the object pointer
      * - |T= : the thread identifier
@@ -164,10 +176,15 @@ protected:
          */
         BitBoolean<uint16, 9u> className;
 
+        /**
+         * Print the log time in the ISO-8601 format?
+         */
+        BitBoolean<uint16, 10u> timeISO8601;
+
         /**
          * Unmapped area
          */
-        BitRange<uint16, 6u, 10u> unMapped;
+        BitRange<uint16, 5u, 11u> unMapped;
 
         /**
          * Output as uint16
@@ -194,6 +211,11 @@ private:
      */
 
     FormatPreferences formatPrefs;
+
+    /**
+     * Converts the time of the messages into calendar fields.
+     */
+    TimeStampCache timeStampCache;
 };
 }
 
@@ -29,12 +29,66 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "ClassRegistryDatabase.h"
 #include "LoggerService.h"
 #include "ReferenceT.h"
+#include "StreamString.h"
+#include "Vector.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Wakes up the LoggerService thread when a new log arrives.
+ * @param[in] parameter the EventSem where the LoggerService thread is blocked.
+ */
+static void LoggerServiceWakeUp(void * const parameter) {
+    EventSem *sem = static_cast<EventSem *>(parameter);
+    if (sem != NULL_PTR(EventSem *)) {
+        (void) sem->Post();
+    }
+}
+
+/**
+ * @brief Reads a list of error names (e.g. { FatalError Warning }) as an error mask.
+ * @param[in] data the configuration.
+ * @param[in] name the name of the list.
+ * @param[out] mask the error types listed.
+ * @return true if all the names are valid error names.
+ */
+static bool LoggerServiceReadReportMask(StructuredDataI &data,
+                                        const char8 * const name,
+                                        ErrorManagement::ErrorType &mask) {
+    AnyType namesType = data.GetType(name);
+    bool ok = (!namesType.IsVoid());
+    uint32 nOfNames = 0u;
+    if (ok) {
+        nOfNames = (namesType.GetNumberOfDimensions() == 0u) ? (1u) : (namesType.GetNumberOfElements(0u));
+    }
+    Vector<StreamString> names(nOfNames);
+    if (ok) {
+        if (namesType.GetNumberOfDimensions() == 0u) {
+            ok = data.Read(name, names[0u]);
+        }
+        else {
+            ok = data.Read(name, names);
+        }
+    }
+    mask = ErrorManagement::NoError;
+    for (uint32 i = 0u; (i < nOfNames) && (ok); i++) {
+        ErrorManagement::ErrorType errorCode;
+        ok = ErrorManagement::ErrorNameToCode(names[i].Buffer(), errorCode);
+        if (ok) {
+            mask.SetError(errorCode.format_as_integer);
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Unknown error type %s in %s", names[i].Buffer(), name);
+        }
+    }
+    return ok;
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -46,6 +100,8 @@ LoggerService::LoggerService() :
     consumers = NULL_PTR(LoggerConsumerI **);
     logger = NULL_PTR(Logger *);
     nOfConsumers = 0u;
+    maxBatchLatency = 100u;
+    (void) newEntrySem.Create();
 }
 
 /*lint -e{1551} -e{1740} the destructor must guarantee that the SingleThreadService. The logger is a singleton and is freed by the Logger class at the end of program execution*/
@@ -55,6 +111,10 @@ LoggerService::~LoggerService() {
             REPORT_ERROR(ErrorManagement::Warning, "Could not Stop the logThreadService");
         }
     }
+    if (logger != NULL_PTR(Logger *)) {
+        logger->SetConsumerWakeUp(NULL_PTR(LoggerWakeUpFunction), NULL_PTR(void *));
+    }
+    (void) newEntrySem.Close();
     if (consumers != NULL_PTR(LoggerConsumerI **)) {
         delete[] consumers;
     }
@@ -62,14 +122,24 @@ LoggerService::~LoggerService() {
 
 bool LoggerService::Initialise(StructuredDataI &data) {
     bool ok = ReferenceContainer::Initialise(data);
-    uint32 cpuMask = 0x1u;
+    ProcessorType cpuMask(0x1u);
     uint32 stackSize = THREADS_DEFAULT_STACKSIZE;
     uint32 numberOfLogPages = DEFAULT_NUMBER_OF_LOG_PAGES;
+    uint32 deferredFormatting = 0u;
+    uint32 numberOfProducerQueues = 0u;
+    uint32 producerQueuePages = DEFAULT_NUMBER_OF_PRODUCER_QUEUE_PAGES;
     if (ok) {
-        ok = data.Read("CPUs", cpuMask);
+        StreamString cpus;
+        ok = data.Read("CPUs", cpus);
         if (!ok) {
             REPORT_ERROR(ErrorManagement::Warning, "No CPUs defined");
         }
+        if (ok) {
+            ok = cpuMask.SetFromString(cpus.Buffer());
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Invalid CPUs %s", cpus.Buffer());
+            }
+        }
     }
     if (ok) {
         (void) data.Read("StackSize", stackSize);
@@ -85,6 +155,93 @@ bool LoggerService::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::Warning, "NumberOfLogPages must be > 0");
         }
     }
+    if (ok) {
+        (void) data.Read("NumberOfProducerQueues", numberOfProducerQueues);
+        (void) data.Read("ProducerQueuePages", producerQueuePages);
+        ok = (producerQueuePages > 0u);
+        if (ok) {
+            ok = ((producerQueuePages & (producerQueuePages - 1u)) == 0u);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "ProducerQueuePages must be a power of 2");
+        }
+    }
+    if (ok) {
+        (void) data.Read("MaxBatchLatency", maxBatchLatency);
+        ok = (maxBatchLatency > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "MaxBatchLatency must be > 0");
+        }
+    }
+    if (ok) {
+        (void) data.Read("DeferredFormatting", deferredFormatting);
+    }
+    if (ok) {
+        if (data.MoveRelative("ReportRateLimits")) {
+            uint32 nOfLimits = data.GetNumberOfChildren();
+            for (uint32 i = 0u; (i < nOfLimits) && (ok); i++) {
+                const char8 * const errorName = data.GetChildName(i);
+                ErrorManagement::ErrorType errorCode;
+                ok = ErrorManagement::ErrorNameToCode(errorName, errorCode);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "Unknown error type %s in ReportRateLimits", errorName);
+                }
+                if (ok) {
+                    ok = data.MoveRelative(errorName);
+                }
+                if (ok) {
+                    float64 rate = 0.0;
+                    uint32 burst = 1u;
+                    ok = data.Read("Rate", rate);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "Rate not specified for %s in ReportRateLimits", errorName);
+                    }
+                    (void) data.Read("Burst", burst);
+                    if (!data.MoveToAncestor(1u)) {
+                        ok = false;
+                    }
+                    if (ok) {
+                        ErrorManagement::SetReportRateLimit(errorCode, rate, burst);
+                    }
+                }
+            }
+            if (!data.MoveToAncestor(1u)) {
+                ok = false;
+            }
+        }
+    }
+    if (ok) {
+        if (!data.GetType("ReportMask").IsVoid()) {
+            ErrorManagement::ErrorType mask;
+            ok = LoggerServiceReadReportMask(data, "ReportMask", mask);
+            if (ok) {
+                ErrorManagement::SetReportMask(mask);
+            }
+        }
+    }
+    if (ok) {
+        if (data.MoveRelative("ClassReportMasks")) {
+            uint32 nOfClasses = data.GetNumberOfChildren();
+            for (uint32 i = 0u; (i < nOfClasses) && (ok); i++) {
+                const char8 * const className = data.GetChildName(i);
+                ClassRegistryItem * const item = ClassRegistryDatabase::Instance()->Find(className);
+                ok = (item != NULL_PTR(ClassRegistryItem *));
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "Unknown class %s in ClassReportMasks", className);
+                }
+                ErrorManagement::ErrorType mask;
+                if (ok) {
+                    ok = LoggerServiceReadReportMask(data, className, mask);
+                }
+                if (ok) {
+                    item->SetReportMask(mask);
+                }
+            }
+            if (!data.MoveToAncestor(1u)) {
+                ok = false;
+            }
+        }
+    }
     if (ok) {
         nOfConsumers = Size();
         ok = (nOfConsumers > 0u);
@@ -108,7 +265,9 @@ bool LoggerService::Initialise(StructuredDataI &data) {
         }
     }
     if (ok) {
-        logger = Logger::Instance(numberOfLogPages);
+        logger = Logger::Instance(numberOfLogPages, numberOfProducerQueues, producerQueuePages);
+        logger->SetDeferredFormatting(deferredFormatting == 1u);
+        logger->SetConsumerWakeUp(&LoggerServiceWakeUp, &newEntrySem);
         logThreadService.SetStackSize(stackSize);
         logThreadService.SetCPUMask(cpuMask);
         logThreadService.SetName(GetName());
@@ -135,6 +294,7 @@ ErrorManagement::ErrorType LoggerService::Execute(ExecutionInfo & info) {
         uint32 i;
         if (consumers != NULL_PTR(LoggerConsumerI **)) {
             LoggerPage *page = logger->GetLogEntry();
+            bool consumed = (page != NULL_PTR(LoggerPage *));
             while (page != NULL_PTR(LoggerPage *)) {
                 for (i = 0u; (i < nOfConsumers); i++) {
                     consumers[i]->ConsumeLogMessage(page);
@@ -142,13 +302,28 @@ ErrorManagement::ErrorType LoggerService::Execute(ExecutionInfo & info) {
                 logger->ReturnPage(page);
                 page = logger->GetLogEntry();
             }
+            if (consumed) {
+                for (i = 0u; (i < nOfConsumers); i++) {
+                    consumers[i]->FlushLogMessages();
+                }
+            }
         }
         if (terminate) {
             //.. and after
             Sleep::Sec(1.0F);
         }
+        else {
+            //Arm the semaphore before parking so that a Post issued in between is not lost
+            (void) newEntrySem.Reset();
+            if (logger->ParkConsumer()) {
+                (void) newEntrySem.Wait(TimeoutType(maxBatchLatency));
+            }
+            logger->UnparkConsumer();
+        }
+    }
+    else {
+        Sleep::Sec(1e-3F);
     }
-    Sleep::Sec(1e-3F);
     return ErrorManagement::NoError;
 }
 
@@ -168,6 +343,10 @@ uint32 LoggerService::GetStackSize() const {
     return logThreadService.GetStackSize();
 }
 
+uint32 LoggerService::GetMaxBatchLatency() const {
+    return maxBatchLatency;
+}
+
 CLASS_REGISTER(LoggerService, "1.0")
 
 }
@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
 #include "Logger.h"
 #include "LoggerConsumerI.h"
 #include "ReferenceContainer.h"
@@ -50,9 +51,20 @@ namespace MARTe {
  * <pre>
  * +LoggerService = {
  *     Class = LoggerService
- *     CPUs = 0x1 //Compulsory. The CPU mask where the asynchronous thread will run.
+ *     CPUs = 0x1 //Compulsory. The CPU mask (or list of CPUs, e.g. "0-3") where the asynchronous thread will run.
  *     StackSize = 32768 //Optional. The stack size of the asynchronous thread.
  *     NumberOfLogPages = 128 //Optional. The number of log pages.
+ *     NumberOfProducerQueues = 0 //Optional. The number of threads that get their own lock-free queue of log pages (see Logger::Instance). Default is 0.
+ *     ProducerQueuePages = 32 //Optional. The number of log pages of each producer queue. Must be a power of 2. Default is 32.
+ *     MaxBatchLatency = 100 //Optional. Maximum time (in milliseconds) that the asynchronous thread waits for new messages before polling the Logger again. Default is 100.
+ *     DeferredFormatting = 0 //Optional. If 1 the log messages are formatted by the asynchronous thread and not by the thread that reports them (see Logger::SetDeferredFormatting). Default is 0.
+ *     ReportRateLimits = { //Optional. Maximum rate at which each REPORT_ERROR call site reports errors of a given type (see ErrorManagement::SetReportRateLimit).
+ *         Warning = { Rate = 10 Burst = 5 } //Rate is the number of messages per second (compulsory), Burst is the number of messages accepted back to back (default 1).
+ *     }
+ *     ReportMask = { FatalError Warning } //Optional. The error types which are reported (see ErrorManagement::SetReportMask). The other reports are discarded by the REPORT_ERROR macros before being formatted. Default is all.
+ *     ClassReportMasks = { //Optional. The error types which are reported by the objects of each class (see ClassRegistryItem::SetReportMask), in addition to the ReportMask.
+ *         FastScheduler = { FatalError Warning }
+ *     }
  *     +LoggerConsumer1 = {
  *         Class = ALoggerConsumer
  *         ...
@@ -88,7 +100,9 @@ LoggerService    ();
     /**
      * @brief Callback function for the EmbeddedThread that polls data from the Logger.
      * @details Polls data from the Logger and if a new log message is available calls ConsumeLogMessage on all
-     *  the registered consumers.
+     *  the registered consumers. Once the pending messages have been consumed, FlushLogMessages is called on all the
+     *  consumers. When there are no more messages the thread parks itself (see Logger::ParkConsumer)
+     *  and blocks until the Logger receives a new message or MaxBatchLatency elapses.
      * @param[in] info see EmbeddedServiceMethodBinderI
      * @return ErrorManagement::NoError.
      */
@@ -117,6 +131,14 @@ LoggerService    ();
      *   Initialise()
      */
     uint32 GetStackSize() const;
+
+    /**
+     * @brief Gets the configured maximum batch latency.
+     * @return the configured maximum batch latency in milliseconds.
+     * @pre
+     *   Initialise()
+     */
+    uint32 GetMaxBatchLatency() const;
 private:
 
     /**
@@ -138,6 +160,16 @@ private:
      * Number of consumers.
      */
     uint32 nOfConsumers;
+
+    /**
+     * Posted by the Logger when a new message arrives while the thread is parked.
+     */
+    EventSem newEntrySem;
+
+    /**
+     * Maximum time (in milliseconds) that the thread blocks in newEntrySem.
+     */
+    uint32 maxBatchLatency;
 };
 }
 
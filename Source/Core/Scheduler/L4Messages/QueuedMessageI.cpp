@@ -35,6 +35,15 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace {
+
+/**
+ * Maximum number of messages taken from the queue on each QueueProcessing.
+ */
+const MARTe::uint32 QUEUED_MESSAGE_I_BATCH_SIZE = 16u;
+
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -99,7 +108,8 @@ ErrorManagement::ErrorType QueuedMessageI::Stop() {
 /*lint -e{1764} EmbeddedServiceMethodBinderI callback method pointer prototype requires a non constant ExecutionInfo*/
 ErrorManagement::ErrorType QueuedMessageI::QueueProcessing(ExecutionInfo &info) {
     ErrorManagement::ErrorType err;
-    ReferenceT<Message> message;
+    ReferenceT<Message> messages[QUEUED_MESSAGE_I_BATCH_SIZE];
+    uint32 numberOfMessages = 0u;
     const TimeoutType timeout = 1000;
 
     // do not handle other stages
@@ -109,18 +119,22 @@ ErrorManagement::ErrorType QueuedMessageI::QueueProcessing(ExecutionInfo &info)
 
         if (err.ErrorsCleared()) {
 
-            err = queue->GetMessage(message, timeout);
+            err = queue->GetMessages(messages, QUEUED_MESSAGE_I_BATCH_SIZE, numberOfMessages, timeout);
 
-            if (err.ErrorsCleared()) {
-                err = queuedMessageFilters.ReceiveMessage(message);
-                if (!message->IsReply()) {
-                    if (message->ExpectsReply()) {
-                        message->SetAsReply(true);
+            for (uint32 i = 0u; i < numberOfMessages; i++) {
+                // the first error is returned after handling all the messages that were taken from the queue
+                ErrorManagement::ErrorType messageErr = queuedMessageFilters.ReceiveMessage(messages[i]);
+                if (err.ErrorsCleared()) {
+                    err = messageErr;
+                }
+                if (!messages[i]->IsReply()) {
+                    if (messages[i]->ExpectsReply()) {
+                        messages[i]->SetAsReply(true);
                         // handles indirect reply
-                        if (message->ExpectsIndirectReply()) {
+                        if (messages[i]->ExpectsIndirectReply()) {
                             // simply produce a warning
                             // destination in reply is known so should not be set
-                            (void) MessageI::SendMessage(message, NULL_PTR(Object *));
+                            (void) MessageI::SendMessage(messages[i], NULL_PTR(Object *));
                         }
                     }
                 }
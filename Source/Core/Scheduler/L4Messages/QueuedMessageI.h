@@ -47,8 +47,8 @@ namespace MARTe {
  * @brief MessageI queued implementation.
  * @details Messages consumed by this MessageI are processed in the context of a thread.
  * A QueueingMessageFilter is installed (MessageI::InstallMessageFilter) and the thread blocks until
- *  a new message is consumed by this queue (QueueingMessageFilter::GetMessage). This message is then
- *  propagated to all the filter that were added to this QueuedMessageI (see InstallMessageFilterInQueue).
+ *  a new message is consumed by this queue (QueueingMessageFilter::GetMessages). All the messages taken from the queue
+ *  (up to 16 on each wake up) are then propagated to all the filter that were added to this QueuedMessageI (see InstallMessageFilterInQueue).
  */
 class QueuedMessageI: public MessageI {
 public:
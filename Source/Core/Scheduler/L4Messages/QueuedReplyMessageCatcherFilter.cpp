@@ -47,6 +47,10 @@ QueuedReplyMessageCatcherFilter::QueuedReplyMessageCatcherFilter() :
 }
 
 void QueuedReplyMessageCatcherFilter::SetMessagesToCatch(ReferenceContainer &messagesToCatchIn) {
+    //Forget the messages which were not caught the last time that the filter was used
+    while (messagesToCatch.Size() > 0u) {
+        (void) messagesToCatch.Delete(messagesToCatch.Get(0u));
+    }
     messagesToCatch = messagesToCatchIn;
 }
 
@@ -61,6 +61,7 @@ public:
 
     /**
      * @brief Sets the reply messages to be caught.
+     * @details Replaces any messages that were still to be caught, so that the filter can be reused.
      * @param[in] messagesToCatchIn the reply messages to be caught.
      */
     void SetMessagesToCatch(ReferenceContainer &messagesToCatchIn);
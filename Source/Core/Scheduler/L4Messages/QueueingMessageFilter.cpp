@@ -29,12 +29,26 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "QueueingMessageFilter.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace {
+
+/**
+ * @brief Advances a queue position (positions wrap around as unsigned integers).
+ */
+inline MARTe::int32 QueuePosition(const MARTe::int32 position,
+                                  const MARTe::uint32 steps) {
+    return static_cast<MARTe::int32>(static_cast<MARTe::uint32>(position) + steps);
+}
+
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -47,70 +61,131 @@ QueueingMessageFilter::QueueingMessageFilter() :
     if (!newMessagesAlarm.Create()) {
         REPORT_ERROR_FULL(ErrorManagement::InitialisationError, "EventSem::Create() has failed");
     }
+    messageQ = new QueueingMessageFilterSlot[QUEUEING_MESSAGE_FILTER_QUEUE_SIZE];
+    for (uint32 i = 0u; i < QUEUEING_MESSAGE_FILTER_QUEUE_SIZE; i++) {
+        messageQ[i].sequence = static_cast<int32>(i);
+    }
+    enqueuePosition = 0;
+    dequeuePosition = 0;
+    consumerWaiting = 0;
 }
 
+/*lint -e{1551} the queued messages are released in the destructor*/
 QueueingMessageFilter::~QueueingMessageFilter() {
-
+    delete[] messageQ;
 }
 
 ErrorManagement::ErrorType QueueingMessageFilter::ConsumeMessage(ReferenceT<Message> &messageToTest) {
     ErrorManagement::ErrorType err;
-    err.timeout = !mutexSemQ.FastLock();
-    if (err.ErrorsCleared()) {
-        err.fatalError = !messageQ.Insert(messageToTest, -1);
-
-        // handle the case of an element to an empty Q
-        uint32 queueSize = messageQ.Size();
-        if ((err.ErrorsCleared()) && (queueSize == 1u)) {
-            err.timeout = !newMessagesAlarm.Post();
+    err.fatalError = !messageToTest.IsValid();
+    const uint32 mask = QUEUEING_MESSAGE_FILTER_QUEUE_SIZE - 1u;
+    QueueingMessageFilterSlot *slot = NULL_PTR(QueueingMessageFilterSlot *);
+    int32 position = Atomic::Load(&enqueuePosition, Atomic::MemoryOrderRelaxed);
+    bool claimed = false;
+    //Claim the slot at the enqueuePosition. It is free when its sequence is the position itself.
+    while ((err.ErrorsCleared()) && (!claimed)) {
+        slot = &messageQ[static_cast<uint32>(position) & mask];
+        int32 sequence = Atomic::LoadAcquire(&slot->sequence);
+        int32 difference = static_cast<int32>(static_cast<uint32>(sequence) - static_cast<uint32>(position));
+        if (difference == 0) {
+            //On failure position is updated with the current enqueuePosition
+            claimed = Atomic::CompareExchange(&enqueuePosition, position, QueuePosition(position, 1u), Atomic::MemoryOrderRelaxed);
+        }
+        else if (difference < 0) {
+            //The consumer did not yet free the slot from the previous lap
+            err.overflow = true;
+        }
+        else {
+            position = Atomic::Load(&enqueuePosition, Atomic::MemoryOrderRelaxed);
+        }
+    }
+    if (claimed) {
+        slot->message = messageToTest;
+        //Publish the message
+        Atomic::Store(&slot->sequence, QueuePosition(position, 1u), Atomic::MemoryOrderSequential);
+        //Only wake up the consumer if it announced that it is waiting
+        if (Atomic::Load(&consumerWaiting, Atomic::MemoryOrderSequential) != 0) {
+            int32 waiting = 1;
+            if (Atomic::CompareExchange(&consumerWaiting, waiting, 0)) {
+                err.timeout = !newMessagesAlarm.Post();
+            }
         }
-
-        mutexSemQ.FastUnLock();
     }
     return err;
 }
 
-ErrorManagement::ErrorType QueueingMessageFilter::GetMessage(ReferenceT<Message> &message,
-                                                             const TimeoutType &timeout) {
-    ErrorManagement::ErrorType err = mutexSemQ.FastLock();
-    bool locked = !err.timeout;
+bool QueueingMessageFilter::Dequeue(ReferenceT<Message> &message) {
+    const uint32 mask = QUEUEING_MESSAGE_FILTER_QUEUE_SIZE - 1u;
+    int32 position = dequeuePosition;
+    QueueingMessageFilterSlot &slot = messageQ[static_cast<uint32>(position) & mask];
+    bool ok = (Atomic::LoadAcquire(&slot.sequence) == QueuePosition(position, 1u));
+    if (ok) {
+        message = slot.message;
+        slot.message = ReferenceT<Message>();
+        dequeuePosition = QueuePosition(position, 1u);
+        //Free the slot for the next lap
+        Atomic::StoreRelease(&slot.sequence, QueuePosition(position, QUEUEING_MESSAGE_FILTER_QUEUE_SIZE));
+    }
+    return ok;
+}
 
-    // handle the empty Q case
-    if (messageQ.Size() == 0u) {
-        if (err.ErrorsCleared()) {
-            err.fatalError = !newMessagesAlarm.Reset();
-        }
-        if (locked) {
-            mutexSemQ.FastUnLock();
-            locked = false;
-        }
-        if (err.ErrorsCleared()) {
+ErrorManagement::ErrorType QueueingMessageFilter::WaitForMessages(const TimeoutType &timeout) {
+    ErrorManagement::ErrorType err;
+    err.fatalError = !newMessagesAlarm.Reset();
+    if (err.ErrorsCleared()) {
+        Atomic::Store(&consumerWaiting, 1, Atomic::MemoryOrderSequential);
+        //Check again after announcing it, so that a message added in between is not missed
+        const uint32 mask = QUEUEING_MESSAGE_FILTER_QUEUE_SIZE - 1u;
+        int32 position = dequeuePosition;
+        int32 sequence = Atomic::Load(&messageQ[static_cast<uint32>(position) & mask].sequence, Atomic::MemoryOrderSequential);
+        if (sequence != QueuePosition(position, 1u)) {
             err = newMessagesAlarm.Wait(timeout);
         }
-        if (err.ErrorsCleared()) {
-            err = mutexSemQ.FastLock();
-            locked = !err.timeout;
-        }
+        Atomic::Store(&consumerWaiting, 0, Atomic::MemoryOrderSequential);
     }
+    return err;
+}
 
+ErrorManagement::ErrorType QueueingMessageFilter::GetMessage(ReferenceT<Message> &message,
+                                                             const TimeoutType &timeout) {
+    //ReferenceT does not allow taking its address
+    ReferenceT<Message> messages[1];
+    uint32 numberOfMessages = 0u;
+    ErrorManagement::ErrorType err = GetMessages(messages, 1u, numberOfMessages, timeout);
     if (err.ErrorsCleared()) {
-        Reference ref = messageQ.Get(0u);
-
-        err.fatalError = !ref.IsValid();
+        message = messages[0];
+    }
+    return err;
+}
 
+ErrorManagement::ErrorType QueueingMessageFilter::GetMessages(ReferenceT<Message> * const messages,
+                                                              const uint32 maxNumberOfMessages,
+                                                              uint32 &numberOfMessages,
+                                                              const TimeoutType &timeout) {
+    ErrorManagement::ErrorType err;
+    numberOfMessages = 0u;
+    err.parametersError = ((messages == NULL_PTR(ReferenceT<Message> *)) || (maxNumberOfMessages == 0u));
+    uint32 attempt;
+    //Wait only once: if all the messages were taken by another consumer the timeout is returned
+    for (attempt = 0u; (attempt < 2u) && (numberOfMessages == 0u) && (err.ErrorsCleared()); attempt++) {
+        if (attempt > 0u) {
+            err = WaitForMessages(timeout);
+        }
         if (err.ErrorsCleared()) {
-            if (messageQ.Delete(ref)) {
-                message = ref;
-                err.fatalError = !message.IsValid();
+            err = mutexSemQ.FastLock();
+            if (err.ErrorsCleared()) {
+                /*lint -e{613} messages is not NULL as checked above*/
+                while ((numberOfMessages < maxNumberOfMessages) && (Dequeue(messages[numberOfMessages]))) {
+                    numberOfMessages++;
+                }
+                mutexSemQ.FastUnLock();
             }
         }
     }
-
-    if (locked) {
-        mutexSemQ.FastUnLock();
+    if ((err.ErrorsCleared()) && (numberOfMessages == 0u)) {
+        err.timeout = true;
     }
     return err;
-
 }
 
 }
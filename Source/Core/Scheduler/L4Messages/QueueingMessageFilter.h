@@ -34,6 +34,7 @@
 
 #include "MessageFilter.h"
 #include "EventSem.h"
+#include "FastPollingMutexSem.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -41,9 +42,33 @@
 
 namespace MARTe {
 
+/**
+ * Maximum number of messages in the queue of a QueueingMessageFilter (a power of two).
+ */
+const uint32 QUEUEING_MESSAGE_FILTER_QUEUE_SIZE = 256u;
+
+/**
+ * @brief A slot of the QueueingMessageFilter queue.
+ */
+struct QueueingMessageFilterSlot {
+    /**
+     * The position in the queue for which the slot is ready to be written (== position) or read (== position + 1).
+     */
+    volatile int32 sequence;
+
+    /**
+     * The queued message.
+     */
+    ReferenceT<Message> message;
+};
+
 /**
  * @brief Adds message to a queue.
- * @details Messages consumed by this filter are added to a queue. The queue is consumed by calling the GetMessage method.
+ * @details Messages consumed by this filter are added to a queue. The queue is consumed by calling the GetMessage (or GetMessages) method.
+ *
+ * The queue is a bounded ring of QUEUEING_MESSAGE_FILTER_QUEUE_SIZE messages where each slot has a sequence number, so that
+ * the threads adding messages (ConsumeMessage) do not lock nor allocate memory. A message is refused when the queue is full.
+ * The consumer only waits on the event semaphore when the queue is empty and it is only posted if the consumer is waiting.
  */
 class DLL_API QueueingMessageFilter: public MessageFilter, public Object {
 public:
@@ -61,7 +86,8 @@ public:
     /**
      * @brief Adds the message to the message queue.
      * @param[in] messageToTest The message to add to the queue.
-     * @return ErrorManagement::NoError if the message can be successfully added to the queue.
+     * @return ErrorManagement::NoError if the message can be successfully added to the queue or
+     * ErrorManagement::Overflow if the queue is full.
      */
     virtual ErrorManagement::ErrorType ConsumeMessage(ReferenceT<Message> &messageToTest);
 
@@ -73,15 +99,62 @@ public:
      */
     ErrorManagement::ErrorType GetMessage(ReferenceT<Message> &message, const TimeoutType &timeout = TTInfiniteWait);
 
+    /**
+     * @brief Gets the oldest messages from the queue or waits for a message to be available.
+     * @details Waits as GetMessage and then gets all the available messages up to \a maxNumberOfMessages.
+     * @param[out] messages where the messages are written, from the oldest to the newest.
+     * @param[in] maxNumberOfMessages the number of elements in \a messages.
+     * @param[out] numberOfMessages the number of messages written in \a messages.
+     * @param[in] timeout The maximum time to wait for a message to be available on the queue.
+     * @return ErrorManagement::NoError if at least one message can be successfully retrieved from the queue with-in the specified timeout.
+     */
+    ErrorManagement::ErrorType GetMessages(ReferenceT<Message> * const messages,
+                                           const uint32 maxNumberOfMessages,
+                                           uint32 &numberOfMessages,
+                                           const TimeoutType &timeout = TTInfiniteWait);
+
 private:
 
+    /**
+     * @brief Removes the oldest message from the queue, if any.
+     * @param[out] message the oldest message.
+     * @return true if a message was removed.
+     * @pre
+     *   mutexSemQ is locked.
+     */
+    bool Dequeue(ReferenceT<Message> &message);
+
+    /**
+     * @brief Waits for the queue not to be empty.
+     * @param[in] timeout The maximum time to wait.
+     * @return ErrorManagement::NoError if a message was added to the queue with-in the specified timeout.
+     * @pre
+     *   mutexSemQ is locked.
+     */
+    ErrorManagement::ErrorType WaitForMessages(const TimeoutType &timeout);
+
     /**
      * Holds the messages consumed by this QueueingMessageFilter
      */
-    ReferenceContainer messageQ;
+    QueueingMessageFilterSlot *messageQ;
+
+    /**
+     * The position where the next message is added.
+     */
+    volatile int32 enqueuePosition;
+
+    /**
+     * The position of the oldest message.
+     */
+    volatile int32 dequeuePosition;
+
+    /**
+     * Different from zero while the consumer is (or is about to be) waiting on newMessagesAlarm.
+     */
+    volatile int32 consumerWaiting;
 
     /**
-     * Locks the adding/removing of messages to the queue
+     * Serialises the consumers of the queue (the producers do not lock)
      */
     FastPollingMutexSem mutexSemQ;
 
@@ -46,6 +46,13 @@ StateMachine::StateMachine() :
         ReferenceContainer(),
         QueuedMessageI() {
     currentStateStatus = Entering;
+    currentStateIndex = 0u;
+    states = NULL_PTR(ReferenceT<ReferenceContainer> *);
+    numberOfStates = 0u;
+    enterMessages = NULL_PTR(StateMachineMessages *);
+    firstTransition = NULL_PTR(uint32 *);
+    transitions = NULL_PTR(StateMachineTransition *);
+    numberOfTransitions = 0u;
 }
 
 /*lint -e{1551} the destructor must guarantee that the QueuedMessageI SingleThreadService is stopped.*/
@@ -87,9 +94,190 @@ void StateMachine::Purge(ReferenceContainer &purgeList) {
         }
     }
     PurgeFilters();
+    FreeTransitions();
     ReferenceContainer::Purge(purgeList);
 }
 
+void StateMachine::FreeTransitions() {
+    uint32 i;
+    if (enterMessages != NULL_PTR(StateMachineMessages *)) {
+        for (i = 0u; i < numberOfStates; i++) {
+            if (enterMessages[i].messages != NULL_PTR(ReferenceT<Message> *)) {
+                delete[] enterMessages[i].messages;
+            }
+        }
+        delete[] enterMessages;
+        enterMessages = NULL_PTR(StateMachineMessages *);
+    }
+    if (transitions != NULL_PTR(StateMachineTransition *)) {
+        for (i = 0u; i < numberOfTransitions; i++) {
+            if (transitions[i].messages.messages != NULL_PTR(ReferenceT<Message> *)) {
+                delete[] transitions[i].messages.messages;
+            }
+        }
+        delete[] transitions;
+        transitions = NULL_PTR(StateMachineTransition *);
+    }
+    if (states != NULL_PTR(ReferenceT<ReferenceContainer> *)) {
+        delete[] states;
+        states = NULL_PTR(ReferenceT<ReferenceContainer> *);
+    }
+    if (firstTransition != NULL_PTR(uint32 *)) {
+        delete[] firstTransition;
+        firstTransition = NULL_PTR(uint32 *);
+    }
+    numberOfStates = 0u;
+    numberOfTransitions = 0u;
+    currentStateIndex = 0u;
+}
+
+bool StateMachine::CompileMessages(ReferenceContainer &container,
+                                   const TimeoutType &timeout,
+                                   StateMachineMessages &messagesToSend) {
+    bool ok = true;
+    uint32 containerSize = container.Size();
+    messagesToSend.numberOfMessages = 0u;
+    messagesToSend.timeout = timeout;
+    messagesToSend.messages = new ReferenceT<Message>[containerSize];
+    uint32 i;
+    for (i = 0u; (i < containerSize) && (ok); i++) {
+        ReferenceT<Message> message = container.Get(i);
+        if (message.IsValid()) {
+            //Only accept indirect replies
+            if (message->ExpectsReply()) {
+                message->SetExpectsIndirectReply(true);
+            }
+            if (message->ExpectsIndirectReply()) {
+                ok = messagesToSend.replies.Insert(message);
+            }
+            messagesToSend.messages[messagesToSend.numberOfMessages] = message;
+            messagesToSend.numberOfMessages++;
+        }
+    }
+    if ((ok) && (messagesToSend.replies.Size() > 0u)) {
+        ReferenceT<QueuedReplyMessageCatcherFilter> filter(new (NULL) QueuedReplyMessageCatcherFilter());
+        filter->SetEventSemaphore(repliesSem);
+        messagesToSend.repliesCatcher = filter;
+    }
+    return ok;
+}
+
+bool StateMachine::GetStateIndex(CCString stateName,
+                                 uint32 &stateIndex) {
+    Reference state = Find(stateName);
+    bool found = false;
+    if (state.IsValid()) {
+        uint32 i;
+        for (i = 0u; (i < numberOfStates) && (!found); i++) {
+            found = (states[i] == state);
+            if (found) {
+                stateIndex = i;
+            }
+        }
+    }
+    return found;
+}
+
+bool StateMachine::CompileTransitions() {
+    FreeTransitions();
+    uint32 size = Size();
+    states = new ReferenceT<ReferenceContainer>[size];
+    uint32 i;
+    for (i = 0u; i < size; i++) {
+        ReferenceT<ReferenceContainer> state = Get(i);
+        if (state.IsValid()) {
+            states[numberOfStates] = state;
+            numberOfTransitions += state->Size();
+            numberOfStates++;
+        }
+    }
+    enterMessages = new StateMachineMessages[numberOfStates];
+    firstTransition = new uint32[numberOfStates + 1u];
+    transitions = new StateMachineTransition[numberOfTransitions];
+    for (i = 0u; i < numberOfStates; i++) {
+        enterMessages[i].messages = NULL_PTR(ReferenceT<Message> *);
+        enterMessages[i].numberOfMessages = 0u;
+    }
+    for (i = 0u; i < numberOfTransitions; i++) {
+        transitions[i].messages.messages = NULL_PTR(ReferenceT<Message> *);
+        transitions[i].messages.numberOfMessages = 0u;
+    }
+    numberOfTransitions = 0u;
+    bool ok = true;
+    for (i = 0u; (i < numberOfStates) && (ok); i++) {
+        firstTransition[i] = numberOfTransitions;
+        uint32 stateSize = states[i]->Size();
+        uint32 j;
+        for (j = 0u; (j < stateSize) && (ok); j++) {
+            ReferenceT<StateMachineEvent> event = states[i]->Get(j);
+            if (event.IsValid()) {
+                StateMachineTransition &transition = transitions[numberOfTransitions];
+                transition.event = event;
+                numberOfTransitions++;
+                ok = GetStateIndex(event->GetNextState(), transition.nextState);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "In event (%s) the next state (%s) is not a state of the StateMachine", event->GetName(),
+                                 event->GetNextState().GetList());
+                }
+                if (ok) {
+                    ok = GetStateIndex(event->GetNextStateError(), transition.nextStateError);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "In event (%s) the next state error (%s) is not a state of the StateMachine",
+                                     event->GetName(), event->GetNextStateError().GetList());
+                    }
+                }
+                if (ok) {
+                    ok = CompileMessages(*(event.operator ->()), event->GetTransitionTimeout(), transition.messages);
+                }
+            }
+        }
+        ReferenceT<ReferenceContainer> enter = states[i]->Find("ENTER");
+        if ((ok) && (enter.IsValid())) {
+            //Compute the highest timeout
+            uint32 msecTimeout = 0u;
+            uint32 n;
+            bool maxTimeoutFound = false;
+            for (n = 0u; (n < enter->Size()) && (!maxTimeoutFound); n++) {
+                ReferenceT<Message> enterMessage = enter->Get(n);
+                if (enterMessage.IsValid()) {
+                    if (enterMessage->GetReplyTimeout() == TTInfiniteWait) {
+                        maxTimeoutFound = true;
+                        msecTimeout = TTInfiniteWait.GetTimeoutMSec();
+                    }
+                    else {
+                        if (enterMessage->GetReplyTimeout().GetTimeoutMSec() > msecTimeout) {
+                            msecTimeout = enterMessage->GetReplyTimeout().GetTimeoutMSec();
+                        }
+                    }
+                }
+            }
+            ok = CompileMessages(*(enter.operator ->()), msecTimeout, enterMessages[i]);
+        }
+    }
+    firstTransition[numberOfStates] = numberOfTransitions;
+    return ok;
+}
+
+bool StateMachine::GetTransitionIndex(const ReferenceT<StateMachineEvent> &event,
+                                      uint32 &transitionIndex) const {
+    bool found = false;
+    uint32 i;
+    for (i = firstTransition[currentStateIndex]; (i < firstTransition[currentStateIndex + 1u]) && (!found); i++) {
+        found = (transitions[i].event == event);
+        if (found) {
+            transitionIndex = i;
+        }
+    }
+    //e.g. the filters of the previous state were kept after failing to send the messages of a transition to the same state
+    for (i = 0u; (i < numberOfTransitions) && (!found); i++) {
+        found = (transitions[i].event == event);
+        if (found) {
+            transitionIndex = i;
+        }
+    }
+    return found;
+}
+
 bool StateMachine::ExportData(StructuredDataI & data) {
     bool ok = ReferenceContainer::ExportData(data);
     if (ok) {
@@ -152,6 +340,15 @@ bool StateMachine::Initialise(StructuredDataI &data) {
             }
         }
     }
+    if (err.ErrorsCleared()) {
+        err.fatalError = !repliesSem.Create();
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not create the replies semaphore");
+        }
+    }
+    if (err.ErrorsCleared()) {
+        err.parametersError = !CompileTransitions();
+    }
     //Install the event listeners for the first state
     if (err.ErrorsCleared()) {
         currentState = Get(0u);
@@ -161,13 +358,12 @@ bool StateMachine::Initialise(StructuredDataI &data) {
         }
     }
     if (err.ErrorsCleared()) {
+        //The state at position zero is also the first of the compiled states
+        currentStateIndex = 0u;
         uint32 z;
-        for (z = 0u; (z < currentState->Size()) && (ok); z++) {
-            ReferenceT<StateMachineEvent> nextStateEventJ = currentState->Get(z);
-            if (nextStateEventJ.IsValid()) {
-                err = InstallMessageFilter(nextStateEventJ);
-                ok = err.ErrorsCleared();
-            }
+        for (z = firstTransition[0u]; (z < firstTransition[1u]) && (ok); z++) {
+            err = InstallMessageFilter(transitions[z].event);
+            ok = err.ErrorsCleared();
         }
     }
     if (err.ErrorsCleared()) {
@@ -183,8 +379,7 @@ bool StateMachine::Initialise(StructuredDataI &data) {
 ErrorManagement::ErrorType StateMachine::EventTriggered(ReferenceT<StateMachineEvent> event) {
     ErrorManagement::ErrorType err;
     ErrorManagement::ErrorType errSend = false;
-    StreamString nextStateError;
-    StreamString nextState;
+    uint32 transitionIndex = 0u;
 
     currentStateStatus = Exiting;
     err.fatalError = !event.IsValid();
@@ -194,159 +389,98 @@ ErrorManagement::ErrorType StateMachine::EventTriggered(ReferenceT<StateMachineE
             REPORT_ERROR(ErrorManagement::FatalError, "The current state is not valid!");
         }
     }
-
     if (err.ErrorsCleared()) {
-        nextStateError = event->GetNextStateError();
-        nextState = event->GetNextState();
-        REPORT_ERROR(ErrorManagement::Information, "Changing from state (%s) to state (%s)", currentState->GetName(), nextState.Buffer());
-        errSend = SendMultipleMessagesAndWaitReply(*(event.operator ->()), event->GetTransitionTimeout());
+        err.fatalError = !GetTransitionIndex(event, transitionIndex);
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "The event (%s) is not an event of the StateMachine", event->GetName());
+        }
     }
-
-    StreamString currentStateName=currentState->GetName();
     if (err.ErrorsCleared()) {
-        if (nextState != currentStateName) {
+        StateMachineTransition &transition = transitions[transitionIndex];
+        REPORT_ERROR(ErrorManagement::Information, "Changing from state (%s) to state (%s)", currentState->GetName(),
+                     states[transition.nextState]->GetName());
+        errSend = SendMultipleMessagesAndWaitReply(transition.messages);
+
+        bool changeState = (transition.nextState != currentStateIndex);
+        if (changeState) {
             //Remove all the filters related to the previous event (except this one which will be removed by the MessageFilter).
             uint32 j;
             bool ok = true;
-            for (j = 0u; (j < currentState->Size()) && (ok); j++) {
-                ReferenceT<StateMachineEvent> currentStateEventJ = currentState->Get(j);
-                if (currentStateEventJ.IsValid()) {
-                    if (currentStateEventJ != event) {
-                        err = RemoveMessageFilter(currentStateEventJ);
-                        ok = err.ErrorsCleared();
-                    }
+            for (j = firstTransition[currentStateIndex]; (j < firstTransition[currentStateIndex + 1u]) && (ok); j++) {
+                if (transitions[j].event != event) {
+                    err = RemoveMessageFilter(transitions[j].event);
+                    ok = err.ErrorsCleared();
                 }
             }
         }
-    }
-    if (!err.ErrorsCleared()) {
-        REPORT_ERROR(ErrorManagement::FatalError, "Error removing StateMachineEvent filters");
-    }
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Error removing StateMachineEvent filters");
+        }
 
-    //Install the next state event filters...
-    if (errSend.ErrorsCleared()) {
-        if (nextState.Size() > 0u) {
-            currentState = Find(nextState.Buffer());
+        //Install the next state event filters...
+        if (errSend.ErrorsCleared()) {
+            currentStateIndex = transition.nextState;
             currentStateStatus = Entering;
-            err.fatalError = !currentState.IsValid();
         }
         else {
-            REPORT_ERROR(err, "In state (%s) the NextState is not defined", currentState->GetName());
+            REPORT_ERROR(err, "In state (%s) could not send all the event messages. Moving to error state (%s)", currentState->GetName(),
+                         states[transition.nextStateError]->GetName());
+            currentStateIndex = transition.nextStateError;
         }
-    }
-    else {
-        REPORT_ERROR(err, "In state (%s) could not send all the event messages. Moving to error state (%s)", currentState->GetName(),
-                                nextStateError.Buffer());
-        if (nextStateError.Size() > 0u) {
-            currentState = Find(nextStateError.Buffer());
-            err.fatalError = !currentState.IsValid();
-        }
-        else {
-            REPORT_ERROR(err, "In state (%s) the NextStateError is not defined", currentState->GetName());
-        }
-    }
-    if (err.ErrorsCleared()) {
-        uint32 j;
-        bool ok = true;
-        for (j = 0u; (j < currentState->Size()) && (ok); j++) {
-            ReferenceT<StateMachineEvent> nextStateEventJ = currentState->Get(j);
-            if (nextStateEventJ.IsValid()) {
-                nextStateEventJ->Reset();
-                if (nextState != currentStateName) {
-                    err = InstallMessageFilter(nextStateEventJ);
+        currentState = states[currentStateIndex];
+        if (err.ErrorsCleared()) {
+            uint32 j;
+            bool ok = true;
+            for (j = firstTransition[currentStateIndex]; (j < firstTransition[currentStateIndex + 1u]) && (ok); j++) {
+                transitions[j].event->Reset();
+                if (changeState) {
+                    err = InstallMessageFilter(transitions[j].event);
                     ok = err.ErrorsCleared();
                 }
             }
         }
-    }
-    else {
-        REPORT_ERROR(ErrorManagement::FatalError, "In state (%s) the next state is not valid", currentState->GetName());
-    }
-    //Check if the next state there are messages to be fired at ENTER.
-    if (err.ErrorsCleared()) {
-        ReferenceT<ReferenceContainer> enterMessages = currentState->Find("ENTER");
-        //Compute the highest timeout
-        if (enterMessages.IsValid()) {
-            uint32 msecTimeout = 0u;
-            uint32 n;
-            bool maxTimeoutFound = false;
-            for (n = 0u; (n < enterMessages->Size()) && (!maxTimeoutFound); n++) {
-                ReferenceT<Message> enterMessage = enterMessages->Get(n);
-                if (enterMessage.IsValid()) {
-                    if (enterMessage->GetReplyTimeout() == TTInfiniteWait) {
-                        maxTimeoutFound = true;
-                        msecTimeout = TTInfiniteWait.GetTimeoutMSec();
-                    }
-                    else {
-                        if (enterMessage->GetReplyTimeout().GetTimeoutMSec() > msecTimeout) {
-                            msecTimeout = enterMessage->GetReplyTimeout().GetTimeoutMSec();
-                        }
-                    }
-                }
-            }
-            err = SendMultipleMessagesAndWaitReply(*(enterMessages.operator ->()), msecTimeout);
+        else {
+            REPORT_ERROR(ErrorManagement::FatalError, "In state (%s) the next state is not valid", currentState->GetName());
+        }
+        //Check if the next state there are messages to be fired at ENTER.
+        if (err.ErrorsCleared()) {
+            err = SendMultipleMessagesAndWaitReply(enterMessages[currentStateIndex]);
+        }
+        if (err.ErrorsCleared()) {
+            currentStateStatus = Executing;
         }
-    }
-    if (err.ErrorsCleared()) {
-        currentStateStatus = Executing;
     }
     return err;
 }
 
-ErrorManagement::ErrorType StateMachine::SendMultipleMessagesAndWaitReply(ReferenceContainer messagesToSend,
-                                                                          const TimeoutType &timeout) {
+ErrorManagement::ErrorType StateMachine::SendMultipleMessagesAndWaitReply(StateMachineMessages &messagesToSend) {
 
     ErrorManagement::ErrorType err;
-    //Semaphore to wait for replies from events which require a reply
-    EventSem waitSem;
-    bool ok = waitSem.Create();
-    if (ok) {
-        ok = waitSem.Reset();
-    }
-
-    //Prepare to wait for eventual replies
-    ReferenceContainer eventReplyContainer;
-    uint32 i;
-
-    //Only accept indirect replies
-    for (i = 0u; i < messagesToSend.Size(); i++) {
-        ReferenceT<Message> eventMsg = messagesToSend.Get(i);
-        if (eventMsg.IsValid()) {
-            if (eventMsg->ExpectsReply()) {
-                eventMsg->SetExpectsIndirectReply(true);
-            }
-            if (eventMsg->ExpectsIndirectReply()) {
-                err = !eventReplyContainer.Insert(eventMsg);
-            }
-        }
-    }
-
-    if (ok) {
-        ok = err.ErrorsCleared();
-    }
     //Prepare the filter which will wait for all the replies
-    if ((eventReplyContainer.Size() > 0u) && (ok)) {
-        ReferenceT<QueuedReplyMessageCatcherFilter> filter(new (NULL) QueuedReplyMessageCatcherFilter());
-        filter->SetMessagesToCatch(eventReplyContainer);
-        filter->SetEventSemaphore(waitSem);
-        err = MessageI::InstallMessageFilter(filter, 0);
+    bool waitReplies = (messagesToSend.replies.Size() > 0u);
+    if (waitReplies) {
+        err.fatalError = !repliesSem.Reset();
+        if (err.ErrorsCleared()) {
+            messagesToSend.repliesCatcher->SetMessagesToCatch(messagesToSend.replies);
+            err = MessageI::InstallMessageFilter(messagesToSend.repliesCatcher, 0);
+        }
     }
 
-    ok = err.ErrorsCleared();
-    for (i = 0u; (i < messagesToSend.Size()) && (ok); i++) {
-        ReferenceT<Message> eventMsg = messagesToSend.Get(i);
-        if (eventMsg.IsValid()) {
-            eventMsg->SetAsReply(false);
-            REPORT_ERROR(ErrorManagement::Information, "In state (%s) triggered message (%s)", currentState->GetName(), eventMsg->GetName());
-            err = MessageI::SendMessage(eventMsg, this);
-        }
+    bool ok = err.ErrorsCleared();
+    uint32 i;
+    for (i = 0u; (i < messagesToSend.numberOfMessages) && (ok); i++) {
+        messagesToSend.messages[i]->SetAsReply(false);
+        REPORT_ERROR(ErrorManagement::Information, "In state (%s) triggered message (%s)", currentState->GetName(), messagesToSend.messages[i]->GetName());
+        err = MessageI::SendMessage(messagesToSend.messages[i], this);
         ok = err.ErrorsCleared();
     }
     //Wait for all the replies to arrive...
-    if (ok) {
-        if (eventReplyContainer.Size() > 0u) {
-            err = waitSem.Wait(timeout);
-        }
+    if ((ok) && (waitReplies)) {
+        err = repliesSem.Wait(messagesToSend.timeout);
+    }
+    //The filter is only removed by itself after catching all the replies
+    if ((waitReplies) && (!err.ErrorsCleared())) {
+        (void) MessageI::RemoveMessageFilter(messagesToSend.repliesCatcher);
     }
 
     return err;
@@ -31,8 +31,11 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "EventSem.h"
+#include "Message.h"
 #include "Object.h"
 #include "QueuedMessageI.h"
+#include "QueuedReplyMessageCatcherFilter.h"
 #include "StateMachineEvent.h"
 
 /*---------------------------------------------------------------------------*/
@@ -40,6 +43,61 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * @brief The messages of a StateMachineEvent, or of the ENTER container of a state, ready to be sent.
+ */
+struct StateMachineMessages {
+    /**
+     * The messages to send, in the order in which they were defined.
+     */
+    ReferenceT<Message> *messages;
+
+    /**
+     * The number of elements in messages.
+     */
+    uint32 numberOfMessages;
+
+    /**
+     * The messages which expect an indirect reply.
+     */
+    ReferenceContainer replies;
+
+    /**
+     * The filter which waits for the replies. Only valid if replies is not empty.
+     */
+    ReferenceT<QueuedReplyMessageCatcherFilter> repliesCatcher;
+
+    /**
+     * The maximum time to wait for all the replies.
+     */
+    TimeoutType timeout;
+};
+
+/**
+ * @brief A state transition compiled from a StateMachineEvent.
+ */
+struct StateMachineTransition {
+    /**
+     * The event which triggers the transition.
+     */
+    ReferenceT<StateMachineEvent> event;
+
+    /**
+     * The index of the StateMachineEvent::GetNextState state.
+     */
+    uint32 nextState;
+
+    /**
+     * The index of the StateMachineEvent::GetNextStateError state.
+     */
+    uint32 nextStateError;
+
+    /**
+     * The messages of the event.
+     */
+    StateMachineMessages messages;
+};
+
 /**
  * @brief Implementation of a complete state machine.
  * @details A StateMachine contains one or more states (which are ReferenceContainre instances).
@@ -50,6 +108,10 @@ namespace MARTe {
  *
  * On each state, if a ReferenceContainer named ENTER exists, then all the messages belonging to this container
  *  will be sent upon entering this state.
+ *
+ * The states and the events are compiled at Initialise into a table of transitions where the next states are
+ * stored as indexes and where the messages to send (and the replies to wait for) are already collected. A state
+ * change does not search the tree for any of these.
 
  *
  * The configuration syntax is (object names are only given as an example):
@@ -133,7 +195,7 @@ StateMachine    ();
      * For every state at least one event shall be defined.
      * For every event in every state the NextState shall be defined and shall exists.
      *  For every event in every state the NextStateError shall exist.
-     * Upon successful initialisation it calls QueuedMessageI::Starts and registers the
+     * Upon successful initialisation it compiles the table of transitions, calls QueuedMessageI::Starts and registers the
      * MessageFilter for all the events of the first state.
      * @param[in] data configuration in the form:
      * * +StateMachine = {
@@ -222,16 +284,100 @@ StateMachine    ();
 private:
     /**
      * @brief Sends multiple messages and waits for all the replies to arrive.
-     * @param[in] messagesToSend container with messages to send.
+     * @param[in] messagesToSend the messages to send (see CompileMessages).
      * @return ErrorManagement::NoError if all the messages can be successfully send and all the replies are received before timeout.
      */
-    virtual ErrorManagement::ErrorType SendMultipleMessagesAndWaitReply(ReferenceContainer messagesToSend, const TimeoutType &timeout);
+    ErrorManagement::ErrorType SendMultipleMessagesAndWaitReply(StateMachineMessages &messagesToSend);
+
+    /**
+     * @brief Compiles the states and the events into the table of transitions.
+     * @pre
+     *   The NextState and the NextStateError of all the events were checked to exist.
+     * @return true if all the next states are states of this StateMachine and all the messages could be compiled.
+     */
+    bool CompileTransitions();
+
+    /**
+     * @brief Collects the Message instances of a container and prepares the wait for their replies.
+     * @details The messages which expect a reply are changed to expect an indirect reply.
+     * @param[in] container the StateMachineEvent or ENTER container with the messages.
+     * @param[in] timeout the maximum time to wait for all the replies.
+     * @param[out] messagesToSend where the messages are collected.
+     * @return true if the messages and the replies filter could be prepared.
+     */
+    bool CompileMessages(ReferenceContainer &container,
+                         const TimeoutType &timeout,
+                         StateMachineMessages &messagesToSend);
+
+    /**
+     * @brief Gets the index of a state.
+     * @param[in] stateName the name of the state to search.
+     * @param[out] stateIndex the index of the state in states.
+     * @return true if \a stateName is the name of a state of this StateMachine.
+     */
+    bool GetStateIndex(CCString stateName,
+                       uint32 &stateIndex);
+
+    /**
+     * @brief Gets the transition of an event.
+     * @details The transitions of the current state are searched first.
+     * @param[in] event the event to search.
+     * @param[out] transitionIndex the index of the transition in transitions.
+     * @return true if \a event is an event of this StateMachine.
+     */
+    bool GetTransitionIndex(const ReferenceT<StateMachineEvent> &event,
+                            uint32 &transitionIndex) const;
+
+    /**
+     * @brief Frees the table of transitions.
+     */
+    void FreeTransitions();
 
     /**
      * The state machine current state.
      */
     ReferenceT<ReferenceContainer> currentState;
 
+    /**
+     * The index of currentState in states.
+     */
+    uint32 currentStateIndex;
+
+    /**
+     * The states, in the order in which they were defined.
+     */
+    ReferenceT<ReferenceContainer> *states;
+
+    /**
+     * The number of elements in states.
+     */
+    uint32 numberOfStates;
+
+    /**
+     * The ENTER messages of each state.
+     */
+    StateMachineMessages *enterMessages;
+
+    /**
+     * The transitions of the state i are the ones from firstTransition[i] to firstTransition[i + 1] (excluded).
+     */
+    uint32 *firstTransition;
+
+    /**
+     * The transitions of all the states.
+     */
+    StateMachineTransition *transitions;
+
+    /**
+     * The number of elements in transitions.
+     */
+    uint32 numberOfTransitions;
+
+    /**
+     * Posted when all the replies of the messages sent in a transition were received.
+     */
+    EventSem repliesSem;
+
     /**
      * The current state status.
      */
@@ -48,11 +48,11 @@ CircularBufferThreadInputDataSource::CircularBufferThreadInputDataSource() :
         EmbeddedServiceMethodBinderI(),
         executor(*this) {
 
-    mutex.Create();
     currentBuffer = NULL_PTR(uint32 *);
-    sleepInMutexSec = 1e-6F;
 
-    isRefreshed = NULL_PTR(uint8 *);
+    writeSequence = NULL_PTR(volatile int32 *);
+    releasedSequence = NULL_PTR(volatile int32 *);
+    readSequence = NULL_PTR(uint32 *);
     lastReadBuffer = NULL_PTR(uint32 *);
     lastReadBuffer_1 = NULL_PTR(uint32 *);
 
@@ -77,14 +77,23 @@ CircularBufferThreadInputDataSource::CircularBufferThreadInputDataSource() :
     getFirst = false;
     stop = 0;
     sleepTime = 0.F;
+    useDriverReadBatch = false;
 
 }
 
 CircularBufferThreadInputDataSource::~CircularBufferThreadInputDataSource() {
 
-    if (isRefreshed != NULL_PTR(uint8 *)) {
-        delete[] isRefreshed;
-        isRefreshed = NULL_PTR(uint8 *);
+    if (writeSequence != NULL_PTR(volatile int32 *)) {
+        delete[] writeSequence;
+        writeSequence = NULL_PTR(volatile int32 *);
+    }
+    if (releasedSequence != NULL_PTR(volatile int32 *)) {
+        delete[] releasedSequence;
+        releasedSequence = NULL_PTR(volatile int32 *);
+    }
+    if (readSequence != NULL_PTR(uint32 *)) {
+        delete[] readSequence;
+        readSequence = NULL_PTR(uint32 *);
     }
     if (currentBuffer != NULL_PTR(uint32 *)) {
         delete[] currentBuffer;
@@ -182,11 +191,6 @@ bool CircularBufferThreadInputDataSource::Initialise(StructuredDataI &data) {
         }
         signalDefinitionInterleaved = (signalDefinitionInterleavedUInt32 == 1u);
     }
-    if (ret) {
-        if (!data.Read("SleepInMutexSec", sleepInMutexSec)) {
-            sleepInMutexSec = 1e-6F;
-        }
-    }
     if (ret) {
         uint8 getFirstTemp = 0u;
         if (!data.Read("GetFirst", getFirstTemp)) {
@@ -206,24 +210,9 @@ void CircularBufferThreadInputDataSource::PrepareInputOffsets() {
     for (uint32 i = 0u; i < numberOfSignals; i++) {
         if (i != syncSignal) {
             lastReadBuffer_1[i] = lastReadBuffer[i];
-            uint32 nStepsForward = 0u;
             //always go to the end
             //roll on consuming the circular buffer until the last written
-            while (nStepsForward < numberOfBuffers) {
-                uint32 lastReadBufTemp = (lastReadBuffer[i] + 1u);
-                if (lastReadBufTemp >= numberOfBuffers) {
-                    lastReadBufTemp = 0u;
-                }
-                (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-                uint32 index = (lastReadBufTemp * numberOfSignals) + i;
-                if (isRefreshed[index] == 0u) {
-                    mutex.FastUnLock();
-                    break;
-                }
-                mutex.FastUnLock();
-                lastReadBuffer[i] = lastReadBufTemp;
-                nStepsForward++;
-            }
+            AdvanceReadPosition(i, GetNumberOfUnreadSamples(i));
         }
     }
 }
@@ -238,22 +227,8 @@ bool CircularBufferThreadInputDataSource::Synchronise() {
     if (!getFirst) {
         //always go to the end
         //roll on consuming the circular buffer until the last written
-        /*lint -e{9113} -e{9131} -e{9007} known dependences and side effects.*/
-        while (nStepsForward < numberOfBuffers && (stop == 0)) {
-            uint32 lastReadBufTemp = (lastReadBuffer[syncSignal] + 1u);
-            if (lastReadBufTemp >= numberOfBuffers) {
-                lastReadBufTemp = 0u;
-            }
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-            uint32 index = (lastReadBufTemp * numberOfSignals) + syncSignal;
-            if (isRefreshed[index] == 0u) {
-                mutex.FastUnLock();
-                break;
-            }
-            mutex.FastUnLock();
-            lastReadBuffer[syncSignal] = lastReadBufTemp;
-            nStepsForward++;
-        }
+        nStepsForward = GetNumberOfUnreadSamples(syncSignal);
+        AdvanceReadPosition(syncSignal, nStepsForward);
     }
     bool ret = (nStepsForward < numberOfBuffers);
     /*lint -e{9113} -e{9131} -e{9007} known side effects.*/
@@ -265,27 +240,30 @@ bool CircularBufferThreadInputDataSource::Synchronise() {
         if (lastReadBuffer[syncSignal] >= numberOfBuffers) {
             lastReadBuffer[syncSignal] += numberOfBuffers;
         }
+        readSequence[syncSignal] -= stepsBack;
         //return to the last sub-block
         //triggerAfterNSamples not arrived yet
+        uint32 targetSequence = (readSequence[syncSignal] + triggerAfterNSamples);
         uint32 numberOfSamplesSinceLastTrigger = triggerAfterNSamples;
+        bool useSleep = !IsEqual(static_cast<float64>(sleepTime), static_cast<float64>(0.F));
         /*lint -e{9113} -e{9131} -e{9007} known dependences and side effects.*/
-        while (numberOfSamplesSinceLastTrigger > 0u && (stop == 0)) {
-            lastReadBuffer[syncSignal]++;
-            if (lastReadBuffer[syncSignal] >= numberOfBuffers) {
-                lastReadBuffer[syncSignal] = 0u;
+        while ((numberOfSamplesSinceLastTrigger > 0u) && (stop == 0)) {
+            int32 written = Atomic::LoadAcquire(&writeSequence[syncSignal]);
+            uint32 available = (static_cast<uint32>(written) - readSequence[syncSignal]);
+            if (available > numberOfSamplesSinceLastTrigger) {
+                available = numberOfSamplesSinceLastTrigger;
             }
-            bool isArrived = false;
-            /*lint -e{9131} -e{9007} known dependences and side effects.*/
-            while (!(isArrived) && (stop == 0)) {
-                (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-                uint32 index = (lastReadBuffer[syncSignal] * numberOfSignals) + syncSignal;
-                isArrived = (isRefreshed[index] == 1u);
-                if (!IsEqual(static_cast<float64>(sleepTime), static_cast<float64>(0.F))) {
-                    Sleep::Sec(sleepTime);
+            AdvanceReadPosition(syncSignal, available);
+            numberOfSamplesSinceLastTrigger = (targetSequence - readSequence[syncSignal]);
+            if (numberOfSamplesSinceLastTrigger > 0u) {
+                if (useSleep) {
+                    Sleep::Hybrid(static_cast<uint64>((sleepTime * 1e9) + 0.5), Sleep::GetSpinThreshold());
+                }
+                else {
+                    //the internal thread store to writeSequence wakes up the core
+                    Atomic::WaitWhileEqual(&writeSequence[syncSignal], written);
                 }
-                mutex.FastUnLock();
             }
-            numberOfSamplesSinceLastTrigger--;
         }
     }
 
@@ -332,12 +310,18 @@ bool CircularBufferThreadInputDataSource::SetConfiguredDatabase(StructuredDataI
     ret = MemoryDataSourceI::SetConfiguredDatabase(data);
     if (ret) {
         currentBuffer = new uint32[numberOfSignals];
+        writeSequence = new int32[numberOfSignals];
+        releasedSequence = new int32[numberOfSignals];
+        readSequence = new uint32[numberOfSignals];
         lastReadBuffer = new uint32[numberOfSignals];
         lastReadBuffer_1 = new uint32[numberOfSignals];
         nBrokerOpPerSignal = new uint32[numberOfSignals];
         nBrokerOpPerSignalCounter = new uint32[numberOfSignals];
         for (uint32 i = 0u; (i < numberOfSignals) && (ret); i++) {
             currentBuffer[i] = 0u;
+            writeSequence[i] = 0;
+            releasedSequence[i] = 0;
+            readSequence[i] = 0u;
             lastReadBuffer[i] = (numberOfBuffers - 1u);
             lastReadBuffer_1[i] = 0u;
             nBrokerOpPerSignal[i] = 0u;
@@ -369,9 +353,6 @@ bool CircularBufferThreadInputDataSource::SetConfiguredDatabase(StructuredDataI
             }
         }
         if (ret) {
-            uint32 nTotalElements = numberOfBuffers * numberOfSignals;
-            isRefreshed = new uint8[nTotalElements];
-            (void) MemoryOperationsHelper::Set(&isRefreshed[0], '\0', numberOfBuffers * numberOfSignals);
             /*lint -e{850} the variable i is not really modified inside the loop.*/
             for (uint32 i = 0u; (i < numberOfSignals) && (ret); i++) {
                 uint32 numberOfStates = 0u;
@@ -776,135 +757,159 @@ ErrorManagement::ErrorType CircularBufferThreadInputDataSource::Execute(Executio
     // REPORT_ERROR(ErrorManagement::Information, "CircularBufferThreadInputDataSource::Execute");
 
     if (info.GetStage() == ExecutionInfo::MainStage) {
-        //one read for each signal
-        uint32 cnt = 0u;
-        uint32 errorMemIndex = 0u;
-        //reset the error check
-        for (uint32 i = 0u; (i < numberOfSignals); i++) {
-            if ((i != timeStampSignalIndex) && (i != errorCheckSignalIndex)) {
-                uint32 readBytes = signalSize[i];
-                uint32 memoryIndex = signalOffsets[i] + (currentBuffer[i] * signalSize[i]);
-                if (DriverRead(reinterpret_cast<char8*> (&(memory[memoryIndex])), readBytes, i)) {
-                    if (readBytes == signalSize[i]) {
-                        //save the timestamp
-                        if (timeStampSignalIndex != 0xFFFFFFFFu) {
-                            uint32 index1 = (currentBuffer[timeStampSignalIndex] * (numberOfChannels));
-                            uint32 timeMemIndex = (signalOffsets[timeStampSignalIndex] + ((index1 + cnt) * static_cast<uint32> (sizeof(uint64))));
-                            void *timerPtr = &memory[timeMemIndex];
-                            *(reinterpret_cast<uint64 *> (timerPtr)) = HighResolutionTimer::Counter();
+        if (useDriverReadBatch) {
+            ExecuteDriverReadBatch();
+        }
+        else {
+            //one read for each signal
+            uint32 cnt = 0u;
+            for (uint32 i = 0u; (i < numberOfSignals); i++) {
+                if ((i != timeStampSignalIndex) && (i != errorCheckSignalIndex)) {
+                    uint32 readBytes = signalSize[i];
+                    uint32 memoryIndex = signalOffsets[i] + (currentBuffer[i] * signalSize[i]);
+                    if (DriverRead(reinterpret_cast<char8*> (&(memory[memoryIndex])), readBytes, i)) {
+                        if (readBytes == signalSize[i]) {
+                            //save the timestamp
+                            WriteTimeStamp(cnt, HighResolutionTimer::Counter());
+                        }
+                        else {
+                            //copy the timestamp of the previous buffer
+                            CopyPreviousTimeStamp(cnt);
                         }
                     }
                     else {
+                        //driver read error
+                        SetErrorCheck(cnt, 1u);
                         //copy the timestamp of the previous buffer
-                        if (timeStampSignalIndex != 0xFFFFFFFFu) {
-                            uint32 previousBuf = (currentBuffer[timeStampSignalIndex] - 1u);
-                            if (previousBuf >= numberOfBuffers) {
-                                previousBuf += numberOfBuffers;
-                            }
-                            uint32 index1 = (previousBuf * (numberOfChannels));
-                            uint32 index2 = (currentBuffer[timeStampSignalIndex] * (numberOfChannels));
-                            uint32 timeMemIndex1 = (signalOffsets[timeStampSignalIndex] + ((index1 + cnt) * static_cast<uint32> (sizeof(uint64))));
-                            uint32 timeMemIndex2 = (signalOffsets[timeStampSignalIndex] + ((index2 + cnt) * static_cast<uint32> (sizeof(uint64))));
-                            void *timerPtr2 = &(memory[timeMemIndex2]);
-                            void *timerPtr1 = &(memory[timeMemIndex1]);
-                            *reinterpret_cast<uint64*> (timerPtr2) = *reinterpret_cast<uint64*> (timerPtr1);
-                        }
+                        CopyPreviousTimeStamp(cnt);
                     }
-                }
-                else {
-                    //driver read error
-                    if (errorCheckSignalIndex != 0xFFFFFFFFu) {
-                        uint32 index = (currentBuffer[errorCheckSignalIndex] * (numberOfChannels));
-                        errorMemIndex = (signalOffsets[errorCheckSignalIndex] + ((index + cnt) * static_cast<uint32> (sizeof(uint32))));
-                        void *errorPtr = &memory[errorMemIndex];
-                        //if timeout give it a chance
-                        *reinterpret_cast<uint32*>(errorPtr) |= 1u;
-                    }
-                    //copy the timestamp of the previous buffer
-                    if (timeStampSignalIndex != 0xFFFFFFFFu) {
-                        uint32 previousBuf = (currentBuffer[timeStampSignalIndex] - 1u);
-                        if (previousBuf >= numberOfBuffers) {
-                            previousBuf += numberOfBuffers;
-                        }
-                        uint32 index1 = (previousBuf * (numberOfChannels));
-                        uint32 index2 = (currentBuffer[timeStampSignalIndex] * (numberOfChannels));
-                        uint32 timeMemIndex1 = (signalOffsets[timeStampSignalIndex] + ((index1 + cnt) * static_cast<uint32> (sizeof(uint64))));
-                        uint32 timeMemIndex2 = (signalOffsets[timeStampSignalIndex] + ((index2 + cnt) * static_cast<uint32> (sizeof(uint64))));
-                        void *timePtr2 = &memory[timeMemIndex2];
-                        void *timePtr1 = &memory[timeMemIndex1];
-                        *reinterpret_cast<uint64*> (timePtr2) = *reinterpret_cast<uint64*> (timePtr1);
+                    //refresh in any case... otherwise it will block the sync
+                    //overlap error
+                    if (IsWriteOverlap(i)) {
+                        SetErrorCheck(cnt, 2u);
                     }
+                    PublishSample(i);
+                    cnt++;
                 }
-                //refresh in any case... otherwise it will block the sync
-                {
-                    //the DriverRead returns the size read
-                    uint32 index = ((currentBuffer[i] * (numberOfSignals)) + i);
-
-                    if (errorCheckSignalIndex != 0xFFFFFFFFu) {
-                        uint32 index1 = (currentBuffer[errorCheckSignalIndex] * (numberOfChannels));
-                        errorMemIndex = (signalOffsets[errorCheckSignalIndex] + ((index1 + cnt) * static_cast<uint32> (sizeof(uint32))));
-
-                        //overlap error
-                        (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-                        if (isRefreshed[index] == 1u) {
-                            void *errorPtr = &memory[errorMemIndex];
-                            *reinterpret_cast<uint32*> (errorPtr) |= 2u;
-                        }
-                        mutex.FastUnLock();
+            }
+            PublishTimeStampAndErrorCheck();
+        }
+    }
+    else {
+        //the write position (currentBuffer) is not reset at startup since
+        //it must stay aligned with the sequence numbers seen by the consumer
+    }
+
+    // bool ret = err.ErrorsCleared();
+    // REPORT_ERROR(ret ? ErrorManagement::Information : ErrorManagement::FatalError, "CircularBufferThreadInputDataSource::Execute returning %s", ret ? "true" : "false");
+    return err;
+}
+
+/*lint -e{715} the default implementation does not read any data.*/
+bool CircularBufferThreadInputDataSource::DriverReadBatch(const uint32 firstSlot,
+                                                          const uint32 maxSlots,
+                                                          uint32 &filledSlots) {
+    filledSlots = 0u;
+    REPORT_ERROR(ErrorManagement::FatalError, "CircularBufferThreadInputDataSource::DriverReadBatch not implemented by the specialised class");
+    return false;
+}
+
+/*lint -e{613} null pointer checked before.*/
+void CircularBufferThreadInputDataSource::ExecuteDriverReadBatch() {
+    //all the channels are written (and published) in lock-step, so they share the same write position
+    uint32 firstChannel = 0u;
+    while ((firstChannel == timeStampSignalIndex) || (firstChannel == errorCheckSignalIndex)) {
+        firstChannel++;
+    }
+    if (firstChannel < numberOfSignals) {
+        uint32 maxSlots = (numberOfBuffers - currentBuffer[firstChannel]);
+        uint32 filledSlots = 0u;
+        bool ok = DriverReadBatch(currentBuffer[firstChannel], maxSlots, filledSlots);
+        uint64 timeStamp = HighResolutionTimer::Counter();
+        if (filledSlots > maxSlots) {
+            filledSlots = maxSlots;
+        }
+        //on error refresh one slot in any case... otherwise it will block the sync
+        uint32 numberOfSlots = (ok) ? (filledSlots) : (filledSlots + 1u);
+        for (uint32 s = 0u; s < numberOfSlots; s++) {
+            uint32 cnt = 0u;
+            for (uint32 i = 0u; (i < numberOfSignals); i++) {
+                if ((i != timeStampSignalIndex) && (i != errorCheckSignalIndex)) {
+                    if (s < filledSlots) {
+                        WriteTimeStamp(cnt, timeStamp);
                     }
-                    (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-                    isRefreshed[index] = 1u;
-                    mutex.FastUnLock();
-                    currentBuffer[i]++;
-                    if (currentBuffer[i] >= numberOfBuffers) {
-                        currentBuffer[i] = 0u;
+                    else {
+                        //driver read error
+                        SetErrorCheck(cnt, 1u);
+                        CopyPreviousTimeStamp(cnt);
                     }
+                    //overlap error
+                    if (IsWriteOverlap(i)) {
+                        SetErrorCheck(cnt, 2u);
+                    }
+                    PublishSample(i);
+                    cnt++;
                 }
-                cnt++;
-            }
-        }
-        if (timeStampSignalIndex != 0xFFFFFFFFu) {
-            uint32 index = (currentBuffer[timeStampSignalIndex] * (numberOfSignals)) + timeStampSignalIndex;
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-            isRefreshed[index] = 1u;
-            mutex.FastUnLock();
-            currentBuffer[timeStampSignalIndex]++;
-            if (currentBuffer[timeStampSignalIndex] >= numberOfBuffers) {
-                currentBuffer[timeStampSignalIndex] = 0u;
             }
+            PublishTimeStampAndErrorCheck();
         }
-        if (errorCheckSignalIndex != 0xFFFFFFFFu) {
-            uint32 index = (currentBuffer[errorCheckSignalIndex] * (numberOfSignals)) + errorCheckSignalIndex;
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-            isRefreshed[index] = 1u;
-            mutex.FastUnLock();
+    }
+}
 
-            currentBuffer[errorCheckSignalIndex]++;
-            if (currentBuffer[errorCheckSignalIndex] >= numberOfBuffers) {
-                currentBuffer[errorCheckSignalIndex] = 0u;
-            }
-            index = (currentBuffer[errorCheckSignalIndex] * (numberOfChannels));
-            for (uint32 i = 0u; i < numberOfChannels; i++) {
-                errorMemIndex = (signalOffsets[errorCheckSignalIndex] + ((index + i) * static_cast<uint32> (sizeof(uint32))));
-                void *errorPtr = &memory[errorMemIndex];
-                *reinterpret_cast<uint32*> (errorPtr) = 0u;
-            }
-        }
+/*lint -e{613} null pointer checked before.*/
+void CircularBufferThreadInputDataSource::WriteTimeStamp(const uint32 channelIdx,
+                                                         const uint64 timeStamp) {
+    if (timeStampSignalIndex != 0xFFFFFFFFu) {
+        uint32 index1 = (currentBuffer[timeStampSignalIndex] * (numberOfChannels));
+        uint32 timeMemIndex = (signalOffsets[timeStampSignalIndex] + ((index1 + channelIdx) * static_cast<uint32> (sizeof(uint64))));
+        void *timerPtr = &memory[timeMemIndex];
+        *(reinterpret_cast<uint64 *> (timerPtr)) = timeStamp;
     }
-    else if (info.GetStage() == ExecutionInfo::StartupStage) {
-        for (uint32 i = 0u; i < numberOfSignals; i++) {
-            currentBuffer[i] = 0u;
-        }
-        (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-        (void) MemoryOperationsHelper::Set(&isRefreshed[0], '\0', numberOfBuffers * numberOfSignals);
-        mutex.FastUnLock();
+}
+
+/*lint -e{613} null pointer checked before.*/
+void CircularBufferThreadInputDataSource::CopyPreviousTimeStamp(const uint32 channelIdx) {
+    if (timeStampSignalIndex != 0xFFFFFFFFu) {
+        uint32 previousBuf = (currentBuffer[timeStampSignalIndex] - 1u);
+        if (previousBuf >= numberOfBuffers) {
+            previousBuf += numberOfBuffers;
+        }
+        uint32 index1 = (previousBuf * (numberOfChannels));
+        uint32 index2 = (currentBuffer[timeStampSignalIndex] * (numberOfChannels));
+        uint32 timeMemIndex1 = (signalOffsets[timeStampSignalIndex] + ((index1 + channelIdx) * static_cast<uint32> (sizeof(uint64))));
+        uint32 timeMemIndex2 = (signalOffsets[timeStampSignalIndex] + ((index2 + channelIdx) * static_cast<uint32> (sizeof(uint64))));
+        void *timePtr2 = &memory[timeMemIndex2];
+        void *timePtr1 = &memory[timeMemIndex1];
+        *reinterpret_cast<uint64*> (timePtr2) = *reinterpret_cast<uint64*> (timePtr1);
     }
-    else {
+}
+
+/*lint -e{613} null pointer checked before.*/
+void CircularBufferThreadInputDataSource::SetErrorCheck(const uint32 channelIdx,
+                                                        const uint32 errorBits) {
+    if (errorCheckSignalIndex != 0xFFFFFFFFu) {
+        uint32 index = (currentBuffer[errorCheckSignalIndex] * (numberOfChannels));
+        uint32 errorMemIndex = (signalOffsets[errorCheckSignalIndex] + ((index + channelIdx) * static_cast<uint32> (sizeof(uint32))));
+        void *errorPtr = &memory[errorMemIndex];
+        *reinterpret_cast<uint32*> (errorPtr) |= errorBits;
     }
+}
 
-    // bool ret = err.ErrorsCleared();
-    // REPORT_ERROR(ret ? ErrorManagement::Information : ErrorManagement::FatalError, "CircularBufferThreadInputDataSource::Execute returning %s", ret ? "true" : "false");
-    return err;
+/*lint -e{613} null pointer checked before.*/
+void CircularBufferThreadInputDataSource::PublishTimeStampAndErrorCheck() {
+    if (timeStampSignalIndex != 0xFFFFFFFFu) {
+        PublishSample(timeStampSignalIndex);
+    }
+    if (errorCheckSignalIndex != 0xFFFFFFFFu) {
+        PublishSample(errorCheckSignalIndex);
+        //reset the error check of the next buffer
+        uint32 index = (currentBuffer[errorCheckSignalIndex] * (numberOfChannels));
+        for (uint32 i = 0u; i < numberOfChannels; i++) {
+            uint32 errorMemIndex = (signalOffsets[errorCheckSignalIndex] + ((index + i) * static_cast<uint32> (sizeof(uint32))));
+            void *errorPtr = &memory[errorMemIndex];
+            *reinterpret_cast<uint32*> (errorPtr) = 0u;
+        }
+    }
 }
 
 /*lint -e{715} the offset and the numberOfSamples are not required for the default implementation.*/
@@ -918,19 +923,8 @@ bool CircularBufferThreadInputDataSource::TerminateInputCopy(const uint32 signal
     nBrokerOpPerSignalCounter[signalIdx]--;
     if ((nBrokerOpPerSignalCounter[signalIdx] == 0u) || (nBrokerOpPerSignalCounter[signalIdx] >= nBrokerOpPerSignal[signalIdx])) {
         //set as read
-        nBrokerOpPerSignalCounter[signalIdx] = nBrokerOpPerSignal[signalIdx];
-        uint32 index = (lastReadBuffer_1[signalIdx]);
-
-        while (index != lastReadBuffer[signalIdx]) {
-            index++;
-            if (index >= numberOfBuffers) {
-                index = 0u;
-            }
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-            uint32 index1 = (index * numberOfSignals) + signalIdx;
-            isRefreshed[index1] = 0u;
-            mutex.FastUnLock();
-        }
+        //all the buffers up to the read position can be written again by the internal thread
+        Atomic::StoreRelease(&releasedSequence[signalIdx], static_cast<int32>(readSequence[signalIdx]));
         nBrokerOpPerSignalCounter[signalIdx] = nBrokerOpPerSignal[signalIdx];
     }
 
@@ -33,8 +33,8 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "Atomic.h"
 #include "EmbeddedServiceMethodBinderI.h"
-#include "FastPollingMutexSem.h"
 #include "MemoryDataSourceI.h"
 #include "SingleThreadService.h"
 
@@ -49,6 +49,13 @@ namespace MARTe {
  * @details This function has to be implemented for the specific data source. An internal counter (nBrokerOpPerSignalCounter) monitors how many brokers have read the target buffer. When this counter gets to zero the buffer
  *  is allowed to be written again by the thread, otherwise a buffer over-run will be generated.
  *
+ * The hand-off between the internal thread (single producer) and the real-time thread (single consumer) is wait-free and does not use any lock:
+ *  for each signal the internal thread publishes, with release semantics, the sequence number of the last sample written (writeSequence) and the
+ *  real-time thread publishes, with release semantics, the sequence number of the last sample that was consumed by the brokers (releasedSequence).
+ *  Each side reads the other side's counter with acquire semantics, so that a sample is never visible before its data and a buffer is never
+ *  reported as free before the brokers have copied it. The real-time thread never waits on a location that is held by the internal thread while
+ *  it is executing DriverRead(*).
+ *
  * Two optional signals can be defined and are recognised by name:
  *   \a InternalTimeStamp: stores the HighResolutionTimer::Counter() time stamp of the signals once they have been read. It must be
  *     uint64 type and it must have a number of elements equal to the number of signals that the data source produces.
@@ -57,6 +64,10 @@ namespace MARTe {
  *       - bit 0: DriverRead(*) function returns false.
  *       - bit 1: Write overlap. Attempting to write on a sample that hasn't been read yet by the consumers.
  *
+ * Drivers that receive a whole frame at once (e.g. a DMA page per interrupt) can instead implement \a DriverReadBatch(*), which fills several
+ *  consecutive buffer slots of all the signals in one call, and set \a useDriverReadBatch to true (e.g. in their constructor). In this case \a DriverRead(*)
+ *  is never called and the interleaved accelerators can be used to de-interleave all the slots of the batch in bulk.
+ *
  * This data source also allows to specify signals as being "interleaved". In order to achieve this, each signal must declared a field named PacketMemberSizes which describes its structure.
  * As an example PacketMemberSizes={4,2,2,8} would mean that the signal (whose NumberOfElements shall be 16 for an uint8 type) is composed of an uint32, followed by 2 uint16 and finally followed by an uint64.
   * A series of protected accelerators (see numberOfInterleavedSamples, numberOfInterleavedSignalMembers and memberByteSize) allow specialised classes to use this information, together with the number of samples, to go from an interleaved memory representation to a non-interleaved representation (where each signal contains N consecutive samples of its type).
@@ -73,9 +84,8 @@ namespace MARTe {
  *     *CpuMask = 0x1 (the cpus where the internal thread is allowed to run: default is 0xFFFF)
  *     *ReceiverThreadPriority = 0-31 (the priority of the internal thread, default is 31)
  *     *ReceiverThreadStackSize = 0-31 (the stack size of the internal thread, default is THREADS_DEFAULT_STACKSIZE)
- *     *SleepTime = 0 (the sleep time in mutex in seconds, default is 0.F)
+ *     *SleepTime = 0 (the sleep time in seconds between two polls of the synchronising signal, default is 0.F, i.e. wait for the event without sleeping. Sleeps shorter than Sleep::GetSpinThreshold() are busy waited)
  *     *SignalDefinitionInterleaved = 0/1 (if 0, default, it is assumed that the signal is not defined as interleaved)
- *     *sleepInMutexSec = 1e-6F (the sleep time in mutex in seconds, default is 1e-6F)
  *     *GetFirst = 0/1 (if 0, default, do not wait for the first valid buffer to arrive)
  *     Signals = {
  *         *InternalTimeStamp = {
@@ -132,7 +142,8 @@ public:
      * @details Denoting with N, the number of samples of the synchronising signal, this function waits that the last N samples arrives.
      *   If between two calls to this function, a number of samples M > N has arrived, it waits the other N-mod(M,N) samples before returning.
      * @details If the internal thread is faster then the readers and all the buffers are set as written but no read, this method fails to
-     *   find the last buffer written by the internal thread and returns false.
+     *   find the last buffer written by the internal thread and returns false. The read position is in this case moved to the last sample
+     *   written so that the next call can recover.
      * @post
      *   lastReadBuffer[syncSignal] = the index of last buffer written by the internal thread for the synchronising signal.
      */
@@ -178,6 +189,7 @@ public:
      * @brief Sets the lastReadBuffer indexes to the last buffer written by the internal thread for all the signals.
      * @see DataSourceI::PrepareInputOffsets
      * @details This method is called by the MemoryMapMultiBufferInputBroker before the read operations to synchronise the buffers to the latest written.
+     * If the internal thread has written more than numberOfBuffers samples since the last read, the oldest samples are skipped.
      * post
      *   for each signal i: lastReadBuffer[i] = the index of last buffer written by the internal thread for the signal i.
      *
@@ -204,6 +216,9 @@ public:
      *
      * @details If DriverRead returns a read size different than the byte size for the signal i, the signal i is assumed to be not written and its buffer number (currentBuffer)
      * is not incremented. If DriverRead explicitly fails returning false, the buffer is not incremented and if the ErrorCheck signal exists, the error is reported with code 0x1.
+     * @details If useDriverReadBatch is true DriverReadBatch is called instead and all the slots that it fills are published at once.
+     * @details After each read the writeSequence of the signal is published with release semantics. The sequence counters are kept across a restart of the
+     * internal thread, so that the positions of the producer and of the consumer stay aligned.
      */
     virtual ErrorManagement::ErrorType Execute(ExecutionInfo & info);
 
@@ -215,6 +230,20 @@ public:
      */
     virtual bool DriverRead(char8 * const bufferToFill, uint32 &sizeToRead, const uint32 signalIdx)=0;
 
+    /**
+     * @brief The optional low level interface to read several buffer slots of all the signals in one call.
+     * @details Only called if useDriverReadBatch is true. The slot k of the signal i starts at GetSlotMemory(i, k) and it is signalSize[i] bytes long.
+     * All the signals, except the InternalTimeStamp and the ErrorCheck, shall be filled for each slot in [firstSlot, firstSlot + filledSlots[.
+     * The slots are contiguous in memory for each signal, i.e. the batch never wraps around the end of the circular buffer.
+     * All the slots filled in the same call get the same InternalTimeStamp.
+     * @param[in] firstSlot the first slot to be filled.
+     * @param[in] maxSlots the maximum number of slots that can be filled (numberOfBuffers - firstSlot).
+     * @param[out] filledSlots the number of slots effectively filled (it may be zero).
+     * @return false in case of error. The slot following the ones filled is then published with the ErrorCheck bit 0 set.
+     * The default implementation returns false.
+     */
+    virtual bool DriverReadBatch(const uint32 firstSlot, const uint32 maxSlots, uint32 &filledSlots);
+
     /**
      * @see ReferenceContainer::Purge
      * @details Stops the execution of the internal thread.
@@ -240,17 +269,22 @@ protected:
     SingleThreadService executor;
 
     /**
-     * The spinlock used to guarantee mutual access to the
-     * shared isRefreshed flag memory
+     * The per-signal sequence number of the samples written by the internal thread, i.e. the
+     * number of samples published so far (modulo 2^32). Written only by the internal thread (release)
+     * and read by the real-time thread (acquire).
+     */
+    volatile int32 *writeSequence;
+
+    /**
+     * The per-signal sequence number of the samples that have been consumed by the brokers. Written only by the
+     * real-time thread (release) in TerminateInputCopy and read by the internal thread (acquire) to detect write overlaps.
      */
-    FastPollingMutexSem mutex;
+    volatile int32 *releasedSequence;
 
     /**
-     * The flags to denote if a buffer is written or read
-     * isRefreshed[i]=1: the buffer i is written by the internal thread.
-     * isRefreshed[i]=0: the buffer i is read by the brokers.
+     * The per-signal sequence number of the samples reached by the read position (lastReadBuffer). Only accessed by the real-time thread.
      */
-    uint8 *isRefreshed;
+    uint32 *readSequence;
 
     /**
      * Denotes the last buffer read by the brokers.
@@ -298,11 +332,6 @@ protected:
      */
     uint32 errorCheckSignalIndex;
 
-    /**
-     * How much time to sleep in lock.
-     */
-    float32 sleepInMutexSec;
-
     /**
      * The ratio between the signal size (NOfElements * TypeSize) / Size of the packet will define how many times the packet structure is repeated inside the memory. This is the content that will be transformed from interleaved to flat.
      */
@@ -348,6 +377,16 @@ protected:
      */
     float32 sleepTime;
 
+    /**
+     * If true the internal thread reads the signals with DriverReadBatch instead of DriverRead.
+     */
+    bool useDriverReadBatch;
+
+    /**
+     * @brief Returns the address of the buffer slot \a slot of the signal \a signalIdx.
+     */
+    inline char8 *GetSlotMemory(const uint32 signalIdx, const uint32 slot) const;
+
 private:
 
     /**
@@ -360,6 +399,51 @@ private:
      */
     bool GenererateInterleavedAcceleratorsSignalDefinitionInterleaved();
 
+    /**
+     * @brief Returns the number of samples of the signal \a signalIdx written by the internal thread and not yet reached by the read position.
+     */
+    inline uint32 GetNumberOfUnreadSamples(const uint32 signalIdx) const;
+
+    /**
+     * @brief Moves the read position of the signal \a signalIdx forward by \a nSamples.
+     */
+    inline void AdvanceReadPosition(const uint32 signalIdx, const uint32 nSamples);
+
+    /**
+     * @brief Returns true if the buffer at the write position of the signal \a signalIdx has not yet been released by the brokers.
+     */
+    inline bool IsWriteOverlap(const uint32 signalIdx) const;
+
+    /**
+     * @brief Publishes the sample at the write position of the signal \a signalIdx and moves the write position forward.
+     */
+    inline void PublishSample(const uint32 signalIdx);
+
+    /**
+     * @brief Reads and publishes a batch of slots with DriverReadBatch.
+     */
+    void ExecuteDriverReadBatch();
+
+    /**
+     * @brief Writes \a timeStamp in the InternalTimeStamp (if defined) of the channel \a channelIdx at the write position.
+     */
+    void WriteTimeStamp(const uint32 channelIdx, const uint64 timeStamp);
+
+    /**
+     * @brief Copies the InternalTimeStamp (if defined) of the channel \a channelIdx from the previous buffer to the write position.
+     */
+    void CopyPreviousTimeStamp(const uint32 channelIdx);
+
+    /**
+     * @brief Sets \a errorBits in the ErrorCheck (if defined) of the channel \a channelIdx at the write position.
+     */
+    void SetErrorCheck(const uint32 channelIdx, const uint32 errorBits);
+
+    /**
+     * @brief Publishes the InternalTimeStamp and the ErrorCheck (if defined) and resets the ErrorCheck of the next buffer.
+     */
+    void PublishTimeStampAndErrorCheck();
+
 };
 
 }
@@ -368,4 +452,43 @@ private:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+/*lint -e{613} null pointer checked before.*/
+inline char8 *CircularBufferThreadInputDataSource::GetSlotMemory(const uint32 signalIdx,
+                                                                 const uint32 slot) const {
+    return reinterpret_cast<char8 *>(&memory[signalOffsets[signalIdx] + (slot * signalSize[signalIdx])]);
+}
+
+/*lint -e{613} null pointer checked before.*/
+inline uint32 CircularBufferThreadInputDataSource::GetNumberOfUnreadSamples(const uint32 signalIdx) const {
+    uint32 written = static_cast<uint32>(Atomic::LoadAcquire(&writeSequence[signalIdx]));
+    return (written - readSequence[signalIdx]);
+}
+
+/*lint -e{613} null pointer checked before.*/
+inline void CircularBufferThreadInputDataSource::AdvanceReadPosition(const uint32 signalIdx,
+                                                                     const uint32 nSamples) {
+    readSequence[signalIdx] += nSamples;
+    lastReadBuffer[signalIdx] = ((lastReadBuffer[signalIdx] + (nSamples % numberOfBuffers)) % numberOfBuffers);
+}
+
+/*lint -e{613} null pointer checked before.*/
+inline bool CircularBufferThreadInputDataSource::IsWriteOverlap(const uint32 signalIdx) const {
+    uint32 released = static_cast<uint32>(Atomic::LoadAcquire(&releasedSequence[signalIdx]));
+    return ((static_cast<uint32>(writeSequence[signalIdx]) - released) >= numberOfBuffers);
+}
+
+/*lint -e{613} null pointer checked before.*/
+inline void CircularBufferThreadInputDataSource::PublishSample(const uint32 signalIdx) {
+    //the sample data must be visible before the new sequence number
+    Atomic::StoreRelease(&writeSequence[signalIdx], static_cast<int32>(static_cast<uint32>(writeSequence[signalIdx]) + 1u));
+    currentBuffer[signalIdx]++;
+    if (currentBuffer[signalIdx] >= numberOfBuffers) {
+        currentBuffer[signalIdx] = 0u;
+    }
+}
+
+}
+
 #endif /* CIRCULARBUFFERTHREADINPUTDATASOURCE_H_ */
@@ -0,0 +1,278 @@
+/**
+ * @file ExecutionWatchdog.cpp
+ * @brief Source file for class ExecutionWatchdog
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutionWatchdog (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "BrokerI.h"
+#include "ExecutionWatchdog.h"
+#include "HighResolutionTimer.h"
+#include "ObjectRegistryDatabase.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+ExecutionWatchdog::ExecutionWatchdog() :
+        Object(), EmbeddedServiceMethodBinderI(), executor(*this) {
+    threads = NULL_PTR(ExecutionWatchdogThread *);
+    numberOfThreads = 0u;
+    samplePeriod = 1u;
+    stallTimeout = 1000u;
+    stallTimeoutTicks = 0u;
+    numberOfStalls = 0u;
+    (void) periodSem.Create();
+}
+
+/*lint -e{1551} the destructor must guarantee that the sampling thread is stopped before the samples are freed*/
+ExecutionWatchdog::~ExecutionWatchdog() {
+    if (Stop() != ErrorManagement::NoError) {
+        if (Stop() != ErrorManagement::NoError) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not Stop the sampling thread");
+        }
+    }
+    if (threads != NULL_PTR(ExecutionWatchdogThread *)) {
+        for (uint32 t = 0u; t < numberOfThreads; t++) {
+            delete[] threads[t].samples;
+        }
+        delete[] threads;
+    }
+    (void) periodSem.Close();
+}
+
+bool ExecutionWatchdog::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    if (ok) {
+        ok = data.Read("Scheduler", schedulerPath);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The Scheduler shall be specified");
+        }
+    }
+    if (ok) {
+        (void) data.Read("SamplePeriod", samplePeriod);
+        (void) data.Read("StallTimeout", stallTimeout);
+        ok = ((samplePeriod > 0u) && (stallTimeout > samplePeriod));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "SamplePeriod shall be > 0 and smaller than the StallTimeout");
+        }
+    }
+    if (ok) {
+        stallTimeoutTicks = (static_cast<uint64>(stallTimeout) * HighResolutionTimer::Frequency()) / 1000u;
+        StreamString cpus;
+        if (data.Read("CPUs", cpus)) {
+            ProcessorType cpuMask;
+            ok = cpuMask.SetFromString(cpus.Buffer());
+            if (ok) {
+                executor.SetCPUMask(cpuMask);
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Invalid CPUs");
+            }
+        }
+    }
+    if (ok) {
+        uint32 stackSize;
+        if (data.Read("StackSize", stackSize)) {
+            executor.SetStackSize(stackSize);
+        }
+        executor.SetName(GetName());
+        ok = (executor.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start the sampling thread.");
+        }
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType ExecutionWatchdog::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::StartupStage) {
+        (void) periodSem.Reset();
+    }
+    else if (info.GetStage() == ExecutionInfo::MainStage) {
+        //Stop posts the semaphore so that the thread does not wait for the end of the period
+        ErrorManagement::ErrorType err = periodSem.Wait(samplePeriod);
+        if (err == ErrorManagement::Timeout) {
+            if (threads == NULL_PTR(ExecutionWatchdogThread *)) {
+                (void) ResolveThreads();
+            }
+            uint64 now = HighResolutionTimer::Counter();
+            for (uint32 t = 0u; t < numberOfThreads; t++) {
+                SampleThread(threads[t], now);
+            }
+        }
+    }
+    else {
+        //Other stages not used.
+    }
+    return ErrorManagement::NoError;
+}
+
+ErrorManagement::ErrorType ExecutionWatchdog::Stop() {
+    (void) periodSem.Post();
+    return executor.Stop();
+}
+
+bool ExecutionWatchdog::ResolveThreads() {
+    if (!scheduler.IsValid()) {
+        scheduler = ObjectRegistryDatabase::Instance()->Find(schedulerPath.Buffer());
+    }
+    bool ok = scheduler.IsValid();
+    uint32 numberOfStates = 0u;
+    if (ok) {
+        numberOfStates = scheduler->GetNumberOfStates();
+        ok = (numberOfStates > 0u);
+    }
+    if (ok) {
+        uint32 n = 0u;
+        for (uint32 s = 0u; s < numberOfStates; s++) {
+            n += scheduler->GetState(s)->numberOfThreads;
+        }
+        threads = new ExecutionWatchdogThread[n];
+        numberOfThreads = n;
+        uint32 t = 0u;
+        for (uint32 s = 0u; s < numberOfStates; s++) {
+            const ScheduledState *state = scheduler->GetState(s);
+            for (uint32 j = 0u; j < state->numberOfThreads; j++) {
+                threads[t].stateName = state->name;
+                threads[t].thread = &state->threads[j];
+                threads[t].lastWord = 0;
+                threads[t].lastChangeTicks = HighResolutionTimer::Counter();
+                threads[t].stallReported = false;
+                uint32 numberOfSamples = state->threads[j].numberOfExecutables + 1u;
+                threads[t].samples = new uint64[numberOfSamples];
+                for (uint32 e = 0u; e < numberOfSamples; e++) {
+                    threads[t].samples[e] = 0u;
+                }
+                t++;
+            }
+        }
+    }
+    return ok;
+}
+
+void ExecutionWatchdog::SampleThread(ExecutionWatchdogThread &watched,
+                                     const uint64 now) {
+    const ScheduledThread *thread = watched.thread;
+    if (thread->progress != NULL_PTR(ExecutionProgress *)) {
+        int64 word = Atomic::Load(&thread->progress->word, Atomic::MemoryOrderRelaxed);
+        uint32 index = static_cast<uint32>(static_cast<uint64>(word) & 0xFFFFFFFFu);
+        if ((index > 0u) && (index <= thread->numberOfExecutables)) {
+            watched.samples[index - 1u]++;
+        }
+        else {
+            watched.samples[thread->numberOfExecutables]++;
+        }
+        if (word != watched.lastWord) {
+            watched.lastWord = word;
+            watched.lastChangeTicks = now;
+            watched.stallReported = false;
+        }
+        else if ((index > 0u) && (index <= thread->numberOfExecutables) && (!watched.stallReported)) {
+            if ((now - watched.lastChangeTicks) > stallTimeoutTicks) {
+                StreamString name;
+                GetExecutableName(thread->executables[index - 1u], name);
+                uint32 cycle = static_cast<uint32>(static_cast<uint64>(word) >> 32u);
+                REPORT_ERROR(ErrorManagement::Warning, "Thread %s.%s stalled for more than %d ms in %s (cycle %d)", watched.stateName, thread->name,
+                             stallTimeout, name.Buffer(), cycle);
+                watched.stallReported = true;
+                numberOfStalls++;
+            }
+        }
+        else {
+            //Not stalled
+        }
+    }
+}
+
+void ExecutionWatchdog::GetExecutableName(ExecutableI * const executable,
+                                          StreamString &name) {
+    BrokerI *broker = dynamic_cast<BrokerI *>(executable);
+    if (broker != NULL_PTR(BrokerI *)) {
+        const ClassProperties *properties = broker->GetClassProperties();
+        if (properties != NULL_PTR(const ClassProperties *)) {
+            name = properties->GetName();
+        }
+        name += " of ";
+        name += broker->GetOwnerFunctionName();
+    }
+    else {
+        Object *obj = dynamic_cast<Object *>(executable);
+        if (obj != NULL_PTR(Object *)) {
+            name = obj->GetName();
+        }
+    }
+}
+
+bool ExecutionWatchdog::GetNumberOfSamples(const char8 * const stateName,
+                                           const char8 * const threadName,
+                                           const uint32 executable,
+                                           uint64 &numberOfSamples) const {
+    bool found = false;
+    for (uint32 t = 0u; (t < numberOfThreads) && (!found); t++) {
+        if ((StringHelper::Compare(stateName, threads[t].stateName) == 0) && (StringHelper::Compare(threadName, threads[t].thread->name) == 0)) {
+            found = (executable <= threads[t].thread->numberOfExecutables);
+            if (found) {
+                numberOfSamples = threads[t].samples[executable];
+            }
+        }
+    }
+    return found;
+}
+
+uint32 ExecutionWatchdog::GetNumberOfStalls() const {
+    return numberOfStalls;
+}
+
+void ExecutionWatchdog::ReportProfile() const {
+    for (uint32 t = 0u; t < numberOfThreads; t++) {
+        const ScheduledThread *thread = threads[t].thread;
+        uint64 total = 0u;
+        for (uint32 e = 0u; e <= thread->numberOfExecutables; e++) {
+            total += threads[t].samples[e];
+        }
+        for (uint32 e = 0u; (e <= thread->numberOfExecutables) && (total > 0u); e++) {
+            if (threads[t].samples[e] > 0u) {
+                StreamString name = "(outside the ExecutableIs)";
+                if (e < thread->numberOfExecutables) {
+                    GetExecutableName(thread->executables[e], name);
+                }
+                REPORT_ERROR(ErrorManagement::Information, "Thread %s.%s: %d of %d samples in %s", threads[t].stateName, thread->name,
+                             threads[t].samples[e], total, name.Buffer());
+            }
+        }
+    }
+}
+
+CLASS_REGISTER(ExecutionWatchdog, "1.0")
+}
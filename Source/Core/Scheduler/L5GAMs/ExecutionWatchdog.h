@@ -0,0 +1,250 @@
+/**
+ * @file ExecutionWatchdog.h
+ * @brief Header file for class ExecutionWatchdog
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ExecutionWatchdog
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EXECUTIONWATCHDOG_H_
+#define EXECUTIONWATCHDOG_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "GAMSchedulerI.h"
+#include "Object.h"
+#include "ReferenceT.h"
+#include "SingleThreadService.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief The sampling state of a thread watched by an ExecutionWatchdog.
+ */
+struct ExecutionWatchdogThread {
+    /**
+     * The name of the state of the thread.
+     */
+    const char8 *stateName;
+
+    /**
+     * The thread.
+     */
+    const ScheduledThread *thread;
+
+    /**
+     * The last progress word sampled.
+     */
+    int64 lastWord;
+
+    /**
+     * The HighResolutionTimer::Counter when the progress word last changed.
+     */
+    uint64 lastChangeTicks;
+
+    /**
+     * True if the current stall was already reported.
+     */
+    bool stallReported;
+
+    /**
+     * The number of samples in each ExecutableI of the thread (the last element counts the samples outside the ExecutableIs).
+     */
+    uint64 *samples;
+};
+
+/**
+ * @brief Low priority watchdog which samples the ExecutionProgress of the real-time threads of a GAMSchedulerI (see GAMScheduler)
+ * to detect the threads stalled in an ExecutableI and to profile the GAMs.
+ * @details Every SamplePeriod the progress word of each thread is read (a load of a cache line owned by the real-time thread,
+ * which does not delay it). If the word of a thread did not change for StallTimeout while the thread is within an ExecutableI,
+ * the stall is reported once, with the name of the ExecutableI (the GAM or, for a broker, the broker class and the GAM which owns
+ * it). A stall in the broker of a synchronising DataSource (e.g. waiting for a timer or for a network packet) is also reported, so
+ * that StallTimeout should be longer than the period of the slowest thread.
+ *
+ * The samples are also counted per ExecutableI, which gives a statistical profile of where the threads spend their time (see
+ * GetNumberOfSamples and ReportProfile) without any timing on the real-time path.
+ *
+ * The Scheduler is resolved when the first sample is taken, so that the watchdog can be declared outside (and before) the
+ * RealTimeApplication. The threads are known once the RealTimeApplication is configured.
+ *
+ * The configuration syntax is (names are only given as an example):
+ *
+ * <pre>
+ * +Watchdog = {
+ *     Class = ExecutionWatchdog
+ *     Scheduler = "App.Scheduler" //Compulsory. The absolute path of the GAMSchedulerI.
+ *     SamplePeriod = 1 //Optional. The time between samples in milliseconds. Default is 1.
+ *     StallTimeout = 1000 //Optional. The time in milliseconds after which a thread is considered stalled. Default is 1000.
+ *     CPUs = "0-0" //Optional. The CPUs where the sampling thread runs (see ProcessorType::SetFromString).
+ *     StackSize = 65536 //Optional. The stack size of the sampling thread.
+ * }
+ * </pre>
+ */
+class ExecutionWatchdog: public Object, public EmbeddedServiceMethodBinderI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor.
+     */
+    ExecutionWatchdog();
+
+    /**
+     * @brief Destructor. Stops the sampling thread.
+     */
+    virtual ~ExecutionWatchdog();
+
+    /**
+     * @brief Reads the parameters (see class description) and starts the sampling thread.
+     * @param[in] data see class description.
+     * @return true if all the parameters are valid and the thread could be started.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Callback function of the sampling thread (samples the threads every SamplePeriod).
+     * @param[in] info see EmbeddedServiceMethodBinderI.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Stops the sampling thread.
+     * @return see SingleThreadService::Stop.
+     */
+    ErrorManagement::ErrorType Stop();
+
+    /**
+     * @brief Gets the number of samples of a thread in one of its ExecutableIs.
+     * @param[in] stateName the name of the state.
+     * @param[in] threadName the name of the thread.
+     * @param[in] executable the index of the ExecutableI or the number of ExecutableIs of the thread for the samples outside the ExecutableIs.
+     * @param[out] numberOfSamples the number of samples.
+     * @return true if the thread is watched and \a executable is valid.
+     */
+    bool GetNumberOfSamples(const char8 * const stateName,
+                            const char8 * const threadName,
+                            const uint32 executable,
+                            uint64 &numberOfSamples) const;
+
+    /**
+     * @brief Gets the number of stalls reported.
+     * @return the number of stalls reported.
+     */
+    uint32 GetNumberOfStalls() const;
+
+    /**
+     * @brief Reports the number of samples of each thread in each of its ExecutableIs.
+     */
+    void ReportProfile() const;
+
+private:
+
+    /**
+     * @brief Resolves the Scheduler and allocates the sampling state of its threads.
+     * @return true if the Scheduler is configured.
+     */
+    bool ResolveThreads();
+
+    /**
+     * @brief Samples the progress of a thread.
+     * @param[in,out] watched the thread.
+     * @param[in] now the HighResolutionTimer::Counter of the sample.
+     */
+    void SampleThread(ExecutionWatchdogThread &watched,
+                      const uint64 now);
+
+    /**
+     * @brief Gets the name of an ExecutableI.
+     * @param[in] executable the ExecutableI.
+     * @param[out] name the name of the GAM or the class of the broker and the name of the GAM which owns it.
+     */
+    static void GetExecutableName(ExecutableI * const executable,
+                                  StreamString &name);
+
+    /**
+     * The sampling thread.
+     */
+    SingleThreadService executor;
+
+    /**
+     * Where the sampling thread waits between samples (posted by Stop).
+     */
+    EventSem periodSem;
+
+    /**
+     * The path of the Scheduler.
+     */
+    StreamString schedulerPath;
+
+    /**
+     * The Scheduler (valid once resolved).
+     */
+    ReferenceT<GAMSchedulerI> scheduler;
+
+    /**
+     * The watched threads of all the states.
+     */
+    ExecutionWatchdogThread *threads;
+
+    /**
+     * The number of elements of threads.
+     */
+    uint32 numberOfThreads;
+
+    /**
+     * The time between samples in milliseconds.
+     */
+    uint32 samplePeriod;
+
+    /**
+     * The time in milliseconds after which a thread is considered stalled.
+     */
+    uint32 stallTimeout;
+
+    /**
+     * The stallTimeout in HighResolutionTimer ticks.
+     */
+    uint64 stallTimeoutTicks;
+
+    /**
+     * The number of stalls reported.
+     */
+    uint32 numberOfStalls;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EXECUTIONWATCHDOG_H_ */
@@ -29,11 +29,14 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "ExecutionInfo.h"
 #include "FastScheduler.h"
 #include "MultiThreadService.h"
+#include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
 #include "Threads.h"
+#include "Trace.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -44,13 +47,12 @@ namespace MARTe {
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 
-const uint64 ALL_CPUS = 0xFFFFFFFFFFFFFFFFull;
-
 FastScheduler::FastScheduler() :
         GAMSchedulerI(),
         binder(*this, &FastScheduler::Execute) {
     initialised = false;
-    cpuMap = NULL_PTR(uint64 **);
+    cpuMap = NULL_PTR(ProcessorType **);
+    cpuMapAssigned = NULL_PTR(bool **);
     cpuThreadMap = NULL_PTR(uint32 **);
     multiThreadService = NULL_PTR(MultiThreadService *);
     rtThreadInfo[0] = NULL_PTR(RTThreadParam *);
@@ -63,6 +65,10 @@ FastScheduler::FastScheduler() :
     }
     maxNThreads = 0u;
     superFast = 0u;
+    useSpinBarrier = 0u;
+    spinBarrierTime = 100e-6;
+    stateGeneration = 0;
+    threadStateGeneration = NULL_PTR(int32 *);
 }
 
 /*lint -e{1551} the destructor must guarantee that the resources are stopped and freed. No exception should be thrown given that
@@ -77,6 +83,9 @@ FastScheduler::~FastScheduler() {
     if (!unusedThreadsSem.Post()) {
         //REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the event semaphore");
     }
+    if (!spinningBarrier.ForcePass()) {
+        //REPORT_ERROR(ErrorManagement::FatalError, "Failed ForcePass(*) of the spinning barrier");
+    }
     if (multiThreadService != NULL_PTR(MultiThreadService *)) {
         ErrorManagement::ErrorType err;
         err = multiThreadService->Stop();
@@ -85,6 +94,9 @@ FastScheduler::~FastScheduler() {
         }
         delete multiThreadService;
     }
+    if (threadStateGeneration != NULL_PTR(int32 *)) {
+        delete[] threadStateGeneration;
+    }
     if (rtThreadInfo[0] != NULL) {
         delete rtThreadInfo[0];
     }
@@ -94,18 +106,26 @@ FastScheduler::~FastScheduler() {
     if (cpuMap != NULL) {
         for (uint32 i = 0u; i < numberOfStates; i++) {
             if (cpuMap[i] != NULL) {
-                delete cpuMap[i];
+                delete[] cpuMap[i];
+            }
+        }
+        delete[] cpuMap;
+    }
+    if (cpuMapAssigned != NULL) {
+        for (uint32 i = 0u; i < numberOfStates; i++) {
+            if (cpuMapAssigned[i] != NULL) {
+                delete[] cpuMapAssigned[i];
             }
         }
-        delete cpuMap;
+        delete[] cpuMapAssigned;
     }
     if (cpuThreadMap != NULL) {
         for (uint32 i = 0u; i < numberOfStates; i++) {
             if (cpuThreadMap[i] != NULL) {
-                delete cpuThreadMap[i];
+                delete[] cpuThreadMap[i];
             }
         }
-        delete cpuThreadMap;
+        delete[] cpuThreadMap;
     }
 }
 
@@ -115,11 +135,29 @@ bool FastScheduler::Initialise(StructuredDataI & data) {
         if (!data.Read("NoWait", superFast)) {
             superFast = 0u;
         }
+        if (!data.Read("SpinBarrier", useSpinBarrier)) {
+            useSpinBarrier = 0u;
+        }
+        if (!data.Read("SpinBarrierTime", spinBarrierTime)) {
+            spinBarrierTime = 100e-6;
+        }
+        if (spinBarrierTime < 0.0) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "SpinBarrierTime shall not be negative");
+            ret = false;
+        }
 
-        if (Size() > 0u) {
-            ret = (Size() == 1u);
+        //The OverrunMessage (see GAMSchedulerI) is not an ErrorMessage
+        uint32 numberOfErrorMessages = 0u;
+        for (uint32 n = 0u; n < Size(); n++) {
+            Reference child = Get(n);
+            if (!IsOverrunMessage(child)) {
+                errorMessage = child;
+                numberOfErrorMessages++;
+            }
+        }
+        if (numberOfErrorMessages > 0u) {
+            ret = (numberOfErrorMessages == 1u);
             if (ret) {
-                errorMessage = Get(0u);
                 ret = errorMessage.IsValid();
                 if (!ret) {
                     //REPORT_ERROR(ErrorManagement::ParametersError, "The ErrorMessage is not valid");
@@ -155,6 +193,9 @@ void FastScheduler::Purge(ReferenceContainer &purgeList) {
     if (!countingSem.ForcePass()) {
         //REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the event semaphore");
     }
+    if (!spinningBarrier.ForcePass()) {
+        //REPORT_ERROR(ErrorManagement::FatalError, "Failed ForcePass(*) of the spinning barrier");
+    }
     if (multiThreadService != NULL) {
         ErrorManagement::ErrorType err;
         err = multiThreadService->Stop();
@@ -184,12 +225,15 @@ ErrorManagement::ErrorType FastScheduler::StartNextStateExecution() {
             initialised = true;
         }
         //stop all and release the useless ones
-        if (superFast == 0u) {
+        if ((superFast == 0u) && (useSpinBarrier == 0u)) {
             if (!countingSem.Reset()) {
                 //REPORT_ERROR(ErrorManagement::FatalError, "Failed Reset(*) of the event semaphore");
             }
         }
 
+        //each thread goes through the spinningBarrier once per state
+        (void) Atomic::FetchAdd(&stateGeneration, 1, Atomic::MemoryOrderRelease);
+
         if (!unusedThreadsSem.Post()) {
             //REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the event semaphore");
         }
@@ -217,7 +261,7 @@ void FastScheduler::ComputeMaxNThreads() {
     for (uint32 i = 0u; i < numberOfStates; i++) {
         uint32 nThreads = states[i].numberOfThreads;
         for (uint32 j = 0u; j < nThreads; j++) {
-            uint64 cpu = static_cast<uint64>(states[i].threads[j].cpu.GetProcessorMask());
+            const ProcessorType &cpu = states[i].threads[j].cpu;
             //different from the previous
             bool found = false;
             //loop on the previous states and previous states to find the same cpu
@@ -227,8 +271,7 @@ void FastScheduler::ComputeMaxNThreads() {
                     nOtherThreads = j;
                 }
                 for (uint32 k = 0u; (k < nOtherThreads) && (!found); k++) {
-                    uint64 otherCpu = static_cast<uint64>(states[h].threads[k].cpu.GetProcessorMask());
-                    found = (otherCpu == cpu);
+                    found = (states[h].threads[k].cpu == cpu);
                 }
             }
 
@@ -238,8 +281,7 @@ void FastScheduler::ComputeMaxNThreads() {
                 for (uint32 h = i; h < numberOfStates; h++) {
                     uint32 nEqualCpus = 0u;
                     for (uint32 k = 0u; k < states[h].numberOfThreads; k++) {
-                        uint64 otherCpu = static_cast<uint64>(states[h].threads[k].cpu.GetProcessorMask());
-                        if (otherCpu == cpu) {
+                        if (states[h].threads[k].cpu == cpu) {
                             nEqualCpus++;
                         }
                     }
@@ -255,7 +297,7 @@ void FastScheduler::ComputeMaxNThreads() {
 
 /*lint -e{613} the caller of CreateThreadMap guarantees that the cpuMap memory is allocated*/
 /*lint -e{850} variables are not modified by the REPORT_ERROR*/
-void FastScheduler::CreateThreadMap(const uint64 cpu,
+void FastScheduler::CreateThreadMap(const ProcessorType &cpu,
                                     const uint32 state,
                                     const uint32 thread) {
     bool found = false;
@@ -264,18 +306,19 @@ void FastScheduler::CreateThreadMap(const uint64 cpu,
 
     //match the cpu with the threads on the same line
     for (uint32 h = 0u; (h < maxNThreads) && (!found); h++) {
-        if (cpuMap[state][h] == ALL_CPUS) {
+        if (!cpuMapAssigned[state][h]) {
             bool allInvalids = false;
             for (uint32 k = 0u; (k < state) && (!found); k++) {
-                found = (cpuMap[k][h] == cpu);
+                found = (cpuMapAssigned[k][h]) && (cpuMap[k][h] == cpu);
                 if (found) {
                     //the cpu belongs to thread h
                     cpuMap[state][h] = cpu;
+                    cpuMapAssigned[state][h] = true;
                     //map the thread i,j to the thread h
                     cpuThreadMap[state][thread] = h;
                     REPORT_ERROR(ErrorManagement::Information, "cpuThreadMap[%d][%d]=%!", state, thread, h);
                 }
-                allInvalids = (cpuMap[k][h] == ALL_CPUS);
+                allInvalids = (!cpuMapAssigned[k][h]);
             }
             if (allInvalids || (state == 0u)) {
                 if (firstInvalid == UNDEFINED_THREAD_ID) {
@@ -285,10 +328,11 @@ void FastScheduler::CreateThreadMap(const uint64 cpu,
         }
     }
     if (!found) {
-        multiThreadService->SetCPUMaskThreadPool(BitSet(cpu), firstInvalid);
+        multiThreadService->SetCPUMaskThreadPool(cpu, firstInvalid);
         multiThreadService->SetPriorityClassThreadPool(Threads::RealTimePriorityClass, firstInvalid);
 
         cpuMap[state][firstInvalid] = cpu;
+        cpuMapAssigned[state][firstInvalid] = true;
         cpuThreadMap[state][thread] = firstInvalid;
         REPORT_ERROR(ErrorManagement::Information, "cpuThreadMap[%d][%d]=%!", state, thread, firstInvalid);
     }
@@ -308,13 +352,26 @@ ErrorManagement::ErrorType FastScheduler::SetupThreadMap() {
 
         //set all as invalid
         for (uint32 i = 0u; i < numberOfStates; i++) {
-            cpuMap[i] = new uint64[maxNThreads];
+            cpuMap[i] = new ProcessorType[maxNThreads];
+            cpuMapAssigned[i] = new bool[maxNThreads];
             for (uint32 j = 0u; j < maxNThreads; j++) {
-                cpuMap[i][j] = ALL_CPUS;
+                cpuMapAssigned[i][j] = false;
             }
         }
 
-        if (countingSem.Create(maxNThreads)) {
+        threadStateGeneration = new int32[maxNThreads];
+        for (uint32 j = 0u; j < maxNThreads; j++) {
+            threadStateGeneration[j] = 0;
+        }
+        uint64 spinTicks = static_cast<uint64>(spinBarrierTime * static_cast<float64>(HighResolutionTimer::Frequency()));
+        bool ok;
+        if (useSpinBarrier == 1u) {
+            ok = spinningBarrier.Create(maxNThreads, spinTicks);
+        }
+        else {
+            ok = countingSem.Create(maxNThreads);
+        }
+        if (ok) {
 
             //group for each state the threads depending on the cpu
             //if a cpu is not used in that state it will be invalid
@@ -323,8 +380,7 @@ ErrorManagement::ErrorType FastScheduler::SetupThreadMap() {
                 cpuThreadMap[i] = new uint32[nThreads];
                 for (uint32 j = 0u; j < nThreads; j++) {
 
-                    uint64 cpu = static_cast<uint64>(states[i].threads[j].cpu.GetProcessorMask());
-                    CreateThreadMap(cpu, i, j);
+                    CreateThreadMap(states[i].threads[j].cpu, i, j);
                 }
             }
 
@@ -332,7 +388,15 @@ ErrorManagement::ErrorType FastScheduler::SetupThreadMap() {
             /*lint -e{850} variables are not modified by the REPORT_ERROR*/
             for (uint32 i = 0u; i < numberOfStates; i++) {
                 for (uint32 j = 0u; j < maxNThreads; j++) {
-                    REPORT_ERROR(ErrorManagement::Information, "cpuMap[%d][%d]=%!", i, j, cpuMap[i][j]);
+                    //The masks are printed as lists of CPUs, as they may be wider than 64 bits
+                    char8 cpus[128];
+                    if (!cpuMapAssigned[i][j]) {
+                        cpus[0] = '\0';
+                    }
+                    else {
+                        (void) cpuMap[i][j].ToList(&cpus[0], static_cast<uint32>(sizeof(cpus)));
+                    }
+                    REPORT_ERROR(ErrorManagement::Information, "cpuMap[%d][%d]=%s", i, j, &cpus[0]);
                 }
             }
         }
@@ -343,6 +407,10 @@ ErrorManagement::ErrorType FastScheduler::SetupThreadMap() {
 /*lint -e{613} rtThreadInfo != NULL is guaranteed by the caller, i.e. the function will not be reached*/
 void FastScheduler::CustomPrepareNextState() {
     ErrorManagement::ErrorType err;
+    if (errorMessage.IsValid()) {
+        //The errorMessage is sent from the real-time threads
+        errorMessageDestination = ObjectRegistryDatabase::Instance()->Find(errorMessage->GetDestination());
+    }
 
     err = !realTimeApplicationT.IsValid();
     if (err.ErrorsCleared()) {
@@ -351,7 +419,8 @@ void FastScheduler::CustomPrepareNextState() {
         nextBuffer &= 0x1u;
 
         if (!initialised) {
-            cpuMap = new uint64*[numberOfStates];
+            cpuMap = new ProcessorType*[numberOfStates];
+            cpuMapAssigned = new bool*[numberOfStates];
             cpuThreadMap = new uint32*[numberOfStates];
             err = SetupThreadMap();
         }
@@ -361,7 +430,18 @@ void FastScheduler::CustomPrepareNextState() {
                 rtThreadInfo[nextBuffer][j].executables = NULL_PTR(ExecutableI **);
                 rtThreadInfo[nextBuffer][j].numberOfExecutables = 0u;
                 rtThreadInfo[nextBuffer][j].cycleTime = NULL_PTR(uint32 *);
+                rtThreadInfo[nextBuffer][j].cycleTimeHistogram = NULL_PTR(LatencyHistogram *);
                 rtThreadInfo[nextBuffer][j].lastCycleTimeStamp = 0u;
+                rtThreadInfo[nextBuffer][j].lateness = NULL_PTR(uint32 *);
+                rtThreadInfo[nextBuffer][j].period = 0u;
+                rtThreadInfo[nextBuffer][j].phase = 0u;
+                rtThreadInfo[nextBuffer][j].busyWaitTail = 0u;
+                rtThreadInfo[nextBuffer][j].nextRelease = 0u;
+                rtThreadInfo[nextBuffer][j].flatCycle = NULL_PTR(FlatCycle *);
+                rtThreadInfo[nextBuffer][j].multiRate = NULL_PTR(MultiRateSchedule *);
+                rtThreadInfo[nextBuffer][j].prefetch = NULL_PTR(const PrefetchTable *);
+                rtThreadInfo[nextBuffer][j].budgetMonitor = NULL_PTR(CycleBudgetMonitor *);
+                rtThreadInfo[nextBuffer][j].traceNameId = 0u;
             }
 
             //Launches the threads for the next state
@@ -370,7 +450,13 @@ void FastScheduler::CustomPrepareNextState() {
             for (uint32 i = 0u; i < numberOfThreads; i++) {
                 rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].executables = nextState->threads[i].executables;
                 rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].numberOfExecutables = nextState->threads[i].numberOfExecutables;
+                rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].flatCycle = nextState->threads[i].flat;
+                rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].multiRate = nextState->threads[i].multiRate;
+                rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].prefetch = nextState->threads[i].prefetch;
+                rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].budgetMonitor = nextState->threads[i].budgetMonitor;
+                rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].traceNameId = nextState->threads[i].traceNameId;
                 rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].cycleTime = nextState->threads[i].cycleTime;
+                rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].cycleTimeHistogram = nextState->threads[i].cycleTimeHistogram;
                 rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].lastCycleTimeStamp = 0u;
                 REPORT_ERROR(ErrorManagement::FatalError, "Configuring rtThreadInfo[%d][%d]=%!", nextBuffer, cpuThreadMap[nextStateIdentifier][i],
                         rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].numberOfExecutables);
@@ -391,21 +477,47 @@ ErrorManagement::ErrorType FastScheduler::Execute(ExecutionInfo & information) {
         //normal wait for an explicit post
         (void) eventSem.Wait(TTInfiniteWait);
         if (superFast == 0u) {
-            (void) countingSem.WaitForAll(TTInfiniteWait);
+            if (useSpinBarrier == 1u) {
+                int32 currentGeneration = Atomic::LoadAcquire(&stateGeneration);
+                if (threadStateGeneration[threadNumber] != currentGeneration) {
+                    threadStateGeneration[threadNumber] = currentGeneration;
+                    (void) spinningBarrier.Wait();
+                }
+            }
+            else {
+                (void) countingSem.WaitForAll(TTInfiniteWait);
+            }
         }
 
         uint32 idx = static_cast<uint32>(realTimeApplicationT->GetIndex());
 
         if (rtThreadInfo[idx] != NULL_PTR(RTThreadParam *)) {
             if (rtThreadInfo[idx][threadNumber].numberOfExecutables > 0u) {
-                bool ok = ExecuteSingleCycle(rtThreadInfo[idx][threadNumber].executables, rtThreadInfo[idx][threadNumber].numberOfExecutables);
+                bool ok;
+                uint64 cycleStartTicks = HighResolutionTimer::Counter();
+                MARTe2_TRACE_EVENT(Trace::EVENT_CYCLE_BEGIN, rtThreadInfo[idx][threadNumber].traceNameId, 0u)
+                if (rtThreadInfo[idx][threadNumber].flatCycle != NULL_PTR(FlatCycle *)) {
+                    ok = ExecuteFlatCycle(*rtThreadInfo[idx][threadNumber].flatCycle);
+                }
+                else if (rtThreadInfo[idx][threadNumber].multiRate != NULL_PTR(MultiRateSchedule *)) {
+                    ok = ExecuteMultiRateCycle(rtThreadInfo[idx][threadNumber].executables, *rtThreadInfo[idx][threadNumber].multiRate, cycleStartTicks,
+                                               rtThreadInfo[idx][threadNumber].prefetch);
+                }
+                else {
+                    ok = ExecuteSingleCycle(rtThreadInfo[idx][threadNumber].executables, rtThreadInfo[idx][threadNumber].numberOfExecutables,
+                                            cycleStartTicks, rtThreadInfo[idx][threadNumber].prefetch);
+                }
+                MARTe2_TRACE_EVENT(Trace::EVENT_CYCLE_END, rtThreadInfo[idx][threadNumber].traceNameId, 0u)
+                if (rtThreadInfo[idx][threadNumber].budgetMonitor != NULL_PTR(CycleBudgetMonitor *)) {
+                    (void) CheckCycleBudget(*rtThreadInfo[idx][threadNumber].budgetMonitor, cycleStartTicks);
+                }
                 if (!ok) {
                     REPORT_ERROR(ErrorManagement::FatalError, "Failed to ExecuteSingleCycle().");
                     //Do not set ret.fatalError = true because when ExecuteSingleCycle returns false it will trigger the MultiThreadService to restart the execution of ThreadLoop.
                     //If this was not handled then it would wait on eventSem.Wait(TTInfiniteWait) every time ExecuteSingleCycle returns false.
                     //ret.fatalError = true;
                     if (errorMessage.IsValid()) {
-                        if (MessageI::SendMessage(errorMessage, this) != ErrorManagement::NoError) {
+                        if (MessageI::SendMessage(errorMessage, this, errorMessageDestination) != ErrorManagement::NoError) {
                             //REPORT_ERROR(ErrorManagement::FatalError, "Failed to SendMessage.");
                         }
                     }
@@ -413,8 +525,10 @@ ErrorManagement::ErrorType FastScheduler::Execute(ExecutionInfo & information) {
                 uint32 absTime = 0u;
                 if (rtThreadInfo[idx][threadNumber].lastCycleTimeStamp != 0u) {
                     uint64 tmp = (HighResolutionTimer::Counter() - rtThreadInfo[idx][threadNumber].lastCycleTimeStamp);
-                    float64 ticksToTime = (static_cast<float64>(tmp) * clockPeriod) * 1e6;
-                    absTime = static_cast<uint32>(ticksToTime); //us
+                    absTime = static_cast<uint32>(HighResolutionTimer::TicksToMicroSeconds(tmp)); //us
+                    if (rtThreadInfo[idx][threadNumber].cycleTimeHistogram != NULL_PTR(LatencyHistogram *)) {
+                        rtThreadInfo[idx][threadNumber].cycleTimeHistogram->Add(absTime);
+                    }
                 }
                 uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
                 (void)MemoryOperationsHelper::Copy(rtThreadInfo[idx][threadNumber].cycleTime, &absTime, sizeToCopy);
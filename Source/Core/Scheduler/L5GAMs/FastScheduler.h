@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "CountingSem.h"
+#include "SpinningBarrier.h"
 #include "GAMScheduler.h"
 #include "GAMSchedulerI.h"
 #include "Message.h"
@@ -51,12 +52,18 @@ namespace MARTe {
  * +Scheduler = {\n
  *    Class = FastScheduler
  *    NoWait = 0 //Wait for all the cycles to terminate before executing the executables of the next cycle. Default is 0
+ *    SpinBarrier = 0 //Optional. If 1 the threads synchronise at each state start with a SpinningBarrier instead of a CountingSem. Default is 0
+ *    SpinBarrierTime = 100e-6 //Optional. Time (in seconds) that a thread spins on the SpinningBarrier before blocking. Default is 100e-6
  *     ...\n
  *    TimingDataSource = "Name of the TimingDataSource"
  *    +ErrorMessage = { //Optional. Fired every time there is an execution error. Name is only an example.
  *        Class = Message
  *        ...
  *    }
+ *    +OverrunMessage = { //Optional. Fired when a thread exceeds its CycleBudget (see GAMSchedulerI).
+ *        Class = Message
+ *        ...
+ *    }
  * }\n
  *
  * @details This scheduler executes from the beginning a number of threads and keeps them executing across the state transitions.
@@ -106,6 +113,9 @@ public:
      * before executing the executables of the next state. If 1, the RTT of the next state are executed immediately after the termination
      * of the last RTT execution from the previous state. Since every RTT has a different synchronisation point, this might lead to the
      * execution of RTTs of next and previous state at the same time.
+     *   SpinBarrier = 0|1
+     * If 1 (and NoWait = 0) the threads wait for each other at the start of each state on a cache-line aligned SpinningBarrier
+     * (which spins for SpinBarrierTime seconds before blocking) instead of on a CountingSem.
      *
      * @return At most one message shall be defined and this will be considered as the ErrorMessage.
      * @see FastSchedulerI::Initialise.
@@ -164,7 +174,7 @@ protected:
     /**
      * @brief Map the RTTs to the executables threads depending on the cpus
      */
-    void CreateThreadMap(uint64 cpu, uint32 state, uint32 thread);
+    void CreateThreadMap(const ProcessorType &cpu, uint32 state, uint32 thread);
 
     /**
     * @brief Compute the number of executables threads
@@ -206,6 +216,11 @@ protected:
      */
     ReferenceT<Message> errorMessage;
 
+    /**
+     * The destination of the errorMessage, resolved before each state starts.
+     */
+    ReferenceT<MessageI> errorMessageDestination;
+
     /**
      * Specialised real-time application reference.
      */
@@ -219,7 +234,12 @@ protected:
     /**
      * cpu map
      */
-    uint64 **cpuMap;
+    ProcessorType **cpuMap;
+
+    /**
+     * True for the elements of cpuMap which are assigned to a cpu
+     */
+    bool **cpuMapAssigned;
 
     /**
      * cpu thread map
@@ -235,6 +255,31 @@ protected:
      * Fast scheduler mode
      */
     uint8 superFast;
+
+    /**
+     * If 1 the state start synchronisation uses the spinningBarrier.
+     */
+    uint8 useSpinBarrier;
+
+    /**
+     * Time to spin on the spinningBarrier before blocking.
+     */
+    float64 spinBarrierTime;
+
+    /**
+     * The spinning barrier (used if useSpinBarrier == 1).
+     */
+    SpinningBarrier spinningBarrier;
+
+    /**
+     * Incremented at each StartNextStateExecution.
+     */
+    volatile int32 stateGeneration;
+
+    /**
+     * For each thread, the stateGeneration for which the thread last went through the spinningBarrier.
+     */
+    int32 *threadStateGeneration;
 };
 
 }
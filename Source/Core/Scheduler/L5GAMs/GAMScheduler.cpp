@@ -30,11 +30,15 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "ClockCorrelation.h"
 #include "ExecutionInfo.h"
 #include "GAMScheduler.h"
 #include "MultiThreadService.h"
+#include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
+#include "Sleep.h"
 #include "Threads.h"
+#include "Trace.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -51,6 +55,9 @@ GAMScheduler::GAMScheduler() :
     multiThreadService[1] = NULL_PTR(MultiThreadService *);
     rtThreadInfo[0] = NULL_PTR(RTThreadParam *);
     rtThreadInfo[1] = NULL_PTR(RTThreadParam *);
+    numberOfRTThreads[0] = 0u;
+    numberOfRTThreads[1] = 0u;
+    networkTime = false;
     if (!eventSem.Create()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Failed Create(*) of the event semaphore");
     }
@@ -75,6 +82,8 @@ GAMScheduler::~GAMScheduler() {
         }
         delete multiThreadService[1];
     }
+    StopParallelExecutors(0u, true);
+    StopParallelExecutors(1u, true);
     if (rtThreadInfo[0] != NULL) {
         delete rtThreadInfo[0];
     }
@@ -86,10 +95,23 @@ GAMScheduler::~GAMScheduler() {
 bool GAMScheduler::Initialise(StructuredDataI & data) {
     bool ret = GAMSchedulerI::Initialise(data);
     if (ret) {
-        if (Size() > 0u) {
-            ret = (Size() == 1u);
+        uint32 networkTimeIn = 0u;
+        (void) data.Read("NetworkTime", networkTimeIn);
+        networkTime = (networkTimeIn == 1u);
+    }
+    if (ret) {
+        //The OverrunMessage (see GAMSchedulerI) is not an ErrorMessage
+        uint32 numberOfErrorMessages = 0u;
+        for (uint32 n = 0u; n < Size(); n++) {
+            Reference child = Get(n);
+            if (!IsOverrunMessage(child)) {
+                errorMessage = child;
+                numberOfErrorMessages++;
+            }
+        }
+        if (numberOfErrorMessages > 0u) {
+            ret = (numberOfErrorMessages == 1u);
             if (ret) {
-                errorMessage = Get(0u);
                 ret = errorMessage.IsValid();
                 if (!ret) {
                     REPORT_ERROR(ErrorManagement::ParametersError, "The ErrorMessage is not valid");
@@ -123,6 +145,8 @@ void GAMScheduler::Purge(ReferenceContainer &purgeList) {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not StopCurrentStateExecution multiThreadService[1]");
         }
     }
+    StopParallelExecutors(0u, false);
+    StopParallelExecutors(1u, false);
     ReferenceContainer::Purge(purgeList);
 }
 
@@ -160,12 +184,17 @@ ErrorManagement::ErrorType GAMScheduler::StopCurrentStateExecution() {
         if (multiThreadService[currentIndex] != NULL) {
             err = multiThreadService[currentIndex]->Stop();
         }
+        StopParallelExecutors(currentIndex, false);
     }
     return err;
 }
 
 void GAMScheduler::CustomPrepareNextState() {
     ErrorManagement::ErrorType err;
+    if (errorMessage.IsValid()) {
+        //The errorMessage is sent from the real-time threads
+        errorMessageDestination = ObjectRegistryDatabase::Instance()->Find(errorMessage->GetDestination());
+    }
     if (eventSem.Reset()) {
         realTimeApplicationT = realTimeApp;
         err = !realTimeApplicationT.IsValid();
@@ -181,6 +210,7 @@ void GAMScheduler::CustomPrepareNextState() {
             if (err.ErrorsCleared()) {
                 multiThreadService[nextBuffer] = new (NULL) MultiThreadService(binder);
                 multiThreadService[nextBuffer]->SetNumberOfPoolThreads(numberOfThreads);
+                StopParallelExecutors(nextBuffer, true);
                 if (rtThreadInfo[nextBuffer] != NULL) {
                     delete rtThreadInfo[nextBuffer];
                 }
@@ -191,15 +221,40 @@ void GAMScheduler::CustomPrepareNextState() {
             }
             if (err.ErrorsCleared()) {
                 rtThreadInfo[nextBuffer] = new RTThreadParam[numberOfThreads];
+                numberOfRTThreads[nextBuffer] = numberOfThreads;
                 for (uint32 i = 0u; i < numberOfThreads; i++) {
                     rtThreadInfo[nextBuffer][i].executables = nextState->threads[i].executables;
                     rtThreadInfo[nextBuffer][i].numberOfExecutables = nextState->threads[i].numberOfExecutables;
                     rtThreadInfo[nextBuffer][i].cycleTime = nextState->threads[i].cycleTime;
+                    rtThreadInfo[nextBuffer][i].cycleTimeHistogram = nextState->threads[i].cycleTimeHistogram;
                     rtThreadInfo[nextBuffer][i].lastCycleTimeStamp = 0u;
+                    rtThreadInfo[nextBuffer][i].lateness = nextState->threads[i].lateness;
+                    rtThreadInfo[nextBuffer][i].period = static_cast<uint64>(nextState->threads[i].period) * 1000LLU;
+                    rtThreadInfo[nextBuffer][i].phase = static_cast<uint64>(nextState->threads[i].phase) * 1000LLU;
+                    rtThreadInfo[nextBuffer][i].busyWaitTail = nextState->threads[i].busyWaitTail;
+                    rtThreadInfo[nextBuffer][i].nextRelease = 0u;
+                    rtThreadInfo[nextBuffer][i].networkTimeRelease = false;
+                    rtThreadInfo[nextBuffer][i].parallelExecutor = NULL_PTR(ParallelCycleExecutor *);
+                    rtThreadInfo[nextBuffer][i].flatCycle = nextState->threads[i].flat;
+                    rtThreadInfo[nextBuffer][i].multiRate = nextState->threads[i].multiRate;
+                    rtThreadInfo[nextBuffer][i].prefetch = nextState->threads[i].prefetch;
+                    rtThreadInfo[nextBuffer][i].budgetMonitor = nextState->threads[i].budgetMonitor;
+                    rtThreadInfo[nextBuffer][i].traceNameId = nextState->threads[i].traceNameId;
+                    rtThreadInfo[nextBuffer][i].progress = nextState->threads[i].progress;
+                    if ((err.ErrorsCleared()) && (nextState->threads[i].parallel != NULL_PTR(ParallelSchedule *))) {
+                        rtThreadInfo[nextBuffer][i].parallelExecutor = new ParallelCycleExecutor(*this, *nextState->threads[i].parallel,
+                                                                                                  nextState->threads[i].name);
+                        err = rtThreadInfo[nextBuffer][i].parallelExecutor->Start();
+                        rtThreadInfo[nextBuffer][i].progress = NULL_PTR(ExecutionProgress *);
+                    }
                     multiThreadService[nextBuffer]->SetPriorityClassThreadPool(Threads::RealTimePriorityClass, i);
                     multiThreadService[nextBuffer]->SetCPUMaskThreadPool(nextState->threads[i].cpu, i);
                     multiThreadService[nextBuffer]->SetStackSizeThreadPool(nextState->threads[i].stackSize, i);
                     multiThreadService[nextBuffer]->SetThreadNameThreadPool(nextState->threads[i].name, i);
+                    multiThreadService[nextBuffer]->SetPrefaultStackSizeThreadPool(nextState->threads[i].prefaultStackSize, i);
+                    multiThreadService[nextBuffer]->SetDeadlineThreadPool(static_cast<uint64>(nextState->threads[i].deadlineRuntime) * 1000LLU,
+                                                                          static_cast<uint64>(nextState->threads[i].deadlineDeadline) * 1000LLU,
+                                                                          static_cast<uint64>(nextState->threads[i].deadlinePeriod) * 1000LLU, i);
                 }
                 err = multiThreadService[nextBuffer]->Start();
             }
@@ -228,14 +283,39 @@ ErrorManagement::ErrorType GAMScheduler::Execute(ExecutionInfo & information) {
     }
     else if (information.GetStage() == MARTe::ExecutionInfo::MainStage) {
         if (rtThreadInfo[idx] != NULL_PTR(RTThreadParam *)) {
-            bool ok = ExecuteSingleCycle(rtThreadInfo[idx][threadNumber].executables, rtThreadInfo[idx][threadNumber].numberOfExecutables);
+            if (rtThreadInfo[idx][threadNumber].period > 0u) {
+                WaitForRelease(rtThreadInfo[idx][threadNumber]);
+            }
+            bool ok;
+            BeginCycleProgress(rtThreadInfo[idx][threadNumber].progress);
+            uint64 cycleStartTicks = HighResolutionTimer::Counter();
+            MARTe2_TRACE_EVENT(Trace::EVENT_CYCLE_BEGIN, rtThreadInfo[idx][threadNumber].traceNameId, 0u)
+            if (rtThreadInfo[idx][threadNumber].parallelExecutor != NULL_PTR(ParallelCycleExecutor *)) {
+                ok = rtThreadInfo[idx][threadNumber].parallelExecutor->ExecuteCycle();
+            }
+            else if (rtThreadInfo[idx][threadNumber].flatCycle != NULL_PTR(FlatCycle *)) {
+                ok = ExecuteFlatCycle(*rtThreadInfo[idx][threadNumber].flatCycle);
+            }
+            else if (rtThreadInfo[idx][threadNumber].multiRate != NULL_PTR(MultiRateSchedule *)) {
+                ok = ExecuteMultiRateCycle(rtThreadInfo[idx][threadNumber].executables, *rtThreadInfo[idx][threadNumber].multiRate, cycleStartTicks,
+                                           rtThreadInfo[idx][threadNumber].prefetch);
+            }
+            else {
+                ok = ExecuteSingleCycle(rtThreadInfo[idx][threadNumber].executables, rtThreadInfo[idx][threadNumber].numberOfExecutables,
+                                        cycleStartTicks, rtThreadInfo[idx][threadNumber].prefetch);
+            }
+            MARTe2_TRACE_EVENT(Trace::EVENT_CYCLE_END, rtThreadInfo[idx][threadNumber].traceNameId, 0u)
+            EndCycleProgress();
+            if (rtThreadInfo[idx][threadNumber].budgetMonitor != NULL_PTR(CycleBudgetMonitor *)) {
+                (void) CheckCycleBudget(*rtThreadInfo[idx][threadNumber].budgetMonitor, cycleStartTicks);
+            }
             if (!ok) {
                 REPORT_ERROR(ErrorManagement::FatalError, "Failed to ExecuteSingleCycle().");
                 //Do not set ret.fatalError = true because when ExecuteSingleCycle returns false it will trigger the MultiThreadService to restart the execution of ThreadLoop.
                 //If this was not handled then it would wait on eventSem.Wait(TTInfiniteWait) every time ExecuteSingleCycle returns false.
                 //ret.fatalError = true;
                 if (errorMessage.IsValid()) {
-                    if (MessageI::SendMessage(errorMessage, this) != ErrorManagement::NoError) {
+                    if (MessageI::SendMessage(errorMessage, this, errorMessageDestination) != ErrorManagement::NoError) {
                         REPORT_ERROR(ErrorManagement::FatalError, "Failed to SendMessage.");
                     }
                 }
@@ -243,8 +323,10 @@ ErrorManagement::ErrorType GAMScheduler::Execute(ExecutionInfo & information) {
             uint32 absTime = 0u;
             if (rtThreadInfo[idx][threadNumber].lastCycleTimeStamp != 0u) {
                 uint64 tmp = (HighResolutionTimer::Counter() - rtThreadInfo[idx][threadNumber].lastCycleTimeStamp);
-                float64 ticksToTime = (static_cast<float64>(tmp) * clockPeriod) * 1e6;
-                absTime = static_cast<uint32>(ticksToTime);  //us
+                absTime = static_cast<uint32>(HighResolutionTimer::TicksToMicroSeconds(tmp));  //us
+                if (rtThreadInfo[idx][threadNumber].cycleTimeHistogram != NULL_PTR(LatencyHistogram *)) {
+                    rtThreadInfo[idx][threadNumber].cycleTimeHistogram->Add(absTime);
+                }
             }
             uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
             if (!MemoryOperationsHelper::Copy(rtThreadInfo[idx][threadNumber].cycleTime, &absTime, sizeToCopy)) {
@@ -262,6 +344,74 @@ ErrorManagement::ErrorType GAMScheduler::Execute(ExecutionInfo & information) {
     return ret;
 }
 
+void GAMScheduler::WaitForRelease(RTThreadParam &threadParam) const {
+    bool useNetworkTime = false;
+    if (networkTime) {
+        useNetworkTime = ClockCorrelation::IsSynchronised();
+    }
+    if (useNetworkTime != threadParam.networkTimeRelease) {
+        //Realign when the time base changes
+        threadParam.networkTimeRelease = useNetworkTime;
+        threadParam.nextRelease = 0u;
+    }
+    uint64 now;
+    if (useNetworkTime) {
+        now = ClockCorrelation::CounterToUTC(HighResolutionTimer::Counter());
+    }
+    else {
+        now = Sleep::GetMonotonicNanoSeconds();
+    }
+    if (threadParam.nextRelease == 0u) {
+        //Threads with the same period are released in lock-step (shifted by their phase)
+        threadParam.nextRelease = (((now / threadParam.period) + 1u) * threadParam.period) + threadParam.phase;
+    }
+    if (useNetworkTime) {
+        if (threadParam.nextRelease > now) {
+            Sleep::UntilMonotonicNanoSeconds(Sleep::GetMonotonicNanoSeconds() + (threadParam.nextRelease - now), threadParam.busyWaitTail);
+        }
+        now = ClockCorrelation::CounterToUTC(HighResolutionTimer::Counter());
+    }
+    else {
+        Sleep::UntilMonotonicNanoSeconds(threadParam.nextRelease, threadParam.busyWaitTail);
+        now = Sleep::GetMonotonicNanoSeconds();
+    }
+    if (threadParam.lateness != NULL_PTR(uint32 *)) {
+        uint32 latenessUsec = 0u;
+        if (now > threadParam.nextRelease) {
+            latenessUsec = static_cast<uint32>((now - threadParam.nextRelease) / 1000u);
+        }
+        uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
+        if (!MemoryOperationsHelper::Copy(threadParam.lateness, &latenessUsec, sizeToCopy)) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not copy lateness information.");
+        }
+    }
+    threadParam.nextRelease += threadParam.period;
+    //Skip the releases missed due to an overrun, instead of executing them back-to-back
+    if (threadParam.nextRelease <= now) {
+        uint64 missed = ((now - threadParam.nextRelease) / threadParam.period) + 1u;
+        threadParam.nextRelease += (missed * threadParam.period);
+    }
+}
+
+void GAMScheduler::StopParallelExecutors(const uint32 buffer,
+                                         const bool destroy) {
+    if (rtThreadInfo[buffer] != NULL_PTR(RTThreadParam *)) {
+        for (uint32 i = 0u; i < numberOfRTThreads[buffer]; i++) {
+            ParallelCycleExecutor *parallelExecutor = rtThreadInfo[buffer][i].parallelExecutor;
+            if (parallelExecutor != NULL_PTR(ParallelCycleExecutor *)) {
+                ErrorManagement::ErrorType err = parallelExecutor->Stop();
+                if (!err.ErrorsCleared()) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the parallel workers of thread %d", i);
+                }
+                if (destroy) {
+                    delete parallelExecutor;
+                    rtThreadInfo[buffer][i].parallelExecutor = NULL_PTR(ParallelCycleExecutor *);
+                }
+            }
+        }
+    }
+}
+
 CLASS_REGISTER(GAMScheduler, "1.0")
 
 }
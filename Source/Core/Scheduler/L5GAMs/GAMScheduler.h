@@ -35,6 +35,7 @@
 #include "GAMSchedulerI.h"
 #include "Message.h"
 #include "MultiThreadService.h"
+#include "ParallelCycleExecutor.h"
 #include "RealTimeApplication.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -59,24 +60,103 @@ struct RTThreadParam {
      * The cycle time
      */
     uint32* cycleTime;
+    /**
+     * The cycle time histogram (may be NULL)
+     */
+    LatencyHistogram *cycleTimeHistogram;
     /**
      * HRT value last cycle time
      */
     uint64 lastCycleTimeStamp;
+    /**
+     * The release lateness (may be NULL)
+     */
+    uint32 *lateness;
+    /**
+     * The release period in nano-seconds (0 if the thread is not periodically released)
+     */
+    uint64 period;
+    /**
+     * The release offset in nano-seconds
+     */
+    uint64 phase;
+    /**
+     * The time in micro-seconds before each release that is spent busy waiting
+     */
+    uint32 busyWaitTail;
+    /**
+     * Monotonic time (see Sleep::GetMonotonicNanoSeconds), or network time if networkTimeRelease, of the next release (0 before the first release)
+     */
+    uint64 nextRelease;
+    /**
+     * True if the nextRelease is in network time (see ClockCorrelation)
+     */
+    bool networkTimeRelease;
+    /**
+     * Executes the cycles with the thread workers (NULL if the executables are executed sequentially)
+     */
+    ParallelCycleExecutor *parallelExecutor;
+    /**
+     * The flattened cycle (NULL if the executables are executed with ExecuteSingleCycle)
+     */
+    FlatCycle *flatCycle;
+    /**
+     * The execution rates of the GAMs (NULL if all the GAMs are executed in every cycle)
+     */
+    MultiRateSchedule *multiRate;
+    /**
+     * The memory to be prefetched before each executable (NULL if not prefetched)
+     */
+    const PrefetchTable *prefetch;
+    /**
+     * The cycle budget and the overrun statistics (NULL if the cycles are not monitored)
+     */
+    CycleBudgetMonitor *budgetMonitor;
+    /**
+     * The identifier of the name with which the cycles are traced (see Trace)
+     */
+    uint32 traceNameId;
+    /**
+     * The progress published by the thread (NULL for the threads with a parallel schedule, whose ExecutableIs are reordered)
+     */
+    ExecutionProgress *progress;
 };
 
 /**
  * @brief The GAM scheduler.
- * @details The syntax in the configuration stream has to be:
+ * @details Each RealTimeThread runs in its own thread. Threads with a Period (see RealTimeThread) are released at
+ * absolute monotonic deadlines (k * Period + Phase), so that the cycles do not drift, and the release lateness in
+ * micro-seconds is written in the State.Thread_Lateness signal of the TimingDataSource. Releases missed because of an
+ * overrun are skipped. Threads without a Period run as fast as their GAMs and DataSources allow.
+ *
+ * With NetworkTime = 1 the releases are instead aligned to the network time, i.e. to the UTC or PTP clock correlated with the
+ * HighResolutionTimer by the ClockCorrelation (see ClockCorrelationService), so that the nodes which share the network time
+ * release their threads with the same Period and Phase at the same instants. Each deadline is converted to the monotonic clock
+ * just before the thread sleeps, so that the drift corrections of the ClockCorrelation are followed, and the Lateness is
+ * measured on the network time, i.e. it is the alignment error of the release with respect to the other nodes (an early release
+ * is reported as 0). The threads are released on the monotonic clock while the ClockCorrelation is not synchronised.
+ *
+ * Threads with WorkerCPUs (see RealTimeThread) execute the independent GAMs of each cycle in parallel with one worker
+ * thread per CPU (see ParallelCycleExecutor).
+ *
+ * The threads without WorkerCPUs publish the ExecutableI that they are executing (see ExecutionProgress), so that the
+ * stalls can be detected and the GAMs profiled by an ExecutionWatchdog.
+ *
+ * The syntax in the configuration stream has to be:
  *
  * +Scheduler = {\n
  *    Class = Scheduler_name
  *     ...\n
  *    TimingDataSource = "Name of the TimingDataSource"
+ *    NetworkTime = 1 //Optional. If 1 the periodic threads are released on the network time. Default is 0.
  *    +ErrorMessage = { //Optional. Fired every time there is an execution error. Name is only an example.
  *        Class = Message
  *        ...
  *    }
+ *    +OverrunMessage = { //Optional. Fired when a thread exceeds its CycleBudget (see GAMSchedulerI).
+ *        Class = Message
+ *        ...
+ *    }
  * }\n
  */
 class GAMScheduler: public GAMSchedulerI {
@@ -124,7 +204,7 @@ public:
      * @param[in] information (see EmbeddedThread)
      * @return ErrorManagement::NoError if every ExecutableI did not return any error.
      */
-    ErrorManagement::ErrorType Execute(ExecutionInfo &information);
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &information);
 
     /**
      * @brief Stops the active MultiThreadService running services and calls ReferenceContainer::Purge
@@ -139,6 +219,23 @@ protected:
      */
     virtual void CustomPrepareNextState();
 
+    /**
+     * @brief Waits for the next absolute-deadline release of a periodic thread and records its lateness.
+     * @details The first release is aligned to the next multiple of the period (plus the phase) of the monotonic clock
+     * or, if networkTime, of the network time.
+     * @param[in,out] threadParam the parameters of the thread to be released.
+     * @pre
+     *   threadParam.period > 0
+     */
+    void WaitForRelease(RTThreadParam &threadParam) const;
+
+    /**
+     * @brief Stops the workers of the threads with a parallel schedule.
+     * @param[in] buffer the index of the rtThreadInfo to stop.
+     * @param[in] destroy if true the ParallelCycleExecutor instances are also deleted.
+     */
+    void StopParallelExecutors(const uint32 buffer, const bool destroy);
+
     /**
      * The array of identifiers of the thread in execution.
      */
@@ -149,6 +246,11 @@ protected:
      */
     RTThreadParam *rtThreadInfo[2];
 
+    /**
+     * The number of elements of each rtThreadInfo
+     */
+    uint32 numberOfRTThreads[2];
+
     /**
      * The eventSemaphore
      */
@@ -164,6 +266,16 @@ protected:
      */
     ReferenceT<Message> errorMessage;
 
+    /**
+     * The destination of the errorMessage, resolved before each state starts.
+     */
+    ReferenceT<MessageI> errorMessageDestination;
+
+    /**
+     * True if the periodic threads are released on the network time.
+     */
+    bool networkTime;
+
     /**
      * Specialised real-time application reference.
      */
@@ -0,0 +1,418 @@
+/**
+ * @file LatencyProbeDataSource.cpp
+ * @brief Source file for class LatencyProbeDataSource
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LatencyProbeDataSource (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "HeapManager.h"
+#include "HighResolutionTimer.h"
+#include "LatencyProbeDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+LatencyProbeDataSource::LatencyProbeDataSource() :
+        MemoryDataSourceI(),
+        synchroniser(),
+        wakeLatencyHistogram(),
+        jitterHistogram() {
+    triggered = false;
+    periodTicks = 0u;
+    spinThreshold = 0u;
+    timeout = 1000u;
+    nanoSecondsPerTick = HighResolutionTimer::Period() * 1e9;
+    triggerTicks = 0;
+    started = false;
+    stateStartTicks = 0u;
+    nextDeadline = 0u;
+    lastWake = 0u;
+    lastReference = 0u;
+    numberOfCycles = 0u;
+    numberOfOverruns = 0u;
+    trace = NULL_PTR(LatencyProbeTraceEntry *);
+    worstTrace = NULL_PTR(LatencyProbeTraceEntry *);
+    traceLength = 64u;
+    worstTraceSize = 0u;
+    worstCycle = 0u;
+    counterSignal = NULL_PTR(uint32 *);
+    timeSignal = NULL_PTR(uint32 *);
+    stampSignal = NULL_PTR(uint64 *);
+    wakeLatencySignal = NULL_PTR(uint32 *);
+    jitterSignal = NULL_PTR(int32 *);
+}
+
+LatencyProbeDataSource::~LatencyProbeDataSource() {
+    if (numberOfCycles > 0u) {
+        Report();
+    }
+    if (trace != NULL_PTR(LatencyProbeTraceEntry *)) {
+        void *mem = reinterpret_cast<void *>(trace);
+        (void) HeapManager::Free(mem);
+    }
+    if (worstTrace != NULL_PTR(LatencyProbeTraceEntry *)) {
+        void *mem = reinterpret_cast<void *>(worstTrace);
+        (void) HeapManager::Free(mem);
+    }
+}
+
+bool LatencyProbeDataSource::Initialise(StructuredDataI & data) {
+    bool ok = MemoryDataSourceI::Initialise(data);
+    if (ok) {
+        StreamString mode;
+        if (!data.Read("Mode", mode)) {
+            mode = "Timer";
+        }
+        triggered = (mode == "Triggered");
+        ok = ((triggered) || (mode == "Timer"));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Mode shall be Timer or Triggered");
+        }
+    }
+    if ((ok) && (!triggered)) {
+        uint32 period = 0u;
+        ok = data.Read("Period", period);
+        if (ok) {
+            ok = (period > 0u);
+        }
+        if (ok) {
+            periodTicks = static_cast<uint64>((static_cast<float64>(period) * 1e3) / nanoSecondsPerTick);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Period shall be specified and > 0 if Mode = Timer");
+        }
+    }
+    if (ok) {
+        if (!data.Read("SpinThreshold", spinThreshold)) {
+            spinThreshold = 0u;
+        }
+        synchroniser.SetSpinWindow(spinThreshold);
+        uint32 timeoutMs = 1000u;
+        if (data.Read("Timeout", timeoutMs)) {
+            timeout = timeoutMs;
+        }
+        if (data.Read("TraceLength", traceLength)) {
+            ok = (traceLength > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "TraceLength shall be > 0");
+            }
+        }
+    }
+    return ok;
+}
+
+bool LatencyProbeDataSource::SetConfiguredDatabase(StructuredDataI & data) {
+    bool ok = DataSourceI::SetConfiguredDatabase(data);
+    uint32 nOfFunctions = GetNumberOfFunctions();
+    if (ok) {
+        ok = (nOfFunctions <= 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Only one GAM can read from a LatencyProbeDataSource");
+        }
+    }
+    uint32 f;
+    for (f = 0u; (f < nOfFunctions) && (ok); f++) {
+        uint32 nOfOutputSignals = 0u;
+        ok = GetFunctionNumberOfSignals(OutputSignals, f, nOfOutputSignals);
+        if (ok) {
+            ok = (nOfOutputSignals == 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "A LatencyProbeDataSource has no output signals");
+            }
+        }
+    }
+    uint32 s;
+    for (s = 0u; (s < numberOfSignals) && (ok); s++) {
+        StreamString signalName;
+        ok = GetSignalName(s, signalName);
+        TypeDescriptor expectedType = InvalidType;
+        if (ok) {
+            if ((signalName == "Counter") || (signalName == "Time") || (signalName == "WakeLatency")) {
+                expectedType = UnsignedInteger32Bit;
+            }
+            else if (signalName == "Stamp") {
+                expectedType = UnsignedInteger64Bit;
+            }
+            else if (signalName == "Jitter") {
+                expectedType = SignedInteger32Bit;
+            }
+            else {
+                ok = false;
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Unknown signal %s (shall be Counter, Time, Stamp, WakeLatency or Jitter)",
+                             signalName.Buffer());
+            }
+        }
+        uint32 nOfElements = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(s, nOfElements);
+        }
+        if (ok) {
+            ok = ((GetSignalType(s) == expectedType) && (nOfElements == 1u));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The signal %s shall be a %s scalar", signalName.Buffer(),
+                             TypeDescriptor::GetTypeNameFromTypeDescriptor(expectedType));
+            }
+        }
+    }
+    return ok;
+}
+
+bool LatencyProbeDataSource::GetSignalAddress(const char8 * const signalName,
+                                              const TypeDescriptor &type,
+                                              void *&address) {
+    bool ok = true;
+    uint32 signalIdx = 0u;
+    address = NULL_PTR(void *);
+    if (GetSignalIndex(signalIdx, signalName)) {
+        ok = (GetSignalType(signalIdx) == type);
+        if (ok) {
+            ok = GetSignalMemoryBuffer(signalIdx, 0u, address);
+        }
+    }
+    return ok;
+}
+
+bool LatencyProbeDataSource::AllocateMemory() {
+    bool ok = MemoryDataSourceI::AllocateMemory();
+    if (ok) {
+        uint32 traceSize = static_cast<uint32>(sizeof(LatencyProbeTraceEntry)) * traceLength;
+        trace = reinterpret_cast<LatencyProbeTraceEntry *>(HeapManager::Malloc(traceSize));
+        worstTrace = reinterpret_cast<LatencyProbeTraceEntry *>(HeapManager::Malloc(traceSize));
+        ok = ((trace != NULL_PTR(LatencyProbeTraceEntry *)) && (worstTrace != NULL_PTR(LatencyProbeTraceEntry *)));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate the trace");
+        }
+    }
+    void *address = NULL_PTR(void *);
+    if (ok) {
+        ok = GetSignalAddress("Counter", UnsignedInteger32Bit, address);
+        counterSignal = static_cast<uint32 *>(address);
+    }
+    if (ok) {
+        ok = GetSignalAddress("Time", UnsignedInteger32Bit, address);
+        timeSignal = static_cast<uint32 *>(address);
+    }
+    if (ok) {
+        ok = GetSignalAddress("Stamp", UnsignedInteger64Bit, address);
+        stampSignal = static_cast<uint64 *>(address);
+    }
+    if (ok) {
+        ok = GetSignalAddress("WakeLatency", UnsignedInteger32Bit, address);
+        wakeLatencySignal = static_cast<uint32 *>(address);
+    }
+    if (ok) {
+        ok = GetSignalAddress("Jitter", SignedInteger32Bit, address);
+        jitterSignal = static_cast<int32 *>(address);
+    }
+    return ok;
+}
+
+const char8 *LatencyProbeDataSource::GetBrokerName(StructuredDataI &data,
+                                                   const SignalDirection direction) {
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == InputSignals) {
+        brokerName = "MemoryMapSynchronisedInputBroker";
+    }
+    return brokerName;
+}
+
+bool LatencyProbeDataSource::PrepareNextState(const char8 * const currentStateName,
+                                              const char8 * const nextStateName) {
+    started = false;
+    return true;
+}
+
+bool LatencyProbeDataSource::Synchronise() {
+    uint64 wake = 0u;
+    uint64 reference = 0u;
+    bool measured = true;
+    if (triggered) {
+        measured = synchroniser.Wait(timeout);
+        wake = HighResolutionTimer::Counter();
+        synchroniser.Reset();
+        reference = static_cast<uint64>(Atomic::LoadAcquire(&triggerTicks));
+        if (!measured) {
+            numberOfOverruns++;
+        }
+    }
+    else {
+        uint64 now = HighResolutionTimer::Counter();
+        if (!started) {
+            nextDeadline = now + periodTicks;
+        }
+        synchroniser.WaitUntil(nextDeadline);
+        wake = HighResolutionTimer::Counter();
+        reference = nextDeadline;
+        //Absolute deadlines: the missed ones are skipped
+        nextDeadline += periodTicks;
+        while (nextDeadline <= wake) {
+            nextDeadline += periodTicks;
+            numberOfOverruns++;
+        }
+    }
+    if (measured) {
+        if (!started) {
+            started = true;
+            stateStartTicks = wake;
+            lastWake = wake;
+            lastReference = reference;
+        }
+        uint32 wakeLatency = 0u;
+        if (wake > reference) {
+            wakeLatency = static_cast<uint32>(static_cast<float64>(wake - reference) * nanoSecondsPerTick);
+        }
+        float64 wakeInterval = static_cast<float64>(wake - lastWake);
+        float64 referenceInterval = static_cast<float64>(static_cast<int64>(reference - lastReference));
+        int32 jitter = static_cast<int32>((wakeInterval - referenceInterval) * nanoSecondsPerTick);
+        lastWake = wake;
+        lastReference = reference;
+
+        wakeLatencyHistogram.Add(wakeLatency);
+        jitterHistogram.Add(static_cast<uint32>((jitter < 0) ? -jitter : jitter));
+        LatencyProbeTraceEntry &entry = trace[numberOfCycles % traceLength];
+        entry.cycle = numberOfCycles;
+        entry.wakeLatency = wakeLatency;
+        entry.jitter = jitter;
+        if ((numberOfCycles == 0u) || (wakeLatency > worstTrace[worstTraceSize - 1u].wakeLatency)) {
+            //Copy the cycles up to this one, oldest first (only when the worst case changes)
+            worstTraceSize = (numberOfCycles < traceLength) ? (static_cast<uint32>(numberOfCycles) + 1u) : (traceLength);
+            uint32 i;
+            for (i = 0u; i < worstTraceSize; i++) {
+                worstTrace[i] = trace[((numberOfCycles + 1u) - worstTraceSize + i) % traceLength];
+            }
+            worstCycle = numberOfCycles;
+        }
+
+        if (counterSignal != NULL_PTR(uint32 *)) {
+            *counterSignal = static_cast<uint32>(numberOfCycles);
+        }
+        if (timeSignal != NULL_PTR(uint32 *)) {
+            *timeSignal = static_cast<uint32>((static_cast<float64>(wake - stateStartTicks) * nanoSecondsPerTick) / 1e3);
+        }
+        if (stampSignal != NULL_PTR(uint64 *)) {
+            *stampSignal = wake;
+        }
+        if (wakeLatencySignal != NULL_PTR(uint32 *)) {
+            *wakeLatencySignal = wakeLatency;
+        }
+        if (jitterSignal != NULL_PTR(int32 *)) {
+            *jitterSignal = jitter;
+        }
+        numberOfCycles++;
+    }
+    return true;
+}
+
+bool LatencyProbeDataSource::ExportData(StructuredDataI & data) {
+    bool ret = DataSourceI::ExportData(data);
+    if (ret) {
+        ret = data.Write("Overruns", numberOfOverruns);
+    }
+    HybridEventSemStatistics statistics;
+    synchroniser.GetStatistics(statistics);
+    if (ret) {
+        ret = data.Write("SpinWakes", statistics.numberOfSpinWakes);
+    }
+    if (ret) {
+        ret = data.Write("SleepWakes", statistics.numberOfSleepWakes);
+    }
+    if (ret) {
+        ret = data.Write("WorstCycle", worstCycle);
+    }
+    if (ret) {
+        ret = data.CreateRelative("WakeLatency");
+    }
+    if (ret) {
+        ret = wakeLatencyHistogram.Export(data);
+    }
+    if (ret) {
+        ret = data.MoveToAncestor(1u);
+    }
+    if (ret) {
+        ret = data.CreateRelative("Jitter");
+    }
+    if (ret) {
+        ret = jitterHistogram.Export(data);
+    }
+    if (ret) {
+        ret = data.MoveToAncestor(1u);
+    }
+    return ret;
+}
+
+void LatencyProbeDataSource::Trigger(const uint64 ticks) {
+    Atomic::StoreRelease(&triggerTicks, static_cast<int64>(ticks));
+    synchroniser.Post();
+}
+
+const LatencyHistogram &LatencyProbeDataSource::GetWakeLatencyHistogram() const {
+    return wakeLatencyHistogram;
+}
+
+const LatencyHistogram &LatencyProbeDataSource::GetJitterHistogram() const {
+    return jitterHistogram;
+}
+
+uint64 LatencyProbeDataSource::GetNumberOfOverruns() const {
+    return numberOfOverruns;
+}
+
+void LatencyProbeDataSource::GetSynchronisationStatistics(HybridEventSemStatistics &statistics) const {
+    synchroniser.GetStatistics(statistics);
+}
+
+void LatencyProbeDataSource::Report() const {
+    StreamString prefix;
+    (void) prefix.Printf("%s.WakeLatency", GetName());
+    wakeLatencyHistogram.Report(prefix.Buffer(), "ns");
+    (void) prefix.SetSize(0ull);
+    (void) prefix.Printf("%s.Jitter", GetName());
+    jitterHistogram.Report(prefix.Buffer(), "ns");
+    REPORT_ERROR(ErrorManagement::Information, "%s: %u cycles, %u overruns. Worst-case trace (up to cycle %u):", GetName(), numberOfCycles,
+                 numberOfOverruns, worstCycle);
+    HybridEventSemStatistics statistics;
+    synchroniser.GetStatistics(statistics);
+    REPORT_ERROR(ErrorManagement::Information, "%s: %u spin wake-ups, %u sleep wake-ups, %u ns spent busy waiting", GetName(),
+                 statistics.numberOfSpinWakes, statistics.numberOfSleepWakes,
+                 static_cast<uint64>(static_cast<float64>(statistics.spinTicks) * nanoSecondsPerTick));
+    uint32 i;
+    for (i = 0u; i < worstTraceSize; i++) {
+        REPORT_ERROR(ErrorManagement::Information, "%s: cycle %u WakeLatency = %u ns Jitter = %d ns", GetName(), worstTrace[i].cycle,
+                     worstTrace[i].wakeLatency, worstTrace[i].jitter);
+    }
+}
+
+CLASS_REGISTER(LatencyProbeDataSource, "1.0")
+
+}
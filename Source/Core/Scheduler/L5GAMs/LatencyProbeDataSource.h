@@ -0,0 +1,353 @@
+/**
+ * @file LatencyProbeDataSource.h
+ * @brief Header file for class LatencyProbeDataSource
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class LatencyProbeDataSource
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LATENCYPROBEDATASOURCE_H_
+#define LATENCYPROBEDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "HybridEventSem.h"
+#include "LatencyHistogram.h"
+#include "MemoryDataSourceI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief A cycle of the worst-case trace of a LatencyProbeDataSource.
+ */
+struct LatencyProbeTraceEntry {
+    /**
+     * The cycle number.
+     */
+    uint64 cycle;
+
+    /**
+     * The wake-up latency in nano-seconds.
+     */
+    uint32 wakeLatency;
+
+    /**
+     * The cycle jitter in nano-seconds.
+     */
+    int32 jitter;
+};
+
+/**
+ * @brief Synchronising DataSourceI which measures the wake-up latency and the cycle jitter of the RealTimeThread that it drives
+ * (i.e. a cyclictest executed by the real scheduler, brokers and GAMs).
+ * @details In Mode = Timer the thread is woken up at absolute deadlines, every Period micro-seconds (missed deadlines are skipped and
+ * counted as overruns). In Mode = Triggered the thread is woken up by a LatencyProbeGAM (see LatencyProbeGAM Trigger) executed by
+ * another thread, so that the cross-thread wake-up latency through the schedulers is measured.
+ *
+ * In each cycle the wake-up latency is the time from the deadline (or from the trigger) to the wake-up and the jitter is the difference
+ * between the time from the previous wake-up and the time from the previous deadline (or trigger). Both are added to a LatencyHistogram
+ * (the absolute value of the jitter) and the last TraceLength cycles are kept, so that the cycles up to the worst wake-up latency can be
+ * analysed. The thread waits on a HybridEventSem, which busy waits the last SpinThreshold nano-seconds before each deadline (or the first
+ * SpinThreshold nano-seconds of each wait for a trigger) and counts the wake-ups that did not need the operating system.
+ * The histograms, the spin and sleep wake-ups and the worst-case trace are reported (as ErrorManagement::Information) when the DataSource is destroyed
+ * and the statistics are exported in ExportData.
+ *
+ * Only one GAM may read the signals, which are all optional and identified by their name:
+ *  - Counter (uint32): the cycle number;
+ *  - Time (uint32): the wake-up time in micro-seconds from the beginning of the state;
+ *  - Stamp (uint64): the HighResolutionTimer::Counter at the wake-up (to be given to a LatencyProbeGAM, possibly in another thread);
+ *  - WakeLatency (uint32): the wake-up latency in nano-seconds;
+ *  - Jitter (int32): the cycle jitter in nano-seconds.
+ *
+ * A complete template, measuring a timer thread and a triggered thread, is given in
+ * Docs/User/source/_static/examples/Configurations/LatencyProbe-1.cfg.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Timer = {
+ *     Class = LatencyProbeDataSource
+ *     Mode = Timer //Optional. Timer or Triggered. Default = Timer.
+ *     Period = 1000 //Compulsory if Mode = Timer. The period in micro-seconds.
+ *     SpinThreshold = 0 //Optional. Nano-seconds to be busy waited before each deadline or while waiting for a trigger (see HybridEventSem). Default = 0 (operating system sleep only).
+ *     Timeout = 1000 //Optional. If Mode = Triggered, maximum time in milliseconds to wait for a trigger. Default = 1000.
+ *     TraceLength = 64 //Optional. Number of cycles in the worst-case trace. Default = 64.
+ *     Signals = {
+ *         Counter = { Type = uint32 }
+ *         Stamp = { Type = uint64 }
+ *         WakeLatency = { Type = uint32 }
+ *     }
+ * }
+ * </pre>
+ */
+class LatencyProbeDataSource: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    LatencyProbeDataSource();
+
+    /**
+     * @brief Destructor. Reports the histograms and the worst-case trace.
+     */
+    virtual ~LatencyProbeDataSource();
+
+    /**
+     * @brief Reads the parameters (see class description).
+     * @param[in] data see MemoryDataSourceI::Initialise.
+     * @return true if MemoryDataSourceI::Initialise returns true and the parameters are valid.
+     */
+    virtual bool Initialise(StructuredDataI & data);
+
+    /**
+     * @brief Checks the names and the types of the signals and that only one GAM reads (and no GAM writes) the signals.
+     * @param[in] data see DataSourceI::SetConfiguredDatabase.
+     * @return true if the conditions above are met.
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI & data);
+
+    /**
+     * @brief Allocates the signals memory and the worst-case trace.
+     * @return true if the memory can be allocated.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief Gets the broker name.
+     * @param[in] data see DataSourceI::GetBrokerName.
+     * @param[in] direction see DataSourceI::GetBrokerName.
+     * @return MemoryMapSynchronisedInputBroker for the input signals.
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction);
+
+    /**
+     * @brief Restarts the deadlines from the first cycle of the next state.
+     * @param[in] currentStateName see StatefulI::PrepareNextState.
+     * @param[in] nextStateName see StatefulI::PrepareNextState.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief Waits for the next deadline (or trigger), measures the wake-up and updates the signals.
+     * @return true (a Triggered wait that times out is not measured).
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief see DataSourceI::ExportData.
+     * @details Also exports the Overruns, the SpinWakes and SleepWakes (see HybridEventSemStatistics), the WakeLatency and Jitter statistics (see LatencyHistogram::Export) and the WorstCycle.
+     * @param[out] data see DataSourceI::ExportData.
+     * @return true if all the information could be exported.
+     */
+    virtual bool ExportData(StructuredDataI & data);
+
+    /**
+     * @brief Wakes up the thread waiting in Synchronise (Mode = Triggered).
+     * @param[in] ticks the HighResolutionTimer::Counter from which the wake-up latency is measured.
+     */
+    void Trigger(const uint64 ticks);
+
+    /**
+     * @brief Gets the histogram of the wake-up latencies.
+     * @return the histogram of the wake-up latencies (in nano-seconds).
+     */
+    const LatencyHistogram &GetWakeLatencyHistogram() const;
+
+    /**
+     * @brief Gets the histogram of the (absolute) cycle jitter.
+     * @return the histogram of the cycle jitter (in nano-seconds).
+     */
+    const LatencyHistogram &GetJitterHistogram() const;
+
+    /**
+     * @brief Gets the number of deadlines missed (Mode = Timer) or of triggers not received in time (Mode = Triggered).
+     * @return the number of overruns.
+     */
+    uint64 GetNumberOfOverruns() const;
+
+    /**
+     * @brief Gets the statistics of the waits for the deadlines (or the triggers).
+     * @param[out] statistics the spin and sleep wake-ups since the construction.
+     */
+    void GetSynchronisationStatistics(HybridEventSemStatistics &statistics) const;
+
+    /**
+     * @brief Reports (as ErrorManagement::Information) the histograms and the worst-case trace.
+     */
+    void Report() const;
+
+private:
+
+    /**
+     * @brief Gets the address of a signal (identified by its name) and checks its type.
+     * @return true if the signal does not exist or if its type is \a type.
+     */
+    bool GetSignalAddress(const char8 * const signalName,
+                          const TypeDescriptor &type,
+                          void *&address);
+
+    /**
+     * True if Mode = Triggered.
+     */
+    bool triggered;
+
+    /**
+     * The period in HighResolutionTimer ticks (Mode = Timer).
+     */
+    uint64 periodTicks;
+
+    /**
+     * Nano-seconds busy waited before each deadline or while waiting for a trigger.
+     */
+    uint32 spinThreshold;
+
+    /**
+     * Maximum time to wait for a trigger.
+     */
+    TimeoutType timeout;
+
+    /**
+     * Nano-seconds per HighResolutionTimer tick.
+     */
+    float64 nanoSecondsPerTick;
+
+    /**
+     * Waits for the deadlines and is posted by Trigger.
+     */
+    HybridEventSem synchroniser;
+
+    /**
+     * The HighResolutionTimer::Counter given to the last Trigger.
+     */
+    volatile int64 triggerTicks;
+
+    /**
+     * True after the first cycle of a state.
+     */
+    bool started;
+
+    /**
+     * Counter at the beginning of the state.
+     */
+    uint64 stateStartTicks;
+
+    /**
+     * The next deadline (Mode = Timer).
+     */
+    uint64 nextDeadline;
+
+    /**
+     * Counter at the previous wake-up.
+     */
+    uint64 lastWake;
+
+    /**
+     * The previous deadline (or trigger).
+     */
+    uint64 lastReference;
+
+    /**
+     * Number of cycles measured.
+     */
+    uint64 numberOfCycles;
+
+    /**
+     * Number of overruns.
+     */
+    uint64 numberOfOverruns;
+
+    /**
+     * Wake-up latencies histogram.
+     */
+    LatencyHistogram wakeLatencyHistogram;
+
+    /**
+     * Absolute cycle jitter histogram.
+     */
+    LatencyHistogram jitterHistogram;
+
+    /**
+     * The last traceLength cycles (circular buffer).
+     */
+    LatencyProbeTraceEntry *trace;
+
+    /**
+     * The traceLength cycles up to the worst wake-up latency (oldest first).
+     */
+    LatencyProbeTraceEntry *worstTrace;
+
+    /**
+     * Number of elements of trace and worstTrace.
+     */
+    uint32 traceLength;
+
+    /**
+     * Number of valid elements in worstTrace.
+     */
+    uint32 worstTraceSize;
+
+    /**
+     * The cycle of the worst wake-up latency.
+     */
+    uint64 worstCycle;
+
+    /**
+     * Address of the Counter signal (or NULL).
+     */
+    uint32 *counterSignal;
+
+    /**
+     * Address of the Time signal (or NULL).
+     */
+    uint32 *timeSignal;
+
+    /**
+     * Address of the Stamp signal (or NULL).
+     */
+    uint64 *stampSignal;
+
+    /**
+     * Address of the WakeLatency signal (or NULL).
+     */
+    uint32 *wakeLatencySignal;
+
+    /**
+     * Address of the Jitter signal (or NULL).
+     */
+    int32 *jitterSignal;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LATENCYPROBEDATASOURCE_H_ */
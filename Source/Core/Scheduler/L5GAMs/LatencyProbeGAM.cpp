@@ -0,0 +1,220 @@
+/**
+ * @file LatencyProbeGAM.cpp
+ * @brief Source file for class LatencyProbeGAM
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class LatencyProbeGAM (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "LatencyProbeGAM.h"
+#include "ObjectRegistryDatabase.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+LatencyProbeGAM::LatencyProbeGAM() :
+        GAM() {
+    histograms = NULL_PTR(LatencyHistogram *);
+    histogramNames = NULL_PTR(StreamString *);
+    lastStamps = NULL_PTR(uint64 *);
+    numberOfStamps = 0u;
+    stampOutputs = NULL_PTR(uint64 **);
+    numberOfStampOutputs = 0u;
+    latencyOutputs = NULL_PTR(uint32 **);
+    numberOfLatencyOutputs = 0u;
+    nanoSecondsPerTick = HighResolutionTimer::Period() * 1e9;
+}
+
+LatencyProbeGAM::~LatencyProbeGAM() {
+    if (histograms != NULL_PTR(LatencyHistogram *)) {
+        uint32 i;
+        for (i = 0u; i < numberOfStamps; i++) {
+            if (histograms[i].GetCount() > 0u) {
+                histograms[i].Report(histogramNames[i].Buffer(), "ns");
+            }
+        }
+        delete[] histograms;
+    }
+    if (histogramNames != NULL_PTR(StreamString *)) {
+        delete[] histogramNames;
+    }
+    if (lastStamps != NULL_PTR(uint64 *)) {
+        delete[] lastStamps;
+    }
+    if (stampOutputs != NULL_PTR(uint64 **)) {
+        delete[] stampOutputs;
+    }
+    if (latencyOutputs != NULL_PTR(uint32 **)) {
+        delete[] latencyOutputs;
+    }
+}
+
+bool LatencyProbeGAM::Initialise(StructuredDataI & data) {
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        if (!data.Read("Trigger", triggerPath)) {
+            triggerPath = "";
+        }
+    }
+    return ok;
+}
+
+bool LatencyProbeGAM::Setup() {
+    numberOfStamps = GetNumberOfInputSignals();
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; (i < numberOfStamps) && (ok); i++) {
+        ok = (GetSignalType(InputSignals, i) == UnsignedInteger64Bit);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The input signals shall be uint64");
+        }
+    }
+    uint32 numberOfOutputs = GetNumberOfOutputSignals();
+    for (i = 0u; (i < numberOfOutputs) && (ok); i++) {
+        TypeDescriptor type = GetSignalType(OutputSignals, i);
+        if (type == UnsignedInteger64Bit) {
+            numberOfStampOutputs++;
+        }
+        else if (type == UnsignedInteger32Bit) {
+            numberOfLatencyOutputs++;
+        }
+        else {
+            ok = false;
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The output signals shall be uint64 or uint32");
+        }
+    }
+    if (ok) {
+        ok = (numberOfLatencyOutputs <= numberOfStamps);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "There shall be at most one uint32 output signal per input signal");
+        }
+    }
+    if (ok) {
+        histograms = new LatencyHistogram[numberOfStamps];
+        //The signals database is purged before the destructor reports the histograms
+        histogramNames = new StreamString[numberOfStamps];
+        lastStamps = new uint64[numberOfStamps];
+        for (i = 0u; (i < numberOfStamps) && (ok); i++) {
+            lastStamps[i] = 0u;
+            StreamString signalName;
+            ok = GetSignalName(InputSignals, i, signalName);
+            if (ok) {
+                ok = histogramNames[i].Printf("%s.%s", GetName(), signalName.Buffer());
+            }
+        }
+        stampOutputs = new uint64*[numberOfStampOutputs];
+        latencyOutputs = new uint32*[numberOfLatencyOutputs];
+        uint32 nStampOutputs = 0u;
+        uint32 nLatencyOutputs = 0u;
+        for (i = 0u; (i < numberOfOutputs) && (ok); i++) {
+            if (GetSignalType(OutputSignals, i) == UnsignedInteger64Bit) {
+                stampOutputs[nStampOutputs] = static_cast<uint64 *>(GetOutputSignalMemory(i));
+                nStampOutputs++;
+            }
+            else {
+                latencyOutputs[nLatencyOutputs] = static_cast<uint32 *>(GetOutputSignalMemory(i));
+                nLatencyOutputs++;
+            }
+        }
+    }
+    if ((ok) && (triggerPath.Size() > 0u)) {
+        trigger = ObjectRegistryDatabase::Instance()->Find(triggerPath.Buffer());
+        ok = trigger.IsValid();
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Trigger %s is not a LatencyProbeDataSource", triggerPath.Buffer());
+        }
+    }
+    return ok;
+}
+
+bool LatencyProbeGAM::Execute() {
+    uint64 now = HighResolutionTimer::Counter();
+    uint32 i;
+    for (i = 0u; i < numberOfStamps; i++) {
+        uint64 stamp = *static_cast<uint64 *>(GetInputSignalMemory(i));
+        uint32 latency = 0u;
+        //A stamp is only measured once (e.g. not again if the producer did not run, or timed out, in this cycle)
+        if ((stamp > lastStamps[i]) && (stamp < now)) {
+            latency = static_cast<uint32>(static_cast<float64>(now - stamp) * nanoSecondsPerTick);
+            histograms[i].Add(latency);
+            lastStamps[i] = stamp;
+        }
+        if (i < numberOfLatencyOutputs) {
+            *latencyOutputs[i] = latency;
+        }
+    }
+    for (i = 0u; i < numberOfStampOutputs; i++) {
+        *stampOutputs[i] = now;
+    }
+    if (trigger.IsValid()) {
+        trigger->Trigger(HighResolutionTimer::Counter());
+    }
+    return true;
+}
+
+bool LatencyProbeGAM::ExportData(StructuredDataI & data) {
+    bool ok = GAM::ExportData(data);
+    if ((ok) && (histograms != NULL_PTR(LatencyHistogram *))) {
+        ok = data.CreateRelative("Latencies");
+        uint32 i;
+        for (i = 0u; (i < numberOfStamps) && (ok); i++) {
+            StreamString signalName;
+            ok = GetSignalName(InputSignals, i, signalName);
+            if (ok) {
+                ok = data.CreateRelative(signalName.Buffer());
+            }
+            if (ok) {
+                ok = histograms[i].Export(data);
+            }
+            if (ok) {
+                ok = data.MoveToAncestor(1u);
+            }
+        }
+        if (ok) {
+            ok = data.MoveToAncestor(1u);
+        }
+    }
+    return ok;
+}
+
+const LatencyHistogram *LatencyProbeGAM::GetHistogram(const uint32 signalIdx) const {
+    const LatencyHistogram *histogram = NULL_PTR(const LatencyHistogram *);
+    if ((histograms != NULL_PTR(LatencyHistogram *)) && (signalIdx < numberOfStamps)) {
+        histogram = &histograms[signalIdx];
+    }
+    return histogram;
+}
+
+CLASS_REGISTER(LatencyProbeGAM, "1.0")
+
+}
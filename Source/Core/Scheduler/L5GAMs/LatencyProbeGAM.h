@@ -0,0 +1,185 @@
+/**
+ * @file LatencyProbeGAM.h
+ * @brief Header file for class LatencyProbeGAM
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class LatencyProbeGAM
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LATENCYPROBEGAM_H_
+#define LATENCYPROBEGAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+#include "LatencyHistogram.h"
+#include "LatencyProbeDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Lightweight GAM which measures the latency of signals (e.g. across RealTimeThreads) and optionally triggers a LatencyProbeDataSource.
+ * @details Every input signal shall be a uint64 HighResolutionTimer::Counter stamp (e.g. the Stamp of a LatencyProbeDataSource or the output of
+ * another LatencyProbeGAM, possibly written by another thread through a ThreadChannelDataSource). In each Execute the latency of each
+ * input (the time from the stamp to the execution of this GAM) is added to a LatencyHistogram of the input (stamps equal to zero, or already
+ * measured in a previous cycle, are ignored).
+ *
+ * The uint64 output signals are written with the HighResolutionTimer::Counter of the execution of this GAM. The uint32 output signals are
+ * written with the latency, in nano-seconds, of the input signal with the same index (i.e. the first uint32 output with the latency of the
+ * first input, ...).
+ *
+ * If Trigger is set, the LatencyProbeDataSource (Mode = Triggered) with this full path is triggered at the end of Execute. As the outputs of
+ * this GAM are only copied after Execute, the signals consumed by the triggered thread shall be written by a GAM executed before this one.
+ *
+ * The histograms are reported (as ErrorManagement::Information) when the GAM is destroyed and exported in ExportData.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Probe = {
+ *     Class = LatencyProbeGAM
+ *     Trigger = App.Data.Wake //Optional. Full path of the LatencyProbeDataSource to trigger.
+ *     InputSignals = {
+ *         Stamp = { DataSource = Channel Type = uint64 }
+ *     }
+ *     OutputSignals = {
+ *         StampLatency = { DataSource = DDB Type = uint32 }
+ *     }
+ * }
+ * </pre>
+ */
+class LatencyProbeGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    LatencyProbeGAM();
+
+    /**
+     * @brief Destructor. Reports and frees the histograms.
+     */
+    virtual ~LatencyProbeGAM();
+
+    /**
+     * @brief Reads the optional Trigger parameter.
+     * @param[in] data see GAM::Initialise.
+     * @return true if GAM::Initialise returns true.
+     */
+    virtual bool Initialise(StructuredDataI & data);
+
+    /**
+     * @brief Checks the signals (see class description), allocates the histograms and finds the LatencyProbeDataSource to trigger.
+     * @return true if the input signals are uint64, the output signals uint64 or uint32 (at most one uint32 per input) and the Trigger exists.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Measures the latency of the inputs, writes the outputs and triggers the LatencyProbeDataSource.
+     * @return true.
+     */
+    virtual bool Execute();
+
+    /**
+     * @brief see GAM::ExportData.
+     * @details Also exports the statistics of the histogram of each input (see LatencyHistogram::Export).
+     * @param[out] data see GAM::ExportData.
+     * @return true if all the information could be exported.
+     */
+    virtual bool ExportData(StructuredDataI & data);
+
+    /**
+     * @brief Gets the latency histogram of an input signal.
+     * @param[in] signalIdx the index of the input signal.
+     * @return the histogram (in nano-seconds) or NULL if \a signalIdx is not valid.
+     */
+    const LatencyHistogram *GetHistogram(const uint32 signalIdx) const;
+
+private:
+
+    /**
+     * Full path of the LatencyProbeDataSource to trigger.
+     */
+    StreamString triggerPath;
+
+    /**
+     * The LatencyProbeDataSource to trigger.
+     */
+    ReferenceT<LatencyProbeDataSource> trigger;
+
+    /**
+     * One histogram per input signal.
+     */
+    LatencyHistogram *histograms;
+
+    /**
+     * The GAMName.SignalName of each histogram.
+     */
+    StreamString *histogramNames;
+
+    /**
+     * The last stamp measured for each input signal.
+     */
+    uint64 *lastStamps;
+
+    /**
+     * Number of input signals.
+     */
+    uint32 numberOfStamps;
+
+    /**
+     * The uint64 output signals.
+     */
+    uint64 **stampOutputs;
+
+    /**
+     * Number of uint64 output signals.
+     */
+    uint32 numberOfStampOutputs;
+
+    /**
+     * The uint32 output signals.
+     */
+    uint32 **latencyOutputs;
+
+    /**
+     * Number of uint32 output signals.
+     */
+    uint32 numberOfLatencyOutputs;
+
+    /**
+     * Nano-seconds per HighResolutionTimer tick.
+     */
+    float64 nanoSecondsPerTick;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LATENCYPROBEGAM_H_ */
@@ -29,7 +29,9 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
 #include "MemoryMapAsyncOutputBroker.h"
+#include "Trace.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -44,9 +46,15 @@ MemoryMapAsyncOutputBroker::MemoryMapAsyncOutputBroker() :
         service(binder),
         binder(*this, &MemoryMapAsyncOutputBroker::BufferLoop) {
     bufferMemoryMap = NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry*);
+    batchSegments = NULL_PTR(DataSourceBufferSegment*);
     numberOfBuffers = 0u;
     writeIdx = 0u;
     readSynchIdx = 0u;
+    writeSequence = 0;
+    readSequence = 0;
+    consumerSleeping = 0;
+    flushRequests = 0;
+    flushedRequests = 0;
     cpuMask = ProcessorType(0xffu); // WARNING USING UINT32 TO INITIALIZE `ProcessorType`
     stackSize = THREADS_DATABASE_GRANULARITY;
     if (!sem.Create()) {
@@ -55,10 +63,7 @@ MemoryMapAsyncOutputBroker::MemoryMapAsyncOutputBroker() :
     if (!sem.Reset()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Could not Reset the EventSem.");
     }
-    fastSem.Create();
-    posted = false;
-    flushed = true;
-    destroying = false;
+    destroying = 0;
     ignoreBufferOverrun = false;
 }
 
@@ -79,17 +84,17 @@ MemoryMapAsyncOutputBroker::~MemoryMapAsyncOutputBroker() {
         delete[] bufferMemoryMap;
         bufferMemoryMap = NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry*);
     }
+    if (batchSegments != NULL_PTR(DataSourceBufferSegment*)) {
+        delete[] batchSegments;
+        batchSegments = NULL_PTR(DataSourceBufferSegment*);
+    }
 }
 
 void MemoryMapAsyncOutputBroker::UnlinkDataSource() {
     if (!sem.IsClosed()) {
-        if (fastSem.FastLock() == ErrorManagement::NoError) {
-            destroying = true;
-            fastSem.FastUnLock();
-            if (!sem.Post()) {
-                REPORT_ERROR(ErrorManagement::FatalError, "Could not Post the EventSem.");
-            }
-            posted = true;
+        Atomic::Store(&destroying, 1, Atomic::MemoryOrderSequential);
+        if (!sem.Post()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not Post the EventSem.");
         }
         if (!sem.Close()) {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not Close the EventSem.");
@@ -170,7 +175,7 @@ bool MemoryMapAsyncOutputBroker::InitWithBufferParameters(const SignalDirection
         uint32 i;
         for (i = 0u; i < numberOfBuffers; i++) {
             bufferMemoryMap[i].index = i;
-            bufferMemoryMap[i].toConsume = false;
+            bufferMemoryMap[i].timestamp = 0u;
             uint32 c;
             bufferMemoryMap[i].mem = new void*[numberOfCopies];
             for (c = 0u; (c < numberOfCopies) && (ok); c++) {
@@ -179,12 +184,17 @@ bool MemoryMapAsyncOutputBroker::InitWithBufferParameters(const SignalDirection
             }
         }
     }
+    if (ok) {
+        if (numberOfCopies > 0u) {
+            batchSegments = new DataSourceBufferSegment[numberOfBuffers * numberOfCopies];
+        }
+    }
     if (ok) {
         service.SetStackSize(stackSize);
         service.SetCPUMask(cpuMask);
     }
     if (ok) {
-        readSynchIdx = numberOfBuffers - 1u;
+        readSynchIdx = 0u;
         StreamString serviceName;
         if (serviceName.Printf("%s:MemoryMapAsyncOutputBroker", dataSourceIn.GetName())) {
             service.SetName(serviceName.Buffer());
@@ -210,35 +220,38 @@ bool MemoryMapAsyncOutputBroker::Execute() {
     bool ret = true;
 
     if (bufferMemoryMap != NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry*)) {
+        //Only this thread writes the writeSequence
+        const uint32 written = static_cast<uint32>(writeSequence);
         if (!ignoreBufferOverrun) {
-            if (bufferMemoryMap[writeIdx].toConsume) {
+            //The page at writeIdx is still owned by the BufferLoop
+            const uint32 consumed = static_cast<uint32>(Atomic::LoadAcquire(&readSequence));
+            if ((written - consumed) >= numberOfBuffers) {
                 //Buffer overrun...
                 const uint32 idx = writeIdx;
                 REPORT_ERROR(ErrorManagement::FatalError, "Buffer overrun for index %d ", idx);
                 ret = false;
             }
         }
-        uint32 n;
-        for (n = 0u; (n < numberOfCopies) && (ret); n++) {
+        if (ret) {
+            bufferMemoryMap[writeIdx].timestamp = HighResolutionTimer::Counter();
             if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
-                //Copy into the buffered table from the GAM memory
-                ret = MemoryOperationsHelper::Copy(bufferMemoryMap[writeIdx].mem[n], copyTable[n].gamPointer, copyTable[n].copySize);
+                uint32 n;
+                for (n = 0u; n < numberOfCopies; n++) {
+                    //Copy into the buffered table from the GAM memory
+                    MemoryOperationsHelper::CopyUnchecked(bufferMemoryMap[writeIdx].mem[n], copyTable[n].gamPointer, copyTable[n].copySize);
+                }
+            }
+            writeIdx++;
+            if (writeIdx == numberOfBuffers) {
+                writeIdx = 0u;
+            }
+            //Publish the page. The sequentially consistent store/load pair guarantees that either the BufferLoop sees the new
+            //writeSequence before going to sleep or that this thread sees it sleeping and wakes it up.
+            Atomic::Store(&writeSequence, static_cast<int32>(written + 1u), Atomic::MemoryOrderSequential);
+            if (Atomic::Load(&consumerSleeping, Atomic::MemoryOrderSequential) != 0) {
+                ret = sem.Post();
             }
         }
-        bufferMemoryMap[writeIdx].toConsume = true;
-        if (ret) {
-            //Fast semaphore to increment writeIdx and to atomically Post the semaphore which warns the BufferLoop that there might be new data to be consumed.
-            ret = (fastSem.FastLock() == ErrorManagement::NoError);
-        }
-        writeIdx++;
-        if (writeIdx == numberOfBuffers) {
-            writeIdx = 0u;
-        }
-        if (ret) {
-            ret = sem.Post();
-            posted = true;
-        }
-        fastSem.FastUnLock();
     }
     return ret;
 }
@@ -246,15 +259,13 @@ bool MemoryMapAsyncOutputBroker::Execute() {
 bool MemoryMapAsyncOutputBroker::Flush() {
     bool ret = true;
     if (service.GetStatus() != EmbeddedThreadI::OffState) {
-        ret = (fastSem.FastLock() == ErrorManagement::NoError);
+        const uint32 request = (static_cast<uint32>(Atomic::FetchAdd(&flushRequests, 1)) + 1u);
+        ret = sem.Post();
         if (ret) {
-            flushed = false;
-            ret = sem.Post();
-            posted = true;
-        }
-        fastSem.FastUnLock();
-        while (!flushed) {
-            Sleep::Sec(0.1F);
+            //Wait for the BufferLoop to complete a drain which started after the request
+            while (static_cast<int32>(static_cast<uint32>(Atomic::LoadAcquire(&flushedRequests)) - request) < 0) {
+                Sleep::Sec(0.1F);
+            }
         }
     }
     return ret;
@@ -264,68 +275,74 @@ bool MemoryMapAsyncOutputBroker::Flush() {
 ErrorManagement::ErrorType MemoryMapAsyncOutputBroker::BufferLoop(ExecutionInfo &info) {
     ErrorManagement::ErrorType err;
     if (info.GetStage() == ExecutionInfo::MainStage) {
-        int32 synchStopIdx = 0;
-        if (fastSem.FastLock() == ErrorManagement::NoError) {
-            //Always stay preTriggerBuffers behind from the writeIdx so that we don't lose the pre-trigger buffers
-            synchStopIdx = static_cast<int32>(writeIdx);
-        }
-        fastSem.FastUnLock();
-
-        //Have to treat the special case when only one buffer is configured
-        if (numberOfBuffers == 1u) {
-            readSynchIdx = 0u;
-            synchStopIdx = 1;
+        //Any Flush requested before this point is served by the drain below
+        const int32 flushRequest = Atomic::LoadAcquire(&flushRequests);
+        const uint32 written = static_cast<uint32>(Atomic::LoadAcquire(&writeSequence));
+        //Only this thread writes the readSequence
+        uint32 consumed = static_cast<uint32>(readSequence);
+        if ((written - consumed) > numberOfBuffers) {
+            //Only possible when buffer overruns are ignored: the oldest pages were already overwritten
+            const uint32 lost = ((written - consumed) - numberOfBuffers);
+            consumed += lost;
+            readSynchIdx = ((readSynchIdx + (lost % numberOfBuffers)) % numberOfBuffers);
         }
         bool ret = true;
-        //Check all the buffers until writeIdx - preTriggerBuffers (inclusive)
-        while ((readSynchIdx != static_cast<uint32>(synchStopIdx)) && (ret)) {
-            if (bufferMemoryMap != NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry*)) {
-                if (bufferMemoryMap[readSynchIdx].toConsume) {
+        const uint32 numberOfReadyBuffers = (written - consumed);
+        if (numberOfReadyBuffers > 0u) {
+            if ((copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) && (batchSegments != NULL_PTR(DataSourceBufferSegment*))) {
+                //Describe all the ready pages, from the oldest to the newest, so that the DataSource can consume them at once
+                uint32 pageIdx = readSynchIdx;
+                uint32 b;
+                for (b = 0u; b < numberOfReadyBuffers; b++) {
                     uint32 c;
-                    for (c = 0u; (c < numberOfCopies) && (ret); c++) {
-                        //Copy from the buffer to the DataSource memory
-                        if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
-                            ret = MemoryOperationsHelper::Copy(copyTable[c].dataSourcePointer, bufferMemoryMap[readSynchIdx].mem[c], copyTable[c].copySize);
-                        }
+                    for (c = 0u; c < numberOfCopies; c++) {
+                        DataSourceBufferSegment &segment = batchSegments[(b * numberOfCopies) + c];
+                        segment.source = bufferMemoryMap[pageIdx].mem[c];
+                        segment.destination = copyTable[c].dataSourcePointer;
+                        segment.size = copyTable[c].copySize;
+                        segment.timestamp = bufferMemoryMap[pageIdx].timestamp;
                     }
-                    if (ret) {
-                        if (dataSourceRef.IsValid()) {
-                            //Make sure that the dataSourceRef consumes this data.
-                            ret = dataSourceRef->Synchronise();
-                        }
+                    pageIdx++;
+                    if (pageIdx == numberOfBuffers) {
+                        pageIdx = 0u;
                     }
-                    bufferMemoryMap[readSynchIdx].toConsume = false;
                 }
-                readSynchIdx++;
-                if (numberOfBuffers > 1u) {
-                    if (readSynchIdx == numberOfBuffers) {
-                        readSynchIdx = 0u;
-                    }
+                if (dataSourceRef.IsValid()) {
+                    //Make sure that the dataSourceRef consumes this data.
+                    MARTe2_TRACE_EVENT(Trace::EVENT_BROKER_FLUSH_BEGIN, GetTraceNameId(), numberOfReadyBuffers)
+                    ret = dataSourceRef->SynchroniseBatch(batchSegments, numberOfReadyBuffers, numberOfCopies);
+                    MARTe2_TRACE_EVENT(Trace::EVENT_BROKER_FLUSH_END, GetTraceNameId(), numberOfReadyBuffers)
                 }
             }
+            consumed += numberOfReadyBuffers;
+            readSynchIdx = ((readSynchIdx + numberOfReadyBuffers) % numberOfBuffers);
+            //Give the pages back to the real-time thread
+            Atomic::StoreRelease(&readSequence, static_cast<int32>(consumed));
         }
 
         if (ret) {
-            flushed = true;
-            //Wait for new data to be available from the real-time thread.
-            if (!destroying) {
-                err = sem.Wait(TTInfiniteWait);
+            Atomic::StoreRelease(&flushedRequests, flushRequest);
+            if (Atomic::Load(&destroying, Atomic::MemoryOrderSequential) != 0) {
+                err = ErrorManagement::Completed;
             }
             else {
-                Sleep::Sec(0.1F);
-            }
-            if (err.ErrorsCleared()) {
-                //Only reset the semaphore if it was not posted in-between the Wait exit and now...
-                if (fastSem.FastLock() == ErrorManagement::NoError) {
-                    if (!posted) {
-                        err.fatalError = !sem.Reset();
+                //Posts from the previous wait are discarded. Any Post issued from now on will release the Wait below.
+                err.fatalError = !sem.Reset();
+                if (err.ErrorsCleared()) {
+                    Atomic::Store(&consumerSleeping, 1, Atomic::MemoryOrderSequential);
+                    //Wait for new data to be available from the real-time thread, unless it (or a Flush) arrived in the meanwhile.
+                    bool wait = (static_cast<uint32>(Atomic::Load(&writeSequence, Atomic::MemoryOrderSequential)) == written);
+                    if (wait) {
+                        wait = (Atomic::Load(&flushRequests, Atomic::MemoryOrderSequential) == flushRequest);
+                    }
+                    if (wait) {
+                        wait = (Atomic::Load(&destroying, Atomic::MemoryOrderSequential) == 0);
                     }
-                    if (destroying) {
-                        err = ErrorManagement::Completed;
+                    if (wait) {
+                        err = sem.Wait(TTInfiniteWait);
                     }
-                    posted = false;
+                    Atomic::Store(&consumerSleeping, 0, Atomic::MemoryOrderSequential);
                 }
-                fastSem.FastUnLock();
             }
         }
     }
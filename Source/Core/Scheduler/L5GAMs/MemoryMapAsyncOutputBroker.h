@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "Atomic.h"
 #include "EventSem.h"
 #include "MemoryMapBroker.h"
 #include "SingleThreadService.h"
@@ -50,14 +51,14 @@ struct MemoryMapAsyncOutputBrokerBufferEntry {
     MARTe::uint32 index;
 
     /**
-     * Data ready to be consumed?
+     * Signal addresses
      */
-    bool toConsume;
+    void **mem;
 
     /**
-     * Signal addresses
+     * HighResolutionTimer::Counter() when the page was written by the real-time thread.
      */
-    void **mem;
+    MARTe::uint64 timestamp;
 };
 /**
  * @brief A MemoryMapBroker which asynchronously stores the signals in a DataSourceI memory.
@@ -66,6 +67,12 @@ struct MemoryMapAsyncOutputBrokerBufferEntry {
  *
  * Only one GAM is allowed to interact with this MemoryMapAsyncOutputBroker (an IOGAM can be used to collate all the signals).
  *
+ * The pages are handed over with a single-producer/single-consumer ring: the real-time thread publishes the number of pages written
+ * (writeSequence) and the flushing thread the number of pages consumed (readSequence), each with release semantics. The flushing thread
+ * only sleeps on the EventSem when there is nothing to consume, and the real-time thread only posts the EventSem if the flushing thread is sleeping.
+ *
+ * All the pages that are ready when the flushing thread wakes up are handed over in one call to DataSourceI::SynchroniseBatch.
+ *
  * The DataSource shall call the UnlinkDataSource in the DataSourceI::Purge.
  */
 class MemoryMapAsyncOutputBroker: public MemoryMapBroker {
@@ -115,8 +122,9 @@ MemoryMapAsyncOutputBroker    ();
 
     /**
      * @brief Sequentially copies all the signals from the GAM memory to the next free buffer memory.
-     * @details After copying the data, the SingleThreadService is informed that new data is available so that it can be potentially flushed into
-     * the DataSourceI.
+     * @details The page is time-stamped with the HighResolutionTimer::Counter() (see DataSourceBufferSegment::timestamp). After copying the data, the SingleThreadService is informed that new data is available so that it can be potentially flushed into
+     * the DataSourceI. No lock is taken and the EventSem is only posted if the SingleThreadService is waiting for data.
+     * If an overrun is detected (and not ignored) the page is not written.
      * @return true if all copies are successfully performed and if the next free buffer is not marked for triggering (which means that an overrun as occurred).
      */
     virtual bool Execute();
@@ -192,6 +200,11 @@ private:
      */
     MemoryMapAsyncOutputBrokerBufferEntry *bufferMemoryMap;
 
+    /**
+     * The segments of the pages handed to DataSourceI::SynchroniseBatch (numberOfBuffers * numberOfCopies).
+     */
+    DataSourceBufferSegment *batchSegments;
+
     /**
      * The DataSource associated to this broker
      */
@@ -213,24 +226,39 @@ private:
     uint32 readSynchIdx;
 
     /**
-     * Semaphore that synchronises the Execute and the BufferLoop methods.
+     * The number of pages written by the Execute method (modulo 2^32). Only written by the real-time thread.
      */
-    EventSem sem;
+    volatile int32 writeSequence;
 
     /**
-     * Makes sure that the EventSem is not Reset while being posted and also protects the writeIdx variable.
+     * The number of pages consumed by the BufferLoop method (modulo 2^32). Only written by the BufferLoop.
      */
-    FastPollingMutexSem fastSem;
+    volatile int32 readSequence;
 
     /**
-     * Makes sure that the EventSem is not Reset while being posted and also protects the writeIdx variable.
+     * Not zero while the BufferLoop is (about to start) waiting on the EventSem.
      */
-    bool posted;
+    volatile int32 consumerSleeping;
+
+    /**
+     * The number of Flush requests.
+     */
+    volatile int32 flushRequests;
+
+    /**
+     * The number of Flush requests that were served by the BufferLoop.
+     */
+    volatile int32 flushedRequests;
+
+    /**
+     * Semaphore used to wake up the BufferLoop when it is waiting for new data.
+     */
+    EventSem sem;
 
     /**
      * Allows a clean exit of the BufferLoop thread
      */
-    bool destroying;
+    volatile int32 destroying;
 
     /**
      * The binder for the SingleThreadService.
@@ -241,11 +269,6 @@ private:
      * If true buffer overruns will be ignored.
      */
     bool ignoreBufferOverrun;
-
-    /**
-     * True if flushed was called.
-     */
-    bool flushed;
 };
 }
 
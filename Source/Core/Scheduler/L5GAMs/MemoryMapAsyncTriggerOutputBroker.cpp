@@ -31,6 +31,7 @@
 #include "MemoryMapAsyncTriggerOutputBroker.h"
 
 #include "AdvancedErrorManagement.h"
+#include "PinnedMemory.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -66,6 +67,12 @@ MemoryMapAsyncTriggerOutputBroker::MemoryMapAsyncTriggerOutputBroker() :
     posted = false;
     destroying = false;
     triggerIndexInGAMMemory = 0u;
+    contiguousBufferMemory = false;
+    hugePages = false;
+    lockMemory = false;
+    bufferMemory = NULL_PTR(void *);
+    bufferMemoryMappedSize = 0u;
+    bufferPageByteSize = 0u;
 }
 
 /*lint -e{1551} the destructor must guarantee that the SingleThreadService is stopped and that buffer memory is freed.*/
@@ -75,8 +82,10 @@ MemoryMapAsyncTriggerOutputBroker::~MemoryMapAsyncTriggerOutputBroker() {
         uint32 i;
         for (i = 0u; i < numberOfBuffers; i++) {
             uint32 c;
-            for (c = 0u; c < numberOfCopies; c++) {
-                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(bufferMemoryMap[i].mem[c]);
+            if (!contiguousBufferMemory) {
+                for (c = 0u; c < numberOfCopies; c++) {
+                    GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(bufferMemoryMap[i].mem[c]);
+                }
             }
             delete[] bufferMemoryMap[i].mem;
             bufferMemoryMap[i].mem = NULL_PTR(void**);
@@ -85,6 +94,32 @@ MemoryMapAsyncTriggerOutputBroker::~MemoryMapAsyncTriggerOutputBroker() {
         delete[] bufferMemoryMap;
         bufferMemoryMap = NULL_PTR(MemoryMapAsyncTriggerOutputBrokerBufferEntry*);
     }
+    if (!PinnedMemory::Free(bufferMemory, bufferMemoryMappedSize)) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not free the contiguous buffer memory.");
+    }
+}
+
+void MemoryMapAsyncTriggerOutputBroker::SetContiguousBufferMemory(const bool hugePagesIn,
+                                                                  const bool lockMemoryIn) {
+    if (bufferMemoryMap == NULL_PTR(MemoryMapAsyncTriggerOutputBrokerBufferEntry*)) {
+        contiguousBufferMemory = true;
+        hugePages = hugePagesIn;
+        lockMemory = lockMemoryIn;
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::Warning, "SetContiguousBufferMemory shall be called before InitWithTriggerParameters");
+    }
+}
+
+bool MemoryMapAsyncTriggerOutputBroker::GetBufferMemory(void *&address,
+                                                        uint32 &size) const {
+    address = bufferMemory;
+    size = (bufferPageByteSize * numberOfBuffers);
+    return (bufferMemory != NULL_PTR(void *));
+}
+
+uint32 MemoryMapAsyncTriggerOutputBroker::GetBufferPageByteSize() const {
+    return bufferPageByteSize;
 }
 
 void MemoryMapAsyncTriggerOutputBroker::UnlinkDataSource() {
@@ -199,6 +234,29 @@ bool MemoryMapAsyncTriggerOutputBroker::InitWithTriggerParameters(const SignalDi
     if (ok) {
         dataSourceRef = Reference(&dataSourceIn);
     }
+    if (ok) {
+        if (contiguousBufferMemory) {
+            //Each copy starts 8 byte aligned inside the page
+            uint64 pageSize = 0u;
+            uint32 c;
+            for (c = 0u; c < numberOfCopies; c++) {
+                pageSize += ((static_cast<uint64>(copyTable[c].copySize) + 7u) & ~static_cast<uint64>(7u));
+            }
+            uint64 totalSize = (pageSize * numberOfBuffers);
+            ok = ((totalSize > 0u) && (totalSize <= 0xFFFFFFFFu));
+            if (ok) {
+                bufferPageByteSize = static_cast<uint32>(pageSize);
+                bufferMemory = PinnedMemory::Allocate(static_cast<uint32>(totalSize), hugePages, lockMemory, bufferMemoryMappedSize);
+                ok = (bufferMemory != NULL_PTR(void *));
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate the contiguous buffer memory");
+                }
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The contiguous buffer memory shall be > 0 and < 4 GB");
+            }
+        }
+    }
     if (ok) {
         bufferMemoryMap = new MemoryMapAsyncTriggerOutputBrokerBufferEntry[numberOfBuffers];
         uint32 i;
@@ -207,9 +265,19 @@ bool MemoryMapAsyncTriggerOutputBroker::InitWithTriggerParameters(const SignalDi
             bufferMemoryMap[i].triggered = false;
             uint32 c;
             bufferMemoryMap[i].mem = new void*[numberOfCopies];
-            for (c = 0u; (c < numberOfCopies) && (ok); c++) {
-                bufferMemoryMap[i].mem[c] = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(copyTable[c].copySize);
-                ok = MemoryOperationsHelper::Set(bufferMemoryMap[i].mem[c], '\0', copyTable[c].copySize);
+            if (contiguousBufferMemory) {
+                //The mapped memory is already zero initialised
+                uint32 offset = (i * bufferPageByteSize);
+                for (c = 0u; c < numberOfCopies; c++) {
+                    bufferMemoryMap[i].mem[c] = &(reinterpret_cast<char8 *>(bufferMemory)[offset]);
+                    offset += ((copyTable[c].copySize + 7u) & ~7u);
+                }
+            }
+            else {
+                for (c = 0u; (c < numberOfCopies) && (ok); c++) {
+                    bufferMemoryMap[i].mem[c] = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(copyTable[c].copySize);
+                    ok = MemoryOperationsHelper::Set(bufferMemoryMap[i].mem[c], '\0', copyTable[c].copySize);
+                }
             }
         }
     }
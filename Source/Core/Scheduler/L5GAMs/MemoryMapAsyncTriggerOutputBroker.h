@@ -73,6 +73,11 @@ struct MemoryMapAsyncTriggerOutputBrokerBufferEntry {
  * type uint8. All the signals shall have one and only one sample. The DataSourceI shall return GetNumberOfMemoryBuffers() == 1.
  *
  * Only one GAM is allowed to interact with this MemoryMapAsyncTriggerOutputBroker (an IOGAM can be used to collate all the signals).
+ *
+ * By default each signal copy of each page is allocated from the standard heap. If SetContiguousBufferMemory is called before InitWithTriggerParameters,
+ * the whole ring is instead allocated as a single page aligned block (see PinnedMemory), optionally backed by huge pages and locked in memory.
+ * The page i then starts at GetBufferPageByteSize() * i from the block start (see GetBufferMemory), so that the complete pre/post-trigger window
+ * can be dumped as one memory region.
  * 
  * The DataSource shall call the UnlinkDataSource in the DataSourceI::Purge.
  */
@@ -186,6 +191,28 @@ MemoryMapAsyncTriggerOutputBroker    ();
      */
     void UnlinkDataSource();
 
+    /**
+     * @brief Allocates all the pages in a single contiguous block.
+     * @details Shall be called before InitWithTriggerParameters. The signal copies are stored in each page in the copy table order, each starting at an 8 byte aligned offset.
+     * @param[in] hugePagesIn if true the block is backed by huge pages (if available).
+     * @param[in] lockMemoryIn if true the block is locked in memory.
+     */
+    void SetContiguousBufferMemory(const bool hugePagesIn, const bool lockMemoryIn);
+
+    /**
+     * @brief Gets the contiguous block where all the pages are stored.
+     * @param[out] address the start of the block.
+     * @param[out] size the number of bytes used by the pages (GetBufferPageByteSize() * GetNumberOfBuffers()).
+     * @return true if the pages were allocated in a contiguous block (see SetContiguousBufferMemory).
+     */
+    bool GetBufferMemory(void *&address, uint32 &size) const;
+
+    /**
+     * @brief Gets the distance, in bytes, between two consecutive pages of the contiguous block.
+     * @return the distance between two consecutive pages or zero if the pages are not allocated in a contiguous block.
+     */
+    uint32 GetBufferPageByteSize() const;
+
 private:
 
     /**
@@ -296,6 +323,36 @@ private:
      * The index of the trigger on the GAM signal (it is for sure zero in the DataSource, but it is not necessarily zero in the GAM memory).
      */
     uint32 triggerIndexInGAMMemory;
+
+    /**
+     * True if the pages are allocated in a single contiguous block.
+     */
+    bool contiguousBufferMemory;
+
+    /**
+     * True if the contiguous block shall be backed by huge pages.
+     */
+    bool hugePages;
+
+    /**
+     * True if the contiguous block shall be locked in memory.
+     */
+    bool lockMemory;
+
+    /**
+     * The contiguous block where all the pages are stored.
+     */
+    void *bufferMemory;
+
+    /**
+     * The number of bytes mapped for the contiguous block.
+     */
+    uint32 bufferMemoryMappedSize;
+
+    /**
+     * The distance, in bytes, between two consecutive pages of the contiguous block.
+     */
+    uint32 bufferPageByteSize;
 };
 }
 
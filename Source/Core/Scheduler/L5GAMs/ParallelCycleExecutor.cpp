@@ -0,0 +1,182 @@
+/**
+ * @file ParallelCycleExecutor.cpp
+ * @brief Source file for class ParallelCycleExecutor
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ParallelCycleExecutor (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "HighResolutionTimer.h"
+#include "ParallelCycleExecutor.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Time in micro-seconds a worker waits for the release of a cycle before returning to the MultiThreadService (so that it can be stopped).
+ */
+static const uint32 PARALLEL_CYCLE_RELEASE_WAIT_USEC = 100000u;
+
+/**
+ * Time in micro-seconds a lane busy-waits before sleeping between checks (so that a lane sharing its CPU cannot starve the others).
+ */
+static const uint32 PARALLEL_CYCLE_SPIN_USEC = 1000u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+ParallelCycleExecutor::ParallelCycleExecutor(const GAMSchedulerI &schedulerIn,
+                                             const ParallelSchedule &scheduleIn,
+                                             const char8 * const threadName) :
+        EmbeddedServiceMethodBinderI(),
+        scheduler(schedulerIn),
+        schedule(scheduleIn),
+        workers(*this) {
+    cycle = 0;
+    arrived = 0;
+    failed = 0;
+    stopping = 0;
+    cycleStartTicks = 0u;
+    spinTicks = (HighResolutionTimer::Frequency() * static_cast<uint64>(PARALLEL_CYCLE_SPIN_USEC)) / 1000000u;
+    releaseWaitTicks = (HighResolutionTimer::Frequency() * static_cast<uint64>(PARALLEL_CYCLE_RELEASE_WAIT_USEC)) / 1000000u;
+    laneCycles = new uint64[schedule.numberOfLanes];
+    laneReleases = new int32[schedule.numberOfLanes];
+    for (uint32 n = 0u; n < schedule.numberOfLanes; n++) {
+        laneCycles[n] = 0u;
+        laneReleases[n] = 0;
+    }
+    workerName = threadName;
+    workerName += "_Worker";
+}
+
+/*lint -e{1551} the destructor must guarantee that the workers are stopped.*/
+ParallelCycleExecutor::~ParallelCycleExecutor() {
+    (void) Stop();
+    delete [] laneCycles;
+    delete [] laneReleases;
+}
+
+ErrorManagement::ErrorType ParallelCycleExecutor::Start() {
+    uint32 numberOfWorkers = schedule.numberOfLanes - 1u;
+    workers.SetNumberOfPoolThreads(numberOfWorkers);
+    ErrorManagement::ErrorType err = workers.CreateThreads();
+    if (err.ErrorsCleared()) {
+        for (uint32 w = 0u; w < numberOfWorkers; w++) {
+            workers.SetPriorityClassThreadPool(Threads::RealTimePriorityClass, w);
+            //AddCPU numbers the CPUs from 1
+            ProcessorType workerCPU(UndefinedCPUs);
+            workerCPU.AddCPU(schedule.workerCPUs[w] + 1u);
+            workers.SetCPUMaskThreadPool(workerCPU, w);
+            workers.SetThreadNameThreadPool(workerName.Buffer(), w);
+        }
+        Atomic::Store(&stopping, 0, Atomic::MemoryOrderRelease);
+        err = workers.Start();
+    }
+    if (!err.ErrorsCleared()) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to start the workers of %s", workerName.Buffer());
+    }
+    return err;
+}
+
+ErrorManagement::ErrorType ParallelCycleExecutor::Stop() {
+    //Release the workers that might be waiting at a barrier of a cycle that will not be completed
+    Atomic::Store(&stopping, 1, Atomic::MemoryOrderRelease);
+    return workers.Stop();
+}
+
+bool ParallelCycleExecutor::ExecuteCycle() {
+    Atomic::Store(&failed, 0, Atomic::MemoryOrderRelaxed);
+    cycleStartTicks = HighResolutionTimer::Counter();
+    //The increment releases the cycleStartTicks and the failed flag to the workers
+    (void) Atomic::FetchAdd(&cycle, 1);
+    laneReleases[0u]++;
+    ExecuteLane(0u);
+    return (Atomic::Load(&failed, Atomic::MemoryOrderAcquire) == 0);
+}
+
+void ParallelCycleExecutor::ExecuteLane(const uint32 lane) {
+    int64 numberOfLanes = static_cast<int64>(schedule.numberOfLanes);
+    int64 levelBarrier = static_cast<int64>(laneCycles[lane]) * static_cast<int64>(schedule.numberOfLevels) * numberOfLanes;
+    bool stop = false;
+    for (uint32 l = 0u; (l < schedule.numberOfLevels) && (!stop); l++) {
+        if (Atomic::Load(&failed, Atomic::MemoryOrderAcquire) == 0) {
+            if (!scheduler.ExecuteParallelSegment(schedule, l, lane, cycleStartTicks)) {
+                Atomic::Store(&failed, 1, Atomic::MemoryOrderRelease);
+            }
+        }
+        //Wait for all the lanes to complete this level (the acquire makes their writes visible to the next level)
+        levelBarrier += numberOfLanes;
+        (void) Atomic::FetchAdd(&arrived, static_cast<int64>(1));
+        uint64 waitStart = HighResolutionTimer::Counter();
+        while ((Atomic::Load(&arrived, Atomic::MemoryOrderAcquire) < levelBarrier) && (!stop)) {
+            stop = (Atomic::Load(&stopping, Atomic::MemoryOrderRelaxed) != 0);
+            if ((HighResolutionTimer::Counter() - waitStart) > spinTicks) {
+                Sleep::MSec(1u);
+            }
+        }
+    }
+    laneCycles[lane]++;
+}
+
+/*lint -e{1764} EmbeddedServiceMethodBinderI callback method pointer prototype requires a non constant ExecutionInfo*/
+ErrorManagement::ErrorType ParallelCycleExecutor::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        uint32 lane = info.GetThreadNumber() + 1u;
+        uint64 waitStart = HighResolutionTimer::Counter();
+        bool released = false;
+        bool timeout = false;
+        while ((!released) && (!timeout)) {
+            Atomic::WaitWhileEqual(&cycle, laneReleases[lane]);
+            int32 current = Atomic::Load(&cycle, Atomic::MemoryOrderAcquire);
+            released = (current != laneReleases[lane]);
+            if (released) {
+                laneReleases[lane] = current;
+            }
+            else {
+                uint64 waited = (HighResolutionTimer::Counter() - waitStart);
+                timeout = (waited > releaseWaitTicks);
+                if (waited > spinTicks) {
+                    Sleep::MSec(1u);
+                }
+            }
+            if (Atomic::Load(&stopping, Atomic::MemoryOrderRelaxed) != 0) {
+                timeout = true;
+            }
+        }
+        if (released) {
+            ExecuteLane(lane);
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+}
@@ -0,0 +1,180 @@
+/**
+ * @file ParallelCycleExecutor.h
+ * @brief Header file for class ParallelCycleExecutor
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ParallelCycleExecutor
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PARALLELCYCLEEXECUTOR_H_
+#define PARALLELCYCLEEXECUTOR_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "EmbeddedServiceMethodBinderI.h"
+#include "GAMSchedulerI.h"
+#include "MultiThreadService.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Executes the cycles of a real-time thread with a ParallelSchedule (see RealTimeThread WorkerCPUs).
+ * @details The real-time thread executes the lane 0 of each level and one worker thread, pinned to its CPU and with
+ * real-time priority, executes each of the other lanes. The workers busy-wait (see Atomic::WaitWhileEqual) for the
+ * release of a cycle and all the lanes meet at a barrier (a shared monotonic counter) after each level, so that a level
+ * only starts when all the GAMs it depends on were executed. A lane that busy-waits for more than one millisecond
+ * (e.g. because the worker CPUs are not isolated or the thread is not released) sleeps between the checks.
+ *
+ * If an ExecutableI fails the remaining levels of the cycle are skipped by all the lanes (as in
+ * GAMSchedulerI::ExecuteSingleCycle) and ExecuteCycle returns false.
+ */
+class ParallelCycleExecutor: public EmbeddedServiceMethodBinderI {
+
+public:
+
+    /**
+     * @brief Constructor.
+     * @param[in] schedulerIn the scheduler that owns the \a scheduleIn.
+     * @param[in] scheduleIn the parallel schedule of the thread.
+     * @param[in] threadName the name of the real-time thread (the workers are named threadName_Worker).
+     */
+    ParallelCycleExecutor(const GAMSchedulerI &schedulerIn,
+                          const ParallelSchedule &scheduleIn,
+                          const char8 * const threadName);
+
+    /**
+     * @brief Destructor. Stops the workers.
+     */
+    virtual ~ParallelCycleExecutor();
+
+    /**
+     * @brief Starts the worker threads.
+     * @return ErrorManagement::NoError if all the workers were started.
+     */
+    ErrorManagement::ErrorType Start();
+
+    /**
+     * @brief Stops the worker threads.
+     * @return ErrorManagement::NoError if all the workers were stopped.
+     */
+    ErrorManagement::ErrorType Stop();
+
+    /**
+     * @brief Executes one cycle of the schedule. Shall only be called by the real-time thread that owns the schedule.
+     * @return true if all the ExecutableIs were successfully executed.
+     * @pre
+     *   Start()
+     */
+    bool ExecuteCycle();
+
+    /**
+     * @brief Callback of the worker threads.
+     * @param[in] info the worker thread information.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+private:
+
+    /**
+     * @brief Executes all the levels of the current cycle for a lane.
+     * @param[in] lane the lane to execute.
+     */
+    void ExecuteLane(const uint32 lane);
+
+    /**
+     * The scheduler that executes the ExecutableIs.
+     */
+    const GAMSchedulerI &scheduler;
+
+    /**
+     * The parallel schedule.
+     */
+    const ParallelSchedule &schedule;
+
+    /**
+     * The worker threads.
+     */
+    MultiThreadService workers;
+
+    /**
+     * Incremented to release a cycle.
+     */
+    volatile int32 cycle;
+
+    /**
+     * Number of lanes arrived at the barrier of a level (never reset).
+     */
+    volatile int64 arrived;
+
+    /**
+     * Set (to 1) if an ExecutableI failed in the current cycle.
+     */
+    volatile int32 failed;
+
+    /**
+     * Set (to 1) to release the workers from any wait while they are being stopped.
+     */
+    volatile int32 stopping;
+
+    /**
+     * The HighResolutionTimer::Counter at the beginning of the current cycle.
+     */
+    uint64 cycleStartTicks;
+
+    /**
+     * The HighResolutionTimer ticks of PARALLEL_CYCLE_SPIN_USEC.
+     */
+    uint64 spinTicks;
+
+    /**
+     * The HighResolutionTimer ticks of PARALLEL_CYCLE_RELEASE_WAIT_USEC.
+     */
+    uint64 releaseWaitTicks;
+
+    /**
+     * The number of cycles executed by each lane.
+     */
+    uint64 *laneCycles;
+
+    /**
+     * The last value of cycle seen by each lane.
+     */
+    int32 *laneReleases;
+
+    /**
+     * The workers thread name.
+     */
+    StreamString workerName;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* PARALLELCYCLEEXECUTOR_H_ */
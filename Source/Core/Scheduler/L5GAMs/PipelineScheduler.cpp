@@ -0,0 +1,572 @@
+/**
+ * @file PipelineScheduler.cpp
+ * @brief Source file for class PipelineScheduler
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PipelineScheduler (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "ExecutionInfo.h"
+#include "GAMDataDependencies.h"
+#include "ObjectRegistryDatabase.h"
+#include "PipelineScheduler.h"
+#include "RealTimeState.h"
+#include "Sleep.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Time in micro-seconds a stage waits for the previous or the next stage before returning to the MultiThreadService (so that it can be stopped).
+ */
+static const uint32 PIPELINE_SCHEDULER_RELEASE_WAIT_USEC = 100000u;
+
+/**
+ * Time in micro-seconds a stage busy-waits before sleeping between checks (so that a stage sharing its CPU cannot starve the others).
+ */
+static const uint32 PIPELINE_SCHEDULER_SPIN_USEC = 1000u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+PipelineScheduler::PipelineScheduler() :
+        GAMScheduler() {
+    schedules = NULL_PTR(PipelineSchedule **);
+    numberOfScheduledStates = 0u;
+    stageInfo[0] = NULL_PTR(PipelineStageParam *);
+    stageInfo[1] = NULL_PTR(PipelineStageParam *);
+    numberOfStageThreads[0] = 0u;
+    numberOfStageThreads[1] = 0u;
+    stageCounters[0] = NULL_PTR(PipelineCounters *);
+    stageCounters[1] = NULL_PTR(PipelineCounters *);
+    numberOfCounters[0] = 0u;
+    numberOfCounters[1] = 0u;
+    spinTicks = (HighResolutionTimer::Frequency() * static_cast<uint64>(PIPELINE_SCHEDULER_SPIN_USEC)) / 1000000u;
+    releaseWaitTicks = (HighResolutionTimer::Frequency() * static_cast<uint64>(PIPELINE_SCHEDULER_RELEASE_WAIT_USEC)) / 1000000u;
+}
+
+/*lint -e{1551} the destructor must guarantee that the stage threads are stopped before the stages are freed.*/
+PipelineScheduler::~PipelineScheduler() {
+    for (uint32 b = 0u; b < 2u; b++) {
+        StopStages(b);
+        if (multiThreadService[b] != NULL) {
+            ErrorManagement::ErrorType err = multiThreadService[b]->Stop();
+            if (!err.ErrorsCleared()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the stage threads");
+            }
+        }
+        FreeStages(b);
+    }
+    if (schedules != NULL_PTR(PipelineSchedule **)) {
+        for (uint32 i = 0u; i < numberOfScheduledStates; i++) {
+            if (schedules[i] != NULL_PTR(PipelineSchedule *)) {
+                uint32 numberOfThreads = states[i].numberOfThreads;
+                for (uint32 j = 0u; j < numberOfThreads; j++) {
+                    delete [] schedules[i][j].stageFirst;
+                    delete [] schedules[i][j].gates;
+                    delete [] schedules[i][j].gateStages;
+                    delete [] schedules[i][j].stageCPUs;
+                }
+                delete [] schedules[i];
+            }
+        }
+        delete [] schedules;
+    }
+}
+
+bool PipelineScheduler::ConfigureScheduler(Reference realTimeAppIn) {
+    bool ret = GAMSchedulerI::ConfigureScheduler(realTimeAppIn);
+    ReferenceT<RealTimeApplication> rtApp = realTimeApp;
+    ReferenceT<ReferenceContainer> statesContainer;
+    if (ret) {
+        statesContainer = rtApp->Find("States");
+        ret = statesContainer.IsValid();
+    }
+    if (ret) {
+        numberOfScheduledStates = numberOfStates;
+        schedules = new PipelineSchedule*[numberOfStates];
+        for (uint32 i = 0u; i < numberOfStates; i++) {
+            uint32 numberOfThreads = states[i].numberOfThreads;
+            schedules[i] = new PipelineSchedule[numberOfThreads];
+            for (uint32 j = 0u; j < numberOfThreads; j++) {
+                schedules[i][j].numberOfStages = 1u;
+                schedules[i][j].stageFirst = NULL_PTR(uint32 *);
+                schedules[i][j].gates = NULL_PTR(uint32 *);
+                schedules[i][j].gateStages = NULL_PTR(uint32 *);
+                schedules[i][j].numberOfGates = 0u;
+                schedules[i][j].stageCPUs = NULL_PTR(uint32 *);
+            }
+        }
+    }
+    for (uint32 i = 0u; (i < numberOfStates) && (ret); i++) {
+        ReferenceT<RealTimeState> stateElement = statesContainer->Get(i);
+        ReferenceT<ReferenceContainer> threadContainer;
+        ret = stateElement.IsValid();
+        if (ret) {
+            threadContainer = stateElement->Find("Threads");
+            ret = threadContainer.IsValid();
+        }
+        for (uint32 j = 0u; (j < states[i].numberOfThreads) && (ret); j++) {
+            ReferenceT<RealTimeThread> threadElement = threadContainer->Get(j);
+            ret = threadElement.IsValid();
+            if (ret) {
+                ret = BuildPipelineSchedule(threadElement, states[i].threads[j], schedules[i][j]);
+            }
+        }
+    }
+    return ret;
+}
+
+bool PipelineScheduler::BuildPipelineSchedule(ReferenceT<RealTimeThread> threadElement,
+                                              const ScheduledThread &thread,
+                                              PipelineSchedule &schedule) const {
+    ReferenceContainer gams;
+    bool ret = threadElement->GetGAMs(gams);
+    uint32 numberOfGams = gams.Size();
+    uint32 numberOfStages = threadElement->GetNumberOfPipelineStages() + 1u;
+    const StreamString *stageNames = threadElement->GetPipelineStages();
+    schedule.numberOfStages = numberOfStages;
+    schedule.stageFirst = new uint32[numberOfStages + 1u];
+    schedule.stageCPUs = new uint32[numberOfStages];
+    schedule.gates = new uint32[numberOfGams + 1u];
+    schedule.gateStages = new uint32[numberOfGams + 1u];
+    schedule.stageFirst[0u] = 0u;
+    for (uint32 s = 1u; s < numberOfStages; s++) {
+        schedule.stageCPUs[s - 1u] = threadElement->GetPipelineCPUs()[s - 1u];
+    }
+
+    //The executables of each GAM are its input brokers, the GAM and its output brokers (see GAMSchedulerI::ConfigureScheduler)
+    uint32 *gamStages = new uint32[numberOfGams + 1u];
+    uint32 *gamOutputs = new uint32[numberOfGams + 1u];
+    uint32 stage = 0u;
+    uint32 e = 0u;
+    for (uint32 k = 0u; (k < numberOfGams) && (ret); k++) {
+        ReferenceT<GAM> gam = gams.Get(k);
+        ret = gam.IsValid();
+        if (ret) {
+            if ((k > 0u) && ((stage + 1u) < numberOfStages)) {
+                if (stageNames[stage] == gam->GetName()) {
+                    stage++;
+                    schedule.stageFirst[stage] = e;
+                }
+            }
+            gamStages[k] = stage;
+            ReferenceContainer inputBrokers;
+            ret = gam->GetInputBrokers(inputBrokers);
+            if (ret) {
+                e += inputBrokers.Size() + 1u;
+                gamOutputs[k] = e;
+                ReferenceContainer outputBrokers;
+                ret = gam->GetOutputBrokers(outputBrokers);
+                if (ret) {
+                    e += outputBrokers.Size();
+                }
+            }
+        }
+    }
+    if (ret) {
+        ret = ((stage + 1u) == numberOfStages) && (e == thread.numberOfExecutables);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The PipelineStages of the thread %s shall be GAMs of the thread (after the first), in the execution order",
+                         thread.name);
+        }
+    }
+    if (ret) {
+        schedule.stageFirst[numberOfStages] = e;
+    }
+
+    //Gate the output brokers of the GAMs which write data used by the later stages
+    GAMDataDependencies dependencies;
+    if ((ret) && (numberOfStages > 1u)) {
+        ret = dependencies.Initialise(realTimeApp, gams);
+    }
+    for (uint32 a = 0u; (a < numberOfGams) && (ret) && (numberOfStages > 1u); a++) {
+        bool gated = false;
+        uint32 gateStage = 0u;
+        for (uint32 b = a + 1u; (b < numberOfGams) && (ret); b++) {
+            if (gamStages[b] > gamStages[a]) {
+                ret = !dependencies.WritesSignal(b, a);
+                if (ret) {
+                    if ((dependencies.WritesSignal(a, b)) || (dependencies.WritesDataSource(a, b))) {
+                        gated = true;
+                        gateStage = gamStages[b];
+                    }
+                }
+                else {
+                    ReferenceT<GAM> producer = gams.Get(b);
+                    ReferenceT<GAM> consumer = gams.Get(a);
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The GAM %s writes a signal used by the GAM %s of a previous pipeline stage",
+                                 producer->GetName(), consumer->GetName());
+                }
+            }
+        }
+        if (gated) {
+            schedule.gates[schedule.numberOfGates] = gamOutputs[a];
+            schedule.gateStages[schedule.numberOfGates] = gateStage;
+            schedule.numberOfGates++;
+        }
+    }
+    if ((ret) && (numberOfStages > 1u)) {
+        REPORT_ERROR(ErrorManagement::Information, "Thread %s: %d GAMs in %d pipeline stages with %d gated GAMs", thread.name, numberOfGams, numberOfStages,
+                     schedule.numberOfGates);
+    }
+    delete [] gamStages;
+    delete [] gamOutputs;
+    return ret;
+}
+
+ErrorManagement::ErrorType PipelineScheduler::StopCurrentStateExecution() {
+    ErrorManagement::ErrorType err(realTimeApplicationT.IsValid());
+    if (err.ErrorsCleared()) {
+        StopStages(realTimeApplicationT->GetIndex());
+        err = GAMScheduler::StopCurrentStateExecution();
+    }
+    return err;
+}
+
+void PipelineScheduler::Purge(ReferenceContainer &purgeList) {
+    StopStages(0u);
+    StopStages(1u);
+    GAMScheduler::Purge(purgeList);
+}
+
+void PipelineScheduler::StopStages(const uint32 buffer) {
+    if (stageCounters[buffer] != NULL_PTR(PipelineCounters *)) {
+        for (uint32 t = 0u; t < numberOfCounters[buffer]; t++) {
+            Atomic::Store(&stageCounters[buffer][t].stopping, 1, Atomic::MemoryOrderRelease);
+        }
+    }
+}
+
+void PipelineScheduler::FreeStages(const uint32 buffer) {
+    if (stageCounters[buffer] != NULL_PTR(PipelineCounters *)) {
+        for (uint32 t = 0u; t < numberOfCounters[buffer]; t++) {
+            delete [] stageCounters[buffer][t].started;
+            delete [] stageCounters[buffer][t].completed;
+            delete [] stageCounters[buffer][t].cycleStartTicks;
+            delete [] stageCounters[buffer][t].latency;
+            delete [] stageCounters[buffer][t].maxLatency;
+        }
+        delete [] stageCounters[buffer];
+        stageCounters[buffer] = NULL_PTR(PipelineCounters *);
+    }
+    numberOfCounters[buffer] = 0u;
+    if (stageInfo[buffer] != NULL_PTR(PipelineStageParam *)) {
+        delete [] stageInfo[buffer];
+        stageInfo[buffer] = NULL_PTR(PipelineStageParam *);
+    }
+    numberOfStageThreads[buffer] = 0u;
+}
+
+void PipelineScheduler::CustomPrepareNextState() {
+    ErrorManagement::ErrorType err;
+    if (errorMessage.IsValid()) {
+        //The errorMessage is sent from the real-time threads
+        errorMessageDestination = ObjectRegistryDatabase::Instance()->Find(errorMessage->GetDestination());
+    }
+    if (eventSem.Reset()) {
+        realTimeApplicationT = realTimeApp;
+        err = !realTimeApplicationT.IsValid();
+        if (err.ErrorsCleared()) {
+            //Launches the stage threads for the next state
+            uint32 nextBuffer = (realTimeApplicationT->GetIndex() + 1u) % 2u;
+            ScheduledState *nextState = GetSchedulableStates()[nextBuffer];
+            uint32 numberOfThreads = nextState->numberOfThreads;
+            const PipelineSchedule *nextSchedules = schedules[nextStateIdentifier];
+            uint32 numberOfThreadStages = 0u;
+            for (uint32 i = 0u; i < numberOfThreads; i++) {
+                numberOfThreadStages += nextSchedules[i].numberOfStages;
+            }
+            StopStages(nextBuffer);
+            if (multiThreadService[nextBuffer] != NULL) {
+                err = multiThreadService[nextBuffer]->Stop();
+                delete multiThreadService[nextBuffer];
+            }
+            if (err.ErrorsCleared()) {
+                FreeStages(nextBuffer);
+                multiThreadService[nextBuffer] = new (NULL) MultiThreadService(binder);
+                multiThreadService[nextBuffer]->SetNumberOfPoolThreads(numberOfThreadStages);
+                err = multiThreadService[nextBuffer]->CreateThreads();
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to Stop() MultiThreadService.");
+            }
+            if (err.ErrorsCleared()) {
+                stageCounters[nextBuffer] = new PipelineCounters[numberOfThreads];
+                numberOfCounters[nextBuffer] = numberOfThreads;
+                stageInfo[nextBuffer] = new PipelineStageParam[numberOfThreadStages];
+                numberOfStageThreads[nextBuffer] = numberOfThreadStages;
+                uint32 n = 0u;
+                for (uint32 i = 0u; i < numberOfThreads; i++) {
+                    const PipelineSchedule &schedule = nextSchedules[i];
+                    PipelineCounters &counters = stageCounters[nextBuffer][i];
+                    uint32 numberOfStages = schedule.numberOfStages;
+                    counters.started = new int64[numberOfStages];
+                    counters.completed = new int64[numberOfStages];
+                    counters.cycleStartTicks = new uint64[numberOfStages + 1u];
+                    counters.latency = new uint32[numberOfStages];
+                    counters.maxLatency = new uint32[numberOfStages];
+                    counters.stopping = 0;
+                    for (uint32 s = 0u; s < numberOfStages; s++) {
+                        counters.started[s] = 0;
+                        counters.completed[s] = 0;
+                        counters.latency[s] = 0u;
+                        counters.maxLatency[s] = 0u;
+                    }
+                    for (uint32 s = 0u; s < numberOfStages; s++) {
+                        PipelineStageParam &param = stageInfo[nextBuffer][n];
+                        param.thread.executables = nextState->threads[i].executables;
+                        param.thread.numberOfExecutables = nextState->threads[i].numberOfExecutables;
+                        param.thread.cycleTime = nextState->threads[i].cycleTime;
+                        param.thread.cycleTimeHistogram = nextState->threads[i].cycleTimeHistogram;
+                        param.thread.lastCycleTimeStamp = 0u;
+                        param.thread.lateness = nextState->threads[i].lateness;
+                        param.thread.period = static_cast<uint64>(nextState->threads[i].period) * 1000LLU;
+                        param.thread.phase = static_cast<uint64>(nextState->threads[i].phase) * 1000LLU;
+                        param.thread.busyWaitTail = nextState->threads[i].busyWaitTail;
+                        param.thread.nextRelease = 0u;
+                        param.thread.parallelExecutor = NULL_PTR(ParallelCycleExecutor *);
+                        param.thread.flatCycle = NULL_PTR(FlatCycle *);
+                        param.thread.multiRate = NULL_PTR(MultiRateSchedule *);
+                        param.thread.prefetch = NULL_PTR(const PrefetchTable *);
+                        //The budget applies to the end-to-end latency of the cycle, i.e. it is checked by the last stage
+                        param.thread.budgetMonitor = NULL_PTR(CycleBudgetMonitor *);
+                        if ((s + 1u) == numberOfStages) {
+                            param.thread.budgetMonitor = nextState->threads[i].budgetMonitor;
+                        }
+                        param.schedule = &schedule;
+                        param.counters = &counters;
+                        param.name = nextState->threads[i].name;
+                        param.stage = s;
+                        param.cycle = 0;
+                        multiThreadService[nextBuffer]->SetPriorityClassThreadPool(Threads::RealTimePriorityClass, n);
+                        multiThreadService[nextBuffer]->SetStackSizeThreadPool(nextState->threads[i].stackSize, n);
+                        multiThreadService[nextBuffer]->SetPrefaultStackSizeThreadPool(nextState->threads[i].prefaultStackSize, n);
+                        if (s == 0u) {
+                            multiThreadService[nextBuffer]->SetCPUMaskThreadPool(nextState->threads[i].cpu, n);
+                            multiThreadService[nextBuffer]->SetThreadNameThreadPool(nextState->threads[i].name, n);
+                            multiThreadService[nextBuffer]->SetDeadlineThreadPool(static_cast<uint64>(nextState->threads[i].deadlineRuntime) * 1000LLU,
+                                                                                  static_cast<uint64>(nextState->threads[i].deadlineDeadline) * 1000LLU,
+                                                                                  static_cast<uint64>(nextState->threads[i].deadlinePeriod) * 1000LLU, n);
+                        }
+                        else {
+                            StreamString stageName;
+                            (void) stageName.Printf("%s_Stage%d", nextState->threads[i].name, s);
+                            //AddCPU numbers the CPUs from 1
+                            ProcessorType stageCPU(UndefinedCPUs);
+                            stageCPU.AddCPU(schedule.stageCPUs[s - 1u] + 1u);
+                            multiThreadService[nextBuffer]->SetCPUMaskThreadPool(stageCPU, n);
+                            multiThreadService[nextBuffer]->SetThreadNameThreadPool(stageName.Buffer(), n);
+                        }
+                        n++;
+                    }
+                }
+                err = multiThreadService[nextBuffer]->Start();
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to CreateThreads().");
+            }
+            if (!err.ErrorsCleared()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to Start() MultiThreadService.");
+            }
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed Reset(*) of the event semaphore");
+    }
+}
+
+bool PipelineScheduler::WaitForCounter(const volatile int64 * const counter,
+                                       const int64 target,
+                                       const PipelineCounters &counters,
+                                       const bool bounded) const {
+    uint64 waitStart = HighResolutionTimer::Counter();
+    bool reached = (Atomic::Load(counter, Atomic::MemoryOrderAcquire) >= target);
+    bool stop = false;
+    while ((!reached) && (!stop)) {
+        uint64 waited = (HighResolutionTimer::Counter() - waitStart);
+        if (waited > spinTicks) {
+            Sleep::MSec(1u);
+        }
+        stop = (Atomic::Load(&counters.stopping, Atomic::MemoryOrderRelaxed) != 0);
+        if ((bounded) && (waited > releaseWaitTicks)) {
+            stop = true;
+        }
+        reached = (Atomic::Load(counter, Atomic::MemoryOrderAcquire) >= target);
+    }
+    return reached;
+}
+
+bool PipelineScheduler::ExecuteStage(PipelineStageParam &param) {
+    const PipelineSchedule &schedule = *param.schedule;
+    PipelineCounters &counters = *param.counters;
+    uint32 stage = param.stage;
+    int64 cycle = param.cycle;
+    uint32 ring = schedule.numberOfStages + 1u;
+    uint32 slot = static_cast<uint32>(static_cast<uint64>(cycle) % ring);
+
+    //The previous stage shall have completed this cycle and the next stage shall have started the previous one
+    bool ready = true;
+    if (stage > 0u) {
+        ready = WaitForCounter(&counters.completed[stage - 1u], cycle + 1, counters, true);
+    }
+    if ((ready) && ((stage + 1u) < schedule.numberOfStages)) {
+        ready = WaitForCounter(&counters.started[stage + 1u], cycle, counters, true);
+    }
+    bool ok = true;
+    if (ready) {
+        uint64 cycleStartTicks;
+        if (stage == 0u) {
+            if (param.thread.period > 0u) {
+                WaitForRelease(param.thread);
+            }
+            cycleStartTicks = HighResolutionTimer::Counter();
+            counters.cycleStartTicks[slot] = cycleStartTicks;
+        }
+        else {
+            cycleStartTicks = counters.cycleStartTicks[slot];
+        }
+        Atomic::Store(&counters.started[stage], cycle + 1, Atomic::MemoryOrderRelease);
+
+        uint32 first = schedule.stageFirst[stage];
+        uint32 last = schedule.stageFirst[stage + 1u];
+        bool stopped = false;
+        for (uint32 g = 0u; (g < schedule.numberOfGates) && (ok) && (!stopped); g++) {
+            uint32 gate = schedule.gates[g];
+            if ((gate >= first) && (gate < last)) {
+                ok = ExecuteSingleCycle(&param.thread.executables[first], gate - first, cycleStartTicks);
+                if (ok) {
+                    //Do not overwrite the data before the consumer stage has completed the previous cycle (only fails if stopping)
+                    stopped = !WaitForCounter(&counters.completed[schedule.gateStages[g]], cycle, counters, false);
+                }
+                first = gate;
+            }
+        }
+        if ((ok) && (!stopped)) {
+            ok = ExecuteSingleCycle(&param.thread.executables[first], last - first, cycleStartTicks);
+        }
+        //A cycle interrupted by the stopping is never completed, so that the next stages do not execute it with partial data
+        if (!stopped) {
+            Atomic::Store(&counters.completed[stage], cycle + 1, Atomic::MemoryOrderRelease);
+            param.cycle++;
+
+            uint64 tmp = (HighResolutionTimer::Counter() - cycleStartTicks);
+            uint32 latency = static_cast<uint32>(HighResolutionTimer::TicksToMicroSeconds(tmp));
+            counters.latency[stage] = latency;
+            if (latency > counters.maxLatency[stage]) {
+                counters.maxLatency[stage] = latency;
+            }
+            if (param.thread.budgetMonitor != NULL_PTR(CycleBudgetMonitor *)) {
+                (void) CheckCycleBudget(*param.thread.budgetMonitor, cycleStartTicks);
+            }
+        }
+    }
+    return ok;
+}
+
+/*lint -e{1764} EmbeddedServiceMethodBinderI callback method pointer prototype requires a non constant ExecutionInfo*/
+ErrorManagement::ErrorType PipelineScheduler::Execute(ExecutionInfo & information) {
+    ErrorManagement::ErrorType ret;
+    uint32 threadNumber = information.GetThreadNumber();
+    uint32 idx = realTimeApplicationT->GetIndex();
+
+    if (information.GetStage() == MARTe::ExecutionInfo::StartupStage) {
+        ret = eventSem.Wait(TTInfiniteWait);
+    }
+    else if (information.GetStage() == MARTe::ExecutionInfo::MainStage) {
+        if ((stageInfo[idx] != NULL_PTR(PipelineStageParam *)) && (threadNumber < numberOfStageThreads[idx])) {
+            PipelineStageParam &param = stageInfo[idx][threadNumber];
+            int64 cycle = param.cycle;
+            bool ok = ExecuteStage(param);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to ExecuteStage().");
+                if (errorMessage.IsValid()) {
+                    if (MessageI::SendMessage(errorMessage, this, errorMessageDestination) != ErrorManagement::NoError) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Failed to SendMessage.");
+                    }
+                }
+            }
+            if ((param.stage == 0u) && (param.cycle != cycle)) {
+                uint32 absTime = 0u;
+                if (param.thread.lastCycleTimeStamp != 0u) {
+                    uint64 tmp = (HighResolutionTimer::Counter() - param.thread.lastCycleTimeStamp);
+                    absTime = static_cast<uint32>(HighResolutionTimer::TicksToMicroSeconds(tmp));  //us
+                    if (param.thread.cycleTimeHistogram != NULL_PTR(LatencyHistogram *)) {
+                        param.thread.cycleTimeHistogram->Add(absTime);
+                    }
+                }
+                uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
+                if (!MemoryOperationsHelper::Copy(param.thread.cycleTime, &absTime, sizeToCopy)) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Could not copy cycle time information.");
+                }
+                param.thread.lastCycleTimeStamp = HighResolutionTimer::Counter();
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::FatalError, "PipelineStageParam is NULL.");
+        }
+    }
+    else {
+        //Other states not used.
+    }
+    return ret;
+}
+
+bool PipelineScheduler::ExportData(StructuredDataI & data) {
+    bool ret = GAMScheduler::ExportData(data);
+    if ((ret) && (realTimeApplicationT.IsValid())) {
+        uint32 idx = realTimeApplicationT->GetIndex();
+        for (uint32 n = 0u; (n < numberOfStageThreads[idx]) && (ret); n++) {
+            const PipelineStageParam &param = stageInfo[idx][n];
+            uint32 numberOfStages = param.schedule->numberOfStages;
+            if ((param.stage == 0u) && (numberOfStages > 1u)) {
+                ret = data.CreateRelative(param.name);
+                if (ret) {
+                    Vector<uint32> latency(param.counters->latency, numberOfStages);
+                    ret = data.Write("StageLatency", latency);
+                }
+                if (ret) {
+                    Vector<uint32> maxLatency(param.counters->maxLatency, numberOfStages);
+                    ret = data.Write("StageMaxLatency", maxLatency);
+                }
+                if (ret) {
+                    ret = data.MoveToAncestor(1u);
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+CLASS_REGISTER(PipelineScheduler, "1.0")
+
+}
@@ -0,0 +1,327 @@
+/**
+ * @file PipelineScheduler.h
+ * @brief Header file for class PipelineScheduler
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class PipelineScheduler
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PIPELINESCHEDULER_H_
+#define PIPELINESCHEDULER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GAMScheduler.h"
+#include "RealTimeThread.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief POD to store how the ExecutableIs of a thread are split in pipeline stages.
+ */
+struct PipelineSchedule {
+    /**
+     * The number of stages (1 if the thread is not split).
+     */
+    uint32 numberOfStages;
+
+    /**
+     * The ExecutableIs of the stage s are [stageFirst[s], stageFirst[s + 1]) (numberOfStages + 1 elements).
+     */
+    uint32 *stageFirst;
+
+    /**
+     * The index of the ExecutableIs (output brokers) that shall wait for a later stage before being executed.
+     */
+    uint32 *gates;
+
+    /**
+     * The stage that shall have completed the previous cycle before each gate is executed.
+     */
+    uint32 *gateStages;
+
+    /**
+     * The number of gates.
+     */
+    uint32 numberOfGates;
+
+    /**
+     * The CPU number of each stage after the first one (numberOfStages - 1 elements).
+     */
+    uint32 *stageCPUs;
+};
+
+/**
+ * @brief POD with the cycle counters shared by the stages of a thread.
+ */
+struct PipelineCounters {
+    /**
+     * The number of cycles started by each stage.
+     */
+    volatile int64 *started;
+
+    /**
+     * The number of cycles completed by each stage.
+     */
+    volatile int64 *completed;
+
+    /**
+     * The HighResolutionTimer::Counter at the beginning of the last numberOfStages + 1 cycles (indexed by cycle % (numberOfStages + 1)).
+     */
+    uint64 *cycleStartTicks;
+
+    /**
+     * The end-to-end latency of the last cycle at the end of each stage, in micro-seconds.
+     */
+    uint32 *latency;
+
+    /**
+     * The maximum end-to-end latency at the end of each stage, in micro-seconds.
+     */
+    uint32 *maxLatency;
+
+    /**
+     * Set (to 1) to release the stages from any wait while the state is being stopped.
+     */
+    volatile int32 stopping;
+};
+
+/**
+ * @brief Parameters of each pipeline stage thread.
+ */
+struct PipelineStageParam {
+    /**
+     * The thread parameters (the release and the cycle time are only used by the first stage).
+     */
+    RTThreadParam thread;
+
+    /**
+     * The schedule of the thread.
+     */
+    const PipelineSchedule *schedule;
+
+    /**
+     * The counters of the thread.
+     */
+    PipelineCounters *counters;
+
+    /**
+     * The name of the RealTimeThread.
+     */
+    const char8 *name;
+
+    /**
+     * The stage executed by this thread.
+     */
+    uint32 stage;
+
+    /**
+     * The number of cycles completed by this stage.
+     */
+    int64 cycle;
+};
+
+/**
+ * @brief A GAMScheduler which splits the Functions of a RealTimeThread in pipeline stages, each executed by its own
+ * thread, so that the stage s of the cycle n + 1 is executed at the same time as the stage s + 1 of the cycle n.
+ * @details The stages are configured in the RealTimeThread (PipelineStages and PipelineCPUs). The first stage runs in
+ * the RealTimeThread itself (with its CPUs, Period and SchedDeadline) and each of the other stages runs in a thread
+ * pinned to its PipelineCPUs element, with the same real-time priority and stack size.
+ *
+ * The stages are connected automatically through lock-free cycle counters:
+ *  - the stage s only starts the cycle n after the stage s - 1 completed it;
+ *  - the stage s only starts the cycle n after the stage s + 1 started the cycle n - 1 (so that a stage is at most one cycle ahead);
+ *  - the output brokers of a GAM which writes a signal used by a later stage t only write the cycle n after the stage t
+ *    completed the cycle n - 1 (so that the signal is never overwritten while being read).
+ * The GAMs of a stage shall not write a GAMDataSource signal used by a previous stage (the application is refused). Any other
+ * DataSourceI used by more than one stage is shared as if the stages were different RealTimeThreads.
+ *
+ * The execution time signals of the TimingDataSource (GAM_ReadTime, GAM_ExecTime and GAM_WriteTime) are measured from the
+ * beginning of the cycle in the first stage, i.e. they are the end-to-end latency of the cycle. The latency at the end of
+ * each stage is also exported (see ExportData). Threads without PipelineStages are executed as by the GAMScheduler.
+ *
+ * The syntax in the configuration stream is the same as for the GAMScheduler:
+ *
+ * +Scheduler = {\n
+ *    Class = PipelineScheduler
+ *    TimingDataSource = "Name of the TimingDataSource"
+ *    +ErrorMessage = { //Optional
+ *        Class = Message
+ *        ...
+ *    }
+ * }\n
+ */
+class PipelineScheduler: public GAMScheduler {
+
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor
+     */
+    PipelineScheduler();
+
+    /**
+     * @brief Destructor. Stops the stage threads.
+     */
+    virtual ~PipelineScheduler();
+
+    /**
+     * @brief Calls GAMSchedulerI::ConfigureScheduler and splits the ExecutableIs of the threads with PipelineStages.
+     * @param[in] realTimeAppIn the RealTimeApplication using this scheduler.
+     * @return true if the GAMSchedulerI::ConfigureScheduler succeeds, all the PipelineStages are GAMs of the thread (in the
+     * execution order) and no stage writes a GAMDataSource signal used by a previous stage.
+     */
+    virtual bool ConfigureScheduler(Reference realTimeAppIn);
+
+    /**
+     * @brief Releases the stages from any wait and stops the execution of the current state.
+     * @see GAMScheduler::StopCurrentStateExecution
+     */
+    virtual ErrorManagement::ErrorType StopCurrentStateExecution();
+
+    /**
+     * @brief Callback function for the MultiThreadService. Executes one cycle of a pipeline stage.
+     * @param[in] information (see EmbeddedThread)
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &information);
+
+    /**
+     * @brief Releases the stages from any wait before GAMScheduler::Purge.
+     * @see GAMScheduler::Purge
+     */
+    virtual void Purge(ReferenceContainer &purgeList);
+
+    /**
+     * @brief Exports, for each thread of the current state with PipelineStages, the latency at the end of each stage.
+     * @details The following is added: ThreadName = { StageLatency = { ... } StageMaxLatency = { ... } } (micro-seconds).
+     * @param[out] data where to export.
+     * @return true if the data can be exported.
+     */
+    virtual bool ExportData(StructuredDataI & data);
+
+protected:
+
+    /**
+     * @brief Starts the stage threads for the next state.
+     */
+    virtual void CustomPrepareNextState();
+
+private:
+
+    /**
+     * @brief Splits the ExecutableIs of a thread in the stages configured in the RealTimeThread.
+     * @param[in] threadElement the RealTimeThread.
+     * @param[in] thread the scheduled thread.
+     * @param[out] schedule the pipeline schedule.
+     * @return true if the schedule can be computed.
+     */
+    bool BuildPipelineSchedule(ReferenceT<RealTimeThread> threadElement,
+                               const ScheduledThread &thread,
+                               PipelineSchedule &schedule) const;
+
+    /**
+     * @brief Waits for a counter to reach a target.
+     * @param[in] counter the counter.
+     * @param[in] target the value to be reached.
+     * @param[in] counters the counters of the thread (to detect the stopping).
+     * @param[in] bounded if true gives up after PIPELINE_SCHEDULER_RELEASE_WAIT_USEC.
+     * @return true if the counter reached the target.
+     */
+    bool WaitForCounter(const volatile int64 * const counter,
+                        const int64 target,
+                        const PipelineCounters &counters,
+                        const bool bounded) const;
+
+    /**
+     * @brief Executes one cycle of a stage.
+     * @param[in,out] param the stage parameters.
+     * @return true if all the ExecutableIs were successfully executed.
+     */
+    bool ExecuteStage(PipelineStageParam &param);
+
+    /**
+     * @brief Releases the stages of a buffer from any wait.
+     * @param[in] buffer the index of the buffer.
+     */
+    void StopStages(const uint32 buffer);
+
+    /**
+     * @brief Frees the stages of a buffer.
+     * @param[in] buffer the index of the buffer.
+     */
+    void FreeStages(const uint32 buffer);
+
+    /**
+     * The pipeline schedule of each thread of each state.
+     */
+    PipelineSchedule **schedules;
+
+    /**
+     * The number of states in schedules.
+     */
+    uint32 numberOfScheduledStates;
+
+    /**
+     * The parameters of each stage thread, for the current and next state.
+     */
+    PipelineStageParam *stageInfo[2];
+
+    /**
+     * The number of elements of each stageInfo.
+     */
+    uint32 numberOfStageThreads[2];
+
+    /**
+     * The counters of each thread, for the current and next state.
+     */
+    PipelineCounters *stageCounters[2];
+
+    /**
+     * The number of elements of each stageCounters.
+     */
+    uint32 numberOfCounters[2];
+
+    /**
+     * The HighResolutionTimer ticks of the busy waiting before sleeping.
+     */
+    uint64 spinTicks;
+
+    /**
+     * The HighResolutionTimer ticks of a bounded wait.
+     */
+    uint64 releaseWaitTicks;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* PIPELINESCHEDULER_H_ */
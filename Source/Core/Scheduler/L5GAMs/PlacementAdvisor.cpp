@@ -0,0 +1,449 @@
+/**
+ * @file PlacementAdvisor.cpp
+ * @brief Source file for class PlacementAdvisor
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PlacementAdvisor (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "GAM.h"
+#include "GAMDataDependencies.h"
+#include "LatencyHistogram.h"
+#include "PlacementAdvisor.h"
+#include "Processor.h"
+#include "RealTimeState.h"
+#include "RealTimeThread.h"
+#include "ReferenceContainerFilterReferencesTemplate.h"
+#include "TimingDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+namespace {
+/**
+ * The proposed CPU of the threads which are not placed.
+ */
+const uint32 PLACEMENT_ADVISOR_NOT_PLACED = 0xFFFFFFFFu;
+
+/**
+ * The capacity of the fastest CPUs (see Processor::Capacity).
+ */
+const uint64 PLACEMENT_ADVISOR_FULL_CAPACITY = 1024u;
+
+/**
+ * @brief Gets the cluster of a CPU.
+ * @param[in] cpu the CPU (starting at 0, whereas ProcessorType::CPUEnabled numbers the CPUs from 1).
+ * @return the cluster of \a cpu (0 if it is not found).
+ */
+uint32 PlacementAdvisorCluster(const uint32 cpu) {
+    uint32 cluster = 0u;
+    uint32 numberOfClusters = Processor::NumberOfClusters();
+    bool found = false;
+    for (uint32 c = 0u; (c < numberOfClusters) && (!found); c++) {
+        found = Processor::ClusterCPUs(c).CPUEnabled(cpu + 1u);
+        if (found) {
+            cluster = c;
+        }
+    }
+    return cluster;
+}
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+PlacementAdvisor::PlacementAdvisor() {
+    numberOfThreads = 0u;
+    threadNames = NULL_PTR(StreamString *);
+    threadCosts = NULL_PTR(uint32 *);
+    configuredCPUs = NULL_PTR(ProcessorType *);
+    proposedCPUs = NULL_PTR(uint32 *);
+    fixedThreads = NULL_PTR(bool *);
+    traffic = NULL_PTR(uint32 *);
+    costMeasured = false;
+    predictedCycleTime = 0u;
+}
+
+PlacementAdvisor::~PlacementAdvisor() {
+    Clean();
+}
+
+void PlacementAdvisor::Clean() {
+    if (threadNames != NULL_PTR(StreamString *)) {
+        delete[] threadNames;
+        threadNames = NULL_PTR(StreamString *);
+    }
+    if (threadCosts != NULL_PTR(uint32 *)) {
+        delete[] threadCosts;
+        threadCosts = NULL_PTR(uint32 *);
+    }
+    if (configuredCPUs != NULL_PTR(ProcessorType *)) {
+        delete[] configuredCPUs;
+        configuredCPUs = NULL_PTR(ProcessorType *);
+    }
+    if (proposedCPUs != NULL_PTR(uint32 *)) {
+        delete[] proposedCPUs;
+        proposedCPUs = NULL_PTR(uint32 *);
+    }
+    if (fixedThreads != NULL_PTR(bool *)) {
+        delete[] fixedThreads;
+        fixedThreads = NULL_PTR(bool *);
+    }
+    if (traffic != NULL_PTR(uint32 *)) {
+        delete[] traffic;
+        traffic = NULL_PTR(uint32 *);
+    }
+    numberOfThreads = 0u;
+}
+
+bool PlacementAdvisor::Initialise(ReferenceT<RealTimeApplication> realTimeApp,
+                                  const char8 * const stateNameIn) {
+    bool ret = realTimeApp.IsValid();
+    ReferenceT<RealTimeState> state;
+    if (ret) {
+        stateName = stateNameIn;
+        ReferenceContainer states;
+        ret = realTimeApp->GetStates(states);
+        uint32 numberOfStates = states.Size();
+        for (uint32 s = 0u; (s < numberOfStates) && (ret) && (!state.IsValid()); s++) {
+            ReferenceT<RealTimeState> candidate = states.Get(s);
+            if (candidate.IsValid()) {
+                if (stateName == candidate->GetName()) {
+                    state = candidate;
+                }
+            }
+        }
+        if (ret) {
+            ret = state.IsValid();
+        }
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Could not find the state %s", stateName.Buffer());
+        }
+    }
+    ReferenceT<ReferenceContainer> threadContainer;
+    if (ret) {
+        threadContainer = state->Find("Threads");
+        ret = threadContainer.IsValid();
+    }
+    ReferenceT<TimingDataSource> timing;
+    if (ret) {
+        ReferenceT<ReferenceContainer> data = realTimeApp->Find("Data");
+        if (data.IsValid()) {
+            ReferenceContainer timingDataSources;
+            ReferenceContainerFilterReferencesTemplate<TimingDataSource> timingFilter(1, ReferenceContainerFilterMode::RECURSIVE);
+            data->Find(timingDataSources, timingFilter);
+            if (timingDataSources.Size() > 0u) {
+                timing = timingDataSources.Get(0u);
+            }
+        }
+        Clean();
+        numberOfThreads = threadContainer->Size();
+        threadNames = new StreamString[numberOfThreads];
+        threadCosts = new uint32[numberOfThreads];
+        configuredCPUs = new ProcessorType[numberOfThreads];
+        proposedCPUs = new uint32[numberOfThreads];
+        fixedThreads = new bool[numberOfThreads];
+        traffic = new uint32[numberOfThreads * numberOfThreads];
+        for (uint32 i = 0u; i < (numberOfThreads * numberOfThreads); i++) {
+            traffic[i] = 0u;
+        }
+        costMeasured = false;
+        predictedCycleTime = 0u;
+    }
+    //All the GAMs of the state, thread after thread, and the thread of each one
+    ReferenceContainer gams;
+    uint32 *gamThreads = NULL_PTR(uint32 *);
+    uint32 *gamCounts = NULL_PTR(uint32 *);
+    if (ret) {
+        gamCounts = new uint32[numberOfThreads];
+    }
+    for (uint32 t = 0u; (t < numberOfThreads) && (ret); t++) {
+        ReferenceT<RealTimeThread> thread = threadContainer->Get(t);
+        ret = thread.IsValid();
+        if (ret) {
+            threadNames[t] = thread->GetName();
+            threadCosts[t] = 0u;
+            configuredCPUs[t] = thread->GetCPU();
+            proposedCPUs[t] = PLACEMENT_ADVISOR_NOT_PLACED;
+            fixedThreads[t] = ((thread->GetNumberOfWorkers() > 0u) || (thread->GetNumberOfPipelineStages() > 0u));
+            uint32 before = gams.Size();
+            ret = thread->GetGAMs(gams);
+            gamCounts[t] = gams.Size() - before;
+        }
+        for (uint32 g = gams.Size() - gamCounts[t]; (g < gams.Size()) && (ret) && (timing.IsValid()); g++) {
+            ReferenceT<GAM> gam = gams.Get(g);
+            StreamString signalName;
+            if (gam.IsValid()) {
+                signalName = gam->GetName();
+                signalName += "_WriteTime";
+            }
+            uint32 signalIdx = 0u;
+            if (timing->GetSignalIndex(signalIdx, signalName.Buffer())) {
+                const LatencyHistogram *histogram = timing->GetSignalHistogram(signalIdx);
+                if (histogram != NULL_PTR(LatencyHistogram *)) {
+                    if (histogram->GetCount() > 0u) {
+                        costMeasured = true;
+                        uint32 writeTime = histogram->GetP99();
+                        if (writeTime > threadCosts[t]) {
+                            threadCosts[t] = writeTime;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    if ((ret) && (!costMeasured)) {
+        for (uint32 t = 0u; t < numberOfThreads; t++) {
+            threadCosts[t] = gamCounts[t];
+        }
+    }
+    uint32 numberOfGAMs = gams.Size();
+    if (ret) {
+        gamThreads = new uint32[numberOfGAMs];
+        uint32 g = 0u;
+        for (uint32 t = 0u; t < numberOfThreads; t++) {
+            for (uint32 n = 0u; n < gamCounts[t]; n++) {
+                gamThreads[g] = t;
+                g++;
+            }
+        }
+    }
+    if (ret) {
+        GAMDataDependencies dependencies;
+        ret = dependencies.Initialise(realTimeApp, gams);
+        for (uint32 a = 0u; (a < numberOfGAMs) && (ret); a++) {
+            for (uint32 b = 0u; b < numberOfGAMs; b++) {
+                uint32 ta = gamThreads[a];
+                uint32 tb = gamThreads[b];
+                if (ta != tb) {
+                    if ((dependencies.WritesSignal(a, b)) || (dependencies.WritesDataSource(a, b))) {
+                        traffic[(ta * numberOfThreads) + tb]++;
+                        traffic[(tb * numberOfThreads) + ta]++;
+                    }
+                }
+            }
+        }
+        if (!ret) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not collect the data dependencies of the GAMs of the state %s", stateName.Buffer());
+        }
+    }
+    if (gamThreads != NULL_PTR(uint32 *)) {
+        delete[] gamThreads;
+    }
+    if (gamCounts != NULL_PTR(uint32 *)) {
+        delete[] gamCounts;
+    }
+    return ret;
+}
+
+bool PlacementAdvisor::Advise(const ProcessorType &allowedCPUs,
+                              const uint32 crossClusterCost) {
+    uint32 numberOfCPUs = Processor::Available();
+    if (numberOfCPUs > PROCESSOR_TYPE_MAX_CPUS) {
+        numberOfCPUs = PROCESSOR_TYPE_MAX_CPUS;
+    }
+    //Restricted to the isolated CPUs if any of the allowed ones is isolated
+    ProcessorType isolated = Processor::IsolatedCPUs();
+    bool useIsolated = false;
+    uint32 numberOfCandidates = 0u;
+    for (uint32 cpu = 0u; cpu < numberOfCPUs; cpu++) {
+        if (allowedCPUs.CPUEnabled(cpu + 1u)) {
+            numberOfCandidates++;
+            if (isolated.CPUEnabled(cpu + 1u)) {
+                useIsolated = true;
+            }
+        }
+    }
+    bool ret = (numberOfCandidates > 0u);
+    if (!ret) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "None of the allowed CPUs is available");
+    }
+    uint32 *candidates = NULL_PTR(uint32 *);
+    uint32 *clusters = NULL_PTR(uint32 *);
+    uint64 *capacities = NULL_PTR(uint64 *);
+    uint64 *loads = NULL_PTR(uint64 *);
+    if (ret) {
+        candidates = new uint32[numberOfCandidates];
+        clusters = new uint32[numberOfCandidates];
+        capacities = new uint64[numberOfCandidates];
+        loads = new uint64[numberOfCandidates];
+        uint32 n = 0u;
+        for (uint32 cpu = 0u; cpu < numberOfCPUs; cpu++) {
+            if (allowedCPUs.CPUEnabled(cpu + 1u)) {
+                if ((!useIsolated) || (isolated.CPUEnabled(cpu + 1u))) {
+                    candidates[n] = cpu;
+                    clusters[n] = PlacementAdvisorCluster(cpu);
+                    capacities[n] = Processor::Capacity(cpu);
+                    if (capacities[n] == 0u) {
+                        capacities[n] = PLACEMENT_ADVISOR_FULL_CAPACITY;
+                    }
+                    loads[n] = 0u;
+                    n++;
+                }
+            }
+        }
+        numberOfCandidates = n;
+    }
+    uint32 *order = NULL_PTR(uint32 *);
+    uint32 *threadCandidates = NULL_PTR(uint32 *);
+    if (ret) {
+        //The threads by decreasing cost (insertion sort, the number of threads is small)
+        order = new uint32[numberOfThreads];
+        threadCandidates = new uint32[numberOfThreads];
+        for (uint32 t = 0u; t < numberOfThreads; t++) {
+            uint32 j = t;
+            while ((j > 0u) && (threadCosts[order[j - 1u]] < threadCosts[t])) {
+                order[j] = order[j - 1u];
+                j--;
+            }
+            order[j] = t;
+            proposedCPUs[t] = PLACEMENT_ADVISOR_NOT_PLACED;
+            threadCandidates[t] = PLACEMENT_ADVISOR_NOT_PLACED;
+        }
+        for (uint32 o = 0u; o < numberOfThreads; o++) {
+            uint32 t = order[o];
+            bool placeable = !fixedThreads[t];
+            uint64 bestScore = 0u;
+            uint32 best = PLACEMENT_ADVISOR_NOT_PLACED;
+            for (uint32 c = 0u; (c < numberOfCandidates) && (placeable); c++) {
+                uint64 score = ((loads[c] + threadCosts[t]) * PLACEMENT_ADVISOR_FULL_CAPACITY) / capacities[c];
+                for (uint32 other = 0u; other < numberOfThreads; other++) {
+                    uint32 otherCandidate = threadCandidates[other];
+                    if (otherCandidate != PLACEMENT_ADVISOR_NOT_PLACED) {
+                        if (clusters[otherCandidate] != clusters[c]) {
+                            score += static_cast<uint64>(traffic[(t * numberOfThreads) + other]) * crossClusterCost;
+                        }
+                    }
+                }
+                if ((best == PLACEMENT_ADVISOR_NOT_PLACED) || (score < bestScore)) {
+                    best = c;
+                    bestScore = score;
+                }
+            }
+            if (best != PLACEMENT_ADVISOR_NOT_PLACED) {
+                threadCandidates[t] = best;
+                proposedCPUs[t] = candidates[best];
+                loads[best] += threadCosts[t];
+            }
+        }
+        predictedCycleTime = 0u;
+        for (uint32 c = 0u; c < numberOfCandidates; c++) {
+            uint64 scaled = (loads[c] * PLACEMENT_ADVISOR_FULL_CAPACITY) / capacities[c];
+            if (scaled > predictedCycleTime) {
+                predictedCycleTime = static_cast<uint32>(scaled);
+            }
+        }
+    }
+    if (candidates != NULL_PTR(uint32 *)) {
+        delete[] candidates;
+    }
+    if (clusters != NULL_PTR(uint32 *)) {
+        delete[] clusters;
+    }
+    if (capacities != NULL_PTR(uint64 *)) {
+        delete[] capacities;
+    }
+    if (loads != NULL_PTR(uint64 *)) {
+        delete[] loads;
+    }
+    if (order != NULL_PTR(uint32 *)) {
+        delete[] order;
+    }
+    if (threadCandidates != NULL_PTR(uint32 *)) {
+        delete[] threadCandidates;
+    }
+    return ret;
+}
+
+uint32 PlacementAdvisor::GetNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+uint32 PlacementAdvisor::GetThreadCost(const uint32 thread) const {
+    uint32 cost = 0u;
+    if (thread < numberOfThreads) {
+        cost = threadCosts[thread];
+    }
+    return cost;
+}
+
+bool PlacementAdvisor::IsCostMeasured() const {
+    return costMeasured;
+}
+
+ProcessorType PlacementAdvisor::GetThreadCPUs(const uint32 thread) const {
+    ProcessorType cpus(UndefinedCPUs);
+    if (thread < numberOfThreads) {
+        if (proposedCPUs[thread] == PLACEMENT_ADVISOR_NOT_PLACED) {
+            cpus = configuredCPUs[thread];
+        }
+        else {
+            cpus.AddCPU(proposedCPUs[thread] + 1u);
+        }
+    }
+    return cpus;
+}
+
+uint32 PlacementAdvisor::GetPredictedCycleTime() const {
+    return predictedCycleTime;
+}
+
+bool PlacementAdvisor::GetConfiguration(StreamString &fragment) {
+    bool ret = fragment.Printf("+States = {\n    +%s = {\n        +Threads = {\n", stateName.Buffer());
+    for (uint32 t = 0u; (t < numberOfThreads) && (ret); t++) {
+        char8 previous[64];
+        if (!configuredCPUs[t].ToList(&previous[0u], static_cast<uint32>(sizeof(previous)))) {
+            previous[0u] = '\0';
+        }
+        ret = fragment.Printf("            +%s = {\n", threadNames[t].Buffer());
+        if (ret) {
+            if (proposedCPUs[t] == PLACEMENT_ADVISOR_NOT_PLACED) {
+                ret = fragment.Printf("                //Not placed, CPUs = %s\n", previous);
+            }
+            else {
+                uint32 cpu = proposedCPUs[t];
+                ret = fragment.Printf("                CPUs = \"%u-%u\" //Cost = %u, previous CPUs = %s\n", cpu, cpu, threadCosts[t], previous);
+            }
+        }
+        if (ret) {
+            ret = fragment.Printf("%s", "            }\n");
+        }
+    }
+    if (ret) {
+        ret = fragment.Printf("        }\n    }\n} //Predicted cycle time = %u\n", predictedCycleTime);
+    }
+    return ret;
+}
+
+}
@@ -0,0 +1,224 @@
+/**
+ * @file PlacementAdvisor.h
+ * @brief Header file for class PlacementAdvisor
+ * @date 15/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class PlacementAdvisor
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PLACEMENTADVISOR_H_
+#define PLACEMENTADVISOR_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ProcessorType.h"
+#include "RealTimeApplication.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The default cost (in microseconds) of each pair of GAMs, in different threads placed on different clusters, which exchange data.
+ */
+static const uint32 PLACEMENT_ADVISOR_CROSS_CLUSTER_COST = 2u;
+
+/**
+ * @brief Proposes the CPU of each RealTimeThread of a state from the measured cost of its GAMs, the data exchanged
+ * between the threads and the CPU topology.
+ * @details Initialise collects, for each thread of the state:
+ *  - the cost: the largest P99 of the GAM_NAME_WriteTime histograms (see TimingDataSource Histograms) of its GAMs, i.e. the
+ *    time from the start of the cycle until the last output broker of the thread was executed. If the TimingDataSource has no
+ *    histograms (or no samples yet) the cost of every thread is its number of GAMs;
+ *  - the traffic with every other thread: the number of pairs of GAMs (one in each thread) where one writes data read or written
+ *    by the other (see GAMDataDependencies).
+ *
+ * Advise then places the threads, by decreasing cost, each one on the CPU (of the allowed ones, restricted to the isolated CPUs
+ * if any of them is isolated, see Processor::IsolatedCPUs) where it would finish first: the cost of the threads already on the CPU
+ * plus its own, scaled by the capacity of the CPU (see Processor::Capacity), plus the cross-cluster cost for each pair of
+ * communicating GAMs in threads already placed on another cluster (see Processor::ClusterCPUs). The threads with WorkerCPUs or
+ * PipelineStages keep their CPUs.
+ *
+ * GetConfiguration writes the proposal as a configuration fragment, to be merged in the RealTimeApplication configuration:
+ * <pre>
+ * +States = {
+ *     +State1 = {
+ *         +Threads = {
+ *             +Thread1 = {
+ *                 CPUs = "2-2" //Cost = 120, previous CPUs = 0
+ *             }
+ *             ...
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * The assignment of the GAMs to the threads is not changed, given that it defines the order and the synchronisation of the GAMs.
+ */
+class DLL_API PlacementAdvisor {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetNumberOfThreads() == 0
+     */
+    PlacementAdvisor();
+
+    /**
+     * @brief Destructor.
+     */
+    ~PlacementAdvisor();
+
+    /**
+     * @brief Collects the cost of the threads of a state and the traffic between them (see class description).
+     * @param[in] realTimeApp the configured RealTimeApplication (which should have executed the state with a TimingDataSource with Histograms).
+     * @param[in] stateNameIn the name of the state.
+     * @return true if the state exists and the data dependencies of its GAMs can be collected.
+     * @pre
+     *   GetNumberOfThreads() == 0
+     */
+    bool Initialise(ReferenceT<RealTimeApplication> realTimeApp,
+                    const char8 * const stateNameIn);
+
+    /**
+     * @brief Places the threads on the CPUs (see class description).
+     * @param[in] allowedCPUs the CPUs that can be used.
+     * @param[in] crossClusterCost the cost of each pair of communicating GAMs placed on different clusters.
+     * @return true if at least one of the \a allowedCPUs is available.
+     */
+    bool Advise(const ProcessorType &allowedCPUs,
+                const uint32 crossClusterCost = PLACEMENT_ADVISOR_CROSS_CLUSTER_COST);
+
+    /**
+     * @brief Gets the number of threads of the state.
+     * @return the number of threads of the state.
+     */
+    uint32 GetNumberOfThreads() const;
+
+    /**
+     * @brief Gets the cost of a thread.
+     * @param[in] thread the thread index (< GetNumberOfThreads()).
+     * @return the cost of the thread (in microseconds, or in GAMs if the costs are not measured).
+     */
+    uint32 GetThreadCost(const uint32 thread) const;
+
+    /**
+     * @brief Checks if the costs were measured.
+     * @return true if the costs are the P99 of the GAM timing histograms, false if they are the number of GAMs.
+     */
+    bool IsCostMeasured() const;
+
+    /**
+     * @brief Gets the CPU proposed for a thread.
+     * @param[in] thread the thread index (< GetNumberOfThreads()).
+     * @return the proposed CPU or the configured CPUs if the thread is not placed (see class description).
+     * @pre
+     *   Advise()
+     */
+    ProcessorType GetThreadCPUs(const uint32 thread) const;
+
+    /**
+     * @brief Gets the predicted cycle time, i.e. the largest load of a CPU scaled by its capacity.
+     * @return the predicted cycle time (in the units of GetThreadCost).
+     * @pre
+     *   Advise()
+     */
+    uint32 GetPredictedCycleTime() const;
+
+    /**
+     * @brief Writes the proposal as a configuration fragment (see class description).
+     * @param[out] fragment where the fragment is written.
+     * @return true if the fragment was written.
+     * @pre
+     *   Advise()
+     */
+    bool GetConfiguration(StreamString &fragment);
+
+private:
+
+    /**
+     * @brief Frees the memory of the threads.
+     */
+    void Clean();
+
+    /**
+     * The name of the state.
+     */
+    StreamString stateName;
+
+    /**
+     * The number of threads.
+     */
+    uint32 numberOfThreads;
+
+    /**
+     * The names of the threads.
+     */
+    StreamString *threadNames;
+
+    /**
+     * The cost of each thread.
+     */
+    uint32 *threadCosts;
+
+    /**
+     * The configured CPUs of each thread.
+     */
+    ProcessorType *configuredCPUs;
+
+    /**
+     * The CPU proposed for each thread (0xFFFFFFFF if the thread is not placed).
+     */
+    uint32 *proposedCPUs;
+
+    /**
+     * True for the threads which keep their CPUs (with WorkerCPUs or PipelineStages).
+     */
+    bool *fixedThreads;
+
+    /**
+     * The traffic between each pair of threads (numberOfThreads * numberOfThreads).
+     */
+    uint32 *traffic;
+
+    /**
+     * True if the costs were measured.
+     */
+    bool costMeasured;
+
+    /**
+     * The predicted cycle time.
+     */
+    uint32 predictedCycleTime;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* PLACEMENTADVISOR_H_ */